@@ -0,0 +1,313 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+#include <functional>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2c.h>
+
+/**
+ * @brief Transaction completion callback. Called from I2C queue thread with transfer status, 0 for no errors
+ */
+using I2cCallback = std::function<void(int status)>;
+
+/**
+ * @brief Scheduling class of I2C transaction. Queued transactions of higher class always run first
+ */
+enum class I2cPriority : uint8_t
+{
+    High = 0,   ///< Sample reads with deadline of one sample period
+    Normal = 1, ///< FIFO reads with deadline of several sample periods
+    Low = 2,    ///< Slow environmental sensors and housekeeping
+};
+
+/**
+ * @brief Register read/write transaction executed by I2C queue. Owned by the caller and reused for every transfer,
+ *        so queueing requires no allocation.
+ */
+struct I2cTransaction
+{
+    uint8_t address;            ///< Device address
+    uint8_t registerId;         ///< First register to read or write
+    uint8_t *data;              ///< Data buffer. Must stay valid until callback is called
+    uint16_t length;            ///< Number of bytes to read or write
+    bool write;                 ///< true for register write, false for register read
+    I2cCallback callback;       ///< Completion callback
+    std::atomic<bool> pending;  ///< Set while transaction is queued or executed
+    uint32_t busCycles;         ///< CPU cycles spent on the bus by the last transfer. Valid in callback
+
+    I2cPriority priority;       ///< Scheduling class
+    uint32_t deadlineUs;        ///< Deadline relative to submit time, 0 for none. Used for ordering within class
+    uint16_t chunkSize;         ///< Maximum bytes per bus transfer, 0 for single transfer. Only for FIFO data
+                                ///< registers: register address is not advanced between chunks
+
+    uint32_t queuedAt;          ///< Cycle counter when transaction was submitted
+    uint32_t startedAt;         ///< Cycle counter of the first bus transfer
+    uint32_t due;               ///< Cycle counter of absolute deadline
+    uint16_t done;              ///< Bytes already transferred by previous chunks
+};
+
+/**
+ * @brief Bus time accounting of one device, since the last statistics reset
+ */
+struct I2cDeviceStats
+{
+    uint8_t address;          ///< Device address
+    uint32_t transfers;       ///< Completed transactions
+    uint32_t busTimeUs;       ///< Time spent on the bus
+    uint32_t maxLatencyUs;    ///< Maximum time from submit to first bus transfer
+    uint32_t deadlineMisses;  ///< Transactions completed after their deadline
+    uint16_t recoveries;      ///< Successful sensor re-initializations since boot
+    uint16_t failedRecoveries; ///< Failed sensor re-initializations since boot
+};
+
+/**
+ * @brief Bus level statistics, since the last statistics reset
+ */
+struct I2cBusStats
+{
+    uint32_t speed;       ///< Bus speed, I2C_SPEED_*
+    uint32_t windowMs;    ///< Length of the statistics window
+    uint32_t busyUs;      ///< Bus time of all devices in the window
+    uint32_t rejected;    ///< Transactions rejected because queue was full or transaction was still pending
+    uint32_t busClears;   ///< Bus clear sequences since boot
+    size_t devices;       ///< Number of registered devices
+};
+
+/**
+ * @brief Per bus scheduler of I2C transactions. Transactions from all sensors on the bus are executed by queue
+ *        thread, so sensor interrupt handlers only queue a transfer and return. The next transaction is the one of
+ *        the highest priority class with the earliest deadline. Transactions split into chunks go back to the queue
+ *        after every chunk, so a long FIFO read can't hold the bus past the deadline of a short sample read.
+ *        Transfers use i2c_transfer_cb when driver supports it (CONFIG_I2C_CALLBACK), blocking EasyDMA transfer
+ *        otherwise.
+ *        After CONFIG_I2C_QUEUE_RECOVERY_ERRORS failed transfers in a row, queue thread clears the bus with
+ *        i2c_recover_bus (up to 9 SCL pulses and STOP) before the next transfer, so a slave holding SDA low is
+ *        released without involving sensor drivers. A callback transfer which does not complete in time is aborted
+ *        the same way. If the driver does not return the buffers after the bus clear either, the bus is marked
+ *        failed: the transaction completes with -ETIMEDOUT but stays pending in a quarantine slot, so its buffer is
+ *        not reused while the driver may still write to it, and the following transfers fail without touching the
+ *        driver until sensor recovery resets the controller with ResetController.
+ */
+class I2cQueue
+{
+    constexpr static size_t MaxTransactions = 16; ///< Maximum number of queued transactions per bus
+    constexpr static size_t MaxDevices = 8;       ///< Maximum number of devices per bus
+
+public:
+    constexpr static uint32_t TransferTimeoutMs = 100; ///< Wait for i2c_transfer_cb completion before the transfer is aborted
+
+    /**
+     * @brief Get queue of I2C bus. Queue thread is started on first use.
+     *
+     * @param bus I2C bus device
+     * @return I2cQueue& queue of the bus
+     */
+    static I2cQueue &ForBus(const device *bus);
+
+    /**
+     * @brief Get number of started bus queues
+     */
+    static size_t Count();
+
+    /**
+     * @brief Get started bus queue
+     *
+     * @param index queue index, less than Count()
+     * @return I2cQueue& queue of the bus
+     */
+    static I2cQueue &At(size_t index);
+
+    /**
+     * @brief Register device on the bus and configure bus speed. Bus runs at the lowest maximum speed of its
+     *        devices, and in Fast-mode Plus only with CONFIG_I2C_QUEUE_FAST_PLUS.
+     *
+     * @param address device address
+     * @param maxSpeed maximum speed supported by device, I2C_SPEED_*
+     * @return Status, 0 for no errors
+     */
+    int AddDevice(uint8_t address, uint32_t maxSpeed);
+
+    /**
+     * @brief Queue transaction
+     *
+     * @param transaction transaction to execute
+     * @return true if transaction was queued, false if it is still pending or queue is full
+     */
+    bool Submit(I2cTransaction &transaction);
+
+    /**
+     * @brief Get number of transactions rejected because queue was full or transaction was still pending
+     *
+     * @return number of rejected transactions
+     */
+    uint32_t GetRejected();
+
+    /**
+     * @brief Check if caller runs on queue thread, where waiting for a transaction would never return
+     *
+     * @return true if called from queue thread
+     */
+    bool IsQueueThread();
+
+    /**
+     * @brief Get bus and per device statistics
+     *
+     * @param busStats bus statistics
+     * @param deviceStats per device statistics, in registration order
+     * @param maxDevices size of deviceStats array
+     * @param reset start new statistics window
+     * @return number of devices stored to deviceStats array
+     */
+    size_t GetStats(I2cBusStats &busStats, I2cDeviceStats *deviceStats, size_t maxDevices, bool reset);
+
+    /**
+     * @brief Count sensor re-initialization after repeated transfer errors
+     *
+     * @param address device address
+     * @param recovered true if sensor was initialized again
+     */
+    void NoteRecovery(uint8_t address, bool recovered);
+
+    /**
+     * @brief Check if the bus failed: a timed out transfer was not returned by the driver after bus clear
+     *
+     * @return true until the controller is reset with ResetController
+     */
+    bool IsFailed();
+
+    /**
+     * @brief Reset the controller of a failed bus. Suspending the controller stops its DMA, so the quarantined
+     *        transaction is released and transfers start again. Called from sensor recovery, does nothing if the bus
+     *        has not failed.
+     *
+     * @return Status, 0 if the bus is usable, -EBUSY if the driver may still write to the quarantined buffer
+     */
+    int ResetController();
+
+private:
+    /**
+     * @brief State of the current callback transfer, shared with the driver completion callback
+     */
+    enum class TransferState : uint8_t
+    {
+        Idle,      ///< No transfer in progress
+        Running,   ///< Transfer started, completion signals transferDone
+        Abandoned, ///< Transfer timed out after bus clear, completion releases the quarantined transaction
+    };
+
+    /**
+     * @brief Bus time accounting of one device
+     */
+    struct DeviceEntry
+    {
+        uint8_t address;           ///< Device address
+        uint32_t maxSpeed;         ///< Maximum speed supported by device
+        uint32_t transfers;        ///< Completed transactions
+        uint64_t busCycles;        ///< Time spent on the bus
+        uint32_t maxLatencyCycles; ///< Maximum time from submit to first bus transfer
+        uint32_t deadlineMisses;   ///< Transactions completed after deadline
+        uint16_t recoveries;       ///< Successful sensor re-initializations
+        uint16_t failedRecoveries; ///< Failed sensor re-initializations
+    };
+
+    /**
+     * @brief Start queue thread for the bus
+     *
+     * @param busDevice I2C bus device
+     * @param index queue index, used to select thread stack
+     */
+    void Start(const device *busDevice, size_t index);
+
+    /**
+     * @brief Queue thread. Executes queued transactions and calls completion callbacks.
+     *
+     * @param data pointer to current instance of I2cQueue
+     */
+    static void WorkingThread(void *data, void *, void *);
+
+    /**
+     * @brief Remove the most urgent transaction from the queue
+     *
+     * @return transaction, nullptr if queue is empty
+     */
+    I2cTransaction *Next();
+
+    /**
+     * @brief Add transaction to the queue
+     *
+     * @param transaction transaction to add
+     * @return true if there was free slot
+     */
+    bool Enqueue(I2cTransaction &transaction);
+
+    /**
+     * @brief Execute single bus transfer: whole transaction or its next chunk
+     *
+     * @param transaction transaction to execute
+     * @param length number of bytes to transfer
+     * @return transfer status, 0 for no errors
+     */
+    int Execute(I2cTransaction &transaction, uint16_t length);
+
+    /**
+     * @brief Update accounting of the transaction device
+     *
+     * @param transaction completed transaction
+     * @param end cycle counter at completion
+     */
+    void Account(const I2cTransaction &transaction, uint32_t end);
+
+    /**
+     * @brief Count transfer result and clear the bus after too many failed transfers in a row
+     *
+     * @param status transfer status
+     */
+    void CheckBus(int status);
+
+    /**
+     * @brief Mark the bus failed and keep the transaction pending until the driver returns its buffer
+     *
+     * @param transaction transaction of the abandoned transfer
+     */
+    void Quarantine(I2cTransaction &transaction);
+
+    /**
+     * @brief Check if transaction is kept pending in the quarantine slot
+     */
+    bool IsQuarantined(const I2cTransaction &transaction);
+
+    /**
+     * @brief Release the quarantined transaction, so that its owner can submit it again
+     */
+    void ReleaseQuarantine();
+
+    /**
+     * @brief Transfer complete callback used with i2c_transfer_cb
+     */
+    static void OnTransferComplete(const device *dev, int result, void *data);
+
+    const device *bus = nullptr;                  ///< I2C bus device
+    k_spinlock lock;                              ///< Protects queued transactions and statistics
+    I2cTransaction *queued[MaxTransactions];      ///< Queued transactions, unordered
+    size_t queuedCount = 0;                       ///< Number of queued transactions
+    k_sem wakeup;                                 ///< Signalled when transaction is queued
+    k_thread thread;                              ///< Queue thread
+    k_sem transferDone;                           ///< Signalled by i2c_transfer_cb completion
+    i2c_msg msgs[2];                              ///< Messages of the current transfer. Used by the driver until completion
+    uint8_t registerId;                           ///< Register address sent by the current transfer
+    int transferResult;                           ///< Result of i2c_transfer_cb transfer
+    std::atomic<TransferState> transferState;     ///< State of the current callback transfer
+    std::atomic<bool> failed;                     ///< Set when an abandoned transfer was not returned by the driver
+    I2cTransaction *quarantined = nullptr;        ///< Transaction of the abandoned transfer, protected by lock
+    std::atomic<uint32_t> rejected;               ///< Number of rejected transactions
+    uint32_t failedTransfers = 0;                 ///< Failed transfers in a row. Used only by queue thread
+    std::atomic<uint32_t> busClears;              ///< Number of bus clear sequences
+
+    DeviceEntry devices[MaxDevices];              ///< Registered devices
+    size_t deviceCount = 0;                       ///< Number of registered devices
+    uint32_t speed = 0;                           ///< Current bus speed, I2C_SPEED_*
+    int64_t windowStart = 0;                      ///< Uptime of statistics window start, ms
+};
@@ -1,6 +1,8 @@
 #pragma once
+#include <string.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/drivers/i2c.h>
+#include "i2c_queue.hpp"
 
 // #define MAX30102_NODE DT_NODELABEL(max30102)
 /**
@@ -8,8 +10,9 @@
  * 
  * @tparam DeviceName Device name 
  * @tparam i2c_id  Device ID
+ * @tparam maxSpeed Maximum bus speed supported by device, I2C_SPEED_*
  */
-template <class DeviceName, int i2c_id>
+template <class DeviceName, int i2c_id, uint32_t maxSpeed = I2C_SPEED_FAST>
 class I2CTransport
 {
 public:
@@ -25,6 +28,10 @@ public:
         //     dev = DEVICE_DT_GET(DT_NODELABEL(i2c1max));
         // }
         deviceStatus.store(0, std::memory_order_relaxed);
+        consecutiveErrors.store(0, std::memory_order_relaxed);
+        syncState.store(SyncState::Idle, std::memory_order_relaxed);
+        k_mutex_init(&syncLock);
+        k_sem_init(&syncDone, 0, 1);
     }
 
     /**
@@ -33,40 +40,146 @@ public:
     void Initialize(const device* dev_arg)
     {
         dev = dev_arg;
-        int status = i2c_configure(dev, I2C_SPEED_SET(I2C_SPEED_FAST) | I2C_MODE_CONTROLLER);
-        // int status = i2c_configure(dev, I2C_SPEED_SET(I2C_SPEED_FAST) | I2C_MODE_MASTER);
+        queue = &I2cQueue::ForBus(dev);
+        // Bus speed is selected by queue from speeds of all devices on the bus
+        int status = queue->AddDevice(i2c_id, maxSpeed);
         deviceStatus.store(status, std::memory_order_relaxed);
+        consecutiveErrors.store(0, std::memory_order_relaxed);
+
+        // Blocking register access goes through the queue as well, behind sample reads
+        syncTransaction.address = i2c_id;
+        syncTransaction.priority = I2cPriority::Low;
+        syncTransaction.deadlineUs = 0;
+        syncTransaction.chunkSize = 0;
+        syncTransaction.pending.store(false, std::memory_order_relaxed);
+        syncState.store(SyncState::Idle, std::memory_order_relaxed);
+        syncTransaction.callback = [this](int status)
+        {
+            // Completion of an abandoned transfer only frees the transaction for the next blocking transfer
+            syncStatus = status;
+            if (syncState.exchange(SyncState::Idle, std::memory_order_acq_rel) == SyncState::Waiting)
+            {
+                k_sem_give(&syncDone);
+            }
+        };
+    }
+
+    /**
+     * @brief Set handler called after every CONFIG_SENSOR_RECOVERY_ERRORS failed transfers in a row, or after any
+     *        failed transfer while the bus is failed. Must be set before transactions are used.
+     * 
+     * @param handler failure handler, called from the thread of the failed transfer. Must only schedule recovery
+     */
+    void SetFailureHandler(std::function<void()> &&handler)
+    {
+        failureHandler = std::move(handler);
+    }
+
+    /**
+     * @brief Count sensor re-initialization in statistics of the bus
+     * 
+     * @param recovered true if sensor was initialized again
+     */
+    void NoteRecovery(bool recovered)
+    {
+        if (queue != nullptr)
+        {
+            queue->NoteRecovery(i2c_id, recovered);
+        }
+    }
+
+    /**
+     * @brief Reset the bus controller if a transfer was abandoned on the bus. Called by sensor recovery before the
+     *        sensor is initialized again
+     * 
+     * @return Status, 0 if the bus is usable
+     */
+    int ResetBus()
+    {
+        return queue != nullptr ? queue->ResetController() : -ENODEV;
+    }
+
+    /**
+     * @brief Prepare transaction for asynchronous transfers with this device. Must be called once before transaction
+     *        is used.
+     * 
+     * @param transaction transaction to prepare
+     * @param callback completion callback, called from I2C queue thread
+     * @param priority scheduling class
+     * @param deadlineUs deadline relative to submit time, 0 for none
+     */
+    void SetupTransaction(I2cTransaction &transaction, I2cCallback &&callback,
+                          I2cPriority priority = I2cPriority::Normal, uint32_t deadlineUs = 0)
+    {
+        transaction.address = i2c_id;
+        transaction.priority = priority;
+        transaction.deadlineUs = deadlineUs;
+        transaction.chunkSize = 0;
+        transaction.pending.store(false, std::memory_order_relaxed);
+        transaction.callback = [this, callback = std::move(callback)](int status)
+        {
+            UpdateStatus(status);
+            callback(status);
+        };
     }
 
     /**
-     * @brief Write device Register
+     * @brief Queue asynchronous read of hardware register batch. Returns immediately, transaction callback is called
+     *        when data is available
+     * 
+     * @param transaction transaction prepared with SetupTransaction
+     * @param registerId Start register ID 
+     * @param data pointer to data object, where register batch should be stored. Must stay valid until callback
+     * @param size number of registers to read
+     * @return true if transfer was queued
+     */
+    bool ReadRegistersAsync(I2cTransaction &transaction, uint8_t registerId, uint8_t* data, uint16_t size)
+    {
+        return SubmitTransaction(transaction, registerId, data, size, false);
+    }
+
+    /**
+     * @brief Queue asynchronous write of hardware register batch. Returns immediately, transaction callback is called
+     *        when data is written
+     * 
+     * @param transaction transaction prepared with SetupTransaction
+     * @param registerId Start register ID 
+     * @param data pointer to data to write. Must stay valid until callback
+     * @param size number of registers to write
+     * @return true if transfer was queued
+     */
+    bool WriteRegistersAsync(I2cTransaction &transaction, uint8_t registerId, uint8_t* data, uint16_t size)
+    {
+        return SubmitTransaction(transaction, registerId, data, size, true);
+    }
+
+    /**
+     * @brief Write device Register. Blocks until the queued transfer completes
      * 
      * @param registerId Id of the register to write
      * @param value value to write
      */
     void WriteRegister(uint8_t registerId, uint8_t value)
     {
-        int status = i2c_reg_write_byte(dev, i2c_id, registerId, value);
-        deviceStatus.store(status, std::memory_order_relaxed);
+        Transfer(registerId, &value, 1, true);
     }
 
     /**
-     * @brief Read device register
+     * @brief Read device register. Blocks until the queued transfer completes
      * 
      * @param registerId Id of the register to read
      * @return uint8_t hardware register id
      */
     uint8_t ReadRegister(uint8_t registerId)
     {
-        uint8_t value;
-        int status = i2c_reg_read_byte(dev, i2c_id, registerId, &value);
-        deviceStatus.store(status, std::memory_order_relaxed);
+        uint8_t value = 0;
+        Transfer(registerId, &value, 1, false);
         return value;
     }
 
     /**
      * @brief Update hardware register. Reads hardware register updated register bits selected with mask
-     *        and writes updated register value back
+     *        and writes updated register value back. Blocks until the queued transfers complete
      * 
      * @param registerId Register ID to update
      * @param mask Bitmask of the register to update
@@ -74,12 +187,21 @@ public:
      */
     void UpdateRegister(uint8_t registerId, uint8_t mask, uint8_t value)
     {
-        int status = i2c_reg_update_byte(dev, i2c_id, registerId, mask, value);
-        deviceStatus.store(status, std::memory_order_relaxed);
+        uint8_t current = 0;
+        if (Transfer(registerId, &current, 1, false) != 0)
+        {
+            return;
+        }
+
+        uint8_t updated = (current & ~mask) | (value & mask);
+        if (updated != current)
+        {
+            Transfer(registerId, &updated, 1, true);
+        }
     }
 
     /**
-     * @brief Read hardware register batch from device
+     * @brief Read hardware register batch from device. Blocks until the queued transfer completes
      * 
      * @param registerId Start register ID 
      * @param data pointer to data object, where register batch should be stored
@@ -87,8 +209,38 @@ public:
      */
     void ReadRegisters(uint8_t registerId, uint8_t* data, int size)
     {
-        int status = i2c_burst_read(dev, i2c_id, registerId, data, size);
-        deviceStatus.store(status, std::memory_order_relaxed);
+        Transfer(registerId, data, size, false);
+    }
+
+    /**
+     * @brief Poll register until bits selected with mask are cleared, e.g. self clearing reset bit
+     * 
+     * @param registerId Register ID to poll
+     * @param mask Bitmask of the bits to wait for
+     * @param timeoutMs maximum wait
+     * @return Status, 0 when bits are cleared, -ETIMEDOUT or transfer error of the last read after timeout
+     */
+    int WaitRegisterClear(uint8_t registerId, uint8_t mask, uint32_t timeoutMs)
+    {
+        int64_t end = k_uptime_get() + timeoutMs;
+
+        for (;;)
+        {
+            uint8_t value = ReadRegister(registerId);
+            int status = deviceStatus.load(std::memory_order_relaxed);
+
+            if (status == 0 && (value & mask) == 0)
+            {
+                return 0;
+            }
+
+            if (k_uptime_get() >= end)
+            {
+                return status != 0 ? status : -ETIMEDOUT;
+            }
+
+            k_msleep(pollPeriodMs);
+        }
     }
 
     /**
@@ -104,6 +256,159 @@ public:
     }
 
 private:
+    /**
+     * @brief State of the blocking transfer, shared with its completion callback
+     */
+    enum class SyncState : uint8_t
+    {
+        Idle,      ///< No blocking transfer in the queue
+        Waiting,   ///< Caller waits for completion
+        Abandoned, ///< Caller timed out, the queue still owns the transaction and its buffer
+    };
+
+    /**
+     * @brief Store transfer status and call failure handler after every CONFIG_SENSOR_RECOVERY_ERRORS failed
+     *        transfers in a row. On a failed bus every sensor fails until the controller is reset, so the handler is
+     *        called right away
+     */
+    void UpdateStatus(int status)
+    {
+        deviceStatus.store(status, std::memory_order_relaxed);
+
+        if (status == 0)
+        {
+            consecutiveErrors.store(0, std::memory_order_relaxed);
+            return;
+        }
+
+        uint32_t errors = consecutiveErrors.fetch_add(1, std::memory_order_relaxed) + 1;
+        bool recover = CONFIG_SENSOR_RECOVERY_ERRORS != 0 && errors % CONFIG_SENSOR_RECOVERY_ERRORS == 0;
+        if ((recover || (queue != nullptr && queue->IsFailed())) && failureHandler)
+        {
+            failureHandler();
+        }
+    }
+
+    /**
+     * @brief Queue register transfer and wait for its completion, so that configuration takes part in bus
+     *        arbitration and accounting. Must not be called from I2C queue thread, e.g. transaction callbacks.
+     *        Data goes through a buffer of the transport: after a timeout the transfer may still complete, and it
+     *        must not write into the stack of a caller which has already returned.
+     * 
+     * @return transfer status, 0 for no errors, -ETIMEDOUT if the queue did not complete the transfer in time
+     */
+    int Transfer(uint8_t registerId, uint8_t* data, uint16_t size, bool write)
+    {
+        if (queue == nullptr)
+        {
+            UpdateStatus(-ENODEV);
+            return -ENODEV;
+        }
+
+        __ASSERT(!queue->IsQueueThread(), "Blocking I2C transfer from I2C queue thread");
+        __ASSERT(size <= syncBufferSize, "Blocking I2C transfer too long");
+
+        if (size > syncBufferSize)
+        {
+            UpdateStatus(-EINVAL);
+            return -EINVAL;
+        }
+
+        int status = -EBUSY;
+        k_mutex_lock(&syncLock, K_FOREVER);
+
+        for (int retry = 0; retry < syncRetryCount; ++retry)
+        {
+            // Transaction of an abandoned transfer is still owned by the queue
+            if (syncState.load(std::memory_order_acquire) == SyncState::Idle)
+            {
+                if (write)
+                {
+                    memcpy(syncBuffer, data, size);
+                }
+
+                syncState.store(SyncState::Waiting, std::memory_order_release);
+                if (SubmitTransaction(syncTransaction, registerId, syncBuffer, size, write))
+                {
+                    status = WaitTransfer();
+                    if (status == 0 && !write)
+                    {
+                        memcpy(data, syncBuffer, size);
+                    }
+                    break;
+                }
+                syncState.store(SyncState::Idle, std::memory_order_release);
+            }
+
+            // Queue is full, sample reads drain it within a few transfers
+            k_msleep(pollPeriodMs);
+        }
+
+        k_mutex_unlock(&syncLock);
+
+        UpdateStatus(status);
+        return status;
+    }
+
+    /**
+     * @brief Wait for completion of the queued blocking transfer. Queue completes every transaction within a few
+     *        transfer timeouts, a longer wait means that the queue is stuck
+     * 
+     * @return transfer status, -ETIMEDOUT if the transfer was abandoned
+     */
+    int WaitTransfer()
+    {
+        if (k_sem_take(&syncDone, K_MSEC(syncTimeoutMs)) == 0)
+        {
+            return syncStatus;
+        }
+
+        SyncState waiting = SyncState::Waiting;
+        if (syncState.compare_exchange_strong(waiting, SyncState::Abandoned, std::memory_order_acq_rel))
+        {
+            return -ETIMEDOUT;
+        }
+
+        // Completed together with the timeout
+        k_sem_take(&syncDone, K_MSEC(syncTimeoutMs));
+        return syncStatus;
+    }
+
+    /**
+     * @brief Fill and queue transaction
+     */
+    bool SubmitTransaction(I2cTransaction &transaction, uint8_t registerId, uint8_t* data, uint16_t size, bool write)
+    {
+        // Transaction fields must not change while previous transfer is still pending
+        if (queue == nullptr || transaction.pending.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        transaction.registerId = registerId;
+        transaction.data = data;
+        transaction.length = size;
+        transaction.write = write;
+
+        return queue->Submit(transaction);
+    }
+
+    constexpr static uint32_t pollPeriodMs = 1; ///< Register poll period of WaitRegisterClear and full queue retry
+    constexpr static int syncRetryCount = 10;   ///< Attempts to queue blocking transfer
+    constexpr static uint32_t syncTimeoutMs = 5 * I2cQueue::TransferTimeoutMs; ///< Wait for blocking transfer, a
+                                                ///< timed out transfer and its bus clear with margin for queueing
+    constexpr static uint16_t syncBufferSize = 32; ///< Longest blocking transfer, BME280 calibration is 26 bytes
+
     std::atomic<int> deviceStatus; ///< Device status
+    std::atomic<uint32_t> consecutiveErrors; ///< Failed transfers in a row
+    std::function<void()> failureHandler; ///< Called after repeated transfer errors
     const device* dev = nullptr; ///< Logical device
+    I2cQueue* queue = nullptr; ///< Transaction queue of the bus
+
+    I2cTransaction syncTransaction; ///< Transaction of blocking register access
+    k_mutex syncLock; ///< Serializes blocking register access of the device
+    k_sem syncDone; ///< Signalled when blocking transfer completes
+    int syncStatus = 0; ///< Status of the last blocking transfer
+    std::atomic<SyncState> syncState; ///< State of the blocking transfer
+    uint8_t syncBuffer[syncBufferSize]; ///< Data of blocking transfers, stays valid after a timeout
 };
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "arm_math.h"
+
+#include "ble_service.hpp"
+#include "ble_types.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+class BandPower;
+class SignalQuality;
+class FeedbackEngine;
+class EventCapture;
+
+/**
+ * @brief Keys for CommandId::Ads131m08Cmd commands
+ */
+enum class Ads131Command : uint8_t
+{
+    SetPreset       = 0x10, ///< data: [Ads131FilterPreset]
+    SetCoefficients = 0x11, ///< data: [stages, per stage b0, b1, b2, a1, a2 int32 LE Q2.30]. Feedback coefficients use
+                            ///< CMSIS sign: y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2]
+};
+
+/**
+ * @brief Filter presets. Coefficients are designed for the current sample rate
+ */
+enum class Ads131FilterPreset : uint8_t
+{
+    Off             = 0, ///< Samples are sent unchanged
+    Notch50Bandpass = 1, ///< 50 Hz notch, 0.5 - 100 Hz band pass
+    Notch60Bandpass = 2, ///< 60 Hz notch, 0.5 - 100 Hz band pass
+    Bandpass        = 3, ///< 0.5 - 100 Hz band pass
+};
+
+/**
+ * @brief Processing pipeline between ADS131M08 frame read and packetization.
+ *
+ * Frames are collected into per channel blocks of one packet times decimation factor. Every block is decimated by
+ * 1, 2, 4 or 8 with a windowed sinc FIR (CMSIS-DSP arm_fir_decimate_q31, which computes only the kept outputs),
+ * goes through a cascade of biquads at the output rate (arm_biquad_cascade_df1_q31, one instance per channel) and
+ * is packed into the ADS131M08 packet: 9 samples of [8 channels, 24-bit big endian][sample counter], padded to
+ * 227 bytes.
+ *
+ * Samples are converted to q31 with one bit of headroom, so filter transients can't wrap around, and saturated
+ * back to 24 bits. Coefficient changes are applied on the next block and clear filter state.
+ */
+class Ads131Pipeline
+{
+public:
+    constexpr static size_t MaxDevices = 2;       ///< Number of ADS131M08 devices
+    constexpr static size_t Channels = 8;         ///< Channels per device
+    constexpr static size_t SamplesPerPacket = 9; ///< Samples in one packet
+    constexpr static size_t PacketSize = 227;     ///< Size of packet sent over BLE and USB
+    constexpr static size_t MaxStages = 4;        ///< Maximum number of biquads in cascade
+    constexpr static size_t MaxDecimation = 8;    ///< Maximum decimation factor
+    constexpr static size_t MaxBlockFrames = SamplesPerPacket * MaxDecimation; ///< Maximum ADC frames per block
+    constexpr static int SampleShift = 7;         ///< 24-bit sample to q31 with one bit of headroom
+
+    /**
+     * @brief Construct Ads131Pipeline
+     *
+     * @param controller USB communication controller
+     */
+    Ads131Pipeline(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Registers BLE command handler and applies CONFIG_ADS131_FILTER_PRESET
+     *
+     * @param inputRate ADC sample rate, Hz
+     * @param outputRate streaming rate, Hz. inputRate divided by 1, 2, 4 or 8
+     */
+    void Initialize(uint32_t inputRate, uint32_t outputRate);
+
+    /**
+     * @brief Add frame of one device. Sends packet when block is complete
+     *
+     * @param device device index, less than MaxDevices
+     * @param channels channel data of the frame, 8 x 24-bit big endian
+     * @warning Called from system work queue
+     */
+    void PushFrame(size_t device, const uint8_t *channels);
+
+    /**
+     * @brief Set band power estimator fed with every filtered block
+     *
+     * @param estimator band power estimator, nullptr stops feeding blocks
+     */
+    void SetBandPower(BandPower *estimator);
+
+    /**
+     * @brief Set signal quality monitor fed with every block of ADC samples
+     *
+     * @param monitor signal quality monitor, nullptr stops feeding blocks
+     */
+    void SetSignalQuality(SignalQuality *monitor);
+
+#if CONFIG_USE_FEEDBACK
+    /**
+     * @brief Set feedback engine fed with the ADC codes of every frame
+     *
+     * @param engine feedback engine, nullptr stops feeding frames
+     */
+    void SetFeedback(FeedbackEngine *engine);
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+    /**
+     * @brief Set event capture that counts every frame and holds packets while capture mode is enabled
+     *
+     * @param events event capture, nullptr publishes every packet
+     */
+    void SetCapture(EventCapture *events);
+#endif
+
+#if CONFIG_ADS131_PIPELINE_BENCHMARK
+    /**
+     * @brief Measure pipeline cycles for 8 and 16 channels at every ADC sample rate and decimation factor, and log
+     *        CPU load with BLE bandwidth. Must be called before sampling starts
+     */
+    void Benchmark();
+#endif
+
+private:
+    constexpr static int postShift = 1;          ///< Coefficients are Q2.30
+    constexpr static size_t counterOffset = 24;  ///< Offset of sample counter in packet sample
+    constexpr static size_t sampleStride = 25;   ///< Size of packet sample
+    constexpr static size_t tapsPerPhase = 32;   ///< Decimator taps per polyphase branch
+    constexpr static size_t maxTaps = tapsPerPhase * MaxDecimation;        ///< Maximum decimator length
+
+    /**
+     * @brief Per device blocks and filter state
+     */
+    struct Device
+    {
+        q31_t input[Channels][MaxBlockFrames];            ///< ADC samples of the current block
+        arm_fir_decimate_instance_q31 decimator[Channels]; ///< Decimator of every channel
+        q31_t decimatorState[Channels][maxTaps + MaxBlockFrames - 1]; ///< Decimator state
+        q31_t block[Channels][SamplesPerPacket];          ///< Samples of the current packet
+        arm_biquad_casd_df1_inst_q31 filter[Channels];    ///< Biquad cascade of every channel
+        q31_t state[Channels][4 * MaxStages];             ///< Filter state
+        uint8_t counter;                                  ///< Counter of the first packet sample
+        size_t frames;                                    ///< ADC frames in the current block
+    };
+
+    /**
+     * @brief Called when ADS131M08 command is received via BLE
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
+    /**
+     * @brief Design preset coefficients for sample rate
+     *
+     * @param preset filter preset
+     * @param rate sample rate, Hz
+     * @param coefficients output coefficients, 5 per stage
+     * @return number of stages
+     */
+    static size_t DesignPreset(Ads131FilterPreset preset, uint32_t rate, q31_t *coefficients);
+
+    /**
+     * @brief Store coefficients to be applied on the next block
+     */
+    void SetPending(const q31_t *coefficients, size_t stages);
+
+    /**
+     * @brief Apply pending coefficients to every channel and clear filter state
+     */
+    void ApplyPending();
+
+    /**
+     * @brief Design decimator and reset decimator state of every device
+     *
+     * @param factor decimation factor, 1, 2, 4 or 8
+     */
+    void SetDecimation(size_t factor);
+
+    /**
+     * @brief Decimate complete block of a device and filter the result
+     */
+    void FilterBlock(Device &dev);
+
+    /**
+     * @brief Pack filtered block into packet
+     */
+    void Pack(Device &dev);
+
+    Device devices[MaxDevices];             ///< Per device state
+    uint32_t inputRate;                     ///< ADC sample rate, Hz
+    uint32_t outputRate;                    ///< Streaming rate, Hz
+    size_t decimation;                      ///< Decimation factor
+    size_t blockFrames;                     ///< ADC frames per packet
+    q31_t decimatorCoefficients[maxTaps];   ///< Decimator coefficients, shared by every channel
+    q31_t coefficients[5 * MaxStages];      ///< Active coefficients, shared by every channel
+    size_t stages;                          ///< Active number of stages, 0 for bypass
+
+    k_spinlock pendingLock;                 ///< Protects pending coefficients
+    q31_t pendingCoefficients[5 * MaxStages]; ///< Coefficients requested by command
+    size_t pendingStages;                   ///< Number of requested stages
+    std::atomic<bool> reloadPending;        ///< Pending coefficients are not applied yet
+
+    uint8_t packet[PacketSize];             ///< Packet being sent
+    BandPower *bandPower = nullptr;         ///< Band power estimator fed with filtered blocks
+    SignalQuality *signalQuality = nullptr; ///< Signal quality monitor fed with ADC blocks
+#if CONFIG_USE_FEEDBACK
+    FeedbackEngine *feedback = nullptr;     ///< Feedback engine fed with frames
+#endif
+#if CONFIG_USE_EVENT_CAPTURE
+    EventCapture *capture = nullptr;        ///< Event capture fed with frames and packets
+#endif
+
+    SensorStream<SensorId::Ads131m08_0, Bluetooth::Ads131m08Notify> stream0;   ///< ADS131M08_0 packet stream
+    SensorStream<SensorId::Ads131m08_1, Bluetooth::Ads131m08_1_Notify> stream1; ///< ADS131M08_1 packet stream
+};
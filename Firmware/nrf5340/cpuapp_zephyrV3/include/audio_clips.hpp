@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Encoding of stored audio clip
+ */
+enum class AudioClipFormat : uint8_t
+{
+    ImaAdpcm = 0, ///< IMA ADPCM nibbles, low nibble first, starting from predictor 0 and startIndex
+    MuLaw    = 1, ///< G.711 mu-law, one byte per sample
+};
+
+/**
+ * @brief Mono audio clip stored in flash. Clips are generated by scripts/audio_clips.py
+ */
+struct AudioClip
+{
+    const char *name;       ///< Clip name
+    AudioClipFormat format; ///< Encoding
+    uint32_t sampleRate;    ///< Sample rate, Hz
+    uint32_t samples;       ///< Number of samples
+    uint8_t startIndex;     ///< IMA ADPCM step index of the first sample
+    const uint8_t *data;    ///< Encoded samples
+    size_t size;            ///< Size of encoded samples
+};
+
+extern const AudioClip audioClips[]; ///< Stored clips, selected by index
+extern const size_t audioClipCount;  ///< Number of stored clips
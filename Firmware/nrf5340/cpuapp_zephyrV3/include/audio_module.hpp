@@ -10,9 +10,15 @@
 
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+
+#include <atomic>
+
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
 #include "device_string.hpp"
+#include "audio_clips.hpp"
+#include "ima_adpcm.hpp"
+#include "latency_meter.hpp"
 
 /*************************/
 #include <string.h>
@@ -24,12 +30,13 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
 
-/* Prepare for 32 sample values */
-#define NUM_SAMPLES     32
-#define I2S_BLOCK_SIZE  128
-#define NUM_BLOCKS      5
-// #define J_LIMIT sizeof(rawAudioData) / (NUM_BLOCKS * NUM_SAMPLES * 2)
-// #define J_LIMIT (93056 / (NUM_BLOCKS * NUM_SAMPLES * 2))
+#define I2S_SAMPLE_RATE      44100
+#define I2S_CHANNELS         2
+#define I2S_BLOCK_SIZE       (CONFIG_I2S_FRAMES_PER_BLOCK * I2S_CHANNELS * sizeof(int16_t))
+/* Microseconds of audio per I2S block */
+#define I2S_BLOCK_US         (CONFIG_I2S_FRAMES_PER_BLOCK * 1000000ULL / I2S_SAMPLE_RATE)
+/* Milliseconds to wait for a free block. */
+#define WRITE_TIMEOUT        1000
 
 namespace
 {
@@ -38,8 +45,30 @@ namespace
     K_THREAD_STACK_DEFINE(pollStackAreaAudio, stackSizeAudio); ///< Worker thread stack
 } // namespace
 
+/**
+ * @brief Keys for CommandId::AlarmCmd commands, in addition to BleCommand
+ */
+enum class AudioCommand : uint8_t
+{
+    SelectClip         = 0x10, ///< data: [clip index]. Applied on the next StartSampling
+    SetLoop            = 0x11, ///< data: [1 to repeat the clip until StopSampling, 0 to play it once]
+    SetVolume          = 0x12, ///< data: [volume %], 0 - 100
+    SetBlocksPerWakeup = 0x13, ///< data: [blocks], 1 - CONFIG_I2S_NUM_BLOCKS - 1. Trades latency margin for wakeups
+    ReportStats        = 0x14, ///< Log playback statistics
+};
+
 /**
  * @brief AudioModule driver
+ *
+ * Plays clips stored in flash as IMA ADPCM or mu-law (see audio_clips.hpp). The worker thread decodes the clip
+ * straight into I2S memory slab blocks, resampling it to I2S_SAMPLE_RATE with linear interpolation and scaling it
+ * by the volume in the same loop. Both channels carry the same samples.
+ *
+ * The stream starts once CONFIG_I2S_PREFILL_BLOCKS blocks are queued. Then the feeder sleeps for blocksPerWakeup
+ * blocks and refills every free block on each wakeup, so the remaining blocks cover late wakeups.
+ *
+ * A sine feedback tone, driven by FeedbackEngine, can be mixed with the clips. While it is enabled, playback keeps
+ * running. Volume changes ramp over one block, so they don't click.
  */
 class AudioModule {
     
@@ -57,15 +86,46 @@ public:
     int Initialize();
 
     /**
-     * @brief Start taking Audio samples
+     * @brief Start playing the selected clip. Restarts the clip if it is already playing
      */
     int StartSampling();
 
     /**
-     * @brief Stop taking Audio samples
+     * @brief Stop playing. An enabled feedback tone stays silent until it is enabled again
      */
     int StopSampling();
 
+    /**
+     * @brief Number of I2S underruns since initialization
+     */
+    uint32_t GetUnderruns() const;
+
+    /**
+     * @brief Start or stop the feedback tone. Starts playback if needed
+     */
+    void EnableTone(bool enable);
+
+    /**
+     * @brief Set feedback tone volume, used from the next filled block
+     *
+     * @param percent volume, 0 - 100
+     * @param stamp cycle counter of the feature that caused the change
+     */
+    void SetToneVolume(uint8_t percent, uint32_t stamp);
+
+    /**
+     * @brief Set feedback tone frequency, used from the next filled block
+     *
+     * @param frequency frequency, Hz
+     * @param stamp cycle counter of the feature that caused the change
+     */
+    void SetToneFrequency(uint16_t frequency, uint32_t stamp);
+
+    /**
+     * @brief Return latencies from tone change stamps to playback since the last call
+     */
+    LatencyMeter::Summary TakeToneLatency();
+
 private:
     /**
      * @brief Called when trigger mode is received via BLE
@@ -78,7766 +138,76 @@ private:
      */
     bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
 
+    /**
+     * @brief Clip decoder and resampler state
+     */
+    struct Player
+    {
+        const AudioClip *clip;  ///< Clip being played
+        bool finished;          ///< Last sample of the clip was played
+        ImaAdpcm::State state;  ///< IMA ADPCM decoder state
+        uint32_t position;      ///< Index of the next clip sample to decode
+        int32_t previous;       ///< Clip sample before the output position
+        int32_t current;        ///< Clip sample after the output position
+        uint32_t phase;         ///< Output position between previous and current sample, Q16
+        uint32_t step;          ///< Clip samples per output sample, Q16
+    };
+
+    /**
+     * @brief Start selected clip from the beginning
+     */
+    void StartClip();
+
+    /**
+     * @brief Decode the next clip sample. Wraps around or finishes at the end of the clip
+     */
+    int32_t DecodeNext();
+
+    /**
+     * @brief Fill I2S block with resampled and scaled clip samples, silence after the end of the clip
+     *
+     * @param block interleaved stereo block of CONFIG_I2S_FRAMES_PER_BLOCK frames
+     */
+    void FillBlock(int16_t *block);
+
+    /**
+     * @brief Clip or feedback tone is playing
+     */
+    bool Playing() const;
+
+    /**
+     * @brief Play until the clip finishes and the tone is off, or StopSampling is called
+     */
+    void Play();
+
+    /**
+     * @brief Log playback statistics
+     */
+    void ReportStats();
+
     static void WorkingThreadAudio(void *data, void *, void *);
     k_thread worker;     ///< Worker thread
-    uint32_t J_LIMIT = (sizeof(rawAudioData) / (NUM_BLOCKS * NUM_SAMPLES * 2));
-    void *mem_blocks;
+    k_sem playSemaphore; ///< Given by StartSampling, StopSampling and EnableTone, wakes the feeder
     const struct device* i2s_dev; ///< Logical device
-    /* Alarm sirene raw samples */
-    unsigned char rawAudioData[93056] = {
-        0x52, 0x49, 0x46, 0x46, 0x94, 0x6B, 0x01, 0x00, 0x57, 0x41, 0x56, 0x45,
-        0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
-        0xC0, 0x5D, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x04, 0x00, 0x10, 0x00,
-        0x64, 0x61, 0x74, 0x61, 0x70, 0x6B, 0x01, 0x00, 0x13, 0x00, 0x13, 0x00,
-        0x18, 0x00, 0x18, 0x00, 0x4E, 0x00, 0x50, 0x00, 0xA3, 0xFF, 0x9D, 0xFF,
-        0x14, 0x00, 0x18, 0x00, 0xF1, 0xFF, 0xEB, 0xFF, 0x19, 0x00, 0x22, 0x00,
-        0x17, 0x00, 0x14, 0x00, 0x6F, 0xFF, 0x70, 0xFF, 0x9B, 0xFF, 0x98, 0xFF,
-        0x24, 0xFF, 0x24, 0xFF, 0xF4, 0xFF, 0xF6, 0xFF, 0x93, 0xFF, 0x90, 0xFF,
-        0x8A, 0x00, 0x91, 0x00, 0xBB, 0xFE, 0xB5, 0xFE, 0xCD, 0x00, 0xD2, 0x00,
-        0xEF, 0xFD, 0xED, 0xFD, 0xD4, 0x04, 0xCF, 0x04, 0x69, 0x1D, 0x65, 0x1D,
-        0xF7, 0x1B, 0xEE, 0x1B, 0xA6, 0x14, 0xA6, 0x14, 0x5E, 0x0F, 0x59, 0x0F,
-        0xB4, 0x09, 0xB6, 0x09, 0x24, 0x09, 0x27, 0x09, 0xFB, 0x05, 0xFC, 0x05,
-        0x33, 0x05, 0x37, 0x05, 0x40, 0x02, 0x3C, 0x02, 0x06, 0x02, 0x0C, 0x02,
-        0x70, 0x01, 0x6D, 0x01, 0xCA, 0x01, 0xD0, 0x01, 0x1F, 0x01, 0x20, 0x01,
-        0x55, 0x01, 0x54, 0x01, 0xB7, 0x00, 0xBB, 0x00, 0xC5, 0x00, 0xC1, 0x00,
-        0xC5, 0x00, 0xC8, 0x00, 0x51, 0x00, 0x50, 0x00, 0x5B, 0x00, 0x5D, 0x00,
-        0x13, 0xE8, 0x19, 0xE8, 0x06, 0xDA, 0x06, 0xDA, 0xD3, 0xDC, 0xD8, 0xDC,
-        0x16, 0xDF, 0x17, 0xDF, 0x73, 0xEA, 0x79, 0xEA, 0x24, 0xEF, 0x24, 0xEF,
-        0x32, 0xF3, 0x30, 0xF3, 0x77, 0xF6, 0x7A, 0xF6, 0x13, 0xF9, 0x10, 0xF9,
-        0xF3, 0xFB, 0xF8, 0xFB, 0xE1, 0xFC, 0xE0, 0xFC, 0x82, 0xFD, 0x82, 0xFD,
-        0x26, 0xFD, 0x23, 0xFD, 0x68, 0xFE, 0x62, 0xFE, 0x65, 0xFD, 0x68, 0xFD,
-        0x16, 0xFF, 0x11, 0xFF, 0xF7, 0xFD, 0xFC, 0xFD, 0xAB, 0xFE, 0xAA, 0xFE,
-        0xC2, 0xFE, 0xC5, 0xFE, 0x35, 0xFE, 0x31, 0xFE, 0x03, 0x16, 0xFE, 0x15,
-        0x15, 0x26, 0x11, 0x26, 0x64, 0x23, 0x5E, 0x23, 0x60, 0x1F, 0x5C, 0x1F,
-        0xA6, 0x13, 0xA2, 0x13, 0x64, 0x0E, 0x65, 0x0E, 0x87, 0x0A, 0x88, 0x0A,
-        0x00, 0x07, 0xFD, 0x06, 0x91, 0x04, 0x8E, 0x04, 0x3B, 0x01, 0x39, 0x01,
-        0xA7, 0x00, 0xA2, 0x00, 0x44, 0xFF, 0x48, 0xFF, 0xC9, 0xFF, 0xCF, 0xFF,
-        0x57, 0xFE, 0x5F, 0xFE, 0xDD, 0xFE, 0xE1, 0xFE, 0x11, 0xFE, 0x14, 0xFE,
-        0x9F, 0xFE, 0x9C, 0xFE, 0xE4, 0xFD, 0xDF, 0xFD, 0x18, 0xFE, 0x15, 0xFE,
-        0x2D, 0xFE, 0x34, 0xFE, 0x86, 0xE7, 0x90, 0xE7, 0x4B, 0xDA, 0x56, 0xDA,
-        0x43, 0xDC, 0x45, 0xDC, 0x18, 0xDE, 0x1F, 0xDE, 0x39, 0xE8, 0x3A, 0xE8,
-        0x44, 0xEE, 0x42, 0xEE, 0x6C, 0xF2, 0x69, 0xF2, 0x82, 0xF5, 0x88, 0xF5,
-        0x25, 0xF8, 0x29, 0xF8, 0xC6, 0xFA, 0xD0, 0xFA, 0x49, 0xFB, 0x4D, 0xFB,
-        0xF6, 0xFC, 0xF1, 0xFC, 0x64, 0xFD, 0x59, 0xFD, 0xFC, 0xFD, 0xED, 0xFD,
-        0x19, 0xFD, 0x09, 0xFD, 0x13, 0xFE, 0x14, 0xFE, 0x99, 0xFD, 0x9B, 0xFD,
-        0xDE, 0xFE, 0xE9, 0xFE, 0xC2, 0xFE, 0xC9, 0xFE, 0x8D, 0xFE, 0x86, 0xFE,
-        0xCC, 0x15, 0xC1, 0x15, 0x75, 0x25, 0x65, 0x25, 0x35, 0x23, 0x30, 0x23,
-        0xAF, 0x1F, 0xAB, 0x1F, 0xA9, 0x14, 0xAF, 0x14, 0xDE, 0x0E, 0xE5, 0x0E,
-        0xA0, 0x0A, 0xA3, 0x0A, 0x7F, 0x07, 0x79, 0x07, 0xC6, 0x04, 0xBC, 0x04,
-        0x31, 0x02, 0x26, 0x02, 0xA9, 0x01, 0xA1, 0x01, 0xC1, 0xFF, 0xC7, 0xFF,
-        0x61, 0x00, 0x70, 0x00, 0x9B, 0xFF, 0xB7, 0xFF, 0x79, 0x00, 0x8B, 0x00,
-        0x21, 0xFF, 0x28, 0xFF, 0x7E, 0xFF, 0x73, 0xFF, 0xA7, 0xFE, 0x9A, 0xFE,
-        0xCF, 0xFE, 0xC2, 0xFE, 0x03, 0xFF, 0x09, 0xFF, 0x6E, 0xE8, 0x7F, 0xE8,
-        0x6F, 0xDA, 0x80, 0xDA, 0x66, 0xDC, 0x6B, 0xDC, 0x0C, 0xDF, 0x0C, 0xDF,
-        0xAF, 0xE9, 0xA0, 0xE9, 0x27, 0xEF, 0x17, 0xEF, 0xF8, 0xF2, 0xEC, 0xF2,
-        0xA0, 0xF6, 0xA1, 0xF6, 0x9D, 0xF9, 0xA8, 0xF9, 0x30, 0xFC, 0x41, 0xFC,
-        0xEF, 0xFC, 0xFD, 0xFC, 0x80, 0xFE, 0x85, 0xFE, 0xDE, 0xFD, 0xCF, 0xFD,
-        0xEE, 0xFE, 0xD3, 0xFE, 0x90, 0xFE, 0x77, 0xFE, 0xA5, 0xFF, 0x9B, 0xFF,
-        0xAB, 0xFE, 0xB3, 0xFE, 0xDF, 0xFF, 0xF0, 0xFF, 0x07, 0x00, 0x0D, 0x00,
-        0x7A, 0xFF, 0x76, 0xFF, 0x53, 0x17, 0x3D, 0x17, 0xDC, 0x25, 0xCC, 0x25,
-        0x11, 0x23, 0x09, 0x23, 0xDE, 0x20, 0xE6, 0x20, 0x6F, 0x16, 0x7D, 0x16,
-        0x92, 0x10, 0xAC, 0x10, 0xD7, 0x0C, 0xE6, 0x0C, 0x94, 0x09, 0x9C, 0x09,
-        0x31, 0x06, 0x21, 0x06, 0xF7, 0x03, 0xDE, 0x03, 0xFC, 0x02, 0xDB, 0x02,
-        0x43, 0x01, 0x35, 0x01, 0x2B, 0x02, 0x35, 0x02, 0xE7, 0x00, 0x07, 0x01,
-        0xF7, 0x01, 0x20, 0x02, 0xC9, 0x00, 0xD6, 0x00, 0xEF, 0x01, 0xF4, 0x01,
-        0xD6, 0x00, 0xC5, 0x00, 0x82, 0x00, 0x7D, 0x00, 0x6B, 0x01, 0x6D, 0x01,
-        0xC9, 0xE9, 0xCF, 0xE9, 0x7B, 0xDA, 0x87, 0xDA, 0xE4, 0xDC, 0xDD, 0xDC,
-        0x2B, 0xE0, 0x22, 0xE0, 0xE8, 0xEA, 0xD2, 0xEA, 0xB0, 0xF0, 0x94, 0xF0,
-        0x1D, 0xF4, 0x00, 0xF4, 0x6D, 0xF7, 0x65, 0xF7, 0x98, 0xFA, 0xA3, 0xFA,
-        0xBB, 0xFC, 0xE1, 0xFC, 0x67, 0xFE, 0x90, 0xFE, 0x47, 0x00, 0x5C, 0x00,
-        0xB0, 0xFF, 0xA6, 0xFF, 0x3F, 0x01, 0x11, 0x01, 0xD2, 0xFF, 0xA2, 0xFF,
-        0xA4, 0x00, 0x88, 0x00, 0x16, 0x00, 0x0C, 0x00, 0x1F, 0x01, 0x2B, 0x01,
-        0x28, 0x01, 0x2D, 0x01, 0xB6, 0x00, 0xBE, 0x00, 0xB4, 0x17, 0xB8, 0x17,
-        0x9E, 0x25, 0xA4, 0x25, 0x3C, 0x23, 0x48, 0x23, 0x72, 0x21, 0x82, 0x21,
-        0x6C, 0x17, 0x80, 0x17, 0x88, 0x11, 0xA6, 0x11, 0xBC, 0x0D, 0xDA, 0x0D,
-        0xCD, 0x0A, 0xDB, 0x0A, 0x08, 0x08, 0xFB, 0x07, 0xF3, 0x04, 0xC7, 0x04,
-        0xBF, 0x03, 0x91, 0x03, 0xF4, 0x01, 0xD3, 0x01, 0x7C, 0x02, 0x89, 0x02,
-        0xC5, 0x01, 0xF1, 0x01, 0x5C, 0x02, 0x8F, 0x02, 0x6A, 0x01, 0x8C, 0x01,
-        0x19, 0x02, 0x22, 0x02, 0xF1, 0x00, 0xE8, 0x00, 0x17, 0x01, 0x0B, 0x01,
-        0xB9, 0x01, 0xAC, 0x01, 0xF8, 0xE9, 0xE4, 0xE9, 0x1A, 0xDA, 0x1A, 0xDA,
-        0xD0, 0xDC, 0xC2, 0xDC, 0xC1, 0xE0, 0xC7, 0xE0, 0xF7, 0xEB, 0xF1, 0xEB,
-        0x1B, 0xF1, 0x09, 0xF1, 0x20, 0xF5, 0x03, 0xF5, 0xC0, 0xF8, 0xAE, 0xF8,
-        0x22, 0xFB, 0x26, 0xFB, 0x27, 0xFE, 0x50, 0xFE, 0x20, 0xFF, 0x50, 0xFF,
-        0xEC, 0x00, 0x07, 0x01, 0x58, 0x00, 0x51, 0x00, 0x30, 0x01, 0x03, 0x01,
-        0x8B, 0x00, 0x60, 0x00, 0x92, 0x01, 0x73, 0x01, 0x37, 0x01, 0x31, 0x01,
-        0xAA, 0x01, 0xB5, 0x01, 0xAC, 0x01, 0xBD, 0x01, 0xC1, 0x01, 0xD6, 0x01,
-        0x80, 0x18, 0x93, 0x18, 0x14, 0x26, 0x14, 0x26, 0x43, 0x23, 0x3A, 0x23,
-        0xFB, 0x21, 0xDF, 0x21, 0xD1, 0x17, 0xC1, 0x17, 0x93, 0x11, 0x9D, 0x11,
-        0x26, 0x0D, 0x43, 0x0D, 0xF4, 0x09, 0x1A, 0x0A, 0x99, 0x07, 0xA0, 0x07,
-        0x8F, 0x04, 0x79, 0x04, 0xFE, 0x03, 0xD5, 0x03, 0x50, 0x02, 0x35, 0x02,
-        0xBA, 0x02, 0xBA, 0x02, 0xA7, 0x01, 0xCB, 0x01, 0x37, 0x02, 0x53, 0x02,
-        0x71, 0x01, 0x8C, 0x01, 0xE3, 0x01, 0xE4, 0x01, 0x1D, 0x01, 0x17, 0x01,
-        0xCF, 0x00, 0xC3, 0x00, 0xD4, 0x00, 0xC1, 0x00, 0x3F, 0xE9, 0x2E, 0xE9,
-        0xAC, 0xD9, 0xAB, 0xD9, 0xAE, 0xDC, 0xB9, 0xDC, 0x09, 0xE0, 0x28, 0xE0,
-        0x0D, 0xEB, 0x1B, 0xEB, 0xD1, 0xF0, 0xC0, 0xF0, 0x1C, 0xF5, 0xF1, 0xF4,
-        0xB0, 0xF8, 0x78, 0xF8, 0xF0, 0xFA, 0xD8, 0xFA, 0x2B, 0xFE, 0x39, 0xFE,
-        0x07, 0xFF, 0x2E, 0xFF, 0x82, 0x00, 0xA4, 0x00, 0xC4, 0xFF, 0xD8, 0xFF,
-        0x77, 0x00, 0x67, 0x00, 0xB3, 0xFF, 0xA8, 0xFF, 0xC1, 0x00, 0xAD, 0x00,
-        0xD6, 0x00, 0xD5, 0x00, 0x95, 0x01, 0x94, 0x01, 0xAE, 0x01, 0xC0, 0x01,
-        0xCB, 0x01, 0xDC, 0x01, 0x42, 0x18, 0x5E, 0x18, 0x05, 0x26, 0x07, 0x26,
-        0x26, 0x23, 0x1D, 0x23, 0xBD, 0x21, 0x9F, 0x21, 0x7C, 0x17, 0x71, 0x17,
-        0x54, 0x11, 0x66, 0x11, 0xCA, 0x0D, 0xF9, 0x0D, 0x9B, 0x0A, 0xCD, 0x0A,
-        0x8C, 0x07, 0xA0, 0x07, 0x0A, 0x04, 0xF8, 0x03, 0x1E, 0x03, 0xEE, 0x02,
-        0xD8, 0x01, 0xA8, 0x01, 0x95, 0x02, 0x76, 0x02, 0x9B, 0x01, 0x8F, 0x01,
-        0x09, 0x02, 0x0C, 0x02, 0xCD, 0x00, 0xD7, 0x00, 0xD9, 0x00, 0xE1, 0x00,
-        0xDD, 0xFF, 0xDA, 0xFF, 0xBB, 0xFF, 0xB0, 0xFF, 0x02, 0x00, 0xE1, 0xFF,
-        0x5C, 0xE8, 0x42, 0xE8, 0x56, 0xD9, 0x52, 0xD9, 0x89, 0xDC, 0x9A, 0xDC,
-        0x45, 0xDF, 0x6D, 0xDF, 0x24, 0xEA, 0x36, 0xEA, 0x02, 0xF0, 0xEE, 0xEF,
-        0x97, 0xF3, 0x6C, 0xF3, 0x22, 0xF7, 0xED, 0xF6, 0x28, 0xFA, 0x1B, 0xFA,
-        0x19, 0xFD, 0x37, 0xFD, 0xA4, 0xFD, 0xE0, 0xFD, 0x16, 0xFF, 0x65, 0xFF,
-        0x57, 0xFE, 0x99, 0xFE, 0x61, 0xFF, 0x93, 0xFF, 0xE9, 0xFE, 0x0C, 0xFF,
-        0x0D, 0x00, 0x15, 0x00, 0xF8, 0xFF, 0xF3, 0xFF, 0xCE, 0x00, 0xCB, 0x00,
-        0x25, 0x01, 0x1E, 0x01, 0xDB, 0x00, 0xF1, 0x00, 0x3E, 0x18, 0x48, 0x18,
-        0xD0, 0x26, 0xC4, 0x26, 0xC3, 0x23, 0x9E, 0x23, 0x6B, 0x21, 0x29, 0x21,
-        0x35, 0x16, 0x11, 0x16, 0x3C, 0x10, 0x3C, 0x10, 0x7A, 0x0C, 0xA0, 0x0C,
-        0x3C, 0x09, 0x73, 0x09, 0x60, 0x06, 0x70, 0x06, 0x58, 0x03, 0x47, 0x03,
-        0x08, 0x03, 0xC6, 0x02, 0x37, 0x01, 0xE5, 0x00, 0x8B, 0x01, 0x3C, 0x01,
-        0x4F, 0x00, 0x0C, 0x00, 0xDE, 0x00, 0xB4, 0x00, 0xD5, 0xFF, 0xC9, 0xFF,
-        0x14, 0x00, 0x19, 0x00, 0xE3, 0xFE, 0xF7, 0xFE, 0x7E, 0xFE, 0x86, 0xFE,
-        0x1C, 0xFF, 0x0F, 0xFF, 0x9D, 0xE7, 0x98, 0xE7, 0x7D, 0xD9, 0x7F, 0xD9,
-        0x8D, 0xDC, 0xB8, 0xDC, 0x8D, 0xDE, 0xC7, 0xDE, 0x83, 0xE9, 0xB1, 0xE9,
-        0x38, 0xEF, 0x42, 0xEF, 0x17, 0xF3, 0xFD, 0xF2, 0x4E, 0xF6, 0x17, 0xF6,
-        0xE6, 0xF8, 0xC6, 0xF8, 0xF1, 0xFB, 0xE8, 0xFB, 0x84, 0xFC, 0xA5, 0xFC,
-        0x91, 0xFE, 0xD6, 0xFE, 0x3E, 0xFE, 0x82, 0xFE, 0xC0, 0xFE, 0x15, 0xFF,
-        0x1D, 0xFE, 0x50, 0xFE, 0x8C, 0xFF, 0xB0, 0xFF, 0x17, 0xFF, 0x24, 0xFF,
-        0x73, 0x00, 0x72, 0x00, 0xBB, 0x00, 0xCA, 0x00, 0xB0, 0xFF, 0xBE, 0xFF,
-        0x57, 0x17, 0x64, 0x17, 0x0C, 0x26, 0xFC, 0x25, 0x54, 0x23, 0x28, 0x23,
-        0xAA, 0x20, 0x69, 0x20, 0xF5, 0x14, 0xC8, 0x14, 0x60, 0x0F, 0x56, 0x0F,
-        0xCE, 0x0B, 0xEC, 0x0B, 0x57, 0x08, 0x92, 0x08, 0xBD, 0x05, 0xF2, 0x05,
-        0x84, 0x02, 0xA3, 0x02, 0x8F, 0x01, 0x8F, 0x01, 0x0C, 0x00, 0xDA, 0xFF,
-        0x67, 0x00, 0x1F, 0x00, 0xE2, 0xFF, 0x87, 0xFF, 0x90, 0x00, 0x3C, 0x00,
-        0x06, 0xFF, 0xD1, 0xFE, 0x95, 0xFF, 0x72, 0xFF, 0x35, 0xFE, 0x21, 0xFE,
-        0x14, 0xFE, 0xFC, 0xFD, 0x95, 0xFE, 0x70, 0xFE, 0x37, 0xE7, 0x21, 0xE7,
-        0xAB, 0xD9, 0xA8, 0xD9, 0xA8, 0xDC, 0xC8, 0xDC, 0x51, 0xDE, 0x79, 0xDE,
-        0xEF, 0xE8, 0x0A, 0xE9, 0x59, 0xEE, 0x4C, 0xEE, 0xE5, 0xF1, 0xBE, 0xF1,
-        0x14, 0xF6, 0xDB, 0xF5, 0xFD, 0xF8, 0xD8, 0xF8, 0x10, 0xFC, 0x05, 0xFC,
-        0xD8, 0xFC, 0xF5, 0xFC, 0x17, 0xFE, 0x5B, 0xFE, 0xD0, 0xFD, 0x2C, 0xFE,
-        0x2C, 0xFE, 0x93, 0xFE, 0xD8, 0xFD, 0x2C, 0xFE, 0xB5, 0xFF, 0xEC, 0xFF,
-        0xFE, 0xFE, 0x1A, 0xFF, 0xF2, 0xFF, 0x06, 0x00, 0x83, 0xFF, 0xAB, 0xFF,
-        0x11, 0xFF, 0x4E, 0xFF, 0xC7, 0x16, 0x0C, 0x17, 0x8B, 0x25, 0xBE, 0x25,
-        0x03, 0x23, 0x12, 0x23, 0x5F, 0x20, 0x51, 0x20, 0x4C, 0x15, 0x37, 0x15,
-        0x16, 0x10, 0x0E, 0x10, 0x4F, 0x0C, 0x58, 0x0C, 0xB6, 0x07, 0xCC, 0x07,
-        0x3A, 0x05, 0x39, 0x05, 0x4D, 0x02, 0x3C, 0x02, 0x73, 0x01, 0x35, 0x01,
-        0x15, 0x00, 0xC3, 0xFF, 0xF8, 0xFF, 0x98, 0xFF, 0x4C, 0xFF, 0xF2, 0xFE,
-        0xB0, 0xFF, 0x70, 0xFF, 0x58, 0xFE, 0x38, 0xFE, 0xE5, 0xFE, 0xD0, 0xFE,
-        0xF9, 0xFD, 0xEB, 0xFD, 0xB2, 0xFE, 0x7F, 0xFE, 0xE2, 0xFE, 0x9A, 0xFE,
-        0xB5, 0xE7, 0x5A, 0xE7, 0x1F, 0xDA, 0xD1, 0xD9, 0x92, 0xDC, 0x68, 0xDC,
-        0xD3, 0xDD, 0xD5, 0xDD, 0x47, 0xE8, 0x60, 0xE8, 0xCA, 0xED, 0xF3, 0xED,
-        0xF5, 0xF1, 0x08, 0xF2, 0xF3, 0xF5, 0xFA, 0xF5, 0x48, 0xF8, 0x47, 0xF8,
-        0x9B, 0xFB, 0x9D, 0xFB, 0x73, 0xFC, 0x9C, 0xFC, 0x67, 0xFE, 0xA4, 0xFE,
-        0x76, 0xFE, 0xCD, 0xFE, 0x7E, 0xFE, 0xCD, 0xFE, 0x06, 0xFE, 0x39, 0xFE,
-        0xD5, 0xFF, 0xEB, 0xFF, 0xA1, 0xFF, 0xA6, 0xFF, 0x7C, 0x00, 0x82, 0x00,
-        0x98, 0xFF, 0xBA, 0xFF, 0x17, 0xFF, 0x4C, 0xFF, 0x12, 0x17, 0x60, 0x17,
-        0x2B, 0x26, 0x70, 0x26, 0xFC, 0x23, 0x31, 0x24, 0x3D, 0x21, 0x54, 0x21,
-        0xA7, 0x15, 0xA2, 0x15, 0x45, 0x10, 0x2E, 0x10, 0xF5, 0x0B, 0xE1, 0x0B,
-        0x45, 0x08, 0x3B, 0x08, 0x30, 0x06, 0x38, 0x06, 0xA9, 0x02, 0xB7, 0x02,
-        0xAB, 0x01, 0xA5, 0x01, 0x9E, 0xFF, 0x80, 0xFF, 0xB5, 0xFF, 0x82, 0xFF,
-        0x84, 0xFF, 0x4D, 0xFF, 0x2B, 0x00, 0x12, 0x00, 0xD8, 0xFE, 0xCE, 0xFE,
-        0x40, 0xFF, 0x53, 0xFF, 0x3E, 0xFE, 0x42, 0xFE, 0x5C, 0xFE, 0x4A, 0xFE,
-        0xA1, 0xFE, 0x6F, 0xFE, 0xEE, 0xE6, 0xAB, 0xE6, 0xED, 0xD8, 0xA1, 0xD8,
-        0xAF, 0xDB, 0x7C, 0xDB, 0xB3, 0xDD, 0x87, 0xDD, 0x8C, 0xE8, 0x81, 0xE8,
-        0x14, 0xEE, 0x14, 0xEE, 0x83, 0xF2, 0x82, 0xF2, 0x1D, 0xF6, 0x16, 0xF6,
-        0xD8, 0xF8, 0xB5, 0xF8, 0x7B, 0xFC, 0x50, 0xFC, 0x46, 0xFD, 0x1A, 0xFD,
-        0x1E, 0xFF, 0x07, 0xFF, 0xC7, 0xFE, 0xC2, 0xFE, 0x18, 0xFF, 0x2A, 0xFF,
-        0x74, 0xFE, 0x80, 0xFE, 0x20, 0x00, 0x37, 0x00, 0xAE, 0xFF, 0xC8, 0xFF,
-        0x5B, 0x00, 0x88, 0x00, 0x2D, 0x00, 0x76, 0x00, 0xB3, 0xFF, 0x01, 0x00,
-        0xD0, 0x17, 0x24, 0x18, 0xE9, 0x26, 0x29, 0x27, 0x4F, 0x24, 0x76, 0x24,
-        0xAC, 0x21, 0xBB, 0x21, 0xC1, 0x16, 0xB9, 0x16, 0xF9, 0x10, 0xEB, 0x10,
-        0x68, 0x0C, 0x6D, 0x0C, 0x92, 0x08, 0xB6, 0x08, 0xE8, 0x05, 0x30, 0x06,
-        0xB2, 0x02, 0x12, 0x03, 0xB4, 0x01, 0x05, 0x02, 0x0B, 0x00, 0x45, 0x00,
-        0x86, 0x00, 0x90, 0x00, 0x9D, 0xFF, 0x90, 0xFF, 0x90, 0x00, 0x66, 0x00,
-        0x6E, 0xFF, 0x2F, 0xFF, 0xF7, 0xFF, 0xA3, 0xFF, 0x4D, 0xFF, 0xE3, 0xFE,
-        0x78, 0xFF, 0x0C, 0xFF, 0xD7, 0xFF, 0x7E, 0xFF, 0x1F, 0xE8, 0xDE, 0xE7,
-        0x1B, 0xD9, 0xF4, 0xD8, 0x94, 0xDB, 0x82, 0xDB, 0xA9, 0xDD, 0x9F, 0xDD,
-        0x7D, 0xE8, 0x88, 0xE8, 0xF4, 0xEE, 0x06, 0xEF, 0x3F, 0xF3, 0x48, 0xF3,
-        0xCA, 0xF6, 0xB6, 0xF6, 0x8C, 0xF9, 0x44, 0xF9, 0xC9, 0xFC, 0x70, 0xFC,
-        0xE7, 0xFD, 0x8F, 0xFD, 0x64, 0xFF, 0x3F, 0xFF, 0xDB, 0xFE, 0xE3, 0xFE,
-        0x9D, 0xFF, 0xC8, 0xFF, 0xA7, 0xFE, 0xD9, 0xFE, 0x05, 0x00, 0x4B, 0x00,
-        0x2A, 0x00, 0x7C, 0x00, 0xA5, 0x00, 0x14, 0x01, 0x0F, 0x00, 0x80, 0x00,
-        0xD9, 0xFF, 0x24, 0x00, 0x90, 0x17, 0xC2, 0x17, 0xAA, 0x26, 0xB3, 0x26,
-        0x2E, 0x24, 0x39, 0x24, 0x07, 0x22, 0x14, 0x22, 0x2D, 0x17, 0x2B, 0x17,
-        0xF9, 0x10, 0xE1, 0x10, 0x09, 0x0D, 0xDF, 0x0C, 0x49, 0x09, 0x28, 0x09,
-        0x59, 0x06, 0x6E, 0x06, 0x18, 0x03, 0x4C, 0x03, 0x08, 0x02, 0x59, 0x02,
-        0xBC, 0x00, 0xEB, 0x00, 0x42, 0x01, 0x50, 0x01, 0x59, 0x00, 0x49, 0x00,
-        0x40, 0x01, 0x23, 0x01, 0x2F, 0x00, 0xFC, 0xFF, 0x50, 0x00, 0x14, 0x00,
-        0xD1, 0xFF, 0x72, 0xFF, 0x43, 0x00, 0xEB, 0xFF, 0x31, 0x00, 0xFC, 0xFF,
-        0x4C, 0xE8, 0x39, 0xE8, 0x4C, 0xD9, 0x63, 0xD9, 0xAF, 0xDB, 0xBF, 0xDB,
-        0x0F, 0xDE, 0x10, 0xDE, 0x6C, 0xE9, 0x6B, 0xE9, 0x58, 0xEF, 0x58, 0xEF,
-        0xCD, 0xF2, 0xE6, 0xF2, 0xAF, 0xF6, 0xBF, 0xF6, 0xE7, 0xF9, 0xE4, 0xF9,
-        0x64, 0xFD, 0x41, 0xFD, 0x9F, 0xFE, 0x74, 0xFE, 0x1B, 0x00, 0xF0, 0xFF,
-        0x7E, 0xFF, 0x76, 0xFF, 0xF5, 0xFF, 0xF2, 0xFF, 0xB7, 0xFE, 0xDA, 0xFE,
-        0x11, 0x00, 0x46, 0x00, 0x0D, 0x00, 0x58, 0x00, 0x0C, 0x01, 0x57, 0x01,
-        0xBD, 0x00, 0xDF, 0x00, 0x80, 0x00, 0x67, 0x00, 0xF8, 0x17, 0xBD, 0x17,
-        0x2F, 0x26, 0xEA, 0x25, 0xA9, 0x23, 0x96, 0x23, 0xBE, 0x21, 0xD4, 0x21,
-        0xEF, 0x16, 0x22, 0x17, 0x4C, 0x11, 0x78, 0x11, 0x89, 0x0D, 0xAA, 0x0D,
-        0x68, 0x09, 0x7D, 0x09, 0x85, 0x06, 0xA5, 0x06, 0x8E, 0x03, 0x96, 0x03,
-        0x2A, 0x02, 0x29, 0x02, 0x98, 0x00, 0x73, 0x00, 0xEE, 0x00, 0xD0, 0x00,
-        0x53, 0x00, 0x3A, 0x00, 0x86, 0x01, 0x76, 0x01, 0x8D, 0x00, 0x67, 0x00,
-        0xFF, 0x00, 0xC2, 0x00, 0x8E, 0xFF, 0x4C, 0xFF, 0xAB, 0xFF, 0x95, 0xFF,
-        0x54, 0x00, 0x80, 0x00, 0xB5, 0xE8, 0xFE, 0xE8, 0x03, 0xDA, 0x3E, 0xDA,
-        0xBA, 0xDC, 0xA4, 0xDC, 0x0B, 0xDF, 0xC2, 0xDE, 0x0A, 0xEA, 0xB1, 0xE9,
-        0xA4, 0xEF, 0x63, 0xEF, 0x1A, 0xF3, 0x06, 0xF3, 0x17, 0xF7, 0x11, 0xF7,
-        0xE4, 0xF9, 0xE9, 0xF9, 0x0F, 0xFD, 0x2E, 0xFD, 0xA7, 0xFE, 0xE6, 0xFE,
-        0x43, 0x00, 0x9A, 0x00, 0xC1, 0xFF, 0x06, 0x00, 0x55, 0x00, 0x69, 0x00,
-        0x52, 0xFF, 0x47, 0xFF, 0x48, 0x00, 0x56, 0x00, 0xAD, 0xFF, 0xE7, 0xFF,
-        0xF4, 0x00, 0x53, 0x01, 0xED, 0x00, 0x17, 0x01, 0x4C, 0x00, 0x2A, 0x00,
-        0xEA, 0x17, 0x89, 0x17, 0x47, 0x26, 0xF8, 0x25, 0xF2, 0x22, 0xFE, 0x22,
-        0x2C, 0x21, 0x81, 0x21, 0xE5, 0x16, 0x43, 0x17, 0x50, 0x11, 0x82, 0x11,
-        0xC0, 0x0D, 0xA6, 0x0D, 0xDE, 0x09, 0xB9, 0x09, 0x3C, 0x07, 0x11, 0x07,
-        0x17, 0x04, 0xEE, 0x03, 0xA5, 0x02, 0x5E, 0x02, 0xEF, 0x00, 0x8D, 0x00,
-        0x4D, 0x01, 0xF6, 0x00, 0x50, 0x00, 0x34, 0x00, 0x0F, 0x01, 0x20, 0x01,
-        0x47, 0x00, 0x4E, 0x00, 0x0B, 0x01, 0xDC, 0x00, 0xEB, 0xFF, 0x8E, 0xFF,
-        0xDA, 0xFF, 0xA8, 0xFF, 0x66, 0x00, 0x99, 0x00, 0x00, 0xE8, 0x85, 0xE8,
-        0x07, 0xD9, 0x89, 0xD9, 0xA0, 0xDC, 0xB8, 0xDC, 0x01, 0xDF, 0xB1, 0xDE,
-        0xF6, 0xE9, 0x81, 0xE9, 0xBB, 0xEF, 0x6B, 0xEF, 0x1F, 0xF3, 0x24, 0xF3,
-        0xEB, 0xF6, 0x0E, 0xF7, 0xBB, 0xF9, 0xEE, 0xF9, 0xAB, 0xFC, 0xEB, 0xFC,
-        0xC8, 0xFD, 0x22, 0xFE, 0x5A, 0xFF, 0xE0, 0xFF, 0x01, 0xFF, 0x6A, 0xFF,
-        0x10, 0x00, 0x37, 0x00, 0xA9, 0xFF, 0x89, 0xFF, 0xEA, 0x00, 0xC2, 0x00,
-        0xB7, 0xFF, 0xC4, 0xFF, 0x88, 0x00, 0xC7, 0x00, 0xDA, 0x00, 0xF1, 0x00,
-        0xA0, 0x00, 0x60, 0x00, 0x04, 0x19, 0x6B, 0x18, 0x5E, 0x27, 0xE4, 0x26,
-        0xB6, 0x23, 0xAD, 0x23, 0x76, 0x21, 0xED, 0x21, 0x90, 0x16, 0x30, 0x17,
-        0xC1, 0x10, 0x1D, 0x11, 0x5A, 0x0D, 0x51, 0x0D, 0xC6, 0x09, 0x6C, 0x09,
-        0x53, 0x07, 0xDC, 0x06, 0xAC, 0x04, 0x1E, 0x04, 0x52, 0x03, 0xA6, 0x02,
-        0x95, 0x01, 0xD9, 0x00, 0xA1, 0x01, 0x20, 0x01, 0xAE, 0x00, 0xA2, 0x00,
-        0x34, 0x01, 0x9C, 0x01, 0xAF, 0xFF, 0x32, 0x00, 0xBA, 0x00, 0x00, 0x01,
-        0x83, 0xFF, 0x84, 0xFF, 0x69, 0xFF, 0x76, 0xFF, 0xFE, 0xFF, 0x62, 0x00,
-        0xC2, 0xE7, 0x6C, 0xE8, 0x1C, 0xD9, 0xA2, 0xD9, 0x3A, 0xDC, 0x20, 0xDC,
-        0x86, 0xDE, 0xD5, 0xDD, 0xC5, 0xE9, 0xE5, 0xE8, 0xF0, 0xEF, 0x68, 0xEF,
-        0x4B, 0xF3, 0x66, 0xF3, 0xD2, 0xF6, 0x56, 0xF7, 0xEF, 0xF8, 0xAA, 0xF9,
-        0x82, 0xFB, 0x4A, 0xFC, 0x12, 0xFD, 0xE9, 0xFD, 0xA8, 0xFE, 0x7B, 0xFF,
-        0xA1, 0xFE, 0x1D, 0xFF, 0x99, 0xFF, 0x7E, 0xFF, 0x64, 0xFF, 0xB2, 0xFE,
-        0x42, 0x01, 0x67, 0x00, 0xE4, 0xFF, 0x53, 0xFF, 0xAF, 0x00, 0x91, 0x00,
-        0xD5, 0x00, 0xD4, 0x00, 0x64, 0x00, 0x30, 0x00, 0x44, 0x18, 0xBE, 0x17,
-        0x88, 0x26, 0x37, 0x26, 0xA8, 0x23, 0xE5, 0x23, 0x6D, 0x21, 0x60, 0x22,
-        0x1F, 0x16, 0x46, 0x17, 0x0F, 0x10, 0xD4, 0x10, 0xFA, 0x0C, 0x0E, 0x0D,
-        0xBC, 0x09, 0x38, 0x09, 0xCE, 0x07, 0xF4, 0x06, 0x38, 0x05, 0x34, 0x04,
-        0x55, 0x03, 0x33, 0x02, 0x86, 0x01, 0x65, 0x00, 0x94, 0x01, 0xDE, 0x00,
-        0x81, 0x00, 0x7B, 0x00, 0xF8, 0x00, 0xAE, 0x01, 0x54, 0xFF, 0x48, 0x00,
-        0x8A, 0x00, 0x2B, 0x01, 0x80, 0xFF, 0xA2, 0xFF, 0x42, 0xFF, 0x25, 0xFF,
-        0xCD, 0xFF, 0xE1, 0xFF, 0xF1, 0xE7, 0x52, 0xE8, 0x9E, 0xD9, 0xE3, 0xD9,
-        0xB8, 0xDC, 0x71, 0xDC, 0xE7, 0xDE, 0xF8, 0xDD, 0x06, 0xEA, 0xE0, 0xE8,
-        0x0D, 0xF0, 0x51, 0xEF, 0x5B, 0xF3, 0x60, 0xF3, 0x9B, 0xF6, 0x44, 0xF7,
-        0xA1, 0xF8, 0xA7, 0xF9, 0x25, 0xFB, 0x4C, 0xFC, 0xBE, 0xFC, 0xF6, 0xFD,
-        0x1D, 0xFE, 0x42, 0xFF, 0xE7, 0xFD, 0x9A, 0xFE, 0x8F, 0xFF, 0x8C, 0xFF,
-        0x5A, 0xFF, 0x9A, 0xFE, 0xDC, 0x00, 0xE4, 0xFF, 0x62, 0xFF, 0xC2, 0xFE,
-        0x06, 0x00, 0xF1, 0xFF, 0x81, 0x00, 0xB9, 0x00, 0x0C, 0x00, 0x17, 0x00,
-        0xB4, 0x17, 0x7B, 0x17, 0x0B, 0x26, 0xDC, 0x25, 0x00, 0x23, 0x49, 0x23,
-        0xAE, 0x20, 0x81, 0x21, 0x83, 0x15, 0x6E, 0x16, 0xE4, 0x0F, 0x60, 0x10,
-        0xC0, 0x0C, 0x86, 0x0C, 0x3C, 0x09, 0x7D, 0x08, 0x52, 0x07, 0x4C, 0x06,
-        0x06, 0x05, 0xF6, 0x03, 0x7C, 0x03, 0x56, 0x02, 0xFD, 0x01, 0xF7, 0x00,
-        0x20, 0x02, 0x8F, 0x01, 0x20, 0x00, 0x3E, 0x00, 0x85, 0x00, 0x49, 0x01,
-        0x88, 0xFF, 0x53, 0x00, 0xE3, 0x00, 0x26, 0x01, 0x40, 0x00, 0xE7, 0xFF,
-        0xE8, 0xFF, 0x55, 0xFF, 0x80, 0x00, 0x4F, 0x00, 0xC6, 0xE8, 0x13, 0xE9,
-        0x57, 0xDA, 0xAF, 0xDA, 0x51, 0xDD, 0x39, 0xDD, 0x09, 0xDF, 0x60, 0xDE,
-        0x3B, 0xEA, 0x6F, 0xE9, 0x12, 0xF0, 0xB8, 0xEF, 0x62, 0xF3, 0xA6, 0xF3,
-        0x9E, 0xF6, 0x5B, 0xF7, 0x02, 0xF8, 0xE9, 0xF8, 0x77, 0xFA, 0x76, 0xFB,
-        0x3E, 0xFC, 0x5B, 0xFD, 0xD5, 0xFD, 0xF3, 0xFE, 0x8C, 0xFD, 0x3A, 0xFE,
-        0x3E, 0xFF, 0x32, 0xFF, 0xC8, 0xFE, 0x0E, 0xFE, 0xDF, 0xFF, 0x2B, 0xFF,
-        0xAB, 0xFE, 0x9D, 0xFE, 0x43, 0xFF, 0xE8, 0xFF, 0xD8, 0xFF, 0xB1, 0x00,
-        0x2E, 0xFF, 0x6E, 0xFF, 0xBF, 0x16, 0x58, 0x16, 0x59, 0x25, 0xBC, 0x24,
-        0xA6, 0x22, 0x85, 0x22, 0x04, 0x21, 0x88, 0x21, 0x94, 0x15, 0x50, 0x16,
-        0x0C, 0x10, 0x61, 0x10, 0xB5, 0x0C, 0x6F, 0x0C, 0x42, 0x09, 0x91, 0x08,
-        0xA3, 0x07, 0xDA, 0x06, 0xD0, 0x04, 0x06, 0x04, 0x56, 0x03, 0x6D, 0x02,
-        0xE1, 0x01, 0x05, 0x01, 0x32, 0x02, 0xD0, 0x01, 0x67, 0x00, 0xF0, 0x00,
-        0xAB, 0x00, 0xFF, 0x01, 0x4A, 0xFF, 0xA4, 0x00, 0xAF, 0x00, 0x30, 0x01,
-        0xB9, 0x00, 0x2F, 0x00, 0x6E, 0x00, 0x63, 0xFF, 0xD1, 0x00, 0x13, 0x00,
-        0x0E, 0xE9, 0xFA, 0xE8, 0xCD, 0xDA, 0xEC, 0xDA, 0x55, 0xDD, 0x17, 0xDD,
-        0xBE, 0xDE, 0xF0, 0xDD, 0xD5, 0xE9, 0xE3, 0xE8, 0x54, 0xEF, 0xE0, 0xEE,
-        0xFD, 0xF2, 0x31, 0xF3, 0x70, 0xF6, 0x06, 0xF7, 0x38, 0xF8, 0xD3, 0xF8,
-        0x1E, 0xFB, 0xA5, 0xFB, 0x79, 0xFC, 0x0F, 0xFD, 0xC6, 0xFD, 0x50, 0xFE,
-        0x7E, 0xFD, 0x8D, 0xFD, 0x7B, 0xFF, 0x99, 0xFE, 0x57, 0xFF, 0xA7, 0xFD,
-        0x75, 0x00, 0xC8, 0xFE, 0xD8, 0xFE, 0x1D, 0xFE, 0x1E, 0xFF, 0xA5, 0xFF,
-        0x38, 0xFF, 0x73, 0x00, 0x98, 0xFE, 0x9F, 0xFF, 0x6E, 0x16, 0xE6, 0x16,
-        0x1B, 0x25, 0x49, 0x25, 0xC1, 0x22, 0x41, 0x23, 0xE6, 0x20, 0xE1, 0x21,
-        0xDA, 0x15, 0xDA, 0x16, 0x4E, 0x10, 0xCB, 0x10, 0xA8, 0x0C, 0x7B, 0x0C,
-        0x58, 0x09, 0xD4, 0x08, 0x12, 0x07, 0xA0, 0x06, 0xE9, 0x03, 0x91, 0x03,
-        0x8E, 0x02, 0x1F, 0x02, 0x26, 0x01, 0xAB, 0x00, 0x9B, 0x01, 0x80, 0x01,
-        0x15, 0x00, 0xC9, 0x00, 0x91, 0x00, 0x04, 0x02, 0x99, 0xFF, 0xF3, 0x00,
-        0x1A, 0x01, 0x88, 0x01, 0x9B, 0x00, 0xD6, 0xFF, 0x9A, 0x00, 0x55, 0xFF,
-        0x60, 0x01, 0x7B, 0x00, 0x94, 0xE9, 0x79, 0xE9, 0xB6, 0xDA, 0xE4, 0xDA,
-        0xEB, 0xDC, 0xC9, 0xDC, 0xCD, 0xDE, 0x04, 0xDE, 0xCD, 0xE9, 0xE9, 0xE8,
-        0xB5, 0xEF, 0x3A, 0xEF, 0x77, 0xF3, 0x9C, 0xF3, 0x64, 0xF6, 0xDA, 0xF6,
-        0x67, 0xF8, 0xC4, 0xF8, 0x8A, 0xFB, 0xDB, 0xFB, 0x11, 0xFD, 0x80, 0xFD,
-        0xC8, 0xFE, 0x63, 0xFF, 0x51, 0xFE, 0x90, 0xFE, 0x7C, 0xFF, 0xF7, 0xFE,
-        0x87, 0xFE, 0x30, 0xFD, 0x41, 0xFF, 0x01, 0xFE, 0x2E, 0xFE, 0xD4, 0xFD,
-        0xE3, 0xFE, 0xAD, 0xFF, 0x18, 0xFF, 0x58, 0x00, 0x3F, 0xFE, 0xE7, 0xFE,
-        0x2F, 0x16, 0xF2, 0x15, 0x50, 0x25, 0xA5, 0x24, 0xFD, 0x22, 0xB9, 0x22,
-        0x05, 0x21, 0x93, 0x21, 0xB3, 0x15, 0xA4, 0x16, 0xD1, 0x0F, 0x96, 0x10,
-        0xF5, 0x0B, 0x4B, 0x0C, 0x04, 0x09, 0x18, 0x09, 0xEC, 0x06, 0x0F, 0x07,
-        0xF9, 0x03, 0xF8, 0x03, 0xBE, 0x02, 0x5B, 0x02, 0xE3, 0x00, 0x1A, 0x00,
-        0xD9, 0x01, 0x3A, 0x01, 0xEF, 0x00, 0x21, 0x01, 0xE7, 0x01, 0xFE, 0x02,
-        0xD2, 0x00, 0xFF, 0x01, 0xBD, 0x01, 0x1E, 0x02, 0x58, 0x01, 0x9A, 0x00,
-        0x96, 0x00, 0x6B, 0xFF, 0x22, 0x01, 0x96, 0x00, 0xFB, 0xE8, 0x6D, 0xE9,
-        0x28, 0xDA, 0x21, 0xDB, 0xED, 0xDC, 0x7C, 0xDD, 0xC6, 0xDE, 0x64, 0xDE,
-        0x1C, 0xEA, 0x0F, 0xE9, 0xD8, 0xEF, 0x9F, 0xEE, 0xE5, 0xF3, 0xDA, 0xF2,
-        0xD0, 0xF6, 0xE3, 0xF5, 0xEB, 0xF8, 0x04, 0xF8, 0xA5, 0xFB, 0x12, 0xFB,
-        0x91, 0xFC, 0xA4, 0xFC, 0xA8, 0xFE, 0x6E, 0xFF, 0xC5, 0xFD, 0x9C, 0xFE,
-        0xA0, 0xFE, 0xD4, 0xFE, 0x65, 0xFD, 0xC1, 0xFC, 0xA0, 0xFE, 0xCA, 0xFD,
-        0xB5, 0xFD, 0x76, 0xFD, 0x47, 0xFE, 0xF0, 0xFE, 0x60, 0xFF, 0x49, 0x00,
-        0xCD, 0xFE, 0x1C, 0xFF, 0x0D, 0x17, 0x78, 0x16, 0xD5, 0x25, 0xDF, 0x24,
-        0x03, 0x23, 0x94, 0x22, 0xE5, 0x20, 0x62, 0x21, 0xD0, 0x15, 0xF5, 0x16,
-        0xFB, 0x0F, 0x46, 0x11, 0xBF, 0x0B, 0xF7, 0x0C, 0xE0, 0x08, 0x1D, 0x0A,
-        0xC0, 0x06, 0x0A, 0x08, 0xFA, 0x03, 0xFA, 0x04, 0x10, 0x03, 0x46, 0x03,
-        0x6E, 0x01, 0xE7, 0x00, 0x11, 0x02, 0x6A, 0x01, 0x18, 0x01, 0x23, 0x01,
-        0x36, 0x02, 0x23, 0x03, 0x10, 0x01, 0x2A, 0x02, 0x49, 0x02, 0xB5, 0x02,
-        0x7F, 0x01, 0xEA, 0x00, 0xD3, 0x00, 0xE3, 0xFF, 0x20, 0x01, 0xB8, 0x00,
-        0xFF, 0xE8, 0x67, 0xE9, 0x00, 0xDA, 0xB1, 0xDA, 0x94, 0xDC, 0xA9, 0xDC,
-        0xEE, 0xDE, 0x13, 0xDE, 0x0D, 0xEA, 0x99, 0xE8, 0x2C, 0xF0, 0xB3, 0xEE,
-        0xFB, 0xF3, 0xBB, 0xF2, 0xD9, 0xF6, 0x9F, 0xF5, 0xE4, 0xF8, 0x99, 0xF7,
-        0xC6, 0xFB, 0xB0, 0xFA, 0xF5, 0xFC, 0x88, 0xFC, 0x7A, 0xFE, 0xAD, 0xFE,
-        0x36, 0xFE, 0x76, 0xFE, 0xD5, 0xFE, 0x5D, 0xFE, 0xBE, 0xFD, 0x82, 0xFC,
-        0x77, 0xFE, 0x47, 0xFD, 0x7F, 0xFD, 0x43, 0xFD, 0xC5, 0xFE, 0xC9, 0xFF,
-        0xF4, 0xFE, 0x67, 0x00, 0xEE, 0xFE, 0xCF, 0xFF, 0x2F, 0x17, 0x0E, 0x17,
-        0x68, 0x26, 0xD6, 0x25, 0xB2, 0x23, 0x8C, 0x23, 0x45, 0x21, 0xF8, 0x21,
-        0x22, 0x16, 0x5F, 0x17, 0xAB, 0x0F, 0xE9, 0x10, 0x13, 0x0C, 0x29, 0x0D,
-        0xFF, 0x08, 0x22, 0x0A, 0xE6, 0x06, 0x39, 0x08, 0xBC, 0x03, 0xE0, 0x04,
-        0xB9, 0x02, 0x3A, 0x03, 0x85, 0x01, 0x4F, 0x01, 0xC0, 0x01, 0x89, 0x01,
-        0x47, 0x01, 0xDE, 0x01, 0xF9, 0x01, 0x6C, 0x03, 0x06, 0x01, 0x96, 0x02,
-        0xB7, 0x01, 0x3E, 0x02, 0x87, 0x00, 0xBD, 0xFF, 0xC1, 0x00, 0x69, 0xFF,
-        0xC0, 0x00, 0xF3, 0xFF, 0x93, 0xE8, 0xD7, 0xE8, 0x70, 0xD9, 0x40, 0xDA,
-        0x26, 0xDC, 0x91, 0xDC, 0xCE, 0xDE, 0x56, 0xDE, 0x09, 0xEA, 0xEE, 0xE8,
-        0x26, 0xF0, 0xE4, 0xEE, 0xEE, 0xF3, 0xB9, 0xF2, 0x4B, 0xF7, 0xEA, 0xF5,
-        0x81, 0xF9, 0xE6, 0xF7, 0x76, 0xFC, 0x01, 0xFB, 0x71, 0xFD, 0xBE, 0xFC,
-        0x8F, 0xFE, 0xA6, 0xFE, 0xF0, 0xFD, 0x26, 0xFE, 0x9B, 0xFE, 0xF0, 0xFD,
-        0x0A, 0xFE, 0x47, 0xFC, 0x35, 0xFF, 0x03, 0xFD, 0xD7, 0xFE, 0x6E, 0xFD,
-        0x38, 0x00, 0x0A, 0x00, 0x9E, 0xFF, 0x32, 0x00, 0x9A, 0xFF, 0xED, 0xFF,
-        0x0E, 0x18, 0xA4, 0x17, 0xCF, 0x26, 0x1B, 0x26, 0x1A, 0x24, 0xF7, 0x23,
-        0x2F, 0x21, 0x14, 0x22, 0xEA, 0x15, 0x8E, 0x17, 0xC3, 0x0F, 0xA1, 0x11,
-        0xCC, 0x0B, 0x90, 0x0D, 0x97, 0x08, 0x6C, 0x0A, 0x65, 0x06, 0x49, 0x08,
-        0xB6, 0x03, 0x53, 0x05, 0xCD, 0x02, 0xA2, 0x03, 0xB2, 0x01, 0xB8, 0x01,
-        0x75, 0x02, 0x6E, 0x02, 0x95, 0x01, 0x72, 0x02, 0xE2, 0x01, 0xF0, 0x03,
-        0x7E, 0x00, 0x12, 0x03, 0x9F, 0x00, 0x9B, 0x02, 0x05, 0xFF, 0xF1, 0xFF,
-        0xB3, 0xFF, 0xEE, 0xFF, 0xB3, 0xFF, 0x11, 0x00, 0x69, 0xE7, 0x2F, 0xE8,
-        0x09, 0xD9, 0xA4, 0xD9, 0xD7, 0xDB, 0x74, 0xDB, 0xFF, 0xDE, 0x52, 0xDD,
-        0x69, 0xEA, 0xE5, 0xE7, 0x8E, 0xF0, 0xF8, 0xED, 0x63, 0xF4, 0x0E, 0xF2,
-        0x4A, 0xF7, 0x2C, 0xF5, 0x99, 0xF9, 0x96, 0xF7, 0x55, 0xFC, 0xD3, 0xFA,
-        0x3C, 0xFD, 0xA0, 0xFC, 0x60, 0xFE, 0xB2, 0xFE, 0x86, 0xFD, 0xDF, 0xFD,
-        0x92, 0xFE, 0xEF, 0xFD, 0x98, 0xFE, 0x8E, 0xFC, 0x11, 0x00, 0x4E, 0xFD,
-        0x33, 0x00, 0xE5, 0xFD, 0xCC, 0x01, 0x8B, 0x00, 0x25, 0x01, 0xAD, 0x00,
-        0xFC, 0x00, 0x7D, 0x00, 0xC2, 0x18, 0xE8, 0x17, 0xD5, 0x26, 0x26, 0x26,
-        0xFB, 0x23, 0x42, 0x24, 0x1A, 0x21, 0xB9, 0x22, 0xB4, 0x15, 0x46, 0x18,
-        0xCB, 0x0F, 0x8E, 0x12, 0x21, 0x0C, 0xA3, 0x0E, 0x19, 0x09, 0x49, 0x0B,
-        0x98, 0x06, 0x67, 0x08, 0xCD, 0x03, 0xF8, 0x04, 0x2F, 0x03, 0x63, 0x03,
-        0xD0, 0x01, 0x48, 0x01, 0x95, 0x02, 0x3F, 0x02, 0x6B, 0x01, 0x42, 0x02,
-        0x66, 0x01, 0xA3, 0x03, 0xEF, 0xFF, 0xCB, 0x02, 0xA3, 0xFF, 0xD9, 0x01,
-        0x38, 0xFE, 0x43, 0xFF, 0xA2, 0xFE, 0xD7, 0xFE, 0xA5, 0xFE, 0xE2, 0xFE,
-        0xC4, 0xE6, 0x64, 0xE7, 0xBD, 0xD8, 0x4A, 0xD9, 0xF5, 0xDB, 0xB5, 0xDB,
-        0xBC, 0xDE, 0x60, 0xDD, 0x39, 0xEA, 0x2E, 0xE8, 0x0C, 0xF0, 0xE5, 0xED,
-        0xB0, 0xF3, 0xB6, 0xF1, 0x1B, 0xF7, 0x1D, 0xF5, 0xD9, 0xF9, 0xDF, 0xF7,
-        0x9A, 0xFC, 0xF6, 0xFA, 0xF0, 0xFC, 0x30, 0xFC, 0x72, 0xFE, 0x78, 0xFE,
-        0xBA, 0xFD, 0xAF, 0xFD, 0xFE, 0xFE, 0xE5, 0xFD, 0x18, 0xFF, 0xA6, 0xFC,
-        0x89, 0x00, 0x9B, 0xFD, 0x86, 0x00, 0x53, 0xFE, 0x98, 0x01, 0xBB, 0x00,
-        0x7A, 0x01, 0x79, 0x01, 0x2A, 0x01, 0x28, 0x01, 0xFE, 0x18, 0x7D, 0x18,
-        0x6E, 0x27, 0xE4, 0x26, 0x46, 0x24, 0x65, 0x24, 0x86, 0x21, 0x93, 0x22,
-        0x33, 0x16, 0xD0, 0x17, 0x76, 0x10, 0x1C, 0x12, 0x5A, 0x0C, 0xF5, 0x0D,
-        0xBF, 0x08, 0x8F, 0x0A, 0x73, 0x06, 0x91, 0x08, 0xEF, 0x03, 0xDB, 0x05,
-        0x4F, 0x03, 0x72, 0x04, 0xA4, 0x01, 0xF9, 0x01, 0x1E, 0x02, 0x7C, 0x02,
-        0x09, 0x01, 0x78, 0x02, 0x5F, 0x01, 0x1B, 0x04, 0xB7, 0xFF, 0xE6, 0x02,
-        0x63, 0xFF, 0xD0, 0x01, 0x47, 0xFE, 0x72, 0xFF, 0x76, 0xFE, 0xE9, 0xFE,
-        0x9B, 0xFE, 0x4E, 0xFF, 0xAA, 0xE6, 0xDE, 0xE7, 0x53, 0xD8, 0x76, 0xD9,
-        0x95, 0xDB, 0xC7, 0xDB, 0x6B, 0xDE, 0x62, 0xDD, 0xD0, 0xE9, 0x1E, 0xE8,
-        0xD0, 0xEF, 0x15, 0xEE, 0xDC, 0xF3, 0x42, 0xF2, 0x35, 0xF7, 0x71, 0xF5,
-        0x50, 0xF9, 0x38, 0xF7, 0xFC, 0xFB, 0xF9, 0xF9, 0xF3, 0xFC, 0x97, 0xFB,
-        0xC7, 0xFE, 0xF9, 0xFD, 0x3E, 0xFE, 0x17, 0xFD, 0x2D, 0xFF, 0xA9, 0xFC,
-        0xD6, 0xFE, 0xD6, 0xFA, 0x9A, 0x00, 0x3D, 0xFC, 0xCE, 0x00, 0x7E, 0xFD,
-        0x21, 0x02, 0x6A, 0x00, 0x18, 0x02, 0x5B, 0x01, 0x2A, 0x02, 0x54, 0x01,
-        0x0D, 0x1A, 0xD1, 0x18, 0x01, 0x28, 0x1B, 0x27, 0x5F, 0x24, 0xCC, 0x24,
-        0x73, 0x21, 0x70, 0x23, 0x13, 0x16, 0xE5, 0x18, 0x00, 0x10, 0xA3, 0x12,
-        0x80, 0x0C, 0x9D, 0x0E, 0x8B, 0x09, 0x64, 0x0B, 0x13, 0x07, 0x04, 0x09,
-        0x3E, 0x04, 0x17, 0x06, 0x48, 0x03, 0xAA, 0x04, 0x50, 0x01, 0x54, 0x02,
-        0xB8, 0x01, 0x40, 0x03, 0xE5, 0x00, 0xE6, 0x03, 0xBF, 0x00, 0x53, 0x05,
-        0x9F, 0xFE, 0xA2, 0x03, 0x86, 0xFE, 0x69, 0x02, 0x55, 0xFD, 0x4F, 0xFF,
-        0x92, 0xFD, 0x11, 0xFE, 0xC5, 0xFD, 0xC4, 0xFD, 0x19, 0xE6, 0x26, 0xE6,
-        0x14, 0xD8, 0xC2, 0xD7, 0xB6, 0xDB, 0x5D, 0xDA, 0x59, 0xDE, 0xC7, 0xDB,
-        0x60, 0xE9, 0x35, 0xE6, 0xD5, 0xEF, 0xE4, 0xEC, 0x60, 0xF3, 0x18, 0xF1,
-        0xFE, 0xF5, 0x53, 0xF4, 0xA4, 0xF8, 0x5F, 0xF7, 0x6C, 0xFB, 0xAB, 0xFA,
-        0x18, 0xFC, 0xD2, 0xFB, 0x2B, 0xFE, 0xF1, 0xFD, 0x6E, 0xFE, 0x43, 0xFD,
-        0xD4, 0xFF, 0xEF, 0xFC, 0xDD, 0xFF, 0x71, 0xFB, 0xB2, 0x01, 0xFF, 0xFC,
-        0x83, 0x01, 0xF1, 0xFD, 0x9A, 0x02, 0xCA, 0x00, 0x55, 0x02, 0xCA, 0x01,
-        0x27, 0x02, 0x15, 0x02, 0xA9, 0x19, 0xAB, 0x19, 0xC2, 0x27, 0x4A, 0x28,
-        0x7B, 0x24, 0xEE, 0x25, 0xC9, 0x21, 0x3F, 0x24, 0xDE, 0x16, 0x9D, 0x19,
-        0x71, 0x10, 0xEB, 0x12, 0x29, 0x0D, 0x0F, 0x0F, 0x61, 0x0A, 0xE6, 0x0B,
-        0x76, 0x07, 0xAF, 0x08, 0x9C, 0x04, 0x6C, 0x05, 0x77, 0x03, 0xF0, 0x03,
-        0x4F, 0x01, 0xF9, 0x01, 0xF5, 0x00, 0xCA, 0x02, 0x7B, 0xFF, 0x03, 0x03,
-        0xA1, 0xFF, 0x6A, 0x04, 0x7E, 0xFE, 0x16, 0x03, 0x15, 0xFF, 0x2D, 0x02,
-        0xBE, 0xFD, 0xE6, 0xFE, 0xD6, 0xFD, 0xB7, 0xFD, 0xC9, 0xFD, 0x45, 0xFD,
-        0x72, 0xE6, 0xDE, 0xE5, 0x60, 0xD8, 0x6A, 0xD7, 0xAB, 0xDB, 0xE1, 0xD9,
-        0x66, 0xDE, 0xDE, 0xDB, 0x41, 0xE9, 0x7E, 0xE6, 0xBC, 0xEF, 0x38, 0xED,
-        0xB2, 0xF2, 0x87, 0xF0, 0x76, 0xF5, 0x8D, 0xF3, 0x33, 0xF8, 0x8F, 0xF6,
-        0x07, 0xFB, 0xF0, 0xF9, 0x66, 0xFC, 0xBF, 0xFB, 0x8F, 0xFE, 0xBD, 0xFD,
-        0xD8, 0xFE, 0xD7, 0xFC, 0xDE, 0xFF, 0x45, 0xFC, 0x7B, 0xFF, 0xF4, 0xFA,
-        0x5F, 0x00, 0x5F, 0xFC, 0x1A, 0x00, 0xDF, 0xFD, 0xB7, 0x01, 0x5E, 0x01,
-        0xBF, 0x01, 0x71, 0x02, 0xEC, 0x01, 0xBC, 0x02, 0x2D, 0x19, 0xD7, 0x19,
-        0x73, 0x27, 0x6D, 0x28, 0x0F, 0x24, 0xD2, 0x25, 0x85, 0x21, 0x19, 0x24,
-        0x8C, 0x16, 0x7A, 0x19, 0x5F, 0x10, 0x64, 0x13, 0xA9, 0x0D, 0x9A, 0x10,
-        0x74, 0x0A, 0x5F, 0x0D, 0x9A, 0x07, 0x14, 0x0A, 0x95, 0x04, 0x25, 0x06,
-        0xA4, 0x03, 0x3E, 0x04, 0x69, 0x01, 0xCD, 0x01, 0x8C, 0x01, 0xF2, 0x02,
-        0xC7, 0x00, 0xC0, 0x03, 0xF7, 0x00, 0xDC, 0x04, 0xF8, 0xFF, 0x43, 0x03,
-        0x27, 0x00, 0x9C, 0x01, 0xF1, 0xFE, 0x82, 0xFE, 0x89, 0xFE, 0x25, 0xFD,
-        0x4E, 0xFE, 0xFD, 0xFC, 0xE7, 0xE6, 0xE3, 0xE5, 0xB3, 0xD8, 0x7D, 0xD7,
-        0x11, 0xDC, 0x20, 0xDA, 0x11, 0xDE, 0x4E, 0xDB, 0x29, 0xE9, 0xF0, 0xE5,
-        0xDF, 0xEE, 0x88, 0xEB, 0xF6, 0xF1, 0x97, 0xEE, 0x41, 0xF5, 0x13, 0xF2,
-        0x33, 0xF8, 0xA7, 0xF5, 0x17, 0xFB, 0xB5, 0xF9, 0xCD, 0xFB, 0x86, 0xFB,
-        0x2E, 0xFE, 0x05, 0xFE, 0xC0, 0xFD, 0x84, 0xFC, 0xFB, 0xFE, 0x20, 0xFC,
-        0xA2, 0xFE, 0xF4, 0xFA, 0xB4, 0xFF, 0xCA, 0xFC, 0x6E, 0xFF, 0x5A, 0xFE,
-        0x94, 0x00, 0x5A, 0x01, 0x2C, 0x01, 0xD4, 0x02, 0x34, 0x01, 0xEC, 0x02,
-        0x2A, 0x19, 0xE3, 0x1A, 0x0D, 0x27, 0x3B, 0x29, 0xCD, 0x23, 0xB2, 0x26,
-        0x12, 0x22, 0x60, 0x25, 0x38, 0x17, 0x5E, 0x1A, 0x93, 0x11, 0x62, 0x14,
-        0x39, 0x0E, 0xD8, 0x10, 0xEA, 0x0A, 0x81, 0x0D, 0xCB, 0x07, 0xEC, 0x09,
-        0x30, 0x05, 0x4C, 0x06, 0x37, 0x04, 0x46, 0x04, 0x9F, 0x01, 0x9D, 0x01,
-        0xAE, 0x01, 0xED, 0x02, 0x6A, 0x00, 0x61, 0x03, 0x29, 0x01, 0xF3, 0x04,
-        0x10, 0x00, 0xD3, 0x02, 0xAA, 0x00, 0x35, 0x01, 0x5C, 0xFF, 0xCA, 0xFD,
-        0xC2, 0xFE, 0x4A, 0xFC, 0xFD, 0xFE, 0xA9, 0xFC, 0x35, 0xE7, 0x30, 0xE5,
-        0x5D, 0xD9, 0x1F, 0xD7, 0x23, 0xDC, 0x63, 0xD9, 0x89, 0xDD, 0x93, 0xDA,
-        0x27, 0xE8, 0xAC, 0xE5, 0xFC, 0xED, 0x1D, 0xEC, 0x2B, 0xF1, 0xA3, 0xEF,
-        0x96, 0xF4, 0xF8, 0xF2, 0xB0, 0xF7, 0x2E, 0xF6, 0xE4, 0xFA, 0x00, 0xFA,
-        0x67, 0xFC, 0x42, 0xFC, 0xB9, 0xFE, 0x7D, 0xFE, 0xC4, 0xFE, 0x48, 0xFD,
-        0xDF, 0xFF, 0x94, 0xFC, 0x27, 0xFF, 0x10, 0xFB, 0x12, 0x00, 0xEF, 0xFC,
-        0x3E, 0xFF, 0x7A, 0xFE, 0x5F, 0x00, 0xE3, 0x01, 0xAE, 0x00, 0x49, 0x03,
-        0x8F, 0x00, 0x0A, 0x03, 0xB2, 0x18, 0xAE, 0x1A, 0x37, 0x27, 0x0E, 0x29,
-        0x4E, 0x24, 0x57, 0x26, 0x16, 0x23, 0x39, 0x25, 0x45, 0x18, 0x1A, 0x1A,
-        0x6D, 0x12, 0x03, 0x14, 0x1B, 0x0F, 0xB8, 0x10, 0x1F, 0x0B, 0xFD, 0x0C,
-        0xE5, 0x07, 0xA2, 0x09, 0x56, 0x04, 0x49, 0x05, 0x33, 0x03, 0x4D, 0x03,
-        0xFA, 0x00, 0x2A, 0x01, 0xD6, 0x00, 0x72, 0x02, 0x18, 0x00, 0x94, 0x03,
-        0xF8, 0x00, 0x3D, 0x05, 0x06, 0x00, 0x2E, 0x03, 0xC8, 0x00, 0x5B, 0x01,
-        0xE3, 0xFF, 0x2C, 0xFE, 0x71, 0xFF, 0xBA, 0xFC, 0x31, 0xFF, 0xE7, 0xFC,
-        0x7C, 0xE6, 0xEB, 0xE4, 0xF6, 0xD7, 0xB1, 0xD6, 0xF6, 0xDA, 0x72, 0xD9,
-        0x20, 0xDC, 0x70, 0xDA, 0x54, 0xE7, 0xC4, 0xE5, 0x70, 0xED, 0x0C, 0xEC,
-        0x1E, 0xF1, 0x97, 0xEF, 0x00, 0xF5, 0x26, 0xF3, 0x50, 0xF8, 0x98, 0xF6,
-        0xD0, 0xFB, 0xF7, 0xFA, 0xAE, 0xFC, 0xDB, 0xFC, 0x7E, 0xFE, 0xDA, 0xFE,
-        0xB3, 0xFE, 0xD1, 0xFD, 0x07, 0x00, 0x5F, 0xFD, 0xA9, 0xFF, 0x0A, 0xFC,
-        0x8B, 0x00, 0xD6, 0xFD, 0x3D, 0xFF, 0xA9, 0xFE, 0x96, 0x00, 0x01, 0x02,
-        0x6F, 0x01, 0x81, 0x03, 0xFF, 0x01, 0x76, 0x03, 0xDD, 0x1A, 0x7C, 0x1B,
-        0x06, 0x29, 0x50, 0x29, 0x04, 0x26, 0x98, 0x26, 0x8F, 0x24, 0x62, 0x25,
-        0xA9, 0x19, 0x88, 0x1A, 0x3E, 0x13, 0x1A, 0x14, 0x16, 0x0F, 0x48, 0x10,
-        0xDD, 0x0A, 0x88, 0x0C, 0x46, 0x07, 0xF4, 0x08, 0x0C, 0x04, 0xF2, 0x04,
-        0x27, 0x03, 0x1D, 0x03, 0x3B, 0x01, 0x12, 0x01, 0x94, 0x00, 0x9C, 0x01,
-        0x51, 0xFF, 0x16, 0x02, 0xD6, 0xFF, 0x69, 0x03, 0xEE, 0xFE, 0xA2, 0x01,
-        0x38, 0x00, 0xED, 0x00, 0x4D, 0xFE, 0x68, 0xFD, 0x96, 0xFD, 0x7A, 0xFC,
-        0xF3, 0xFC, 0xC5, 0xFC, 0xA5, 0xE4, 0x62, 0xE5, 0xCF, 0xD6, 0xA7, 0xD7,
-        0x82, 0xD9, 0xBC, 0xD9, 0x31, 0xDB, 0xD0, 0xDA, 0x3E, 0xE6, 0xA4, 0xE5,
-        0xEE, 0xEC, 0x49, 0xEC, 0xBF, 0xF0, 0xA8, 0xEF, 0xD2, 0xF4, 0x24, 0xF3,
-        0xB9, 0xF8, 0xB4, 0xF6, 0x18, 0xFC, 0x8E, 0xFA, 0x69, 0xFD, 0x96, 0xFC,
-        0x6E, 0xFF, 0x9F, 0xFE, 0xFC, 0xFF, 0x0C, 0xFE, 0x2F, 0x01, 0xAB, 0xFD,
-        0xE8, 0x00, 0xC8, 0xFC, 0xC7, 0x01, 0xC8, 0xFE, 0x4D, 0x00, 0x8E, 0xFF,
-        0x5E, 0x02, 0x85, 0x03, 0xFE, 0x02, 0x90, 0x04, 0x3D, 0x03, 0x00, 0x04,
-        0x65, 0x1B, 0x1B, 0x1B, 0x86, 0x29, 0xEB, 0x28, 0x3C, 0x27, 0xE0, 0x26,
-        0x33, 0x25, 0x3B, 0x25, 0x0E, 0x1A, 0x2F, 0x1A, 0x4A, 0x13, 0xB4, 0x13,
-        0x55, 0x0F, 0x67, 0x10, 0x4D, 0x0B, 0x4F, 0x0D, 0x65, 0x07, 0xCD, 0x09,
-        0x36, 0x04, 0x29, 0x06, 0x98, 0x02, 0xCB, 0x03, 0x46, 0x00, 0x7C, 0x01,
-        0x9D, 0xFF, 0x0F, 0x02, 0x62, 0xFE, 0x6C, 0x02, 0xE5, 0xFE, 0x6B, 0x03,
-        0xD7, 0xFD, 0xEB, 0x00, 0x47, 0xFF, 0xC5, 0xFF, 0x56, 0xFD, 0xAA, 0xFB,
-        0x14, 0xFD, 0xE3, 0xFA, 0xFE, 0xFC, 0xA2, 0xFB, 0x9D, 0xE4, 0x5D, 0xE4,
-        0x83, 0xD6, 0xC6, 0xD6, 0x17, 0xD9, 0x51, 0xD9, 0x46, 0xDB, 0x74, 0xDB,
-        0x16, 0xE6, 0x58, 0xE6, 0xDF, 0xEC, 0xD9, 0xEC, 0x23, 0xF1, 0x19, 0xF0,
-        0x1C, 0xF5, 0xB0, 0xF2, 0x27, 0xF9, 0xF9, 0xF5, 0x6F, 0xFC, 0xAA, 0xF9,
-        0x02, 0xFE, 0x34, 0xFC, 0xE3, 0xFF, 0x68, 0xFE, 0xAF, 0x00, 0x20, 0xFE,
-        0x33, 0x02, 0x21, 0xFE, 0x7C, 0x01, 0xE4, 0xFC, 0x4E, 0x02, 0x38, 0xFF,
-        0xBA, 0x00, 0x57, 0x00, 0xC7, 0x02, 0x92, 0x04, 0x54, 0x03, 0x93, 0x05,
-        0x71, 0x03, 0x9F, 0x04, 0x64, 0x1B, 0x56, 0x1B, 0x55, 0x29, 0xCE, 0x28,
-        0xD6, 0x26, 0x82, 0x26, 0x6F, 0x24, 0x6B, 0x24, 0x6F, 0x19, 0x7B, 0x19,
-        0xD2, 0x12, 0x44, 0x13, 0x8B, 0x0E, 0x10, 0x10, 0x65, 0x0A, 0x57, 0x0D,
-        0xAC, 0x06, 0x58, 0x0A, 0x5C, 0x03, 0x75, 0x06, 0x86, 0x01, 0x59, 0x03,
-        0xB2, 0xFF, 0xF0, 0x00, 0x37, 0xFF, 0x56, 0x01, 0x92, 0xFD, 0x33, 0x01,
-        0xB2, 0xFE, 0xEA, 0x02, 0x40, 0xFE, 0x09, 0x01, 0x51, 0xFF, 0x85, 0xFF,
-        0x2B, 0xFD, 0x5D, 0xFB, 0x8A, 0xFC, 0x92, 0xFA, 0x23, 0xFC, 0x6F, 0xFB,
-        0xF3, 0xE3, 0x88, 0xE4, 0x7C, 0xD6, 0x4D, 0xD7, 0x5E, 0xD9, 0x9C, 0xD9,
-        0x71, 0xDB, 0x17, 0xDB, 0x80, 0xE6, 0xEE, 0xE5, 0xE6, 0xEC, 0xF7, 0xEB,
-        0x57, 0xF1, 0x52, 0xEF, 0xFD, 0xF5, 0x85, 0xF2, 0xEB, 0xF9, 0xC0, 0xF5,
-        0xDA, 0xFC, 0x80, 0xF9, 0x84, 0xFE, 0xE3, 0xFC, 0x50, 0x00, 0xB6, 0xFF,
-        0x7D, 0x00, 0x31, 0xFF, 0x6F, 0x02, 0x73, 0xFF, 0x53, 0x01, 0x69, 0xFD,
-        0x0C, 0x02, 0x50, 0xFF, 0x3C, 0x01, 0x1B, 0x01, 0x46, 0x03, 0x63, 0x05,
-        0xAC, 0x03, 0x2C, 0x06, 0xCC, 0x03, 0x12, 0x05, 0xFC, 0x1B, 0xE0, 0x1B,
-        0x54, 0x29, 0xD1, 0x28, 0xB7, 0x26, 0xBE, 0x26, 0x6B, 0x24, 0x0A, 0x25,
-        0xFA, 0x18, 0xD3, 0x19, 0xA0, 0x12, 0xCB, 0x13, 0xF8, 0x0E, 0x18, 0x11,
-        0x9C, 0x0A, 0x12, 0x0E, 0x50, 0x06, 0x5F, 0x0A, 0x55, 0x03, 0x6A, 0x06,
-        0x88, 0x01, 0xC1, 0x02, 0x05, 0x00, 0x14, 0x00, 0xFB, 0xFF, 0xAB, 0x00,
-        0x0B, 0xFE, 0x79, 0x00, 0xFD, 0xFE, 0x5B, 0x02, 0xF6, 0xFD, 0x1A, 0x00,
-        0x17, 0xFF, 0x6D, 0xFE, 0x83, 0xFD, 0x63, 0xFA, 0x49, 0xFD, 0xB5, 0xF9,
-        0x9B, 0xFC, 0x5B, 0xFA, 0xC6, 0xE3, 0x3D, 0xE3, 0xEC, 0xD5, 0x1C, 0xD6,
-        0xF6, 0xD8, 0xE4, 0xD8, 0xFC, 0xDB, 0x79, 0xDB, 0xF4, 0xE6, 0x4A, 0xE6,
-        0xE8, 0xEC, 0xF2, 0xEB, 0xDA, 0xF0, 0xFC, 0xEE, 0xA4, 0xF5, 0x73, 0xF2,
-        0xA0, 0xF9, 0xE9, 0xF5, 0xAA, 0xFC, 0xED, 0xF9, 0xF2, 0xFE, 0x04, 0xFE,
-        0x8E, 0x00, 0x9D, 0x00, 0xD1, 0x00, 0x0D, 0x00, 0x9F, 0x02, 0xFD, 0xFF,
-        0x6F, 0x01, 0x0E, 0xFE, 0x6F, 0x02, 0xBE, 0x00, 0x38, 0x01, 0xEC, 0x02,
-        0x3E, 0x02, 0xDB, 0x06, 0x59, 0x02, 0x85, 0x07, 0x83, 0x03, 0x23, 0x07,
-        0x20, 0x1C, 0xB3, 0x1D, 0xD8, 0x29, 0x71, 0x2A, 0xFD, 0x26, 0xB5, 0x27,
-        0x29, 0x24, 0x44, 0x25, 0xD7, 0x18, 0xE8, 0x19, 0xD3, 0x12, 0xDB, 0x13,
-        0x14, 0x0F, 0xA6, 0x10, 0x5F, 0x0A, 0xEF, 0x0C, 0x92, 0x06, 0x80, 0x09,
-        0x76, 0x03, 0x68, 0x05, 0x52, 0x01, 0x87, 0x01, 0x9F, 0xFF, 0xE2, 0xFE,
-        0x35, 0xFF, 0x5E, 0xFF, 0x5E, 0xFD, 0x4D, 0xFF, 0x7A, 0xFE, 0x1C, 0x01,
-        0xDF, 0xFD, 0xBE, 0xFE, 0x57, 0xFF, 0xD6, 0xFC, 0x0B, 0xFE, 0xD7, 0xF8,
-        0x2C, 0xFD, 0xA6, 0xF7, 0x38, 0xFC, 0x74, 0xF8, 0x39, 0xE4, 0x8E, 0xE2,
-        0xC5, 0xD6, 0x06, 0xD6, 0x8B, 0xD9, 0xAA, 0xD8, 0x2C, 0xDC, 0x12, 0xDB,
-        0x8F, 0xE7, 0xCC, 0xE6, 0x70, 0xED, 0x07, 0xED, 0x48, 0xF1, 0x7A, 0xF0,
-        0xCD, 0xF5, 0xFE, 0xF3, 0x5C, 0xF9, 0x17, 0xF7, 0x65, 0xFC, 0x1F, 0xFB,
-        0x4D, 0xFE, 0xD7, 0xFE, 0x8C, 0x00, 0x14, 0x02, 0x34, 0x01, 0xBB, 0x01,
-        0xAC, 0x02, 0x35, 0x01, 0x4A, 0x01, 0xD5, 0xFE, 0xFD, 0x01, 0x2F, 0x01,
-        0xD8, 0x00, 0x52, 0x03, 0x2F, 0x02, 0x65, 0x07, 0x13, 0x03, 0x86, 0x08,
-        0x8C, 0x03, 0x21, 0x07, 0xA1, 0x1B, 0x0B, 0x1D, 0x69, 0x29, 0xDC, 0x29,
-        0x61, 0x26, 0x09, 0x27, 0x98, 0x23, 0x71, 0x24, 0x20, 0x18, 0xB4, 0x18,
-        0x8E, 0x12, 0xC9, 0x12, 0xAD, 0x0E, 0x7B, 0x0F, 0x84, 0x0A, 0x70, 0x0C,
-        0xC9, 0x06, 0x2C, 0x09, 0x42, 0x03, 0x6A, 0x04, 0x38, 0x02, 0x2B, 0x01,
-        0xA0, 0x00, 0x4D, 0xFE, 0x00, 0x00, 0x9D, 0xFE, 0x1C, 0xFE, 0x07, 0xFF,
-        0x4B, 0xFF, 0x81, 0x01, 0x4B, 0xFE, 0x2B, 0xFF, 0x53, 0xFF, 0xE6, 0xFC,
-        0x3B, 0xFE, 0x0B, 0xF9, 0x11, 0xFD, 0x79, 0xF7, 0x8F, 0xFC, 0xD1, 0xF8,
-        0x54, 0xE4, 0xBE, 0xE2, 0xB4, 0xD6, 0x2B, 0xD6, 0xD6, 0xD9, 0x33, 0xD9,
-        0xB3, 0xDC, 0xFA, 0xDB, 0x05, 0xE8, 0xA4, 0xE7, 0x23, 0xED, 0xFB, 0xEC,
-        0x3E, 0xF1, 0x5B, 0xF0, 0xAC, 0xF5, 0x74, 0xF3, 0x82, 0xF9, 0xE0, 0xF6,
-        0xC7, 0xFC, 0x90, 0xFB, 0x82, 0xFD, 0xCD, 0xFE, 0xEF, 0xFE, 0x85, 0x01,
-        0x58, 0xFF, 0xD7, 0x00, 0x65, 0x01, 0x42, 0x00, 0x4F, 0x00, 0xCB, 0xFD,
-        0x73, 0x01, 0x77, 0x00, 0x27, 0x00, 0xE4, 0x02, 0x6D, 0x01, 0x49, 0x07,
-        0x87, 0x02, 0xC6, 0x08, 0x0C, 0x03, 0x47, 0x07, 0xB1, 0x1B, 0x68, 0x1D,
-        0x27, 0x29, 0xC1, 0x29, 0xA3, 0x25, 0x50, 0x26, 0xC7, 0x22, 0xA2, 0x23,
-        0xEA, 0x17, 0x68, 0x18, 0x92, 0x12, 0xC6, 0x12, 0x6A, 0x0E, 0x5C, 0x0F,
-        0x3D, 0x0A, 0x8F, 0x0C, 0x7B, 0x06, 0x55, 0x09, 0x5F, 0x03, 0xD6, 0x04,
-        0xB8, 0x02, 0xBD, 0x01, 0x81, 0x01, 0x42, 0xFF, 0xBE, 0x00, 0xCD, 0xFF,
-        0xD4, 0xFE, 0xA0, 0x00, 0xB3, 0xFF, 0xDE, 0x02, 0xD6, 0xFE, 0x1C, 0x00,
-        0x9D, 0x00, 0xAD, 0xFD, 0x38, 0xFF, 0xB8, 0xF8, 0x52, 0xFE, 0x35, 0xF7,
-        0xBF, 0xFD, 0xC7, 0xF8, 0x66, 0xE5, 0x01, 0xE3, 0x90, 0xD7, 0x6E, 0xD6,
-        0xCB, 0xDA, 0x87, 0xD9, 0x19, 0xDD, 0xB1, 0xDB, 0xCE, 0xE7, 0xE4, 0xE6,
-        0x87, 0xED, 0x15, 0xED, 0x3E, 0xF1, 0x3E, 0xF0, 0x4C, 0xF5, 0xEE, 0xF2,
-        0xBB, 0xF8, 0xD3, 0xF5, 0x15, 0xFC, 0x89, 0xFA, 0x77, 0xFC, 0x6A, 0xFD,
-        0xC6, 0xFD, 0x10, 0x00, 0x88, 0xFE, 0x8A, 0xFF, 0xF9, 0xFF, 0x3C, 0xFE,
-        0x5F, 0xFF, 0x54, 0xFC, 0x34, 0x00, 0x35, 0xFF, 0xC1, 0xFE, 0x38, 0x02,
-        0xA6, 0xFF, 0xDC, 0x06, 0x1A, 0x00, 0xFF, 0x07, 0x84, 0x00, 0x42, 0x06,
-        0x42, 0x19, 0x4B, 0x1C, 0xF5, 0x27, 0xA8, 0x29, 0xB7, 0x24, 0x55, 0x26,
-        0x65, 0x22, 0xE2, 0x23, 0x9B, 0x17, 0x4D, 0x18, 0xC4, 0x12, 0xC2, 0x12,
-        0x06, 0x0F, 0x93, 0x0F, 0x91, 0x0A, 0x89, 0x0C, 0x29, 0x07, 0xB6, 0x09,
-        0xC7, 0x03, 0xC6, 0x04, 0x90, 0x03, 0xC0, 0x01, 0x07, 0x02, 0x9B, 0xFE,
-        0xDF, 0x01, 0xC7, 0xFF, 0x2D, 0x00, 0x2C, 0x01, 0x5D, 0x00, 0x39, 0x03,
-        0x6A, 0xFF, 0xA4, 0x00, 0x80, 0x00, 0x76, 0xFD, 0x0C, 0x00, 0x15, 0xF9,
-        0xC9, 0xFF, 0xD8, 0xF7, 0x82, 0xFF, 0x51, 0xF9, 0x6A, 0xE6, 0xAF, 0xE2,
-        0x28, 0xD8, 0xC2, 0xD5, 0x61, 0xDB, 0x57, 0xD9, 0x7B, 0xDD, 0x05, 0xDC,
-        0x36, 0xE8, 0xFB, 0xE7, 0x95, 0xEC, 0x2F, 0xED, 0x69, 0xF0, 0x4D, 0xF0,
-        0xBB, 0xF4, 0xCC, 0xF2, 0xA5, 0xF8, 0xCF, 0xF5, 0x0D, 0xFC, 0xB8, 0xFA,
-        0x97, 0xFC, 0x4A, 0xFE, 0x65, 0xFE, 0x05, 0x02, 0xF3, 0xFD, 0x6B, 0x00,
-        0xA8, 0xFF, 0x03, 0xFF, 0x98, 0xFF, 0xE5, 0xFC, 0xEB, 0x00, 0x9D, 0xFF,
-        0x95, 0xFF, 0x6E, 0x02, 0x0A, 0x00, 0xC5, 0x06, 0x5D, 0x00, 0x3B, 0x08,
-        0xB7, 0x00, 0x17, 0x07, 0x80, 0x19, 0xC8, 0x1D, 0x42, 0x27, 0x8A, 0x2A,
-        0x2E, 0x24, 0x34, 0x27, 0xD4, 0x21, 0x18, 0x24, 0x45, 0x17, 0xE8, 0x17,
-        0xE9, 0x12, 0x68, 0x12, 0x08, 0x0F, 0x14, 0x0F, 0xC0, 0x0A, 0xBA, 0x0C,
-        0xE3, 0x06, 0xF2, 0x09, 0xC8, 0x03, 0x72, 0x05, 0xF7, 0x02, 0xA4, 0x01,
-        0xD9, 0x00, 0x9E, 0xFD, 0x13, 0x01, 0x05, 0xFF, 0xA0, 0xFF, 0xB8, 0x00,
-        0xF6, 0xFF, 0x12, 0x03, 0xC3, 0xFE, 0x49, 0x00, 0xC7, 0xFF, 0xFB, 0xFC,
-        0xF9, 0xFE, 0x0F, 0xF8, 0xCC, 0xFE, 0x94, 0xF6, 0xF1, 0xFE, 0x03, 0xF8,
-        0xF5, 0xE6, 0xD3, 0xE1, 0x31, 0xD9, 0xE0, 0xD4, 0x13, 0xDC, 0xF0, 0xD7,
-        0x2A, 0xDE, 0x08, 0xDB, 0xA2, 0xE8, 0x6A, 0xE7, 0x65, 0xED, 0xA9, 0xED,
-        0x65, 0xF1, 0x1C, 0xF1, 0x43, 0xF5, 0xEE, 0xF2, 0xB9, 0xF8, 0x1C, 0xF5,
-        0x72, 0xFC, 0x33, 0xFA, 0x9F, 0xFD, 0x98, 0xFE, 0x8E, 0xFF, 0xB0, 0x02,
-        0xF0, 0xFE, 0x3A, 0x01, 0x20, 0x00, 0x61, 0xFF, 0xBB, 0xFF, 0x11, 0xFD,
-        0x12, 0x01, 0xEB, 0xFF, 0x89, 0x00, 0xAF, 0x03, 0x49, 0x01, 0x7E, 0x08,
-        0x5B, 0x01, 0xF6, 0x09, 0xEA, 0x00, 0x6C, 0x08, 0x4B, 0x18, 0x4C, 0x1E,
-        0xC2, 0x25, 0x26, 0x2B, 0xE5, 0x22, 0x0B, 0x28, 0x57, 0x21, 0x31, 0x25,
-        0x09, 0x17, 0x81, 0x18, 0x5E, 0x12, 0x04, 0x12, 0x5D, 0x0E, 0x5E, 0x0E,
-        0x53, 0x0A, 0x6C, 0x0C, 0xC6, 0x06, 0x31, 0x0A, 0xD4, 0x02, 0xD7, 0x04,
-        0xA1, 0x01, 0x5E, 0x00, 0x8A, 0xFF, 0x12, 0xFC, 0x35, 0x00, 0xB7, 0xFD,
-        0x07, 0xFF, 0xC8, 0xFF, 0x41, 0xFF, 0x29, 0x02, 0xB7, 0xFD, 0x31, 0xFF,
-        0x60, 0xFE, 0x77, 0xFB, 0x40, 0xFE, 0xFA, 0xF6, 0x7A, 0xFE, 0xA4, 0xF5,
-        0xA0, 0xFF, 0xB4, 0xF7, 0x6F, 0xE8, 0x0F, 0xE2, 0x9A, 0xDA, 0xEA, 0xD4,
-        0x7C, 0xDD, 0x1E, 0xD8, 0x42, 0xDF, 0x26, 0xDB, 0xCE, 0xE9, 0xE8, 0xE7,
-        0xA1, 0xEE, 0x4D, 0xEE, 0xD7, 0xF2, 0x15, 0xF2, 0xF2, 0xF6, 0x28, 0xF4,
-        0x3D, 0xFA, 0x87, 0xF6, 0xE7, 0xFD, 0x2A, 0xFC, 0xB3, 0xFE, 0xC4, 0x00,
-        0x20, 0x00, 0xC2, 0x04, 0x43, 0xFF, 0xE3, 0x02, 0xD5, 0x00, 0xF2, 0x00,
-        0xF7, 0x00, 0xA1, 0xFE, 0x9E, 0x02, 0x69, 0x01, 0x6E, 0x01, 0xA4, 0x04,
-        0x4F, 0x01, 0xFC, 0x08, 0x2D, 0x01, 0x7F, 0x0A, 0x01, 0x00, 0x36, 0x08,
-        0x05, 0x17, 0x6C, 0x1D, 0x33, 0x25, 0x7B, 0x2A, 0xA3, 0x22, 0x67, 0x27,
-        0xF8, 0x20, 0x7A, 0x24, 0x7C, 0x16, 0xF8, 0x17, 0x77, 0x11, 0x9D, 0x11,
-        0x2D, 0x0D, 0xC0, 0x0D, 0xF0, 0x08, 0x77, 0x0B, 0xAC, 0x05, 0x05, 0x09,
-        0x02, 0x02, 0x54, 0x03, 0x15, 0x01, 0xAF, 0xFE, 0xCC, 0xFF, 0x0C, 0xFB,
-        0x26, 0x00, 0x8A, 0xFC, 0x66, 0xFE, 0x46, 0xFE, 0xF7, 0xFE, 0x2D, 0x01,
-        0xDB, 0xFD, 0xBB, 0xFE, 0x25, 0xFF, 0x7D, 0xFB, 0x2E, 0xFF, 0x0C, 0xF7,
-        0x66, 0xFF, 0xD8, 0xF5, 0xB2, 0x00, 0xA4, 0xF8, 0x96, 0xE9, 0xBF, 0xE3,
-        0x41, 0xDB, 0xC9, 0xD6, 0x73, 0xDD, 0x8D, 0xD9, 0x24, 0xDF, 0x46, 0xDC,
-        0x88, 0xE9, 0x3F, 0xE8, 0x6B, 0xEE, 0x2A, 0xEE, 0xCC, 0xF2, 0x06, 0xF2,
-        0x1D, 0xF7, 0x80, 0xF4, 0x2E, 0xFA, 0xE8, 0xF6, 0x6F, 0xFD, 0x55, 0xFC,
-        0x8A, 0xFE, 0x1F, 0x01, 0xC0, 0xFF, 0x87, 0x04, 0x82, 0xFF, 0xFE, 0x02,
-        0x56, 0x01, 0x58, 0x01, 0x66, 0x00, 0x21, 0xFE, 0x9A, 0x01, 0xB4, 0x00,
-        0x62, 0x00, 0x1B, 0x04, 0x79, 0x00, 0xD4, 0x08, 0xF3, 0xFF, 0xD9, 0x09,
-        0xAA, 0xFE, 0x36, 0x07, 0x02, 0x16, 0x49, 0x1C, 0x48, 0x24, 0xF4, 0x28,
-        0x84, 0x22, 0x08, 0x26, 0x0E, 0x21, 0x14, 0x23, 0xB3, 0x16, 0xDA, 0x16,
-        0x61, 0x11, 0x95, 0x10, 0x28, 0x0D, 0x33, 0x0D, 0x31, 0x09, 0x95, 0x0B,
-        0xB4, 0x05, 0x34, 0x09, 0x25, 0x02, 0xB7, 0x03, 0xFE, 0x00, 0xFC, 0xFE,
-        0x3A, 0x00, 0xF8, 0xFB, 0xAD, 0x00, 0x7C, 0xFD, 0xE4, 0xFE, 0xEA, 0xFE,
-        0xC6, 0xFF, 0xD9, 0x01, 0x65, 0xFE, 0x0D, 0xFF, 0x09, 0x00, 0xFE, 0xFB,
-        0x26, 0x00, 0x55, 0xF7, 0xE8, 0x00, 0x4F, 0xF6, 0x4B, 0x02, 0xA6, 0xF8,
-        0xF9, 0xEA, 0x54, 0xE3, 0xA9, 0xDC, 0xB4, 0xD6, 0x0F, 0xDE, 0xAB, 0xD9,
-        0x7C, 0xDF, 0x32, 0xDD, 0xE6, 0xE9, 0xD4, 0xE9, 0x32, 0xEF, 0x4D, 0xF0,
-        0x41, 0xF3, 0x6B, 0xF3, 0x2B, 0xF7, 0xEE, 0xF4, 0xC3, 0xFA, 0x73, 0xF7,
-        0xBF, 0xFD, 0xA2, 0xFC, 0xB5, 0xFE, 0x5A, 0x01, 0xC1, 0xFF, 0xB1, 0x04,
-        0x4F, 0xFF, 0x04, 0x03, 0xBC, 0x00, 0x02, 0x01, 0x08, 0x00, 0x05, 0xFE,
-        0xB3, 0x01, 0xFE, 0x00, 0xD9, 0xFF, 0xEC, 0x03, 0x82, 0xFF, 0x92, 0x08,
-        0x6C, 0xFE, 0x89, 0x09, 0x12, 0xFD, 0x7D, 0x07, 0xC4, 0x14, 0x52, 0x1D,
-        0x54, 0x23, 0x06, 0x2A, 0xFC, 0x21, 0xBD, 0x26, 0x77, 0x20, 0xC4, 0x22,
-        0x29, 0x16, 0x12, 0x16, 0x81, 0x10, 0x68, 0x0F, 0x0C, 0x0C, 0x21, 0x0C,
-        0x05, 0x08, 0xC8, 0x0A, 0xEF, 0x04, 0xA5, 0x08, 0x8C, 0x02, 0xC3, 0x03,
-        0x7D, 0x01, 0x81, 0xFE, 0x4A, 0x00, 0xDA, 0xFA, 0x11, 0x01, 0xD9, 0xFC,
-        0x9A, 0xFF, 0x02, 0xFF, 0xA3, 0xFF, 0xA1, 0x01, 0x03, 0xFE, 0xFB, 0xFE,
-        0xFF, 0xFF, 0x71, 0xFC, 0x04, 0x00, 0xA4, 0xF7, 0xF9, 0x00, 0x97, 0xF6,
-        0x3F, 0x02, 0x62, 0xF8, 0xF2, 0xEA, 0x71, 0xE2, 0xBF, 0xDC, 0x8D, 0xD5,
-        0x2F, 0xDE, 0x78, 0xD8, 0x5C, 0xDF, 0xDB, 0xDB, 0xF1, 0xE9, 0xE1, 0xE8,
-        0x12, 0xF0, 0x4F, 0xF0, 0x11, 0xF4, 0x80, 0xF3, 0x6E, 0xF7, 0x87, 0xF4,
-        0x11, 0xFA, 0x79, 0xF6, 0x98, 0xFC, 0xAA, 0xFB, 0xEF, 0xFD, 0x32, 0x01,
-        0x8D, 0xFF, 0x2A, 0x05, 0xEC, 0xFE, 0x30, 0x03, 0x68, 0x00, 0x12, 0x01,
-        0xAD, 0x00, 0xC8, 0xFE, 0x12, 0x02, 0x3C, 0x01, 0x76, 0x00, 0x17, 0x04,
-        0x88, 0x00, 0xBA, 0x08, 0x5E, 0xFF, 0x34, 0x09, 0xE8, 0xFD, 0x0F, 0x07,
-        0x4A, 0x15, 0x2B, 0x1D, 0xD3, 0x23, 0xC9, 0x2A, 0x14, 0x22, 0x06, 0x28,
-        0xAB, 0x20, 0xD0, 0x24, 0x8D, 0x15, 0x7E, 0x17, 0xCC, 0x0F, 0x65, 0x10,
-        0x41, 0x0C, 0x94, 0x0D, 0x7B, 0x08, 0x09, 0x0C, 0x72, 0x05, 0xC0, 0x09,
-        0xA1, 0x02, 0x2C, 0x04, 0xAF, 0x01, 0x11, 0xFF, 0x01, 0x00, 0xEC, 0xFA,
-        0xCC, 0x00, 0xD1, 0xFC, 0x3C, 0xFF, 0x9E, 0xFE, 0x11, 0xFF, 0xC7, 0x00,
-        0x14, 0xFE, 0xA8, 0xFE, 0x5D, 0xFF, 0x76, 0xFB, 0x5C, 0xFF, 0xFF, 0xF6,
-        0x72, 0x00, 0x97, 0xF6, 0x07, 0x02, 0xE9, 0xF8, 0x46, 0xEA, 0x4C, 0xE2,
-        0xBB, 0xDB, 0x8D, 0xD4, 0x2B, 0xDE, 0xCC, 0xD7, 0xA5, 0xDF, 0xFA, 0xDA,
-        0xEE, 0xEA, 0x66, 0xE8, 0x48, 0xF0, 0x40, 0xEF, 0x34, 0xF4, 0x80, 0xF2,
-        0x5E, 0xF8, 0x64, 0xF4, 0xA5, 0xFB, 0xC6, 0xF6, 0x6D, 0xFE, 0x16, 0xFC,
-        0xFF, 0xFE, 0xAD, 0x00, 0xB3, 0x00, 0xD4, 0x04, 0x56, 0xFF, 0xB3, 0x02,
-        0xC6, 0x00, 0x3A, 0x01, 0xA7, 0x00, 0x3B, 0xFF, 0x8D, 0x01, 0x9C, 0x01,
-        0x10, 0x00, 0xC1, 0x04, 0xF5, 0xFF, 0x13, 0x09, 0x58, 0xFF, 0xC4, 0x09,
-        0xAE, 0xFD, 0x32, 0x07, 0xD2, 0x15, 0x0C, 0x1E, 0x02, 0x24, 0x6C, 0x2B,
-        0x1E, 0x21, 0xC7, 0x27, 0x67, 0x1F, 0xA7, 0x24, 0x55, 0x14, 0xA2, 0x17,
-        0x37, 0x0F, 0x1C, 0x11, 0x0B, 0x0B, 0x7B, 0x0D, 0x2B, 0x07, 0xAD, 0x0B,
-        0x05, 0x04, 0x32, 0x09, 0x81, 0x01, 0x0C, 0x04, 0xCD, 0x00, 0x66, 0xFF,
-        0x33, 0xFF, 0x68, 0xFB, 0xD4, 0x00, 0xB7, 0xFD, 0x88, 0xFF, 0x16, 0xFF,
-        0x17, 0x00, 0x47, 0x01, 0x0F, 0xFF, 0x97, 0xFE, 0xC6, 0x00, 0x93, 0xFB,
-        0xB0, 0x00, 0x0C, 0xF7, 0x55, 0x01, 0x48, 0xF6, 0x25, 0x03, 0xD0, 0xF8,
-        0x1E, 0xEB, 0xC6, 0xE1, 0x0C, 0xDD, 0x5E, 0xD4, 0x84, 0xDF, 0x8A, 0xD7,
-        0x1A, 0xE1, 0x9F, 0xDA, 0x5F, 0xEC, 0x19, 0xE8, 0xFB, 0xF1, 0x86, 0xEF,
-        0xB4, 0xF5, 0x32, 0xF3, 0x21, 0xF9, 0xE4, 0xF4, 0x69, 0xFC, 0xB2, 0xF7,
-        0x20, 0xFF, 0xCE, 0xFC, 0x30, 0x00, 0x69, 0x01, 0xBD, 0x01, 0xE9, 0x04,
-        0x1C, 0x00, 0x81, 0x02, 0xB7, 0x00, 0xB5, 0x00, 0xE9, 0xFF, 0x8E, 0xFE,
-        0x32, 0x01, 0xC0, 0x01, 0xE2, 0xFF, 0x33, 0x05, 0x29, 0x00, 0xD3, 0x09,
-        0x1A, 0xFF, 0x38, 0x0A, 0x6A, 0xFD, 0x28, 0x08, 0x57, 0x15, 0xA6, 0x1F,
-        0x6E, 0x23, 0x8F, 0x2D, 0x93, 0x20, 0x34, 0x2A, 0x91, 0x1E, 0xAE, 0x26,
-        0xFD, 0x12, 0x9A, 0x18, 0x21, 0x0D, 0x84, 0x10, 0x27, 0x0A, 0x2D, 0x0D,
-        0xDC, 0x06, 0x3C, 0x0B, 0xAA, 0x03, 0x48, 0x08, 0xC3, 0x00, 0xE5, 0x02,
-        0xB9, 0xFF, 0x7F, 0xFE, 0x1A, 0xFE, 0x24, 0xFB, 0xBA, 0xFF, 0x9A, 0xFD,
-        0x92, 0xFF, 0xC4, 0xFF, 0x2F, 0x00, 0x8E, 0x01, 0xCE, 0xFE, 0x2E, 0xFE,
-        0xEC, 0xFF, 0x77, 0xFA, 0x0E, 0x00, 0x36, 0xF6, 0x20, 0x01, 0x99, 0xF5,
-        0x73, 0x02, 0xCA, 0xF6, 0xA4, 0xEA, 0xF9, 0xDE, 0xA0, 0xDC, 0xFB, 0xD0,
-        0xFC, 0xDF, 0x3D, 0xD5, 0xF9, 0xE1, 0x4D, 0xD9, 0x25, 0xED, 0x93, 0xE7,
-        0xAA, 0xF2, 0x9F, 0xEF, 0x13, 0xF6, 0x46, 0xF3, 0xCB, 0xF9, 0x57, 0xF5,
-        0xD2, 0xFC, 0xF0, 0xF7, 0xF1, 0xFF, 0x81, 0xFD, 0xD7, 0x00, 0xEF, 0x01,
-        0x3B, 0x02, 0x3E, 0x05, 0x3C, 0x00, 0xBD, 0x02, 0xBA, 0x00, 0x26, 0x01,
-        0x41, 0x00, 0x87, 0xFF, 0x1D, 0x01, 0x57, 0x02, 0xE4, 0xFF, 0xA4, 0x05,
-        0xAC, 0xFF, 0x7E, 0x09, 0xE0, 0xFE, 0x37, 0x0A, 0xAB, 0xFD, 0x44, 0x09,
-        0x35, 0x15, 0x2F, 0x21, 0xE1, 0x22, 0x06, 0x2F, 0x8D, 0x1F, 0xE5, 0x2A,
-        0xCC, 0x1D, 0xEA, 0x26, 0xF5, 0x12, 0xCB, 0x18, 0xAE, 0x0D, 0xE9, 0x10,
-        0xEC, 0x09, 0x05, 0x0D, 0x05, 0x06, 0xE5, 0x0A, 0x15, 0x03, 0x5E, 0x08,
-        0x98, 0x00, 0x38, 0x03, 0xC1, 0xFF, 0xB8, 0xFE, 0x27, 0xFE, 0x13, 0xFB,
-        0xFA, 0xFF, 0x5D, 0xFD, 0x61, 0xFF, 0xD7, 0xFE, 0x0C, 0x00, 0x92, 0x00,
-        0x53, 0xFF, 0xD0, 0xFD, 0xBE, 0x00, 0x9A, 0xFA, 0x90, 0x00, 0x88, 0xF6,
-        0x7B, 0x01, 0x1C, 0xF6, 0xA7, 0x02, 0x3C, 0xF7, 0x3B, 0xEB, 0x6C, 0xDF,
-        0xE0, 0xDD, 0xDC, 0xD1, 0x06, 0xE1, 0xA2, 0xD5, 0xCC, 0xE2, 0x79, 0xD9,
-        0x6B, 0xED, 0x2F, 0xE7, 0xFA, 0xF2, 0x36, 0xEF, 0xC2, 0xF6, 0xDA, 0xF2,
-        0x8B, 0xFA, 0xC0, 0xF4, 0x8B, 0xFD, 0x64, 0xF7, 0x90, 0xFF, 0x50, 0xFC,
-        0x43, 0x00, 0x0C, 0x01, 0xD4, 0x01, 0xEC, 0x04, 0x21, 0x00, 0x03, 0x03,
-        0x4F, 0x00, 0x21, 0x01, 0x70, 0xFF, 0x10, 0xFF, 0x52, 0x00, 0xDB, 0x01,
-        0xCF, 0xFE, 0xB8, 0x04, 0x4C, 0xFF, 0xE2, 0x08, 0x64, 0xFE, 0x2B, 0x09,
-        0x99, 0xFD, 0x93, 0x08, 0x96, 0x14, 0x4D, 0x20, 0x3C, 0x21, 0xB3, 0x2D,
-        0xFB, 0x1D, 0x34, 0x2A, 0x32, 0x1C, 0x9E, 0x26, 0x02, 0x12, 0x1E, 0x19,
-        0xC1, 0x0C, 0x11, 0x11, 0xB3, 0x09, 0xCC, 0x0D, 0xDD, 0x05, 0xBD, 0x0B,
-        0xAB, 0x02, 0xE6, 0x08, 0x87, 0x00, 0xF2, 0x03, 0x9C, 0xFF, 0x0A, 0xFF,
-        0x54, 0xFE, 0x5D, 0xFB, 0x39, 0x00, 0x46, 0xFD, 0x5C, 0x00, 0x48, 0xFF,
-        0xFC, 0x00, 0x16, 0x01, 0x11, 0x00, 0x39, 0xFE, 0x4F, 0x01, 0x22, 0xFB,
-        0x7E, 0x00, 0xBE, 0xF6, 0x70, 0x01, 0x6F, 0xF6, 0x47, 0x02, 0x06, 0xF7,
-        0x4C, 0xEB, 0x0C, 0xDF, 0xAC, 0xDE, 0x99, 0xD1, 0x60, 0xE2, 0x6C, 0xD5,
-        0x3B, 0xE4, 0x2C, 0xD9, 0x4E, 0xEE, 0xCE, 0xE6, 0xF5, 0xF2, 0xBE, 0xEE,
-        0xB4, 0xF5, 0xF1, 0xF1, 0x6A, 0xF9, 0x26, 0xF4, 0x4F, 0xFC, 0xB9, 0xF6,
-        0x7C, 0xFE, 0xB8, 0xFB, 0x61, 0xFF, 0xA6, 0x00, 0x7C, 0x00, 0x36, 0x04,
-        0x70, 0xFE, 0x52, 0x02, 0xA4, 0xFE, 0x9D, 0x00, 0x35, 0xFE, 0xC7, 0xFE,
-        0x43, 0xFF, 0x9B, 0x01, 0x3A, 0xFE, 0xC9, 0x04, 0x17, 0xFF, 0x56, 0x09,
-        0x1D, 0xFE, 0xD9, 0x09, 0xA2, 0xFC, 0xE5, 0x08, 0x97, 0x13, 0xC6, 0x20,
-        0x8D, 0x20, 0x3B, 0x2E, 0x52, 0x1D, 0x39, 0x2A, 0xD4, 0x1B, 0x52, 0x26,
-        0x00, 0x12, 0x61, 0x18, 0x9A, 0x0D, 0x7F, 0x10, 0xB4, 0x0A, 0x2B, 0x0D,
-        0xF2, 0x06, 0x2F, 0x0B, 0x27, 0x04, 0x01, 0x09, 0xE4, 0x01, 0x33, 0x04,
-        0xE3, 0x00, 0x52, 0xFF, 0x2B, 0x00, 0xFB, 0xFB, 0x60, 0x02, 0xBA, 0xFD,
-        0x34, 0x02, 0x26, 0xFF, 0x01, 0x03, 0x3D, 0x01, 0xCB, 0x01, 0x2A, 0xFE,
-        0xDC, 0x02, 0x11, 0xFB, 0x13, 0x02, 0x9D, 0xF6, 0xEE, 0x02, 0xFA, 0xF5,
-        0x50, 0x04, 0xF1, 0xF6, 0x1E, 0xED, 0x2B, 0xDF, 0xBE, 0xDF, 0xEA, 0xD1,
-        0x7C, 0xE2, 0x0F, 0xD6, 0x00, 0xE4, 0x72, 0xDA, 0xB4, 0xED, 0x74, 0xE8,
-        0xE5, 0xF1, 0x28, 0xF0, 0xB9, 0xF4, 0x38, 0xF3, 0xA5, 0xF8, 0x4F, 0xF5,
-        0x67, 0xFB, 0x69, 0xF7, 0x80, 0xFD, 0x09, 0xFC, 0x86, 0xFE, 0xD6, 0x00,
-        0xF2, 0xFE, 0xE3, 0x03, 0xFE, 0xFC, 0x59, 0x02, 0x19, 0xFD, 0xE5, 0x00,
-        0x39, 0xFC, 0x91, 0xFE, 0x67, 0xFD, 0x78, 0x01, 0x3E, 0xFC, 0x45, 0x04,
-        0x0F, 0xFD, 0x86, 0x08, 0x3F, 0xFC, 0x2E, 0x09, 0x17, 0xFB, 0x6F, 0x08,
-        0x5B, 0x12, 0x3E, 0x20, 0x1B, 0x20, 0xA2, 0x2D, 0x42, 0x1D, 0x28, 0x29,
-        0xBA, 0x1B, 0x9D, 0x24, 0x1E, 0x12, 0xAD, 0x16, 0xAE, 0x0D, 0xDF, 0x0E,
-        0xFC, 0x0A, 0x2D, 0x0C, 0x1C, 0x07, 0x40, 0x0A, 0x62, 0x04, 0x40, 0x08,
-        0xDD, 0x01, 0x41, 0x03, 0xEB, 0x00, 0xA4, 0xFE, 0xC2, 0x00, 0x0A, 0xFC,
-        0xD6, 0x02, 0xCB, 0xFD, 0xDA, 0x02, 0x98, 0xFF, 0xA7, 0x03, 0x07, 0x02,
-        0x8C, 0x02, 0x67, 0xFF, 0x98, 0x03, 0x9E, 0xFC, 0xE1, 0x02, 0x7D, 0xF8,
-        0xA0, 0x03, 0x71, 0xF7, 0xEC, 0x04, 0xC6, 0xF7, 0xD5, 0xED, 0x8C, 0xDF,
-        0xFC, 0xDF, 0xA9, 0xD1, 0x22, 0xE3, 0x45, 0xD6, 0x67, 0xE4, 0xA3, 0xDA,
-        0xF5, 0xED, 0xC2, 0xE8, 0x2D, 0xF2, 0xA3, 0xF0, 0xF3, 0xF4, 0x98, 0xF3,
-        0x8D, 0xF8, 0x73, 0xF5, 0xFD, 0xFA, 0x68, 0xF7, 0x91, 0xFD, 0x82, 0xFC,
-        0x61, 0xFE, 0xFE, 0x00, 0xF6, 0xFE, 0xCC, 0x03, 0xC5, 0xFC, 0xC1, 0x01,
-        0x05, 0xFD, 0xF8, 0xFF, 0x66, 0xFC, 0x94, 0xFD, 0x59, 0xFD, 0x2C, 0x00,
-        0x40, 0xFC, 0x1C, 0x03, 0xEE, 0xFC, 0x90, 0x07, 0x49, 0xFC, 0x1F, 0x09,
-        0xC8, 0xFA, 0x0B, 0x09, 0x5D, 0x12, 0xFA, 0x21, 0x5B, 0x20, 0x0A, 0x30,
-        0x3C, 0x1D, 0x21, 0x2B, 0x00, 0x1C, 0x6B, 0x26, 0xAC, 0x12, 0xEA, 0x17,
-        0x43, 0x0E, 0x73, 0x0F, 0xF4, 0x0A, 0xBA, 0x0B, 0x8D, 0x07, 0xF4, 0x09,
-        0x0F, 0x05, 0xE0, 0x07, 0xD1, 0x02, 0x12, 0x03, 0x72, 0x02, 0x0C, 0xFF,
-        0xEE, 0x01, 0x3C, 0xFC, 0xE5, 0x03, 0x18, 0xFE, 0x68, 0x03, 0xB0, 0xFF,
-        0x01, 0x04, 0x21, 0x02, 0xDA, 0x02, 0x54, 0xFF, 0x06, 0x04, 0x75, 0xFC,
-        0xFB, 0x02, 0xC4, 0xF7, 0x74, 0x03, 0x1A, 0xF6, 0xF2, 0x04, 0x60, 0xF6,
-        0xA1, 0xED, 0xEA, 0xDD, 0xD0, 0xDF, 0x37, 0xD0, 0x95, 0xE2, 0xEA, 0xD4,
-        0xD5, 0xE3, 0xAF, 0xD9, 0xC0, 0xEC, 0xF9, 0xE7, 0x2C, 0xF1, 0x94, 0xF0,
-        0x88, 0xF4, 0x67, 0xF4, 0xEA, 0xF7, 0x26, 0xF6, 0x58, 0xFA, 0x1C, 0xF8,
-        0xB9, 0xFC, 0xE1, 0xFC, 0x76, 0xFD, 0x48, 0x01, 0xF2, 0xFD, 0x0A, 0x04,
-        0x0F, 0xFC, 0x68, 0x02, 0x55, 0xFC, 0x92, 0x00, 0xC4, 0xFB, 0x12, 0xFE,
-        0xFA, 0xFC, 0xE6, 0x00, 0x40, 0xFC, 0x12, 0x04, 0xA9, 0xFD, 0xEF, 0x08,
-        0xED, 0xFC, 0x23, 0x0A, 0xB6, 0xFB, 0xDD, 0x09, 0xBE, 0x12, 0xD0, 0x21,
-        0x44, 0x20, 0x2B, 0x2F, 0x42, 0x1D, 0x76, 0x2A, 0x0F, 0x1C, 0x13, 0x26,
-        0x18, 0x13, 0xF4, 0x17, 0xA7, 0x0E, 0x5D, 0x0F, 0xB3, 0x0B, 0xE1, 0x0B,
-        0x19, 0x08, 0xBF, 0x09, 0x74, 0x05, 0x85, 0x07, 0xD3, 0x02, 0x81, 0x02,
-        0x2C, 0x02, 0x41, 0xFE, 0xF2, 0x01, 0xA6, 0xFB, 0x32, 0x04, 0x98, 0xFD,
-        0x21, 0x04, 0xB5, 0xFF, 0x33, 0x04, 0xE7, 0x01, 0xFC, 0x02, 0x41, 0xFF,
-        0x5F, 0x03, 0xE1, 0xFB, 0xD6, 0x01, 0xE1, 0xF6, 0xA4, 0x02, 0x9D, 0xF5,
-        0x6C, 0x04, 0x54, 0xF6, 0x8F, 0xED, 0x92, 0xDE, 0xF3, 0xDF, 0x2F, 0xD1,
-        0xFC, 0xE2, 0xEC, 0xD5, 0xA5, 0xE3, 0xC3, 0xD9, 0x9E, 0xEC, 0xF9, 0xE7,
-        0x25, 0xF1, 0xE1, 0xF0, 0x38, 0xF4, 0xAA, 0xF4, 0x8A, 0xF7, 0x9D, 0xF6,
-        0x77, 0xFA, 0xEE, 0xF8, 0x99, 0xFD, 0xEC, 0xFD, 0x17, 0xFE, 0x7C, 0x01,
-        0xA6, 0xFE, 0x10, 0x04, 0x67, 0xFC, 0x05, 0x02, 0x94, 0xFC, 0xF7, 0xFF,
-        0x55, 0xFC, 0x8D, 0xFD, 0xC6, 0xFD, 0x75, 0x00, 0x20, 0xFD, 0xAE, 0x03,
-        0x2C, 0xFE, 0x75, 0x08, 0x64, 0xFD, 0x2C, 0x0A, 0x2E, 0xFB, 0x3F, 0x09,
-        0x28, 0x12, 0x13, 0x21, 0x27, 0x20, 0x8E, 0x2E, 0x68, 0x1D, 0xE2, 0x29,
-        0x93, 0x1C, 0xD1, 0x25, 0x90, 0x13, 0xA6, 0x17, 0xFB, 0x0E, 0xD7, 0x0E,
-        0x21, 0x0B, 0x97, 0x0A, 0xEE, 0x07, 0xF7, 0x08, 0x2D, 0x05, 0x4E, 0x07,
-        0x0F, 0x02, 0xE5, 0x02, 0x5E, 0x01, 0xA7, 0xFF, 0xE2, 0x00, 0x51, 0xFD,
-        0xAD, 0x02, 0xCB, 0xFE, 0xC7, 0x01, 0xD8, 0xFF, 0x73, 0x02, 0x6F, 0x02,
-        0x5D, 0x01, 0xA0, 0xFF, 0x54, 0x02, 0x7D, 0xFC, 0xD3, 0x01, 0xF7, 0xF7,
-        0x0E, 0x03, 0x47, 0xF6, 0x44, 0x05, 0x04, 0xF7, 0x31, 0xEE, 0x33, 0xDF,
-        0x3B, 0xE0, 0x0D, 0xD2, 0x87, 0xE2, 0x74, 0xD6, 0x1A, 0xE3, 0x30, 0xDA,
-        0x38, 0xEC, 0x1F, 0xE8, 0x3B, 0xF1, 0xE8, 0xF0, 0x51, 0xF5, 0xFC, 0xF4,
-        0xB0, 0xF8, 0x92, 0xF6, 0x67, 0xFB, 0x18, 0xF8, 0x4E, 0xFE, 0x22, 0xFC,
-        0x4C, 0xFF, 0xBC, 0xFF, 0xE1, 0xFF, 0x6A, 0x02, 0xEE, 0xFD, 0x3C, 0x01,
-        0x6C, 0xFE, 0x38, 0x00, 0x5C, 0xFD, 0x7B, 0xFD, 0x2E, 0xFE, 0x24, 0x00,
-        0x79, 0xFD, 0x6D, 0x03, 0x8F, 0xFE, 0x75, 0x08, 0x42, 0xFD, 0x17, 0x0A,
-        0xD9, 0xFA, 0x2C, 0x09, 0x06, 0x12, 0xE1, 0x20, 0x1C, 0x20, 0x07, 0x2E,
-        0x9F, 0x1D, 0x43, 0x29, 0xC5, 0x1C, 0x6B, 0x25, 0x93, 0x13, 0x75, 0x17,
-        0x73, 0x0E, 0xD4, 0x0E, 0xBE, 0x0A, 0x21, 0x0B, 0xA3, 0x07, 0xC8, 0x09,
-        0xAA, 0x04, 0xD9, 0x07, 0x94, 0x01, 0x92, 0x03, 0xB0, 0x00, 0xFB, 0xFF,
-        0x45, 0x00, 0x4D, 0xFD, 0x76, 0x02, 0x9E, 0xFE, 0x2C, 0x02, 0xE3, 0xFF,
-        0xE4, 0x02, 0x79, 0x02, 0x77, 0x01, 0x79, 0xFF, 0x3D, 0x02, 0xA1, 0xFC,
-        0x5B, 0x01, 0x05, 0xF8, 0xD7, 0x02, 0xB3, 0xF6, 0x24, 0x05, 0xA7, 0xF7,
-        0xA6, 0xED, 0xBA, 0xDF, 0x4B, 0xDF, 0x89, 0xD2, 0xF4, 0xE1, 0x65, 0xD7,
-        0x05, 0xE3, 0x7F, 0xDB, 0x0B, 0xEC, 0x1C, 0xE9, 0x44, 0xF1, 0xB3, 0xF1,
-        0x68, 0xF5, 0x7E, 0xF5, 0xF3, 0xF8, 0x10, 0xF7, 0x75, 0xFC, 0x25, 0xF9,
-        0xA3, 0xFF, 0x31, 0xFD, 0x18, 0x00, 0x26, 0x00, 0x33, 0x00, 0x7A, 0x02,
-        0xF7, 0xFD, 0x2A, 0x01, 0xF7, 0xFD, 0x91, 0xFF, 0x4C, 0xFD, 0xFC, 0xFC,
-        0xC1, 0xFE, 0xFB, 0xFF, 0xD3, 0xFD, 0xAA, 0x02, 0x85, 0xFE, 0x0D, 0x07,
-        0x16, 0xFD, 0x79, 0x08, 0xF2, 0xFA, 0x98, 0x07, 0x63, 0x12, 0x58, 0x1F,
-        0xFA, 0x20, 0xBB, 0x2C, 0x9D, 0x1E, 0x4F, 0x28, 0x83, 0x1D, 0x68, 0x24,
-        0xDF, 0x13, 0x7D, 0x16, 0x17, 0x0E, 0xB9, 0x0D, 0x91, 0x09, 0x0D, 0x0A,
-        0xF3, 0x05, 0xE6, 0x08, 0xAD, 0x02, 0x7C, 0x07, 0x39, 0xFF, 0x81, 0x03,
-        0xC6, 0xFE, 0x7D, 0x00, 0x6D, 0xFE, 0x9C, 0xFD, 0xE3, 0x00, 0xB0, 0xFE,
-        0x3E, 0x01, 0x42, 0x00, 0x26, 0x02, 0xBD, 0x02, 0x3A, 0x01, 0x11, 0x00,
-        0x3F, 0x02, 0x76, 0xFD, 0xDF, 0x01, 0x80, 0xF9, 0x3E, 0x03, 0x2B, 0xF8,
-        0x5D, 0x05, 0x36, 0xF9, 0xE0, 0xED, 0x9A, 0xE1, 0x1F, 0xDF, 0xEF, 0xD3,
-        0x7E, 0xE1, 0x2E, 0xD8, 0xA2, 0xE2, 0xB8, 0xDB, 0xD1, 0xEC, 0xE3, 0xE9,
-        0x89, 0xF2, 0x27, 0xF2, 0x35, 0xF7, 0x9D, 0xF5, 0xD5, 0xFA, 0x7E, 0xF6,
-        0xE8, 0xFD, 0xA1, 0xF7, 0x7E, 0x01, 0xC5, 0xFB, 0xBF, 0x01, 0xFC, 0xFE,
-        0x4F, 0x02, 0x90, 0x02, 0xB2, 0xFF, 0xDF, 0x01, 0x5F, 0xFF, 0xBE, 0x00,
-        0xF9, 0xFD, 0x08, 0xFE, 0x4C, 0xFE, 0x22, 0x00, 0x67, 0xFD, 0xA1, 0x02,
-        0x10, 0xFE, 0x7E, 0x06, 0x5E, 0xFD, 0x36, 0x08, 0x3B, 0xFB, 0xF1, 0x06,
-        0xA3, 0x12, 0x74, 0x1E, 0x50, 0x21, 0x37, 0x2C, 0xE3, 0x1E, 0x26, 0x28,
-        0x7D, 0x1D, 0x98, 0x24, 0xFB, 0x12, 0x45, 0x16, 0x7E, 0x0D, 0x73, 0x0E,
-        0xC3, 0x08, 0x18, 0x0B, 0x19, 0x05, 0x22, 0x0A, 0x41, 0x02, 0x26, 0x09,
-        0xDC, 0xFE, 0xFA, 0x04, 0x8A, 0xFE, 0x75, 0x01, 0x37, 0xFE, 0xC9, 0xFD,
-        0x37, 0x01, 0xA1, 0xFE, 0x97, 0x01, 0xA1, 0xFF, 0xDC, 0x02, 0x1F, 0x02,
-        0x51, 0x02, 0xDC, 0xFF, 0xD6, 0x02, 0x43, 0xFD, 0xD4, 0x01, 0x6D, 0xF9,
-        0x80, 0x02, 0xE2, 0xF7, 0x9E, 0x04, 0x48, 0xF9, 0x0B, 0xED, 0x91, 0xE1,
-        0x0C, 0xDE, 0x65, 0xD3, 0x03, 0xE1, 0xE1, 0xD7, 0xD5, 0xE2, 0xD8, 0xDB,
-        0x19, 0xED, 0xE9, 0xE9, 0x4E, 0xF2, 0x5C, 0xF1, 0xC5, 0xF6, 0x54, 0xF4,
-        0xB6, 0xFA, 0x86, 0xF5, 0xCC, 0xFD, 0xBF, 0xF6, 0x3A, 0x01, 0xFC, 0xFA,
-        0x27, 0x01, 0x3B, 0xFE, 0x12, 0x01, 0xA9, 0x01, 0x2C, 0xFE, 0x0E, 0x01,
-        0xCD, 0xFD, 0x2F, 0x00, 0x9D, 0xFC, 0xEA, 0xFD, 0x4A, 0xFD, 0x5F, 0x00,
-        0xCF, 0xFC, 0xDB, 0x02, 0xB4, 0xFD, 0x65, 0x06, 0x4E, 0xFD, 0x00, 0x08,
-        0x62, 0xFB, 0xB6, 0x06, 0xCB, 0x12, 0x38, 0x1E, 0x94, 0x21, 0x49, 0x2C,
-        0x44, 0x1E, 0x87, 0x27, 0xA0, 0x1C, 0xBE, 0x23, 0xE7, 0x12, 0x22, 0x16,
-        0xA4, 0x0D, 0xAB, 0x0E, 0xD4, 0x08, 0x61, 0x0B, 0x92, 0x04, 0xE7, 0x09,
-        0x76, 0x01, 0xA7, 0x08, 0x7F, 0xFE, 0xD5, 0x04, 0xEC, 0xFE, 0xBF, 0x01,
-        0xD1, 0xFE, 0xF9, 0xFD, 0x8C, 0x01, 0x49, 0xFE, 0x0B, 0x02, 0x4C, 0xFF,
-        0x9C, 0x03, 0xE9, 0x01, 0x99, 0x02, 0x2D, 0xFF, 0xF5, 0x02, 0xB8, 0xFC,
-        0x4A, 0x02, 0x90, 0xF9, 0xC4, 0x02, 0x25, 0xF8, 0xFD, 0x04, 0xC0, 0xF9,
-        0xC9, 0xED, 0x5E, 0xE2, 0x07, 0xDF, 0x0F, 0xD4, 0x49, 0xE2, 0x72, 0xD8,
-        0x21, 0xE4, 0x57, 0xDC, 0xE2, 0xED, 0xE6, 0xE9, 0x17, 0xF3, 0x62, 0xF1,
-        0xE0, 0xF7, 0x9C, 0xF4, 0xAD, 0xFB, 0xB2, 0xF5, 0xAC, 0xFE, 0xCF, 0xF6,
-        0x8C, 0x01, 0x8E, 0xFA, 0x8F, 0x01, 0x36, 0xFE, 0x76, 0x01, 0xF3, 0x01,
-        0x74, 0xFE, 0x6C, 0x01, 0x1C, 0xFE, 0x9E, 0x00, 0x68, 0xFC, 0xE2, 0xFD,
-        0x74, 0xFD, 0xC4, 0x00, 0xFE, 0xFC, 0x3F, 0x03, 0x99, 0xFD, 0x97, 0x06,
-        0xE2, 0xFC, 0x17, 0x08, 0xDD, 0xFA, 0xEB, 0x06, 0x34, 0x12, 0xA3, 0x1E,
-        0xA8, 0x20, 0xD3, 0x2C, 0x41, 0x1D, 0x57, 0x28, 0x27, 0x1B, 0x15, 0x24,
-        0xBB, 0x11, 0x7D, 0x16, 0xAE, 0x0C, 0xC7, 0x0E, 0x48, 0x08, 0x7A, 0x0B,
-        0x8E, 0x04, 0x30, 0x0A, 0x72, 0x01, 0xEA, 0x08, 0x88, 0xFE, 0x41, 0x05,
-        0x3A, 0xFE, 0x78, 0x01, 0x7F, 0xFE, 0xFC, 0xFD, 0xB2, 0x01, 0xE1, 0xFE,
-        0xED, 0x01, 0xB9, 0xFF, 0x6B, 0x03, 0x6D, 0x02, 0x8B, 0x02, 0xD2, 0xFF,
-        0xD3, 0x02, 0x2F, 0xFD, 0xEC, 0x01, 0x55, 0xF9, 0xAB, 0x02, 0x91, 0xF7,
-        0xB4, 0x04, 0x89, 0xF8, 0x4D, 0xED, 0xAB, 0xE0, 0xE6, 0xDE, 0x74, 0xD2,
-        0xBF, 0xE2, 0x50, 0xD7, 0xE6, 0xE4, 0x97, 0xDB, 0x2A, 0xEE, 0xFA, 0xE8,
-        0x0D, 0xF3, 0x91, 0xF0, 0x7C, 0xF7, 0xF4, 0xF3, 0x57, 0xFB, 0x6F, 0xF5,
-        0xC6, 0xFE, 0xE7, 0xF6, 0xF8, 0x01, 0x9A, 0xFA, 0xFF, 0x01, 0xFC, 0xFD,
-        0x97, 0x01, 0x6B, 0x01, 0x4E, 0xFE, 0xA4, 0x00, 0x2B, 0xFE, 0x1C, 0x00,
-        0xD5, 0xFC, 0xC5, 0xFD, 0xAB, 0xFD, 0x58, 0x00, 0x5C, 0xFD, 0xFC, 0x02,
-        0xE1, 0xFD, 0x9B, 0x06, 0x01, 0xFD, 0x7F, 0x08, 0xEF, 0xFA, 0xAF, 0x07,
-        0x34, 0x12, 0x72, 0x1F, 0x95, 0x20, 0x8F, 0x2D, 0xD4, 0x1C, 0xC2, 0x28,
-        0xFC, 0x1A, 0xBD, 0x24, 0xF5, 0x11, 0xA5, 0x17, 0x3F, 0x0D, 0x3B, 0x10,
-        0xAE, 0x08, 0x85, 0x0C, 0xF6, 0x04, 0xDF, 0x0A, 0xE7, 0x01, 0x8E, 0x09,
-        0xF8, 0xFE, 0x10, 0x06, 0x02, 0xFF, 0xB2, 0x02, 0xEA, 0xFE, 0xA9, 0xFE,
-        0xE8, 0x01, 0xFB, 0xFE, 0x13, 0x02, 0x61, 0xFF, 0x74, 0x03, 0xBC, 0x01,
-        0x6E, 0x02, 0x32, 0xFF, 0x8B, 0x02, 0xAF, 0xFC, 0x58, 0x02, 0x99, 0xF9,
-        0xB2, 0x03, 0x1D, 0xF8, 0xE8, 0x05, 0xF6, 0xF8, 0xAA, 0xEE, 0x30, 0xE1,
-        0xFA, 0xDF, 0xBD, 0xD2, 0x02, 0xE3, 0xE8, 0xD6, 0x86, 0xE4, 0x91, 0xDA,
-        0xAF, 0xED, 0xAE, 0xE7, 0x88, 0xF2, 0x0B, 0xEF, 0xF6, 0xF6, 0xB2, 0xF2,
-        0x85, 0xFA, 0x6A, 0xF4, 0x3A, 0xFD, 0xA0, 0xF5, 0x17, 0x00, 0x35, 0xF9,
-        0x6B, 0x00, 0x01, 0xFD, 0xD9, 0x00, 0x71, 0x01, 0xBA, 0xFD, 0x10, 0x01,
-        0x2C, 0xFD, 0x6E, 0x00, 0xE1, 0xFB, 0x3F, 0xFE, 0x07, 0xFD, 0xBE, 0x00,
-        0x7C, 0xFD, 0x81, 0x03, 0x19, 0xFE, 0xCB, 0x06, 0xA5, 0xFC, 0x20, 0x08,
-        0x58, 0xFA, 0x46, 0x07, 0x94, 0x11, 0x2A, 0x1F, 0x31, 0x20, 0x85, 0x2D,
-        0xE4, 0x1C, 0x0F, 0x29, 0x90, 0x1B, 0x77, 0x25, 0x4D, 0x12, 0x61, 0x18,
-        0x34, 0x0D, 0x00, 0x11, 0xF9, 0x08, 0xB9, 0x0D, 0xDC, 0x05, 0x86, 0x0C,
-        0x6E, 0x03, 0x9F, 0x0B, 0x66, 0x00, 0xF1, 0x07, 0x06, 0x00, 0x33, 0x04,
-        0x25, 0xFF, 0x72, 0xFF, 0x13, 0x02, 0xAE, 0xFF, 0xC4, 0x02, 0x4E, 0x00,
-        0x0E, 0x04, 0x36, 0x02, 0xB6, 0x02, 0x55, 0xFF, 0x27, 0x02, 0x5D, 0xFC,
-        0x81, 0x01, 0x04, 0xF9, 0x12, 0x03, 0xA9, 0xF7, 0x80, 0x05, 0x97, 0xF8,
-        0x34, 0xEE, 0x98, 0xE0, 0x6C, 0xDF, 0x21, 0xD2, 0x8F, 0xE2, 0xA5, 0xD6,
-        0x97, 0xE3, 0x2A, 0xDA, 0xDB, 0xEC, 0x50, 0xE7, 0x49, 0xF2, 0xDB, 0xEE,
-        0xFD, 0xF6, 0x52, 0xF2, 0x27, 0xFA, 0x53, 0xF3, 0x9D, 0xFC, 0x06, 0xF4,
-        0x94, 0xFF, 0x8B, 0xF7, 0xE1, 0xFF, 0x31, 0xFB, 0xD4, 0x00, 0x09, 0x00,
-        0x1E, 0xFE, 0x1C, 0x00, 0x59, 0xFD, 0x81, 0xFF, 0x14, 0xFC, 0xCF, 0xFD,
-        0x80, 0xFD, 0xCC, 0x00, 0xE8, 0xFD, 0x6A, 0x03, 0x9C, 0xFE, 0xA0, 0x06,
-        0x58, 0xFD, 0xDE, 0x07, 0x0D, 0xFB, 0xC7, 0x06, 0x78, 0x12, 0x9B, 0x1E,
-        0x47, 0x21, 0x0B, 0x2D, 0x33, 0x1E, 0x9A, 0x28, 0xF0, 0x1C, 0xFB, 0x24,
-        0xA4, 0x13, 0x16, 0x18, 0xAC, 0x0D, 0x72, 0x10, 0x82, 0x08, 0xEB, 0x0C,
-        0x05, 0x05, 0xF3, 0x0B, 0xBD, 0x02, 0xA4, 0x0B, 0x3F, 0x00, 0x97, 0x08,
-        0x5E, 0x00, 0x32, 0x05, 0xB0, 0xFF, 0x5E, 0x00, 0xFC, 0x01, 0xD0, 0xFF,
-        0xA4, 0x02, 0x53, 0x00, 0xD0, 0x03, 0x12, 0x02, 0x4F, 0x02, 0x56, 0xFF,
-        0xE0, 0x01, 0x04, 0xFD, 0xEF, 0x00, 0xE5, 0xF9, 0xE5, 0x01, 0x99, 0xF8,
-        0xDC, 0x03, 0x96, 0xF9, 0xA8, 0xEC, 0x0D, 0xE2, 0xD8, 0xDD, 0x7F, 0xD3,
-        0xE0, 0xE0, 0xA4, 0xD7, 0x32, 0xE2, 0x0E, 0xDB, 0xEE, 0xEB, 0x10, 0xE8,
-        0x42, 0xF2, 0xDC, 0xEF, 0x91, 0xF7, 0x67, 0xF3, 0x23, 0xFB, 0x70, 0xF4,
-        0x13, 0xFD, 0x4E, 0xF4, 0x7D, 0xFF, 0x48, 0xF7, 0x99, 0xFF, 0xFC, 0xFA,
-        0x79, 0x00, 0x19, 0x00, 0x2C, 0xFE, 0x8D, 0x00, 0x6C, 0xFD, 0xC6, 0xFF,
-        0x5C, 0xFC, 0xB1, 0xFD, 0x3B, 0xFE, 0x57, 0x00, 0x71, 0xFF, 0x06, 0x03,
-        0x99, 0x00, 0x3C, 0x06, 0x53, 0xFF, 0x39, 0x07, 0xF3, 0xFC, 0xDE, 0x05,
-        0xDB, 0x13, 0x3A, 0x1D, 0x7F, 0x22, 0xC5, 0x2B, 0x59, 0x1F, 0xD3, 0x27,
-        0x20, 0x1E, 0xC1, 0x24, 0x0C, 0x14, 0xB9, 0x17, 0xDB, 0x0D, 0x35, 0x10,
-        0xEF, 0x08, 0xEC, 0x0C, 0x4F, 0x05, 0xC0, 0x0B, 0xF7, 0x02, 0x5F, 0x0B,
-        0xEC, 0xFF, 0xC5, 0x07, 0x83, 0xFF, 0xC2, 0x03, 0xE2, 0xFE, 0xDE, 0xFE,
-        0xCA, 0x01, 0x17, 0xFF, 0x78, 0x02, 0xFF, 0xFF, 0x57, 0x03, 0x2A, 0x02,
-        0x2E, 0x01, 0xC4, 0xFF, 0xAD, 0xFF, 0x10, 0xFD, 0x8D, 0xFE, 0xF4, 0xF9,
-        0xFD, 0xFF, 0x04, 0xF9, 0xB0, 0x02, 0x78, 0xFA, 0xDA, 0xEB, 0x1A, 0xE3,
-        0x7A, 0xDD, 0xB1, 0xD4, 0x99, 0xE0, 0x96, 0xD8, 0xA1, 0xE1, 0x51, 0xDB,
-        0xD3, 0xEB, 0x50, 0xE8, 0x28, 0xF2, 0xD7, 0xEF, 0x2A, 0xF7, 0x4A, 0xF3,
-        0xAC, 0xFA, 0x71, 0xF4, 0x1C, 0xFD, 0xF9, 0xF4, 0xF6, 0xFF, 0x56, 0xF8,
-        0x19, 0x00, 0x03, 0xFC, 0xC5, 0x00, 0xE0, 0x00, 0xF8, 0xFD, 0xC1, 0x00,
-        0xC7, 0xFD, 0x50, 0x00, 0x3F, 0xFD, 0x62, 0xFE, 0x98, 0xFF, 0xB2, 0x00,
-        0xEC, 0x00, 0xEF, 0x02, 0xBF, 0x01, 0xB0, 0x05, 0x2D, 0x00, 0x87, 0x06,
-        0x0C, 0xFD, 0xC3, 0x04, 0x7F, 0x13, 0xD3, 0x1B, 0x10, 0x22, 0x68, 0x2A,
-        0x5D, 0x1F, 0xED, 0x26, 0xA3, 0x1E, 0x7C, 0x24, 0xA1, 0x14, 0xE2, 0x17,
-        0x3A, 0x0E, 0x77, 0x10, 0xE7, 0x08, 0xC8, 0x0C, 0x30, 0x05, 0x62, 0x0B,
-        0xCF, 0x02, 0xE7, 0x0A, 0x57, 0x00, 0xDB, 0x07, 0x8B, 0x00, 0x9A, 0x04,
-        0xC6, 0xFF, 0xAD, 0xFF, 0x17, 0x02, 0x73, 0xFF, 0xFA, 0x01, 0xAA, 0xFF,
-        0x66, 0x02, 0x8E, 0x01, 0x11, 0x00, 0x85, 0xFF, 0xD1, 0xFE, 0x7B, 0xFD,
-        0xE5, 0xFD, 0xB9, 0xFA, 0x46, 0xFF, 0x86, 0xF9, 0x7E, 0x02, 0x2D, 0xFB,
-        0x7F, 0xEC, 0x52, 0xE4, 0x28, 0xDE, 0xD1, 0xD5, 0x1E, 0xE1, 0x90, 0xD9,
-        0x13, 0xE2, 0x53, 0xDC, 0x1C, 0xEC, 0xF4, 0xE8, 0x96, 0xF2, 0x61, 0xF0,
-        0xBD, 0xF7, 0xE6, 0xF3, 0x5E, 0xFB, 0x21, 0xF5, 0x7D, 0xFD, 0x5C, 0xF5,
-        0xC2, 0xFF, 0x28, 0xF8, 0x62, 0xFF, 0x3C, 0xFB, 0x4D, 0x00, 0x3B, 0x00,
-        0x00, 0xFE, 0x66, 0x00, 0xCA, 0xFD, 0xF1, 0xFF, 0x47, 0xFD, 0x1F, 0xFE,
-        0x91, 0xFF, 0x4D, 0x00, 0xE8, 0x00, 0xA4, 0x02, 0xCB, 0x01, 0xA3, 0x05,
-        0x52, 0x00, 0xE4, 0x06, 0xED, 0xFC, 0x34, 0x05, 0xF7, 0x12, 0x2B, 0x1C,
-        0x80, 0x21, 0xCF, 0x2A, 0x63, 0x1E, 0xBA, 0x26, 0x51, 0x1D, 0x95, 0x23,
-        0x4C, 0x13, 0xCA, 0x16, 0xCB, 0x0C, 0x4E, 0x0F, 0x7D, 0x07, 0x9F, 0x0B,
-        0xDF, 0x03, 0x8E, 0x0A, 0xAF, 0x01, 0x54, 0x0A, 0x5C, 0xFF, 0x6A, 0x07,
-        0x09, 0x00, 0x77, 0x04, 0xC4, 0xFF, 0xF1, 0xFF, 0xD9, 0x02, 0x64, 0x00,
-        0x50, 0x03, 0xEF, 0x00, 0xC3, 0x03, 0x81, 0x02, 0x40, 0x01, 0xF3, 0xFF,
-        0x9D, 0xFF, 0x26, 0xFD, 0xB8, 0xFE, 0xF1, 0xF9, 0x71, 0x00, 0xEC, 0xF8,
-        0xF2, 0x03, 0xAD, 0xFA, 0x74, 0xED, 0x4B, 0xE3, 0xE2, 0xDE, 0x9B, 0xD4,
-        0x21, 0xE2, 0xE5, 0xD8, 0x29, 0xE3, 0x2E, 0xDC, 0x17, 0xED, 0x07, 0xE9,
-        0x71, 0xF3, 0x96, 0xF0, 0xC3, 0xF8, 0x71, 0xF4, 0x24, 0xFC, 0x5C, 0xF5,
-        0x55, 0xFE, 0xA0, 0xF5, 0x9F, 0x00, 0xB3, 0xF8, 0xD3, 0xFF, 0xAF, 0xFB,
-        0xCA, 0xFF, 0x16, 0x00, 0x86, 0xFC, 0x6D, 0xFF, 0x55, 0xFC, 0x13, 0xFF,
-        0xF9, 0xFB, 0x6A, 0xFD, 0xAA, 0xFE, 0xFF, 0xFF, 0x37, 0x00, 0xB8, 0x02,
-        0xFA, 0x00, 0xD7, 0x05, 0x19, 0xFF, 0xCA, 0x06, 0xAA, 0xFB, 0x15, 0x05,
-        0x43, 0x12, 0xA7, 0x1C, 0xAD, 0x20, 0x38, 0x2B, 0xAC, 0x1D, 0x34, 0x27,
-        0xE5, 0x1C, 0x28, 0x24, 0x05, 0x13, 0x43, 0x17, 0x98, 0x0C, 0x87, 0x0F,
-        0x3B, 0x07, 0x7C, 0x0B, 0xAF, 0x03, 0x62, 0x0A, 0x3B, 0x01, 0xDA, 0x09,
-        0xF9, 0xFE, 0xBA, 0x06, 0xC9, 0xFF, 0x9B, 0x03, 0xE2, 0xFF, 0x27, 0xFF,
-        0x1D, 0x03, 0xBE, 0xFF, 0x95, 0x03, 0x7E, 0x00, 0x0E, 0x04, 0x73, 0x02,
-        0x6E, 0x01, 0x28, 0x00, 0x05, 0x00, 0xB9, 0xFD, 0x34, 0xFF, 0x85, 0xFA,
-        0xD3, 0x00, 0x6C, 0xF9, 0xE4, 0x03, 0xCC, 0xFA, 0x5E, 0xED, 0x5E, 0xE3,
-        0xD8, 0xDE, 0xB9, 0xD4, 0xD2, 0xE1, 0xAF, 0xD8, 0xB9, 0xE2, 0xE4, 0xDB,
-        0xEF, 0xEC, 0x13, 0xE9, 0x8D, 0xF3, 0xFA, 0xF0, 0x7C, 0xF8, 0x9A, 0xF4,
-        0x16, 0xFC, 0x93, 0xF5, 0xA5, 0xFE, 0x17, 0xF6, 0x58, 0x01, 0x86, 0xF9,
-        0x93, 0x00, 0xB6, 0xFC, 0xA6, 0x00, 0x47, 0x01, 0x9F, 0xFD, 0xD9, 0x00,
-        0xB5, 0xFC, 0x7C, 0xFF, 0xF1, 0xFB, 0x14, 0xFD, 0x5F, 0xFE, 0xF4, 0xFE,
-        0xF0, 0xFF, 0x7D, 0x01, 0xCF, 0x00, 0xBF, 0x04, 0x82, 0xFF, 0x0D, 0x06,
-        0x6C, 0xFC, 0x96, 0x04, 0x0B, 0x13, 0xF7, 0x1B, 0x43, 0x22, 0x41, 0x2B,
-        0xB4, 0x1F, 0xA2, 0x27, 0x06, 0x1F, 0x90, 0x24, 0x5E, 0x14, 0x02, 0x17,
-        0x84, 0x0D, 0xDF, 0x0E, 0x60, 0x08, 0x42, 0x0B, 0x7A, 0x04, 0x4B, 0x0A,
-        0x96, 0x01, 0xD4, 0x09, 0x5D, 0xFE, 0x17, 0x06, 0x24, 0xFF, 0x1A, 0x03,
-        0x20, 0xFF, 0xAF, 0xFE, 0x37, 0x02, 0x68, 0xFF, 0xFC, 0x02, 0xC8, 0x00,
-        0x8E, 0x03, 0x2F, 0x03, 0xDE, 0x00, 0x25, 0x01, 0x0B, 0xFF, 0x44, 0xFE,
-        0x46, 0xFE, 0xF7, 0xFA, 0xC1, 0xFF, 0xC4, 0xF9, 0x36, 0x03, 0x8D, 0xFB,
-        0x6A, 0xEC, 0xE2, 0xE3, 0xF8, 0xDC, 0x3E, 0xD4, 0x84, 0xDF, 0xBE, 0xD7,
-        0x21, 0xE0, 0xB3, 0xDA, 0xAB, 0xEA, 0x21, 0xE8, 0x4F, 0xF1, 0x1C, 0xF0,
-        0xAB, 0xF6, 0xE5, 0xF3, 0xD2, 0xFA, 0xF9, 0xF4, 0x09, 0xFE, 0x8E, 0xF5,
-        0x14, 0x01, 0x26, 0xF9, 0x44, 0x00, 0x1D, 0xFC, 0x41, 0x00, 0x9C, 0x00,
-        0x79, 0xFD, 0x24, 0x00, 0x3C, 0xFD, 0x37, 0xFF, 0xAE, 0xFC, 0xBD, 0xFC,
-        0x43, 0xFF, 0xB5, 0xFE, 0x8A, 0x00, 0x56, 0x01, 0x26, 0x01, 0xC4, 0x04,
-        0xD3, 0xFF, 0x5E, 0x06, 0x81, 0xFC, 0xD5, 0x04, 0x78, 0x13, 0xCE, 0x1C,
-        0xC3, 0x22, 0x5B, 0x2C, 0x32, 0x20, 0xED, 0x28, 0xA9, 0x1F, 0xFB, 0x25,
-        0x58, 0x15, 0x90, 0x18, 0xBF, 0x0E, 0x56, 0x10, 0x5B, 0x09, 0x35, 0x0C,
-        0x51, 0x05, 0x33, 0x0B, 0x8B, 0x02, 0xFB, 0x0A, 0x2E, 0x00, 0x05, 0x08,
-        0xE8, 0x00, 0xC9, 0x04, 0x52, 0x00, 0xA5, 0xFF, 0x79, 0x02, 0x80, 0xFF,
-        0x41, 0x02, 0x3D, 0x00, 0xCC, 0x02, 0xFD, 0x02, 0x35, 0x00, 0x35, 0x01,
-        0x57, 0xFF, 0xEF, 0xFE, 0x09, 0xFF, 0x83, 0xFB, 0x37, 0x00, 0xA6, 0xF9,
-        0x6F, 0x03, 0xE1, 0xFA, 0xA8, 0xEC, 0x05, 0xE3, 0xA9, 0xDD, 0x94, 0xD3,
-        0x45, 0xE0, 0xE8, 0xD6, 0xEF, 0xE0, 0xDA, 0xD9, 0x48, 0xEB, 0x6D, 0xE7,
-        0x9E, 0xF1, 0x9C, 0xEF, 0x89, 0xF6, 0xB0, 0xF3, 0x83, 0xFA, 0xC9, 0xF4,
-        0x3A, 0xFD, 0x0E, 0xF5, 0xC5, 0xFF, 0x55, 0xF8, 0x72, 0xFF, 0x1C, 0xFC,
-        0x1C, 0x00, 0x7C, 0x01, 0xA4, 0xFD, 0x50, 0x01, 0xC9, 0xFD, 0x49, 0x00,
-        0x4D, 0xFD, 0x4F, 0xFD, 0x21, 0x00, 0x00, 0xFF, 0x47, 0x01, 0x9D, 0x01,
-        0xAC, 0x01, 0x33, 0x05, 0x89, 0x00, 0x36, 0x07, 0x2D, 0xFD, 0xC3, 0x05,
-        0xCE, 0x13, 0x62, 0x1D, 0x93, 0x22, 0x78, 0x2C, 0xB8, 0x1F, 0xEB, 0x28,
-        0xF1, 0x1E, 0xE2, 0x25, 0x20, 0x14, 0xF7, 0x17, 0xCF, 0x0D, 0xCC, 0x0F,
-        0x2B, 0x09, 0x08, 0x0C, 0x28, 0x05, 0x1C, 0x0B, 0x0D, 0x02, 0xB1, 0x0A,
-        0x2C, 0xFF, 0x3C, 0x07, 0x72, 0xFF, 0x88, 0x03, 0x24, 0xFF, 0x6F, 0xFE,
-        0x36, 0x02, 0x3E, 0xFF, 0x10, 0x02, 0x26, 0x00, 0x1A, 0x02, 0xCD, 0x02,
-        0x2E, 0xFF, 0xF2, 0x00, 0x0B, 0xFE, 0x38, 0xFE, 0xCC, 0xFD, 0x89, 0xFA,
-        0x0C, 0xFF, 0x8E, 0xF8, 0xCB, 0x02, 0x50, 0xFA, 0xF8, 0xEB, 0x91, 0xE2,
-        0x01, 0xDD, 0x5E, 0xD3, 0x19, 0xE0, 0x29, 0xD7, 0x46, 0xE1, 0x7B, 0xDA,
-        0x81, 0xEC, 0x91, 0xE8, 0xE1, 0xF2, 0x90, 0xF0, 0xA8, 0xF7, 0x2D, 0xF4,
-        0xCD, 0xFB, 0xF3, 0xF4, 0x4A, 0xFF, 0x87, 0xF5, 0x71, 0x02, 0x21, 0xF9,
-        0xE3, 0x01, 0x7B, 0xFC, 0xAE, 0x01, 0xF5, 0x00, 0x44, 0xFE, 0xEC, 0xFF,
-        0xA3, 0xFE, 0x49, 0xFF, 0xAA, 0xFE, 0xDA, 0xFC, 0x78, 0x01, 0xC1, 0xFE,
-        0x64, 0x02, 0x8E, 0x01, 0x98, 0x02, 0x67, 0x05, 0x74, 0x01, 0xBD, 0x07,
-        0xAD, 0xFD, 0x3D, 0x06, 0x5A, 0x14, 0xFE, 0x1D, 0x61, 0x23, 0x63, 0x2D,
-        0x4E, 0x20, 0xA4, 0x29, 0xC1, 0x1E, 0x1A, 0x26, 0x3B, 0x13, 0xE4, 0x17,
-        0xCA, 0x0C, 0x0E, 0x10, 0xBD, 0x07, 0x5B, 0x0C, 0x81, 0x03, 0x9A, 0x0B,
-        0x65, 0x00, 0x4F, 0x0B, 0x67, 0xFD, 0xC0, 0x07, 0xC0, 0xFD, 0x2E, 0x04,
-        0x06, 0xFE, 0xBE, 0xFF, 0x47, 0x01, 0x99, 0x00, 0xC6, 0x00, 0xFA, 0x00,
-        0x2E, 0x01, 0xB7, 0x03, 0x9B, 0xFE, 0xDF, 0x01, 0xA1, 0xFD, 0xD5, 0xFE,
-        0x4B, 0xFD, 0xC4, 0xFA, 0xB6, 0xFE, 0x8D, 0xF8, 0x95, 0x02, 0xDB, 0xF9,
-        0x1B, 0xEC, 0x10, 0xE2, 0x46, 0xDD, 0xCC, 0xD2, 0x12, 0xE0, 0x3C, 0xD6,
-        0xC4, 0xE1, 0xFA, 0xD9, 0x65, 0xED, 0x49, 0xE8, 0xD7, 0xF3, 0x17, 0xF0,
-        0xB7, 0xF8, 0x87, 0xF3, 0xF0, 0xFC, 0x4C, 0xF4, 0xFA, 0xFF, 0x9B, 0xF4,
-        0xDD, 0x02, 0x1D, 0xF8, 0xFF, 0x02, 0x0D, 0xFC, 0x8C, 0x02, 0x11, 0x00,
-        0x2D, 0xFF, 0xF5, 0xFE, 0x8A, 0xFF, 0x65, 0xFE, 0x1A, 0xFF, 0xAE, 0xFB,
-        0xFB, 0x01, 0xF3, 0xFD, 0xF6, 0x02, 0x27, 0x01, 0x81, 0x03, 0x69, 0x05,
-        0x9C, 0x01, 0x45, 0x07, 0xA9, 0xFD, 0x11, 0x06, 0x34, 0x14, 0x22, 0x1E,
-        0xDE, 0x22, 0x4C, 0x2D, 0x00, 0x20, 0xCA, 0x29, 0xE0, 0x1D, 0xAC, 0x25,
-        0x42, 0x12, 0x69, 0x17, 0x73, 0x0B, 0x6F, 0x0F, 0x83, 0x06, 0x22, 0x0C,
-        0x52, 0x02, 0x7E, 0x0B, 0x40, 0xFF, 0x0C, 0x0B, 0x9A, 0xFC, 0x99, 0x07,
-        0x7F, 0xFC, 0x86, 0x03, 0x88, 0xFD, 0xF1, 0xFF, 0x14, 0x01, 0x0F, 0x01,
-        0x19, 0x01, 0xC5, 0x01, 0x82, 0x01, 0x5D, 0x04, 0x23, 0xFE, 0x9E, 0x01,
-        0x3B, 0xFD, 0xA9, 0xFE, 0x8F, 0xFC, 0xA4, 0xFA, 0x4B, 0xFE, 0x11, 0xF9,
-        0x0D, 0x02, 0x4A, 0xFA, 0x86, 0xEB, 0x55, 0xE2, 0xB2, 0xDC, 0x1D, 0xD3,
-        0x7D, 0xDF, 0x76, 0xD6, 0xC1, 0xE1, 0x8E, 0xDA, 0x2D, 0xED, 0x68, 0xE8,
-        0x2B, 0xF4, 0x54, 0xF0, 0x76, 0xF9, 0xBA, 0xF3, 0xDE, 0xFD, 0x7D, 0xF4,
-        0xD1, 0x00, 0xE8, 0xF4, 0x4D, 0x03, 0x44, 0xF8, 0x40, 0x03, 0x4C, 0xFC,
-        0xFE, 0x01, 0xA3, 0xFF, 0x71, 0xFE, 0x8E, 0xFE, 0x55, 0xFE, 0xCB, 0xFD,
-        0x07, 0xFE, 0x3B, 0xFB, 0x83, 0x01, 0x0E, 0xFE, 0x37, 0x02, 0xCB, 0x00,
-        0xF4, 0x02, 0xD1, 0x04, 0xAC, 0x01, 0xD1, 0x06, 0xF4, 0xFD, 0xC3, 0x05,
-        0x3A, 0x14, 0x9D, 0x1D, 0xEC, 0x22, 0x96, 0x2C, 0x00, 0x20, 0x20, 0x29,
-        0x09, 0x1E, 0x5B, 0x25, 0xE4, 0x12, 0xB7, 0x17, 0xE3, 0x0B, 0xD5, 0x0F,
-        0x7F, 0x06, 0x70, 0x0C, 0x2B, 0x02, 0xD0, 0x0B, 0x7D, 0xFF, 0xBE, 0x0B,
-        0x31, 0xFD, 0xAA, 0x08, 0x3B, 0xFD, 0xC0, 0x04, 0xC9, 0xFD, 0xC4, 0x00,
-        0x0D, 0x01, 0x69, 0x01, 0x3D, 0x01, 0x02, 0x02, 0xB9, 0x01, 0x7B, 0x04,
-        0xBB, 0xFE, 0xE7, 0x01, 0x8C, 0xFE, 0x72, 0xFF, 0xDD, 0xFD, 0x67, 0xFB,
-        0xBC, 0xFE, 0x0B, 0xF9, 0xBE, 0x02, 0x3F, 0xFA, 0x4E, 0xEC, 0x59, 0xE2,
-        0x67, 0xDD, 0x57, 0xD3, 0x96, 0xE0, 0x2A, 0xD7, 0x5E, 0xE2, 0xBC, 0xDA,
-        0x84, 0xED, 0x50, 0xE8, 0xDC, 0xF4, 0x5E, 0xF0, 0x89, 0xFA, 0xD6, 0xF3,
-        0x80, 0xFE, 0x0F, 0xF4, 0x32, 0x01, 0x34, 0xF4, 0xAD, 0x03, 0x90, 0xF7,
-        0x58, 0x03, 0x42, 0xFB, 0xAA, 0x02, 0x45, 0xFF, 0xFD, 0xFE, 0x6E, 0xFE,
-        0x6D, 0xFE, 0xC1, 0xFD, 0x0E, 0xFE, 0x95, 0xFB, 0x78, 0x01, 0xA7, 0xFE,
-        0xDC, 0x01, 0x6C, 0x01, 0x8D, 0x02, 0x59, 0x05, 0x82, 0x01, 0x89, 0x07,
-        0xE5, 0xFC, 0xE5, 0x05, 0x02, 0x13, 0x96, 0x1D, 0xC7, 0x21, 0x73, 0x2C,
-        0x24, 0x1E, 0x30, 0x28, 0x28, 0x1C, 0x6C, 0x24, 0x59, 0x11, 0x25, 0x17,
-        0x3F, 0x0A, 0x5A, 0x0F, 0xE2, 0x04, 0x32, 0x0C, 0x24, 0x01, 0x1C, 0x0C,
-        0x6C, 0xFE, 0xC1, 0x0B, 0x98, 0xFB, 0xEB, 0x07, 0xD5, 0xFB, 0x11, 0x04,
-        0xDA, 0xFC, 0x6C, 0x00, 0xC8, 0x00, 0x64, 0x01, 0x75, 0x01, 0x08, 0x02,
-        0xD7, 0x01, 0x0E, 0x04, 0x8F, 0xFE, 0xE7, 0x00, 0x16, 0xFE, 0xFA, 0xFD,
-        0x5D, 0xFD, 0x04, 0xFA, 0x7A, 0xFE, 0x00, 0xF8, 0x01, 0x03, 0x84, 0xF9,
-        0x1F, 0xED, 0x16, 0xE2, 0x66, 0xDE, 0x70, 0xD3, 0x0A, 0xE2, 0xE5, 0xD7,
-        0xEB, 0xE3, 0xA5, 0xDB, 0x8E, 0xEE, 0xE4, 0xE8, 0x9A, 0xF5, 0x9E, 0xF0,
-        0x14, 0xFB, 0xC4, 0xF3, 0x1B, 0xFF, 0x0A, 0xF4, 0xAD, 0x01, 0x4C, 0xF4,
-        0x1B, 0x04, 0xC9, 0xF7, 0xA1, 0x03, 0x6E, 0xFB, 0x82, 0x02, 0x09, 0xFF,
-        0xC3, 0xFE, 0x48, 0xFE, 0x93, 0xFE, 0x3B, 0xFE, 0x95, 0xFE, 0x90, 0xFC,
-        0x95, 0x01, 0x77, 0xFF, 0xFC, 0x01, 0x3C, 0x02, 0xB5, 0x02, 0xFB, 0x05,
-        0xC8, 0x01, 0xE5, 0x07, 0x6D, 0xFD, 0x6D, 0x06, 0x37, 0x13, 0xA9, 0x1D,
-        0xE0, 0x21, 0x21, 0x2C, 0x63, 0x1E, 0xCE, 0x27, 0xB1, 0x1C, 0x3F, 0x24,
-        0x40, 0x12, 0x2D, 0x17, 0x36, 0x0B, 0x5E, 0x0F, 0x32, 0x05, 0xD6, 0x0B,
-        0xD7, 0x00, 0x44, 0x0B, 0x3D, 0xFE, 0xF8, 0x0A, 0x2A, 0xFC, 0xDC, 0x07,
-        0xF5, 0xFC, 0x8E, 0x04, 0x23, 0xFE, 0x10, 0x01, 0xC4, 0x01, 0xB2, 0x01,
-        0x5E, 0x01, 0x57, 0x01, 0x63, 0x01, 0x1A, 0x03, 0x76, 0xFE, 0x6A, 0x00,
-        0x28, 0xFE, 0xB6, 0xFD, 0x68, 0xFD, 0x17, 0xFA, 0x48, 0xFE, 0x42, 0xF8,
-        0x8A, 0x02, 0xC6, 0xF9, 0xB7, 0xEC, 0xA8, 0xE2, 0x37, 0xDE, 0x91, 0xD4,
-        0x5C, 0xE1, 0xB4, 0xD8, 0x0D, 0xE3, 0x46, 0xDC, 0x44, 0xED, 0x48, 0xE9,
-        0x21, 0xF4, 0x07, 0xF1, 0x5D, 0xFA, 0xA8, 0xF4, 0x87, 0xFE, 0xF6, 0xF4,
-        0x32, 0x01, 0x27, 0xF5, 0x6A, 0x03, 0x34, 0xF8, 0x0A, 0x03, 0xBB, 0xFB,
-        0x20, 0x02, 0x74, 0xFF, 0x6B, 0xFE, 0xB7, 0xFE, 0x00, 0xFF, 0x39, 0xFF,
-        0xE9, 0xFE, 0x57, 0xFD, 0xE1, 0x01, 0x0B, 0x00, 0x2B, 0x02, 0xB6, 0x02,
-        0xBB, 0x02, 0x2E, 0x06, 0x40, 0x01, 0x51, 0x07, 0xDA, 0xFC, 0xA7, 0x05,
-        0x14, 0x13, 0x16, 0x1D, 0xF2, 0x21, 0x52, 0x2B, 0x0D, 0x1F, 0x70, 0x27,
-        0x36, 0x1D, 0xCC, 0x23, 0xB7, 0x12, 0x95, 0x16, 0x87, 0x0B, 0x88, 0x0E,
-        0x29, 0x05, 0xD8, 0x0A, 0x23, 0x01, 0xB4, 0x0A, 0x62, 0xFE, 0x5C, 0x0A,
-        0x06, 0xFC, 0x37, 0x07, 0x50, 0xFC, 0x9D, 0x03, 0x3E, 0xFD, 0xA8, 0xFF,
-        0x72, 0x01, 0xB7, 0x00, 0x89, 0x01, 0x9B, 0x00, 0x74, 0x01, 0x38, 0x02,
-        0x71, 0xFE, 0x82, 0xFF, 0x07, 0xFE, 0xB7, 0xFC, 0x57, 0xFD, 0x42, 0xF9,
-        0xB0, 0xFE, 0x17, 0xF8, 0x21, 0x03, 0xF4, 0xF9, 0xD9, 0xEC, 0x9C, 0xE2,
-        0xC6, 0xDD, 0x93, 0xD4, 0xEF, 0xE0, 0xF2, 0xD8, 0xAD, 0xE2, 0x8E, 0xDC,
-        0x15, 0xED, 0xC6, 0xE9, 0x31, 0xF4, 0xC8, 0xF1, 0xC8, 0xFA, 0xAB, 0xF5,
-        0xC0, 0xFE, 0xD9, 0xF5, 0x51, 0x01, 0x2C, 0xF6, 0xE3, 0x03, 0x8D, 0xF9,
-        0x31, 0x03, 0xC8, 0xFC, 0x6E, 0x02, 0xFD, 0x00, 0xF5, 0xFD, 0xD5, 0xFF,
-        0x7D, 0xFD, 0xC1, 0xFF, 0xA8, 0xFD, 0x52, 0xFE, 0xB2, 0x00, 0x08, 0x01,
-        0x5D, 0x01, 0xEA, 0x03, 0x07, 0x02, 0x1D, 0x07, 0x42, 0x01, 0x8D, 0x08,
-        0xE4, 0xFC, 0x9C, 0x06, 0x20, 0x13, 0xA4, 0x1D, 0x1F, 0x22, 0x3A, 0x2B,
-        0xEA, 0x1E, 0x72, 0x26, 0x7B, 0x1D, 0x01, 0x23, 0x0B, 0x13, 0x9E, 0x15,
-        0x23, 0x0C, 0xE1, 0x0D, 0x2C, 0x05, 0xCD, 0x09, 0x46, 0x01, 0xC7, 0x09,
-        0xE3, 0xFE, 0x8F, 0x09, 0x2B, 0xFC, 0x0E, 0x06, 0x28, 0xFD, 0x18, 0x03,
-        0xD1, 0xFD, 0xBD, 0xFE, 0x85, 0x02, 0xEE, 0xFF, 0x0B, 0x03, 0xE0, 0xFF,
-        0x1B, 0x03, 0x39, 0x01, 0x20, 0x00, 0x6A, 0xFE, 0x4F, 0xFF, 0x58, 0xFB,
-        0x61, 0xFE, 0x1E, 0xF8, 0xB7, 0xFE, 0x81, 0xF6, 0xEF, 0x02, 0x8A, 0xF8,
-        0xB6, 0xEC, 0xAC, 0xE1, 0x28, 0xDE, 0xD4, 0xD4, 0x52, 0xE1, 0xC8, 0xD9,
-        0x5C, 0xE2, 0xF0, 0xDC, 0xB9, 0xEC, 0x63, 0xEA, 0xA8, 0xF3, 0x0E, 0xF2,
-        0xA5, 0xFA, 0xE2, 0xF5, 0x8B, 0xFE, 0xC2, 0xF5, 0x19, 0x01, 0x32, 0xF6,
-        0xB6, 0x03, 0xC1, 0xF9, 0xA0, 0x02, 0xC0, 0xFC, 0xFF, 0x01, 0x53, 0x01,
-        0x7C, 0xFD, 0x5C, 0x00, 0xDB, 0xFC, 0x5A, 0x00, 0xD3, 0xFC, 0x11, 0xFF,
-        0xF1, 0xFF, 0x17, 0x02, 0xAA, 0x00, 0xF0, 0x04, 0xFF, 0x01, 0x61, 0x08,
-        0xEC, 0x01, 0xED, 0x09, 0xB1, 0xFD, 0xBF, 0x07, 0xBC, 0x13, 0x78, 0x1E,
-        0x35, 0x22, 0x54, 0x2B, 0x06, 0x1F, 0x89, 0x26, 0xC5, 0x1D, 0x3B, 0x23,
-        0x5A, 0x13, 0xBA, 0x15, 0x45, 0x0C, 0xE5, 0x0D, 0x74, 0x05, 0x64, 0x0A,
-        0x52, 0x01, 0x7B, 0x0A, 0x91, 0xFE, 0xD3, 0x09, 0xDD, 0xFB, 0x30, 0x06,
-        0x05, 0xFD, 0x40, 0x03, 0x01, 0xFE, 0x10, 0xFF, 0x56, 0x02, 0x13, 0x00,
-        0x27, 0x03, 0xA8, 0x00, 0xF5, 0x02, 0xE6, 0x01, 0x9C, 0xFF, 0xAD, 0xFE,
-        0xFC, 0xFE, 0xCC, 0xFB, 0x8E, 0xFD, 0x1D, 0xF8, 0x96, 0xFD, 0x6B, 0xF6,
-        0xB3, 0x01, 0x51, 0xF8, 0x1B, 0xEC, 0xC4, 0xE1, 0x90, 0xDD, 0x76, 0xD4,
-        0x13, 0xE1, 0x43, 0xD9, 0xE1, 0xE2, 0xD4, 0xDC, 0x74, 0xED, 0x7F, 0xEA,
-        0x57, 0xF4, 0x38, 0xF2, 0xE5, 0xFA, 0x55, 0xF5, 0x7D, 0xFF, 0x83, 0xF5,
-        0x12, 0x02, 0xD4, 0xF5, 0xC3, 0x04, 0x56, 0xF9, 0x8B, 0x03, 0x2D, 0xFC,
-        0x5A, 0x02, 0x50, 0x00, 0x38, 0xFE, 0x7D, 0xFF, 0xA2, 0xFD, 0x13, 0xFF,
-        0xE3, 0xFD, 0xE4, 0xFD, 0xD3, 0x00, 0xED, 0x00, 0x59, 0x01, 0x0A, 0x04,
-        0x65, 0x02, 0xBC, 0x07, 0x2A, 0x02, 0x7B, 0x09, 0x2C, 0xFE, 0xCA, 0x07,
-        0xEE, 0x13, 0x91, 0x1E, 0x9B, 0x22, 0x14, 0x2C, 0xF7, 0x1E, 0x39, 0x27,
-        0x1B, 0x1D, 0xC8, 0x23, 0x3A, 0x12, 0xAB, 0x15, 0x63, 0x0B, 0xC5, 0x0D,
-        0xE4, 0x04, 0x9F, 0x0A, 0x69, 0x00, 0x8F, 0x0A, 0x14, 0xFE, 0x8C, 0x0A,
-        0x8C, 0xFB, 0x4F, 0x07, 0xB0, 0xFC, 0x66, 0x04, 0xAA, 0xFD, 0xD0, 0xFF,
-        0xB6, 0x01, 0x62, 0x00, 0x20, 0x02, 0x9D, 0x00, 0x1D, 0x02, 0x06, 0x02,
-        0x29, 0xFF, 0xE4, 0xFE, 0x74, 0xFE, 0x79, 0xFB, 0x98, 0xFD, 0xAD, 0xF7,
-        0x1F, 0xFE, 0x17, 0xF6, 0x58, 0x02, 0x08, 0xF8, 0x79, 0xEC, 0x3C, 0xE1,
-        0xEB, 0xDD, 0x0C, 0xD4, 0x3B, 0xE1, 0xA4, 0xD8, 0xCB, 0xE2, 0xBE, 0xDB,
-        0x86, 0xED, 0xC9, 0xE9, 0x71, 0xF4, 0xF5, 0xF1, 0x2A, 0xFB, 0x74, 0xF5,
-        0x84, 0xFF, 0x7E, 0xF5, 0xE1, 0x01, 0xA6, 0xF5, 0x4E, 0x04, 0xB6, 0xF8,
-        0x47, 0x03, 0xCF, 0xFB, 0x62, 0x02, 0xB8, 0x00, 0x62, 0xFE, 0x7A, 0x00,
-        0xEF, 0xFD, 0x50, 0x00, 0x9F, 0xFD, 0xB6, 0xFE, 0xCF, 0x00, 0xF7, 0x01,
-        0x55, 0x01, 0x2B, 0x05, 0xF9, 0x01, 0xB3, 0x08, 0x44, 0x01, 0x15, 0x0A,
-        0x30, 0xFD, 0x2A, 0x08, 0x23, 0x13, 0xCF, 0x1E, 0x98, 0x21, 0xA4, 0x2B,
-        0xB9, 0x1E, 0x4B, 0x27, 0xF5, 0x1C, 0xED, 0x23, 0x34, 0x12, 0xDD, 0x15,
-        0x67, 0x0B, 0xBC, 0x0D, 0xBC, 0x04, 0x41, 0x0A, 0x87, 0x00, 0x4A, 0x0A,
-        0x26, 0xFE, 0xF7, 0x09, 0xDE, 0xFB, 0x1F, 0x07, 0x9B, 0xFC, 0xCE, 0x03,
-        0xC2, 0xFD, 0x22, 0xFF, 0x02, 0x02, 0xA3, 0xFF, 0x6E, 0x02, 0xD1, 0xFF,
-        0x6D, 0x02, 0x22, 0x01, 0xDE, 0xFE, 0xA0, 0xFD, 0x73, 0xFE, 0xB9, 0xFA,
-        0xC2, 0xFD, 0x35, 0xF7, 0xCA, 0xFE, 0x1E, 0xF6, 0xB7, 0x02, 0xD4, 0xF7,
-        0xB6, 0xEC, 0x06, 0xE1, 0x4C, 0xDE, 0x39, 0xD4, 0x10, 0xE1, 0x85, 0xD8,
-        0x30, 0xE3, 0x37, 0xDC, 0x05, 0xEE, 0x52, 0xEA, 0xDA, 0xF4, 0x7B, 0xF2,
-        0x60, 0xFB, 0xBB, 0xF5, 0xC0, 0xFF, 0xF5, 0xF5, 0x31, 0x02, 0x77, 0xF6,
-        0x69, 0x04, 0x59, 0xF9, 0x8B, 0x03, 0x7D, 0xFC, 0xE4, 0x01, 0xB1, 0x00,
-        0x69, 0xFD, 0xE6, 0xFF, 0xE2, 0xFC, 0x98, 0xFF, 0x52, 0xFD, 0xBB, 0xFE,
-        0xB5, 0x00, 0x1F, 0x02, 0x43, 0x01, 0x0A, 0x05, 0x62, 0x02, 0xF1, 0x08,
-        0x51, 0x01, 0xED, 0x09, 0x7E, 0xFD, 0x64, 0x08, 0x7F, 0x13, 0x42, 0x1F,
-        0xB0, 0x21, 0xFC, 0x2B, 0x8F, 0x1E, 0x55, 0x27, 0x7B, 0x1C, 0xB4, 0x23,
-        0xB1, 0x11, 0xB9, 0x15, 0xC9, 0x0A, 0x94, 0x0D, 0x42, 0x04, 0x91, 0x0A,
-        0xC1, 0xFF, 0x65, 0x0A, 0x5C, 0xFD, 0xEB, 0x09, 0x1B, 0xFB, 0xF9, 0x06,
-        0x6C, 0xFC, 0x39, 0x04, 0x42, 0xFE, 0x25, 0x00, 0xCC, 0x02, 0xEA, 0x00,
-        0x68, 0x03, 0x54, 0x01, 0x16, 0x03, 0x0C, 0x02, 0xF3, 0xFF, 0xA5, 0xFE,
-        0x19, 0xFF, 0x42, 0xFB, 0xE2, 0xFD, 0x1E, 0xF7, 0x3F, 0xFF, 0x54, 0xF6,
-        0x38, 0x03, 0x01, 0xF8, 0x32, 0xED, 0xEF, 0xE0, 0xFB, 0xDE, 0x0F, 0xD4,
-        0x0B, 0xE2, 0x92, 0xD8, 0xC4, 0xE3, 0xE7, 0xDB, 0xC3, 0xEE, 0x36, 0xEA,
-        0xCD, 0xF5, 0x9E, 0xF2, 0x6F, 0xFC, 0xC2, 0xF5, 0xFA, 0x00, 0xF4, 0xF5,
-        0x1D, 0x03, 0x4F, 0xF6, 0x1C, 0x05, 0x2F, 0xF9, 0x6E, 0x03, 0xC0, 0xFB,
-        0xA8, 0x01, 0x26, 0x00, 0x1E, 0xFD, 0x5D, 0xFF, 0x60, 0xFC, 0xCA, 0xFE,
-        0x9F, 0xFC, 0xFE, 0xFD, 0xB3, 0xFF, 0x7E, 0x01, 0xAE, 0x00, 0x1B, 0x05,
-        0xC4, 0x01, 0x33, 0x09, 0x40, 0x00, 0xED, 0x09, 0x5A, 0xFC, 0x3D, 0x08,
-        0xA8, 0x12, 0x9B, 0x1F, 0xE2, 0x20, 0x98, 0x2C, 0xE9, 0x1D, 0x23, 0x28,
-        0x3C, 0x1C, 0xBE, 0x24, 0x30, 0x11, 0x1E, 0x16, 0x80, 0x0A, 0xC0, 0x0D,
-        0x09, 0x04, 0x8C, 0x0A, 0x9C, 0xFF, 0x66, 0x0A, 0x70, 0xFD, 0xFB, 0x09,
-        0x6A, 0xFB, 0x08, 0x07, 0xE5, 0xFC, 0x4F, 0x04, 0x84, 0xFE, 0xB7, 0xFF,
-        0x3E, 0x03, 0xC8, 0x00, 0xDB, 0x03, 0x7A, 0x01, 0x74, 0x03, 0x2A, 0x02,
-        0x20, 0x00, 0x50, 0xFE, 0x5D, 0xFF, 0xD3, 0xFA, 0xD2, 0xFE, 0xEF, 0xF6,
-        0x7C, 0x00, 0x33, 0xF6, 0x4F, 0x04, 0xCC, 0xF7, 0xAA, 0xED, 0x31, 0xE0,
-        0x49, 0xDF, 0x1A, 0xD3, 0x06, 0xE2, 0x85, 0xD7, 0xB2, 0xE3, 0x24, 0xDB,
-        0x88, 0xEE, 0xD1, 0xE9, 0xE9, 0xF4, 0x3F, 0xF2, 0x8C, 0xFB, 0xDA, 0xF5,
-        0xEF, 0xFF, 0xFD, 0xF5, 0x2E, 0x02, 0x77, 0xF6, 0x88, 0x04, 0x8F, 0xF9,
-        0x38, 0x03, 0x60, 0xFC, 0x4D, 0x01, 0xAB, 0x00, 0x67, 0xFC, 0x6B, 0xFF,
-        0x01, 0xFC, 0xCC, 0xFE, 0x79, 0xFC, 0x17, 0xFE, 0xF2, 0xFF, 0xF8, 0x01,
-        0x83, 0x00, 0x2D, 0x05, 0xE1, 0x00, 0xCD, 0x08, 0x79, 0xFF, 0xCD, 0x09,
-        0x17, 0xFC, 0x50, 0x08, 0xAE, 0x12, 0xA3, 0x1F, 0xC3, 0x20, 0x2C, 0x2C,
-        0xFC, 0x1D, 0x92, 0x27, 0x66, 0x1C, 0xF2, 0x23, 0xE2, 0x11, 0x9C, 0x15,
-        0xA8, 0x0B, 0x46, 0x0D, 0xD7, 0x04, 0x68, 0x09, 0x9C, 0x00, 0x66, 0x09,
-        0x65, 0xFE, 0xF2, 0x08, 0xF6, 0xFB, 0xDA, 0x05, 0x44, 0xFD, 0x28, 0x03,
-        0x46, 0xFF, 0xFF, 0xFE, 0xE7, 0x03, 0x12, 0x00, 0xD2, 0x03, 0x72, 0x00,
-        0x34, 0x03, 0x39, 0x01, 0x96, 0xFF, 0x7D, 0xFD, 0x30, 0xFF, 0xBC, 0xFA,
-        0xED, 0xFE, 0x47, 0xF7, 0x3E, 0x00, 0x0F, 0xF6, 0x9A, 0x03, 0x66, 0xF7,
-        0x54, 0xED, 0x4D, 0xE0, 0x94, 0xDF, 0xE4, 0xD3, 0x51, 0xE2, 0x6E, 0xD8,
-        0x1D, 0xE4, 0x2A, 0xDC, 0xBA, 0xEE, 0x81, 0xEA, 0x12, 0xF5, 0x03, 0xF3,
-        0x9E, 0xFB, 0xD5, 0xF6, 0x5C, 0xFF, 0x8F, 0xF6, 0x40, 0x01, 0xE9, 0xF6,
-        0x8B, 0x03, 0xE5, 0xF9, 0x5F, 0x02, 0x99, 0xFC, 0xA3, 0x00, 0xE9, 0x00,
-        0x6D, 0xFC, 0x18, 0x00, 0x75, 0xFC, 0x8E, 0xFF, 0x36, 0xFD, 0xD5, 0xFE,
-        0x07, 0x01, 0xB9, 0x02, 0x5E, 0x01, 0x53, 0x05, 0x9B, 0x01, 0xED, 0x08,
-        0x0A, 0x00, 0x36, 0x0A, 0x4E, 0xFC, 0xC0, 0x08, 0x14, 0x12, 0x8D, 0x1F,
-        0xFA, 0x1F, 0x33, 0x2C, 0x5A, 0x1D, 0xA9, 0x27, 0x60, 0x1B, 0x92, 0x23,
-        0xE5, 0x10, 0x4F, 0x15, 0xCA, 0x0A, 0xEC, 0x0C, 0xA6, 0x04, 0x48, 0x09,
-        0xDF, 0x00, 0x50, 0x09, 0xE3, 0xFE, 0xB3, 0x08, 0x6B, 0xFC, 0x79, 0x05,
-        0x75, 0xFD, 0xC2, 0x02, 0x24, 0xFF, 0x8A, 0xFE, 0x37, 0x03, 0x46, 0xFF,
-        0x65, 0x03, 0x10, 0x00, 0x6E, 0x02, 0x80, 0x00, 0x6B, 0xFE, 0x65, 0xFC,
-        0x1C, 0xFE, 0xE9, 0xF9, 0x0B, 0xFE, 0x76, 0xF6, 0xF9, 0xFF, 0x68, 0xF5,
-        0xCE, 0x03, 0xEE, 0xF6, 0xEE, 0xED, 0xFD, 0xDF, 0x9D, 0xDF, 0xEF, 0xD2,
-        0x57, 0xE2, 0xBE, 0xD7, 0x77, 0xE4, 0x29, 0xDC, 0xD6, 0xEE, 0x51, 0xEA,
-        0xAB, 0xF4, 0x6C, 0xF2, 0x81, 0xFA, 0xDC, 0xF5, 0x83, 0xFE, 0x22, 0xF6,
-        0x9A, 0x00, 0xEC, 0xF6, 0x28, 0x03, 0x4B, 0xFA, 0x34, 0x02, 0xF2, 0xFC,
-        0x8B, 0x00, 0x09, 0x01, 0xAE, 0xFC, 0x64, 0x00, 0x90, 0xFC, 0x97, 0xFF,
-        0xB7, 0xFD, 0x51, 0xFF, 0xC9, 0x01, 0x89, 0x03, 0x33, 0x02, 0xFD, 0x05,
-        0x0E, 0x02, 0x35, 0x09, 0xF6, 0xFF, 0x3A, 0x0A, 0xF8, 0xFB, 0x98, 0x08,
-        0xF5, 0x11, 0xA9, 0x1F, 0x39, 0x20, 0xCC, 0x2C, 0x4B, 0x1D, 0xC6, 0x27,
-        0x6B, 0x1B, 0x90, 0x23, 0x28, 0x11, 0xAE, 0x15, 0x60, 0x0B, 0xA3, 0x0D,
-        0x90, 0x05, 0x3F, 0x0A, 0x68, 0x01, 0xC7, 0x09, 0x6A, 0xFF, 0x18, 0x09,
-        0xD3, 0xFC, 0xC3, 0x05, 0x85, 0xFD, 0x10, 0x03, 0xD7, 0xFE, 0xC6, 0xFE,
-        0x76, 0x02, 0x38, 0xFF, 0x91, 0x02, 0x25, 0x00, 0xC2, 0x01, 0xA1, 0x00,
-        0xD7, 0xFD, 0x75, 0xFC, 0x7E, 0xFD, 0x02, 0xFA, 0x8F, 0xFD, 0x96, 0xF6,
-        0x96, 0xFF, 0x49, 0xF5, 0xB9, 0x03, 0x2C, 0xF7, 0xCF, 0xED, 0x5F, 0xE0,
-        0x74, 0xDF, 0x4F, 0xD3, 0x5A, 0xE2, 0x89, 0xD8, 0xD6, 0xE3, 0x7B, 0xDC,
-        0x14, 0xEE, 0x5E, 0xEA, 0x1F, 0xF4, 0xB0, 0xF2, 0xC8, 0xF9, 0xFC, 0xF5,
-        0xC2, 0xFD, 0x2C, 0xF6, 0x93, 0xFF, 0x92, 0xF6, 0x77, 0x02, 0xE2, 0xF9,
-        0x7E, 0x02, 0xF7, 0xFC, 0x86, 0x01, 0x7D, 0x01, 0xC4, 0xFD, 0xDB, 0x00,
-        0x3F, 0xFD, 0x66, 0xFF, 0x91, 0xFD, 0x8E, 0xFE, 0x65, 0x01, 0xC4, 0x02,
-        0x13, 0x02, 0x8B, 0x05, 0x5C, 0x02, 0x77, 0x09, 0x6C, 0x00, 0xF2, 0x0A,
-        0xEF, 0xFB, 0x71, 0x08, 0xBB, 0x11, 0xCD, 0x1E, 0x99, 0x20, 0x24, 0x2C,
-        0xDB, 0x1D, 0xE8, 0x26, 0xD9, 0x1C, 0x75, 0x23, 0x9E, 0x12, 0xC5, 0x15,
-        0x11, 0x0C, 0x05, 0x0D, 0x7C, 0x06, 0xE6, 0x09, 0x6D, 0x02, 0xC0, 0x09,
-        0x9A, 0x00, 0x70, 0x09, 0x74, 0xFD, 0x1E, 0x06, 0x2A, 0xFD, 0x0F, 0x03,
-        0x43, 0xFE, 0xB9, 0xFE, 0x1B, 0x02, 0x9E, 0xFF, 0xAE, 0x02, 0x5B, 0x01,
-        0x5A, 0x02, 0x3C, 0x02, 0x9D, 0xFE, 0x1D, 0xFE, 0xB9, 0xFD, 0x2B, 0xFB,
-        0x89, 0xFD, 0x26, 0xF7, 0xAA, 0xFF, 0xA7, 0xF5, 0x58, 0x04, 0x58, 0xF8,
-        0x8F, 0xEE, 0xF9, 0xE1, 0x7B, 0xDF, 0x47, 0xD4, 0x8F, 0xE2, 0xC4, 0xD9,
-        0x6F, 0xE3, 0xDF, 0xDC, 0xAA, 0xED, 0x58, 0xEA, 0x65, 0xF4, 0x34, 0xF3,
-        0xD0, 0xF9, 0x10, 0xF6, 0x11, 0xFE, 0x56, 0xF6, 0x13, 0x00, 0xCE, 0xF6,
-        0x32, 0x03, 0xDB, 0xF9, 0x3F, 0x03, 0x66, 0xFC, 0x10, 0x02, 0x79, 0x00,
-        0x85, 0xFE, 0x90, 0xFF, 0x88, 0xFE, 0x2F, 0xFE, 0x0E, 0xFF, 0x92, 0xFD,
-        0x9D, 0x02, 0xB9, 0x01, 0x59, 0x03, 0xCA, 0x04, 0xE3, 0x02, 0xA2, 0x08,
-        0x6B, 0x00, 0x34, 0x0A, 0xA4, 0xFB, 0x98, 0x07, 0x61, 0x11, 0x16, 0x1E,
-        0x70, 0x20, 0xC8, 0x2B, 0x40, 0x1D, 0x30, 0x26, 0x8E, 0x1C, 0x40, 0x23,
-        0x77, 0x12, 0xF0, 0x15, 0xD6, 0x0B, 0x35, 0x0D, 0x91, 0x06, 0x9B, 0x0A,
-        0x4D, 0x02, 0x79, 0x0A, 0x43, 0x00, 0x22, 0x0A, 0x5E, 0xFD, 0x93, 0x07,
-        0x23, 0xFD, 0x1E, 0x05, 0xEE, 0xFD, 0xC7, 0x00, 0x0D, 0x01, 0x6E, 0x01,
-        0xB4, 0x00, 0x87, 0x02, 0x90, 0x00, 0x4C, 0x03, 0x83, 0xFD, 0x4D, 0xFF,
-        0x15, 0xFD, 0x38, 0xFC, 0xC2, 0xFD, 0x38, 0xF8, 0x01, 0x00, 0x4C, 0xF6,
-        0x5F, 0x04, 0x8D, 0xF8, 0x90, 0xEE, 0x35, 0xE2, 0x90, 0xDF, 0xBC, 0xD4,
-        0xAE, 0xE2, 0x6A, 0xDA, 0x96, 0xE3, 0x95, 0xDD, 0xA2, 0xED, 0xDD, 0xEA,
-        0x3A, 0xF4, 0x77, 0xF3, 0x54, 0xF9, 0xC4, 0xF5, 0x40, 0xFD, 0x7D, 0xF5,
-        0x0F, 0xFF, 0x85, 0xF5, 0xE1, 0x01, 0xFE, 0xF7, 0x8B, 0x02, 0xE9, 0xFA,
-        0xE3, 0x01, 0x7C, 0xFF, 0xBA, 0xFE, 0xC4, 0xFE, 0x2A, 0xFF, 0xAB, 0xFD,
-        0x3B, 0xFF, 0xC1, 0xFC, 0x3F, 0x02, 0xB9, 0x00, 0xD2, 0x02, 0xE4, 0x03,
-        0x39, 0x02, 0xE7, 0x07, 0x08, 0x00, 0xBD, 0x09, 0x06, 0xFC, 0x80, 0x07,
-        0xFB, 0x11, 0xB8, 0x1D, 0x30, 0x21, 0x41, 0x2B, 0x57, 0x1E, 0xF2, 0x25,
-        0x3F, 0x1D, 0xB4, 0x22, 0xE7, 0x12, 0x55, 0x15, 0xFA, 0x0B, 0x81, 0x0C,
-        0xA3, 0x06, 0x0B, 0x0A, 0xC5, 0x02, 0x5D, 0x0A, 0x00, 0x01, 0x59, 0x0A,
-        0x0E, 0xFE, 0xA8, 0x07, 0x5C, 0xFD, 0x92, 0x04, 0x5D, 0xFE, 0x49, 0x00,
-        0xC6, 0x01, 0x53, 0x01, 0x28, 0x01, 0x83, 0x02, 0xCF, 0x00, 0x6E, 0x03,
-        0x7E, 0xFD, 0x5D, 0xFF, 0x83, 0xFC, 0xE4, 0xFB, 0x0A, 0xFD, 0xDB, 0xF7,
-        0x41, 0xFF, 0x06, 0xF6, 0x3C, 0x03, 0x48, 0xF8, 0x78, 0xED, 0x5A, 0xE2,
-        0xAA, 0xDE, 0x01, 0xD5, 0x93, 0xE1, 0x14, 0xDA, 0xC5, 0xE2, 0x18, 0xDD,
-        0x3F, 0xED, 0x47, 0xEA, 0xFB, 0xF3, 0xCF, 0xF2, 0x5E, 0xF9, 0x55, 0xF5,
-        0x32, 0xFD, 0x12, 0xF5, 0x1D, 0xFF, 0x46, 0xF5, 0x1C, 0x02, 0x18, 0xF8,
-        0x8A, 0x02, 0xF2, 0xFA, 0x84, 0x01, 0x32, 0xFF, 0x08, 0xFE, 0x07, 0xFE,
-        0xF4, 0xFE, 0xE9, 0xFC, 0x45, 0xFF, 0xCD, 0xFB, 0x90, 0x02, 0xD1, 0xFF,
-        0x71, 0x03, 0x59, 0x03, 0xD6, 0x02, 0x93, 0x07, 0xBF, 0x00, 0xE6, 0x09,
-        0xCB, 0xFC, 0xD1, 0x07, 0xA1, 0x12, 0xDF, 0x1D, 0x37, 0x21, 0x1B, 0x2B,
-        0x76, 0x1E, 0x56, 0x26, 0x19, 0x1D, 0x4F, 0x23, 0x5C, 0x12, 0x01, 0x16,
-        0xC9, 0x0B, 0xA7, 0x0D, 0x45, 0x06, 0xC4, 0x0A, 0x99, 0x02, 0x12, 0x0B,
-        0xBA, 0x00, 0xC1, 0x0A, 0x0F, 0xFE, 0x38, 0x08, 0x88, 0xFD, 0x46, 0x05,
-        0x3F, 0xFE, 0xB2, 0x00, 0xAD, 0x01, 0xC5, 0x01, 0xAD, 0x00, 0xDB, 0x02,
-        0xB1, 0x00, 0x57, 0x04, 0x8B, 0xFD, 0x5F, 0x00, 0xD4, 0xFC, 0xE5, 0xFC,
-        0x48, 0xFD, 0x4F, 0xF8, 0x52, 0xFF, 0xC4, 0xF5, 0x6B, 0x03, 0x17, 0xF8,
-        0x4C, 0xED, 0x15, 0xE2, 0x7B, 0xDE, 0xE4, 0xD4, 0xAE, 0xE0, 0x64, 0xD9,
-        0x22, 0xE2, 0x97, 0xDC, 0xF5, 0xEC, 0xE5, 0xE9, 0xAA, 0xF3, 0x54, 0xF2,
-        0x87, 0xF9, 0x98, 0xF5, 0x16, 0xFD, 0x2D, 0xF5, 0xEA, 0xFE, 0x7A, 0xF5,
-        0x5F, 0x01, 0xD3, 0xF7, 0x05, 0x02, 0xD0, 0xFA, 0x29, 0x01, 0x5B, 0xFF,
-        0x64, 0xFD, 0x05, 0xFE, 0x46, 0xFE, 0xD9, 0xFC, 0x31, 0xFE, 0x4D, 0xFB,
-        0x8D, 0x01, 0x72, 0xFF, 0x76, 0x02, 0xF1, 0x02, 0x4C, 0x02, 0xBB, 0x07,
-        0x31, 0x00, 0x0D, 0x0A, 0x39, 0xFC, 0x92, 0x07, 0xE7, 0x12, 0xB0, 0x1D,
-        0x42, 0x22, 0x03, 0x2B, 0x6D, 0x20, 0x76, 0x26, 0xF8, 0x1E, 0x0B, 0x23,
-        0x29, 0x14, 0xBC, 0x15, 0x5D, 0x0D, 0x1D, 0x0D, 0x7D, 0x07, 0xC9, 0x09,
-        0x30, 0x04, 0x5A, 0x0A, 0x47, 0x02, 0xE2, 0x09, 0x97, 0xFF, 0x67, 0x07,
-        0xE3, 0xFE, 0x87, 0x04, 0xB7, 0xFF, 0x3E, 0x00, 0x74, 0x03, 0xB0, 0x01,
-        0x42, 0x02, 0xC1, 0x02, 0x0B, 0x02, 0x10, 0x04, 0x54, 0xFE, 0xAD, 0xFF,
-        0x47, 0xFD, 0x2F, 0xFC, 0x80, 0xFD, 0x96, 0xF7, 0x9D, 0xFF, 0x6D, 0xF5,
-        0x7C, 0x03, 0x2D, 0xF8, 0x7E, 0xEC, 0x10, 0xE2, 0x12, 0xDD, 0x1B, 0xD5,
-        0xA3, 0xDE, 0xC1, 0xD9, 0x03, 0xE0, 0x2F, 0xDD, 0xC4, 0xEA, 0x5D, 0xEA,
-        0xAE, 0xF1, 0xE7, 0xF2, 0xFB, 0xF7, 0x7E, 0xF6, 0x61, 0xFB, 0xEA, 0xF5,
-        0xB3, 0xFD, 0xDF, 0xF6, 0x3A, 0x00, 0x36, 0xF9, 0x82, 0x00, 0x9F, 0xFB,
-        0xA1, 0xFF, 0xE0, 0xFF, 0x26, 0xFC, 0x8A, 0xFE, 0xAB, 0xFD, 0xD7, 0xFD,
-        0xD8, 0xFD, 0x83, 0xFC, 0x8B, 0x01, 0xE8, 0x00, 0x31, 0x02, 0xF6, 0x03,
-        0xF6, 0x01, 0x8A, 0x08, 0x33, 0x00, 0xE1, 0x0A, 0x7A, 0xFC, 0x28, 0x08,
-        0x9F, 0x13, 0x40, 0x1E, 0xF0, 0x22, 0xDA, 0x2A, 0xAB, 0x21, 0x47, 0x26,
-        0x40, 0x20, 0xB7, 0x22, 0xA8, 0x15, 0xB8, 0x15, 0xAD, 0x0E, 0x3C, 0x0D,
-        0x08, 0x08, 0x7F, 0x09, 0xAE, 0x04, 0x2A, 0x0A, 0x18, 0x02, 0xE3, 0x08,
-        0xCF, 0xFF, 0xB4, 0x06, 0x95, 0xFF, 0x43, 0x04, 0x4A, 0x00, 0xD9, 0xFF,
-        0x9A, 0x03, 0x15, 0x01, 0x2D, 0x02, 0xF4, 0x01, 0x57, 0x02, 0x9F, 0x03,
-        0xAE, 0xFE, 0x5A, 0xFF, 0x3E, 0xFE, 0x8B, 0xFC, 0x0B, 0xFE, 0xA2, 0xF7,
-        0x95, 0xFF, 0x36, 0xF5, 0x35, 0x03, 0xE7, 0xF7, 0x37, 0xEC, 0xD5, 0xE1,
-        0x09, 0xDD, 0x4E, 0xD5, 0x7A, 0xDE, 0xD6, 0xD9, 0x65, 0xE0, 0xA5, 0xDD,
-        0x11, 0xEB, 0x93, 0xEA, 0x63, 0xF2, 0x2E, 0xF3, 0xE7, 0xF8, 0xAF, 0xF6,
-        0xF3, 0xFB, 0xB5, 0xF5, 0x40, 0xFE, 0xDF, 0xF6, 0xA3, 0x00, 0x4A, 0xF9,
-        0xF7, 0x00, 0x09, 0xFC, 0x3C, 0x00, 0x65, 0x00, 0xFB, 0xFC, 0x19, 0xFF,
-        0xF9, 0xFD, 0xB9, 0xFD, 0xE3, 0xFD, 0x20, 0xFC, 0x94, 0x01, 0x7E, 0x00,
-        0xFC, 0x01, 0x84, 0x03, 0x10, 0x02, 0x78, 0x08, 0x4E, 0x00, 0xB1, 0x0A,
-        0xE4, 0xFC, 0x41, 0x08, 0x01, 0x14, 0x76, 0x1E, 0x5A, 0x23, 0x1A, 0x2B,
-        0x8D, 0x21, 0x49, 0x26, 0x8A, 0x1F, 0x74, 0x22, 0xAD, 0x14, 0x63, 0x15,
-        0x5E, 0x0D, 0xE8, 0x0C, 0x32, 0x07, 0xDF, 0x09, 0x2B, 0x04, 0xDB, 0x0A,
-        0xC3, 0x01, 0x92, 0x09, 0xD0, 0xFE, 0x5A, 0x06, 0xBA, 0xFE, 0x96, 0x03,
-        0xD6, 0xFF, 0x63, 0xFF, 0x6F, 0x03, 0x05, 0x01, 0xBE, 0x02, 0xA2, 0x02,
-        0x3B, 0x02, 0xCC, 0x03, 0x41, 0xFE, 0x36, 0xFF, 0x97, 0xFD, 0xF2, 0xFB,
-        0x07, 0xFE, 0x95, 0xF7, 0xAC, 0xFF, 0x6B, 0xF5, 0xDA, 0x02, 0xAA, 0xF7,
-        0x9B, 0xEB, 0x60, 0xE1, 0x4B, 0xDC, 0xA2, 0xD4, 0x81, 0xDE, 0xA1, 0xD9,
-        0x54, 0xE0, 0xF1, 0xDC, 0xAA, 0xEB, 0x3E, 0xEA, 0xBF, 0xF2, 0x55, 0xF2,
-        0xFB, 0xF8, 0x56, 0xF5, 0x55, 0xFC, 0xBA, 0xF4, 0xD4, 0xFE, 0x34, 0xF6,
-        0xEE, 0x01, 0xC3, 0xF9, 0x77, 0x01, 0x44, 0xFC, 0x6A, 0x00, 0x92, 0x00,
-        0x90, 0xFC, 0xCC, 0xFE, 0x95, 0xFD, 0x6F, 0xFD, 0x37, 0xFE, 0x50, 0xFC,
-        0x1D, 0x02, 0xB6, 0x00, 0xA3, 0x02, 0x00, 0x04, 0xF3, 0x01, 0x35, 0x08,
-        0xE8, 0x00, 0x0F, 0x0B, 0xDB, 0xFD, 0x0B, 0x09, 0x28, 0x15, 0x76, 0x1F,
-        0x50, 0x24, 0x11, 0x2C, 0xED, 0x21, 0x18, 0x27, 0x17, 0x20, 0x06, 0x24,
-        0x40, 0x14, 0x5D, 0x16, 0x15, 0x0D, 0x67, 0x0E, 0x8B, 0x06, 0x0E, 0x0B,
-        0xFF, 0x02, 0x7E, 0x0B, 0xC0, 0x00, 0x34, 0x0A, 0x22, 0xFE, 0x03, 0x07,
-        0xAD, 0xFE, 0x7A, 0x04, 0x90, 0xFF, 0xF1, 0xFF, 0x40, 0x03, 0x81, 0x01,
-        0xBF, 0x01, 0x64, 0x02, 0x57, 0x01, 0xDD, 0x03, 0xA4, 0xFD, 0xBA, 0xFF,
-        0x59, 0xFD, 0x89, 0xFC, 0x0C, 0xFE, 0x36, 0xF8, 0x2C, 0xFF, 0x34, 0xF5,
-        0x92, 0x02, 0x52, 0xF7, 0x53, 0xEB, 0xCA, 0xE0, 0x23, 0xDC, 0x02, 0xD4,
-        0x3C, 0xDE, 0x9C, 0xD8, 0x33, 0xE0, 0xA7, 0xDB, 0x44, 0xEC, 0x65, 0xE9,
-        0xBF, 0xF3, 0xB9, 0xF1, 0x44, 0xFA, 0xFB, 0xF4, 0xA1, 0xFD, 0x7D, 0xF4,
-        0x74, 0xFF, 0x56, 0xF5, 0xCA, 0x01, 0x4B, 0xF8, 0xC1, 0x01, 0x41, 0xFB,
-        0xC0, 0x00, 0xB1, 0xFF, 0x57, 0xFD, 0x75, 0xFE, 0xC2, 0xFE, 0xA8, 0xFD,
-        0x01, 0xFF, 0x28, 0xFC, 0x9F, 0x02, 0x60, 0x00, 0x25, 0x03, 0xF5, 0x03,
-        0x74, 0x02, 0x70, 0x08, 0xD9, 0x00, 0xFF, 0x0A, 0x77, 0xFD, 0xE2, 0x08,
-        0x8B, 0x14, 0x2C, 0x1F, 0x03, 0x24, 0x0C, 0x2C, 0xDF, 0x21, 0x56, 0x27,
-        0xBE, 0x1F, 0x39, 0x24, 0x8D, 0x13, 0x8E, 0x16, 0xA8, 0x0B, 0x02, 0x0E,
-        0x6B, 0x05, 0x33, 0x0B, 0xD5, 0x01, 0x84, 0x0B, 0x19, 0x00, 0xAA, 0x0A,
-        0x79, 0xFD, 0x55, 0x07, 0x5F, 0xFD, 0x32, 0x04, 0xB9, 0xFE, 0x24, 0x00,
-        0x36, 0x02, 0x82, 0x01, 0x03, 0x01, 0x99, 0x02, 0x8C, 0x00, 0xF8, 0x03,
-        0xE4, 0xFC, 0xD0, 0xFF, 0x25, 0xFC, 0x0A, 0xFC, 0x2B, 0xFD, 0xCB, 0xF7,
-        0x0E, 0xFF, 0x77, 0xF5, 0x29, 0x02, 0x24, 0xF7, 0x50, 0xEB, 0xE2, 0xE0,
-        0x82, 0xDB, 0xC2, 0xD3, 0xC3, 0xDD, 0xAB, 0xD8, 0xBC, 0xDF, 0xAE, 0xDB,
-        0xF3, 0xEB, 0x60, 0xE9, 0x05, 0xF4, 0x14, 0xF2, 0x3C, 0xFA, 0xAF, 0xF4,
-        0x32, 0xFE, 0x9E, 0xF4, 0xF2, 0xFF, 0x70, 0xF5, 0xB3, 0x02, 0xC9, 0xF8,
-        0xA7, 0x02, 0xA8, 0xFB, 0x52, 0x01, 0x9C, 0xFF, 0xEA, 0xFD, 0x37, 0xFE,
-        0x37, 0xFF, 0x3E, 0xFD, 0xCE, 0xFF, 0x18, 0xFC, 0x08, 0x03, 0xCE, 0xFF,
-        0xA0, 0x03, 0x8B, 0x03, 0x66, 0x02, 0x9B, 0x07, 0xCD, 0x00, 0x2B, 0x0A,
-        0xC2, 0xFD, 0x9F, 0x08, 0x64, 0x14, 0xCC, 0x1E, 0x3E, 0x24, 0xF1, 0x2B,
-        0x1C, 0x22, 0x0E, 0x27, 0x77, 0x20, 0x6B, 0x24, 0x4D, 0x14, 0xAF, 0x16,
-        0x20, 0x0C, 0xE9, 0x0D, 0x8B, 0x05, 0x18, 0x0B, 0x7E, 0x01, 0x3D, 0x0B,
-        0xE9, 0xFF, 0x93, 0x0A, 0x49, 0xFD, 0x7A, 0x07, 0x8C, 0xFD, 0xD1, 0x04,
-        0xA7, 0xFE, 0xA5, 0x00, 0xFA, 0x01, 0xFA, 0x01, 0x96, 0x00, 0x99, 0x02,
-        0x69, 0x00, 0xE3, 0x03, 0xDC, 0xFD, 0x7B, 0x00, 0x89, 0xFD, 0xB7, 0xFC,
-        0x7E, 0xFE, 0x32, 0xF8, 0x9C, 0xFF, 0x65, 0xF5, 0x97, 0x02, 0x07, 0xF7,
-        0xD6, 0xEB, 0xF1, 0xE0, 0xF7, 0xDB, 0x1F, 0xD4, 0xCE, 0xDD, 0xEC, 0xD8,
-        0x43, 0xDF, 0x63, 0xDB, 0x50, 0xEB, 0x06, 0xE9, 0x8D, 0xF3, 0xAC, 0xF1,
-        0x5D, 0xFA, 0x57, 0xF4, 0x32, 0xFE, 0xC5, 0xF3, 0xF4, 0xFF, 0x90, 0xF4,
-        0xA7, 0x02, 0xE4, 0xF7, 0x5D, 0x02, 0xE0, 0xFA, 0x4B, 0x01, 0x64, 0xFF,
-        0xBC, 0xFD, 0x07, 0xFE, 0xFE, 0xFE, 0x6D, 0xFD, 0xF0, 0xFE, 0xF8, 0xFB,
-        0x9E, 0x01, 0x69, 0xFF, 0x19, 0x02, 0x5E, 0x03, 0x81, 0x01, 0x22, 0x08,
-        0x7A, 0x00, 0xCC, 0x0A, 0x6D, 0xFD, 0x0C, 0x09, 0x44, 0x14, 0x4E, 0x1F,
-        0xE0, 0x23, 0xE0, 0x2B, 0xF5, 0x21, 0x2E, 0x27, 0x5F, 0x20, 0xB4, 0x24,
-        0x54, 0x14, 0x10, 0x17, 0x23, 0x0C, 0x65, 0x0E, 0x48, 0x05, 0xC6, 0x0B,
-        0x6B, 0x01, 0x43, 0x0C, 0x50, 0xFF, 0x16, 0x0B, 0xB0, 0xFC, 0xB3, 0x07,
-        0x48, 0xFD, 0xC9, 0x04, 0xC4, 0xFE, 0x85, 0x00, 0x9F, 0x02, 0x2A, 0x02,
-        0x71, 0x01, 0xD2, 0x02, 0x17, 0x01, 0xFF, 0x03, 0x05, 0xFE, 0x4A, 0x00,
-        0xDC, 0xFD, 0x8F, 0xFC, 0xDC, 0xFE, 0x3E, 0xF8, 0x45, 0x00, 0x0E, 0xF6,
-        0x2A, 0x03, 0xAC, 0xF7, 0xFB, 0xEB, 0x0D, 0xE1, 0x37, 0xDC, 0x59, 0xD4,
-        0x10, 0xDE, 0xF2, 0xD8, 0xB3, 0xDF, 0x59, 0xDB, 0x9D, 0xEB, 0x05, 0xE9,
-        0xBB, 0xF3, 0xAE, 0xF1, 0xB8, 0xFA, 0x78, 0xF4, 0xEE, 0xFE, 0x4D, 0xF4,
-        0x39, 0x01, 0x8F, 0xF5, 0xC0, 0x03, 0xC6, 0xF8, 0xFF, 0x02, 0x84, 0xFB,
-        0x7A, 0x01, 0xB2, 0xFF, 0x98, 0xFD, 0xF8, 0xFD, 0xE3, 0xFE, 0x46, 0xFD,
-        0xAB, 0xFF, 0x50, 0xFC, 0xAA, 0x02, 0xA9, 0xFF, 0x42, 0x02, 0xCF, 0x02,
-        0xC9, 0x00, 0x98, 0x06, 0x4D, 0xFF, 0x9A, 0x08, 0x95, 0xFC, 0x37, 0x07,
-        0xFF, 0x13, 0x1E, 0x1E, 0xF8, 0x23, 0x18, 0x2B, 0xFF, 0x21, 0x9D, 0x26,
-        0x67, 0x20, 0x8B, 0x24, 0x73, 0x14, 0xFE, 0x16, 0x50, 0x0C, 0x5A, 0x0E,
-        0x47, 0x05, 0x89, 0x0B, 0x0E, 0x01, 0xBA, 0x0B, 0x28, 0xFF, 0xE0, 0x0A,
-        0x93, 0xFC, 0xB3, 0x07, 0x0A, 0xFD, 0xB9, 0x04, 0x2A, 0xFE, 0x3A, 0x00,
-        0xE6, 0x01, 0xE5, 0x01, 0xA1, 0x00, 0xC9, 0x02, 0xCE, 0xFF, 0xFF, 0x03,
-        0x2D, 0xFD, 0x24, 0x01, 0xC4, 0xFD, 0x24, 0xFE, 0x41, 0xFF, 0x1A, 0xFA,
-        0xC9, 0x00, 0xDF, 0xF7, 0xC9, 0x03, 0x2E, 0xF9, 0xA3, 0xEC, 0x44, 0xE2,
-        0xBF, 0xDC, 0x59, 0xD5, 0xCC, 0xDE, 0xD4, 0xD9, 0x27, 0xE0, 0xB0, 0xDB,
-        0xDF, 0xEB, 0x15, 0xE9, 0xC7, 0xF3, 0xBB, 0xF1, 0x82, 0xFA, 0x55, 0xF4,
-        0x77, 0xFE, 0xF6, 0xF3, 0x4C, 0x00, 0xBF, 0xF4, 0x58, 0x03, 0x4D, 0xF8,
-        0x70, 0x03, 0xC2, 0xFB, 0x72, 0x02, 0x78, 0x00, 0x74, 0xFE, 0xB2, 0xFE,
-        0x47, 0xFF, 0x8B, 0xFD, 0xFA, 0xFF, 0x4E, 0xFC, 0xA5, 0x02, 0x36, 0xFF,
-        0x5C, 0x02, 0x8D, 0x02, 0x14, 0x01, 0xD1, 0x06, 0x3B, 0xFF, 0xBD, 0x08,
-        0xDA, 0xFB, 0xFD, 0x06, 0xC4, 0x12, 0x8D, 0x1D, 0xB6, 0x22, 0x40, 0x2A,
-        0xCC, 0x20, 0xA3, 0x25, 0x9E, 0x1F, 0xF0, 0x23, 0x1B, 0x14, 0xB2, 0x16,
-        0x4D, 0x0C, 0x31, 0x0E, 0xC4, 0x05, 0xE4, 0x0B, 0x9B, 0x01, 0x36, 0x0C,
-        0x68, 0xFF, 0x1A, 0x0B, 0x12, 0xFC, 0x63, 0x07, 0xDC, 0xFB, 0xCC, 0x03,
-        0x1F, 0xFD, 0x28, 0xFF, 0x70, 0x01, 0xF3, 0x00, 0xDA, 0x00, 0x0B, 0x02,
-        0x00, 0x00, 0xF8, 0x02, 0x0A, 0xFD, 0xD8, 0xFF, 0x3C, 0xFD, 0x9A, 0xFC,
-        0xA4, 0xFE, 0xA4, 0xF8, 0xE6, 0x00, 0x5E, 0xF7, 0x56, 0x04, 0x4F, 0xF9,
-        0x4B, 0xED, 0xA2, 0xE2, 0x1B, 0xDD, 0xD1, 0xD5, 0xDA, 0xDE, 0x44, 0xDA,
-        0x31, 0xE0, 0xF6, 0xDB, 0xB7, 0xEB, 0x1B, 0xE9, 0xBA, 0xF3, 0xC8, 0xF1,
-        0x6A, 0xFA, 0x30, 0xF4, 0xE6, 0xFE, 0x49, 0xF4, 0x47, 0x01, 0xBB, 0xF5,
-        0x0A, 0x04, 0xF6, 0xF8, 0x07, 0x04, 0x63, 0xFC, 0x81, 0x02, 0xDD, 0x00,
-        0x6B, 0xFE, 0x53, 0xFF, 0x51, 0xFF, 0x8B, 0xFE, 0x80, 0x00, 0xD8, 0xFD,
-        0xA0, 0x03, 0xF5, 0x00, 0x19, 0x03, 0xBF, 0x03, 0x92, 0x01, 0x8F, 0x07,
-        0xFC, 0xFE, 0x7B, 0x08, 0xAA, 0xFB, 0xC6, 0x06, 0xE0, 0x12, 0xB9, 0x1D,
-        0x1B, 0x23, 0x88, 0x2A, 0xB2, 0x21, 0x44, 0x26, 0x3D, 0x20, 0x5F, 0x24,
-        0xC9, 0x14, 0x22, 0x17, 0x9A, 0x0C, 0x23, 0x0E, 0xBC, 0x05, 0xB3, 0x0B,
-        0x23, 0x01, 0x9E, 0x0B, 0xBD, 0xFE, 0x68, 0x0A, 0x5C, 0xFC, 0xCD, 0x07,
-        0x40, 0xFC, 0x79, 0x04, 0x9C, 0xFD, 0xEE, 0xFF, 0x5D, 0x01, 0x20, 0x01,
-        0x3A, 0x00, 0x94, 0x01, 0x45, 0xFF, 0x57, 0x02, 0x47, 0xFC, 0x38, 0xFF,
-        0x06, 0xFD, 0x79, 0xFC, 0x50, 0xFE, 0x53, 0xF8, 0xCE, 0x00, 0x51, 0xF7,
-        0x24, 0x04, 0xF5, 0xF8, 0x33, 0xED, 0x3E, 0xE2, 0x4B, 0xDD, 0xC7, 0xD5,
-        0x9C, 0xDE, 0xF6, 0xD9, 0x22, 0xE0, 0xEA, 0xDB, 0x87, 0xEB, 0x29, 0xE9,
-        0xC3, 0xF3, 0x23, 0xF2, 0xAA, 0xFA, 0x71, 0xF4, 0x0A, 0xFF, 0x1E, 0xF4,
-        0x66, 0x01, 0x33, 0xF5, 0xBB, 0x03, 0xC6, 0xF7, 0xCD, 0x03, 0x2C, 0xFB,
-        0x4D, 0x02, 0xC5, 0xFF, 0x7D, 0xFE, 0xA0, 0xFE, 0x82, 0xFF, 0x1F, 0xFE,
-        0x16, 0x00, 0xE1, 0xFC, 0x22, 0x03, 0xF3, 0xFF, 0x9E, 0x02, 0xC6, 0x02,
-        0xA7, 0x01, 0x0C, 0x07, 0x79, 0xFF, 0x6A, 0x08, 0x04, 0xFC, 0xBF, 0x06,
-        0x91, 0x12, 0x6B, 0x1D, 0x24, 0x22, 0xCD, 0x29, 0xD6, 0x20, 0xDA, 0x25,
-        0x54, 0x1F, 0xE9, 0x23, 0x18, 0x14, 0xB2, 0x16, 0x16, 0x0C, 0xC4, 0x0D,
-        0x21, 0x05, 0x51, 0x0B, 0xF4, 0x00, 0xD4, 0x0B, 0x6B, 0xFE, 0x98, 0x0A,
-        0xEA, 0xFB, 0x00, 0x08, 0x15, 0xFC, 0x04, 0x05, 0xAA, 0xFD, 0xB4, 0x00,
-        0x56, 0x01, 0xE1, 0x01, 0x2F, 0x00, 0x68, 0x02, 0xC1, 0xFF, 0xD4, 0x03,
-        0x65, 0xFC, 0x82, 0x00, 0xD8, 0xFC, 0xAA, 0xFD, 0xE7, 0xFD, 0x7D, 0xF9,
-        0xE1, 0xFF, 0xD5, 0xF7, 0x64, 0x03, 0x31, 0xF9, 0xE2, 0xEC, 0x3F, 0xE2,
-        0x8C, 0xDD, 0xB4, 0xD5, 0x09, 0xDF, 0x9A, 0xD9, 0xCD, 0xE0, 0xAC, 0xDB,
-        0x11, 0xEC, 0xE4, 0xE8, 0x01, 0xF4, 0x9C, 0xF1, 0x2F, 0xFB, 0x44, 0xF4,
-        0x72, 0xFF, 0xE8, 0xF3, 0x11, 0x02, 0x61, 0xF5, 0x42, 0x04, 0xD2, 0xF7,
-        0x82, 0x03, 0x58, 0xFA, 0xC7, 0x01, 0x8A, 0xFE, 0x44, 0xFE, 0x76, 0xFD,
-        0x79, 0xFF, 0x0F, 0xFD, 0xFB, 0xFF, 0xAF, 0xFB, 0x96, 0x03, 0x26, 0xFF,
-        0x2E, 0x03, 0xD1, 0x01, 0xFB, 0x01, 0x9F, 0x05, 0x16, 0x00, 0x45, 0x07,
-        0x94, 0xFC, 0x21, 0x06, 0x47, 0x13, 0x78, 0x1D, 0x90, 0x22, 0x17, 0x2A,
-        0x12, 0x21, 0x32, 0x26, 0x37, 0x1F, 0xE1, 0x23, 0xED, 0x13, 0x9A, 0x16,
-        0x04, 0x0C, 0x1B, 0x0E, 0xA7, 0x04, 0x7F, 0x0B, 0x2C, 0x00, 0xAE, 0x0B,
-        0x8E, 0xFD, 0x2D, 0x0A, 0xA6, 0xFB, 0xDF, 0x07, 0x8B, 0xFC, 0x40, 0x05,
-        0x25, 0xFE, 0xE4, 0x00, 0xBB, 0x01, 0xE8, 0x01, 0xA6, 0x00, 0x54, 0x02,
-        0x27, 0x00, 0xBF, 0x03, 0x59, 0xFC, 0x66, 0x00, 0x73, 0xFC, 0xFA, 0xFD,
-        0x4A, 0xFD, 0x7B, 0xFA, 0x30, 0xFF, 0x30, 0xF9, 0xB9, 0x02, 0x4E, 0xFA,
-        0x29, 0xEC, 0xBE, 0xE2, 0xE4, 0xDC, 0xCD, 0xD5, 0x8A, 0xDE, 0x95, 0xD9,
-        0x90, 0xE0, 0xFF, 0xDB, 0x23, 0xEC, 0x8D, 0xE9, 0x39, 0xF4, 0x12, 0xF2,
-        0x6B, 0xFB, 0x6B, 0xF4, 0xCC, 0xFF, 0x43, 0xF4, 0x08, 0x02, 0x80, 0xF5,
-        0xF3, 0x03, 0xF8, 0xF7, 0x5A, 0x03, 0xFB, 0xFA, 0xE3, 0x01, 0x62, 0xFF,
-        0x0F, 0xFE, 0x18, 0xFE, 0xBA, 0xFE, 0x66, 0xFD, 0x21, 0xFF, 0x0B, 0xFC,
-        0xD1, 0x02, 0x52, 0xFF, 0x17, 0x03, 0xFE, 0x01, 0xA1, 0x02, 0x89, 0x05,
-        0xE8, 0x00, 0xB4, 0x06, 0x67, 0xFD, 0x9A, 0x05, 0xEE, 0x13, 0x22, 0x1D,
-        0x66, 0x23, 0x4B, 0x2A, 0x9A, 0x21, 0x66, 0x26, 0x99, 0x1F, 0xE8, 0x23,
-        0xBC, 0x13, 0x0F, 0x16, 0x86, 0x0B, 0xAC, 0x0D, 0x81, 0x04, 0xAA, 0x0B,
-        0x29, 0x00, 0xDF, 0x0B, 0x46, 0xFE, 0xD0, 0x0A, 0x49, 0xFC, 0xEB, 0x07,
-        0xD6, 0xFC, 0x7F, 0x04, 0x87, 0xFE, 0x12, 0x00, 0x8A, 0x02, 0x7B, 0x01,
-        0xFE, 0x01, 0x1C, 0x02, 0x74, 0x01, 0x6A, 0x03, 0xCF, 0xFD, 0x42, 0x00,
-        0x45, 0xFD, 0x92, 0xFD, 0x9B, 0xFD, 0x39, 0xFA, 0x0E, 0xFF, 0xFA, 0xF8,
-        0x8D, 0x02, 0xF2, 0xF9, 0x1B, 0xEC, 0x69, 0xE2, 0x9D, 0xDC, 0x18, 0xD5,
-        0xA0, 0xDE, 0x34, 0xD9, 0x75, 0xE0, 0xCA, 0xDB, 0x2E, 0xEC, 0xBE, 0xE9,
-        0x3F, 0xF4, 0x0B, 0xF2, 0x77, 0xFB, 0x33, 0xF4, 0x0C, 0x00, 0x2E, 0xF4,
-        0xEE, 0x01, 0x17, 0xF5, 0xE5, 0x03, 0xDF, 0xF7, 0x20, 0x03, 0x25, 0xFB,
-        0x5F, 0x01, 0x69, 0xFF, 0x88, 0xFD, 0x4D, 0xFE, 0x60, 0xFE, 0x1F, 0xFE,
-        0xCB, 0xFE, 0xE9, 0xFC, 0x58, 0x02, 0x15, 0x00, 0x93, 0x02, 0x98, 0x02,
-        0x32, 0x02, 0xB9, 0x05, 0x15, 0x01, 0x4F, 0x07, 0xAF, 0xFD, 0x76, 0x06,
-        0x45, 0x14, 0x3B, 0x1E, 0xD4, 0x23, 0xAF, 0x2B, 0xC9, 0x21, 0xA4, 0x27,
-        0xF2, 0x1F, 0xEF, 0x24, 0x94, 0x14, 0x3A, 0x17, 0x6A, 0x0C, 0xDC, 0x0E,
-        0xE6, 0x04, 0x50, 0x0C, 0x57, 0x00, 0x4C, 0x0C, 0x82, 0xFE, 0x6F, 0x0B,
-        0xDB, 0xFC, 0xD5, 0x08, 0x89, 0xFD, 0x66, 0x05, 0x24, 0xFF, 0xF3, 0x00,
-        0x71, 0x02, 0x7A, 0x01, 0x6B, 0x01, 0x74, 0x01, 0x42, 0x01, 0x01, 0x03,
-        0x9A, 0xFD, 0xD8, 0xFF, 0xA9, 0xFD, 0xD1, 0xFD, 0xCC, 0xFD, 0xAA, 0xFA,
-        0xAD, 0xFE, 0xED, 0xF8, 0x11, 0x02, 0xBD, 0xF9, 0x84, 0xEB, 0xF6, 0xE1,
-        0xD9, 0xDB, 0x4D, 0xD4, 0x0F, 0xDE, 0x69, 0xD8, 0x3A, 0xE0, 0x6D, 0xDB,
-        0x51, 0xEB, 0xD5, 0xE8, 0xBF, 0xF3, 0x62, 0xF1, 0x10, 0xFB, 0xBF, 0xF3,
-        0x16, 0xFF, 0x41, 0xF3, 0xE1, 0x00, 0x14, 0xF4, 0xBB, 0x02, 0xDE, 0xF6,
-        0x98, 0x02, 0xE4, 0xFA, 0x3B, 0x01, 0x91, 0xFF, 0x32, 0xFE, 0x5C, 0xFF,
-        0xE4, 0xFE, 0x11, 0xFF, 0xF4, 0xFE, 0x50, 0xFD, 0xF0, 0x02, 0x9E, 0x00,
-        0x00, 0x03, 0x85, 0x02, 0x29, 0x03, 0xCB, 0x05, 0x6A, 0x02, 0x9C, 0x07,
-        0xD3, 0xFE, 0xB1, 0x06, 0x21, 0x15, 0x4D, 0x1E, 0xBD, 0x24, 0x03, 0x2C,
-        0x14, 0x22, 0x93, 0x27, 0x91, 0x1F, 0x3F, 0x24, 0xC2, 0x14, 0x1D, 0x17,
-        0x4E, 0x0C, 0x87, 0x0E, 0x7F, 0x05, 0x90, 0x0C, 0xF5, 0x01, 0x52, 0x0D,
-        0xE1, 0xFF, 0x31, 0x0C, 0x7C, 0xFD, 0xCE, 0x08, 0x67, 0xFD, 0xAA, 0x04,
-        0xD5, 0xFE, 0x1C, 0x00, 0x1A, 0x02, 0xA0, 0x00, 0xC8, 0x01, 0x5E, 0x01,
-        0x87, 0x01, 0x06, 0x03, 0x28, 0xFD, 0x93, 0xFF, 0xF9, 0xFC, 0xC5, 0xFD,
-        0xCD, 0xFC, 0xA6, 0xFA, 0x8E, 0xFD, 0xE3, 0xF8, 0x43, 0x01, 0xDD, 0xF9,
-        0x10, 0xEB, 0x56, 0xE2, 0x4B, 0xDB, 0x7A, 0xD4, 0x1A, 0xDE, 0x0C, 0xD9,
-        0x50, 0xE0, 0x06, 0xDC, 0xBF, 0xEA, 0xAE, 0xE8, 0x1F, 0xF3, 0x04, 0xF1,
-        0x16, 0xFA, 0xFE, 0xF2, 0xE8, 0xFD, 0x77, 0xF2, 0x7E, 0x00, 0x0F, 0xF4,
-        0xF8, 0x02, 0x6B, 0xF7, 0x7F, 0x02, 0x15, 0xFB, 0xC4, 0x00, 0x80, 0xFF,
-        0x26, 0xFD, 0xD6, 0xFE, 0x6C, 0xFD, 0x5F, 0xFE, 0xF0, 0xFD, 0x1D, 0xFD,
-        0x8C, 0x02, 0xAF, 0x00, 0xC8, 0x02, 0x5A, 0x02, 0xF0, 0x02, 0x26, 0x05,
-        0x51, 0x02, 0xEC, 0x06, 0x93, 0xFE, 0xD5, 0x05, 0xE3, 0x14, 0x8C, 0x1D,
-        0xAD, 0x24, 0x73, 0x2B, 0xE7, 0x21, 0x1B, 0x27, 0xDC, 0x1F, 0x76, 0x24,
-        0x56, 0x15, 0xDF, 0x17, 0xA7, 0x0C, 0x72, 0x0F, 0x1C, 0x05, 0xF3, 0x0C,
-        0x06, 0x01, 0x2A, 0x0D, 0x8B, 0xFE, 0x9D, 0x0B, 0x7C, 0xFC, 0xB6, 0x08,
-        0x80, 0xFD, 0x6D, 0x05, 0x1C, 0xFF, 0xBF, 0x00, 0xDE, 0x02, 0x3C, 0x01,
-        0xB8, 0x02, 0x5F, 0x01, 0x58, 0x02, 0x5E, 0x02, 0x12, 0xFE, 0xEE, 0xFE,
-        0xD9, 0xFD, 0x35, 0xFD, 0xA2, 0xFD, 0x63, 0xFA, 0x0C, 0xFE, 0x9E, 0xF8,
-        0x99, 0x01, 0x9A, 0xF9, 0x13, 0xEB, 0xEF, 0xE1, 0x1A, 0xDB, 0x1C, 0xD4,
-        0xAD, 0xDD, 0x6F, 0xD8, 0xA1, 0xDF, 0x1A, 0xDB, 0x66, 0xEA, 0x05, 0xE8,
-        0x2F, 0xF3, 0x7E, 0xF0, 0xB2, 0xFA, 0xF8, 0xF2, 0x74, 0xFE, 0x9A, 0xF2,
-        0x99, 0x00, 0xEA, 0xF3, 0xCA, 0x02, 0x0F, 0xF7, 0x25, 0x02, 0xE9, 0xFA,
-        0xFA, 0x00, 0x2E, 0x00, 0x03, 0xFD, 0x9B, 0xFF, 0xD1, 0xFC, 0x5C, 0xFF,
-        0xF9, 0xFC, 0x2D, 0xFE, 0x06, 0x01, 0x56, 0x01, 0x8D, 0x01, 0x3C, 0x03,
-        0xFD, 0x01, 0x27, 0x06, 0xAE, 0x01, 0xE5, 0x07, 0x32, 0xFE, 0x12, 0x07,
-        0x9E, 0x14, 0x9C, 0x1E, 0x64, 0x24, 0x3E, 0x2C, 0xDB, 0x21, 0xFB, 0x27,
-        0xE4, 0x1F, 0x38, 0x25, 0xF1, 0x14, 0xFC, 0x17, 0x62, 0x0C, 0xBC, 0x0F,
-        0x32, 0x05, 0x8A, 0x0D, 0xAB, 0x01, 0xFE, 0x0D, 0x6F, 0xFF, 0xB3, 0x0C,
-        0xC2, 0xFC, 0x12, 0x09, 0x22, 0xFD, 0xE8, 0x04, 0x7F, 0xFE, 0xC8, 0xFF,
-        0x0E, 0x03, 0xC0, 0x00, 0x9E, 0x03, 0x12, 0x01, 0x81, 0x03, 0x0B, 0x02,
-        0x7B, 0xFF, 0xB8, 0xFE, 0xB8, 0xFE, 0x80, 0xFC, 0x32, 0xFE, 0x82, 0xF9,
-        0x95, 0xFE, 0xE9, 0xF7, 0xFF, 0x01, 0xAE, 0xF8, 0xB2, 0xEB, 0x4F, 0xE1,
-        0x18, 0xDC, 0xF0, 0xD3, 0x59, 0xDE, 0xDB, 0xD7, 0x34, 0xE0, 0xAC, 0xDA,
-        0x0F, 0xEB, 0xF8, 0xE7, 0x69, 0xF3, 0x0E, 0xF0, 0x9D, 0xFA, 0x63, 0xF2,
-        0x6F, 0xFE, 0x42, 0xF2, 0xF9, 0x00, 0xBF, 0xF3, 0xB4, 0x03, 0x51, 0xF7,
-        0x3D, 0x03, 0x5C, 0xFB, 0x9E, 0x01, 0x30, 0x00, 0x3A, 0xFD, 0x6D, 0xFF,
-        0xD3, 0xFC, 0x78, 0xFF, 0x1C, 0xFD, 0xC1, 0xFE, 0xFF, 0x00, 0x19, 0x02,
-        0x7B, 0x01, 0x1C, 0x04, 0x05, 0x02, 0x01, 0x07, 0x53, 0x01, 0x35, 0x08,
-        0x0A, 0xFE, 0x72, 0x07, 0x3C, 0x14, 0x90, 0x1E, 0xBF, 0x23, 0xE7, 0x2B,
-        0xC2, 0x21, 0x5D, 0x28, 0xCF, 0x1F, 0x7C, 0x25, 0x15, 0x15, 0x5F, 0x18,
-        0xA9, 0x0C, 0x3A, 0x10, 0x5E, 0x05, 0xC9, 0x0D, 0x36, 0x01, 0x98, 0x0D,
-        0xC9, 0xFE, 0x51, 0x0C, 0x68, 0xFC, 0x33, 0x09, 0xFD, 0xFC, 0x45, 0x05,
-        0x8D, 0xFE, 0x6F, 0x00, 0x5C, 0x02, 0xA5, 0x00, 0xBC, 0x02, 0xA7, 0x00,
-        0x77, 0x02, 0x6E, 0x01, 0xDE, 0xFE, 0x5E, 0xFE, 0x8A, 0xFE, 0x63, 0xFC,
-        0xDC, 0xFD, 0x37, 0xF9, 0xC5, 0xFE, 0xFF, 0xF7, 0xFF, 0x01, 0x78, 0xF8,
-        0x07, 0xEC, 0x63, 0xE1, 0x91, 0xDC, 0xC7, 0xD3, 0xA8, 0xDE, 0x39, 0xD7,
-        0xA2, 0xE0, 0x1B, 0xDA, 0x2C, 0xEB, 0x38, 0xE7, 0x7D, 0xF3, 0x8D, 0xEF,
-        0x90, 0xFA, 0x15, 0xF2, 0xBF, 0xFE, 0x7D, 0xF2, 0xF2, 0x00, 0x76, 0xF3,
-        0x65, 0x03, 0x8E, 0xF6, 0xEC, 0x02, 0x75, 0xFA, 0xA9, 0x01, 0x72, 0xFF,
-        0x06, 0xFE, 0x4F, 0xFF, 0x85, 0xFD, 0xE4, 0xFE, 0x08, 0xFE, 0x33, 0xFE,
-        0xC7, 0x01, 0x3F, 0x01, 0x7E, 0x02, 0x95, 0x03, 0x34, 0x03, 0xD4, 0x06,
-        0x41, 0x02, 0x25, 0x08, 0xE8, 0xFE, 0xA4, 0x07, 0xA8, 0x14, 0xAA, 0x1E,
-        0xF7, 0x23, 0x61, 0x2C, 0x76, 0x21, 0xD8, 0x28, 0xA6, 0x1F, 0x47, 0x26,
-        0x24, 0x15, 0x3E, 0x19, 0x0A, 0x0D, 0x0F, 0x11, 0xF3, 0x05, 0x6D, 0x0E,
-        0xB4, 0x01, 0x18, 0x0E, 0x34, 0xFF, 0x15, 0x0D, 0x42, 0xFC, 0xCF, 0x09,
-        0xB2, 0xFC, 0x15, 0x06, 0xD5, 0xFD, 0xE2, 0x00, 0xE0, 0x01, 0x58, 0x01,
-        0x65, 0x02, 0x87, 0x01, 0x8C, 0x01, 0xBE, 0x01, 0x86, 0xFD, 0x23, 0xFE,
-        0xBC, 0xFC, 0xA9, 0xFB, 0x6B, 0xFC, 0xAB, 0xF8, 0x53, 0xFD, 0x60, 0xF7,
-        0xDB, 0x00, 0x46, 0xF8, 0xFC, 0xEA, 0x65, 0xE1, 0xEE, 0xDB, 0x08, 0xD4,
-        0x92, 0xDE, 0xC0, 0xD7, 0x3A, 0xE0, 0x10, 0xDA, 0xBD, 0xEA, 0x0D, 0xE7,
-        0xB1, 0xF2, 0x0D, 0xEF, 0x08, 0xFA, 0xD7, 0xF1, 0x4C, 0xFE, 0x02, 0xF2,
-        0x4D, 0x01, 0x32, 0xF3, 0x47, 0x04, 0x27, 0xF6, 0xB7, 0x03, 0x8C, 0xF9,
-        0x79, 0x02, 0xAF, 0xFE, 0x36, 0xFE, 0x19, 0xFE, 0x05, 0xFE, 0x59, 0xFE,
-        0xF8, 0xFE, 0x70, 0xFE, 0x2B, 0x03, 0x3B, 0x02, 0x6B, 0x03, 0x4F, 0x04,
-        0x7B, 0x03, 0x18, 0x07, 0x6F, 0x02, 0x5F, 0x08, 0xD5, 0xFE, 0x49, 0x07,
-        0xD8, 0x14, 0x48, 0x1E, 0xD8, 0x23, 0x84, 0x2B, 0x79, 0x21, 0x17, 0x28,
-        0xC3, 0x1F, 0xC5, 0x25, 0x7C, 0x15, 0x03, 0x19, 0x79, 0x0D, 0x03, 0x11,
-        0x3A, 0x06, 0x62, 0x0E, 0xEB, 0x01, 0x5C, 0x0E, 0x9F, 0xFE, 0x28, 0x0D,
-        0xCD, 0xFB, 0xB6, 0x0A, 0x34, 0xFC, 0x46, 0x07, 0x65, 0xFD, 0x07, 0x02,
-        0x69, 0x01, 0x36, 0x02, 0x8D, 0x01, 0xA1, 0x01, 0xDD, 0x00, 0x93, 0x01,
-        0x0A, 0xFD, 0xF3, 0xFD, 0x31, 0xFD, 0x39, 0xFC, 0x03, 0xFD, 0x28, 0xF9,
-        0x10, 0xFE, 0xDF, 0xF7, 0x6B, 0x01, 0x98, 0xF8, 0x48, 0xEB, 0x6B, 0xE1,
-        0xF8, 0xDB, 0xC5, 0xD3, 0x4D, 0xDE, 0x16, 0xD7, 0x41, 0xE0, 0xAE, 0xD9,
-        0x79, 0xEA, 0x81, 0xE6, 0x85, 0xF2, 0xB7, 0xEE, 0x5F, 0xF9, 0x13, 0xF1,
-        0xA6, 0xFD, 0x2D, 0xF1, 0xC6, 0x00, 0x27, 0xF2, 0x7D, 0x03, 0x55, 0xF4,
-        0x48, 0x03, 0xE1, 0xF7, 0x36, 0x02, 0x22, 0xFD, 0x82, 0xFE, 0x2C, 0xFD,
-        0x32, 0xFE, 0x9B, 0xFD, 0xBD, 0xFE, 0xA2, 0xFD, 0x4D, 0x02, 0x16, 0x01,
-        0x61, 0x02, 0x36, 0x03, 0xC4, 0x02, 0x8D, 0x06, 0xCF, 0x01, 0x06, 0x08,
-        0xA8, 0xFE, 0x9B, 0x07, 0xE4, 0x14, 0xED, 0x1E, 0x61, 0x24, 0xC8, 0x2C,
-        0xF8, 0x21, 0x47, 0x29, 0x1D, 0x20, 0x6C, 0x26, 0x1F, 0x16, 0x58, 0x19,
-        0x5E, 0x0E, 0x0E, 0x11, 0x97, 0x07, 0x85, 0x0E, 0x45, 0x03, 0x43, 0x0E,
-        0x3E, 0x00, 0x85, 0x0D, 0x96, 0xFD, 0x8E, 0x0B, 0xBA, 0xFD, 0x2A, 0x08,
-        0x92, 0xFE, 0xFC, 0x02, 0x2F, 0x02, 0x32, 0x03, 0x30, 0x02, 0xB6, 0x02,
-        0x87, 0x01, 0xAD, 0x02, 0x9A, 0xFD, 0xDE, 0xFE, 0x37, 0xFD, 0x56, 0xFC,
-        0xEB, 0xFC, 0x17, 0xF9, 0x02, 0xFE, 0xB3, 0xF7, 0x58, 0x01, 0x30, 0xF8,
-        0x22, 0xEB, 0xCC, 0xE0, 0xF1, 0xDB, 0xFD, 0xD2, 0x42, 0xDE, 0x56, 0xD6,
-        0xD3, 0xDF, 0x24, 0xD9, 0x72, 0xE9, 0x40, 0xE6, 0x0D, 0xF1, 0xB5, 0xEE,
-        0x30, 0xF8, 0xD8, 0xF1, 0xA6, 0xFC, 0x49, 0xF2, 0xAE, 0xFF, 0xF6, 0xF2,
-        0x04, 0x02, 0x9A, 0xF4, 0xE2, 0x01, 0x0E, 0xF8, 0xEB, 0x00, 0x06, 0xFD,
-        0x28, 0xFD, 0x8A, 0xFC, 0x51, 0xFD, 0x06, 0xFD, 0xE0, 0xFD, 0xDF, 0xFC,
-        0x15, 0x02, 0x1F, 0x01, 0x4D, 0x02, 0xA1, 0x03, 0x89, 0x02, 0xD3, 0x06,
-        0x45, 0x01, 0x19, 0x08, 0xF8, 0xFD, 0x8E, 0x07, 0x3F, 0x14, 0x10, 0x1F,
-        0x34, 0x23, 0xC8, 0x2C, 0x0A, 0x21, 0xB0, 0x29, 0x7F, 0x1F, 0x94, 0x26,
-        0x08, 0x16, 0x34, 0x19, 0x74, 0x0E, 0x5E, 0x10, 0x8E, 0x07, 0x21, 0x0D,
-        0x74, 0x03, 0x04, 0x0D, 0xC8, 0x00, 0xC1, 0x0C, 0xB6, 0xFE, 0x39, 0x0B,
-        0x90, 0xFE, 0x5B, 0x07, 0xB5, 0xFF, 0x73, 0x02, 0x5A, 0x03, 0xD7, 0x02,
-        0x28, 0x03, 0x94, 0x02, 0x7D, 0x02, 0xD7, 0x02, 0x4C, 0xFE, 0x9E, 0xFE,
-        0x37, 0xFE, 0x54, 0xFC, 0xED, 0xFD, 0x25, 0xF9, 0x3A, 0xFF, 0x0A, 0xF8,
-        0x4B, 0x02, 0x85, 0xF8, 0xD2, 0xEB, 0xEB, 0xE0, 0xAF, 0xDC, 0xD2, 0xD2,
-        0xEE, 0xDE, 0xE0, 0xD5, 0x98, 0xE0, 0x46, 0xD9, 0x48, 0xEA, 0x20, 0xE7,
-        0xB8, 0xF1, 0x27, 0xF0, 0xD9, 0xF7, 0xDA, 0xF2, 0x88, 0xFB, 0x6E, 0xF2,
-        0xFF, 0xFD, 0x4C, 0xF2, 0x81, 0x00, 0x36, 0xF4, 0xED, 0x00, 0x61, 0xF8,
-        0xD3, 0xFF, 0x61, 0xFD, 0x14, 0xFC, 0xF4, 0xFC, 0x54, 0xFC, 0x07, 0xFD,
-        0x2D, 0xFD, 0xD8, 0xFC, 0x29, 0x01, 0xEA, 0x00, 0x46, 0x01, 0x47, 0x03,
-        0x98, 0x01, 0x7D, 0x06, 0x56, 0x00, 0xAE, 0x07, 0x5B, 0xFD, 0x07, 0x07,
-        0x23, 0x14, 0xC2, 0x1E, 0x83, 0x23, 0x1F, 0x2D, 0x17, 0x21, 0xDF, 0x29,
-        0xAB, 0x1F, 0x7F, 0x26, 0xBE, 0x15, 0x36, 0x18, 0xA1, 0x0E, 0x2B, 0x0F,
-        0xE8, 0x08, 0xA9, 0x0C, 0x1A, 0x05, 0x13, 0x0D, 0x52, 0x02, 0x05, 0x0D,
-        0x58, 0xFF, 0xCD, 0x0A, 0xEC, 0xFE, 0xBE, 0x06, 0x15, 0x00, 0xD8, 0x01,
-        0x1E, 0x04, 0xBD, 0x02, 0xEE, 0x03, 0x0B, 0x03, 0xF5, 0x02, 0x71, 0x03,
-        0x07, 0xFF, 0x77, 0xFF, 0xA0, 0xFE, 0xF5, 0xFC, 0xF5, 0xFD, 0x40, 0xF9,
-        0x0E, 0xFF, 0xBD, 0xF7, 0x48, 0x02, 0x9A, 0xF8, 0x6B, 0xEB, 0xD5, 0xE0,
-        0x71, 0xDC, 0xB7, 0xD2, 0xFB, 0xDE, 0x32, 0xD6, 0x1E, 0xE0, 0x6B, 0xD9,
-        0xD6, 0xE9, 0xB9, 0xE7, 0xCE, 0xF0, 0xD5, 0xF0, 0x87, 0xF6, 0x80, 0xF3,
-        0xBE, 0xFA, 0x63, 0xF3, 0xE2, 0xFD, 0x9C, 0xF3, 0xB5, 0x00, 0x8B, 0xF5,
-        0x4C, 0x01, 0x97, 0xF9, 0x42, 0x00, 0xA3, 0xFE, 0x3A, 0xFC, 0xBF, 0xFD,
-        0x2F, 0xFC, 0x15, 0xFD, 0xD3, 0xFC, 0x74, 0xFC, 0x70, 0x00, 0x3C, 0x00,
-        0xB0, 0x00, 0xB6, 0x02, 0xD0, 0x01, 0x19, 0x07, 0xA7, 0x00, 0xE7, 0x08,
-        0x75, 0xFD, 0x1E, 0x08, 0x46, 0x14, 0x00, 0x20, 0x19, 0x23, 0xFF, 0x2D,
-        0xA7, 0x20, 0x80, 0x2A, 0xC9, 0x1F, 0x2B, 0x27, 0x39, 0x16, 0xC9, 0x18,
-        0x12, 0x0F, 0x28, 0x0F, 0x54, 0x09, 0x4A, 0x0C, 0xDC, 0x04, 0x1B, 0x0C,
-        0x25, 0x02, 0x49, 0x0C, 0xD5, 0xFF, 0xDE, 0x0A, 0x16, 0xFF, 0xBD, 0x06,
-        0xF5, 0xFF, 0x98, 0x01, 0xA7, 0x03, 0x5C, 0x02, 0xC7, 0x03, 0x4A, 0x03,
-        0x31, 0x03, 0x18, 0x04, 0x05, 0x00, 0xB6, 0x00, 0xF1, 0xFF, 0x7F, 0xFE,
-        0xAF, 0xFE, 0xE7, 0xF9, 0xF6, 0xFF, 0x2F, 0xF8, 0xFE, 0x02, 0xB8, 0xF8,
-        0x42, 0xEC, 0xE0, 0xE0, 0x61, 0xDD, 0xB0, 0xD2, 0xCB, 0xDF, 0x3D, 0xD6,
-        0x86, 0xE0, 0xA1, 0xD9, 0x2C, 0xEA, 0x1E, 0xE8, 0x55, 0xF1, 0xB8, 0xF1,
-        0x0E, 0xF7, 0x5F, 0xF4, 0x9B, 0xFB, 0x70, 0xF4, 0xE7, 0xFD, 0xB1, 0xF3,
-        0x2F, 0x00, 0x2D, 0xF5, 0xF4, 0x00, 0x53, 0xF9, 0xE7, 0xFF, 0x4A, 0xFE,
-        0x26, 0xFC, 0x6F, 0xFD, 0x51, 0xFC, 0xB5, 0xFC, 0x1A, 0xFD, 0x23, 0xFC,
-        0x27, 0x00, 0x76, 0xFF, 0x5E, 0x00, 0xD6, 0x01, 0x67, 0x01, 0x36, 0x06,
-        0x4A, 0x00, 0x18, 0x08, 0x3D, 0xFD, 0x92, 0x07, 0xCC, 0x13, 0x42, 0x1F,
-        0x73, 0x22, 0x40, 0x2D, 0x17, 0x20, 0x99, 0x29, 0x93, 0x1F, 0x57, 0x26,
-        0x12, 0x16, 0xF0, 0x17, 0x84, 0x0F, 0x17, 0x0F, 0xAE, 0x09, 0x75, 0x0C,
-        0x2E, 0x05, 0xB1, 0x0C, 0xB4, 0x02, 0x4A, 0x0D, 0xF3, 0xFF, 0x4B, 0x0B,
-        0x49, 0xFF, 0x2A, 0x07, 0xB6, 0x00, 0x84, 0x02, 0xC9, 0x04, 0x8F, 0x03,
-        0x32, 0x04, 0xD6, 0x03, 0x8E, 0x03, 0x79, 0x04, 0x4A, 0x00, 0xE8, 0x00,
-        0xFB, 0xFF, 0x62, 0xFE, 0x1B, 0xFF, 0x0A, 0xFA, 0xD9, 0xFF, 0xAC, 0xF7,
-        0xE8, 0x02, 0x27, 0xF8, 0x67, 0xEC, 0x79, 0xE0, 0xFB, 0xDD, 0xE0, 0xD2,
-        0xFF, 0xDF, 0x64, 0xD6, 0x79, 0xE0, 0xC9, 0xD9, 0xB5, 0xE9, 0xFF, 0xE7,
-        0xE7, 0xEF, 0x9F, 0xF0, 0xFE, 0xF5, 0x9A, 0xF3, 0x5C, 0xFA, 0x3F, 0xF3,
-        0x14, 0xFD, 0xEA, 0xF2, 0xF3, 0xFF, 0x12, 0xF5, 0x8B, 0x00, 0x0F, 0xF9,
-        0x0B, 0xFF, 0xB5, 0xFD, 0x5F, 0xFB, 0x24, 0xFD, 0x4B, 0xFC, 0x27, 0xFD,
-        0xB1, 0xFC, 0x4F, 0xFC, 0x35, 0x00, 0xF6, 0xFF, 0x61, 0x00, 0x5E, 0x02,
-        0xFE, 0x00, 0xB1, 0x06, 0xFA, 0xFF, 0x00, 0x09, 0xE3, 0xFC, 0x9B, 0x08,
-        0x3F, 0x13, 0x40, 0x20, 0x01, 0x22, 0x0B, 0x2E, 0x59, 0x20, 0xA7, 0x2A,
-        0xCE, 0x1F, 0x16, 0x27, 0xAA, 0x16, 0xEA, 0x18, 0x53, 0x10, 0xF6, 0x0F,
-        0x3C, 0x0A, 0xBF, 0x0C, 0xDC, 0x05, 0xF6, 0x0C, 0x31, 0x03, 0x21, 0x0D,
-        0x4C, 0x00, 0xE6, 0x0A, 0xD1, 0xFF, 0xED, 0x06, 0x12, 0x01, 0xED, 0x01,
-        0x38, 0x04, 0xE6, 0x01, 0x98, 0x03, 0x2A, 0x02, 0x4F, 0x03, 0x2F, 0x03,
-        0xBF, 0xFF, 0xC8, 0xFF, 0x62, 0xFF, 0x52, 0xFD, 0x2B, 0xFF, 0x4B, 0xF9,
-        0x82, 0x00, 0x3D, 0xF7, 0x90, 0x03, 0x90, 0xF7, 0x0E, 0xED, 0xA6, 0xDF,
-        0x95, 0xDD, 0x42, 0xD1, 0x48, 0xDF, 0xC8, 0xD4, 0xEE, 0xDF, 0x71, 0xD8,
-        0x6D, 0xE9, 0xBE, 0xE6, 0xDF, 0xEF, 0xC8, 0xEF, 0xD1, 0xF5, 0xCE, 0xF2,
-        0x30, 0xFA, 0x9E, 0xF2, 0xE7, 0xFC, 0x8F, 0xF2, 0x12, 0x00, 0x3B, 0xF5,
-        0x33, 0x00, 0x02, 0xF9, 0x2E, 0xFF, 0x73, 0xFE, 0xB2, 0xFB, 0x4B, 0xFE,
-        0xCC, 0xFB, 0xB8, 0xFD, 0x21, 0xFC, 0xC2, 0xFC, 0xDE, 0xFF, 0x20, 0x00,
-        0xB2, 0x00, 0xF1, 0x02, 0x91, 0x00, 0x9A, 0x06, 0x3C, 0xFF, 0x87, 0x08,
-        0x1E, 0xFC, 0x0B, 0x08, 0xDB, 0x12, 0x12, 0x20, 0x81, 0x22, 0x80, 0x2E,
-        0x76, 0x20, 0x53, 0x2A, 0xC6, 0x1F, 0xBD, 0x26, 0xF0, 0x15, 0x54, 0x18,
-        0xAD, 0x0F, 0xB4, 0x0F, 0xC3, 0x09, 0xEB, 0x0C, 0x79, 0x05, 0x68, 0x0D,
-        0x83, 0x02, 0x4A, 0x0D, 0x39, 0xFF, 0x65, 0x0A, 0x72, 0xFF, 0xE0, 0x06,
-        0x75, 0x00, 0x45, 0x01, 0x7C, 0x04, 0xD0, 0x01, 0x6F, 0x04, 0x32, 0x02,
-        0xE0, 0x03, 0xEB, 0x02, 0xEC, 0xFF, 0x66, 0xFF, 0xE5, 0xFE, 0x62, 0xFC,
-        0x54, 0xFF, 0xFB, 0xF8, 0x95, 0x00, 0x09, 0xF7, 0xC5, 0x03, 0xAC, 0xF7,
-        0x06, 0xED, 0xA4, 0xDF, 0x89, 0xDD, 0x8E, 0xD1, 0x85, 0xDF, 0xE1, 0xD5,
-        0xED, 0xDF, 0x23, 0xD9, 0x9A, 0xE9, 0x3F, 0xE7, 0xE0, 0xEF, 0xB6, 0xEF,
-        0xF7, 0xF5, 0x8E, 0xF2, 0x5C, 0xFA, 0xFD, 0xF1, 0x72, 0xFD, 0x35, 0xF2,
-        0x90, 0x00, 0x0D, 0xF5, 0x27, 0x00, 0x76, 0xF8, 0x2F, 0xFF, 0x1B, 0xFE,
-        0x19, 0xFB, 0x90, 0xFD, 0x52, 0xFB, 0x51, 0xFD, 0x0E, 0xFC, 0xA7, 0xFC,
-        0x06, 0x00, 0x0C, 0x00, 0x33, 0x01, 0x3B, 0x03, 0xF8, 0x00, 0xDE, 0x06,
-        0xD3, 0xFF, 0xF6, 0x08, 0xD0, 0xFC, 0x81, 0x08, 0x2A, 0x13, 0x3D, 0x20,
-        0x94, 0x22, 0x42, 0x2E, 0xA3, 0x20, 0x02, 0x2A, 0x62, 0x20, 0x14, 0x27,
-        0x97, 0x16, 0x26, 0x19, 0xC6, 0x0F, 0x63, 0x10, 0x84, 0x09, 0x8C, 0x0D,
-        0xC5, 0x04, 0x0E, 0x0E, 0xEA, 0x01, 0x19, 0x0E, 0xE6, 0xFE, 0x41, 0x0B,
-        0x62, 0xFF, 0xC8, 0x07, 0x35, 0x00, 0xF0, 0x01, 0x19, 0x04, 0x30, 0x02,
-        0x10, 0x04, 0x9D, 0x02, 0x5F, 0x03, 0x5E, 0x03, 0xC4, 0xFF, 0x54, 0x00,
-        0x3F, 0xFE, 0xA0, 0xFC, 0x64, 0xFE, 0xA7, 0xF8, 0x7E, 0xFF, 0x6A, 0xF6,
-        0xA1, 0x02, 0xE5, 0xF6, 0xCE, 0xEC, 0xB6, 0xDF, 0x53, 0xDD, 0x95, 0xD1,
-        0x53, 0xDF, 0x03, 0xD6, 0x81, 0xDF, 0xE0, 0xD8, 0x80, 0xE9, 0xD7, 0xE6,
-        0x4F, 0xF0, 0xB1, 0xEF, 0x54, 0xF6, 0x47, 0xF2, 0x11, 0xFB, 0xAE, 0xF1,
-        0xD6, 0xFD, 0x8C, 0xF1, 0x11, 0x01, 0xBE, 0xF4, 0xA2, 0x00, 0x5C, 0xF8,
-        0x02, 0x00, 0x68, 0xFE, 0x46, 0xFC, 0x4B, 0xFE, 0x3D, 0xFC, 0xBA, 0xFD,
-        0xE8, 0xFC, 0xBB, 0xFC, 0x66, 0x00, 0xA9, 0xFF, 0x06, 0x02, 0x93, 0x03,
-        0xC5, 0x01, 0xBA, 0x07, 0x9C, 0x00, 0x05, 0x0A, 0x62, 0xFD, 0x65, 0x09,
-        0x1C, 0x13, 0x75, 0x20, 0xAB, 0x22, 0x8A, 0x2E, 0x9C, 0x20, 0xDA, 0x29,
-        0x2A, 0x20, 0xBB, 0x26, 0x3B, 0x16, 0xE1, 0x18, 0xB0, 0x0F, 0x2B, 0x10,
-        0xDF, 0x09, 0xAD, 0x0D, 0x38, 0x05, 0x6D, 0x0E, 0x1F, 0x02, 0x36, 0x0E,
-        0xF3, 0xFE, 0xEE, 0x0A, 0x72, 0xFF, 0x62, 0x07, 0x42, 0x00, 0x82, 0x01,
-        0xE2, 0x03, 0x9B, 0x01, 0xAA, 0x03, 0x17, 0x02, 0xDB, 0x02, 0x34, 0x03,
-        0x02, 0xFF, 0x22, 0x00, 0xD5, 0xFD, 0x7D, 0xFC, 0x21, 0xFE, 0x3E, 0xF8,
-        0x7B, 0xFF, 0xEB, 0xF5, 0x9A, 0x02, 0x7A, 0xF6, 0xC2, 0xEC, 0x3D, 0xDF,
-        0x82, 0xDD, 0x82, 0xD1, 0xB2, 0xDF, 0x6C, 0xD6, 0xAC, 0xE0, 0xE0, 0xD9,
-        0x42, 0xEA, 0x32, 0xE7, 0xD8, 0xF0, 0xF4, 0xEF, 0x9E, 0xF6, 0x79, 0xF2,
-        0x46, 0xFB, 0xAE, 0xF1, 0x95, 0xFE, 0x47, 0xF2, 0x43, 0x01, 0x3C, 0xF5,
-        0xC3, 0x00, 0xF9, 0xF8, 0xA1, 0xFF, 0xA9, 0xFE, 0x32, 0xFC, 0xEF, 0xFE,
-        0x61, 0xFC, 0x73, 0xFE, 0x37, 0xFD, 0x36, 0xFD, 0x31, 0x01, 0x55, 0x00,
-        0xDC, 0x01, 0x62, 0x03, 0xBC, 0x01, 0xE5, 0x07, 0x6B, 0x00, 0x04, 0x0A,
-        0xC7, 0xFD, 0xB2, 0x09, 0xF2, 0x13, 0xEE, 0x20, 0x3B, 0x23, 0x62, 0x2E,
-        0x03, 0x21, 0x3F, 0x29, 0xB0, 0x1F, 0xAE, 0x25, 0x19, 0x16, 0xCF, 0x18,
-        0x09, 0x0F, 0xE4, 0x0F, 0x2B, 0x09, 0xAE, 0x0D, 0x7E, 0x04, 0xC0, 0x0E,
-        0x5C, 0x01, 0x69, 0x0E, 0xEA, 0xFE, 0xAB, 0x0B, 0x4F, 0xFF, 0xA4, 0x07,
-        0x6C, 0x00, 0xBB, 0x01, 0xD7, 0x03, 0x29, 0x01, 0xF2, 0x03, 0xBA, 0x01,
-        0x1A, 0x03, 0xD1, 0x02, 0x02, 0xFF, 0xB9, 0xFF, 0x6A, 0xFE, 0x9F, 0xFC,
-        0x66, 0xFE, 0x15, 0xF8, 0xB6, 0xFF, 0x19, 0xF6, 0x49, 0x02, 0x9F, 0xF6,
-        0xDF, 0xEB, 0x54, 0xDF, 0x44, 0xDC, 0xCE, 0xD1, 0x62, 0xDE, 0xF1, 0xD6,
-        0xAD, 0xDF, 0x3C, 0xDA, 0xAF, 0xE9, 0x22, 0xE7, 0xE2, 0xF0, 0xE8, 0xEF,
-        0xC8, 0xF6, 0xDA, 0xF1, 0x53, 0xFB, 0x96, 0xF0, 0x7C, 0xFE, 0x00, 0xF1,
-        0x54, 0x01, 0x57, 0xF4, 0x0A, 0x01, 0xAE, 0xF8, 0x11, 0x00, 0xC4, 0xFE,
-        0x1A, 0xFC, 0xD1, 0xFE, 0xD4, 0xFB, 0x2B, 0xFE, 0xD2, 0xFC, 0x0E, 0xFD,
-        0x25, 0x01, 0x51, 0x00, 0x05, 0x02, 0x98, 0x03, 0xE1, 0x01, 0xF3, 0x07,
-        0x97, 0x00, 0xB7, 0x09, 0x8C, 0xFD, 0x94, 0x08, 0x31, 0x14, 0x00, 0x20,
-        0xDA, 0x23, 0x65, 0x2D, 0xE1, 0x21, 0x4D, 0x28, 0xBA, 0x20, 0x45, 0x25,
-        0x58, 0x16, 0x39, 0x18, 0x90, 0x0F, 0x1B, 0x10, 0x95, 0x09, 0x49, 0x0E,
-        0x24, 0x05, 0xC7, 0x0F, 0x90, 0x01, 0xE2, 0x0E, 0x52, 0xFE, 0xE9, 0x0A,
-        0x95, 0xFE, 0x6B, 0x06, 0xAA, 0xFF, 0x71, 0x00, 0x2A, 0x04, 0x05, 0x01,
-        0x48, 0x04, 0x7E, 0x01, 0x54, 0x03, 0xBB, 0x02, 0xD9, 0xFE, 0x60, 0xFF,
-        0x29, 0xFE, 0x2A, 0xFC, 0x71, 0xFE, 0x10, 0xF8, 0xA3, 0xFF, 0x6C, 0xF6,
-        0xD8, 0x02, 0xDB, 0xF7, 0xF3, 0xEB, 0x3A, 0xE0, 0x77, 0xDC, 0x1E, 0xD3,
-        0x47, 0xDE, 0x1A, 0xD8, 0x87, 0xDF, 0x2B, 0xDB, 0xE0, 0xE9, 0x22, 0xE8,
-        0x6D, 0xF0, 0xF4, 0xEF, 0x80, 0xF6, 0xC5, 0xF1, 0xF7, 0xFA, 0x4D, 0xF0,
-        0x65, 0xFE, 0x3A, 0xF1, 0x4D, 0x01, 0x26, 0xF5, 0xCA, 0x00, 0xB3, 0xF9,
-        0x79, 0xFF, 0x5A, 0xFF, 0x41, 0xFB, 0xF5, 0xFE, 0x4D, 0xFB, 0x82, 0xFE,
-        0x5A, 0xFC, 0x32, 0xFD, 0xC1, 0x00, 0x7A, 0x00, 0x34, 0x01, 0xA4, 0x03,
-        0x04, 0x01, 0xC4, 0x07, 0xC7, 0xFF, 0x2F, 0x09, 0xC0, 0xFC, 0xCF, 0x07,
-        0x5F, 0x13, 0x12, 0x1F, 0xD7, 0x22, 0x25, 0x2C, 0x15, 0x21, 0x36, 0x27,
-        0xF4, 0x1F, 0x3C, 0x24, 0x01, 0x16, 0x9D, 0x17, 0x8A, 0x0F, 0xCA, 0x0F,
-        0x78, 0x09, 0x07, 0x0E, 0xAD, 0x04, 0x35, 0x0F, 0xB5, 0x01, 0xB5, 0x0E,
-        0xDB, 0xFE, 0x91, 0x0A, 0x47, 0xFF, 0xB8, 0x05, 0x7F, 0x00, 0x00, 0x00,
-        0x2D, 0x04, 0x07, 0x00, 0x7E, 0x04, 0x11, 0x01, 0x82, 0x03, 0xB4, 0x02,
-        0x6A, 0xFF, 0xBB, 0xFF, 0xE2, 0xFE, 0x54, 0xFC, 0xED, 0xFE, 0x16, 0xF8,
-        0x17, 0x00, 0xD1, 0xF6, 0xEC, 0x02, 0x34, 0xF8, 0xB9, 0xEC, 0x73, 0xE1,
-        0x18, 0xDD, 0x27, 0xD4, 0xFD, 0xDE, 0x12, 0xD9, 0x1F, 0xE0, 0xE4, 0xDB,
-        0xF2, 0xE9, 0x6D, 0xE8, 0x62, 0xF0, 0x3F, 0xF0, 0x63, 0xF6, 0xF5, 0xF1,
-        0x5A, 0xFB, 0xEA, 0xF0, 0xE3, 0xFD, 0xF3, 0xF0, 0xF8, 0x00, 0x94, 0xF5,
-        0x8A, 0x00, 0xA5, 0xFA, 0x2A, 0xFF, 0x37, 0x00, 0x82, 0xFB, 0x10, 0x00,
-        0xCD, 0xFA, 0x54, 0xFE, 0xF8, 0xFB, 0x84, 0xFC, 0x35, 0x00, 0x8E, 0xFF,
-        0xE4, 0x00, 0x42, 0x03, 0xDF, 0x00, 0x8F, 0x07, 0xB3, 0xFF, 0xAE, 0x08,
-        0xEF, 0xFC, 0x38, 0x07, 0xEF, 0x12, 0xAF, 0x1D, 0xB5, 0x22, 0x44, 0x2B,
-        0xD7, 0x20, 0x9D, 0x26, 0xB1, 0x1F, 0x08, 0x24, 0x1B, 0x16, 0xD4, 0x17,
-        0xEB, 0x0F, 0x36, 0x10, 0xF3, 0x09, 0x87, 0x0E, 0xD2, 0x04, 0x8C, 0x0F,
-        0x2A, 0x02, 0x7A, 0x0F, 0xB7, 0xFE, 0x70, 0x0A, 0x33, 0xFF, 0x46, 0x05,
-        0x1C, 0x01, 0x37, 0x00, 0x02, 0x05, 0xAD, 0x00, 0xCE, 0x05, 0xB0, 0x02,
-        0x49, 0x04, 0x76, 0x04, 0xBB, 0xFF, 0x15, 0x01, 0x3E, 0xFF, 0x65, 0xFD,
-        0x4E, 0xFF, 0xF9, 0xF8, 0x84, 0x00, 0xDC, 0xF7, 0x17, 0x03, 0x3F, 0xF9,
-        0x37, 0xED, 0xDB, 0xE2, 0x84, 0xDD, 0x47, 0xD5, 0x69, 0xDF, 0xA5, 0xD9,
-        0xC4, 0xE0, 0x22, 0xDC, 0x1C, 0xEA, 0xF3, 0xE7, 0x39, 0xF0, 0x93, 0xEF,
-        0x51, 0xF6, 0x68, 0xF1, 0xA5, 0xFB, 0x94, 0xF0, 0x94, 0xFE, 0xDC, 0xF0,
-        0x0B, 0x02, 0xF5, 0xF5, 0x93, 0x01, 0x2A, 0xFB, 0x39, 0xFF, 0xDB, 0xFF,
-        0x60, 0xFB, 0x66, 0xFF, 0xA9, 0xFA, 0x5B, 0xFD, 0x55, 0xFC, 0x85, 0xFB,
-        0xCB, 0x00, 0xDC, 0xFE, 0xCC, 0x00, 0x41, 0x02, 0x9B, 0x00, 0xCE, 0x06,
-        0x54, 0xFF, 0xEE, 0x07, 0xEC, 0xFC, 0xB4, 0x06, 0xE4, 0x12, 0x25, 0x1D,
-        0xA9, 0x22, 0xC8, 0x2A, 0xEF, 0x20, 0xAB, 0x26, 0x71, 0x1F, 0x44, 0x24,
-        0x23, 0x16, 0x7D, 0x18, 0xDF, 0x0F, 0xAD, 0x10, 0x9D, 0x09, 0xB2, 0x0E,
-        0x25, 0x04, 0x71, 0x0F, 0x38, 0x01, 0x42, 0x0F, 0xEF, 0xFD, 0x74, 0x0A,
-        0x7C, 0xFE, 0x35, 0x05, 0xD6, 0x00, 0x73, 0x00, 0xC5, 0x04, 0xBA, 0x00,
-        0x6E, 0x05, 0x98, 0x02, 0xF8, 0x03, 0x6E, 0x04, 0xBC, 0xFF, 0x2A, 0x01,
-        0xF6, 0xFF, 0xBC, 0xFD, 0x2C, 0x00, 0x0B, 0xF9, 0x71, 0x01, 0x01, 0xF8,
-        0xE6, 0x03, 0x6C, 0xF9, 0xA6, 0xED, 0xEA, 0xE2, 0xB6, 0xDD, 0x4F, 0xD5,
-        0x39, 0xDF, 0x3A, 0xD9, 0xC3, 0xE0, 0x8D, 0xDB, 0x40, 0xEA, 0x79, 0xE7,
-        0x59, 0xF0, 0x12, 0xEF, 0x99, 0xF6, 0xE4, 0xF0, 0xE1, 0xFB, 0xF5, 0xEF,
-        0x01, 0xFF, 0x3D, 0xF0, 0x49, 0x02, 0x0B, 0xF5, 0x12, 0x02, 0xBA, 0xFA,
-        0xF2, 0xFF, 0xDE, 0xFF, 0xDD, 0xFB, 0x81, 0xFF, 0x3F, 0xFB, 0xE4, 0xFD,
-        0x72, 0xFC, 0xDA, 0xFB, 0x7B, 0x00, 0x17, 0xFF, 0x03, 0x00, 0x7B, 0x02,
-        0xCD, 0xFF, 0x48, 0x07, 0x76, 0xFE, 0x4B, 0x08, 0xF2, 0xFB, 0xD4, 0x06,
-        0x8B, 0x12, 0xCA, 0x1D, 0x62, 0x22, 0x4C, 0x2B, 0xE9, 0x20, 0x87, 0x27,
-        0x10, 0x1F, 0x04, 0x25, 0x75, 0x15, 0xDE, 0x18, 0x81, 0x0F, 0x61, 0x11,
-        0x6A, 0x09, 0xB8, 0x0F, 0x57, 0x04, 0xC1, 0x10, 0xFB, 0x00, 0x2E, 0x10,
-        0xE0, 0xFD, 0x7B, 0x0B, 0xF4, 0xFD, 0x65, 0x05, 0x0C, 0x00, 0x29, 0x00,
-        0x58, 0x04, 0x9E, 0x00, 0xAF, 0x04, 0xDD, 0x01, 0x76, 0x03, 0xD4, 0x03,
-        0x7F, 0xFF, 0x9F, 0x00, 0x51, 0x00, 0x85, 0xFD, 0x76, 0x00, 0xD1, 0xF8,
-        0xCA, 0x01, 0x1E, 0xF8, 0x07, 0x04, 0x8F, 0xF9, 0x08, 0xED, 0x69, 0xE2,
-        0x3F, 0xDD, 0x0E, 0xD5, 0xA9, 0xDE, 0xBA, 0xD8, 0x95, 0xE0, 0x29, 0xDB,
-        0xF7, 0xE9, 0x2E, 0xE7, 0x0D, 0xF0, 0xA6, 0xEE, 0x0E, 0xF6, 0x03, 0xF0,
-        0x67, 0xFB, 0x26, 0xEF, 0xE0, 0xFE, 0xAB, 0xEF, 0xC3, 0x01, 0x2D, 0xF4,
-        0xA6, 0x01, 0x6D, 0xFA, 0x83, 0xFF, 0xB1, 0xFF, 0x43, 0xFB, 0x4C, 0xFF,
-        0xFE, 0xFA, 0x05, 0xFE, 0x6A, 0xFC, 0x11, 0xFC, 0x02, 0x00, 0xCA, 0xFE,
-        0x16, 0xFF, 0xAD, 0x01, 0x1A, 0xFF, 0x51, 0x06, 0x01, 0xFE, 0xF8, 0x06,
-        0x36, 0xFC, 0xDA, 0x05, 0x5F, 0x13, 0x35, 0x1D, 0x5A, 0x23, 0xFB, 0x2A,
-        0xAA, 0x21, 0x7D, 0x27, 0xD8, 0x1F, 0x7A, 0x25, 0x42, 0x16, 0x54, 0x19,
-        0xF9, 0x0F, 0xB3, 0x11, 0xD8, 0x09, 0x4C, 0x10, 0x69, 0x04, 0xF9, 0x10,
-        0x30, 0x01, 0xB9, 0x10, 0x82, 0xFE, 0x44, 0x0C, 0xF2, 0xFE, 0xFA, 0x05,
-        0xE3, 0x00, 0x56, 0x00, 0x27, 0x05, 0xA8, 0x00, 0x59, 0x05, 0xF2, 0x01,
-        0xBA, 0x03, 0xF4, 0x03, 0x4A, 0x00, 0x6C, 0x01, 0xEF, 0x00, 0x52, 0xFE,
-        0xDB, 0x00, 0xAC, 0xF9, 0xBF, 0x01, 0xE1, 0xF8, 0xA3, 0x03, 0x26, 0xFA,
-        0x55, 0xEC, 0x99, 0xE2, 0x06, 0xDC, 0x47, 0xD4, 0xCA, 0xDD, 0x86, 0xD7,
-        0x82, 0xDF, 0x39, 0xD9, 0x64, 0xE9, 0xD3, 0xE5, 0xC1, 0xEF, 0xB8, 0xED,
-        0x0A, 0xF6, 0x7D, 0xEF, 0x63, 0xFB, 0xED, 0xEE, 0xA3, 0xFE, 0x3D, 0xEF,
-        0x78, 0x01, 0xE1, 0xF3, 0xCC, 0x00, 0x1E, 0xFA, 0xF7, 0xFE, 0xF6, 0xFF,
-        0x77, 0xFA, 0x58, 0xFF, 0x71, 0xFA, 0xFC, 0xFD, 0x56, 0xFC, 0xE2, 0xFB,
-        0x1C, 0x00, 0x8E, 0xFE, 0xDE, 0xFF, 0xFF, 0x01, 0xD4, 0xFF, 0x93, 0x06,
-        0xEF, 0xFE, 0x80, 0x07, 0x75, 0xFC, 0xAE, 0x05, 0xC2, 0x13, 0x50, 0x1D,
-        0x15, 0x24, 0xCA, 0x2B, 0x33, 0x22, 0xAB, 0x28, 0x5F, 0x20, 0x00, 0x27,
-        0x7B, 0x16, 0x35, 0x1A, 0x56, 0x10, 0x47, 0x12, 0xFF, 0x09, 0x43, 0x10,
-        0xEE, 0x04, 0xF5, 0x10, 0x5B, 0x01, 0x7B, 0x10, 0x2A, 0xFE, 0xBD, 0x0B,
-        0xD6, 0xFE, 0x90, 0x05, 0x8B, 0x00, 0xA6, 0xFF, 0x21, 0x05, 0x57, 0x00,
-        0xDA, 0x04, 0x99, 0x01, 0xF8, 0x02, 0xE1, 0x03, 0xE7, 0xFE, 0x15, 0x01,
-        0x56, 0xFF, 0xD8, 0xFD, 0x8E, 0xFF, 0x75, 0xF9, 0x82, 0x00, 0x7B, 0xF8,
-        0x29, 0x03, 0x9D, 0xFA, 0xB6, 0xEB, 0xFA, 0xE2, 0x50, 0xDB, 0x89, 0xD4,
-        0x36, 0xDD, 0xA6, 0xD7, 0x33, 0xDF, 0x53, 0xD9, 0xDE, 0xE8, 0xEA, 0xE5,
-        0x1D, 0xEF, 0xE6, 0xED, 0xBD, 0xF5, 0x24, 0xF0, 0xA8, 0xFA, 0x45, 0xEF,
-        0x59, 0xFE, 0xA9, 0xEF, 0x8B, 0x01, 0x18, 0xF4, 0xC3, 0x00, 0x28, 0xFA,
-        0xF5, 0xFE, 0x1F, 0x00, 0x9B, 0xFA, 0xD9, 0xFF, 0xCB, 0xFA, 0xAB, 0xFE,
-        0xA6, 0xFC, 0x44, 0xFC, 0xE4, 0x00, 0x27, 0xFF, 0x80, 0x00, 0x2F, 0x02,
-        0x6E, 0x00, 0xA1, 0x06, 0x8F, 0xFF, 0xBA, 0x07, 0xFB, 0xFC, 0x86, 0x05,
-        0x46, 0x14, 0xE9, 0x1C, 0xB8, 0x24, 0x40, 0x2B, 0xAE, 0x22, 0x08, 0x28,
-        0xA5, 0x20, 0x74, 0x26, 0x60, 0x17, 0x48, 0x1A, 0x09, 0x11, 0x45, 0x12,
-        0x63, 0x0A, 0xFF, 0x0F, 0x9E, 0x05, 0xCF, 0x10, 0x07, 0x02, 0x94, 0x10,
-        0xAF, 0xFE, 0x24, 0x0C, 0x5D, 0xFF, 0xEB, 0x05, 0x1F, 0x01, 0xB4, 0xFF,
-        0x4A, 0x05, 0x8F, 0xFF, 0xA7, 0x05, 0x10, 0x01, 0x14, 0x04, 0xB0, 0x03,
-        0xE5, 0xFF, 0xEF, 0x00, 0x05, 0x00, 0xDE, 0xFD, 0xEC, 0xFF, 0x3F, 0xF9,
-        0xCA, 0x00, 0x18, 0xF8, 0x4F, 0x03, 0x43, 0xFA, 0x41, 0xEC, 0x33, 0xE3,
-        0xCF, 0xDB, 0x00, 0xD5, 0x1B, 0xDE, 0x7C, 0xD8, 0x43, 0xE0, 0x13, 0xDA,
-        0x3E, 0xE9, 0xED, 0xE5, 0x60, 0xEF, 0x9E, 0xED, 0x9C, 0xF5, 0x7A, 0xEF,
-        0x32, 0xFA, 0xB6, 0xEE, 0xC2, 0xFD, 0xEC, 0xEE, 0x7A, 0x01, 0xB5, 0xF3,
-        0xF8, 0x00, 0x3D, 0xFA, 0x0C, 0xFF, 0x9A, 0x00, 0xB5, 0xFA, 0xCA, 0x00,
-        0xFF, 0xF9, 0x3A, 0xFF, 0x99, 0xFB, 0xA0, 0xFC, 0xDA, 0xFF, 0x58, 0xFF,
-        0xF7, 0xFF, 0x77, 0x02, 0x13, 0x00, 0x04, 0x07, 0xEE, 0xFE, 0x08, 0x08,
-        0x6F, 0xFC, 0x00, 0x06, 0x72, 0x13, 0x14, 0x1D, 0xD0, 0x23, 0x52, 0x2B,
-        0x50, 0x21, 0xC4, 0x27, 0x24, 0x1F, 0x5E, 0x26, 0x53, 0x16, 0xA7, 0x1A,
-        0x9E, 0x10, 0x59, 0x13, 0xAA, 0x0A, 0xB2, 0x11, 0xFB, 0x05, 0x0A, 0x12,
-        0x14, 0x02, 0x76, 0x11, 0xEE, 0xFD, 0x45, 0x0C, 0x6E, 0xFE, 0xAE, 0x05,
-        0xB1, 0x00, 0x98, 0xFF, 0x75, 0x05, 0xAF, 0xFF, 0xFF, 0x05, 0x26, 0x01,
-        0x1E, 0x04, 0x6D, 0x03, 0xF1, 0xFF, 0xD1, 0x00, 0xD5, 0xFF, 0x95, 0xFD,
-        0xF3, 0xFF, 0x18, 0xF9, 0x4D, 0x01, 0xF3, 0xF7, 0xB1, 0x03, 0xB6, 0xF9,
-        0x8A, 0xEC, 0x6B, 0xE2, 0x4C, 0xDC, 0x4F, 0xD4, 0xF8, 0xDE, 0xF5, 0xD7,
-        0x0E, 0xE1, 0x3A, 0xD9, 0xFD, 0xE9, 0x29, 0xE5, 0x85, 0xEF, 0x5D, 0xEC,
-        0x8A, 0xF5, 0x23, 0xEE, 0x50, 0xFA, 0xE3, 0xED, 0x29, 0xFE, 0x53, 0xEE,
-        0x5D, 0x02, 0x69, 0xF3, 0xC7, 0x01, 0xD1, 0xF9, 0xA6, 0xFF, 0x3C, 0x00,
-        0xDF, 0xFA, 0x46, 0x00, 0xC0, 0xFA, 0x48, 0xFF, 0xB6, 0xFC, 0x1B, 0xFD,
-        0x7D, 0x00, 0x59, 0xFF, 0x7F, 0x00, 0x69, 0x02, 0x2D, 0x00, 0xA3, 0x06,
-        0xD4, 0xFE, 0xBE, 0x07, 0x66, 0xFC, 0xD6, 0x05, 0xBC, 0x13, 0x16, 0x1D,
-        0xD5, 0x23, 0x10, 0x2B, 0x41, 0x21, 0x91, 0x27, 0x3C, 0x1F, 0x9D, 0x26,
-        0xE5, 0x15, 0x6B, 0x1A, 0x1E, 0x10, 0x24, 0x13, 0xCF, 0x09, 0x44, 0x11,
-        0x35, 0x05, 0xC2, 0x11, 0xB0, 0x01, 0xAD, 0x11, 0xD0, 0xFD, 0xDC, 0x0C,
-        0x4A, 0xFE, 0x51, 0x06, 0xEF, 0xFF, 0x31, 0xFF, 0x9F, 0x04, 0xEA, 0xFE,
-        0xA3, 0x04, 0xF0, 0xFF, 0x11, 0x03, 0x84, 0x02, 0x76, 0xFF, 0x9A, 0x00,
-        0x3E, 0xFF, 0x9D, 0xFD, 0x4F, 0xFF, 0x6B, 0xF9, 0xAA, 0x00, 0x6E, 0xF8,
-        0x4D, 0x03, 0xAB, 0xFA, 0x1E, 0xEC, 0x73, 0xE3, 0x59, 0xDC, 0x8D, 0xD5,
-        0xB7, 0xDE, 0x8E, 0xD8, 0xB0, 0xE0, 0x31, 0xD9, 0x52, 0xEA, 0x73, 0xE5,
-        0x22, 0xF0, 0x9B, 0xEC, 0x59, 0xF6, 0x4E, 0xEE, 0xC2, 0xFA, 0xB4, 0xED,
-        0x1D, 0xFE, 0x0E, 0xEE, 0xC3, 0x01, 0x1E, 0xF3, 0x80, 0x01, 0x35, 0xFA,
-        0x18, 0x00, 0xF4, 0x01, 0x51, 0xFB, 0x23, 0x02, 0x0E, 0xFB, 0xC2, 0x00,
-        0x5D, 0xFC, 0xCB, 0xFD, 0x13, 0x00, 0x88, 0xFF, 0xB3, 0x00, 0x67, 0x02,
-        0x22, 0x01, 0x7F, 0x06, 0xD5, 0xFF, 0x2A, 0x07, 0x46, 0xFD, 0xC1, 0x04,
-        0x3A, 0x14, 0xF4, 0x1B, 0xB0, 0x23, 0xD3, 0x29, 0x65, 0x21, 0x1D, 0x27,
-        0x5E, 0x1F, 0x9E, 0x26, 0x8D, 0x15, 0x47, 0x1A, 0xC5, 0x0F, 0x52, 0x13,
-        0xAF, 0x09, 0xE0, 0x11, 0x18, 0x05, 0x4A, 0x12, 0xC4, 0x01, 0x8A, 0x11,
-        0x5A, 0xFE, 0x63, 0x0C, 0xB0, 0xFE, 0x24, 0x05, 0x31, 0x00, 0x75, 0xFD,
-        0xE4, 0x04, 0x7C, 0xFD, 0x0B, 0x05, 0x14, 0xFF, 0x69, 0x03, 0xEF, 0x01,
-        0x95, 0xFF, 0x49, 0x00, 0xDA, 0xFE, 0xA1, 0xFD, 0x4E, 0xFE, 0xC5, 0xF9,
-        0xA7, 0xFF, 0x4A, 0xF9, 0x2A, 0x02, 0x98, 0xFB, 0x92, 0xEB, 0x4C, 0xE4,
-        0x59, 0xDC, 0x36, 0xD6, 0xBD, 0xDE, 0xAD, 0xD8, 0xA4, 0xE0, 0xE2, 0xD8,
-        0x77, 0xEA, 0x2E, 0xE5, 0x30, 0xF0, 0x08, 0xEC, 0x60, 0xF6, 0x71, 0xED,
-        0x49, 0xFB, 0x57, 0xED, 0x64, 0xFE, 0x2E, 0xEE, 0x93, 0x01, 0x7E, 0xF3,
-        0xEC, 0x00, 0xAC, 0xFA, 0x49, 0xFF, 0x85, 0x02, 0xC3, 0xFA, 0x87, 0x02,
-        0xCC, 0xFA, 0x04, 0x01, 0xB6, 0xFC, 0x66, 0xFE, 0x6A, 0x00, 0xE0, 0xFF,
-        0x17, 0x01, 0x6A, 0x02, 0x9A, 0x01, 0xFD, 0x05, 0x77, 0x00, 0x8F, 0x06,
-        0xF6, 0xFD, 0x3C, 0x04, 0x44, 0x14, 0x87, 0x1B, 0x50, 0x23, 0xC6, 0x29,
-        0x93, 0x20, 0x4F, 0x27, 0xB3, 0x1E, 0x45, 0x27, 0xD9, 0x14, 0xC8, 0x1A,
-        0x15, 0x0F, 0xD2, 0x13, 0xDA, 0x08, 0x33, 0x12, 0x04, 0x04, 0x4F, 0x12,
-        0x75, 0x01, 0xB2, 0x11, 0x6C, 0xFE, 0x42, 0x0C, 0x7E, 0xFF, 0x3F, 0x05,
-        0x14, 0x01, 0x18, 0xFD, 0x7A, 0x05, 0x24, 0xFD, 0x64, 0x05, 0xAE, 0xFE,
-        0x50, 0x03, 0x4B, 0x01, 0xBC, 0xFF, 0xD3, 0xFF, 0x15, 0xFF, 0x1C, 0xFD,
-        0xC7, 0xFE, 0xA9, 0xF9, 0xE9, 0xFF, 0xD8, 0xF8, 0xA4, 0x02, 0x59, 0xFB,
-        0x7F, 0xEC, 0x0B, 0xE4, 0x6C, 0xDD, 0x99, 0xD5, 0x4D, 0xE0, 0x22, 0xD8,
-        0x0F, 0xE2, 0x19, 0xD8, 0xDC, 0xEB, 0xFC, 0xE4, 0x88, 0xF1, 0x15, 0xEC,
-        0xA4, 0xF7, 0xFF, 0xED, 0x23, 0xFC, 0xAC, 0xED, 0x81, 0xFE, 0x28, 0xEE,
-        0x9C, 0x01, 0xC0, 0xF3, 0x6D, 0x00, 0xAA, 0xFA, 0xEA, 0xFE, 0x00, 0x03,
-        0x88, 0xFA, 0xEF, 0x02, 0xA2, 0xFA, 0x49, 0x01, 0xD8, 0xFC, 0xAA, 0xFE,
-        0x9B, 0x00, 0x4A, 0x00, 0x2F, 0x01, 0xF7, 0x02, 0x4C, 0x01, 0x46, 0x06,
-        0x11, 0x00, 0x1C, 0x07, 0x1A, 0xFD, 0x55, 0x04, 0x64, 0x13, 0x9B, 0x1B,
-        0x77, 0x22, 0x1E, 0x2A, 0xAB, 0x1F, 0x9E, 0x27, 0xD3, 0x1D, 0xBE, 0x27,
-        0x10, 0x14, 0xE2, 0x1A, 0x72, 0x0E, 0xEA, 0x13, 0x84, 0x08, 0x05, 0x12,
-        0x51, 0x04, 0xAB, 0x12, 0xC9, 0x01, 0x28, 0x12, 0x9C, 0xFE, 0x88, 0x0C,
-        0x82, 0xFF, 0x94, 0x05, 0x05, 0x01, 0x11, 0xFD, 0x52, 0x05, 0x05, 0xFD,
-        0x1D, 0x05, 0x93, 0xFE, 0xE8, 0x02, 0x5D, 0x01, 0x0A, 0xFF, 0xE6, 0xFF,
-        0xD0, 0xFE, 0xAF, 0xFD, 0xC8, 0xFE, 0x86, 0xFA, 0x1C, 0x00, 0x7B, 0xF9,
-        0x0D, 0x03, 0x21, 0xFC, 0x8F, 0xEC, 0xA1, 0xE4, 0x8D, 0xDD, 0x22, 0xD6,
-        0x3E, 0xE0, 0x78, 0xD8, 0x42, 0xE2, 0x50, 0xD8, 0x0A, 0xEC, 0xEE, 0xE4,
-        0xD8, 0xF1, 0xF5, 0xEB, 0xCA, 0xF7, 0xF7, 0xED, 0xFE, 0xFB, 0x5F, 0xED,
-        0x9B, 0xFE, 0xDA, 0xED, 0xB6, 0x01, 0x4C, 0xF3, 0x35, 0x01, 0x3A, 0xFA,
-        0xA9, 0xFF, 0xC1, 0x02, 0x74, 0xFB, 0x21, 0x03, 0xB4, 0xFB, 0xCD, 0x01,
-        0xB2, 0xFD, 0xF8, 0xFE, 0x66, 0x01, 0x32, 0x00, 0x58, 0x01, 0xEE, 0x01,
-        0x6C, 0x01, 0x11, 0x05, 0xCE, 0xFF, 0x0E, 0x06, 0xEA, 0xFC, 0x85, 0x03,
-        0x51, 0x13, 0xE4, 0x1A, 0x29, 0x22, 0x29, 0x29, 0xB2, 0x1F, 0xF1, 0x26,
-        0xBB, 0x1D, 0x60, 0x27, 0xFA, 0x13, 0x3E, 0x1B, 0x08, 0x0E, 0x68, 0x14,
-        0x06, 0x08, 0x71, 0x12, 0xCE, 0x03, 0xE4, 0x12, 0x82, 0x01, 0x8D, 0x12,
-        0x8E, 0xFE, 0x3D, 0x0D, 0xD1, 0xFE, 0x3F, 0x06, 0x6A, 0x00, 0xB9, 0xFD,
-        0x9A, 0x04, 0x09, 0xFD, 0x66, 0x04, 0x3A, 0xFE, 0xB8, 0x02, 0x18, 0x01,
-        0x1C, 0xFF, 0x2E, 0x00, 0xE3, 0xFE, 0x95, 0xFE, 0x97, 0xFE, 0x86, 0xFB,
-        0x5C, 0x00, 0xA2, 0xFA, 0x18, 0x03, 0xF0, 0xFC, 0xD9, 0xEC, 0xA0, 0xE5,
-        0xFB, 0xDD, 0x55, 0xD7, 0x3A, 0xE0, 0x7B, 0xD9, 0x13, 0xE2, 0xD1, 0xD8,
-        0xF6, 0xEB, 0xC8, 0xE4, 0xF3, 0xF1, 0x63, 0xEB, 0xE4, 0xF7, 0x56, 0xED,
-        0x08, 0xFC, 0x20, 0xED, 0xDB, 0xFD, 0x87, 0xED, 0xAF, 0x00, 0x0E, 0xF3,
-        0x92, 0x00, 0x2F, 0xFA, 0xDB, 0xFE, 0x9E, 0x02, 0xB2, 0xFA, 0x5A, 0x03,
-        0xDB, 0xFA, 0x2A, 0x02, 0x61, 0xFC, 0x3C, 0xFF, 0xFD, 0xFF, 0xDE, 0xFF,
-        0xC0, 0x00, 0x75, 0x01, 0x20, 0x01, 0x35, 0x04, 0x7A, 0xFF, 0x09, 0x05,
-        0xF0, 0xFC, 0xF1, 0x02, 0x3D, 0x13, 0x6A, 0x1A, 0x37, 0x22, 0xD2, 0x28,
-        0x36, 0x20, 0xA6, 0x26, 0x52, 0x1E, 0x36, 0x27, 0x2F, 0x14, 0x0E, 0x1B,
-        0x2A, 0x0E, 0x9C, 0x14, 0x33, 0x08, 0xA2, 0x12, 0xFA, 0x03, 0x92, 0x12,
-        0x84, 0x02, 0x1B, 0x12, 0xBD, 0xFF, 0x43, 0x0C, 0x15, 0x00, 0x50, 0x05,
-        0x1E, 0x02, 0x22, 0xFD, 0x60, 0x06, 0xA5, 0xFC, 0x0F, 0x06, 0xA4, 0xFD,
-        0x6D, 0x04, 0x7E, 0x00, 0x8F, 0x00, 0xCB, 0xFF, 0x4F, 0xFF, 0x30, 0xFE,
-        0xE4, 0xFE, 0xC0, 0xFB, 0x4E, 0x00, 0xF2, 0xFA, 0xB6, 0x02, 0xF2, 0xFC,
-        0x79, 0xEC, 0x61, 0xE5, 0x7D, 0xDD, 0xE1, 0xD6, 0x80, 0xDF, 0x27, 0xD9,
-        0x70, 0xE1, 0xAF, 0xD8, 0xAF, 0xEB, 0x00, 0xE5, 0x94, 0xF1, 0x3D, 0xEB,
-        0xBC, 0xF7, 0x51, 0xED, 0xE6, 0xFB, 0x59, 0xED, 0x36, 0xFD, 0xC6, 0xED,
-        0xD9, 0xFF, 0xA5, 0xF3, 0x49, 0xFF, 0x74, 0xFA, 0x07, 0xFD, 0x79, 0x02,
-        0xD7, 0xF8, 0x08, 0x03, 0x57, 0xF9, 0x4F, 0x02, 0xF5, 0xFA, 0x97, 0xFF,
-        0xD8, 0xFE, 0x69, 0x00, 0xFB, 0xFF, 0xF2, 0x01, 0x42, 0x00, 0x28, 0x04,
-        0xDF, 0xFE, 0x0D, 0x05, 0x85, 0xFC, 0xFE, 0x02, 0xC6, 0x12, 0xCD, 0x1A,
-        0xD9, 0x21, 0x6D, 0x29, 0xF1, 0x1F, 0x5D, 0x27, 0x12, 0x1E, 0xE6, 0x27,
-        0x0A, 0x14, 0xA6, 0x1B, 0x1D, 0x0E, 0x61, 0x15, 0xD0, 0x07, 0x02, 0x13,
-        0xA6, 0x03, 0xF4, 0x12, 0x55, 0x02, 0x86, 0x12, 0xB1, 0xFF, 0x92, 0x0C,
-        0x4C, 0x00, 0xC1, 0x05, 0xA2, 0x02, 0xA9, 0xFD, 0xC6, 0x06, 0x0B, 0xFD,
-        0x87, 0x06, 0xEC, 0xFD, 0x3D, 0x05, 0x01, 0x01, 0x70, 0x01, 0x2F, 0x00,
-        0x6F, 0x00, 0xAE, 0xFE, 0xFA, 0xFF, 0x34, 0xFC, 0x51, 0x01, 0x1D, 0xFB,
-        0x8E, 0x03, 0x29, 0xFD, 0x45, 0xED, 0x60, 0xE5, 0x0C, 0xDE, 0xAC, 0xD6,
-        0xE1, 0xDF, 0x9E, 0xD8, 0xAE, 0xE1, 0x16, 0xD8, 0x74, 0xEB, 0x34, 0xE4,
-        0x6A, 0xF1, 0xA1, 0xEA, 0x8F, 0xF7, 0x2D, 0xED, 0xA4, 0xFB, 0x26, 0xED,
-        0x33, 0xFD, 0x94, 0xED, 0x08, 0x00, 0x7A, 0xF3, 0xBC, 0xFF, 0x53, 0xFA,
-        0x6E, 0xFD, 0x4B, 0x02, 0x4A, 0xF9, 0xE5, 0x02, 0x20, 0xF9, 0x80, 0x01,
-        0x41, 0xFA, 0x1A, 0xFE, 0x37, 0xFE, 0xFD, 0xFE, 0x64, 0xFF, 0xAF, 0x00,
-        0x29, 0x00, 0x97, 0x03, 0xD3, 0xFE, 0xF1, 0x04, 0x91, 0xFC, 0xC5, 0x02,
-        0xD5, 0x12, 0x4E, 0x1A, 0x24, 0x22, 0x08, 0x29, 0x6A, 0x20, 0x13, 0x27,
-        0x77, 0x1E, 0xAD, 0x27, 0xB4, 0x14, 0xBF, 0x1B, 0x9C, 0x0E, 0x47, 0x15,
-        0xA3, 0x08, 0xBD, 0x12, 0x8F, 0x04, 0xC1, 0x12, 0xDA, 0x02, 0x6A, 0x12,
-        0xD3, 0xFF, 0x77, 0x0C, 0x13, 0x00, 0xCC, 0x05, 0x74, 0x02, 0xD2, 0xFD,
-        0xB9, 0x06, 0x0C, 0xFD, 0x0E, 0x07, 0x77, 0xFE, 0xBA, 0x05, 0xB7, 0x01,
-        0x90, 0x01, 0xD6, 0x00, 0x5E, 0x00, 0x5B, 0xFF, 0xB6, 0xFF, 0x9F, 0xFC,
-        0x4B, 0x01, 0x6A, 0xFB, 0xAD, 0x03, 0xD9, 0xFD, 0x62, 0xED, 0x86, 0xE6,
-        0xB8, 0xDD, 0x8E, 0xD7, 0x2D, 0xDF, 0x55, 0xD9, 0x03, 0xE1, 0x58, 0xD8,
-        0xE2, 0xEA, 0xF6, 0xE3, 0x16, 0xF1, 0x5D, 0xEA, 0x2E, 0xF7, 0x1B, 0xED,
-        0x62, 0xFB, 0x52, 0xED, 0x1E, 0xFD, 0x99, 0xED, 0x37, 0x00, 0x84, 0xF3,
-        0xED, 0xFF, 0xD1, 0xF9, 0x84, 0xFD, 0xB7, 0x01, 0x40, 0xF9, 0xC0, 0x02,
-        0x0D, 0xF9, 0x95, 0x01, 0x8A, 0xFA, 0x9E, 0xFE, 0x9E, 0xFE, 0x4A, 0xFF,
-        0xA2, 0xFF, 0x76, 0x00, 0xEE, 0xFF, 0xD8, 0x02, 0x44, 0xFE, 0x37, 0x04,
-        0xFB, 0xFB, 0xD2, 0x01, 0x8D, 0x12, 0x37, 0x19, 0xAD, 0x22, 0x6F, 0x28,
-        0x93, 0x21, 0x8F, 0x26, 0xD5, 0x1F, 0xBC, 0x27, 0xB8, 0x15, 0x0D, 0x1C,
-        0x4B, 0x0F, 0xA6, 0x15, 0xD7, 0x08, 0x93, 0x12, 0x85, 0x04, 0x31, 0x12,
-        0xED, 0x02, 0x1E, 0x12, 0xD2, 0xFF, 0x44, 0x0C, 0x32, 0x00, 0x54, 0x06,
-        0x8C, 0x02, 0x69, 0xFE, 0xDF, 0x06, 0x40, 0xFD, 0x14, 0x07, 0x43, 0xFE,
-        0xD0, 0x05, 0x42, 0x01, 0xDE, 0x01, 0xCE, 0x00, 0xE0, 0x00, 0xE7, 0xFF,
-        0xA5, 0x00, 0xB6, 0xFD, 0x1A, 0x02, 0x11, 0xFC, 0x4E, 0x04, 0x7E, 0xFE,
-        0x97, 0xED, 0xFF, 0xE6, 0x66, 0xDD, 0xDA, 0xD7, 0x68, 0xDE, 0xDC, 0xD9,
-        0x32, 0xE0, 0xBF, 0xD8, 0x9C, 0xEA, 0x6C, 0xE4, 0xFB, 0xF0, 0x95, 0xEA,
-        0x90, 0xF7, 0x92, 0xED, 0xBC, 0xFB, 0xCF, 0xED, 0x43, 0xFD, 0xDD, 0xED,
-        0x75, 0x00, 0xEC, 0xF3, 0x20, 0x00, 0xEF, 0xF9, 0xC2, 0xFD, 0xF7, 0x01,
-        0x2F, 0xF9, 0x08, 0x03, 0xCD, 0xF8, 0x08, 0x02, 0xD4, 0xF9, 0xF0, 0xFE,
-        0xFF, 0xFD, 0x7E, 0xFF, 0x30, 0xFF, 0x4D, 0x00, 0x92, 0xFF, 0x6C, 0x02,
-        0x58, 0xFE, 0x28, 0x04, 0x01, 0xFC, 0x7F, 0x01, 0x9F, 0x12, 0x01, 0x19,
-        0x97, 0x22, 0x12, 0x28, 0x92, 0x21, 0xFD, 0x25, 0x8D, 0x1F, 0x00, 0x27,
-        0x0D, 0x15, 0x54, 0x1B, 0xED, 0x0E, 0x85, 0x15, 0x8B, 0x08, 0xC6, 0x12,
-        0x90, 0x04, 0xBF, 0x12, 0xF0, 0x02, 0x7B, 0x12, 0xAA, 0xFF, 0x40, 0x0C,
-        0x07, 0x00, 0x0C, 0x06, 0xA7, 0x02, 0x2D, 0xFE, 0x86, 0x07, 0x4E, 0xFD,
-        0xF3, 0x07, 0x2F, 0xFE, 0xB7, 0x06, 0x08, 0x01, 0x42, 0x02, 0x2D, 0x00,
-        0x2B, 0x01, 0xA7, 0xFF, 0xD0, 0x00, 0xBF, 0xFD, 0x04, 0x02, 0x44, 0xFC,
-        0x5A, 0x04, 0x30, 0xFF, 0x9F, 0xED, 0x7F, 0xE7, 0xB2, 0xDD, 0x54, 0xD8,
-        0xAF, 0xDE, 0x35, 0xDA, 0xDC, 0xE0, 0x26, 0xD9, 0x55, 0xEB, 0xBD, 0xE4,
-        0x54, 0xF1, 0x5D, 0xEA, 0x9F, 0xF7, 0x02, 0xED, 0xA0, 0xFB, 0x0A, 0xED,
-        0x7A, 0xFD, 0x75, 0xED, 0xA1, 0x00, 0xB6, 0xF3, 0x37, 0x00, 0xF9, 0xF9,
-        0x5E, 0xFD, 0xB6, 0x01, 0x6E, 0xF8, 0x77, 0x02, 0x48, 0xF8, 0xEA, 0x01,
-        0xDD, 0xF9, 0x62, 0xFF, 0x5E, 0xFE, 0x69, 0x00, 0x10, 0xFF, 0xC5, 0x00,
-        0x53, 0xFF, 0x97, 0x02, 0x26, 0xFE, 0x14, 0x04, 0xD8, 0xFB, 0x06, 0x01,
-        0xC0, 0x12, 0xC2, 0x18, 0x73, 0x22, 0xD8, 0x27, 0x42, 0x21, 0xDA, 0x25,
-        0x1B, 0x1F, 0x03, 0x27, 0xB1, 0x14, 0x6C, 0x1B, 0xEC, 0x0E, 0xE8, 0x15,
-        0xDA, 0x08, 0x4F, 0x13, 0xD4, 0x04, 0x4E, 0x13, 0x00, 0x03, 0xF8, 0x12,
-        0xE9, 0xFF, 0xBD, 0x0C, 0x48, 0x00, 0x40, 0x06, 0x00, 0x03, 0x55, 0xFE,
-        0xF5, 0x07, 0x96, 0xFD, 0xF6, 0x07, 0x1C, 0xFE, 0x62, 0x06, 0xC7, 0x00,
-        0x10, 0x02, 0xD7, 0xFF, 0x8E, 0x01, 0x5B, 0xFF, 0x30, 0x01, 0x36, 0xFD,
-        0x55, 0x02, 0x73, 0xFB, 0xA6, 0x04, 0xA9, 0xFE, 0xC7, 0xED, 0x04, 0xE7,
-        0x48, 0xDE, 0x1A, 0xD8, 0x7F, 0xDF, 0x15, 0xDA, 0x52, 0xE1, 0xB6, 0xD8,
-        0x91, 0xEB, 0x60, 0xE4, 0x04, 0xF1, 0xFE, 0xE9, 0xDB, 0xF6, 0xBC, 0xEC,
-        0xD2, 0xFA, 0xE0, 0xEC, 0xC8, 0xFC, 0x2F, 0xED, 0xFB, 0xFF, 0xA7, 0xF3,
-        0xE5, 0xFF, 0x82, 0xFA, 0x5F, 0xFD, 0xAF, 0x02, 0x40, 0xF8, 0x47, 0x03,
-        0x2E, 0xF8, 0x70, 0x02, 0xBC, 0xF9, 0x69, 0xFF, 0x21, 0xFE, 0x51, 0x00,
-        0xD8, 0xFE, 0x14, 0x01, 0x4D, 0xFF, 0x78, 0x03, 0x15, 0xFE, 0x45, 0x05,
-        0x82, 0xFB, 0xAE, 0x01, 0x48, 0x12, 0x07, 0x19, 0xB3, 0x21, 0x0F, 0x28,
-        0x91, 0x20, 0x29, 0x26, 0xE2, 0x1E, 0xC8, 0x27, 0x81, 0x14, 0xE8, 0x1B,
-        0x07, 0x0F, 0x05, 0x16, 0x55, 0x09, 0x23, 0x13, 0x41, 0x05, 0xF2, 0x12,
-        0x37, 0x03, 0xD8, 0x12, 0xCE, 0xFF, 0x35, 0x0C, 0xA5, 0xFF, 0x2C, 0x05,
-        0x28, 0x02, 0xDC, 0xFC, 0x68, 0x07, 0x4B, 0xFC, 0x8C, 0x07, 0x51, 0xFD,
-        0xE1, 0x05, 0x73, 0x00, 0x76, 0x01, 0xA0, 0xFF, 0xBD, 0x00, 0xDA, 0xFE,
-        0x6A, 0x00, 0x98, 0xFC, 0xA8, 0x01, 0xD4, 0xFA, 0x22, 0x04, 0xA3, 0xFE,
-        0x30, 0xED, 0x49, 0xE7, 0x97, 0xDD, 0xF8, 0xD7, 0xCF, 0xDE, 0xB2, 0xD9,
-        0xA5, 0xE0, 0xEC, 0xD7, 0x5D, 0xEB, 0xCA, 0xE3, 0x16, 0xF1, 0xF1, 0xE9,
-        0xD0, 0xF6, 0xE6, 0xEC, 0xF3, 0xFA, 0xF8, 0xEC, 0xD6, 0xFC, 0xBC, 0xEC,
-        0x2B, 0x00, 0x35, 0xF3, 0x59, 0x00, 0x45, 0xFA, 0xCB, 0xFD, 0xA5, 0x02,
-        0xA0, 0xF8, 0x7D, 0x03, 0x8C, 0xF8, 0x74, 0x02, 0x24, 0xFA, 0x2E, 0xFF,
-        0x6F, 0xFE, 0xE7, 0xFF, 0xD0, 0xFE, 0x7A, 0x00, 0x0E, 0xFF, 0xDE, 0x02,
-        0xD5, 0xFD, 0xD9, 0x04, 0x94, 0xFB, 0x2C, 0x01, 0x8D, 0x12, 0x7B, 0x18,
-        0x17, 0x22, 0xEE, 0x27, 0xBD, 0x20, 0x30, 0x26, 0xDF, 0x1E, 0x48, 0x28,
-        0x69, 0x14, 0xE3, 0x1C, 0x89, 0x0E, 0x93, 0x16, 0xDC, 0x08, 0x8C, 0x13,
-        0xA1, 0x04, 0x73, 0x13, 0xD5, 0x02, 0xC0, 0x13, 0xAB, 0xFF, 0x63, 0x0D,
-        0x72, 0xFF, 0x1E, 0x06, 0x0B, 0x02, 0x72, 0xFD, 0xF5, 0x06, 0x07, 0xFC,
-        0x5F, 0x07, 0x3E, 0xFD, 0x1D, 0x06, 0xB5, 0x00, 0xF3, 0x01, 0xF6, 0xFF,
-        0xB1, 0x01, 0x4E, 0xFF, 0x30, 0x01, 0x4B, 0xFC, 0x4E, 0x02, 0x04, 0xFA,
-        0x64, 0x04, 0x91, 0xFD, 0x88, 0xED, 0x6D, 0xE6, 0x03, 0xDE, 0x03, 0xD7,
-        0x76, 0xDF, 0xDD, 0xD8, 0x27, 0xE1, 0x92, 0xD6, 0x46, 0xEB, 0x94, 0xE1,
-        0x59, 0xF1, 0x5A, 0xE8, 0xF9, 0xF6, 0x80, 0xEB, 0x3C, 0xFB, 0xD8, 0xEB,
-        0x21, 0xFD, 0xB2, 0xEB, 0x02, 0x00, 0x02, 0xF2, 0x2E, 0x00, 0x7A, 0xF9,
-        0x90, 0xFD, 0x78, 0x02, 0xF4, 0xF8, 0x5F, 0x04, 0x51, 0xF8, 0xFB, 0x02,
-        0x93, 0xF9, 0x6D, 0xFF, 0xFE, 0xFD, 0x3E, 0x00, 0x56, 0xFE, 0xE2, 0x00,
-        0xEF, 0xFE, 0xF1, 0x03, 0xB3, 0xFD, 0x13, 0x06, 0x98, 0xFB, 0x62, 0x02,
-        0x71, 0x12, 0x93, 0x19, 0xF9, 0x21, 0x38, 0x29, 0x4A, 0x20, 0x54, 0x27,
-        0x79, 0x1E, 0xB0, 0x29, 0x5F, 0x14, 0xC4, 0x1E, 0x04, 0x0E, 0xA1, 0x17,
-        0x98, 0x08, 0x78, 0x14, 0x46, 0x04, 0x01, 0x14, 0x42, 0x02, 0xE8, 0x13,
-        0x89, 0xFF, 0xA4, 0x0D, 0xAD, 0xFF, 0x48, 0x06, 0x5E, 0x02, 0x59, 0xFD,
-        0xE5, 0x06, 0x63, 0xFB, 0x4E, 0x07, 0xA8, 0xFC, 0xBC, 0x05, 0x10, 0x00,
-        0x13, 0x01, 0x13, 0xFF, 0xF3, 0x00, 0xAE, 0xFE, 0xA4, 0x00, 0xF7, 0xFB,
-        0xE6, 0x01, 0xEA, 0xF9, 0xEC, 0x03, 0x8F, 0xFD, 0xC4, 0xEC, 0xEF, 0xE5,
-        0x6C, 0xDD, 0x42, 0xD6, 0xA4, 0xDF, 0x82, 0xD8, 0xDD, 0xE1, 0x69, 0xD6,
-        0x0D, 0xEC, 0x6D, 0xE1, 0x4E, 0xF2, 0x72, 0xE8, 0x8E, 0xF7, 0x7B, 0xEB,
-        0xB1, 0xFB, 0xBC, 0xEB, 0xFD, 0xFD, 0x0E, 0xEC, 0xAB, 0x00, 0x4E, 0xF2,
-        0x62, 0x00, 0x64, 0xF9, 0x93, 0xFD, 0x0D, 0x02, 0x01, 0xF9, 0xC0, 0x03,
-        0x06, 0xF9, 0xE4, 0x02, 0xC6, 0xFA, 0xA0, 0xFF, 0x6B, 0xFF, 0xCE, 0x00,
-        0x45, 0xFF, 0x20, 0x01, 0x5B, 0xFF, 0x9D, 0x03, 0x41, 0xFE, 0xE5, 0x05,
-        0x48, 0xFC, 0x5F, 0x02, 0x93, 0x13, 0x29, 0x1A, 0xC3, 0x22, 0xA8, 0x29,
-        0x26, 0x20, 0x0D, 0x27, 0xF8, 0x1D, 0x20, 0x29, 0xEE, 0x13, 0x47, 0x1E,
-        0xD6, 0x0D, 0x84, 0x17, 0x8C, 0x08, 0x85, 0x14, 0x74, 0x04, 0x55, 0x14,
-        0xF8, 0x01, 0xD4, 0x13, 0x0B, 0xFF, 0x5D, 0x0D, 0x4C, 0xFF, 0x73, 0x06,
-        0x2A, 0x02, 0x1A, 0xFE, 0x02, 0x07, 0xC6, 0xFC, 0xE5, 0x06, 0x96, 0xFD,
-        0x38, 0x05, 0xDC, 0x00, 0x8B, 0x00, 0x92, 0xFF, 0x64, 0x00, 0xEF, 0xFE,
-        0x41, 0x00, 0x8F, 0xFC, 0x55, 0x01, 0x2E, 0xFA, 0x9D, 0x03, 0xDF, 0xFD,
-        0x7E, 0xEC, 0x46, 0xE6, 0x57, 0xDD, 0xCE, 0xD6, 0xE6, 0xDF, 0x73, 0xD9,
-        0xD6, 0xE1, 0x0C, 0xD7, 0xE0, 0xEB, 0xD0, 0xE1, 0x16, 0xF2, 0x6C, 0xE8,
-        0x69, 0xF7, 0x47, 0xEB, 0x69, 0xFB, 0x72, 0xEB, 0xE8, 0xFD, 0x0D, 0xEC,
-        0x0E, 0x01, 0xB2, 0xF2, 0x08, 0x01, 0xA8, 0xF9, 0x35, 0xFE, 0xCC, 0x01,
-        0x21, 0xF9, 0xD6, 0x02, 0x19, 0xF9, 0xF1, 0x01, 0xB7, 0xFA, 0xCD, 0xFE,
-        0x59, 0xFF, 0x44, 0x00, 0xD9, 0xFF, 0x3C, 0x01, 0xE8, 0xFF, 0x80, 0x03,
-        0x9A, 0xFE, 0xD4, 0x05, 0x48, 0xFC, 0x66, 0x02, 0x78, 0x13, 0x46, 0x1A,
-        0xEB, 0x22, 0x0C, 0x2A, 0x82, 0x20, 0x9B, 0x27, 0x78, 0x1E, 0xEB, 0x29,
-        0xFF, 0x13, 0xD9, 0x1E, 0x77, 0x0D, 0x25, 0x18, 0x5D, 0x08, 0x9D, 0x15,
-        0x6B, 0x04, 0x48, 0x15, 0x05, 0x02, 0x6C, 0x14, 0x00, 0xFF, 0xA7, 0x0D,
-        0xE1, 0xFE, 0x77, 0x06, 0xCC, 0x01, 0x56, 0xFE, 0xF6, 0x06, 0x65, 0xFD,
-        0x00, 0x07, 0x0C, 0xFE, 0x36, 0x05, 0xD1, 0x00, 0xB9, 0x00, 0x4E, 0xFF,
-        0x16, 0x00, 0x54, 0xFE, 0x0B, 0x00, 0x3D, 0xFC, 0x77, 0x01, 0x22, 0xFA,
-        0x6D, 0x03, 0x16, 0xFD, 0x31, 0xEC, 0x2D, 0xE5, 0xAA, 0xDC, 0x6D, 0xD5,
-        0x38, 0xDF, 0x0D, 0xD8, 0x88, 0xE1, 0x04, 0xD6, 0x51, 0xEC, 0x33, 0xE1,
-        0x07, 0xF3, 0xCD, 0xE7, 0x00, 0xF8, 0xD4, 0xE9, 0x3E, 0xFC, 0x78, 0xEA,
-        0xAD, 0xFE, 0x7E, 0xEB, 0x84, 0x01, 0x29, 0xF2, 0xA8, 0x01, 0x87, 0xF9,
-        0x9E, 0xFE, 0x89, 0x01, 0x6A, 0xF9, 0x8A, 0x02, 0x8A, 0xF9, 0x2E, 0x02,
-        0x57, 0xFB, 0x99, 0xFF, 0x90, 0xFF, 0xEA, 0x00, 0x41, 0x00, 0xCC, 0x01,
-        0x7E, 0x00, 0xE3, 0x03, 0x13, 0xFF, 0xE1, 0x05, 0x57, 0xFD, 0x34, 0x03,
-        0x47, 0x14, 0xEA, 0x1A, 0x9B, 0x23, 0x60, 0x2A, 0x1B, 0x21, 0xE7, 0x27,
-        0xB1, 0x1E, 0xF3, 0x29, 0xF1, 0x13, 0xF9, 0x1E, 0xEE, 0x0C, 0x70, 0x18,
-        0xAE, 0x07, 0x63, 0x16, 0x19, 0x03, 0x91, 0x15, 0xD2, 0x00, 0x99, 0x14,
-        0x4E, 0xFE, 0x59, 0x0E, 0x37, 0xFE, 0xF2, 0x06, 0x6D, 0x01, 0x2A, 0xFF,
-        0x76, 0x06, 0xFE, 0xFD, 0x2D, 0x06, 0x1C, 0xFE, 0x6E, 0x04, 0xBF, 0x00,
-        0x41, 0x00, 0x7C, 0xFF, 0x52, 0xFF, 0x85, 0xFE, 0xEB, 0xFE, 0x6A, 0xFC,
-        0x99, 0x00, 0xB7, 0xFA, 0x7B, 0x02, 0x54, 0xFD, 0xF9, 0xEB, 0xDA, 0xE5,
-        0x96, 0xDC, 0x4E, 0xD6, 0xA6, 0xDE, 0x27, 0xD8, 0xEF, 0xE0, 0xF8, 0xD5,
-        0x8C, 0xEB, 0xCB, 0xE0, 0xDC, 0xF2, 0x9F, 0xE7, 0x3C, 0xF8, 0xE3, 0xE9,
-        0x9E, 0xFC, 0xAC, 0xEA, 0x7E, 0xFE, 0x7B, 0xEB, 0xCC, 0x00, 0x7E, 0xF1,
-        0xF7, 0x00, 0xFC, 0xF8, 0xCA, 0xFD, 0xAB, 0x00, 0x01, 0xF9, 0xF9, 0x01,
-        0x48, 0xF9, 0xED, 0x01, 0xF0, 0xFA, 0x23, 0xFF, 0x4D, 0xFF, 0x92, 0x00,
-        0x7A, 0x00, 0xA9, 0x01, 0xE8, 0x00, 0x97, 0x03, 0x0F, 0xFF, 0x14, 0x05,
-        0x47, 0xFD, 0x90, 0x02, 0xD0, 0x13, 0x23, 0x1A, 0x87, 0x23, 0xD5, 0x29,
-        0xB6, 0x21, 0x50, 0x28, 0x1C, 0x1F, 0x25, 0x2A, 0x66, 0x14, 0x22, 0x1F,
-        0xE7, 0x0C, 0x23, 0x18, 0xAF, 0x07, 0xD2, 0x15, 0xDB, 0x03, 0x52, 0x15,
-        0x04, 0x02, 0x57, 0x14, 0xB1, 0xFF, 0x4A, 0x0E, 0x47, 0xFF, 0xB9, 0x06,
-        0x45, 0x02, 0x24, 0xFF, 0xC5, 0x06, 0xED, 0xFD, 0x73, 0x06, 0x0D, 0xFE,
-        0xCF, 0x04, 0x12, 0x01, 0x2C, 0x00, 0x6E, 0xFF, 0x37, 0xFF, 0x96, 0xFE,
-        0xE1, 0xFE, 0xDE, 0xFC, 0xC8, 0x00, 0x4B, 0xFB, 0x64, 0x02, 0x90, 0xFD,
-        0xA6, 0xEB, 0xB4, 0xE5, 0xD2, 0xDB, 0x09, 0xD6, 0xB6, 0xDD, 0x9D, 0xD7,
-        0xB2, 0xE0, 0x2B, 0xD6, 0x4F, 0xEB, 0x04, 0xE1, 0xC4, 0xF2, 0xCF, 0xE7,
-        0xF8, 0xF7, 0x18, 0xEA, 0xAB, 0xFB, 0x72, 0xEA, 0xF5, 0xFD, 0xED, 0xEB,
-        0x73, 0x00, 0x06, 0xF2, 0xCA, 0x00, 0x4E, 0xF9, 0xEC, 0xFD, 0xB6, 0x00,
-        0x76, 0xF9, 0xB6, 0x01, 0xCB, 0xF9, 0x8C, 0x01, 0x7A, 0xFB, 0x91, 0xFE,
-        0x2F, 0x00, 0x74, 0x00, 0xDE, 0x00, 0x31, 0x01, 0x35, 0x01, 0x25, 0x03,
-        0x6F, 0xFF, 0x12, 0x05, 0xB6, 0xFD, 0xE6, 0x02, 0x9B, 0x14, 0xE3, 0x1A,
-        0x56, 0x24, 0x33, 0x2A, 0x63, 0x22, 0x52, 0x28, 0x6C, 0x1F, 0xA4, 0x29,
-        0x11, 0x15, 0xFF, 0x1E, 0x7A, 0x0D, 0x42, 0x18, 0xE0, 0x07, 0xC4, 0x15,
-        0x13, 0x04, 0x72, 0x15, 0x45, 0x01, 0x8E, 0x13, 0xF4, 0xFE, 0x9A, 0x0D,
-        0xEC, 0xFE, 0xA0, 0x06, 0xBC, 0x01, 0x06, 0xFF, 0x68, 0x06, 0x0E, 0xFE,
-        0x30, 0x06, 0x12, 0xFE, 0xA9, 0x04, 0x08, 0x01, 0x04, 0x00, 0x25, 0xFF,
-        0x6D, 0xFF, 0x8D, 0xFE, 0xE6, 0xFE, 0x95, 0xFC, 0x97, 0x00, 0xB9, 0xFA,
-        0x96, 0x02, 0x3C, 0xFD, 0x70, 0xEB, 0x23, 0xE5, 0xCD, 0xDB, 0x0A, 0xD6,
-        0xB7, 0xDD, 0xEE, 0xD7, 0x99, 0xE0, 0x78, 0xD6, 0x2C, 0xEB, 0x22, 0xE1,
-        0x1E, 0xF3, 0x0E, 0xE8, 0x13, 0xF9, 0xAD, 0xEA, 0xB1, 0xFC, 0xC3, 0xEA,
-        0x9C, 0xFF, 0xDB, 0xEC, 0xBC, 0x01, 0xA2, 0xF2, 0x87, 0x01, 0x8E, 0xF9,
-        0x09, 0xFF, 0x77, 0x01, 0x12, 0xFA, 0x48, 0x02, 0x1B, 0xFA, 0x18, 0x02,
-        0x73, 0xFB, 0x06, 0xFF, 0x07, 0x00, 0xC3, 0x00, 0xCE, 0x00, 0x67, 0x01,
-        0x69, 0x01, 0x5D, 0x03, 0xB2, 0xFF, 0x12, 0x05, 0x8B, 0xFD, 0x6D, 0x02,
-        0xF5, 0x14, 0xBE, 0x1A, 0x9C, 0x24, 0xBD, 0x29, 0xA8, 0x22, 0xB2, 0x27,
-        0xD2, 0x1F, 0x2E, 0x29, 0x08, 0x15, 0x46, 0x1E, 0x30, 0x0D, 0x75, 0x17,
-        0x8E, 0x07, 0x3D, 0x15, 0x3B, 0x04, 0x6C, 0x15, 0x47, 0x01, 0x49, 0x13,
-        0xF7, 0xFE, 0x54, 0x0D, 0x18, 0xFF, 0x63, 0x06, 0x42, 0x01, 0x32, 0xFE,
-        0x71, 0x06, 0xB5, 0xFD, 0xA5, 0x06, 0x1A, 0xFE, 0x5A, 0x05, 0x3D, 0x01,
-        0xD5, 0x00, 0xA9, 0xFF, 0xCC, 0xFF, 0xE5, 0xFE, 0x15, 0xFF, 0xF8, 0xFC,
-        0x9E, 0x00, 0x5A, 0xFB, 0x9C, 0x02, 0xEB, 0xFD, 0x01, 0xEB, 0x8C, 0xE5,
-        0x48, 0xDB, 0xB3, 0xD6, 0x5C, 0xDD, 0xDE, 0xD8, 0xF9, 0xDF, 0x39, 0xD7,
-        0xDD, 0xEA, 0xF9, 0xE1, 0x5A, 0xF2, 0x50, 0xE8, 0xE7, 0xF7, 0x29, 0xEA,
-        0x7C, 0xFB, 0x0A, 0xEA, 0x85, 0xFE, 0x4C, 0xEC, 0x13, 0x01, 0x65, 0xF2,
-        0xC5, 0x00, 0x5A, 0xF9, 0xB0, 0xFE, 0x97, 0x01, 0x83, 0xF9, 0x2C, 0x02,
-        0x40, 0xF9, 0xE5, 0x01, 0xC6, 0xFA, 0x09, 0xFF, 0x22, 0xFF, 0x99, 0x00,
-        0x84, 0x00, 0x93, 0x01, 0x4C, 0x01, 0x9D, 0x03, 0xEF, 0xFF, 0x26, 0x05,
-        0x03, 0xFE, 0xA4, 0x02, 0x48, 0x15, 0xAD, 0x1A, 0x0C, 0x25, 0x66, 0x29,
-        0xF9, 0x22, 0x3F, 0x27, 0xB2, 0x20, 0x37, 0x29, 0x13, 0x16, 0xB1, 0x1E,
-        0x91, 0x0E, 0x6D, 0x18, 0xCE, 0x08, 0x6F, 0x16, 0xCE, 0x04, 0x35, 0x16,
-        0x06, 0x02, 0x1E, 0x14, 0x81, 0xFF, 0x0B, 0x0E, 0x07, 0x00, 0x29, 0x07,
-        0x00, 0x02, 0xE7, 0xFE, 0xB9, 0x06, 0xF4, 0xFD, 0xFF, 0x06, 0x30, 0xFE,
-        0x6C, 0x05, 0xFD, 0x00, 0x41, 0x01, 0x7A, 0xFF, 0xBE, 0xFF, 0x41, 0xFE,
-        0xC2, 0xFE, 0xF4, 0xFB, 0x14, 0x00, 0x7D, 0xFA, 0xE3, 0x01, 0xE5, 0xFC,
-        0xEF, 0xEA, 0x39, 0xE5, 0xEC, 0xDA, 0x76, 0xD6, 0xD9, 0xDC, 0x91, 0xD8,
-        0xE6, 0xDE, 0x9D, 0xD6, 0x65, 0xE9, 0x36, 0xE1, 0x37, 0xF1, 0xE3, 0xE7,
-        0x19, 0xF7, 0xF9, 0xE9, 0x32, 0xFB, 0x3A, 0xEA, 0x91, 0xFD, 0xDC, 0xEB,
-        0xFC, 0xFF, 0xDC, 0xF1, 0x7B, 0xFF, 0xC7, 0xF8, 0x91, 0xFD, 0xFD, 0x00,
-        0x63, 0xF9, 0x3B, 0x02, 0xE8, 0xF8, 0xB5, 0x01, 0x8A, 0xFA, 0xDB, 0xFE,
-        0xB2, 0xFE, 0x73, 0x00, 0x3B, 0x00, 0xEC, 0x01, 0x52, 0x01, 0x75, 0x04,
-        0xD3, 0xFF, 0xCB, 0x05, 0x28, 0xFE, 0x85, 0x03, 0xDC, 0x14, 0x0D, 0x1B,
-        0x14, 0x25, 0xE3, 0x29, 0x29, 0x23, 0xD6, 0x27, 0xFD, 0x20, 0x73, 0x29,
-        0xAE, 0x16, 0xC3, 0x1E, 0xBD, 0x0E, 0xDC, 0x17, 0x1B, 0x09, 0xE1, 0x15,
-        0xEB, 0x04, 0xC6, 0x15, 0x94, 0x02, 0x3A, 0x14, 0x15, 0x00, 0x40, 0x0E,
-        0xAC, 0x00, 0x5A, 0x07, 0xD5, 0x02, 0x8D, 0xFF, 0xDA, 0x06, 0x54, 0xFE,
-        0x77, 0x07, 0x15, 0xFF, 0x99, 0x05, 0xBE, 0x01, 0x47, 0x01, 0xBF, 0xFF,
-        0x08, 0x00, 0x14, 0xFE, 0x08, 0xFF, 0x43, 0xFB, 0xB5, 0x00, 0xD4, 0xF9,
-        0x2B, 0x02, 0xD2, 0xFB, 0x58, 0xEB, 0x26, 0xE4, 0xF6, 0xDA, 0x48, 0xD5,
-        0xCD, 0xDC, 0x6F, 0xD7, 0xFE, 0xDE, 0x20, 0xD6, 0xDA, 0xE8, 0xDC, 0xE0,
-        0x92, 0xF0, 0xDB, 0xE7, 0x09, 0xF6, 0xF2, 0xE9, 0x8B, 0xFA, 0x3B, 0xEA,
-        0x40, 0xFD, 0xF7, 0xEB, 0xAB, 0xFF, 0xCE, 0xF1, 0xE8, 0xFE, 0x7C, 0xF8,
-        0x70, 0xFC, 0xE6, 0xFF, 0x9C, 0xF8, 0x28, 0x01, 0x61, 0xF8, 0xA2, 0x00,
-        0xB5, 0xFA, 0x40, 0xFE, 0x1B, 0xFF, 0x6B, 0x00, 0xDB, 0xFF, 0xEE, 0x01,
-        0x9F, 0x00, 0xD1, 0x04, 0xD3, 0xFE, 0x45, 0x06, 0x70, 0xFD, 0x62, 0x04,
-        0x88, 0x14, 0x32, 0x1C, 0x01, 0x25, 0xFC, 0x2A, 0x59, 0x23, 0xE4, 0x28,
-        0x70, 0x21, 0x34, 0x2A, 0xD7, 0x17, 0x8F, 0x1F, 0x4D, 0x10, 0x6D, 0x18,
-        0x86, 0x0A, 0x13, 0x16, 0x8D, 0x05, 0xA0, 0x15, 0x6F, 0x02, 0xF1, 0x13,
-        0xFE, 0xFF, 0x5A, 0x0E, 0xB6, 0x00, 0xCC, 0x07, 0x28, 0x03, 0x52, 0x00,
-        0xE8, 0x06, 0xDD, 0xFE, 0xD0, 0x06, 0xEB, 0xFE, 0x76, 0x04, 0x29, 0x01,
-        0x3A, 0x00, 0xF4, 0xFE, 0xB6, 0xFF, 0x67, 0xFD, 0x16, 0xFF, 0x75, 0xFA,
-        0xE3, 0x00, 0x1B, 0xF9, 0x46, 0x02, 0x32, 0xFB, 0xE5, 0xEA, 0x7A, 0xE3,
-        0x64, 0xDA, 0xD8, 0xD4, 0xE2, 0xDB, 0xD9, 0xD6, 0xB9, 0xDD, 0x5B, 0xD5,
-        0x86, 0xE7, 0x0E, 0xE0, 0x25, 0xEF, 0x2F, 0xE7, 0x19, 0xF5, 0x95, 0xE9,
-        0x36, 0xFA, 0xE3, 0xE9, 0x53, 0xFD, 0x64, 0xEB, 0xF9, 0xFF, 0x21, 0xF1,
-        0x66, 0xFF, 0x01, 0xF8, 0x1F, 0xFD, 0xCB, 0xFF, 0x24, 0xF9, 0x59, 0x01,
-        0x2E, 0xF9, 0x56, 0x01, 0x5B, 0xFB, 0xFB, 0xFE, 0x71, 0xFF, 0x19, 0x01,
-        0x1C, 0x00, 0xDA, 0x02, 0x64, 0x00, 0xA8, 0x05, 0x8C, 0xFE, 0xE1, 0x06,
-        0x04, 0xFD, 0x90, 0x04, 0x78, 0x14, 0x2E, 0x1C, 0x20, 0x25, 0xCC, 0x2A,
-        0x87, 0x23, 0xA8, 0x28, 0xB5, 0x21, 0x2A, 0x2A, 0x6B, 0x17, 0x26, 0x1F,
-        0x01, 0x10, 0x23, 0x18, 0x20, 0x0A, 0xEB, 0x15, 0x19, 0x05, 0xBF, 0x15,
-        0x1F, 0x02, 0x71, 0x14, 0x31, 0xFF, 0x58, 0x0E, 0xC6, 0xFF, 0x60, 0x07,
-        0x1C, 0x02, 0x84, 0xFF, 0x75, 0x06, 0x2D, 0xFE, 0xA1, 0x06, 0x46, 0xFE,
-        0x6D, 0x04, 0x8A, 0x00, 0x71, 0x00, 0x61, 0xFE, 0xA3, 0xFF, 0x53, 0xFC,
-        0xCB, 0xFF, 0x9E, 0xF9, 0xAA, 0x01, 0x5A, 0xF8, 0x45, 0x03, 0xAF, 0xFA,
-        0xF7, 0xEB, 0x49, 0xE3, 0x23, 0xDB, 0xCD, 0xD4, 0xEF, 0xDC, 0x64, 0xD7,
-        0xAB, 0xDE, 0x1A, 0xD6, 0x0D, 0xE9, 0x4F, 0xE1, 0x2D, 0xF0, 0x21, 0xE8,
-        0xFC, 0xF5, 0x3E, 0xEA, 0x42, 0xFB, 0x51, 0xEA, 0xFB, 0xFD, 0x5A, 0xEB,
-        0x0C, 0x01, 0x6B, 0xF1, 0x0F, 0x00, 0x2A, 0xF8, 0x7E, 0xFD, 0xDB, 0xFF,
-        0xF7, 0xF8, 0x3E, 0x01, 0xB5, 0xF8, 0x4A, 0x01, 0x08, 0xFB, 0x36, 0xFF,
-        0xD8, 0xFE, 0x45, 0x01, 0xB2, 0xFF, 0x59, 0x03, 0x79, 0xFF, 0xFA, 0x05,
-        0xEF, 0xFD, 0x61, 0x07, 0x67, 0xFC, 0x0A, 0x05, 0x71, 0x13, 0x42, 0x1C,
-        0x59, 0x24, 0xBC, 0x2A, 0x42, 0x22, 0x06, 0x28, 0xB1, 0x20, 0x6F, 0x29,
-        0x64, 0x16, 0x66, 0x1E, 0x48, 0x0F, 0x85, 0x17, 0x49, 0x09, 0x3A, 0x15,
-        0xE8, 0x03, 0x13, 0x15, 0xB4, 0x01, 0x62, 0x14, 0xF9, 0xFE, 0x75, 0x0E,
-        0x6D, 0x00, 0xE6, 0x07, 0xFD, 0x02, 0x29, 0x00, 0x3D, 0x07, 0x80, 0xFE,
-        0x51, 0x07, 0x45, 0xFE, 0xDC, 0x04, 0x60, 0x00, 0x2D, 0x01, 0x6C, 0xFE,
-        0x54, 0x00, 0x5D, 0xFC, 0x7A, 0x00, 0x9F, 0xF9, 0xCB, 0x01, 0x1C, 0xF8,
-        0x68, 0x03, 0x8D, 0xFA, 0x98, 0xEC, 0x73, 0xE3, 0xA5, 0xDB, 0x02, 0xD5,
-        0xD5, 0xDD, 0xB9, 0xD7, 0x3D, 0xDF, 0x50, 0xD6, 0x70, 0xE9, 0x5C, 0xE1,
-        0xB3, 0xF0, 0x85, 0xE8, 0xDB, 0xF6, 0x09, 0xEB, 0x1A, 0xFC, 0xF9, 0xEA,
-        0x20, 0xFE, 0x80, 0xEB, 0xB0, 0x00, 0x6F, 0xF1, 0x39, 0xFF, 0x32, 0xF8,
-        0xDB, 0xFC, 0x3E, 0x00, 0xD1, 0xF8, 0x21, 0x02, 0xC9, 0xF8, 0x76, 0x02,
-        0x3E, 0xFB, 0x52, 0x00, 0xF1, 0xFE, 0x57, 0x02, 0xAC, 0xFF, 0x76, 0x04,
-        0x72, 0xFF, 0x2E, 0x07, 0x2A, 0xFE, 0x9E, 0x08, 0x6F, 0xFC, 0x06, 0x06,
-        0x59, 0x13, 0x33, 0x1D, 0x45, 0x24, 0x9A, 0x2B, 0xF3, 0x21, 0xDC, 0x28,
-        0x59, 0x20, 0x0F, 0x2A, 0x19, 0x16, 0xD8, 0x1E, 0xD3, 0x0E, 0xB5, 0x17,
-        0xCE, 0x08, 0x29, 0x15, 0xB1, 0x03, 0x90, 0x15, 0x80, 0x01, 0xD0, 0x14,
-        0xE8, 0xFE, 0xB9, 0x0E, 0x71, 0x00, 0xC4, 0x07, 0xC5, 0x02, 0xA6, 0xFF,
-        0x12, 0x07, 0xF5, 0xFD, 0xF6, 0x06, 0x85, 0xFD, 0x51, 0x04, 0xA4, 0xFF,
-        0x79, 0x00, 0x76, 0xFD, 0x16, 0x00, 0x6D, 0xFB, 0xBF, 0x00, 0x05, 0xF9,
-        0x4D, 0x02, 0xAA, 0xF7, 0x3D, 0x04, 0x5F, 0xFA, 0x27, 0xED, 0xF4, 0xE2,
-        0x6E, 0xDC, 0x9D, 0xD4, 0xF3, 0xDE, 0x6E, 0xD7, 0xC9, 0xE0, 0x68, 0xD6,
-        0x33, 0xEB, 0xB1, 0xE1, 0x34, 0xF2, 0x90, 0xE8, 0x54, 0xF8, 0x23, 0xEB,
-        0x8E, 0xFD, 0xA3, 0xEA, 0x21, 0x00, 0x85, 0xEB, 0xA6, 0x02, 0x9E, 0xF1,
-        0xD5, 0x00, 0x62, 0xF8, 0x4B, 0xFE, 0x79, 0x00, 0x82, 0xF9, 0xE9, 0x01,
-        0xD3, 0xF9, 0xCA, 0x02, 0x98, 0xFC, 0xBA, 0x00, 0x65, 0x00, 0x0B, 0x03,
-        0x87, 0x00, 0xFD, 0x04, 0x64, 0xFF, 0x27, 0x07, 0xCD, 0xFD, 0x92, 0x08,
-        0x90, 0xFB, 0xBE, 0x05, 0xE5, 0x12, 0x61, 0x1D, 0x68, 0x23, 0xA2, 0x2B,
-        0xD0, 0x20, 0xEA, 0x28, 0xF8, 0x1E, 0x10, 0x2A, 0x57, 0x14, 0xCB, 0x1E,
-        0x82, 0x0D, 0x2D, 0x18, 0x1F, 0x07, 0x4B, 0x15, 0xFD, 0x01, 0xF9, 0x15,
-        0x89, 0xFF, 0x28, 0x15, 0x6C, 0xFD, 0x33, 0x0F, 0x91, 0xFF, 0x85, 0x08,
-        0x22, 0x02, 0x32, 0x00, 0x60, 0x07, 0xD0, 0xFE, 0xEA, 0x06, 0xBA, 0xFD,
-        0x4A, 0x04, 0x12, 0x00, 0x5F, 0x00, 0xE2, 0xFD, 0xE3, 0xFF, 0xD1, 0xFB,
-        0xEB, 0x00, 0xB5, 0xF9, 0x5D, 0x02, 0x27, 0xF8, 0xE4, 0x04, 0x2D, 0xFB,
-        0x90, 0xED, 0x78, 0xE3, 0x1B, 0xDD, 0x09, 0xD5, 0x9A, 0xDF, 0x70, 0xD7,
-        0x53, 0xE1, 0xF0, 0xD5, 0x50, 0xEC, 0x39, 0xE1, 0x15, 0xF3, 0xC7, 0xE7,
-        0x91, 0xF9, 0xD6, 0xEA, 0x50, 0xFE, 0xEC, 0xE9, 0x6E, 0x00, 0x90, 0xEA,
-        0x74, 0x02, 0xA9, 0xF0, 0x5B, 0x00, 0x77, 0xF7, 0x27, 0xFE, 0x2D, 0x00,
-        0x9D, 0xF8, 0x84, 0x01, 0xAD, 0xF8, 0x51, 0x02, 0x00, 0xFB, 0xA2, 0xFF,
-        0x1D, 0xFF, 0xF6, 0x01, 0x3E, 0x00, 0x72, 0x04, 0x5F, 0xFF, 0xB1, 0x06,
-        0xF9, 0xFD, 0x37, 0x08, 0x1D, 0xFB, 0xE7, 0x04, 0x6D, 0x12, 0x69, 0x1C,
-        0x2D, 0x23, 0xE2, 0x2A, 0x0A, 0x21, 0xA5, 0x28, 0x79, 0x1F, 0x18, 0x2A,
-        0x28, 0x14, 0xBB, 0x1E, 0x72, 0x0D, 0x51, 0x18, 0x12, 0x07, 0x5D, 0x15,
-        0x8D, 0x02, 0x89, 0x16, 0x77, 0x00, 0xC7, 0x15, 0x43, 0xFE, 0x7C, 0x0F,
-        0x34, 0x00, 0x96, 0x08, 0x1B, 0x02, 0xC8, 0xFF, 0xE0, 0x07, 0x98, 0xFE,
-        0x27, 0x08, 0x2B, 0xFE, 0xCF, 0x05, 0x01, 0x01, 0x42, 0x01, 0x7C, 0xFE,
-        0x9E, 0xFF, 0xCD, 0xFB, 0x76, 0x00, 0x93, 0xF9, 0xF7, 0x01, 0x02, 0xF8,
-        0x18, 0x05, 0x33, 0xFB, 0xE6, 0xED, 0x8B, 0xE3, 0x0E, 0xDD, 0xD9, 0xD4,
-        0xFB, 0xDE, 0xF1, 0xD6, 0xB0, 0xE0, 0xBD, 0xD5, 0x23, 0xEC, 0x22, 0xE1,
-        0xCB, 0xF2, 0x89, 0xE7, 0x14, 0xF9, 0x89, 0xEA, 0xB2, 0xFD, 0x9A, 0xE9,
-        0xD6, 0xFF, 0xAB, 0xEA, 0xFE, 0x01, 0xE8, 0xF0, 0xFD, 0xFF, 0x9D, 0xF7,
-        0x1C, 0xFE, 0x1A, 0x00, 0x4F, 0xF8, 0x3D, 0x01, 0x04, 0xF8, 0xB2, 0x01,
-        0x6D, 0xFA, 0xF7, 0xFE, 0x02, 0xFF, 0x97, 0x01, 0x76, 0x00, 0x25, 0x04,
-        0x8A, 0xFF, 0x79, 0x06, 0xD4, 0xFD, 0x2D, 0x08, 0xB7, 0xFA, 0x54, 0x05,
-        0xC9, 0x11, 0x24, 0x1D, 0xAD, 0x22, 0xC2, 0x2B, 0xD1, 0x20, 0x8E, 0x29,
-        0x09, 0x1F, 0x67, 0x2A, 0xA7, 0x13, 0xF9, 0x1E, 0xDD, 0x0C, 0x59, 0x18,
-        0x78, 0x06, 0x25, 0x15, 0xB6, 0x01, 0xE8, 0x15, 0xA8, 0xFF, 0xF4, 0x14,
-        0xBD, 0xFD, 0x15, 0x0F, 0xB7, 0xFF, 0xB1, 0x08, 0xAB, 0x01, 0x87, 0x00,
-        0x44, 0x07, 0x3E, 0xFF, 0xA0, 0x07, 0xB7, 0xFE, 0x5E, 0x05, 0x74, 0x01,
-        0x38, 0x01, 0x15, 0xFF, 0x22, 0x00, 0xC2, 0xFC, 0x03, 0x01, 0x3C, 0xFA,
-        0xBC, 0x02, 0x66, 0xF8, 0xAC, 0x05, 0xEE, 0xFA, 0x84, 0xEE, 0x18, 0xE3,
-        0x88, 0xDD, 0x74, 0xD4, 0x57, 0xDF, 0xB9, 0xD6, 0x28, 0xE1, 0xEE, 0xD5,
-        0x6E, 0xEC, 0x1A, 0xE1, 0x88, 0xF3, 0x02, 0xE8, 0x02, 0xFA, 0x25, 0xEB,
-        0xA1, 0xFE, 0x30, 0xEA, 0x86, 0x00, 0xF7, 0xEA, 0x6F, 0x02, 0xB9, 0xF0,
-        0xAA, 0x00, 0x47, 0xF7, 0xA9, 0xFE, 0x63, 0xFF, 0x1D, 0xF9, 0xF0, 0x00,
-        0x6A, 0xF8, 0x4D, 0x01, 0x57, 0xFA, 0x7F, 0xFE, 0x37, 0xFE, 0xCA, 0x00,
-        0xFE, 0xFE, 0xED, 0x02, 0x58, 0xFE, 0xB1, 0x05, 0x9B, 0xFC, 0x81, 0x07,
-        0x0E, 0xFA, 0x22, 0x05, 0x4E, 0x11, 0xD0, 0x1C, 0x72, 0x22, 0x7E, 0x2B,
-        0xA5, 0x20, 0xF7, 0x28, 0xCC, 0x1E, 0xAD, 0x29, 0xE0, 0x13, 0xC9, 0x1E,
-        0xB3, 0x0C, 0xB8, 0x17, 0x68, 0x06, 0xE7, 0x14, 0xCD, 0x01, 0xF5, 0x15,
-        0xBF, 0xFF, 0x23, 0x15, 0x9C, 0xFD, 0x2D, 0x0F, 0x2D, 0xFF, 0x84, 0x08,
-        0x57, 0x01, 0x84, 0x00, 0xC7, 0x06, 0xE2, 0xFE, 0xA3, 0x07, 0xC0, 0xFE,
-        0x9A, 0x05, 0x47, 0x01, 0xB2, 0x01, 0xD3, 0xFE, 0x36, 0x01, 0xD2, 0xFC,
-        0xDF, 0x01, 0x0B, 0xFA, 0x8B, 0x03, 0x42, 0xF8, 0xC0, 0x05, 0x7E, 0xFA,
-        0x70, 0xEE, 0xDF, 0xE2, 0x5C, 0xDD, 0x29, 0xD4, 0x53, 0xDF, 0xF7, 0xD6,
-        0x3F, 0xE1, 0x60, 0xD6, 0xC9, 0xEB, 0xFD, 0xE0, 0xCC, 0xF2, 0x01, 0xE8,
-        0x1D, 0xF9, 0x8C, 0xEA, 0x1E, 0xFE, 0xAD, 0xE9, 0x77, 0x00, 0x9F, 0xEA,
-        0x94, 0x02, 0x9A, 0xF0, 0xD5, 0x00, 0x3E, 0xF7, 0x50, 0xFE, 0x1C, 0xFF,
-        0x0F, 0xF9, 0x00, 0x01, 0x54, 0xF8, 0x4A, 0x01, 0x8F, 0xFA, 0x2F, 0xFF,
-        0x50, 0xFE, 0xC1, 0x01, 0x5E, 0xFE, 0x70, 0x03, 0x83, 0xFD, 0x17, 0x06,
-        0xF3, 0xFB, 0xA9, 0x07, 0xE7, 0xF9, 0x57, 0x05, 0x1A, 0x11, 0xAC, 0x1C,
-        0xFC, 0x21, 0x54, 0x2B, 0xF8, 0x1F, 0x78, 0x28, 0xFF, 0x1D, 0x05, 0x29,
-        0xDB, 0x13, 0xB7, 0x1E, 0xF4, 0x0C, 0xCE, 0x17, 0x67, 0x06, 0x67, 0x15,
-        0x01, 0x01, 0x43, 0x16, 0x93, 0xFE, 0x80, 0x15, 0x91, 0xFC, 0xAB, 0x0F,
-        0x83, 0xFE, 0xE3, 0x08, 0x3D, 0x01, 0xEE, 0x00, 0x80, 0x06, 0xB5, 0xFE,
-        0x2B, 0x07, 0x48, 0xFE, 0x1D, 0x05, 0x5F, 0x00, 0x81, 0x01, 0xDC, 0xFD,
-        0x8F, 0x01, 0x3F, 0xFC, 0x3E, 0x02, 0xA0, 0xF9, 0xAD, 0x03, 0x3D, 0xF8,
-        0xC1, 0x05, 0xF9, 0xFA, 0xD4, 0xEE, 0xEC, 0xE3, 0x29, 0xDE, 0x39, 0xD5,
-        0x2C, 0xE0, 0xAA, 0xD7, 0x21, 0xE2, 0xC5, 0xD6, 0x15, 0xEC, 0xC8, 0xE0,
-        0xBB, 0xF2, 0x85, 0xE7, 0x3E, 0xF9, 0xDE, 0xE9, 0x80, 0xFE, 0xE2, 0xE8,
-        0xDE, 0x00, 0x94, 0xE9, 0xFC, 0x02, 0xA1, 0xEF, 0x3D, 0x01, 0xC8, 0xF6,
-        0x66, 0xFE, 0xD7, 0xFE, 0xF6, 0xF8, 0xDB, 0x00, 0x35, 0xF8, 0xF8, 0x00,
-        0x1F, 0xFA, 0x83, 0xFE, 0xEA, 0xFD, 0x0F, 0x01, 0x24, 0xFE, 0xF3, 0x02,
-        0x8F, 0xFD, 0xC4, 0x05, 0xFA, 0xFB, 0x00, 0x07, 0xD6, 0xF9, 0x28, 0x04,
-        0xAA, 0x10, 0x1F, 0x1B, 0x57, 0x21, 0x07, 0x2A, 0x73, 0x1F, 0x04, 0x28,
-        0x83, 0x1D, 0x27, 0x29, 0x8E, 0x13, 0x2E, 0x1F, 0x23, 0x0D, 0x8F, 0x18,
-        0xE1, 0x06, 0x55, 0x16, 0x99, 0x01, 0x46, 0x17, 0x12, 0xFF, 0x6D, 0x16,
-        0xA8, 0xFC, 0x1D, 0x10, 0x3D, 0xFE, 0xB2, 0x08, 0x64, 0x01, 0xB5, 0x00,
-        0x1F, 0x07, 0xE0, 0xFE, 0x0A, 0x08, 0xEA, 0xFE, 0x01, 0x06, 0x67, 0x01,
-        0x09, 0x02, 0xD0, 0xFE, 0x9F, 0x01, 0xC1, 0xFC, 0x54, 0x02, 0x14, 0xFA,
-        0x0A, 0x04, 0xE3, 0xF8, 0xEE, 0x05, 0x89, 0xFB, 0xDB, 0xEE, 0x64, 0xE4,
-        0x14, 0xDE, 0x48, 0xD5, 0xF1, 0xDF, 0x25, 0xD7, 0xF6, 0xE1, 0xE4, 0xD5,
-        0x35, 0xEC, 0x0F, 0xE0, 0x79, 0xF2, 0x8C, 0xE6, 0xBA, 0xF8, 0xE3, 0xE8,
-        0x3E, 0xFE, 0x69, 0xE8, 0xEA, 0x00, 0x7B, 0xE9, 0x4B, 0x03, 0xEE, 0xEF,
-        0x7C, 0x01, 0x36, 0xF7, 0x4A, 0xFE, 0x48, 0xFF, 0x66, 0xF8, 0x19, 0x01,
-        0xB5, 0xF7, 0x22, 0x01, 0xE0, 0xF9, 0x8E, 0xFE, 0xC4, 0xFD, 0xA6, 0x00,
-        0x48, 0xFE, 0x80, 0x02, 0x87, 0xFD, 0xF2, 0x04, 0x10, 0xFC, 0x81, 0x06,
-        0x65, 0xFA, 0x3C, 0x04, 0xB4, 0x11, 0xBD, 0x1B, 0x65, 0x22, 0xF9, 0x2A,
-        0x8E, 0x20, 0x1A, 0x29, 0x9F, 0x1E, 0x73, 0x2A, 0x3D, 0x14, 0xFB, 0x1F,
-        0x2B, 0x0E, 0x9B, 0x19, 0xE7, 0x07, 0xF8, 0x16, 0x42, 0x02, 0x42, 0x17,
-        0x95, 0xFF, 0x37, 0x16, 0x3A, 0xFD, 0x0C, 0x10, 0xD6, 0xFE, 0x0F, 0x09,
-        0x84, 0x01, 0xC1, 0x00, 0x3B, 0x07, 0xFB, 0xFE, 0xC1, 0x07, 0xC3, 0xFE,
-        0xF5, 0x05, 0x96, 0x01, 0x6A, 0x02, 0xB3, 0xFF, 0xF6, 0x01, 0xCC, 0xFD,
-        0x64, 0x02, 0xFB, 0xFA, 0x90, 0x03, 0xF6, 0xF8, 0x25, 0x05, 0x2E, 0xFB,
-        0x87, 0xED, 0x8E, 0xE3, 0xF0, 0xDC, 0xB5, 0xD4, 0x6D, 0xDE, 0xB7, 0xD6,
-        0x37, 0xE0, 0x97, 0xD5, 0xB6, 0xEA, 0x52, 0xE0, 0xCB, 0xF0, 0xB7, 0xE6,
-        0x32, 0xF7, 0x46, 0xE9, 0xB1, 0xFC, 0xAF, 0xE8, 0x94, 0xFF, 0xA6, 0xE9,
-        0x07, 0x02, 0xAB, 0xEF, 0xF7, 0x00, 0xD2, 0xF6, 0xCA, 0xFE, 0x64, 0xFF,
-        0x1B, 0xF9, 0x24, 0x01, 0x93, 0xF8, 0x46, 0x01, 0x17, 0xFA, 0x59, 0xFE,
-        0xCA, 0xFD, 0x65, 0x00, 0x82, 0xFE, 0x7E, 0x02, 0x90, 0xFE, 0xBC, 0x05,
-        0x65, 0xFD, 0xC2, 0x07, 0xB2, 0xFB, 0x87, 0x05, 0x57, 0x13, 0x3F, 0x1D,
-        0xAD, 0x23, 0xF5, 0x2B, 0x42, 0x22, 0xE1, 0x29, 0x5F, 0x20, 0xC1, 0x2A,
-        0xBA, 0x15, 0xC5, 0x1F, 0x93, 0x0F, 0x34, 0x19, 0x52, 0x09, 0xCE, 0x16,
-        0xFD, 0x03, 0x6F, 0x17, 0xEE, 0x00, 0x37, 0x16, 0x6C, 0xFE, 0x17, 0x10,
-        0x51, 0xFF, 0xF4, 0x08, 0x7C, 0x01, 0x75, 0x00, 0x46, 0x07, 0x02, 0xFF,
-        0xFC, 0x07, 0x2F, 0xFF, 0x55, 0x06, 0xF7, 0x01, 0x62, 0x02, 0xB8, 0xFF,
-        0x71, 0x01, 0x88, 0xFD, 0x50, 0x01, 0x3B, 0xFA, 0x8C, 0x02, 0x49, 0xF8,
-        0x51, 0x04, 0x7E, 0xFA, 0xA3, 0xEC, 0x9C, 0xE2, 0x75, 0xDC, 0xE9, 0xD3,
-        0x01, 0xDE, 0x26, 0xD6, 0xE2, 0xDF, 0x41, 0xD5, 0xB4, 0xEA, 0x66, 0xE0,
-        0xC6, 0xF0, 0xD5, 0xE6, 0x1E, 0xF7, 0x32, 0xE9, 0xA5, 0xFC, 0xD2, 0xE8,
-        0xE7, 0xFF, 0x5F, 0xEA, 0x6C, 0x02, 0x9B, 0xF0, 0x1C, 0x01, 0x6F, 0xF7,
-        0xF1, 0xFE, 0x08, 0x00, 0xF1, 0xF8, 0x58, 0x01, 0x3E, 0xF8, 0x21, 0x01,
-        0xE1, 0xF9, 0x7C, 0xFE, 0xD0, 0xFD, 0x95, 0x00, 0xB9, 0xFE, 0xB6, 0x02,
-        0xCD, 0xFE, 0xE9, 0x05, 0xD4, 0xFD, 0x32, 0x08, 0xE2, 0xFB, 0xF4, 0x05,
-        0x97, 0x13, 0x19, 0x1E, 0x8B, 0x23, 0xBD, 0x2C, 0xEE, 0x21, 0x81, 0x2A,
-        0x4A, 0x20, 0xAD, 0x2B, 0x65, 0x15, 0x77, 0x20, 0x8B, 0x0F, 0x56, 0x1A,
-        0xD3, 0x08, 0xAA, 0x17, 0x27, 0x03, 0xDC, 0x17, 0xCD, 0xFF, 0x08, 0x16,
-        0x5F, 0xFD, 0xCE, 0x0F, 0x14, 0xFF, 0x32, 0x09, 0x11, 0x01, 0x2F, 0x00,
-        0x30, 0x07, 0xE1, 0xFE, 0xE9, 0x07, 0xE3, 0xFE, 0x8D, 0x06, 0xA6, 0x01,
-        0xBE, 0x02, 0xAC, 0xFF, 0xD6, 0x01, 0x99, 0xFD, 0xAF, 0x01, 0x60, 0xFA,
-        0x5F, 0x02, 0xD7, 0xF7, 0xC1, 0x04, 0x66, 0xFA, 0x15, 0xED, 0x2D, 0xE2,
-        0x47, 0xDD, 0xA2, 0xD3, 0x9F, 0xDE, 0xA1, 0xD5, 0xE4, 0xDF, 0x2B, 0xD4,
-        0xBA, 0xEA, 0x70, 0xDF, 0x88, 0xF0, 0x82, 0xE5, 0x8B, 0xF7, 0x78, 0xE8,
-        0x2E, 0xFD, 0x58, 0xE8, 0xA4, 0x00, 0x58, 0xEA, 0x04, 0x03, 0x84, 0xF0,
-        0x4F, 0x01, 0x0C, 0xF7, 0x53, 0xFF, 0x05, 0x00, 0x2A, 0xF9, 0x19, 0x01,
-        0x5C, 0xF8, 0xF0, 0x00, 0xA1, 0xF9, 0x13, 0xFE, 0xB8, 0xFD, 0x32, 0x00,
-        0x9A, 0xFE, 0x3D, 0x02, 0xDA, 0xFE, 0x7C, 0x05, 0xDA, 0xFD, 0xCB, 0x07,
-        0x3A, 0xFB, 0x1D, 0x05, 0xB8, 0x12, 0x71, 0x1D, 0xA3, 0x22, 0x1F, 0x2C,
-        0x87, 0x21, 0x84, 0x2A, 0x52, 0x20, 0xEF, 0x2B, 0x98, 0x15, 0xBA, 0x20,
-        0x9C, 0x0F, 0x91, 0x1A, 0xC4, 0x08, 0xCD, 0x17, 0x0C, 0x03, 0xDD, 0x17,
-        0x82, 0xFF, 0xB9, 0x15, 0x1C, 0xFD, 0x8B, 0x0F, 0xB8, 0xFE, 0xEE, 0x08,
-        0xFB, 0x00, 0x40, 0x00, 0xF4, 0x06, 0x39, 0xFF, 0xD7, 0x07, 0x9E, 0xFF,
-        0x2F, 0x06, 0x50, 0x02, 0xDA, 0x01, 0x24, 0x00, 0x10, 0x01, 0x5B, 0xFE,
-        0xD8, 0x00, 0x2F, 0xFB, 0x1A, 0x02, 0x17, 0xF9, 0x79, 0x04, 0x3C, 0xFB,
-        0x05, 0xED, 0xA6, 0xE2, 0x12, 0xDD, 0x9A, 0xD3, 0x77, 0xDE, 0x41, 0xD5,
-        0x1C, 0xE0, 0x2D, 0xD4, 0xEA, 0xEA, 0xA2, 0xDF, 0x18, 0xF1, 0xEA, 0xE5,
-        0x85, 0xF7, 0x70, 0xE8, 0x7C, 0xFD, 0x9F, 0xE8, 0xEB, 0x00, 0xAD, 0xEA,
-        0x48, 0x03, 0xBD, 0xF0, 0xC1, 0x01, 0x4F, 0xF7, 0x5C, 0xFF, 0xCE, 0xFF,
-        0xC9, 0xF9, 0xF8, 0x00, 0xD8, 0xF8, 0x6C, 0x00, 0xA9, 0xFA, 0xB5, 0xFD,
-        0x8D, 0xFE, 0x65, 0xFF, 0xEC, 0xFE, 0xCC, 0x00, 0x06, 0xFF, 0xF2, 0x03,
-        0xB0, 0xFD, 0x14, 0x06, 0xC3, 0xFB, 0x80, 0x04, 0x32, 0x13, 0x1A, 0x1D,
-        0x30, 0x23, 0x47, 0x2C, 0x8E, 0x21, 0x7B, 0x2A, 0xA9, 0x1F, 0x4C, 0x2B,
-        0xC2, 0x14, 0xBC, 0x1F, 0x81, 0x0E, 0x54, 0x19, 0x56, 0x08, 0x06, 0x17,
-        0x41, 0x02, 0xA2, 0x16, 0x11, 0xFF, 0xEE, 0x14, 0xE1, 0xFC, 0x1D, 0x0F,
-        0x3C, 0xFE, 0x89, 0x08, 0xA1, 0x00, 0x0C, 0x00, 0xEA, 0x05, 0xC1, 0xFE,
-        0xCB, 0x06, 0x75, 0xFF, 0x0E, 0x05, 0x73, 0x02, 0x6D, 0x01, 0x44, 0x01,
-        0x0C, 0x01, 0xCF, 0xFF, 0xCC, 0x00, 0x68, 0xFC, 0x44, 0x02, 0x0E, 0xFA,
-        0x3E, 0x04, 0x89, 0xFB, 0x11, 0xED, 0x12, 0xE3, 0x1B, 0xDD, 0x06, 0xD4,
-        0x96, 0xDE, 0xBE, 0xD5, 0x65, 0xE0, 0xEF, 0xD4, 0x3F, 0xEB, 0xA9, 0xE0,
-        0x75, 0xF1, 0x08, 0xE7, 0x62, 0xF7, 0x55, 0xE9, 0x59, 0xFD, 0x94, 0xE9,
-        0x6D, 0x00, 0x0B, 0xEB, 0xC0, 0x02, 0xB4, 0xF0, 0xD7, 0x01, 0x5F, 0xF7,
-        0x64, 0xFF, 0xCF, 0xFF, 0xED, 0xF9, 0xEA, 0x00, 0xF8, 0xF8, 0x39, 0x00,
-        0x57, 0xFA, 0xF5, 0xFC, 0x1F, 0xFE, 0x44, 0xFE, 0xCD, 0xFE, 0x12, 0x00,
-        0x2B, 0xFF, 0xBC, 0x03, 0x94, 0xFD, 0x25, 0x06, 0x6A, 0xFB, 0x8E, 0x04,
-        0xA0, 0x12, 0xE8, 0x1C, 0x92, 0x22, 0xB0, 0x2B, 0x6F, 0x21, 0x06, 0x2A,
-        0x7F, 0x1F, 0x95, 0x2A, 0x8A, 0x14, 0xB5, 0x1E, 0x7B, 0x0E, 0x8C, 0x18,
-        0xAB, 0x08, 0x52, 0x16, 0x1D, 0x03, 0x5C, 0x16, 0xE6, 0xFF, 0xB5, 0x14,
-        0x62, 0xFD, 0xFD, 0x0E, 0xDE, 0xFD, 0x1C, 0x08, 0x84, 0x00, 0xE0, 0xFF,
-        0x17, 0x06, 0xF0, 0xFE, 0xF0, 0x06, 0x86, 0xFF, 0xB8, 0x05, 0xE4, 0x02,
-        0x7E, 0x01, 0x5D, 0x01, 0xC9, 0x00, 0xB1, 0xFF, 0x6E, 0x00, 0x1F, 0xFC,
-        0x27, 0x02, 0xD0, 0xF9, 0x32, 0x04, 0x2B, 0xFB, 0xDB, 0xEC, 0xB9, 0xE2,
-        0xD5, 0xDC, 0x0B, 0xD4, 0xDF, 0xDD, 0xCA, 0xD5, 0x40, 0xE0, 0xCB, 0xD5,
-        0x35, 0xEB, 0x88, 0xE1, 0x6A, 0xF1, 0x94, 0xE7, 0x3F, 0xF7, 0x98, 0xE9,
-        0xD6, 0xFC, 0x86, 0xE9, 0x24, 0x00, 0x61, 0xEB, 0xB6, 0x02, 0x28, 0xF1,
-        0x25, 0x02, 0xF9, 0xF7, 0xFF, 0xFE, 0xE8, 0xFF, 0x82, 0xF9, 0xFB, 0x00,
-        0x8B, 0xF8, 0x7C, 0x00, 0xC6, 0xF9, 0x56, 0xFD, 0xF0, 0xFD, 0xCA, 0xFE,
-        0x84, 0xFE, 0x35, 0x00, 0xCF, 0xFE, 0xA6, 0x03, 0x16, 0xFD, 0xE0, 0x05,
-        0x41, 0xFB, 0xD3, 0x04, 0x70, 0x12, 0x31, 0x1D, 0xBC, 0x22, 0x25, 0x2C,
-        0xA3, 0x21, 0x37, 0x2A, 0x38, 0x1F, 0x1D, 0x2A, 0xB1, 0x14, 0xB4, 0x1E,
-        0x49, 0x0E, 0xA3, 0x18, 0x74, 0x08, 0xBE, 0x16, 0xAD, 0x02, 0x93, 0x16,
-        0x8C, 0xFF, 0xA2, 0x14, 0xE6, 0xFC, 0x85, 0x0E, 0xDC, 0xFD, 0xC4, 0x07,
-        0x63, 0x01, 0xF5, 0xFF, 0xB2, 0x06, 0xC8, 0xFE, 0xE1, 0x07, 0x98, 0xFF,
-        0x72, 0x06, 0xA7, 0x02, 0x6C, 0x02, 0x8A, 0x01, 0x93, 0x01, 0xF8, 0xFF,
-        0x2E, 0x01, 0x73, 0xFC, 0xE4, 0x02, 0x28, 0xFA, 0xFF, 0x04, 0x1A, 0xFB,
-        0x5E, 0xEE, 0xCF, 0xE2, 0xEF, 0xDD, 0x50, 0xD3, 0x62, 0xDF, 0x55, 0xD5,
-        0x6C, 0xE1, 0x32, 0xD5, 0x97, 0xEB, 0xA0, 0xE0, 0xEE, 0xF1, 0x07, 0xE7,
-        0x9F, 0xF7, 0x11, 0xE9, 0x21, 0xFD, 0x3F, 0xE9, 0x14, 0x00, 0x38, 0xEB,
-        0x07, 0x03, 0xD0, 0xF1, 0xC3, 0x01, 0x7F, 0xF8, 0x37, 0xFE, 0x8C, 0x00,
-        0xBD, 0xF8, 0x7B, 0x01, 0x75, 0xF7, 0x74, 0x00, 0xED, 0xF8, 0x72, 0xFD,
-        0xFB, 0xFC, 0x7E, 0xFE, 0x10, 0xFE, 0x71, 0x00, 0x6C, 0xFE, 0xE6, 0x03,
-        0xB1, 0xFC, 0x04, 0x06, 0x53, 0xFA, 0xA9, 0x04, 0x0D, 0x11, 0x09, 0x1D,
-        0x98, 0x21, 0xA8, 0x2C, 0xF2, 0x1F, 0xB0, 0x2A, 0x0E, 0x1E, 0xF2, 0x2A,
-        0xEF, 0x13, 0x3C, 0x1F, 0x92, 0x0D, 0x84, 0x18, 0x12, 0x08, 0x3C, 0x16,
-        0x14, 0x03, 0x5E, 0x16, 0x18, 0x00, 0x38, 0x14, 0x2C, 0xFD, 0xB4, 0x0D,
-        0x91, 0xFE, 0x0F, 0x07, 0x30, 0x02, 0xFD, 0xFE, 0xC4, 0x07, 0x6E, 0xFE,
-        0xC3, 0x08, 0x7C, 0xFF, 0x22, 0x07, 0xB5, 0x02, 0xE8, 0x02, 0x97, 0x01,
-        0x1A, 0x02, 0xC0, 0xFF, 0xE6, 0x01, 0x35, 0xFC, 0xFB, 0x03, 0x4F, 0xFA,
-        0x32, 0x06, 0xB3, 0xFB, 0xF8, 0xEE, 0x06, 0xE3, 0x73, 0xDE, 0xB2, 0xD3,
-        0xF6, 0xDF, 0x6A, 0xD5, 0xF4, 0xE1, 0x3F, 0xD5, 0xEC, 0xEB, 0xDA, 0xE0,
-        0x58, 0xF2, 0xBD, 0xE7, 0xC4, 0xF7, 0x14, 0xEA, 0x9E, 0xFC, 0xDC, 0xE9,
-        0xCD, 0xFF, 0x02, 0xEC, 0x70, 0x02, 0x14, 0xF2, 0x2F, 0x01, 0xC8, 0xF8,
-        0x5E, 0xFD, 0xDA, 0x00, 0xFF, 0xF7, 0x81, 0x01, 0x53, 0xF7, 0x86, 0x00,
-        0x0D, 0xF9, 0x0F, 0xFD, 0x26, 0xFD, 0xC2, 0xFD, 0xA0, 0xFD, 0x6B, 0xFF,
-        0xD5, 0xFD, 0x52, 0x03, 0x77, 0xFB, 0x45, 0x05, 0x8D, 0xF9, 0x56, 0x04,
-        0xF4, 0x10, 0xF5, 0x1C, 0x5A, 0x21, 0xE8, 0x2B, 0x15, 0x20, 0x48, 0x2A,
-        0x40, 0x1E, 0x84, 0x2A, 0xA2, 0x14, 0x1E, 0x1F, 0x3B, 0x0E, 0x2E, 0x18,
-        0xD3, 0x08, 0xAA, 0x15, 0xB8, 0x03, 0xBB, 0x15, 0xAB, 0x00, 0xF2, 0x13,
-        0xF8, 0xFD, 0x49, 0x0E, 0xFA, 0xFE, 0x92, 0x07, 0xBB, 0x02, 0x5E, 0xFF,
-        0xE3, 0x07, 0x78, 0xFE, 0x62, 0x08, 0x49, 0xFF, 0xC6, 0x06, 0xF9, 0x02,
-        0x01, 0x03, 0xC9, 0x02, 0x60, 0x02, 0xE1, 0x00, 0x25, 0x02, 0xB3, 0xFC,
-        0xAD, 0x04, 0x8C, 0xFA, 0x9F, 0x06, 0x4A, 0xFB, 0x74, 0xEF, 0xE6, 0xE2,
-        0x21, 0xDF, 0x28, 0xD4, 0x36, 0xE0, 0xA0, 0xD5, 0xA9, 0xE1, 0xF8, 0xD4,
-        0x42, 0xEB, 0x63, 0xE0, 0x93, 0xF1, 0x44, 0xE7, 0x3C, 0xF7, 0x47, 0xEA,
-        0x50, 0xFC, 0x76, 0xEA, 0x10, 0xFF, 0x0A, 0xEC, 0xD2, 0x01, 0xD4, 0xF1,
-        0xDE, 0x00, 0x86, 0xF8, 0x02, 0xFD, 0xE2, 0x00, 0xAB, 0xF7, 0xA6, 0x01,
-        0x64, 0xF7, 0xFA, 0x00, 0xFC, 0xF8, 0x24, 0xFD, 0x1E, 0xFD, 0x4C, 0xFD,
-        0x41, 0xFE, 0x84, 0xFF, 0x7B, 0xFE, 0x9F, 0x03, 0xCF, 0xFB, 0xCC, 0x05,
-        0x88, 0xF9, 0xFB, 0x04, 0x8E, 0x10, 0x5F, 0x1D, 0xB1, 0x20, 0x26, 0x2C,
-        0xD3, 0x1F, 0x09, 0x2B, 0x6B, 0x1E, 0xEF, 0x2B, 0xC8, 0x14, 0x8C, 0x20,
-        0x94, 0x0E, 0xBC, 0x19, 0xC2, 0x08, 0x61, 0x16, 0xC0, 0x03, 0xEA, 0x15,
-        0xFA, 0x00, 0x12, 0x14, 0x09, 0xFE, 0x11, 0x0E, 0xFD, 0xFE, 0x66, 0x07,
-        0x2A, 0x03, 0x4F, 0xFF, 0xAC, 0x08, 0xC9, 0xFE, 0xF1, 0x08, 0x9E, 0xFF,
-        0x1E, 0x07, 0x3C, 0x03, 0x7C, 0x02, 0xB7, 0x02, 0x52, 0x01, 0x7B, 0x00,
-        0x3C, 0x01, 0x62, 0xFC, 0x08, 0x04, 0x45, 0xFA, 0x4C, 0x06, 0xF7, 0xFA,
-        0x3B, 0xEF, 0x9C, 0xE2, 0x05, 0xDF, 0xD6, 0xD3, 0x0A, 0xE0, 0x04, 0xD5,
-        0xAC, 0xE1, 0x4B, 0xD4, 0x5C, 0xEB, 0x8B, 0xDF, 0x91, 0xF1, 0x38, 0xE6,
-        0x59, 0xF7, 0x69, 0xE9, 0xA9, 0xFC, 0x2A, 0xEA, 0xB1, 0xFF, 0x3C, 0xEC,
-        0xB6, 0x02, 0x4D, 0xF2, 0xB0, 0x01, 0xF5, 0xF8, 0x49, 0xFD, 0xFC, 0x00,
-        0xE8, 0xF7, 0x92, 0x01, 0xA3, 0xF7, 0x78, 0x00, 0xE5, 0xF9, 0x2C, 0xFD,
-        0x91, 0xFE, 0x7A, 0xFD, 0x42, 0xFF, 0x48, 0xFF, 0x1B, 0xFF, 0x4F, 0x03,
-        0x4D, 0xFC, 0x8F, 0x05, 0x1B, 0xFA, 0x1A, 0x05, 0x46, 0x11, 0x8A, 0x1D,
-        0x90, 0x21, 0x79, 0x2C, 0x28, 0x20, 0xEB, 0x2A, 0x5D, 0x1E, 0x83, 0x2B,
-        0x95, 0x14, 0x13, 0x20, 0x67, 0x0E, 0x6F, 0x19, 0xBE, 0x08, 0x6E, 0x16,
-        0x2F, 0x03, 0xAA, 0x15, 0x1E, 0x00, 0xD7, 0x13, 0x05, 0xFD, 0x0F, 0x0E,
-        0x37, 0xFE, 0x95, 0x07, 0x61, 0x02, 0x43, 0xFF, 0xD5, 0x07, 0x99, 0xFE,
-        0xFE, 0x07, 0x94, 0xFF, 0x9A, 0x05, 0x9A, 0x02, 0x28, 0x01, 0x6F, 0x02,
-        0xD3, 0x00, 0xD8, 0x00, 0x29, 0x01, 0xD7, 0xFC, 0xC0, 0x03, 0x6D, 0xFA,
-        0x53, 0x06, 0x49, 0xFB, 0xE7, 0xEE, 0xAF, 0xE2, 0xA1, 0xDE, 0xB9, 0xD3,
-        0x42, 0xE0, 0x4B, 0xD5, 0xF1, 0xE1, 0x70, 0xD4, 0x14, 0xEC, 0x0C, 0xE0,
-        0x2C, 0xF2, 0x97, 0xE6, 0xEA, 0xF7, 0xAE, 0xE9, 0x12, 0xFD, 0x24, 0xEA,
-        0x06, 0x00, 0xE1, 0xEB, 0x0A, 0x03, 0x9D, 0xF1, 0xDC, 0x01, 0x2C, 0xF8,
-        0xEB, 0xFD, 0xD1, 0x00, 0x17, 0xF8, 0x31, 0x01, 0xF6, 0xF7, 0x55, 0x00,
-        0x40, 0xFA, 0x5B, 0xFD, 0xF4, 0xFE, 0xE7, 0xFD, 0x52, 0xFF, 0x9C, 0xFF,
-        0x0F, 0xFF, 0xAF, 0x03, 0x83, 0xFC, 0x04, 0x06, 0x6B, 0xF9, 0x80, 0x04,
-        0x1A, 0x11, 0x10, 0x1D, 0x60, 0x21, 0xE5, 0x2B, 0xF1, 0x1F, 0x6F, 0x2A,
-        0x5A, 0x1E, 0x76, 0x2B, 0xEE, 0x13, 0xED, 0x1F, 0x86, 0x0D, 0x69, 0x19,
-        0x9B, 0x07, 0x67, 0x16, 0xA0, 0x02, 0x1D, 0x16, 0xCD, 0xFF, 0x66, 0x14,
-        0xC1, 0xFC, 0x73, 0x0E, 0xBE, 0xFD, 0xA5, 0x07, 0xBC, 0x01, 0x01, 0xFF,
-        0xC0, 0x07, 0xCC, 0xFE, 0x2E, 0x08, 0xCE, 0xFF, 0xFD, 0x05, 0xC0, 0x02,
-        0x2A, 0x01, 0x02, 0x02, 0xB3, 0x00, 0x63, 0x00, 0xFF, 0x00, 0x9A, 0xFC,
-        0x8B, 0x03, 0x71, 0xFA, 0x8B, 0x06, 0xFD, 0xFB, 0xBC, 0xEE, 0x65, 0xE3,
-        0x34, 0xDE, 0x58, 0xD4, 0x93, 0xDF, 0xD0, 0xD5, 0x0F, 0xE1, 0x9C, 0xD4,
-        0xCA, 0xEB, 0x05, 0xE0, 0x8F, 0xF2, 0x5D, 0xE6, 0xC3, 0xF8, 0x44, 0xE9,
-        0xF4, 0xFD, 0xC8, 0xE9, 0x58, 0x00, 0x59, 0xEB, 0x30, 0x03, 0x71, 0xF1,
-        0x02, 0x02, 0x43, 0xF8, 0x0D, 0xFE, 0xD9, 0x00, 0x50, 0xF8, 0x33, 0x01,
-        0xDD, 0xF7, 0x20, 0x00, 0x01, 0xFA, 0x4A, 0xFD, 0x8E, 0xFE, 0xBA, 0xFD,
-        0x09, 0xFF, 0x3A, 0xFF, 0x7A, 0xFE, 0x88, 0x02, 0x31, 0xFC, 0xE5, 0x04,
-        0x76, 0xF9, 0xA7, 0x03, 0x16, 0x11, 0x3F, 0x1C, 0xD1, 0x21, 0x8B, 0x2B,
-        0x3F, 0x20, 0xD5, 0x29, 0x20, 0x1F, 0x40, 0x2B, 0x48, 0x14, 0xEF, 0x1F,
-        0x74, 0x0D, 0xFC, 0x19, 0xF4, 0x06, 0x26, 0x17, 0x4C, 0x01, 0x44, 0x16,
-        0x5A, 0xFF, 0xFB, 0x14, 0xB3, 0xFC, 0xC2, 0x0E, 0x43, 0xFE, 0x0B, 0x08,
-        0x0F, 0x02, 0x55, 0xFF, 0xA5, 0x07, 0xDE, 0xFE, 0x12, 0x08, 0xD4, 0xFF,
-        0x40, 0x06, 0xC4, 0x02, 0x00, 0x02, 0x87, 0x02, 0x62, 0x01, 0xFA, 0x00,
-        0xE3, 0x01, 0xB7, 0xFD, 0xB0, 0x03, 0xF8, 0xFA, 0x7F, 0x06, 0x2A, 0xFC,
-        0x42, 0xEF, 0xC3, 0xE3, 0xCB, 0xDE, 0x73, 0xD4, 0x7B, 0xE0, 0x4A, 0xD6,
-        0x6E, 0xE1, 0xBE, 0xD4, 0xF8, 0xEB, 0xA8, 0xDF, 0x7E, 0xF2, 0x2E, 0xE5,
-        0xEB, 0xF8, 0xC9, 0xE7, 0x75, 0xFE, 0xB5, 0xE8, 0x65, 0x00, 0x21, 0xEA,
-        0x00, 0x03, 0xA0, 0xF0, 0xBB, 0x01, 0xCB, 0xF7, 0xFB, 0xFD, 0x7A, 0x00,
-        0x84, 0xF8, 0xF8, 0x00, 0xF5, 0xF7, 0xF9, 0xFF, 0x78, 0xF9, 0xE9, 0xFC,
-        0xDB, 0xFD, 0x6E, 0xFD, 0x79, 0xFE, 0x06, 0xFF, 0x53, 0xFE, 0xA9, 0x02,
-        0xC7, 0xFC, 0x79, 0x05, 0xF3, 0xF9, 0x48, 0x04, 0xFD, 0x10, 0x63, 0x1C,
-        0x66, 0x21, 0xAF, 0x2B, 0xAF, 0x1F, 0xC5, 0x29, 0x7A, 0x1E, 0x18, 0x2B,
-        0x3C, 0x14, 0xB8, 0x20, 0x7A, 0x0D, 0x47, 0x1B, 0x5E, 0x07, 0x2B, 0x19,
-        0xE7, 0x01, 0x54, 0x18, 0xCC, 0xFF, 0x8F, 0x16, 0x20, 0xFD, 0xCF, 0x0F,
-        0x15, 0xFE, 0x07, 0x08, 0x16, 0x02, 0xA9, 0xFF, 0x6A, 0x07, 0xF8, 0xFE,
-        0x28, 0x08, 0x12, 0x00, 0x75, 0x06, 0xE6, 0x02, 0xCB, 0x01, 0x1D, 0x02,
-        0x6F, 0x01, 0xD2, 0x00, 0x74, 0x01, 0x1B, 0xFD, 0x28, 0x03, 0x83, 0xFA,
-        0xCF, 0x05, 0x72, 0xFB, 0xCC, 0xEE, 0x64, 0xE3, 0x26, 0xDE, 0xE3, 0xD3,
-        0xF5, 0xDF, 0xF7, 0xD5, 0x61, 0xE1, 0xF7, 0xD4, 0x80, 0xEB, 0x2A, 0xDF,
-        0xB0, 0xF2, 0xF6, 0xE4, 0x94, 0xF8, 0xE4, 0xE6, 0x18, 0xFE, 0xFD, 0xE7,
-        0x5F, 0x00, 0xF5, 0xE9, 0xE3, 0x02, 0xA6, 0xF0, 0x11, 0x02, 0x69, 0xF8,
-        0x17, 0xFE, 0x77, 0x00, 0x02, 0xF9, 0x38, 0x01, 0x68, 0xF8, 0x26, 0x00,
-        0x41, 0xFA, 0x8B, 0xFD, 0xD7, 0xFE, 0x2B, 0xFE, 0xD2, 0xFE, 0x22, 0xFF,
-        0xB8, 0xFE, 0xB2, 0x02, 0x1A, 0xFD, 0x5C, 0x05, 0x7F, 0xFA, 0x88, 0x04,
-        0xBB, 0x11, 0xB9, 0x1C, 0x77, 0x22, 0x38, 0x2C, 0xA3, 0x20, 0x0E, 0x2A,
-        0x30, 0x1F, 0xEF, 0x2A, 0xCD, 0x14, 0xC0, 0x20, 0x58, 0x0D, 0xCF, 0x1A,
-        0x3B, 0x07, 0xC0, 0x18, 0xDD, 0x01, 0x88, 0x17, 0x80, 0xFF, 0x6B, 0x15,
-        0x6B, 0xFD, 0x00, 0x0F, 0x34, 0xFE, 0x55, 0x07, 0xD9, 0x01, 0x53, 0xFF,
-        0xDA, 0x06, 0xBD, 0xFE, 0x20, 0x07, 0x9D, 0xFF, 0x8C, 0x05, 0x86, 0x02,
-        0x15, 0x01, 0xFE, 0x01, 0x40, 0x01, 0x1E, 0x01, 0x3B, 0x01, 0x40, 0xFD,
-        0xB5, 0x02, 0x4F, 0xFA, 0xA7, 0x05, 0x47, 0xFB, 0x48, 0xEE, 0x07, 0xE3,
-        0xCA, 0xDD, 0xE1, 0xD3, 0x41, 0xDF, 0xFC, 0xD5, 0x9E, 0xE0, 0x39, 0xD5,
-        0x0B, 0xEB, 0x63, 0xDF, 0x88, 0xF2, 0x4E, 0xE5, 0xAB, 0xF8, 0x60, 0xE7,
-        0xAC, 0xFD, 0x5F, 0xE8, 0x18, 0x00, 0x9C, 0xEA, 0xF5, 0x01, 0xD6, 0xF0,
-        0x68, 0x01, 0xBC, 0xF8, 0xE7, 0xFD, 0x7C, 0x00, 0xC0, 0xF8, 0xEE, 0x00,
-        0xAE, 0xF8, 0x29, 0x00, 0x0F, 0xFA, 0x25, 0xFD, 0xAB, 0xFE, 0xD5, 0xFD,
-        0xB4, 0xFE, 0xEF, 0xFE, 0xF0, 0xFE, 0x19, 0x03, 0x69, 0xFD, 0xF5, 0x05,
-        0x65, 0xFA, 0xF3, 0x04, 0xBF, 0x11, 0xFA, 0x1C, 0x43, 0x22, 0xF5, 0x2B,
-        0xF4, 0x20, 0xC5, 0x29, 0x9A, 0x1F, 0x6D, 0x2A, 0xF1, 0x14, 0x4F, 0x20,
-        0x5F, 0x0D, 0x74, 0x1A, 0x5A, 0x07, 0xB1, 0x18, 0x66, 0x02, 0xBF, 0x17,
-        0x0D, 0x00, 0x9B, 0x15, 0xF5, 0xFD, 0x28, 0x0F, 0x8B, 0xFE, 0x67, 0x07,
-        0x3B, 0x02, 0x04, 0x00, 0x93, 0x07, 0xC7, 0xFF, 0x7F, 0x07, 0x56, 0x00,
-        0xDA, 0x05, 0x04, 0x03, 0x20, 0x01, 0x35, 0x02, 0xC3, 0x00, 0xBF, 0x00,
-        0xF2, 0x00, 0xE5, 0xFC, 0x7D, 0x02, 0x08, 0xFA, 0x71, 0x05, 0xE8, 0xFA,
-        0xF0, 0xED, 0xE7, 0xE2, 0x37, 0xDD, 0xEC, 0xD3, 0xAB, 0xDE, 0x7A, 0xD6,
-        0xED, 0xDF, 0xC4, 0xD5, 0x08, 0xEB, 0x0E, 0xE0, 0x59, 0xF2, 0x7E, 0xE5,
-        0x86, 0xF8, 0x46, 0xE7, 0x69, 0xFD, 0x35, 0xE8, 0x97, 0xFF, 0x3E, 0xEA,
-        0xE3, 0x01, 0xE7, 0xF0, 0xCD, 0x00, 0x26, 0xF8, 0x32, 0xFD, 0x70, 0xFF,
-        0x9D, 0xF7, 0x97, 0xFF, 0x08, 0xF8, 0x70, 0xFF, 0xB0, 0xF9, 0xE2, 0xFC,
-        0x71, 0xFE, 0xAD, 0xFD, 0xFC, 0xFE, 0x1E, 0xFF, 0x65, 0xFE, 0x9E, 0x02,
-        0x48, 0xFD, 0xC4, 0x05, 0x61, 0xFA, 0x14, 0x05, 0x54, 0x12, 0x6D, 0x1D,
-        0x05, 0x23, 0x4E, 0x2C, 0x78, 0x21, 0x94, 0x29, 0x0D, 0x20, 0x45, 0x2A,
-        0x92, 0x14, 0xFA, 0x1F, 0x5F, 0x0D, 0xDC, 0x1A, 0xE7, 0x06, 0xCB, 0x18,
-        0x78, 0x02, 0xF9, 0x17, 0x97, 0x00, 0xD0, 0x15, 0xBA, 0xFE, 0x4D, 0x0F,
-        0xFD, 0xFF, 0x13, 0x08, 0x5B, 0x03, 0xAA, 0x00, 0xB4, 0x08, 0x55, 0x00,
-        0x0C, 0x08, 0x4E, 0x00, 0xA5, 0x06, 0x2F, 0x03, 0xB8, 0x01, 0x7A, 0x02,
-        0x40, 0x01, 0x49, 0x01, 0x98, 0x01, 0x8A, 0xFD, 0xA5, 0x02, 0x4D, 0xFA,
-        0x8E, 0x05, 0xBB, 0xFA, 0x73, 0xED, 0x0D, 0xE2, 0xCF, 0xDC, 0x3E, 0xD3,
-        0x20, 0xDE, 0xC9, 0xD5, 0xA7, 0xDF, 0x39, 0xD5, 0x01, 0xEB, 0x33, 0xDF,
-        0x80, 0xF2, 0x85, 0xE4, 0x11, 0xF9, 0xA0, 0xE6, 0x41, 0xFD, 0x7A, 0xE7,
-        0xEB, 0xFE, 0xBF, 0xE9, 0x79, 0x00, 0x40, 0xF0, 0x61, 0xFF, 0xE3, 0xF7,
-        0x0B, 0xFC, 0x3A, 0xFF, 0xE6, 0xF6, 0xC8, 0xFF, 0x30, 0xF7, 0x72, 0xFF,
-        0x9C, 0xF8, 0x87, 0xFC, 0xA3, 0xFD, 0x2F, 0xFD, 0x4F, 0xFE, 0x5D, 0xFE,
-        0x6C, 0xFE, 0x73, 0x02, 0x29, 0xFD, 0x59, 0x05, 0x54, 0xFA, 0x38, 0x05,
-        0x4D, 0x12, 0x06, 0x1E, 0xF3, 0x22, 0x04, 0x2D, 0xA8, 0x21, 0x8D, 0x2A,
-        0x5A, 0x20, 0x52, 0x2B, 0x51, 0x15, 0x8B, 0x21, 0xA1, 0x0D, 0xE4, 0x1B,
-        0x5A, 0x07, 0xD2, 0x19, 0x09, 0x03, 0x8E, 0x18, 0x91, 0x01, 0x37, 0x16,
-        0xC6, 0xFF, 0x4F, 0x0F, 0xC1, 0x00, 0x96, 0x07, 0xD3, 0x03, 0x4E, 0x00,
-        0xE5, 0x08, 0xEC, 0xFF, 0xC5, 0x08, 0x8D, 0x00, 0xFF, 0x06, 0x19, 0x03,
-        0x2E, 0x02, 0x8C, 0x02, 0x77, 0x01, 0x18, 0x01, 0x95, 0x01, 0x25, 0xFD,
-        0xE5, 0x02, 0x5F, 0xFA, 0x85, 0x05, 0x4A, 0xFA, 0x51, 0xED, 0x51, 0xE1,
-        0xA3, 0xDC, 0x57, 0xD2, 0x52, 0xDE, 0x26, 0xD5, 0x31, 0xDF, 0x0E, 0xD4,
-        0x8A, 0xEA, 0x23, 0xDE, 0xFA, 0xF1, 0xC7, 0xE3, 0x73, 0xF8, 0x22, 0xE6,
-        0xC5, 0xFC, 0x9F, 0xE7, 0x2D, 0xFE, 0xFA, 0xE9, 0x10, 0x00, 0x0C, 0xF1,
-        0xDB, 0xFE, 0x8D, 0xF8, 0x66, 0xFC, 0x21, 0x00, 0x2A, 0xF7, 0x2A, 0x00,
-        0xCC, 0xF7, 0xBB, 0xFF, 0x9C, 0xF9, 0x30, 0xFD, 0x21, 0xFE, 0xA3, 0xFD,
-        0x65, 0xFE, 0x31, 0xFF, 0xA1, 0xFD, 0x0A, 0x03, 0x6C, 0xFC, 0x34, 0x06,
-        0xA2, 0xF9, 0x5B, 0x06, 0x80, 0x12, 0xCA, 0x1F, 0xD2, 0x22, 0x4E, 0x2E,
-        0x3C, 0x21, 0x68, 0x2B, 0x7B, 0x20, 0x82, 0x2C, 0xF9, 0x14, 0x1A, 0x22,
-        0xDF, 0x0D, 0x96, 0x1C, 0x17, 0x07, 0xC7, 0x19, 0x1D, 0x03, 0x8D, 0x18,
-        0x7C, 0x01, 0x21, 0x16, 0xED, 0xFF, 0x5A, 0x0F, 0xE0, 0x00, 0x99, 0x07,
-        0x13, 0x03, 0xAE, 0xFF, 0x7D, 0x08, 0xBA, 0xFF, 0x9D, 0x07, 0xDC, 0xFF,
-        0x27, 0x06, 0xD8, 0x02, 0x8A, 0x01, 0x28, 0x02, 0xAE, 0x01, 0xAE, 0x00,
-        0x5B, 0x02, 0x5A, 0xFC, 0xBF, 0x03, 0x17, 0xF9, 0xB7, 0x06, 0x0D, 0xF9,
-        0x9D, 0xED, 0xA4, 0xDF, 0x8D, 0xDD, 0x99, 0xD1, 0xB3, 0xDE, 0x3D, 0xD4,
-        0xB7, 0xDF, 0x73, 0xD3, 0x18, 0xEB, 0xB2, 0xDD, 0x50, 0xF2, 0x82, 0xE3,
-        0xFB, 0xF8, 0x5B, 0xE6, 0xB0, 0xFC, 0x5C, 0xE7, 0x82, 0xFE, 0xE4, 0xE9,
-        0x25, 0x00, 0x92, 0xF0, 0xDE, 0xFF, 0xF5, 0xF8, 0x81, 0xFD, 0xAB, 0x00,
-        0xEA, 0xF7, 0xC2, 0x00, 0x51, 0xF8, 0x1F, 0x00, 0xAA, 0xF9, 0xFC, 0xFC,
-        0x8C, 0xFE, 0xCB, 0xFD, 0x8F, 0xFE, 0x60, 0xFF, 0x38, 0xFE, 0x28, 0x04,
-        0x76, 0xFC, 0x20, 0x07, 0x7D, 0xF9, 0x2E, 0x07, 0x63, 0x12, 0x33, 0x20,
-        0xDB, 0x22, 0x69, 0x2E, 0xD3, 0x21, 0xCA, 0x2B, 0xA5, 0x20, 0x75, 0x2C,
-        0x2F, 0x15, 0x5E, 0x22, 0x8E, 0x0D, 0x1C, 0x1C, 0x39, 0x07, 0x96, 0x19,
-        0x68, 0x03, 0x78, 0x18, 0xBA, 0x01, 0x28, 0x16, 0x96, 0xFF, 0x2F, 0x0F,
-        0xB2, 0xFF, 0xD7, 0x06, 0x2F, 0x02, 0x5A, 0xFF, 0xE7, 0x07, 0x13, 0xFF,
-        0xFA, 0x07, 0xF4, 0xFF, 0x56, 0x06, 0x8B, 0x02, 0x71, 0x01, 0x95, 0x01,
-        0x27, 0x01, 0xC1, 0xFF, 0xC6, 0x01, 0x2F, 0xFB, 0xA5, 0x03, 0x77, 0xF8,
-        0xAA, 0x06, 0x88, 0xF8, 0xCB, 0xED, 0xC8, 0xDF, 0xAE, 0xDC, 0x3B, 0xD1,
-        0xE5, 0xDD, 0x22, 0xD4, 0xFC, 0xDE, 0x55, 0xD3, 0xE9, 0xEA, 0x85, 0xDD,
-        0xD3, 0xF2, 0xF1, 0xE3, 0x6B, 0xF9, 0x9E, 0xE6, 0x5F, 0xFD, 0xFC, 0xE7,
-        0xD1, 0xFE, 0x5B, 0xEA, 0xD5, 0x00, 0x5F, 0xF1, 0x13, 0x00, 0x2A, 0xF9,
-        0x92, 0xFD, 0xB2, 0x00, 0xCE, 0xF7, 0x1A, 0x01, 0xF4, 0xF7, 0x8C, 0x00,
-        0xC6, 0xF9, 0x3D, 0xFE, 0xAE, 0xFE, 0x3E, 0xFF, 0xF5, 0xFE, 0xEA, 0x00,
-        0xFA, 0xFD, 0x00, 0x05, 0x55, 0xFC, 0xC0, 0x07, 0x10, 0xF9, 0x51, 0x07,
-        0x13, 0x12, 0x13, 0x20, 0x5A, 0x23, 0xA6, 0x2E, 0x3C, 0x22, 0xB4, 0x2B,
-        0x40, 0x21, 0xA6, 0x2C, 0x45, 0x15, 0x95, 0x22, 0x59, 0x0D, 0x50, 0x1C,
-        0x41, 0x06, 0x64, 0x19, 0x59, 0x02, 0x22, 0x18, 0xFE, 0x00, 0x9F, 0x15,
-        0x94, 0xFF, 0x01, 0x0F, 0xEB, 0x00, 0x75, 0x07, 0x47, 0x03, 0xA2, 0xFF,
-        0xF6, 0x08, 0xF0, 0xFE, 0x70, 0x08, 0x16, 0xFF, 0xDE, 0x06, 0x99, 0x01,
-        0xE6, 0x01, 0x89, 0x00, 0xC3, 0x01, 0x2D, 0xFF, 0x81, 0x02, 0x11, 0xFB,
-        0xC7, 0x03, 0x3F, 0xF8, 0x2F, 0x07, 0xF4, 0xF8, 0x33, 0xEE, 0x22, 0xE0,
-        0x12, 0xDD, 0xA9, 0xD1, 0x18, 0xDE, 0x49, 0xD4, 0x25, 0xDF, 0x4C, 0xD3,
-        0xD5, 0xEA, 0xF8, 0xDC, 0xCF, 0xF2, 0x40, 0xE3, 0x09, 0xFA, 0x2D, 0xE6,
-        0xEE, 0xFD, 0x54, 0xE7, 0x60, 0xFF, 0x1A, 0xEA, 0x6C, 0x00, 0x8B, 0xF0,
-        0x2B, 0xFF, 0x77, 0xF8, 0xA6, 0xFC, 0x54, 0x00, 0x14, 0xF7, 0x25, 0x01,
-        0x63, 0xF7, 0xCC, 0x00, 0xAF, 0xF8, 0xE0, 0xFD, 0x89, 0xFD, 0xE7, 0xFE,
-        0x97, 0xFD, 0x2C, 0x00, 0x3A, 0xFD, 0x92, 0x04, 0x16, 0xFC, 0x66, 0x07,
-        0xF9, 0xF8, 0xE4, 0x06, 0xBF, 0x11, 0xA1, 0x1F, 0xE5, 0x22, 0x3D, 0x2E,
-        0xBD, 0x21, 0xC3, 0x2B, 0xAB, 0x20, 0xD7, 0x2C, 0x54, 0x15, 0x6F, 0x23,
-        0x61, 0x0D, 0x0E, 0x1D, 0x7F, 0x06, 0x65, 0x1A, 0x75, 0x02, 0x1D, 0x19,
-        0x16, 0x01, 0x5D, 0x16, 0xF8, 0xFF, 0xC4, 0x0F, 0x2A, 0x01, 0xAA, 0x07,
-        0xE1, 0x03, 0xE8, 0xFF, 0x69, 0x09, 0x0A, 0xFF, 0x38, 0x09, 0x93, 0xFF,
-        0xCF, 0x07, 0x7E, 0x02, 0x1F, 0x03, 0x91, 0x01, 0x1B, 0x03, 0x3A, 0x00,
-        0x8C, 0x03, 0xE4, 0xFB, 0x8E, 0x04, 0x0C, 0xF9, 0x2C, 0x07, 0x21, 0xF9,
-        0x62, 0xEE, 0x85, 0xE0, 0x11, 0xDD, 0xC4, 0xD1, 0x66, 0xDE, 0x58, 0xD4,
-        0x5A, 0xDF, 0x3B, 0xD3, 0x90, 0xEA, 0xB3, 0xDC, 0x6D, 0xF2, 0x47, 0xE3,
-        0x27, 0xF9, 0xF7, 0xE5, 0x95, 0xFD, 0x9E, 0xE7, 0xD9, 0xFE, 0x3A, 0xEA,
-        0x11, 0x00, 0xBE, 0xF0, 0xB6, 0xFE, 0x89, 0xF8, 0xE4, 0xFB, 0xFF, 0xFF,
-        0x8F, 0xF6, 0xED, 0x00, 0xE4, 0xF6, 0x64, 0x00, 0x9C, 0xF8, 0xA9, 0xFD,
-        0xF5, 0xFC, 0x7F, 0xFE, 0xF9, 0xFC, 0x13, 0x00, 0x47, 0xFC, 0x49, 0x04,
-        0x6E, 0xFB, 0x5D, 0x07, 0x29, 0xF9, 0x89, 0x07, 0xCE, 0x11, 0xC9, 0x1F,
-        0x33, 0x23, 0x72, 0x2E, 0xBE, 0x21, 0x9F, 0x2B, 0xEC, 0x20, 0xCD, 0x2C,
-        0xC8, 0x15, 0x40, 0x23, 0x01, 0x0E, 0xD8, 0x1C, 0x50, 0x07, 0x32, 0x1A,
-        0x8C, 0x02, 0x69, 0x18, 0x43, 0x01, 0xF2, 0x15, 0x00, 0x00, 0x4D, 0x0F,
-        0x4C, 0x01, 0x8B, 0x07, 0x35, 0x04, 0xF4, 0xFF, 0x7F, 0x09, 0xD2, 0xFE,
-        0x25, 0x09, 0x3D, 0xFF, 0x8C, 0x07, 0xF6, 0x01, 0x79, 0x03, 0x36, 0x01,
-        0x77, 0x03, 0x78, 0xFF, 0x0D, 0x04, 0x42, 0xFB, 0xD0, 0x04, 0x16, 0xF8,
-        0xFC, 0x06, 0xF6, 0xF7, 0x7B, 0xEE, 0x0F, 0xE0, 0x16, 0xDD, 0x7D, 0xD1,
-        0x77, 0xDE, 0x58, 0xD4, 0x47, 0xDF, 0x4E, 0xD3, 0x7E, 0xEA, 0xFE, 0xDC,
-        0x2E, 0xF2, 0x59, 0xE3, 0xBC, 0xF8, 0xC0, 0xE5, 0x93, 0xFD, 0x67, 0xE7,
-        0xF2, 0xFE, 0xE9, 0xE9, 0x7C, 0x00, 0xF2, 0xF0, 0x58, 0xFF, 0xF7, 0xF8,
-        0x29, 0xFC, 0x93, 0x00, 0x7B, 0xF6, 0x9C, 0x01, 0xA3, 0xF6, 0x32, 0x01,
-        0x2E, 0xF8, 0x84, 0xFE, 0x51, 0xFC, 0x94, 0xFF, 0xA9, 0xFC, 0x87, 0x01,
-        0x58, 0xFC, 0xB6, 0x05, 0x95, 0xFB, 0x9F, 0x08, 0x55, 0xF9, 0x5A, 0x08,
-        0xC7, 0x11, 0x01, 0x20, 0x08, 0x23, 0x7A, 0x2E, 0x9D, 0x21, 0x9C, 0x2B,
-        0x83, 0x20, 0x67, 0x2C, 0x19, 0x15, 0x90, 0x22, 0x7D, 0x0D, 0x5C, 0x1C,
-        0x27, 0x07, 0x54, 0x1A, 0x5B, 0x02, 0xFE, 0x18, 0xB0, 0x00, 0x2D, 0x16,
-        0xC9, 0xFE, 0xB3, 0x0E, 0xBD, 0xFF, 0x63, 0x06, 0x59, 0x03, 0xF3, 0xFE,
-        0x84, 0x09, 0x26, 0xFE, 0x9C, 0x09, 0xB2, 0xFE, 0x0F, 0x08, 0x36, 0x01,
-        0xBE, 0x03, 0xAF, 0xFF, 0x46, 0x03, 0xB6, 0xFD, 0x5E, 0x03, 0x8F, 0xF9,
-        0x24, 0x04, 0xEF, 0xF6, 0x47, 0x06, 0x81, 0xF7, 0x9E, 0xED, 0xE2, 0xDF,
-        0x6A, 0xDC, 0x88, 0xD1, 0xE8, 0xDD, 0x7A, 0xD4, 0x60, 0xDF, 0xF6, 0xD3,
-        0x06, 0xEB, 0xE2, 0xDD, 0xB4, 0xF2, 0xF2, 0xE3, 0x1F, 0xF9, 0xB4, 0xE5,
-        0xE7, 0xFD, 0xBB, 0xE6, 0xAC, 0xFF, 0x8C, 0xE9, 0x5B, 0x01, 0xED, 0xF0,
-        0x42, 0x00, 0x35, 0xF9, 0x63, 0xFC, 0xBE, 0x00, 0x22, 0xF6, 0xCA, 0x01,
-        0x21, 0xF6, 0x67, 0x01, 0xD1, 0xF7, 0x39, 0xFF, 0x5C, 0xFC, 0x00, 0x01,
-        0xD8, 0xFC, 0xD1, 0x02, 0xEF, 0xFC, 0xCB, 0x06, 0x23, 0xFC, 0x27, 0x09,
-        0xDF, 0xF9, 0x26, 0x08, 0x8E, 0x12, 0xA9, 0x1F, 0xC2, 0x23, 0xFC, 0x2D,
-        0x59, 0x22, 0x35, 0x2B, 0xD3, 0x20, 0xB3, 0x2B, 0x18, 0x15, 0xD7, 0x21,
-        0x31, 0x0D, 0xCA, 0x1B, 0x5C, 0x06, 0xD5, 0x19, 0x5B, 0x01, 0xE9, 0x18,
-        0xD3, 0xFF, 0x40, 0x16, 0x5B, 0xFE, 0x21, 0x0F, 0xB3, 0xFF, 0xFA, 0x06,
-        0x68, 0x03, 0x10, 0xFF, 0x9C, 0x09, 0xC9, 0xFD, 0xB9, 0x09, 0x19, 0xFE,
-        0x23, 0x08, 0x56, 0x00, 0xC2, 0x03, 0x9F, 0xFE, 0x05, 0x03, 0xE3, 0xFC,
-        0x9F, 0x02, 0xE0, 0xF8, 0x1F, 0x03, 0x6B, 0xF6, 0x99, 0x05, 0xA9, 0xF7,
-        0x08, 0xED, 0x23, 0xE0, 0xCD, 0xDB, 0xB5, 0xD1, 0x34, 0xDD, 0x60, 0xD4,
-        0x95, 0xDE, 0xD3, 0xD3, 0x8F, 0xEA, 0xE5, 0xDD, 0x6B, 0xF2, 0xE6, 0xE3,
-        0xA7, 0xF9, 0x20, 0xE6, 0x7F, 0xFE, 0xE0, 0xE6, 0xAE, 0xFF, 0x34, 0xE9,
-        0x49, 0x01, 0x7F, 0xF0, 0x0A, 0x00, 0x95, 0xF8, 0xCD, 0xFC, 0xE7, 0x00,
-        0x81, 0xF6, 0x29, 0x02, 0x54, 0xF6, 0xEF, 0x01, 0xA2, 0xF7, 0xB3, 0xFF,
-        0xB7, 0xFB, 0x5B, 0x01, 0xA0, 0xFC, 0x44, 0x03, 0x01, 0xFD, 0x22, 0x07,
-        0xBE, 0xFC, 0xDF, 0x09, 0x0F, 0xFA, 0x8F, 0x08, 0x9C, 0x12, 0x47, 0x20,
-        0xEF, 0x23, 0xBB, 0x2E, 0x89, 0x22, 0xFB, 0x2B, 0x5B, 0x21, 0x7A, 0x2C,
-        0x24, 0x15, 0x0D, 0x22, 0x77, 0x0D, 0x38, 0x1C, 0xE5, 0x05, 0xBA, 0x19,
-        0x2F, 0x01, 0x2E, 0x19, 0x0D, 0x00, 0xC8, 0x16, 0xE6, 0xFD, 0x02, 0x0F,
-        0x03, 0xFF, 0x01, 0x07, 0x0B, 0x02, 0xAA, 0xFE, 0xBA, 0x08, 0xD7, 0xFD,
-        0x0E, 0x09, 0x19, 0xFE, 0xE4, 0x07, 0x54, 0x00, 0xD4, 0x03, 0x95, 0xFE,
-        0xCA, 0x02, 0x99, 0xFC, 0x7F, 0x02, 0x12, 0xF9, 0x9C, 0x02, 0x2B, 0xF6,
-        0x57, 0x05, 0x5F, 0xF7, 0xD3, 0xEC, 0x87, 0xDF, 0xBF, 0xDB, 0x35, 0xD1,
-        0x44, 0xDD, 0x35, 0xD4, 0x74, 0xDE, 0xC8, 0xD3, 0x96, 0xEA, 0x3A, 0xDE,
-        0x12, 0xF2, 0xBE, 0xE3, 0xAE, 0xF9, 0x29, 0xE6, 0x58, 0xFE, 0x81, 0xE6,
-        0x90, 0xFF, 0xF8, 0xE8, 0x1B, 0x02, 0x13, 0xF1, 0x1B, 0x01, 0xFE, 0xF8,
-        0x46, 0xFE, 0x55, 0x01, 0xAB, 0xF7, 0x22, 0x02, 0x47, 0xF7, 0xBF, 0x01,
-        0xA7, 0xF8, 0xB6, 0xFF, 0xB5, 0xFC, 0x85, 0x01, 0xC6, 0xFD, 0x6D, 0x03,
-        0xEB, 0xFD, 0xB5, 0x06, 0x9E, 0xFD, 0x70, 0x09, 0x00, 0xFB, 0x81, 0x08,
-        0x37, 0x13, 0x57, 0x20, 0x19, 0x24, 0xBF, 0x2E, 0x6B, 0x22, 0xBC, 0x2B,
-        0x48, 0x21, 0x24, 0x2C, 0x53, 0x15, 0xCE, 0x21, 0xB7, 0x0D, 0x0E, 0x1C,
-        0x19, 0x06, 0xB4, 0x19, 0x29, 0x01, 0x45, 0x19, 0xE1, 0xFF, 0xE7, 0x16,
-        0x52, 0xFD, 0xE9, 0x0E, 0x6A, 0xFE, 0x22, 0x07, 0x2B, 0x01, 0xEC, 0xFE,
-        0x7E, 0x07, 0xEC, 0xFD, 0x12, 0x08, 0xB1, 0xFE, 0x87, 0x06, 0x90, 0x00,
-        0x7D, 0x02, 0xA0, 0xFE, 0x6D, 0x01, 0x9F, 0xFC, 0x30, 0x01, 0x2A, 0xF9,
-        0xEF, 0x01, 0xEE, 0xF6, 0x76, 0x04, 0xC8, 0xF7, 0xBB, 0xEC, 0x58, 0xE0,
-        0x01, 0xDC, 0xBB, 0xD1, 0xB3, 0xDD, 0x8F, 0xD4, 0x07, 0xDF, 0x2F, 0xD4,
-        0xE3, 0xEA, 0x66, 0xDE, 0xDA, 0xF2, 0x84, 0xE4, 0x33, 0xFA, 0x8C, 0xE6,
-        0x3A, 0xFF, 0xCE, 0xE6, 0x72, 0x00, 0xFA, 0xE8, 0xD2, 0x02, 0xF6, 0xF0,
-        0xAF, 0x01, 0x00, 0xF9, 0xC0, 0xFE, 0x69, 0x01, 0xA3, 0xF8, 0xD6, 0x02,
-        0xAB, 0xF7, 0xAB, 0x01, 0x59, 0xF9, 0xC8, 0xFF, 0x55, 0xFD, 0x99, 0x01,
-        0x82, 0xFE, 0xAA, 0x03, 0xEC, 0xFE, 0x50, 0x07, 0xF6, 0xFD, 0x29, 0x09,
-        0xB6, 0xFB, 0x6D, 0x08, 0x4A, 0x13, 0xAF, 0x1F, 0x33, 0x24, 0xA2, 0x2E,
-        0x7C, 0x22, 0xFC, 0x2B, 0xE4, 0x20, 0x1E, 0x2C, 0xE9, 0x14, 0xC1, 0x21,
-        0xD7, 0x0C, 0x24, 0x1B, 0xE3, 0x05, 0x44, 0x19, 0xF8, 0x00, 0x25, 0x19,
-        0xBF, 0xFF, 0x0F, 0x17, 0x69, 0xFD, 0x17, 0x0F, 0xA3, 0xFE, 0xFF, 0x06,
-        0xCD, 0x01, 0x9B, 0xFE, 0xE3, 0x07, 0xEC, 0xFC, 0xCC, 0x08, 0x2B, 0xFE,
-        0xD4, 0x06, 0x1C, 0x00, 0xA3, 0x02, 0x69, 0xFE, 0x6D, 0x01, 0x78, 0xFC,
-        0x2A, 0x01, 0xF6, 0xF8, 0x4E, 0x02, 0x36, 0xF7, 0x77, 0x04, 0xD4, 0xF7,
-        0xE2, 0xEC, 0x6F, 0xE0, 0x13, 0xDC, 0x72, 0xD1, 0xE1, 0xDD, 0xE8, 0xD3,
-        0xC6, 0xDF, 0xD8, 0xD3, 0xA1, 0xEB, 0xF3, 0xDD, 0x55, 0xF3, 0x76, 0xE4,
-        0x16, 0xFA, 0x56, 0xE6, 0xED, 0xFE, 0x6A, 0xE6, 0x83, 0x00, 0xAB, 0xE8,
-        0xED, 0x02, 0x7A, 0xF0, 0xC4, 0x01, 0x69, 0xF8, 0x8E, 0xFE, 0xC7, 0x00,
-        0x81, 0xF8, 0xAE, 0x02, 0xE8, 0xF7, 0xC1, 0x01, 0xE6, 0xF9, 0x9C, 0xFF,
-        0x4C, 0xFE, 0x54, 0x01, 0x50, 0xFF, 0xFA, 0x02, 0x4A, 0xFF, 0x67, 0x06,
-        0x09, 0xFE, 0x63, 0x08, 0xD3, 0xFB, 0x1B, 0x08, 0x6E, 0x13, 0xC3, 0x1F,
-        0xE5, 0x23, 0xA7, 0x2E, 0x16, 0x22, 0x4C, 0x2C, 0xEC, 0x1F, 0x4F, 0x2C,
-        0x57, 0x14, 0x84, 0x22, 0xE3, 0x0C, 0x19, 0x1C, 0x21, 0x06, 0xEC, 0x19,
-        0x7B, 0x01, 0xE9, 0x19, 0xB3, 0xFF, 0x81, 0x17, 0x96, 0xFD, 0x42, 0x10,
-        0x9A, 0xFE, 0x7D, 0x08, 0xAC, 0x01, 0x20, 0x00, 0x8E, 0x07, 0xF4, 0xFD,
-        0xE8, 0x07, 0x7F, 0xFE, 0x16, 0x06, 0xC4, 0x00, 0x63, 0x01, 0xCE, 0xFE,
-        0x7C, 0x00, 0x4C, 0xFD, 0x8C, 0x00, 0xBD, 0xF9, 0x0A, 0x02, 0xB6, 0xF7,
-        0x86, 0x04, 0xDF, 0xF7, 0x16, 0xED, 0x22, 0xE0, 0xAE, 0xDC, 0x43, 0xD1,
-        0x23, 0xDE, 0x53, 0xD3, 0x3B, 0xE0, 0x67, 0xD3, 0x86, 0xEB, 0xFA, 0xDC,
-        0x10, 0xF3, 0xA5, 0xE3, 0xD6, 0xF9, 0x0E, 0xE6, 0x5E, 0xFE, 0x09, 0xE6,
-        0x40, 0x00, 0x88, 0xE8, 0x38, 0x02, 0x72, 0xEF, 0x7F, 0x01, 0x3F, 0xF7,
-        0x81, 0xFE, 0x60, 0xFF, 0x9C, 0xF8, 0x8D, 0x01, 0x0E, 0xF8, 0xF1, 0x00,
-        0xBC, 0xF9, 0x9B, 0xFE, 0xA0, 0xFE, 0xC4, 0x00, 0xA3, 0xFF, 0x4C, 0x02,
-        0xE0, 0xFF, 0xFD, 0x05, 0x51, 0xFE, 0xF3, 0x07, 0xC7, 0xFB, 0xD3, 0x07,
-        0x09, 0x13, 0x91, 0x1F, 0x75, 0x23, 0x96, 0x2E, 0x1B, 0x22, 0x92, 0x2C,
-        0xDF, 0x1F, 0x54, 0x2C, 0xA1, 0x14, 0xC2, 0x22, 0xD3, 0x0C, 0xDC, 0x1B,
-        0x4E, 0x06, 0x9E, 0x19, 0xF1, 0x01, 0xDA, 0x19, 0x19, 0x00, 0x64, 0x17,
-        0x38, 0xFE, 0x84, 0x10, 0xB6, 0xFE, 0xA8, 0x08, 0xAC, 0x01, 0xBF, 0x00,
-        0x7B, 0x07, 0x9E, 0xFE, 0x03, 0x08, 0x38, 0xFF, 0x3D, 0x06, 0x72, 0x01,
-        0x74, 0x01, 0x3E, 0xFF, 0x9D, 0x00, 0xC9, 0xFD, 0x69, 0x00, 0x1F, 0xFA,
-        0xF2, 0x01, 0x28, 0xF8, 0x58, 0x04, 0x18, 0xF8, 0x0C, 0xED, 0x45, 0xE0,
-        0x87, 0xDC, 0x30, 0xD1, 0xFA, 0xDD, 0x6D, 0xD3, 0x08, 0xE0, 0xBE, 0xD3,
-        0x29, 0xEB, 0x5A, 0xDD, 0x05, 0xF3, 0x5E, 0xE4, 0x83, 0xF9, 0x7F, 0xE6,
-        0x18, 0xFE, 0x38, 0xE6, 0x17, 0x00, 0xA9, 0xE8, 0xEA, 0x01, 0x91, 0xEF,
-        0x49, 0x01, 0x56, 0xF7, 0x4A, 0xFE, 0x57, 0xFF, 0x69, 0xF8, 0x83, 0x01,
-        0xF1, 0xF7, 0x0A, 0x01, 0xB9, 0xF9, 0xCD, 0xFE, 0x46, 0xFE, 0xCD, 0x00,
-        0xFE, 0xFE, 0x35, 0x02, 0x44, 0xFF, 0xC6, 0x05, 0xE4, 0xFD, 0xDC, 0x07,
-        0xA8, 0xFB, 0xEB, 0x07, 0x06, 0x13, 0xCF, 0x1F, 0x68, 0x23, 0xBF, 0x2E,
-        0xE8, 0x21, 0x6E, 0x2C, 0x2E, 0x20, 0x48, 0x2C, 0x39, 0x15, 0xB0, 0x22,
-        0x7C, 0x0D, 0xA9, 0x1B, 0xD9, 0x06, 0x71, 0x19, 0x05, 0x02, 0xC6, 0x19,
-        0xC3, 0xFF, 0x6A, 0x17, 0xE2, 0xFD, 0x9A, 0x10, 0x80, 0xFE, 0xD9, 0x08,
-        0x49, 0x01, 0x76, 0x00, 0x5E, 0x07, 0x54, 0xFE, 0x06, 0x08, 0xD9, 0xFE,
-        0x82, 0x06, 0x6D, 0x01, 0x27, 0x02, 0xA9, 0xFF, 0x51, 0x01, 0x2F, 0xFE,
-        0xFF, 0x00, 0xA9, 0xFA, 0x3E, 0x02, 0x89, 0xF8, 0x95, 0x04, 0xA8, 0xF8,
-        0x02, 0xED, 0xA5, 0xE0, 0xA6, 0xDC, 0xA6, 0xD1, 0x07, 0xDE, 0xD0, 0xD3,
-        0x9E, 0xDF, 0xCB, 0xD3, 0xD0, 0xEA, 0xB5, 0xDD, 0x88, 0xF2, 0xC8, 0xE4,
-        0x38, 0xF9, 0x28, 0xE7, 0x18, 0xFE, 0xA5, 0xE6, 0x88, 0x00, 0xCA, 0xE8,
-        0x88, 0x02, 0x70, 0xEF, 0x0D, 0x02, 0x1E, 0xF7, 0x35, 0xFF, 0x81, 0xFF,
-        0x94, 0xF8, 0x5B, 0x01, 0x7C, 0xF7, 0xB8, 0x00, 0xCE, 0xF8, 0x1C, 0xFE,
-        0x29, 0xFD, 0x00, 0x00, 0x29, 0xFE, 0xB2, 0x01, 0x6A, 0xFE, 0x2B, 0x05,
-        0x20, 0xFD, 0x35, 0x07, 0xD0, 0xFA, 0xF5, 0x06, 0xA8, 0x12, 0x18, 0x1F,
-        0x47, 0x23, 0x34, 0x2E, 0x08, 0x22, 0x14, 0x2C, 0x65, 0x20, 0x11, 0x2C,
-        0xE2, 0x14, 0xE5, 0x21, 0x4B, 0x0D, 0xE9, 0x1A, 0xE2, 0x06, 0xBA, 0x18,
-        0x04, 0x02, 0x45, 0x19, 0xB8, 0xFF, 0x4E, 0x17, 0x85, 0xFD, 0x93, 0x10,
-        0x18, 0xFE, 0x07, 0x09, 0x19, 0x01, 0xD9, 0x00, 0x0D, 0x08, 0x1C, 0xFF,
-        0x23, 0x09, 0x94, 0xFF, 0x93, 0x07, 0xEF, 0x01, 0x1F, 0x03, 0x14, 0x00,
-        0x23, 0x02, 0x80, 0xFE, 0xF6, 0x01, 0x48, 0xFB, 0x3B, 0x03, 0x41, 0xF9,
-        0x50, 0x05, 0x45, 0xF9, 0x59, 0xED, 0x00, 0xE1, 0x97, 0xDC, 0xDA, 0xD1,
-        0xE1, 0xDD, 0x2A, 0xD4, 0xB3, 0xDF, 0x6B, 0xD4, 0x50, 0xEB, 0xC2, 0xDE,
-        0xCB, 0xF2, 0x9C, 0xE5, 0x12, 0xF9, 0xB0, 0xE7, 0x0C, 0xFE, 0x36, 0xE7,
-        0x25, 0x00, 0xE9, 0xE8, 0x41, 0x02, 0x76, 0xEF, 0xB7, 0x01, 0xDE, 0xF6,
-        0xB7, 0xFE, 0xEE, 0xFE, 0x2D, 0xF8, 0x13, 0x01, 0x36, 0xF7, 0xE0, 0x00,
-        0xDC, 0xF8, 0xAA, 0xFE, 0xFE, 0xFC, 0x33, 0x00, 0xBD, 0xFD, 0x76, 0x01,
-        0xFB, 0xFD, 0x92, 0x04, 0xAE, 0xFC, 0x75, 0x06, 0xC6, 0xFA, 0xBE, 0x06,
-        0x80, 0x12, 0xE1, 0x1E, 0x56, 0x23, 0x31, 0x2E, 0xEA, 0x21, 0xC5, 0x2B,
-        0xF3, 0x1F, 0x5D, 0x2B, 0x69, 0x14, 0x0B, 0x21, 0xD2, 0x0C, 0x3E, 0x1A,
-        0x93, 0x06, 0x44, 0x18, 0x56, 0x01, 0x8D, 0x18, 0x9C, 0xFF, 0x41, 0x17,
-        0xAE, 0xFD, 0xC6, 0x10, 0x19, 0xFE, 0x39, 0x09, 0x0B, 0x01, 0x16, 0x01,
-        0x14, 0x07, 0x78, 0xFE, 0x60, 0x08, 0xDC, 0xFE, 0x06, 0x07, 0x47, 0x01,
-        0x4B, 0x03, 0x16, 0x00, 0x9B, 0x02, 0xCC, 0xFE, 0x30, 0x02, 0xA6, 0xFB,
-        0x98, 0x03, 0xE2, 0xF9, 0x9D, 0x05, 0x9E, 0xF9, 0x19, 0xEE, 0x73, 0xE1,
-        0x26, 0xDD, 0xD6, 0xD1, 0x9E, 0xDE, 0x1B, 0xD4, 0xBD, 0xE0, 0xCF, 0xD4,
-        0x1C, 0xEC, 0x13, 0xDF, 0x9A, 0xF3, 0xEB, 0xE5, 0xCB, 0xF9, 0xDE, 0xE7,
-        0x13, 0xFF, 0xB7, 0xE7, 0xBE, 0x00, 0xEB, 0xE8, 0xAB, 0x02, 0x97, 0xEF,
-        0x36, 0x02, 0x4C, 0xF7, 0x27, 0xFF, 0x5F, 0xFF, 0xFD, 0xF8, 0xD9, 0x01,
-        0x65, 0xF7, 0x3E, 0x01, 0x92, 0xF8, 0x96, 0xFE, 0x5B, 0xFC, 0xE9, 0xFF,
-        0x0C, 0xFD, 0x46, 0x01, 0x7D, 0xFD, 0x5E, 0x04, 0x01, 0xFC, 0xE4, 0x05,
-        0xE0, 0xF9, 0x03, 0x06, 0x99, 0x11, 0x5D, 0x1E, 0x8C, 0x22, 0x1D, 0x2E,
-        0xDC, 0x20, 0xC1, 0x2B, 0x7D, 0x1E, 0xD3, 0x2A, 0x49, 0x13, 0xA4, 0x20,
-        0x13, 0x0C, 0x1B, 0x1A, 0xC7, 0x05, 0x05, 0x18, 0x77, 0x00, 0x51, 0x18,
-        0x57, 0xFE, 0xD8, 0x16, 0x5A, 0xFC, 0x22, 0x10, 0x13, 0xFD, 0x89, 0x08,
-        0x7A, 0x00, 0xCA, 0x00, 0x1D, 0x07, 0xA3, 0xFE, 0x88, 0x08, 0x14, 0xFF,
-        0x20, 0x07, 0xA2, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0x79, 0x02, 0xCB, 0xFE,
-        0x2F, 0x02, 0xF7, 0xFB, 0x9C, 0x03, 0x67, 0xFA, 0xB2, 0x05, 0x5C, 0xFA,
-        0x95, 0xED, 0x97, 0xE1, 0xF9, 0xDC, 0x20, 0xD2, 0xF3, 0xDE, 0x89, 0xD4,
-        0x76, 0xE1, 0x71, 0xD5, 0x75, 0xEC, 0x67, 0xDF, 0x88, 0xF3, 0xC0, 0xE5,
-        0x16, 0xFA, 0x3E, 0xE8, 0x53, 0xFF, 0xC8, 0xE7, 0xD4, 0x01, 0x92, 0xE9,
-        0x9B, 0x03, 0x03, 0xF0, 0xB5, 0x02, 0x64, 0xF7, 0x2C, 0xFF, 0x15, 0xFF,
-        0x60, 0xF8, 0x06, 0x01, 0x5B, 0xF7, 0xFC, 0x00, 0x0E, 0xF9, 0x62, 0xFE,
-        0x8D, 0xFD, 0x29, 0x00, 0xEF, 0xFD, 0x08, 0x01, 0x62, 0xFE, 0xDC, 0x03,
-        0x18, 0xFD, 0x81, 0x05, 0xFE, 0xFA, 0x79, 0x05, 0x46, 0x13, 0x4C, 0x1E,
-        0x8C, 0x23, 0x5B, 0x2D, 0x93, 0x21, 0xF1, 0x2A, 0x33, 0x1F, 0x3A, 0x2A,
-        0x3F, 0x14, 0x4B, 0x20, 0xDF, 0x0C, 0xBC, 0x19, 0x34, 0x06, 0x04, 0x17,
-        0x26, 0x01, 0x9F, 0x17, 0xAB, 0xFE, 0xE6, 0x15, 0x0F, 0xFD, 0xA8, 0x0F,
-        0xD5, 0xFD, 0x39, 0x08, 0x1F, 0x01, 0x39, 0x00, 0xE9, 0x07, 0x35, 0xFE,
-        0x0E, 0x09, 0x4E, 0xFE, 0x5E, 0x07, 0x0A, 0x01, 0xF4, 0x02, 0x9C, 0xFF,
-        0x53, 0x02, 0xC6, 0xFE, 0x64, 0x01, 0xBA, 0xFB, 0x9D, 0x02, 0x01, 0xFA,
-        0xD5, 0x04, 0x15, 0xFA, 0xDA, 0xEC, 0x6D, 0xE1, 0xA7, 0xDC, 0x5C, 0xD2,
-        0x97, 0xDE, 0xAC, 0xD4, 0xC6, 0xE0, 0x28, 0xD5, 0xEB, 0xEB, 0x52, 0xDF,
-        0xA8, 0xF3, 0x38, 0xE6, 0xFC, 0xF9, 0xD6, 0xE8, 0xD4, 0xFE, 0x53, 0xE8,
-        0x0D, 0x01, 0xFA, 0xE9, 0xA1, 0x02, 0x68, 0xF0, 0xE6, 0x01, 0xCE, 0xF7,
-        0xDE, 0xFE, 0x12, 0x00, 0x0C, 0xF8, 0xF3, 0x01, 0x9A, 0xF6, 0xA5, 0x01,
-        0x4E, 0xF8, 0xF8, 0xFE, 0x61, 0xFC, 0xE6, 0xFF, 0x5A, 0xFD, 0xFD, 0x00,
-        0x9E, 0xFE, 0x1F, 0x04, 0x5D, 0xFD, 0xE7, 0x05, 0x06, 0xFB, 0xC6, 0x05,
-        0xA1, 0x12, 0x69, 0x1E, 0xE3, 0x22, 0xA0, 0x2D, 0xE3, 0x20, 0x5F, 0x2B,
-        0x13, 0x1F, 0x3A, 0x2B, 0xE2, 0x13, 0xF4, 0x20, 0x46, 0x0C, 0x35, 0x1A,
-        0x33, 0x06, 0xBD, 0x17, 0x2E, 0x01, 0xE3, 0x17, 0xFB, 0xFE, 0xFB, 0x15,
-        0x78, 0xFD, 0x7A, 0x0F, 0x7C, 0xFE, 0x4E, 0x08, 0x83, 0x01, 0x32, 0x00,
-        0x4F, 0x08, 0x82, 0xFE, 0xA6, 0x09, 0xB5, 0xFE, 0xDB, 0x07, 0x39, 0x01,
-        0xE6, 0x03, 0x68, 0x00, 0xEF, 0x02, 0x32, 0xFF, 0x71, 0x01, 0x00, 0xFC,
-        0xB2, 0x02, 0x34, 0xFA, 0xFA, 0x04, 0x2E, 0xFA, 0x5C, 0xED, 0x5B, 0xE1,
-        0x5F, 0xDD, 0x37, 0xD2, 0x43, 0xDF, 0x69, 0xD4, 0x03, 0xE1, 0x73, 0xD4,
-        0xD9, 0xEB, 0xA4, 0xDE, 0x5A, 0xF3, 0x38, 0xE5, 0x99, 0xF9, 0xE0, 0xE7,
-        0xED, 0xFE, 0x27, 0xE8, 0x52, 0x01, 0x5C, 0xEA, 0x51, 0x02, 0x8C, 0xF0,
-        0x34, 0x01, 0xB3, 0xF7, 0x05, 0xFE, 0x97, 0xFF, 0x92, 0xF7, 0x4B, 0x01,
-        0x7F, 0xF6, 0x2C, 0x01, 0x42, 0xF8, 0x7D, 0xFE, 0x63, 0xFC, 0x62, 0xFF,
-        0x18, 0xFD, 0x57, 0x00, 0xCD, 0xFE, 0x92, 0x03, 0x5F, 0xFD, 0xFC, 0x04,
-        0x48, 0xFB, 0x1F, 0x05, 0x18, 0x13, 0x1D, 0x1E, 0x04, 0x23, 0x24, 0x2D,
-        0x69, 0x21, 0x4C, 0x2B, 0x88, 0x1F, 0x05, 0x2B, 0x05, 0x15, 0xF1, 0x20,
-        0x28, 0x0D, 0x1C, 0x1A, 0x8F, 0x06, 0x46, 0x17, 0xFD, 0x00, 0xE0, 0x16,
-        0x6F, 0xFE, 0xDD, 0x14, 0xE2, 0xFD, 0x2C, 0x0F, 0xAF, 0xFE, 0xCF, 0x07,
-        0x28, 0x02, 0x3C, 0x00, 0x52, 0x08, 0x79, 0xFE, 0x92, 0x09, 0xDE, 0xFE,
-        0x11, 0x08, 0xE9, 0x01, 0x98, 0x03, 0xB8, 0x00, 0x1A, 0x03, 0xE4, 0xFF,
-        0x28, 0x01, 0x96, 0xFC, 0xE3, 0x02, 0x9A, 0xFB, 0xDA, 0x04, 0x96, 0xFB,
-        0xD2, 0xEC, 0x9A, 0xE2, 0xB1, 0xDC, 0x7C, 0xD3, 0xF9, 0xDD, 0xEF, 0xD4,
-        0xF5, 0xDF, 0x5C, 0xD5, 0x54, 0xEA, 0x50, 0xDF, 0x7A, 0xF2, 0x58, 0xE6,
-        0x11, 0xF9, 0x15, 0xE9, 0xA6, 0xFE, 0x58, 0xE9, 0x32, 0x01, 0x28, 0xEB,
-        0xF9, 0x01, 0xE7, 0xF0, 0x5E, 0x01, 0x93, 0xF8, 0x99, 0xFD, 0xF8, 0xFF,
-        0x78, 0xF7, 0xCB, 0x01, 0xE8, 0xF5, 0x3A, 0x01, 0x43, 0xF7, 0xFE, 0xFD,
-        0xF6, 0xFB, 0x5C, 0xFF, 0x6E, 0xFC, 0x2F, 0x00, 0x64, 0xFE, 0x68, 0x03,
-        0xCE, 0xFC, 0x66, 0x04, 0xE8, 0xFA, 0x47, 0x04, 0x36, 0x13, 0x38, 0x1D,
-        0x8C, 0x23, 0x67, 0x2C, 0x25, 0x22, 0xD1, 0x2A, 0x25, 0x20, 0x8E, 0x2A,
-        0x9D, 0x15, 0x7E, 0x20, 0x66, 0x0D, 0xAD, 0x19, 0xD7, 0x06, 0x00, 0x17,
-        0x5F, 0x01, 0xE3, 0x16, 0xB1, 0xFE, 0x10, 0x15, 0x93, 0xFD, 0x06, 0x0F,
-        0x75, 0xFE, 0x88, 0x07, 0x70, 0x02, 0x30, 0x00, 0xA3, 0x08, 0x36, 0xFE,
-        0x15, 0x0A, 0x65, 0xFE, 0xB3, 0x08, 0x9C, 0x01, 0xFF, 0x03, 0x3F, 0x00,
-        0x92, 0x03, 0xA5, 0xFF, 0xE6, 0x01, 0xE4, 0xFC, 0xFE, 0x02, 0x90, 0xFB,
-        0xD6, 0x04, 0xD1, 0xFB, 0x29, 0xEC, 0xC3, 0xE2, 0xA7, 0xDB, 0xA6, 0xD3,
-        0x62, 0xDD, 0x8A, 0xD5, 0x22, 0xDF, 0x76, 0xD5, 0xF3, 0xE9, 0x88, 0xDF,
-        0x47, 0xF2, 0x1D, 0xE6, 0xFA, 0xF8, 0xCC, 0xE8, 0x7B, 0xFE, 0xED, 0xE8,
-        0x3A, 0x01, 0xD6, 0xEA, 0x7B, 0x02, 0xF7, 0xF0, 0x14, 0x01, 0xE2, 0xF7,
-        0x1F, 0xFD, 0x4C, 0xFF, 0xF3, 0xF6, 0x5E, 0x01, 0xA8, 0xF5, 0x77, 0x01,
-        0x01, 0xF7, 0x52, 0xFE, 0xCD, 0xFB, 0xA9, 0xFF, 0x50, 0xFC, 0x2B, 0x00,
-        0xE4, 0xFD, 0xA4, 0x02, 0x28, 0xFD, 0x5D, 0x04, 0x49, 0xFB, 0x19, 0x04,
-        0x20, 0x14, 0x61, 0x1D, 0xB1, 0x24, 0x8D, 0x2C, 0xAA, 0x22, 0x7E, 0x2A,
-        0x15, 0x21, 0xE9, 0x2A, 0xE5, 0x15, 0xC6, 0x20, 0x3F, 0x0D, 0x44, 0x1A,
-        0x8D, 0x06, 0xB3, 0x17, 0x2A, 0x01, 0x8D, 0x17, 0x8B, 0xFE, 0x78, 0x15,
-        0x56, 0xFD, 0x43, 0x0F, 0xDC, 0xFE, 0x49, 0x08, 0x9E, 0x02, 0x8E, 0x00,
-        0xCE, 0x08, 0x75, 0xFE, 0x77, 0x0A, 0x79, 0xFE, 0x4D, 0x09, 0xA2, 0x01,
-        0x8A, 0x04, 0x3A, 0x00, 0xC1, 0x03, 0x8B, 0xFF, 0x2D, 0x02, 0x20, 0xFD,
-        0xF0, 0x02, 0x4B, 0xFB, 0xF2, 0x04, 0x9F, 0xFB, 0x2C, 0xEC, 0x37, 0xE2,
-        0x7C, 0xDB, 0xEB, 0xD2, 0x92, 0xDD, 0xF6, 0xD4, 0x06, 0xDF, 0x69, 0xD4,
-        0x87, 0xEA, 0xDE, 0xDE, 0x71, 0xF3, 0x61, 0xE5, 0xD8, 0xF9, 0xC3, 0xE7,
-        0x05, 0xFF, 0xE4, 0xE7, 0x90, 0x01, 0x2E, 0xEA, 0xC6, 0x02, 0x90, 0xF0,
-        0x7A, 0x01, 0xDD, 0xF7, 0xD9, 0xFD, 0xAA, 0xFF, 0x55, 0xF7, 0x3F, 0x01,
-        0x82, 0xF5, 0x02, 0x01, 0x9A, 0xF6, 0xD1, 0xFD, 0x94, 0xFB, 0x7A, 0xFF,
-        0x9F, 0xFC, 0x65, 0x00, 0x3E, 0xFE, 0x00, 0x03, 0x57, 0xFD, 0xCE, 0x04,
-        0x03, 0xFB, 0x70, 0x04, 0xB8, 0x13, 0xF8, 0x1D, 0x2F, 0x24, 0x36, 0x2D,
-        0x45, 0x22, 0x5B, 0x2B, 0xF0, 0x20, 0xEF, 0x2B, 0x7A, 0x15, 0x4C, 0x21,
-        0xCB, 0x0C, 0xE9, 0x1A, 0xA7, 0x06, 0xA5, 0x18, 0xB9, 0x01, 0x89, 0x18,
-        0xF4, 0xFE, 0xD4, 0x15, 0xB6, 0xFD, 0x54, 0x0F, 0x9C, 0xFE, 0xB0, 0x07,
-        0x57, 0x02, 0x15, 0x00, 0x1D, 0x09, 0x2E, 0xFF, 0x94, 0x0A, 0x39, 0xFF,
-        0x54, 0x09, 0x60, 0x02, 0x1D, 0x04, 0x63, 0x00, 0x2F, 0x03, 0x6F, 0xFF,
-        0x83, 0x01, 0xAA, 0xFC, 0x82, 0x02, 0xC5, 0xFA, 0x03, 0x05, 0x3B, 0xFB,
-        0x68, 0xEC, 0xAF, 0xE1, 0x4D, 0xDC, 0xD5, 0xD2, 0x0B, 0xDE, 0x99, 0xD4,
-        0x65, 0xDF, 0x35, 0xD4, 0x66, 0xEA, 0xBB, 0xDE, 0xE8, 0xF2, 0x00, 0xE5,
-        0x09, 0xF9, 0x50, 0xE7, 0xF4, 0xFD, 0x62, 0xE7, 0xE8, 0x00, 0x43, 0xEA,
-        0x19, 0x02, 0xBB, 0xF0, 0x70, 0x01, 0x6C, 0xF8, 0x97, 0xFD, 0xE0, 0xFF,
-        0xE0, 0xF6, 0xAD, 0x00, 0xC0, 0xF5, 0xD8, 0x00, 0x0D, 0xF7, 0xFA, 0xFD,
-        0x29, 0xFC, 0x26, 0x00, 0xCD, 0xFC, 0x2B, 0x01, 0x7B, 0xFE, 0x18, 0x04,
-        0x78, 0xFD, 0x28, 0x06, 0x01, 0xFB, 0xB0, 0x05, 0x7A, 0x13, 0x07, 0x1F,
-        0xB4, 0x23, 0xC9, 0x2D, 0x1E, 0x22, 0xEF, 0x2B, 0x09, 0x21, 0x42, 0x2C,
-        0x6E, 0x16, 0xDA, 0x21, 0xEF, 0x0D, 0x8F, 0x1B, 0x78, 0x07, 0x0F, 0x19,
-        0x4D, 0x02, 0xEE, 0x18, 0x8A, 0xFF, 0x35, 0x16, 0x3B, 0xFE, 0x9D, 0x0F,
-        0xFF, 0xFE, 0x16, 0x08, 0x96, 0x02, 0x56, 0x00, 0xF8, 0x08, 0x4C, 0xFF,
-        0x31, 0x0A, 0x3C, 0xFF, 0xF9, 0x08, 0xE5, 0x01, 0x4A, 0x04, 0xC8, 0xFF,
-        0x8A, 0x03, 0x95, 0xFE, 0x0A, 0x02, 0xDE, 0xFB, 0xDD, 0x02, 0xD6, 0xF9,
-        0x4B, 0x05, 0x72, 0xFA, 0xE1, 0xEC, 0x76, 0xE1, 0x30, 0xDC, 0x69, 0xD2,
-        0xC5, 0xDD, 0x8C, 0xD4, 0x70, 0xDE, 0x03, 0xD4, 0x27, 0xE9, 0xA1, 0xDE,
-        0xC8, 0xF1, 0xBC, 0xE4, 0xB5, 0xF8, 0x44, 0xE7, 0x26, 0xFE, 0x45, 0xE7,
-        0x8F, 0x00, 0xA0, 0xE9, 0x0F, 0x02, 0x7F, 0xF0, 0xDF, 0x00, 0x9E, 0xF7,
-        0xAA, 0xFD, 0xD0, 0xFF, 0x63, 0xF7, 0xE4, 0x00, 0xFA, 0xF5, 0xBE, 0x00,
-        0x06, 0xF7, 0x4E, 0xFE, 0x58, 0xFB, 0x6F, 0x00, 0x64, 0xFC, 0xFE, 0x01,
-        0x89, 0xFD, 0x36, 0x04, 0xEE, 0xFC, 0x57, 0x06, 0x78, 0xFA, 0x76, 0x05,
-        0xED, 0x12, 0x9C, 0x1E, 0xE0, 0x23, 0xDA, 0x2D, 0x2E, 0x22, 0xA4, 0x2B,
-        0xD3, 0x21, 0x60, 0x2C, 0xB5, 0x16, 0x82, 0x21, 0x4D, 0x0E, 0xF3, 0x1B,
-        0xFC, 0x06, 0x87, 0x19, 0x8A, 0x01, 0xC3, 0x19, 0x3C, 0xFF, 0x48, 0x17,
-        0x86, 0xFD, 0xE2, 0x0F, 0x31, 0xFF, 0xFE, 0x08, 0x4E, 0x02, 0x82, 0x00,
-        0xC4, 0x08, 0xA4, 0xFF, 0x27, 0x0A, 0xBA, 0xFF, 0x3D, 0x09, 0xF3, 0x01,
-        0x08, 0x05, 0xA4, 0xFF, 0xEE, 0x03, 0x10, 0xFE, 0x1B, 0x03, 0x4D, 0xFC,
-        0x74, 0x03, 0x31, 0xFA, 0xE7, 0x05, 0x20, 0xFB, 0x16, 0xED, 0x98, 0xE1,
-        0x24, 0xDC, 0x3E, 0xD2, 0xC4, 0xDD, 0x66, 0xD4, 0x35, 0xDE, 0xC5, 0xD3,
-        0x7A, 0xE9, 0xBD, 0xDE, 0xA9, 0xF1, 0xE0, 0xE3, 0x26, 0xF9, 0x16, 0xE6,
-        0x85, 0xFE, 0xB8, 0xE5, 0xCF, 0x00, 0x80, 0xE8, 0x7D, 0x02, 0x39, 0xF0,
-        0x7B, 0x00, 0x00, 0xF7, 0x1F, 0xFD, 0x55, 0xFF, 0xD3, 0xF6, 0x1F, 0x00,
-        0xBD, 0xF5, 0x33, 0x00, 0xC1, 0xF6, 0x28, 0xFE, 0x10, 0xFB, 0xB2, 0x00,
-        0xEB, 0xFB, 0xF4, 0x01, 0xB5, 0xFC, 0x83, 0x03, 0x47, 0xFC, 0x68, 0x05,
-        0xF9, 0xF9, 0x99, 0x04, 0xF7, 0x12, 0x83, 0x1E, 0xFE, 0x23, 0x1E, 0x2E,
-        0x6A, 0x22, 0x2C, 0x2C, 0xA6, 0x21, 0x7D, 0x2C, 0x58, 0x16, 0x73, 0x21,
-        0x20, 0x0E, 0x69, 0x1C, 0xB3, 0x06, 0x60, 0x1A, 0x4D, 0x01, 0xAB, 0x1A,
-        0x3F, 0xFF, 0xBF, 0x17, 0xC5, 0xFD, 0xE4, 0x0F, 0xE3, 0xFF, 0x03, 0x09,
-        0x82, 0x03, 0xED, 0x00, 0x5D, 0x09, 0x06, 0x00, 0x78, 0x0A, 0x36, 0x00,
-        0x7A, 0x09, 0x58, 0x02, 0x26, 0x05, 0xAE, 0xFF, 0x53, 0x04, 0x78, 0xFE,
-        0x5B, 0x03, 0xBE, 0xFC, 0x04, 0x04, 0x0A, 0xFB, 0x51, 0x06, 0xC6, 0xFB,
-        0x75, 0xED, 0xC0, 0xE1, 0x48, 0xDC, 0xC6, 0xD1, 0xDA, 0xDD, 0x86, 0xD3,
-        0xE2, 0xDE, 0x7A, 0xD3, 0x41, 0xEA, 0xA6, 0xDE, 0x64, 0xF2, 0x92, 0xE3,
-        0x82, 0xF9, 0x51, 0xE5, 0xBC, 0xFE, 0xF5, 0xE4, 0x6C, 0x00, 0xD7, 0xE7,
-        0xE0, 0x01, 0xDF, 0xEF, 0x01, 0x00, 0x29, 0xF7, 0x94, 0xFC, 0x52, 0xFF,
-        0x00, 0xF7, 0x2E, 0x00, 0xB8, 0xF5, 0x86, 0xFF, 0x74, 0xF6, 0x11, 0xFD,
-        0xDA, 0xFA, 0xDC, 0xFF, 0xD9, 0xFB, 0x54, 0x01, 0xF3, 0xFC, 0x40, 0x03,
-        0x19, 0xFC, 0xF4, 0x04, 0xA0, 0xF9, 0x27, 0x04, 0x5A, 0x12, 0x2B, 0x1E,
-        0x92, 0x23, 0x56, 0x2E, 0xFD, 0x21, 0x9F, 0x2C, 0xAE, 0x20, 0x59, 0x2C,
-        0x26, 0x15, 0xFA, 0x20, 0x0C, 0x0D, 0x11, 0x1C, 0x2D, 0x06, 0x81, 0x1A,
-        0x1B, 0x01, 0xE5, 0x1A, 0xAD, 0xFF, 0x19, 0x18, 0x4B, 0xFE, 0x07, 0x10,
-        0xDB, 0xFF, 0x81, 0x08, 0x48, 0x03, 0x8D, 0x00, 0xD6, 0x08, 0xF4, 0xFF,
-        0x13, 0x0A, 0xE4, 0x00, 0x54, 0x09, 0x6A, 0x03, 0xD0, 0x04, 0x7F, 0x00,
-        0xBA, 0x03, 0xEB, 0xFE, 0xBF, 0x02, 0xF3, 0xFC, 0xB7, 0x03, 0x29, 0xFB,
-        0x45, 0x06, 0xE3, 0xFB, 0xA3, 0xED, 0xE7, 0xE1, 0x7F, 0xDC, 0xCC, 0xD1,
-        0x0A, 0xDE, 0x7A, 0xD3, 0x56, 0xDF, 0xC8, 0xD3, 0xD1, 0xEA, 0x0B, 0xDF,
-        0xEA, 0xF2, 0xED, 0xE3, 0xD5, 0xF9, 0x94, 0xE5, 0xF1, 0xFE, 0x61, 0xE5,
-        0x46, 0x00, 0x33, 0xE8, 0x83, 0x01, 0x32, 0xF0, 0x0A, 0x00, 0x9C, 0xF7,
-        0x66, 0xFC, 0x33, 0xFF, 0xC2, 0xF6, 0x7F, 0xFF, 0xE1, 0xF5, 0xB4, 0xFE,
-        0xB0, 0xF6, 0x37, 0xFC, 0x13, 0xFB, 0xF6, 0xFE, 0x2B, 0xFC, 0x7E, 0x00,
-        0x1F, 0xFD, 0x79, 0x02, 0x3E, 0xFC, 0x95, 0x04, 0xE2, 0xF9, 0x1F, 0x04,
-        0x6D, 0x12, 0xFB, 0x1D, 0x86, 0x23, 0x03, 0x2E, 0x2F, 0x22, 0x5A, 0x2C,
-        0x36, 0x21, 0x5E, 0x2C, 0xB6, 0x15, 0x32, 0x21, 0x59, 0x0D, 0x23, 0x1C,
-        0x1F, 0x06, 0x2C, 0x1A, 0xD8, 0x00, 0x0C, 0x1A, 0xB5, 0xFF, 0x37, 0x17,
-        0x82, 0xFE, 0x3B, 0x0F, 0x01, 0x00, 0xF3, 0x07, 0x9A, 0x03, 0x74, 0x00,
-        0x3C, 0x09, 0x33, 0x00, 0xE1, 0x09, 0xD3, 0x00, 0x51, 0x09, 0x6C, 0x03,
-        0x60, 0x05, 0x1E, 0x01, 0x02, 0x04, 0x74, 0xFF, 0xF1, 0x02, 0x54, 0xFD,
-        0xA3, 0x03, 0xE8, 0xFA, 0xE4, 0x05, 0x3C, 0xFB, 0x78, 0xED, 0x9A, 0xE1,
-        0x52, 0xDC, 0x9D, 0xD1, 0x3E, 0xDD, 0x2A, 0xD3, 0xED, 0xDD, 0xF1, 0xD2,
-        0xA1, 0xE9, 0x38, 0xDE, 0x2C, 0xF2, 0x67, 0xE3, 0x83, 0xF9, 0x73, 0xE5,
-        0x79, 0xFE, 0x82, 0xE5, 0x7B, 0xFF, 0x62, 0xE8, 0xB1, 0x00, 0x84, 0xF0,
-        0x7A, 0xFF, 0xE2, 0xF7, 0x3D, 0xFC, 0xA4, 0xFF, 0xC2, 0xF6, 0xDB, 0xFF,
-        0x33, 0xF6, 0x47, 0xFF, 0x54, 0xF6, 0x5E, 0xFC, 0x11, 0xFA, 0x63, 0xFE,
-        0xB9, 0xFB, 0x25, 0x00, 0xFD, 0xFC, 0x63, 0x02, 0x4D, 0xFC, 0xDB, 0x04,
-        0x0D, 0xFA, 0x80, 0x04, 0x6E, 0x12, 0x14, 0x1E, 0x9B, 0x23, 0x0E, 0x2E,
-        0xF3, 0x22, 0x8F, 0x2C, 0x10, 0x22, 0x9D, 0x2C, 0x18, 0x16, 0x41, 0x21,
-        0x82, 0x0D, 0x26, 0x1C, 0x3A, 0x06, 0x46, 0x1A, 0x94, 0x01, 0x55, 0x1A,
-        0x81, 0x00, 0x29, 0x17, 0x3D, 0xFF, 0xDF, 0x0E, 0x5B, 0x00, 0x66, 0x07,
-        0x83, 0x03, 0xAF, 0xFF, 0x00, 0x09, 0x92, 0xFF, 0xA3, 0x09, 0x46, 0x00,
-        0x91, 0x09, 0x16, 0x03, 0xBB, 0x05, 0xF8, 0x00, 0xF9, 0x03, 0x44, 0xFF,
-        0x8E, 0x02, 0xE5, 0xFC, 0x53, 0x03, 0x82, 0xFA, 0x5C, 0x05, 0xB4, 0xFA,
-        0x08, 0xED, 0x19, 0xE1, 0xEA, 0xDB, 0x32, 0xD1, 0xAB, 0xDC, 0xDC, 0xD2,
-        0xE3, 0xDD, 0x05, 0xD3, 0xB2, 0xE9, 0x18, 0xDE, 0x45, 0xF2, 0x0D, 0xE3,
-        0x7C, 0xF9, 0xDE, 0xE4, 0x47, 0xFE, 0x24, 0xE5, 0x6C, 0xFF, 0xB9, 0xE8,
-        0xC8, 0x00, 0x4F, 0xF1, 0xA7, 0xFF, 0xEA, 0xF8, 0x78, 0xFC, 0xA3, 0x00,
-        0x29, 0xF7, 0xD9, 0x00, 0x5E, 0xF6, 0xF1, 0xFF, 0xC6, 0xF6, 0x83, 0xFD,
-        0x95, 0xFA, 0x7B, 0xFF, 0x37, 0xFC, 0xE9, 0x00, 0x8B, 0xFD, 0x13, 0x03,
-        0xBF, 0xFC, 0x4B, 0x05, 0xDD, 0xFA, 0x18, 0x05, 0x01, 0x13, 0x62, 0x1E,
-        0x15, 0x24, 0x39, 0x2E, 0x0E, 0x23, 0x3D, 0x2C, 0xD3, 0x21, 0x3B, 0x2C,
-        0x28, 0x16, 0x7C, 0x21, 0x5D, 0x0D, 0x6A, 0x1C, 0xF7, 0x05, 0x92, 0x1A,
-        0x0D, 0x01, 0xFD, 0x19, 0x34, 0x00, 0xAE, 0x16, 0xEF, 0xFE, 0x1C, 0x0E,
-        0x35, 0x00, 0x98, 0x06, 0x3D, 0x03, 0xCA, 0xFE, 0x79, 0x08, 0x9C, 0xFE,
-        0x6B, 0x09, 0xD1, 0xFF, 0xD4, 0x08, 0x2B, 0x02, 0x06, 0x05, 0x5B, 0x00,
-        0x65, 0x03, 0x1B, 0xFF, 0x28, 0x02, 0x07, 0xFD, 0xDD, 0x02, 0xCB, 0xFA,
-        0xE3, 0x04, 0x49, 0xFB, 0xCC, 0xEC, 0x2F, 0xE2, 0x7D, 0xDB, 0x23, 0xD2,
-        0x60, 0xDC, 0xED, 0xD3, 0x57, 0xDD, 0x70, 0xD3, 0x4B, 0xE9, 0x32, 0xDE,
-        0x86, 0xF2, 0x7B, 0xE3, 0x54, 0xFA, 0xA4, 0xE5, 0x42, 0xFF, 0x30, 0xE6,
-        0x01, 0x00, 0x4B, 0xE9, 0x60, 0x01, 0xC9, 0xF1, 0x35, 0x00, 0x60, 0xF9,
-        0x52, 0xFD, 0x42, 0x01, 0xF0, 0xF7, 0x34, 0x01, 0xE9, 0xF6, 0xEC, 0xFF,
-        0x80, 0xF7, 0x80, 0xFD, 0x82, 0xFB, 0x7E, 0xFF, 0x2C, 0xFD, 0xD2, 0x00,
-        0x64, 0xFE, 0x0C, 0x03, 0x94, 0xFD, 0x69, 0x05, 0x36, 0xFB, 0x80, 0x04,
-        0x1B, 0x13, 0x5C, 0x1D, 0x79, 0x24, 0x71, 0x2D, 0xBC, 0x23, 0xCA, 0x2B,
-        0xA9, 0x22, 0x69, 0x2C, 0x8E, 0x16, 0xB2, 0x21, 0x3A, 0x0D, 0x72, 0x1C,
-        0x9A, 0x05, 0x61, 0x1A, 0xDE, 0x00, 0xFF, 0x19, 0x02, 0x00, 0xDF, 0x16,
-        0x8E, 0xFE, 0x6F, 0x0E, 0x86, 0xFF, 0xAB, 0x06, 0xA3, 0x02, 0x0B, 0xFF,
-        0x23, 0x08, 0x0A, 0xFF, 0xFE, 0x08, 0x11, 0x00, 0x74, 0x08, 0x6F, 0x02,
-        0x6D, 0x04, 0x6C, 0x00, 0x04, 0x03, 0x3F, 0xFF, 0xDA, 0x01, 0xDE, 0xFC,
-        0xAF, 0x02, 0x52, 0xFA, 0xDB, 0x04, 0x24, 0xFB, 0xE9, 0xEC, 0x68, 0xE2,
-        0x92, 0xDB, 0x88, 0xD2, 0x60, 0xDC, 0x68, 0xD4, 0xED, 0xDD, 0x2F, 0xD4,
-        0xEC, 0xE9, 0xA7, 0xDE, 0x4E, 0xF3, 0x09, 0xE4, 0xB7, 0xFA, 0xFB, 0xE5,
-        0x98, 0xFF, 0xAE, 0xE6, 0x95, 0x00, 0xCD, 0xE9, 0xD4, 0x01, 0xF5, 0xF1,
-        0xC9, 0x00, 0x87, 0xF9, 0x1C, 0xFD, 0x9E, 0x00, 0xBD, 0xF7, 0xEB, 0x00,
-        0x28, 0xF7, 0x4B, 0x00, 0xBF, 0xF7, 0x1E, 0xFE, 0x87, 0xFB, 0xE3, 0xFF,
-        0xCD, 0xFC, 0x08, 0x01, 0xDA, 0xFD, 0x70, 0x03, 0xEC, 0xFC, 0x12, 0x06,
-        0x29, 0xFB, 0x8B, 0x05, 0xF3, 0x12, 0xE5, 0x1D, 0x6F, 0x24, 0xD5, 0x2D,
-        0x83, 0x23, 0x9D, 0x2B, 0x0A, 0x22, 0x1E, 0x2C, 0x7A, 0x16, 0x24, 0x22,
-        0x44, 0x0D, 0xF2, 0x1C, 0xFF, 0x05, 0xFB, 0x1A, 0xF0, 0x00, 0xF5, 0x19,
-        0xF9, 0xFF, 0xEC, 0x16, 0x8F, 0xFE, 0xB9, 0x0E, 0x80, 0xFF, 0x27, 0x07,
-        0x0D, 0x03, 0xF6, 0xFF, 0x51, 0x08, 0x81, 0xFF, 0xEA, 0x08, 0x19, 0x00,
-        0x6F, 0x08, 0x73, 0x02, 0xFE, 0x04, 0x0C, 0x01, 0x3E, 0x03, 0x96, 0xFF,
-        0x70, 0x02, 0x40, 0xFD, 0x5B, 0x03, 0x94, 0xFA, 0x0C, 0x05, 0x24, 0xFB,
-        0x51, 0xED, 0xFE, 0xE2, 0xA1, 0xDB, 0xD5, 0xD2, 0x97, 0xDC, 0x0D, 0xD5,
-        0xFA, 0xDD, 0x31, 0xD4, 0xCD, 0xE9, 0x1D, 0xDE, 0xF4, 0xF2, 0x43, 0xE3,
-        0x36, 0xFA, 0x43, 0xE5, 0xEE, 0xFE, 0x22, 0xE6, 0xBB, 0xFF, 0x00, 0xE9,
-        0x83, 0x01, 0x8E, 0xF1, 0xB8, 0x00, 0x58, 0xF9, 0xA3, 0xFD, 0x17, 0x01,
-        0xF4, 0xF7, 0x41, 0x01, 0x19, 0xF7, 0x78, 0x00, 0x59, 0xF7, 0xE7, 0xFD,
-        0xDC, 0xFA, 0x3A, 0xFF, 0x06, 0xFD, 0x14, 0x01, 0x88, 0xFD, 0x27, 0x03,
-        0x7F, 0xFC, 0xCA, 0x05, 0xB8, 0xFA, 0xDA, 0x04, 0xA9, 0x12, 0x19, 0x1D,
-        0x9F, 0x24, 0x6A, 0x2D, 0xF0, 0x23, 0x67, 0x2B, 0x80, 0x22, 0x6D, 0x2C,
-        0x3E, 0x16, 0x34, 0x22, 0x3F, 0x0D, 0x28, 0x1D, 0x23, 0x06, 0x20, 0x1B,
-        0xF6, 0x01, 0xAA, 0x1A, 0xF9, 0x00, 0xA7, 0x17, 0xEC, 0xFE, 0xEF, 0x0E,
-        0xA3, 0xFF, 0x1F, 0x07, 0x7C, 0x02, 0x2C, 0xFF, 0x96, 0x08, 0x73, 0xFF,
-        0x5C, 0x09, 0x30, 0x00, 0xD8, 0x08, 0xA1, 0x02, 0xF1, 0x04, 0xFF, 0x00,
-        0xBE, 0x02, 0x1F, 0xFF, 0x80, 0x02, 0x0D, 0xFD, 0x94, 0x03, 0x53, 0xFA,
-        0x6C, 0x05, 0x66, 0xFB, 0x57, 0xED, 0x05, 0xE3, 0x97, 0xDB, 0xFB, 0xD2,
-        0x1D, 0xDC, 0xDB, 0xD4, 0xB3, 0xDD, 0xDF, 0xD3, 0x0C, 0xEA, 0x17, 0xDE,
-        0xD8, 0xF2, 0x26, 0xE3, 0xF7, 0xF9, 0x52, 0xE5, 0x1E, 0xFE, 0xDE, 0xE5,
-        0x9B, 0xFF, 0x3D, 0xE9, 0xB4, 0x01, 0xB9, 0xF1, 0xC5, 0x00, 0x2A, 0xF9,
-        0xFF, 0xFD, 0xFA, 0x00, 0xEB, 0xF7, 0x95, 0x00, 0x57, 0xF7, 0xF1, 0xFF,
-        0x1E, 0xF8, 0xA0, 0xFD, 0xE8, 0xFB, 0x1A, 0xFF, 0xA2, 0xFD, 0xB4, 0x00,
-        0xBB, 0xFD, 0xF5, 0x02, 0xB4, 0xFC, 0x12, 0x06, 0x0F, 0xFB, 0x4E, 0x05,
-        0x03, 0x13, 0xA8, 0x1D, 0x65, 0x24, 0x6C, 0x2D, 0xC4, 0x23, 0x65, 0x2B,
-        0x3D, 0x22, 0x94, 0x2C, 0x02, 0x16, 0x5A, 0x22, 0x4C, 0x0D, 0x2A, 0x1D,
-        0x17, 0x06, 0xB6, 0x1A, 0xB6, 0x01, 0xCA, 0x19, 0x0C, 0x00, 0x70, 0x16,
-        0x20, 0xFE, 0x44, 0x0E, 0x4B, 0xFF, 0x3C, 0x07, 0xC9, 0x01, 0x2E, 0xFF,
-        0x71, 0x07, 0x40, 0xFF, 0xE7, 0x07, 0xCA, 0xFF, 0x38, 0x07, 0x36, 0x02,
-        0xC4, 0x03, 0x0E, 0x01, 0x52, 0x02, 0x83, 0xFF, 0x44, 0x02, 0x14, 0xFD,
-        0x27, 0x03, 0xA6, 0xF9, 0xB4, 0x04, 0x6F, 0xFA, 0xEA, 0xEC, 0x4E, 0xE2,
-        0xC7, 0xDB, 0xCC, 0xD2, 0x84, 0xDC, 0x0F, 0xD5, 0xE7, 0xDD, 0xB2, 0xD3,
-        0x18, 0xEA, 0x0A, 0xDE, 0x8D, 0xF2, 0x1F, 0xE3, 0xBB, 0xF9, 0x9B, 0xE5,
-        0x1E, 0xFE, 0x6D, 0xE6, 0xEB, 0xFF, 0x76, 0xE9, 0x1B, 0x02, 0x8B, 0xF1,
-        0x04, 0x01, 0x72, 0xF8, 0xF8, 0xFE, 0xBF, 0x00, 0x65, 0xF9, 0xA4, 0x00,
-        0xBF, 0xF8, 0xE4, 0xFF, 0x0A, 0xF9, 0x0D, 0xFD, 0x61, 0xFC, 0x41, 0xFE,
-        0xDD, 0xFD, 0x1B, 0x00, 0xD8, 0xFD, 0xC7, 0x02, 0x35, 0xFD, 0x86, 0x06,
-        0xA5, 0xFB, 0x9C, 0x05, 0xA2, 0x13, 0xD6, 0x1D, 0xA1, 0x24, 0x4E, 0x2D,
-        0xD3, 0x23, 0xF4, 0x2A, 0x1B, 0x22, 0x14, 0x2C, 0xC3, 0x15, 0x76, 0x21,
-        0x98, 0x0D, 0x73, 0x1C, 0x74, 0x06, 0xE2, 0x19, 0x3C, 0x02, 0x66, 0x19,
-        0x21, 0x00, 0x63, 0x16, 0x9D, 0xFD, 0x3A, 0x0E, 0x9A, 0xFE, 0x39, 0x07,
-        0xBC, 0x00, 0x01, 0xFF, 0x88, 0x06, 0x51, 0xFF, 0x22, 0x07, 0x0A, 0x00,
-        0xE5, 0x06, 0xF9, 0x02, 0x38, 0x03, 0x5D, 0x01, 0xE4, 0x01, 0x5D, 0xFF,
-        0x17, 0x02, 0xB7, 0xFC, 0xBC, 0x02, 0xFE, 0xF8, 0x3B, 0x04, 0x34, 0xFA,
-        0xF3, 0xEB, 0xD8, 0xE1, 0xF4, 0xDA, 0x53, 0xD2, 0xB6, 0xDB, 0x93, 0xD4,
-        0xD9, 0xDD, 0xA2, 0xD3, 0xFE, 0xE9, 0x26, 0xDE, 0xE5, 0xF1, 0x2B, 0xE3,
-        0x1F, 0xF9, 0xEA, 0xE5, 0x47, 0xFD, 0x50, 0xE6, 0xC2, 0xFF, 0x50, 0xE9,
-        0x44, 0x02, 0x62, 0xF1, 0x45, 0x01, 0x6B, 0xF8, 0xC9, 0xFE, 0x6A, 0x00,
-        0xF5, 0xF8, 0x2D, 0x00, 0xC6, 0xF8, 0xB3, 0xFF, 0x30, 0xF9, 0xC9, 0xFC,
-        0x21, 0xFD, 0x81, 0xFE, 0x02, 0xFE, 0x3D, 0x00, 0xB3, 0xFD, 0xD7, 0x02,
-        0x08, 0xFD, 0x77, 0x06, 0xD0, 0xFB, 0x2D, 0x05, 0x5C, 0x14, 0x9E, 0x1D,
-        0x7D, 0x25, 0x59, 0x2D, 0xC2, 0x24, 0x5D, 0x2B, 0x52, 0x22, 0x67, 0x2C,
-        0x61, 0x16, 0x36, 0x22, 0x5F, 0x0E, 0xEF, 0x1C, 0xDD, 0x06, 0xDB, 0x19,
-        0x9A, 0x02, 0x5F, 0x19, 0xEA, 0xFF, 0x83, 0x16, 0xA5, 0xFD, 0xCE, 0x0E,
-        0xA6, 0xFE, 0xB1, 0x07, 0x2D, 0x01, 0x8A, 0xFF, 0xE3, 0x06, 0x73, 0xFF,
-        0x0A, 0x07, 0xF2, 0xFF, 0x97, 0x06, 0x07, 0x03, 0xBF, 0x02, 0x92, 0x01,
-        0x1B, 0x02, 0xFA, 0xFF, 0x49, 0x02, 0x1C, 0xFD, 0xE5, 0x02, 0x5E, 0xF9,
-        0xF0, 0x03, 0xB3, 0xFA, 0x31, 0xEB, 0x38, 0xE2, 0x0A, 0xDA, 0x5A, 0xD2,
-        0xBF, 0xDA, 0x2D, 0xD4, 0x6E, 0xDD, 0xFB, 0xD2, 0x55, 0xE9, 0x12, 0xDD,
-        0x52, 0xF1, 0x7A, 0xE2, 0x9E, 0xF8, 0x97, 0xE5, 0xA4, 0xFC, 0xF9, 0xE5,
-        0x60, 0xFF, 0xB9, 0xE8, 0x81, 0x01, 0x45, 0xF0, 0xB3, 0x00, 0xAC, 0xF7,
-        0x8D, 0xFE, 0x75, 0x00, 0xC9, 0xF8, 0xA3, 0x00, 0x59, 0xF8, 0xDD, 0xFF,
-        0xDA, 0xF8, 0x92, 0xFC, 0xD3, 0xFC, 0xDC, 0xFD, 0xA5, 0xFD, 0x77, 0xFF,
-        0xBA, 0xFD, 0x96, 0x02, 0x23, 0xFD, 0x4A, 0x06, 0x27, 0xFC, 0xDB, 0x04,
-        0x08, 0x15, 0x6D, 0x1D, 0x2A, 0x26, 0x6E, 0x2D, 0x70, 0x25, 0xC3, 0x2B,
-        0x85, 0x22, 0x14, 0x2D, 0x69, 0x16, 0xFA, 0x22, 0x79, 0x0E, 0x8E, 0x1D,
-        0x62, 0x07, 0x98, 0x1A, 0x51, 0x03, 0x0F, 0x1A, 0x2A, 0x00, 0x02, 0x17,
-        0x0E, 0xFE, 0x82, 0x0F, 0xE8, 0xFE, 0x00, 0x08, 0x11, 0x01, 0x32, 0xFF,
-        0x5B, 0x07, 0x4F, 0xFF, 0xF7, 0x07, 0x3D, 0x00, 0x22, 0x07, 0x42, 0x03,
-        0xCF, 0x02, 0xD2, 0x01, 0xD0, 0x01, 0x3A, 0x00, 0xBC, 0x01, 0x42, 0xFD,
-        0x7E, 0x02, 0xF0, 0xF9, 0x9B, 0x03, 0xA4, 0xFB, 0xC3, 0xEA, 0x0F, 0xE3,
-        0xD8, 0xD9, 0x32, 0xD3, 0x89, 0xDA, 0xC8, 0xD4, 0x4E, 0xDD, 0x33, 0xD3,
-        0x54, 0xE9, 0x2F, 0xDD, 0x0B, 0xF1, 0x68, 0xE2, 0x20, 0xF8, 0x49, 0xE5,
-        0x7A, 0xFC, 0x16, 0xE6, 0xEE, 0xFF, 0x51, 0xE9, 0xE2, 0x01, 0xA0, 0xF0,
-        0xCA, 0x00, 0xBA, 0xF7, 0x6D, 0xFE, 0x48, 0x00, 0x02, 0xF8, 0xF8, 0xFF,
-        0xA1, 0xF7, 0x65, 0xFF, 0xC2, 0xF8, 0xBB, 0xFC, 0x08, 0xFD, 0x37, 0xFE,
-        0xF6, 0xFD, 0xBA, 0xFF, 0xF7, 0xFD, 0x75, 0x02, 0x2C, 0xFD, 0x99, 0x05,
-        0x10, 0xFC, 0xEA, 0x03, 0xBA, 0x14, 0x6E, 0x1C, 0x6E, 0x25, 0x2F, 0x2C,
-        0xC9, 0x24, 0x9D, 0x2A, 0x6F, 0x22, 0x9C, 0x2C, 0xA5, 0x16, 0xBA, 0x22,
-        0xE6, 0x0E, 0x86, 0x1D, 0x9D, 0x07, 0x81, 0x1A, 0x09, 0x03, 0x9C, 0x19,
-        0xD7, 0xFF, 0x98, 0x16, 0xEE, 0xFD, 0x6E, 0x0F, 0x1C, 0xFF, 0x7D, 0x08,
-        0x3B, 0x01, 0xD2, 0xFF, 0x4E, 0x07, 0xCA, 0xFF, 0xA9, 0x07, 0x35, 0x00,
-        0xD4, 0x06, 0xF2, 0x02, 0x30, 0x03, 0xCA, 0x01, 0x4E, 0x02, 0x37, 0x00,
-        0x48, 0x02, 0x8F, 0xFD, 0xE7, 0x02, 0x4E, 0xFA, 0xDF, 0x03, 0xE7, 0xFB,
-        0x61, 0xEB, 0x77, 0xE3, 0x9C, 0xDA, 0xA6, 0xD3, 0x40, 0xDB, 0x39, 0xD5,
-        0x4B, 0xDD, 0xF2, 0xD2, 0x1B, 0xE9, 0x04, 0xDD, 0x34, 0xF1, 0x7E, 0xE2,
-        0xB5, 0xF8, 0x9C, 0xE5, 0x4C, 0xFD, 0x75, 0xE6, 0x49, 0x00, 0x3F, 0xE9,
-        0x59, 0x02, 0x98, 0xF0, 0x4A, 0x01, 0xA8, 0xF7, 0x44, 0xFF, 0x7E, 0x00,
-        0x2D, 0xF9, 0x96, 0x00, 0x8B, 0xF8, 0xF6, 0xFF, 0x18, 0xF9, 0x2F, 0xFD,
-        0xA2, 0xFC, 0x77, 0xFE, 0xC1, 0xFD, 0x75, 0x00, 0xD8, 0xFD, 0x1B, 0x03,
-        0x13, 0xFD, 0x1C, 0x06, 0xFD, 0xFB, 0x52, 0x04, 0x5C, 0x14, 0x81, 0x1C,
-        0x1A, 0x25, 0x53, 0x2C, 0x5A, 0x24, 0xBA, 0x2A, 0x32, 0x22, 0xF2, 0x2C,
-        0x3C, 0x16, 0xC0, 0x22, 0x06, 0x0E, 0x41, 0x1D, 0xD0, 0x06, 0x99, 0x1A,
-        0x52, 0x02, 0xF0, 0x19, 0x3A, 0xFF, 0x14, 0x17, 0xE7, 0xFC, 0x78, 0x0F,
-        0x07, 0xFE, 0x49, 0x08, 0x77, 0x00, 0xA3, 0xFF, 0x12, 0x07, 0xCD, 0xFF,
-        0xDC, 0x07, 0x80, 0x00, 0x1F, 0x07, 0xF0, 0x02, 0x4A, 0x03, 0x31, 0x01,
-        0x14, 0x02, 0xFC, 0xFE, 0x27, 0x02, 0x68, 0xFC, 0x3A, 0x03, 0xBC, 0xF9,
-        0x4C, 0x04, 0x9C, 0xFB, 0x9D, 0xEB, 0x3F, 0xE3, 0xB8, 0xDA, 0x52, 0xD3,
-        0x86, 0xDB, 0xCD, 0xD4, 0x08, 0xDE, 0xD8, 0xD2, 0x4A, 0xEA, 0x33, 0xDD,
-        0x7C, 0xF2, 0xBC, 0xE2, 0x91, 0xF9, 0x27, 0xE5, 0x08, 0xFE, 0xDD, 0xE5,
-        0x52, 0x01, 0xE4, 0xE8, 0x83, 0x03, 0x5C, 0xF0, 0x2B, 0x02, 0x7D, 0xF7,
-        0x33, 0xFF, 0xDF, 0xFF, 0x64, 0xF8, 0xCB, 0xFF, 0xD6, 0xF7, 0x64, 0xFF,
-        0xFA, 0xF8, 0x5A, 0xFD, 0xE2, 0xFC, 0x1E, 0xFF, 0xDA, 0xFD, 0x16, 0x01,
-        0xB9, 0xFD, 0xA6, 0x03, 0x5C, 0xFC, 0x13, 0x06, 0x58, 0xFB, 0x48, 0x04,
-        0x35, 0x14, 0xA5, 0x1C, 0x26, 0x25, 0x91, 0x2C, 0x6E, 0x24, 0x25, 0x2B,
-        0xB4, 0x21, 0x0F, 0x2D, 0x82, 0x15, 0xC0, 0x22, 0x72, 0x0D, 0x47, 0x1D,
-        0x8A, 0x06, 0xD8, 0x1A, 0x40, 0x02, 0x0A, 0x1A, 0x4E, 0xFF, 0x31, 0x17,
-        0x61, 0xFD, 0xFF, 0x0F, 0xAF, 0xFE, 0xC2, 0x08, 0x84, 0x01, 0x1C, 0x00,
-        0x13, 0x08, 0xC6, 0xFF, 0x85, 0x08, 0x03, 0x00, 0x6E, 0x07, 0x59, 0x02,
-        0xE9, 0x03, 0x30, 0x01, 0xFC, 0x02, 0x96, 0xFF, 0xD9, 0x02, 0xD2, 0xFC,
-        0x26, 0x04, 0x50, 0xFA, 0x24, 0x05, 0x02, 0xFC, 0x68, 0xEC, 0xBA, 0xE3,
-        0x73, 0xDB, 0xEF, 0xD3, 0x27, 0xDC, 0x39, 0xD5, 0xC2, 0xDE, 0x1C, 0xD3,
-        0x00, 0xEB, 0x59, 0xDD, 0xE4, 0xF2, 0xA9, 0xE2, 0xC7, 0xF9, 0x36, 0xE5,
-        0xF2, 0xFD, 0x3A, 0xE6, 0x5F, 0x00, 0xCB, 0xE8, 0x3F, 0x02, 0xF9, 0xEF,
-        0x04, 0x01, 0x4A, 0xF7, 0x60, 0xFE, 0x23, 0x00, 0xD1, 0xF7, 0x9B, 0x00,
-        0x13, 0xF7, 0x24, 0x00, 0xF4, 0xF7, 0x8E, 0xFD, 0x6B, 0xFB, 0x76, 0xFE,
-        0xBE, 0xFC, 0x4D, 0x00, 0x31, 0xFD, 0x3E, 0x03, 0x0F, 0xFC, 0x03, 0x06,
-        0xDE, 0xFA, 0x4D, 0x04, 0x5D, 0x13, 0x70, 0x1C, 0x28, 0x24, 0x0A, 0x2C,
-        0x6F, 0x23, 0xBC, 0x2A, 0x12, 0x21, 0x10, 0x2D, 0xBE, 0x14, 0xBB, 0x22,
-        0x33, 0x0D, 0xC3, 0x1D, 0x71, 0x06, 0x36, 0x1B, 0x34, 0x02, 0xDB, 0x19,
-        0xE1, 0xFF, 0x33, 0x17, 0xCB, 0xFD, 0xC7, 0x0F, 0x16, 0xFF, 0x9D, 0x08,
-        0xAD, 0x01, 0xE6, 0xFF, 0x46, 0x08, 0x9B, 0xFF, 0x15, 0x09, 0x2F, 0x00,
-        0x1F, 0x08, 0xD6, 0x02, 0x53, 0x04, 0xBA, 0x01, 0xE7, 0x02, 0xED, 0xFF,
-        0x8A, 0x02, 0x47, 0xFD, 0xA5, 0x03, 0x77, 0xFA, 0xFD, 0x04, 0x35, 0xFC,
-        0x8D, 0xEC, 0x06, 0xE4, 0x1B, 0xDC, 0x9D, 0xD4, 0xE5, 0xDC, 0xF1, 0xD5,
-        0x58, 0xDF, 0x99, 0xD3, 0xC0, 0xEB, 0xF6, 0xDD, 0x1B, 0xF3, 0x9E, 0xE2,
-        0xD1, 0xF9, 0x08, 0xE5, 0x32, 0xFE, 0x98, 0xE6, 0xCC, 0x00, 0x8B, 0xE9,
-        0xC8, 0x02, 0xFB, 0xF0, 0x65, 0x01, 0x02, 0xF8, 0x92, 0xFE, 0x80, 0x00,
-        0x34, 0xF8, 0x02, 0x01, 0x77, 0xF7, 0x7B, 0x00, 0x46, 0xF8, 0xB1, 0xFD,
-        0x19, 0xFC, 0xDA, 0xFE, 0xF6, 0xFC, 0x14, 0x00, 0x2A, 0xFD, 0x7E, 0x02,
-        0x12, 0xFC, 0x17, 0x05, 0xE7, 0xFA, 0x72, 0x03, 0x6F, 0x13, 0x8D, 0x1B,
-        0xDE, 0x23, 0xDF, 0x2A, 0x24, 0x23, 0xA0, 0x29, 0xBC, 0x20, 0xF9, 0x2B,
-        0x93, 0x14, 0xE5, 0x21, 0x0A, 0x0D, 0x1E, 0x1D, 0x55, 0x06, 0xE2, 0x1A,
-        0xB5, 0x01, 0x32, 0x19, 0xFC, 0xFE, 0x50, 0x16, 0x3E, 0xFD, 0x2C, 0x0F,
-        0xC4, 0xFE, 0x3F, 0x08, 0xEA, 0x01, 0x0B, 0x00, 0xF3, 0x07, 0x14, 0xFF,
-        0xC9, 0x08, 0xB0, 0xFF, 0x0E, 0x08, 0x91, 0x02, 0x3A, 0x04, 0x4C, 0x01,
-        0x67, 0x03, 0x03, 0x00, 0xE5, 0x02, 0x3B, 0xFD, 0x11, 0x04, 0xD1, 0xFA,
-        0x45, 0x05, 0x9B, 0xFC, 0xFE, 0xEC, 0x08, 0xE5, 0x9F, 0xDC, 0xDF, 0xD5,
-        0x7E, 0xDD, 0x43, 0xD7, 0xD9, 0xDF, 0xCF, 0xD4, 0xA6, 0xEB, 0x72, 0xDE,
-        0x76, 0xF3, 0x75, 0xE3, 0xFE, 0xF9, 0x77, 0xE5, 0xC5, 0xFE, 0x1B, 0xE7,
-        0x78, 0x01, 0xD8, 0xE9, 0x59, 0x03, 0xE5, 0xF0, 0xE8, 0x01, 0xF9, 0xF7,
-        0x7F, 0xFE, 0xFB, 0xFF, 0x70, 0xF8, 0x2B, 0x01, 0x44, 0xF7, 0x34, 0x00,
-        0xE9, 0xF7, 0x38, 0xFD, 0xBE, 0xFB, 0x61, 0xFE, 0xB6, 0xFC, 0xE2, 0xFF,
-        0x72, 0xFD, 0xF6, 0x02, 0x1A, 0xFC, 0x48, 0x05, 0xEC, 0xFA, 0x7A, 0x03,
-        0x39, 0x13, 0xF9, 0x1A, 0xED, 0x23, 0x63, 0x2A, 0xC4, 0x22, 0xD7, 0x28,
-        0x4C, 0x20, 0x5D, 0x2B, 0x85, 0x14, 0x08, 0x22, 0x6E, 0x0C, 0xCD, 0x1C,
-        0x07, 0x06, 0xFE, 0x1A, 0x4E, 0x01, 0x5C, 0x19, 0x7B, 0xFE, 0x9E, 0x16,
-        0x71, 0xFC, 0x74, 0x0F, 0xE3, 0xFD, 0x62, 0x08, 0x7E, 0x01, 0x69, 0x00,
-        0xD6, 0x07, 0x39, 0xFF, 0x14, 0x09, 0x1D, 0x00, 0x1E, 0x08, 0xD4, 0x02,
-        0x33, 0x04, 0xB5, 0x01, 0x2E, 0x03, 0x50, 0x00, 0x99, 0x02, 0x47, 0xFD,
-        0x01, 0x04, 0x02, 0xFB, 0x42, 0x05, 0xBF, 0xFC, 0xDE, 0xEC, 0x23, 0xE5,
-        0xF3, 0xDB, 0x8D, 0xD5, 0x6F, 0xDD, 0x45, 0xD7, 0x29, 0xE0, 0xC8, 0xD4,
-        0x01, 0xEC, 0xDB, 0xDD, 0x2C, 0xF4, 0xF0, 0xE2, 0x7B, 0xFA, 0x9C, 0xE4,
-        0x09, 0xFF, 0x11, 0xE6, 0xD2, 0x01, 0xE0, 0xE8, 0xE3, 0x03, 0xF8, 0xEF,
-        0x5C, 0x02, 0xFD, 0xF6, 0xD4, 0xFE, 0x14, 0xFF, 0x52, 0xF8, 0x50, 0x00,
-        0xF6, 0xF6, 0x91, 0xFF, 0x07, 0xF8, 0x0A, 0xFD, 0xBD, 0xFB, 0xEA, 0xFD,
-        0x7C, 0xFC, 0xF7, 0xFE, 0x0C, 0xFD, 0xFE, 0x01, 0xD3, 0xFB, 0x7A, 0x04,
-        0x7B, 0xFA, 0xE1, 0x02, 0xCE, 0x12, 0x8D, 0x1A, 0xE0, 0x23, 0x4A, 0x2A,
-        0x7D, 0x22, 0xB8, 0x28, 0xC2, 0x1F, 0x3B, 0x2B, 0xF8, 0x13, 0x5C, 0x22,
-        0xB4, 0x0B, 0x3E, 0x1D, 0x26, 0x05, 0x63, 0x1B, 0xE2, 0x00, 0x07, 0x1A,
-        0x56, 0xFE, 0x4B, 0x17, 0x8B, 0xFC, 0x55, 0x10, 0x10, 0xFE, 0x3B, 0x09,
-        0x53, 0x01, 0xEA, 0x00, 0xDE, 0x07, 0xAD, 0xFF, 0x7E, 0x09, 0x8C, 0x00,
-        0xA2, 0x08, 0x42, 0x03, 0xFD, 0x04, 0x6E, 0x02, 0x28, 0x04, 0x61, 0x01,
-        0x12, 0x03, 0xF5, 0xFD, 0xFB, 0x03, 0x4F, 0xFB, 0x6D, 0x05, 0xF9, 0xFC,
-        0x4F, 0xED, 0x66, 0xE5, 0x27, 0xDC, 0x9B, 0xD5, 0x40, 0xDD, 0xDB, 0xD6,
-        0xE1, 0xDF, 0x60, 0xD4, 0x82, 0xEB, 0x35, 0xDD, 0x03, 0xF4, 0x86, 0xE2,
-        0xCC, 0xFA, 0xA9, 0xE4, 0xEB, 0xFE, 0xE0, 0xE5, 0x14, 0x01, 0x5E, 0xE8,
-        0xA9, 0x02, 0x47, 0xEF, 0x33, 0x01, 0x91, 0xF6, 0x07, 0xFE, 0xDE, 0xFE,
-        0x99, 0xF7, 0x0E, 0x00, 0xCA, 0xF5, 0xE7, 0xFE, 0xA6, 0xF6, 0x0A, 0xFC,
-        0x79, 0xFA, 0x10, 0xFD, 0x88, 0xFB, 0x55, 0xFE, 0xEB, 0xFC, 0xF6, 0x01,
-        0xF9, 0xFB, 0x57, 0x04, 0x81, 0xFA, 0x9B, 0x02, 0x8F, 0x12, 0x27, 0x1A,
-        0xA4, 0x23, 0xFA, 0x29, 0xA0, 0x22, 0xF2, 0x28, 0xF3, 0x1F, 0x52, 0x2B,
-        0x94, 0x14, 0x9E, 0x22, 0x19, 0x0C, 0x46, 0x1D, 0x43, 0x05, 0x13, 0x1B,
-        0xFB, 0x00, 0xD1, 0x19, 0xC8, 0xFE, 0x5D, 0x17, 0x15, 0xFD, 0x3F, 0x10,
-        0x76, 0xFE, 0xBC, 0x08, 0xCF, 0x01, 0xA1, 0x00, 0x06, 0x08, 0x68, 0xFF,
-        0xBD, 0x09, 0xA8, 0x00, 0x98, 0x08, 0x7D, 0x03, 0xC3, 0x04, 0x7A, 0x02,
-        0xE8, 0x03, 0x37, 0x01, 0xC2, 0x02, 0xC5, 0xFD, 0xD2, 0x03, 0xA5, 0xFB,
-        0xE4, 0x04, 0x04, 0xFD, 0x95, 0xEC, 0x62, 0xE5, 0x92, 0xDB, 0x87, 0xD5,
-        0xEA, 0xDC, 0xD0, 0xD6, 0xAC, 0xDF, 0x8D, 0xD4, 0x00, 0xEB, 0x69, 0xDD,
-        0x2F, 0xF3, 0xB1, 0xE2, 0xF7, 0xF9, 0xF9, 0xE4, 0xA7, 0xFE, 0x8A, 0xE6,
-        0xF4, 0x00, 0xD2, 0xE8, 0xD9, 0x02, 0x04, 0xF0, 0x4A, 0x01, 0x5C, 0xF7,
-        0xEA, 0xFD, 0x4F, 0xFF, 0xD9, 0xF7, 0xA9, 0x00, 0x8B, 0xF6, 0x7D, 0xFF,
-        0x0C, 0xF8, 0xC5, 0xFC, 0xCF, 0xFB, 0x93, 0xFD, 0x55, 0xFC, 0xD7, 0xFE,
-        0x09, 0xFD, 0x1A, 0x02, 0xFB, 0xFB, 0x73, 0x04, 0x0A, 0xFB, 0x39, 0x03,
-        0x7A, 0x13, 0xF3, 0x1A, 0x4E, 0x24, 0x8B, 0x2A, 0xA8, 0x22, 0x1C, 0x29,
-        0xF6, 0x1F, 0x5F, 0x2B, 0x63, 0x14, 0x31, 0x22, 0x91, 0x0C, 0xFA, 0x1C,
-        0xD4, 0x05, 0x78, 0x1A, 0x13, 0x01, 0xE5, 0x18, 0xAC, 0xFE, 0xC8, 0x16,
-        0xAD, 0xFC, 0xC2, 0x0F, 0x23, 0xFE, 0x80, 0x08, 0x23, 0x01, 0x44, 0x00,
-        0x42, 0x07, 0xE0, 0xFE, 0x6F, 0x08, 0x03, 0x00, 0x15, 0x07, 0x07, 0x03,
-        0x76, 0x03, 0x65, 0x02, 0x35, 0x03, 0x21, 0x01, 0xD9, 0x02, 0xC9, 0xFD,
-        0xF0, 0x03, 0x36, 0xFB, 0x44, 0x05, 0x93, 0xFC, 0x99, 0xEC, 0xDC, 0xE4,
-        0xC0, 0xDB, 0x5C, 0xD5, 0x13, 0xDD, 0xA4, 0xD6, 0xAD, 0xDF, 0x6B, 0xD4,
-        0x7B, 0xEB, 0xD1, 0xDD, 0x35, 0xF3, 0x33, 0xE3, 0xD4, 0xF9, 0xBA, 0xE5,
-        0x63, 0xFE, 0x15, 0xE7, 0xF5, 0x00, 0x1A, 0xE9, 0x25, 0x03, 0xE2, 0xEF,
-        0x06, 0x02, 0x23, 0xF7, 0x58, 0xFF, 0x71, 0xFF, 0x12, 0xF9, 0xBF, 0x00,
-        0x9B, 0xF7, 0x79, 0xFF, 0xCB, 0xF8, 0x4F, 0xFC, 0xA1, 0xFC, 0x50, 0xFD,
-        0x08, 0xFD, 0xDC, 0xFE, 0x79, 0xFD, 0xB3, 0x02, 0x26, 0xFC, 0x4D, 0x05,
-        0x8A, 0xFA, 0xE1, 0x03, 0x11, 0x13, 0x76, 0x1B, 0x1B, 0x24, 0xCE, 0x2A,
-        0xD2, 0x22, 0x68, 0x29, 0x40, 0x20, 0x5D, 0x2B, 0x72, 0x14, 0x0B, 0x22,
-        0xAE, 0x0C, 0x8C, 0x1C, 0x4F, 0x06, 0x45, 0x1A, 0xC4, 0x01, 0xF5, 0x18,
-        0xE9, 0xFE, 0xCE, 0x16, 0x77, 0xFC, 0xFC, 0x0F, 0x78, 0xFD, 0xEB, 0x08,
-        0x45, 0x00, 0xF8, 0x00, 0xA1, 0x06, 0xAD, 0xFF, 0x7E, 0x08, 0x21, 0x01,
-        0x41, 0x07, 0x00, 0x04, 0x60, 0x03, 0xC5, 0x02, 0xDC, 0x02, 0x02, 0x01,
-        0x77, 0x02, 0x02, 0xFD, 0xE5, 0x03, 0x7D, 0xFA, 0x8E, 0x05, 0xB3, 0xFB,
-        0x48, 0xED, 0x4E, 0xE4, 0x3E, 0xDC, 0x08, 0xD5, 0xB6, 0xDD, 0xC2, 0xD6,
-        0x27, 0xE0, 0xC2, 0xD4, 0xA6, 0xEB, 0xAA, 0xDD, 0x7C, 0xF3, 0x0D, 0xE3,
-        0xE2, 0xF9, 0x33, 0xE5, 0xBF, 0xFE, 0xAE, 0xE6, 0xAF, 0x01, 0x0C, 0xE9,
-        0x46, 0x04, 0x07, 0xF0, 0xDC, 0x02, 0xDC, 0xF6, 0xEE, 0xFF, 0x9D, 0xFE,
-        0x9C, 0xF9, 0x1B, 0x00, 0x9C, 0xF7, 0xD9, 0xFE, 0xF2, 0xF8, 0x4C, 0xFC,
-        0x7A, 0xFC, 0x7C, 0xFD, 0xDC, 0xFC, 0x2B, 0xFF, 0x44, 0xFD, 0x28, 0x03,
-        0x24, 0xFC, 0xCA, 0x05, 0xC7, 0xFA, 0xE2, 0x04, 0xF2, 0x12, 0x53, 0x1C,
-        0xDE, 0x23, 0x78, 0x2B, 0x2E, 0x22, 0xA1, 0x29, 0xCC, 0x1F, 0x96, 0x2B,
-        0x45, 0x14, 0xC2, 0x22, 0x46, 0x0C, 0x50, 0x1D, 0x7B, 0x05, 0xF9, 0x1A,
-        0xAD, 0x00, 0xA8, 0x19, 0x08, 0xFE, 0x67, 0x17, 0xF0, 0xFB, 0x93, 0x10,
-        0xB7, 0xFD, 0xAB, 0x09, 0xA1, 0x00, 0xB8, 0x01, 0xD7, 0x06, 0xF8, 0xFF,
-        0x8E, 0x08, 0xD0, 0x00, 0x38, 0x07, 0x40, 0x03, 0xD6, 0x03, 0x22, 0x02,
-        0xC7, 0x03, 0xB3, 0x00, 0x47, 0x03, 0xCF, 0xFC, 0x42, 0x04, 0x63, 0xFA,
-        0x94, 0x05, 0x66, 0xFB, 0x6D, 0xED, 0xF2, 0xE3, 0xA2, 0xDC, 0xD9, 0xD4,
-        0x2B, 0xDE, 0x56, 0xD6, 0xA6, 0xE0, 0x76, 0xD4, 0x13, 0xEC, 0x42, 0xDD,
-        0x29, 0xF4, 0xBF, 0xE2, 0xF6, 0xFA, 0x15, 0xE5, 0xB1, 0xFF, 0x37, 0xE6,
-        0x44, 0x02, 0x7D, 0xE8, 0x1F, 0x04, 0x6C, 0xEF, 0x6C, 0x02, 0xD5, 0xF6,
-        0x61, 0xFF, 0xE5, 0xFE, 0xE6, 0xF8, 0x62, 0x00, 0x12, 0xF7, 0x6D, 0xFF,
-        0x79, 0xF8, 0xDC, 0xFC, 0xEE, 0xFB, 0xFF, 0xFD, 0x0C, 0xFC, 0x8E, 0xFF,
-        0xC1, 0xFC, 0x8C, 0x03, 0xCB, 0xFB, 0xB1, 0x05, 0x75, 0xFA, 0x8A, 0x04,
-        0xA5, 0x12, 0xF0, 0x1B, 0x63, 0x23, 0x00, 0x2B, 0xBF, 0x21, 0xA2, 0x29,
-        0x30, 0x1F, 0x54, 0x2B, 0xD5, 0x13, 0x86, 0x22, 0x30, 0x0C, 0x48, 0x1D,
-        0xC5, 0x05, 0x25, 0x1B, 0x18, 0x01, 0x16, 0x1A, 0x45, 0xFE, 0x9C, 0x17,
-        0x40, 0xFC, 0x6E, 0x10, 0xDA, 0xFD, 0xB8, 0x08, 0x00, 0x01, 0xCD, 0x00,
-        0xE6, 0x07, 0xC0, 0xFF, 0xB4, 0x09, 0xE5, 0x00, 0x18, 0x08, 0x9B, 0x03,
-        0x5F, 0x04, 0x60, 0x02, 0xFD, 0x03, 0x82, 0x00, 0x4F, 0x03, 0x82, 0xFC,
-        0x36, 0x04, 0x55, 0xFA, 0x83, 0x05, 0x6F, 0xFB, 0x10, 0xED, 0xDA, 0xE3,
-        0x5A, 0xDC, 0xCC, 0xD4, 0x26, 0xDE, 0x43, 0xD6, 0xBB, 0xE0, 0x8D, 0xD4,
-        0x0F, 0xEC, 0x7A, 0xDD, 0x76, 0xF3, 0xA2, 0xE2, 0xBF, 0xF9, 0xF4, 0xE4,
-        0x58, 0xFE, 0xFD, 0xE5, 0x40, 0x01, 0x78, 0xE8, 0x36, 0x03, 0x93, 0xEF,
-        0x76, 0x01, 0x23, 0xF7, 0x7B, 0xFE, 0x26, 0xFF, 0x84, 0xF7, 0x38, 0x00,
-        0x2F, 0xF6, 0x83, 0xFF, 0xF8, 0xF7, 0xCC, 0xFC, 0xCA, 0xFB, 0x04, 0xFE,
-        0x22, 0xFC, 0xF4, 0xFF, 0x63, 0xFC, 0x9B, 0x03, 0x61, 0xFB, 0xBD, 0x05,
-        0x02, 0xFA, 0xA8, 0x04, 0xCE, 0x12, 0x5E, 0x1C, 0xCC, 0x23, 0x83, 0x2B,
-        0x4D, 0x22, 0x2C, 0x2A, 0x20, 0x20, 0x15, 0x2C, 0xC8, 0x14, 0x1E, 0x23,
-        0x13, 0x0D, 0x78, 0x1D, 0x65, 0x06, 0xA1, 0x1A, 0xCF, 0x01, 0x8C, 0x19,
-        0xFE, 0xFE, 0x55, 0x17, 0x2B, 0xFD, 0x7D, 0x10, 0xC7, 0xFE, 0x16, 0x09,
-        0x99, 0x01, 0x1D, 0x01, 0x73, 0x08, 0xEC, 0xFF, 0xA1, 0x09, 0x5E, 0x00,
-        0xE7, 0x07, 0x2A, 0x03, 0x4A, 0x04, 0x14, 0x02, 0xFB, 0x03, 0x26, 0x00,
-        0xDC, 0x03, 0x82, 0xFC, 0xE1, 0x04, 0x4A, 0xFA, 0x5B, 0x06, 0x4F, 0xFB,
-        0x9B, 0xED, 0xB8, 0xE3, 0x60, 0xDC, 0x97, 0xD4, 0xC6, 0xDD, 0x0B, 0xD6,
-        0xC0, 0xDF, 0x39, 0xD4, 0x26, 0xEB, 0x39, 0xDD, 0x23, 0xF3, 0x2D, 0xE3,
-        0xAA, 0xF9, 0xF2, 0xE5, 0xE2, 0xFD, 0xB2, 0xE6, 0x30, 0x00, 0x76, 0xE8,
-        0x0E, 0x02, 0x5B, 0xEF, 0xBF, 0x00, 0xFF, 0xF6, 0x2A, 0xFE, 0xFD, 0xFE,
-        0x54, 0xF7, 0x66, 0x00, 0x25, 0xF6, 0x17, 0x00, 0xC9, 0xF7, 0x68, 0xFD,
-        0x13, 0xFB, 0x3C, 0xFE, 0x63, 0xFB, 0x14, 0x00, 0xAB, 0xFB, 0xC0, 0x03,
-        0xBA, 0xFA, 0xEE, 0x05, 0x4A, 0xF9, 0xF2, 0x04, 0xE7, 0x11, 0x47, 0x1C,
-        0x6A, 0x23, 0x70, 0x2B, 0xF6, 0x21, 0xA0, 0x29, 0x04, 0x20, 0x2F, 0x2B,
-        0xA1, 0x14, 0x4C, 0x22, 0xAA, 0x0C, 0x72, 0x1C, 0x84, 0x06, 0x2F, 0x1A,
-        0x61, 0x02, 0x9A, 0x19, 0x21, 0x00, 0xC6, 0x17, 0x24, 0xFE, 0xBA, 0x10,
-        0x3C, 0xFF, 0xD7, 0x08, 0xEA, 0x01, 0x16, 0x01, 0xC8, 0x08, 0x9B, 0xFF,
-        0xE0, 0x09, 0x9C, 0xFF, 0x3F, 0x08, 0x1E, 0x02, 0x27, 0x05, 0x54, 0x01,
-        0xDC, 0x04, 0xA4, 0xFF, 0x78, 0x04, 0xF0, 0xFB, 0x67, 0x05, 0xF9, 0xF9,
-        0xDF, 0x06, 0xF0, 0xFA, 0x45, 0xEE, 0x9A, 0xE3, 0xDD, 0xDC, 0xB0, 0xD4,
-        0x4B, 0xDE, 0x98, 0xD6, 0x47, 0xE0, 0x52, 0xD5, 0x90, 0xEB, 0x07, 0xDE,
-        0x7F, 0xF3, 0xCD, 0xE3, 0x92, 0xF9, 0xE2, 0xE5, 0xEC, 0xFD, 0xA5, 0xE6,
-        0x7B, 0x00, 0xF1, 0xE8, 0x17, 0x02, 0xBD, 0xEF, 0xE0, 0x00, 0x9D, 0xF7,
-        0xE1, 0xFD, 0xF7, 0xFE, 0x25, 0xF7, 0x89, 0x00, 0x42, 0xF6, 0xCC, 0x00,
-        0xC8, 0xF7, 0x2E, 0xFE, 0xEB, 0xFA, 0xFA, 0xFE, 0x02, 0xFB, 0x5C, 0x00,
-        0x9B, 0xFB, 0x19, 0x04, 0x75, 0xFA, 0xA1, 0x05, 0x28, 0xF9, 0xE1, 0x04,
-        0xDC, 0x11, 0x54, 0x1C, 0x05, 0x23, 0x01, 0x2B, 0xD3, 0x21, 0x4C, 0x29,
-        0xEE, 0x1F, 0x98, 0x2A, 0xDF, 0x14, 0x14, 0x22, 0xB1, 0x0C, 0x0F, 0x1C,
-        0xA0, 0x06, 0x06, 0x1A, 0x1B, 0x02, 0x14, 0x19, 0x78, 0xFF, 0xA6, 0x16,
-        0x3F, 0xFE, 0x2B, 0x10, 0x6F, 0xFF, 0x32, 0x08, 0x5A, 0x02, 0xDD, 0x00,
-        0xC6, 0x08, 0x06, 0xFF, 0xC4, 0x09, 0xEA, 0xFE, 0x72, 0x08, 0xCA, 0x01,
-        0x6D, 0x05, 0x26, 0x01, 0x8B, 0x05, 0xED, 0xFF, 0xF5, 0x04, 0x41, 0xFC,
-        0x36, 0x06, 0xDF, 0xFA, 0x35, 0x07, 0x4D, 0xFB, 0x56, 0xEE, 0xB6, 0xE3,
-        0x03, 0xDD, 0xF6, 0xD4, 0x24, 0xDE, 0xAE, 0xD6, 0xBB, 0xDF, 0x43, 0xD5,
-        0xD3, 0xEA, 0xFD, 0xDD, 0x3B, 0xF3, 0x6C, 0xE4, 0x5D, 0xF9, 0x9A, 0xE6,
-        0xDB, 0xFD, 0x93, 0xE7, 0x44, 0x00, 0xC5, 0xE9, 0x9B, 0x01, 0x47, 0xF0,
-        0x6E, 0x00, 0x3E, 0xF8, 0xD4, 0xFD, 0xAF, 0xFF, 0x5E, 0xF7, 0x59, 0x01,
-        0x20, 0xF6, 0xFF, 0x00, 0x8F, 0xF7, 0x16, 0xFE, 0xAF, 0xFA, 0xBF, 0xFE,
-        0xB8, 0xFA, 0x1C, 0x00, 0x18, 0xFB, 0x81, 0x03, 0x1F, 0xFA, 0x1A, 0x05,
-        0x05, 0xF9, 0x88, 0x04, 0xFF, 0x11, 0x18, 0x1C, 0x50, 0x23, 0xD4, 0x2A,
-        0xF1, 0x21, 0xB2, 0x28, 0x7E, 0x20, 0x27, 0x2A, 0x51, 0x15, 0x1D, 0x21,
-        0x32, 0x0D, 0xD6, 0x1A, 0x09, 0x07, 0xAA, 0x18, 0xC5, 0x02, 0xEE, 0x17,
-        0x5D, 0x00, 0xE7, 0x15, 0xBC, 0xFE, 0x2F, 0x0F, 0xE6, 0xFF, 0x5A, 0x07,
-        0x42, 0x02, 0xE0, 0xFF, 0xEF, 0x08, 0xBD, 0xFE, 0x21, 0x0A, 0x47, 0xFF,
-        0x6E, 0x08, 0x14, 0x02, 0x07, 0x05, 0x2C, 0x01, 0x15, 0x05, 0xE0, 0xFF,
-        0xEF, 0x04, 0xC6, 0xFC, 0xBA, 0x05, 0x0E, 0xFB, 0x11, 0x07, 0xE5, 0xFB,
-        0x08, 0xEE, 0x3F, 0xE4, 0xD1, 0xDC, 0x8B, 0xD5, 0x3C, 0xDE, 0xC1, 0xD7,
-        0xB0, 0xDF, 0x75, 0xD6, 0xCE, 0xEA, 0xA6, 0xDF, 0x96, 0xF2, 0xA6, 0xE5,
-        0xD0, 0xF8, 0xCC, 0xE7, 0x20, 0xFD, 0x71, 0xE8, 0xA8, 0xFF, 0x78, 0xEA,
-        0x50, 0x01, 0x22, 0xF1, 0x09, 0x00, 0xC7, 0xF8, 0xBA, 0xFD, 0x0B, 0x00,
-        0x13, 0xF7, 0xE9, 0x00, 0x1A, 0xF6, 0x54, 0x00, 0xDE, 0xF7, 0x93, 0xFD,
-        0x52, 0xFB, 0xA3, 0xFE, 0x1B, 0xFB, 0xF2, 0xFF, 0x27, 0xFB, 0xF3, 0x02,
-        0x77, 0xFA, 0xD1, 0x04, 0xEC, 0xF8, 0xD5, 0x03, 0xC9, 0x11, 0x79, 0x1B,
-        0xFF, 0x22, 0x60, 0x2A, 0xBB, 0x21, 0x54, 0x28, 0x4D, 0x20, 0x7A, 0x29,
-        0x0F, 0x15, 0xF8, 0x1F, 0x66, 0x0D, 0xF8, 0x19, 0x10, 0x07, 0xD5, 0x17,
-        0xB5, 0x02, 0x31, 0x17, 0x63, 0x00, 0x77, 0x15, 0xF4, 0xFE, 0xE9, 0x0E,
-        0x46, 0x00, 0x57, 0x07, 0x81, 0x02, 0x0F, 0x00, 0xC2, 0x08, 0x0F, 0xFF,
-        0x96, 0x09, 0x9C, 0xFF, 0x1A, 0x08, 0xA7, 0x02, 0xE6, 0x04, 0xA8, 0x01,
-        0x10, 0x05, 0x2D, 0x00, 0xF7, 0x04, 0x22, 0xFD, 0x9C, 0x05, 0x4A, 0xFB,
-        0x1E, 0x07, 0x4C, 0xFC, 0x87, 0xEE, 0xEB, 0xE4, 0x58, 0xDD, 0xEF, 0xD5,
-        0x6B, 0xDE, 0xE7, 0xD7, 0xCA, 0xDF, 0xD8, 0xD6, 0x13, 0xEB, 0xB8, 0xE0,
-        0x9A, 0xF2, 0xA9, 0xE6, 0xC5, 0xF8, 0xA3, 0xE8, 0x34, 0xFD, 0x3B, 0xE9,
-        0x58, 0xFF, 0xC0, 0xEA, 0xE0, 0x00, 0x6C, 0xF1, 0xC8, 0xFF, 0x3D, 0xF9,
-        0x9F, 0xFD, 0x80, 0x00, 0x95, 0xF7, 0x81, 0x01, 0xD8, 0xF6, 0xD8, 0x00,
-        0xF4, 0xF7, 0x64, 0xFD, 0xEC, 0xFA, 0x29, 0xFE, 0xE1, 0xFA, 0xD9, 0xFF,
-        0x16, 0xFB, 0xDE, 0x02, 0x71, 0xFA, 0xA0, 0x04, 0x20, 0xF9, 0xAC, 0x03,
-        0xB9, 0x11, 0x07, 0x1B, 0xB3, 0x22, 0xE1, 0x29, 0x83, 0x21, 0xBF, 0x27,
-        0x0E, 0x20, 0xB0, 0x28, 0x03, 0x15, 0xDC, 0x1E, 0x9A, 0x0D, 0x02, 0x19,
-        0xA0, 0x07, 0x47, 0x17, 0x24, 0x03, 0xA9, 0x16, 0xB3, 0x00, 0xF7, 0x14,
-        0xF9, 0xFE, 0xF6, 0x0D, 0xE2, 0xFF, 0x05, 0x06, 0x57, 0x02, 0xF5, 0xFE,
-        0x4B, 0x08, 0x03, 0xFE, 0x0A, 0x09, 0xCD, 0xFE, 0xFB, 0x07, 0x54, 0x02,
-        0xE4, 0x04, 0x85, 0x01, 0xFB, 0x04, 0xD0, 0xFF, 0xAE, 0x04, 0xE6, 0xFC,
-        0x7C, 0x05, 0x4F, 0xFB, 0x9F, 0x06, 0x3F, 0xFC, 0xFE, 0xED, 0xDA, 0xE4,
-        0xFD, 0xDC, 0xEA, 0xD5, 0x5D, 0xDE, 0x36, 0xD8, 0xE2, 0xDF, 0x4B, 0xD7,
-        0x6C, 0xEA, 0xA8, 0xE0, 0xDC, 0xF1, 0x81, 0xE6, 0xDB, 0xF7, 0x35, 0xE8,
-        0x74, 0xFC, 0xF6, 0xE8, 0x32, 0xFF, 0xED, 0xEA, 0x23, 0x01, 0x41, 0xF2,
-        0x36, 0x00, 0x30, 0xFA, 0x79, 0xFD, 0x06, 0x01, 0xB4, 0xF7, 0x1E, 0x02,
-        0xDC, 0xF6, 0x31, 0x01, 0xE3, 0xF7, 0xA3, 0xFD, 0x25, 0xFB, 0x8F, 0xFE,
-        0x06, 0xFB, 0x31, 0x00, 0x2F, 0xFB, 0xF6, 0x02, 0x54, 0xFA, 0x79, 0x04,
-        0x2F, 0xF9, 0xAD, 0x03, 0xB9, 0x11, 0xFE, 0x1A, 0xD7, 0x22, 0x3D, 0x2A,
-        0x76, 0x21, 0xEB, 0x27, 0xDA, 0x1F, 0xE3, 0x28, 0x77, 0x15, 0xA1, 0x1F,
-        0xCD, 0x0D, 0xA9, 0x19, 0xB0, 0x07, 0xC4, 0x17, 0x12, 0x03, 0xDD, 0x16,
-        0x66, 0x00, 0xDD, 0x14, 0x86, 0xFE, 0x73, 0x0D, 0x83, 0xFF, 0xA2, 0x05,
-        0x21, 0x02, 0xA6, 0xFE, 0xC0, 0x07, 0x74, 0xFD, 0xB9, 0x08, 0x83, 0xFE,
-        0xD4, 0x07, 0x20, 0x02, 0x6B, 0x04, 0x25, 0x01, 0x90, 0x04, 0x83, 0xFF,
-        0x65, 0x04, 0xD6, 0xFC, 0x36, 0x05, 0x13, 0xFB, 0x7A, 0x06, 0xD5, 0xFB,
-        0x1F, 0xEE, 0x83, 0xE4, 0x00, 0xDD, 0x2D, 0xD5, 0x54, 0xDE, 0x7A, 0xD7,
-        0xDF, 0xDF, 0x85, 0xD6, 0x74, 0xEA, 0xF2, 0xDF, 0x2B, 0xF2, 0x05, 0xE6,
-        0x3B, 0xF8, 0xDC, 0xE7, 0x78, 0xFC, 0xA3, 0xE8, 0x17, 0xFF, 0xB4, 0xEA,
-        0xCD, 0x00, 0x08, 0xF2, 0xF5, 0xFF, 0xDC, 0xF9, 0xD8, 0xFD, 0x26, 0x01,
-        0x30, 0xF8, 0x39, 0x02, 0x17, 0xF7, 0xFD, 0x00, 0xFC, 0xF7, 0x89, 0xFD,
-        0x91, 0xFB, 0xA8, 0xFE, 0x6C, 0xFB, 0x50, 0x00, 0x7E, 0xFB, 0xDD, 0x02,
-        0xCB, 0xFA, 0xEF, 0x04, 0x3A, 0xF9, 0x21, 0x04, 0x87, 0x11, 0x88, 0x1B,
-        0x9E, 0x22, 0xDC, 0x2A, 0x7D, 0x21, 0x7B, 0x28, 0x2C, 0x20, 0x75, 0x29,
-        0xA2, 0x15, 0xD4, 0x1F, 0xFE, 0x0D, 0xCE, 0x19, 0x36, 0x08, 0x25, 0x18,
-        0x2C, 0x04, 0x64, 0x17, 0x6B, 0x01, 0x08, 0x15, 0xA0, 0xFF, 0x9C, 0x0D,
-        0x53, 0x00, 0xE1, 0x05, 0x44, 0x02, 0xB2, 0xFE, 0x38, 0x08, 0x2C, 0xFE,
-        0x47, 0x09, 0x63, 0xFF, 0x32, 0x08, 0x85, 0x02, 0x5D, 0x04, 0x15, 0x01,
-        0x5A, 0x04, 0x54, 0xFF, 0x41, 0x04, 0xD1, 0xFC, 0xE6, 0x04, 0xB5, 0xFA,
-        0xB5, 0x06, 0x9F, 0xFB, 0x63, 0xEE, 0x36, 0xE4, 0x3A, 0xDD, 0xF6, 0xD4,
-        0x23, 0xDE, 0x87, 0xD7, 0x17, 0xDF, 0x97, 0xD6, 0x88, 0xE9, 0x6A, 0xE0,
-        0x47, 0xF1, 0x85, 0xE6, 0x21, 0xF7, 0x44, 0xE8, 0x3E, 0xFB, 0x16, 0xE9,
-        0x3B, 0xFE, 0xBD, 0xEB, 0x09, 0x00, 0x17, 0xF3, 0x4C, 0xFF, 0x81, 0xFA,
-        0x50, 0xFD, 0x58, 0x01, 0x43, 0xF7, 0x85, 0x01, 0x8D, 0xF6, 0xA3, 0x00,
-        0x97, 0xF7, 0xAA, 0xFD, 0x5D, 0xFB, 0x1F, 0xFF, 0x70, 0xFB, 0xE7, 0x00,
-        0xB0, 0xFB, 0x5E, 0x03, 0x0C, 0xFB, 0x60, 0x05, 0x13, 0xF9, 0x34, 0x04,
-        0x76, 0x11, 0x9E, 0x1B, 0xE9, 0x22, 0xEC, 0x2A, 0x6E, 0x22, 0x7D, 0x28,
-        0xB8, 0x21, 0x50, 0x29, 0x61, 0x17, 0x7B, 0x1F, 0x1D, 0x0F, 0x07, 0x19,
-        0xC9, 0x08, 0x0D, 0x17, 0x9F, 0x04, 0x6E, 0x16, 0xAB, 0x01, 0xF5, 0x13,
-        0x1C, 0x00, 0xFE, 0x0C, 0xAA, 0x00, 0xAA, 0x05, 0xC7, 0x02, 0x24, 0xFF,
-        0x59, 0x08, 0xB5, 0xFE, 0xDB, 0x08, 0x4D, 0xFF, 0x50, 0x08, 0x98, 0x02,
-        0xE5, 0x04, 0x51, 0x01, 0xB6, 0x04, 0x6E, 0xFF, 0x41, 0x04, 0xED, 0xFC,
-        0xFF, 0x04, 0x23, 0xFB, 0xC4, 0x06, 0x33, 0xFC, 0x8F, 0xEE, 0xFD, 0xE4,
-        0xD1, 0xDC, 0x70, 0xD5, 0xFF, 0xDC, 0xAC, 0xD7, 0xE6, 0xDD, 0x16, 0xD7,
-        0x4D, 0xE8, 0xF1, 0xE0, 0x19, 0xF1, 0xA3, 0xE7, 0x99, 0xF7, 0x7E, 0xE9,
-        0xE9, 0xFB, 0x1B, 0xEA, 0x9D, 0xFE, 0x33, 0xEC, 0x28, 0x00, 0x3F, 0xF3,
-        0xF9, 0xFF, 0xE4, 0xFA, 0xAB, 0xFD, 0x58, 0x01, 0x41, 0xF8, 0xEF, 0x01,
-        0x99, 0xF7, 0x53, 0x01, 0xC4, 0xF7, 0xD7, 0xFD, 0xF1, 0xFA, 0xE1, 0xFE,
-        0x66, 0xFB, 0xFA, 0x00, 0xDB, 0xFB, 0x24, 0x03, 0xFB, 0xFA, 0x9F, 0x04,
-        0xA7, 0xF9, 0xBD, 0x03, 0xE3, 0x11, 0xE3, 0x1A, 0xC3, 0x23, 0x86, 0x2A,
-        0x56, 0x23, 0x0C, 0x28, 0x43, 0x22, 0x92, 0x28, 0xAD, 0x17, 0xA9, 0x1E,
-        0xD8, 0x0E, 0x3F, 0x18, 0x5B, 0x08, 0x9D, 0x16, 0xE3, 0x03, 0xFE, 0x15,
-        0x29, 0x01, 0xE5, 0x13, 0x6B, 0xFF, 0x9E, 0x0C, 0xCA, 0xFF, 0x2B, 0x05,
-        0x31, 0x02, 0xAE, 0xFE, 0xF2, 0x07, 0x7D, 0xFE, 0x9A, 0x08, 0x0D, 0xFF,
-        0x2E, 0x08, 0x5C, 0x02, 0xAE, 0x04, 0x2D, 0x01, 0x06, 0x04, 0x1C, 0xFF,
-        0xF3, 0x03, 0x9F, 0xFD, 0x99, 0x04, 0x0C, 0xFC, 0xF8, 0x05, 0x0A, 0xFD,
-        0x74, 0xED, 0x9C, 0xE5, 0xBD, 0xDB, 0xF9, 0xD5, 0x81, 0xDC, 0x92, 0xD8,
-        0xAF, 0xDD, 0xD9, 0xD7, 0x64, 0xE8, 0x9B, 0xE1, 0x02, 0xF1, 0x80, 0xE7,
-        0x1B, 0xF8, 0xB0, 0xE9, 0x55, 0xFC, 0x1F, 0xEA, 0x23, 0xFF, 0x67, 0xEC,
-        0xB5, 0x00, 0xAD, 0xF3, 0xD1, 0xFF, 0xAB, 0xFA, 0x4C, 0xFD, 0x30, 0x01,
-        0x3F, 0xF7, 0x20, 0x01, 0xF0, 0xF6, 0xD3, 0x00, 0x4B, 0xF7, 0x50, 0xFD,
-        0x70, 0xFB, 0xC8, 0xFE, 0x2C, 0xFC, 0x94, 0x00, 0x43, 0xFC, 0xC2, 0x01,
-        0xF6, 0xFB, 0xA1, 0x03, 0x6F, 0xFA, 0x70, 0x02, 0x24, 0x13, 0x27, 0x1A,
-        0x73, 0x24, 0x8B, 0x29, 0xFF, 0x23, 0x79, 0x27, 0xA7, 0x22, 0x6B, 0x28,
-        0xD3, 0x17, 0xD0, 0x1E, 0x34, 0x0F, 0x35, 0x19, 0x90, 0x07, 0x71, 0x16,
-        0x9B, 0x03, 0x27, 0x16, 0x04, 0x01, 0xE0, 0x13, 0xCB, 0xFF, 0xDF, 0x0C,
-        0x77, 0x00, 0xA9, 0x05, 0xDE, 0x02, 0xED, 0xFE, 0xC1, 0x08, 0xE3, 0xFE,
-        0xD8, 0x08, 0xFC, 0xFE, 0xAD, 0x08, 0xD9, 0x02, 0x70, 0x04, 0xA4, 0x01,
-        0xAF, 0x03, 0x21, 0x00, 0x11, 0x03, 0x9B, 0xFE, 0x7F, 0x03, 0xD8, 0xFC,
-        0x31, 0x05, 0xFC, 0xFD, 0x72, 0xEC, 0x1D, 0xE6, 0x99, 0xDB, 0xFE, 0xD6,
-        0xF4, 0xDB, 0xBF, 0xD8, 0x44, 0xDD, 0x87, 0xD7, 0x59, 0xE8, 0x1E, 0xE1,
-        0x0E, 0xF1, 0xA4, 0xE6, 0x77, 0xF8, 0x46, 0xE9, 0x60, 0xFC, 0xC0, 0xE9,
-        0xB8, 0xFE, 0x08, 0xEC, 0xC4, 0xFF, 0xF7, 0xF2, 0x32, 0xFF, 0x37, 0xFA,
-        0x11, 0xFD, 0x2B, 0x01, 0x37, 0xF7, 0x30, 0x01, 0x08, 0xF7, 0xD9, 0x00,
-        0x7E, 0xF7, 0x27, 0xFD, 0x95, 0xFB, 0xCD, 0xFD, 0x76, 0xFC, 0x1D, 0xFF,
-        0x89, 0xFD, 0xCF, 0x00, 0x14, 0xFD, 0x98, 0x02, 0x2D, 0xFB, 0x5B, 0x01,
-        0x04, 0x14, 0x72, 0x19, 0xAF, 0x24, 0x7C, 0x28, 0xEA, 0x23, 0x6A, 0x26,
-        0xCC, 0x22, 0x01, 0x28, 0x93, 0x17, 0x73, 0x1E, 0x2A, 0x0F, 0x73, 0x19,
-        0xFC, 0x07, 0x05, 0x17, 0xE6, 0x03, 0x3A, 0x16, 0x7F, 0x01, 0xBE, 0x13,
-        0x35, 0x00, 0x90, 0x0C, 0x12, 0x01, 0xC0, 0x05, 0x05, 0x03, 0xAF, 0xFE,
-        0x0B, 0x09, 0xF6, 0xFE, 0x55, 0x09, 0x5C, 0xFF, 0x9E, 0x08, 0xD7, 0x02,
-        0x84, 0x04, 0x3C, 0x02, 0xA2, 0x03, 0x12, 0x01, 0xAA, 0x02, 0x80, 0xFF,
-        0x21, 0x03, 0x94, 0xFD, 0x45, 0x05, 0xD7, 0xFE, 0x33, 0xEC, 0x53, 0xE6,
-        0x96, 0xDB, 0x51, 0xD7, 0x89, 0xDC, 0x6F, 0xD9, 0xA5, 0xDD, 0xE7, 0xD7,
-        0x04, 0xE9, 0x84, 0xE1, 0x1B, 0xF1, 0x18, 0xE6, 0x73, 0xF8, 0xC6, 0xE8,
-        0x87, 0xFC, 0x9D, 0xE9, 0xF7, 0xFE, 0x4A, 0xEC, 0x2C, 0x00, 0x5E, 0xF3,
-        0x2F, 0xFF, 0xEA, 0xF9, 0x24, 0xFD, 0xD8, 0x00, 0x18, 0xF7, 0x6E, 0x00,
-        0xE9, 0xF6, 0x2C, 0x00, 0x9C, 0xF7, 0xC3, 0xFC, 0xF7, 0xFB, 0xB0, 0xFD,
-        0xB3, 0xFC, 0xB3, 0xFE, 0x93, 0xFD, 0x3A, 0x00, 0xDF, 0xFC, 0x08, 0x02,
-        0xB0, 0xFA, 0xD4, 0x00, 0xF8, 0x13, 0xA8, 0x19, 0xA9, 0x24, 0xB8, 0x28,
-        0x24, 0x24, 0xFE, 0x26, 0xCF, 0x22, 0x32, 0x28, 0x8D, 0x17, 0x9B, 0x1E,
-        0x1B, 0x0F, 0xB2, 0x19, 0x93, 0x07, 0xCE, 0x16, 0x80, 0x03, 0xF6, 0x15,
-        0x28, 0x01, 0x68, 0x13, 0x06, 0x00, 0x7D, 0x0C, 0xB1, 0x00, 0xBF, 0x05,
-        0xFF, 0x02, 0x1F, 0xFF, 0xA9, 0x08, 0x42, 0xFF, 0x1F, 0x09, 0xBE, 0xFF,
-        0xC0, 0x08, 0x5C, 0x03, 0x7D, 0x04, 0x64, 0x02, 0xD1, 0x03, 0x4B, 0x01,
-        0xD0, 0x02, 0x90, 0xFF, 0xCE, 0x03, 0xFA, 0xFD, 0xA4, 0x05, 0xD8, 0xFE,
-        0xD1, 0xEC, 0x94, 0xE6, 0xF7, 0xDB, 0x79, 0xD7, 0x2D, 0xDC, 0x01, 0xD9,
-        0x74, 0xDD, 0xE8, 0xD7, 0x81, 0xE8, 0x88, 0xE1, 0x47, 0xF1, 0xC9, 0xE6,
-        0x90, 0xF8, 0x98, 0xE9, 0xB6, 0xFC, 0x65, 0xEA, 0xA4, 0xFE, 0x84, 0xEC,
-        0xEC, 0xFF, 0x7D, 0xF3, 0x85, 0xFF, 0x71, 0xFA, 0x1F, 0xFD, 0x18, 0x01,
-        0x9D, 0xF7, 0x20, 0x01, 0xD8, 0xF6, 0x6E, 0x00, 0x18, 0xF7, 0xCA, 0xFC,
-        0xEE, 0xFA, 0x84, 0xFD, 0x03, 0xFC, 0x2C, 0xFF, 0x0E, 0xFD, 0x09, 0x01,
-        0xF8, 0xFB, 0x86, 0x02, 0x5B, 0xFA, 0xB1, 0x01, 0xD0, 0x12, 0x5B, 0x19,
-        0xB9, 0x23, 0x53, 0x28, 0x83, 0x23, 0xBE, 0x26, 0xA0, 0x22, 0x1F, 0x28,
-        0x7C, 0x17, 0x49, 0x1E, 0xAC, 0x0E, 0xE8, 0x18, 0xA2, 0x07, 0x4A, 0x16,
-        0x5D, 0x03, 0x73, 0x15, 0x48, 0x01, 0x4E, 0x13, 0xE6, 0xFF, 0x5A, 0x0C,
-        0x7F, 0x00, 0x94, 0x05, 0xCF, 0x02, 0x9C, 0xFE, 0xA8, 0x08, 0xD4, 0xFE,
-        0x7A, 0x09, 0x85, 0xFF, 0xE5, 0x08, 0xD9, 0x02, 0x1B, 0x05, 0x26, 0x02,
-        0x0C, 0x04, 0x85, 0x00, 0x23, 0x03, 0xC1, 0xFE, 0x3F, 0x04, 0x6A, 0xFD,
-        0xFB, 0x05, 0xA3, 0xFE, 0x4B, 0xED, 0x0F, 0xE7, 0x40, 0xDC, 0x1C, 0xD8,
-        0xA6, 0xDC, 0xC9, 0xD9, 0xA1, 0xDD, 0x57, 0xD8, 0xB0, 0xE8, 0x0A, 0xE2,
-        0x90, 0xF1, 0x62, 0xE7, 0x82, 0xF8, 0x02, 0xEA, 0xCB, 0xFC, 0xB6, 0xEA,
-        0x51, 0xFF, 0x3D, 0xED, 0x97, 0x00, 0xF1, 0xF3, 0x96, 0xFF, 0x76, 0xFA,
-        0x19, 0xFD, 0x98, 0x01, 0x30, 0xF7, 0x92, 0x01, 0x5D, 0xF6, 0xF5, 0x00,
-        0x28, 0xF7, 0xC6, 0xFD, 0x03, 0xFB, 0x65, 0xFE, 0xA1, 0xFB, 0x81, 0xFF,
-        0x71, 0xFC, 0x1E, 0x01, 0x67, 0xFB, 0x6F, 0x02, 0xF5, 0xF9, 0x35, 0x01,
-        0xD9, 0x12, 0xB1, 0x18, 0x2C, 0x24, 0xBF, 0x27, 0x87, 0x23, 0x16, 0x26,
-        0x17, 0x22, 0x43, 0x27, 0xF3, 0x16, 0xC3, 0x1D, 0xF5, 0x0D, 0x4E, 0x18,
-        0x09, 0x07, 0xA8, 0x15, 0xAA, 0x02, 0xD0, 0x14, 0x5A, 0x00, 0x8F, 0x12,
-        0x56, 0xFF, 0x2C, 0x0C, 0x78, 0x00, 0xA9, 0x05, 0x23, 0x03, 0x64, 0xFE,
-        0xE0, 0x08, 0xFC, 0xFD, 0xBC, 0x09, 0xA3, 0xFE, 0xD0, 0x08, 0xDA, 0x01,
-        0x32, 0x05, 0xC3, 0x01, 0x7B, 0x04, 0xC2, 0x00, 0x83, 0x03, 0x09, 0xFF,
-        0xB3, 0x04, 0xF1, 0xFD, 0xE9, 0x05, 0x10, 0xFF, 0x02, 0xED, 0xC6, 0xE7,
-        0x94, 0xDB, 0xB1, 0xD8, 0x74, 0xDC, 0x54, 0xDA, 0xD6, 0xDD, 0xCE, 0xD8,
-        0x48, 0xE9, 0x61, 0xE2, 0x7E, 0xF2, 0xF3, 0xE7, 0x0D, 0xF9, 0x75, 0xEA,
-        0x78, 0xFD, 0x6B, 0xEB, 0x72, 0xFF, 0x76, 0xED, 0x75, 0x00, 0xCA, 0xF3,
-        0x45, 0xFF, 0x4F, 0xFA, 0xAD, 0xFC, 0xF4, 0x01, 0x9B, 0xF6, 0x2F, 0x02,
-        0x69, 0xF5, 0x48, 0x01, 0xA9, 0xF6, 0x3A, 0xFE, 0x48, 0xFA, 0x21, 0xFE,
-        0x85, 0xFB, 0x71, 0xFF, 0xA0, 0xFC, 0x4F, 0x01, 0x8E, 0xFB, 0x88, 0x02,
-        0x1E, 0xFA, 0x20, 0x01, 0x45, 0x13, 0x80, 0x18, 0xD6, 0x24, 0x87, 0x27,
-        0x96, 0x23, 0x9B, 0x25, 0x7C, 0x22, 0x72, 0x27, 0xC2, 0x16, 0xB1, 0x1D,
-        0x9C, 0x0D, 0x19, 0x18, 0x38, 0x07, 0x9A, 0x15, 0x11, 0x03, 0xBA, 0x14,
-        0xE8, 0x00, 0x81, 0x12, 0x7B, 0xFF, 0xED, 0x0B, 0xDE, 0x00, 0xC2, 0x05,
-        0x46, 0x03, 0xEB, 0xFD, 0xA6, 0x09, 0x07, 0xFE, 0xCD, 0x0A, 0xF6, 0xFE,
-        0x52, 0x09, 0xEB, 0x01, 0x26, 0x05, 0xA0, 0x01, 0xE1, 0x03, 0x62, 0x00,
-        0xF8, 0x02, 0xA2, 0xFE, 0xC7, 0x03, 0x0A, 0xFD, 0x7B, 0x05, 0xA6, 0xFE,
-        0x1C, 0xEC, 0x27, 0xE7, 0x89, 0xDA, 0x38, 0xD8, 0xCA, 0xDB, 0x1B, 0xDA,
-        0xEB, 0xDC, 0x50, 0xD8, 0xB2, 0xE8, 0x1F, 0xE2, 0xB8, 0xF1, 0x9E, 0xE7,
-        0x62, 0xF8, 0x81, 0xEA, 0x85, 0xFC, 0x5D, 0xEB, 0x08, 0xFF, 0xE0, 0xED,
-        0x86, 0x00, 0x3C, 0xF4, 0x0F, 0xFF, 0x2D, 0xFA, 0x9E, 0xFC, 0xDF, 0x01,
-        0x4B, 0xF6, 0xC0, 0x01, 0x69, 0xF5, 0x06, 0x01, 0xCF, 0xF6, 0xF9, 0xFD,
-        0x24, 0xFB, 0x7E, 0xFE, 0x27, 0xFC, 0x96, 0xFF, 0xF4, 0xFC, 0x6C, 0x01,
-        0x43, 0xFC, 0x4D, 0x03, 0x74, 0xFA, 0xA4, 0x01, 0xBB, 0x13, 0x02, 0x19,
-        0x54, 0x25, 0xE2, 0x27, 0x3B, 0x24, 0x31, 0x26, 0x08, 0x23, 0xBA, 0x27,
-        0x4B, 0x17, 0xD4, 0x1D, 0x46, 0x0E, 0x28, 0x18, 0x8C, 0x07, 0x19, 0x15,
-        0x75, 0x03, 0x50, 0x14, 0xE5, 0x00, 0xD8, 0x11, 0x89, 0xFF, 0xBF, 0x0B,
-        0xD8, 0x00, 0xC1, 0x05, 0x49, 0x03, 0x10, 0xFE, 0x56, 0x09, 0x09, 0xFE,
-        0x34, 0x0A, 0xCE, 0xFE, 0x01, 0x09, 0x1F, 0x02, 0xF5, 0x04, 0xB4, 0x01,
-        0x1A, 0x04, 0xAE, 0x00, 0x46, 0x03, 0xA7, 0xFE, 0xDD, 0x03, 0xAA, 0xFC,
-        0x92, 0x05, 0x4B, 0xFE, 0x64, 0xEC, 0x16, 0xE7, 0x89, 0xDA, 0xFF, 0xD7,
-        0x9F, 0xDB, 0x9F, 0xD9, 0x10, 0xDD, 0x73, 0xD8, 0xB2, 0xE8, 0x60, 0xE2,
-        0xB7, 0xF1, 0x20, 0xE8, 0x2D, 0xF8, 0xEF, 0xEA, 0x36, 0xFC, 0x7C, 0xEB,
-        0x96, 0xFE, 0xB5, 0xED, 0x2D, 0x00, 0xE8, 0xF3, 0xFA, 0xFE, 0x13, 0xFA,
-        0x6F, 0xFC, 0xB3, 0x01, 0x81, 0xF6, 0xDE, 0x01, 0x9E, 0xF5, 0x0B, 0x01,
-        0xBE, 0xF6, 0xBD, 0xFD, 0xA2, 0xFA, 0x24, 0xFE, 0x81, 0xFB, 0x3E, 0xFF,
-        0x38, 0xFC, 0x33, 0x01, 0x88, 0xFB, 0xEA, 0x02, 0x13, 0xFA, 0x6E, 0x01,
-        0x3F, 0x13, 0x7C, 0x18, 0x4E, 0x25, 0xAB, 0x27, 0x11, 0x24, 0xE7, 0x25,
-        0xB1, 0x22, 0xFB, 0x26, 0x5B, 0x17, 0x57, 0x1D, 0x7E, 0x0E, 0xBA, 0x17,
-        0x4B, 0x08, 0x51, 0x15, 0x19, 0x04, 0xAC, 0x14, 0x95, 0x01, 0x5A, 0x12,
-        0xD2, 0xFF, 0xF7, 0x0B, 0xF5, 0x00, 0xA4, 0x05, 0xA6, 0x03, 0x19, 0xFE,
-        0x9C, 0x09, 0xDC, 0xFD, 0xA5, 0x0A, 0xCB, 0xFE, 0x4D, 0x09, 0xBC, 0x01,
-        0x54, 0x05, 0x38, 0x01, 0x68, 0x04, 0x1E, 0x00, 0xA5, 0x03, 0x4C, 0xFE,
-        0x78, 0x04, 0xE0, 0xFC, 0xB2, 0x05, 0x49, 0xFE, 0x83, 0xEC, 0x40, 0xE7,
-        0x68, 0xDA, 0x1E, 0xD8, 0xED, 0xDB, 0x1C, 0xDA, 0x32, 0xDD, 0xFE, 0xD8,
-        0x36, 0xE8, 0x38, 0xE2, 0x63, 0xF1, 0xF0, 0xE7, 0x92, 0xF7, 0x38, 0xEA,
-        0x0C, 0xFC, 0xFF, 0xEA, 0x95, 0xFE, 0x80, 0xED, 0x52, 0x00, 0xED, 0xF3,
-        0x1F, 0xFF, 0x54, 0xFA, 0x6A, 0xFC, 0xEF, 0x01, 0x95, 0xF6, 0x58, 0x02,
-        0x41, 0xF5, 0x45, 0x01, 0xA9, 0xF6, 0x86, 0xFE, 0xC8, 0xFA, 0x51, 0xFF,
-        0x9C, 0xFB, 0x2C, 0x00, 0x45, 0xFC, 0xCF, 0x01, 0x5B, 0xFB, 0xF9, 0x02,
-        0x1A, 0xFA, 0xA5, 0x01, 0x34, 0x13, 0x9F, 0x18, 0x4E, 0x25, 0xD9, 0x27,
-        0xD8, 0x23, 0xE5, 0x25, 0x89, 0x22, 0xE4, 0x26, 0x83, 0x17, 0xA8, 0x1D,
-        0x31, 0x0E, 0xE5, 0x17, 0xDA, 0x07, 0x7B, 0x15, 0x5A, 0x03, 0xA6, 0x14,
-        0x30, 0x01, 0x3E, 0x12, 0xAB, 0xFF, 0xE1, 0x0B, 0xB0, 0x00, 0x29, 0x05,
-        0x6F, 0x03, 0xA3, 0xFD, 0x3A, 0x09, 0x34, 0xFD, 0x89, 0x0A, 0x35, 0xFE,
-        0x68, 0x09, 0x1B, 0x01, 0x69, 0x05, 0x47, 0x00, 0x85, 0x04, 0x7A, 0xFF,
-        0xE6, 0x03, 0xE6, 0xFD, 0xDC, 0x04, 0xE2, 0xFC, 0x3B, 0x06, 0x3A, 0xFE,
-        0x26, 0xED, 0x1E, 0xE7, 0x3F, 0xDB, 0x21, 0xD8, 0x80, 0xDC, 0xE9, 0xD9,
-        0xB4, 0xDD, 0x24, 0xD9, 0x07, 0xE9, 0xC4, 0xE2, 0x0F, 0xF2, 0x4D, 0xE8,
-        0x3D, 0xF8, 0x84, 0xEA, 0xA1, 0xFC, 0x46, 0xEB, 0xA9, 0xFE, 0xB7, 0xED,
-        0x12, 0x00, 0x03, 0xF4, 0x79, 0xFF, 0x2A, 0xFB, 0x01, 0xFD, 0xC6, 0x02,
-        0x05, 0xF7, 0xE6, 0x02, 0xF9, 0xF5, 0x18, 0x02, 0xC3, 0xF6, 0x11, 0xFF,
-        0x95, 0xFA, 0xD7, 0xFF, 0x63, 0xFB, 0xA8, 0x00, 0x38, 0xFC, 0x62, 0x02,
-        0x43, 0xFB, 0x5D, 0x03, 0x87, 0xF9, 0xBE, 0x01, 0xDD, 0x12, 0x27, 0x19,
-        0x9F, 0x24, 0xFC, 0x27, 0x5A, 0x23, 0x16, 0x26, 0x38, 0x22, 0x9D, 0x26,
-        0xB9, 0x16, 0xBA, 0x1C, 0xF1, 0x0D, 0x6D, 0x17, 0xD4, 0x07, 0x7F, 0x15,
-        0x83, 0x03, 0xF9, 0x14, 0x38, 0x01, 0x5B, 0x12, 0xAD, 0xFF, 0x07, 0x0C,
-        0x48, 0x00, 0xF9, 0x04, 0x98, 0x02, 0x6B, 0xFD, 0xA3, 0x08, 0x7D, 0xFD,
-        0x9C, 0x09, 0x36, 0xFE, 0xC8, 0x08, 0xFF, 0x00, 0xD8, 0x04, 0xC6, 0xFF,
-        0x2E, 0x04, 0xF3, 0xFE, 0xA1, 0x03, 0x62, 0xFD, 0x99, 0x04, 0x6D, 0xFC,
-        0x94, 0x06, 0x3F, 0xFE, 0x2A, 0xED, 0xB4, 0xE6, 0x44, 0xDB, 0xBA, 0xD7,
-        0xA8, 0xDC, 0xCF, 0xD9, 0xE3, 0xDD, 0x97, 0xD9, 0x44, 0xE9, 0x7F, 0xE3,
-        0xA7, 0xF1, 0x66, 0xE8, 0x0B, 0xF8, 0x6F, 0xEA, 0x8B, 0xFC, 0x03, 0xEB,
-        0xD8, 0xFE, 0x89, 0xED, 0x8A, 0x00, 0xFF, 0xF3, 0x8A, 0xFF, 0xB5, 0xFA,
-        0x2D, 0xFD, 0x2D, 0x02, 0x20, 0xF7, 0x1E, 0x02, 0x44, 0xF6, 0x86, 0x01,
-        0x54, 0xF7, 0x2F, 0xFF, 0x4E, 0xFB, 0xB6, 0x00, 0x25, 0xFC, 0xDA, 0x01,
-        0x36, 0xFC, 0x0A, 0x03, 0x74, 0xFB, 0x1B, 0x04, 0xA8, 0xF9, 0x7B, 0x02,
-        0x18, 0x13, 0xF8, 0x19, 0x02, 0x25, 0x06, 0x29, 0x57, 0x23, 0xA6, 0x26,
-        0x34, 0x22, 0xD1, 0x26, 0xA3, 0x16, 0xB3, 0x1C, 0x96, 0x0E, 0x03, 0x18,
-        0xBE, 0x07, 0xA2, 0x15, 0x10, 0x03, 0xDF, 0x14, 0x1F, 0x01, 0xAF, 0x12,
-        0x8E, 0xFF, 0x40, 0x0C, 0xEC, 0x00, 0xBE, 0x05, 0x13, 0x03, 0xE7, 0xFD,
-        0x46, 0x09, 0x08, 0xFE, 0x14, 0x0A, 0x82, 0xFE, 0xE0, 0x08, 0xA4, 0x00,
-        0x0D, 0x05, 0x29, 0xFF, 0x24, 0x04, 0xF1, 0xFD, 0x25, 0x04, 0xC6, 0xFC,
-        0xA5, 0x04, 0x8E, 0xFB, 0x85, 0x06, 0x48, 0xFD, 0x0B, 0xED, 0xCC, 0xE5,
-        0x48, 0xDB, 0xE6, 0xD6, 0x03, 0xDD, 0x32, 0xD9, 0x04, 0xDE, 0xF2, 0xD8,
-        0xB4, 0xE9, 0x26, 0xE3, 0xD5, 0xF1, 0xFE, 0xE7, 0xE6, 0xF8, 0xAC, 0xEA,
-        0x3D, 0xFD, 0x27, 0xEB, 0xEC, 0xFE, 0x3C, 0xED, 0x68, 0x00, 0x9E, 0xF3,
-        0xE3, 0xFE, 0x34, 0xFA, 0xC7, 0xFC, 0x22, 0x02, 0x6F, 0xF6, 0xFD, 0x01,
-        0xA4, 0xF5, 0x74, 0x01, 0xDF, 0xF6, 0x4B, 0xFF, 0xEF, 0xFA, 0xF3, 0x00,
-        0xD2, 0xFB, 0x13, 0x02, 0x1F, 0xFC, 0x96, 0x03, 0xB7, 0xFB, 0xF6, 0x04,
-        0xA5, 0xF9, 0x26, 0x03, 0xEA, 0x12, 0x84, 0x1A, 0x71, 0x24, 0x57, 0x29,
-        0xC8, 0x22, 0x4F, 0x27, 0x8B, 0x21, 0x78, 0x27, 0xE0, 0x15, 0x6D, 0x1D,
-        0x80, 0x0D, 0x49, 0x18, 0xA1, 0x06, 0xBB, 0x15, 0xA9, 0x02, 0x6C, 0x15,
-        0xED, 0x00, 0x17, 0x13, 0x7C, 0xFF, 0xB2, 0x0C, 0xF8, 0x00, 0xE1, 0x05,
-        0x7A, 0x03, 0x50, 0xFE, 0xBD, 0x09, 0x3B, 0xFE, 0x71, 0x0A, 0xB3, 0xFE,
-        0x22, 0x09, 0xC9, 0x00, 0x16, 0x05, 0x3B, 0xFF, 0x5B, 0x04, 0x56, 0xFE,
-        0xC9, 0x03, 0x80, 0xFC, 0x6C, 0x04, 0x3E, 0xFB, 0x5B, 0x06, 0xB3, 0xFC,
-        0x52, 0xED, 0x7C, 0xE5, 0xE4, 0xDB, 0x9A, 0xD6, 0x91, 0xDD, 0x95, 0xD8,
-        0xDE, 0xDE, 0x60, 0xD8, 0x72, 0xEA, 0x3D, 0xE2, 0x2F, 0xF3, 0xC1, 0xE7,
-        0xC5, 0xF9, 0x0D, 0xEA, 0xD9, 0xFD, 0xB5, 0xEA, 0x8A, 0xFF, 0x1A, 0xED,
-        0xC3, 0x00, 0x58, 0xF3, 0x01, 0xFF, 0xE0, 0xF9, 0x75, 0xFC, 0x5D, 0x01,
-        0x9F, 0xF6, 0xDE, 0x01, 0xF9, 0xF5, 0x78, 0x01, 0x75, 0xF7, 0x89, 0xFF,
-        0x0A, 0xFB, 0x9E, 0x00, 0xD9, 0xFB, 0x6E, 0x01, 0x7E, 0xFC, 0x63, 0x03,
-        0xEE, 0xFB, 0xBD, 0x04, 0xFD, 0xF9, 0x76, 0x03, 0xE2, 0x12, 0x94, 0x1A,
-        0x67, 0x24, 0x92, 0x29, 0x6B, 0x22, 0x40, 0x27, 0x87, 0x21, 0xC0, 0x27,
-        0xD6, 0x15, 0xD7, 0x1D, 0x19, 0x0D, 0x4B, 0x18, 0x63, 0x06, 0xE5, 0x15,
-        0x30, 0x02, 0x08, 0x15, 0xDF, 0x00, 0xE2, 0x12, 0x8E, 0xFF, 0x9C, 0x0C,
-        0x93, 0x01, 0x57, 0x06, 0x94, 0x03, 0x77, 0xFE, 0x33, 0x09, 0xCA, 0xFD,
-        0xD7, 0x09, 0x2A, 0xFE, 0xCA, 0x08, 0x79, 0x00, 0x98, 0x05, 0xB0, 0xFF,
-        0x69, 0x04, 0x8E, 0xFE, 0xDD, 0x03, 0xBB, 0xFC, 0xF5, 0x03, 0xEA, 0xFA,
-        0x21, 0x06, 0x65, 0xFC, 0x06, 0xED, 0x0C, 0xE5, 0xC2, 0xDB, 0x5E, 0xD6,
-        0xF2, 0xDD, 0x04, 0xD9, 0x76, 0xDE, 0x5D, 0xD8, 0x67, 0xEA, 0x9C, 0xE2,
-        0xAA, 0xF2, 0xBD, 0xE7, 0x8F, 0xF9, 0x36, 0xEA, 0xB1, 0xFD, 0x05, 0xEB,
-        0xFA, 0xFE, 0x22, 0xED, 0x64, 0x00, 0x7C, 0xF3, 0x9B, 0xFE, 0xFF, 0xF9,
-        0xD9, 0xFC, 0xFA, 0x01, 0xCC, 0xF6, 0x2A, 0x02, 0x74, 0xF6, 0x16, 0x02,
-        0xFF, 0xF6, 0x62, 0xFF, 0x57, 0xFA, 0x82, 0x00, 0xC8, 0xFB, 0xF4, 0x01,
-        0x57, 0xFC, 0xD0, 0x03, 0x6B, 0xFC, 0xB2, 0x05, 0xD9, 0xF9, 0xC9, 0x03,
-        0x45, 0x13, 0x60, 0x1B, 0xF7, 0x23, 0x73, 0x29, 0xB3, 0x21, 0xA1, 0x26,
-        0x81, 0x21, 0x5B, 0x27, 0xAE, 0x15, 0x1E, 0x1D, 0xAF, 0x0D, 0x24, 0x18,
-        0xC2, 0x06, 0xD4, 0x15, 0x9F, 0x02, 0x1F, 0x15, 0x94, 0x00, 0x6B, 0x12,
-        0x2C, 0xFF, 0x23, 0x0C, 0xB8, 0x00, 0x5B, 0x05, 0xD5, 0x02, 0xCE, 0xFD,
-        0x51, 0x09, 0x0C, 0xFE, 0x75, 0x09, 0x06, 0xFE, 0xFA, 0x08, 0x98, 0x00,
-        0x35, 0x05, 0xDD, 0xFE, 0x15, 0x04, 0x76, 0xFD, 0x7A, 0x03, 0x88, 0xFB,
-        0x8A, 0x03, 0xCB, 0xF9, 0x31, 0x06, 0xF9, 0xFB, 0xCB, 0xEC, 0x97, 0xE4,
-        0x1F, 0xDC, 0x8A, 0xD6, 0x44, 0xDE, 0x6E, 0xD9, 0xA1, 0xDE, 0xFD, 0xD8,
-        0xFA, 0xE9, 0x0D, 0xE3, 0x34, 0xF2, 0x6D, 0xE8, 0x06, 0xF9, 0x9E, 0xEA,
-        0x31, 0xFD, 0x36, 0xEB, 0x75, 0xFF, 0xF7, 0xED, 0xFB, 0x00, 0x39, 0xF4,
-        0x62, 0xFF, 0x0F, 0xFB, 0xCD, 0xFC, 0x2D, 0x02, 0x85, 0xF6, 0x26, 0x02,
-        0x70, 0xF6, 0x29, 0x02, 0x21, 0xF7, 0xCA, 0xFF, 0xFA, 0xFA, 0xC9, 0x01,
-        0xDC, 0xFB, 0x19, 0x03, 0x17, 0xFC, 0xD3, 0x04, 0xE0, 0xFB, 0x4F, 0x06,
-        0x91, 0xF9, 0x46, 0x04, 0xD7, 0x12, 0x44, 0x1B, 0x00, 0x24, 0xB7, 0x29,
-        0x18, 0x22, 0x11, 0x27, 0x65, 0x21, 0x20, 0x27, 0x09, 0x16, 0xF9, 0x1C,
-        0xE3, 0x0D, 0x7E, 0x17, 0x06, 0x07, 0x56, 0x15, 0xC8, 0x02, 0xC3, 0x14,
-        0xAC, 0x00, 0x7E, 0x12, 0xEF, 0xFE, 0x30, 0x0C, 0x74, 0x00, 0x34, 0x05,
-        0x21, 0x03, 0x05, 0xFE, 0x65, 0x09, 0xDD, 0xFD, 0x96, 0x09, 0xE7, 0xFD,
-        0xC8, 0x08, 0x2E, 0x00, 0x24, 0x05, 0x3E, 0xFE, 0x1F, 0x04, 0x9A, 0xFC,
-        0xE1, 0x03, 0xA8, 0xFA, 0x3C, 0x04, 0x3F, 0xF9, 0x44, 0x06, 0x3D, 0xFB,
-        0xE1, 0xEC, 0x66, 0xE4, 0x9B, 0xDB, 0x00, 0xD6, 0x7A, 0xDD, 0x9B, 0xD8,
-        0x63, 0xDE, 0xB3, 0xD8, 0xE1, 0xE9, 0xFB, 0xE2, 0xBE, 0xF1, 0x50, 0xE8,
-        0x7C, 0xF8, 0x59, 0xEA, 0x9D, 0xFC, 0xCE, 0xEA, 0xC4, 0xFE, 0xDB, 0xEC,
-        0xB4, 0x00, 0x2B, 0xF3, 0x76, 0xFF, 0x75, 0xFA, 0xFB, 0xFC, 0xFC, 0x01,
-        0x9B, 0xF6, 0x47, 0x02, 0x1A, 0xF6, 0xF9, 0x01, 0xE8, 0xF6, 0xA7, 0xFF,
-        0xB0, 0xFA, 0xB2, 0x01, 0xBC, 0xFB, 0x5E, 0x03, 0x59, 0xFC, 0xCE, 0x05,
-        0xD8, 0xFB, 0x1C, 0x07, 0xBE, 0xF9, 0xE2, 0x04, 0x4A, 0x13, 0x9C, 0x1B,
-        0x8D, 0x24, 0xDB, 0x29, 0xC7, 0x22, 0x4E, 0x27, 0xAB, 0x21, 0x3E, 0x27,
-        0x3E, 0x16, 0x20, 0x1D, 0x3D, 0x0E, 0xB6, 0x17, 0x9A, 0x07, 0xD1, 0x15,
-        0x94, 0x03, 0x6C, 0x15, 0x51, 0x01, 0x76, 0x13, 0x4C, 0xFF, 0x3D, 0x0D,
-        0x76, 0x00, 0xE4, 0x05, 0x0E, 0x03, 0x59, 0xFE, 0x66, 0x09, 0xCB, 0xFD,
-        0x2E, 0x0A, 0x36, 0xFE, 0x0E, 0x09, 0x3C, 0x00, 0x15, 0x05, 0x04, 0xFE,
-        0xFB, 0x03, 0x5B, 0xFC, 0x35, 0x03, 0xAF, 0xF9, 0x09, 0x04, 0xA0, 0xF8,
-        0x23, 0x06, 0xE0, 0xFA, 0xC7, 0xEC, 0x80, 0xE4, 0x7A, 0xDB, 0x57, 0xD6,
-        0x2F, 0xDD, 0xD8, 0xD8, 0x27, 0xDE, 0xAB, 0xD8, 0x8E, 0xE9, 0x9B, 0xE2,
-        0xC7, 0xF1, 0x35, 0xE8, 0x4A, 0xF8, 0xF2, 0xE9, 0x78, 0xFC, 0xA3, 0xEA,
-        0xC5, 0xFE, 0x99, 0xEC, 0xC8, 0x00, 0xC2, 0xF2, 0x4A, 0xFF, 0xCB, 0xF9,
-        0xBF, 0xFC, 0x6B, 0x01, 0x7D, 0xF6, 0x42, 0x02, 0x9B, 0xF5, 0xD6, 0x01,
-        0x14, 0xF7, 0x35, 0x00, 0xB0, 0xFA, 0x0D, 0x02, 0xAC, 0xFB, 0x7E, 0x03,
-        0x81, 0xFC, 0x37, 0x06, 0xC1, 0xFB, 0x68, 0x07, 0xCC, 0xF9, 0x43, 0x05,
-        0x02, 0x13, 0x68, 0x1B, 0x4E, 0x24, 0x7F, 0x29, 0x80, 0x22, 0xBE, 0x26,
-        0xE5, 0x21, 0x46, 0x27, 0x90, 0x16, 0x5F, 0x1D, 0x5A, 0x0E, 0xC5, 0x17,
-        0xBB, 0x07, 0xE1, 0x15, 0x8B, 0x03, 0x15, 0x15, 0x51, 0x01, 0x1E, 0x13,
-        0x45, 0xFF, 0xFE, 0x0C, 0x2F, 0x01, 0x4F, 0x06, 0x55, 0x03, 0x66, 0xFE,
-        0x25, 0x09, 0x16, 0xFD, 0x1D, 0x0A, 0x9E, 0xFD, 0xC1, 0x08, 0x5E, 0xFF,
-        0x6A, 0x05, 0xC1, 0xFD, 0xA4, 0x04, 0x99, 0xFC, 0xB7, 0x03, 0xC5, 0xF9,
-        0x30, 0x04, 0x56, 0xF8, 0x2D, 0x06, 0x7B, 0xFA, 0x1E, 0xED, 0x8F, 0xE4,
-        0x06, 0xDC, 0xA6, 0xD6, 0xB1, 0xDD, 0x69, 0xD9, 0x59, 0xDE, 0x04, 0xD9,
-        0x82, 0xE9, 0xED, 0xE2, 0x88, 0xF1, 0x70, 0xE8, 0x4E, 0xF8, 0x7F, 0xEA,
-        0x76, 0xFC, 0x57, 0xEB, 0x85, 0xFE, 0x18, 0xED, 0xAE, 0x00, 0x58, 0xF3,
-        0xEB, 0xFE, 0x25, 0xFA, 0x95, 0xFC, 0xC5, 0x01, 0x0A, 0xF7, 0x3C, 0x03,
-        0xE9, 0xF5, 0x67, 0x02, 0xEA, 0xF6, 0x47, 0x00, 0x80, 0xFA, 0x2B, 0x02,
-        0x4F, 0xFB, 0x76, 0x03, 0x47, 0xFC, 0x52, 0x06, 0x82, 0xFB, 0x8D, 0x07,
-        0x9F, 0xF9, 0x5F, 0x05, 0xA9, 0x12, 0x55, 0x1B, 0xC0, 0x23, 0x30, 0x29,
-        0x48, 0x22, 0x9B, 0x26, 0x83, 0x21, 0xBD, 0x26, 0x68, 0x16, 0xA7, 0x1C,
-        0x76, 0x0E, 0x06, 0x17, 0x1F, 0x08, 0x55, 0x15, 0xCD, 0x03, 0x56, 0x14,
-        0xB3, 0x01, 0xA1, 0x12, 0x66, 0xFF, 0x56, 0x0C, 0xDC, 0x00, 0x31, 0x05,
-        0x9F, 0x03, 0x1C, 0xFE, 0x2D, 0x09, 0xBB, 0xFC, 0x45, 0x0A, 0xB9, 0xFD,
-        0x06, 0x09, 0xAD, 0xFF, 0x2C, 0x05, 0x60, 0xFD, 0x7B, 0x04, 0x16, 0xFC,
-        0xBB, 0x03, 0x3E, 0xF9, 0xDE, 0x04, 0x4E, 0xF8, 0xB5, 0x06, 0x80, 0xFA,
-        0x7E, 0xED, 0x5F, 0xE4, 0x22, 0xDC, 0x3A, 0xD6, 0xC3, 0xDD, 0xF5, 0xD8,
-        0xA2, 0xDE, 0xF4, 0xD8, 0xB8, 0xE9, 0x45, 0xE3, 0xF0, 0xF1, 0x58, 0xE9,
-        0xF9, 0xF7, 0xDA, 0xEA, 0x33, 0xFC, 0xC1, 0xEB, 0x6E, 0xFE, 0x74, 0xED,
-        0xBE, 0x00, 0xB0, 0xF3, 0x2C, 0xFF, 0xBE, 0xFA, 0x5A, 0xFC, 0xE6, 0x01,
-        0x01, 0xF7, 0x71, 0x03, 0x15, 0xF6, 0xAE, 0x02, 0x67, 0xF7, 0xBA, 0x00,
-        0x16, 0xFB, 0x09, 0x03, 0x79, 0xFB, 0x42, 0x04, 0xEC, 0xFB, 0x06, 0x07,
-        0x11, 0xFB, 0x72, 0x08, 0x32, 0xF9, 0x24, 0x06, 0x63, 0x12, 0x27, 0x1C,
-        0xF9, 0x23, 0x7E, 0x2A, 0x62, 0x22, 0xC2, 0x27, 0x70, 0x21, 0xB6, 0x27,
-        0x53, 0x16, 0x28, 0x1D, 0x1C, 0x0E, 0xEE, 0x16, 0xBC, 0x07, 0xE6, 0x14,
-        0xF0, 0x03, 0x5E, 0x14, 0xC1, 0x01, 0xD7, 0x12, 0x7A, 0xFF, 0xBA, 0x0C,
-        0x10, 0x01, 0xA4, 0x05, 0x73, 0x03, 0xFA, 0xFD, 0xD9, 0x08, 0x49, 0xFC,
-        0x7E, 0x09, 0xCB, 0xFC, 0xE0, 0x08, 0x65, 0xFF, 0x73, 0x05, 0x56, 0xFD,
-        0xF4, 0x04, 0xDF, 0xFB, 0x4A, 0x04, 0xC1, 0xF8, 0xD8, 0x04, 0xE2, 0xF6,
-        0xDE, 0x06, 0x70, 0xF9, 0x9D, 0xED, 0x83, 0xE3, 0x53, 0xDC, 0x97, 0xD5,
-        0x9A, 0xDD, 0x10, 0xD8, 0x9E, 0xDE, 0x1B, 0xD8, 0xC8, 0xE9, 0xB0, 0xE2,
-        0xB5, 0xF1, 0xA5, 0xE8, 0x44, 0xF8, 0xE0, 0xEA, 0xB7, 0xFB, 0x1A, 0xEB,
-        0x0E, 0xFE, 0xAB, 0xEC, 0x45, 0x00, 0x97, 0xF2, 0xFF, 0xFE, 0x0B, 0xFA,
-        0xC7, 0xFC, 0xFE, 0x01, 0x08, 0xF7, 0x9E, 0x03, 0x47, 0xF6, 0x37, 0x03,
-        0x68, 0xF6, 0x3F, 0x00, 0xE9, 0xF9, 0x82, 0x02, 0x97, 0xFA, 0x2F, 0x04,
-        0x92, 0xFB, 0xBE, 0x07, 0xE8, 0xFA, 0x99, 0x09, 0xCC, 0xF8, 0xE3, 0x06,
-        0x76, 0x12, 0x1D, 0x1D, 0x8C, 0x23, 0xAB, 0x2A, 0x30, 0x22, 0x03, 0x28,
-        0x02, 0x21, 0xDF, 0x27, 0xF2, 0x15, 0x72, 0x1D, 0x3C, 0x0E, 0xC2, 0x17,
-        0xC8, 0x07, 0xB0, 0x15, 0x59, 0x04, 0x52, 0x15, 0xC7, 0x01, 0x8C, 0x13,
-        0x94, 0xFF, 0x89, 0x0D, 0xFA, 0x00, 0x28, 0x06, 0x9D, 0x03, 0x66, 0xFE,
-        0x99, 0x09, 0xC6, 0xFC, 0x52, 0x0A, 0xE0, 0xFC, 0x08, 0x0A, 0x8A, 0xFF,
-        0x3B, 0x06, 0xFC, 0xFC, 0x7B, 0x05, 0x63, 0xFB, 0xC3, 0x04, 0x3F, 0xF8,
-        0x81, 0x05, 0x93, 0xF6, 0x33, 0x07, 0xFC, 0xF8, 0x44, 0xED, 0xA4, 0xE2,
-        0x15, 0xDC, 0x1E, 0xD5, 0xB4, 0xDD, 0x1F, 0xD8, 0xE4, 0xDE, 0x38, 0xD8,
-        0xD2, 0xE9, 0x60, 0xE2, 0x6F, 0xF1, 0xAE, 0xE7, 0xC1, 0xF7, 0x86, 0xE9,
-        0x89, 0xFB, 0x40, 0xEA, 0x14, 0xFE, 0x1A, 0xEC, 0x2F, 0x00, 0x26, 0xF2,
-        0x9C, 0xFE, 0x80, 0xF9, 0xA0, 0xFB, 0x14, 0x01, 0xA5, 0xF5, 0xEC, 0x02,
-        0x40, 0xF5, 0x6A, 0x03, 0xC5, 0xF5, 0x24, 0x01, 0x5A, 0xF9, 0x89, 0x03,
-        0x1B, 0xFA, 0xE2, 0x04, 0x81, 0xFA, 0x7D, 0x07, 0xEE, 0xF9, 0x31, 0x09,
-        0xCE, 0xF8, 0x38, 0x07, 0xB3, 0x12, 0x8F, 0x1D, 0xCD, 0x23, 0xF0, 0x2A,
-        0x19, 0x22, 0xD7, 0x27, 0xF9, 0x20, 0xD8, 0x27, 0xF5, 0x15, 0xBD, 0x1D,
-        0x1E, 0x0E, 0x76, 0x18, 0xCB, 0x07, 0xBC, 0x16, 0x09, 0x04, 0xF7, 0x15,
-        0xB2, 0x01, 0x23, 0x14, 0xC1, 0xFF, 0x0E, 0x0E, 0x4E, 0x01, 0x85, 0x06,
-        0x33, 0x04, 0xC2, 0xFE, 0x1B, 0x0A, 0xCA, 0xFC, 0x8B, 0x0A, 0x3B, 0xFC,
-        0xFE, 0x09, 0x7A, 0xFE, 0xAA, 0x06, 0x6F, 0xFC, 0xEC, 0x05, 0x66, 0xFB,
-        0x5C, 0x05, 0xEB, 0xF8, 0xB8, 0x05, 0x29, 0xF7, 0xB3, 0x06, 0x07, 0xF9,
-        0x16, 0xED, 0xE6, 0xE2, 0x1C, 0xDC, 0x84, 0xD5, 0xD2, 0xDD, 0x8D, 0xD8,
-        0x12, 0xDF, 0x8B, 0xD8, 0x30, 0xEA, 0xA8, 0xE2, 0x2C, 0xF2, 0xD8, 0xE7,
-        0x6D, 0xF8, 0x73, 0xE9, 0xF4, 0xFB, 0xF7, 0xE9, 0x17, 0xFE, 0xB3, 0xEB,
-        0x76, 0x00, 0x49, 0xF2, 0x15, 0xFF, 0x05, 0xFA, 0x0E, 0xFC, 0xA1, 0x01,
-        0x14, 0xF6, 0x7A, 0x03, 0x3B, 0xF5, 0x9A, 0x03, 0xAD, 0xF5, 0x29, 0x01,
-        0x23, 0xF9, 0x38, 0x03, 0x10, 0xFA, 0x49, 0x04, 0xAD, 0xFA, 0xB6, 0x06,
-        0x43, 0xFA, 0x7C, 0x08, 0x3C, 0xF9, 0xA0, 0x06, 0xAD, 0x12, 0xC9, 0x1C,
-        0xBE, 0x23, 0x3C, 0x2A, 0xE5, 0x21, 0x1D, 0x27, 0x87, 0x20, 0xF0, 0x26,
-        0x28, 0x15, 0x9F, 0x1C, 0x7D, 0x0D, 0xA7, 0x17, 0x71, 0x07, 0x3C, 0x16,
-        0xEE, 0x03, 0xA2, 0x15, 0xD8, 0x01, 0xF2, 0x13, 0xEF, 0xFE, 0xEB, 0x0C,
-        0x5F, 0x00, 0x58, 0x05, 0xA0, 0x03, 0x24, 0xFE, 0xD2, 0x09, 0x79, 0xFC,
-        0xB8, 0x0A, 0x7D, 0xFC, 0x25, 0x0A, 0xDA, 0xFE, 0x72, 0x06, 0xA9, 0xFC,
-        0x9E, 0x05, 0xBE, 0xFB, 0x70, 0x05, 0xA0, 0xF9, 0x0D, 0x06, 0xD4, 0xF7,
-        0x70, 0x07, 0xDF, 0xF9, 0xB7, 0xED, 0x46, 0xE3, 0x61, 0xDC, 0xA4, 0xD5,
-        0x69, 0xDE, 0xFE, 0xD8, 0xA2, 0xDF, 0x04, 0xD9, 0x02, 0xEB, 0x55, 0xE3,
-        0x9E, 0xF2, 0x42, 0xE8, 0xD5, 0xF8, 0xDE, 0xE9, 0x53, 0xFC, 0x75, 0xEA,
-        0xBB, 0xFE, 0x57, 0xEC, 0x9D, 0x01, 0x2C, 0xF3, 0xE3, 0xFF, 0x48, 0xFA,
-        0xB4, 0xFC, 0x7C, 0x01, 0x95, 0xF6, 0x49, 0x03, 0xCD, 0xF5, 0x72, 0x03,
-        0x5D, 0xF6, 0x09, 0x01, 0x5D, 0xFA, 0x84, 0x03, 0xC1, 0xFA, 0x0A, 0x04,
-        0xAD, 0xFA, 0x17, 0x06, 0x47, 0xFA, 0x41, 0x08, 0x8B, 0xF8, 0x10, 0x06,
-        0x69, 0x12, 0xCA, 0x1C, 0xD3, 0x23, 0x7B, 0x2A, 0xDB, 0x21, 0x1A, 0x27,
-        0x76, 0x20, 0xE6, 0x26, 0x62, 0x15, 0xE2, 0x1C, 0x9A, 0x0D, 0xBD, 0x17,
-        0x14, 0x07, 0xD1, 0x15, 0xED, 0x03, 0x9C, 0x15, 0x9D, 0x01, 0xF3, 0x13,
-        0xF5, 0xFE, 0x68, 0x0D, 0x72, 0x00, 0x23, 0x06, 0x6C, 0x03, 0xBA, 0xFE,
-        0x34, 0x09, 0x8E, 0xFC, 0x08, 0x0A, 0x83, 0xFC, 0xBA, 0x09, 0x3F, 0xFF,
-        0xBC, 0x05, 0xD2, 0xFC, 0x65, 0x05, 0x50, 0xFC, 0x70, 0x05, 0x12, 0xFA,
-        0xE3, 0x05, 0xF1, 0xF7, 0x7D, 0x07, 0xD7, 0xF9, 0xE6, 0xED, 0x54, 0xE3,
-        0x9D, 0xDC, 0x9F, 0xD5, 0x62, 0xDE, 0xA6, 0xD8, 0x13, 0xE0, 0x14, 0xD9,
-        0x4F, 0xEB, 0x27, 0xE3, 0x27, 0xF3, 0x74, 0xE8, 0x85, 0xF9, 0x2B, 0xEA,
-        0x9B, 0xFC, 0x49, 0xEA, 0x68, 0xFE, 0x73, 0xEB, 0x01, 0x01, 0x00, 0xF2,
-        0xDC, 0xFF, 0xD6, 0xF9, 0xEB, 0xFC, 0x59, 0x01, 0xF2, 0xF6, 0x68, 0x03,
-        0xEB, 0xF5, 0x24, 0x03, 0x9C, 0xF6, 0xA9, 0x00, 0x72, 0xFA, 0xD6, 0x02,
-        0x41, 0xFB, 0xD0, 0x03, 0x7E, 0xFB, 0x61, 0x06, 0x92, 0xFA, 0xFE, 0x07,
-        0x0B, 0xF9, 0x31, 0x06, 0x73, 0x12, 0xA1, 0x1C, 0xAF, 0x23, 0x74, 0x2A,
-        0xA0, 0x21, 0x66, 0x27, 0x1E, 0x20, 0x4E, 0x27, 0x98, 0x14, 0x10, 0x1D,
-        0xF0, 0x0C, 0xE6, 0x17, 0x0C, 0x07, 0xAC, 0x16, 0x91, 0x03, 0x39, 0x16,
-        0xD1, 0x01, 0x23, 0x15, 0xE6, 0xFE, 0x3B, 0x0E, 0x42, 0x00, 0x6C, 0x06,
-        0x41, 0x03, 0xEE, 0xFE, 0x99, 0x09, 0x29, 0xFD, 0xBA, 0x0A, 0xAB, 0xFD,
-        0x5D, 0x09, 0xA6, 0xFF, 0xBF, 0x05, 0xC0, 0xFD, 0xB2, 0x04, 0x78, 0xFC,
-        0xA7, 0x04, 0xE7, 0xF9, 0xAA, 0x05, 0x43, 0xF8, 0x64, 0x07, 0x22, 0xFA,
-        0xF1, 0xED, 0x81, 0xE3, 0x88, 0xDC, 0x4D, 0xD5, 0xFE, 0xDE, 0x8C, 0xD8,
-        0x51, 0xE0, 0x49, 0xD8, 0xF7, 0xEB, 0xA7, 0xE2, 0x4A, 0xF3, 0xAD, 0xE7,
-        0x12, 0xF9, 0x0C, 0xE9, 0xBD, 0xFC, 0xCA, 0xE9, 0x7A, 0xFE, 0xF7, 0xEA,
-        0x7B, 0x01, 0x06, 0xF2, 0xA9, 0xFF, 0x80, 0xF9, 0xA1, 0xFC, 0x16, 0x01,
-        0x4B, 0xF6, 0xDC, 0x02, 0x8B, 0xF5, 0xA6, 0x02, 0x03, 0xF7, 0x7B, 0x00,
-        0xA3, 0xFA, 0x36, 0x02, 0xB3, 0xFB, 0x7A, 0x03, 0x62, 0xFB, 0xDB, 0x05,
-        0x84, 0xFA, 0xB2, 0x07, 0xA9, 0xF8, 0xCF, 0x05, 0x27, 0x12, 0x76, 0x1C,
-        0xA0, 0x23, 0xC5, 0x2A, 0x66, 0x21, 0xDD, 0x27, 0xFC, 0x1F, 0x22, 0x28,
-        0x40, 0x14, 0xB3, 0x1D, 0xE9, 0x0C, 0x7B, 0x18, 0xFB, 0x06, 0xB1, 0x16,
-        0x84, 0x03, 0x10, 0x16, 0xB9, 0x01, 0xD1, 0x14, 0xEE, 0xFE, 0x15, 0x0E,
-        0xA7, 0x00, 0x8B, 0x06, 0x78, 0x03, 0xCB, 0xFE, 0xC8, 0x09, 0xF0, 0xFC,
-        0x73, 0x0A, 0x34, 0xFD, 0x51, 0x09, 0xDD, 0xFF, 0x8F, 0x05, 0x3D, 0xFE,
-        0x80, 0x04, 0xF7, 0xFC, 0xB0, 0x04, 0x54, 0xFA, 0xC1, 0x05, 0x82, 0xF8,
-        0xA7, 0x07, 0x62, 0xFA, 0x65, 0xEE, 0xFF, 0xE3, 0xE4, 0xDC, 0xC0, 0xD5,
-        0xAB, 0xDE, 0x4B, 0xD8, 0x33, 0xE0, 0x1E, 0xD8, 0xD6, 0xEB, 0x78, 0xE2,
-        0x5A, 0xF3, 0x03, 0xE8, 0x1E, 0xF9, 0xE2, 0xE9, 0x33, 0xFC, 0x46, 0xEA,
-        0x0A, 0xFE, 0x92, 0xEB, 0xE1, 0x00, 0x3D, 0xF2, 0x75, 0xFF, 0xE1, 0xF9,
-        0xC3, 0xFC, 0xB0, 0x01, 0x8A, 0xF6, 0x94, 0x03, 0x5D, 0xF5, 0xDD, 0x02,
-        0x58, 0xF6, 0xEE, 0xFF, 0x45, 0xFA, 0x91, 0x01, 0x7F, 0xFB, 0xF2, 0x02,
-        0x7B, 0xFB, 0xCE, 0x05, 0x39, 0xFA, 0x99, 0x07, 0x4E, 0xF8, 0xC2, 0x05,
-        0x4E, 0x11, 0xF4, 0x1B, 0xC9, 0x22, 0xF5, 0x29, 0x33, 0x21, 0x8E, 0x27,
-        0xA5, 0x1F, 0xA7, 0x27, 0xEE, 0x13, 0x5B, 0x1D, 0x87, 0x0C, 0xFA, 0x17,
-        0xD7, 0x06, 0x19, 0x16, 0xB3, 0x03, 0x9B, 0x15, 0xCB, 0x01, 0x4F, 0x14,
-        0xDA, 0xFE, 0xA0, 0x0D, 0x38, 0x00, 0x44, 0x06, 0xD5, 0x02, 0x7C, 0xFE,
-        0x09, 0x09, 0xA5, 0xFC, 0x34, 0x0A, 0x3A, 0xFD, 0x46, 0x09, 0x26, 0x00,
-        0x5C, 0x05, 0xA5, 0xFE, 0x15, 0x04, 0x3F, 0xFD, 0x1B, 0x04, 0x60, 0xFA,
-        0x72, 0x05, 0x9D, 0xF8, 0x7C, 0x07, 0x54, 0xFA, 0x41, 0xEE, 0xF4, 0xE3,
-        0x15, 0xDD, 0x30, 0xD6, 0xB3, 0xDE, 0xD9, 0xD8, 0x05, 0xE0, 0x6F, 0xD8,
-        0xFC, 0xEB, 0xD7, 0xE2, 0x55, 0xF3, 0xFE, 0xE7, 0x25, 0xF9, 0xEC, 0xE9,
-        0xA2, 0xFC, 0xC3, 0xEA, 0xB0, 0xFE, 0x3C, 0xEC, 0x43, 0x01, 0x7D, 0xF2,
-        0xA6, 0xFF, 0x6E, 0xF9, 0x3F, 0xFD, 0x49, 0x01, 0xFA, 0xF6, 0x0F, 0x03,
-        0xFB, 0xF5, 0xD8, 0x02, 0xEE, 0xF6, 0x23, 0x00, 0xB2, 0xFA, 0x84, 0x01,
-        0xC7, 0xFB, 0xB7, 0x02, 0xCE, 0xFB, 0x89, 0x05, 0x8A, 0xFA, 0x68, 0x07,
-        0x32, 0xF8, 0x72, 0x05, 0xA1, 0x11, 0x1C, 0x1C, 0xCC, 0x22, 0xD3, 0x29,
-        0x00, 0x21, 0xD1, 0x26, 0xE7, 0x1F, 0x5E, 0x27, 0xF4, 0x13, 0x12, 0x1D,
-        0x69, 0x0C, 0xDA, 0x17, 0x71, 0x06, 0xE7, 0x15, 0xF0, 0x02, 0x10, 0x15,
-        0xF2, 0x00, 0xA7, 0x13, 0x76, 0xFE, 0x7D, 0x0D, 0x06, 0x00, 0xA5, 0x06,
-        0x2E, 0x02, 0xBC, 0xFE, 0x5E, 0x08, 0xFF, 0xFC, 0x80, 0x09, 0x3F, 0xFD,
-        0x9F, 0x08, 0xE2, 0xFF, 0xDF, 0x04, 0x7C, 0xFE, 0xCA, 0x03, 0x4F, 0xFD,
-        0xD9, 0x03, 0xB0, 0xFA, 0xF7, 0x04, 0xBF, 0xF8, 0x4C, 0x07, 0xA6, 0xFA,
-        0x00, 0xEE, 0x03, 0xE4, 0x8B, 0xDC, 0xF4, 0xD5, 0x4C, 0xDE, 0xF4, 0xD8,
-        0x98, 0xDF, 0xAD, 0xD8, 0xBA, 0xEB, 0x0E, 0xE3, 0x51, 0xF3, 0x30, 0xE8,
-        0x65, 0xF9, 0x1F, 0xEA, 0xC9, 0xFC, 0xBE, 0xEA, 0x33, 0xFE, 0x98, 0xEB,
-        0x02, 0x01, 0x1C, 0xF2, 0xDA, 0xFF, 0x53, 0xF9, 0xA3, 0xFD, 0x10, 0x01,
-        0x58, 0xF7, 0x97, 0x02, 0x2F, 0xF6, 0x65, 0x02, 0x24, 0xF7, 0xFB, 0xFF,
-        0xDC, 0xFA, 0x68, 0x01, 0x2C, 0xFC, 0xDB, 0x02, 0xF8, 0xFB, 0x37, 0x05,
-        0xBD, 0xFA, 0xEB, 0x06, 0x91, 0xF8, 0x18, 0x05, 0xD7, 0x11, 0xC0, 0x1B,
-        0x6E, 0x23, 0xF9, 0x29, 0xE0, 0x21, 0x22, 0x27, 0xA5, 0x20, 0x6D, 0x27,
-        0x34, 0x14, 0xBD, 0x1C, 0xC5, 0x0C, 0xD7, 0x17, 0x9B, 0x06, 0xE1, 0x15,
-        0x18, 0x03, 0x40, 0x15, 0xE6, 0x01, 0xB0, 0x14, 0xE9, 0xFE, 0xF0, 0x0D,
-        0xDD, 0xFF, 0x97, 0x06, 0x5C, 0x02, 0x28, 0xFF, 0xE3, 0x08, 0xF5, 0xFD,
-        0xF3, 0x09, 0xFE, 0xFD, 0xDB, 0x08, 0x25, 0x00, 0x1B, 0x05, 0xA4, 0xFE,
-        0xE1, 0x03, 0x26, 0xFD, 0xF3, 0x03, 0xB1, 0xFA, 0x10, 0x05, 0xF4, 0xF8,
-        0x50, 0x07, 0xEB, 0xFA, 0xE1, 0xED, 0x1D, 0xE4, 0x5F, 0xDC, 0xEA, 0xD5,
-        0xE9, 0xDD, 0xB3, 0xD8, 0x01, 0xDF, 0x41, 0xD8, 0x65, 0xEB, 0xD9, 0xE2,
-        0xC7, 0xF2, 0xA5, 0xE7, 0x20, 0xF9, 0xD1, 0xE9, 0xD2, 0xFC, 0x82, 0xEA,
-        0x0C, 0xFE, 0x11, 0xEB, 0x00, 0x01, 0xB7, 0xF1, 0xDF, 0xFF, 0xE1, 0xF8,
-        0x1B, 0xFD, 0x07, 0x00, 0xD9, 0xF6, 0x7B, 0x01, 0xFD, 0xF5, 0xBA, 0x01,
-        0xDC, 0xF6, 0x6C, 0xFF, 0x9D, 0xFA, 0xEB, 0x00, 0x94, 0xFB, 0x46, 0x02,
-        0x9C, 0xFB, 0xCA, 0x04, 0xC4, 0xFA, 0xD2, 0x06, 0x90, 0xF8, 0xC6, 0x04,
-        0xF2, 0x11, 0x77, 0x1B, 0x6E, 0x23, 0xA5, 0x29, 0xFA, 0x21, 0xEF, 0x26,
-        0xE7, 0x20, 0x77, 0x27, 0xB1, 0x14, 0x1A, 0x1D, 0x52, 0x0D, 0x49, 0x18,
-        0xD8, 0x06, 0xD4, 0x15, 0xF2, 0x02, 0xE5, 0x14, 0xA9, 0x01, 0x45, 0x14,
-        0xEF, 0xFE, 0xD9, 0x0D, 0x1E, 0x00, 0xD8, 0x06, 0x22, 0x03, 0xCD, 0xFF,
-        0x2F, 0x09, 0x36, 0xFE, 0xFE, 0x09, 0xB9, 0xFD, 0x66, 0x09, 0x5C, 0x00,
-        0xB6, 0x05, 0x00, 0xFF, 0x96, 0x04, 0x8C, 0xFD, 0x7C, 0x04, 0xFE, 0xFA,
-        0x31, 0x05, 0xDB, 0xF8, 0x55, 0x07, 0xFB, 0xFA, 0x0A, 0xEE, 0x7B, 0xE4,
-        0xAD, 0xDC, 0x85, 0xD6, 0x29, 0xDE, 0x52, 0xD9, 0x1E, 0xDF, 0x8B, 0xD8,
-        0x27, 0xEB, 0xA7, 0xE2, 0x87, 0xF2, 0x61, 0xE7, 0xB8, 0xF8, 0xBC, 0xE9,
-        0xAC, 0xFC, 0xBD, 0xEA, 0x3B, 0xFE, 0x9C, 0xEB, 0x20, 0x01, 0x09, 0xF2,
-        0xFD, 0xFF, 0xE8, 0xF8, 0x25, 0xFD, 0x00, 0x00, 0xE2, 0xF6, 0x64, 0x01,
-        0xE3, 0xF5, 0xC4, 0x01, 0x95, 0xF6, 0x44, 0xFF, 0x70, 0xFA, 0xA8, 0x00,
-        0xCC, 0xFB, 0x4B, 0x02, 0xDA, 0xFB, 0xD3, 0x04, 0x14, 0xFB, 0x02, 0x07,
-        0xFF, 0xF8, 0xF4, 0x04, 0x2C, 0x12, 0x5F, 0x1B, 0x8A, 0x23, 0x3B, 0x29,
-        0xC9, 0x21, 0x28, 0x26, 0xD5, 0x20, 0xFF, 0x26, 0xD7, 0x14, 0x11, 0x1D,
-        0x75, 0x0D, 0x6C, 0x18, 0x7B, 0x07, 0x15, 0x16, 0xB2, 0x03, 0x25, 0x15,
-        0x08, 0x02, 0x20, 0x14, 0xB0, 0xFE, 0x6C, 0x0D, 0xF6, 0xFF, 0xFC, 0x06,
-        0xCE, 0x02, 0x13, 0x00, 0x3A, 0x09, 0xFE, 0xFE, 0x68, 0x0A, 0xAC, 0xFE,
-        0x59, 0x09, 0xD5, 0x00, 0x3B, 0x05, 0x4D, 0xFF, 0x9D, 0x03, 0x84, 0xFD,
-        0xEF, 0x03, 0x5E, 0xFB, 0xBE, 0x04, 0x1F, 0xF9, 0xB9, 0x06, 0xEF, 0xFA,
-        0x94, 0xED, 0x81, 0xE4, 0x20, 0xDC, 0x8A, 0xD6, 0xF4, 0xDD, 0xCB, 0xD9,
-        0xE8, 0xDE, 0xDE, 0xD8, 0x38, 0xEB, 0xF7, 0xE2, 0x9F, 0xF2, 0x80, 0xE7,
-        0x9D, 0xF8, 0xF0, 0xE9, 0x62, 0xFC, 0xFD, 0xEA, 0xFB, 0xFD, 0xF4, 0xEB,
-        0x83, 0x01, 0xC2, 0xF2, 0x1A, 0x00, 0xC1, 0xF8, 0x47, 0xFD, 0x89, 0xFF,
-        0xB9, 0xF6, 0x65, 0x00, 0xA5, 0xF5, 0x0F, 0x01, 0xC1, 0xF6, 0x2E, 0xFF,
-        0xD6, 0xFA, 0xB4, 0x00, 0x7B, 0xFC, 0xA1, 0x02, 0xEF, 0xFB, 0x7F, 0x04,
-        0x07, 0xFB, 0xDD, 0x06, 0x04, 0xF9, 0x0A, 0x05, 0x36, 0x12, 0x97, 0x1B,
-        0xE7, 0x23, 0xAE, 0x29, 0x55, 0x22, 0x72, 0x26, 0x61, 0x21, 0x40, 0x27,
-        0xE2, 0x14, 0xE2, 0x1C, 0x4A, 0x0D, 0x3B, 0x18, 0x42, 0x07, 0x94, 0x15,
-        0xD1, 0x03, 0xC7, 0x14, 0x24, 0x02, 0xB4, 0x13, 0xE9, 0xFE, 0x45, 0x0D,
-        0x3B, 0x00, 0x88, 0x07, 0xCF, 0x02, 0xB1, 0x00, 0x25, 0x09, 0xD7, 0xFF,
-        0x18, 0x0A, 0xE5, 0xFE, 0x51, 0x09, 0xF0, 0x00, 0x1E, 0x05, 0x42, 0xFF,
-        0xA7, 0x03, 0x7F, 0xFD, 0x10, 0x04, 0x91, 0xFB, 0xEC, 0x04, 0x2C, 0xF9,
-        0x26, 0x07, 0x45, 0xFB, 0x05, 0xEE, 0xCF, 0xE4, 0x1B, 0xDC, 0x9F, 0xD6,
-        0x23, 0xDD, 0x85, 0xD9, 0x93, 0xDE, 0x5B, 0xD9, 0xE1, 0xEA, 0x93, 0xE3,
-        0xAF, 0xF2, 0x5C, 0xE8, 0xC2, 0xF8, 0x21, 0xEB, 0xCE, 0xFB, 0x80, 0xEB,
-        0x7B, 0xFD, 0x87, 0xEC, 0x72, 0x00, 0x9C, 0xF2, 0x84, 0xFF, 0x85, 0xF8,
-        0x0E, 0xFD, 0x5A, 0xFF, 0x2C, 0xF7, 0x82, 0x00, 0x18, 0xF6, 0x7F, 0x01,
-        0x82, 0xF6, 0x42, 0xFF, 0xC1, 0xFA, 0x1A, 0x01, 0x0A, 0xFC, 0xBE, 0x02,
-        0xEC, 0xFB, 0xE6, 0x04, 0xD8, 0xFA, 0x02, 0x07, 0xDB, 0xF8, 0xF2, 0x04,
-        0xB8, 0x11, 0x1A, 0x1B, 0xA2, 0x23, 0x2C, 0x29, 0xE4, 0x22, 0x8B, 0x26,
-        0x0F, 0x21, 0x46, 0x26, 0x12, 0x15, 0x68, 0x1C, 0x45, 0x0D, 0xC8, 0x17,
-        0x6B, 0x07, 0x3A, 0x15, 0x4F, 0x04, 0xF5, 0x14, 0xB0, 0x02, 0x1C, 0x14,
-        0xFA, 0xFF, 0x64, 0x0E, 0x96, 0x00, 0x47, 0x08, 0x02, 0x03, 0x5F, 0x01,
-        0xA3, 0x08, 0xF9, 0xFF, 0xFB, 0x09, 0x04, 0xFF, 0x57, 0x09, 0xD5, 0x00,
-        0x55, 0x05, 0x0E, 0xFF, 0x38, 0x04, 0x6A, 0xFD, 0x17, 0x04, 0xF2, 0xFA,
-        0x60, 0x05, 0x06, 0xF9, 0x13, 0x07, 0xF4, 0xFA, 0x5E, 0xEE, 0x0A, 0xE5,
-        0xA9, 0xDC, 0x23, 0xD7, 0xD4, 0xDD, 0x2F, 0xDA, 0x8B, 0xDF, 0x29, 0xDA,
-        0x40, 0xEB, 0xB9, 0xE3, 0x16, 0xF3, 0x52, 0xE8, 0xBE, 0xF8, 0xD2, 0xEA,
-        0x2F, 0xFC, 0x6D, 0xEB, 0xCB, 0xFD, 0x31, 0xEC, 0x6C, 0x00, 0xCD, 0xF1,
-        0x74, 0xFF, 0x8D, 0xF7, 0x2D, 0xFD, 0xBF, 0xFE, 0x9B, 0xF7, 0x49, 0x00,
-        0x0B, 0xF6, 0x1D, 0x01, 0xFA, 0xF6, 0xAA, 0xFF, 0xC7, 0xFA, 0x23, 0x01,
-        0xA6, 0xFB, 0x88, 0x02, 0xA9, 0xFB, 0xE2, 0x04, 0xA7, 0xFA, 0xF8, 0x06,
-        0xFF, 0xF8, 0xE1, 0x04, 0xC5, 0x11, 0xA4, 0x1A, 0x85, 0x23, 0x84, 0x28,
-        0x0A, 0x22, 0x43, 0x25, 0xA5, 0x20, 0xC5, 0x25, 0xF4, 0x14, 0x56, 0x1C,
-        0x28, 0x0D, 0xCD, 0x17, 0x74, 0x07, 0xFB, 0x14, 0xDB, 0x03, 0x26, 0x14,
-        0x68, 0x02, 0x8D, 0x13, 0xC0, 0xFF, 0x03, 0x0E, 0x03, 0x01, 0x9A, 0x08,
-        0x49, 0x03, 0x44, 0x01, 0xD4, 0x08, 0x9E, 0xFF, 0x62, 0x0A, 0xA9, 0xFE,
-        0x76, 0x09, 0x2F, 0x00, 0xD0, 0x05, 0x0D, 0xFF, 0xE4, 0x04, 0xA8, 0xFD,
-        0x27, 0x05, 0x93, 0xFB, 0x2F, 0x06, 0x71, 0xF9, 0xBD, 0x07, 0x9E, 0xFB,
-        0xDD, 0xEE, 0xF2, 0xE5, 0xDF, 0xDC, 0xF8, 0xD7, 0x2F, 0xDE, 0x0E, 0xDB,
-        0x68, 0xDF, 0x3D, 0xDA, 0x83, 0xEB, 0x01, 0xE4, 0x30, 0xF3, 0x8A, 0xE8,
-        0x77, 0xF8, 0x54, 0xEB, 0xE9, 0xFB, 0x4E, 0xEC, 0x49, 0xFD, 0xDD, 0xEC,
-        0x2D, 0x00, 0x80, 0xF2, 0x3A, 0xFF, 0x0F, 0xF8, 0x09, 0xFD, 0x79, 0xFF,
-        0x44, 0xF7, 0xED, 0x00, 0xB0, 0xF5, 0xE5, 0x01, 0x9B, 0xF6, 0x39, 0x00,
-        0x3A, 0xFA, 0x09, 0x01, 0x77, 0xFB, 0x92, 0x02, 0x28, 0xFB, 0xA3, 0x04,
-        0xDF, 0xF9, 0xA1, 0x06, 0x6B, 0xF8, 0x7B, 0x04, 0x9C, 0x11, 0x59, 0x1A,
-        0xB6, 0x23, 0x3C, 0x28, 0x70, 0x22, 0x31, 0x25, 0xF2, 0x20, 0xDA, 0x25,
-        0x74, 0x14, 0xD1, 0x1B, 0xD9, 0x0C, 0x56, 0x17, 0x2D, 0x08, 0xC9, 0x14,
-        0x0B, 0x05, 0xDB, 0x13, 0x6E, 0x03, 0x0B, 0x13, 0x0E, 0x00, 0x1C, 0x0D,
-        0x8C, 0x00, 0x61, 0x07, 0xCB, 0x02, 0x15, 0x00, 0xC5, 0x08, 0xCE, 0xFE,
-        0x78, 0x0A, 0xCF, 0xFD, 0xAF, 0x09, 0x92, 0xFF, 0xCB, 0x05, 0xA1, 0xFE,
-        0x74, 0x04, 0x0C, 0xFD, 0xEE, 0x04, 0x05, 0xFB, 0x81, 0x06, 0x15, 0xF9,
-        0xE3, 0x07, 0x1A, 0xFB, 0x83, 0xEE, 0x16, 0xE5, 0x74, 0xDC, 0x79, 0xD7,
-        0xA0, 0xDD, 0x82, 0xDA, 0x5D, 0xDF, 0x1F, 0xDA, 0xDA, 0xEB, 0x21, 0xE4,
-        0x48, 0xF3, 0x6B, 0xE8, 0xE4, 0xF7, 0x4E, 0xEB, 0xE6, 0xFA, 0x62, 0xEC,
-        0xA0, 0xFC, 0x69, 0xED, 0xF8, 0xFF, 0x31, 0xF3, 0xBE, 0xFF, 0xE2, 0xF8,
-        0x28, 0xFD, 0xD5, 0xFF, 0x27, 0xF7, 0x08, 0x01, 0x8C, 0xF5, 0x60, 0x02,
-        0x0A, 0xF6, 0x73, 0x00, 0x4C, 0xFA, 0xA3, 0x01, 0x9F, 0xFB, 0x2D, 0x03,
-        0x36, 0xFB, 0x3A, 0x05, 0x52, 0xF9, 0x07, 0x07, 0x23, 0xF8, 0x2A, 0x05,
-        0xAB, 0x11, 0x3F, 0x1B, 0x91, 0x23, 0x7B, 0x28, 0xF4, 0x22, 0xD6, 0x25,
-        0x1C, 0x21, 0x0A, 0x26, 0xC6, 0x14, 0x4B, 0x1C, 0x14, 0x0D, 0xCC, 0x17,
-        0x2F, 0x08, 0x77, 0x14, 0x30, 0x05, 0x37, 0x13, 0x7D, 0x03, 0x42, 0x12,
-        0x99, 0x00, 0x13, 0x0D, 0x7E, 0x00, 0x48, 0x07, 0x09, 0x03, 0x68, 0x00,
-        0xD1, 0x08, 0xF2, 0xFE, 0x8A, 0x0A, 0x83, 0xFD, 0x64, 0x0A, 0x96, 0xFF,
-        0x27, 0x06, 0x66, 0xFE, 0x1E, 0x05, 0x34, 0xFD, 0x45, 0x05, 0xCD, 0xFA,
-        0x5D, 0x07, 0x20, 0xF9, 0x65, 0x08, 0xD3, 0xFA, 0xD2, 0xEE, 0xCF, 0xE4,
-        0xC7, 0xDC, 0x84, 0xD7, 0xF5, 0xDC, 0xE1, 0xD9, 0xFA, 0xDE, 0xDD, 0xD9,
-        0x33, 0xEB, 0x81, 0xE3, 0x32, 0xF3, 0x40, 0xE8, 0x08, 0xF8, 0xCE, 0xEB,
-        0xC0, 0xFA, 0xE3, 0xEC, 0x32, 0xFC, 0xA9, 0xED, 0x13, 0xFF, 0xBE, 0xF2,
-        0x69, 0xFF, 0xA9, 0xF8, 0xE3, 0xFC, 0x89, 0xFF, 0x43, 0xF7, 0x21, 0x01,
-        0x31, 0xF5, 0x56, 0x02, 0x38, 0xF5, 0x31, 0x00, 0x4F, 0xF9, 0x2B, 0x01,
-        0x50, 0xFA, 0x59, 0x02, 0x3E, 0xFA, 0xE9, 0x04, 0x2D, 0xF8, 0xB3, 0x06,
-        0x40, 0xF7, 0x29, 0x05, 0x8D, 0x10, 0xF1, 0x1A, 0xB2, 0x22, 0x6E, 0x28,
-        0x81, 0x22, 0x34, 0x26, 0x41, 0x20, 0x1F, 0x26, 0xEE, 0x13, 0x70, 0x1C,
-        0x39, 0x0C, 0xF1, 0x17, 0x95, 0x07, 0x51, 0x14, 0xDD, 0x04, 0x1A, 0x13,
-        0x95, 0x03, 0x68, 0x12, 0x5B, 0x00, 0xF3, 0x0C, 0x28, 0x00, 0x21, 0x07,
-        0xE0, 0x02, 0x5A, 0x00, 0xDE, 0x08, 0x07, 0xFF, 0xD8, 0x0A, 0xBB, 0xFD,
-        0x94, 0x0A, 0xB3, 0xFF, 0xBF, 0x06, 0x08, 0xFF, 0x90, 0x05, 0xA6, 0xFD,
-        0xC1, 0x05, 0x1A, 0xFB, 0xC9, 0x07, 0x2B, 0xF9, 0xE0, 0x08, 0xDA, 0xFA,
-        0xB0, 0xEF, 0x1D, 0xE5, 0xC1, 0xDD, 0xB9, 0xD7, 0x22, 0xDE, 0xFC, 0xD9,
-        0x48, 0xE0, 0xCA, 0xD9, 0xAC, 0xEC, 0x8F, 0xE3, 0x00, 0xF4, 0xE0, 0xE7,
-        0x91, 0xF8, 0xB8, 0xEB, 0x52, 0xFB, 0x1E, 0xED, 0x90, 0xFC, 0xE3, 0xED,
-        0xB9, 0xFF, 0x57, 0xF3, 0x8F, 0xFF, 0xD0, 0xF8, 0xEF, 0xFC, 0xCF, 0xFF,
-        0xEE, 0xF6, 0x2C, 0x01, 0x18, 0xF5, 0x86, 0x02, 0xA1, 0xF5, 0xAF, 0x00,
-        0x4A, 0xF9, 0x02, 0x01, 0x26, 0xFA, 0x17, 0x02, 0x0A, 0xFA, 0xB2, 0x04,
-        0xFF, 0xF7, 0xB8, 0x06, 0xB7, 0xF6, 0xDD, 0x04, 0xE5, 0x0F, 0xAC, 0x1A,
-        0xE1, 0x21, 0x44, 0x28, 0x4E, 0x21, 0xFD, 0x25, 0x34, 0x1F, 0x67, 0x26,
-        0xE9, 0x12, 0xD8, 0x1C, 0x6F, 0x0B, 0x39, 0x18, 0xBA, 0x06, 0x27, 0x14,
-        0x22, 0x04, 0xC9, 0x12, 0x2B, 0x03, 0x31, 0x12, 0x30, 0x00, 0xB1, 0x0C,
-        0x8B, 0x00, 0x5E, 0x07, 0x13, 0x03, 0x17, 0x00, 0x98, 0x08, 0x2D, 0xFE,
-        0xDA, 0x0A, 0x3D, 0xFD, 0x53, 0x0A, 0x29, 0xFF, 0xBA, 0x06, 0xE9, 0xFE,
-        0xDC, 0x05, 0xF1, 0xFD, 0xDB, 0x05, 0x41, 0xFB, 0xCE, 0x07, 0x40, 0xF9,
-        0x0C, 0x09, 0x1A, 0xFB, 0x2E, 0xF0, 0x79, 0xE5, 0x04, 0xDE, 0x90, 0xD7,
-        0xB0, 0xDE, 0xE2, 0xD9, 0xC3, 0xE0, 0x67, 0xD9, 0x0E, 0xED, 0xED, 0xE2,
-        0xA5, 0xF4, 0xD1, 0xE7, 0x25, 0xF9, 0xB6, 0xEB, 0xCD, 0xFB, 0x30, 0xED,
-        0x77, 0xFC, 0xB4, 0xED, 0xA9, 0xFF, 0xB9, 0xF3, 0x4D, 0xFF, 0x28, 0xF9,
-        0xBC, 0xFC, 0x75, 0x00, 0x45, 0xF7, 0x55, 0x02, 0xA7, 0xF4, 0xC8, 0x02,
-        0x44, 0xF5, 0xE8, 0x00, 0xFA, 0xF8, 0x3C, 0x01, 0x31, 0xFA, 0x78, 0x02,
-        0x54, 0xFA, 0x2C, 0x05, 0x69, 0xF8, 0xFF, 0x06, 0xFC, 0xF6, 0xF0, 0x04,
-        0xAA, 0x0F, 0xA3, 0x1A, 0xCB, 0x21, 0xC3, 0x28, 0xEB, 0x20, 0x4C, 0x26,
-        0xF9, 0x1E, 0xEE, 0x26, 0x7D, 0x12, 0x2E, 0x1D, 0xE7, 0x0A, 0x32, 0x18,
-        0x9B, 0x06, 0x85, 0x14, 0xF6, 0x03, 0x38, 0x13, 0x1E, 0x03, 0x40, 0x12,
-        0xD4, 0xFF, 0xEE, 0x0B, 0x8F, 0x00, 0xB2, 0x06, 0x35, 0x03, 0x87, 0xFF,
-        0xDB, 0x08, 0x05, 0xFE, 0x41, 0x0B, 0x7C, 0xFD, 0x81, 0x0A, 0x48, 0xFF,
-        0x7E, 0x06, 0x8A, 0xFE, 0x70, 0x05, 0x6D, 0xFD, 0x6E, 0x05, 0xEC, 0xFA,
-        0x1E, 0x07, 0x10, 0xF9, 0xF7, 0x08, 0xA0, 0xFB, 0x16, 0xF0, 0x69, 0xE5,
-        0xEF, 0xDD, 0x0E, 0xD7, 0xD5, 0xDE, 0x6D, 0xD9, 0xD8, 0xE0, 0xCE, 0xD8,
-        0x4D, 0xED, 0xA2, 0xE2, 0xE0, 0xF4, 0xB0, 0xE7, 0x8C, 0xF9, 0x9B, 0xEB,
-        0x02, 0xFC, 0x70, 0xEC, 0x1B, 0xFD, 0xB8, 0xED, 0x14, 0x00, 0xDC, 0xF3,
-        0x15, 0xFF, 0xF6, 0xF8, 0x61, 0xFC, 0x15, 0x00, 0xFC, 0xF6, 0xB3, 0x01,
-        0x3A, 0xF5, 0xBD, 0x02, 0xA6, 0xF5, 0x9D, 0x00, 0xCD, 0xF9, 0xA8, 0x01,
-        0x6C, 0xFA, 0x9F, 0x02, 0x67, 0xFA, 0x22, 0x05, 0xF0, 0xF8, 0x0E, 0x07,
-        0x10, 0xF7, 0x62, 0x04, 0x0D, 0x10, 0xE9, 0x1A, 0xFF, 0x21, 0x3A, 0x29,
-        0x1B, 0x21, 0x0B, 0x27, 0xF6, 0x1E, 0x90, 0x27, 0xC4, 0x12, 0xD8, 0x1D,
-        0x28, 0x0B, 0x8C, 0x18, 0x5E, 0x06, 0x93, 0x14, 0xE6, 0x03, 0xF5, 0x13,
-        0xC2, 0x02, 0xA0, 0x12, 0x3F, 0x00, 0xCB, 0x0C, 0x00, 0x01, 0x36, 0x07,
-        0x9B, 0x03, 0xE0, 0xFF, 0xD3, 0x08, 0x16, 0xFE, 0x9B, 0x0A, 0x2C, 0xFD,
-        0x74, 0x0A, 0xB3, 0xFF, 0x9A, 0x06, 0xC2, 0xFE, 0xE5, 0x05, 0x87, 0xFD,
-        0xA7, 0x05, 0xB2, 0xFA, 0x11, 0x07, 0xEA, 0xF8, 0xD0, 0x08, 0xAE, 0xFB,
-        0xF6, 0xEF, 0x3F, 0xE5, 0x1F, 0xDE, 0xFC, 0xD6, 0x3F, 0xDF, 0x39, 0xD9,
-        0x24, 0xE1, 0x5F, 0xD8, 0x08, 0xED, 0xE5, 0xE1, 0xBA, 0xF4, 0x74, 0xE7,
-        0x50, 0xF9, 0x2D, 0xEB, 0xFE, 0xFB, 0xC6, 0xEB, 0x44, 0xFD, 0x1B, 0xED,
-        0xE0, 0xFF, 0x1D, 0xF3, 0x29, 0xFF, 0xCC, 0xF8, 0xB3, 0xFC, 0x68, 0x00,
-        0x30, 0xF7, 0xD2, 0x01, 0x0F, 0xF5, 0x38, 0x02, 0x64, 0xF5, 0xAA, 0xFF,
-        0x44, 0xF9, 0x94, 0x00, 0x54, 0xFA, 0x4D, 0x02, 0x64, 0xFA, 0xED, 0x04,
-        0x00, 0xF9, 0x94, 0x06, 0x1B, 0xF7, 0x84, 0x03, 0xC3, 0x0F, 0xB9, 0x19,
-        0xC1, 0x21, 0x3E, 0x28, 0x8B, 0x20, 0x0D, 0x26, 0x04, 0x1F, 0x78, 0x27,
-        0x21, 0x13, 0xF4, 0x1D, 0xAA, 0x0B, 0x81, 0x18, 0x1B, 0x07, 0xCC, 0x14,
-        0x43, 0x04, 0x33, 0x14, 0xC4, 0x02, 0xC2, 0x12, 0xF3, 0xFF, 0x7E, 0x0C,
-        0xDA, 0x00, 0x01, 0x07, 0x5B, 0x03, 0x6D, 0xFF, 0x5E, 0x09, 0x7B, 0xFE,
-        0x2E, 0x0B, 0xFD, 0xFD, 0x87, 0x0A, 0x6E, 0x00, 0x7A, 0x06, 0x75, 0xFF,
-        0x67, 0x05, 0xAA, 0xFD, 0xBE, 0x05, 0x63, 0xFB, 0x39, 0x07, 0xDD, 0xF9,
-        0x22, 0x09, 0xE1, 0xFC, 0x60, 0xF0, 0x80, 0xE6, 0xA0, 0xDE, 0x03, 0xD8,
-        0xB6, 0xDF, 0xEA, 0xD9, 0x50, 0xE1, 0x52, 0xD8, 0x62, 0xED, 0xD8, 0xE1,
-        0xB7, 0xF4, 0x46, 0xE7, 0x32, 0xF9, 0xDB, 0xEA, 0x28, 0xFC, 0x79, 0xEB,
-        0xDA, 0xFD, 0x20, 0xED, 0x70, 0x00, 0x35, 0xF3, 0x8D, 0xFF, 0xB4, 0xF8,
-        0x02, 0xFD, 0x43, 0x00, 0x05, 0xF7, 0x4A, 0x01, 0x6D, 0xF5, 0xF4, 0x01,
-        0x43, 0xF6, 0x8E, 0xFF, 0x2A, 0xFA, 0x70, 0x00, 0xD6, 0xFA, 0xDD, 0x01,
-        0x89, 0xFA, 0x43, 0x04, 0xEE, 0xF8, 0xAC, 0x05, 0x29, 0xF7, 0xE7, 0x02,
-        0xFA, 0x0F, 0x6C, 0x19, 0x8F, 0x21, 0xD5, 0x27, 0x7A, 0x20, 0xEC, 0x25,
-        0xA4, 0x1E, 0x64, 0x27, 0xB2, 0x12, 0xFC, 0x1D, 0x31, 0x0B, 0x51, 0x18,
-        0xC3, 0x06, 0xC5, 0x14, 0xCF, 0x03, 0x47, 0x14, 0x25, 0x02, 0xA0, 0x12,
-        0xC5, 0xFF, 0xB8, 0x0C, 0x7B, 0x00, 0x29, 0x07, 0xF3, 0x02, 0xA5, 0xFF,
-        0x83, 0x08, 0x21, 0xFE, 0x61, 0x0A, 0xE4, 0xFD, 0xC9, 0x09, 0x77, 0x00,
-        0xE9, 0x05, 0x8B, 0xFF, 0x5C, 0x05, 0x24, 0xFE, 0x95, 0x05, 0x96, 0xFB,
-        0x53, 0x07, 0x49, 0xFA, 0x17, 0x09, 0xF8, 0xFC, 0x7C, 0xF0, 0x87, 0xE6,
-        0xDA, 0xDE, 0x0C, 0xD8, 0xD5, 0xDF, 0xF5, 0xD9, 0xBB, 0xE1, 0xA5, 0xD8,
-        0x9A, 0xED, 0x07, 0xE2, 0x01, 0xF5, 0xD4, 0xE7, 0x83, 0xF9, 0x59, 0xEB,
-        0x7C, 0xFC, 0xD3, 0xEB, 0xC8, 0xFD, 0x3B, 0xED, 0x3D, 0x00, 0x50, 0xF3,
-        0xBC, 0xFF, 0x13, 0xF9, 0x44, 0xFD, 0x92, 0x00, 0xB4, 0xF7, 0x0F, 0x02,
-        0x87, 0xF5, 0x03, 0x02, 0xCA, 0xF5, 0x2A, 0xFF, 0xC3, 0xF9, 0x68, 0x00,
-        0x8C, 0xFA, 0x1B, 0x02, 0x5D, 0xFA, 0xB6, 0x04, 0xA3, 0xF8, 0xE2, 0x05,
-        0xD3, 0xF6, 0x17, 0x03, 0x81, 0x0F, 0xAA, 0x19, 0x06, 0x21, 0xFA, 0x27,
-        0x1C, 0x20, 0xF7, 0x25, 0x4E, 0x1E, 0x33, 0x27, 0x61, 0x12, 0xA2, 0x1D,
-        0x3A, 0x0B, 0xED, 0x17, 0xA8, 0x06, 0x84, 0x14, 0xB5, 0x03, 0x40, 0x14,
-        0x6A, 0x02, 0xD0, 0x12, 0xFD, 0xFF, 0xB0, 0x0C, 0x5A, 0x00, 0xBD, 0x06,
-        0xCB, 0x02, 0x49, 0xFF, 0x93, 0x08, 0xFD, 0xFD, 0x9A, 0x0A, 0x06, 0xFE,
-        0x76, 0x0A, 0xD2, 0x00, 0x50, 0x06, 0x49, 0xFF, 0xE6, 0x05, 0xD6, 0xFD,
-        0x15, 0x06, 0x48, 0xFB, 0x9B, 0x07, 0x37, 0xFA, 0x75, 0x09, 0x38, 0xFD,
-        0x7E, 0xF0, 0x63, 0xE6, 0x0C, 0xDF, 0x41, 0xD8, 0xF2, 0xDF, 0x61, 0xDA,
-        0xAF, 0xE1, 0x43, 0xD9, 0x59, 0xED, 0xBD, 0xE2, 0x71, 0xF4, 0x98, 0xE8,
-        0x4B, 0xF9, 0x1B, 0xEC, 0x52, 0xFC, 0x3C, 0xEC, 0xAA, 0xFD, 0xBE, 0xED,
-        0xBE, 0xFF, 0xA2, 0xF3, 0x2A, 0xFF, 0x7D, 0xF9, 0x58, 0xFC, 0xA4, 0x00,
-        0xC8, 0xF6, 0x1C, 0x02, 0x1B, 0xF5, 0x5D, 0x02, 0x71, 0xF5, 0xB9, 0xFF,
-        0xA5, 0xF9, 0x7C, 0x01, 0x96, 0xF9, 0x86, 0x02, 0x5D, 0xF9, 0xF9, 0x04,
-        0x03, 0xF8, 0xDB, 0x05, 0x44, 0xF6, 0xBC, 0x02, 0x3F, 0x0F, 0x86, 0x19,
-        0xAD, 0x20, 0x9A, 0x27, 0xB6, 0x1F, 0x69, 0x25, 0x08, 0x1E, 0x92, 0x26,
-        0xA6, 0x12, 0x33, 0x1D, 0x88, 0x0B, 0x33, 0x17, 0x9D, 0x06, 0xBD, 0x13,
-        0x47, 0x03, 0x93, 0x13, 0x35, 0x02, 0x4D, 0x12, 0x68, 0x00, 0xA1, 0x0C,
-        0x30, 0x01, 0xB6, 0x06, 0x1B, 0x04, 0x8D, 0xFF, 0x6D, 0x09, 0xC2, 0xFD,
-        0xE7, 0x0A, 0x72, 0xFD, 0x6A, 0x0A, 0xFC, 0xFF, 0x8C, 0x06, 0x7D, 0xFE,
-        0xC7, 0x06, 0x7E, 0xFD, 0x11, 0x07, 0x2B, 0xFB, 0x5B, 0x08, 0x71, 0xFA,
-        0xEE, 0x09, 0x98, 0xFD, 0xBB, 0xF0, 0xA1, 0xE6, 0x15, 0xDF, 0x49, 0xD8,
-        0x5B, 0xE0, 0xA5, 0xDA, 0xF5, 0xE1, 0x51, 0xD9, 0x84, 0xED, 0xF2, 0xE2,
-        0x95, 0xF4, 0x0F, 0xE9, 0x5D, 0xF9, 0x49, 0xEC, 0xA2, 0xFC, 0x4B, 0xEC,
-        0x8E, 0xFD, 0x5B, 0xED, 0x50, 0xFF, 0x25, 0xF3, 0x57, 0xFE, 0x0E, 0xF9,
-        0xB5, 0xFB, 0xBB, 0x00, 0x48, 0xF6, 0x77, 0x02, 0xD6, 0xF4, 0xAE, 0x02,
-        0x87, 0xF5, 0x2F, 0x00, 0x98, 0xF9, 0xD7, 0x01, 0x66, 0xF9, 0xF8, 0x02,
-        0xFE, 0xF8, 0x29, 0x05, 0xD0, 0xF7, 0xDE, 0x05, 0x06, 0xF6, 0x69, 0x02,
-        0x87, 0x0F, 0xA1, 0x19, 0x2F, 0x21, 0x17, 0x28, 0xB7, 0x1F, 0xB3, 0x25,
-        0xF3, 0x1D, 0x0A, 0x27, 0x51, 0x12, 0x50, 0x1D, 0x8D, 0x0B, 0x57, 0x17,
-        0xDC, 0x06, 0x2D, 0x14, 0xD6, 0x03, 0x6C, 0x14, 0x8E, 0x02, 0x07, 0x13,
-        0xB1, 0x00, 0xFD, 0x0C, 0x7C, 0x01, 0xCD, 0x06, 0x30, 0x04, 0x08, 0xFF,
-        0xEE, 0x09, 0x8A, 0xFD, 0x56, 0x0B, 0x70, 0xFD, 0x8C, 0x0A, 0x07, 0x00,
-        0xFF, 0x05, 0xFA, 0xFD, 0x34, 0x06, 0xD3, 0xFC, 0x8D, 0x06, 0x88, 0xFA,
-        0xBE, 0x07, 0xCE, 0xF9, 0x84, 0x09, 0x3A, 0xFD, 0xE1, 0xEF, 0xD0, 0xE5,
-        0x9C, 0xDE, 0xA4, 0xD7, 0xFA, 0xDF, 0xC2, 0xD9, 0x07, 0xE2, 0x85, 0xD8,
-        0xA9, 0xED, 0x33, 0xE2, 0x71, 0xF4, 0x4E, 0xE8, 0x1D, 0xF9, 0x84, 0xEB,
-        0x3F, 0xFC, 0x61, 0xEB, 0xCE, 0xFD, 0x17, 0xED, 0x6D, 0xFF, 0xF1, 0xF2,
-        0xDF, 0xFE, 0x5C, 0xF9, 0xEB, 0xFB, 0xF7, 0x00, 0x17, 0xF6, 0x72, 0x02,
-        0xDA, 0xF4, 0x99, 0x02, 0xDA, 0xF5, 0x23, 0x00, 0x9A, 0xFA, 0x4C, 0x02,
-        0x24, 0xFA, 0x44, 0x03, 0x0B, 0xFA, 0xE1, 0x05, 0x76, 0xF8, 0x4A, 0x06,
-        0xA8, 0xF6, 0x05, 0x03, 0x2F, 0x10, 0x54, 0x1A, 0x35, 0x21, 0x59, 0x28,
-        0xF4, 0x1F, 0x56, 0x26, 0x0F, 0x1E, 0xD1, 0x27, 0x6D, 0x12, 0x2A, 0x1E,
-        0x44, 0x0B, 0x93, 0x17, 0x9B, 0x06, 0x6B, 0x14, 0x4B, 0x03, 0x54, 0x14,
-        0xC7, 0x01, 0xA7, 0x12, 0x4B, 0x00, 0xF3, 0x0C, 0xDB, 0x00, 0x9F, 0x06,
-        0xC4, 0x03, 0x11, 0xFF, 0x93, 0x09, 0x74, 0xFD, 0xF4, 0x0A, 0x92, 0xFD,
-        0xF1, 0x09, 0xEB, 0xFF, 0x61, 0x05, 0xE9, 0xFD, 0xC4, 0x05, 0xCE, 0xFC,
-        0xD2, 0x05, 0x0B, 0xFA, 0x85, 0x07, 0xA5, 0xF9, 0x83, 0x09, 0xEB, 0xFC,
-        0x21, 0xF0, 0xA9, 0xE5, 0x01, 0xDF, 0x83, 0xD7, 0x45, 0xE0, 0x99, 0xD9,
-        0x01, 0xE2, 0x04, 0xD8, 0xE2, 0xED, 0xE6, 0xE1, 0x1E, 0xF5, 0x9E, 0xE8,
-        0xC9, 0xF9, 0xA7, 0xEB, 0xFF, 0xFC, 0x96, 0xEB, 0x54, 0xFE, 0x26, 0xED,
-        0x0F, 0x00, 0x11, 0xF3, 0x7E, 0xFF, 0x4E, 0xF9, 0xA5, 0xFC, 0xDB, 0x00,
-        0xA9, 0xF6, 0x3B, 0x02, 0x27, 0xF5, 0xF7, 0x01, 0x06, 0xF6, 0x90, 0xFF,
-        0x8D, 0xFA, 0xAC, 0x01, 0x93, 0xFA, 0x2E, 0x03, 0x4F, 0xFA, 0xB6, 0x05,
-        0xA9, 0xF8, 0x26, 0x06, 0x68, 0xF6, 0xAC, 0x02, 0xC4, 0x0F, 0x0D, 0x1A,
-        0xE9, 0x20, 0x4E, 0x28, 0xB5, 0x1F, 0x35, 0x26, 0x07, 0x1E, 0xE3, 0x27,
-        0xF0, 0x11, 0xC2, 0x1D, 0xE3, 0x0A, 0x62, 0x17, 0x07, 0x06, 0x74, 0x14,
-        0xC0, 0x02, 0xA9, 0x14, 0x3B, 0x01, 0xF4, 0x12, 0x3D, 0xFF, 0xC0, 0x0C,
-        0xEC, 0xFF, 0xA6, 0x06, 0xEB, 0x02, 0x53, 0xFF, 0x50, 0x09, 0x75, 0xFE,
-        0x94, 0x0A, 0x8D, 0xFE, 0xBB, 0x09, 0xD9, 0x00, 0x1A, 0x05, 0x81, 0xFE,
-        0x05, 0x05, 0xE4, 0xFC, 0x78, 0x05, 0x9B, 0xFA, 0xFD, 0x06, 0x35, 0xFA,
-        0x4D, 0x09, 0xA9, 0xFD, 0xEA, 0xEF, 0x28, 0xE6, 0xE6, 0xDE, 0xD6, 0xD7,
-        0xFE, 0xDF, 0xBD, 0xD9, 0xC0, 0xE1, 0x2D, 0xD8, 0xC1, 0xED, 0x31, 0xE2,
-        0xD9, 0xF4, 0x8F, 0xE8, 0x30, 0xFA, 0xA6, 0xEB, 0x9D, 0xFD, 0x5B, 0xEB,
-        0x3A, 0xFF, 0x1F, 0xED, 0xFE, 0x00, 0x35, 0xF3, 0x18, 0x00, 0x25, 0xF9,
-        0xCC, 0xFC, 0x31, 0x00, 0x9C, 0xF6, 0x17, 0x01, 0xD5, 0xF5, 0x52, 0x01,
-        0xB4, 0xF6, 0x09, 0xFF, 0x1E, 0xFB, 0x53, 0x01, 0xE0, 0xFA, 0xB0, 0x02,
-        0x65, 0xFA, 0xEF, 0x04, 0x03, 0xF9, 0x62, 0x05, 0x18, 0xF7, 0x4F, 0x02,
-        0x32, 0x10, 0xC3, 0x19, 0x06, 0x21, 0x25, 0x28, 0xF4, 0x1F, 0x77, 0x26,
-        0x02, 0x1E, 0xE6, 0x27, 0x36, 0x12, 0xE7, 0x1D, 0xFC, 0x0A, 0x5E, 0x17,
-        0x68, 0x05, 0x24, 0x14, 0xDB, 0x01, 0x70, 0x14, 0x80, 0x00, 0xE9, 0x12,
-        0xFC, 0xFE, 0xF7, 0x0C, 0xDF, 0xFF, 0xDC, 0x06, 0x2C, 0x03, 0xCD, 0xFF,
-        0xF5, 0x08, 0xB7, 0xFE, 0x87, 0x09, 0x9E, 0xFE, 0xC4, 0x08, 0x29, 0x01,
-        0xEF, 0x04, 0x7F, 0xFF, 0x35, 0x05, 0x0E, 0xFE, 0x65, 0x05, 0x8C, 0xFB,
-        0xA9, 0x06, 0xFE, 0xFA, 0x1A, 0x08, 0xA1, 0xFD, 0x47, 0xEF, 0x47, 0xE6,
-        0xAC, 0xDE, 0xDF, 0xD7, 0xF3, 0xDF, 0x81, 0xD9, 0x0F, 0xE2, 0x22, 0xD8,
-        0xD4, 0xED, 0x48, 0xE2, 0x1E, 0xF5, 0xF5, 0xE8, 0x56, 0xFA, 0xDA, 0xEB,
-        0xFD, 0xFD, 0x89, 0xEB, 0x3E, 0xFF, 0xE8, 0xEC, 0xE2, 0x00, 0xFD, 0xF2,
-        0x2C, 0x00, 0x4C, 0xF9, 0x02, 0xFD, 0xA2, 0x00, 0x56, 0xF7, 0x8F, 0x01,
-        0x92, 0xF6, 0x42, 0x01, 0x9E, 0xF7, 0xC4, 0xFE, 0x2E, 0xFB, 0x20, 0x00,
-        0x11, 0xFB, 0xE0, 0x01, 0x14, 0xFB, 0xA0, 0x04, 0xAA, 0xF9, 0x1F, 0x05,
-        0x5B, 0xF8, 0x95, 0x02, 0x17, 0x11, 0xD1, 0x19, 0xC4, 0x21, 0x70, 0x28,
-        0x42, 0x20, 0xA3, 0x26, 0x2B, 0x1E, 0x16, 0x28, 0x4C, 0x12, 0xAD, 0x1D,
-        0x25, 0x0B, 0xFC, 0x16, 0x31, 0x06, 0x5A, 0x14, 0x81, 0x02, 0x98, 0x14,
-        0x06, 0x01, 0x36, 0x13, 0xF6, 0xFE, 0xBA, 0x0C, 0xB7, 0xFF, 0x8C, 0x06,
-        0xD5, 0x02, 0x1A, 0xFF, 0xC1, 0x08, 0x7A, 0xFE, 0x9A, 0x09, 0x09, 0xFF,
-        0x1D, 0x08, 0x22, 0x01, 0x74, 0x04, 0xC1, 0xFF, 0x81, 0x04, 0xD4, 0xFD,
-        0xA1, 0x04, 0x2E, 0xFB, 0x0B, 0x06, 0x90, 0xFA, 0x60, 0x07, 0x2A, 0xFD,
-        0x91, 0xEE, 0xF2, 0xE5, 0xD5, 0xDD, 0x49, 0xD7, 0x84, 0xDF, 0x4F, 0xD9,
-        0xA9, 0xE1, 0xDB, 0xD7, 0xC1, 0xED, 0x8C, 0xE2, 0xDC, 0xF4, 0x24, 0xE9,
-        0xDC, 0xF9, 0xD0, 0xEB, 0x79, 0xFD, 0x6C, 0xEB, 0x02, 0xFF, 0xC7, 0xEC,
-        0x45, 0x01, 0x57, 0xF3, 0x75, 0x00, 0x68, 0xF9, 0x73, 0xFD, 0xFC, 0x00,
-        0x73, 0xF7, 0x9D, 0x01, 0xAC, 0xF6, 0x1F, 0x01, 0x17, 0xF8, 0x10, 0xFF,
-        0xAB, 0xFB, 0x51, 0x00, 0x58, 0xFB, 0xF5, 0x01, 0x11, 0xFB, 0x66, 0x04,
-        0xED, 0xF9, 0x51, 0x05, 0x95, 0xF8, 0xB0, 0x02, 0xA8, 0x11, 0x13, 0x1A,
-        0x5D, 0x22, 0x9E, 0x28, 0xCA, 0x20, 0x91, 0x26, 0x93, 0x1E, 0xE5, 0x27,
-        0x57, 0x12, 0x12, 0x1D, 0x0F, 0x0B, 0x6D, 0x16, 0xD7, 0x05, 0xA9, 0x13,
-        0x8D, 0x02, 0x49, 0x14, 0x22, 0x01, 0x12, 0x13, 0x32, 0xFF, 0xBB, 0x0C,
-        0xF8, 0xFF, 0xB9, 0x06, 0xDF, 0x02, 0xFB, 0xFE, 0x94, 0x08, 0x18, 0xFE,
-        0x4C, 0x09, 0x7A, 0xFE, 0x52, 0x08, 0xD8, 0x00, 0x90, 0x04, 0x82, 0xFF,
-        0x01, 0x05, 0x2B, 0xFE, 0x1A, 0x05, 0xCB, 0xFB, 0x2F, 0x06, 0xE6, 0xFA,
-        0x94, 0x07, 0x97, 0xFD, 0x91, 0xEE, 0x3F, 0xE6, 0xD3, 0xDD, 0x9E, 0xD7,
-        0x19, 0xDF, 0x81, 0xD9, 0x6A, 0xE1, 0x4D, 0xD8, 0x7E, 0xED, 0xF6, 0xE2,
-        0x06, 0xF5, 0xA6, 0xE9, 0x47, 0xFA, 0x46, 0xEC, 0x9A, 0xFD, 0xC3, 0xEB,
-        0x0F, 0xFF, 0x35, 0xED, 0xC1, 0x00, 0x83, 0xF3, 0x15, 0x00, 0xBE, 0xF9,
-        0x04, 0xFD, 0x4F, 0x01, 0x86, 0xF7, 0x47, 0x02, 0x8C, 0xF6, 0x9C, 0x01,
-        0x33, 0xF7, 0xF6, 0xFE, 0x53, 0xFB, 0x98, 0x00, 0x33, 0xFB, 0xE7, 0x01,
-        0x70, 0xFB, 0x48, 0x04, 0x48, 0xFA, 0xCD, 0x04, 0x01, 0xF9, 0x34, 0x02,
-        0xC6, 0x11, 0x69, 0x19, 0x85, 0x22, 0x3B, 0x28, 0x2B, 0x21, 0x4B, 0x26,
-        0xBA, 0x1E, 0x4D, 0x27, 0xD5, 0x12, 0xD5, 0x1C, 0x27, 0x0B, 0x3C, 0x16,
-        0x28, 0x06, 0x1A, 0x14, 0x80, 0x02, 0x4C, 0x14, 0xED, 0x00, 0x91, 0x12,
-        0x75, 0xFF, 0x39, 0x0C, 0x1E, 0x00, 0xC0, 0x05, 0x4B, 0x03, 0x5D, 0xFE,
-        0xBC, 0x08, 0x7A, 0xFD, 0xA9, 0x09, 0x3B, 0xFE, 0xD7, 0x08, 0x9E, 0x00,
-        0x92, 0x04, 0xD2, 0xFE, 0x7E, 0x04, 0x74, 0xFD, 0x42, 0x04, 0x62, 0xFB,
-        0x79, 0x05, 0x1E, 0xFB, 0xA4, 0x06, 0xA1, 0xFD, 0xFE, 0xED, 0x67, 0xE6,
-        0x66, 0xDD, 0x82, 0xD7, 0x03, 0xDF, 0xAF, 0xD9, 0x5D, 0xE1, 0xBE, 0xD8,
-        0x21, 0xED, 0x2F, 0xE3, 0xED, 0xF4, 0xD2, 0xE9, 0xFC, 0xF9, 0xC4, 0xEB,
-        0xCB, 0xFD, 0xB1, 0xEB, 0x5F, 0xFF, 0x70, 0xED, 0x7D, 0x00, 0x9E, 0xF3,
-        0xC4, 0xFF, 0x0E, 0xFA, 0x86, 0xFC, 0x64, 0x01, 0x11, 0xF7, 0x0A, 0x02,
-        0x4D, 0xF6, 0x65, 0x01, 0x3F, 0xF7, 0x3E, 0xFF, 0x44, 0xFB, 0xEA, 0x00,
-        0x68, 0xFB, 0x60, 0x02, 0xA4, 0xFB, 0x50, 0x04, 0xB1, 0xFA, 0xD5, 0x04,
-        0x83, 0xF9, 0x4D, 0x02, 0x02, 0x12, 0x6C, 0x19, 0x71, 0x22, 0x2A, 0x28,
-        0xC6, 0x20, 0xCD, 0x25, 0xB0, 0x1E, 0xD3, 0x26, 0x24, 0x13, 0x4D, 0x1C,
-        0x23, 0x0B, 0x94, 0x15, 0xF5, 0x05, 0x89, 0x13, 0x5F, 0x02, 0xED, 0x13,
-        0x10, 0x01, 0x7A, 0x12, 0xEF, 0xFF, 0x58, 0x0C, 0x81, 0x00, 0xE4, 0x05,
-        0x4D, 0x03, 0x25, 0xFE, 0xA3, 0x08, 0x80, 0xFD, 0x3E, 0x09, 0xF9, 0xFD,
-        0x8D, 0x08, 0x42, 0x00, 0xF2, 0x04, 0xF0, 0xFE, 0xD2, 0x04, 0x71, 0xFD,
-        0x79, 0x04, 0x7D, 0xFB, 0x49, 0x05, 0xB8, 0xFA, 0x9B, 0x06, 0x69, 0xFD,
-        0x51, 0xEE, 0x8E, 0xE6, 0xBC, 0xDD, 0xDE, 0xD7, 0x3C, 0xDF, 0x34, 0xDA,
-        0x04, 0xE1, 0x0D, 0xD9, 0x94, 0xEC, 0xB2, 0xE3, 0x9C, 0xF4, 0x4D, 0xEA,
-        0xE5, 0xF9, 0x6A, 0xEC, 0x4D, 0xFD, 0xC7, 0xEB, 0x89, 0xFE, 0x2C, 0xED,
-        0x06, 0x00, 0x78, 0xF3, 0x87, 0xFF, 0xFC, 0xF9, 0xFA, 0xFC, 0xF5, 0x01,
-        0x8E, 0xF7, 0x9B, 0x02, 0xE9, 0xF6, 0x3A, 0x02, 0x63, 0xF7, 0xD9, 0xFF,
-        0xC7, 0xFA, 0xFC, 0x00, 0x25, 0xFB, 0xA6, 0x02, 0x6D, 0xFB, 0x81, 0x04,
-        0xB0, 0xFA, 0x5F, 0x05, 0x48, 0xF9, 0xAF, 0x02, 0xA3, 0x11, 0x6E, 0x19,
-        0x55, 0x22, 0x1A, 0x28, 0xCE, 0x20, 0xA4, 0x25, 0x09, 0x1F, 0xC0, 0x26,
-        0x38, 0x13, 0xFD, 0x1B, 0xA3, 0x0B, 0xFA, 0x15, 0x4E, 0x06, 0x0A, 0x14,
-        0xD4, 0x02, 0x8C, 0x14, 0x57, 0x01, 0xF6, 0x12, 0x82, 0xFF, 0x6D, 0x0C,
-        0x25, 0x00, 0x19, 0x06, 0xB8, 0x02, 0x12, 0xFE, 0x51, 0x08, 0x90, 0xFD,
-        0xD1, 0x08, 0xA2, 0xFD, 0x36, 0x08, 0xE1, 0xFF, 0xCB, 0x04, 0xD4, 0xFE,
-        0x47, 0x04, 0x3D, 0xFD, 0x49, 0x04, 0xD1, 0xFB, 0x0B, 0x05, 0x0A, 0xFB,
-        0x6C, 0x06, 0xAE, 0xFD, 0xC5, 0xED, 0xB8, 0xE6, 0x10, 0xDD, 0x2F, 0xD8,
-        0x95, 0xDE, 0x9B, 0xDA, 0x60, 0xE0, 0x8C, 0xD9, 0x4E, 0xEC, 0x3F, 0xE4,
-        0x90, 0xF3, 0xBB, 0xE9, 0x22, 0xF9, 0xCE, 0xEB, 0x00, 0xFD, 0xB5, 0xEB,
-        0xAB, 0xFE, 0x8C, 0xED, 0x72, 0x00, 0xE8, 0xF3, 0x98, 0xFF, 0x00, 0xFA,
-        0xCB, 0xFC, 0xD8, 0x01, 0x17, 0xF7, 0x40, 0x02, 0xD5, 0xF6, 0x8C, 0x02,
-        0x7C, 0xF7, 0x65, 0x00, 0x1D, 0xFB, 0x7B, 0x01, 0x89, 0xFB, 0xD9, 0x02,
-        0x8E, 0xFB, 0x1C, 0x04, 0xBE, 0xFA, 0xD6, 0x04, 0x63, 0xF9, 0x46, 0x02,
-        0x32, 0x12, 0x5B, 0x19, 0xE2, 0x22, 0xC0, 0x27, 0x87, 0x21, 0x74, 0x25,
-        0xB7, 0x1F, 0x82, 0x26, 0xD7, 0x13, 0xE3, 0x1B, 0x7B, 0x0C, 0x72, 0x16,
-        0xB3, 0x06, 0x2D, 0x14, 0xCD, 0x02, 0x15, 0x14, 0x72, 0x01, 0x6B, 0x12,
-        0xD3, 0xFF, 0x5A, 0x0C, 0x7D, 0x00, 0x11, 0x06, 0x4B, 0x03, 0x59, 0xFE,
-        0xB6, 0x08, 0xBD, 0xFD, 0x07, 0x09, 0x6C, 0xFD, 0x79, 0x08, 0xC2, 0xFF,
-        0xDA, 0x04, 0xC8, 0xFE, 0x9C, 0x04, 0xC4, 0xFD, 0x67, 0x04, 0x64, 0xFC,
-        0x62, 0x05, 0xBF, 0xFB, 0xBC, 0x06, 0x2B, 0xFE, 0xFF, 0xED, 0x19, 0xE7,
-        0x1A, 0xDD, 0xA9, 0xD8, 0x52, 0xDE, 0xCA, 0xDA, 0x31, 0xE0, 0xF3, 0xD9,
-        0x0B, 0xEC, 0x83, 0xE4, 0xCD, 0xF3, 0x53, 0xEA, 0x7A, 0xF9, 0x92, 0xEC,
-        0x26, 0xFD, 0xA0, 0xEC, 0x34, 0xFE, 0x22, 0xEE, 0xE9, 0xFF, 0x2B, 0xF4,
-        0xA7, 0xFF, 0xC1, 0xFA, 0xB1, 0xFC, 0x2B, 0x02, 0x7D, 0xF7, 0xC9, 0x02,
-        0xF3, 0xF6, 0xE2, 0x02, 0x6E, 0xF7, 0x57, 0x00, 0x3D, 0xFB, 0x60, 0x01,
-        0x93, 0xFB, 0x57, 0x02, 0xEB, 0xFB, 0xDD, 0x03, 0xD4, 0xFA, 0x79, 0x04,
-        0x53, 0xF9, 0x24, 0x02, 0xE5, 0x11, 0x0E, 0x19, 0xF5, 0x22, 0x95, 0x27,
-        0xC2, 0x21, 0x64, 0x25, 0xC3, 0x1F, 0xF6, 0x25, 0x06, 0x14, 0x62, 0x1B,
-        0x3B, 0x0C, 0x98, 0x15, 0xEB, 0x06, 0x93, 0x13, 0x67, 0x03, 0x95, 0x13,
-        0x40, 0x02, 0xE7, 0x11, 0x26, 0x00, 0xB6, 0x0B, 0x46, 0x00, 0x1F, 0x05,
-        0x61, 0x03, 0x17, 0xFE, 0x7E, 0x08, 0x91, 0xFD, 0x1B, 0x09, 0x73, 0xFD,
-        0xA8, 0x08, 0x0D, 0x00, 0xB0, 0x04, 0xCD, 0xFE, 0x45, 0x04, 0xB2, 0xFD,
-        0x0F, 0x04, 0x35, 0xFC, 0x4A, 0x05, 0x86, 0xFB, 0x08, 0x07, 0xE1, 0xFD,
-        0x8A, 0xEE, 0x0E, 0xE7, 0x4A, 0xDD, 0x72, 0xD8, 0x45, 0xDE, 0x9B, 0xDA,
-        0x3A, 0xE0, 0x3F, 0xDA, 0xD6, 0xEB, 0xCF, 0xE4, 0x58, 0xF3, 0x67, 0xEA,
-        0xBC, 0xF8, 0x86, 0xEC, 0x43, 0xFC, 0xA6, 0xEC, 0xC5, 0xFD, 0x90, 0xEE,
-        0xD5, 0xFF, 0x8D, 0xF4, 0xBA, 0xFF, 0xE1, 0xFA, 0xB7, 0xFC, 0xE0, 0x01,
-        0xB5, 0xF7, 0x56, 0x02, 0x2C, 0xF7, 0xB1, 0x02, 0x5F, 0xF7, 0xFD, 0xFF,
-        0x63, 0xFB, 0x6C, 0x01, 0xDE, 0xFB, 0xC9, 0x02, 0x03, 0xFC, 0x4A, 0x04,
-        0xA7, 0xFA, 0x0C, 0x05, 0xB1, 0xF8, 0x7F, 0x02, 0x36, 0x11, 0x3E, 0x19,
-        0x9D, 0x22, 0xC3, 0x27, 0x27, 0x22, 0xD6, 0x25, 0x5F, 0x20, 0x1B, 0x26,
-        0xEF, 0x14, 0x95, 0x1B, 0x62, 0x0D, 0xED, 0x15, 0x89, 0x07, 0x5C, 0x13,
-        0xE0, 0x03, 0x2C, 0x13, 0x7A, 0x02, 0x6F, 0x11, 0xB4, 0x00, 0xFF, 0x0B,
-        0xB4, 0x00, 0xA7, 0x05, 0x3F, 0x03, 0x45, 0xFE, 0x2E, 0x08, 0xB2, 0xFD,
-        0xD0, 0x08, 0x39, 0xFD, 0xE3, 0x08, 0xFD, 0xFF, 0x03, 0x05, 0x88, 0xFE,
-        0x73, 0x04, 0xFF, 0xFC, 0x3F, 0x04, 0x5E, 0xFB, 0xAE, 0x05, 0xA9, 0xFA,
-        0x9B, 0x07, 0x4D, 0xFD, 0x19, 0xEF, 0xB7, 0xE6, 0x88, 0xDD, 0x52, 0xD8,
-        0xB1, 0xDD, 0x1B, 0xDA, 0x46, 0xDF, 0xC2, 0xD9, 0xAA, 0xEA, 0x34, 0xE4,
-        0x7F, 0xF2, 0xFE, 0xE9, 0xB3, 0xF8, 0xC0, 0xEC, 0x48, 0xFC, 0xBA, 0xEC,
-        0x77, 0xFD, 0x1F, 0xEE, 0x59, 0xFF, 0x83, 0xF3, 0x87, 0xFF, 0x15, 0xFA,
-        0x5E, 0xFD, 0xFE, 0x01, 0x44, 0xF8, 0x9B, 0x02, 0x44, 0xF7, 0xFF, 0x02,
-        0x11, 0xF7, 0x57, 0x00, 0xAD, 0xFA, 0x90, 0x01, 0x43, 0xFB, 0x0E, 0x03,
-        0x8E, 0xFB, 0xB5, 0x04, 0x70, 0xFA, 0x7D, 0x05, 0xC3, 0xF8, 0xF8, 0x02,
-        0x53, 0x11, 0x5B, 0x19, 0xD5, 0x22, 0xA4, 0x27, 0x77, 0x22, 0x9F, 0x25,
-        0xD1, 0x20, 0x08, 0x26, 0x2B, 0x15, 0x9A, 0x1B, 0x5A, 0x0D, 0xF9, 0x15,
-        0x01, 0x07, 0x54, 0x13, 0xA2, 0x03, 0x93, 0x13, 0x58, 0x02, 0x14, 0x12,
-        0x07, 0x00, 0x40, 0x0C, 0x66, 0x00, 0xF7, 0x05, 0xC0, 0x02, 0xF4, 0xFD,
-        0x45, 0x08, 0x71, 0xFD, 0x82, 0x09, 0xF7, 0xFC, 0x82, 0x09, 0x33, 0xFF,
-        0xE7, 0x05, 0x11, 0xFE, 0x4E, 0x05, 0xAD, 0xFC, 0x00, 0x05, 0x3E, 0xFB,
-        0xC1, 0x05, 0x57, 0xFA, 0x65, 0x07, 0x1C, 0xFD, 0xD9, 0xEE, 0xD7, 0xE6,
-        0x6F, 0xDD, 0xB6, 0xD8, 0xE5, 0xDD, 0xBB, 0xDA, 0xA1, 0xDF, 0x21, 0xDA,
-        0x4E, 0xEB, 0x59, 0xE4, 0xC4, 0xF2, 0x7A, 0xE9, 0x46, 0xF9, 0x31, 0xEC,
-        0x99, 0xFC, 0x07, 0xEC, 0x34, 0xFE, 0x01, 0xEE, 0xA9, 0x00, 0xFF, 0xF3,
-        0x6E, 0xFF, 0xB9, 0xF9, 0xE2, 0xFC, 0xB0, 0x01, 0x53, 0xF7, 0x3D, 0x02,
-        0x1E, 0xF6, 0xF2, 0x02, 0x4C, 0xF6, 0xC7, 0x00, 0x0D, 0xFA, 0xF9, 0x01,
-        0x91, 0xFA, 0x0D, 0x03, 0xD2, 0xFA, 0x64, 0x04, 0x59, 0xFA, 0x5A, 0x05,
-        0x93, 0xF8, 0x77, 0x02, 0x5D, 0x11, 0xF6, 0x18, 0xBB, 0x22, 0x1E, 0x27,
-        0x68, 0x22, 0x6C, 0x25, 0x64, 0x20, 0xF1, 0x25, 0x9B, 0x14, 0xC9, 0x1B,
-        0x35, 0x0D, 0xC2, 0x16, 0x6E, 0x06, 0xAF, 0x13, 0x44, 0x03, 0xCF, 0x13,
-        0xEE, 0x01, 0xD8, 0x11, 0xEE, 0xFF, 0x3E, 0x0C, 0x69, 0x01, 0x90, 0x06,
-        0xBE, 0x03, 0x65, 0xFE, 0xE9, 0x08, 0x88, 0xFD, 0x17, 0x0A, 0xDC, 0xFC,
-        0xED, 0x09, 0x2F, 0xFF, 0xF1, 0x05, 0xFD, 0xFD, 0x94, 0x05, 0x21, 0xFD,
-        0x24, 0x05, 0x9D, 0xFB, 0xB9, 0x05, 0xB1, 0xFA, 0x73, 0x07, 0x6D, 0xFD,
-        0xAF, 0xEE, 0xC0, 0xE6, 0x69, 0xDD, 0xA4, 0xD8, 0xBB, 0xDD, 0x27, 0xDA,
-        0xC7, 0xDF, 0xAD, 0xD9, 0x77, 0xEB, 0xC5, 0xE3, 0xCC, 0xF2, 0xE0, 0xE8,
-        0x73, 0xF9, 0x09, 0xEC, 0x75, 0xFC, 0xF7, 0xEB, 0x61, 0xFD, 0xB0, 0xED,
-        0x6B, 0xFF, 0x4B, 0xF3, 0x53, 0xFE, 0x71, 0xF9, 0x31, 0xFC, 0xA7, 0x01,
-        0x16, 0xF7, 0x60, 0x02, 0xA2, 0xF5, 0xBF, 0x02, 0xED, 0xF5, 0x5A, 0x00,
-        0xF1, 0xF9, 0x94, 0x01, 0x73, 0xFA, 0x9C, 0x02, 0x03, 0xFB, 0x5E, 0x04,
-        0x4B, 0xFA, 0x54, 0x05, 0xA7, 0xF8, 0xC6, 0x02, 0x3A, 0x11, 0x7A, 0x19,
-        0x4D, 0x22, 0x79, 0x27, 0xD8, 0x21, 0xD1, 0x25, 0x16, 0x20, 0x80, 0x26,
-        0x6E, 0x14, 0x34, 0x1C, 0x30, 0x0D, 0xF7, 0x16, 0xCA, 0x06, 0xCB, 0x13,
-        0x95, 0x03, 0x89, 0x13, 0xB4, 0x02, 0xD5, 0x11, 0x51, 0x00, 0xF9, 0x0B,
-        0x69, 0x01, 0xF0, 0x05, 0xCB, 0x03, 0x2F, 0xFE, 0x2D, 0x09, 0x00, 0xFE,
-        0x96, 0x0A, 0xA8, 0xFD, 0xE5, 0x09, 0xC1, 0xFF, 0xEF, 0x05, 0x85, 0xFE,
-        0x44, 0x05, 0x25, 0xFD, 0xC3, 0x04, 0x58, 0xFB, 0x94, 0x05, 0x58, 0xFA,
-        0x1F, 0x07, 0xDE, 0xFC, 0x99, 0xEE, 0x28, 0xE6, 0xA0, 0xDD, 0x48, 0xD8,
-        0x35, 0xDE, 0x1C, 0xDA, 0xB3, 0xDF, 0x42, 0xD9, 0x7A, 0xEB, 0xD1, 0xE3,
-        0xA5, 0xF2, 0x25, 0xE9, 0xD7, 0xF8, 0x30, 0xEC, 0x3C, 0xFC, 0x8C, 0xEC,
-        0x55, 0xFD, 0x55, 0xEE, 0xBD, 0xFF, 0x0A, 0xF4, 0x92, 0xFE, 0xF2, 0xF9,
-        0x26, 0xFC, 0x87, 0x01, 0xDE, 0xF6, 0xB4, 0x01, 0x99, 0xF5, 0x3C, 0x02,
-        0x3E, 0xF6, 0x0F, 0x00, 0xDA, 0xF9, 0x2F, 0x01, 0x4F, 0xFA, 0x87, 0x02,
-        0xCF, 0xFA, 0x8F, 0x04, 0x0F, 0xFA, 0x9A, 0x05, 0xB7, 0xF8, 0x32, 0x03,
-        0x6F, 0x11, 0xF4, 0x19, 0x68, 0x22, 0xCC, 0x27, 0xEC, 0x21, 0xF1, 0x25,
-        0x5A, 0x20, 0xAB, 0x26, 0x8A, 0x14, 0xFF, 0x1B, 0x22, 0x0D, 0x53, 0x16,
-        0xF3, 0x06, 0x5C, 0x13, 0x72, 0x03, 0x1E, 0x13, 0x59, 0x02, 0x9B, 0x11,
-        0x43, 0x00, 0x70, 0x0C, 0x51, 0x01, 0x71, 0x06, 0xB8, 0x03, 0xD7, 0xFE,
-        0xBF, 0x08, 0x4B, 0xFE, 0x37, 0x0A, 0xED, 0xFD, 0xBC, 0x09, 0x2E, 0x00,
-        0x20, 0x06, 0xF2, 0xFE, 0xB1, 0x05, 0x81, 0xFD, 0xD9, 0x04, 0x13, 0xFB,
-        0xB4, 0x05, 0x36, 0xFA, 0xED, 0x06, 0xCA, 0xFC, 0x75, 0xEE, 0x68, 0xE6,
-        0x76, 0xDD, 0x9C, 0xD8, 0xEB, 0xDD, 0x63, 0xDA, 0xAE, 0xDF, 0xC2, 0xD9,
-        0x30, 0xEB, 0x03, 0xE4, 0xD0, 0xF2, 0xFE, 0xE9, 0xEC, 0xF8, 0xBD, 0xEC,
-        0x6A, 0xFC, 0xD4, 0xEC, 0x78, 0xFD, 0x00, 0xEE, 0x80, 0xFF, 0xF4, 0xF2,
-        0xB8, 0xFE, 0x3B, 0xF9, 0x29, 0xFC, 0xC9, 0x00, 0x35, 0xF7, 0xA0, 0x01,
-        0x78, 0xF5, 0xE0, 0x01, 0xF0, 0xF5, 0xC2, 0xFF, 0xAE, 0xF9, 0x34, 0x01,
-        0x08, 0xFA, 0xA5, 0x02, 0xF7, 0xFA, 0x34, 0x05, 0xFE, 0xF9, 0xBF, 0x05,
-        0xEF, 0xF8, 0x0E, 0x03, 0x79, 0x11, 0x50, 0x19, 0xA2, 0x22, 0x3D, 0x27,
-        0xF9, 0x21, 0x5F, 0x25, 0xF9, 0x1F, 0xF9, 0x25, 0x8A, 0x14, 0x0C, 0x1C,
-        0xEA, 0x0C, 0x04, 0x16, 0xED, 0x06, 0x68, 0x13, 0x70, 0x03, 0x58, 0x13,
-        0x4C, 0x02, 0x18, 0x12, 0x09, 0x00, 0x01, 0x0D, 0x03, 0x01, 0xD1, 0x06,
-        0xEF, 0x03, 0x92, 0xFF, 0x0F, 0x09, 0xCA, 0xFE, 0xC3, 0x0A, 0x6A, 0xFE,
-        0x0B, 0x0A, 0x55, 0x00, 0x2D, 0x06, 0xC6, 0xFE, 0xD9, 0x05, 0x67, 0xFD,
-        0x1F, 0x05, 0xFA, 0xFA, 0x0A, 0x06, 0x82, 0xFA, 0xFC, 0x06, 0x32, 0xFD,
-        0x1D, 0xEE, 0xAC, 0xE6, 0xFE, 0xDC, 0xB8, 0xD8, 0x18, 0xDE, 0xE4, 0xDA,
-        0x43, 0xE0, 0x2F, 0xDA, 0xD6, 0xEB, 0xF3, 0xE3, 0x38, 0xF3, 0xC2, 0xE9,
-        0x2F, 0xF9, 0x58, 0xEC, 0x93, 0xFC, 0x68, 0xEC, 0xEC, 0xFD, 0x06, 0xEE,
-        0x42, 0x00, 0x42, 0xF3, 0xFA, 0xFE, 0x4F, 0xF9, 0x05, 0xFC, 0x86, 0x00,
-        0xC0, 0xF6, 0x3A, 0x01, 0x55, 0xF5, 0xD6, 0x01, 0x20, 0xF6, 0xD2, 0xFF,
-        0x1A, 0xFA, 0x59, 0x01, 0x5E, 0xFA, 0x7A, 0x02, 0xC9, 0xFA, 0x9B, 0x04,
-        0x01, 0xFA, 0x27, 0x05, 0xE6, 0xF8, 0x59, 0x02, 0x20, 0x12, 0x63, 0x19,
-        0x2C, 0x23, 0x5D, 0x27, 0x0B, 0x22, 0x4B, 0x25, 0x06, 0x20, 0x4F, 0x26,
-        0x33, 0x14, 0x5C, 0x1C, 0xB4, 0x0C, 0x60, 0x16, 0x88, 0x06, 0x66, 0x13,
-        0x3C, 0x03, 0x53, 0x13, 0x06, 0x02, 0x8D, 0x11, 0xC9, 0xFF, 0x64, 0x0C,
-        0x29, 0x01, 0x41, 0x06, 0xC6, 0x03, 0xDB, 0xFE, 0x37, 0x09, 0x5D, 0xFE,
-        0x9D, 0x0A, 0xD7, 0xFD, 0xE8, 0x09, 0x2B, 0x00, 0xE6, 0x05, 0xB2, 0xFE,
-        0x65, 0x05, 0x88, 0xFD, 0xF1, 0x04, 0x6D, 0xFB, 0x7D, 0x05, 0xB7, 0xFA,
-        0xFA, 0x06, 0xDB, 0xFD, 0xED, 0xED, 0xC3, 0xE6, 0x10, 0xDD, 0xD9, 0xD8,
-        0x4E, 0xDE, 0xE1, 0xDA, 0x10, 0xE0, 0xA3, 0xD9, 0x36, 0xEC, 0xEE, 0xE3,
-        0xA9, 0xF3, 0x19, 0xEA, 0xA9, 0xF9, 0x0E, 0xED, 0xA1, 0xFC, 0xFD, 0xEC,
-        0x78, 0xFD, 0x89, 0xEE, 0xC5, 0xFF, 0xDA, 0xF3, 0xBB, 0xFE, 0x49, 0xFA,
-        0x7A, 0xFC, 0xDB, 0x01, 0xF2, 0xF6, 0xFD, 0x01, 0x77, 0xF5, 0x59, 0x02,
-        0x11, 0xF6, 0xB6, 0xFF, 0xEA, 0xF9, 0x1D, 0x01, 0xA6, 0xFA, 0x82, 0x02,
-        0x23, 0xFB, 0xA4, 0x04, 0xA3, 0xFA, 0x62, 0x05, 0xE3, 0xF8, 0xF6, 0x01,
-        0xC1, 0x11, 0x00, 0x19, 0xB1, 0x22, 0x19, 0x27, 0x67, 0x21, 0xFB, 0x24,
-        0xDE, 0x1F, 0x67, 0x26, 0xB4, 0x13, 0xE1, 0x1B, 0x65, 0x0C, 0xBB, 0x15,
-        0x93, 0x06, 0xD4, 0x12, 0x64, 0x03, 0xBC, 0x12, 0x8C, 0x02, 0x41, 0x11,
-        0x1E, 0x00, 0xD2, 0x0B, 0x2D, 0x01, 0x93, 0x05, 0x99, 0x03, 0x71, 0xFE,
-        0x30, 0x09, 0xAE, 0xFE, 0x60, 0x0A, 0x28, 0xFE, 0x97, 0x09, 0xC7, 0x00,
-        0xB7, 0x05, 0x2E, 0xFF, 0xDE, 0x04, 0x77, 0xFD, 0xA5, 0x04, 0x84, 0xFB,
-        0x5E, 0x05, 0xE1, 0xFA, 0x1E, 0x07, 0x57, 0xFE, 0x35, 0xEE, 0x1E, 0xE7,
-        0x48, 0xDD, 0xFD, 0xD8, 0xBC, 0xDE, 0x3F, 0xDB, 0x3A, 0xE0, 0xED, 0xD9,
-        0x3F, 0xEC, 0x6A, 0xE4, 0x63, 0xF3, 0x8C, 0xEA, 0x47, 0xF9, 0x81, 0xED,
-        0xCC, 0xFC, 0xB0, 0xED, 0xE4, 0xFD, 0x1D, 0xEF, 0x2F, 0x00, 0x3B, 0xF4,
-        0x27, 0xFF, 0x50, 0xFA, 0x9C, 0xFC, 0x16, 0x01, 0x1D, 0xF7, 0xF2, 0x00,
-        0x4E, 0xF6, 0xC3, 0x01, 0xFA, 0xF6, 0x1C, 0xFF, 0xB8, 0xFA, 0xD1, 0x00,
-        0x26, 0xFB, 0x75, 0x02, 0x07, 0xFB, 0x35, 0x04, 0x1F, 0xFA, 0xCB, 0x04,
-        0xDE, 0xF8, 0xC3, 0x01, 0xF4, 0x11, 0x2D, 0x19, 0xAA, 0x22, 0x20, 0x27,
-        0x35, 0x21, 0xD5, 0x24, 0x87, 0x1F, 0xF0, 0x25, 0xB1, 0x13, 0x85, 0x1B,
-        0x6E, 0x0C, 0x1B, 0x15, 0x92, 0x06, 0x25, 0x12, 0x0D, 0x03, 0x2B, 0x12,
-        0xDF, 0x01, 0xF1, 0x10, 0xCF, 0xFF, 0x44, 0x0C, 0x5D, 0x00, 0xE5, 0x05,
-        0xDA, 0x02, 0x3A, 0xFF, 0x41, 0x08, 0x19, 0xFF, 0x45, 0x09, 0x5E, 0xFE,
-        0xE1, 0x08, 0x26, 0x01, 0x59, 0x05, 0x3B, 0xFF, 0x4A, 0x05, 0xC1, 0xFD,
-        0x53, 0x05, 0xB3, 0xFB, 0x39, 0x06, 0x24, 0xFB, 0x1C, 0x07, 0xE4, 0xFD,
-        0x1C, 0xEE, 0xD2, 0xE6, 0x7C, 0xDD, 0x04, 0xD9, 0xAB, 0xDE, 0x24, 0xDB,
-        0x8D, 0xE0, 0x35, 0xDA, 0x54, 0xEC, 0x83, 0xE4, 0xF9, 0xF3, 0x5E, 0xEB,
-        0x90, 0xF9, 0x17, 0xEE, 0xEB, 0xFC, 0xD7, 0xED, 0x00, 0xFE, 0xD6, 0xEE,
-        0xFD, 0xFF, 0x5D, 0xF3, 0xC1, 0xFF, 0xE1, 0xF9, 0x4C, 0xFD, 0x83, 0x00,
-        0xE0, 0xF7, 0xD6, 0x00, 0x70, 0xF6, 0x4A, 0x01, 0xE5, 0xF6, 0xBD, 0xFE,
-        0x5B, 0xFA, 0xD2, 0x00, 0x65, 0xFA, 0x59, 0x02, 0x88, 0xFA, 0x9A, 0x04,
-        0x87, 0xF9, 0x0E, 0x05, 0x8F, 0xF8, 0x02, 0x02, 0x6A, 0x11, 0xAD, 0x18,
-        0x74, 0x22, 0x96, 0x26, 0x71, 0x21, 0x6E, 0x24, 0x99, 0x1F, 0x59, 0x25,
-        0xA9, 0x13, 0x19, 0x1B, 0x16, 0x0C, 0x6A, 0x14, 0xAC, 0x06, 0xEB, 0x11,
-        0x51, 0x03, 0x3F, 0x12, 0x1B, 0x02, 0x1E, 0x11, 0xCA, 0xFF, 0x5E, 0x0C,
-        0x30, 0x00, 0x1C, 0x06, 0x67, 0x02, 0x6D, 0xFF, 0x0C, 0x08, 0x19, 0xFF,
-        0xB6, 0x09, 0xD1, 0xFE, 0x41, 0x09, 0x4F, 0x01, 0xDF, 0x05, 0x48, 0xFF,
-        0xA1, 0x05, 0xC2, 0xFD, 0x89, 0x05, 0x9F, 0xFB, 0x5F, 0x06, 0x15, 0xFB,
-        0x6F, 0x07, 0x39, 0xFE, 0x39, 0xEE, 0x4C, 0xE7, 0xE5, 0xDC, 0x41, 0xD9,
-        0x05, 0xDE, 0xB0, 0xDB, 0xEC, 0xDF, 0xDA, 0xDA, 0x20, 0xEC, 0x23, 0xE5,
-        0x74, 0xF3, 0x6A, 0xEB, 0x17, 0xF9, 0x01, 0xEE, 0x8E, 0xFC, 0xC4, 0xED,
-        0x03, 0xFE, 0x30, 0xEF, 0x7F, 0x00, 0x17, 0xF4, 0xBD, 0xFF, 0xD8, 0xF9,
-        0xAA, 0xFD, 0x76, 0x00, 0xD7, 0xF7, 0xB2, 0x00, 0x4C, 0xF6, 0x37, 0x01,
-        0xC8, 0xF6, 0xBF, 0xFE, 0x5A, 0xFA, 0x02, 0x01, 0xC6, 0xFA, 0x6F, 0x02,
-        0xB0, 0xFA, 0x42, 0x04, 0x04, 0xFA, 0xEE, 0x04, 0xBA, 0xF8, 0xA4, 0x01,
-        0x09, 0x12, 0xDD, 0x18, 0x39, 0x23, 0xBC, 0x26, 0x13, 0x22, 0x3F, 0x24,
-        0x69, 0x20, 0x57, 0x25, 0x24, 0x14, 0x16, 0x1B, 0xDC, 0x0C, 0xF1, 0x14,
-        0xE4, 0x06, 0xF6, 0x11, 0x76, 0x03, 0x1D, 0x12, 0x0B, 0x02, 0x8C, 0x10,
-        0x92, 0xFF, 0x85, 0x0B, 0x54, 0x00, 0xE5, 0x05, 0x37, 0x02, 0x4B, 0xFF,
-        0x0F, 0x08, 0x0C, 0xFF, 0x8D, 0x09, 0x7A, 0xFE, 0x6A, 0x09, 0x2A, 0x01,
-        0xEF, 0x05, 0xEE, 0xFE, 0xA5, 0x05, 0xB1, 0xFD, 0xB1, 0x05, 0xEB, 0xFB,
-        0x20, 0x06, 0x09, 0xFB, 0x86, 0x07, 0x58, 0xFE, 0x31, 0xEE, 0x06, 0xE7,
-        0xEB, 0xDC, 0x0D, 0xD9, 0xE1, 0xDD, 0x75, 0xDB, 0x7B, 0xDF, 0x64, 0xDA,
-        0xC9, 0xEB, 0xBC, 0xE4, 0x41, 0xF3, 0x1B, 0xEB, 0x2B, 0xF9, 0x25, 0xEE,
-        0x65, 0xFC, 0xED, 0xED, 0x99, 0xFD, 0x70, 0xEF, 0x17, 0x00, 0xB5, 0xF4,
-        0x9E, 0xFF, 0x81, 0xFA, 0xB5, 0xFD, 0xF6, 0x00, 0x05, 0xF8, 0x52, 0x01,
-        0x70, 0xF6, 0xA8, 0x01, 0x65, 0xF6, 0xE8, 0xFE, 0xD2, 0xF9, 0x26, 0x01,
-        0x3B, 0xFA, 0x82, 0x02, 0x92, 0xFA, 0x9F, 0x04, 0x4A, 0xFA, 0x8C, 0x05,
-        0xB4, 0xF8, 0x0A, 0x02, 0xA8, 0x11, 0x00, 0x19, 0xCA, 0x22, 0xE7, 0x26,
-        0x97, 0x21, 0x32, 0x24, 0x1D, 0x20, 0x3F, 0x25, 0x2C, 0x14, 0x23, 0x1B,
-        0xDD, 0x0C, 0xD5, 0x14, 0x1C, 0x07, 0xF4, 0x11, 0xED, 0x03, 0x39, 0x12,
-        0xC3, 0x02, 0xC4, 0x10, 0x0F, 0x00, 0x0C, 0x0B, 0x42, 0x00, 0xFA, 0x04,
-        0x60, 0x02, 0xAD, 0xFE, 0x3D, 0x08, 0x9A, 0xFE, 0xF9, 0x09, 0x95, 0xFE,
-        0xC3, 0x09, 0x05, 0x01, 0x16, 0x06, 0x69, 0xFE, 0x4F, 0x05, 0xAF, 0xFC,
-        0xE5, 0x04, 0x9F, 0xFA, 0x54, 0x05, 0x0C, 0xFA, 0xCE, 0x06, 0x9A, 0xFD,
-        0xD2, 0xED, 0x8E, 0xE6, 0xF6, 0xDC, 0xAA, 0xD8, 0xA7, 0xDE, 0xC6, 0xDB,
-        0x4F, 0xE0, 0xED, 0xDA, 0xE4, 0xEB, 0xD8, 0xE4, 0xF1, 0xF2, 0x07, 0xEB,
-        0xCA, 0xF8, 0x02, 0xEE, 0x3C, 0xFC, 0xE3, 0xED, 0xA1, 0xFD, 0x88, 0xEF,
-        0x31, 0x00, 0x42, 0xF5, 0x8B, 0xFF, 0x01, 0xFB, 0x2F, 0xFD, 0x18, 0x01,
-        0x84, 0xF7, 0x49, 0x01, 0x64, 0xF6, 0xAE, 0x01, 0xD4, 0xF6, 0x8F, 0xFF,
-        0x75, 0xFA, 0x3E, 0x02, 0x3B, 0xFB, 0x0C, 0x04, 0xCD, 0xFB, 0x2E, 0x06,
-        0x50, 0xFB, 0x71, 0x06, 0xD5, 0xF9, 0xA2, 0x02, 0xB8, 0x12, 0x9A, 0x19,
-        0x39, 0x23, 0x62, 0x27, 0xA7, 0x21, 0xAA, 0x24, 0x19, 0x20, 0xBA, 0x25,
-        0xBF, 0x14, 0xFD, 0x1B, 0x9F, 0x0D, 0xAD, 0x15, 0x8A, 0x07, 0x6A, 0x12,
-        0x0F, 0x04, 0x95, 0x12, 0x96, 0x02, 0xF0, 0x10, 0x2E, 0x00, 0x31, 0x0B,
-        0xD4, 0x00, 0x61, 0x05, 0xD8, 0x02, 0xDC, 0xFE, 0x39, 0x08, 0x85, 0xFE,
-        0x2C, 0x09, 0x2D, 0xFE, 0xC4, 0x08, 0x65, 0x00, 0x5E, 0x05, 0xD1, 0xFD,
-        0xB6, 0x04, 0xF6, 0xFB, 0x01, 0x04, 0x9B, 0xF9, 0x8C, 0x04, 0x69, 0xF9,
-        0xAD, 0x05, 0x05, 0xFD, 0x98, 0xEC, 0xDA, 0xE5, 0x35, 0xDC, 0xFD, 0xD7,
-        0xDD, 0xDD, 0x94, 0xDA, 0x8D, 0xDF, 0x76, 0xD9, 0x02, 0xEB, 0x4C, 0xE3,
-        0x2B, 0xF2, 0xB2, 0xE9, 0x69, 0xF8, 0x34, 0xED, 0xD4, 0xFB, 0x00, 0xED,
-        0x3F, 0xFD, 0x8E, 0xEE, 0x74, 0xFF, 0x47, 0xF4, 0xC1, 0xFE, 0x2D, 0xFA,
-        0x3E, 0xFD, 0x52, 0x01, 0x0B, 0xF8, 0xD9, 0x01, 0x15, 0xF7, 0xEA, 0x01,
-        0x89, 0xF7, 0x99, 0xFF, 0xA9, 0xFA, 0xC6, 0x01, 0x6B, 0xFB, 0xD0, 0x03,
-        0x77, 0xFC, 0x9E, 0x06, 0xEE, 0xFB, 0xEC, 0x06, 0xBF, 0xFA, 0x4F, 0x03,
-        0xF3, 0x13, 0x97, 0x1A, 0x58, 0x24, 0xA7, 0x28, 0x8B, 0x22, 0xFE, 0x25,
-        0x86, 0x20, 0xFB, 0x26, 0xB9, 0x14, 0xB6, 0x1C, 0xC5, 0x0D, 0x84, 0x16,
-        0x0B, 0x08, 0x52, 0x13, 0xC1, 0x04, 0x93, 0x13, 0xDA, 0x02, 0xA5, 0x11,
-        0x3F, 0x00, 0x57, 0x0B, 0x3C, 0x01, 0xC2, 0x05, 0xF9, 0x02, 0xA4, 0xFE,
-        0x70, 0x08, 0x50, 0xFE, 0x38, 0x09, 0x20, 0xFE, 0x2E, 0x08, 0xE7, 0xFF,
-        0x48, 0x05, 0x16, 0xFE, 0xC9, 0x04, 0x48, 0xFC, 0xD7, 0x03, 0x9A, 0xF9,
-        0x65, 0x04, 0x25, 0xF9, 0x7A, 0x05, 0xA6, 0xFC, 0xC4, 0xEB, 0xD0, 0xE4,
-        0x78, 0xDB, 0xC9, 0xD6, 0x98, 0xDD, 0xBB, 0xD9, 0x7B, 0xDF, 0x8F, 0xD8,
-        0x58, 0xEB, 0xF4, 0xE2, 0x29, 0xF2, 0x0F, 0xE9, 0x04, 0xF8, 0x9A, 0xEC,
-        0x85, 0xFB, 0xBC, 0xEC, 0x91, 0xFD, 0xC9, 0xEE, 0x9B, 0xFF, 0xA4, 0xF4,
-        0x05, 0xFE, 0x85, 0xF9, 0x93, 0xFC, 0xFC, 0x00, 0x51, 0xF7, 0x8F, 0x01,
-        0xDB, 0xF6, 0x11, 0x02, 0xFF, 0xF7, 0x6E, 0x00, 0xF2, 0xFA, 0x38, 0x02,
-        0x54, 0xFB, 0xE3, 0x03, 0x44, 0xFC, 0x66, 0x06, 0x5C, 0xFB, 0x96, 0x06,
-        0x26, 0xFA, 0xDD, 0x02, 0x4E, 0x14, 0x1B, 0x1B, 0x85, 0x24, 0xFF, 0x28,
-        0x6A, 0x22, 0xF7, 0x25, 0x74, 0x20, 0x18, 0x27, 0x3C, 0x14, 0x5E, 0x1C,
-        0x18, 0x0D, 0x1C, 0x16, 0x9E, 0x07, 0xFA, 0x12, 0xAE, 0x04, 0x5D, 0x13,
-        0xD7, 0x02, 0xA4, 0x11, 0x57, 0x01, 0x34, 0x0C, 0x8D, 0x02, 0x13, 0x07,
-        0x9B, 0x03, 0x44, 0xFF, 0xB2, 0x08, 0x6D, 0xFE, 0x25, 0x09, 0xE8, 0xFD,
-        0x2D, 0x08, 0x7F, 0xFF, 0x29, 0x05, 0xA4, 0xFD, 0x29, 0x05, 0x54, 0xFC,
-        0xFB, 0x03, 0xAB, 0xF9, 0xE5, 0x04, 0x81, 0xF9, 0x2E, 0x06, 0x42, 0xFD,
-        0x4F, 0xEC, 0x70, 0xE5, 0x64, 0xDC, 0xD6, 0xD7, 0xCF, 0xDD, 0x68, 0xDA,
-        0x73, 0xDF, 0x03, 0xD9, 0xC7, 0xEB, 0xDA, 0xE3, 0x91, 0xF3, 0x90, 0xEA,
-        0x83, 0xF8, 0xF8, 0xEC, 0x15, 0xFB, 0x2B, 0xEC, 0xEA, 0xFC, 0xBB, 0xED,
-        0x69, 0xFE, 0x54, 0xF3, 0x24, 0xFE, 0x64, 0xF9, 0xD5, 0xFC, 0x03, 0x01,
-        0x2E, 0xF7, 0x75, 0x01, 0x00, 0xF6, 0x5E, 0x01, 0xE6, 0xF6, 0xFF, 0xFF,
-        0x63, 0xFA, 0x73, 0x02, 0x79, 0xFA, 0xD3, 0x03, 0xB5, 0xFB, 0x65, 0x06,
-        0x87, 0xFA, 0x26, 0x06, 0x6E, 0xF9, 0x83, 0x02, 0x5E, 0x13, 0x45, 0x1A,
-        0xEB, 0x23, 0x88, 0x28, 0xBC, 0x22, 0xF9, 0x25, 0xAE, 0x20, 0xE5, 0x26,
-        0x1E, 0x14, 0xC4, 0x1B, 0x32, 0x0C, 0x17, 0x15, 0xCE, 0x07, 0x7B, 0x13,
-        0xD9, 0x04, 0x06, 0x14, 0xEE, 0x02, 0x95, 0x12, 0xBC, 0x01, 0x36, 0x0D,
-        0xDF, 0x01, 0x07, 0x07, 0x6F, 0x03, 0xA8, 0xFF, 0xD5, 0x08, 0xDF, 0xFE,
-        0xB0, 0x09, 0x95, 0xFE, 0xA4, 0x08, 0x8C, 0xFF, 0x83, 0x05, 0x46, 0xFD,
-        0xE8, 0x05, 0x50, 0xFC, 0x26, 0x05, 0x53, 0xFA, 0x49, 0x06, 0x98, 0xFA,
-        0xCA, 0x06, 0xC6, 0xFD, 0xCF, 0xEC, 0xEE, 0xE5, 0xD0, 0xDB, 0x37, 0xD7,
-        0x32, 0xDD, 0xEC, 0xD9, 0x67, 0xDF, 0x34, 0xD9, 0xAF, 0xEB, 0x06, 0xE4,
-        0x9B, 0xF3, 0x98, 0xEA, 0xEF, 0xF7, 0x06, 0xEC, 0x2E, 0xFB, 0xAB, 0xEB,
-        0xAD, 0xFC, 0xAC, 0xEC, 0x94, 0xFD, 0xD0, 0xF1, 0xB8, 0xFD, 0x67, 0xF8,
-        0x4A, 0xFC, 0xE8, 0xFF, 0x27, 0xF7, 0xED, 0x00, 0x92, 0xF6, 0x6F, 0x01,
-        0x77, 0xF7, 0x66, 0x00, 0x34, 0xFA, 0x65, 0x02, 0x97, 0xF9, 0x36, 0x03,
-        0x1C, 0xFA, 0x0B, 0x05, 0x58, 0xF9, 0x23, 0x05, 0x20, 0xF9, 0x50, 0x02,
-        0xD0, 0x12, 0xE2, 0x19, 0xB9, 0x23, 0xAB, 0x28, 0x45, 0x22, 0xF0, 0x25,
-        0x50, 0x20, 0x00, 0x27, 0xAD, 0x14, 0xBE, 0x1C, 0x9F, 0x0C, 0x25, 0x16,
-        0xDC, 0x07, 0x47, 0x14, 0x5F, 0x04, 0x56, 0x14, 0x0F, 0x03, 0x81, 0x13,
-        0xA0, 0x02, 0x94, 0x0E, 0x96, 0x02, 0xEF, 0x07, 0x02, 0x04, 0x42, 0x00,
-        0xC4, 0x08, 0xE9, 0xFE, 0x0C, 0x09, 0x2A, 0xFE, 0x91, 0x08, 0xB2, 0xFF,
-        0x14, 0x06, 0x02, 0xFE, 0x95, 0x06, 0x02, 0xFD, 0xEF, 0x05, 0x0D, 0xFB,
-        0xBD, 0x06, 0xD5, 0xFA, 0x29, 0x07, 0xD9, 0xFD, 0x87, 0xED, 0x3F, 0xE6,
-        0x18, 0xDC, 0xEC, 0xD6, 0x4A, 0xDD, 0x6A, 0xD9, 0x91, 0xDF, 0xB3, 0xD8,
-        0x7C, 0xEB, 0x6D, 0xE3, 0xF9, 0xF3, 0x7B, 0xEA, 0xD1, 0xF8, 0x89, 0xEC,
-        0xF7, 0xFB, 0x36, 0xEC, 0x2F, 0xFD, 0xED, 0xEC, 0x59, 0xFD, 0xAD, 0xF1,
-        0x2E, 0xFD, 0x2E, 0xF8, 0x77, 0xFB, 0xA4, 0xFF, 0xA5, 0xF6, 0xDF, 0x00,
-        0x83, 0xF6, 0xAF, 0x01, 0x21, 0xF7, 0x30, 0x00, 0xF8, 0xF9, 0x20, 0x02,
-        0x7A, 0xF9, 0x1D, 0x03, 0xE1, 0xF9, 0xE5, 0x04, 0x20, 0xF9, 0x4C, 0x05,
-        0x17, 0xF9, 0xC1, 0x02, 0x3F, 0x13, 0xF4, 0x1A, 0x84, 0x24, 0x0A, 0x2A,
-        0x85, 0x22, 0xA9, 0x26, 0x93, 0x1F, 0x9A, 0x26, 0xDC, 0x13, 0xD0, 0x1B,
-        0xA2, 0x0B, 0xF1, 0x14, 0xDF, 0x06, 0xDB, 0x12, 0xDB, 0x03, 0x24, 0x13,
-        0x35, 0x02, 0x21, 0x12, 0xEF, 0x01, 0x48, 0x0D, 0x61, 0x02, 0x36, 0x07,
-        0xAA, 0x04, 0x62, 0x00, 0xD1, 0x09, 0xAD, 0xFF, 0x87, 0x09, 0x84, 0xFE,
-        0x1E, 0x08, 0x5C, 0xFF, 0xD3, 0x04, 0x19, 0xFD, 0xC9, 0x05, 0x94, 0xFC,
-        0xDA, 0x05, 0x4D, 0xFB, 0x93, 0x06, 0xA9, 0xFA, 0x86, 0x06, 0x10, 0xFD,
-        0x27, 0xEC, 0x99, 0xE4, 0x35, 0xDB, 0xEC, 0xD5, 0x55, 0xDD, 0x90, 0xD9,
-        0xEA, 0xDF, 0x48, 0xD9, 0x72, 0xEB, 0x15, 0xE4, 0x11, 0xF4, 0x35, 0xEB,
-        0x89, 0xF9, 0x16, 0xEE, 0xCA, 0xFC, 0x0A, 0xEE, 0xD9, 0xFE, 0x63, 0xEF,
-        0x1F, 0xFF, 0x1F, 0xF4, 0x03, 0xFE, 0x72, 0xF9, 0x5E, 0xFB, 0xC2, 0xFF,
-        0x3F, 0xF6, 0x67, 0x00, 0x36, 0xF7, 0x32, 0x02, 0xB5, 0xF8, 0x67, 0x01,
-        0xA4, 0xFB, 0x3F, 0x03, 0x07, 0xFA, 0x24, 0x03, 0x03, 0xFA, 0x7C, 0x04,
-        0x80, 0xF9, 0x8E, 0x05, 0x1F, 0xF9, 0xE4, 0x02, 0x8C, 0x13, 0x73, 0x1B,
-        0x61, 0x24, 0x05, 0x2A, 0xA8, 0x22, 0x9A, 0x26, 0x6F, 0x20, 0x35, 0x27,
-        0xA3, 0x14, 0x05, 0x1C, 0x96, 0x0B, 0x91, 0x14, 0xE9, 0x05, 0x88, 0x11,
-        0x3A, 0x03, 0xF7, 0x11, 0x34, 0x01, 0xB3, 0x10, 0xF3, 0x00, 0xC3, 0x0B,
-        0xBD, 0x01, 0x13, 0x06, 0xA6, 0x03, 0xD6, 0xFE, 0x47, 0x08, 0xA3, 0xFD,
-        0xF3, 0x07, 0x57, 0xFC, 0xD1, 0x07, 0x6A, 0xFE, 0x66, 0x05, 0x32, 0xFD,
-        0xD4, 0x06, 0x2F, 0xFD, 0xFB, 0x05, 0x27, 0xFB, 0x6A, 0x06, 0x02, 0xFA,
-        0x74, 0x07, 0x54, 0xFD, 0x12, 0xED, 0xE0, 0xE4, 0x1D, 0xDC, 0x49, 0xD6,
-        0x3D, 0xDD, 0x43, 0xD9, 0xCA, 0xDE, 0x19, 0xD8, 0x65, 0xEA, 0x2E, 0xE3,
-        0xA5, 0xF3, 0xB9, 0xEA, 0x6A, 0xF9, 0xC2, 0xED, 0x40, 0xFC, 0x83, 0xED,
-        0xA4, 0xFE, 0x22, 0xEF, 0x4D, 0xFF, 0x8C, 0xF4, 0xB7, 0xFE, 0x90, 0xFA,
-        0xC2, 0xFC, 0xCF, 0x01, 0xC0, 0xF7, 0xBB, 0x02, 0xF3, 0xF6, 0x09, 0x03,
-        0x0A, 0xF7, 0xFD, 0x00, 0x25, 0xFA, 0xF2, 0x02, 0x25, 0xF9, 0x45, 0x03,
-        0x3F, 0xFA, 0x76, 0x05, 0x78, 0xF9, 0x3E, 0x06, 0x80, 0xF8, 0xFA, 0x02,
-        0x1C, 0x13, 0xA7, 0x1B, 0x40, 0x24, 0x5B, 0x2A, 0x20, 0x23, 0x46, 0x27,
-        0xD8, 0x21, 0xA5, 0x28, 0x93, 0x16, 0xC6, 0x1D, 0x1B, 0x0D, 0x1B, 0x16,
-        0x31, 0x07, 0xE2, 0x12, 0x90, 0x03, 0x45, 0x12, 0x2D, 0x01, 0x8D, 0x10,
-        0x2A, 0x01, 0xB4, 0x0B, 0xB9, 0x02, 0x99, 0x06, 0x08, 0x05, 0xBC, 0xFF,
-        0x47, 0x09, 0x24, 0xFE, 0xBF, 0x09, 0x9E, 0xFD, 0xD0, 0x08, 0xDA, 0xFE,
-        0x8B, 0x05, 0xD5, 0xFC, 0x08, 0x07, 0x09, 0xFD, 0x98, 0x05, 0x91, 0xFA,
-        0x2C, 0x06, 0x75, 0xF9, 0xA3, 0x06, 0x25, 0xFC, 0x1B, 0xEC, 0x79, 0xE3,
-        0x54, 0xDB, 0x18, 0xD5, 0x1E, 0xDD, 0xEC, 0xD8, 0x92, 0xDE, 0xB8, 0xD7,
-        0x6D, 0xE9, 0x3F, 0xE2, 0x67, 0xF2, 0x63, 0xE9, 0xBA, 0xF7, 0xF2, 0xEB,
-        0xCA, 0xFB, 0x2C, 0xED, 0x4E, 0xFE, 0x19, 0xEF, 0x34, 0xFE, 0xEF, 0xF3,
-        0x4F, 0xFC, 0xCD, 0xF8, 0xE6, 0xF9, 0x81, 0xFF, 0x17, 0xF6, 0x61, 0x01,
-        0x6C, 0xF5, 0x85, 0x01, 0xF6, 0xF6, 0xB5, 0x00, 0x5B, 0xFA, 0xB4, 0x02,
-        0xEC, 0xF8, 0x70, 0x02, 0x56, 0xFB, 0xFE, 0x05, 0x44, 0xFB, 0xCD, 0x07,
-        0xC3, 0xFA, 0x55, 0x05, 0x77, 0x14, 0x61, 0x1D, 0x3A, 0x24, 0xCC, 0x2A,
-        0xF2, 0x21, 0x7B, 0x26, 0x0B, 0x21, 0x27, 0x28, 0xF2, 0x16, 0x53, 0x1E,
-        0x4D, 0x0E, 0x7C, 0x17, 0x03, 0x09, 0x0D, 0x15, 0x6C, 0x04, 0x2A, 0x13,
-        0xFA, 0x01, 0x42, 0x11, 0x18, 0x02, 0x66, 0x0C, 0xEC, 0x03, 0x54, 0x07,
-        0x6C, 0x06, 0xB2, 0x00, 0x8C, 0x0A, 0x31, 0xFF, 0xF2, 0x0B, 0xDC, 0xFF,
-        0xE7, 0x09, 0x3E, 0x00, 0xCF, 0x05, 0xAD, 0xFD, 0x93, 0x06, 0x5A, 0xFD,
-        0x68, 0x03, 0xFA, 0xF8, 0x0B, 0x04, 0x91, 0xF7, 0x82, 0x05, 0xCF, 0xFA,
-        0x24, 0xEC, 0xDC, 0xE2, 0x9A, 0xDB, 0xB0, 0xD4, 0x27, 0xDD, 0x3F, 0xD8,
-        0x43, 0xDE, 0xDC, 0xD6, 0x95, 0xE9, 0x01, 0xE2, 0x9B, 0xF2, 0x2C, 0xE9,
-        0xFC, 0xF6, 0x99, 0xEA, 0xFB, 0xFA, 0xD1, 0xEB, 0x47, 0xFD, 0x8D, 0xED,
-        0xE3, 0xFD, 0xF4, 0xF2, 0x64, 0xFC, 0x68, 0xF8, 0x9B, 0xF9, 0xBC, 0xFE,
-        0x45, 0xF5, 0xEE, 0xFF, 0xEC, 0xF3, 0x6F, 0xFF, 0xDB, 0xF6, 0xEB, 0xFF,
-        0x13, 0xFB, 0xB9, 0x02, 0x50, 0xFA, 0x07, 0x03, 0xA9, 0xFD, 0xBC, 0x07,
-        0xC6, 0xFC, 0x04, 0x09, 0x91, 0xFA, 0x2A, 0x05, 0x90, 0x13, 0xDD, 0x1C,
-        0x5F, 0x24, 0x3E, 0x2B, 0x00, 0x23, 0xD7, 0x27, 0xF2, 0x21, 0x3A, 0x29,
-        0x6E, 0x16, 0xC4, 0x1D, 0x60, 0x0E, 0xA4, 0x17, 0xDD, 0x0A, 0x34, 0x17,
-        0xEC, 0x06, 0x12, 0x16, 0x81, 0x04, 0x4A, 0x14, 0xD2, 0x02, 0xEB, 0x0D,
-        0x5B, 0x03, 0x76, 0x07, 0x90, 0x05, 0x91, 0x00, 0x8A, 0x0A, 0x15, 0x00,
-        0x89, 0x0C, 0x39, 0x01, 0x5D, 0x09, 0x82, 0x00, 0x8A, 0x04, 0x1F, 0xFD,
-        0x98, 0x04, 0x0D, 0xFC, 0x93, 0x01, 0xB2, 0xF7, 0x17, 0x03, 0xEF, 0xF6,
-        0x24, 0x06, 0xAA, 0xFB, 0x47, 0xED, 0x1D, 0xE4, 0x3D, 0xDC, 0x97, 0xD5,
-        0x96, 0xDD, 0x07, 0xD9, 0xEB, 0xDD, 0xE8, 0xD6, 0x96, 0xE8, 0x94, 0xE1,
-        0x97, 0xEF, 0x7D, 0xE6, 0xEA, 0xF3, 0x8B, 0xE7, 0x2B, 0xF9, 0xE2, 0xE9,
-        0xB2, 0xFB, 0xA0, 0xEB, 0x97, 0xFD, 0x1C, 0xF2, 0x9E, 0xFC, 0x39, 0xF8,
-        0x27, 0xFA, 0xF0, 0xFE, 0x70, 0xF4, 0xA7, 0xFE, 0x93, 0xF2, 0xA4, 0xFD,
-        0x0E, 0xF6, 0x88, 0xFE, 0x94, 0xFA, 0x9B, 0x01, 0xE2, 0xFA, 0xF0, 0x02,
-        0x0E, 0xFE, 0x88, 0x07, 0xA2, 0xFD, 0x6A, 0x09, 0x4C, 0xFA, 0x64, 0x04,
-        0x0F, 0x12, 0xD7, 0x1A, 0xA7, 0x22, 0xD4, 0x28, 0x90, 0x21, 0xB3, 0x25,
-        0x30, 0x22, 0xD0, 0x28, 0x84, 0x17, 0x1C, 0x1E, 0x5C, 0x10, 0x2E, 0x19,
-        0x52, 0x0B, 0x89, 0x17, 0xD6, 0x06, 0x1A, 0x16, 0x59, 0x05, 0x87, 0x15,
-        0xD8, 0x02, 0x90, 0x0E, 0x35, 0x03, 0xB9, 0x07, 0xA7, 0x05, 0xDC, 0x00,
-        0x84, 0x0C, 0x42, 0x02, 0xDB, 0x0E, 0xBD, 0x03, 0x24, 0x0C, 0xBC, 0x03,
-        0x26, 0x08, 0x4B, 0x01, 0x58, 0x07, 0x75, 0xFF, 0xDA, 0x03, 0x7F, 0xFA,
-        0x55, 0x03, 0x82, 0xF7, 0x7C, 0x06, 0x42, 0xFC, 0xFC, 0xEE, 0x0F, 0xE6,
-        0x83, 0xDE, 0x1D, 0xD8, 0xE4, 0xDF, 0x78, 0xDB, 0x9A, 0xDF, 0x97, 0xD8,
-        0xA3, 0xE9, 0xAB, 0xE2, 0xD4, 0xEF, 0xB5, 0xE6, 0x4E, 0xF5, 0xCC, 0xE8,
-        0x43, 0xFA, 0xD0, 0xEA, 0x27, 0xFC, 0xCF, 0xEB, 0x64, 0xFE, 0x79, 0xF2,
-        0xDD, 0xFC, 0x47, 0xF8, 0x47, 0xF9, 0x24, 0xFE, 0x4E, 0xF1, 0xB8, 0xFB,
-        0x2C, 0xEE, 0x68, 0xF9, 0xBD, 0xEF, 0x2B, 0xF8, 0x20, 0xF4, 0xDF, 0xFA,
-        0xF2, 0xF6, 0xA8, 0xFE, 0x3B, 0xFB, 0x76, 0x04, 0x99, 0xFB, 0x78, 0x07,
-        0x30, 0xF8, 0x74, 0x02, 0x4A, 0x0F, 0x4F, 0x18, 0x23, 0x20, 0x85, 0x26,
-        0xEA, 0x1E, 0x77, 0x23, 0x80, 0x1E, 0xA5, 0x25, 0xC5, 0x14, 0xF9, 0x1B,
-        0xB7, 0x0E, 0xF9, 0x17, 0x00, 0x09, 0x9B, 0x15, 0x7C, 0x04, 0xD8, 0x13,
-        0xA4, 0x02, 0xC3, 0x12, 0x6B, 0x00, 0x2F, 0x0C, 0xF4, 0x01, 0x3F, 0x06,
-        0x65, 0x06, 0x37, 0x01, 0x6B, 0x0F, 0x9F, 0x04, 0xB5, 0x12, 0x3D, 0x07,
-        0xDB, 0x10, 0x4E, 0x08, 0xDA, 0x0B, 0x2E, 0x05, 0x3A, 0x09, 0xB8, 0x01,
-        0x39, 0x06, 0x1A, 0xFD, 0x21, 0x06, 0x49, 0xFA, 0xF3, 0x07, 0x9D, 0xFD,
-        0xF9, 0xF0, 0x0C, 0xE8, 0xAA, 0xE0, 0x69, 0xDA, 0xC0, 0xE1, 0x6B, 0xDD,
-        0x85, 0xE2, 0x7F, 0xDB, 0x19, 0xEB, 0xEF, 0xE3, 0xF2, 0xF0, 0xA6, 0xE7,
-        0x52, 0xF6, 0x95, 0xE9, 0xEC, 0xF9, 0x78, 0xEA, 0x0D, 0xFC, 0xDF, 0xEB,
-        0xE5, 0xFE, 0x0D, 0xF3, 0x5F, 0xFE, 0x23, 0xFA, 0xDB, 0xF9, 0x4D, 0xFF,
-        0xA6, 0xF0, 0xBA, 0xFB, 0x30, 0xED, 0xF1, 0xF8, 0x87, 0xEE, 0x30, 0xF7,
-        0x85, 0xF3, 0x3C, 0xFA, 0xD5, 0xF6, 0x39, 0xFE, 0xDF, 0xF9, 0x0A, 0x03,
-        0x04, 0xF9, 0xFE, 0x04, 0xCA, 0xF6, 0x51, 0x01, 0xE0, 0x0B, 0xED, 0x14,
-        0x1C, 0x1C, 0x65, 0x22, 0x1E, 0x1C, 0x68, 0x20, 0x4D, 0x1A, 0x37, 0x21,
-        0x77, 0x12, 0x89, 0x19, 0x0E, 0x0E, 0x48, 0x17, 0xA2, 0x0A, 0x92, 0x17,
-        0x78, 0x07, 0x53, 0x17, 0x47, 0x03, 0x07, 0x14, 0x9C, 0xFF, 0x41, 0x0C,
-        0x7D, 0x00, 0x67, 0x05, 0xC1, 0x05, 0xE5, 0x00, 0xBF, 0x0D, 0x29, 0x03,
-        0x68, 0x0F, 0x19, 0x04, 0x80, 0x0D, 0x44, 0x05, 0xBC, 0x08, 0x5E, 0x02,
-        0xBB, 0x05, 0xA7, 0xFE, 0x0D, 0x04, 0x05, 0xFB, 0x6B, 0x06, 0x7B, 0xFA,
-        0x6C, 0x08, 0xD9, 0xFD, 0x45, 0xF5, 0x0E, 0xEC, 0x05, 0xE6, 0x90, 0xDF,
-        0xA4, 0xE5, 0x21, 0xE1, 0xA2, 0xE7, 0xA8, 0xE0, 0x6C, 0xED, 0x70, 0xE6,
-        0xC0, 0xF1, 0xC4, 0xE8, 0x6F, 0xF6, 0xBF, 0xE9, 0x8C, 0xFA, 0xE0, 0xEA,
-        0x2F, 0xFE, 0x8D, 0xED, 0x79, 0xFF, 0xD9, 0xF2, 0xBE, 0xFD, 0xD8, 0xF8,
-        0xEC, 0xF8, 0xD6, 0xFD, 0x39, 0xF2, 0xD4, 0xFC, 0x21, 0xF1, 0x92, 0xFC,
-        0xBD, 0xF3, 0x21, 0xFC, 0xA1, 0xF9, 0x58, 0x00, 0x0C, 0xFD, 0x78, 0x04,
-        0x57, 0xFD, 0xB6, 0x06, 0x36, 0xFA, 0x6A, 0x06, 0x92, 0xF8, 0x4A, 0x03,
-        0x4F, 0x06, 0x9E, 0x0F, 0x1E, 0x0F, 0xAC, 0x15, 0x16, 0x0C, 0xBF, 0x10,
-        0xA9, 0x09, 0xB8, 0x10, 0xAF, 0x06, 0xC2, 0x0D, 0xE7, 0x02, 0xF8, 0x0B,
-        0x61, 0xFE, 0x23, 0x0B, 0x32, 0xFC, 0xF6, 0x0B, 0xED, 0xFB, 0x8F, 0x0C,
-        0xD7, 0xFD, 0x75, 0x0A, 0xF3, 0x00, 0xC9, 0x05, 0xFA, 0x05, 0x18, 0x01,
-        0x8F, 0x0B, 0xFB, 0x00, 0x6A, 0x0B, 0x0C, 0x00, 0x6C, 0x08, 0xFD, 0xFF,
-        0x4E, 0x04, 0x6B, 0xFD, 0x3E, 0x03, 0xA2, 0xFB, 0x93, 0x04, 0x0F, 0xFB,
-        0xF4, 0x07, 0xAD, 0xFB, 0x1F, 0x0C, 0x7B, 0x01, 0x19, 0x08, 0xFE, 0xFE,
-        0x5D, 0x05, 0x0B, 0xFF, 0x56, 0x06, 0xED, 0x01, 0xE8, 0x03, 0x13, 0xFD,
-        0x2D, 0x03, 0x1E, 0xFC, 0x88, 0x06, 0x36, 0xFD, 0x8B, 0x09, 0x4D, 0xFC,
-        0x76, 0x08, 0x19, 0xF8, 0x64, 0x06, 0x45, 0xF5, 0x41, 0x04, 0x4D, 0xF7,
-        0x94, 0x01, 0xA9, 0xFC, 0xD3, 0xFC, 0xAF, 0x01, 0xFB, 0xF7, 0x99, 0x02,
-        0x5A, 0xF8, 0xC3, 0x03, 0xAF, 0xFA, 0x2C, 0x03, 0xC2, 0xFC, 0xC8, 0x03,
-        0x30, 0xFD, 0xCD, 0x04, 0x4C, 0xFC, 0xCD, 0x05, 0x59, 0xFA, 0x89, 0x06,
-        0xEE, 0xF6, 0x66, 0x01, 0x21, 0xF8, 0x01, 0x01, 0x0C, 0xFB, 0x11, 0x01,
-        0x8B, 0xFC, 0x91, 0x00, 0x37, 0xFF, 0x7E, 0x05, 0x4D, 0xFF, 0xDF, 0x05,
-        0x60, 0xFB, 0x68, 0x04, 0xC1, 0xF8, 0xDC, 0x05, 0xD4, 0xF9, 0x4B, 0x0A,
-        0xA5, 0xFB, 0xD5, 0x0C, 0x27, 0xFE, 0x35, 0x0B, 0xA8, 0x01, 0x72, 0x06,
-        0x99, 0x05, 0x98, 0x00, 0x1B, 0x09, 0x44, 0xFE, 0x41, 0x09, 0xA1, 0xFD,
-        0x18, 0x08, 0x70, 0xFF, 0xB8, 0x06, 0x89, 0xFF, 0x00, 0x05, 0x79, 0xFD,
-        0x7C, 0x05, 0x0A, 0xFC, 0xA4, 0x07, 0x90, 0xFB, 0xC7, 0x0A, 0x5E, 0x00,
-        0xC2, 0x0A, 0xC6, 0x01, 0xA4, 0x07, 0x74, 0x01, 0x4A, 0x06, 0x09, 0x02,
-        0x76, 0x05, 0x2A, 0xFF, 0xE7, 0x05, 0x55, 0xFF, 0xB1, 0x08, 0xD5, 0xFF,
-        0x7A, 0x0A, 0x84, 0xFD, 0xD3, 0x09, 0x87, 0xF9, 0xD0, 0x08, 0xC7, 0xF7,
-        0xA1, 0x06, 0xAC, 0xF9, 0x93, 0x02, 0xF3, 0xFD, 0x41, 0xFE, 0x6F, 0x03,
-        0xC1, 0xF9, 0xC9, 0x04, 0x11, 0xF9, 0xFA, 0x04, 0xAA, 0xFB, 0x9A, 0x04,
-        0x62, 0xFE, 0xD2, 0x05, 0x1A, 0x00, 0xBD, 0x07, 0xB5, 0xFD, 0x2A, 0x07,
-        0x05, 0xFB, 0x12, 0x07, 0x98, 0xF9, 0xE7, 0x03, 0x9D, 0xF9, 0xA3, 0x02,
-        0x17, 0xFC, 0x62, 0x02, 0xF7, 0xFC, 0x72, 0x01, 0xFA, 0xFD, 0x73, 0x04,
-        0xD9, 0xFE, 0x8E, 0x05, 0xA4, 0xFC, 0x8E, 0x05, 0x5F, 0xF9, 0x37, 0x06,
-        0x20, 0xF8, 0x42, 0x08, 0xAC, 0xF8, 0x72, 0x09, 0x60, 0xFB, 0x19, 0x08,
-        0x2E, 0x00, 0x94, 0x04, 0x58, 0x04, 0x00, 0xFF, 0xEE, 0x08, 0xD4, 0xFD,
-        0xBB, 0x09, 0xBA, 0xFD, 0x7C, 0x06, 0x7F, 0xFD, 0xB2, 0x03, 0x19, 0xFC,
-        0x01, 0x02, 0x3A, 0xFA, 0xE1, 0x04, 0x35, 0xFB, 0x6F, 0x07, 0x2C, 0xFB,
-        0x73, 0x08, 0xFD, 0xFD, 0x12, 0x09, 0xE7, 0xFF, 0xBE, 0x06, 0x50, 0x00,
-        0x35, 0x05, 0x93, 0x00, 0xF4, 0x03, 0x54, 0xFD, 0xBA, 0x02, 0xE3, 0xFB,
-        0x02, 0x04, 0xE9, 0xFA, 0xD0, 0x06, 0xD4, 0xF9, 0x23, 0x08, 0xDF, 0xF7,
-        0x20, 0x08, 0x52, 0xF7, 0x56, 0x06, 0x94, 0xF9, 0x24, 0x02, 0xDB, 0xFD,
-        0xBE, 0xFE, 0x21, 0x04, 0x25, 0xFA, 0x3F, 0x05, 0xCF, 0xF8, 0xC8, 0x04,
-        0x48, 0xFB, 0x39, 0x04, 0x06, 0xFD, 0xB6, 0x04, 0x9E, 0xFE, 0xA2, 0x06,
-        0x3A, 0xFC, 0x51, 0x06, 0x2D, 0xFA, 0xFC, 0x06, 0xF6, 0xF8, 0xE0, 0x03,
-        0x4F, 0xF7, 0xE5, 0x00, 0x41, 0xF9, 0xE0, 0xFF, 0x85, 0xFB, 0x54, 0x00,
-        0x8E, 0xFD, 0x2B, 0x04, 0xD1, 0xFE, 0xA3, 0x05, 0x56, 0xFD, 0x7C, 0x06,
-        0x22, 0xFA, 0x38, 0x07, 0xD4, 0xF8, 0x59, 0x09, 0xCD, 0xF8, 0xF7, 0x09,
-        0xFD, 0xF9, 0x26, 0x07, 0x35, 0xFD, 0xDD, 0x01, 0x2D, 0x00, 0x1E, 0xFB,
-        0x9C, 0x05, 0xDA, 0xFA, 0xE2, 0x07, 0x34, 0xFC, 0x71, 0x05, 0xCC, 0xFC,
-        0x08, 0x03, 0x7E, 0xFB, 0x00, 0x01, 0x00, 0xF9, 0x60, 0x03, 0x19, 0xF9,
-        0xE4, 0x05, 0xD9, 0xF8, 0x56, 0x07, 0x2C, 0xFC, 0x09, 0x08, 0x5D, 0xFE,
-        0x03, 0x05, 0x4F, 0xFE, 0xFA, 0x01, 0x31, 0xFD, 0x7C, 0x00, 0xFA, 0xF9,
-        0x23, 0x00, 0x92, 0xF9, 0xCE, 0x01, 0x02, 0xF9, 0x9E, 0x04, 0xF3, 0xF7,
-        0x9E, 0x05, 0x79, 0xF5, 0x00, 0x06, 0xFB, 0xF4, 0xE2, 0x04, 0xBD, 0xF7,
-        0x2B, 0x01, 0x68, 0xFC, 0x3D, 0xFD, 0x30, 0x02, 0x98, 0xF7, 0x54, 0x02,
-        0x05, 0xF6, 0xB3, 0x01, 0x9C, 0xF8, 0x46, 0x01, 0x70, 0xFA, 0x07, 0x02,
-        0xD7, 0xFB, 0xEB, 0x03, 0xFD, 0xF9, 0x61, 0x04, 0xFD, 0xF7, 0x29, 0x05,
-        0xF3, 0xF6, 0x28, 0x02, 0xBE, 0xF6, 0x5B, 0x00, 0xC8, 0xF9, 0x67, 0x00,
-        0x9B, 0xFC, 0x5A, 0x01, 0x70, 0xFD, 0xDB, 0x03, 0x15, 0xFD, 0x93, 0x03,
-        0x7F, 0xFB, 0x10, 0x04, 0x63, 0xF9, 0xB9, 0x05, 0x7F, 0xF8, 0x5F, 0x08,
-        0xA6, 0xF7, 0x8F, 0x08, 0x9B, 0xF8, 0xE6, 0x05, 0x63, 0xFC, 0x73, 0x01,
-        0xFA, 0x00, 0x5E, 0xFC, 0xCF, 0x06, 0x43, 0xFC, 0x42, 0x08, 0xC1, 0xFC,
-        0x6B, 0x05, 0xF4, 0xFC, 0x17, 0x03, 0xC4, 0xFB, 0x1B, 0x01, 0x68, 0xF9,
-        0x47, 0x02, 0x42, 0xF8, 0x99, 0x04, 0xCB, 0xF7, 0xCF, 0x05, 0x0A, 0xFB,
-        0x97, 0x05, 0x8F, 0xFC, 0xE0, 0x02, 0xF1, 0xFC, 0xA1, 0x00, 0x9B, 0xFC,
-        0xA0, 0xFF, 0xEA, 0xF9, 0x4B, 0xFF, 0x65, 0xF9, 0xA2, 0x00, 0xA5, 0xF8,
-        0xDF, 0x02, 0x1A, 0xF7, 0x78, 0x04, 0x05, 0xF5, 0x89, 0x05, 0xEA, 0xF4,
-        0x4E, 0x04, 0xFC, 0xF6, 0x84, 0x00, 0x39, 0xFB, 0xFE, 0xFB, 0x40, 0x00,
-        0x5F, 0xF6, 0xB1, 0x00, 0xA0, 0xF4, 0xEF, 0xFF, 0x3C, 0xF7, 0x85, 0xFF,
-        0xD1, 0xF9, 0xF5, 0x00, 0x01, 0xFC, 0x68, 0x03, 0xC4, 0xFA, 0x95, 0x04,
-        0xBA, 0xF7, 0x61, 0x04, 0x4E, 0xF6, 0x00, 0x01, 0x57, 0xF7, 0x30, 0x00,
-        0x7B, 0xFA, 0x27, 0x00, 0xBE, 0xFC, 0x79, 0x00, 0xA7, 0xFD, 0x1C, 0x03,
-        0x26, 0xFD, 0x0C, 0x03, 0xE2, 0xFA, 0xE8, 0x02, 0xEA, 0xF8, 0xCC, 0x04,
-        0x5F, 0xF8, 0xD4, 0x07, 0x01, 0xF8, 0x9C, 0x08, 0x02, 0xF9, 0x4C, 0x06,
-        0x03, 0xFC, 0x71, 0x01, 0x4C, 0x00, 0x3F, 0xFC, 0x14, 0x06, 0xE5, 0xFB,
-        0xF3, 0x07, 0xC7, 0xFC, 0x40, 0x05, 0xF6, 0xFC, 0x6F, 0x02, 0x4F, 0xFB,
-        0x96, 0x00, 0x47, 0xF9, 0x18, 0x02, 0x69, 0xF8, 0x64, 0x05, 0xF9, 0xF8,
-        0xAB, 0x06, 0x42, 0xFC, 0x33, 0x05, 0xC0, 0xFC, 0x55, 0x02, 0x32, 0xFD,
-        0xA2, 0x00, 0x69, 0xFD, 0xFB, 0xFF, 0xE7, 0xFA, 0xB4, 0x00, 0xEB, 0xFA,
-        0x0F, 0x03, 0xDE, 0xFA, 0x43, 0x04, 0x24, 0xF8, 0x39, 0x04, 0x7C, 0xF4,
-        0x8D, 0x04, 0xE9, 0xF3, 0xA4, 0x03, 0x61, 0xF6, 0xA1, 0x00, 0x44, 0xFB,
-        0x2C, 0xFC, 0x3F, 0x00, 0xA8, 0xF6, 0xE1, 0x00, 0xF4, 0xF4, 0x3B, 0x00,
-        0xBA, 0xF7, 0x1C, 0x00, 0xC5, 0xFA, 0xFE, 0x01, 0xD5, 0xFC, 0x0C, 0x04,
-        0x54, 0xFB, 0xAB, 0x04, 0xAF, 0xF7, 0x7D, 0x03, 0x1E, 0xF6, 0xC5, 0xFF,
-        0xE3, 0xF7, 0x8C, 0xFF, 0x0A, 0xFB, 0x68, 0xFF, 0xCA, 0xFC, 0x61, 0xFF,
-        0x8D, 0xFD, 0x20, 0x02, 0xD6, 0xFC, 0x55, 0x02, 0x68, 0xFA, 0x6D, 0x02,
-        0xFD, 0xF8, 0x1C, 0x05, 0xA6, 0xF8, 0x6B, 0x08, 0x8A, 0xF8, 0x25, 0x09,
-        0x7E, 0xFA, 0x93, 0x07, 0x6D, 0xFE, 0x8A, 0x03, 0x21, 0x03, 0xBB, 0xFE,
-        0x3D, 0x08, 0x96, 0xFD, 0x8D, 0x09, 0xCF, 0xFD, 0xE0, 0x06, 0xFB, 0xFD,
-        0xFD, 0x03, 0x3A, 0xFC, 0x1F, 0x02, 0x65, 0xFA, 0xAC, 0x03, 0xEE, 0xF9,
-        0x23, 0x07, 0x15, 0xFB, 0x4C, 0x08, 0x6E, 0xFE, 0x3F, 0x06, 0x55, 0xFE,
-        0x37, 0x03, 0x9A, 0xFE, 0xB3, 0x01, 0xD5, 0xFE, 0xBC, 0x00, 0xF5, 0xFB,
-        0x87, 0x01, 0xF7, 0xFB, 0x77, 0x04, 0x74, 0xFC, 0x03, 0x06, 0xD8, 0xF9,
-        0x57, 0x06, 0x5E, 0xF6, 0x3E, 0x06, 0x55, 0xF5, 0x16, 0x04, 0xB7, 0xF6,
-        0x46, 0x00, 0xE4, 0xFA, 0xB4, 0xFB, 0xED, 0xFF, 0x90, 0xF6, 0x10, 0x01,
-        0xE8, 0xF4, 0x66, 0x00, 0x5B, 0xF7, 0xE4, 0xFF, 0x18, 0xFA, 0x71, 0x01,
-        0xEC, 0xFB, 0x5D, 0x03, 0xB3, 0xFA, 0x3A, 0x04, 0xE0, 0xF7, 0xD5, 0x03,
-        0xE6, 0xF6, 0xB8, 0x00, 0xE6, 0xF8, 0xD5, 0x00, 0x2E, 0xFC, 0xBC, 0x00,
-        0xA7, 0xFD, 0x68, 0x00, 0x7E, 0xFE, 0x13, 0x03, 0xC9, 0xFD, 0xF5, 0x02,
-        0x10, 0xFB, 0xA2, 0x02, 0x7C, 0xF9, 0x38, 0x05, 0xC5, 0xF8, 0x97, 0x08,
-        0xCE, 0xF8, 0xB5, 0x09, 0xDF, 0xFA, 0x52, 0x08, 0xDF, 0xFE, 0x5B, 0x04,
-        0x15, 0x04, 0xCF, 0xFF, 0xDE, 0x09, 0x3F, 0xFF, 0x9D, 0x0B, 0x0B, 0x00,
-        0xDF, 0x08, 0x64, 0x00, 0xE6, 0x05, 0xB6, 0xFE, 0x34, 0x04, 0xDB, 0xFC,
-        0xD1, 0x05, 0x55, 0xFC, 0xD1, 0x08, 0xE5, 0xFC, 0xB1, 0x09, 0xE7, 0xFF,
-        0x52, 0x07, 0x80, 0xFF, 0xBD, 0x03, 0x47, 0xFF, 0x5E, 0x02, 0x9E, 0xFF,
-        0xE2, 0x01, 0x1A, 0xFD, 0xE7, 0x02, 0x63, 0xFD, 0xC6, 0x05, 0xE6, 0xFD,
-        0x7D, 0x07, 0x78, 0xFB, 0x32, 0x08, 0x1D, 0xF8, 0x20, 0x08, 0xF1, 0xF6,
-        0x06, 0x06, 0x4D, 0xF8, 0xE5, 0x01, 0x17, 0xFC, 0xA7, 0xFC, 0x96, 0x00,
-        0x0B, 0xF7, 0x7C, 0x01, 0x81, 0xF5, 0xD7, 0x00, 0x5D, 0xF8, 0x9E, 0x00,
-        0xFC, 0xFA, 0xEF, 0x01, 0x05, 0xFC, 0x37, 0x03, 0x34, 0xFA, 0xA1, 0x03,
-        0xAA, 0xF7, 0x7D, 0x03, 0x35, 0xF7, 0xF3, 0x00, 0x96, 0xF9, 0x40, 0x01,
-        0x4C, 0xFD, 0xAA, 0x01, 0x96, 0xFE, 0x5F, 0x01, 0xB9, 0xFE, 0xD7, 0x03,
-        0xE0, 0xFD, 0xF2, 0x03, 0x1B, 0xFB, 0x95, 0x03, 0x61, 0xF9, 0xE0, 0x05,
-        0x35, 0xF9, 0xA5, 0x09, 0xDE, 0xF9, 0x53, 0x0B, 0xC1, 0xFB, 0xA3, 0x09,
-        0x3F, 0xFF, 0x58, 0x05, 0x32, 0x04, 0x85, 0x00, 0xD7, 0x09, 0x88, 0xFF,
-        0xB6, 0x0B, 0x61, 0x00, 0x0D, 0x09, 0xC2, 0x00, 0x8B, 0x06, 0x8C, 0xFF,
-        0x71, 0x05, 0x2A, 0xFE, 0x02, 0x07, 0x98, 0xFD, 0x98, 0x09, 0xCB, 0xFD,
-        0x53, 0x0A, 0x97, 0x00, 0xB3, 0x08, 0x09, 0x01, 0xF4, 0x04, 0xA9, 0x00,
-        0x28, 0x03, 0x6E, 0x00, 0xD0, 0x02, 0xD3, 0xFD, 0x75, 0x03, 0x77, 0xFD,
-        0x49, 0x06, 0xF8, 0xFD, 0x41, 0x08, 0xF5, 0xFB, 0x66, 0x08, 0x1D, 0xF8,
-        0x80, 0x07, 0x22, 0xF6, 0xC0, 0x05, 0xE3, 0xF7, 0x89, 0x02, 0x48, 0xFC,
-        0xD7, 0xFD, 0x48, 0x01, 0x53, 0xF8, 0x9B, 0x02, 0x4C, 0xF6, 0xBC, 0x01,
-        0xC7, 0xF8, 0x56, 0x01, 0x23, 0xFB, 0x67, 0x02, 0xAA, 0xFC, 0x27, 0x04,
-        0x55, 0xFB, 0xD7, 0x04, 0x72, 0xF8, 0x34, 0x04, 0x60, 0xF7, 0x2F, 0x01,
-        0xEA, 0xF8, 0xA7, 0x00, 0x62, 0xFD, 0xC9, 0x01, 0x9C, 0xFF, 0x58, 0x02,
-        0x9B, 0xFF, 0x85, 0x04, 0x8E, 0xFE, 0x77, 0x04, 0x98, 0xFB, 0xC8, 0x03,
-        0x76, 0xF9, 0xB6, 0x05, 0x7F, 0xF9, 0xC4, 0x09, 0xC6, 0xFA, 0x2C, 0x0C,
-        0x70, 0xFC, 0x3F, 0x0A, 0x6F, 0xFF, 0xC4, 0x05, 0xEE, 0x03, 0x8D, 0x00,
-        0x73, 0x09, 0x3F, 0xFF, 0x9A, 0x0B, 0x2B, 0x00, 0x1C, 0x09, 0x81, 0x00,
-        0xE5, 0x06, 0x8D, 0xFF, 0x5E, 0x05, 0xC9, 0xFD, 0xE9, 0x06, 0x4F, 0xFD,
-        0x9D, 0x09, 0xC9, 0xFD, 0x68, 0x0A, 0x79, 0x00, 0xFA, 0x08, 0xF4, 0x00,
-        0xDF, 0x04, 0x3D, 0x00, 0x08, 0x03, 0x0C, 0x00, 0xF0, 0x02, 0xCD, 0xFD,
-        0x8D, 0x03, 0x64, 0xFD, 0x0B, 0x06, 0x98, 0xFD, 0x50, 0x08, 0xC9, 0xFB,
-        0x7E, 0x08, 0xF6, 0xF7, 0x42, 0x07, 0xDA, 0xF5, 0xD1, 0x05, 0x22, 0xF8,
-        0xF8, 0x02, 0xE3, 0xFC, 0xB0, 0xFE, 0x43, 0x02, 0x17, 0xF9, 0x76, 0x03,
-        0xB5, 0xF6, 0x49, 0x02, 0xD7, 0xF8, 0xAF, 0x01, 0xAE, 0xFA, 0x51, 0x02,
-        0xF1, 0xFB, 0xEB, 0x03, 0x9D, 0xFA, 0x9B, 0x04, 0x65, 0xF8, 0x74, 0x04,
-        0x75, 0xF7, 0xA0, 0x01, 0xC4, 0xF8, 0x01, 0x01, 0xD7, 0xFC, 0xBA, 0x01,
-        0xD7, 0xFE, 0x16, 0x02, 0x0B, 0xFF, 0x86, 0x04, 0x50, 0xFE, 0xD8, 0x04,
-        0xA1, 0xFB, 0x70, 0x04, 0x0D, 0xF9, 0xD8, 0x05, 0xCB, 0xF8, 0x80, 0x09,
-        0x23, 0xFA, 0x87, 0x0B, 0x88, 0xFB, 0x16, 0x09, 0x89, 0xFE, 0x93, 0x04,
-        0xFC, 0x02, 0x74, 0xFF, 0x5E, 0x08, 0x28, 0xFE, 0xB0, 0x0A, 0x37, 0xFF,
-        0xF0, 0x08, 0x09, 0x00, 0x71, 0x07, 0x86, 0xFF, 0x70, 0x06, 0x07, 0xFE,
-        0x86, 0x07, 0x14, 0xFD, 0x40, 0x09, 0xD6, 0xFC, 0x1A, 0x0A, 0xA8, 0xFF,
-        0xDE, 0x08, 0x4B, 0x00, 0xAE, 0x04, 0x72, 0xFF, 0x6C, 0x02, 0xC5, 0xFE,
-        0x53, 0x02, 0x65, 0xFC, 0x98, 0x03, 0xB0, 0xFC, 0x73, 0x06, 0x55, 0xFD,
-        0x03, 0x09, 0x0F, 0xFC, 0x0C, 0x09, 0x3E, 0xF8, 0x25, 0x07, 0xC8, 0xF5,
-        0xBE, 0x05, 0x44, 0xF8, 0x4B, 0x03, 0x3D, 0xFD, 0xD5, 0xFE, 0x52, 0x02,
-        0x1D, 0xF9, 0x3E, 0x03, 0x4C, 0xF6, 0xC8, 0x01, 0xC9, 0xF7, 0xDC, 0x00,
-        0x8C, 0xF9, 0xC0, 0x01, 0xE7, 0xFA, 0xB8, 0x03, 0xF9, 0xF9, 0xB9, 0x04,
-        0x0F, 0xF8, 0xBA, 0x04, 0x26, 0xF7, 0xD2, 0x01, 0x67, 0xF8, 0x40, 0x01,
-        0x6E, 0xFC, 0x00, 0x02, 0xA0, 0xFE, 0x90, 0x02, 0xAA, 0xFE, 0xC6, 0x04,
-        0x37, 0xFD, 0x2C, 0x04, 0x9C, 0xFA, 0xA9, 0x03, 0x9A, 0xF8, 0x7A, 0x05,
-        0x7C, 0xF8, 0x46, 0x09, 0x00, 0xFA, 0x60, 0x0B, 0xFC, 0xFA, 0x6B, 0x08,
-        0x7A, 0xFD, 0x84, 0x03, 0x51, 0x02, 0xAF, 0xFE, 0x12, 0x08, 0xCC, 0xFD,
-        0xBB, 0x0A, 0x1D, 0xFF, 0x1A, 0x09, 0xE6, 0xFF, 0xF2, 0x06, 0xBC, 0xFE,
-        0x5F, 0x05, 0x9D, 0xFC, 0x50, 0x06, 0xCD, 0xFB, 0x0C, 0x08, 0xC0, 0xFB,
-        0xFA, 0x08, 0xB8, 0xFE, 0xD9, 0x07, 0x64, 0xFF, 0x11, 0x04, 0xCD, 0xFE,
-        0x21, 0x02, 0x7F, 0xFE, 0x0F, 0x02, 0x33, 0xFC, 0x61, 0x03, 0xB7, 0xFC,
-        0xB3, 0x05, 0xDB, 0xFC, 0x94, 0x07, 0xC5, 0xFA, 0xC0, 0x07, 0xDC, 0xF6,
-        0x33, 0x06, 0xAB, 0xF4, 0xED, 0x04, 0x74, 0xF7, 0x68, 0x02, 0x70, 0xFC,
-        0xBA, 0xFD, 0xA9, 0x01, 0x33, 0xF8, 0xD1, 0x02, 0xBD, 0xF5, 0x93, 0x01,
-        0x05, 0xF7, 0x62, 0x00, 0x3B, 0xF9, 0x6A, 0x01, 0x99, 0xFA, 0x4D, 0x03,
-        0xB8, 0xF9, 0x14, 0x04, 0x5B, 0xF8, 0x73, 0x04, 0xE2, 0xF7, 0xDE, 0x01,
-        0x1F, 0xF9, 0x55, 0x01, 0x73, 0xFC, 0x8A, 0x01, 0x0D, 0xFE, 0x91, 0x01,
-        0x01, 0xFE, 0xE9, 0x03, 0xDF, 0xFC, 0x86, 0x03, 0x7D, 0xFA, 0x60, 0x03,
-        0x84, 0xF8, 0x68, 0x05, 0x0B, 0xF8, 0x1E, 0x09, 0x9E, 0xF9, 0x5B, 0x0B,
-        0x73, 0xFB, 0x2B, 0x09, 0xB7, 0xFD, 0xEB, 0x03, 0xE9, 0x01, 0x15, 0xFE,
-        0x1D, 0x07, 0xB8, 0xFC, 0xD1, 0x09, 0x49, 0xFE, 0xCF, 0x08, 0xE5, 0xFF,
-        0x9D, 0x06, 0xEF, 0xFE, 0x1C, 0x05, 0xE0, 0xFC, 0xC1, 0x05, 0xC5, 0xFB,
-        0xDE, 0x06, 0x2C, 0xFB, 0x5B, 0x07, 0xB8, 0xFD, 0x43, 0x06, 0x66, 0xFE,
-        0x04, 0x03, 0x3A, 0xFE, 0x44, 0x01, 0xD7, 0xFD, 0x04, 0x01, 0x22, 0xFB,
-        0x20, 0x02, 0x74, 0xFB, 0xD4, 0x04, 0x0B, 0xFC, 0xB3, 0x06, 0xF7, 0xF9,
-        0x12, 0x07, 0x34, 0xF6, 0x82, 0x05, 0xE3, 0xF3, 0xCC, 0x03, 0x1B, 0xF6,
-        0xE5, 0x01, 0xA0, 0xFB, 0x98, 0xFD, 0x7A, 0x01, 0x45, 0xF8, 0xC3, 0x02,
-        0x97, 0xF5, 0x3C, 0x01, 0xBC, 0xF6, 0xC4, 0xFF, 0xFF, 0xF8, 0xB8, 0x00,
-        0x63, 0xFA, 0xAF, 0x02, 0xC0, 0xF9, 0xB9, 0x03, 0x8B, 0xF8, 0x3B, 0x04,
-        0x17, 0xF8, 0xA1, 0x01, 0x35, 0xF9, 0xEE, 0x00, 0xAC, 0xFC, 0x50, 0x01,
-        0x65, 0xFE, 0xD0, 0x01, 0x55, 0xFE, 0x51, 0x04, 0x08, 0xFD, 0xE0, 0x03,
-        0x67, 0xFA, 0x64, 0x03, 0xE1, 0xF8, 0xC5, 0x05, 0x78, 0xF8, 0x98, 0x09,
-        0xB2, 0xF9, 0xB3, 0x0B, 0x47, 0xFB, 0x89, 0x09, 0x5B, 0xFD, 0x47, 0x04,
-        0xB5, 0x01, 0x5B, 0xFE, 0xF6, 0x06, 0xC8, 0xFC, 0xA8, 0x09, 0x1E, 0xFE,
-        0x63, 0x08, 0x51, 0xFF, 0x22, 0x06, 0x46, 0xFE, 0xF0, 0x04, 0x7B, 0xFC,
-        0xBB, 0x05, 0x91, 0xFB, 0xB8, 0x06, 0xD5, 0xFA, 0x2F, 0x07, 0x61, 0xFD,
-        0xFB, 0x05, 0x05, 0xFE, 0x5D, 0x02, 0x7B, 0xFD, 0x01, 0x01, 0x48, 0xFD,
-        0x48, 0x01, 0xF5, 0xFA, 0x43, 0x02, 0x05, 0xFB, 0x8D, 0x04, 0x20, 0xFB,
-        0x5C, 0x06, 0x19, 0xF9, 0x96, 0x06, 0x20, 0xF5, 0x3B, 0x05, 0xEF, 0xF2,
-        0xE0, 0x03, 0x52, 0xF5, 0xB6, 0x01, 0x74, 0xFA, 0x3C, 0xFD, 0x4D, 0x00,
-        0xED, 0xF7, 0xE3, 0x01, 0x83, 0xF5, 0xF4, 0x00, 0xC4, 0xF6, 0xC9, 0xFF,
-        0xE3, 0xF8, 0xCD, 0x00, 0xE8, 0xF9, 0x89, 0x02, 0x27, 0xF9, 0x88, 0x03,
-        0x26, 0xF8, 0x6C, 0x04, 0x97, 0xF7, 0xD9, 0x01, 0xB9, 0xF8, 0x1E, 0x01,
-        0x32, 0xFC, 0x57, 0x01, 0xB8, 0xFD, 0x91, 0x01, 0x86, 0xFD, 0xEB, 0x03,
-        0xAB, 0xFC, 0xE5, 0x03, 0x6F, 0xFA, 0xEA, 0x03, 0xA1, 0xF8, 0xDC, 0x05,
-        0x98, 0xF8, 0xF2, 0x09, 0xF3, 0xF9, 0xF7, 0x0B, 0x7B, 0xFB, 0xA1, 0x09,
-        0xA4, 0xFD, 0x81, 0x04, 0x03, 0x02, 0x86, 0xFE, 0x23, 0x07, 0xD3, 0xFC,
-        0x91, 0x09, 0xC7, 0xFD, 0x54, 0x08, 0x07, 0xFF, 0x36, 0x06, 0x18, 0xFE,
-        0x2A, 0x05, 0x4A, 0xFC, 0xFA, 0x05, 0x4E, 0xFB, 0x46, 0x07, 0xB0, 0xFA,
-        0x09, 0x08, 0x4F, 0xFD, 0xE9, 0x06, 0x0A, 0xFE, 0x85, 0x03, 0xF9, 0xFD,
-        0xF0, 0x01, 0xC2, 0xFD, 0x08, 0x02, 0x57, 0xFB, 0xCF, 0x02, 0x46, 0xFB,
-        0x0E, 0x05, 0x3F, 0xFB, 0xC4, 0x06, 0x25, 0xF9, 0xD5, 0x06, 0x29, 0xF5,
-        0x78, 0x05, 0x1B, 0xF3, 0x07, 0x04, 0x7E, 0xF5, 0xEC, 0x01, 0xB3, 0xFA,
-        0x8B, 0xFD, 0x98, 0x00, 0x3B, 0xF8, 0x1B, 0x02, 0xAC, 0xF5, 0x0C, 0x01,
-        0xDA, 0xF6, 0xD8, 0xFF, 0xEC, 0xF8, 0xC9, 0x00, 0xE6, 0xF9, 0xAC, 0x02,
-        0x04, 0xF9, 0xB1, 0x03, 0xB0, 0xF7, 0x46, 0x04, 0x05, 0xF7, 0xCF, 0x01,
-        0x3C, 0xF8, 0x23, 0x01, 0x9D, 0xFB, 0x23, 0x01, 0x04, 0xFD, 0x2D, 0x01,
-        0xE6, 0xFC, 0x8E, 0x03, 0x2F, 0xFC, 0x9D, 0x03, 0x04, 0xFA, 0xC1, 0x03,
-        0x6B, 0xF8, 0xFB, 0x05, 0x5D, 0xF8, 0x1F, 0x0A, 0xAF, 0xF9, 0x2D, 0x0C,
-        0x07, 0xFB, 0xBB, 0x09, 0x2C, 0xFD, 0x70, 0x04, 0xB9, 0x01, 0xA7, 0xFE,
-        0x0F, 0x07, 0x1C, 0xFD, 0xB0, 0x09, 0x21, 0xFE, 0x86, 0x08, 0x38, 0xFF,
-        0x73, 0x06, 0x3D, 0xFE, 0xA7, 0x05, 0x53, 0xFC, 0xA1, 0x06, 0x4B, 0xFB,
-        0xD1, 0x07, 0xB3, 0xFA, 0x52, 0x08, 0x16, 0xFD, 0x09, 0x07, 0xDF, 0xFD,
-        0x98, 0x03, 0xDB, 0xFD, 0x26, 0x02, 0xEE, 0xFD, 0x42, 0x02, 0xB9, 0xFB,
-        0x04, 0x03, 0xA9, 0xFB, 0x2B, 0x05, 0x87, 0xFB, 0xD1, 0x06, 0x2E, 0xF9,
-        0x29, 0x07, 0x1F, 0xF5, 0x11, 0x06, 0x0A, 0xF3, 0xD6, 0x04, 0xAB, 0xF5,
-        0x94, 0x02, 0x09, 0xFB, 0xEE, 0xFD, 0xEA, 0x00, 0x78, 0xF8, 0x81, 0x02,
-        0xD2, 0xF5, 0x83, 0x01, 0x02, 0xF7, 0x61, 0x00, 0x10, 0xF9, 0x5E, 0x01,
-        0xEF, 0xF9, 0x3F, 0x03, 0x0D, 0xF9, 0x5A, 0x04, 0xE4, 0xF7, 0xEF, 0x04,
-        0x56, 0xF7, 0x7D, 0x02, 0xA2, 0xF8, 0xB6, 0x01, 0xED, 0xFB, 0xA8, 0x01,
-        0x58, 0xFD, 0x95, 0x01, 0x39, 0xFD, 0xB1, 0x03, 0x8C, 0xFC, 0xE9, 0x03,
-        0x77, 0xFA, 0x10, 0x04, 0xD7, 0xF8, 0x83, 0x06, 0x73, 0xF8, 0xC6, 0x0A,
-        0x55, 0xF9, 0xCE, 0x0C, 0xB0, 0xFA, 0x36, 0x0A, 0xEB, 0xFC, 0xD9, 0x04,
-        0x8C, 0x01, 0xF1, 0xFE, 0x00, 0x07, 0x2F, 0xFD, 0x93, 0x09, 0x28, 0xFE,
-        0x71, 0x08, 0x6B, 0xFF, 0x6C, 0x06, 0x83, 0xFE, 0x77, 0x05, 0x8F, 0xFC,
-        0x45, 0x06, 0x5F, 0xFB, 0x96, 0x07, 0xDF, 0xFA, 0x1D, 0x08, 0x40, 0xFD,
-        0xF3, 0x06, 0x24, 0xFE, 0xAD, 0x03, 0x33, 0xFE, 0x52, 0x02, 0x79, 0xFE,
-        0x5B, 0x02, 0x83, 0xFC, 0x01, 0x03, 0x33, 0xFC, 0x14, 0x05, 0x05, 0xFC,
-        0xD6, 0x06, 0x97, 0xF9, 0x84, 0x07, 0x54, 0xF5, 0xAD, 0x06, 0x2D, 0xF3,
-        0x50, 0x05, 0x9F, 0xF5, 0x1B, 0x03, 0xFD, 0xFA, 0x8D, 0xFE, 0x05, 0x01,
-        0xFA, 0xF8, 0xC9, 0x02, 0x41, 0xF6, 0xAE, 0x01, 0x57, 0xF7, 0x86, 0x00,
-        0x3F, 0xF9, 0x67, 0x01, 0x46, 0xFA, 0x54, 0x03, 0x62, 0xF9, 0x81, 0x04,
-        0x44, 0xF8, 0x43, 0x05, 0xC0, 0xF7, 0xF4, 0x02, 0xC6, 0xF8, 0x07, 0x02,
-        0x12, 0xFC, 0xF0, 0x01, 0x8F, 0xFD, 0x98, 0x01, 0x9A, 0xFD, 0x7F, 0x03,
-        0xF9, 0xFC, 0xBB, 0x03, 0xCE, 0xFA, 0xD6, 0x03, 0xF0, 0xF8, 0x3F, 0x06,
-        0x46, 0xF8, 0xC0, 0x0A, 0x22, 0xF9, 0xEE, 0x0C, 0x89, 0xFA, 0x6D, 0x0A,
-        0xCA, 0xFC, 0x14, 0x05, 0x7C, 0x01, 0x18, 0xFF, 0x0B, 0x07, 0x38, 0xFD,
-        0xAE, 0x09, 0x20, 0xFE, 0xA4, 0x08, 0x50, 0xFF, 0xB6, 0x06, 0x87, 0xFE,
-        0xA3, 0x05, 0xB2, 0xFC, 0x6D, 0x06, 0x8D, 0xFB, 0x7A, 0x07, 0xE5, 0xFA,
-        0x1C, 0x08, 0x5F, 0xFD, 0x31, 0x07, 0x41, 0xFE, 0xDC, 0x03, 0x45, 0xFE,
-        0x53, 0x02, 0x9D, 0xFE, 0x53, 0x02, 0xB8, 0xFC, 0xF6, 0x02, 0x77, 0xFC,
-        0x31, 0x05, 0x45, 0xFC, 0x1E, 0x07, 0xBE, 0xF9, 0xD6, 0x07, 0x5A, 0xF5,
-        0xFD, 0x06, 0x4A, 0xF3, 0x84, 0x05, 0xCA, 0xF5, 0x17, 0x03, 0x28, 0xFB,
-        0x76, 0xFE, 0x37, 0x01, 0x14, 0xF9, 0x10, 0x03, 0x86, 0xF6, 0x19, 0x02,
-        0x87, 0xF7, 0xD7, 0x00, 0x8F, 0xF9, 0xA4, 0x01, 0xB4, 0xFA, 0x79, 0x03,
-        0xD6, 0xF9, 0xA5, 0x04, 0xDA, 0xF8, 0x5E, 0x05, 0x34, 0xF8, 0x0B, 0x03,
-        0x24, 0xF9, 0x5E, 0x02, 0x5B, 0xFC, 0x40, 0x02, 0xDA, 0xFD, 0xDB, 0x01,
-        0xD1, 0xFD, 0xC5, 0x03, 0x14, 0xFD, 0xDD, 0x03, 0xCB, 0xFA, 0x01, 0x04,
-        0xBA, 0xF8, 0x77, 0x06, 0x01, 0xF8, 0xBB, 0x0A, 0xF2, 0xF8, 0xC4, 0x0C,
-        0xC5, 0xFA, 0x61, 0x0A, 0x5B, 0xFD, 0x10, 0x05, 0x05, 0x02, 0x0A, 0xFF,
-        0x48, 0x07, 0x2F, 0xFD, 0xC5, 0x09, 0x07, 0xFE, 0xBF, 0x08, 0x45, 0xFF,
-        0xB0, 0x06, 0x77, 0xFE, 0x91, 0x05, 0xA3, 0xFC, 0x6B, 0x06, 0x60, 0xFB,
-        0x68, 0x07, 0xCC, 0xFA, 0xF1, 0x07, 0x3F, 0xFD, 0x08, 0x07, 0xFB, 0xFD,
-        0xCC, 0x03, 0x38, 0xFE, 0x4E, 0x02, 0xB8, 0xFE, 0x59, 0x02, 0xC7, 0xFC,
-        0x17, 0x03, 0x77, 0xFC, 0x73, 0x05, 0x2F, 0xFC, 0xAA, 0x07, 0xC8, 0xF9,
-        0x7D, 0x08, 0x8B, 0xF5, 0x45, 0x07, 0x57, 0xF3, 0x66, 0x05, 0xB9, 0xF5,
-        0xBC, 0x02, 0x1C, 0xFB, 0x0D, 0xFE, 0x2B, 0x01, 0xC9, 0xF8, 0x08, 0x03,
-        0x5B, 0xF6, 0x40, 0x02, 0x85, 0xF7, 0x18, 0x01, 0x8F, 0xF9, 0xD2, 0x01,
-        0xB4, 0xFA, 0x95, 0x03, 0xED, 0xF9, 0xB9, 0x04, 0x15, 0xF9, 0x43, 0x05,
-        0x9F, 0xF8, 0xC7, 0x02, 0xAE, 0xF9, 0x00, 0x02, 0xF5, 0xFC, 0xA6, 0x01,
-        0x72, 0xFE, 0x21, 0x01, 0x49, 0xFE, 0x24, 0x03, 0x5A, 0xFD, 0x6A, 0x03,
-        0xF3, 0xFA, 0xCD, 0x03, 0xA5, 0xF8, 0x3C, 0x06, 0xF1, 0xF7, 0xAF, 0x0A,
-        0x24, 0xF9, 0xCF, 0x0C, 0x12, 0xFB, 0x88, 0x0A, 0xEA, 0xFD, 0x6E, 0x05,
-        0x8F, 0x02, 0x77, 0xFF, 0xDA, 0x07, 0xB3, 0xFD, 0x39, 0x0A, 0x6B, 0xFE,
-        0xE9, 0x08, 0x69, 0xFF, 0xB2, 0x06, 0x94, 0xFE, 0x9F, 0x05, 0xC7, 0xFC,
-        0x82, 0x06, 0xA2, 0xFB, 0x4E, 0x07, 0xF1, 0xFA, 0xA7, 0x07, 0x3E, 0xFD,
-        0x8D, 0x06, 0xF7, 0xFD, 0x44, 0x03, 0x4A, 0xFE, 0xE0, 0x01, 0xF8, 0xFE,
-        0x24, 0x02, 0x2D, 0xFD, 0x3A, 0x03, 0x00, 0xFD, 0xA8, 0x05, 0xAD, 0xFC,
-        0xC5, 0x07, 0x2D, 0xFA, 0x4A, 0x08, 0xB3, 0xF5, 0x15, 0x07, 0x96, 0xF3,
-        0x12, 0x05, 0xAF, 0xF5, 0x31, 0x02, 0x76, 0xFA, 0x8B, 0xFD, 0x4E, 0x00,
-        0x76, 0xF8, 0x0B, 0x02, 0x51, 0xF6, 0x85, 0x01, 0xED, 0xF7, 0xD2, 0x00,
-        0x1E, 0xFA, 0xD7, 0x01, 0x1D, 0xFB, 0xB1, 0x03, 0x23, 0xFA, 0xD1, 0x04,
-        0x21, 0xF9, 0x81, 0x05, 0xB5, 0xF8, 0x39, 0x03, 0xD2, 0xF9, 0x75, 0x02,
-        0x56, 0xFD, 0x16, 0x02, 0xAF, 0xFE, 0x5C, 0x01, 0x67, 0xFE, 0xEE, 0x02,
-        0x5F, 0xFD, 0x0B, 0x03, 0xEB, 0xFA, 0x4D, 0x03, 0xEE, 0xF8, 0xB6, 0x05,
-        0x51, 0xF8, 0x03, 0x0A, 0xAF, 0xF9, 0x34, 0x0C, 0xBD, 0xFB, 0x3F, 0x0A,
-        0x73, 0xFE, 0x68, 0x05, 0xE8, 0x02, 0xC3, 0xFF, 0xDB, 0x07, 0x0A, 0xFE,
-        0xD3, 0x09, 0x6D, 0xFE, 0xFD, 0x07, 0xE4, 0xFE, 0xAE, 0x05, 0xDB, 0xFD,
-        0xBD, 0x04, 0xE6, 0xFB, 0xE4, 0x05, 0xDA, 0xFA, 0x22, 0x07, 0x6D, 0xFA,
-        0xB4, 0x07, 0xC5, 0xFC, 0xB9, 0x06, 0xBA, 0xFD, 0x3B, 0x03, 0x11, 0xFE,
-        0xBA, 0x01, 0xBC, 0xFE, 0xDC, 0x01, 0x10, 0xFD, 0xEF, 0x02, 0x35, 0xFD,
-        0x6F, 0x05, 0x1C, 0xFD, 0x37, 0x07, 0xAA, 0xFA, 0xBE, 0x07, 0xB1, 0xF6,
-        0x66, 0x06, 0x86, 0xF4, 0x76, 0x04, 0x90, 0xF6, 0xCE, 0x01, 0x4D, 0xFB,
-        0x5E, 0xFD, 0xCB, 0x00, 0x91, 0xF8, 0x6B, 0x02, 0xB0, 0xF6, 0xF7, 0x01,
-        0x90, 0xF8, 0x69, 0x01, 0xC4, 0xFA, 0x7E, 0x02, 0xC4, 0xFB, 0x84, 0x04,
-        0x82, 0xFA, 0x7C, 0x05, 0x26, 0xF9, 0xF1, 0x05, 0x54, 0xF8, 0x93, 0x03,
-        0x59, 0xF9, 0xA0, 0x02, 0xD6, 0xFC, 0x60, 0x02, 0x60, 0xFE, 0xAE, 0x01,
-        0x2D, 0xFE, 0x3F, 0x03, 0x1C, 0xFD, 0xD1, 0x02, 0xD1, 0xFA, 0xDC, 0x02,
-        0xF5, 0xF8, 0x27, 0x05, 0x5C, 0xF8, 0xE8, 0x08, 0x9A, 0xF9, 0x28, 0x0B,
-        0x90, 0xFB, 0x44, 0x09, 0x59, 0xFE, 0xC2, 0x04, 0xC1, 0x02, 0x6D, 0xFF,
-        0x83, 0x07, 0xBD, 0xFD, 0x44, 0x09, 0x03, 0xFE, 0x98, 0x07, 0xB4, 0xFE,
-        0x4E, 0x05, 0x89, 0xFD, 0x5E, 0x04, 0x8C, 0xFB, 0xB1, 0x05, 0xB5, 0xFA,
-        0x35, 0x07, 0x42, 0xFA, 0xD4, 0x07, 0xCD, 0xFC, 0xBE, 0x06, 0x86, 0xFD,
-        0x7D, 0x03, 0xF7, 0xFD, 0x0D, 0x02, 0xB6, 0xFE, 0x21, 0x02, 0x1E, 0xFD,
-        0xFB, 0x02, 0x4A, 0xFD, 0x3E, 0x05, 0x3B, 0xFD, 0x2C, 0x07, 0x22, 0xFB,
-        0xD0, 0x07, 0x69, 0xF7, 0x7B, 0x06, 0x2C, 0xF5, 0x50, 0x04, 0xD3, 0xF6,
-        0x60, 0x01, 0x6B, 0xFB, 0xD4, 0xFC, 0xD5, 0x00, 0x30, 0xF8, 0xCF, 0x02,
-        0x6D, 0xF6, 0x8C, 0x02, 0x49, 0xF8, 0xDE, 0x01, 0x99, 0xFA, 0x17, 0x03,
-        0x63, 0xFB, 0x96, 0x04, 0x04, 0xFA, 0x24, 0x05, 0x8D, 0xF8, 0x90, 0x05,
-        0x09, 0xF8, 0xED, 0x02, 0xEC, 0xF8, 0x11, 0x02, 0x0E, 0xFC, 0x9C, 0x01,
-        0x91, 0xFD, 0xF9, 0x00, 0x7B, 0xFD, 0xD5, 0x02, 0xCA, 0xFC, 0xFA, 0x02,
-        0xA1, 0xFA, 0x07, 0x03, 0xAD, 0xF8, 0x22, 0x05, 0x01, 0xF8, 0x0B, 0x09,
-        0x6D, 0xF9, 0x3D, 0x0B, 0xA5, 0xFB, 0x9B, 0x09, 0xA7, 0xFE, 0x16, 0x05,
-        0x3E, 0x03, 0xB1, 0xFF, 0xFD, 0x07, 0xAF, 0xFD, 0xAC, 0x09, 0xDC, 0xFD,
-        0xB2, 0x07, 0x89, 0xFE, 0x5A, 0x05, 0x37, 0xFD, 0x95, 0x04, 0xDE, 0xFB,
-        0x01, 0x06, 0x47, 0xFB, 0x76, 0x07, 0xB9, 0xFA, 0xE2, 0x07, 0x50, 0xFD,
-        0xF4, 0x06, 0x0B, 0xFE, 0xE1, 0x03, 0x4F, 0xFE, 0x6E, 0x02, 0xF4, 0xFE,
-        0x74, 0x02, 0x0C, 0xFD, 0x02, 0x03, 0xD1, 0xFC, 0x1E, 0x05, 0xDA, 0xFC,
-        0xDD, 0x06, 0xC8, 0xFA, 0x4A, 0x07, 0xD5, 0xF6, 0x0D, 0x06, 0xF8, 0xF4,
-        0xFC, 0x03, 0xB3, 0xF6, 0x1B, 0x01, 0x32, 0xFB, 0x96, 0xFC, 0x96, 0x00,
-        0xE2, 0xF7, 0x83, 0x02, 0x4B, 0xF6, 0x44, 0x02, 0x52, 0xF8, 0x9C, 0x01,
-        0x96, 0xFA, 0xFC, 0x02, 0x12, 0xFB, 0x1F, 0x04, 0x8B, 0xF9, 0x99, 0x04,
-        0x31, 0xF8, 0x37, 0x05, 0xDF, 0xF7, 0xC5, 0x02, 0xE3, 0xF8, 0x0F, 0x02,
-        0x19, 0xFC, 0xBA, 0x01, 0xA4, 0xFD, 0x07, 0x01, 0x80, 0xFD, 0xD6, 0x02,
-        0x22, 0xFD, 0x03, 0x03, 0x34, 0xFB, 0xEF, 0x02, 0x8E, 0xF9, 0xEC, 0x04,
-        0x10, 0xF9, 0xE1, 0x08, 0x3A, 0xFA, 0x9D, 0x0A, 0x34, 0xFC, 0xED, 0x08,
-        0xAD, 0xFE, 0x7A, 0x04, 0xF2, 0x02, 0x33, 0xFF, 0x9A, 0x07, 0x6F, 0xFD,
-        0x23, 0x09, 0xB5, 0xFD, 0x58, 0x07, 0x56, 0xFE, 0x5E, 0x05, 0x15, 0xFD,
-        0x51, 0x05, 0xF8, 0xFB, 0xFD, 0x06, 0x82, 0xFB, 0x4B, 0x08, 0xBA, 0xFA,
-        0x75, 0x08, 0x28, 0xFD, 0x58, 0x07, 0xEE, 0xFD, 0x0E, 0x04, 0x7D, 0xFE,
-        0x5D, 0x02, 0x2D, 0xFF, 0x3F, 0x02, 0x68, 0xFD, 0x76, 0x02, 0x53, 0xFD,
-        0x8F, 0x04, 0x7A, 0xFD, 0x2F, 0x06, 0x7B, 0xFB, 0x78, 0x06, 0x74, 0xF7,
-        0x3A, 0x05, 0x86, 0xF5, 0x67, 0x03, 0x39, 0xF7, 0x3A, 0x01, 0x93, 0xFB,
-        0x08, 0xFD, 0xA2, 0x00, 0x88, 0xF8, 0x32, 0x02, 0x02, 0xF7, 0xDD, 0x01,
-        0x9C, 0xF8, 0xF8, 0x00, 0x22, 0xFA, 0x3B, 0x02, 0x00, 0xFA, 0x8A, 0x03,
-        0x64, 0xF8, 0x34, 0x04, 0x11, 0xF7, 0x20, 0x05, 0xDE, 0xF6, 0xD9, 0x02,
-        0x13, 0xF8, 0x0D, 0x02, 0xC3, 0xFB, 0x53, 0x01, 0xAF, 0xFD, 0x8B, 0x00,
-        0xFB, 0xFD, 0x3B, 0x02, 0xDB, 0xFD, 0xF8, 0x01, 0xB3, 0xFB, 0xD8, 0x01,
-        0xF2, 0xF9, 0xF7, 0x03, 0xA3, 0xF9, 0x3C, 0x08, 0xCC, 0xFA, 0x5D, 0x0A,
-        0x68, 0xFC, 0xA7, 0x08, 0x6A, 0xFE, 0x5B, 0x04, 0x8B, 0x02, 0x50, 0xFF,
-        0x22, 0x07, 0xD0, 0xFD, 0xE1, 0x08, 0x20, 0xFE, 0x76, 0x07, 0xDD, 0xFE,
-        0x26, 0x06, 0x97, 0xFD, 0x4C, 0x06, 0x57, 0xFC, 0xF2, 0x07, 0xB7, 0xFB,
-        0x18, 0x09, 0xD5, 0xFA, 0x31, 0x09, 0x4F, 0xFD, 0xD8, 0x07, 0x21, 0xFE,
-        0x36, 0x04, 0xF3, 0xFE, 0x2F, 0x02, 0xBA, 0xFF, 0xCC, 0x01, 0x0F, 0xFE,
-        0xF7, 0x01, 0x55, 0xFE, 0x13, 0x04, 0x42, 0xFE, 0xDA, 0x05, 0xEC, 0xFB,
-        0x1F, 0x06, 0x96, 0xF7, 0x38, 0x05, 0x99, 0xF5, 0xE6, 0x03, 0x74, 0xF7,
-        0xF7, 0x01, 0xAC, 0xFB, 0xDE, 0xFD, 0xC3, 0x00, 0x31, 0xF9, 0x4A, 0x02,
-        0x63, 0xF7, 0x0B, 0x02, 0x74, 0xF8, 0x4C, 0x01, 0x67, 0xF9, 0x75, 0x02,
-        0x23, 0xF9, 0x9D, 0x03, 0xA5, 0xF7, 0x17, 0x04, 0xA7, 0xF6, 0xC0, 0x04,
-        0xC3, 0xF6, 0x2A, 0x02, 0x68, 0xF8, 0x72, 0x01, 0x14, 0xFC, 0x90, 0x00,
-        0x2D, 0xFE, 0xB9, 0xFF, 0x9E, 0xFE, 0xD2, 0x01, 0x66, 0xFE, 0xD1, 0x01,
-        0x4E, 0xFC, 0x04, 0x02, 0x49, 0xFA, 0x64, 0x04, 0xDE, 0xF9, 0xC0, 0x08,
-        0xAD, 0xFA, 0x7B, 0x0A, 0xE1, 0xFB, 0x59, 0x08, 0xAF, 0xFD, 0xD8, 0x03,
-        0xBC, 0x01, 0xA5, 0xFE, 0xA3, 0x06, 0x21, 0xFD, 0xA2, 0x08, 0x3E, 0xFD,
-        0xB6, 0x07, 0x07, 0xFE, 0xD2, 0x06, 0xFC, 0xFC, 0x20, 0x07, 0xE3, 0xFB,
-        0x43, 0x08, 0x63, 0xFB, 0xFF, 0x08, 0x95, 0xFA, 0xD5, 0x08, 0x5A, 0xFD,
-        0x1E, 0x07, 0x14, 0xFE, 0x71, 0x03, 0x01, 0xFF, 0x3F, 0x01, 0xC7, 0xFF,
-        0xF2, 0x00, 0xC3, 0xFD, 0x6E, 0x01, 0xF4, 0xFD, 0x9A, 0x03, 0xCA, 0xFD,
-        0xC4, 0x05, 0x3F, 0xFB, 0x34, 0x06, 0x02, 0xF7, 0x61, 0x05, 0x67, 0xF5,
-        0x68, 0x04, 0x7C, 0xF7, 0xAF, 0x02, 0x29, 0xFC, 0x94, 0xFE, 0x85, 0x01,
-        0x77, 0xF9, 0x30, 0x03, 0x2C, 0xF7, 0x2D, 0x03, 0xC7, 0xF7, 0x74, 0x02,
-        0x8D, 0xF8, 0xAA, 0x03, 0x59, 0xF8, 0xBC, 0x04, 0x2B, 0xF7, 0xEF, 0x04,
-        0x5F, 0xF6, 0x63, 0x05, 0x87, 0xF6, 0x62, 0x02, 0x6A, 0xF8, 0x81, 0x01,
-        0x4D, 0xFC, 0x80, 0x00, 0xA9, 0xFE, 0x8D, 0xFF, 0x11, 0xFF, 0x80, 0x01,
-        0x7E, 0xFE, 0x71, 0x01, 0x6F, 0xFC, 0xA4, 0x01, 0x6A, 0xFA, 0x3A, 0x04,
-        0xE3, 0xF9, 0x8C, 0x08, 0xB6, 0xFA, 0x2E, 0x0A, 0x8D, 0xFB, 0xE3, 0x07,
-        0x2A, 0xFD, 0x33, 0x03, 0x38, 0x01, 0x13, 0xFE, 0x8B, 0x06, 0x49, 0xFC,
-        0x19, 0x09, 0x14, 0xFC, 0x84, 0x08, 0xC4, 0xFC, 0xCE, 0x07, 0xBA, 0xFB,
-        0xFD, 0x07, 0xDE, 0xFA, 0x18, 0x09, 0x15, 0xFB, 0xA9, 0x09, 0x0E, 0xFB,
-        0x7E, 0x09, 0x42, 0xFE, 0x65, 0x07, 0x62, 0xFF, 0x36, 0x03, 0x6D, 0x00,
-        0xDB, 0x00, 0x7C, 0x01, 0x80, 0x00, 0x80, 0xFF, 0x3B, 0x01, 0x6C, 0xFF,
-        0x59, 0x03, 0xD2, 0xFE, 0xC2, 0x05, 0x0A, 0xFC, 0x84, 0x06, 0xE2, 0xF7,
-        0xAB, 0x05, 0x13, 0xF6, 0xC6, 0x04, 0x1E, 0xF8, 0x14, 0x03, 0x7E, 0xFC,
-        0xF2, 0xFE, 0x7C, 0x01, 0x5A, 0xF9, 0x44, 0x03, 0x8E, 0xF6, 0x90, 0x03,
-        0x01, 0xF7, 0xF3, 0x02, 0xA3, 0xF7, 0x0E, 0x04, 0xA3, 0xF7, 0x03, 0x05,
-        0xD3, 0xF6, 0xB2, 0x04, 0x86, 0xF6, 0xA4, 0x04, 0xC1, 0xF6, 0x99, 0x01,
-        0xE2, 0xF8, 0x7F, 0x00, 0x36, 0xFD, 0x41, 0xFF, 0x74, 0xFF, 0x15, 0xFE,
-        0xA8, 0xFF, 0x26, 0x00, 0xCB, 0xFE, 0x56, 0x00, 0x64, 0xFC, 0x09, 0x01,
-        0xAA, 0xF9, 0xBF, 0x03, 0xE1, 0xF8, 0xFC, 0x07, 0x30, 0xFA, 0x0C, 0x0A,
-        0x57, 0xFB, 0x07, 0x08, 0x3B, 0xFD, 0xAE, 0x03, 0x7E, 0x01, 0xCE, 0xFE,
-        0x5D, 0x07, 0xDC, 0xFC, 0x4A, 0x0A, 0x61, 0xFC, 0xCE, 0x09, 0xBC, 0xFC,
-        0x13, 0x09, 0x8F, 0xFB, 0xAB, 0x08, 0xA6, 0xFA, 0x36, 0x09, 0x26, 0xFB,
-        0x5B, 0x09, 0x59, 0xFB, 0xF9, 0x08, 0x7C, 0xFE, 0xD0, 0x06, 0xB2, 0xFF,
-        0x70, 0x02, 0xEC, 0x00, 0x3A, 0x00, 0x19, 0x02, 0x20, 0x00, 0x25, 0x00,
-        0x1E, 0x01, 0x09, 0x00, 0xA6, 0x03, 0x46, 0xFF, 0x6F, 0x06, 0x90, 0xFC,
-        0x08, 0x07, 0x86, 0xF8, 0x84, 0x05, 0x7D, 0xF6, 0x40, 0x04, 0xA0, 0xF8,
-        0x47, 0x02, 0xDD, 0xFC, 0x02, 0xFE, 0xAF, 0x01, 0x37, 0xF8, 0xAB, 0x03,
-        0x77, 0xF5, 0xFA, 0x03, 0x44, 0xF6, 0x9C, 0x03, 0x1B, 0xF7, 0xB1, 0x04,
-        0xC1, 0xF7, 0x4D, 0x05, 0x2F, 0xF7, 0x87, 0x04, 0xF1, 0xF6, 0x0F, 0x04,
-        0x5E, 0xF7, 0x08, 0x01, 0x7B, 0xF9, 0x19, 0x00, 0xE6, 0xFD, 0xFB, 0xFE,
-        0xE8, 0xFF, 0xBA, 0xFD, 0xC8, 0xFF, 0xB5, 0xFF, 0xDB, 0xFE, 0xFB, 0xFF,
-        0x54, 0xFC, 0xBA, 0x00, 0x49, 0xF9, 0x2F, 0x03, 0xA6, 0xF8, 0x1F, 0x07,
-        0x59, 0xFA, 0x2B, 0x09, 0xBA, 0xFB, 0x06, 0x07, 0x03, 0xFE, 0xDF, 0x02,
-        0x6A, 0x02, 0x25, 0xFE, 0x3B, 0x08, 0x60, 0xFC, 0xE8, 0x0A, 0x24, 0xFC,
-        0xBB, 0x09, 0x68, 0xFC, 0x9E, 0x08, 0xB9, 0xFB, 0xE0, 0x07, 0x68, 0xFB,
-        0x5F, 0x08, 0x1A, 0xFC, 0x9B, 0x08, 0x67, 0xFC, 0x50, 0x08, 0x5A, 0xFF,
-        0xB9, 0x06, 0x29, 0x00, 0xB8, 0x02, 0x34, 0x01, 0xE7, 0x00, 0x91, 0x02,
-        0x37, 0x01, 0x90, 0x00, 0x23, 0x02, 0x86, 0x00, 0x96, 0x04, 0x15, 0x00,
-        0x88, 0x07, 0xB8, 0xFD, 0xF3, 0x07, 0xC8, 0xF9, 0x0F, 0x06, 0xCD, 0xF7,
-        0x76, 0x04, 0x95, 0xF9, 0x00, 0x02, 0x48, 0xFD, 0x92, 0xFD, 0xFD, 0x01,
-        0xEB, 0xF7, 0xD3, 0x03, 0x57, 0xF5, 0xF4, 0x03, 0xB5, 0xF6, 0x77, 0x03,
-        0x05, 0xF8, 0x2F, 0x04, 0x18, 0xF9, 0x95, 0x04, 0xF0, 0xF8, 0xE8, 0x03,
-        0x82, 0xF8, 0x8C, 0x03, 0x72, 0xF8, 0x94, 0x00, 0xB6, 0xF9, 0xB7, 0xFF,
-        0x60, 0xFD, 0x99, 0xFE, 0xF1, 0xFE, 0x47, 0xFD, 0x5E, 0xFE, 0x3A, 0xFF,
-        0x5E, 0xFD, 0x6C, 0xFF, 0xCD, 0xFA, 0xE5, 0xFF, 0xED, 0xF7, 0x26, 0x02,
-        0xB6, 0xF7, 0x3F, 0x06, 0xDB, 0xF9, 0x63, 0x08, 0x81, 0xFB, 0x9B, 0x06,
-        0xE0, 0xFD, 0xC8, 0x02, 0x45, 0x02, 0x25, 0xFE, 0x03, 0x08, 0xA7, 0xFC,
-        0xB5, 0x0A, 0x96, 0xFC, 0x46, 0x09, 0x26, 0xFD, 0xC1, 0x07, 0xBA, 0xFC,
-        0xB0, 0x06, 0x7D, 0xFC, 0xE0, 0x06, 0x34, 0xFD, 0x74, 0x07, 0x3A, 0xFD,
-        0xD4, 0x07, 0x13, 0x00, 0xDF, 0x06, 0xD3, 0x00, 0x50, 0x03, 0x7F, 0x01,
-        0xB2, 0x01, 0xA1, 0x02, 0x77, 0x02, 0xC8, 0x00, 0xAA, 0x03, 0x8E, 0x00,
-        0x2D, 0x06, 0xE2, 0xFF, 0xC2, 0x08, 0x8D, 0xFD, 0xD0, 0x08, 0x65, 0xF9,
-        0x9B, 0x06, 0x6A, 0xF7, 0xBC, 0x04, 0x49, 0xF9, 0x44, 0x02, 0xE8, 0xFC,
-        0xC6, 0xFD, 0x8B, 0x01, 0x03, 0xF8, 0x21, 0x03, 0x42, 0xF5, 0x42, 0x03,
-        0xD0, 0xF6, 0x87, 0x02, 0xB2, 0xF8, 0x1C, 0x03, 0xF7, 0xF9, 0x8A, 0x03,
-        0xD3, 0xF9, 0xCE, 0x02, 0x27, 0xF9, 0xF3, 0x02, 0x6F, 0xF8, 0x8A, 0x00,
-        0x26, 0xF9, 0x0C, 0x00, 0x91, 0xFC, 0x5F, 0xFF, 0xE7, 0xFD, 0xF0, 0xFD,
-        0xF7, 0xFC, 0x7C, 0xFF, 0xCD, 0xFB, 0xA0, 0xFF, 0x76, 0xF9, 0x40, 0x00,
-        0x14, 0xF7, 0x64, 0x02, 0x4E, 0xF7, 0x96, 0x06, 0xB6, 0xF9, 0xA7, 0x08,
-        0xE8, 0xFB, 0xE4, 0x06, 0x47, 0xFE, 0x63, 0x03, 0x87, 0x02, 0xAD, 0xFE,
-        0x37, 0x08, 0x26, 0xFD, 0xD6, 0x0A, 0xCF, 0xFC, 0x14, 0x09, 0x6B, 0xFD,
-        0xCF, 0x06, 0xD0, 0xFC, 0x7C, 0x05, 0x4C, 0xFC, 0xA6, 0x05, 0x23, 0xFD,
-        0xAF, 0x06, 0xEF, 0xFC, 0x2A, 0x08, 0x96, 0xFF, 0xCF, 0x07, 0x51, 0x00,
-        0x7C, 0x04, 0x14, 0x01, 0x33, 0x03, 0x9D, 0x02, 0x13, 0x04, 0x33, 0x01,
-        0xF3, 0x04, 0x1F, 0x01, 0x13, 0x07, 0x40, 0x00, 0x28, 0x09, 0xD5, 0xFD,
-        0x99, 0x08, 0xA0, 0xF9, 0x31, 0x06, 0x63, 0xF7, 0x05, 0x04, 0xD7, 0xF8,
-        0x16, 0x02, 0x53, 0xFC, 0x2A, 0xFE, 0x05, 0x01, 0x68, 0xF8, 0x72, 0x02,
-        0xA9, 0xF5, 0xDE, 0x02, 0x47, 0xF7, 0x4D, 0x02, 0x7E, 0xF9, 0xFE, 0x02,
-        0xC0, 0xFA, 0xC5, 0x03, 0x52, 0xFA, 0xCF, 0x02, 0xD9, 0xF8, 0xB8, 0x02,
-        0xF8, 0xF6, 0x1B, 0x00, 0x47, 0xF7, 0x8F, 0xFF, 0xE7, 0xFA, 0x09, 0xFF,
-        0x77, 0xFC, 0x86, 0xFD, 0xB5, 0xFB, 0x1E, 0xFF, 0xFE, 0xFA, 0x43, 0xFF,
-        0xE4, 0xF8, 0x17, 0x00, 0xEC, 0xF6, 0xAB, 0x02, 0x7E, 0xF7, 0xC1, 0x06,
-        0xCE, 0xF9, 0x00, 0x09, 0xD2, 0xFB, 0xA9, 0x07, 0x8A, 0xFD, 0x28, 0x04,
-        0x74, 0x01, 0x8B, 0xFF, 0x95, 0x07, 0x57, 0xFE, 0xA7, 0x0A, 0x16, 0xFE,
-        0x74, 0x09, 0x78, 0xFE, 0x48, 0x07, 0xA0, 0xFD, 0x04, 0x06, 0xA0, 0xFC,
-        0xAB, 0x06, 0x8E, 0xFD, 0x57, 0x08, 0x5E, 0xFD, 0x00, 0x0A, 0x98, 0xFF,
-        0x48, 0x09, 0xE8, 0xFF, 0x58, 0x05, 0x36, 0x00, 0x8A, 0x03, 0xF2, 0x01,
-        0x17, 0x04, 0x80, 0x00, 0x9C, 0x04, 0x73, 0x00, 0xC0, 0x06, 0xE9, 0xFF,
-        0xF5, 0x08, 0x5B, 0xFD, 0x73, 0x08, 0x7D, 0xF9, 0x12, 0x06, 0x2E, 0xF7,
-        0xF3, 0x03, 0x52, 0xF8, 0x23, 0x02, 0xCC, 0xFB, 0xF2, 0xFD, 0x55, 0x00,
-        0x95, 0xF7, 0x95, 0x01, 0x5E, 0xF4, 0xC9, 0x01, 0x80, 0xF5, 0x7D, 0x01,
-        0xBD, 0xF7, 0x45, 0x02, 0x4E, 0xF9, 0x3A, 0x03, 0xDE, 0xF8, 0x33, 0x02,
-        0x44, 0xF7, 0x7A, 0x02, 0xB5, 0xF5, 0x5A, 0x00, 0x7C, 0xF6, 0xF3, 0xFF,
-        0x72, 0xFA, 0xE3, 0xFF, 0x58, 0xFC, 0xFC, 0xFD, 0xED, 0xFB, 0x79, 0xFF,
-        0x7F, 0xFB, 0x99, 0xFF, 0x50, 0xF9, 0xEE, 0xFF, 0xFC, 0xF6, 0x6C, 0x02,
-        0x5C, 0xF7, 0x15, 0x06, 0xBC, 0xF9, 0x8B, 0x08, 0xED, 0xFB, 0x8A, 0x07,
-        0xCE, 0xFD, 0x12, 0x04, 0xE4, 0x01, 0x63, 0xFF, 0x3B, 0x08, 0x1C, 0xFE,
-        0xC8, 0x0B, 0x35, 0xFE, 0xAA, 0x0A, 0xAD, 0xFE, 0x44, 0x08, 0xF6, 0xFD,
-        0x84, 0x06, 0x4A, 0xFD, 0x0F, 0x07, 0xCB, 0xFE, 0xC8, 0x08, 0xA6, 0xFE,
-        0x36, 0x0A, 0x9E, 0x00, 0x6B, 0x09, 0xFB, 0x00, 0xB2, 0x05, 0xA5, 0x00,
-        0xD4, 0x03, 0x15, 0x02, 0xE1, 0x03, 0x28, 0x00, 0x1B, 0x04, 0xCB, 0xFF,
-        0x32, 0x06, 0x89, 0xFF, 0x6F, 0x08, 0x4A, 0xFD, 0xFA, 0x07, 0xF8, 0xF9,
-        0x8C, 0x05, 0xA0, 0xF7, 0x85, 0x03, 0xBE, 0xF8, 0xCC, 0x01, 0x3B, 0xFC,
-        0xB9, 0xFD, 0xD1, 0x00, 0x40, 0xF7, 0xFC, 0x01, 0xCE, 0xF3, 0xBB, 0x01,
-        0xFF, 0xF4, 0x39, 0x01, 0x61, 0xF7, 0xD1, 0x01, 0x30, 0xF9, 0x36, 0x02,
-        0xC2, 0xF8, 0x77, 0x00, 0x09, 0xF7, 0x95, 0x00, 0xB1, 0xF5, 0xBD, 0xFE,
-        0x8C, 0xF6, 0xB5, 0xFE, 0x20, 0xFA, 0x6A, 0xFF, 0xE6, 0xFB, 0x63, 0xFE,
-        0xCE, 0xFB, 0x47, 0x00, 0x7E, 0xFB, 0x99, 0x00, 0xC4, 0xF9, 0xB5, 0x00,
-        0xF2, 0xF7, 0xAE, 0x02, 0x6C, 0xF8, 0xE2, 0x05, 0xB8, 0xFA, 0x12, 0x08,
-        0xAA, 0xFC, 0xF6, 0x06, 0x63, 0xFE, 0xA9, 0x03, 0x6C, 0x02, 0x40, 0xFF,
-        0xA3, 0x08, 0xFC, 0xFD, 0xC6, 0x0B, 0x32, 0xFE, 0x73, 0x0A, 0xBD, 0xFE,
-        0x03, 0x08, 0x2A, 0xFE, 0x51, 0x06, 0x0E, 0xFE, 0xE8, 0x06, 0xC4, 0xFF,
-        0x9F, 0x08, 0x8D, 0xFF, 0xE5, 0x09, 0x2E, 0x01, 0x11, 0x09, 0x25, 0x01,
-        0xB9, 0x05, 0x9A, 0x00, 0x18, 0x04, 0x83, 0x01, 0x10, 0x04, 0x9E, 0xFF,
-        0x49, 0x04, 0x76, 0xFF, 0xCB, 0x05, 0x99, 0xFF, 0x78, 0x07, 0xA8, 0xFD,
-        0xCC, 0x06, 0x30, 0xFA, 0x7D, 0x04, 0xD7, 0xF7, 0xF2, 0x02, 0xB4, 0xF8,
-        0x7A, 0x01, 0xAD, 0xFB, 0x70, 0xFD, 0x24, 0x00, 0x65, 0xF7, 0xA3, 0x01,
-        0x63, 0xF4, 0x7A, 0x01, 0xA5, 0xF5, 0x12, 0x01, 0xFD, 0xF7, 0x8F, 0x01,
-        0x5E, 0xF9, 0x6E, 0x01, 0x7F, 0xF8, 0xCA, 0xFF, 0xC8, 0xF6, 0xFD, 0xFF,
-        0x9C, 0xF5, 0x52, 0xFE, 0x86, 0xF6, 0x5D, 0xFE, 0x0A, 0xFA, 0xE0, 0xFE,
-        0xE9, 0xFB, 0x26, 0xFE, 0xE6, 0xFB, 0x06, 0x00, 0x8A, 0xFB, 0x15, 0x00,
-        0xFC, 0xF9, 0xDC, 0xFF, 0x63, 0xF8, 0xC7, 0x01, 0xFD, 0xF8, 0x87, 0x05,
-        0x1E, 0xFB, 0x08, 0x08, 0x68, 0xFC, 0x5F, 0x07, 0xCE, 0xFD, 0x90, 0x04,
-        0xEB, 0x01, 0xEA, 0xFF, 0xF8, 0x07, 0x4C, 0xFE, 0x28, 0x0B, 0x6B, 0xFE,
-        0x03, 0x0A, 0xBC, 0xFE, 0x9E, 0x07, 0x40, 0xFE, 0x25, 0x06, 0x50, 0xFE,
-        0x07, 0x07, 0xC8, 0xFF, 0xF7, 0x08, 0xB4, 0xFF, 0x27, 0x0A, 0xA1, 0x01,
-        0xF7, 0x08, 0xC8, 0x01, 0x49, 0x05, 0x57, 0x01, 0x83, 0x03, 0x17, 0x02,
-        0xB7, 0x03, 0x00, 0x00, 0x56, 0x04, 0xA1, 0xFF, 0x21, 0x06, 0xB7, 0xFF,
-        0xC1, 0x07, 0xCA, 0xFD, 0x1C, 0x07, 0xE6, 0xF9, 0xF2, 0x04, 0x3C, 0xF7,
-        0xD2, 0x03, 0xE1, 0xF7, 0x7D, 0x02, 0x99, 0xFA, 0x14, 0xFE, 0x3F, 0xFF,
-        0xC3, 0xF7, 0xD1, 0x00, 0x7C, 0xF4, 0xF4, 0x00, 0xD8, 0xF5, 0xE7, 0x00,
-        0x3F, 0xF8, 0x3E, 0x01, 0xB1, 0xF9, 0xCD, 0x00, 0xBF, 0xF8, 0x19, 0xFF,
-        0xA1, 0xF6, 0x1E, 0xFF, 0x46, 0xF5, 0xFF, 0xFC, 0x61, 0xF6, 0x9B, 0xFC,
-        0x1A, 0xFA, 0x30, 0xFD, 0xF7, 0xFB, 0xBA, 0xFC, 0xF4, 0xFB, 0x28, 0xFF,
-        0x5D, 0xFB, 0xBC, 0xFF, 0x8B, 0xF9, 0xD2, 0xFF, 0x26, 0xF8, 0xF8, 0x01,
-        0xEF, 0xF8, 0x04, 0x06, 0x1E, 0xFB, 0xB9, 0x08, 0x09, 0xFC, 0x50, 0x08,
-        0x9E, 0xFD, 0xAB, 0x05, 0x03, 0x02, 0xE6, 0x00, 0x21, 0x08, 0x11, 0xFF,
-        0x8B, 0x0B, 0xC5, 0xFE, 0x59, 0x0A, 0x20, 0xFF, 0xCE, 0x07, 0x40, 0xFF,
-        0x0B, 0x06, 0xBC, 0xFF, 0x0C, 0x07, 0x72, 0x01, 0x53, 0x09, 0x65, 0x01,
-        0xD4, 0x0A, 0x7D, 0x03, 0x95, 0x09, 0x80, 0x03, 0x9B, 0x05, 0xA0, 0x02,
-        0xB8, 0x03, 0xEF, 0x02, 0x68, 0x03, 0x26, 0x00, 0xD2, 0x03, 0x25, 0xFF,
-        0xB9, 0x05, 0xCE, 0xFE, 0x68, 0x07, 0xB3, 0xFC, 0xB9, 0x06, 0xDF, 0xF8,
-        0xAB, 0x04, 0x3C, 0xF6, 0x29, 0x04, 0x9D, 0xF6, 0x95, 0x02, 0x8E, 0xF9,
-        0x4C, 0xFE, 0xAB, 0xFE, 0x3F, 0xF8, 0x88, 0x00, 0xA1, 0xF4, 0xDC, 0x00,
-        0xBF, 0xF5, 0x80, 0x00, 0x34, 0xF8, 0x64, 0x00, 0xDF, 0xF9, 0xFF, 0xFF,
-        0xDF, 0xF8, 0x24, 0xFE, 0xA3, 0xF6, 0x5C, 0xFE, 0xE7, 0xF4, 0x85, 0xFC,
-        0x15, 0xF6, 0x9A, 0xFC, 0x36, 0xFA, 0x89, 0xFD, 0x4C, 0xFC, 0x62, 0xFD,
-        0xEB, 0xFC, 0x48, 0x00, 0x4A, 0xFC, 0xE6, 0x00, 0x35, 0xFA, 0xEC, 0x00,
-        0x98, 0xF8, 0xDE, 0x02, 0x25, 0xF9, 0xA7, 0x06, 0xEB, 0xFA, 0x54, 0x09,
-        0x56, 0xFB, 0xE7, 0x08, 0x2F, 0xFD, 0xD9, 0x05, 0x7E, 0x01, 0xB5, 0x00,
-        0x8B, 0x07, 0xE4, 0xFE, 0x48, 0x0B, 0x77, 0xFE, 0x14, 0x0A, 0xEB, 0xFE,
-        0x78, 0x07, 0x19, 0xFF, 0xB8, 0x05, 0x88, 0xFF, 0xD3, 0x06, 0x6D, 0x01,
-        0x3C, 0x09, 0x35, 0x01, 0xD8, 0x0A, 0xEC, 0x02, 0x88, 0x09, 0xDB, 0x02,
-        0x94, 0x05, 0x15, 0x02, 0xB3, 0x03, 0x56, 0x02, 0xE8, 0x02, 0x88, 0xFF,
-        0x58, 0x03, 0xF0, 0xFE, 0x68, 0x05, 0xCE, 0xFE, 0x44, 0x07, 0x18, 0xFD,
-        0x1C, 0x07, 0x74, 0xF9, 0x6D, 0x05, 0x99, 0xF6, 0xEE, 0x04, 0xFA, 0xF6,
-        0x2F, 0x03, 0xE1, 0xF9, 0x9E, 0xFE, 0xC6, 0xFE, 0x7C, 0xF8, 0xAC, 0x00,
-        0xC7, 0xF4, 0x4B, 0x01, 0x04, 0xF6, 0xF7, 0x00, 0x92, 0xF8, 0xD3, 0x00,
-        0x43, 0xFA, 0xA9, 0x00, 0x15, 0xF9, 0xC8, 0xFE, 0xB0, 0xF6, 0xBA, 0xFE,
-        0x37, 0xF5, 0xEF, 0xFC, 0x73, 0xF6, 0x10, 0xFD, 0x2B, 0xFA, 0xE0, 0xFD,
-        0x06, 0xFC, 0xA3, 0xFD, 0xD0, 0xFC, 0x69, 0x00, 0x6E, 0xFC, 0x18, 0x01,
-        0x93, 0xFA, 0x18, 0x01, 0xE8, 0xF8, 0x67, 0x02, 0xFC, 0xF8, 0x05, 0x06,
-        0xA7, 0xFA, 0x31, 0x09, 0x24, 0xFB, 0xEF, 0x08, 0x05, 0xFD, 0x32, 0x06,
-        0xB5, 0x01, 0x58, 0x01, 0xA6, 0x07, 0x0A, 0xFF, 0x27, 0x0B, 0x25, 0xFE,
-        0xF7, 0x09, 0x4E, 0xFE, 0x59, 0x07, 0x68, 0xFE, 0xDA, 0x05, 0xCE, 0xFE,
-        0x31, 0x07, 0xD7, 0x00, 0x7C, 0x09, 0x11, 0x01, 0xB7, 0x0A, 0xF6, 0x02,
-        0x6F, 0x09, 0x03, 0x03, 0xBF, 0x05, 0x85, 0x02, 0xEB, 0x03, 0xF1, 0x02,
-        0x27, 0x03, 0x67, 0x00, 0x78, 0x03, 0xB4, 0xFF, 0x78, 0x05, 0xBD, 0xFF,
-        0x41, 0x07, 0x53, 0xFE, 0x40, 0x07, 0x61, 0xFA, 0x96, 0x05, 0x01, 0xF7,
-        0x2C, 0x05, 0x5F, 0xF7, 0x54, 0x03, 0x2F, 0xFA, 0x82, 0xFE, 0x1C, 0xFF,
-        0x92, 0xF8, 0xA0, 0x01, 0xFD, 0xF4, 0xA6, 0x02, 0x6B, 0xF6, 0xCF, 0x02,
-        0x39, 0xF9, 0xBE, 0x02, 0xAE, 0xFA, 0x1D, 0x02, 0x70, 0xF9, 0xFB, 0xFF,
-        0x71, 0xF7, 0x92, 0xFF, 0x67, 0xF6, 0x97, 0xFD, 0xAB, 0xF7, 0x5A, 0xFD,
-        0x59, 0xFB, 0xE6, 0xFD, 0xCB, 0xFC, 0x60, 0xFD, 0x1E, 0xFD, 0xA2, 0xFF,
-        0x89, 0xFC, 0x44, 0x00, 0x84, 0xFA, 0x49, 0x00, 0xDB, 0xF8, 0xF3, 0x01,
-        0xEC, 0xF8, 0xFE, 0x05, 0x9C, 0xFA, 0x6E, 0x09, 0xF2, 0xFA, 0x2E, 0x09,
-        0xEA, 0xFC, 0x98, 0x06, 0xCC, 0x01, 0xD9, 0x01, 0x76, 0x07, 0x51, 0xFF,
-        0xA3, 0x0A, 0x1A, 0xFE, 0x37, 0x09, 0x9C, 0xFD, 0xA7, 0x06, 0x94, 0xFD,
-        0x3F, 0x05, 0x46, 0xFE, 0x45, 0x06, 0x2B, 0x00, 0x2D, 0x08, 0x80, 0x00,
-        0x1D, 0x09, 0x92, 0x02, 0xFE, 0x07, 0xF8, 0x02, 0x72, 0x04, 0x5E, 0x02,
-        0x14, 0x03, 0xB5, 0x02, 0x22, 0x03, 0x84, 0x00, 0x10, 0x04, 0xF6, 0xFF,
-        0x22, 0x06, 0xE1, 0xFF, 0x83, 0x07, 0xEE, 0xFD, 0x3D, 0x07, 0x08, 0xFA,
-        0x5F, 0x05, 0xD8, 0xF6, 0xD8, 0x04, 0x07, 0xF7, 0xE6, 0x02, 0x70, 0xF9,
-        0xFA, 0xFD, 0xD8, 0xFD, 0x90, 0xF8, 0x4B, 0x00, 0xB0, 0xF5, 0xA8, 0x01,
-        0x31, 0xF7, 0x66, 0x02, 0x73, 0xF9, 0x94, 0x02, 0x9C, 0xFA, 0xF6, 0x01,
-        0xBC, 0xF9, 0x18, 0x00, 0x13, 0xF8, 0x94, 0xFF, 0x1A, 0xF7, 0x81, 0xFD,
-        0x33, 0xF8, 0x06, 0xFD, 0xAE, 0xFB, 0xAA, 0xFD, 0xE3, 0xFC, 0x9D, 0xFD,
-        0xDB, 0xFC, 0xFE, 0xFF, 0x04, 0xFC, 0x5F, 0x00, 0xCD, 0xF9, 0x15, 0x00,
-        0x9E, 0xF8, 0xD8, 0x01, 0x4B, 0xF9, 0xB5, 0x05, 0x5E, 0xFB, 0x00, 0x09,
-        0xF7, 0xFB, 0x21, 0x09, 0xEC, 0xFD, 0xFA, 0x06, 0x9D, 0x02, 0xE2, 0x02,
-        0x8E, 0x07, 0x74, 0x00, 0x78, 0x0A, 0xE5, 0xFE, 0x30, 0x09, 0x23, 0xFE,
-        0x27, 0x07, 0xF6, 0xFD, 0x42, 0x06, 0xB4, 0xFE, 0x1C, 0x07, 0xC4, 0x00,
-        0x93, 0x08, 0x61, 0x01, 0x67, 0x09, 0x46, 0x03, 0x22, 0x08, 0xA0, 0x03,
-        0x80, 0x04, 0xF5, 0x02, 0x5E, 0x03, 0xB8, 0x02, 0x6F, 0x03, 0x31, 0x00,
-        0x47, 0x04, 0xDD, 0xFF, 0x9B, 0x06, 0x27, 0x00, 0xA6, 0x07, 0x54, 0xFE,
-        0xD1, 0x06, 0x8C, 0xFA, 0x91, 0x04, 0xA0, 0xF7, 0xC4, 0x03, 0xAE, 0xF7,
-        0xDF, 0x01, 0xBF, 0xF9, 0x67, 0xFD, 0xBA, 0xFD, 0x99, 0xF8, 0x35, 0x00,
-        0xD5, 0xF5, 0x9A, 0x01, 0x1B, 0xF7, 0xFD, 0x01, 0xD0, 0xF8, 0xDB, 0x01,
-        0x5C, 0xF9, 0xF0, 0x00, 0x8B, 0xF8, 0xDE, 0xFE, 0x49, 0xF7, 0x60, 0xFE,
-        0xBD, 0xF6, 0xA1, 0xFC, 0x3E, 0xF8, 0x71, 0xFC, 0xF8, 0xFB, 0x30, 0xFD,
-        0x3A, 0xFD, 0x8B, 0xFD, 0x5B, 0xFD, 0x0D, 0x00, 0x86, 0xFC, 0xA3, 0x00,
-        0xF6, 0xF9, 0xA0, 0x00, 0xEA, 0xF8, 0x61, 0x02, 0xB1, 0xF9, 0xF5, 0x05,
-        0xF6, 0xFB, 0xC6, 0x08, 0xEE, 0xFC, 0xD2, 0x08, 0xB7, 0xFE, 0xF9, 0x06,
-        0x39, 0x03, 0x1B, 0x03, 0xFC, 0x07, 0xC0, 0x00, 0xB2, 0x0A, 0x9E, 0xFF,
-        0x9D, 0x09, 0x3C, 0xFF, 0x0C, 0x08, 0x46, 0xFF, 0x53, 0x07, 0x22, 0x00,
-        0x11, 0x08, 0xE4, 0x01, 0x4C, 0x09, 0x20, 0x02, 0x72, 0x09, 0x63, 0x03,
-        0xB4, 0x07, 0x47, 0x03, 0xE0, 0x03, 0x51, 0x02, 0x93, 0x02, 0xFA, 0x01,
-        0x7C, 0x02, 0x84, 0xFF, 0x3D, 0x03, 0x82, 0xFE, 0x85, 0x05, 0x6F, 0xFE,
-        0x7B, 0x06, 0xFF, 0xFC, 0xF0, 0x05, 0xA7, 0xF9, 0xAE, 0x03, 0xE1, 0xF6,
-        0x74, 0x02, 0x9E, 0xF6, 0xBD, 0x00, 0x05, 0xF8, 0x7A, 0xFC, 0xA5, 0xFB,
-        0xEA, 0xF7, 0xFB, 0xFD, 0x25, 0xF5, 0x39, 0xFF, 0xF8, 0xF5, 0xDB, 0xFF,
-        0x7C, 0xF7, 0x17, 0x00, 0x6F, 0xF8, 0x9E, 0xFF, 0xDB, 0xF7, 0x40, 0xFE,
-        0x9F, 0xF6, 0x2D, 0xFE, 0x9D, 0xF6, 0x0D, 0xFD, 0xAF, 0xF8, 0x4E, 0xFD,
-        0xDB, 0xFC, 0x5C, 0xFE, 0x37, 0xFE, 0x94, 0xFE, 0x51, 0xFE, 0xB5, 0x00,
-        0xA6, 0xFD, 0xB6, 0x01, 0x4C, 0xFB, 0xDF, 0x01, 0x3A, 0xFA, 0x51, 0x03,
-        0x95, 0xFA, 0xCB, 0x06, 0x75, 0xFC, 0xA5, 0x09, 0xA3, 0xFD, 0x6F, 0x0A,
-        0x43, 0xFF, 0x6D, 0x09, 0x88, 0x03, 0xBC, 0x05, 0x49, 0x08, 0x16, 0x03,
-        0x70, 0x0B, 0x9D, 0x01, 0xC1, 0x0A, 0xBA, 0x00, 0x28, 0x09, 0x54, 0x00,
-        0x16, 0x08, 0xA8, 0x00, 0x68, 0x08, 0xEC, 0x01, 0x4B, 0x09, 0xAB, 0x01,
-        0x10, 0x09, 0x58, 0x02, 0xFE, 0x06, 0x16, 0x02, 0x17, 0x03, 0x56, 0x01,
-        0xF6, 0x01, 0x55, 0x01, 0x0E, 0x02, 0x37, 0xFF, 0xD6, 0x02, 0xF3, 0xFD,
-        0x54, 0x05, 0xE6, 0xFD, 0x5D, 0x06, 0x5D, 0xFC, 0xEF, 0x05, 0xF8, 0xF8,
-        0xCE, 0x03, 0x58, 0xF6, 0x62, 0x02, 0x95, 0xF5, 0xD2, 0x00, 0xAC, 0xF6,
-        0x80, 0xFC, 0x7B, 0xFA, 0x84, 0xF7, 0x26, 0xFD, 0x63, 0xF4, 0xA2, 0xFE,
-        0xF9, 0xF4, 0x9E, 0xFF, 0xB3, 0xF6, 0x03, 0x00, 0x29, 0xF8, 0x9E, 0xFF,
-        0x2A, 0xF8, 0x2F, 0xFE, 0x63, 0xF7, 0x9B, 0xFE, 0xD4, 0xF7, 0x11, 0xFE,
-        0xDD, 0xF9, 0x20, 0xFE, 0x52, 0xFD, 0xC3, 0xFE, 0x56, 0xFE, 0xB7, 0xFE,
-        0x20, 0xFE, 0x32, 0x01, 0x39, 0xFD, 0xB7, 0x02, 0xC8, 0xFA, 0xE4, 0x02,
-        0xDC, 0xF9, 0x5F, 0x04, 0x47, 0xFA, 0x7B, 0x07, 0x85, 0xFC, 0xBC, 0x09,
-        0x12, 0xFE, 0x7E, 0x0A, 0x81, 0xFF, 0x7A, 0x09, 0xB9, 0x03, 0x9E, 0x05,
-        0x9E, 0x08, 0xD1, 0x02, 0x92, 0x0B, 0x37, 0x01, 0x21, 0x0B, 0x7E, 0x00,
-        0x43, 0x09, 0x22, 0x00, 0x97, 0x07, 0x97, 0x00, 0x4A, 0x07, 0x20, 0x02,
-        0xCE, 0x07, 0xAF, 0x01, 0x1F, 0x07, 0x38, 0x02, 0x30, 0x05, 0x01, 0x02,
-        0xF6, 0x01, 0x41, 0x01, 0x07, 0x01, 0x65, 0x01, 0x3F, 0x01, 0x80, 0xFE,
-        0x27, 0x02, 0x5B, 0xFC, 0xBC, 0x04, 0xF9, 0xFB, 0xE2, 0x05, 0x8D, 0xFA,
-        0x62, 0x05, 0xA6, 0xF7, 0x18, 0x03, 0x6D, 0xF5, 0x77, 0x01, 0xCD, 0xF4,
-        0xFE, 0xFF, 0xE6, 0xF5, 0xBE, 0xFB, 0xA4, 0xF9, 0xF4, 0xF6, 0x8A, 0xFC,
-        0xF3, 0xF3, 0x73, 0xFE, 0x74, 0xF4, 0x7E, 0xFF, 0xD7, 0xF6, 0x36, 0x00,
-        0xCF, 0xF8, 0xB8, 0xFF, 0x46, 0xF9, 0xED, 0xFD, 0x54, 0xF9, 0x2F, 0xFE,
-        0x39, 0xFA, 0x6D, 0xFD, 0xF6, 0xFB, 0xA7, 0xFD, 0xCB, 0xFE, 0x53, 0xFE,
-        0x69, 0xFF, 0x40, 0xFE, 0xE2, 0xFE, 0xBE, 0x01, 0xF7, 0xFD, 0x58, 0x04,
-        0x71, 0xFB, 0xAE, 0x04, 0x16, 0xFA, 0x01, 0x06, 0x9C, 0xFA, 0xEA, 0x08,
-        0x17, 0xFD, 0x28, 0x0B, 0xF1, 0xFE, 0xB8, 0x0B, 0x85, 0x00, 0xA7, 0x0A,
-        0xA5, 0x04, 0xF1, 0x06, 0x3D, 0x09, 0x81, 0x03, 0xDE, 0x0B, 0x1D, 0x01,
-        0x47, 0x0B, 0xEC, 0xFF, 0xF1, 0x08, 0x4E, 0xFF, 0xF7, 0x06, 0x10, 0x00,
-        0x84, 0x06, 0xFD, 0x01, 0xB3, 0x06, 0xE3, 0x01, 0x1F, 0x06, 0xE5, 0x02,
-        0x6E, 0x04, 0x93, 0x02, 0xA3, 0x01, 0xDE, 0x01, 0xF3, 0x00, 0x1B, 0x02,
-        0x27, 0x01, 0xB9, 0xFE, 0xC8, 0x01, 0x41, 0xFC, 0x13, 0x04, 0xCB, 0xFB,
-        0x58, 0x05, 0x70, 0xFA, 0x16, 0x05, 0xBE, 0xF7, 0x13, 0x03, 0x7F, 0xF5,
-        0x51, 0x01, 0xC5, 0xF4, 0x9B, 0xFF, 0x75, 0xF5, 0x7D, 0xFB, 0x14, 0xF9,
-        0xF0, 0xF6, 0x86, 0xFC, 0x41, 0xF4, 0xC5, 0xFE, 0x9F, 0xF4, 0xE2, 0xFF,
-        0xCC, 0xF6, 0x62, 0x00, 0x8B, 0xF8, 0x93, 0xFF, 0xED, 0xF8, 0xC8, 0xFD,
-        0xBE, 0xF8, 0xE5, 0xFD, 0x53, 0xF9, 0xBE, 0xFC, 0x1E, 0xFB, 0xDB, 0xFC,
-        0x04, 0xFE, 0x52, 0xFD, 0xC4, 0xFE, 0x12, 0xFD, 0x89, 0xFE, 0x88, 0x00,
-        0x2C, 0xFE, 0x0A, 0x03, 0xEE, 0xFB, 0xA8, 0x03, 0x49, 0xFA, 0xF6, 0x04,
-        0x68, 0xFA, 0x8E, 0x07, 0x65, 0xFC, 0xFD, 0x09, 0x2C, 0xFE, 0xE7, 0x0A,
-        0x0B, 0x00, 0x4F, 0x0A, 0x7A, 0x04, 0xD5, 0x06, 0x28, 0x09, 0x8D, 0x03,
-        0xE2, 0x0B, 0x6E, 0x01, 0xAE, 0x0B, 0x22, 0x00, 0x66, 0x09, 0xB4, 0xFF,
-        0x9A, 0x07, 0x8F, 0x00, 0x88, 0x07, 0x25, 0x02, 0xCC, 0x07, 0xFD, 0x01,
-        0x1A, 0x07, 0xFF, 0x02, 0x4E, 0x05, 0x28, 0x03, 0x5A, 0x02, 0x06, 0x03,
-        0x5B, 0x01, 0x51, 0x03, 0x60, 0x01, 0xEA, 0xFF, 0x89, 0x01, 0x46, 0xFD,
-        0xA3, 0x03, 0x77, 0xFC, 0x42, 0x05, 0x0D, 0xFB, 0x17, 0x05, 0x6D, 0xF8,
-        0x27, 0x03, 0xDE, 0xF5, 0x64, 0x01, 0x06, 0xF5, 0x73, 0xFF, 0xCD, 0xF5,
-        0xF4, 0xFA, 0x54, 0xF9, 0x40, 0xF6, 0x9C, 0xFC, 0x97, 0xF3, 0xAE, 0xFE,
-        0xF9, 0xF3, 0xCA, 0xFF, 0x48, 0xF6, 0xDC, 0xFF, 0xF7, 0xF7, 0xFF, 0xFE,
-        0x17, 0xF8, 0x48, 0xFD, 0x06, 0xF8, 0x3D, 0xFD, 0x74, 0xF8, 0x30, 0xFC,
-        0x2D, 0xFA, 0xC9, 0xFB, 0x72, 0xFD, 0x01, 0xFC, 0xCD, 0xFE, 0x24, 0xFC,
-        0xFA, 0xFE, 0xE2, 0xFF, 0xE3, 0xFE, 0xB9, 0x02, 0xC5, 0xFC, 0xA8, 0x03,
-        0x24, 0xFB, 0x0B, 0x05, 0x6C, 0xFB, 0xA2, 0x07, 0x2E, 0xFD, 0x0B, 0x0A,
-        0xAB, 0xFE, 0xA3, 0x0A, 0x6D, 0x00, 0xB2, 0x09, 0xCD, 0x04, 0x14, 0x06,
-        0x7A, 0x09, 0x92, 0x02, 0xFC, 0x0B, 0x50, 0x00, 0x9C, 0x0B, 0x78, 0xFF,
-        0x5E, 0x09, 0xB9, 0xFF, 0x9A, 0x07, 0xB2, 0x00, 0x48, 0x07, 0x6E, 0x02,
-        0x5D, 0x07, 0x89, 0x02, 0x18, 0x07, 0x79, 0x03, 0x4E, 0x05, 0x12, 0x04,
-        0xDF, 0x01, 0xDE, 0x03, 0x59, 0x00, 0xA9, 0x03, 0xFE, 0xFF, 0x01, 0x00,
-        0x22, 0x00, 0x07, 0xFD, 0x4E, 0x02, 0xF5, 0xFB, 0x01, 0x04, 0x63, 0xFA,
-        0xB9, 0x03, 0x96, 0xF7, 0xEE, 0x01, 0x1A, 0xF5, 0x58, 0x00, 0x8C, 0xF4,
-        0xBB, 0xFE, 0xEC, 0xF5, 0xA8, 0xFA, 0xE1, 0xF9, 0x08, 0xF6, 0x7E, 0xFD,
-        0x89, 0xF3, 0x90, 0xFF, 0xF3, 0xF3, 0x18, 0x00, 0x2C, 0xF6, 0xBC, 0xFF,
-        0x0B, 0xF8, 0xC0, 0xFE, 0x63, 0xF8, 0xF6, 0xFC, 0x1C, 0xF8, 0xE7, 0xFC,
-        0x27, 0xF8, 0xBC, 0xFB, 0x0A, 0xFA, 0x99, 0xFA, 0xA4, 0xFD, 0x7C, 0xFA,
-        0x91, 0xFF, 0xA1, 0xFA, 0x54, 0x00, 0x82, 0xFE, 0x5F, 0x00, 0x32, 0x02,
-        0x20, 0xFE, 0xBF, 0x03, 0x4F, 0xFC, 0x9F, 0x05, 0x95, 0xFC, 0x81, 0x08,
-        0x62, 0xFE, 0xE9, 0x0A, 0xF0, 0xFF, 0x29, 0x0B, 0x89, 0x01, 0x6B, 0x09,
-        0x96, 0x05, 0x7E, 0x05, 0x4D, 0x0A, 0x07, 0x02, 0xC8, 0x0C, 0xEF, 0xFF,
-        0x68, 0x0C, 0x7B, 0xFF, 0x28, 0x0A, 0x2D, 0x00, 0x32, 0x08, 0x81, 0x01,
-        0x92, 0x07, 0x55, 0x03, 0x7D, 0x07, 0x75, 0x03, 0x3C, 0x07, 0x3A, 0x05,
-        0x58, 0x05, 0xCD, 0x06, 0x8F, 0x01, 0xAB, 0x06, 0x63, 0xFF, 0x0D, 0x06,
-        0xAC, 0xFE, 0xBD, 0x01, 0xFB, 0xFE, 0xB5, 0xFD, 0x7A, 0x01, 0xCC, 0xFB,
-        0x78, 0x03, 0xAF, 0xF9, 0x09, 0x03, 0xEB, 0xF6, 0xED, 0x00, 0xD0, 0xF4,
-        0x22, 0xFF, 0xB7, 0xF4, 0x54, 0xFD, 0x73, 0xF6, 0x46, 0xF9, 0x2D, 0xFA,
-        0xDA, 0xF4, 0x8F, 0xFD, 0xD7, 0xF2, 0xAC, 0xFF, 0x83, 0xF3, 0xE8, 0xFF,
-        0xF1, 0xF5, 0xE8, 0xFE, 0x0C, 0xF8, 0x69, 0xFD, 0xCA, 0xF8, 0xA0, 0xFB,
-        0xE3, 0xF8, 0x85, 0xFB, 0xFA, 0xF8, 0xCE, 0xF9, 0xCB, 0xFA, 0xC3, 0xF8,
-        0xA8, 0xFE, 0x59, 0xF9, 0xDF, 0x00, 0x2E, 0xFA, 0x68, 0x01, 0x99, 0xFE,
-        0x0B, 0x01, 0x9F, 0x02, 0xA4, 0xFE, 0x72, 0x04, 0xAA, 0xFC, 0x66, 0x06,
-        0x18, 0xFD, 0xEB, 0x08, 0x38, 0xFF, 0x07, 0x0B, 0x00, 0x01, 0x41, 0x0B,
-        0xB9, 0x02, 0x93, 0x09, 0x7B, 0x06, 0xD5, 0x05, 0x93, 0x0A, 0xA3, 0x02,
-        0x5A, 0x0C, 0xB5, 0x00, 0xAE, 0x0B, 0x80, 0x00, 0x87, 0x09, 0x43, 0x01,
-        0x97, 0x07, 0xAB, 0x02, 0x02, 0x07, 0x5D, 0x04, 0x07, 0x07, 0x3E, 0x04,
-        0xE4, 0x06, 0xAB, 0x05, 0xB4, 0x04, 0x76, 0x06, 0x85, 0x00, 0x07, 0x06,
-        0x32, 0xFE, 0x3F, 0x05, 0x83, 0xFD, 0x0F, 0x01, 0xED, 0xFD, 0x78, 0xFD,
-        0x8D, 0x00, 0xA9, 0xFB, 0xAC, 0x02, 0x85, 0xF9, 0x80, 0x02, 0xCE, 0xF6,
-        0xA8, 0x00, 0xAC, 0xF4, 0x13, 0xFF, 0x7C, 0xF4, 0x51, 0xFD, 0x55, 0xF6,
-        0x8B, 0xF9, 0x41, 0xFA, 0x61, 0xF5, 0x92, 0xFD, 0x8A, 0xF3, 0xAF, 0xFF,
-        0x59, 0xF4, 0x01, 0x00, 0x61, 0xF6, 0x47, 0xFF, 0x36, 0xF8, 0xD3, 0xFD,
-        0xB5, 0xF8, 0x3D, 0xFC, 0xC4, 0xF8, 0x3A, 0xFC, 0x30, 0xF9, 0x94, 0xFA,
-        0xB6, 0xFB, 0xA7, 0xF9, 0x3D, 0x00, 0x23, 0xFA, 0xD0, 0x02, 0x2A, 0xFB,
-        0x9C, 0x03, 0x53, 0xFF, 0xE2, 0x02, 0xD0, 0x02, 0x0A, 0x00, 0xBD, 0x04,
-        0xC0, 0xFD, 0xDF, 0x06, 0xB6, 0xFD, 0x5F, 0x09, 0x6E, 0xFF, 0x50, 0x0B,
-        0x07, 0x01, 0x60, 0x0B, 0xEE, 0x02, 0x45, 0x09, 0xBC, 0x06, 0x3B, 0x05,
-        0xD6, 0x0A, 0xEB, 0x01, 0x63, 0x0C, 0xFA, 0xFF, 0x2A, 0x0B, 0xC6, 0xFF,
-        0x0A, 0x09, 0xA6, 0x00, 0x2A, 0x07, 0x2B, 0x02, 0xC5, 0x06, 0xDE, 0x03,
-        0xEE, 0x06, 0x28, 0x04, 0xA8, 0x06, 0xFA, 0x05, 0x07, 0x04, 0xD4, 0x06,
-        0x47, 0xFF, 0x27, 0x06, 0x9D, 0xFC, 0xFF, 0x04, 0x06, 0xFC, 0xCF, 0x00,
-        0xFB, 0xFC, 0x3F, 0xFD, 0xF4, 0xFF, 0x71, 0xFB, 0x5F, 0x02, 0xB5, 0xF9,
-        0x97, 0x02, 0x68, 0xF7, 0x07, 0x01, 0x92, 0xF5, 0xA7, 0xFF, 0x9C, 0xF5,
-        0xEF, 0xFD, 0x9E, 0xF7, 0x62, 0xFA, 0x7B, 0xFB, 0x93, 0xF6, 0xBB, 0xFE,
-        0x2E, 0xF5, 0x6C, 0x00, 0x50, 0xF6, 0x39, 0x00, 0x5B, 0xF8, 0x23, 0xFF,
-        0x20, 0xFA, 0xA0, 0xFD, 0x45, 0xFA, 0x2A, 0xFC, 0xE7, 0xF9, 0x06, 0xFC,
-        0x34, 0xFA, 0x6B, 0xFA, 0xDC, 0xFC, 0xB8, 0xF9, 0xA3, 0x01, 0x7C, 0xFA,
-        0x29, 0x04, 0xA6, 0xFB, 0x75, 0x04, 0xB1, 0xFF, 0x11, 0x03, 0x06, 0x03,
-        0xCE, 0xFF, 0xD7, 0x04, 0x1E, 0xFD, 0x9F, 0x06, 0xCE, 0xFC, 0xF3, 0x08,
-        0x73, 0xFE, 0xA8, 0x0A, 0xE1, 0xFF, 0x78, 0x0A, 0x83, 0x01, 0x97, 0x08,
-        0x08, 0x05, 0x92, 0x04, 0xE6, 0x08, 0x58, 0x01, 0x32, 0x0A, 0xC2, 0xFF,
-        0xDE, 0x08, 0x24, 0x00, 0xAF, 0x06, 0x44, 0x01, 0xB6, 0x04, 0xB1, 0x02,
-        0x8C, 0x04, 0xEF, 0x03, 0x17, 0x05, 0xB9, 0x03, 0x1C, 0x05, 0x24, 0x05,
-        0xD9, 0x02, 0xCF, 0x05, 0xA4, 0xFE, 0x61, 0x05, 0x62, 0xFC, 0x36, 0x04,
-        0x0A, 0xFC, 0x1F, 0x00, 0xA2, 0xFD, 0xB4, 0xFC, 0x20, 0x01, 0xA4, 0xFA,
-        0xB7, 0x03, 0xC8, 0xF8, 0x05, 0x04, 0x64, 0xF6, 0x75, 0x02, 0x0C, 0xF5,
-        0x09, 0x01, 0x77, 0xF5, 0x74, 0xFF, 0x93, 0xF7, 0x1F, 0xFC, 0xC2, 0xFB,
-        0x40, 0xF8, 0xC9, 0xFE, 0xFD, 0xF6, 0x47, 0x00, 0x79, 0xF8, 0x21, 0x00,
-        0x97, 0xFA, 0x2B, 0xFF, 0x81, 0xFC, 0xDA, 0xFD, 0xC1, 0xFC, 0xA8, 0xFC,
-        0x14, 0xFC, 0xE5, 0xFC, 0xC1, 0xFB, 0x6D, 0xFB, 0xB4, 0xFD, 0xA9, 0xFA,
-        0xA8, 0x01, 0x00, 0xFB, 0xE6, 0x03, 0x72, 0xFC, 0x60, 0x04, 0xC9, 0x00,
-        0xB0, 0x02, 0x82, 0x04, 0x1B, 0xFF, 0xD6, 0x06, 0x81, 0xFC, 0xAB, 0x08,
-        0x1A, 0xFC, 0xE1, 0x0A, 0xAD, 0xFD, 0xF3, 0x0B, 0x50, 0xFF, 0x42, 0x0B,
-        0x0C, 0x01, 0xF7, 0x08, 0x59, 0x04, 0xC7, 0x04, 0x3C, 0x08, 0xB6, 0x01,
-        0x87, 0x09, 0x01, 0x00, 0x01, 0x08, 0xD4, 0xFF, 0xC5, 0x05, 0x60, 0x00,
-        0xB9, 0x03, 0x77, 0x01, 0x42, 0x03, 0xA3, 0x02, 0xBA, 0x03, 0xCB, 0x02,
-        0xF4, 0x03, 0x6F, 0x04, 0x16, 0x02, 0x81, 0x05, 0x3A, 0xFE, 0x66, 0x05,
-        0x2D, 0xFC, 0xDF, 0x03, 0xCA, 0xFB, 0x4C, 0xFF, 0x7C, 0xFD, 0x61, 0xFB,
-        0x1E, 0x01, 0xF2, 0xF8, 0xF2, 0x03, 0x19, 0xF7, 0x57, 0x04, 0xD1, 0xF4,
-        0x8C, 0x02, 0xC8, 0xF3, 0xD3, 0x00, 0xBA, 0xF4, 0x13, 0xFF, 0x20, 0xF7,
-        0xDB, 0xFB, 0x76, 0xFB, 0x28, 0xF8, 0x9F, 0xFE, 0xE6, 0xF6, 0x94, 0x00,
-        0x7A, 0xF8, 0x22, 0x01, 0xBA, 0xFA, 0xBC, 0x00, 0xA7, 0xFC, 0x76, 0xFF,
-        0xEB, 0xFC, 0xA0, 0xFD, 0xA7, 0xFC, 0xD1, 0xFC, 0xA2, 0xFC, 0xAC, 0xFA,
-        0x5F, 0xFE, 0x1F, 0xF9, 0xFB, 0x01, 0x06, 0xF9, 0xCE, 0x03, 0xC8, 0xFA,
-        0x05, 0x04, 0xB7, 0xFF, 0x22, 0x02, 0xFE, 0x03, 0x55, 0xFE, 0xBB, 0x06,
-        0x8E, 0xFB, 0xEC, 0x08, 0x3C, 0xFB, 0x8D, 0x0B, 0x26, 0xFD, 0xBC, 0x0C,
-        0xD6, 0xFE, 0xCB, 0x0B, 0x75, 0x00, 0x4A, 0x09, 0x92, 0x03, 0xCA, 0x04,
-        0x5E, 0x07, 0x57, 0x01, 0xCD, 0x08, 0x53, 0xFF, 0x6C, 0x07, 0xC5, 0xFE,
-        0xA7, 0x05, 0x67, 0xFF, 0x40, 0x04, 0x05, 0x01, 0xF8, 0x03, 0x46, 0x03,
-        0xD2, 0x03, 0x57, 0x04, 0x7F, 0x03, 0x66, 0x06, 0x7C, 0x01, 0xE4, 0x07,
-        0xCC, 0xFD, 0xAE, 0x07, 0x35, 0xFC, 0x85, 0x05, 0x53, 0xFC, 0x83, 0x00,
-        0x8F, 0xFE, 0x11, 0xFC, 0x93, 0x02, 0xFA, 0xF8, 0x35, 0x05, 0x7D, 0xF6,
-        0x50, 0x05, 0xC6, 0xF3, 0x83, 0x03, 0xB8, 0xF2, 0xE1, 0x01, 0xFB, 0xF3,
-        0x0D, 0x00, 0xCF, 0xF6, 0xDA, 0xFC, 0x72, 0xFB, 0xEA, 0xF8, 0xE5, 0xFE,
-        0x2F, 0xF7, 0xF6, 0x00, 0x52, 0xF8, 0x46, 0x01, 0xF2, 0xF9, 0x69, 0x00,
-        0x2D, 0xFB, 0xA6, 0xFE, 0x8D, 0xFB, 0x7F, 0xFC, 0xF6, 0xFB, 0x97, 0xFB,
-        0x63, 0xFC, 0xBA, 0xF9, 0x64, 0xFE, 0x6E, 0xF8, 0x29, 0x02, 0xC8, 0xF8,
-        0xAF, 0x03, 0x1F, 0xFB, 0x2D, 0x03, 0x0F, 0x00, 0xCB, 0x00, 0x4F, 0x04,
-        0x01, 0xFD, 0x58, 0x07, 0x9A, 0xFA, 0xD1, 0x09, 0xAE, 0xFA, 0x73, 0x0C,
-        0x87, 0xFC, 0x25, 0x0D, 0x45, 0xFE, 0xB5, 0x0B, 0x22, 0x00, 0xF5, 0x08,
-        0x43, 0x03, 0x82, 0x04, 0x1A, 0x07, 0x33, 0x01, 0xAE, 0x08, 0x31, 0xFF,
-        0x76, 0x07, 0xDE, 0xFE, 0xCF, 0x05, 0xA7, 0xFF, 0xCB, 0x04, 0x4D, 0x01,
-        0xB5, 0x04, 0x61, 0x03, 0x83, 0x04, 0x4F, 0x04, 0x27, 0x04, 0x1B, 0x06,
-        0xEE, 0x01, 0x10, 0x07, 0xC9, 0xFD, 0x6F, 0x06, 0xF4, 0xFB, 0xE9, 0x03,
-        0x7F, 0xFC, 0x3A, 0xFF, 0xFD, 0xFE, 0x21, 0xFB, 0xCC, 0x02, 0x48, 0xF8,
-        0x45, 0x05, 0x11, 0xF6, 0x31, 0x05, 0x99, 0xF3, 0x49, 0x03, 0x0C, 0xF3,
-        0x53, 0x01, 0x64, 0xF4, 0x5C, 0xFF, 0x13, 0xF7, 0x5F, 0xFC, 0x86, 0xFB,
-        0x91, 0xF8, 0xE4, 0xFE, 0x23, 0xF7, 0xEE, 0x00, 0x7F, 0xF8, 0x51, 0x01,
-        0x38, 0xFA, 0xAB, 0x00, 0x2E, 0xFB, 0x17, 0xFF, 0x1B, 0xFB, 0xFE, 0xFC,
-        0x50, 0xFB, 0x14, 0xFC, 0xA4, 0xFB, 0x90, 0xFA, 0xF3, 0xFD, 0xEC, 0xF9,
-        0x2C, 0x02, 0xB2, 0xFA, 0xD8, 0x03, 0x1C, 0xFD, 0x02, 0x03, 0x7B, 0x01,
-        0x60, 0x00, 0x2F, 0x05, 0xC6, 0xFC, 0xC3, 0x07, 0x8D, 0xFA, 0xC5, 0x09,
-        0xF0, 0xFA, 0x0F, 0x0C, 0x2E, 0xFD, 0x9E, 0x0C, 0x71, 0xFF, 0x07, 0x0B,
-        0x7A, 0x01, 0x2F, 0x08, 0x49, 0x04, 0xC3, 0x03, 0xEF, 0x07, 0xA8, 0x00,
-        0x24, 0x09, 0xDD, 0xFE, 0xA5, 0x07, 0xAD, 0xFE, 0xB5, 0x05, 0x95, 0xFF,
-        0x89, 0x04, 0x10, 0x01, 0x90, 0x04, 0xF2, 0x02, 0x50, 0x04, 0xA8, 0x03,
-        0xF5, 0x03, 0xE8, 0x04, 0xD7, 0x01, 0x80, 0x05, 0xED, 0xFD, 0xDE, 0x04,
-        0x56, 0xFC, 0xC5, 0x02, 0x3A, 0xFD, 0xB1, 0xFE, 0x9C, 0xFF, 0x11, 0xFB,
-        0xB7, 0x02, 0x7D, 0xF8, 0xA8, 0x04, 0xA3, 0xF6, 0x47, 0x04, 0x86, 0xF4,
-        0xF3, 0x01, 0x26, 0xF4, 0x9C, 0xFF, 0xEB, 0xF5, 0xCE, 0xFD, 0xD2, 0xF8,
-        0x19, 0xFB, 0x0A, 0xFD, 0x62, 0xF7, 0xAA, 0xFF, 0x3F, 0xF6, 0x00, 0x01,
-        0xDF, 0xF7, 0xD6, 0x00, 0xEE, 0xF9, 0xF4, 0xFF, 0x1A, 0xFB, 0xB4, 0xFE,
-        0x08, 0xFB, 0xDA, 0xFC, 0x53, 0xFB, 0x43, 0xFC, 0xF7, 0xFB, 0x2A, 0xFB,
-        0x22, 0xFE, 0x81, 0xFA, 0xFD, 0x01, 0x05, 0xFB, 0xA6, 0x03, 0xF9, 0xFC,
-        0xE3, 0x02, 0x0C, 0x01, 0x9A, 0x00, 0xF4, 0x04, 0x7B, 0xFD, 0xA4, 0x07,
-        0x5B, 0xFB, 0x4C, 0x09, 0x64, 0xFB, 0x3C, 0x0B, 0xA4, 0xFD, 0x9C, 0x0B,
-        0x22, 0x00, 0xC3, 0x09, 0x02, 0x02, 0xD1, 0x06, 0xED, 0x04, 0xD0, 0x02,
-        0xD5, 0x08, 0x7C, 0x00, 0xE1, 0x09, 0x33, 0xFF, 0xEE, 0x07, 0x40, 0xFF,
-        0xC4, 0x05, 0x04, 0x00, 0xAA, 0x04, 0x42, 0x01, 0xC5, 0x04, 0x26, 0x03,
-        0x5C, 0x04, 0xB7, 0x03, 0x9F, 0x03, 0xC7, 0x04, 0x8D, 0x01, 0x71, 0x05,
-        0xCF, 0xFD, 0xCF, 0x04, 0x56, 0xFC, 0xAE, 0x02, 0x42, 0xFD, 0x5B, 0xFE,
-        0x99, 0xFF, 0x33, 0xFA, 0xAD, 0x02, 0x91, 0xF7, 0xAC, 0x04, 0xE1, 0xF5,
-        0x79, 0x04, 0xF7, 0xF3, 0x0F, 0x02, 0xA5, 0xF3, 0x69, 0xFF, 0x82, 0xF5,
-        0x5D, 0xFD, 0x99, 0xF8, 0x49, 0xFA, 0x8B, 0xFC, 0x6A, 0xF6, 0x15, 0xFF,
-        0xBD, 0xF5, 0xBC, 0x00, 0xFD, 0xF7, 0x35, 0x01, 0x43, 0xFA, 0x9E, 0x00,
-        0x64, 0xFB, 0x80, 0xFF, 0x48, 0xFB, 0xBF, 0xFD, 0xA9, 0xFB, 0x46, 0xFD,
-        0x73, 0xFC, 0x2E, 0xFC, 0x64, 0xFE, 0x81, 0xFB, 0xD4, 0x01, 0x28, 0xFC,
-        0x35, 0x03, 0x0F, 0xFE, 0x3A, 0x02, 0x4B, 0x02, 0x0E, 0x00, 0x66, 0x06,
-        0x65, 0xFD, 0xDF, 0x08, 0x02, 0xFC, 0x86, 0x0A, 0x94, 0xFC, 0x75, 0x0C,
-        0x16, 0xFF, 0xBA, 0x0C, 0xC9, 0x01, 0xAE, 0x0A, 0xA2, 0x03, 0x5A, 0x07,
-        0x9F, 0x06, 0x49, 0x03, 0x38, 0x0A, 0x7B, 0x00, 0xCE, 0x0A, 0x9F, 0xFE,
-        0x62, 0x08, 0x17, 0xFE, 0xF6, 0x05, 0xA4, 0xFE, 0xC3, 0x04, 0x92, 0xFF,
-        0xBF, 0x04, 0x4C, 0x01, 0x35, 0x04, 0xA6, 0x01, 0x49, 0x03, 0xAA, 0x02,
-        0x64, 0x01, 0x76, 0x03, 0x02, 0xFE, 0xFF, 0x02, 0xBB, 0xFC, 0x71, 0x01,
-        0xBF, 0xFD, 0x88, 0xFD, 0xBF, 0xFF, 0xB5, 0xF9, 0x11, 0x02, 0x72, 0xF7,
-        0x20, 0x03, 0xDE, 0xF5, 0x58, 0x02, 0x13, 0xF4, 0xCA, 0xFF, 0xAC, 0xF3,
-        0x48, 0xFD, 0xB6, 0xF5, 0x7F, 0xFB, 0xF3, 0xF8, 0xAF, 0xF8, 0xCF, 0xFC,
-        0x1C, 0xF5, 0x6D, 0xFF, 0x76, 0xF4, 0x4F, 0x01, 0xE8, 0xF6, 0xCA, 0x01,
-        0x8F, 0xF9, 0x6C, 0x01, 0xE4, 0xFA, 0xAB, 0x00, 0x09, 0xFB, 0x13, 0xFF,
-        0xB0, 0xFB, 0xB6, 0xFE, 0x76, 0xFC, 0xA8, 0xFD, 0x35, 0xFE, 0xAE, 0xFC,
-        0x84, 0x01, 0xFA, 0xFC, 0xE1, 0x02, 0x41, 0xFE, 0x14, 0x02, 0x1B, 0x02,
-        0x7E, 0x00, 0xB4, 0x05, 0x60, 0xFE, 0xCD, 0x07, 0x5B, 0xFD, 0x21, 0x09,
-        0x14, 0xFE, 0xD2, 0x0A, 0x63, 0x00, 0x48, 0x0B, 0x85, 0x02, 0x5A, 0x09,
-        0x16, 0x04, 0x38, 0x06, 0xC5, 0x06, 0x86, 0x02, 0x5A, 0x0A, 0x09, 0x00,
-        0x2D, 0x0B, 0x40, 0xFE, 0xCC, 0x08, 0xB9, 0xFD, 0x23, 0x06, 0x01, 0xFE,
-        0xCB, 0x04, 0xCE, 0xFE, 0xAB, 0x04, 0x86, 0x00, 0x38, 0x04, 0x0C, 0x01,
-        0x9F, 0x03, 0x4E, 0x02, 0x02, 0x02, 0x3A, 0x03, 0xC1, 0xFE, 0xE7, 0x02,
-        0x6D, 0xFD, 0x7A, 0x01, 0xC6, 0xFD, 0x98, 0xFD, 0x3D, 0xFF, 0x06, 0xFA,
-        0x63, 0x01, 0x39, 0xF8, 0x8B, 0x02, 0x4F, 0xF7, 0xE7, 0x01, 0xC7, 0xF5,
-        0xEB, 0xFF, 0x59, 0xF5, 0xF4, 0xFD, 0x2C, 0xF7, 0x6D, 0xFC, 0x55, 0xFA,
-        0xF6, 0xF9, 0xD9, 0xFD, 0x69, 0xF6, 0x3C, 0x00, 0x7F, 0xF5, 0xF9, 0x01,
-        0xD9, 0xF7, 0x64, 0x02, 0x6D, 0xFA, 0x0C, 0x02, 0x97, 0xFB, 0x1D, 0x01,
-        0x90, 0xFB, 0x4F, 0xFF, 0xFD, 0xFB, 0xAA, 0xFE, 0x8A, 0xFC, 0x97, 0xFD,
-        0x34, 0xFE, 0xD1, 0xFC, 0x48, 0x01, 0x53, 0xFD, 0xB1, 0x02, 0xF3, 0xFE,
-        0x76, 0x02, 0xD4, 0x02, 0x0F, 0x01, 0x3E, 0x06, 0xCE, 0xFE, 0xAD, 0x07,
-        0xA8, 0xFD, 0x89, 0x08, 0x51, 0xFE, 0x0C, 0x0A, 0x2B, 0x00, 0xBC, 0x0A,
-        0x1A, 0x02, 0xF7, 0x08, 0x8A, 0x03, 0xB5, 0x05, 0xFB, 0x05, 0x2B, 0x02,
-        0x69, 0x09, 0xBB, 0xFF, 0x4E, 0x0A, 0x09, 0xFE, 0xFF, 0x07, 0xB6, 0xFD,
-        0x73, 0x05, 0x3F, 0xFE, 0x7B, 0x04, 0x5A, 0xFF, 0x80, 0x04, 0x23, 0x01,
-        0xDD, 0x03, 0x92, 0x01, 0x25, 0x03, 0x4C, 0x02, 0x86, 0x01, 0xCC, 0x02,
-        0x86, 0xFE, 0xF1, 0x01, 0x19, 0xFD, 0x20, 0x00, 0x4D, 0xFD, 0x36, 0xFC,
-        0x9D, 0xFE, 0x09, 0xF9, 0xD2, 0x00, 0x01, 0xF8, 0xF2, 0x01, 0x6E, 0xF7,
-        0x53, 0x01, 0xFA, 0xF5, 0x8F, 0xFF, 0x55, 0xF5, 0xD1, 0xFD, 0x30, 0xF7,
-        0x67, 0xFC, 0x62, 0xFA, 0xCF, 0xF9, 0xC3, 0xFD, 0x65, 0xF6, 0x20, 0x00,
-        0x99, 0xF5, 0xA3, 0x01, 0xF6, 0xF7, 0xE3, 0x01, 0x79, 0xFA, 0x68, 0x01,
-        0x7C, 0xFB, 0x43, 0x00, 0x9E, 0xFB, 0x86, 0xFE, 0x6B, 0xFC, 0x30, 0xFE,
-        0x33, 0xFD, 0x60, 0xFD, 0xE1, 0xFE, 0xB2, 0xFC, 0xA9, 0x01, 0x80, 0xFD,
-        0xF7, 0x02, 0x6D, 0xFF, 0xE1, 0x02, 0x48, 0x03, 0xA4, 0x01, 0x5F, 0x06,
-        0x6E, 0xFF, 0x69, 0x07, 0x72, 0xFE, 0x08, 0x08, 0x1A, 0xFF, 0x9F, 0x09,
-        0xA8, 0x00, 0x5A, 0x0A, 0x3C, 0x02, 0x92, 0x08, 0xBD, 0x03, 0x73, 0x05,
-        0x6F, 0x06, 0x28, 0x02, 0xC3, 0x09, 0xED, 0xFF, 0x77, 0x0A, 0x81, 0xFE,
-        0x0F, 0x08, 0x30, 0xFE, 0x81, 0x05, 0xA1, 0xFE, 0x8A, 0x04, 0xD2, 0xFF,
-        0x7B, 0x04, 0x93, 0x01, 0xC2, 0x03, 0x0F, 0x02, 0xEF, 0x02, 0x0E, 0x03,
-        0x2E, 0x01, 0xCF, 0x03, 0x78, 0xFE, 0x04, 0x03, 0x36, 0xFD, 0xFA, 0x00,
-        0x27, 0xFD, 0x0F, 0xFD, 0x84, 0xFE, 0x05, 0xFA, 0xA4, 0x00, 0xE2, 0xF8,
-        0x7E, 0x01, 0x0F, 0xF8, 0xF3, 0x00, 0x6B, 0xF6, 0x83, 0xFF, 0xB8, 0xF5,
-        0x1C, 0xFE, 0x68, 0xF7, 0xA6, 0xFC, 0x78, 0xFA, 0xF3, 0xF9, 0xD4, 0xFD,
-        0xAD, 0xF6, 0xEB, 0xFF, 0xEE, 0xF5, 0x43, 0x01, 0x3D, 0xF8, 0xBA, 0x01,
-        0xAC, 0xFA, 0x67, 0x01, 0x77, 0xFB, 0x49, 0x00, 0x77, 0xFB, 0x9E, 0xFE,
-        0x25, 0xFC, 0x12, 0xFE, 0x3D, 0xFD, 0xE4, 0xFC, 0x52, 0xFF, 0x1B, 0xFC,
-        0x38, 0x02, 0xC8, 0xFC, 0x82, 0x03, 0xB0, 0xFE, 0x4D, 0x03, 0x58, 0x02,
-        0x83, 0x01, 0x40, 0x05, 0x1F, 0xFF, 0x50, 0x06, 0x1B, 0xFE, 0x34, 0x07,
-        0x62, 0xFE, 0xE1, 0x08, 0xC5, 0xFF, 0x95, 0x09, 0x15, 0x01, 0xFC, 0x07,
-        0x73, 0x02, 0x08, 0x05, 0x43, 0x05, 0xD8, 0x01, 0xBA, 0x08, 0xFD, 0xFF,
-        0xCD, 0x09, 0xFD, 0xFE, 0xAB, 0x07, 0xAE, 0xFE, 0x53, 0x05, 0xDA, 0xFE,
-        0x73, 0x04, 0xCF, 0xFF, 0x42, 0x04, 0x3C, 0x01, 0x6E, 0x03, 0x94, 0x01,
-        0x2C, 0x02, 0x95, 0x02, 0xD3, 0xFF, 0x66, 0x03, 0xE7, 0xFC, 0xD5, 0x02,
-        0xEF, 0xFB, 0x48, 0x01, 0x8B, 0xFC, 0x08, 0xFE, 0xC1, 0xFE, 0x65, 0xFB,
-        0x65, 0x01, 0x55, 0xFA, 0x93, 0x02, 0x43, 0xF9, 0x42, 0x02, 0x78, 0xF7,
-        0xDF, 0x00, 0xB4, 0xF6, 0xBD, 0xFF, 0x40, 0xF8, 0x66, 0xFE, 0x2D, 0xFB,
-        0x83, 0xFB, 0x50, 0xFE, 0xF4, 0xF7, 0xFB, 0xFF, 0x9F, 0xF6, 0xC9, 0x00,
-        0x83, 0xF8, 0x33, 0x01, 0xE0, 0xFA, 0x46, 0x01, 0xA1, 0xFB, 0x80, 0x00,
-        0xBE, 0xFB, 0x3A, 0xFF, 0x83, 0xFC, 0xF0, 0xFE, 0xB3, 0xFD, 0xC5, 0xFD,
-        0x00, 0x00, 0xC2, 0xFC, 0xD0, 0x02, 0x28, 0xFD, 0xDF, 0x03, 0xA8, 0xFE,
-        0x53, 0x03, 0xF7, 0x01, 0x2B, 0x01, 0xAA, 0x04, 0xAA, 0xFE, 0xBF, 0x05,
-        0x75, 0xFD, 0xD1, 0x06, 0xBC, 0xFD, 0x54, 0x08, 0xE4, 0xFE, 0xBE, 0x08,
-        0xC9, 0xFF, 0x01, 0x07, 0x03, 0x01, 0x03, 0x04, 0x00, 0x04, 0x0F, 0x01,
-        0xBE, 0x07, 0xBB, 0xFF, 0x36, 0x09, 0x43, 0xFF, 0x7A, 0x07, 0xE9, 0xFE,
-        0x3B, 0x05, 0xCF, 0xFE, 0x8D, 0x04, 0xA1, 0xFF, 0x6F, 0x04, 0xE1, 0x00,
-        0xA7, 0x03, 0x38, 0x01, 0x8F, 0x02, 0x86, 0x02, 0x47, 0x00, 0x8C, 0x03,
-        0x97, 0xFD, 0x0C, 0x03, 0x76, 0xFC, 0x58, 0x01, 0xF3, 0xFC, 0xED, 0xFD,
-        0x02, 0xFF, 0x67, 0xFB, 0x55, 0x01, 0x79, 0xFA, 0x7D, 0x02, 0xAD, 0xF9,
-        0x4B, 0x02, 0x64, 0xF8, 0x2C, 0x01, 0x0A, 0xF8, 0x4E, 0x00, 0xAF, 0xF9,
-        0x0A, 0xFF, 0x87, 0xFC, 0x01, 0xFC, 0x12, 0xFF, 0x21, 0xF8, 0x1B, 0x00,
-        0xB6, 0xF6, 0x94, 0x00, 0x7A, 0xF8, 0xDA, 0x00, 0x6D, 0xFA, 0x09, 0x01,
-        0xCC, 0xFA, 0x6F, 0x00, 0xD6, 0xFA, 0x5F, 0xFF, 0xB8, 0xFB, 0x28, 0xFF,
-        0xEA, 0xFC, 0xDF, 0xFD, 0x4A, 0xFF, 0xF7, 0xFC, 0xFF, 0x01, 0x61, 0xFD,
-        0x1C, 0x03, 0x46, 0xFF, 0x7A, 0x02, 0xBF, 0x02, 0x78, 0x00, 0x3E, 0x05,
-        0x63, 0xFE, 0x43, 0x06, 0x54, 0xFD, 0x31, 0x07, 0xB6, 0xFD, 0x61, 0x08,
-        0xCD, 0xFE, 0x91, 0x08, 0x8C, 0xFF, 0xCD, 0x06, 0xD7, 0x00, 0xD5, 0x03,
-        0xE5, 0x03, 0x31, 0x01, 0xAA, 0x07, 0xFC, 0xFF, 0x04, 0x09, 0x6F, 0xFF,
-        0x9D, 0x07, 0x35, 0xFF, 0x11, 0x06, 0xFD, 0xFE, 0xFB, 0x05, 0x8D, 0xFF,
-        0xFC, 0x05, 0x4D, 0x00, 0x10, 0x05, 0x5D, 0x00, 0xC7, 0x03, 0x95, 0x01,
-        0x4E, 0x01, 0x84, 0x02, 0x85, 0xFE, 0x37, 0x02, 0x76, 0xFD, 0x7D, 0x00,
-        0x2A, 0xFE, 0x2D, 0xFD, 0x03, 0x00, 0xCC, 0xFA, 0xCE, 0x01, 0xB9, 0xF9,
-        0xB9, 0x02, 0xB7, 0xF8, 0x5B, 0x02, 0x94, 0xF7, 0x89, 0x01, 0x8C, 0xF7,
-        0xFB, 0x00, 0x5B, 0xF9, 0xC0, 0xFF, 0x32, 0xFC, 0x99, 0xFC, 0xD6, 0xFE,
-        0x97, 0xF8, 0x48, 0x00, 0xE8, 0xF6, 0xEC, 0x00, 0xE9, 0xF7, 0x36, 0x01,
-        0x39, 0xF9, 0x64, 0x01, 0x3C, 0xF9, 0xD8, 0x00, 0x3F, 0xF9, 0x1E, 0x00,
-        0x3D, 0xFA, 0xFB, 0xFF, 0x8D, 0xFB, 0x8C, 0xFE, 0x24, 0xFE, 0x83, 0xFD,
-        0x04, 0x01, 0x90, 0xFD, 0x0F, 0x02, 0xF2, 0xFE, 0x35, 0x01, 0x1C, 0x02,
-        0x61, 0xFF, 0xC8, 0x04, 0xAF, 0xFD, 0x5D, 0x06, 0x09, 0xFD, 0xCA, 0x07,
-        0x9A, 0xFD, 0x23, 0x09, 0x7C, 0xFE, 0x64, 0x09, 0x36, 0xFF, 0xAA, 0x07,
-        0x8D, 0x00, 0xE1, 0x04, 0xD0, 0x03, 0x24, 0x02, 0xE2, 0x07, 0x5E, 0x00,
-        0xBB, 0x09, 0x4D, 0xFF, 0xE5, 0x08, 0xAC, 0xFE, 0xA8, 0x07, 0x75, 0xFE,
-        0x99, 0x07, 0xEB, 0xFE, 0x7B, 0x07, 0x8F, 0xFF, 0x6C, 0x06, 0xC2, 0xFF,
-        0xD3, 0x04, 0x0C, 0x01, 0x05, 0x02, 0x13, 0x02, 0xF1, 0xFE, 0x3C, 0x02,
-        0xEA, 0xFD, 0x42, 0x01, 0xDC, 0xFE, 0x1F, 0xFE, 0xA7, 0x00, 0x7E, 0xFB,
-        0x6A, 0x02, 0xA8, 0xF9, 0x09, 0x03, 0xEE, 0xF7, 0x81, 0x02, 0x7C, 0xF6,
-        0x8E, 0x01, 0x38, 0xF6, 0xCD, 0x00, 0x07, 0xF8, 0x83, 0xFF, 0xCB, 0xFA,
-        0x17, 0xFC, 0xBE, 0xFD, 0xD4, 0xF7, 0xA0, 0xFF, 0xCE, 0xF5, 0xD2, 0x00,
-        0x67, 0xF6, 0x7C, 0x01, 0x9B, 0xF7, 0xBE, 0x01, 0xEC, 0xF7, 0x54, 0x01,
-        0x4A, 0xF8, 0xB3, 0x00, 0x9E, 0xF9, 0x90, 0x00, 0x7F, 0xFB, 0x8A, 0xFF,
-        0x47, 0xFE, 0xA6, 0xFE, 0x2A, 0x01, 0x58, 0xFE, 0x13, 0x02, 0x34, 0xFF,
-        0x2C, 0x01, 0x1D, 0x02, 0x42, 0xFF, 0x99, 0x04, 0x58, 0xFD, 0x53, 0x06,
-        0x90, 0xFC, 0x0E, 0x08, 0xF0, 0xFC, 0x74, 0x09, 0xCB, 0xFD, 0x74, 0x09,
-        0xB3, 0xFE, 0x66, 0x07, 0x33, 0x00, 0x8B, 0x04, 0xD8, 0x03, 0xB6, 0x01,
-        0x54, 0x08, 0x04, 0x00, 0x7A, 0x0A, 0x0E, 0xFF, 0xF8, 0x09, 0x7C, 0xFE,
-        0xBB, 0x08, 0x39, 0xFE, 0x61, 0x08, 0x8C, 0xFE, 0xC7, 0x07, 0x28, 0xFF,
-        0x40, 0x06, 0x4F, 0xFF, 0x6A, 0x04, 0x29, 0x00, 0xC9, 0x01, 0xEB, 0x00,
-        0x1C, 0xFF, 0x35, 0x01, 0x46, 0xFE, 0x5C, 0x00, 0x01, 0xFF, 0x8B, 0xFD,
-        0xAF, 0x00, 0x29, 0xFB, 0x7F, 0x02, 0x7D, 0xF9, 0x1C, 0x03, 0xB6, 0xF7,
-        0xAC, 0x02, 0x48, 0xF6, 0xC8, 0x01, 0x77, 0xF6, 0xC9, 0x00, 0xBE, 0xF8,
-        0x59, 0xFF, 0xD6, 0xFB, 0xF9, 0xFB, 0xBF, 0xFE, 0xD0, 0xF7, 0x4D, 0x00,
-        0xCA, 0xF5, 0x3E, 0x01, 0x59, 0xF6, 0xC8, 0x01, 0x7D, 0xF7, 0xC5, 0x01,
-        0x9A, 0xF7, 0x48, 0x01, 0x0B, 0xF8, 0x9D, 0x00, 0xAD, 0xF9, 0x7C, 0x00,
-        0x83, 0xFB, 0xBA, 0xFF, 0x24, 0xFE, 0x19, 0xFF, 0xCB, 0x00, 0xFA, 0xFE,
-        0xE7, 0x01, 0xDC, 0xFF, 0x9E, 0x01, 0xB6, 0x02, 0x20, 0x00, 0x0D, 0x05,
-        0x72, 0xFE, 0xB6, 0x06, 0x11, 0xFE, 0x83, 0x08, 0x6A, 0xFE, 0xDF, 0x09,
-        0x0D, 0xFF, 0x69, 0x09, 0xBE, 0xFF, 0xF0, 0x06, 0xE9, 0x00, 0xCE, 0x03,
-        0xF8, 0x03, 0xE1, 0x00, 0xBA, 0x07, 0x51, 0xFF, 0x87, 0x09, 0x83, 0xFE,
-        0xDA, 0x08, 0x22, 0xFE, 0xC1, 0x07, 0x5A, 0xFE, 0xB6, 0x07, 0xC8, 0xFE,
-        0x4C, 0x07, 0x5B, 0xFF, 0xBC, 0x05, 0x39, 0xFF, 0x04, 0x04, 0xC2, 0xFF,
-        0x72, 0x01, 0x73, 0x00, 0xCE, 0xFE, 0xAD, 0x00, 0x9D, 0xFD, 0xEC, 0xFF,
-        0xC7, 0xFD, 0x24, 0xFD, 0x62, 0xFF, 0xF1, 0xFA, 0xF6, 0x00, 0x61, 0xF9,
-        0x6D, 0x01, 0xBB, 0xF7, 0x4F, 0x01, 0x8A, 0xF6, 0xF1, 0x00, 0xF1, 0xF6,
-        0x56, 0x00, 0x3D, 0xF9, 0x4E, 0xFF, 0x05, 0xFC, 0x76, 0xFC, 0xD9, 0xFE,
-        0xC5, 0xF8, 0x68, 0x00, 0xF7, 0xF6, 0x67, 0x01, 0x9E, 0xF7, 0xC2, 0x01,
-        0xAC, 0xF8, 0x99, 0x01, 0x85, 0xF8, 0x4D, 0x01, 0xBF, 0xF8, 0xC5, 0x00,
-        0x39, 0xFA, 0x18, 0x01, 0x00, 0xFC, 0x9A, 0x00, 0xAD, 0xFE, 0xB4, 0xFF,
-        0x75, 0x01, 0x5A, 0xFF, 0xB5, 0x02, 0xFE, 0xFF, 0x8A, 0x02, 0x9E, 0x02,
-        0xD1, 0x00, 0xBF, 0x04, 0x0D, 0xFF, 0x57, 0x06, 0x79, 0xFE, 0xEE, 0x07,
-        0x9C, 0xFE, 0x33, 0x09, 0x2D, 0xFF, 0x14, 0x09, 0xC7, 0xFF, 0x42, 0x07,
-        0xD6, 0x00, 0xAE, 0x04, 0x98, 0x03, 0xE3, 0x01, 0x22, 0x07, 0x59, 0x00,
-        0xD0, 0x08, 0x3A, 0xFF, 0x36, 0x08, 0xAC, 0xFE, 0x54, 0x07, 0xA5, 0xFE,
-        0xBB, 0x07, 0xDF, 0xFE, 0xA0, 0x07, 0x41, 0xFF, 0x1A, 0x06, 0xB0, 0xFE,
-        0x36, 0x04, 0x2B, 0xFF, 0x5D, 0x01, 0x11, 0x00, 0x8C, 0xFE, 0x8E, 0x00,
-        0x4F, 0xFD, 0x04, 0x00, 0x8A, 0xFD, 0x79, 0xFD, 0x5A, 0xFF, 0x2E, 0xFB,
-        0x26, 0x01, 0x6C, 0xF9, 0xB8, 0x01, 0x97, 0xF7, 0x80, 0x01, 0xFD, 0xF5,
-        0xBE, 0x00, 0xF6, 0xF5, 0xD9, 0xFF, 0xBA, 0xF7, 0xB1, 0xFE, 0x68, 0xFA,
-        0x23, 0xFC, 0x49, 0xFD, 0xCD, 0xF8, 0x1E, 0xFF, 0x2C, 0xF7, 0x77, 0x00,
-        0x00, 0xF8, 0x54, 0x01, 0xFD, 0xF8, 0xAD, 0x01, 0x79, 0xF8, 0x9F, 0x01,
-        0x81, 0xF8, 0x43, 0x01, 0xE3, 0xF9, 0xA0, 0x01, 0xA1, 0xFB, 0x26, 0x01,
-        0x2B, 0xFE, 0x26, 0x00, 0x9B, 0x00, 0x86, 0xFF, 0xBB, 0x01, 0xE5, 0xFF,
-        0x9A, 0x01, 0x8F, 0x02, 0xF9, 0xFF, 0x0D, 0x05, 0x3E, 0xFE, 0x08, 0x07,
-        0xB8, 0xFD, 0x1D, 0x09, 0x19, 0xFE, 0xCE, 0x0A, 0x29, 0xFF, 0xD0, 0x0A,
-        0x5A, 0x00, 0xC7, 0x08, 0xC5, 0x01, 0xC2, 0x05, 0x65, 0x04, 0xB9, 0x02,
-        0xBD, 0x07, 0xBB, 0x00, 0x45, 0x09, 0x3B, 0xFF, 0x5D, 0x08, 0x3A, 0xFE,
-        0x5E, 0x07, 0xDF, 0xFD, 0x0A, 0x08, 0x30, 0xFE, 0x1C, 0x08, 0xE7, 0xFE,
-        0xB7, 0x06, 0xC5, 0xFE, 0x0F, 0x05, 0x54, 0xFF, 0x9D, 0x02, 0x58, 0x00,
-        0x6F, 0x00, 0xF5, 0x00, 0x64, 0xFF, 0x89, 0x00, 0x9B, 0xFF, 0xDF, 0xFD,
-        0x3C, 0x01, 0x58, 0xFB, 0xEC, 0x02, 0x50, 0xF9, 0x66, 0x03, 0x54, 0xF7,
-        0xAA, 0x02, 0xCD, 0xF5, 0x36, 0x01, 0xC9, 0xF5, 0xB1, 0xFF, 0xE7, 0xF7,
-        0x21, 0xFE, 0xF9, 0xFA, 0x5D, 0xFB, 0xE5, 0xFD, 0x24, 0xF8, 0xD2, 0xFF,
-        0xC0, 0xF6, 0x30, 0x01, 0x9C, 0xF7, 0x1D, 0x02, 0xAF, 0xF8, 0x48, 0x02,
-        0x1C, 0xF8, 0x95, 0x01, 0x31, 0xF8, 0xA2, 0x00, 0x98, 0xF9, 0xC2, 0x00,
-        0x58, 0xFB, 0x22, 0x00, 0xAC, 0xFD, 0x16, 0xFF, 0x9A, 0xFF, 0x73, 0xFE,
-        0x65, 0x00, 0xF7, 0xFE, 0x12, 0x00, 0x90, 0x01, 0x6B, 0xFE, 0x30, 0x04,
-        0xB7, 0xFC, 0x3E, 0x06, 0x49, 0xFC, 0x2A, 0x08, 0x2F, 0xFD, 0x9B, 0x09,
-        0xBB, 0xFE, 0x83, 0x09, 0x43, 0x00, 0x2E, 0x07, 0xCF, 0x01, 0x1C, 0x04,
-        0x94, 0x04, 0x3A, 0x01, 0xDC, 0x07, 0x52, 0xFF, 0x49, 0x09, 0x39, 0xFE,
-        0x4F, 0x08, 0xA9, 0xFD, 0x2E, 0x07, 0xB4, 0xFD, 0xBB, 0x07, 0x82, 0xFE,
-        0xAF, 0x07, 0xA8, 0xFF, 0x63, 0x06, 0xCD, 0xFF, 0xC1, 0x04, 0x70, 0x00,
-        0x6D, 0x02, 0x75, 0x01, 0x7D, 0x00, 0x17, 0x02, 0xB5, 0xFF, 0x8C, 0x01,
-        0x03, 0x00, 0xAF, 0xFE, 0xA6, 0x01, 0xE9, 0xFB, 0x4E, 0x03, 0xCA, 0xF9,
-        0xA0, 0x03, 0xF3, 0xF7, 0xB5, 0x02, 0x98, 0xF6, 0x1C, 0x01, 0xCF, 0xF6,
-        0x65, 0xFF, 0x26, 0xF9, 0xB0, 0xFD, 0x1D, 0xFC, 0xE8, 0xFA, 0xBD, 0xFE,
-        0xBA, 0xF7, 0x65, 0x00, 0x46, 0xF6, 0x55, 0x01, 0x4B, 0xF7, 0xE3, 0x01,
-        0x55, 0xF8, 0xD8, 0x01, 0xB7, 0xF7, 0xFF, 0x00, 0xA5, 0xF7, 0xD2, 0xFF,
-        0xFF, 0xF8, 0x8E, 0xFF, 0xD7, 0xFA, 0x01, 0xFF, 0x7A, 0xFD, 0x57, 0xFE,
-        0x72, 0xFF, 0xD4, 0xFD, 0x38, 0x00, 0x7E, 0xFE, 0x18, 0x00, 0x5E, 0x01,
-        0xAE, 0xFE, 0x18, 0x04, 0x10, 0xFD, 0x31, 0x06, 0xBA, 0xFC, 0x16, 0x08,
-        0xA5, 0xFD, 0x84, 0x09, 0x93, 0xFF, 0x85, 0x09, 0x96, 0x01, 0x64, 0x07,
-        0x63, 0x03, 0x69, 0x04, 0x11, 0x06, 0xA3, 0x01, 0x0E, 0x09, 0xD7, 0xFF,
-        0x55, 0x0A, 0xC6, 0xFE, 0x3F, 0x09, 0x2D, 0xFE, 0x4A, 0x08, 0x21, 0xFE,
-        0xE2, 0x08, 0xF4, 0xFE, 0xC8, 0x08, 0x1A, 0x00, 0x50, 0x07, 0x6C, 0x00,
-        0x51, 0x05, 0xC6, 0x00, 0xB2, 0x02, 0x32, 0x01, 0xAD, 0x00, 0xBC, 0x01,
-        0xC2, 0xFF, 0x2E, 0x01, 0xA2, 0xFF, 0x79, 0xFE, 0xCD, 0x00, 0xC3, 0xFB,
-        0x46, 0x02, 0x9D, 0xF9, 0x91, 0x02, 0xB3, 0xF7, 0x8E, 0x01, 0x44, 0xF6,
-        0x69, 0xFF, 0x4D, 0xF6, 0x1E, 0xFD, 0x8F, 0xF8, 0x54, 0xFB, 0xDA, 0xFB,
-        0xF0, 0xF8, 0xC6, 0xFE, 0x42, 0xF6, 0x96, 0x00, 0xE1, 0xF4, 0x8B, 0x01,
-        0xAF, 0xF5, 0x0E, 0x02, 0x95, 0xF6, 0x09, 0x02, 0xFF, 0xF5, 0x41, 0x01,
-        0x11, 0xF6, 0xFF, 0xFF, 0x95, 0xF7, 0x87, 0xFF, 0xD8, 0xF9, 0x37, 0xFF,
-        0xA5, 0xFC, 0xCA, 0xFE, 0xC4, 0xFE, 0x38, 0xFE, 0xCF, 0xFF, 0xA3, 0xFE,
-        0x42, 0x00, 0x72, 0x01, 0x57, 0xFF, 0x40, 0x04, 0xD2, 0xFD, 0x46, 0x06,
-        0x85, 0xFD, 0xEA, 0x07, 0x91, 0xFE, 0x1E, 0x09, 0xE9, 0x00, 0x12, 0x09,
-        0x2E, 0x03, 0xC9, 0x06, 0xD3, 0x04, 0x76, 0x03, 0x24, 0x07, 0x76, 0x00,
-        0xEB, 0x09, 0x95, 0xFE, 0x7F, 0x0B, 0xB9, 0xFD, 0xC4, 0x0A, 0x6E, 0xFD,
-        0xD9, 0x09, 0xB1, 0xFD, 0x48, 0x0A, 0xBB, 0xFE, 0x12, 0x0A, 0x11, 0x00,
-        0x73, 0x08, 0x76, 0x00, 0x44, 0x06, 0xB7, 0x00, 0x6A, 0x03, 0x1E, 0x01,
-        0x24, 0x01, 0xD0, 0x01, 0xEA, 0xFF, 0x71, 0x01, 0x3D, 0xFF, 0x9E, 0xFE,
-        0x28, 0x00, 0xD1, 0xFB, 0xA7, 0x01, 0xDA, 0xF9, 0xE6, 0x01, 0x47, 0xF8,
-        0xC2, 0x00, 0xF1, 0xF6, 0x5B, 0xFE, 0xED, 0xF6, 0x27, 0xFC, 0x33, 0xF9,
-        0xBC, 0xFA, 0x9B, 0xFC, 0x8B, 0xF8, 0xDA, 0xFF, 0xA9, 0xF5, 0xDA, 0x01,
-        0x0E, 0xF4, 0x98, 0x02, 0xD9, 0xF4, 0x96, 0x02, 0xD4, 0xF5, 0x37, 0x02,
-        0x75, 0xF5, 0x28, 0x01, 0xB6, 0xF5, 0xE5, 0xFF, 0x31, 0xF7, 0xAB, 0xFF,
-        0x55, 0xF9, 0x69, 0xFF, 0x59, 0xFC, 0xEB, 0xFE, 0xE1, 0xFE, 0x0F, 0xFE,
-        0x34, 0x00, 0x57, 0xFE, 0xFF, 0x00, 0x4B, 0x01, 0x3D, 0x00, 0x47, 0x04,
-        0xEA, 0xFE, 0x59, 0x06, 0xDA, 0xFE, 0xF3, 0x07, 0xE9, 0xFF, 0x2E, 0x09,
-        0x19, 0x02, 0x24, 0x09, 0x08, 0x04, 0xC8, 0x06, 0x2C, 0x05, 0x5F, 0x03,
-        0x32, 0x07, 0x3C, 0x00, 0x33, 0x0A, 0x2F, 0xFE, 0x0A, 0x0C, 0x6C, 0xFD,
-        0x57, 0x0B, 0x75, 0xFD, 0x4B, 0x0A, 0xE8, 0xFD, 0xA8, 0x0A, 0xF7, 0xFE,
-        0x4E, 0x0A, 0x16, 0x00, 0xB6, 0x08, 0x47, 0x00, 0x86, 0x06, 0x73, 0x00,
-        0xBF, 0x03, 0xCB, 0x00, 0x5B, 0x01, 0xA6, 0x01, 0xF4, 0xFF, 0x53, 0x01,
-        0xEE, 0xFE, 0x73, 0xFE, 0x97, 0xFF, 0x69, 0xFB, 0xF9, 0x00, 0x7B, 0xF9,
-        0x26, 0x01, 0x05, 0xF8, 0x52, 0x00, 0xDB, 0xF6, 0x78, 0xFE, 0xE0, 0xF6,
-        0xB8, 0xFC, 0x32, 0xF9, 0x9C, 0xFB, 0xAD, 0xFC, 0xA6, 0xF9, 0xD9, 0xFF,
-        0xD2, 0xF6, 0x04, 0x02, 0x0D, 0xF5, 0xE1, 0x02, 0x9F, 0xF5, 0xCA, 0x02,
-        0x7C, 0xF6, 0x51, 0x02, 0x2C, 0xF6, 0x42, 0x01, 0x6E, 0xF6, 0x33, 0x00,
-        0xCB, 0xF7, 0xFC, 0xFF, 0x84, 0xF9, 0xC9, 0xFF, 0x3B, 0xFC, 0x5C, 0xFF,
-        0xA1, 0xFE, 0x79, 0xFE, 0x0D, 0x00, 0xBF, 0xFE, 0x0A, 0x01, 0x66, 0x01,
-        0x61, 0x00, 0x3A, 0x04, 0xFB, 0xFE, 0x31, 0x06, 0xA9, 0xFE, 0xA9, 0x07,
-        0x74, 0xFF, 0xAF, 0x08, 0x75, 0x01, 0x6D, 0x08, 0x26, 0x03, 0x0F, 0x06,
-        0x36, 0x04, 0x94, 0x02, 0xF3, 0x05, 0x79, 0xFF, 0xAC, 0x08, 0x55, 0xFD,
-        0x5E, 0x0A, 0x9A, 0xFC, 0xEE, 0x09, 0xDA, 0xFC, 0x23, 0x09, 0x7A, 0xFD,
-        0x83, 0x09, 0xAA, 0xFE, 0x51, 0x09, 0xF2, 0xFF, 0xF0, 0x07, 0x5B, 0x00,
-        0x36, 0x06, 0x8E, 0x00, 0x8F, 0x03, 0xDD, 0x00, 0x2B, 0x01, 0x93, 0x01,
-        0xC0, 0xFF, 0x34, 0x01, 0xC6, 0xFE, 0x8C, 0xFE, 0x74, 0xFF, 0xAA, 0xFB,
-        0xB4, 0x00, 0xA9, 0xF9, 0x01, 0x01, 0x61, 0xF8, 0x5E, 0x00, 0xA2, 0xF7,
-        0xA1, 0xFE, 0xF2, 0xF7, 0xFF, 0xFC, 0x48, 0xFA, 0xCF, 0xFB, 0x96, 0xFD,
-        0x0C, 0xFA, 0xC5, 0x00, 0x6C, 0xF7, 0x17, 0x03, 0xB6, 0xF5, 0xD6, 0x03,
-        0x3A, 0xF6, 0x5F, 0x03, 0x30, 0xF7, 0x6F, 0x02, 0xFB, 0xF6, 0x08, 0x01,
-        0x33, 0xF7, 0xA0, 0xFF, 0x7B, 0xF8, 0x40, 0xFF, 0x21, 0xFA, 0x26, 0xFF,
-        0xD6, 0xFC, 0xD4, 0xFE, 0x71, 0xFF, 0x40, 0xFE, 0x01, 0x01, 0xCF, 0xFE,
-        0xF8, 0x01, 0xB9, 0x01, 0x23, 0x01, 0xC0, 0x04, 0xC6, 0xFF, 0xBB, 0x06,
-        0x46, 0xFF, 0xF5, 0x07, 0xD6, 0xFF, 0x96, 0x08, 0xA4, 0x01, 0x30, 0x08,
-        0x67, 0x03, 0xE4, 0x05, 0xA7, 0x04, 0x99, 0x02, 0x57, 0x06, 0x44, 0xFF,
-        0xF7, 0x08, 0xC1, 0xFC, 0x76, 0x0A, 0x0D, 0xFC, 0xCC, 0x09, 0xCB, 0xFC,
-        0xD6, 0x08, 0xFC, 0xFD, 0x15, 0x09, 0x87, 0xFF, 0xE6, 0x08, 0xF9, 0x00,
-        0xA0, 0x07, 0x78, 0x01, 0xD6, 0x05, 0x9B, 0x01, 0xCB, 0x02, 0xF2, 0x01,
-        0x05, 0x00, 0x44, 0x02, 0x70, 0xFE, 0x69, 0x01, 0xCB, 0xFD, 0x49, 0xFE,
-        0xFC, 0xFE, 0x2A, 0xFB, 0x68, 0x00, 0x1B, 0xF9, 0xCD, 0x00, 0xEC, 0xF7,
-        0x20, 0x00, 0x6D, 0xF7, 0x70, 0xFE, 0xE3, 0xF7, 0xBB, 0xFC, 0x2B, 0xFA,
-        0x94, 0xFB, 0x96, 0xFD, 0xEC, 0xF9, 0x1C, 0x01, 0x62, 0xF7, 0xBB, 0x03,
-        0xC3, 0xF5, 0x73, 0x04, 0x3F, 0xF6, 0x89, 0x03, 0x1A, 0xF7, 0xF7, 0x01,
-        0xF2, 0xF6, 0x4E, 0x00, 0x38, 0xF7, 0xD3, 0xFE, 0x85, 0xF8, 0x61, 0xFE,
-        0x53, 0xFA, 0x67, 0xFE, 0x42, 0xFD, 0x32, 0xFE, 0xD2, 0xFF, 0x16, 0xFE,
-        0x74, 0x01, 0x0D, 0xFF, 0xF8, 0x01, 0x1C, 0x02, 0x9C, 0x00, 0x27, 0x05,
-        0x2A, 0xFF, 0x39, 0x07, 0xDC, 0xFE, 0x94, 0x08, 0x85, 0xFF, 0xFC, 0x08,
-        0x30, 0x01, 0x81, 0x08, 0xDD, 0x02, 0x06, 0x06, 0xF3, 0x03, 0x5E, 0x02,
-        0x6D, 0x05, 0xCA, 0xFE, 0xE0, 0x07, 0x50, 0xFC, 0xBB, 0x09, 0xCF, 0xFB,
-        0x7A, 0x09, 0xD8, 0xFC, 0xA5, 0x08, 0x58, 0xFE, 0xB9, 0x08, 0xCD, 0xFF,
-        0x7A, 0x08, 0x26, 0x01, 0x38, 0x07, 0x6F, 0x01, 0x64, 0x05, 0x61, 0x01,
-        0x7A, 0x02, 0x8A, 0x01, 0xD4, 0xFF, 0x75, 0x01, 0x20, 0xFE, 0x73, 0x00,
-        0xD2, 0xFD, 0x86, 0xFD, 0x77, 0xFF, 0xBD, 0xFA, 0x17, 0x01, 0x89, 0xF8,
-        0x5A, 0x01, 0x1E, 0xF7, 0x70, 0x00, 0xDB, 0xF6, 0xBE, 0xFE, 0x98, 0xF7,
-        0x42, 0xFD, 0x1C, 0xFA, 0x52, 0xFC, 0x97, 0xFD, 0xE5, 0xFA, 0xE7, 0x00,
-        0x6D, 0xF8, 0x27, 0x03, 0x83, 0xF6, 0xB3, 0x03, 0x96, 0xF6, 0xEC, 0x02,
-        0x48, 0xF7, 0xAD, 0x01, 0x3D, 0xF7, 0x60, 0x00, 0xC5, 0xF7, 0x14, 0xFF,
-        0x37, 0xF9, 0xEC, 0xFE, 0x15, 0xFB, 0x1C, 0xFF, 0x0D, 0xFE, 0x25, 0xFF,
-        0xB8, 0x00, 0x35, 0xFF, 0x23, 0x02, 0xFE, 0xFF, 0x1B, 0x02, 0xA0, 0x02,
-        0x69, 0x00, 0x52, 0x05, 0xF8, 0xFE, 0x7A, 0x07, 0xDB, 0xFE, 0xF5, 0x08,
-        0xD2, 0xFF, 0x48, 0x09, 0x83, 0x01, 0xBD, 0x08, 0x1D, 0x03, 0x8D, 0x06,
-        0x0B, 0x04, 0x49, 0x03, 0x61, 0x05, 0x23, 0x00, 0xD2, 0x07, 0xBF, 0xFD,
-        0xDA, 0x09, 0x01, 0xFD, 0xAB, 0x09, 0xAE, 0xFD, 0xBE, 0x08, 0xE7, 0xFE,
-        0x91, 0x08, 0x11, 0x00, 0xDC, 0x07, 0x12, 0x01, 0x55, 0x06, 0x2A, 0x01,
-        0x5E, 0x04, 0x0E, 0x01, 0x8F, 0x01, 0x41, 0x01, 0x0E, 0xFF, 0x4C, 0x01,
-        0xA8, 0xFD, 0x8F, 0x00, 0x99, 0xFD, 0xAB, 0xFD, 0x5A, 0xFF, 0xA8, 0xFA,
-        0xCF, 0x00, 0x5C, 0xF8, 0xCC, 0x00, 0xB6, 0xF6, 0xD5, 0xFF, 0x5D, 0xF6,
-        0x52, 0xFE, 0xA9, 0xF6, 0xF2, 0xFC, 0xB1, 0xF8, 0x29, 0xFC, 0xE2, 0xFB,
-        0xEE, 0xFA, 0x11, 0xFF, 0x8A, 0xF8, 0x86, 0x01, 0x9D, 0xF6, 0x54, 0x02,
-        0xDD, 0xF6, 0xBB, 0x01, 0xE1, 0xF7, 0x9E, 0x00, 0x1B, 0xF8, 0x8B, 0xFF,
-        0xB5, 0xF8, 0x7A, 0xFE, 0x25, 0xFA, 0x59, 0xFE, 0x0A, 0xFC, 0x50, 0xFE,
-        0xE6, 0xFE, 0x34, 0xFE, 0x63, 0x01, 0x75, 0xFE, 0xBF, 0x02, 0xA3, 0xFF,
-        0x97, 0x02, 0xF0, 0x02, 0xBD, 0x00, 0x1E, 0x06, 0x4A, 0xFF, 0x7F, 0x08,
-        0x3D, 0xFF, 0x0A, 0x0A, 0xFA, 0xFF, 0x4B, 0x0A, 0x44, 0x01, 0x07, 0x0A,
-        0x92, 0x02, 0x19, 0x08, 0x6D, 0x03, 0xF4, 0x04, 0xC8, 0x04, 0xB7, 0x01,
-        0x3B, 0x07, 0x0F, 0xFF, 0x28, 0x09, 0x0F, 0xFE, 0xF1, 0x08, 0x94, 0xFE,
-        0xE4, 0x07, 0xC7, 0xFF, 0xB5, 0x07, 0xF7, 0x00, 0x28, 0x07, 0x09, 0x02,
-        0xAC, 0x05, 0x37, 0x02, 0xA9, 0x03, 0x4B, 0x02, 0xBE, 0x00, 0x4B, 0x02,
-        0x4F, 0xFE, 0xCC, 0x01, 0x10, 0xFD, 0x76, 0x00, 0x67, 0xFD, 0xDB, 0xFC,
-        0x6C, 0xFF, 0x60, 0xF9, 0x0A, 0x01, 0xD9, 0xF6, 0x35, 0x01, 0x4F, 0xF5,
-        0x56, 0x00, 0x10, 0xF5, 0xC6, 0xFE, 0x4F, 0xF5, 0x5D, 0xFD, 0x56, 0xF7,
-        0x8E, 0xFC, 0xA6, 0xFA, 0x37, 0xFB, 0xE8, 0xFD, 0xE9, 0xF8, 0x9A, 0x00,
-        0x10, 0xF7, 0x95, 0x01, 0x46, 0xF7, 0x13, 0x01, 0x35, 0xF8, 0xC5, 0xFF,
-        0x3E, 0xF8, 0x69, 0xFE, 0xA9, 0xF8, 0x33, 0xFD, 0x05, 0xFA, 0xE9, 0xFC,
-        0xF5, 0xFB, 0xBE, 0xFC, 0xC9, 0xFE, 0xE7, 0xFC, 0x3D, 0x01, 0x81, 0xFD,
-        0x78, 0x02, 0x02, 0xFF, 0x0C, 0x02, 0xD1, 0x02, 0x03, 0x00, 0x7B, 0x06,
-        0x8A, 0xFE, 0x30, 0x09, 0xB6, 0xFE, 0xEE, 0x0A, 0xD9, 0xFF, 0x2F, 0x0B,
-        0x86, 0x01, 0xE2, 0x0A, 0xD8, 0x02, 0x98, 0x08, 0x90, 0x03, 0x4A, 0x05,
-        0xED, 0x04, 0xF8, 0x01, 0x50, 0x07, 0x2E, 0xFF, 0x3B, 0x09, 0xF8, 0xFD,
-        0x24, 0x09, 0x5B, 0xFE, 0x34, 0x08, 0xB3, 0xFF, 0x38, 0x08, 0x4F, 0x01,
-        0xEE, 0x07, 0xC0, 0x02, 0xB4, 0x06, 0x19, 0x03, 0xAE, 0x04, 0x0F, 0x03,
-        0xAD, 0x01, 0xC4, 0x02, 0x0F, 0xFF, 0x27, 0x02, 0x8D, 0xFD, 0xBD, 0x00,
-        0xBE, 0xFD, 0xFB, 0xFC, 0x89, 0xFF, 0x52, 0xF9, 0xCC, 0x00, 0x94, 0xF6,
-        0x6F, 0x00, 0xE5, 0xF4, 0x3B, 0xFF, 0xC6, 0xF4, 0x90, 0xFD, 0x37, 0xF5,
-        0x43, 0xFC, 0xB8, 0xF7, 0xA5, 0xFB, 0x2C, 0xFB, 0x5B, 0xFA, 0x99, 0xFE,
-        0x0F, 0xF8, 0xAE, 0x01, 0x37, 0xF6, 0x14, 0x03, 0x6F, 0xF6, 0x84, 0x02,
-        0x59, 0xF7, 0xE2, 0x00, 0x30, 0xF7, 0x04, 0xFF, 0x74, 0xF7, 0x7C, 0xFD,
-        0xD2, 0xF8, 0xF7, 0xFC, 0xFD, 0xFA, 0xEA, 0xFC, 0x36, 0xFE, 0x30, 0xFD,
-        0x1B, 0x01, 0xB3, 0xFD, 0xC0, 0x02, 0xF7, 0xFE, 0x6B, 0x02, 0x94, 0x02,
-        0x83, 0x00, 0x48, 0x06, 0x7A, 0xFF, 0x1C, 0x09, 0x0E, 0x00, 0xBB, 0x0A,
-        0x57, 0x01, 0xF9, 0x0A, 0xF0, 0x02, 0x8C, 0x0A, 0x02, 0x04, 0xF2, 0x07,
-        0x67, 0x04, 0x46, 0x04, 0x9A, 0x05, 0xE7, 0x00, 0xE9, 0x07, 0xF6, 0xFD,
-        0xCF, 0x09, 0xA9, 0xFC, 0xB0, 0x09, 0x52, 0xFD, 0xD9, 0x08, 0x23, 0xFF,
-        0x0F, 0x09, 0x3B, 0x01, 0xD5, 0x08, 0xD3, 0x02, 0x66, 0x07, 0x67, 0x03,
-        0x04, 0x05, 0x83, 0x03, 0x96, 0x01, 0x2A, 0x03, 0xC8, 0xFE, 0x7F, 0x02,
-        0x4F, 0xFD, 0x18, 0x01, 0x8E, 0xFD, 0x70, 0xFD, 0x42, 0xFF, 0x9E, 0xF9,
-        0x21, 0x00, 0xA7, 0xF6, 0x79, 0xFF, 0xE4, 0xF4, 0x53, 0xFE, 0xA0, 0xF4,
-        0xF1, 0xFC, 0x0B, 0xF5, 0x14, 0xFC, 0xA9, 0xF7, 0x9E, 0xFB, 0x4B, 0xFB,
-        0x56, 0xFA, 0x9C, 0xFE, 0x11, 0xF8, 0x94, 0x01, 0x47, 0xF6, 0xC5, 0x02,
-        0x5E, 0xF6, 0x03, 0x02, 0x0F, 0xF7, 0x1C, 0x00, 0xBB, 0xF6, 0x2D, 0xFE,
-        0xED, 0xF6, 0xA9, 0xFC, 0x6F, 0xF8, 0x32, 0xFC, 0xE2, 0xFA, 0x4F, 0xFC,
-        0x45, 0xFE, 0xC9, 0xFC, 0x26, 0x01, 0x84, 0xFD, 0xD9, 0x02, 0xE1, 0xFE,
-        0xE0, 0x02, 0x9D, 0x02, 0x57, 0x01, 0x5F, 0x06, 0x97, 0x00, 0x4B, 0x09,
-        0x1A, 0x01, 0x26, 0x0B, 0xEE, 0x01, 0xA2, 0x0B, 0x35, 0x03, 0x67, 0x0B,
-        0x16, 0x04, 0xC3, 0x08, 0x5D, 0x04, 0x17, 0x05, 0x6D, 0x05, 0x9E, 0x01,
-        0x88, 0x07, 0x9F, 0xFE, 0x4C, 0x09, 0x6A, 0xFD, 0x58, 0x09, 0x22, 0xFE,
-        0xCD, 0x08, 0xDD, 0xFF, 0x3C, 0x09, 0x75, 0x01, 0x13, 0x09, 0xD4, 0x02,
-        0x9C, 0x07, 0x41, 0x03, 0x3F, 0x05, 0x4B, 0x03, 0xDC, 0x01, 0xE9, 0x02,
-        0xD3, 0xFE, 0x2A, 0x02, 0x03, 0xFD, 0xC2, 0x00, 0xFE, 0xFC, 0x1D, 0xFD,
-        0x8A, 0xFE, 0x61, 0xF9, 0x47, 0xFF, 0x69, 0xF6, 0xEC, 0xFE, 0x8E, 0xF4,
-        0x15, 0xFE, 0x0D, 0xF4, 0xB6, 0xFC, 0x67, 0xF4, 0xEC, 0xFB, 0x3B, 0xF7,
-        0xC6, 0xFB, 0x13, 0xFB, 0xA9, 0xFA, 0x91, 0xFE, 0x9D, 0xF8, 0x7A, 0x01,
-        0xE2, 0xF6, 0xA7, 0x02, 0xCC, 0xF6, 0xF9, 0x01, 0x34, 0xF7, 0x54, 0x00,
-        0x9E, 0xF6, 0xD9, 0xFE, 0xC8, 0xF6, 0x91, 0xFD, 0x3D, 0xF8, 0x2E, 0xFD,
-        0xB7, 0xFA, 0xF6, 0xFC, 0x15, 0xFE, 0x24, 0xFD, 0x29, 0x01, 0xC7, 0xFD,
-        0xEC, 0x02, 0x11, 0xFF, 0x04, 0x03, 0xC2, 0x02, 0x9B, 0x01, 0x9C, 0x06,
-        0x02, 0x01, 0x92, 0x09, 0x8D, 0x01, 0x4A, 0x0B, 0x6B, 0x02, 0xB6, 0x0B,
-        0xAE, 0x03, 0x36, 0x0B, 0x6E, 0x04, 0x52, 0x08, 0x9B, 0x04, 0x82, 0x04,
-        0xB6, 0x05, 0x0B, 0x01, 0xA1, 0x07, 0x1E, 0xFE, 0x4D, 0x09, 0xF7, 0xFC,
-        0x46, 0x09, 0xBE, 0xFD, 0xB3, 0x08, 0x44, 0xFF, 0x11, 0x09, 0x84, 0x00,
-        0xCE, 0x08, 0xAF, 0x01, 0x52, 0x07, 0x1D, 0x02, 0xE3, 0x04, 0x7B, 0x02,
-        0x76, 0x01, 0x8C, 0x02, 0x7D, 0xFE, 0x24, 0x02, 0xB2, 0xFC, 0x06, 0x01,
-        0x89, 0xFC, 0x52, 0xFD, 0xB6, 0xFD, 0x88, 0xF9, 0x41, 0xFE, 0x96, 0xF6,
-        0xC9, 0xFD, 0xE6, 0xF4, 0x1E, 0xFD, 0x64, 0xF4, 0xF9, 0xFB, 0xBC, 0xF4,
-        0x4E, 0xFB, 0x87, 0xF7, 0x2E, 0xFB, 0x4B, 0xFB, 0x18, 0xFA, 0xCB, 0xFE,
-        0x2B, 0xF8, 0xAA, 0x01, 0xAF, 0xF6, 0xC4, 0x02, 0xDC, 0xF6, 0xF0, 0x01,
-        0x6C, 0xF7, 0x6D, 0x00, 0x05, 0xF7, 0x38, 0xFF, 0x52, 0xF7, 0x1F, 0xFE,
-        0xEB, 0xF8, 0xDA, 0xFD, 0x7C, 0xFB, 0x6A, 0xFD, 0xF8, 0xFE, 0x13, 0xFD,
-        0xE8, 0x01, 0x34, 0xFD, 0x9C, 0x03, 0x40, 0xFE, 0xBD, 0x03, 0xCB, 0x01,
-        0x7D, 0x02, 0xC6, 0x05, 0xBD, 0x01, 0x04, 0x09, 0x09, 0x02, 0x0C, 0x0B,
-        0x8A, 0x02, 0xB7, 0x0B, 0x9C, 0x03, 0x70, 0x0B, 0x39, 0x04, 0xAB, 0x08,
-        0x78, 0x04, 0xD8, 0x04, 0xAF, 0x05, 0x62, 0x01, 0x73, 0x07, 0x92, 0xFE,
-        0xD4, 0x08, 0x72, 0xFD, 0xB1, 0x08, 0x40, 0xFE, 0x4B, 0x08, 0xC3, 0xFF,
-        0x86, 0x08, 0xE2, 0x00, 0xFB, 0x07, 0xCE, 0x01, 0x41, 0x06, 0x10, 0x02,
-        0xE2, 0x03, 0xB0, 0x02, 0xAD, 0x00, 0x50, 0x03, 0xE6, 0xFD, 0x3A, 0x03,
-        0x4C, 0xFC, 0x11, 0x02, 0x3D, 0xFC, 0x56, 0xFE, 0xA2, 0xFD, 0x4C, 0xFA,
-        0x9D, 0xFE, 0xF5, 0xF6, 0x93, 0xFE, 0xE1, 0xF4, 0x16, 0xFE, 0x19, 0xF4,
-        0xDE, 0xFC, 0x7A, 0xF4, 0x20, 0xFC, 0x42, 0xF7, 0xE1, 0xFB, 0x13, 0xFB,
-        0xC6, 0xFA, 0x84, 0xFE, 0x08, 0xF9, 0x50, 0x01, 0xAC, 0xF7, 0x6D, 0x02,
-        0xB2, 0xF7, 0x93, 0x01, 0x21, 0xF8, 0x0C, 0x00, 0xF8, 0xF7, 0xF4, 0xFE,
-        0x93, 0xF8, 0xE7, 0xFD, 0x1A, 0xFA, 0x6A, 0xFD, 0x21, 0xFC, 0xAD, 0xFC,
-        0x05, 0xFF, 0x5E, 0xFC, 0xD4, 0x01, 0xC1, 0xFC, 0x77, 0x03, 0x3D, 0xFE,
-        0x85, 0x03, 0x1F, 0x02, 0xFE, 0x01, 0x35, 0x06, 0xF5, 0x00, 0x85, 0x09,
-        0xF2, 0x00, 0xB8, 0x0B, 0x7D, 0x01, 0x65, 0x0C, 0xBC, 0x02, 0xE1, 0x0B,
-        0x6F, 0x03, 0x0B, 0x09, 0xAB, 0x03, 0x67, 0x05, 0xC6, 0x04, 0xFE, 0x01,
-        0x80, 0x06, 0x5F, 0xFF, 0xF4, 0x07, 0x4E, 0xFE, 0x33, 0x08, 0x0A, 0xFF,
-        0xF6, 0x07, 0x6C, 0x00, 0x0D, 0x08, 0x76, 0x01, 0x81, 0x07, 0x72, 0x02,
-        0x3D, 0x06, 0xE0, 0x02, 0x44, 0x04, 0x86, 0x03, 0x3F, 0x01, 0xB5, 0x03,
-        0x42, 0xFE, 0x0B, 0x03, 0x69, 0xFC, 0x85, 0x01, 0x38, 0xFC, 0xC3, 0xFD,
-        0xC0, 0xFD, 0xD4, 0xF9, 0xE4, 0xFE, 0x7B, 0xF6, 0xE9, 0xFE, 0x55, 0xF4,
-        0x77, 0xFE, 0xB2, 0xF3, 0x38, 0xFD, 0x2C, 0xF4, 0x75, 0xFC, 0xCE, 0xF6,
-        0x22, 0xFC, 0x51, 0xFA, 0x13, 0xFB, 0xB0, 0xFD, 0x55, 0xF9, 0x57, 0x00,
-        0xCA, 0xF7, 0x83, 0x01, 0x71, 0xF7, 0xDA, 0x00, 0x94, 0xF7, 0x80, 0xFF,
-        0x8B, 0xF7, 0x82, 0xFE, 0x2B, 0xF8, 0x9F, 0xFD, 0x88, 0xF9, 0x33, 0xFD,
-        0x93, 0xFB, 0x8D, 0xFC, 0xBB, 0xFE, 0x6B, 0xFC, 0xDF, 0x01, 0x26, 0xFD,
-        0xD5, 0x03, 0xC2, 0xFE, 0x0C, 0x04, 0x8C, 0x02, 0x97, 0x02, 0x8F, 0x06,
-        0x8D, 0x01, 0xF9, 0x09, 0x94, 0x01, 0x17, 0x0C, 0x10, 0x02, 0xB5, 0x0C,
-        0x44, 0x03, 0x36, 0x0C, 0x05, 0x04, 0x9C, 0x09, 0x32, 0x04, 0x2A, 0x06,
-        0x37, 0x05, 0xCE, 0x02, 0xF6, 0x06, 0x35, 0x00, 0x95, 0x08, 0x27, 0xFF,
-        0x0A, 0x09, 0xD5, 0xFF, 0x00, 0x09, 0x35, 0x01, 0x04, 0x09, 0x26, 0x02,
-        0x68, 0x08, 0x12, 0x03, 0xEF, 0x06, 0x70, 0x03, 0xB4, 0x04, 0xD2, 0x03,
-        0x5D, 0x01, 0xAA, 0x03, 0x2F, 0xFE, 0xC5, 0x02, 0x50, 0xFC, 0x22, 0x01,
-        0x22, 0xFC, 0x5D, 0xFD, 0xA0, 0xFD, 0x97, 0xF9, 0xBE, 0xFE, 0x7C, 0xF6,
-        0xD0, 0xFE, 0x7F, 0xF4, 0x59, 0xFE, 0xCE, 0xF3, 0x18, 0xFD, 0x1B, 0xF4,
-        0x2D, 0xFC, 0x8C, 0xF6, 0xC1, 0xFB, 0xE1, 0xF9, 0x94, 0xFA, 0x65, 0xFD,
-        0xBA, 0xF8, 0x23, 0x00, 0x0F, 0xF7, 0x48, 0x01, 0x8B, 0xF6, 0x84, 0x00,
-        0xB8, 0xF6, 0xFB, 0xFE, 0xD4, 0xF6, 0x02, 0xFE, 0x97, 0xF7, 0x1D, 0xFD,
-        0x32, 0xF9, 0xF6, 0xFC, 0x79, 0xFB, 0xC8, 0xFC, 0xC2, 0xFE, 0x1B, 0xFD,
-        0xDD, 0x01, 0xE3, 0xFD, 0xA9, 0x03, 0x44, 0xFF, 0xC7, 0x03, 0x8F, 0x02,
-        0x33, 0x02, 0xF6, 0x05, 0x18, 0x01, 0x0C, 0x09, 0x18, 0x01, 0x40, 0x0B,
-        0xA4, 0x01, 0x5E, 0x0C, 0x05, 0x03, 0x50, 0x0C, 0x1B, 0x04, 0xF7, 0x09,
-        0xAE, 0x04, 0x7D, 0x06, 0xFB, 0x05, 0xC8, 0x02, 0xEF, 0x07, 0xEC, 0xFF,
-        0x95, 0x09, 0xB5, 0xFE, 0xF6, 0x09, 0x77, 0xFF, 0xAD, 0x09, 0xEF, 0x00,
-        0x9C, 0x09, 0xEA, 0x01, 0xDD, 0x08, 0xC5, 0x02, 0x47, 0x07, 0x0F, 0x03,
-        0xFB, 0x04, 0x38, 0x03, 0x91, 0x01, 0x08, 0x03, 0x5C, 0xFE, 0x4E, 0x02,
-        0x9B, 0xFC, 0xF6, 0x00, 0xB3, 0xFC, 0xC5, 0xFD, 0x81, 0xFE, 0x46, 0xFA,
-        0xB8, 0xFF, 0x28, 0xF7, 0xA4, 0xFF, 0xD6, 0xF4, 0xEB, 0xFE, 0x94, 0xF3,
-        0x63, 0xFD, 0x9B, 0xF3, 0x31, 0xFC, 0x1F, 0xF6, 0x7E, 0xFB, 0xB1, 0xF9,
-        0x30, 0xFA, 0x66, 0xFD, 0x45, 0xF8, 0x57, 0x00, 0xBB, 0xF6, 0xAC, 0x01,
-        0x7B, 0xF6, 0x00, 0x01, 0xC8, 0xF6, 0x9A, 0xFF, 0xCA, 0xF6, 0xA1, 0xFE,
-        0x58, 0xF7, 0xB0, 0xFD, 0xF3, 0xF8, 0x63, 0xFD, 0x5A, 0xFB, 0x3C, 0xFD,
-        0xB2, 0xFE, 0x7F, 0xFD, 0x99, 0x01, 0x42, 0xFE, 0x09, 0x03, 0xB7, 0xFF,
-        0xBA, 0x02, 0xFE, 0x02, 0xD4, 0x00, 0x73, 0x06, 0xB6, 0xFF, 0x5E, 0x09,
-        0xF8, 0xFF, 0x78, 0x0B, 0xC5, 0x00, 0xA5, 0x0C, 0x48, 0x02, 0x69, 0x0C,
-        0x71, 0x03, 0xCF, 0x09, 0x33, 0x04, 0x32, 0x06, 0x9C, 0x05, 0x73, 0x02,
-        0x9E, 0x07, 0x50, 0xFF, 0x23, 0x09, 0xDD, 0xFD, 0x73, 0x09, 0x51, 0xFE,
-        0x48, 0x09, 0x92, 0xFF, 0x6B, 0x09, 0x7C, 0x00, 0xCF, 0x08, 0x6D, 0x01,
-        0x11, 0x07, 0xCD, 0x01, 0x99, 0x04, 0x16, 0x02, 0x3E, 0x01, 0x06, 0x02,
-        0x58, 0xFE, 0x28, 0x01, 0xF5, 0xFC, 0x9A, 0xFF, 0x64, 0xFD, 0x5A, 0xFC,
-        0x40, 0xFF, 0x03, 0xF9, 0x36, 0x00, 0x2D, 0xF6, 0xE8, 0xFF, 0x17, 0xF4,
-        0x2F, 0xFF, 0x1C, 0xF3, 0xBF, 0xFD, 0x7A, 0xF3, 0x7C, 0xFC, 0x27, 0xF6,
-        0x8E, 0xFB, 0xDA, 0xF9, 0xF7, 0xF9, 0xCE, 0xFD, 0xF8, 0xF7, 0x1C, 0x01,
-        0x59, 0xF6, 0xBB, 0x02, 0xDB, 0xF5, 0x59, 0x02, 0xD0, 0xF5, 0x1E, 0x01,
-        0xA7, 0xF5, 0x26, 0x00, 0x7A, 0xF6, 0x1C, 0xFF, 0xA6, 0xF8, 0x92, 0xFE,
-        0x86, 0xFB, 0x06, 0xFE, 0x21, 0xFF, 0x01, 0xFE, 0x0B, 0x02, 0xC1, 0xFE,
-        0x4D, 0x03, 0x55, 0x00, 0xD4, 0x02, 0xA3, 0x03, 0xFC, 0x00, 0x0F, 0x07,
-        0xFF, 0xFF, 0xF5, 0x09, 0x23, 0x00, 0xEA, 0x0B, 0xA8, 0x00, 0xB2, 0x0C,
-        0x03, 0x02, 0x1D, 0x0C, 0x48, 0x03, 0x43, 0x09, 0x65, 0x04, 0x78, 0x05,
-        0x14, 0x06, 0x6D, 0x01, 0x32, 0x08, 0x17, 0xFE, 0xED, 0x09, 0x6A, 0xFC,
-        0x97, 0x0A, 0xB5, 0xFC, 0xA9, 0x0A, 0xE8, 0xFD, 0xBB, 0x0A, 0x02, 0xFF,
-        0xA1, 0x09, 0x5A, 0x00, 0x21, 0x07, 0x2C, 0x01, 0xE8, 0x03, 0xEB, 0x01,
-        0x3A, 0x00, 0xFC, 0x01, 0x72, 0xFD, 0x15, 0x01, 0x7B, 0xFC, 0x4C, 0xFF,
-        0x21, 0xFD, 0xDB, 0xFB, 0x28, 0xFF, 0x5B, 0xF8, 0x4A, 0x00, 0x8E, 0xF5,
-        0x47, 0x00, 0xE2, 0xF3, 0xE2, 0xFF, 0x6F, 0xF3, 0x86, 0xFE, 0x35, 0xF4,
-        0x1B, 0xFD, 0x1B, 0xF7, 0xE7, 0xFB, 0xD9, 0xFA, 0x30, 0xFA, 0xC5, 0xFE,
-        0xFE, 0xF7, 0xE4, 0x01, 0x33, 0xF6, 0x5A, 0x03, 0x83, 0xF5, 0xF9, 0x02,
-        0x83, 0xF5, 0xD7, 0x01, 0x81, 0xF5, 0xB0, 0x00, 0xA5, 0xF6, 0x61, 0xFF,
-        0x13, 0xF9, 0x9D, 0xFE, 0x19, 0xFC, 0x05, 0xFE, 0x8E, 0xFF, 0x1C, 0xFE,
-        0x00, 0x02, 0x2F, 0xFF, 0xD3, 0x02, 0xFD, 0x00, 0x37, 0x02, 0x60, 0x04,
-        0x5C, 0x00, 0xBA, 0x07, 0x73, 0xFF, 0x83, 0x0A, 0xA5, 0xFF, 0x2A, 0x0C,
-        0x03, 0x00, 0x9E, 0x0C, 0x4F, 0x01, 0xC0, 0x0B, 0xA9, 0x02, 0xD8, 0x08,
-        0xDC, 0x03, 0x2E, 0x05, 0xC2, 0x05, 0x66, 0x01, 0x0C, 0x08, 0x5A, 0xFE,
-        0xEB, 0x09, 0xF3, 0xFC, 0x9B, 0x0A, 0x38, 0xFD, 0xAB, 0x0A, 0x35, 0xFE,
-        0xAA, 0x0A, 0x57, 0xFF, 0xA7, 0x09, 0xB8, 0x00, 0x70, 0x07, 0x7E, 0x01,
-        0x86, 0x04, 0x24, 0x02, 0x13, 0x01, 0xFC, 0x01, 0x8A, 0xFE, 0xD8, 0x00,
-        0x88, 0xFD, 0xFE, 0xFE, 0xE8, 0xFD, 0xB8, 0xFB, 0xAA, 0xFF, 0x6B, 0xF8,
-        0x85, 0x00, 0xB3, 0xF5, 0x46, 0x00, 0x17, 0xF4, 0xDA, 0xFF, 0xC7, 0xF3,
-        0x8A, 0xFE, 0xCE, 0xF4, 0x2A, 0xFD, 0xC4, 0xF7, 0xF4, 0xFB, 0x70, 0xFB,
-        0x21, 0xFA, 0x0C, 0xFF, 0xE1, 0xF7, 0xDC, 0x01, 0x10, 0xF6, 0x39, 0x03,
-        0x62, 0xF5, 0x11, 0x03, 0x49, 0xF5, 0x3A, 0x02, 0x43, 0xF5, 0x1E, 0x01,
-        0x41, 0xF6, 0xBB, 0xFF, 0x90, 0xF8, 0xC8, 0xFE, 0x8D, 0xFB, 0xF7, 0xFD,
-        0x1F, 0xFF, 0xEA, 0xFD, 0xB1, 0x01, 0xD5, 0xFE, 0xB1, 0x02, 0x90, 0x00,
-        0x60, 0x02, 0xBA, 0x03, 0xAD, 0x00, 0x0B, 0x07, 0xE1, 0xFF, 0xC5, 0x09,
-        0x2A, 0x00, 0x6B, 0x0B, 0xB2, 0x00, 0xA1, 0x0B, 0x0B, 0x02, 0xA3, 0x0A,
-        0x79, 0x03, 0xDE, 0x07, 0xAA, 0x04, 0x65, 0x04, 0x55, 0x06, 0xFC, 0x00,
-        0x55, 0x08, 0x3A, 0xFE, 0x12, 0x0A, 0xDA, 0xFC, 0xB4, 0x0A, 0xE9, 0xFC,
-        0xC1, 0x0A, 0xB9, 0xFD, 0xB3, 0x0A, 0xDA, 0xFE, 0xBC, 0x09, 0x7C, 0x00,
-        0x89, 0x07, 0xC9, 0x01, 0xA6, 0x04, 0xB2, 0x02, 0x37, 0x01, 0xA5, 0x02,
-        0xCD, 0xFE, 0x83, 0x01, 0xF2, 0xFD, 0x9C, 0xFF, 0x30, 0xFE, 0x43, 0xFC,
-        0xC9, 0xFF, 0xF8, 0xF8, 0x6F, 0x00, 0x59, 0xF6, 0x11, 0x00, 0xE9, 0xF4,
-        0x6D, 0xFF, 0xCC, 0xF4, 0xF3, 0xFD, 0xBE, 0xF5, 0x74, 0xFC, 0x49, 0xF8,
-        0x45, 0xFB, 0x92, 0xFB, 0xDF, 0xF9, 0xEB, 0xFE, 0x0B, 0xF8, 0x9C, 0x01,
-        0x8A, 0xF6, 0xE9, 0x02, 0xFD, 0xF5, 0xF1, 0x02, 0x04, 0xF6, 0x3A, 0x02,
-        0xF7, 0xF5, 0x32, 0x01, 0xC2, 0xF6, 0xA6, 0xFF, 0xB5, 0xF8, 0x86, 0xFE,
-        0x52, 0xFB, 0xA3, 0xFD, 0x71, 0xFE, 0xBD, 0xFD, 0x8A, 0x00, 0xDE, 0xFE,
-        0x3F, 0x01, 0xBC, 0x00, 0xF8, 0x00, 0x13, 0x04, 0x61, 0xFF, 0x6D, 0x07,
-        0xA6, 0xFE, 0x0D, 0x0A, 0xFC, 0xFE, 0x7F, 0x0B, 0x7C, 0xFF, 0xAD, 0x0B,
-        0xF7, 0x00, 0xC5, 0x0A, 0x82, 0x02, 0x2F, 0x08, 0xA4, 0x03, 0xB1, 0x04,
-        0x18, 0x05, 0x3F, 0x01, 0xFA, 0x06, 0x94, 0xFE, 0x7C, 0x08, 0x4C, 0xFD,
-        0x0B, 0x09, 0x59, 0xFD, 0x46, 0x09, 0x14, 0xFE, 0xC1, 0x09, 0x35, 0xFF,
-        0x6F, 0x09, 0xB9, 0x00, 0xD7, 0x07, 0xC2, 0x01, 0x70, 0x05, 0x7D, 0x02,
-        0x57, 0x02, 0x3C, 0x02, 0x69, 0x00, 0x02, 0x01, 0xCF, 0xFF, 0x0F, 0xFF,
-        0x2A, 0x00, 0x9F, 0xFB, 0xC8, 0x01, 0x40, 0xF8, 0x89, 0x02, 0xA4, 0xF5,
-        0x31, 0x02, 0x35, 0xF4, 0x86, 0x01, 0xFD, 0xF3, 0x03, 0x00, 0xCA, 0xF4,
-        0x62, 0xFE, 0x65, 0xF7, 0x19, 0xFD, 0xE8, 0xFA, 0x94, 0xFB, 0x4B, 0xFE,
-        0x97, 0xF9, 0xE9, 0x00, 0xEA, 0xF7, 0x29, 0x02, 0x26, 0xF7, 0x01, 0x02,
-        0xB6, 0xF6, 0x4F, 0x01, 0xF3, 0xF5, 0x64, 0x00, 0x18, 0xF6, 0x24, 0xFF,
-        0xB4, 0xF7, 0x38, 0xFE, 0x3D, 0xFA, 0xC1, 0xFD, 0x7A, 0xFD, 0x2D, 0xFE,
-        0x7E, 0xFF, 0x79, 0xFF, 0xFE, 0xFF, 0x60, 0x01, 0x7F, 0xFF, 0xBA, 0x04,
-        0xED, 0xFD, 0xE8, 0x07, 0x4A, 0xFD, 0x62, 0x0A, 0x9D, 0xFD, 0xC0, 0x0B,
-        0x32, 0xFE, 0xDF, 0x0B, 0x8E, 0xFF, 0x1C, 0x0B, 0x25, 0x01, 0xA4, 0x08,
-        0x79, 0x02, 0x2A, 0x05, 0x04, 0x04, 0xB8, 0x01, 0x08, 0x06, 0x1F, 0xFF,
-        0xBD, 0x07, 0xE2, 0xFD, 0x7E, 0x08, 0x02, 0xFE, 0x07, 0x09, 0xA7, 0xFE,
-        0x07, 0x0A, 0x76, 0xFF, 0x23, 0x0A, 0xAB, 0x00, 0x95, 0x08, 0x7E, 0x01,
-        0xEF, 0x05, 0xDF, 0x01, 0x83, 0x02, 0x63, 0x01, 0x57, 0x00, 0x26, 0x00,
-        0xD0, 0xFF, 0x4C, 0xFE, 0x57, 0x00, 0x16, 0xFB, 0xD4, 0x01, 0xF5, 0xF7,
-        0x67, 0x02, 0x7C, 0xF5, 0x16, 0x02, 0x18, 0xF4, 0x79, 0x01, 0xD9, 0xF3,
-        0x19, 0x00, 0x80, 0xF4, 0x6F, 0xFE, 0x00, 0xF7, 0xFF, 0xFC, 0x9F, 0xFA,
-        0x65, 0xFB, 0x30, 0xFE, 0x45, 0xF9, 0xD9, 0x00, 0x88, 0xF7, 0x0C, 0x02,
-        0xC0, 0xF6, 0xDE, 0x01, 0x1F, 0xF6, 0x2C, 0x01, 0x28, 0xF5, 0x7A, 0x00,
-        0x23, 0xF5, 0x55, 0xFF, 0xF9, 0xF6, 0x95, 0xFE, 0x0E, 0xFA, 0x31, 0xFE,
-        0xB6, 0xFD, 0xA2, 0xFE, 0xFF, 0xFF, 0xB6, 0xFF, 0x81, 0x00, 0x7C, 0x01,
-        0xF8, 0xFF, 0xDB, 0x04, 0x8A, 0xFE, 0x30, 0x08, 0xFD, 0xFD, 0xB7, 0x0A,
-        0x2A, 0xFE, 0x14, 0x0C, 0xB0, 0xFE, 0x49, 0x0C, 0x1D, 0x00, 0x96, 0x0B,
-        0xDA, 0x01, 0xFB, 0x08, 0x45, 0x03, 0x4F, 0x05, 0xD0, 0x04, 0x9A, 0x01,
-        0xC4, 0x06, 0xE2, 0xFE, 0x48, 0x08, 0xBE, 0xFD, 0xE8, 0x08, 0xF8, 0xFD,
-        0x6D, 0x09, 0x95, 0xFE, 0x53, 0x0A, 0x41, 0xFF, 0x69, 0x0A, 0x61, 0x00,
-        0x9C, 0x08, 0x33, 0x01, 0x9F, 0x05, 0xAA, 0x01, 0x18, 0x02, 0x66, 0x01,
-        0xF5, 0xFF, 0x64, 0x00, 0x82, 0xFF, 0xA6, 0xFE, 0x10, 0x00, 0x45, 0xFB,
-        0x5C, 0x01, 0xF2, 0xF7, 0xC6, 0x01, 0x73, 0xF5, 0x7C, 0x01, 0x25, 0xF4,
-        0xD1, 0x00, 0xDB, 0xF3, 0x44, 0xFF, 0x71, 0xF4, 0x91, 0xFD, 0xEC, 0xF6,
-        0x4C, 0xFC, 0x92, 0xFA, 0xF6, 0xFA, 0x63, 0xFE, 0x26, 0xF9, 0x2A, 0x01,
-        0x9A, 0xF7, 0x47, 0x02, 0xD2, 0xF6, 0x10, 0x02, 0x35, 0xF6, 0x60, 0x01,
-        0x39, 0xF5, 0xB0, 0x00, 0x1D, 0xF5, 0x74, 0xFF, 0xD2, 0xF6, 0x79, 0xFE,
-        0xB7, 0xF9, 0xDA, 0xFD, 0x1C, 0xFD, 0xFB, 0xFD, 0x46, 0xFF, 0xD7, 0xFE,
-        0xE2, 0xFF, 0x88, 0x00, 0xAA, 0xFF, 0xE4, 0x03, 0xB4, 0xFE, 0x53, 0x07,
-        0x87, 0xFE, 0xD3, 0x09, 0xF1, 0xFE, 0x3F, 0x0B, 0xB1, 0xFF, 0x9A, 0x0B,
-        0x27, 0x01, 0xFC, 0x0A, 0xBD, 0x02, 0x52, 0x08, 0xD7, 0x03, 0x8D, 0x04,
-        0x23, 0x05, 0xC1, 0x00, 0xFE, 0x06, 0x16, 0xFE, 0x72, 0x08, 0x07, 0xFD,
-        0x21, 0x09, 0x51, 0xFD, 0x9C, 0x09, 0x08, 0xFE, 0x97, 0x0A, 0xDF, 0xFE,
-        0xAB, 0x0A, 0x46, 0x00, 0x14, 0x09, 0x77, 0x01, 0x42, 0x06, 0x25, 0x02,
-        0xD7, 0x02, 0x0E, 0x02, 0x92, 0x00, 0x33, 0x01, 0xCD, 0xFF, 0x6B, 0xFF,
-        0xEA, 0xFF, 0x0A, 0xFC, 0xB9, 0x00, 0x8E, 0xF8, 0xEB, 0x00, 0x00, 0xF6,
-        0x88, 0x00, 0xB0, 0xF4, 0xD7, 0xFF, 0x99, 0xF4, 0x6A, 0xFE, 0x8E, 0xF5,
-        0xFA, 0xFC, 0x72, 0xF8, 0x01, 0xFC, 0x4E, 0xFC, 0xC6, 0xFA, 0xF1, 0xFF,
-        0xF3, 0xF8, 0x57, 0x02, 0x76, 0xF7, 0x19, 0x03, 0xB4, 0xF6, 0xB6, 0x02,
-        0x21, 0xF6, 0xF0, 0x01, 0x2E, 0xF5, 0x13, 0x01, 0x21, 0xF5, 0x9D, 0xFF,
-        0xC2, 0xF6, 0x53, 0xFE, 0xB2, 0xF9, 0x95, 0xFD, 0x3D, 0xFD, 0x95, 0xFD,
-        0x8A, 0xFF, 0x72, 0xFE, 0x3E, 0x00, 0x2D, 0x00, 0x22, 0x00, 0x85, 0x03,
-        0x54, 0xFF, 0x26, 0x07, 0x31, 0xFF, 0xDB, 0x09, 0xC1, 0xFF, 0x25, 0x0B,
-        0x8C, 0x00, 0x37, 0x0B, 0x09, 0x02, 0x20, 0x0A, 0x6B, 0x03, 0x1D, 0x07,
-        0x55, 0x04, 0x62, 0x03, 0x87, 0x05, 0xD6, 0xFF, 0x56, 0x07, 0x96, 0xFD,
-        0xF1, 0x08, 0xEB, 0xFC, 0xD6, 0x09, 0x5C, 0xFD, 0x8F, 0x0A, 0x24, 0xFE,
-        0x61, 0x0B, 0x0D, 0xFF, 0x55, 0x0B, 0x84, 0x00, 0x9A, 0x09, 0xE4, 0x01,
-        0x94, 0x06, 0xAF, 0x02, 0xF4, 0x02, 0x9F, 0x02, 0xA1, 0x00, 0xAF, 0x01,
-        0xDA, 0xFF, 0xDD, 0xFF, 0xF4, 0xFF, 0x94, 0xFC, 0xB6, 0x00, 0x04, 0xF9,
-        0xB4, 0x00, 0x47, 0xF6, 0x0C, 0x00, 0xF8, 0xF4, 0x34, 0xFF, 0xDF, 0xF4,
-        0xDD, 0xFD, 0xE8, 0xF5, 0xA0, 0xFC, 0xCC, 0xF8, 0xD9, 0xFB, 0x82, 0xFC,
-        0xAA, 0xFA, 0x04, 0x00, 0xC5, 0xF8, 0x49, 0x02, 0x15, 0xF7, 0xF1, 0x02,
-        0x33, 0xF6, 0x9E, 0x02, 0xB0, 0xF5, 0xD8, 0x01, 0x12, 0xF5, 0xF9, 0x00,
-        0x2E, 0xF5, 0x8C, 0xFF, 0xDD, 0xF6, 0x3D, 0xFE, 0xBF, 0xF9, 0x7D, 0xFD,
-        0x42, 0xFD, 0x9C, 0xFD, 0x8A, 0xFF, 0x8A, 0xFE, 0x54, 0x00, 0x24, 0x00,
-        0x23, 0x00, 0x34, 0x03, 0x67, 0xFF, 0xA1, 0x06, 0x6D, 0xFF, 0x62, 0x09,
-        0x05, 0x00, 0xBC, 0x0A, 0xCA, 0x00, 0xF2, 0x0A, 0x25, 0x02, 0x11, 0x0A,
-        0x42, 0x03, 0x62, 0x07, 0x02, 0x04, 0xC9, 0x03, 0x19, 0x05, 0x44, 0x00,
-        0x01, 0x07, 0xE5, 0xFD, 0xAB, 0x08, 0x2B, 0xFD, 0x87, 0x09, 0x67, 0xFD,
-        0xE0, 0x09, 0x20, 0xFE, 0x5A, 0x0A, 0x12, 0xFF, 0x37, 0x0A, 0x9C, 0x00,
-        0x9B, 0x08, 0xF5, 0x01, 0xC4, 0x05, 0xB8, 0x02, 0x58, 0x02, 0x86, 0x02,
-        0x38, 0x00, 0xAD, 0x01, 0xB9, 0xFF, 0x43, 0x00, 0xF3, 0xFF, 0x42, 0xFD,
-        0xA2, 0x00, 0xBE, 0xF9, 0x8B, 0x00, 0xD1, 0xF6, 0xE7, 0xFF, 0x5C, 0xF5,
-        0x20, 0xFF, 0x1D, 0xF5, 0xF1, 0xFD, 0xF4, 0xF5, 0x07, 0xFD, 0xAF, 0xF8,
-        0x70, 0xFC, 0x5B, 0xFC, 0x6E, 0xFB, 0x09, 0x00, 0x7A, 0xF9, 0x70, 0x02,
-        0x9E, 0xF7, 0x2B, 0x03, 0xAF, 0xF6, 0xE5, 0x02, 0x6B, 0xF6, 0x09, 0x02,
-        0x01, 0xF6, 0xE6, 0x00, 0x19, 0xF6, 0x4F, 0xFF, 0xAE, 0xF7, 0xED, 0xFD,
-        0x54, 0xFA, 0x37, 0xFD, 0x8E, 0xFD, 0x62, 0xFD, 0x98, 0xFF, 0x2F, 0xFE,
-        0x31, 0x00, 0x89, 0xFF, 0x26, 0x00, 0x8C, 0x02, 0x8B, 0xFF, 0x23, 0x06,
-        0xAA, 0xFF, 0x28, 0x09, 0x3B, 0x00, 0xD2, 0x0A, 0xE8, 0x00, 0x17, 0x0B,
-        0xED, 0x01, 0x3A, 0x0A, 0xD6, 0x02, 0x6B, 0x07, 0x71, 0x03, 0xB3, 0x03,
-        0x9B, 0x04, 0xFB, 0xFF, 0xB5, 0x06, 0xA0, 0xFD, 0xC0, 0x08, 0xE4, 0xFC,
-        0xB8, 0x09, 0x37, 0xFD, 0xFB, 0x09, 0x36, 0xFE, 0x51, 0x0A, 0x5E, 0xFF,
-        0x09, 0x0A, 0xE3, 0x00, 0x4B, 0x08, 0x1A, 0x02, 0x6F, 0x05, 0x97, 0x02,
-        0x28, 0x02, 0x58, 0x02, 0xFF, 0xFF, 0x8A, 0x01, 0x68, 0xFF, 0x6F, 0x00,
-        0x99, 0xFF, 0xAB, 0xFD, 0x49, 0x00, 0x3D, 0xFA, 0x2F, 0x00, 0x23, 0xF7,
-        0x82, 0xFF, 0x41, 0xF5, 0xB3, 0xFE, 0xB9, 0xF4, 0x81, 0xFD, 0x8D, 0xF5,
-        0x82, 0xFC, 0x65, 0xF8, 0xDB, 0xFB, 0x3D, 0xFC, 0xBC, 0xFA, 0x18, 0x00,
-        0xC0, 0xF8, 0xA3, 0x02, 0xDE, 0xF6, 0x73, 0x03, 0x01, 0xF6, 0x42, 0x03,
-        0xF2, 0xF5, 0x65, 0x02, 0xD9, 0xF5, 0x99, 0x01, 0x3E, 0xF6, 0x5A, 0x00,
-        0xFE, 0xF7, 0x58, 0xFF, 0xB3, 0xFA, 0xD7, 0xFE, 0xE2, 0xFD, 0xE9, 0xFE,
-        0xEF, 0xFF, 0x64, 0xFF, 0x6C, 0x00, 0x23, 0x00, 0x20, 0x00, 0x85, 0x02,
-        0x67, 0xFF, 0xD6, 0x05, 0x7D, 0xFF, 0xF8, 0x08, 0x36, 0x00, 0xD2, 0x0A,
-        0x14, 0x01, 0x47, 0x0B, 0x65, 0x02, 0x78, 0x0A, 0xA7, 0x03, 0xA1, 0x07,
-        0x75, 0x04, 0xDF, 0x03, 0xA0, 0x05, 0xFB, 0xFF, 0x94, 0x07, 0x50, 0xFD,
-        0x8D, 0x09, 0x56, 0xFC, 0x80, 0x0A, 0x64, 0xFC, 0x6D, 0x0A, 0x04, 0xFD,
-        0x6A, 0x0A, 0x80, 0xFD, 0xCE, 0x09, 0x9E, 0xFE, 0xFE, 0x07, 0xA4, 0xFF,
-        0x4E, 0x05, 0x46, 0x00, 0x1D, 0x02, 0x68, 0x00, 0x00, 0x00, 0x30, 0x00,
-        0x83, 0xFF, 0xA3, 0xFF, 0xE2, 0xFF, 0x96, 0xFD, 0xB0, 0x00, 0x7A, 0xFA,
-        0xBD, 0x00, 0x85, 0xF7, 0xF9, 0xFF, 0xC3, 0xF5, 0x06, 0xFF, 0x38, 0xF5,
-        0x77, 0xFD, 0xE2, 0xF5, 0x0F, 0xFC, 0x7F, 0xF8, 0x55, 0xFB, 0x3E, 0xFC,
-        0x44, 0xFA, 0x1E, 0x00, 0x6B, 0xF8, 0xD7, 0x02, 0x4F, 0xF6, 0xC1, 0x03,
-        0x32, 0xF5, 0x95, 0x03, 0x54, 0xF5, 0xF4, 0x02, 0x83, 0xF5, 0x81, 0x02,
-        0x4B, 0xF6, 0x76, 0x01, 0x36, 0xF8, 0x71, 0x00, 0xEB, 0xFA, 0xE0, 0xFF,
-        0x08, 0xFE, 0xD6, 0xFF, 0x2C, 0x00, 0x35, 0x00, 0x99, 0x00, 0xC5, 0x00,
-        0x1C, 0x00, 0xCC, 0x02, 0x30, 0xFF, 0xC9, 0x05, 0x07, 0xFF, 0x8A, 0x08,
-        0xCB, 0xFF, 0x0F, 0x0A, 0xD1, 0x00, 0x8C, 0x0A, 0x91, 0x02, 0xEB, 0x09,
-        0x0E, 0x04, 0x67, 0x07, 0xB9, 0x04, 0xE2, 0x03, 0xB6, 0x05, 0x42, 0x00,
-        0x9B, 0x07, 0xD2, 0xFD, 0xC6, 0x09, 0x27, 0xFD, 0xDC, 0x0A, 0x69, 0xFD,
-        0xB0, 0x0A, 0xE1, 0xFD, 0x72, 0x0A, 0x33, 0xFE, 0xCB, 0x09, 0x06, 0xFF,
-        0x0E, 0x08, 0xCA, 0xFF, 0xAB, 0x05, 0x14, 0x00, 0x9E, 0x02, 0xDA, 0xFF,
-        0x79, 0x00, 0x58, 0xFF, 0xDB, 0xFF, 0xCE, 0xFE, 0x27, 0x00, 0xF3, 0xFC,
-        0xF0, 0x00, 0x2F, 0xFA, 0x09, 0x01, 0xA3, 0xF7, 0x45, 0x00, 0x3F, 0xF6,
-        0x48, 0xFF, 0xC0, 0xF5, 0x83, 0xFD, 0x44, 0xF6, 0xF1, 0xFB, 0x8C, 0xF8,
-        0x3C, 0xFB, 0xBE, 0xFB, 0x2E, 0xFA, 0x20, 0xFF, 0x47, 0xF8, 0x66, 0x01,
-        0x28, 0xF6, 0x10, 0x02, 0xFE, 0xF4, 0xE0, 0x01, 0xFD, 0xF4, 0x72, 0x01,
-        0x11, 0xF5, 0x2D, 0x01, 0x9D, 0xF5, 0x64, 0x00, 0x3F, 0xF7, 0xAD, 0xFF,
-        0xBC, 0xF9, 0x72, 0xFF, 0xD2, 0xFC, 0xB8, 0xFF, 0x18, 0xFF, 0x5A, 0x00,
-        0xC9, 0xFF, 0xEC, 0x00, 0x83, 0xFF, 0xD3, 0x02, 0xA7, 0xFE, 0xA2, 0x05,
-        0x9D, 0xFE, 0x0E, 0x08, 0x5F, 0xFF, 0x6E, 0x09, 0x67, 0x00, 0xFA, 0x09,
-        0x38, 0x02, 0x83, 0x09, 0xCE, 0x03, 0x68, 0x07, 0x8D, 0x04, 0x57, 0x04,
-        0xAC, 0x05, 0xFE, 0x00, 0xA9, 0x07, 0x9D, 0xFE, 0xD6, 0x09, 0xD5, 0xFD,
-        0x22, 0x0B, 0x0C, 0xFE, 0x42, 0x0B, 0x88, 0xFE, 0x2A, 0x0B, 0xE9, 0xFE,
-        0xA5, 0x0A, 0xC1, 0xFF, 0x0C, 0x09, 0x6F, 0x00, 0xB7, 0x06, 0xA6, 0x00,
-        0xB6, 0x03, 0x43, 0x00, 0x71, 0x01, 0x81, 0xFF, 0xA5, 0x00, 0xBE, 0xFE,
-        0xCB, 0x00, 0xC4, 0xFC, 0x8B, 0x01, 0xF0, 0xF9, 0x75, 0x01, 0x8E, 0xF7,
-        0xB0, 0x00, 0x3D, 0xF6, 0x9F, 0xFF, 0xCA, 0xF5, 0xE7, 0xFD, 0x4F, 0xF6,
-        0x73, 0xFC, 0x77, 0xF8, 0xC1, 0xFB, 0x9A, 0xFB, 0xB2, 0xFA, 0x0F, 0xFF,
-        0xA6, 0xF8, 0x83, 0x01, 0x68, 0xF6, 0x4D, 0x02, 0x03, 0xF5, 0x26, 0x02,
-        0xD2, 0xF4, 0x9A, 0x01, 0xBF, 0xF4, 0x35, 0x01, 0x22, 0xF5, 0x45, 0x00,
-        0x94, 0xF6, 0x78, 0xFF, 0xF2, 0xF8, 0x4F, 0xFF, 0x37, 0xFC, 0xD0, 0xFF,
-        0xE0, 0xFE, 0xC7, 0x00, 0xF7, 0xFF, 0xB6, 0x01, 0xED, 0xFF, 0xC0, 0x03,
-        0x2D, 0xFF, 0x90, 0x06, 0x15, 0xFF, 0xCA, 0x08, 0xCA, 0xFF, 0xF9, 0x09,
-        0xC9, 0x00, 0x46, 0x0A, 0x5B, 0x02, 0xA3, 0x09, 0xAB, 0x03, 0x61, 0x07,
-        0x32, 0x04, 0x1D, 0x04, 0x38, 0x05, 0x81, 0x00, 0x41, 0x07, 0xF4, 0xFD,
-        0x9E, 0x09, 0xF4, 0xFC, 0x13, 0x0B, 0x1D, 0xFD, 0x6C, 0x0B, 0xCD, 0xFD,
-        0x9B, 0x0B, 0x62, 0xFE, 0x3C, 0x0B, 0x90, 0xFF, 0xD5, 0x09, 0x73, 0x00,
-        0x66, 0x07, 0x93, 0x00, 0x02, 0x04, 0xF1, 0xFF, 0x41, 0x01, 0xE5, 0xFE,
-        0x18, 0x00, 0xF4, 0xFD, 0x20, 0x00, 0xE7, 0xFB, 0xEC, 0x00, 0x32, 0xF9,
-        0x0F, 0x01, 0x13, 0xF7, 0x5B, 0x00, 0x1A, 0xF6, 0x49, 0xFF, 0x04, 0xF6,
-        0xB4, 0xFD, 0xF2, 0xF6, 0x6C, 0xFC, 0x61, 0xF9, 0xDD, 0xFB, 0xA7, 0xFC,
-        0xD0, 0xFA, 0x33, 0x00, 0xC1, 0xF8, 0x97, 0x02, 0x6D, 0xF6, 0x75, 0x03,
-        0x07, 0xF5, 0x34, 0x03, 0xB5, 0xF4, 0x79, 0x02, 0xA0, 0xF4, 0xD2, 0x01,
-        0x0C, 0xF5, 0xB7, 0x00, 0x7E, 0xF6, 0xEF, 0xFF, 0xDB, 0xF8, 0xDC, 0xFF,
-        0x2D, 0xFC, 0x8C, 0x00, 0xE6, 0xFE, 0x91, 0x01, 0x2B, 0x00, 0x85, 0x02,
-        0x45, 0x00, 0x89, 0x04, 0x85, 0xFF, 0x2E, 0x07, 0x46, 0xFF, 0x2C, 0x09,
-        0xF7, 0xFF, 0x09, 0x0A, 0x12, 0x01, 0x23, 0x0A, 0xA9, 0x02, 0x3F, 0x09,
-        0xFB, 0x03, 0xDB, 0x06, 0x87, 0x04, 0xAB, 0x03, 0x8D, 0x05, 0x29, 0x00,
-        0x8B, 0x07, 0xC8, 0xFD, 0xBD, 0x09, 0xCF, 0xFC, 0xFF, 0x0A, 0x01, 0xFD,
-        0x4D, 0x0B, 0xBC, 0xFD, 0x6F, 0x0B, 0x5D, 0xFE, 0x04, 0x0B, 0x67, 0xFF,
-        0xAB, 0x09, 0x1E, 0x00, 0x59, 0x07, 0x1E, 0x00, 0x25, 0x04, 0x5C, 0xFF,
-        0x71, 0x01, 0x42, 0xFE, 0x37, 0x00, 0x3D, 0xFD, 0x3A, 0x00, 0x1A, 0xFB,
-        0x13, 0x01, 0x83, 0xF8, 0x61, 0x01, 0x93, 0xF6, 0x92, 0x00, 0xCF, 0xF5,
-        0x36, 0xFF, 0xCC, 0xF5, 0x7D, 0xFD, 0xD9, 0xF6, 0x29, 0xFC, 0x56, 0xF9,
-        0x9F, 0xFB, 0x87, 0xFC, 0x97, 0xFA, 0xE5, 0xFF, 0xAA, 0xF8, 0x34, 0x02,
-        0x98, 0xF6, 0x15, 0x03, 0x66, 0xF5, 0xE0, 0x02, 0x16, 0xF5, 0x1D, 0x02,
-        0xF8, 0xF4, 0x83, 0x01, 0x43, 0xF5, 0xA4, 0x00, 0x86, 0xF6, 0x0D, 0x00,
-        0x99, 0xF8, 0x12, 0x00, 0x8D, 0xFB, 0xDD, 0x00, 0x04, 0xFE, 0xF8, 0x01,
-        0x31, 0xFF, 0x0B, 0x03, 0x2F, 0xFF, 0x38, 0x05, 0x72, 0xFE, 0xD8, 0x07,
-        0x52, 0xFE, 0xB4, 0x09, 0x46, 0xFF, 0x55, 0x0A, 0xB0, 0x00, 0x35, 0x0A,
-        0x5F, 0x02, 0x0D, 0x09, 0x9E, 0x03, 0x91, 0x06, 0x34, 0x04, 0xA1, 0x03,
-        0x31, 0x05, 0x83, 0x00, 0xFC, 0x06, 0x54, 0xFE, 0xF1, 0x08, 0x90, 0xFD,
-        0xEA, 0x09, 0xD9, 0xFD, 0x2D, 0x0A, 0x90, 0xFE, 0x5D, 0x0A, 0x05, 0xFF,
-        0x1D, 0x0A, 0xAC, 0xFF, 0x09, 0x09, 0x23, 0x00, 0x23, 0x07, 0x1E, 0x00,
-        0x46, 0x04, 0x62, 0xFF, 0xBE, 0x01, 0x51, 0xFE, 0x95, 0x00, 0x36, 0xFD,
-        0x78, 0x00, 0xED, 0xFA, 0x35, 0x01, 0x2B, 0xF8, 0x5A, 0x01, 0x48, 0xF6,
-        0x6A, 0x00, 0xAC, 0xF5, 0xFD, 0xFE, 0xDB, 0xF5, 0x4D, 0xFD, 0xFA, 0xF6,
-        0x22, 0xFC, 0x50, 0xF9, 0x9C, 0xFB, 0x17, 0xFC, 0xDB, 0xFA, 0x10, 0xFF,
-        0x17, 0xF9, 0x36, 0x01, 0x2C, 0xF7, 0xE9, 0x01, 0x1E, 0xF6, 0x9E, 0x01,
-        0xD5, 0xF5, 0x01, 0x01, 0xB2, 0xF5, 0x97, 0x00, 0x06, 0xF6, 0x06, 0x00,
-        0x17, 0xF7, 0x79, 0xFF, 0xF8, 0xF8, 0x5E, 0xFF, 0xC2, 0xFB, 0x01, 0x00,
-        0x21, 0xFE, 0xF7, 0x00, 0x30, 0xFF, 0xFA, 0x01, 0x35, 0xFF, 0x40, 0x04,
-        0x76, 0xFE, 0x0A, 0x07, 0x4F, 0xFE, 0xF2, 0x08, 0x3F, 0xFF, 0x93, 0x09,
-        0x9A, 0x00, 0x6D, 0x09, 0x42, 0x02, 0x52, 0x08, 0x5E, 0x03, 0xF3, 0x05,
-        0xBD, 0x03, 0x4B, 0x03, 0x82, 0x04, 0x5C, 0x00, 0x5A, 0x06, 0x6A, 0xFE,
-        0x5B, 0x08, 0xE9, 0xFD, 0x72, 0x09, 0x47, 0xFE, 0xC9, 0x09, 0xF3, 0xFE,
-        0xF9, 0x09, 0x50, 0xFF, 0xD1, 0x09, 0x09, 0x00, 0xD3, 0x08, 0xB1, 0x00,
-        0xE7, 0x06, 0xF0, 0x00, 0x05, 0x04, 0x6D, 0x00, 0x92, 0x01, 0x88, 0xFF,
-        0x7C, 0x00, 0x92, 0xFE, 0x63, 0x00, 0x34, 0xFC, 0x1D, 0x01, 0x4B, 0xF9,
-        0x51, 0x01, 0x55, 0xF7, 0x8A, 0x00, 0xBC, 0xF6, 0x5E, 0xFF, 0xEB, 0xF6,
-        0xC3, 0xFD, 0xFC, 0xF7, 0xA8, 0xFC, 0x31, 0xFA, 0x2B, 0xFC, 0xAC, 0xFC,
-        0x32, 0xFB, 0x63, 0xFF, 0x1D, 0xF9, 0x36, 0x01, 0x00, 0xF7, 0xB0, 0x01,
-        0xD3, 0xF5, 0x61, 0x01, 0x67, 0xF5, 0xC8, 0x00, 0x1B, 0xF5, 0x61, 0x00,
-        0x3A, 0xF5, 0x93, 0xFF, 0x5D, 0xF6, 0xE6, 0xFE, 0x82, 0xF8, 0x9D, 0xFE,
-        0x8E, 0xFB, 0x12, 0xFF, 0xFB, 0xFD, 0xE8, 0xFF, 0x10, 0xFF, 0x12, 0x01,
-        0x23, 0xFF, 0xAD, 0x03, 0x70, 0xFE, 0xCF, 0x06, 0x29, 0xFE, 0xCB, 0x08,
-        0xCC, 0xFE, 0x43, 0x09, 0xF6, 0xFF, 0xFA, 0x08, 0x9D, 0x01, 0xDD, 0x07,
-        0xDB, 0x02, 0xAC, 0x05, 0x88, 0x03, 0x35, 0x03, 0xB7, 0x04, 0x86, 0x00,
-        0xEB, 0x06, 0xBB, 0xFE, 0x1F, 0x09, 0x4A, 0xFE, 0x41, 0x0A, 0xA3, 0xFE,
-        0xA9, 0x0A, 0x33, 0xFF, 0xFB, 0x0A, 0x71, 0xFF, 0xC7, 0x0A, 0xF1, 0xFF,
-        0x93, 0x09, 0x74, 0x00, 0x61, 0x07, 0xB6, 0x00, 0x6F, 0x04, 0x7A, 0x00,
-        0x11, 0x02, 0xE3, 0xFF, 0x0D, 0x01, 0xB8, 0xFE, 0xFD, 0x00, 0x18, 0xFC,
-        0xBD, 0x01, 0xF8, 0xF8, 0x0F, 0x02, 0x22, 0xF7, 0x78, 0x01, 0xD5, 0xF6,
-        0x48, 0x00, 0x2E, 0xF7, 0x8D, 0xFE, 0x47, 0xF8, 0x49, 0xFD, 0x68, 0xFA,
-        0x95, 0xFC, 0xD4, 0xFC, 0x55, 0xFB, 0x8C, 0xFF, 0x22, 0xF9, 0x5F, 0x01,
-        0xFF, 0xF6, 0xDE, 0x01, 0xFC, 0xF5, 0x89, 0x01, 0xB5, 0xF5, 0x13, 0x01,
-        0x75, 0xF5, 0xF8, 0x00, 0xA3, 0xF5, 0xAA, 0x00, 0xB4, 0xF6, 0x44, 0x00,
-        0xB7, 0xF8, 0xD0, 0xFF, 0x88, 0xFB, 0xC4, 0xFF, 0xE2, 0xFD, 0x18, 0x00,
-        0xDF, 0xFE, 0x1A, 0x01, 0xE7, 0xFE, 0x9F, 0x03, 0x1A, 0xFE, 0xA9, 0x06,
-        0xC6, 0xFD, 0x7F, 0x08, 0x80, 0xFE, 0xDC, 0x08, 0xCD, 0xFF, 0xA4, 0x08,
-        0x96, 0x01, 0xA8, 0x07, 0xE0, 0x02, 0x96, 0x05, 0x91, 0x03, 0x2E, 0x03,
-        0xB5, 0x04, 0x75, 0x00, 0xC9, 0x06, 0x97, 0xFE, 0xBF, 0x08, 0x1D, 0xFE,
-        0x95, 0x09, 0x7C, 0xFE, 0xD4, 0x09, 0x03, 0xFF, 0x2B, 0x0A, 0x2A, 0xFF,
-        0x24, 0x0A, 0x72, 0xFF, 0x37, 0x09, 0xE0, 0xFF, 0x63, 0x07, 0x68, 0x00,
-        0x9B, 0x04, 0x8F, 0x00, 0x5D, 0x02, 0x51, 0x00, 0x83, 0x01, 0x53, 0xFF,
-        0x76, 0x01, 0xCB, 0xFC, 0x31, 0x02, 0xA8, 0xF9, 0x4F, 0x02, 0xB7, 0xF7,
-        0x5C, 0x01, 0x2F, 0xF7, 0xFF, 0xFF, 0x62, 0xF7, 0x38, 0xFE, 0x42, 0xF8,
-        0xF5, 0xFC, 0x2B, 0xFA, 0x5B, 0xFC, 0x83, 0xFC, 0x54, 0xFB, 0x33, 0xFF,
-        0x70, 0xF9, 0x18, 0x01, 0xCB, 0xF7, 0x87, 0x01, 0x31, 0xF7, 0x0C, 0x01,
-        0xFF, 0xF6, 0x6F, 0x00, 0x92, 0xF6, 0x41, 0x00, 0x5A, 0xF6, 0x14, 0x00,
-        0xFB, 0xF6, 0xC3, 0xFF, 0xA7, 0xF8, 0x49, 0xFF, 0x58, 0xFB, 0x21, 0xFF,
-        0x91, 0xFD, 0x69, 0xFF, 0x81, 0xFE, 0x5F, 0x00, 0x9F, 0xFE, 0xFD, 0x02,
-        0xF3, 0xFD, 0x20, 0x06, 0xF5, 0xFD, 0x2F, 0x08, 0xF3, 0xFE, 0xB2, 0x08,
-        0x49, 0x00, 0x8F, 0x08, 0x02, 0x02, 0xC0, 0x07, 0x58, 0x03, 0xE6, 0x05,
-        0xED, 0x03, 0xA1, 0x03, 0xDA, 0x04, 0xFC, 0x00, 0x96, 0x06, 0x0E, 0xFF,
-        0x1A, 0x08, 0x88, 0xFE, 0x93, 0x08, 0x07, 0xFF, 0xCB, 0x08, 0x9C, 0xFF,
-        0x50, 0x09, 0xAE, 0xFF, 0x9E, 0x09, 0xD0, 0xFF, 0x07, 0x09, 0x22, 0x00,
-        0x38, 0x07, 0xAA, 0x00, 0x60, 0x04, 0xF8, 0x00, 0x13, 0x02, 0xC8, 0x00,
-        0x34, 0x01, 0xD9, 0xFF, 0x46, 0x01, 0x44, 0xFD, 0x00, 0x02, 0x18, 0xFA,
-        0x07, 0x02, 0xFE, 0xF7, 0x08, 0x01, 0x62, 0xF7, 0xA3, 0xFF, 0x7D, 0xF7,
-        0xE7, 0xFD, 0x37, 0xF8, 0x80, 0xFC, 0x02, 0xFA, 0xD5, 0xFB, 0x53, 0xFC,
-        0xDA, 0xFA, 0xFB, 0xFE, 0x18, 0xF9, 0xFE, 0x00, 0xA0, 0xF7, 0x7B, 0x01,
-        0x3A, 0xF7, 0x01, 0x01, 0x22, 0xF7, 0x5E, 0x00, 0xB1, 0xF6, 0x41, 0x00,
-        0x6D, 0xF6, 0x17, 0x00, 0xFD, 0xF6, 0xBB, 0xFF, 0xDD, 0xF8, 0x1A, 0xFF,
-        0xD2, 0xFB, 0xB1, 0xFE, 0x47, 0xFE, 0xCA, 0xFE, 0x32, 0xFF, 0xA7, 0xFF,
-        0x06, 0xFF, 0x57, 0x02, 0x37, 0xFE, 0xAE, 0x05, 0x39, 0xFE, 0x0D, 0x08,
-        0x31, 0xFF, 0xDB, 0x08, 0x98, 0x00, 0xD1, 0x08, 0x60, 0x02, 0x03, 0x08,
-        0xDB, 0x03, 0x12, 0x06, 0xA3, 0x04, 0xAD, 0x03, 0xA0, 0x05, 0xDE, 0x00,
-        0x57, 0x07, 0xC1, 0xFE, 0xBC, 0x08, 0x28, 0xFE, 0x1E, 0x09, 0x97, 0xFE,
-        0x39, 0x09, 0x3C, 0xFF, 0xA4, 0x09, 0x76, 0xFF, 0xE3, 0x09, 0xB7, 0xFF,
-        0x3F, 0x09, 0x30, 0x00, 0x46, 0x07, 0xF0, 0x00, 0x30, 0x04, 0x66, 0x01,
-        0xA0, 0x01, 0x69, 0x01, 0x94, 0x00, 0xA0, 0x00, 0xD5, 0x00, 0xF4, 0xFD,
-        0xA5, 0x01, 0x8B, 0xFA, 0xB5, 0x01, 0x10, 0xF8, 0xC5, 0x00, 0x2D, 0xF7,
-        0x66, 0xFF, 0x36, 0xF7, 0x94, 0xFD, 0x29, 0xF8, 0x22, 0xFC, 0x2F, 0xFA,
-        0x69, 0xFB, 0xC1, 0xFC, 0x7C, 0xFA, 0xC4, 0xFF, 0xCE, 0xF8, 0x02, 0x02,
-        0x2E, 0xF7, 0x8F, 0x02, 0x76, 0xF6, 0x11, 0x02, 0xFE, 0xF5, 0x3F, 0x01,
-        0x72, 0xF5, 0xE5, 0x00, 0x2A, 0xF5, 0x83, 0x00, 0xF2, 0xF5, 0xE6, 0xFF,
-        0x21, 0xF8, 0x15, 0xFF, 0x7A, 0xFB, 0x93, 0xFE, 0x46, 0xFE, 0x89, 0xFE,
-        0x6E, 0xFF, 0x2F, 0xFF, 0x29, 0xFF, 0xCB, 0x01, 0x4F, 0xFE, 0x31, 0x05,
-        0x22, 0xFE, 0xC4, 0x07, 0x0A, 0xFF, 0xC9, 0x08, 0x68, 0x00, 0xB7, 0x08,
-        0x4A, 0x02, 0xAE, 0x07, 0xD9, 0x03, 0x80, 0x05, 0xB4, 0x04, 0xCC, 0x02,
-        0xC1, 0x05, 0x9F, 0xFF, 0xA9, 0x07, 0x72, 0xFD, 0x8C, 0x09, 0xEA, 0xFC,
-        0x97, 0x0A, 0x91, 0xFD, 0x29, 0x0B, 0x6B, 0xFE, 0xA6, 0x0B, 0xE7, 0xFE,
-        0xB6, 0x0B, 0x55, 0xFF, 0xAC, 0x0A, 0xEF, 0xFF, 0x31, 0x08, 0xA4, 0x00,
-        0xA3, 0x04, 0x04, 0x01, 0xCB, 0x01, 0x10, 0x01, 0xAD, 0x00, 0x6C, 0x00,
-        0xFE, 0x00, 0xD9, 0xFD, 0x03, 0x02, 0x7F, 0xFA, 0x53, 0x02, 0xFE, 0xF7,
-        0x9E, 0x01, 0x13, 0xF7, 0x2F, 0x00, 0x3B, 0xF7, 0x28, 0xFE, 0x67, 0xF8,
-        0x53, 0xFC, 0xB2, 0xFA, 0x43, 0xFB, 0x80, 0xFD, 0xF5, 0xF9, 0x9F, 0x00,
-        0xEC, 0xF7, 0xC4, 0x02, 0x05, 0xF6, 0x3C, 0x03, 0x0B, 0xF5, 0x9D, 0x02,
-        0x8B, 0xF4, 0xB8, 0x01, 0x29, 0xF4, 0x45, 0x01, 0x49, 0xF4, 0xD5, 0x00,
-        0x81, 0xF5, 0x6C, 0x00, 0x31, 0xF8, 0xD6, 0xFF, 0xCB, 0xFB, 0x8C, 0xFF,
-        0x86, 0xFE, 0x80, 0xFF, 0x7D, 0xFF, 0x24, 0x00, 0x06, 0xFF, 0xAC, 0x02,
-        0xD2, 0xFD, 0xF0, 0x05, 0x5D, 0xFD, 0x34, 0x08, 0x0A, 0xFE, 0xE3, 0x08,
-        0x8E, 0xFF, 0x86, 0x08, 0xBC, 0x01, 0x56, 0x07, 0xB7, 0x03, 0x02, 0x05,
-        0xDB, 0x04, 0x42, 0x02, 0x2E, 0x06, 0x24, 0xFF, 0x37, 0x08, 0xF8, 0xFC,
-        0x12, 0x0A, 0x68, 0xFC, 0x12, 0x0B, 0x17, 0xFD, 0x8D, 0x0B, 0x26, 0xFE,
-        0xE9, 0x0B, 0xD6, 0xFE, 0xB9, 0x0B, 0x5F, 0xFF, 0x77, 0x0A, 0xD5, 0xFF,
-        0xDB, 0x07, 0x65, 0x00, 0x64, 0x04, 0xE0, 0x00, 0xC7, 0x01, 0x08, 0x01,
-        0xCD, 0x00, 0x71, 0x00, 0x3E, 0x01, 0xE7, 0xFD, 0x75, 0x02, 0xA8, 0xFA,
-        0xFD, 0x02, 0x74, 0xF8, 0x32, 0x02, 0xAC, 0xF7, 0x96, 0x00, 0xE9, 0xF7,
-        0x40, 0xFE, 0x01, 0xF9, 0x5E, 0xFC, 0x55, 0xFB, 0x4D, 0xFB, 0x2F, 0xFE,
-        0xF9, 0xF9, 0x65, 0x01, 0xEE, 0xF7, 0xA0, 0x03, 0x08, 0xF6, 0x23, 0x04,
-        0xFD, 0xF4, 0x65, 0x03, 0x6C, 0xF4, 0x29, 0x02, 0x1C, 0xF4, 0x53, 0x01,
-        0x4C, 0xF4, 0xA7, 0x00, 0x82, 0xF5, 0x24, 0x00, 0x0A, 0xF8, 0x72, 0xFF,
-        0x69, 0xFB, 0xCF, 0xFE, 0xFC, 0xFD, 0x96, 0xFE, 0xF7, 0xFE, 0x37, 0xFF,
-        0x7F, 0xFE, 0xE1, 0x01, 0x26, 0xFD, 0x50, 0x05, 0xB4, 0xFC, 0xB2, 0x07,
-        0x99, 0xFD, 0xA2, 0x08, 0x55, 0xFF, 0x7A, 0x08, 0x8D, 0x01, 0x45, 0x07,
-        0x3B, 0x03, 0xE1, 0x04, 0x1D, 0x04, 0x00, 0x02, 0x7B, 0x05, 0xDB, 0xFE,
-        0xAC, 0x07, 0x98, 0xFC, 0xCB, 0x09, 0x09, 0xFC, 0x10, 0x0B, 0xB9, 0xFC,
-        0xC1, 0x0B, 0xF6, 0xFD, 0x2A, 0x0C, 0xBC, 0xFE, 0xFB, 0x0B, 0x64, 0xFF,
-        0xCB, 0x0A, 0xF6, 0xFF, 0x58, 0x08, 0xBF, 0x00, 0xF8, 0x04, 0x85, 0x01,
-        0x4B, 0x02, 0xD3, 0x01, 0x2C, 0x01, 0x31, 0x01, 0x97, 0x01, 0x7A, 0xFE,
-        0xEF, 0x02, 0xF8, 0xFA, 0x66, 0x03, 0x59, 0xF8, 0x8A, 0x02, 0x48, 0xF7,
-        0xD4, 0x00, 0x6C, 0xF7, 0xCF, 0xFE, 0xC0, 0xF8, 0x44, 0xFD, 0x2A, 0xFB,
-        0x55, 0xFC, 0x06, 0xFE, 0xDF, 0xFA, 0x1C, 0x01, 0x8B, 0xF8, 0x6A, 0x03,
-        0x51, 0xF6, 0x2C, 0x04, 0xF3, 0xF4, 0x91, 0x03, 0x41, 0xF4, 0x5E, 0x02,
-        0xE1, 0xF3, 0xA2, 0x01, 0x30, 0xF4, 0x06, 0x01, 0x5F, 0xF5, 0x69, 0x00,
-        0xE9, 0xF7, 0x8B, 0xFF, 0x6C, 0xFB, 0xAD, 0xFE, 0x44, 0xFE, 0x4B, 0xFE,
-        0x81, 0xFF, 0xE9, 0xFE, 0x04, 0xFF, 0x9C, 0x01, 0x98, 0xFD, 0x3D, 0x05,
-        0xEF, 0xFC, 0x0A, 0x08, 0x9B, 0xFD, 0x31, 0x09, 0x0B, 0xFF, 0x04, 0x09,
-        0xF5, 0x00, 0xB4, 0x07, 0x64, 0x02, 0x4D, 0x05, 0x41, 0x03, 0x8A, 0x02,
-        0x9C, 0x04, 0x6C, 0xFF, 0xDB, 0x06, 0x09, 0xFD, 0x15, 0x09, 0x32, 0xFC,
-        0x7A, 0x0A, 0xDA, 0xFC, 0x35, 0x0B, 0x03, 0xFE, 0xA1, 0x0B, 0xC2, 0xFE,
-        0x5E, 0x0B, 0x60, 0xFF, 0x42, 0x0A, 0xFC, 0xFF, 0xE9, 0x07, 0xDC, 0x00,
-        0x7E, 0x04, 0xB8, 0x01, 0xA9, 0x01, 0x16, 0x02, 0x73, 0x00, 0x60, 0x01,
-        0x06, 0x01, 0x98, 0xFE, 0x9C, 0x02, 0xD9, 0xFA, 0x6D, 0x03, 0xF3, 0xF7,
-        0xEE, 0x02, 0xB5, 0xF6, 0x98, 0x01, 0xE8, 0xF6, 0xC0, 0xFF, 0x55, 0xF8,
-        0x6D, 0xFE, 0xD0, 0xFA, 0xA5, 0xFD, 0xA9, 0xFD, 0x6A, 0xFC, 0xC8, 0x00,
-        0x39, 0xFA, 0x42, 0x03, 0xE7, 0xF7, 0x1B, 0x04, 0x69, 0xF6, 0x7F, 0x03,
-        0x7E, 0xF5, 0x4C, 0x02, 0xEA, 0xF4, 0x75, 0x01, 0xF9, 0xF4, 0xB2, 0x00,
-        0xDD, 0xF5, 0xF8, 0xFF, 0xF4, 0xF7, 0x0B, 0xFF, 0x38, 0xFB, 0x31, 0xFE,
-        0xFA, 0xFD, 0xD5, 0xFD, 0x35, 0xFF, 0xB5, 0xFE, 0xB3, 0xFE, 0xA2, 0x01,
-        0x34, 0xFD, 0x90, 0x05, 0x75, 0xFC, 0xAA, 0x08, 0xDA, 0xFC, 0xF6, 0x09,
-        0x23, 0xFE, 0xCE, 0x09, 0xD6, 0xFF, 0x4A, 0x08, 0x29, 0x01, 0xC1, 0x05,
-        0xE7, 0x01, 0xCF, 0x02, 0x19, 0x03, 0xA0, 0xFF, 0x46, 0x05, 0x16, 0xFD,
-        0x8F, 0x07, 0x27, 0xFC, 0x21, 0x09, 0xAA, 0xFC, 0x09, 0x0A, 0xC9, 0xFD,
-        0xBA, 0x0A, 0x9A, 0xFE, 0xB9, 0x0A, 0x61, 0xFF, 0xF7, 0x09, 0x28, 0x00,
-        0x02, 0x08, 0x04, 0x01, 0xEA, 0x04, 0xD0, 0x01, 0x3C, 0x02, 0xF8, 0x01,
-        0x06, 0x01, 0xD0, 0x00, 0x85, 0x01, 0x9C, 0xFD, 0xFD, 0x02, 0x74, 0xF9,
-        0xD9, 0x03, 0x44, 0xF6, 0x73, 0x03, 0x0D, 0xF5, 0x32, 0x02, 0x6F, 0xF5,
-        0x70, 0x00, 0x31, 0xF7, 0x27, 0xFF, 0xE2, 0xF9, 0x57, 0xFE, 0xEA, 0xFC,
-        0x18, 0xFD, 0x26, 0x00, 0xEA, 0xFA, 0xBA, 0x02, 0xB8, 0xF8, 0xB8, 0x03,
-        0x43, 0xF7, 0x3C, 0x03, 0x58, 0xF6, 0x1A, 0x02, 0x9A, 0xF5, 0x3F, 0x01,
-        0xA0, 0xF5, 0x44, 0x00, 0x5F, 0xF6, 0x66, 0xFF, 0x36, 0xF8, 0x7D, 0xFE,
-        0x42, 0xFB, 0xB9, 0xFD, 0xCB, 0xFD, 0xB6, 0xFD, 0xE6, 0xFE, 0x24, 0xFF,
-        0x58, 0xFE, 0x81, 0x02, 0xD3, 0xFC, 0xAF, 0x06, 0xEB, 0xFB, 0xBB, 0x09,
-        0x37, 0xFC, 0xBB, 0x0A, 0x7F, 0xFD, 0x0F, 0x0A, 0x4C, 0xFF, 0x2A, 0x08,
-        0xAF, 0x00, 0x59, 0x05, 0x81, 0x01, 0x54, 0x02, 0xCF, 0x02, 0x22, 0xFF,
-        0xF8, 0x04, 0xAB, 0xFC, 0x1C, 0x07, 0xB8, 0xFB, 0x5B, 0x08, 0x65, 0xFC,
-        0x22, 0x09, 0xAB, 0xFD, 0xCB, 0x09, 0x96, 0xFE, 0xCC, 0x09, 0x80, 0xFF,
-        0x0E, 0x09, 0x4D, 0x00, 0x2F, 0x07, 0x25, 0x01, 0x3A, 0x04, 0xD3, 0x01,
-        0xAB, 0x01, 0x9E, 0x01, 0xB0, 0x00, 0xFB, 0xFF, 0x62, 0x01, 0x82, 0xFC,
-        0x17, 0x03, 0x60, 0xF8, 0x13, 0x04, 0x61, 0xF5, 0xBF, 0x03, 0xA2, 0xF4,
-        0x67, 0x02, 0x95, 0xF5, 0x9F, 0x00, 0xB0, 0xF7, 0x3E, 0xFF, 0x8B, 0xFA,
-        0x54, 0xFE, 0x79, 0xFD, 0xEB, 0xFC, 0x92, 0x00, 0xB5, 0xFA, 0xE7, 0x02,
-        0x85, 0xF8, 0xD0, 0x03, 0x3A, 0xF7, 0x1D, 0x03, 0x7F, 0xF6, 0xC8, 0x01,
-        0xF7, 0xF5, 0xEC, 0x00, 0x06, 0xF6, 0x16, 0x00, 0xCE, 0xF6, 0x6E, 0xFF,
-        0xBF, 0xF8, 0xA9, 0xFE, 0xC6, 0xFB, 0xF9, 0xFD, 0x67, 0xFE, 0x2E, 0xFE,
-        0x3D, 0xFF, 0xEA, 0xFF, 0x4E, 0xFE, 0x69, 0x03, 0x6E, 0xFC, 0x77, 0x07,
-        0x53, 0xFB, 0x41, 0x0A, 0x8F, 0xFB, 0xB7, 0x0A, 0xDB, 0xFC, 0x97, 0x09,
-        0xBB, 0xFE, 0x71, 0x07, 0x42, 0x00, 0xA6, 0x04, 0x55, 0x01, 0xD7, 0x01,
-        0xE9, 0x02, 0xD5, 0xFE, 0x50, 0x05, 0x7A, 0xFC, 0xA1, 0x07, 0x9B, 0xFB,
-        0xEE, 0x08, 0x60, 0xFC, 0x79, 0x09, 0xBF, 0xFD, 0xD9, 0x09, 0xA5, 0xFE,
-        0x8C, 0x09, 0x6E, 0xFF, 0xA0, 0x08, 0x10, 0x00, 0xA5, 0x06, 0xCC, 0x00,
-        0x7D, 0x03, 0x86, 0x01, 0xE5, 0x00, 0x5C, 0x01, 0x20, 0x00, 0xB4, 0xFF,
-        0x63, 0x01, 0x47, 0xFC, 0x9B, 0x03, 0x48, 0xF8, 0xFD, 0x04, 0x8E, 0xF5,
-        0xDB, 0x04, 0x0D, 0xF5, 0x72, 0x03, 0x2E, 0xF6, 0x7E, 0x01, 0x38, 0xF8,
-        0xCE, 0xFF, 0xE4, 0xFA, 0x97, 0xFE, 0xA7, 0xFD, 0xDD, 0xFC, 0xA1, 0x00,
-        0x53, 0xFA, 0x12, 0x03, 0xF8, 0xF7, 0xF1, 0x03, 0xAE, 0xF6, 0x2A, 0x03,
-        0x2D, 0xF6, 0xBB, 0x01, 0x04, 0xF6, 0xD3, 0x00, 0x81, 0xF6, 0x1F, 0x00,
-        0xA1, 0xF7, 0x80, 0xFF, 0xBE, 0xF9, 0xAF, 0xFE, 0xE8, 0xFC, 0xCF, 0xFD,
-        0x66, 0xFF, 0xE8, 0xFD, 0xF8, 0xFF, 0x84, 0xFF, 0x88, 0xFE, 0xF9, 0x02,
-        0x1C, 0xFC, 0x0D, 0x07, 0xAC, 0xFA, 0xF7, 0x09, 0xDB, 0xFA, 0xA9, 0x0A,
-        0x5A, 0xFC, 0xBD, 0x09, 0x71, 0xFE, 0xE6, 0x07, 0x2A, 0x00, 0x4B, 0x05,
-        0x75, 0x01, 0x91, 0x02, 0x27, 0x03, 0x97, 0xFF, 0xBE, 0x05, 0x30, 0xFD,
-        0x19, 0x08, 0x45, 0xFC, 0x5B, 0x09, 0x03, 0xFD, 0xB2, 0x09, 0x75, 0xFE,
-        0xA8, 0x09, 0x83, 0xFF, 0xF2, 0x08, 0x60, 0x00, 0xB9, 0x07, 0x2A, 0x01,
-        0xB5, 0x05, 0x28, 0x02, 0xAC, 0x02, 0x28, 0x03, 0x6C, 0x00, 0x17, 0x03,
-        0xFE, 0xFF, 0x5F, 0x01, 0x8C, 0x01, 0xC8, 0xFD, 0xEC, 0x03, 0x90, 0xF9,
-        0x52, 0x05, 0x79, 0xF6, 0x14, 0x05, 0xA5, 0xF5, 0x9F, 0x03, 0x77, 0xF6,
-        0x9E, 0x01, 0x50, 0xF8, 0xD9, 0xFF, 0xD7, 0xFA, 0x8C, 0xFE, 0xA4, 0xFD,
-        0xD6, 0xFC, 0xAE, 0x00, 0x57, 0xFA, 0x2B, 0x03, 0x28, 0xF8, 0x01, 0x04,
-        0x1C, 0xF7, 0x3D, 0x03, 0xC8, 0xF6, 0xC4, 0x01, 0xDE, 0xF6, 0x98, 0x00,
-        0x94, 0xF7, 0x8C, 0xFF, 0xC1, 0xF8, 0xA5, 0xFE, 0xAE, 0xFA, 0xAD, 0xFD,
-        0x7D, 0xFD, 0xCD, 0xFC, 0x9E, 0xFF, 0x09, 0xFD, 0x11, 0x00, 0xFB, 0xFE,
-        0xA8, 0xFE, 0xCB, 0x02, 0x61, 0xFC, 0x25, 0x07, 0x0A, 0xFB, 0x2E, 0x0A,
-        0x5C, 0xFB, 0xF8, 0x0A, 0xDC, 0xFC, 0x16, 0x0A, 0xE9, 0xFE, 0x35, 0x08,
-        0xAB, 0x00, 0x8E, 0x05, 0xD1, 0x01, 0xB9, 0x02, 0x3F, 0x03, 0xB5, 0xFF,
-        0x74, 0x05, 0x5A, 0xFD, 0x77, 0x07, 0x8D, 0xFC, 0x75, 0x08, 0x4C, 0xFD,
-        0xD7, 0x08, 0xC7, 0xFE, 0xCD, 0x08, 0x01, 0x00, 0x41, 0x08, 0x07, 0x01,
-        0x1C, 0x07, 0xDC, 0x01, 0x22, 0x05, 0xCE, 0x02, 0x6C, 0x02, 0x7C, 0x03,
-        0x74, 0x00, 0x01, 0x03, 0x26, 0x00, 0xE9, 0x00, 0x89, 0x01, 0x30, 0xFD,
-        0xBA, 0x03, 0x20, 0xF9, 0xF2, 0x04, 0x63, 0xF6, 0x83, 0x04, 0xD1, 0xF5,
-        0xF9, 0x02, 0xE7, 0xF6, 0xFA, 0x00, 0xE5, 0xF8, 0x69, 0xFF, 0x88, 0xFB,
-        0x6F, 0xFE, 0x40, 0xFE, 0x33, 0xFD, 0x24, 0x01, 0x17, 0xFB, 0x4A, 0x03,
-        0x17, 0xF9, 0xD5, 0x03, 0xF1, 0xF7, 0xE6, 0x02, 0x6C, 0xF7, 0x4A, 0x01,
-        0x66, 0xF7, 0x08, 0x00, 0xFE, 0xF7, 0x12, 0xFF, 0x2A, 0xF9, 0x45, 0xFE,
-        0x14, 0xFB, 0x86, 0xFD, 0xB2, 0xFD, 0xF4, 0xFC, 0x91, 0xFF, 0x79, 0xFD,
-        0xE4, 0xFF, 0x77, 0xFF, 0x90, 0xFE, 0x04, 0x03, 0x85, 0xFC, 0xC9, 0x06,
-        0x69, 0xFB, 0x52, 0x09, 0xDF, 0xFB, 0xC0, 0x09, 0x60, 0xFD, 0xAD, 0x08,
-        0x49, 0xFF, 0xAF, 0x06, 0xCA, 0x00, 0x0D, 0x04, 0xB4, 0x01, 0x78, 0x01,
-        0xE2, 0x02, 0xE4, 0xFE, 0x09, 0x05, 0x12, 0xFD, 0x1A, 0x07, 0xC7, 0xFC,
-        0x5D, 0x08, 0xD2, 0xFD, 0xF1, 0x08, 0x53, 0xFF, 0x09, 0x09, 0x86, 0x00,
-        0x81, 0x08, 0x45, 0x01, 0x5C, 0x07, 0xFA, 0x01, 0x69, 0x05, 0xBD, 0x02,
-        0xCE, 0x02, 0x45, 0x03, 0xDA, 0x00, 0xD1, 0x02, 0x6F, 0x00, 0xD7, 0x00,
-        0x9F, 0x01, 0x6B, 0xFD, 0x9D, 0x03, 0xB8, 0xF9, 0xAD, 0x04, 0x55, 0xF7,
-        0x33, 0x04, 0x04, 0xF7, 0xA5, 0x02, 0x30, 0xF8, 0xCC, 0x00, 0x1D, 0xFA,
-        0x32, 0xFF, 0x81, 0xFC, 0x39, 0xFE, 0xCB, 0xFE, 0xFA, 0xFC, 0x0E, 0x01,
-        0xE2, 0xFA, 0x9B, 0x02, 0xCF, 0xF8, 0xCD, 0x02, 0x7C, 0xF7, 0xCF, 0x01,
-        0xDA, 0xF6, 0x5A, 0x00, 0xCA, 0xF6, 0x33, 0xFF, 0x54, 0xF7, 0x59, 0xFE,
-        0x7D, 0xF8, 0x91, 0xFD, 0x6F, 0xFA, 0xD1, 0xFC, 0x01, 0xFD, 0x5A, 0xFC,
-        0x08, 0xFF, 0xF3, 0xFC, 0x92, 0xFF, 0xFF, 0xFE, 0x79, 0xFE, 0x72, 0x02,
-        0x7E, 0xFC, 0xFF, 0x05, 0x5C, 0xFB, 0x39, 0x08, 0xD8, 0xFB, 0x7D, 0x08,
-        0x62, 0xFD, 0x5A, 0x07, 0x3E, 0xFF, 0x98, 0x05, 0xE4, 0x00, 0x5C, 0x03,
-        0xF5, 0x01, 0x3E, 0x01, 0x3B, 0x03, 0x32, 0xFF, 0x48, 0x05, 0xA1, 0xFD,
-        0x46, 0x07, 0x5E, 0xFD, 0x80, 0x08, 0x53, 0xFE, 0x11, 0x09, 0xC7, 0xFF,
-        0x20, 0x09, 0xF1, 0x00, 0xA6, 0x08, 0xD6, 0x01, 0x9F, 0x07, 0x7D, 0x02,
-        0xBB, 0x05, 0x27, 0x03, 0x24, 0x03, 0x7E, 0x03, 0xFD, 0x00, 0xDE, 0x02,
-        0x64, 0x00, 0xD0, 0x00, 0x69, 0x01, 0x60, 0xFD, 0x4A, 0x03, 0xE3, 0xF9,
-        0x60, 0x04, 0xB8, 0xF7, 0xE2, 0x03, 0x7C, 0xF7, 0x49, 0x02, 0x95, 0xF8,
-        0x51, 0x00, 0x59, 0xFA, 0x8F, 0xFE, 0x8E, 0xFC, 0x91, 0xFD, 0x7E, 0xFE,
-        0x77, 0xFC, 0x6D, 0x00, 0x8F, 0xFA, 0xEA, 0x01, 0xB7, 0xF8, 0x31, 0x02,
-        0x99, 0xF7, 0x4C, 0x01, 0x0D, 0xF7, 0xF7, 0xFF, 0xFE, 0xF6, 0xEE, 0xFE,
-        0x6E, 0xF7, 0x18, 0xFE, 0x76, 0xF8, 0x6B, 0xFD, 0x45, 0xFA, 0xC2, 0xFC,
-        0xCD, 0xFC, 0x66, 0xFC, 0xE0, 0xFE, 0x06, 0xFD, 0x86, 0xFF, 0x0E, 0xFF,
-        0x94, 0xFE, 0x7C, 0x02, 0xCC, 0xFC, 0xEF, 0x05, 0xC1, 0xFB, 0x09, 0x08,
-        0x62, 0xFC, 0x1E, 0x08, 0x08, 0xFE, 0xF4, 0x06, 0xF5, 0xFF, 0x31, 0x05,
-        0x7B, 0x01, 0x1C, 0x03, 0x4D, 0x02, 0x56, 0x01, 0x63, 0x03, 0xA3, 0xFF,
-        0x56, 0x05, 0x33, 0xFE, 0x33, 0x07, 0xD1, 0xFD, 0x5E, 0x08, 0x7C, 0xFE,
-        0xF4, 0x08, 0x9D, 0xFF, 0xFF, 0x08, 0x9E, 0x00, 0x8B, 0x08, 0x70, 0x01,
-        0xA5, 0x07, 0x08, 0x02, 0xFF, 0x05, 0xB6, 0x02, 0x9B, 0x03, 0x23, 0x03,
-        0x97, 0x01, 0x9A, 0x02, 0xF0, 0x00, 0xA8, 0x00, 0xBE, 0x01, 0x69, 0xFD,
-        0x60, 0x03, 0x36, 0xFA, 0x45, 0x04, 0x4B, 0xF8, 0xB3, 0x03, 0x4C, 0xF8,
-        0x0F, 0x02, 0x84, 0xF9, 0x25, 0x00, 0x3D, 0xFB, 0x97, 0xFE, 0x37, 0xFD,
-        0xBF, 0xFD, 0xDD, 0xFE, 0x8F, 0xFC, 0x7B, 0x00, 0x8B, 0xFA, 0xE1, 0x01,
-        0x9A, 0xF8, 0x3F, 0x02, 0x62, 0xF7, 0xB2, 0x01, 0xC1, 0xF6, 0xC0, 0x00,
-        0xBD, 0xF6, 0xDE, 0xFF, 0x30, 0xF7, 0x14, 0xFF, 0x10, 0xF8, 0x7F, 0xFE,
-        0xB1, 0xF9, 0xDD, 0xFD, 0x18, 0xFC, 0x72, 0xFD, 0x37, 0xFE, 0xE6, 0xFD,
-        0xF1, 0xFE, 0xB8, 0xFF, 0x1B, 0xFE, 0xD2, 0x02, 0x67, 0xFC, 0xF4, 0x05,
-        0x71, 0xFB, 0xD1, 0x07, 0x1E, 0xFC, 0xC5, 0x07, 0xD2, 0xFD, 0x8D, 0x06,
-        0xD8, 0xFF, 0xEC, 0x04, 0x79, 0x01, 0x05, 0x03, 0x76, 0x02, 0x7E, 0x01,
-        0xA9, 0x03, 0x02, 0x00, 0xAD, 0x05, 0xB4, 0xFE, 0xA5, 0x07, 0x36, 0xFE,
-        0xF6, 0x08, 0x96, 0xFE, 0x86, 0x09, 0x4E, 0xFF, 0x7A, 0x09, 0x0F, 0x00,
-        0xE9, 0x08, 0xB0, 0x00, 0xED, 0x07, 0x39, 0x01, 0x2C, 0x06, 0xD0, 0x01,
-        0xAD, 0x03, 0x30, 0x02, 0xA0, 0x01, 0xAB, 0x01, 0x06, 0x01, 0xEB, 0xFF,
-        0xE1, 0x01, 0xFA, 0xFC, 0xB2, 0x03, 0x07, 0xFA, 0xBD, 0x04, 0x4C, 0xF8,
-        0x3F, 0x04, 0x62, 0xF8, 0x96, 0x02, 0x9D, 0xF9, 0x94, 0x00, 0x2E, 0xFB,
-        0xDC, 0xFE, 0x09, 0xFD, 0xDA, 0xFD, 0x8E, 0xFE, 0xAD, 0xFC, 0x09, 0x00,
-        0xA2, 0xFA, 0x68, 0x01, 0xAE, 0xF8, 0xF6, 0x01, 0x6A, 0xF7, 0xB3, 0x01,
-        0xE5, 0xF6, 0x07, 0x01, 0x02, 0xF7, 0x58, 0x00, 0x9C, 0xF7, 0xA4, 0xFF,
-        0xA2, 0xF8, 0x1A, 0xFF, 0x65, 0xFA, 0x85, 0xFE, 0xEA, 0xFC, 0x42, 0xFE,
-        0x05, 0xFF, 0xC7, 0xFE, 0xAF, 0xFF, 0x7D, 0x00, 0xA5, 0xFE, 0x59, 0x03,
-        0x9A, 0xFC, 0x3B, 0x06, 0x3F, 0xFB, 0xFD, 0x07, 0x92, 0xFB, 0xFA, 0x07,
-        0x27, 0xFD, 0xD6, 0x06, 0x3C, 0xFF, 0x44, 0x05, 0x32, 0x01, 0x6F, 0x03,
-        0x69, 0x02, 0xF6, 0x01, 0xB9, 0x03, 0x93, 0x00, 0xBD, 0x05, 0x33, 0xFF,
-        0xAB, 0x07, 0x96, 0xFE, 0xE3, 0x08, 0xCC, 0xFE, 0x8D, 0x09, 0x5F, 0xFF,
-        0x92, 0x09, 0xE9, 0xFF, 0xFB, 0x08, 0x79, 0x00, 0xCE, 0x07, 0xFB, 0x00,
-        0xDD, 0x05, 0x83, 0x01, 0x2A, 0x03, 0xB3, 0x01, 0xF7, 0x00, 0x26, 0x01,
-        0x4A, 0x00, 0x6F, 0xFF, 0x6B, 0x01, 0xAB, 0xFC, 0xA0, 0x03, 0xC8, 0xF9,
-        0x18, 0x05, 0x11, 0xF8, 0xC6, 0x04, 0x0A, 0xF8, 0x24, 0x03, 0x2D, 0xF9,
-        0xDA, 0x00, 0xB1, 0xFA, 0xBA, 0xFE, 0x73, 0xFC, 0x75, 0xFD, 0xDE, 0xFD,
-        0x36, 0xFC, 0x41, 0xFF, 0x2D, 0xFA, 0xBD, 0x00, 0x36, 0xF8, 0x8E, 0x01,
-        0xF3, 0xF6, 0xAD, 0x01, 0x42, 0xF6, 0x5D, 0x01, 0x45, 0xF6, 0xF5, 0x00,
-        0xFA, 0xF6, 0x65, 0x00, 0x47, 0xF8, 0xCE, 0xFF, 0x58, 0xFA, 0x4D, 0xFF,
-        0x18, 0xFD, 0xF9, 0xFE, 0x33, 0xFF, 0x59, 0xFF, 0xBB, 0xFF, 0xCF, 0x00,
-        0x78, 0xFE, 0x74, 0x03, 0x2A, 0xFC, 0x1F, 0x06, 0xBA, 0xFA, 0xBF, 0x07,
-        0x04, 0xFB, 0xAD, 0x07, 0xA2, 0xFC, 0x88, 0x06, 0xE6, 0xFE, 0xFA, 0x04,
-        0x00, 0x01, 0x33, 0x03, 0x38, 0x02, 0xC7, 0x01, 0x7B, 0x03, 0x48, 0x00,
-        0x76, 0x05, 0xA8, 0xFE, 0x64, 0x07, 0x9A, 0xFD, 0x9F, 0x08, 0x4B, 0xFD,
-        0x58, 0x09, 0x79, 0xFD, 0x4F, 0x09, 0xF0, 0xFD, 0xAD, 0x08, 0x98, 0xFE,
-        0x7C, 0x07, 0x3D, 0xFF, 0x81, 0x05, 0xE6, 0xFF, 0xD2, 0x02, 0x5C, 0x00,
-        0xBB, 0x00, 0x47, 0x00, 0x3F, 0x00, 0x0A, 0xFF, 0x73, 0x01, 0x8B, 0xFC,
-        0xB0, 0x03, 0x05, 0xFA, 0x1D, 0x05, 0x7B, 0xF8, 0xCA, 0x04, 0x93, 0xF8,
-        0x1E, 0x03, 0xAB, 0xF9, 0xC1, 0x00, 0x1B, 0xFB, 0x9D, 0xFE, 0xC5, 0xFC,
-        0x64, 0xFD, 0x16, 0xFE, 0x23, 0xFC, 0x86, 0xFF, 0x2D, 0xFA, 0x1C, 0x01,
-        0x51, 0xF8, 0x5E, 0x02, 0x24, 0xF7, 0xDD, 0x02, 0x94, 0xF6, 0xBA, 0x02,
-        0x9F, 0xF6, 0x36, 0x02, 0x32, 0xF7, 0x78, 0x01, 0x41, 0xF8, 0xD6, 0x00,
-        0x34, 0xFA, 0x28, 0x00, 0xE5, 0xFC, 0xBC, 0xFF, 0xF8, 0xFE, 0xC4, 0xFF,
-        0x7E, 0xFF, 0xEE, 0x00, 0x43, 0xFE, 0x58, 0x03, 0x02, 0xFC, 0xDF, 0x05,
-        0x8B, 0xFA, 0x64, 0x07, 0xF8, 0xFA, 0x47, 0x07, 0xB6, 0xFC, 0x2A, 0x06,
-        0x26, 0xFF, 0xD4, 0x04, 0x3B, 0x01, 0x49, 0x03, 0x6B, 0x02, 0xFC, 0x01,
-        0x96, 0x03, 0x81, 0x00, 0x7B, 0x05, 0xC5, 0xFE, 0x36, 0x07, 0x63, 0xFD,
-        0x39, 0x08, 0xDA, 0xFC, 0xAE, 0x08, 0xFD, 0xFC, 0x9C, 0x08, 0x89, 0xFD,
-        0x18, 0x08, 0x41, 0xFE, 0x15, 0x07, 0xE0, 0xFE, 0x36, 0x05, 0x78, 0xFF,
-        0xA6, 0x02, 0xCE, 0xFF, 0xAF, 0x00, 0xD0, 0xFF, 0x3F, 0x00, 0xBE, 0xFE,
-        0x95, 0x01, 0x7C, 0xFC, 0xF4, 0x03, 0x0E, 0xFA, 0x79, 0x05, 0xA3, 0xF8,
-        0xF4, 0x04, 0xD1, 0xF8, 0xDE, 0x02, 0xFE, 0xF9, 0x32, 0x00, 0x4F, 0xFB,
-        0xF3, 0xFD, 0xD5, 0xFC, 0xE1, 0xFC, 0x0D, 0xFE, 0xCB, 0xFB, 0x68, 0xFF,
-        0x02, 0xFA, 0xFE, 0x00, 0x64, 0xF8, 0x3B, 0x02, 0x99, 0xF7, 0xB0, 0x02,
-        0x43, 0xF7, 0x79, 0x02, 0x68, 0xF7, 0xDF, 0x01, 0xE7, 0xF7, 0x2E, 0x01,
-        0xD8, 0xF8, 0x97, 0x00, 0xA5, 0xFA, 0x15, 0x00, 0x23, 0xFD, 0xAC, 0xFF,
-        0x13, 0xFF, 0xAC, 0xFF, 0x70, 0xFF, 0xCF, 0x00, 0x0C, 0xFE, 0x34, 0x03,
-        0x9E, 0xFB, 0xA6, 0x05, 0x41, 0xFA, 0x0E, 0x07, 0xF9, 0xFA, 0xB3, 0x06,
-        0x49, 0xFD, 0x6E, 0x05, 0x22, 0x00, 0x04, 0x04, 0x77, 0x02, 0x87, 0x02,
-        0x8A, 0x03, 0x6E, 0x01, 0x81, 0x04, 0x53, 0x00, 0x1F, 0x06, 0xF8, 0xFE,
-        0x9C, 0x07, 0xF4, 0xFD, 0x56, 0x08, 0x96, 0xFD, 0x7F, 0x08, 0xC9, 0xFD,
-        0x34, 0x08, 0x4B, 0xFE, 0x94, 0x07, 0xEC, 0xFE, 0xB9, 0x06, 0x7A, 0xFF,
-        0x16, 0x05, 0xEF, 0xFF, 0xCB, 0x02, 0x43, 0x00, 0xF5, 0x00, 0x11, 0x00,
-        0xAE, 0x00, 0xD3, 0xFE, 0x0F, 0x02, 0x6A, 0xFC, 0x7A, 0x04, 0x1D, 0xFA,
-        0xCE, 0x05, 0xEE, 0xF8, 0x11, 0x05, 0x8E, 0xF9, 0xC7, 0x02, 0x0F, 0xFB,
-        0xE9, 0xFF, 0x8B, 0xFC, 0xB5, 0xFD, 0xE5, 0xFD, 0xAC, 0xFC, 0xC2, 0xFE,
-        0xC1, 0xFB, 0xAC, 0xFF, 0x1E, 0xFA, 0xE0, 0x00, 0xB2, 0xF8, 0xD0, 0x01,
-        0x03, 0xF8, 0x23, 0x02, 0xE6, 0xF7, 0x0E, 0x02, 0x33, 0xF8, 0xA9, 0x01,
-        0xCA, 0xF8, 0x21, 0x01, 0x84, 0xF9, 0xB2, 0x00, 0xE8, 0xFA, 0x4E, 0x00,
-        0x0E, 0xFD, 0x08, 0x00, 0xBE, 0xFE, 0x3F, 0x00, 0x03, 0xFF, 0x66, 0x01,
-        0x9A, 0xFD, 0xA0, 0x03, 0x4D, 0xFB, 0xBB, 0x05, 0xF8, 0xF9, 0xB8, 0x06,
-        0xA6, 0xFA, 0x17, 0x06, 0xE4, 0xFC, 0xA2, 0x04, 0xC2, 0xFF, 0x43, 0x03,
-        0x0C, 0x02, 0x08, 0x02, 0x20, 0x03, 0x2C, 0x01, 0x1A, 0x04, 0x4F, 0x00,
-        0xC1, 0x05, 0x18, 0xFF, 0x35, 0x07, 0x46, 0xFE, 0xF5, 0x07, 0xFC, 0xFD,
-        0x36, 0x08, 0x27, 0xFE, 0x10, 0x08, 0x88, 0xFE, 0x9C, 0x07, 0x01, 0xFF,
-        0xF5, 0x06, 0x68, 0xFF, 0x91, 0x05, 0xE0, 0xFF, 0x61, 0x03, 0x34, 0x00,
-        0xA7, 0x01, 0x32, 0x00, 0x43, 0x01, 0x32, 0xFF, 0x8F, 0x02, 0x33, 0xFD,
-        0xCA, 0x04, 0x19, 0xFB, 0x28, 0x06, 0xE1, 0xF9, 0x8B, 0x05, 0x34, 0xFA,
-        0x64, 0x03, 0x5A, 0xFB, 0xA1, 0x00, 0x8D, 0xFC, 0x6F, 0xFE, 0xAD, 0xFD,
-        0x62, 0xFD, 0x70, 0xFE, 0x5B, 0xFC, 0x4A, 0xFF, 0xA4, 0xFA, 0x67, 0x00,
-        0x0B, 0xF9, 0x3D, 0x01, 0x17, 0xF8, 0x8D, 0x01, 0x9A, 0xF7, 0x79, 0x01,
-        0x9B, 0xF7, 0x3B, 0x01, 0xFA, 0xF7, 0xE2, 0x00, 0xB5, 0xF8, 0x86, 0x00,
-        0x3F, 0xFA, 0x09, 0x00, 0x96, 0xFC, 0xA4, 0xFF, 0x70, 0xFE, 0x8D, 0xFF,
-        0xD4, 0xFE, 0x7E, 0x00, 0x98, 0xFD, 0x8F, 0x02, 0x78, 0xFB, 0xCB, 0x04,
-        0x31, 0xFA, 0x36, 0x06, 0xC2, 0xFA, 0x17, 0x06, 0xBF, 0xFC, 0x0F, 0x05,
-        0x65, 0xFF, 0xEB, 0x03, 0x8F, 0x01, 0xB9, 0x02, 0xA6, 0x02, 0xED, 0x01,
-        0xBA, 0x03, 0x0A, 0x01, 0xB3, 0x05, 0xDB, 0xFF, 0x97, 0x07, 0xE1, 0xFE,
-        0xDC, 0x08, 0x6B, 0xFE, 0x7A, 0x09, 0x5A, 0xFE, 0x8C, 0x09, 0x89, 0xFE,
-        0x12, 0x09, 0xF6, 0xFE, 0x27, 0x08, 0x63, 0xFF, 0x4C, 0x06, 0xD4, 0xFF,
-        0xBD, 0x03, 0x0B, 0x00, 0xCA, 0x01, 0x0B, 0x00, 0x6A, 0x01, 0x1D, 0xFF,
-        0xB4, 0x02, 0x16, 0xFD, 0xDF, 0x04, 0xDE, 0xFA, 0x31, 0x06, 0x88, 0xF9,
-        0xB0, 0x05, 0xBB, 0xF9, 0xB4, 0x03, 0xCB, 0xFA, 0x12, 0x01, 0xEB, 0xFB,
-        0xEA, 0xFE, 0xF6, 0xFC, 0xC0, 0xFD, 0xAA, 0xFD, 0x99, 0xFC, 0x6C, 0xFE,
-        0x80, 0xFA, 0x9B, 0xFF, 0x7B, 0xF8, 0xB3, 0x00, 0x25, 0xF7, 0x56, 0x01,
-        0x6D, 0xF6, 0x85, 0x01, 0x5A, 0xF6, 0x54, 0x01, 0xDC, 0xF6, 0xE0, 0x00,
-        0xE1, 0xF7, 0x80, 0x00, 0xCC, 0xF9, 0x27, 0x00, 0x6A, 0xFC, 0x09, 0x00,
-        0x44, 0xFE, 0x1A, 0x00, 0x8B, 0xFE, 0x04, 0x01, 0x1A, 0xFD, 0xF5, 0x02,
-        0xDC, 0xFA, 0x09, 0x05, 0x7A, 0xF9, 0x44, 0x06, 0xF5, 0xF9, 0x17, 0x06,
-        0xE4, 0xFB, 0x19, 0x05, 0x77, 0xFE, 0x0E, 0x04, 0x9D, 0x00, 0x12, 0x03,
-        0xC5, 0x01, 0x80, 0x02, 0x08, 0x03, 0xCE, 0x01, 0x40, 0x05, 0x8B, 0x00,
-        0x5D, 0x07, 0x4A, 0xFF, 0xC5, 0x08, 0x7A, 0xFE, 0x71, 0x09, 0x4E, 0xFE,
-        0x79, 0x09, 0x94, 0xFE, 0xDB, 0x08, 0x24, 0xFF, 0xCF, 0x07, 0xA3, 0xFF,
-        0xF6, 0x05, 0xF7, 0xFF, 0x74, 0x03, 0xFE, 0xFF, 0x98, 0x01, 0xD2, 0xFF,
-        0x45, 0x01, 0xEA, 0xFE, 0x9A, 0x02, 0x0B, 0xFD, 0xCF, 0x04, 0xFC, 0xFA,
-        0x37, 0x06, 0xBC, 0xF9, 0xD8, 0x05, 0xFD, 0xF9, 0x11, 0x04, 0x0C, 0xFB,
-        0xB0, 0x01, 0x13, 0xFC, 0x8F, 0xFF, 0xE7, 0xFC, 0x53, 0xFE, 0x69, 0xFD,
-        0xD7, 0xFC, 0x14, 0xFE, 0x85, 0xFA, 0x50, 0xFF, 0x4B, 0xF8, 0x98, 0x00,
-        0x0A, 0xF7, 0x5A, 0x01, 0x79, 0xF6, 0x92, 0x01, 0x9D, 0xF6, 0x37, 0x01,
-        0x43, 0xF7, 0x9A, 0x00, 0x3F, 0xF8, 0x10, 0x00, 0x16, 0xFA, 0xBC, 0xFF,
-        0xA1, 0xFC, 0x9F, 0xFF, 0x97, 0xFE, 0xAF, 0xFF, 0x04, 0xFF, 0x6E, 0x00,
-        0xC3, 0xFD, 0x2D, 0x02, 0x7D, 0xFB, 0x2C, 0x04, 0xDB, 0xF9, 0x68, 0x05,
-        0xE5, 0xF9, 0x36, 0x05, 0x75, 0xFB, 0x48, 0x04, 0xDB, 0xFD, 0x63, 0x03,
-        0x3B, 0x00, 0xA8, 0x02, 0xBF, 0x01, 0x33, 0x02, 0x70, 0x03, 0x9D, 0x01,
-        0xE8, 0x05, 0x6C, 0x00, 0x24, 0x08, 0x26, 0xFF, 0x54, 0x09, 0x61, 0xFE,
-        0xBC, 0x09, 0x42, 0xFE, 0x79, 0x09, 0xC3, 0xFE, 0xCA, 0x08, 0x81, 0xFF,
-        0xC4, 0x07, 0x2C, 0x00, 0xD8, 0x05, 0xA4, 0x00, 0x33, 0x03, 0xEB, 0x00,
-        0x33, 0x01, 0x00, 0x01, 0xC1, 0x00, 0x52, 0x00, 0x09, 0x02, 0x8A, 0xFE,
-        0x67, 0x04, 0x72, 0xFC, 0x23, 0x06, 0x13, 0xFB, 0x1A, 0x06, 0x35, 0xFB,
-        0x76, 0x04, 0x0E, 0xFC, 0xDA, 0x01, 0xDA, 0xFC, 0x58, 0xFF, 0x8B, 0xFD,
-        0xA1, 0xFD, 0xFD, 0xFD, 0xE1, 0xFB, 0x96, 0xFE, 0x66, 0xF9, 0xB8, 0xFF,
-        0x44, 0xF7, 0xED, 0x00, 0x29, 0xF6, 0x99, 0x01, 0xC3, 0xF5, 0x9D, 0x01,
-        0x0F, 0xF6, 0x16, 0x01, 0xC2, 0xF6, 0x5A, 0x00, 0xDA, 0xF7, 0xCA, 0xFF,
-        0xD6, 0xF9, 0x6F, 0xFF, 0x77, 0xFC, 0x3C, 0xFF, 0x82, 0xFE, 0x43, 0xFF,
-        0xF8, 0xFE, 0xFF, 0xFF, 0xBB, 0xFD, 0xCE, 0x01, 0x68, 0xFB, 0xD0, 0x03,
-        0xB9, 0xF9, 0x30, 0x05, 0xDE, 0xF9, 0x0D, 0x05, 0xA7, 0xFB, 0x39, 0x04,
-        0x50, 0xFE, 0x6E, 0x03, 0xE8, 0x00, 0xAF, 0x02, 0xA3, 0x02, 0x49, 0x02,
-        0x5D, 0x04, 0xBA, 0x01, 0xCC, 0x06, 0x96, 0x00, 0xCE, 0x08, 0x6C, 0xFF,
-        0xFC, 0x09, 0xC0, 0xFE, 0x6D, 0x0A, 0xBE, 0xFE, 0x4C, 0x0A, 0x27, 0xFF,
-        0x9D, 0x09, 0xC5, 0xFF, 0x8F, 0x08, 0x31, 0x00, 0x90, 0x06, 0x75, 0x00,
-        0xDA, 0x03, 0x8B, 0x00, 0xC0, 0x01, 0x84, 0x00, 0x1B, 0x01, 0xCF, 0xFF,
-        0x3C, 0x02, 0x26, 0xFE, 0x6F, 0x04, 0x39, 0xFC, 0x02, 0x06, 0x10, 0xFB,
-        0xCE, 0x05, 0x47, 0xFB, 0x14, 0x04, 0x2E, 0xFC, 0x9A, 0x01, 0xE4, 0xFC,
-        0x3C, 0xFF, 0x81, 0xFD, 0xAE, 0xFD, 0xC7, 0xFD, 0x0A, 0xFC, 0x22, 0xFE,
-        0x9C, 0xF9, 0x1F, 0xFF, 0x84, 0xF7, 0x39, 0x00, 0x2C, 0xF6, 0xFB, 0x00,
-        0x97, 0xF5, 0x28, 0x01, 0xB4, 0xF5, 0xDC, 0x00, 0x60, 0xF6, 0x66, 0x00,
-        0x89, 0xF7, 0x10, 0x00, 0x9B, 0xF9, 0xDE, 0xFF, 0x4C, 0xFC, 0xD5, 0xFF,
-        0x5D, 0xFE, 0xEF, 0xFF, 0xF4, 0xFE, 0xA1, 0x00, 0xE9, 0xFD, 0x21, 0x02,
-        0xE7, 0xFB, 0xC5, 0x03, 0x69, 0xFA, 0xCF, 0x04, 0x9C, 0xFA, 0x99, 0x04,
-        0x2B, 0xFC, 0xCD, 0x03, 0x79, 0xFE, 0x36, 0x03, 0x90, 0x00, 0xCA, 0x02,
-        0xF4, 0x01, 0xD0, 0x02, 0x84, 0x03, 0x8C, 0x02, 0xFC, 0x05, 0x94, 0x01,
-        0x37, 0x08, 0x42, 0x00, 0x9C, 0x09, 0x60, 0xFF, 0x46, 0x0A, 0x00, 0xFF,
-        0x34, 0x0A, 0x2F, 0xFF, 0xA3, 0x09, 0x96, 0xFF, 0x8F, 0x08, 0xF3, 0xFF,
-        0x9E, 0x06, 0x24, 0x00, 0xFF, 0x03, 0x13, 0x00, 0xEC, 0x01, 0xFB, 0xFF,
-        0x41, 0x01, 0x64, 0xFF, 0x29, 0x02, 0x1E, 0xFE, 0x09, 0x04, 0x9C, 0xFC,
-        0x60, 0x05, 0xB3, 0xFB, 0x3D, 0x05, 0xF2, 0xFB, 0xCA, 0x03, 0xAC, 0xFC,
-        0xAF, 0x01, 0x35, 0xFD, 0xB3, 0xFF, 0x92, 0xFD, 0x51, 0xFE, 0x9D, 0xFD,
-        0xC1, 0xFC, 0xD7, 0xFD, 0x43, 0xFA, 0xBC, 0xFE, 0x0E, 0xF8, 0xF0, 0xFF,
-        0x94, 0xF6, 0xDD, 0x00, 0xD9, 0xF5, 0x30, 0x01, 0xC3, 0xF5, 0xFC, 0x00,
-        0x35, 0xF6, 0x87, 0x00, 0x3B, 0xF7, 0x2F, 0x00, 0x22, 0xF9, 0x0A, 0x00,
-        0xD7, 0xFB, 0x26, 0x00, 0x07, 0xFE, 0x3B, 0x00, 0xDB, 0xFE, 0xC4, 0x00,
-        0x27, 0xFE, 0xF0, 0x01, 0x8E, 0xFC, 0x7A, 0x03, 0x5A, 0xFB, 0x84, 0x04,
-        0x8D, 0xFB, 0x82, 0x04, 0xE8, 0xFC, 0xEA, 0x03, 0xD4, 0xFE, 0x5B, 0x03,
-        0x97, 0x00, 0xE5, 0x02, 0xB1, 0x01, 0xC2, 0x02, 0x2D, 0x03, 0x93, 0x02,
-        0x91, 0x05, 0xB1, 0x01, 0xE1, 0x07, 0x8B, 0x00, 0x66, 0x09, 0xA1, 0xFF,
-        0x47, 0x0A, 0x42, 0xFF, 0x6D, 0x0A, 0x74, 0xFF, 0xE0, 0x09, 0xE6, 0xFF,
-        0xAC, 0x08, 0x3C, 0x00, 0x87, 0x06, 0x5F, 0x00, 0xB0, 0x03, 0x41, 0x00,
-        0x61, 0x01, 0x1D, 0x00, 0x89, 0x00, 0x8B, 0xFF, 0x2A, 0x01, 0x39, 0xFE,
-        0xB4, 0x02, 0x8B, 0xFC, 0xD7, 0x03, 0x53, 0xFB, 0xB9, 0x03, 0x3A, 0xFB,
-        0x79, 0x02, 0xD9, 0xFB, 0xC7, 0x00, 0x99, 0xFC, 0x32, 0xFF, 0x61, 0xFD,
-        0x2B, 0xFE, 0xA2, 0xFD, 0xB6, 0xFC, 0xC9, 0xFD, 0x39, 0xFA, 0x86, 0xFE,
-        0xD8, 0xF7, 0x90, 0xFF, 0x49, 0xF6, 0x79, 0x00, 0x6D, 0xF5, 0xDA, 0x00,
-        0x54, 0xF5, 0xAC, 0x00, 0x09, 0xF6, 0x36, 0x00, 0x76, 0xF7, 0xE0, 0xFF,
-        0xC4, 0xF9, 0xBB, 0xFF, 0xA3, 0xFC, 0xF1, 0xFF, 0xDE, 0xFE, 0x25, 0x00,
-        0xA4, 0xFF, 0xB7, 0x00, 0x07, 0xFF, 0xE4, 0x01, 0x86, 0xFD, 0x7F, 0x03,
-        0x57, 0xFC, 0xA7, 0x04, 0x68, 0xFC, 0xBF, 0x04, 0x9C, 0xFD, 0x09, 0x04,
-        0x3E, 0xFF, 0x36, 0x03, 0xD1, 0x00, 0x8C, 0x02, 0xE0, 0x01, 0x6D, 0x02,
-        0x5D, 0x03, 0x66, 0x02, 0xE4, 0x05, 0xAB, 0x01, 0x3E, 0x08, 0x88, 0x00,
-        0xC4, 0x09, 0x78, 0xFF, 0x8C, 0x0A, 0xCD, 0xFE, 0x89, 0x0A, 0xDD, 0xFE,
-        0xBC, 0x09, 0x4E, 0xFF, 0x2A, 0x08, 0xC5, 0xFF, 0xD6, 0x05, 0xDE, 0xFF,
-        0xEF, 0x02, 0xBB, 0xFF, 0xCB, 0x00, 0x88, 0xFF, 0x21, 0x00, 0x20, 0xFF,
-        0xCD, 0x00, 0x10, 0xFE, 0x4F, 0x02, 0xA3, 0xFC, 0x64, 0x03, 0x8E, 0xFB,
-        0x3A, 0x03, 0x88, 0xFB, 0xFD, 0x01, 0x21, 0xFC, 0x53, 0x00, 0xDE, 0xFC,
-        0xAF, 0xFE, 0x6E, 0xFD, 0x99, 0xFD, 0x7B, 0xFD, 0x2D, 0xFC, 0x76, 0xFD,
-        0xC8, 0xF9, 0x33, 0xFE, 0x83, 0xF7, 0x69, 0xFF, 0x14, 0xF6, 0x98, 0x00,
-        0x65, 0xF5, 0x4A, 0x01, 0x68, 0xF5, 0x32, 0x01, 0x40, 0xF6, 0xB4, 0x00,
-        0xCE, 0xF7, 0x4E, 0x00, 0x3F, 0xFA, 0x51, 0x00, 0x39, 0xFD, 0x98, 0x00,
-        0x79, 0xFF, 0xD8, 0x00, 0x48, 0x00, 0x35, 0x01, 0xAB, 0xFF, 0x21, 0x02,
-        0x31, 0xFE, 0x52, 0x03, 0x07, 0xFD, 0x3E, 0x04, 0x1F, 0xFD, 0x28, 0x04,
-        0x59, 0xFE, 0x7A, 0x03, 0x0B, 0x00, 0xCF, 0x02, 0xC4, 0x01, 0x50, 0x02,
-        0xE8, 0x02, 0x7C, 0x02, 0x41, 0x04, 0x90, 0x02, 0x79, 0x06, 0xF2, 0x01,
-        0x88, 0x08, 0xBB, 0x00, 0xB8, 0x09, 0x7A, 0xFF, 0x51, 0x0A, 0x9C, 0xFE,
-        0x4B, 0x0A, 0x81, 0xFE, 0x8D, 0x09, 0xD0, 0xFE, 0x11, 0x08, 0x09, 0xFF,
-        0xA0, 0x05, 0xF5, 0xFE, 0x9D, 0x02, 0xB3, 0xFE, 0x46, 0x00, 0xA7, 0xFE,
-        0x71, 0xFF, 0x75, 0xFE, 0x24, 0x00, 0xC9, 0xFD, 0xBD, 0x01, 0xC5, 0xFC,
-        0x0F, 0x03, 0x07, 0xFC, 0xFD, 0x02, 0x27, 0xFC, 0xC2, 0x01, 0xCD, 0xFC,
-        0xEE, 0xFF, 0x63, 0xFD, 0x1C, 0xFE, 0xB7, 0xFD, 0xFF, 0xFC, 0x65, 0xFD,
-        0xDB, 0xFB, 0x27, 0xFD, 0xE5, 0xF9, 0xBC, 0xFD, 0x0B, 0xF8, 0xFC, 0xFE,
-        0xE6, 0xF6, 0x5B, 0x00, 0x42, 0xF6, 0x52, 0x01, 0x1D, 0xF6, 0x85, 0x01,
-        0xAA, 0xF6, 0x43, 0x01, 0x0B, 0xF8, 0x09, 0x01, 0x54, 0xFA, 0x07, 0x01,
-        0x40, 0xFD, 0x27, 0x01, 0x73, 0xFF, 0x18, 0x01, 0x2E, 0x00, 0x3D, 0x01,
-        0x69, 0xFF, 0xE5, 0x01, 0xC7, 0xFD, 0xE6, 0x02, 0x85, 0xFC, 0xB7, 0x03,
-        0xAE, 0xFC, 0x9C, 0x03, 0x12, 0xFE, 0x0A, 0x03, 0xF2, 0xFF, 0x82, 0x02,
-        0xC1, 0x01, 0x50, 0x02, 0xB4, 0x02, 0xB4, 0x02, 0xAA, 0x03, 0xF5, 0x02,
-        0x6E, 0x05, 0x53, 0x02, 0x3E, 0x07, 0x03, 0x01, 0x76, 0x08, 0x95, 0xFF,
-        0x38, 0x09, 0x91, 0xFE, 0x7F, 0x09, 0x5F, 0xFE, 0x15, 0x09, 0x96, 0xFE,
-        0xEA, 0x07, 0xD2, 0xFE, 0xCA, 0x05, 0xCD, 0xFE, 0x0A, 0x03, 0xA6, 0xFE,
-        0xEB, 0x00, 0xA4, 0xFE, 0x38, 0x00, 0x79, 0xFE, 0xEB, 0x00, 0xE7, 0xFD,
-        0x5F, 0x02, 0xFB, 0xFC, 0x7F, 0x03, 0x4A, 0xFC, 0x61, 0x03, 0x78, 0xFC,
-        0x1E, 0x02, 0x23, 0xFD, 0x68, 0x00, 0xB3, 0xFD, 0xBF, 0xFE, 0xDA, 0xFD,
-        0xDD, 0xFD, 0x72, 0xFD, 0x10, 0xFD, 0x38, 0xFD, 0x5D, 0xFB, 0xD7, 0xFD,
-        0x9F, 0xF9, 0x0C, 0xFF, 0x61, 0xF8, 0x53, 0x00, 0xB0, 0xF7, 0x2D, 0x01,
-        0x68, 0xF7, 0x46, 0x01, 0xD1, 0xF7, 0x0E, 0x01, 0xDF, 0xF8, 0xEB, 0x00,
-        0xED, 0xFA, 0x18, 0x01, 0x93, 0xFD, 0x5B, 0x01, 0xB1, 0xFF, 0x5F, 0x01,
-        0x6A, 0x00, 0x63, 0x01, 0xBE, 0xFF, 0xB0, 0x01, 0x41, 0xFE, 0x64, 0x02,
-        0xFB, 0xFC, 0xF5, 0x02, 0xEE, 0xFC, 0xB5, 0x02, 0xFC, 0xFD, 0x16, 0x02,
-        0x91, 0xFF, 0xB2, 0x01, 0x26, 0x01, 0xAC, 0x01, 0x15, 0x02, 0x36, 0x02,
-        0xF5, 0x02, 0x80, 0x02, 0x9E, 0x04, 0xFD, 0x01, 0x51, 0x06, 0xF8, 0x00,
-        0x72, 0x07, 0xC7, 0xFF, 0x0D, 0x08, 0xF9, 0xFE, 0x40, 0x08, 0xD3, 0xFE,
-        0xD6, 0x07, 0xEF, 0xFE, 0xD3, 0x06, 0xE7, 0xFE, 0xDF, 0x04, 0x9D, 0xFE,
-        0x58, 0x02, 0x65, 0xFE, 0x50, 0x00, 0x7C, 0xFE, 0xAE, 0xFF, 0xAE, 0xFE,
-        0x5C, 0x00, 0x8F, 0xFE, 0xE3, 0x01, 0xE9, 0xFD, 0x31, 0x03, 0x47, 0xFD,
-        0x4B, 0x03, 0x62, 0xFD, 0x46, 0x02, 0xE2, 0xFD, 0xAC, 0x00, 0x2E, 0xFE,
-        0xF6, 0xFE, 0x3A, 0xFE, 0xF1, 0xFD, 0xBE, 0xFD, 0xFB, 0xFC, 0x8C, 0xFD,
-        0x61, 0xFB, 0x11, 0xFE, 0xC7, 0xF9, 0x19, 0xFF, 0xCC, 0xF8, 0x44, 0x00,
-        0x46, 0xF8, 0x1D, 0x01, 0x1B, 0xF8, 0x57, 0x01, 0x66, 0xF8, 0x58, 0x01,
-        0x41, 0xF9, 0x85, 0x01, 0x02, 0xFB, 0xDB, 0x01, 0x71, 0xFD, 0x0E, 0x02,
-        0x6C, 0xFF, 0xE5, 0x01, 0x17, 0x00, 0x9F, 0x01, 0x62, 0xFF, 0x9D, 0x01,
-        0xC6, 0xFD, 0x2C, 0x02, 0x74, 0xFC, 0xBE, 0x02, 0x59, 0xFC, 0x99, 0x02,
-        0x76, 0xFD, 0x0F, 0x02, 0x31, 0xFF, 0xB1, 0x01, 0x05, 0x01, 0xA7, 0x01,
-        0x33, 0x02, 0x2F, 0x02, 0x23, 0x03, 0x7E, 0x02, 0xB6, 0x04, 0x09, 0x02,
-        0x29, 0x06, 0x0C, 0x01, 0x27, 0x07, 0xDC, 0xFF, 0xB3, 0x07, 0xE6, 0xFE,
-        0x00, 0x08, 0x70, 0xFE, 0xC1, 0x07, 0x24, 0xFE, 0xF3, 0x06, 0xCD, 0xFD,
-        0x2D, 0x05, 0x64, 0xFD, 0xAB, 0x02, 0x47, 0xFD, 0x9F, 0x00, 0x96, 0xFD,
-        0xED, 0xFF, 0x1A, 0xFE, 0xC0, 0x00, 0x5D, 0xFE, 0x61, 0x02, 0xFE, 0xFD,
-        0xC4, 0x03, 0x72, 0xFD, 0xC1, 0x03, 0x8B, 0xFD, 0x90, 0x02, 0xF8, 0xFD,
-        0xB6, 0x00, 0x41, 0xFE, 0xDC, 0xFE, 0x1D, 0xFE, 0xC5, 0xFD, 0x79, 0xFD,
-        0xE8, 0xFC, 0x20, 0xFD, 0x77, 0xFB, 0xA0, 0xFD, 0xF8, 0xF9, 0xBD, 0xFE,
-        0xF0, 0xF8, 0x18, 0x00, 0x45, 0xF8, 0x3E, 0x01, 0x0F, 0xF8, 0xF7, 0x01,
-        0x65, 0xF8, 0x5B, 0x02, 0x53, 0xF9, 0xC2, 0x02, 0x06, 0xFB, 0x0A, 0x03,
-        0x6C, 0xFD, 0x07, 0x03, 0x4C, 0xFF, 0x81, 0x02, 0xC6, 0xFF, 0xD9, 0x01,
-        0xCB, 0xFE, 0x8E, 0x01, 0x1B, 0xFD, 0xEF, 0x01, 0xE1, 0xFB, 0x8D, 0x02,
-        0x04, 0xFC, 0x8C, 0x02, 0x63, 0xFD, 0x24, 0x02, 0x42, 0xFF, 0xD8, 0x01,
-        0x23, 0x01, 0xE4, 0x01, 0x39, 0x02, 0x85, 0x02, 0x13, 0x03, 0xD0, 0x02,
-        0x77, 0x04, 0x4B, 0x02, 0xF6, 0x05, 0x24, 0x01, 0x08, 0x07, 0xC4, 0xFF,
-        0xAB, 0x07, 0x90, 0xFE, 0xCC, 0x07, 0xC0, 0xFD, 0x63, 0x07, 0x3B, 0xFD,
-        0x79, 0x06, 0xDC, 0xFC, 0xDE, 0x04, 0x99, 0xFC, 0x9E, 0x02, 0xC1, 0xFC,
-        0xDE, 0x00, 0x60, 0xFD, 0x7E, 0x00, 0x09, 0xFE, 0x6C, 0x01, 0x48, 0xFE,
-        0xF3, 0x02, 0xCE, 0xFD, 0x09, 0x04, 0x2B, 0xFD, 0xBE, 0x03, 0x37, 0xFD,
-        0x3F, 0x02, 0xAD, 0xFD, 0x39, 0x00, 0x1A, 0xFE, 0x6A, 0xFE, 0x1A, 0xFE,
-        0x6E, 0xFD, 0x80, 0xFD, 0xC0, 0xFC, 0x1F, 0xFD, 0x84, 0xFB, 0x97, 0xFD,
-        0x1E, 0xFA, 0xB6, 0xFE, 0x19, 0xF9, 0x21, 0x00, 0x73, 0xF8, 0x59, 0x01,
-        0x48, 0xF8, 0x33, 0x02, 0xA3, 0xF8, 0xBC, 0x02, 0x82, 0xF9, 0x15, 0x03,
-        0x08, 0xFB, 0x4C, 0x03, 0x2E, 0xFD, 0x0C, 0x03, 0xE8, 0xFE, 0x64, 0x02,
-        0x5A, 0xFF, 0xBB, 0x01, 0xA1, 0xFE, 0x8F, 0x01, 0x47, 0xFD, 0x0C, 0x02,
-        0x5F, 0xFC, 0xA7, 0x02, 0xC0, 0xFC, 0x94, 0x02, 0x3E, 0xFE, 0x00, 0x02,
-        0x19, 0x00, 0x7E, 0x01, 0xB0, 0x01, 0x64, 0x01, 0x7E, 0x02, 0x09, 0x02,
-        0xFA, 0x02, 0x74, 0x02, 0x11, 0x04, 0x14, 0x02, 0x54, 0x05, 0x11, 0x01,
-        0x6D, 0x06, 0xC0, 0xFF, 0x25, 0x07, 0x9B, 0xFE, 0x68, 0x07, 0xAE, 0xFD,
-        0x0B, 0x07, 0x15, 0xFD, 0x36, 0x06, 0x9D, 0xFC, 0xAF, 0x04, 0x67, 0xFC,
-        0x87, 0x02, 0x94, 0xFC, 0xBF, 0x00, 0x3A, 0xFD, 0x2E, 0x00, 0xE2, 0xFD,
-        0xD7, 0x00, 0x27, 0xFE, 0x1E, 0x02, 0xC2, 0xFD, 0x11, 0x03, 0x4D, 0xFD,
-        0xCB, 0x02, 0x8E, 0xFD, 0x8B, 0x01, 0x36, 0xFE, 0xFC, 0xFF, 0xD3, 0xFE,
-        0xA1, 0xFE, 0xDA, 0xFE, 0x0A, 0xFE, 0x2D, 0xFE, 0x9D, 0xFD, 0xA6, 0xFD,
-        0x8F, 0xFC, 0xEF, 0xFD, 0x22, 0xFB, 0xDA, 0xFE, 0xD5, 0xF9, 0x12, 0x00,
-        0xDC, 0xF8, 0x34, 0x01, 0x7C, 0xF8, 0x21, 0x02, 0xC1, 0xF8, 0xDB, 0x02,
-        0x93, 0xF9, 0x6A, 0x03, 0x1E, 0xFB, 0xB7, 0x03, 0x65, 0xFD, 0x90, 0x03,
-        0x45, 0xFF, 0xE0, 0x02, 0xE2, 0xFF, 0x08, 0x02, 0x32, 0xFF, 0x83, 0x01,
-        0xD2, 0xFD, 0xB0, 0x01, 0xC0, 0xFC, 0x06, 0x02, 0xCF, 0xFC, 0xBA, 0x01,
-        0xC9, 0xFD, 0x11, 0x01, 0x32, 0xFF, 0x80, 0x00, 0x79, 0x00, 0x92, 0x00,
-        0x15, 0x01, 0x57, 0x01, 0x85, 0x01, 0xFC, 0x01, 0xAB, 0x02, 0xDF, 0x01,
-        0x44, 0x04, 0x2C, 0x01, 0xCA, 0x05, 0x29, 0x00, 0xEA, 0x06, 0x11, 0xFF,
-        0x56, 0x07, 0x1A, 0xFE, 0x07, 0x07, 0x4B, 0xFD, 0x17, 0x06, 0xB0, 0xFC,
-        0x70, 0x04, 0x67, 0xFC, 0x12, 0x02, 0x9A, 0xFC, 0x3F, 0x00, 0x5C, 0xFD,
-        0xC0, 0xFF, 0x5A, 0xFE, 0x8C, 0x00, 0xF5, 0xFE, 0x11, 0x02, 0xD7, 0xFE,
-        0x45, 0x03, 0x72, 0xFE, 0x6F, 0x03, 0xB1, 0xFE, 0x8F, 0x02, 0x2F, 0xFF,
-        0x48, 0x01, 0x98, 0xFF, 0x12, 0x00, 0x62, 0xFF, 0x7A, 0xFF, 0x83, 0xFE,
-        0xE6, 0xFE, 0xC0, 0xFD, 0x8D, 0xFD, 0xC0, 0xFD, 0xC6, 0xFB, 0x58, 0xFE,
-        0x2D, 0xFA, 0x5A, 0xFF, 0x04, 0xF9, 0x6C, 0x00, 0x9D, 0xF8, 0x61, 0x01,
-        0xF1, 0xF8, 0x35, 0x02, 0xE2, 0xF9, 0xD4, 0x02, 0x7A, 0xFB, 0x1C, 0x03,
-        0xC0, 0xFD, 0xE0, 0x02, 0x8E, 0xFF, 0x21, 0x02, 0x1A, 0x00, 0x2C, 0x01,
-        0x68, 0xFF, 0xA3, 0x00, 0xF8, 0xFD, 0xD3, 0x00, 0xB6, 0xFC, 0x58, 0x01,
-        0x76, 0xFC, 0x44, 0x01, 0x3F, 0xFD, 0xE7, 0x00, 0x8C, 0xFE, 0xA4, 0x00,
-        0xD2, 0xFF, 0xE1, 0x00, 0x96, 0x00, 0xC9, 0x01, 0x5A, 0x01, 0x97, 0x02,
-        0xDA, 0x02, 0xA8, 0x02, 0xAC, 0x04, 0x28, 0x02, 0x5B, 0x06, 0x32, 0x01,
-        0x7B, 0x07, 0x25, 0x00, 0xE6, 0x07, 0x21, 0xFF, 0x84, 0x07, 0x39, 0xFE,
-        0x85, 0x06, 0x7D, 0xFD, 0xD3, 0x04, 0x1B, 0xFD, 0x7B, 0x02, 0x41, 0xFD,
-        0x91, 0x00, 0xF2, 0xFD, 0xF0, 0xFF, 0xE9, 0xFE, 0x93, 0x00, 0x90, 0xFF,
-        0x06, 0x02, 0x77, 0xFF, 0x4F, 0x03, 0x15, 0xFF, 0x93, 0x03, 0x29, 0xFF,
-        0xBE, 0x02, 0x81, 0xFF, 0x72, 0x01, 0xB9, 0xFF, 0x24, 0x00, 0x75, 0xFF,
-        0x63, 0xFF, 0x8A, 0xFE, 0x93, 0xFE, 0xC1, 0xFD, 0x21, 0xFD, 0xB0, 0xFD,
-        0x4C, 0xFB, 0x48, 0xFE, 0x98, 0xF9, 0x4D, 0xFF, 0x6B, 0xF8, 0x5D, 0x00,
-        0x10, 0xF8, 0x73, 0x01, 0x83, 0xF8, 0x61, 0x02, 0xA5, 0xF9, 0x2C, 0x03,
-        0x76, 0xFB, 0x82, 0x03, 0xE7, 0xFD, 0x4A, 0x03, 0xD4, 0xFF, 0x69, 0x02,
-        0x6B, 0x00, 0x48, 0x01, 0xA9, 0xFF, 0x66, 0x00, 0x1F, 0xFE, 0x4F, 0x00,
-        0xC9, 0xFC, 0x92, 0x00, 0x88, 0xFC, 0x7C, 0x00, 0x5F, 0xFD, 0x2C, 0x00,
-        0xBE, 0xFE, 0xFF, 0xFF, 0x1E, 0x00, 0x53, 0x00, 0xD7, 0x00, 0x49, 0x01,
-        0x90, 0x01, 0x22, 0x02, 0xE1, 0x02, 0x46, 0x02, 0xA4, 0x04, 0xBA, 0x01,
-        0x4A, 0x06, 0xE1, 0x00, 0x63, 0x07, 0xF9, 0xFF, 0xB1, 0x07, 0x24, 0xFF,
-        0x3A, 0x07, 0x68, 0xFE, 0x25, 0x06, 0xD4, 0xFD, 0x4A, 0x04, 0x9A, 0xFD,
-        0xED, 0x01, 0xDA, 0xFD, 0x16, 0x00, 0xBB, 0xFE, 0x9D, 0xFF, 0xE9, 0xFF,
-        0x72, 0x00, 0xD5, 0x00, 0x17, 0x02, 0xF7, 0x00, 0x6C, 0x03, 0xA7, 0x00,
-        0x9E, 0x03, 0xA6, 0x00, 0xBF, 0x02, 0xD9, 0x00, 0x4F, 0x01, 0xE0, 0x00,
-        0x00, 0x00, 0x5C, 0x00, 0x5C, 0xFF, 0x34, 0xFF, 0xD1, 0xFE, 0x2E, 0xFE,
-        0x9E, 0xFD, 0xE3, 0xFD, 0xEA, 0xFB, 0x50, 0xFE, 0x3C, 0xFA, 0x13, 0xFF,
-        0x05, 0xF9, 0xD6, 0xFF, 0x93, 0xF8, 0x8B, 0x00, 0xEE, 0xF8, 0x1A, 0x01,
-        0xF4, 0xF9, 0xA1, 0x01, 0xBB, 0xFB, 0xE0, 0x01, 0x11, 0xFE, 0xB8, 0x01,
-        0xDF, 0xFF, 0xF2, 0x00, 0x62, 0x00, 0xDB, 0xFF, 0x91, 0xFF, 0x0C, 0xFF,
-        0x01, 0xFE, 0x05, 0xFF, 0xC8, 0xFC, 0x62, 0xFF, 0xB6, 0xFC, 0x82, 0xFF,
-        0x9C, 0xFD, 0x69, 0xFF, 0x03, 0xFF, 0x75, 0xFF, 0x4A, 0x00, 0xF3, 0xFF,
-        0xD6, 0x00, 0x16, 0x01, 0x50, 0x01, 0x1F, 0x02, 0x9B, 0x02, 0x6F, 0x02,
-        0x6C, 0x04, 0x01, 0x02, 0x34, 0x06, 0x34, 0x01, 0x70, 0x07, 0x6B, 0x00,
-        0xDA, 0x07, 0xD3, 0xFF, 0x7C, 0x07, 0x43, 0xFF, 0x63, 0x06, 0xC1, 0xFE,
-        0x89, 0x04, 0x60, 0xFE, 0x29, 0x02, 0x70, 0xFE, 0x44, 0x00, 0x1A, 0xFF,
-        0xAB, 0xFF, 0x32, 0x00, 0x54, 0x00, 0x02, 0x01, 0xC6, 0x01, 0x10, 0x01,
-        0xEA, 0x02, 0xAE, 0x00, 0x01, 0x03, 0x80, 0x00, 0x1C, 0x02, 0x8F, 0x00,
-        0xBB, 0x00, 0x91, 0x00, 0x76, 0xFF, 0x27, 0x00, 0xF2, 0xFE, 0x20, 0xFF,
-        0x76, 0xFE, 0x2E, 0xFE, 0x26, 0xFD, 0xEF, 0xFD, 0x4B, 0xFB, 0x6D, 0xFE,
-        0x8C, 0xF9, 0x49, 0xFF, 0x5E, 0xF8, 0x18, 0x00, 0xF7, 0xF7, 0xB5, 0x00,
-        0x6D, 0xF8, 0x38, 0x01, 0x8D, 0xF9, 0xB3, 0x01, 0x70, 0xFB, 0x12, 0x02,
-        0xD1, 0xFD, 0xFF, 0x01, 0xB6, 0xFF, 0x3F, 0x01, 0x5A, 0x00, 0x0C, 0x00,
-        0xB2, 0xFF, 0x0F, 0xFF, 0x47, 0xFE, 0xEC, 0xFE, 0x1F, 0xFD, 0x52, 0xFF,
-        0x04, 0xFD, 0x9E, 0xFF, 0xE8, 0xFD, 0xB0, 0xFF, 0x52, 0xFF, 0xAD, 0xFF,
-        0x9C, 0x00, 0xEB, 0xFF, 0x25, 0x01, 0xA7, 0x00, 0x9E, 0x01, 0x59, 0x01,
-        0xE0, 0x02, 0x6D, 0x01, 0xB5, 0x04, 0xEB, 0x00, 0x70, 0x06, 0x0E, 0x00,
-        0xA1, 0x07, 0x47, 0xFF, 0x14, 0x08, 0xA8, 0xFE, 0xB0, 0x07, 0x33, 0xFE,
-        0x92, 0x06, 0xB4, 0xFD, 0xB7, 0x04, 0x5D, 0xFD, 0x4D, 0x02, 0x71, 0xFD,
-        0x6A, 0x00, 0x49, 0xFE, 0xC9, 0xFF, 0x96, 0xFF, 0x7C, 0x00, 0xA1, 0x00,
-        0xDC, 0x01, 0xDB, 0x00, 0xFF, 0x02, 0x74, 0x00, 0x07, 0x03, 0x36, 0x00,
-        0x1F, 0x02, 0x2A, 0x00, 0xA9, 0x00, 0x41, 0x00, 0x63, 0xFF, 0x1E, 0x00,
-        0xDD, 0xFE, 0x7F, 0xFF, 0x6C, 0xFE, 0xF2, 0xFE, 0x3C, 0xFD, 0xE3, 0xFE,
-        0x64, 0xFB, 0x6C, 0xFF, 0x9F, 0xF9, 0x3B, 0x00, 0x63, 0xF8, 0x01, 0x01,
-        0xF7, 0xF7, 0x99, 0x01, 0x5B, 0xF8, 0xFD, 0x01, 0x7E, 0xF9, 0x59, 0x02,
-        0x53, 0xFB, 0x8A, 0x02, 0xBA, 0xFD, 0x4C, 0x02, 0x94, 0xFF, 0x56, 0x01,
-        0x2C, 0x00, 0xE6, 0xFF, 0x75, 0xFF, 0xB1, 0xFE, 0x1B, 0xFE, 0x43, 0xFE,
-        0xF8, 0xFC, 0x76, 0xFE, 0xE6, 0xFC, 0xC0, 0xFE, 0xD1, 0xFD, 0xD9, 0xFE,
-        0x3C, 0xFF, 0xE4, 0xFE, 0x8E, 0x00, 0x2E, 0xFF, 0x25, 0x01, 0xDF, 0xFF,
-        0x98, 0x01, 0x81, 0x00, 0xC5, 0x02, 0x9F, 0x00, 0x73, 0x04, 0x3F, 0x00,
-        0x2C, 0x06, 0x97, 0xFF, 0x4E, 0x07, 0xF2, 0xFE, 0xD7, 0x07, 0x69, 0xFE,
-        0x7B, 0x07, 0x0A, 0xFE, 0x7B, 0x06, 0xCC, 0xFD, 0xAD, 0x04, 0xB4, 0xFD,
-        0x65, 0x02, 0x2C, 0xFE, 0x93, 0x00, 0x3D, 0xFF, 0x0D, 0x00, 0xCA, 0x00,
-        0xB1, 0x00, 0xE4, 0x01, 0x01, 0x02, 0x45, 0x02, 0xFB, 0x02, 0xFE, 0x01,
-        0xDE, 0x02, 0x9A, 0x01, 0xBF, 0x01, 0x63, 0x01, 0x42, 0x00, 0x26, 0x01,
-        0xED, 0xFE, 0xAB, 0x00, 0x5B, 0xFE, 0xD6, 0xFF, 0xF0, 0xFD, 0x1B, 0xFF,
-        0xCF, 0xFC, 0xF0, 0xFE, 0x1C, 0xFB, 0x30, 0xFF, 0x5C, 0xF9, 0xD8, 0xFF,
-        0x27, 0xF8, 0x87, 0x00, 0xA0, 0xF7, 0x28, 0x01, 0xEE, 0xF7, 0xA5, 0x01,
-        0xE3, 0xF8, 0xF8, 0x01, 0xA4, 0xFA, 0x0B, 0x02, 0xE7, 0xFC, 0x80, 0x01,
-        0xC3, 0xFE, 0x57, 0x00, 0x79, 0xFF, 0xDE, 0xFE, 0x17, 0xFF, 0xD7, 0xFD,
-        0x1F, 0xFE, 0x9A, 0xFD, 0x6F, 0xFD, 0xED, 0xFD, 0xC9, 0xFD, 0x51, 0xFE,
-        0xF5, 0xFE, 0x86, 0xFE, 0x7D, 0x00, 0xA5, 0xFE, 0xBC, 0x01, 0x02, 0xFF,
-        0x47, 0x02, 0xCD, 0xFF, 0xAB, 0x02, 0x6E, 0x00, 0xD2, 0x03, 0xA6, 0x00,
-        0x8E, 0x05, 0x6D, 0x00, 0x48, 0x07, 0xE7, 0xFF, 0x81, 0x08, 0x3E, 0xFF,
-        0xFE, 0x08, 0x9F, 0xFE, 0xB5, 0x08, 0x0E, 0xFE, 0xB7, 0x07, 0xA4, 0xFD,
-        0xE6, 0x05, 0x8E, 0xFD, 0x93, 0x03, 0x20, 0xFE, 0xA0, 0x01, 0x50, 0xFF,
-        0xC0, 0x00, 0xC5, 0x00, 0x00, 0x01, 0xB9, 0x01, 0xEF, 0x01, 0xEB, 0x01,
-        0xA3, 0x02, 0xA2, 0x01, 0x57, 0x02, 0x68, 0x01, 0x38, 0x01, 0x52, 0x01,
-        0xCC, 0xFF, 0x54, 0x01, 0xA6, 0xFE, 0x06, 0x01, 0x44, 0xFE, 0x48, 0x00,
-        0xE3, 0xFD, 0xAA, 0xFF, 0xAF, 0xFC, 0x6E, 0xFF, 0xD7, 0xFA, 0x87, 0xFF,
-        0xF3, 0xF8, 0xF9, 0xFF, 0xAA, 0xF7, 0x91, 0x00, 0x25, 0xF7, 0x2F, 0x01,
-        0x6F, 0xF7, 0xC7, 0x01, 0x73, 0xF8, 0x4F, 0x02, 0x38, 0xFA, 0x7B, 0x02,
-        0x87, 0xFC, 0xFA, 0x01, 0x72, 0xFE, 0xD1, 0x00, 0x5B, 0xFF, 0x5C, 0xFF,
-        0x0B, 0xFF, 0x6E, 0xFE, 0xFC, 0xFD, 0x3E, 0xFE, 0x2C, 0xFD, 0x8F, 0xFE,
-        0x51, 0xFD, 0xC7, 0xFE, 0x5F, 0xFE, 0xDB, 0xFE, 0xC6, 0xFF, 0xC6, 0xFE,
-        0xEF, 0x00, 0x05, 0xFF, 0x5A, 0x01, 0xB7, 0xFF, 0xCF, 0x01, 0x5C, 0x00,
-        0x24, 0x03, 0x9B, 0x00, 0x25, 0x05, 0x8C, 0x00, 0x2B, 0x07, 0x17, 0x00,
-        0x8B, 0x08, 0x73, 0xFF, 0x10, 0x09, 0xCB, 0xFE, 0xBB, 0x08, 0x31, 0xFE,
-        0xB3, 0x07, 0xB6, 0xFD, 0x00, 0x06, 0x95, 0xFD, 0xCD, 0x03, 0x17, 0xFE,
-        0xF3, 0x01, 0x26, 0xFF, 0x05, 0x01, 0x76, 0x00, 0x57, 0x01, 0x50, 0x01,
-        0x68, 0x02, 0x71, 0x01, 0x4C, 0x03, 0x38, 0x01, 0x2C, 0x03, 0x00, 0x01,
-        0x29, 0x02, 0x07, 0x01, 0xB7, 0x00, 0x22, 0x01, 0x84, 0xFF, 0xF7, 0x00,
-        0x02, 0xFF, 0x4B, 0x00, 0x6A, 0xFE, 0xB3, 0xFF, 0xF1, 0xFC, 0x78, 0xFF,
-        0xCB, 0xFA, 0x9C, 0xFF, 0xB0, 0xF8, 0x2B, 0x00, 0x40, 0xF7, 0xE4, 0x00,
-        0xB9, 0xF6, 0x8F, 0x01, 0x07, 0xF7, 0x0B, 0x02, 0x05, 0xF8, 0x55, 0x02,
-        0xA1, 0xF9, 0x48, 0x02, 0xC3, 0xFB, 0xB7, 0x01, 0xA2, 0xFD, 0xB2, 0x00,
-        0x9A, 0xFE, 0x78, 0xFF, 0x5A, 0xFE, 0xB1, 0xFE, 0x56, 0xFD, 0x8B, 0xFE,
-        0x7D, 0xFC, 0xD9, 0xFE, 0x9D, 0xFC, 0x17, 0xFF, 0xAC, 0xFD, 0x21, 0xFF,
-        0x2C, 0xFF, 0x09, 0xFF, 0x6A, 0x00, 0x34, 0xFF, 0xF2, 0x00, 0xE1, 0xFF,
-        0x8D, 0x01, 0x7C, 0x00, 0x07, 0x03, 0xBB, 0x00, 0x30, 0x05, 0x99, 0x00,
-        0x48, 0x07, 0x06, 0x00, 0xBB, 0x08, 0x3A, 0xFF, 0x3D, 0x09, 0x7B, 0xFE,
-        0xDE, 0x08, 0xF9, 0xFD, 0xDA, 0x07, 0xCC, 0xFD, 0x30, 0x06, 0xF5, 0xFD,
-        0x11, 0x04, 0x92, 0xFE, 0x1D, 0x02, 0x85, 0xFF, 0x14, 0x01, 0x97, 0x00,
-        0x38, 0x01, 0x3B, 0x01, 0x1E, 0x02, 0x38, 0x01, 0xDC, 0x02, 0xCD, 0x00,
-        0xB1, 0x02, 0x72, 0x00, 0xA6, 0x01, 0x50, 0x00, 0x40, 0x00, 0x5B, 0x00,
-        0x2A, 0xFF, 0x2E, 0x00, 0xC7, 0xFE, 0x8E, 0xFF, 0x40, 0xFE, 0xF7, 0xFE,
-        0xDE, 0xFC, 0xB3, 0xFE, 0xB1, 0xFA, 0xE2, 0xFE, 0x99, 0xF8, 0x94, 0xFF,
-        0x18, 0xF7, 0x99, 0x00, 0x96, 0xF6, 0x8F, 0x01, 0xF5, 0xF6, 0x28, 0x02,
-        0x06, 0xF8, 0x5D, 0x02, 0xC2, 0xF9, 0x29, 0x02, 0xFB, 0xFB, 0x8E, 0x01,
-        0xFE, 0xFD, 0xA8, 0x00, 0x15, 0xFF, 0xB2, 0xFF, 0xF2, 0xFE, 0x12, 0xFF,
-        0x13, 0xFE, 0x23, 0xFF, 0x42, 0xFD, 0x81, 0xFF, 0x46, 0xFD, 0xDD, 0xFF,
-        0x1B, 0xFE, 0x01, 0x00, 0x50, 0xFF, 0xFA, 0xFF, 0x3F, 0x00, 0x20, 0x00,
-        0x85, 0x00, 0xAB, 0x00, 0xFA, 0x00, 0x22, 0x01, 0x61, 0x02, 0x47, 0x01,
-        0x8C, 0x04, 0x02, 0x01, 0xB9, 0x06, 0x47, 0x00, 0x40, 0x08, 0x2F, 0xFF,
-        0xD4, 0x08, 0x26, 0xFE, 0x8F, 0x08, 0x72, 0xFD, 0x82, 0x07, 0x31, 0xFD,
-        0xC9, 0x05, 0x5E, 0xFD, 0x8F, 0x03, 0xF1, 0xFD, 0x91, 0x01, 0xDB, 0xFE,
-        0x89, 0x00, 0xE0, 0xFF, 0xCF, 0x00, 0x9D, 0x00, 0xD6, 0x01, 0xB1, 0x00,
-        0xCF, 0x02, 0x61, 0x00, 0xE8, 0x02, 0x09, 0x00, 0x1E, 0x02, 0xEA, 0xFF,
-        0xEF, 0x00, 0xE1, 0xFF, 0xFC, 0xFF, 0xC2, 0xFF, 0xB3, 0xFF, 0x38, 0xFF,
-        0x32, 0xFF, 0xB8, 0xFE, 0xC0, 0xFD, 0x8F, 0xFE, 0x93, 0xFB, 0xC8, 0xFE,
-        0x59, 0xF9, 0x82, 0xFF, 0xC1, 0xF7, 0x86, 0x00, 0x1A, 0xF7, 0x88, 0x01,
-        0x5D, 0xF7, 0x29, 0x02, 0x63, 0xF8, 0x59, 0x02, 0x22, 0xFA, 0x31, 0x02,
-        0x48, 0xFC, 0x90, 0x01, 0x2D, 0xFE, 0xA7, 0x00, 0x18, 0xFF, 0x9C, 0xFF,
-        0xC6, 0xFE, 0xD7, 0xFE, 0xAB, 0xFD, 0xBC, 0xFE, 0xB5, 0xFC, 0x08, 0xFF,
-        0x9C, 0xFC, 0x57, 0xFF, 0x70, 0xFD, 0x81, 0xFF, 0xAB, 0xFE, 0x94, 0xFF,
-        0xB2, 0xFF, 0xCF, 0xFF, 0x11, 0x00, 0x6D, 0x00, 0xA2, 0x00, 0x0E, 0x01,
-        0x1B, 0x02, 0x4D, 0x01, 0x44, 0x04, 0x32, 0x01, 0x61, 0x06, 0x9F, 0x00,
-        0xF3, 0x07, 0xD3, 0xFF, 0x90, 0x08, 0x0F, 0xFF, 0x5C, 0x08, 0x8C, 0xFE,
-        0x65, 0x07, 0x69, 0xFE, 0xC9, 0x05, 0x7B, 0xFE, 0xBA, 0x03, 0xFE, 0xFE,
-        0xEF, 0x01, 0xBE, 0xFF, 0x0E, 0x01, 0xA5, 0x00, 0x6A, 0x01, 0x47, 0x01,
-        0x92, 0x02, 0x54, 0x01, 0x8E, 0x03, 0xFE, 0x00, 0x92, 0x03, 0xB8, 0x00,
-        0xA2, 0x02, 0x99, 0x00, 0x45, 0x01, 0xA5, 0x00, 0x20, 0x00, 0x80, 0x00,
-        0xBB, 0xFF, 0xE3, 0xFF, 0x28, 0xFF, 0x38, 0xFF, 0xB5, 0xFD, 0xE2, 0xFE,
-        0x9A, 0xFB, 0xFE, 0xFE, 0x86, 0xF9, 0x79, 0xFF, 0x03, 0xF8, 0x1B, 0x00,
-        0x6A, 0xF7, 0xB0, 0x00, 0xB1, 0xF7, 0x14, 0x01, 0xAA, 0xF8, 0x43, 0x01,
-        0x4E, 0xFA, 0x43, 0x01, 0x4F, 0xFC, 0xD9, 0x00, 0x0B, 0xFE, 0x2C, 0x00,
-        0xE4, 0xFE, 0x49, 0xFF, 0x84, 0xFE, 0xAA, 0xFE, 0x5E, 0xFD, 0x99, 0xFE,
-        0x64, 0xFC, 0xE5, 0xFE, 0x76, 0xFC, 0x15, 0xFF, 0x83, 0xFD, 0x14, 0xFF,
-        0xF8, 0xFE, 0xE1, 0xFE, 0x17, 0x00, 0xDC, 0xFE, 0x79, 0x00, 0x69, 0xFF,
-        0xEF, 0x00, 0x0F, 0x00, 0x5A, 0x02, 0x7B, 0x00, 0x52, 0x04, 0x8F, 0x00,
-        0x45, 0x06, 0x4A, 0x00, 0xAB, 0x07, 0xE2, 0xFF, 0x33, 0x08, 0x73, 0xFF,
-        0xF0, 0x07, 0x32, 0xFF, 0x02, 0x07, 0x12, 0xFF, 0x6E, 0x05, 0x27, 0xFF,
-        0x82, 0x03, 0x9B, 0xFF, 0xCC, 0x01, 0x5D, 0x00, 0x11, 0x01, 0x47, 0x01,
-        0x87, 0x01, 0xF0, 0x01, 0xCC, 0x02, 0xF3, 0x01, 0xC9, 0x03, 0xAF, 0x01,
-        0xAF, 0x03, 0x7E, 0x01, 0x8E, 0x02, 0x83, 0x01, 0x26, 0x01, 0xCA, 0x01,
-        0x0E, 0x00, 0xDB, 0x01, 0xD6, 0xFF, 0x5F, 0x01, 0x69, 0xFF, 0xB0, 0x00,
-        0x1F, 0xFE, 0x35, 0x00, 0x22, 0xFC, 0x0F, 0x00, 0x23, 0xFA, 0x2F, 0x00,
-        0xB2, 0xF8, 0x6C, 0x00, 0x0F, 0xF8, 0xA5, 0x00, 0x32, 0xF8, 0xB3, 0x00,
-        0xFB, 0xF8, 0xBA, 0x00, 0x74, 0xFA, 0x8B, 0x00, 0x5E, 0xFC, 0x13, 0x00,
-        0xFF, 0xFD, 0x53, 0xFF, 0xA8, 0xFE, 0x6B, 0xFE, 0x12, 0xFE, 0xCC, 0xFD,
-        0xC7, 0xFC, 0xC4, 0xFD, 0xBD, 0xFB, 0x21, 0xFE, 0xE8, 0xFB, 0x77, 0xFE,
-        0x1B, 0xFD, 0x9D, 0xFE, 0xA7, 0xFE, 0x6D, 0xFE, 0xD8, 0xFF, 0x4E, 0xFE,
-        0x39, 0x00, 0xB3, 0xFE, 0xC5, 0x00, 0x57, 0xFF, 0x39, 0x02, 0xCB, 0xFF,
-        0x47, 0x04, 0x1E, 0x00, 0x64, 0x06, 0x1C, 0x00, 0xE8, 0x07, 0xF9, 0xFF,
-        0xA1, 0x08, 0xCC, 0xFF, 0x94, 0x08, 0xC2, 0xFF, 0xCC, 0x07, 0xD6, 0xFF,
-        0x36, 0x06, 0x09, 0x00, 0x36, 0x04, 0x88, 0x00, 0x89, 0x02, 0x3E, 0x01,
-        0xED, 0x01, 0x24, 0x02, 0x8E, 0x02, 0xC2, 0x02, 0xEC, 0x03, 0xB6, 0x02,
-        0xE0, 0x04, 0x4F, 0x02, 0x93, 0x04, 0xDC, 0x01, 0x2E, 0x03, 0xAD, 0x01,
-        0x7D, 0x01, 0xD4, 0x01, 0x29, 0x00, 0xF9, 0x01, 0x9F, 0xFF, 0x93, 0x01,
-        0xF9, 0xFE, 0xE7, 0x00, 0x85, 0xFD, 0x62, 0x00, 0x7F, 0xFB, 0x03, 0x00,
-        0x77, 0xF9, 0x03, 0x00, 0xF8, 0xF7, 0x2F, 0x00, 0x5C, 0xF7, 0x60, 0x00,
-        0x79, 0xF7, 0x6E, 0x00, 0x64, 0xF8, 0x6D, 0x00, 0x16, 0xFA, 0x49, 0x00,
-        0x31, 0xFC, 0xD8, 0xFF, 0xDB, 0xFD, 0x2E, 0xFF, 0x7E, 0xFE, 0x5C, 0xFE,
-        0xD7, 0xFD, 0xD0, 0xFD, 0x8A, 0xFC, 0xDE, 0xFD, 0x99, 0xFB, 0x4F, 0xFE,
-        0x09, 0xFC, 0xC8, 0xFE, 0x7D, 0xFD, 0x14, 0xFF, 0x4C, 0xFF, 0xFC, 0xFE,
-        0xB8, 0x00, 0xD4, 0xFE, 0x4A, 0x01, 0x3C, 0xFF, 0xE4, 0x01, 0xDA, 0xFF,
-        0x35, 0x03, 0x5C, 0x00, 0x08, 0x05, 0xB0, 0x00, 0xF6, 0x06, 0xA6, 0x00,
-        0x5D, 0x08, 0x71, 0x00, 0xFC, 0x08, 0x2D, 0x00, 0xD1, 0x08, 0x08, 0x00,
-        0xCE, 0x07, 0xF0, 0xFF, 0xF4, 0x05, 0xF9, 0xFF, 0xC1, 0x03, 0x5E, 0x00,
-        0x0B, 0x02, 0xF5, 0x00, 0x5E, 0x01, 0xB7, 0x01, 0xEE, 0x01, 0x34, 0x02,
-        0x3C, 0x03, 0x1D, 0x02, 0x2C, 0x04, 0xAD, 0x01, 0xCC, 0x03, 0x34, 0x01,
-        0x61, 0x02, 0xF5, 0x00, 0xA5, 0x00, 0x1D, 0x01, 0x52, 0xFF, 0x4E, 0x01,
-        0xD9, 0xFE, 0xF8, 0x00, 0x64, 0xFE, 0x61, 0x00, 0x2F, 0xFD, 0xD7, 0xFF,
-        0x68, 0xFB, 0x78, 0xFF, 0x73, 0xF9, 0x6B, 0xFF, 0xF7, 0xF7, 0x99, 0xFF,
-        0x43, 0xF7, 0xE3, 0xFF, 0x6F, 0xF7, 0x1A, 0x00, 0x8B, 0xF8, 0x51, 0x00,
-        0x7E, 0xFA, 0x55, 0x00, 0xBB, 0xFC, 0x08, 0x00, 0x80, 0xFE, 0x83, 0xFF,
-        0x45, 0xFF, 0xF1, 0xFE, 0xBB, 0xFE, 0x8D, 0xFE, 0x5F, 0xFD, 0xAC, 0xFE,
-        0x50, 0xFC, 0xF8, 0xFE, 0x8C, 0xFC, 0x42, 0xFF, 0xE4, 0xFD, 0x51, 0xFF,
-        0x82, 0xFF, 0x07, 0xFF, 0xC2, 0x00, 0xC6, 0xFE, 0x1F, 0x01, 0x17, 0xFF,
-        0x8B, 0x01, 0xCE, 0xFF, 0xC0, 0x02, 0x80, 0x00, 0x9C, 0x04, 0x12, 0x01,
-        0xA2, 0x06, 0x2B, 0x01, 0x3C, 0x08, 0xFC, 0x00, 0xFE, 0x08, 0xA8, 0x00,
-        0xD6, 0x08, 0x5C, 0x00, 0xB5, 0x07, 0x14, 0x00, 0xB9, 0x05, 0xF2, 0xFF,
-        0x73, 0x03, 0x29, 0x00, 0xA0, 0x01, 0x8E, 0x00, 0xCC, 0x00, 0x15, 0x01,
-        0x57, 0x01, 0x74, 0x01, 0xBD, 0x02, 0x61, 0x01, 0xD8, 0x03, 0x1B, 0x01,
-        0xA2, 0x03, 0xCE, 0x00, 0x4A, 0x02, 0xB4, 0x00, 0xA5, 0x00, 0xE9, 0x00,
-        0x63, 0xFF, 0x1C, 0x01, 0x08, 0xFF, 0xB5, 0x00, 0xA2, 0xFE, 0xDC, 0xFF,
-        0x5B, 0xFD, 0x09, 0xFF, 0x64, 0xFB, 0x55, 0xFE, 0x40, 0xF9, 0x27, 0xFE,
-        0xA3, 0xF7, 0x3E, 0xFE, 0xDA, 0xF6, 0x87, 0xFE, 0x17, 0xF7, 0xC0, 0xFE,
-        0x4E, 0xF8, 0x08, 0xFF, 0x68, 0xFA, 0x1E, 0xFF, 0xC7, 0xFC, 0xF5, 0xFE,
-        0xAA, 0xFE, 0x9D, 0xFE, 0x86, 0xFF, 0x2D, 0xFE, 0xE6, 0xFE, 0xE3, 0xFD,
-        0x77, 0xFD, 0x0B, 0xFE, 0x49, 0xFC, 0x77, 0xFE, 0x93, 0xFC, 0xE7, 0xFE,
-        0xF5, 0xFD, 0x15, 0xFF, 0xB3, 0xFF, 0xE4, 0xFE, 0xDC, 0x00, 0xA1, 0xFE,
-        0x37, 0x01, 0x01, 0xFF, 0x95, 0x01, 0xD8, 0xFF, 0xF5, 0x02, 0xC5, 0x00,
-        0xE4, 0x04, 0x7F, 0x01, 0xF5, 0x06, 0xB5, 0x01, 0x76, 0x08, 0x94, 0x01,
-        0x1E, 0x09, 0x58, 0x01, 0xBF, 0x08, 0x23, 0x01, 0x56, 0x07, 0xE8, 0x00,
-        0x1A, 0x05, 0xAF, 0x00, 0x9E, 0x02, 0xC6, 0x00, 0x9D, 0x00, 0xFC, 0x00,
-        0xCD, 0xFF, 0x5C, 0x01, 0x64, 0x00, 0x91, 0x01, 0xF0, 0x01, 0x55, 0x01,
-        0x02, 0x03, 0xEC, 0x00, 0xAC, 0x02, 0x85, 0x00, 0x20, 0x01, 0x6D, 0x00,
-        0x55, 0xFF, 0xAE, 0x00, 0x21, 0xFE, 0xF8, 0x00, 0xCD, 0xFD, 0x96, 0x00,
-        0x77, 0xFD, 0xBA, 0xFF, 0x2F, 0xFC, 0xD4, 0xFE, 0x59, 0xFA, 0x39, 0xFE,
-        0x60, 0xF8, 0x25, 0xFE, 0xFE, 0xF6, 0x57, 0xFE, 0x6B, 0xF6, 0x93, 0xFE,
-        0xE3, 0xF6, 0xB1, 0xFE, 0x63, 0xF8, 0xE1, 0xFE, 0xBB, 0xFA, 0xFD, 0xFE,
-        0x52, 0xFD, 0xDB, 0xFE, 0x5D, 0xFF, 0x99, 0xFE, 0x21, 0x00, 0x31, 0xFE,
-        0x81, 0xFF, 0xFC, 0xFD, 0xFF, 0xFD, 0x2D, 0xFE, 0xF4, 0xFC, 0x94, 0xFE,
-        0x5F, 0xFD, 0xF8, 0xFE, 0xF0, 0xFE, 0x1C, 0xFF, 0xB5, 0x00, 0xD7, 0xFE,
-        0xD6, 0x01, 0x8C, 0xFE, 0x0C, 0x02, 0xDD, 0xFE, 0x4A, 0x02, 0x97, 0xFF,
-        0x6C, 0x03, 0x5D, 0x00, 0x30, 0x05, 0xE4, 0x00, 0x13, 0x07, 0xFB, 0x00,
-        0x85, 0x08, 0xD0, 0x00, 0x2C, 0x09, 0xAD, 0x00, 0xC6, 0x08, 0x95, 0x00,
-        0x58, 0x07, 0x75, 0x00, 0x04, 0x05, 0x67, 0x00, 0x7F, 0x02, 0xA3, 0x00,
-        0x79, 0x00, 0x04, 0x01, 0xB1, 0xFF, 0x7E, 0x01, 0x40, 0x00, 0xB6, 0x01,
-        0xAC, 0x01, 0x74, 0x01, 0xB3, 0x02, 0x0F, 0x01, 0x4E, 0x02, 0xAF, 0x00,
-        0xC5, 0x00, 0x99, 0x00, 0x0A, 0xFF, 0xEA, 0x00, 0xFC, 0xFD, 0x44, 0x01,
-        0xDB, 0xFD, 0x08, 0x01, 0xAE, 0xFD, 0x6B, 0x00, 0x98, 0xFC, 0xB0, 0xFF,
-        0xCD, 0xFA, 0x2F, 0xFF, 0xBC, 0xF8, 0x00, 0xFF, 0x21, 0xF7, 0x28, 0xFF,
-        0x5D, 0xF6, 0x3D, 0xFF, 0xAD, 0xF6, 0x51, 0xFF, 0x19, 0xF8, 0x5D, 0xFF,
-        0x55, 0xFA, 0x62, 0xFF, 0xDF, 0xFC, 0x1F, 0xFF, 0xDB, 0xFE, 0xD4, 0xFE,
-        0xB6, 0xFF, 0x70, 0xFE, 0x42, 0xFF, 0x4F, 0xFE, 0xF2, 0xFD, 0x84, 0xFE,
-        0xEA, 0xFC, 0xDD, 0xFE, 0x46, 0xFD, 0x26, 0xFF, 0xBE, 0xFE, 0x32, 0xFF,
-        0x6C, 0x00, 0xDC, 0xFE, 0x75, 0x01, 0x84, 0xFE, 0x8A, 0x01, 0xBB, 0xFE,
-        0xA6, 0x01, 0x5E, 0xFF, 0xAE, 0x02, 0x0E, 0x00, 0x8C, 0x04, 0xA1, 0x00,
-        0xAF, 0x06, 0xD4, 0x00, 0x6A, 0x08, 0xC3, 0x00, 0x26, 0x09, 0xAD, 0x00,
-        0xCF, 0x08, 0xA5, 0x00, 0x6B, 0x07, 0x87, 0x00, 0x37, 0x05, 0x6E, 0x00,
-        0xD8, 0x02, 0x94, 0x00, 0xF0, 0x00, 0xDE, 0x00, 0x1D, 0x00, 0x45, 0x01,
-        0x94, 0x00, 0x83, 0x01, 0xE5, 0x01, 0x64, 0x01, 0x02, 0x03, 0x1F, 0x01,
-        0xBD, 0x02, 0xE5, 0x00, 0x46, 0x01, 0xE3, 0x00, 0x93, 0xFF, 0x3F, 0x01,
-        0x94, 0xFE, 0x92, 0x01, 0x93, 0xFE, 0x52, 0x01, 0x8C, 0xFE, 0xAD, 0x00,
-        0x87, 0xFD, 0xFD, 0xFF, 0x90, 0xFB, 0x5F, 0xFF, 0x4C, 0xF9, 0x22, 0xFF,
-        0x8B, 0xF7, 0x1E, 0xFF, 0xDA, 0xF6, 0x2B, 0xFF, 0x50, 0xF7, 0x26, 0xFF,
-        0xC2, 0xF8, 0x45, 0xFF, 0xF2, 0xFA, 0x57, 0xFF, 0x4F, 0xFD, 0x2F, 0xFF,
-        0x2A, 0xFF, 0xD0, 0xFE, 0x07, 0x00, 0x52, 0xFE, 0xA3, 0xFF, 0x02, 0xFE,
-        0x62, 0xFE, 0x20, 0xFE, 0x45, 0xFD, 0x73, 0xFE, 0x89, 0xFD, 0xBE, 0xFE,
-        0xFD, 0xFE, 0xC1, 0xFE, 0xAA, 0x00, 0x65, 0xFE, 0xA4, 0x01, 0x12, 0xFE,
-        0x8B, 0x01, 0x62, 0xFE, 0x77, 0x01, 0x10, 0xFF, 0x6D, 0x02, 0xCF, 0xFF,
-        0x6C, 0x04, 0x69, 0x00, 0xB5, 0x06, 0xBA, 0x00, 0x6D, 0x08, 0xBF, 0x00,
-        0x05, 0x09, 0xD1, 0x00, 0x78, 0x08, 0xDE, 0x00, 0xF6, 0x06, 0xC3, 0x00,
-        0xB6, 0x04, 0xA5, 0x00, 0x55, 0x02, 0xCB, 0x00, 0x6E, 0x00, 0x2B, 0x01,
-        0x8D, 0xFF, 0xA9, 0x01, 0xF1, 0xFF, 0xFD, 0x01, 0x34, 0x01, 0xD8, 0x01,
-        0x4B, 0x02, 0x8F, 0x01, 0x0B, 0x02, 0x54, 0x01, 0xA2, 0x00, 0x5A, 0x01,
-        0x00, 0xFF, 0xB4, 0x01, 0x21, 0xFE, 0xF1, 0x01, 0x4F, 0xFE, 0x9B, 0x01,
-        0x7D, 0xFE, 0xE9, 0x00, 0x90, 0xFD, 0x3D, 0x00, 0xA2, 0xFB, 0xAC, 0xFF,
-        0x60, 0xF9, 0x62, 0xFF, 0xB2, 0xF7, 0x63, 0xFF, 0x25, 0xF7, 0x54, 0xFF,
-        0xBF, 0xF7, 0x4C, 0xFF, 0x56, 0xF9, 0x68, 0xFF, 0xA0, 0xFB, 0x84, 0xFF,
-        0x0E, 0xFE, 0x54, 0xFF, 0xF1, 0xFF, 0xEA, 0xFE, 0xBC, 0x00, 0x4D, 0xFE,
-        0x4C, 0x00, 0xE6, 0xFD, 0x13, 0xFF, 0xEF, 0xFD, 0x02, 0xFE, 0x43, 0xFE,
-        0x43, 0xFE, 0x96, 0xFE, 0x96, 0xFF, 0xBA, 0xFE, 0x28, 0x01, 0x8A, 0xFE,
-        0x00, 0x02, 0x66, 0xFE, 0xCE, 0x01, 0xBF, 0xFE, 0x9B, 0x01, 0x5D, 0xFF,
-        0x7B, 0x02, 0xF4, 0xFF, 0x59, 0x04, 0x65, 0x00, 0x8C, 0x06, 0x97, 0x00,
-        0x31, 0x08, 0x7B, 0x00, 0xBA, 0x08, 0x81, 0x00, 0x2B, 0x08, 0x83, 0x00,
-        0x93, 0x06, 0x87, 0x00, 0x4E, 0x04, 0x8B, 0x00, 0xE5, 0x01, 0xDC, 0x00,
-        0x27, 0x00, 0x59, 0x01, 0x7F, 0xFF, 0xF2, 0x01, 0xFF, 0xFF, 0x51, 0x02,
-        0x3C, 0x01, 0x2A, 0x02, 0x35, 0x02, 0xD2, 0x01, 0xF8, 0x01, 0x5D, 0x01,
-        0xA7, 0x00, 0x34, 0x01, 0x23, 0xFF, 0x52, 0x01, 0x3D, 0xFE, 0x85, 0x01,
-        0x5B, 0xFE, 0x49, 0x01, 0x7A, 0xFE, 0xBF, 0x00, 0xB0, 0xFD, 0x3C, 0x00,
-        0xF3, 0xFB, 0xC6, 0xFF, 0xEC, 0xF9, 0xA6, 0xFF, 0x66, 0xF8, 0xC4, 0xFF,
-        0xF4, 0xF7, 0xCB, 0xFF, 0xA1, 0xF8, 0xA9, 0xFF, 0x4C, 0xFA, 0x8E, 0xFF,
-        0x9E, 0xFC, 0x70, 0xFF, 0xF1, 0xFE, 0x2F, 0xFF, 0x9B, 0x00, 0xE0, 0xFE,
-        0x1A, 0x01, 0x6B, 0xFE, 0x8C, 0x00, 0x28, 0xFE, 0x44, 0xFF, 0x4B, 0xFE,
-        0x5B, 0xFE, 0x9D, 0xFE, 0x9C, 0xFE, 0xFA, 0xFE, 0xE1, 0xFF, 0x1B, 0xFF,
-        0x71, 0x01, 0xE9, 0xFE, 0x5E, 0x02, 0xB1, 0xFE, 0x5B, 0x02, 0xEE, 0xFE,
-        0x3B, 0x02, 0x84, 0xFF, 0xFB, 0x02, 0x19, 0x00, 0x92, 0x04, 0x91, 0x00,
-        0x73, 0x06, 0xB7, 0x00, 0xC3, 0x07, 0x94, 0x00, 0x10, 0x08, 0x91, 0x00,
-        0x40, 0x07, 0xA8, 0x00, 0x8E, 0x05, 0xBC, 0x00, 0x40, 0x03, 0xC8, 0x00,
-        0x07, 0x01, 0xE3, 0x00, 0x84, 0xFF, 0x26, 0x01, 0x2A, 0xFF, 0x8B, 0x01,
-        0xCC, 0xFF, 0xE7, 0x01, 0x15, 0x01, 0xED, 0x01, 0x02, 0x02, 0xCC, 0x01,
-        0xC8, 0x01, 0xA2, 0x01, 0x79, 0x00, 0x9E, 0x01, 0xE7, 0xFE, 0xDD, 0x01,
-        0xEF, 0xFD, 0x1C, 0x02, 0xE7, 0xFD, 0xD4, 0x01, 0x00, 0xFE, 0x2E, 0x01,
-        0x3A, 0xFD, 0x89, 0x00, 0xA8, 0xFB, 0x02, 0x00, 0xD1, 0xF9, 0xE7, 0xFF,
-        0x94, 0xF8, 0x0D, 0x00, 0x62, 0xF8, 0x28, 0x00, 0x37, 0xF9, 0x16, 0x00,
-        0xEB, 0xFA, 0x00, 0x00, 0x20, 0xFD, 0xFA, 0xFF, 0x41, 0xFF, 0xD8, 0xFF,
-        0xB5, 0x00, 0x91, 0xFF, 0x12, 0x01, 0x0D, 0xFF, 0x75, 0x00, 0x8F, 0xFE,
-        0x36, 0xFF, 0x66, 0xFE, 0x49, 0xFE, 0x60, 0xFE, 0x94, 0xFE, 0x73, 0xFE,
-        0xE8, 0xFF, 0x6B, 0xFE, 0x7A, 0x01, 0x2F, 0xFE, 0x65, 0x02, 0x13, 0xFE,
-        0x5F, 0x02, 0x7D, 0xFE, 0x3C, 0x02, 0x43, 0xFF, 0xFB, 0x02, 0xF2, 0xFF,
-        0x9C, 0x04, 0x69, 0x00, 0x6A, 0x06, 0x6F, 0x00, 0xA4, 0x07, 0x39, 0x00,
-        0xCD, 0x07, 0x18, 0x00, 0xFD, 0x06, 0x32, 0x00, 0x57, 0x05, 0x4E, 0x00,
-        0x3E, 0x03, 0x56, 0x00, 0x1E, 0x01, 0x68, 0x00, 0xB7, 0xFF, 0x94, 0x00,
-        0x42, 0xFF, 0x09, 0x01, 0xD3, 0xFF, 0x79, 0x01, 0xFE, 0x00, 0xB7, 0x01,
-        0xE5, 0x01, 0xDD, 0x01, 0x96, 0x01, 0xEB, 0x01, 0x3E, 0x00, 0xF2, 0x01,
-        0xB4, 0xFE, 0x1D, 0x02, 0xCE, 0xFD, 0x10, 0x02, 0xEA, 0xFD, 0x76, 0x01,
-        0x1B, 0xFE, 0x96, 0x00, 0x5A, 0xFD, 0xDF, 0xFF, 0xB4, 0xFB, 0x85, 0xFF,
-        0xD5, 0xF9, 0xA7, 0xFF, 0x97, 0xF8, 0x18, 0x00, 0x62, 0xF8, 0x4B, 0x00,
-        0x1C, 0xF9, 0x46, 0x00, 0x9C, 0xFA, 0x1E, 0x00, 0x9C, 0xFC, 0x0E, 0x00,
-        0x9B, 0xFE, 0xF7, 0xFF, 0x0A, 0x00, 0xB0, 0xFF, 0x73, 0x00, 0x29, 0xFF,
-        0xE6, 0xFF, 0x98, 0xFE, 0xB3, 0xFE, 0x53, 0xFE, 0xC9, 0xFD, 0x24, 0xFE,
-        0x13, 0xFE, 0x1F, 0xFE, 0x62, 0xFF, 0x23, 0xFE, 0xE5, 0x00, 0x0A, 0xFE,
-        0xCA, 0x01, 0x2A, 0xFE, 0xAE, 0x01, 0xCC, 0xFE, 0x8C, 0x01, 0xA4, 0xFF,
-        0x5C, 0x02, 0x37, 0x00, 0x0C, 0x04, 0x73, 0x00, 0xFA, 0x05, 0x2F, 0x00,
-        0x4E, 0x07, 0xB2, 0xFF, 0xB2, 0x07, 0x86, 0xFF, 0x18, 0x07, 0xA0, 0xFF,
-        0xDA, 0x05, 0xEB, 0xFF, 0x02, 0x04, 0x23, 0x00, 0x30, 0x02, 0x5C, 0x00,
-        0xDA, 0x00, 0xAD, 0x00, 0x81, 0x00, 0x39, 0x01, 0x15, 0x01, 0xAB, 0x01,
-        0x47, 0x02, 0xE5, 0x01, 0x26, 0x03, 0x09, 0x02, 0xCE, 0x02, 0x06, 0x02,
-        0x71, 0x01, 0x00, 0x02, 0xD1, 0xFF, 0x09, 0x02, 0xC6, 0xFE, 0xD4, 0x01,
-        0xA8, 0xFE, 0x1B, 0x01, 0x91, 0xFE, 0x32, 0x00, 0x97, 0xFD, 0x8D, 0xFF,
-        0xD0, 0xFB, 0x4E, 0xFF, 0xBF, 0xF9, 0x95, 0xFF, 0x43, 0xF8, 0x09, 0x00,
-        0xC0, 0xF7, 0x35, 0x00, 0x2C, 0xF8, 0xF9, 0xFF, 0x44, 0xF9, 0xA1, 0xFF,
-        0xF1, 0xFA, 0x4B, 0xFF, 0xB3, 0xFC, 0x13, 0xFF, 0x01, 0xFE, 0xC7, 0xFE,
-        0x5F, 0xFE, 0x4B, 0xFE, 0xE0, 0xFD, 0xF0, 0xFD, 0xC3, 0xFC, 0xBF, 0xFD,
-        0xFD, 0xFB, 0x9F, 0xFD, 0x58, 0xFC, 0xAA, 0xFD, 0xBA, 0xFD, 0xCC, 0xFD,
-        0x63, 0xFF, 0xF8, 0xFD, 0x86, 0x00, 0x5F, 0xFE, 0xC8, 0x00, 0x44, 0xFF,
-        0xFC, 0x00, 0x32, 0x00, 0x01, 0x02, 0xCB, 0x00, 0xD0, 0x03, 0xF7, 0x00,
-        0xE8, 0x05, 0x96, 0x00, 0x70, 0x07, 0x06, 0x00, 0xFE, 0x07, 0xD0, 0xFF,
-        0x9B, 0x07, 0xFE, 0xFF, 0x86, 0x06, 0x6B, 0x00, 0xE4, 0x04, 0xCD, 0x00,
-        0x2A, 0x03, 0x0F, 0x01, 0xD3, 0x01, 0x48, 0x01, 0x53, 0x01, 0xAB, 0x01,
-        0xBA, 0x01, 0xFC, 0x01, 0xBF, 0x02, 0x2D, 0x02, 0x84, 0x03, 0x52, 0x02,
-        0x24, 0x03, 0x36, 0x02, 0xD1, 0x01, 0xF2, 0x01, 0x31, 0x00, 0xAD, 0x01,
-        0x12, 0xFF, 0x27, 0x01, 0xCC, 0xFE, 0x41, 0x00, 0x99, 0xFE, 0x46, 0xFF,
-        0xA8, 0xFD, 0xAE, 0xFE, 0xEF, 0xFB, 0x8C, 0xFE, 0xE7, 0xF9, 0x13, 0xFF,
-        0x62, 0xF8, 0xCD, 0xFF, 0xDF, 0xF7, 0x27, 0x00, 0x41, 0xF8, 0xF7, 0xFF,
-        0x5E, 0xF9, 0x6D, 0xFF, 0xE4, 0xFA, 0xE4, 0xFE, 0xA1, 0xFC, 0x76, 0xFE,
-        0xED, 0xFD, 0x19, 0xFE, 0x84, 0xFE, 0xA1, 0xFD, 0x2B, 0xFE, 0x43, 0xFD,
-        0x3C, 0xFD, 0x13, 0xFD, 0x80, 0xFC, 0x05, 0xFD, 0xD2, 0xFC, 0x3F, 0xFD,
-        0x2A, 0xFE, 0x9D, 0xFD, 0xC2, 0xFF, 0x01, 0xFE, 0xE9, 0x00, 0x93, 0xFE,
-        0x25, 0x01, 0x85, 0xFF, 0x43, 0x01, 0x8A, 0x00, 0x0E, 0x02, 0x22, 0x01,
-        0xAC, 0x03, 0x3B, 0x01, 0x97, 0x05, 0xA9, 0x00, 0x0C, 0x07, 0xE2, 0xFF,
-        0x84, 0x07, 0x8B, 0xFF, 0x15, 0x07, 0xCF, 0xFF, 0x08, 0x06, 0x7C, 0x00,
-        0x8D, 0x04, 0x23, 0x01, 0xF1, 0x02, 0x95, 0x01, 0xA6, 0x01, 0xF4, 0x01,
-        0x15, 0x01, 0x57, 0x02, 0x5C, 0x01, 0xBC, 0x02, 0x4E, 0x02, 0xEB, 0x02,
-        0x12, 0x03, 0xEE, 0x02, 0xB4, 0x02, 0xB0, 0x02, 0x60, 0x01, 0x43, 0x02,
-        0xB4, 0xFF, 0xDE, 0x01, 0x8F, 0xFE, 0x40, 0x01, 0x56, 0xFE, 0x3A, 0x00,
-        0x4E, 0xFE, 0x27, 0xFF, 0xA6, 0xFD, 0x81, 0xFE, 0x25, 0xFC, 0x7C, 0xFE,
-        0x51, 0xFA, 0x22, 0xFF, 0xE9, 0xF8, 0xFF, 0xFF, 0x74, 0xF8, 0x64, 0x00,
-        0xDB, 0xF8, 0x30, 0x00, 0xD4, 0xF9, 0x99, 0xFF, 0x3F, 0xFB, 0x14, 0xFF,
-        0xCD, 0xFC, 0xA6, 0xFE, 0x1B, 0xFE, 0x41, 0xFE, 0xBA, 0xFE, 0xB9, 0xFD,
-        0x81, 0xFE, 0x39, 0xFD, 0x97, 0xFD, 0xF8, 0xFC, 0xDB, 0xFC, 0xE2, 0xFC,
-        0x3C, 0xFD, 0x1E, 0xFD, 0xA5, 0xFE, 0x78, 0xFD, 0x58, 0x00, 0xE1, 0xFD,
-        0x88, 0x01, 0x8D, 0xFE, 0xC5, 0x01, 0xA7, 0xFF, 0xC0, 0x01, 0xC4, 0x00,
-        0x61, 0x02, 0x5D, 0x01, 0xD0, 0x03, 0x47, 0x01, 0x95, 0x05, 0x8F, 0x00,
-        0xF3, 0x06, 0x9D, 0xFF, 0x70, 0x07, 0x21, 0xFF, 0x1F, 0x07, 0x4B, 0xFF,
-        0x20, 0x06, 0xD7, 0xFF, 0xBA, 0x04, 0x71, 0x00, 0x16, 0x03, 0x06, 0x01,
-        0xB2, 0x01, 0x96, 0x01, 0xFC, 0x00, 0x41, 0x02, 0x25, 0x01, 0xC3, 0x02,
-        0x08, 0x02, 0xFC, 0x02, 0xBB, 0x02, 0xFA, 0x02, 0x56, 0x02, 0xBE, 0x02,
-        0xEC, 0x00, 0x69, 0x02, 0x3A, 0xFF, 0x04, 0x02, 0x0A, 0xFE, 0x5D, 0x01,
-        0xCE, 0xFD, 0x3E, 0x00, 0xE2, 0xFD, 0x26, 0xFF, 0x5B, 0xFD, 0xA6, 0xFE,
-        0x0F, 0xFC, 0xBF, 0xFE, 0x5B, 0xFA, 0x73, 0xFF, 0x09, 0xF9, 0x53, 0x00,
-        0x84, 0xF8, 0xC0, 0x00, 0xDA, 0xF8, 0x9A, 0x00, 0xCD, 0xF9, 0x15, 0x00,
-        0x49, 0xFB, 0x79, 0xFF, 0x06, 0xFD, 0xDD, 0xFE, 0x94, 0xFE, 0x50, 0xFE,
-        0x6C, 0xFF, 0xC4, 0xFD, 0x5A, 0xFF, 0x65, 0xFD, 0x81, 0xFE, 0x46, 0xFD,
-        0xC3, 0xFD, 0x46, 0xFD, 0x21, 0xFE, 0x77, 0xFD, 0x75, 0xFF, 0xC5, 0xFD,
-        0x24, 0x01, 0x22, 0xFE, 0x41, 0x02, 0xC4, 0xFE, 0x75, 0x02, 0xCE, 0xFF,
-        0x50, 0x02, 0xC1, 0x00, 0xD5, 0x02, 0x2D, 0x01, 0x10, 0x04, 0x0E, 0x01,
-        0xBD, 0x05, 0x5E, 0x00, 0x0A, 0x07, 0x74, 0xFF, 0x96, 0x07, 0xE9, 0xFE,
-        0x4F, 0x07, 0xF6, 0xFE, 0x60, 0x06, 0x74, 0xFF, 0xE3, 0x04, 0x23, 0x00,
-        0x13, 0x03, 0xD4, 0x00, 0x80, 0x01, 0x79, 0x01, 0x95, 0x00, 0x14, 0x02,
-        0xBA, 0x00, 0x7D, 0x02, 0xA5, 0x01, 0xAC, 0x02, 0x76, 0x02, 0x9B, 0x02,
-        0x29, 0x02, 0x52, 0x02, 0xD0, 0x00, 0xE4, 0x01, 0x2F, 0xFF, 0x95, 0x01,
-        0x05, 0xFE, 0x06, 0x01, 0xD0, 0xFD, 0x37, 0x00, 0xE6, 0xFD, 0x7C, 0xFF,
-        0x78, 0xFD, 0x4B, 0xFF, 0x3D, 0xFC, 0x8A, 0xFF, 0x9C, 0xFA, 0x4D, 0x00,
-        0x4E, 0xF9, 0x40, 0x01, 0xBD, 0xF8, 0xC3, 0x01, 0xF9, 0xF8, 0x9B, 0x01,
-        0xD0, 0xF9, 0xF1, 0x00, 0x42, 0xFB, 0x0C, 0x00, 0x08, 0xFD, 0x2A, 0xFF,
-        0xA2, 0xFE, 0x6A, 0xFE, 0x81, 0xFF, 0xCA, 0xFD, 0x5D, 0xFF, 0x6E, 0xFD,
-        0x67, 0xFE, 0x64, 0xFD, 0x96, 0xFD, 0x8A, 0xFD, 0xE3, 0xFD, 0xFB, 0xFD,
-        0x3C, 0xFF, 0x65, 0xFE, 0xE9, 0x00, 0xBE, 0xFE, 0x20, 0x02, 0x24, 0xFF,
-        0x58, 0x02, 0xE1, 0xFF, 0x43, 0x02, 0x71, 0x00, 0xA9, 0x02, 0x96, 0x00,
-        0xE5, 0x03, 0x50, 0x00, 0x82, 0x05, 0x97, 0xFF, 0xDC, 0x06, 0xA7, 0xFE,
-        0x6B, 0x07, 0x31, 0xFE, 0x44, 0x07, 0x71, 0xFE, 0x68, 0x06, 0x35, 0xFF,
-        0x0C, 0x05, 0x2D, 0x00, 0x48, 0x03, 0x20, 0x01, 0xC2, 0x01, 0xD9, 0x01,
-        0xE3, 0x00, 0x79, 0x02, 0x15, 0x01, 0xC4, 0x02, 0x0E, 0x02, 0xC8, 0x02,
-        0xE0, 0x02, 0x7C, 0x02, 0x87, 0x02, 0x07, 0x02, 0x13, 0x01, 0x86, 0x01,
-        0x4B, 0xFF, 0x32, 0x01, 0x02, 0xFE, 0xC4, 0x00, 0xC0, 0xFD, 0x0A, 0x00,
-        0xE1, 0xFD, 0x8B, 0xFF, 0x88, 0xFD, 0x7C, 0xFF, 0x5A, 0xFC, 0xCF, 0xFF,
-        0xC3, 0xFA, 0x97, 0x00, 0x7D, 0xF9, 0x83, 0x01, 0xF1, 0xF8, 0x01, 0x02,
-        0x24, 0xF9, 0xBA, 0x01, 0x04, 0xFA, 0xF6, 0x00, 0x74, 0xFB, 0xF1, 0xFF,
-        0x43, 0xFD, 0xE9, 0xFE, 0xDC, 0xFE, 0x15, 0xFE, 0xAE, 0xFF, 0x70, 0xFD,
-        0x77, 0xFF, 0x23, 0xFD, 0x71, 0xFE, 0x3D, 0xFD, 0x93, 0xFD, 0x9A, 0xFD,
-        0xDE, 0xFD, 0x2E, 0xFE, 0x3E, 0xFF, 0xB9, 0xFE, 0xF5, 0x00, 0x1B, 0xFF,
-        0x2D, 0x02, 0x8D, 0xFF, 0x65, 0x02, 0x39, 0x00, 0x35, 0x02, 0xA9, 0x00,
-        0x8B, 0x02, 0xA0, 0x00, 0xA7, 0x03, 0x2E, 0x00, 0x45, 0x05, 0x53, 0xFF,
-        0x88, 0x06, 0x57, 0xFE, 0x1F, 0x07, 0xE0, 0xFD, 0xD4, 0x06, 0x2C, 0xFE,
-        0xCE, 0x05, 0x12, 0xFF, 0x2A, 0x04, 0x40, 0x00, 0x37, 0x02, 0x88, 0x01,
-        0x93, 0x00, 0x85, 0x02, 0xCD, 0xFF, 0x42, 0x03, 0x1D, 0x00, 0x72, 0x03,
-        0x47, 0x01, 0x24, 0x03, 0x4D, 0x02, 0x87, 0x02, 0x33, 0x02, 0xD3, 0x01,
-        0x01, 0x01, 0x30, 0x01, 0x59, 0xFF, 0xCE, 0x00, 0x29, 0xFE, 0x55, 0x00,
-        0xE4, 0xFD, 0xBF, 0xFF, 0x10, 0xFE, 0x63, 0xFF, 0xB1, 0xFD, 0x8A, 0xFF,
-        0x88, 0xFC, 0xFF, 0xFF, 0xEA, 0xFA, 0xD3, 0x00, 0x98, 0xF9, 0xB3, 0x01,
-        0x14, 0xF9, 0x0A, 0x02, 0x6E, 0xF9, 0xAF, 0x01, 0xAC, 0xFA, 0xC2, 0x00,
-        0x8C, 0xFC, 0x8A, 0xFF, 0xA5, 0xFE, 0x4C, 0xFE, 0x5B, 0x00, 0x5E, 0xFD,
-        0x1A, 0x01, 0xCF, 0xFC, 0xAE, 0x00, 0xC8, 0xFC, 0x5A, 0xFF, 0x39, 0xFD,
-        0x1D, 0xFE, 0xE3, 0xFD, 0xF3, 0xFD, 0xA5, 0xFE, 0xFF, 0xFE, 0x44, 0xFF,
-        0x80, 0x00, 0xAE, 0xFF, 0xB2, 0x01, 0x12, 0x00, 0xF0, 0x01, 0xA6, 0x00,
-        0xE1, 0x01, 0xF1, 0x00, 0x47, 0x02, 0xD2, 0x00, 0x78, 0x03, 0x4D, 0x00,
-        0x11, 0x05, 0x6D, 0xFF, 0x49, 0x06, 0x7D, 0xFE, 0xB8, 0x06, 0x10, 0xFE,
-        0x2F, 0x06, 0x54, 0xFE, 0xD0, 0x04, 0x25, 0xFF, 0xD2, 0x02, 0x3D, 0x00,
-        0xB2, 0x00, 0x64, 0x01, 0x13, 0xFF, 0x43, 0x02, 0x87, 0xFE, 0xE1, 0x02,
-        0x32, 0xFF, 0xEB, 0x02, 0xBC, 0x00, 0x8A, 0x02, 0x20, 0x02, 0xE0, 0x01,
-        0x53, 0x02, 0x30, 0x01, 0x57, 0x01, 0xA8, 0x00, 0xBC, 0xFF, 0x60, 0x00,
-        0x75, 0xFE, 0x10, 0x00, 0x05, 0xFE, 0x92, 0xFF, 0xFB, 0xFD, 0x47, 0xFF,
-        0x7C, 0xFD, 0x72, 0xFF, 0x4D, 0xFC, 0xFD, 0xFF, 0xCA, 0xFA, 0xE5, 0x00,
-        0xAD, 0xF9, 0xD0, 0x01, 0x62, 0xF9, 0x35, 0x02, 0xFD, 0xF9, 0xF4, 0x01,
-        0x6B, 0xFB, 0x20, 0x01, 0x67, 0xFD, 0x0D, 0x00, 0x6E, 0xFF, 0xDF, 0xFE,
-        0xE3, 0x00, 0xF9, 0xFD, 0x3C, 0x01, 0x5C, 0xFD, 0x70, 0x00, 0x4E, 0xFD,
-        0xCC, 0xFE, 0xB4, 0xFD, 0x63, 0xFD, 0x4C, 0xFE, 0x2C, 0xFD, 0xF6, 0xFE,
-        0x39, 0xFE, 0x65, 0xFF, 0xDF, 0xFF, 0xAB, 0xFF, 0x40, 0x01, 0xF5, 0xFF,
-        0xBD, 0x01, 0x7B, 0x00, 0xE2, 0x01, 0xC6, 0x00, 0x74, 0x02, 0x9E, 0x00,
-        0xB6, 0x03, 0x0F, 0x00, 0x43, 0x05, 0x20, 0xFF, 0x54, 0x06, 0x34, 0xFE,
-        0x87, 0x06, 0xBF, 0xFD, 0xDC, 0x05, 0x0E, 0xFE, 0x65, 0x04, 0xE2, 0xFE,
-        0x7D, 0x02, 0x0A, 0x00, 0x84, 0x00, 0x34, 0x01, 0x31, 0xFF, 0x20, 0x02,
-        0xED, 0xFE, 0xB9, 0x02, 0xDB, 0xFF, 0xBC, 0x02, 0x88, 0x01, 0x57, 0x02,
-        0xEE, 0x02, 0xB7, 0x01, 0x10, 0x03, 0x0C, 0x01, 0xF0, 0x01, 0x7F, 0x00,
-        0x46, 0x00, 0x25, 0x00, 0xF1, 0xFE, 0xC5, 0xFF, 0x77, 0xFE, 0x3C, 0xFF,
-        0x5D, 0xFE, 0xF0, 0xFE, 0xBB, 0xFD, 0x1D, 0xFF, 0x69, 0xFC, 0xB1, 0xFF,
-        0xC4, 0xFA, 0xA0, 0x00, 0xA6, 0xF9, 0x9C, 0x01, 0x67, 0xF9, 0x17, 0x02,
-        0xFE, 0xF9, 0xD1, 0x01, 0x5B, 0xFB, 0xF3, 0x00, 0x3D, 0xFD, 0xC3, 0xFF,
-        0x33, 0xFF, 0x99, 0xFE, 0x8C, 0x00, 0xAD, 0xFD, 0xDC, 0x00, 0x0F, 0xFD,
-        0xF1, 0xFF, 0xF5, 0xFC, 0x5F, 0xFE, 0x43, 0xFD, 0x06, 0xFD, 0xD1, 0xFD,
-        0xF3, 0xFC, 0x6E, 0xFE, 0x04, 0xFE, 0x0A, 0xFF, 0x8C, 0xFF, 0x75, 0xFF,
-        0xB8, 0x00, 0xE6, 0xFF, 0x09, 0x01, 0x84, 0x00, 0x1F, 0x01, 0xE5, 0x00,
-        0xC3, 0x01, 0xCA, 0x00, 0x38, 0x03, 0x3F, 0x00, 0xFC, 0x04, 0x45, 0xFF,
-        0x42, 0x06, 0x32, 0xFE, 0xA6, 0x06, 0x9B, 0xFD, 0x23, 0x06, 0xD6, 0xFD,
-        0xCF, 0x04, 0xB4, 0xFE, 0xE7, 0x02, 0xEF, 0xFF, 0xEA, 0x00, 0x2F, 0x01,
-        0x87, 0xFF, 0x31, 0x02, 0x36, 0xFF, 0xEA, 0x02, 0x12, 0x00, 0x1F, 0x03,
-        0x9D, 0x01, 0xE1, 0x02, 0xDE, 0x02, 0x6B, 0x02, 0xE7, 0x02, 0xCC, 0x01,
-        0xD8, 0x01, 0x2D, 0x01, 0x4A, 0x00, 0xA0, 0x00, 0x16, 0xFF, 0x15, 0x00,
-        0xB0, 0xFE, 0x62, 0xFF, 0x91, 0xFE, 0xFB, 0xFE, 0xD5, 0xFD, 0x16, 0xFF,
-        0x49, 0xFC, 0x9D, 0xFF, 0x65, 0xFA, 0xA0, 0x00, 0x08, 0xF9, 0xC7, 0x01,
-        0x98, 0xF8, 0x74, 0x02, 0x1A, 0xF9, 0x45, 0x02, 0x6C, 0xFA, 0x5D, 0x01,
-        0x57, 0xFC, 0x28, 0x00, 0x62, 0xFE, 0xF2, 0xFE, 0xD1, 0xFF, 0x05, 0xFE,
-        0x48, 0x00, 0x5B, 0xFD, 0x8F, 0xFF, 0x2A, 0xFD, 0x2B, 0xFE, 0x5A, 0xFD,
-        0x0E, 0xFD, 0xCA, 0xFD, 0x1B, 0xFD, 0x5E, 0xFE, 0x42, 0xFE, 0x00, 0xFF,
-        0xD5, 0xFF, 0x80, 0xFF, 0x0F, 0x01, 0xFA, 0xFF, 0x76, 0x01, 0x99, 0x00,
-        0xAF, 0x01, 0xF8, 0x00, 0x74, 0x02, 0xD4, 0x00, 0x14, 0x04, 0x3D, 0x00,
-        0xF2, 0x05, 0x31, 0xFF, 0x52, 0x07, 0x00, 0xFE, 0xB4, 0x07, 0x5C, 0xFD,
-        0x1F, 0x07, 0x96, 0xFD, 0xB5, 0x05, 0x72, 0xFE, 0xB2, 0x03, 0x9E, 0xFF,
-        0x99, 0x01, 0xB6, 0x00, 0x0B, 0x00, 0x9B, 0x01, 0x8B, 0xFF, 0x4E, 0x02,
-        0x1B, 0x00, 0x8C, 0x02, 0x66, 0x01, 0x6C, 0x02, 0x63, 0x02, 0x0F, 0x02,
-        0x56, 0x02, 0x9B, 0x01, 0x35, 0x01, 0x22, 0x01, 0xB7, 0xFF, 0xC0, 0x00,
-        0x85, 0xFE, 0x56, 0x00, 0x29, 0xFE, 0xB9, 0xFF, 0xFC, 0xFD, 0x60, 0xFF,
-        0x3C, 0xFD, 0x7C, 0xFF, 0xAA, 0xFB, 0x0B, 0x00, 0xCD, 0xF9, 0xF7, 0x00,
-        0x84, 0xF8, 0x14, 0x02, 0x32, 0xF8, 0x94, 0x02, 0xE2, 0xF8, 0x5B, 0x02,
-        0x61, 0xFA, 0x81, 0x01, 0x6C, 0xFC, 0x72, 0x00, 0x84, 0xFE, 0x70, 0xFF,
-        0x06, 0x00, 0x93, 0xFE, 0x92, 0x00, 0xE4, 0xFD, 0x11, 0x00, 0x94, 0xFD,
-        0xDA, 0xFE, 0x96, 0xFD, 0xDF, 0xFD, 0xC7, 0xFD, 0xEC, 0xFD, 0x12, 0xFE,
-        0xFD, 0xFE, 0x6C, 0xFE, 0x6F, 0x00, 0xC7, 0xFE, 0x88, 0x01, 0x48, 0xFF,
-        0xD8, 0x01, 0x0B, 0x00, 0xF6, 0x01, 0x8A, 0x00, 0xAE, 0x02, 0x7E, 0x00,
-        0x3D, 0x04, 0x06, 0x00, 0x23, 0x06, 0x14, 0xFF, 0x6B, 0x07, 0x04, 0xFE,
-        0xB4, 0x07, 0x67, 0xFD, 0xF8, 0x06, 0x92, 0xFD, 0x77, 0x05, 0x51, 0xFE,
-        0x7F, 0x03, 0x52, 0xFF, 0x7D, 0x01, 0x4E, 0x00, 0x14, 0x00, 0x34, 0x01,
-        0x8C, 0xFF, 0xFB, 0x01, 0x14, 0x00, 0x70, 0x02, 0x3A, 0x01, 0x8D, 0x02,
-        0x33, 0x02, 0x89, 0x02, 0x1B, 0x02, 0x49, 0x02, 0xFC, 0x00, 0xE9, 0x01,
-        0x7B, 0xFF, 0x76, 0x01, 0x6B, 0xFE, 0xCE, 0x00, 0x21, 0xFE, 0x03, 0x00,
-        0x11, 0xFE, 0x78, 0xFF, 0x55, 0xFD, 0x8B, 0xFF, 0xC2, 0xFB, 0x13, 0x00,
-        0xD8, 0xF9, 0x24, 0x01, 0x8C, 0xF8, 0x4F, 0x02, 0x3B, 0xF8, 0xFB, 0x02,
-        0xE4, 0xF8, 0xC4, 0x02, 0x52, 0xFA, 0xEE, 0x01, 0x3C, 0xFC, 0xD5, 0x00,
-        0x34, 0xFE, 0xC4, 0xFF, 0x9A, 0xFF, 0xC3, 0xFE, 0x1B, 0x00, 0xDD, 0xFD,
-        0xA0, 0xFF, 0x48, 0xFD, 0x8A, 0xFE, 0x12, 0xFD, 0xAE, 0xFD, 0x1C, 0xFD,
-        0xCE, 0xFD, 0x65, 0xFD, 0xFA, 0xFE, 0xD5, 0xFD, 0x70, 0x00, 0x56, 0xFE,
-        0x8F, 0x01, 0x13, 0xFF, 0xE0, 0x01, 0xF8, 0xFF, 0x00, 0x02, 0x97, 0x00,
-        0xBD, 0x02, 0x8D, 0x00, 0x50, 0x04, 0x04, 0x00, 0x3A, 0x06, 0xF0, 0xFE,
-        0x93, 0x07, 0xC3, 0xFD, 0xDE, 0x07, 0x1A, 0xFD, 0x3B, 0x07, 0x4E, 0xFD,
-        0xBB, 0x05, 0x24, 0xFE, 0xD8, 0x03, 0x3F, 0xFF, 0xDD, 0x01, 0x58, 0x00,
-        0x89, 0x00, 0x66, 0x01, 0x03, 0x00, 0x5A, 0x02, 0x70, 0x00, 0xF9, 0x02,
-        0x7B, 0x01, 0x52, 0x03, 0x49, 0x02, 0x55, 0x03, 0x20, 0x02, 0x1D, 0x03,
-        0xE9, 0x00, 0x9B, 0x02, 0x61, 0xFF, 0x0D, 0x02, 0x36, 0xFE, 0x40, 0x01,
-        0xE3, 0xFD, 0x50, 0x00, 0xC3, 0xFD, 0xA6, 0xFF, 0x19, 0xFD, 0x90, 0xFF,
-        0x9C, 0xFB, 0x07, 0x00, 0xCE, 0xF9, 0x0A, 0x01, 0x90, 0xF8, 0x3A, 0x02,
-        0x51, 0xF8, 0xD7, 0x02, 0xFA, 0xF8, 0x9A, 0x02, 0x61, 0xFA, 0xAC, 0x01,
-        0x39, 0xFC, 0x8E, 0x00, 0x16, 0xFE, 0x71, 0xFF, 0x5A, 0xFF, 0x58, 0xFE,
-        0xCD, 0xFF, 0x58, 0xFD, 0x58, 0xFF, 0x85, 0xFC, 0x58, 0xFE, 0x16, 0xFC,
-        0x99, 0xFD, 0xE6, 0xFB, 0xDF, 0xFD, 0x31, 0xFC, 0x23, 0xFF, 0xB1, 0xFC,
-        0xB9, 0x00, 0x5E, 0xFD, 0xE5, 0x01, 0x3F, 0xFE, 0x48, 0x02, 0x50, 0xFF,
-        0x62, 0x02, 0x20, 0x00, 0x07, 0x03, 0x58, 0x00, 0x72, 0x04, 0xFB, 0xFF,
-        0x2E, 0x06, 0x01, 0xFF, 0x67, 0x07, 0xDC, 0xFD, 0xA0, 0x07, 0x44, 0xFD,
-        0xF6, 0x06, 0x8A, 0xFD, 0x9C, 0x05, 0x79, 0xFE, 0xC4, 0x03, 0x95, 0xFF,
-        0xF1, 0x01, 0xAD, 0x00, 0xAC, 0x00, 0xB6, 0x01, 0x41, 0x00, 0xBF, 0x02,
-        0xC0, 0x00, 0x91, 0x03, 0xBF, 0x01, 0x23, 0x04, 0x75, 0x02, 0x54, 0x04,
-        0x17, 0x02, 0x10, 0x04, 0xC6, 0x00, 0x86, 0x03, 0x23, 0xFF, 0xC8, 0x02,
-        0xEF, 0xFD, 0xD9, 0x01, 0x87, 0xFD, 0xAC, 0x00, 0x6D, 0xFD, 0xC8, 0xFF,
-        0xD8, 0xFC, 0x75, 0xFF, 0x84, 0xFB, 0xC3, 0xFF, 0xDF, 0xF9, 0xBA, 0x00,
-        0xAF, 0xF8, 0xDE, 0x01, 0x71, 0xF8, 0x7E, 0x02, 0x14, 0xF9, 0x40, 0x02,
-        0x5B, 0xFA, 0x65, 0x01, 0x23, 0xFC, 0x56, 0x00, 0xE0, 0xFD, 0x47, 0xFF,
-        0x14, 0xFF, 0x40, 0xFE, 0x6A, 0xFF, 0x3B, 0xFD, 0xEE, 0xFE, 0x6E, 0xFC,
-        0xEB, 0xFD, 0xE0, 0xFB, 0x48, 0xFD, 0xAA, 0xFB, 0xB1, 0xFD, 0xF3, 0xFB,
-        0x1E, 0xFF, 0x87, 0xFC, 0xC7, 0x00, 0x5C, 0xFD, 0x06, 0x02, 0x60, 0xFE,
-        0x60, 0x02, 0x8C, 0xFF, 0x6F, 0x02, 0x6C, 0x00, 0xF5, 0x02, 0xA9, 0x00,
-        0x49, 0x04, 0x62, 0x00, 0xFB, 0x05, 0x5E, 0xFF, 0x37, 0x07, 0x34, 0xFE,
-        0x8B, 0x07, 0x75, 0xFD, 0x09, 0x07, 0xA1, 0xFD, 0xEA, 0x05, 0x7B, 0xFE,
-        0x48, 0x04, 0x97, 0xFF, 0x88, 0x02, 0xB2, 0x00, 0x3F, 0x01, 0xBD, 0x01,
-        0xD1, 0x00, 0xC5, 0x02, 0x3F, 0x01, 0x9B, 0x03, 0x37, 0x02, 0x2A, 0x04,
-        0xCC, 0x02, 0x53, 0x04, 0x50, 0x02, 0x0E, 0x04, 0xEA, 0x00, 0x6D, 0x03,
-        0x4D, 0xFF, 0xAA, 0x02, 0x3B, 0xFE, 0xB7, 0x01, 0xF2, 0xFD, 0xA7, 0x00,
-        0xEE, 0xFD, 0xDB, 0xFF, 0x52, 0xFD, 0x97, 0xFF, 0xF5, 0xFB, 0xE0, 0xFF,
-        0x2E, 0xFA, 0xC8, 0x00, 0xE6, 0xF8, 0xE0, 0x01, 0x72, 0xF8, 0x7A, 0x02,
-        0xE2, 0xF8, 0x3F, 0x02, 0xEE, 0xF9, 0x6B, 0x01, 0x95, 0xFB, 0x58, 0x00,
-        0x5C, 0xFD, 0x4B, 0xFF, 0xB8, 0xFE, 0x42, 0xFE, 0x37, 0xFF, 0x40, 0xFD,
-        0xD0, 0xFE, 0x6E, 0xFC, 0xE6, 0xFD, 0xF0, 0xFB, 0x4E, 0xFD, 0xC2, 0xFB,
-        0xC9, 0xFD, 0xFC, 0xFB, 0x1D, 0xFF, 0x7C, 0xFC, 0xAF, 0x00, 0x33, 0xFD,
-        0xB1, 0x01, 0x0D, 0xFE, 0xF1, 0x01, 0x08, 0xFF, 0xFD, 0x01, 0xB8, 0xFF,
-        0xAB, 0x02, 0xEF, 0xFF, 0x26, 0x04, 0xB1, 0xFF, 0x05, 0x06, 0xE3, 0xFE,
-        0x5E, 0x07, 0xF1, 0xFD, 0xD4, 0x07, 0x72, 0xFD, 0x68, 0x07, 0xC1, 0xFD,
-        0x57, 0x06, 0x97, 0xFE, 0xAD, 0x04, 0xA2, 0xFF, 0xD5, 0x02, 0xA3, 0x00,
-        0x69, 0x01, 0x9C, 0x01, 0xD8, 0x00, 0x99, 0x02, 0x34, 0x01, 0x66, 0x03,
-        0x1B, 0x02, 0xE8, 0x03, 0xAC, 0x02, 0x1F, 0x04, 0x3C, 0x02, 0xF8, 0x03,
-        0xE9, 0x00, 0x98, 0x03, 0x66, 0xFF, 0xF6, 0x02, 0x74, 0xFE, 0x39, 0x02,
-        0x48, 0xFE, 0x52, 0x01, 0x4C, 0xFE, 0xB6, 0x00, 0xA8, 0xFD, 0x87, 0x00,
-        0x2F, 0xFC, 0xBE, 0x00, 0x4F, 0xFA, 0x6E, 0x01, 0xEE, 0xF8, 0x47, 0x02,
-        0x6E, 0xF8, 0x9B, 0x02, 0xCA, 0xF8, 0x3F, 0x02, 0xDD, 0xF9, 0x58, 0x01,
-        0x78, 0xFB, 0x56, 0x00, 0x50, 0xFD, 0x59, 0xFF, 0xB2, 0xFE, 0x69, 0xFE,
-        0x4A, 0xFF, 0x7A, 0xFD, 0xEE, 0xFE, 0xB0, 0xFC, 0x01, 0xFE, 0x29, 0xFC,
-        0x66, 0xFD, 0xE4, 0xFB, 0xBD, 0xFD, 0xF3, 0xFB, 0x09, 0xFF, 0x41, 0xFC,
-        0x6C, 0x00, 0xC5, 0xFC, 0x53, 0x01, 0x69, 0xFD, 0x5F, 0x01, 0x43, 0xFE,
-        0x5B, 0x01, 0xE7, 0xFE, 0xF2, 0x01, 0x2B, 0xFF, 0x6E, 0x03, 0x14, 0xFF,
-        0x56, 0x05, 0x70, 0xFE, 0xD0, 0x06, 0xB9, 0xFD, 0x7A, 0x07, 0x70, 0xFD,
-        0x49, 0x07, 0xE9, 0xFD, 0x56, 0x06, 0xD1, 0xFE, 0xC1, 0x04, 0xD3, 0xFF,
-        0xF5, 0x02, 0xC5, 0x00, 0x92, 0x01, 0xC1, 0x01, 0xFC, 0x00, 0xBD, 0x02,
-        0x50, 0x01, 0x9A, 0x03, 0x26, 0x02, 0x2C, 0x04, 0xC2, 0x02, 0x7D, 0x04,
-        0x70, 0x02, 0x91, 0x04, 0x52, 0x01, 0x61, 0x04, 0xF3, 0xFF, 0x01, 0x04,
-        0x1C, 0xFF, 0x5E, 0x03, 0xEC, 0xFE, 0x79, 0x02, 0xF3, 0xFE, 0xBF, 0x01,
-        0x58, 0xFE, 0x5B, 0x01, 0xEC, 0xFC, 0x6A, 0x01, 0x06, 0xFB, 0xEE, 0x01,
-        0x75, 0xF9, 0x99, 0x02, 0xB4, 0xF8, 0xDB, 0x02, 0xCD, 0xF8, 0x68, 0x02,
-        0xAD, 0xF9, 0x8E, 0x01, 0x38, 0xFB, 0x84, 0x00, 0xE3, 0xFC, 0x6B, 0xFF,
-        0x47, 0xFE, 0x4C, 0xFE, 0xE0, 0xFE, 0x20, 0xFD, 0xB2, 0xFE, 0x27, 0xFC,
-        0xF8, 0xFD, 0x75, 0xFB, 0x6F, 0xFD, 0x13, 0xFB, 0xB7, 0xFD, 0x09, 0xFB,
-        0xCD, 0xFE, 0x4F, 0xFB, 0x0C, 0x00, 0xBD, 0xFB, 0xD8, 0x00, 0x76, 0xFC,
-        0x00, 0x01, 0x5D, 0xFD, 0xFB, 0x00, 0x29, 0xFE, 0x92, 0x01, 0x82, 0xFE,
-        0xFB, 0x02, 0x72, 0xFE, 0xE6, 0x04, 0xE6, 0xFD, 0x8F, 0x06, 0x37, 0xFD,
-        0x72, 0x07, 0xED, 0xFC, 0x83, 0x07, 0x5D, 0xFD, 0xBB, 0x06, 0x46, 0xFE,
-        0x48, 0x05, 0x6E, 0xFF, 0x95, 0x03, 0xB1, 0x00, 0x3D, 0x02, 0xFB, 0x01,
-        0x96, 0x01, 0x4B, 0x03, 0xC1, 0x01, 0x50, 0x04, 0x59, 0x02, 0xF5, 0x04,
-        0xCE, 0x02, 0x44, 0x05, 0x82, 0x02, 0x27, 0x05, 0x75, 0x01, 0xCC, 0x04,
-        0x43, 0x00, 0x33, 0x04, 0x6B, 0xFF, 0x70, 0x03, 0x2D, 0xFF, 0x77, 0x02,
-        0x15, 0xFF, 0xB4, 0x01, 0x6F, 0xFE, 0x5F, 0x01, 0x08, 0xFD, 0x78, 0x01,
-        0x20, 0xFB, 0x07, 0x02, 0x84, 0xF9, 0xB2, 0x02, 0xA1, 0xF8, 0xEF, 0x02,
-        0xA8, 0xF8, 0x82, 0x02, 0x77, 0xF9, 0x7A, 0x01, 0xF8, 0xFA, 0x3B, 0x00,
-        0xA1, 0xFC, 0xD4, 0xFE, 0xF2, 0xFD, 0x7B, 0xFD, 0x85, 0xFE, 0x33, 0xFC,
-        0x4E, 0xFE, 0x33, 0xFB, 0xB5, 0xFD, 0x9B, 0xFA, 0x4E, 0xFD, 0x59, 0xFA,
-        0xA9, 0xFD, 0x89, 0xFA, 0xC0, 0xFE, 0xFC, 0xFA, 0x01, 0x00, 0xB9, 0xFB,
-        0xF1, 0x00, 0x98, 0xFC, 0x39, 0x01, 0xA1, 0xFD, 0x54, 0x01, 0x62, 0xFE,
-        0xD6, 0x01, 0xB3, 0xFE, 0x1D, 0x03, 0x9D, 0xFE, 0xDF, 0x04, 0x1C, 0xFE,
-        0x59, 0x06, 0x8B, 0xFD, 0x29, 0x07, 0x55, 0xFD, 0x1A, 0x07, 0xD7, 0xFD,
-        0x49, 0x06, 0xDD, 0xFE, 0xD2, 0x04, 0x34, 0x00, 0x33, 0x03, 0xAB, 0x01,
-        0xEC, 0x01, 0x05, 0x03, 0x64, 0x01, 0x31, 0x04, 0xA6, 0x01, 0x14, 0x05,
-        0x53, 0x02, 0x99, 0x05, 0xD4, 0x02, 0xDA, 0x05, 0x91, 0x02, 0xAC, 0x05,
-        0x79, 0x01, 0x26, 0x05, 0x27, 0x00, 0x55, 0x04, 0x15, 0xFF, 0x56, 0x03,
-        0xA2, 0xFE, 0x4A, 0x02, 0x76, 0xFE, 0x77, 0x01, 0xD9, 0xFD, 0x16, 0x01,
-        0x92, 0xFC, 0x0D, 0x01, 0xD3, 0xFA, 0x78, 0x01, 0x6A, 0xF9, 0x11, 0x02,
-        0xB1, 0xF8, 0x5B, 0x02, 0xC3, 0xF8, 0xF3, 0x01, 0x8D, 0xF9, 0xF2, 0x00,
-        0xF6, 0xFA, 0x98, 0xFF, 0x91, 0xFC, 0x25, 0xFE, 0xD5, 0xFD, 0xDA, 0xFC,
-        0x5B, 0xFE, 0xCA, 0xFB, 0x13, 0xFE, 0xFF, 0xFA, 0x5D, 0xFD, 0x7A, 0xFA,
-        0xDC, 0xFC, 0x34, 0xFA, 0x29, 0xFD, 0x55, 0xFA, 0x4F, 0xFE, 0xD6, 0xFA,
-        0xBE, 0xFF, 0xAE, 0xFB, 0xF3, 0x00, 0xA0, 0xFC, 0x89, 0x01, 0xBB, 0xFD,
-        0xD2, 0x01, 0x86, 0xFE, 0x6F, 0x02, 0x02, 0xFF, 0xB3, 0x03, 0x12, 0xFF,
-        0x55, 0x05, 0xC3, 0xFE, 0xB1, 0x06, 0x43, 0xFE, 0x55, 0x07, 0x11, 0xFE,
-        0x3B, 0x07, 0x8A, 0xFE, 0x6A, 0x06, 0x88, 0xFF, 0x02, 0x05, 0xEA, 0x00,
-        0x6F, 0x03, 0x4D, 0x02, 0x2D, 0x02, 0x90, 0x03, 0x9C, 0x01, 0x84, 0x04,
-        0xCD, 0x01, 0x3F, 0x05, 0x6C, 0x02, 0xB2, 0x05, 0xDF, 0x02, 0xEC, 0x05,
-        0x85, 0x02, 0xBA, 0x05, 0x61, 0x01, 0x22, 0x05, 0xE3, 0xFF, 0x32, 0x04,
-        0xAC, 0xFE, 0x26, 0x03, 0x0F, 0xFE, 0x05, 0x02, 0xD1, 0xFD, 0x21, 0x01,
-        0x4E, 0xFD, 0x96, 0x00, 0x2A, 0xFC, 0x5D, 0x00, 0xA3, 0xFA, 0x95, 0x00,
-        0x61, 0xF9, 0x0B, 0x01, 0xD0, 0xF8, 0x3B, 0x01, 0xEB, 0xF8, 0xDD, 0x00,
-        0xC5, 0xF9, 0xF3, 0xFF, 0x17, 0xFB, 0xB8, 0xFE, 0x9F, 0xFC, 0x64, 0xFD,
-        0xD1, 0xFD, 0x3D, 0xFC, 0x66, 0xFE, 0x59, 0xFB, 0x42, 0xFE, 0xB9, 0xFA,
-        0xB6, 0xFD, 0x4F, 0xFA, 0x44, 0xFD, 0x22, 0xFA, 0xA0, 0xFD, 0x68, 0xFA,
-        0xBD, 0xFE, 0x17, 0xFB, 0x26, 0x00, 0x0A, 0xFC, 0x43, 0x01, 0x13, 0xFD,
-        0xC6, 0x01, 0x23, 0xFE, 0xEB, 0x01, 0x00, 0xFF, 0x4E, 0x02, 0x7F, 0xFF,
-        0x5B, 0x03, 0xB0, 0xFF, 0xD8, 0x04, 0x72, 0xFF, 0x2D, 0x06, 0xF9, 0xFE,
-        0xD9, 0x06, 0xC1, 0xFE, 0xC5, 0x06, 0x1C, 0xFF, 0xFF, 0x05, 0x05, 0x00,
-        0x9D, 0x04, 0x3A, 0x01, 0x09, 0x03, 0x78, 0x02, 0xBC, 0x01, 0x93, 0x03,
-        0x1A, 0x01, 0x7F, 0x04, 0x35, 0x01, 0x3F, 0x05, 0xC2, 0x01, 0xC0, 0x05,
-        0x2F, 0x02, 0xFA, 0x05, 0xEC, 0x01, 0xA8, 0x05, 0xE0, 0x00, 0xE0, 0x04,
-        0x97, 0xFF, 0xE3, 0x03, 0x8A, 0xFE, 0xDD, 0x02, 0x0F, 0xFE, 0xE2, 0x01,
-        0xF4, 0xFD, 0x1A, 0x01, 0xA4, 0xFD, 0xAD, 0x00, 0xB0, 0xFC, 0x87, 0x00,
-        0x3C, 0xFB, 0xDD, 0x00, 0xDF, 0xF9, 0x52, 0x01, 0x1A, 0xF9, 0x81, 0x01,
-        0x1D, 0xF9, 0x11, 0x01, 0xE1, 0xF9, 0x16, 0x00, 0x40, 0xFB, 0xC9, 0xFE,
-        0xE0, 0xFC, 0x75, 0xFD, 0x41, 0xFE, 0x3F, 0xFC, 0xFA, 0xFE, 0x34, 0xFB,
-        0x02, 0xFF, 0x61, 0xFA, 0x97, 0xFE, 0xD4, 0xF9, 0x3A, 0xFE, 0xAE, 0xF9,
-        0x79, 0xFE, 0x16, 0xFA, 0x63, 0xFF, 0xED, 0xFA, 0x78, 0x00, 0xE7, 0xFB,
-        0x50, 0x01, 0xD6, 0xFC, 0xA1, 0x01, 0xBF, 0xFD, 0x89, 0x01, 0x5F, 0xFE,
-        0xB2, 0x01, 0xBA, 0xFE, 0x88, 0x02, 0xCA, 0xFE, 0x07, 0x04, 0x7D, 0xFE,
-        0x78, 0x05, 0x01, 0xFE, 0x5E, 0x06, 0xE5, 0xFD, 0x7B, 0x06, 0x5B, 0xFE,
-        0xD4, 0x05, 0x7B, 0xFF, 0x86, 0x04, 0xD2, 0x00, 0xE1, 0x02, 0x3B, 0x02,
-        0x74, 0x01, 0x6D, 0x03, 0xAC, 0x00, 0x7D, 0x04, 0x96, 0x00, 0x51, 0x05,
-        0xFF, 0x00, 0xE9, 0x05, 0x74, 0x01, 0x22, 0x06, 0x5D, 0x01, 0xC1, 0x05,
-        0xA6, 0x00, 0xEB, 0x04, 0xB8, 0xFF, 0xEE, 0x03, 0x02, 0xFF, 0x05, 0x03,
-        0xB8, 0xFE, 0x2C, 0x02, 0xCE, 0xFE, 0x9E, 0x01, 0x92, 0xFE, 0x46, 0x01,
-        0xA9, 0xFD, 0x30, 0x01, 0x0D, 0xFC, 0x72, 0x01, 0x87, 0xFA, 0xDB, 0x01,
-        0x92, 0xF9, 0xF2, 0x01, 0x6B, 0xF9, 0x6B, 0x01, 0x0B, 0xFA, 0x47, 0x00,
-        0x57, 0xFB, 0xE8, 0xFE, 0xFA, 0xFC, 0x76, 0xFD, 0x60, 0xFE, 0x42, 0xFC,
-        0x1A, 0xFF, 0x24, 0xFB, 0x19, 0xFF, 0x4D, 0xFA, 0x9B, 0xFE, 0xAE, 0xF9,
-        0x1B, 0xFE, 0x7E, 0xF9, 0x20, 0xFE, 0xE9, 0xF9, 0xD8, 0xFE, 0xD3, 0xFA,
-        0xC2, 0xFF, 0xD8, 0xFB, 0x8F, 0x00, 0xD4, 0xFC, 0xE2, 0x00, 0xB3, 0xFD,
-        0xE4, 0x00, 0x66, 0xFE, 0x28, 0x01, 0xD3, 0xFE, 0x2A, 0x02, 0x0A, 0xFF,
-        0xC7, 0x03, 0xD7, 0xFE, 0x5D, 0x05, 0x77, 0xFE, 0x4C, 0x06, 0x64, 0xFE,
-        0x73, 0x06, 0xE3, 0xFE, 0xC1, 0x05, 0x04, 0x00, 0x65, 0x04, 0x64, 0x01,
-        0xC3, 0x02, 0xE2, 0x02, 0x62, 0x01, 0x27, 0x04, 0xB5, 0x00, 0x46, 0x05,
-        0xB9, 0x00, 0x1A, 0x06, 0x40, 0x01, 0xA4, 0x06, 0xCD, 0x01, 0xC6, 0x06,
-        0xD3, 0x01, 0x41, 0x06, 0x30, 0x01, 0x41, 0x05, 0x49, 0x00, 0x12, 0x04,
-        0x83, 0xFF, 0xE7, 0x02, 0x32, 0xFF, 0xDD, 0x01, 0x36, 0xFF, 0x14, 0x01,
-        0xEE, 0xFE, 0xA7, 0x00, 0xE5, 0xFD, 0x7B, 0x00, 0x29, 0xFC, 0xB9, 0x00,
-        0x7E, 0xFA, 0x19, 0x01, 0x79, 0xF9, 0x2B, 0x01, 0x38, 0xF9, 0xA8, 0x00,
-        0xE0, 0xF9, 0x90, 0xFF, 0x2D, 0xFB, 0x36, 0xFE, 0xE1, 0xFC, 0xCB, 0xFC,
-        0x53, 0xFE, 0x8F, 0xFB, 0x2C, 0xFF, 0x85, 0xFA, 0x47, 0xFF, 0xCE, 0xF9,
-        0xE5, 0xFE, 0x58, 0xF9, 0x6C, 0xFE, 0x5D, 0xF9, 0x6F, 0xFE, 0xFD, 0xF9,
-        0x0E, 0xFF, 0x1F, 0xFB, 0xE9, 0xFF, 0x64, 0xFC, 0xA9, 0x00, 0x96, 0xFD,
-        0xF0, 0x00, 0xAB, 0xFE, 0xF5, 0x00, 0x67, 0xFF, 0x43, 0x01, 0xD1, 0xFF,
-        0x58, 0x02, 0xE5, 0xFF, 0x1C, 0x04, 0xA4, 0xFF, 0xDB, 0x05, 0x4B, 0xFF,
-        0xFD, 0x06, 0x38, 0xFF, 0x47, 0x07, 0xC8, 0xFF, 0xB0, 0x06, 0xD6, 0x00,
-        0x51, 0x05, 0x2E, 0x02, 0x9C, 0x03, 0x82, 0x03, 0x0B, 0x02, 0xB2, 0x04,
-        0x24, 0x01, 0x9B, 0x05, 0xE7, 0x00, 0x44, 0x06, 0x35, 0x01, 0x95, 0x06,
-        0x88, 0x01, 0x7D, 0x06, 0x71, 0x01, 0xDA, 0x05, 0xBE, 0x00, 0xBF, 0x04,
-        0xD4, 0xFF, 0x8B, 0x03, 0x0F, 0xFF, 0x58, 0x02, 0xBD, 0xFE, 0x4B, 0x01,
-        0xBF, 0xFE, 0x8C, 0x00, 0x7D, 0xFE, 0x37, 0x00, 0x7C, 0xFD, 0x3C, 0x00,
-        0xCB, 0xFB, 0x95, 0x00, 0x1A, 0xFA, 0xFA, 0x00, 0xF6, 0xF8, 0xF6, 0x00,
-        0xA7, 0xF8, 0x52, 0x00, 0x35, 0xF9, 0x33, 0xFF, 0x82, 0xFA, 0xDB, 0xFD,
-        0x2C, 0xFC, 0x8F, 0xFC, 0xB3, 0xFD, 0x6F, 0xFB, 0xA1, 0xFE, 0xA0, 0xFA,
-        0xED, 0xFE, 0x10, 0xFA, 0xC1, 0xFE, 0xD0, 0xF9, 0x8E, 0xFE, 0xE6, 0xF9,
-        0xD1, 0xFE, 0x91, 0xFA, 0x95, 0xFF, 0xA5, 0xFB, 0x85, 0x00, 0xE1, 0xFC,
-        0x46, 0x01, 0x24, 0xFE, 0x93, 0x01, 0x43, 0xFF, 0x93, 0x01, 0xFD, 0xFF,
-        0xD1, 0x01, 0x4A, 0x00, 0xDA, 0x02, 0x39, 0x00, 0x9B, 0x04, 0xEC, 0xFF,
-        0x68, 0x06, 0x95, 0xFF, 0x99, 0x07, 0xA4, 0xFF, 0x03, 0x08, 0x4D, 0x00,
-        0x81, 0x07, 0x77, 0x01, 0x3F, 0x06, 0xCF, 0x02, 0x87, 0x04, 0x19, 0x04,
-        0xE4, 0x02, 0x21, 0x05, 0xD1, 0x01, 0xDF, 0x05, 0x65, 0x01, 0x50, 0x06,
-        0x7A, 0x01, 0x7C, 0x06, 0xA5, 0x01, 0x49, 0x06, 0x6C, 0x01, 0x93, 0x05,
-        0xBD, 0x00, 0x6E, 0x04, 0xE1, 0xFF, 0x2F, 0x03, 0x34, 0xFF, 0xE4, 0x01,
-        0xF4, 0xFE, 0xC4, 0x00, 0xEB, 0xFE, 0xFC, 0xFF, 0x9F, 0xFE, 0xAF, 0xFF,
-        0x79, 0xFD, 0xB1, 0xFF, 0xA2, 0xFB, 0x0C, 0x00, 0xBE, 0xF9, 0x68, 0x00,
-        0x83, 0xF8, 0x67, 0x00, 0x11, 0xF8, 0xBC, 0xFF, 0x91, 0xF8, 0x8D, 0xFE,
-        0xDA, 0xF9, 0x39, 0xFD, 0xA4, 0xFB, 0xF4, 0xFB, 0x63, 0xFD, 0xFA, 0xFA,
-        0x90, 0xFE, 0x45, 0xFA, 0x12, 0xFF, 0xEA, 0xF9, 0x00, 0xFF, 0xD1, 0xF9,
-        0xDB, 0xFE, 0x1D, 0xFA, 0x06, 0xFF, 0xD3, 0xFA, 0xB0, 0xFF, 0xED, 0xFB,
-        0x7E, 0x00, 0x1F, 0xFD, 0x26, 0x01, 0x6A, 0xFE, 0x5B, 0x01, 0x9D, 0xFF,
-        0x53, 0x01, 0x69, 0x00, 0x99, 0x01, 0xBF, 0x00, 0xBE, 0x02, 0xB2, 0x00,
-        0xA7, 0x04, 0x54, 0x00, 0x96, 0x06, 0xF0, 0xFF, 0xE4, 0x07, 0xE7, 0xFF,
-        0x58, 0x08, 0x78, 0x00, 0xE8, 0x07, 0x83, 0x01, 0xA2, 0x06, 0xAA, 0x02,
-        0xDA, 0x04, 0xC4, 0x03, 0x17, 0x03, 0xB1, 0x04, 0xCD, 0x01, 0x5D, 0x05,
-        0x35, 0x01, 0xB7, 0x05, 0x2F, 0x01, 0xC3, 0x05, 0x58, 0x01, 0x8A, 0x05,
-        0x2E, 0x01, 0xDF, 0x04, 0x90, 0x00, 0xEE, 0x03, 0xC3, 0xFF, 0xC9, 0x02,
-        0x1F, 0xFF, 0x86, 0x01, 0xED, 0xFE, 0x4C, 0x00, 0xF4, 0xFE, 0x6D, 0xFF,
-        0x9E, 0xFE, 0x06, 0xFF, 0x5F, 0xFD, 0x18, 0xFF, 0x59, 0xFB, 0x75, 0xFF,
-        0x50, 0xF9, 0xF4, 0xFF, 0x08, 0xF8, 0x15, 0x00, 0x93, 0xF7, 0xB0, 0xFF,
-        0x15, 0xF8, 0xD8, 0xFE, 0x61, 0xF9, 0xD4, 0xFD, 0x34, 0xFB, 0xC5, 0xFC,
-        0x03, 0xFD, 0xD5, 0xFB, 0x5F, 0xFE, 0x16, 0xFB, 0x00, 0xFF, 0xB3, 0xFA,
-        0x12, 0xFF, 0x8E, 0xFA, 0xD7, 0xFE, 0xB6, 0xFA, 0xF4, 0xFE, 0x3E, 0xFB,
-        0x83, 0xFF, 0x09, 0xFC, 0x5E, 0x00, 0x12, 0xFD, 0x17, 0x01, 0x3F, 0xFE,
-        0x6C, 0x01, 0x86, 0xFF, 0x77, 0x01, 0x76, 0x00, 0xEF, 0x01, 0xF9, 0x00,
-        0x3D, 0x03, 0xF9, 0x00, 0x58, 0x05, 0x9E, 0x00, 0x5E, 0x07, 0x1A, 0x00,
-        0xA4, 0x08, 0xD9, 0xFF, 0x01, 0x09, 0x20, 0x00, 0x68, 0x08, 0xD8, 0x00,
-        0xFA, 0x06, 0xC1, 0x01, 0x0F, 0x05, 0xB7, 0x02, 0x22, 0x03, 0x9F, 0x03,
-        0xAF, 0x01, 0x60, 0x04, 0xF3, 0x00, 0xDD, 0x04, 0xE1, 0x00, 0x19, 0x05,
-        0x22, 0x01, 0x08, 0x05, 0x13, 0x01, 0xAB, 0x04, 0x8C, 0x00, 0xF6, 0x03,
-        0xAE, 0xFF, 0x00, 0x03, 0xE5, 0xFE, 0xBC, 0x01, 0x81, 0xFE, 0x54, 0x00,
-        0x69, 0xFE, 0x2A, 0xFF, 0xF0, 0xFD, 0x71, 0xFE, 0x9C, 0xFC, 0x3F, 0xFE,
-        0x82, 0xFA, 0x83, 0xFE, 0x7C, 0xF8, 0x04, 0xFF, 0x3B, 0xF7, 0x59, 0xFF,
-        0xE0, 0xF6, 0x2E, 0xFF, 0x7D, 0xF7, 0x9C, 0xFE, 0xEB, 0xF8, 0xD0, 0xFD,
-        0xCD, 0xFA, 0xF6, 0xFC, 0xB2, 0xFC, 0x2B, 0xFC, 0x25, 0xFE, 0x73, 0xFB,
-        0xE3, 0xFE, 0xF6, 0xFA, 0x00, 0xFF, 0xAC, 0xFA, 0xC0, 0xFE, 0x9A, 0xFA,
-        0xD8, 0xFE, 0xE3, 0xFA, 0x60, 0xFF, 0x92, 0xFB, 0x38, 0x00, 0x99, 0xFC,
-        0xF7, 0x00, 0xFD, 0xFD, 0x4B, 0x01, 0x87, 0xFF, 0x4E, 0x01, 0xE9, 0x00,
-        0xB5, 0x01, 0xDE, 0x01, 0xFB, 0x02, 0x53, 0x02, 0x0E, 0x05, 0x2E, 0x02,
-        0x06, 0x07, 0xAE, 0x01, 0x46, 0x08, 0x47, 0x01, 0xAB, 0x08, 0x53, 0x01,
-        0x24, 0x08, 0xD0, 0x01, 0xD6, 0x06, 0x88, 0x02, 0x08, 0x05, 0x41, 0x03,
-        0x41, 0x03, 0x0D, 0x04, 0xDF, 0x01, 0xC2, 0x04, 0x2B, 0x01, 0x53, 0x05,
-        0x1D, 0x01, 0xB6, 0x05, 0x4A, 0x01, 0xD6, 0x05, 0x2C, 0x01, 0x9B, 0x05,
-        0x81, 0x00, 0xDF, 0x04, 0x91, 0xFF, 0xC3, 0x03, 0xAE, 0xFE, 0x4E, 0x02,
-        0x43, 0xFE, 0xAB, 0x00, 0x2C, 0xFE, 0x32, 0xFF, 0xBC, 0xFD, 0x21, 0xFE,
-        0x80, 0xFC, 0xA9, 0xFD, 0x8E, 0xFA, 0xDC, 0xFD, 0xC1, 0xF8, 0x65, 0xFE,
-        0xA8, 0xF7, 0xD0, 0xFE, 0x56, 0xF7, 0xB0, 0xFE, 0xE3, 0xF7, 0x20, 0xFE,
-        0x2F, 0xF9, 0x4A, 0xFD, 0xF1, 0xFA, 0x6D, 0xFC, 0xA7, 0xFC, 0x92, 0xFB,
-        0xF7, 0xFD, 0xCE, 0xFA, 0x9C, 0xFE, 0x42, 0xFA, 0xA4, 0xFE, 0xDD, 0xF9,
-        0x7D, 0xFE, 0xB7, 0xF9, 0xBA, 0xFE, 0xEC, 0xF9, 0x83, 0xFF, 0xA0, 0xFA,
-        0x9C, 0x00, 0xBC, 0xFB, 0x94, 0x01, 0x32, 0xFD, 0x09, 0x02, 0xDB, 0xFE,
-        0x1D, 0x02, 0x54, 0x00, 0x74, 0x02, 0x61, 0x01, 0x9D, 0x03, 0xD2, 0x01,
-        0x68, 0x05, 0xB2, 0x01, 0x19, 0x07, 0x4D, 0x01, 0x19, 0x08, 0x16, 0x01,
-        0x56, 0x08, 0x5C, 0x01, 0xC7, 0x07, 0x17, 0x02, 0x6F, 0x06, 0xFB, 0x02,
-        0xB5, 0x04, 0xEC, 0x03, 0x02, 0x03, 0xBF, 0x04, 0xBD, 0x01, 0x7C, 0x05,
-        0x22, 0x01, 0xFC, 0x05, 0x22, 0x01, 0x47, 0x06, 0x48, 0x01, 0x6C, 0x06,
-        0x0E, 0x01, 0x2A, 0x06, 0x35, 0x00, 0x80, 0x05, 0x16, 0xFF, 0x67, 0x04,
-        0x1D, 0xFE, 0xF0, 0x02, 0xAC, 0xFD, 0x67, 0x01, 0xA9, 0xFD, 0x00, 0x00,
-        0x5E, 0xFD, 0x17, 0xFF, 0x4D, 0xFC, 0xA2, 0xFE, 0x90, 0xFA, 0xBD, 0xFE,
-        0xF5, 0xF8, 0x04, 0xFF, 0x02, 0xF8, 0x2F, 0xFF, 0xC6, 0xF7, 0xD5, 0xFE,
-        0x4A, 0xF8, 0x1E, 0xFE, 0x87, 0xF9, 0x2F, 0xFD, 0x26, 0xFB, 0x4A, 0xFC,
-        0xC8, 0xFC, 0x7E, 0xFB, 0x06, 0xFE, 0xD6, 0xFA, 0xAF, 0xFE, 0x66, 0xFA,
-        0xD4, 0xFE, 0x23, 0xFA, 0xC4, 0xFE, 0x08, 0xFA, 0x21, 0xFF, 0x31, 0xFA,
-        0x01, 0x00, 0xCE, 0xFA, 0x23, 0x01, 0xCA, 0xFB, 0x09, 0x02, 0x2C, 0xFD,
-        0x52, 0x02, 0xAD, 0xFE, 0x30, 0x02, 0xFE, 0xFF, 0x57, 0x02, 0xE6, 0x00,
-        0x47, 0x03, 0x43, 0x01, 0xEF, 0x04, 0x29, 0x01, 0x7C, 0x06, 0xC5, 0x00,
-        0x72, 0x07, 0x9E, 0x00, 0xBB, 0x07, 0xE1, 0x00, 0x42, 0x07, 0x96, 0x01,
-        0x15, 0x06, 0x71, 0x02, 0x79, 0x04, 0x49, 0x03, 0xD8, 0x02, 0x0D, 0x04,
-        0x98, 0x01, 0xBD, 0x04, 0xE4, 0x00, 0x2A, 0x05, 0xC5, 0x00, 0x79, 0x05,
-        0xD6, 0x00, 0x93, 0x05, 0x8D, 0x00, 0x70, 0x05, 0xC0, 0xFF, 0xCF, 0x04,
-        0xBB, 0xFE, 0xCD, 0x03, 0xF3, 0xFD, 0x65, 0x02, 0xC5, 0xFD, 0xF9, 0x00,
-        0xFE, 0xFD, 0xB9, 0xFF, 0xED, 0xFD, 0xEB, 0xFE, 0x0C, 0xFD, 0x9E, 0xFE,
-        0x6B, 0xFB, 0xC8, 0xFE, 0xE6, 0xF9, 0x2D, 0xFF, 0xF3, 0xF8, 0x5F, 0xFF,
-        0xB6, 0xF8, 0x14, 0xFF, 0x31, 0xF9, 0x77, 0xFE, 0x65, 0xFA, 0x9E, 0xFD,
-        0xF9, 0xFB, 0xD0, 0xFC, 0x8B, 0xFD, 0x0C, 0xFC, 0xB6, 0xFE, 0x63, 0xFB,
-        0x51, 0xFF, 0xEC, 0xFA, 0x5C, 0xFF, 0xA5, 0xFA, 0x3D, 0xFF, 0x84, 0xFA,
-        0x79, 0xFF, 0xC0, 0xFA, 0x3C, 0x00, 0x60, 0xFB, 0x3F, 0x01, 0x66, 0xFC,
-        0x04, 0x02, 0xAF, 0xFD, 0x35, 0x02, 0x13, 0xFF, 0x03, 0x02, 0x41, 0x00,
-        0x12, 0x02, 0x05, 0x01, 0x02, 0x03, 0x45, 0x01, 0xA1, 0x04, 0x0F, 0x01,
-        0x2A, 0x06, 0x95, 0x00, 0x18, 0x07, 0x5F, 0x00, 0x51, 0x07, 0x95, 0x00,
-        0xCC, 0x06, 0x3F, 0x01, 0x9E, 0x05, 0x10, 0x02, 0x00, 0x04, 0xE6, 0x02,
-        0x78, 0x02, 0xAC, 0x03, 0x45, 0x01, 0x59, 0x04, 0xA6, 0x00, 0xCF, 0x04,
-        0x84, 0x00, 0x18, 0x05, 0x8A, 0x00, 0x2D, 0x05, 0x45, 0x00, 0x00, 0x05,
-        0x75, 0xFF, 0x6C, 0x04, 0x76, 0xFE, 0x7E, 0x03, 0xB1, 0xFD, 0x44, 0x02,
-        0x8D, 0xFD, 0xEC, 0x00, 0xCF, 0xFD, 0xC8, 0xFF, 0xD0, 0xFD, 0x1A, 0xFF,
-        0xEF, 0xFC, 0xE4, 0xFE, 0x6E, 0xFB, 0x33, 0xFF, 0xFB, 0xF9, 0xB0, 0xFF,
-        0x1B, 0xF9, 0xF0, 0xFF, 0xE9, 0xF8, 0xAE, 0xFF, 0x62, 0xF9, 0xF1, 0xFE,
-        0x93, 0xFA, 0x0F, 0xFE, 0x18, 0xFC, 0x1D, 0xFD, 0xA8, 0xFD, 0x4F, 0xFC,
-        0xCE, 0xFE, 0x9B, 0xFB, 0x81, 0xFF, 0x27, 0xFB, 0xAC, 0xFF, 0xE9, 0xFA,
-        0xB3, 0xFF, 0xCD, 0xFA, 0xFC, 0xFF, 0xF6, 0xFA, 0xC8, 0x00, 0x77, 0xFB,
-        0xC9, 0x01, 0x4E, 0xFC, 0x84, 0x02, 0x7F, 0xFD, 0xA4, 0x02, 0xC3, 0xFE,
-        0x4E, 0x02, 0xD5, 0xFF, 0x46, 0x02, 0x74, 0x00, 0x07, 0x03, 0x9D, 0x00,
-        0x73, 0x04, 0x55, 0x00, 0xC6, 0x05, 0xD6, 0xFF, 0x87, 0x06, 0x9E, 0xFF,
-        0xB0, 0x06, 0xED, 0xFF, 0x22, 0x06, 0xBB, 0x00, 0x09, 0x05, 0xB8, 0x01,
-        0x8C, 0x03, 0xB4, 0x02, 0x2C, 0x02, 0x8E, 0x03, 0x24, 0x01, 0x40, 0x04,
-        0x9B, 0x00, 0xA3, 0x04, 0x82, 0x00, 0xD6, 0x04, 0x80, 0x00, 0xE2, 0x04,
-        0x30, 0x00, 0xC4, 0x04, 0x4B, 0xFF, 0x47, 0x04, 0x2C, 0xFE, 0x88, 0x03,
-        0x56, 0xFD, 0x6E, 0x02, 0x23, 0xFD, 0x40, 0x01, 0x60, 0xFD, 0x3C, 0x00,
-        0x61, 0xFD, 0x9A, 0xFF, 0x97, 0xFC, 0x68, 0xFF, 0x3F, 0xFB, 0xAF, 0xFF,
-        0x06, 0xFA, 0x2C, 0x00, 0x66, 0xF9, 0x64, 0x00, 0x64, 0xF9, 0x0F, 0x00,
-        0x03, 0xFA, 0x34, 0xFF, 0x30, 0xFB, 0x2E, 0xFE, 0x9E, 0xFC, 0x27, 0xFD,
-        0xFA, 0xFD, 0x47, 0xFC, 0xE7, 0xFE, 0xA0, 0xFB, 0x61, 0xFF, 0x4A, 0xFB,
-        0x7D, 0xFF, 0x26, 0xFB, 0x77, 0xFF, 0x27, 0xFB, 0xD6, 0xFF, 0x4E, 0xFB,
-        0xBE, 0x00, 0xCC, 0xFB, 0xE7, 0x01, 0x7D, 0xFC, 0xCA, 0x02, 0x91, 0xFD,
-        0xFC, 0x02, 0xBA, 0xFE, 0xDA, 0x02, 0xC3, 0xFF, 0xE3, 0x02, 0x64, 0x00,
-        0xBD, 0x03, 0x9A, 0x00, 0x0E, 0x05, 0x51, 0x00, 0x36, 0x06, 0xE1, 0xFF,
-        0xB9, 0x06, 0x9E, 0xFF, 0x93, 0x06, 0xFF, 0xFF, 0xCD, 0x05, 0xC7, 0x00,
-        0x8C, 0x04, 0xD3, 0x01, 0x16, 0x03, 0xD2, 0x02, 0xCB, 0x01, 0xB1, 0x03,
-        0xEB, 0x00, 0x50, 0x04, 0x88, 0x00, 0xA6, 0x04, 0x88, 0x00, 0xC6, 0x04,
-        0xA7, 0x00, 0xD6, 0x04, 0x5B, 0x00, 0xA4, 0x04, 0x71, 0xFF, 0x27, 0x04,
-        0x3B, 0xFE, 0x57, 0x03, 0x48, 0xFD, 0x42, 0x02, 0xFB, 0xFC, 0x18, 0x01,
-        0x16, 0xFD, 0x1F, 0x00, 0x00, 0xFD, 0x91, 0xFF, 0x43, 0xFC, 0x65, 0xFF,
-        0x0B, 0xFB, 0xB5, 0xFF, 0x06, 0xFA, 0x2F, 0x00, 0xAD, 0xF9, 0x75, 0x00,
-        0xE5, 0xF9, 0x27, 0x00, 0xBC, 0xFA, 0x5D, 0xFF, 0xE7, 0xFB, 0x5D, 0xFE,
-        0x46, 0xFD, 0x5C, 0xFD, 0x6A, 0xFE, 0x7F, 0xFC, 0x2C, 0xFF, 0xDB, 0xFB,
-        0x6F, 0xFF, 0x83, 0xFB, 0x62, 0xFF, 0x5D, 0xFB, 0x51, 0xFF, 0x5F, 0xFB,
-        0xBD, 0xFF, 0xAF, 0xFB, 0xD6, 0x00, 0x4E, 0xFC, 0x2B, 0x02, 0x2E, 0xFD,
-        0x2D, 0x03, 0x44, 0xFE, 0x69, 0x03, 0x52, 0xFF, 0x26, 0x03, 0x2A, 0x00,
-        0x0A, 0x03, 0x94, 0x00, 0x9F, 0x03, 0x9D, 0x00, 0xBD, 0x04, 0x40, 0x00,
-        0xB0, 0x05, 0xAA, 0xFF, 0x11, 0x06, 0x4C, 0xFF, 0xD7, 0x05, 0x88, 0xFF,
-        0x28, 0x05, 0x42, 0x00, 0x0F, 0x04, 0x49, 0x01, 0xDA, 0x02, 0x4C, 0x02,
-        0xC5, 0x01, 0x33, 0x03, 0x0F, 0x01, 0xE4, 0x03, 0xBE, 0x00, 0x4F, 0x04,
-        0xA9, 0x00, 0x86, 0x04, 0x94, 0x00, 0x97, 0x04, 0x02, 0x00, 0x59, 0x04,
-        0xE7, 0xFE, 0xB9, 0x03, 0x91, 0xFD, 0xDD, 0x02, 0xB0, 0xFC, 0xC5, 0x01,
-        0x85, 0xFC, 0xB1, 0x00, 0xDF, 0xFC, 0xE8, 0xFF, 0xFE, 0xFC, 0x7F, 0xFF,
-        0x68, 0xFC, 0x86, 0xFF, 0x41, 0xFB, 0xEB, 0xFF, 0x3B, 0xFA, 0x7F, 0x00,
-        0xC4, 0xF9, 0xD0, 0x00, 0xDC, 0xF9, 0x8A, 0x00, 0x6F, 0xFA, 0xC4, 0xFF,
-        0x6D, 0xFB, 0xD0, 0xFE, 0x91, 0xFC, 0xE5, 0xFD, 0xA4, 0xFD, 0x28, 0xFD,
-        0x5B, 0xFE, 0x88, 0xFC, 0xBE, 0xFE, 0x27, 0xFC, 0xE0, 0xFE, 0xE4, 0xFB,
-        0x0B, 0xFF, 0xD2, 0xFB, 0xA8, 0xFF, 0x15, 0xFC, 0xD9, 0x00, 0xB0, 0xFC,
-        0x36, 0x02, 0x96, 0xFD, 0x27, 0x03, 0xB3, 0xFE, 0x46, 0x03, 0xCD, 0xFF,
-        0xE6, 0x02, 0xA6, 0x00, 0xB0, 0x02, 0x17, 0x01, 0x42, 0x03, 0x2A, 0x01,
-        0x6C, 0x04, 0xD5, 0x00, 0x8E, 0x05, 0x46, 0x00, 0x1F, 0x06, 0xE6, 0xFF,
-        0x33, 0x06, 0x0D, 0x00, 0xB7, 0x05, 0x9F, 0x00, 0xD5, 0x04, 0x6F, 0x01,
-        0xAE, 0x03, 0x37, 0x02, 0xA4, 0x02, 0xFE, 0x02, 0xDD, 0x01, 0x9E, 0x03,
-        0x6D, 0x01, 0x14, 0x04, 0x2B, 0x01, 0x4E, 0x04, 0xDA, 0x00, 0x61, 0x04,
-        0x23, 0x00, 0x15, 0x04, 0xE3, 0xFE, 0x7C, 0x03, 0x93, 0xFD, 0x85, 0x02,
-        0xC2, 0xFC, 0x57, 0x01, 0xD3, 0xFC, 0x0E, 0x00, 0x57, 0xFD, 0x19, 0xFF,
-        0xA5, 0xFD, 0x84, 0xFE, 0x17, 0xFD, 0x72, 0xFE, 0xED, 0xFB, 0xD9, 0xFE,
-        0xC2, 0xFA, 0x7E, 0xFF, 0x21, 0xFA, 0xF5, 0xFF, 0xF3, 0xF9, 0xDB, 0xFF,
-        0x5F, 0xFA, 0x46, 0xFF, 0x38, 0xFB, 0x6B, 0xFE, 0x53, 0xFC, 0x86, 0xFD,
-        0x58, 0xFD, 0xB0, 0xFC, 0x13, 0xFE, 0x06, 0xFC, 0x8B, 0xFE, 0x96, 0xFB,
-        0xDA, 0xFE, 0x5E, 0xFB, 0x3C, 0xFF, 0x52, 0xFB, 0xFA, 0xFF, 0x98, 0xFB,
-        0x36, 0x01, 0x4A, 0xFC, 0x75, 0x02, 0x4A, 0xFD, 0x2A, 0x03, 0x9C, 0xFE,
-        0x0E, 0x03, 0xEA, 0xFF, 0x78, 0x02, 0xE8, 0x00, 0x2D, 0x02, 0x7C, 0x01,
-        0xAB, 0x02, 0x9A, 0x01, 0xD0, 0x03, 0x45, 0x01, 0xF1, 0x04, 0xA7, 0x00,
-        0xA4, 0x05, 0x3E, 0x00, 0xD2, 0x05, 0x50, 0x00, 0x76, 0x05, 0xED, 0x00,
-        0x9D, 0x04, 0xC6, 0x01, 0x95, 0x03, 0xB7, 0x02, 0xA2, 0x02, 0x89, 0x03,
-        0xFE, 0x01, 0x3B, 0x04, 0x94, 0x01, 0xAB, 0x04, 0x54, 0x01, 0xF2, 0x04,
-        0xFC, 0x00, 0x01, 0x05, 0x34, 0x00, 0xB7, 0x04, 0xFE, 0xFE, 0x05, 0x04,
-        0xB0, 0xFD, 0x05, 0x03, 0xF4, 0xFC, 0xCB, 0x01, 0x03, 0xFD, 0x8B, 0x00,
-        0x85, 0xFD, 0x89, 0xFF, 0xCF, 0xFD, 0xE6, 0xFE, 0x3E, 0xFD, 0xB5, 0xFE,
-        0x0F, 0xFC, 0x0B, 0xFF, 0xDC, 0xFA, 0xA7, 0xFF, 0x25, 0xFA, 0x14, 0x00,
-        0x02, 0xFA, 0xF8, 0xFF, 0x70, 0xFA, 0x53, 0xFF, 0x5B, 0xFB, 0x6A, 0xFE,
-        0x6E, 0xFC, 0x7B, 0xFD, 0x5C, 0xFD, 0xAB, 0xFC, 0xFC, 0xFD, 0x0F, 0xFC,
-        0x4F, 0xFE, 0xA2, 0xFB, 0x88, 0xFE, 0x69, 0xFB, 0xD9, 0xFE, 0x57, 0xFB,
-        0x9C, 0xFF, 0x98, 0xFB, 0xDA, 0x00, 0x26, 0xFC, 0x14, 0x02, 0xFC, 0xFC,
-        0xCF, 0x02, 0x1B, 0xFE, 0xBB, 0x02, 0x4D, 0xFF, 0x42, 0x02, 0x44, 0x00,
-        0x1E, 0x02, 0xDE, 0x00, 0xC5, 0x02, 0xF8, 0x00, 0x20, 0x04, 0x90, 0x00,
-        0x60, 0x05, 0xEA, 0xFF, 0x20, 0x06, 0x7D, 0xFF, 0x3F, 0x06, 0xA9, 0xFF,
-        0xC6, 0x05, 0x57, 0x00, 0xD0, 0x04, 0x47, 0x01, 0xB1, 0x03, 0x3A, 0x02,
-        0xB4, 0x02, 0x04, 0x03, 0x10, 0x02, 0x9F, 0x03, 0xBD, 0x01, 0x01, 0x04,
-        0x8E, 0x01, 0x3D, 0x04, 0x4F, 0x01, 0x56, 0x04, 0x9B, 0x00, 0x2F, 0x04,
-        0x7F, 0xFF, 0xB5, 0x03, 0x46, 0xFE, 0xFD, 0x02, 0x9A, 0xFD, 0xE1, 0x01,
-        0x92, 0xFD, 0xBF, 0x00, 0xFD, 0xFD, 0xC4, 0xFF, 0x12, 0xFE, 0x2F, 0xFF,
-        0x5B, 0xFD, 0x12, 0xFF, 0xFC, 0xFB, 0x75, 0xFF, 0xB4, 0xFA, 0x1D, 0x00,
-        0xEC, 0xF9, 0x8F, 0x00, 0xD6, 0xF9, 0x6D, 0x00, 0x54, 0xFA, 0xD8, 0xFF,
-        0x4D, 0xFB, 0xEA, 0xFE, 0x72, 0xFC, 0x03, 0xFE, 0x66, 0xFD, 0x29, 0xFD,
-        0x0A, 0xFE, 0x8E, 0xFC, 0x57, 0xFE, 0x1C, 0xFC, 0x8A, 0xFE, 0xD8, 0xFB,
-        0xD2, 0xFE, 0xB2, 0xFB, 0x87, 0xFF, 0xD3, 0xFB, 0xA8, 0x00, 0x2F, 0xFC,
-        0xCC, 0x01, 0xDD, 0xFC, 0x76, 0x02, 0xE2, 0xFD, 0x65, 0x02, 0x0F, 0xFF,
-        0xFE, 0x01, 0x16, 0x00, 0xF5, 0x01, 0xBF, 0x00, 0xC7, 0x02, 0xF1, 0x00,
-        0x4D, 0x04, 0x8E, 0x00, 0xB6, 0x05, 0xE1, 0xFF, 0x81, 0x06, 0x5E, 0xFF,
-        0x9A, 0x06, 0x70, 0xFF, 0x10, 0x06, 0xFD, 0xFF, 0x0A, 0x05, 0xDB, 0x00,
-        0xED, 0x03, 0xC6, 0x01, 0xE5, 0x02, 0x9D, 0x02, 0x46, 0x02, 0x50, 0x03,
-        0xEE, 0x01, 0xCC, 0x03, 0xC4, 0x01, 0x24, 0x04, 0x7D, 0x01, 0x59, 0x04,
-        0xDB, 0x00, 0x4F, 0x04, 0xC2, 0xFF, 0x03, 0x04, 0xA9, 0xFE, 0x63, 0x03,
-        0xFA, 0xFD, 0x5E, 0x02, 0xFE, 0xFD, 0x28, 0x01, 0x47, 0xFE, 0x21, 0x00,
-        0x3D, 0xFE, 0x74, 0xFF, 0x42, 0xFD, 0x4F, 0xFF, 0xAD, 0xFB, 0xB7, 0xFF,
-        0x37, 0xFA, 0x6D, 0x00, 0x69, 0xF9, 0xF5, 0x00, 0x61, 0xF9, 0xF5, 0x00,
-        0xF9, 0xF9, 0x79, 0x00, 0x1C, 0xFB, 0xA3, 0xFF, 0x52, 0xFC, 0xA0, 0xFE,
-        0x61, 0xFD, 0x9F, 0xFD, 0xFE, 0xFD, 0xB2, 0xFC, 0x43, 0xFE, 0xFF, 0xFB,
-        0x66, 0xFE, 0x82, 0xFB, 0xA4, 0xFE, 0x3D, 0xFB, 0x54, 0xFF, 0x44, 0xFB,
-        0x6F, 0x00, 0x9E, 0xFB, 0x92, 0x01, 0x44, 0xFC, 0x34, 0x02, 0x60, 0xFD,
-        0x27, 0x02, 0xA2, 0xFE, 0xC7, 0x01, 0xB9, 0xFF, 0xCA, 0x01, 0x68, 0x00,
-        0xB0, 0x02, 0x92, 0x00, 0x42, 0x04, 0x2B, 0x00, 0xB4, 0x05, 0x75, 0xFF,
-        0x86, 0x06, 0xEA, 0xFE, 0x93, 0x06, 0xEB, 0xFE, 0xEF, 0x05, 0x76, 0xFF,
-        0xC9, 0x04, 0x6A, 0x00, 0x82, 0x03, 0x98, 0x01, 0x76, 0x02, 0xCF, 0x02,
-        0xCD, 0x01, 0xE7, 0x03, 0x88, 0x01, 0xB6, 0x04, 0x5E, 0x01, 0x33, 0x05,
-        0x18, 0x01, 0x60, 0x05, 0x60, 0x00, 0x2A, 0x05, 0x38, 0xFF, 0xA6, 0x04,
-        0x12, 0xFE, 0xC6, 0x03, 0x70, 0xFD, 0x89, 0x02, 0x86, 0xFD, 0x30, 0x01,
-        0xF6, 0xFD, 0x25, 0x00, 0x19, 0xFE, 0x92, 0xFF, 0x5A, 0xFD, 0x91, 0xFF,
-        0xFC, 0xFB, 0x06, 0x00, 0xA2, 0xFA, 0xB9, 0x00, 0xE1, 0xF9, 0x26, 0x01,
-        0xD2, 0xF9, 0x06, 0x01, 0x67, 0xFA, 0x6B, 0x00, 0x79, 0xFB, 0x66, 0xFF,
-        0xA8, 0xFC, 0x2B, 0xFE, 0xA5, 0xFD, 0xE2, 0xFC, 0x2E, 0xFE, 0xC8, 0xFB,
-        0x64, 0xFE, 0x01, 0xFB, 0x76, 0xFE, 0x9E, 0xFA, 0xB3, 0xFE, 0x8E, 0xFA,
-        0x6C, 0xFF, 0xD8, 0xFA, 0x96, 0x00, 0x68, 0xFB, 0xC5, 0x01, 0x30, 0xFC,
-        0x72, 0x02, 0x5A, 0xFD, 0x60, 0x02, 0x86, 0xFE, 0xF6, 0x01, 0x71, 0xFF,
-        0xD5, 0x01, 0xE0, 0xFF, 0x87, 0x02, 0xDE, 0xFF, 0xDB, 0x03, 0x83, 0xFF,
-        0x26, 0x05, 0xFA, 0xFE, 0xE2, 0x05, 0xBB, 0xFE, 0xF3, 0x05, 0xEB, 0xFE,
-        0x5F, 0x05, 0x98, 0xFF, 0x4C, 0x04, 0x98, 0x00, 0x1D, 0x03, 0xC8, 0x01,
-        0x22, 0x02, 0xFB, 0x02, 0xA2, 0x01, 0x00, 0x04, 0x7E, 0x01, 0xB0, 0x04,
-        0x7C, 0x01, 0x17, 0x05, 0x49, 0x01, 0x2B, 0x05, 0x98, 0x00, 0xF5, 0x04,
-        0x62, 0xFF, 0x72, 0x04, 0x2D, 0xFE, 0xA6, 0x03, 0x77, 0xFD, 0x7F, 0x02,
-        0x79, 0xFD, 0x39, 0x01, 0xDE, 0xFD, 0x4E, 0x00, 0xFB, 0xFD, 0xCD, 0xFF,
-        0x50, 0xFD, 0xCF, 0xFF, 0xFF, 0xFB, 0x21, 0x00, 0xB3, 0xFA, 0x9B, 0x00,
-        0xF2, 0xF9, 0xD6, 0x00, 0xDD, 0xF9, 0x9B, 0x00, 0x6B, 0xFA, 0xF8, 0xFF,
-        0x7E, 0xFB, 0x01, 0xFF, 0xAA, 0xFC, 0xE2, 0xFD, 0xA6, 0xFD, 0xC3, 0xFC,
-        0x25, 0xFE, 0xC4, 0xFB, 0x41, 0xFE, 0x10, 0xFB, 0x42, 0xFE, 0xAC, 0xFA,
-        0x73, 0xFE, 0x95, 0xFA, 0x1C, 0xFF, 0xDC, 0xFA, 0x4D, 0x00, 0x69, 0xFB,
-        0x75, 0x01, 0x41, 0xFC, 0x25, 0x02, 0x6F, 0xFD, 0x24, 0x02, 0xB2, 0xFE,
-        0xC2, 0x01, 0xA9, 0xFF, 0xA1, 0x01, 0x1F, 0x00, 0x50, 0x02, 0x29, 0x00,
-        0x9D, 0x03, 0xD4, 0xFF, 0xF3, 0x04, 0x69, 0xFF, 0xC0, 0x05, 0x2C, 0xFF,
-        0xEE, 0x05, 0x63, 0xFF, 0x74, 0x05, 0xF1, 0xFF, 0x79, 0x04, 0xD8, 0x00,
-        0x53, 0x03, 0xE2, 0x01, 0x60, 0x02, 0xFE, 0x02, 0xEC, 0x01, 0xF3, 0x03,
-        0xCF, 0x01, 0xAD, 0x04, 0xD7, 0x01, 0x0B, 0x05, 0xAA, 0x01, 0x1B, 0x05,
-        0xFA, 0x00, 0xC6, 0x04, 0xC9, 0xFF, 0x26, 0x04, 0x8B, 0xFE, 0x42, 0x03,
-        0xC7, 0xFD, 0x12, 0x02, 0xB2, 0xFD, 0xD6, 0x00, 0x04, 0xFE, 0xF3, 0xFF,
-        0x26, 0xFE, 0x8C, 0xFF, 0x87, 0xFD, 0x97, 0xFF, 0x47, 0xFC, 0xF0, 0xFF,
-        0xFD, 0xFA, 0x6D, 0x00, 0x36, 0xFA, 0xA9, 0x00, 0x10, 0xFA, 0x84, 0x00,
-        0x90, 0xFA, 0xF7, 0xFF, 0x8F, 0xFB, 0x1A, 0xFF, 0xB2, 0xFC, 0x17, 0xFE,
-        0x9D, 0xFD, 0x03, 0xFD, 0x11, 0xFE, 0x0F, 0xFC, 0x2F, 0xFE, 0x47, 0xFB,
-        0x32, 0xFE, 0xC9, 0xFA, 0x5C, 0xFE, 0x9C, 0xFA, 0x05, 0xFF, 0xDF, 0xFA,
-        0x24, 0x00, 0x7D, 0xFB, 0x54, 0x01, 0x69, 0xFC, 0x18, 0x02, 0xA3, 0xFD,
-        0x30, 0x02, 0xEA, 0xFE, 0xE8, 0x01, 0xD5, 0xFF, 0xCB, 0x01, 0x46, 0x00,
-        0x63, 0x02, 0x39, 0x00, 0x9E, 0x03, 0xDB, 0xFF, 0xD0, 0x04, 0x5A, 0xFF,
-        0x7F, 0x05, 0x11, 0xFF, 0x84, 0x05, 0x33, 0xFF, 0xF3, 0x04, 0xB5, 0xFF,
-        0xEC, 0x03, 0x87, 0x00, 0xD9, 0x02, 0x85, 0x01, 0xF9, 0x01, 0xA3, 0x02,
-        0x97, 0x01, 0xC0, 0x03, 0x8E, 0x01, 0xBA, 0x04, 0xA0, 0x01, 0x6E, 0x05,
-        0x8B, 0x01, 0xB6, 0x05, 0xEF, 0x00, 0x74, 0x05, 0xCF, 0xFF, 0xBD, 0x04,
-        0x9E, 0xFE, 0xAE, 0x03, 0xE1, 0xFD, 0x53, 0x02, 0xCE, 0xFD, 0xF7, 0x00,
-        0x24, 0xFE, 0xFA, 0xFF, 0x47, 0xFE, 0x95, 0xFF, 0xB5, 0xFD, 0xA1, 0xFF,
-        0x8E, 0xFC, 0x14, 0x00, 0x6B, 0xFB, 0xA4, 0x00, 0xD7, 0xFA, 0x01, 0x01,
-        0xCE, 0xFA, 0xEF, 0x00, 0x59, 0xFB, 0x6B, 0x00, 0x45, 0xFC, 0x7F, 0xFF,
-        0x3F, 0xFD, 0x60, 0xFE, 0x04, 0xFE, 0x17, 0xFD, 0x4A, 0xFE, 0xEC, 0xFB,
-        0x40, 0xFE, 0xE5, 0xFA, 0x21, 0xFE, 0x49, 0xFA, 0x33, 0xFE, 0x07, 0xFA,
-        0xDC, 0xFE, 0x5B, 0xFA, 0xFD, 0xFF, 0x18, 0xFB, 0x2B, 0x01, 0x35, 0xFC,
-        0xE2, 0x01, 0x99, 0xFD, 0xFC, 0x01, 0x03, 0xFF, 0xBA, 0x01, 0xFC, 0xFF,
-        0xAC, 0x01, 0x6C, 0x00, 0x39, 0x02, 0x5A, 0x00, 0x55, 0x03, 0xE6, 0xFF,
-        0x5A, 0x04, 0x51, 0xFF, 0xE5, 0x04, 0xEF, 0xFE, 0xE5, 0x04, 0x0C, 0xFF,
-        0x5E, 0x04, 0xA7, 0xFF, 0x6B, 0x03, 0xB2, 0x00, 0x6D, 0x02, 0xF1, 0x01,
-        0xAF, 0x01, 0x41, 0x03, 0x72, 0x01, 0x79, 0x04, 0x8D, 0x01, 0x7A, 0x05,
-        0xB1, 0x01, 0x26, 0x06, 0x9C, 0x01, 0x5E, 0x06, 0x01, 0x01, 0xFB, 0x05,
-        0xE3, 0xFF, 0x16, 0x05, 0xCE, 0xFE, 0xDD, 0x03, 0x1E, 0xFE, 0x66, 0x02,
-        0x12, 0xFE, 0x0B, 0x01, 0x4F, 0xFE, 0x18, 0x00, 0x66, 0xFE, 0xB9, 0xFF,
-        0xDA, 0xFD, 0xC0, 0xFF, 0xCA, 0xFC, 0x2A, 0x00, 0xC5, 0xFB, 0xAC, 0x00,
-        0x44, 0xFB, 0x05, 0x01, 0x42, 0xFB, 0xE3, 0x00, 0xDA, 0xFB, 0x42, 0x00,
-        0xBF, 0xFC, 0x35, 0xFF, 0xBD, 0xFD, 0xEF, 0xFD, 0x66, 0xFE, 0x98, 0xFC,
-        0x9E, 0xFE, 0x5A, 0xFB, 0x90, 0xFE, 0x5D, 0xFA, 0x6B, 0xFE, 0xBE, 0xF9,
-        0x8F, 0xFE, 0xA9, 0xF9, 0x19, 0xFF, 0x26, 0xFA, 0x30, 0x00, 0x1D, 0xFB,
-        0x36, 0x01, 0x5D, 0xFC, 0xD8, 0x01, 0xCB, 0xFD, 0xEE, 0x01, 0x29, 0xFF,
-        0xBD, 0x01, 0x14, 0x00, 0xCC, 0x01, 0x6D, 0x00, 0x74, 0x02, 0x57, 0x00,
-        0x9C, 0x03, 0xE0, 0xFF, 0xA3, 0x04, 0x52, 0xFF, 0x24, 0x05, 0xF7, 0xFE,
-        0x17, 0x05, 0x1F, 0xFF, 0x80, 0x04, 0xC2, 0xFF, 0x8C, 0x03, 0xD8, 0x00,
-        0x87, 0x02, 0x26, 0x02, 0xC4, 0x01, 0x7F, 0x03, 0x76, 0x01, 0xBA, 0x04,
-        0x7A, 0x01, 0xAC, 0x05, 0x7F, 0x01, 0x44, 0x06, 0x5D, 0x01, 0x64, 0x06,
-        0xB8, 0x00, 0xF5, 0x05, 0xAF, 0xFF, 0x11, 0x05, 0xB6, 0xFE, 0xE1, 0x03,
-        0x38, 0xFE, 0x77, 0x02, 0x47, 0xFE, 0x2A, 0x01, 0x8F, 0xFE, 0x56, 0x00,
-        0x88, 0xFE, 0x19, 0x00, 0xD2, 0xFD, 0x4D, 0x00, 0xA2, 0xFC, 0xC7, 0x00,
-        0x93, 0xFB, 0x4B, 0x01, 0xFA, 0xFA, 0x91, 0x01, 0xFF, 0xFA, 0x54, 0x01,
-        0x7C, 0xFB, 0x99, 0x00, 0x6F, 0xFC, 0x74, 0xFF, 0x79, 0xFD, 0x13, 0xFE,
-        0x40, 0xFE, 0xB0, 0xFC, 0x9A, 0xFE, 0x69, 0xFB, 0xA7, 0xFE, 0x74, 0xFA,
-        0xA9, 0xFE, 0xD4, 0xF9, 0xDF, 0xFE, 0xAF, 0xF9, 0x83, 0xFF, 0x1A, 0xFA,
-        0x8B, 0x00, 0x02, 0xFB, 0x78, 0x01, 0x3C, 0xFC, 0xF3, 0x01, 0xB5, 0xFD,
-        0xD9, 0x01, 0x0C, 0xFF, 0x96, 0x01, 0xE7, 0xFF, 0x92, 0x01, 0x27, 0x00,
-        0x45, 0x02, 0xFE, 0xFF, 0x6F, 0x03, 0x87, 0xFF, 0x85, 0x04, 0x0C, 0xFF,
-        0x27, 0x05, 0xD6, 0xFE, 0x3D, 0x05, 0x27, 0xFF, 0xCF, 0x04, 0xFA, 0xFF,
-        0xF2, 0x03, 0x3C, 0x01, 0xF8, 0x02, 0xAF, 0x02, 0x3F, 0x02, 0x23, 0x04,
-        0xF0, 0x01, 0x6D, 0x05, 0xF1, 0x01, 0x53, 0x06, 0xEB, 0x01, 0xDE, 0x06,
-        0xBA, 0x01, 0xDB, 0x06, 0x00, 0x01, 0x56, 0x06, 0xEF, 0xFF, 0x4F, 0x05,
-        0xE2, 0xFE, 0x08, 0x04, 0x5F, 0xFE, 0x84, 0x02, 0x5D, 0xFE, 0x30, 0x01,
-        0xAA, 0xFE, 0x52, 0x00, 0xA0, 0xFE, 0x1F, 0x00, 0xFA, 0xFD, 0x56, 0x00,
-        0xCF, 0xFC, 0xE0, 0x00, 0xBE, 0xFB, 0x61, 0x01, 0x23, 0xFB, 0x8A, 0x01,
-        0x10, 0xFB, 0x1E, 0x01, 0x80, 0xFB, 0x2E, 0x00, 0x60, 0xFC, 0xE0, 0xFE,
-        0x5A, 0xFD, 0x61, 0xFD, 0x1A, 0xFE, 0xF0, 0xFB, 0x6C, 0xFE, 0xBD, 0xFA,
-        0x78, 0xFE, 0xE1, 0xF9, 0x7C, 0xFE, 0x7C, 0xF9, 0xA9, 0xFE, 0x84, 0xF9,
-        0x4D, 0xFF, 0x1F, 0xFA, 0x47, 0x00, 0x2A, 0xFB, 0x41, 0x01, 0x81, 0xFC,
-        0xC1, 0x01, 0x0E, 0xFE, 0xC7, 0x01, 0x74, 0xFF, 0x91, 0x01, 0x4A, 0x00,
-        0xA1, 0x01, 0x7F, 0x00, 0x56, 0x02, 0x39, 0x00, 0x83, 0x03, 0xAD, 0xFF,
-        0x9C, 0x04, 0x31, 0xFF, 0x42, 0x05, 0x17, 0xFF, 0x5A, 0x05, 0x8F, 0xFF,
-        0xE5, 0x04, 0x83, 0x00, 0xFB, 0x03, 0xC8, 0x01, 0xED, 0x02, 0x33, 0x03,
-        0x15, 0x02, 0x9A, 0x04, 0xB4, 0x01, 0xC1, 0x05, 0x9F, 0x01, 0x93, 0x06,
-        0xA7, 0x01, 0xF5, 0x06, 0x91, 0x01, 0xDF, 0x06, 0x0C, 0x01, 0x3A, 0x06,
-        0x2C, 0x00, 0x20, 0x05, 0x40, 0xFF, 0xB8, 0x03, 0xB8, 0xFE, 0x1A, 0x02,
-        0x9B, 0xFE, 0x9E, 0x00, 0xB6, 0xFE, 0xA8, 0xFF, 0x92, 0xFE, 0x53, 0xFF,
-        0xC8, 0xFD, 0x83, 0xFF, 0x93, 0xFC, 0xFD, 0xFF, 0x66, 0xFB, 0x7F, 0x00,
-        0xB9, 0xFA, 0x9E, 0x00, 0x97, 0xFA, 0x34, 0x00, 0x0C, 0xFB, 0x5D, 0xFF,
-        0xF7, 0xFB, 0x3D, 0xFE, 0x0D, 0xFD, 0xFB, 0xFC, 0xE8, 0xFD, 0xBF, 0xFB,
-        0x56, 0xFE, 0xAC, 0xFA, 0x70, 0xFE, 0xF2, 0xF9, 0x6E, 0xFE, 0x92, 0xF9,
-        0x91, 0xFE, 0xAB, 0xF9, 0x21, 0xFF, 0x48, 0xFA, 0x10, 0x00, 0x5D, 0xFB,
-        0x09, 0x01, 0xCB, 0xFC, 0x9C, 0x01, 0x70, 0xFE, 0xC4, 0x01, 0x01, 0x00,
-        0xA7, 0x01, 0xF8, 0x00, 0xCB, 0x01, 0x46, 0x01, 0x84, 0x02, 0x06, 0x01,
-        0xBE, 0x03, 0x6E, 0x00, 0xDC, 0x04, 0xE5, 0xFF, 0x9A, 0x05, 0xAF, 0xFF,
-        0xB7, 0x05, 0x0D, 0x00, 0x53, 0x05, 0xC7, 0x00, 0x69, 0x04, 0xC9, 0x01,
-        0x59, 0x03, 0xE5, 0x02, 0x77, 0x02, 0x0D, 0x04, 0xFB, 0x01, 0x11, 0x05,
-        0xCD, 0x01, 0xD1, 0x05, 0xBC, 0x01, 0x34, 0x06, 0x93, 0x01, 0x22, 0x06,
-        0x04, 0x01, 0x92, 0x05, 0x1E, 0x00, 0x82, 0x04, 0x2E, 0xFF, 0x1D, 0x03,
-        0x8E, 0xFE, 0x7D, 0x01, 0x4B, 0xFE, 0x07, 0x00, 0x3B, 0xFE, 0x1C, 0xFF,
-        0xEB, 0xFD, 0xE7, 0xFE, 0x0C, 0xFD, 0x38, 0xFF, 0xBA, 0xFB, 0xD3, 0xFF,
-        0x84, 0xFA, 0x6B, 0x00, 0xC8, 0xF9, 0x8D, 0x00, 0x99, 0xF9, 0x20, 0x00,
-        0x15, 0xFA, 0x46, 0xFF, 0x06, 0xFB, 0x26, 0xFE, 0x3E, 0xFC, 0xF0, 0xFC,
-        0x3F, 0xFD, 0xBD, 0xFB, 0xDE, 0xFD, 0xAF, 0xFA, 0x1B, 0xFE, 0xF6, 0xF9,
-        0x2F, 0xFE, 0x9D, 0xF9, 0x48, 0xFE, 0xB3, 0xF9, 0xCE, 0xFE, 0x59, 0xFA,
-        0xB6, 0xFF, 0x69, 0xFB, 0xBE, 0x00, 0xE1, 0xFC, 0x7A, 0x01, 0x84, 0xFE,
-        0xDA, 0x01, 0xFF, 0xFF, 0xF2, 0x01, 0xDD, 0x00, 0x52, 0x02, 0x03, 0x01,
-        0x2C, 0x03, 0x9F, 0x00, 0x87, 0x04, 0xF5, 0xFF, 0xAB, 0x05, 0x5C, 0xFF,
-        0x57, 0x06, 0x3B, 0xFF, 0x5A, 0x06, 0xAF, 0xFF, 0xC5, 0x05, 0x94, 0x00,
-        0xAC, 0x04, 0xB3, 0x01, 0x67, 0x03, 0xE8, 0x02, 0x54, 0x02, 0x19, 0x04,
-        0xAE, 0x01, 0x21, 0x05, 0x6B, 0x01, 0xE3, 0x05, 0x5F, 0x01, 0x33, 0x06,
-        0x45, 0x01, 0x0C, 0x06, 0xCB, 0x00, 0x51, 0x05, 0xDE, 0xFF, 0x1C, 0x04,
-        0xE1, 0xFE, 0x9D, 0x02, 0x35, 0xFE, 0xED, 0x00, 0xE8, 0xFD, 0x80, 0xFF,
-        0xD7, 0xFD, 0xA7, 0xFE, 0x7C, 0xFD, 0x8B, 0xFE, 0xA3, 0xFC, 0xFB, 0xFE,
-        0x62, 0xFB, 0xAA, 0xFF, 0x54, 0xFA, 0x53, 0x00, 0xB8, 0xF9, 0x70, 0x00,
-        0xB2, 0xF9, 0xFC, 0xFF, 0x2F, 0xFA, 0x05, 0xFF, 0x2C, 0xFB, 0xE0, 0xFD,
-        0x5A, 0xFC, 0x9D, 0xFC, 0x64, 0xFD, 0x62, 0xFB, 0x0A, 0xFE, 0x44, 0xFA,
-        0x50, 0xFE, 0x73, 0xF9, 0x5A, 0xFE, 0x15, 0xF9, 0x67, 0xFE, 0x3B, 0xF9,
-        0xCE, 0xFE, 0xFB, 0xF9, 0xA4, 0xFF, 0x2F, 0xFB, 0x97, 0x00, 0xB7, 0xFC,
-        0x46, 0x01, 0x5E, 0xFE, 0x98, 0x01, 0xD5, 0xFF, 0xB5, 0x01, 0xAF, 0x00,
-        0x05, 0x02, 0xCE, 0x00, 0xE3, 0x02, 0x5F, 0x00, 0x1D, 0x04, 0xAA, 0xFF,
-        0x38, 0x05, 0x0D, 0xFF, 0xE1, 0x05, 0xFB, 0xFE, 0xF5, 0x05, 0x7E, 0xFF,
-        0x81, 0x05, 0x77, 0x00, 0x8C, 0x04, 0x9A, 0x01, 0x6C, 0x03, 0xD1, 0x02,
-        0x6B, 0x02, 0x13, 0x04, 0xDE, 0x01, 0x47, 0x05, 0x98, 0x01, 0x44, 0x06,
-        0x9A, 0x01, 0xCA, 0x06, 0x8B, 0x01, 0xBE, 0x06, 0x24, 0x01, 0x0B, 0x06,
-        0x4A, 0x00, 0xCA, 0x04, 0x50, 0xFF, 0x2C, 0x03, 0x94, 0xFE, 0x5F, 0x01,
-        0x30, 0xFE, 0xBB, 0xFF, 0x04, 0xFE, 0xBD, 0xFE, 0x9C, 0xFD, 0x7F, 0xFE,
-        0xB0, 0xFC, 0xF4, 0xFE, 0x6A, 0xFB, 0xB2, 0xFF, 0x49, 0xFA, 0x63, 0x00,
-        0xB1, 0xF9, 0x88, 0x00, 0x9D, 0xF9, 0x1A, 0x00, 0x22, 0xFA, 0x43, 0xFF,
-        0x0B, 0xFB, 0x33, 0xFE, 0x25, 0xFC, 0x03, 0xFD, 0x13, 0xFD, 0xB4, 0xFB,
-        0xA2, 0xFD, 0x65, 0xFA, 0xED, 0xFD, 0x4E, 0xF9, 0xFE, 0xFD, 0xB3, 0xF8,
-        0x18, 0xFE, 0xA0, 0xF8, 0x85, 0xFE, 0x3C, 0xF9, 0x57, 0xFF, 0x65, 0xFA,
-        0x48, 0x00, 0x0B, 0xFC, 0xF7, 0x00, 0xE9, 0xFD, 0x51, 0x01, 0xA8, 0xFF,
-        0x73, 0x01, 0xB5, 0x00, 0xD8, 0x01, 0xFB, 0x00, 0xC0, 0x02, 0x8A, 0x00,
-        0x17, 0x04, 0xC7, 0xFF, 0x3D, 0x05, 0x19, 0xFF, 0xF1, 0x05, 0xE0, 0xFE,
-        0x12, 0x06, 0x41, 0xFF, 0xAF, 0x05, 0x09, 0x00, 0xD3, 0x04, 0x28, 0x01,
-        0xC3, 0x03, 0x65, 0x02, 0xCD, 0x02, 0xCB, 0x03, 0x2F, 0x02, 0x20, 0x05,
-        0xDF, 0x01, 0x3E, 0x06, 0xC4, 0x01, 0xE8, 0x06, 0xB1, 0x01, 0x0F, 0x07,
-        0x44, 0x01, 0x89, 0x06, 0x71, 0x00, 0x71, 0x05, 0x80, 0xFF, 0xCE, 0x03,
-        0xCC, 0xFE, 0xF0, 0x01, 0x71, 0xFE, 0x31, 0x00, 0x46, 0xFE, 0x17, 0xFF,
-        0xDF, 0xFD, 0xCB, 0xFE, 0xE0, 0xFC, 0x26, 0xFF, 0x8C, 0xFB, 0xDD, 0xFF,
-        0x48, 0xFA, 0x83, 0x00, 0x8F, 0xF9, 0xB3, 0x00, 0x67, 0xF9, 0x57, 0x00,
-        0xDB, 0xF9, 0x7F, 0xFF, 0xD1, 0xFA, 0x74, 0xFE, 0x03, 0xFC, 0x3D, 0xFD,
-        0x1F, 0xFD, 0xF7, 0xFB, 0xE6, 0xFD, 0xAE, 0xFA, 0x57, 0xFE, 0x9A, 0xF9,
-        0x84, 0xFE, 0xF1, 0xF8, 0x9F, 0xFE, 0xD3, 0xF8, 0x01, 0xFF, 0x60, 0xF9,
-        0xD3, 0xFF, 0x8B, 0xFA, 0xBC, 0x00, 0x32, 0xFC, 0x6C, 0x01, 0x1B, 0xFE,
-        0xBD, 0x01, 0xD5, 0xFF, 0xDD, 0x01, 0xF6, 0x00, 0x43, 0x02, 0x40, 0x01,
-        0x43, 0x03, 0xEB, 0x00, 0xA0, 0x04, 0x36, 0x00, 0xDA, 0x05, 0x92, 0xFF,
-        0x7C, 0x06, 0x60, 0xFF, 0x86, 0x06, 0xBD, 0xFF, 0xFC, 0x05, 0x8F, 0x00,
-        0xFF, 0x04, 0x92, 0x01, 0xC1, 0x03, 0xC2, 0x02, 0x95, 0x02, 0xF9, 0x03,
-        0xBA, 0x01, 0x39, 0x05, 0x3C, 0x01, 0x44, 0x06, 0x11, 0x01, 0xDA, 0x06,
-        0x06, 0x01, 0xF0, 0x06, 0xAC, 0x00, 0x56, 0x06, 0xEC, 0xFF, 0x3B, 0x05,
-        0xF8, 0xFE, 0xA6, 0x03, 0x4A, 0xFE, 0xDE, 0x01, 0xF3, 0xFD, 0x35, 0x00,
-        0xD4, 0xFD, 0x25, 0xFF, 0x71, 0xFD, 0xE2, 0xFE, 0x80, 0xFC, 0x46, 0xFF,
-        0x33, 0xFB, 0xFE, 0xFF, 0x12, 0xFA, 0xA5, 0x00, 0x79, 0xF9, 0xCF, 0x00,
-        0x6F, 0xF9, 0x68, 0x00, 0xFC, 0xF9, 0x8D, 0xFF, 0xF2, 0xFA, 0x83, 0xFE,
-        0x37, 0xFC, 0x65, 0xFD, 0x5D, 0xFD, 0x44, 0xFC, 0x3F, 0xFE, 0x29, 0xFB,
-        0xC1, 0xFE, 0x3B, 0xFA, 0xF3, 0xFE, 0xA8, 0xF9, 0x07, 0xFF, 0x91, 0xF9,
-        0x69, 0xFF, 0x0A, 0xFA, 0x3E, 0x00, 0x0B, 0xFB, 0x36, 0x01, 0x84, 0xFC,
-        0xEF, 0x01, 0x3B, 0xFE, 0x42, 0x02, 0xCB, 0xFF, 0x5C, 0x02, 0xC5, 0x00,
-        0xB4, 0x02, 0xFC, 0x00, 0x9D, 0x03, 0x99, 0x00, 0xE7, 0x04, 0xEC, 0xFF,
-        0x0E, 0x06, 0x59, 0xFF, 0xB5, 0x06, 0x3A, 0xFF, 0xC0, 0x06, 0xB3, 0xFF,
-        0x3C, 0x06, 0x9D, 0x00, 0x3C, 0x05, 0xBD, 0x01, 0xFC, 0x03, 0xE4, 0x02,
-        0xC6, 0x02, 0x0A, 0x04, 0xEA, 0x01, 0x1A, 0x05, 0x5D, 0x01, 0x06, 0x06,
-        0x35, 0x01, 0x99, 0x06, 0x19, 0x01, 0xBA, 0x06, 0xC2, 0x00, 0x4B, 0x06,
-        0xE6, 0xFF, 0x5A, 0x05, 0xF8, 0xFE, 0xF4, 0x03, 0x2F, 0xFE, 0x63, 0x02,
-        0xDC, 0xFD, 0xE9, 0x00, 0xB9, 0xFD, 0x01, 0x00, 0x6B, 0xFD, 0xC8, 0xFF,
-        0x8D, 0xFC, 0x1A, 0x00, 0x47, 0xFB, 0xC3, 0x00, 0x1E, 0xFA, 0x4A, 0x01,
-        0x64, 0xF9, 0x6A, 0x01, 0x4B, 0xF9, 0xE7, 0x00, 0xCA, 0xF9, 0xF0, 0xFF,
-        0xC2, 0xFA, 0xBC, 0xFE, 0x03, 0xFC, 0x7C, 0xFD, 0x2C, 0xFD, 0x4B, 0xFC,
-        0x04, 0xFE, 0x25, 0xFB, 0x8D, 0xFE, 0x39, 0xFA, 0xBC, 0xFE, 0x91, 0xF9,
-        0xE4, 0xFE, 0x63, 0xF9, 0x4E, 0xFF, 0xB9, 0xF9, 0x3B, 0x00, 0x98, 0xFA,
-        0x4D, 0x01, 0xE4, 0xFB, 0x2C, 0x02, 0x63, 0xFD, 0x9A, 0x02, 0xCD, 0xFE,
-        0xBF, 0x02, 0xB0, 0xFF, 0x07, 0x03, 0xF8, 0xFF, 0xD5, 0x03, 0xB0, 0xFF,
-        0x02, 0x05, 0x2E, 0xFF, 0x1A, 0x06, 0xAA, 0xFE, 0xC8, 0x06, 0xA0, 0xFE,
-        0xE2, 0x06, 0x2A, 0xFF, 0x71, 0x06, 0x32, 0x00, 0x8C, 0x05, 0x85, 0x01,
-        0x63, 0x04, 0xD6, 0x02, 0x53, 0x03, 0x1E, 0x04, 0x83, 0x02, 0x51, 0x05,
-        0x07, 0x02, 0x5A, 0x06, 0xCF, 0x01, 0x1A, 0x07, 0xAB, 0x01, 0x5D, 0x07,
-        0x2E, 0x01, 0x10, 0x07, 0x3A, 0x00, 0x30, 0x06, 0x07, 0xFF, 0xE6, 0x04,
-        0x17, 0xFE, 0x66, 0x03, 0x8D, 0xFD, 0xF1, 0x01, 0x6A, 0xFD, 0xF8, 0x00,
-        0x24, 0xFD, 0x8A, 0x00, 0x69, 0xFC, 0xAE, 0x00, 0x43, 0xFB, 0x1A, 0x01,
-        0x2F, 0xFA, 0x90, 0x01, 0x6D, 0xF9, 0x99, 0x01, 0x41, 0xF9, 0x14, 0x01,
-        0x9A, 0xF9, 0x12, 0x00, 0x6D, 0xFA, 0xD4, 0xFE, 0x84, 0xFB, 0x84, 0xFD,
-        0x84, 0xFC, 0x3A, 0xFC, 0x43, 0xFD, 0xF5, 0xFA, 0xB7, 0xFD, 0xCB, 0xF9,
-        0xF6, 0xFD, 0xFA, 0xF8, 0x27, 0xFE, 0xA5, 0xF8, 0xC4, 0xFE, 0xF4, 0xF8,
-        0xDC, 0xFF, 0xD6, 0xF9, 0x29, 0x01, 0x23, 0xFB, 0x2A, 0x02, 0xA7, 0xFC,
-        0xB5, 0x02, 0x22, 0xFE, 0xDA, 0x02, 0x26, 0xFF, 0x2B, 0x03, 0x9D, 0xFF,
-        0xF7, 0x03, 0x8A, 0xFF, 0x2C, 0x05, 0x18, 0xFF, 0x5E, 0x06, 0x9C, 0xFE,
-        0x2C, 0x07, 0x77, 0xFE, 0x68, 0x07, 0xDB, 0xFE, 0x17, 0x07, 0xA8, 0xFF,
-        0x3D, 0x06, 0xBF, 0x00, 0x24, 0x05, 0xF0, 0x01, 0x0E, 0x04, 0x3F, 0x03,
-        0x3B, 0x03, 0x99, 0x04, 0xB8, 0x02, 0xE1, 0x05, 0x6E, 0x02, 0xD3, 0x06,
-        0x2E, 0x02, 0x4F, 0x07, 0x8D, 0x01, 0x1C, 0x07, 0x6A, 0x00, 0x5F, 0x06,
-        0x1B, 0xFF, 0x23, 0x05, 0x0D, 0xFE, 0x9F, 0x03, 0x80, 0xFD, 0x24, 0x02,
-        0x4A, 0xFD, 0x01, 0x01, 0xF6, 0xFC, 0x8D, 0x00, 0x1F, 0xFC, 0x97, 0x00,
-        0xE7, 0xFA, 0x18, 0x01, 0xB3, 0xF9, 0xA1, 0x01, 0xE2, 0xF8, 0xD5, 0x01,
-        0xA5, 0xF8, 0x92, 0x01, 0xFD, 0xF8, 0xE8, 0x00, 0xD6, 0xF9, 0xF7, 0xFF,
-        0x03, 0xFB, 0xCD, 0xFE, 0x1E, 0xFC, 0x75, 0xFD, 0xFF, 0xFC, 0xFC, 0xFB,
-        0x78, 0xFD, 0x91, 0xFA, 0xB4, 0xFD, 0x73, 0xF9, 0xDB, 0xFD, 0xC7, 0xF8,
-        0x72, 0xFE, 0xC8, 0xF8, 0x94, 0xFF, 0x68, 0xF9, 0xFA, 0x00, 0x92, 0xFA,
-        0x1E, 0x02, 0x1E, 0xFC, 0xC8, 0x02, 0xAA, 0xFD, 0x0E, 0x03, 0xD1, 0xFE,
-        0x74, 0x03, 0x60, 0xFF, 0x4F, 0x04, 0x62, 0xFF, 0x93, 0x05, 0x01, 0xFF,
-        0xCB, 0x06, 0x97, 0xFE, 0x95, 0x07, 0x62, 0xFE, 0xC4, 0x07, 0xA5, 0xFE,
-        0x55, 0x07, 0x30, 0xFF, 0x78, 0x06, 0x18, 0x00, 0x49, 0x05, 0x2E, 0x01,
-        0x28, 0x04, 0x7F, 0x02, 0x4A, 0x03, 0xEE, 0x03, 0xC8, 0x02, 0x51, 0x05,
-        0x93, 0x02, 0x7F, 0x06, 0x59, 0x02, 0x2A, 0x07, 0xAB, 0x01, 0x3A, 0x07,
-        0x5F, 0x00, 0x97, 0x06, 0xD4, 0xFE, 0x6B, 0x05, 0x8F, 0xFD, 0xD7, 0x03,
-        0xD9, 0xFC, 0x47, 0x02, 0x8A, 0xFC, 0x15, 0x01, 0x2C, 0xFC, 0x76, 0x00,
-        0x53, 0xFB, 0x60, 0x00, 0x2B, 0xFA, 0xA8, 0x00, 0x0E, 0xF9, 0x17, 0x01,
-        0x64, 0xF8, 0x49, 0x01, 0x52, 0xF8, 0x22, 0x01, 0xBF, 0xF8, 0xA2, 0x00,
-        0xA6, 0xF9, 0xC9, 0xFF, 0xCB, 0xFA, 0xC2, 0xFE, 0xF7, 0xFB, 0x80, 0xFD,
-        0xE6, 0xFC, 0x28, 0xFC, 0x83, 0xFD, 0xCA, 0xFA, 0xDE, 0xFD, 0xA8, 0xF9,
-        0x2F, 0xFE, 0x02, 0xF9, 0xEB, 0xFE, 0xF6, 0xF8, 0x27, 0x00, 0x9E, 0xF9,
-        0x9B, 0x01, 0xCC, 0xFA, 0xB3, 0x02, 0x52, 0xFC, 0x4B, 0x03, 0xD6, 0xFD,
-        0x76, 0x03, 0xF2, 0xFE, 0xBF, 0x03, 0x8A, 0xFF, 0x7C, 0x04, 0xAA, 0xFF,
-        0x9B, 0x05, 0x6A, 0xFF, 0xAF, 0x06, 0x0C, 0xFF, 0x54, 0x07, 0xE4, 0xFE,
-        0x70, 0x07, 0x13, 0xFF, 0xFA, 0x06, 0xA3, 0xFF, 0x15, 0x06, 0x7E, 0x00,
-        0xDE, 0x04, 0x86, 0x01, 0x9F, 0x03, 0xBA, 0x02, 0xAA, 0x02, 0x11, 0x04,
-        0x0B, 0x02, 0x6D, 0x05, 0xBB, 0x01, 0x93, 0x06, 0x6E, 0x01, 0x34, 0x07,
-        0xBE, 0x00, 0x31, 0x07, 0x86, 0xFF, 0x77, 0x06, 0x2C, 0xFE, 0x38, 0x05,
-        0x26, 0xFD, 0x9E, 0x03, 0xAD, 0xFC, 0x1D, 0x02, 0x93, 0xFC, 0x02, 0x01,
-        0x4C, 0xFC, 0x6F, 0x00, 0x8E, 0xFB, 0x5C, 0x00, 0x5F, 0xFA, 0xA0, 0x00,
-        0x45, 0xF9, 0x03, 0x01, 0x90, 0xF8, 0x1B, 0x01, 0x7D, 0xF8, 0xD9, 0x00,
-        0xF0, 0xF8, 0x35, 0x00, 0xE6, 0xF9, 0x5B, 0xFF, 0x18, 0xFB, 0x4B, 0xFE,
-        0x4A, 0xFC, 0x1A, 0xFD, 0x26, 0xFD, 0xBE, 0xFB, 0xB2, 0xFD, 0x63, 0xFA,
-        0xF9, 0xFD, 0x51, 0xF9, 0x43, 0xFE, 0xC0, 0xF8, 0xF4, 0xFE, 0xE1, 0xF8,
-        0x20, 0x00, 0xAF, 0xF9, 0x78, 0x01, 0xFC, 0xFA, 0x6F, 0x02, 0x97, 0xFC,
-        0xD8, 0x02, 0x10, 0xFE, 0xE5, 0x02, 0x21, 0xFF, 0x21, 0x03, 0xA0, 0xFF,
-        0xD5, 0x03, 0xAC, 0xFF, 0xFA, 0x04, 0x5C, 0xFF, 0x0A, 0x06, 0xF5, 0xFE,
-        0xB7, 0x06, 0xD8, 0xFE, 0xCB, 0x06, 0x19, 0xFF, 0x52, 0x06, 0xBE, 0xFF,
-        0x75, 0x05, 0xA1, 0x00, 0x59, 0x04, 0xA7, 0x01, 0x48, 0x03, 0xDB, 0x02,
-        0x82, 0x02, 0x30, 0x04, 0x0F, 0x02, 0x86, 0x05, 0xDA, 0x01, 0x96, 0x06,
-        0x9E, 0x01, 0x18, 0x07, 0xEB, 0x00, 0xF0, 0x06, 0xB4, 0xFF, 0x16, 0x06,
-        0x65, 0xFE, 0xB9, 0x04, 0x7C, 0xFD, 0x19, 0x03, 0x2C, 0xFD, 0x94, 0x01,
-        0x36, 0xFD, 0x8C, 0x00, 0x16, 0xFD, 0x13, 0x00, 0x74, 0xFC, 0x1A, 0x00,
-        0x5F, 0xFB, 0x80, 0x00, 0x40, 0xFA, 0xEF, 0x00, 0x77, 0xF9, 0x14, 0x01,
-        0x4B, 0xF9, 0xC7, 0x00, 0xA4, 0xF9, 0x22, 0x00, 0x7C, 0xFA, 0x40, 0xFF,
-        0x8F, 0xFB, 0x39, 0xFE, 0x97, 0xFC, 0x0A, 0xFD, 0x53, 0xFD, 0xB3, 0xFB,
-        0xBF, 0xFD, 0x50, 0xFA, 0xEF, 0xFD, 0x33, 0xF9, 0x2A, 0xFE, 0x97, 0xF8,
-        0xDA, 0xFE, 0xC0, 0xF8, 0x03, 0x00, 0x9E, 0xF9, 0x43, 0x01, 0x11, 0xFB,
-        0x1B, 0x02, 0xC3, 0xFC, 0x58, 0x02, 0x50, 0xFE, 0x51, 0x02, 0x63, 0xFF,
-        0x74, 0x02, 0xDA, 0xFF, 0x2B, 0x03, 0xDC, 0xFF, 0x5D, 0x04, 0x77, 0xFF,
-        0xA5, 0x05, 0x04, 0xFF, 0x86, 0x06, 0xD6, 0xFE, 0xD1, 0x06, 0x07, 0xFF,
-        0x69, 0x06, 0x9F, 0xFF, 0x87, 0x05, 0x6F, 0x00, 0x57, 0x04, 0x72, 0x01,
-        0x43, 0x03, 0x9C, 0x02, 0x87, 0x02, 0xF5, 0x03, 0x23, 0x02, 0x5B, 0x05,
-        0xFA, 0x01, 0x81, 0x06, 0xB6, 0x01, 0x1F, 0x07, 0x07, 0x01, 0xF8, 0x06,
-        0xD8, 0xFF, 0x10, 0x06, 0x9B, 0xFE, 0x9B, 0x04, 0xC7, 0xFD, 0xDA, 0x02,
-        0x6F, 0xFD, 0x3E, 0x01, 0x65, 0xFD, 0x28, 0x00, 0x15, 0xFD, 0xAF, 0xFF,
-        0x46, 0xFC, 0xC3, 0xFF, 0xFE, 0xFA, 0x2E, 0x00, 0xB0, 0xF9, 0xB5, 0x00,
-        0xD4, 0xF8, 0xF2, 0x00, 0xA1, 0xF8, 0xCC, 0x00, 0x2A, 0xF9, 0x48, 0x00,
-        0x37, 0xFA, 0x83, 0xFF, 0x7D, 0xFB, 0x9A, 0xFE, 0x9E, 0xFC, 0x80, 0xFD,
-        0x5E, 0xFD, 0x37, 0xFC, 0xC3, 0xFD, 0xD4, 0xFA, 0xEE, 0xFD, 0x9E, 0xF9,
-        0x28, 0xFE, 0xE8, 0xF8, 0xD3, 0xFE, 0xF3, 0xF8, 0xF1, 0xFF, 0xC2, 0xF9,
-        0x2F, 0x01, 0x30, 0xFB, 0x05, 0x02, 0xF3, 0xFC, 0x66, 0x02, 0x9F, 0xFE,
-        0x78, 0x02, 0xBF, 0xFF, 0xC4, 0x02, 0x4A, 0x00, 0x98, 0x03, 0x39, 0x00,
-        0xD3, 0x04, 0xCF, 0xFF, 0x17, 0x06, 0x45, 0xFF, 0xE2, 0x06, 0xF8, 0xFE,
-        0xF9, 0x06, 0x11, 0xFF, 0x61, 0x06, 0x76, 0xFF, 0x47, 0x05, 0x1A, 0x00,
-        0x05, 0x04, 0xE8, 0x00, 0xF5, 0x02, 0xED, 0x01, 0x4B, 0x02, 0x40, 0x03,
-        0xFA, 0x01, 0xAB, 0x04, 0xE5, 0x01, 0xFF, 0x05, 0xAA, 0x01, 0xBB, 0x06,
-        0x04, 0x01, 0xC1, 0x06, 0xD3, 0xFF, 0xF1, 0x05, 0x8D, 0xFE, 0x8C, 0x04,
-        0xBB, 0xFD, 0xBE, 0x02, 0x64, 0xFD, 0x0C, 0x01, 0x6E, 0xFD, 0xD3, 0xFF,
-        0x2F, 0xFD, 0x3B, 0xFF, 0x6F, 0xFC, 0x34, 0xFF, 0x2C, 0xFB, 0x9E, 0xFF,
-        0xE6, 0xF9, 0x36, 0x00, 0x0F, 0xF9, 0x96, 0x00, 0xF7, 0xF8, 0x9B, 0x00,
-        0x92, 0xF9, 0x51, 0x00, 0xAD, 0xFA, 0xD3, 0xFF, 0xF1, 0xFB, 0x1A, 0xFF,
-        0xFB, 0xFC, 0x13, 0xFE, 0xAD, 0xFD, 0xBD, 0xFC, 0xFF, 0xFD, 0x36, 0xFB,
-        0x25, 0xFE, 0xDD, 0xF9, 0x61, 0xFE, 0x0C, 0xF9, 0x05, 0xFF, 0x0C, 0xF9,
-        0x35, 0x00, 0xD1, 0xF9, 0x70, 0x01, 0x3D, 0xFB, 0x44, 0x02, 0x07, 0xFD,
-        0x88, 0x02, 0xCA, 0xFE, 0x83, 0x02, 0x10, 0x00, 0xBB, 0x02, 0xAB, 0x00,
-        0x87, 0x03, 0xAF, 0x00, 0xD3, 0x04, 0x25, 0x00, 0x20, 0x06, 0x80, 0xFF,
-        0xFA, 0x06, 0x14, 0xFF, 0x0D, 0x07, 0x18, 0xFF, 0x6A, 0x06, 0x6C, 0xFF,
-        0x4D, 0x05, 0xFD, 0xFF, 0x04, 0x04, 0xC4, 0x00, 0xF1, 0x02, 0xE3, 0x01,
-        0x41, 0x02, 0x48, 0x03, 0xEB, 0x01, 0xE1, 0x04, 0xC8, 0x01, 0x49, 0x06,
-        0x9C, 0x01, 0x1D, 0x07, 0xEA, 0x00, 0x24, 0x07, 0xC6, 0xFF, 0x57, 0x06,
-        0x7D, 0xFE, 0xF6, 0x04, 0xA1, 0xFD, 0x2D, 0x03, 0x54, 0xFD, 0x84, 0x01,
-        0x55, 0xFD, 0x4E, 0x00, 0x29, 0xFD, 0xCA, 0xFF, 0x65, 0xFC, 0xE0, 0xFF,
-        0x32, 0xFB, 0x6A, 0x00, 0xF6, 0xF9, 0x10, 0x01, 0x31, 0xF9, 0x5B, 0x01,
-        0x2A, 0xF9, 0x42, 0x01, 0xCD, 0xF9, 0xD2, 0x00, 0xF0, 0xFA, 0x33, 0x00,
-        0x38, 0xFC, 0x57, 0xFF, 0x4B, 0xFD, 0x2F, 0xFE, 0xF8, 0xFD, 0xB1, 0xFC,
-        0x45, 0xFE, 0x17, 0xFB, 0x60, 0xFE, 0xAB, 0xF9, 0x8C, 0xFE, 0xE1, 0xF8,
-        0x3B, 0xFF, 0xDA, 0xF8, 0x6D, 0x00, 0x9C, 0xF9, 0xBB, 0x01, 0xE5, 0xFA,
-        0xA0, 0x02, 0x89, 0xFC, 0xEB, 0x02, 0x21, 0xFE, 0xDA, 0x02, 0x42, 0xFF,
-        0xF4, 0x02, 0xCD, 0xFF, 0x9D, 0x03, 0xB4, 0xFF, 0xBE, 0x04, 0x39, 0xFF,
-        0xF2, 0x05, 0xA9, 0xFE, 0xB7, 0x06, 0x67, 0xFE, 0xD2, 0x06, 0x93, 0xFE,
-        0x40, 0x06, 0x10, 0xFF, 0x45, 0x05, 0xCA, 0xFF, 0x1B, 0x04, 0xBD, 0x00,
-        0x26, 0x03, 0xF4, 0x01, 0x80, 0x02, 0x79, 0x03, 0x37, 0x02, 0x10, 0x05,
-        0x1A, 0x02, 0x76, 0x06, 0xE1, 0x01, 0x42, 0x07, 0x2B, 0x01, 0x4B, 0x07,
-        0xFA, 0xFF, 0x96, 0x06, 0xC0, 0xFE, 0x4B, 0x05, 0xEC, 0xFD, 0xB2, 0x03,
-        0xB0, 0xFD, 0x20, 0x02, 0xC4, 0xFD, 0xFF, 0x00, 0xB3, 0xFD, 0x7D, 0x00,
-        0x0A, 0xFD, 0x86, 0x00, 0xE9, 0xFB, 0x0B, 0x01, 0xA8, 0xFA, 0x9B, 0x01,
-        0xCC, 0xF9, 0xE2, 0x01, 0x97, 0xF9, 0xC1, 0x01, 0x06, 0xFA, 0x41, 0x01,
-        0xE9, 0xFA, 0x94, 0x00, 0xFD, 0xFB, 0x9E, 0xFF, 0xEE, 0xFC, 0x64, 0xFE,
-        0x95, 0xFD, 0xD5, 0xFC, 0xE6, 0xFD, 0x2F, 0xFB, 0x0C, 0xFE, 0xC2, 0xF9,
-        0x4A, 0xFE, 0xF1, 0xF8, 0xFB, 0xFE, 0xF2, 0xF8, 0x29, 0x00, 0xB8, 0xF9,
-        0x6C, 0x01, 0x11, 0xFB, 0x42, 0x02, 0xB9, 0xFC, 0x95, 0x02, 0x4F, 0xFE,
-        0x7D, 0x02, 0x68, 0xFF, 0x9B, 0x02, 0xE2, 0xFF, 0x35, 0x03, 0xC3, 0xFF,
-        0x65, 0x04, 0x3C, 0xFF, 0xAA, 0x05, 0x97, 0xFE, 0x99, 0x06, 0x3B, 0xFE,
-        0xDF, 0x06, 0x46, 0xFE, 0x84, 0x06, 0xA9, 0xFE, 0xBA, 0x05, 0x5B, 0xFF,
-        0xB2, 0x04, 0x48, 0x00, 0xBC, 0x03, 0x91, 0x01, 0x11, 0x03, 0x1C, 0x03,
-        0xAB, 0x02, 0xD0, 0x04, 0x74, 0x02, 0x40, 0x06, 0x28, 0x02, 0x15, 0x07,
-        0x65, 0x01, 0x04, 0x07, 0x32, 0x00, 0x2D, 0x06, 0xE7, 0xFE, 0xC5, 0x04,
-        0x11, 0xFE, 0x1A, 0x03, 0xC6, 0xFD, 0x80, 0x01, 0xD6, 0xFD, 0x6E, 0x00,
-        0xB3, 0xFD, 0xF7, 0xFF, 0x03, 0xFD, 0x21, 0x00, 0xC9, 0xFB, 0xB8, 0x00,
-        0x70, 0xFA, 0x77, 0x01, 0x7B, 0xF9, 0xEF, 0x01, 0x24, 0xF9, 0xFD, 0x01,
-        0x75, 0xF9, 0xA7, 0x01, 0x35, 0xFA, 0x0A, 0x01, 0x43, 0xFB, 0x26, 0x00,
-        0x4D, 0xFC, 0xE0, 0xFE, 0x12, 0xFD, 0x49, 0xFD, 0x98, 0xFD, 0x8A, 0xFB,
-        0xD8, 0xFD, 0x18, 0xFA, 0x3A, 0xFE, 0x42, 0xF9, 0xEE, 0xFE, 0x4E, 0xF9,
-        0x2A, 0x00, 0x1D, 0xFA, 0x67, 0x01, 0x7E, 0xFB, 0x48, 0x02, 0x29, 0xFD,
-        0x9F, 0x02, 0xC6, 0xFE, 0x9E, 0x02, 0xE5, 0xFF, 0xDA, 0x02, 0x61, 0x00,
-        0xA0, 0x03, 0x35, 0x00, 0xF0, 0x04, 0x98, 0xFF, 0x49, 0x06, 0xCF, 0xFE,
-        0x32, 0x07, 0x53, 0xFE, 0x6D, 0x07, 0x3E, 0xFE, 0x0E, 0x07, 0x91, 0xFE,
-        0x33, 0x06, 0x32, 0xFF, 0x08, 0x05, 0x19, 0x00, 0xE8, 0x03, 0x5F, 0x01,
-        0x08, 0x03, 0x08, 0x03, 0x82, 0x02, 0xCA, 0x04, 0x37, 0x02, 0x50, 0x06,
-        0xE3, 0x01, 0x27, 0x07, 0x26, 0x01, 0x20, 0x07, 0xF6, 0xFF, 0x52, 0x06,
-        0xA7, 0xFE, 0xF8, 0x04, 0xB3, 0xFD, 0x4B, 0x03, 0x3E, 0xFD, 0xBC, 0x01,
-        0x17, 0xFD, 0x8C, 0x00, 0xC4, 0xFC, 0x0E, 0x00, 0xE3, 0xFB, 0x1A, 0x00,
-        0x93, 0xFA, 0xAA, 0x00, 0x3C, 0xF9, 0x52, 0x01, 0x6E, 0xF8, 0xBF, 0x01,
-        0x42, 0xF8, 0xC1, 0x01, 0xC0, 0xF8, 0x69, 0x01, 0xB2, 0xF9, 0xC6, 0x00,
-        0xED, 0xFA, 0xD4, 0xFF, 0x1E, 0xFC, 0x7F, 0xFE, 0xF9, 0xFC, 0xC9, 0xFC,
-        0x7F, 0xFD, 0x04, 0xFB, 0xC3, 0xFD, 0x8E, 0xF9, 0x13, 0xFE, 0xC2, 0xF8,
-        0xC4, 0xFE, 0xD4, 0xF8, 0xFA, 0xFF, 0xAE, 0xF9, 0x4E, 0x01, 0x03, 0xFB,
-        0x59, 0x02, 0xA0, 0xFC, 0xE6, 0x02, 0x16, 0xFE, 0x27, 0x03, 0x29, 0xFF,
-        0x8C, 0x03, 0xA5, 0xFF, 0x7D, 0x04, 0xA5, 0xFF, 0xC9, 0x05, 0x34, 0xFF,
-        0x0E, 0x07, 0xA5, 0xFE, 0xC9, 0x07, 0x4A, 0xFE, 0xD1, 0x07, 0x4B, 0xFE,
-        0x3C, 0x07, 0xAD, 0xFE, 0x37, 0x06, 0x57, 0xFF, 0xEA, 0x04, 0x52, 0x00,
-        0xBD, 0x03, 0xA8, 0x01, 0xD1, 0x02, 0x55, 0x03, 0x4F, 0x02, 0x11, 0x05,
-        0x05, 0x02, 0x86, 0x06, 0xB4, 0x01, 0x55, 0x07, 0xFF, 0x00, 0x3C, 0x07,
-        0xC1, 0xFF, 0x64, 0x06, 0x68, 0xFE, 0x0E, 0x05, 0x56, 0xFD, 0x85, 0x03,
-        0xC0, 0xFC, 0x20, 0x02, 0x6E, 0xFC, 0x1E, 0x01, 0xFC, 0xFB, 0x9C, 0x00,
-        0x14, 0xFB, 0x96, 0x00, 0xD8, 0xF9, 0xF7, 0x00, 0xB7, 0xF8, 0x70, 0x01,
-        0x18, 0xF8, 0xBD, 0x01, 0x30, 0xF8, 0x9F, 0x01, 0xD7, 0xF8, 0x2D, 0x01,
-        0xF1, 0xF9, 0x77, 0x00, 0x3E, 0xFB, 0x70, 0xFF, 0x74, 0xFC, 0x17, 0xFE,
-        0x56, 0xFD, 0x68, 0xFC, 0xD9, 0xFD, 0xA6, 0xFA, 0x1B, 0xFE, 0x2B, 0xF9,
-        0x66, 0xFE, 0x65, 0xF8, 0x20, 0xFF, 0x7B, 0xF8, 0x5D, 0x00, 0x66, 0xF9,
-        0xAF, 0x01, 0xB9, 0xFA, 0xAF, 0x02, 0x4F, 0xFC, 0x34, 0x03, 0xB3, 0xFD,
-        0x71, 0x03, 0xC4, 0xFE, 0xD8, 0x03, 0x4A, 0xFF, 0xA9, 0x04, 0x6B, 0xFF,
-        0xCF, 0x05, 0x1E, 0xFF, 0xE7, 0x06, 0xB8, 0xFE, 0x6E, 0x07, 0x7D, 0xFE,
-        0x56, 0x07, 0x96, 0xFE, 0xA2, 0x06, 0x00, 0xFF, 0x93, 0x05, 0xA6, 0xFF,
-        0x50, 0x04, 0xA2, 0x00, 0x20, 0x03, 0xFA, 0x01, 0x46, 0x02, 0xAC, 0x03,
-        0xC1, 0x01, 0x70, 0x05, 0x81, 0x01, 0xE4, 0x06, 0x2D, 0x01, 0x99, 0x07,
-        0x74, 0x00, 0x6B, 0x07, 0x3D, 0xFF, 0x7A, 0x06, 0x05, 0xFE, 0x1C, 0x05,
-        0x1E, 0xFD, 0x9C, 0x03, 0xB3, 0xFC, 0x30, 0x02, 0x83, 0xFC, 0x33, 0x01,
-        0x2C, 0xFC, 0x9E, 0x00, 0x67, 0xFB, 0x89, 0x00, 0x46, 0xFA, 0xC6, 0x00,
-        0x3E, 0xF9, 0x2E, 0x01, 0xBC, 0xF8, 0x69, 0x01, 0xE3, 0xF8, 0x5A, 0x01,
-        0x97, 0xF9, 0x06, 0x01, 0xA7, 0xFA, 0x63, 0x00, 0xE6, 0xFB, 0x71, 0xFF,
-        0x04, 0xFD, 0x22, 0xFE, 0xD2, 0xFD, 0x75, 0xFC, 0x3A, 0xFE, 0xCC, 0xFA,
-        0x6C, 0xFE, 0x62, 0xF9, 0xB0, 0xFE, 0xBB, 0xF8, 0x60, 0xFF, 0xDB, 0xF8,
-        0x8A, 0x00, 0xBD, 0xF9, 0xB6, 0x01, 0xFE, 0xFA, 0x95, 0x02, 0x72, 0xFC,
-        0xF7, 0x02, 0xC8, 0xFD, 0x18, 0x03, 0xB8, 0xFE, 0x5C, 0x03, 0x38, 0xFF,
-        0x11, 0x04, 0x47, 0xFF, 0x25, 0x05, 0x05, 0xFF, 0x28, 0x06, 0xB0, 0xFE,
-        0xAA, 0x06, 0x7C, 0xFE, 0x91, 0x06, 0x99, 0xFE, 0xF5, 0x05, 0xFD, 0xFE,
-        0x05, 0x05, 0xA7, 0xFF, 0xF2, 0x03, 0xA2, 0x00, 0xF0, 0x02, 0xEA, 0x01,
-        0x48, 0x02, 0x8D, 0x03, 0xF3, 0x01, 0x30, 0x05, 0xCE, 0x01, 0x95, 0x06,
-        0x91, 0x01, 0x31, 0x07, 0xDB, 0x00, 0x05, 0x07, 0xBC, 0xFF, 0x22, 0x06,
-        0x92, 0xFE, 0xDC, 0x04, 0xC4, 0xFD, 0x71, 0x03, 0x6C, 0xFD, 0x23, 0x02,
-        0x55, 0xFD, 0x3D, 0x01, 0x05, 0xFD, 0xCC, 0x00, 0x48, 0xFC, 0xB9, 0x00,
-        0x1A, 0xFB, 0xEB, 0x00, 0x0A, 0xFA, 0x33, 0x01, 0x6D, 0xF9, 0x52, 0x01,
-        0x78, 0xF9, 0x2B, 0x01, 0x01, 0xFA, 0xB4, 0x00, 0xE4, 0xFA, 0xF8, 0xFF,
-        0xEF, 0xFB, 0xF9, 0xFE, 0xDF, 0xFC, 0xA5, 0xFD, 0x85, 0xFD, 0x15, 0xFC,
-        0xCF, 0xFD, 0x7E, 0xFA, 0xE8, 0xFD, 0x49, 0xF9, 0x29, 0xFE, 0xC7, 0xF8,
-        0xCF, 0xFE, 0x0F, 0xF9, 0xEA, 0xFF, 0xF3, 0xF9, 0x07, 0x01, 0x38, 0xFB,
-        0xD1, 0x01, 0xA1, 0xFC, 0x31, 0x02, 0xF1, 0xFD, 0x59, 0x02, 0xD9, 0xFE,
-        0xB6, 0x02, 0x50, 0xFF, 0x8E, 0x03, 0x63, 0xFF, 0xC1, 0x04, 0x34, 0xFF,
-        0xDB, 0x05, 0xE2, 0xFE, 0x6C, 0x06, 0xB8, 0xFE, 0x5A, 0x06, 0xD2, 0xFE,
-        0xC9, 0x05, 0x45, 0xFF, 0xE2, 0x04, 0x01, 0x00, 0xDE, 0x03, 0x0A, 0x01,
-        0xF5, 0x02, 0x55, 0x02, 0x5E, 0x02, 0xE0, 0x03, 0x2C, 0x02, 0x5F, 0x05,
-        0x1C, 0x02, 0x8F, 0x06, 0xFA, 0x01, 0x02, 0x07, 0x51, 0x01, 0xC6, 0x06,
-        0x43, 0x00, 0xD9, 0x05, 0x18, 0xFF, 0xA0, 0x04, 0x4B, 0xFE, 0x2F, 0x03,
-        0xE6, 0xFD, 0xE5, 0x01, 0xC3, 0xFD, 0xFC, 0x00, 0x74, 0xFD, 0x81, 0x00,
-        0xAF, 0xFC, 0x63, 0x00, 0x88, 0xFB, 0x94, 0x00, 0x78, 0xFA, 0xDF, 0x00,
-        0xE3, 0xF9, 0x11, 0x01, 0xED, 0xF9, 0xFB, 0x00, 0x78, 0xFA, 0x95, 0x00,
-        0x4D, 0xFB, 0xE9, 0xFF, 0x48, 0xFC, 0xEC, 0xFE, 0x17, 0xFD, 0xAB, 0xFD,
-        0xA0, 0xFD, 0x2E, 0xFC, 0xCC, 0xFD, 0xAB, 0xFA, 0xD7, 0xFD, 0x76, 0xF9,
-        0xFA, 0xFD, 0xE8, 0xF8, 0x97, 0xFE, 0x1C, 0xF9, 0x98, 0xFF, 0xFA, 0xF9,
-        0xB1, 0x00, 0x42, 0xFB, 0x6D, 0x01, 0xB1, 0xFC, 0xBA, 0x01, 0x10, 0xFE,
-        0xCE, 0x01, 0x02, 0xFF, 0x10, 0x02, 0x99, 0xFF, 0xDB, 0x02, 0xC8, 0xFF,
-        0x09, 0x04, 0xA8, 0xFF, 0x33, 0x05, 0x54, 0xFF, 0xD6, 0x05, 0x07, 0xFF,
-        0xE4, 0x05, 0x06, 0xFF, 0x67, 0x05, 0x5C, 0xFF, 0xA3, 0x04, 0x08, 0x00,
-        0xAF, 0x03, 0xFA, 0x00, 0xDA, 0x02, 0x31, 0x02, 0x41, 0x02, 0xAB, 0x03,
-        0x00, 0x02, 0x33, 0x05, 0xF6, 0x01, 0x76, 0x06, 0xD5, 0x01, 0x0E, 0x07,
-        0x51, 0x01, 0xDE, 0x06, 0x5F, 0x00, 0xF7, 0x05, 0x58, 0xFF, 0xAE, 0x04,
-        0x9B, 0xFE, 0x33, 0x03, 0x43, 0xFE, 0xD5, 0x01, 0x1E, 0xFE, 0xC8, 0x00,
-        0xCA, 0xFD, 0x24, 0x00, 0xFB, 0xFC, 0xED, 0xFF, 0xCC, 0xFB, 0x1C, 0x00,
-        0xAF, 0xFA, 0x8F, 0x00, 0x11, 0xFA, 0xE7, 0x00, 0x16, 0xFA, 0xFC, 0x00,
-        0x99, 0xFA, 0xA2, 0x00, 0x6C, 0xFB, 0xFE, 0xFF, 0x57, 0xFC, 0x12, 0xFF,
-        0x2B, 0xFD, 0xDF, 0xFD, 0xB7, 0xFD, 0x68, 0xFC, 0xE8, 0xFD, 0xD5, 0xFA,
-        0xEA, 0xFD, 0x92, 0xF9, 0xFC, 0xFD, 0xF2, 0xF8, 0x85, 0xFE, 0x31, 0xF9,
-        0x7E, 0xFF, 0x14, 0xFA, 0x99, 0x00, 0x68, 0xFB, 0x65, 0x01, 0xDF, 0xFC,
-        0xCA, 0x01, 0x3D, 0xFE, 0xEA, 0x01, 0x4B, 0xFF, 0x32, 0x02, 0xE8, 0xFF,
-        0xF0, 0x02, 0x13, 0x00, 0x0C, 0x04, 0xD5, 0xFF, 0x1C, 0x05, 0x4F, 0xFF,
-        0xAA, 0x05, 0xE8, 0xFE, 0xA3, 0x05, 0xD0, 0xFE, 0x22, 0x05, 0x21, 0xFF,
-        0x61, 0x04, 0xC6, 0xFF, 0x89, 0x03, 0xAD, 0x00, 0xCA, 0x02, 0xDF, 0x01,
-        0x4A, 0x02, 0x5D, 0x03, 0x22, 0x02, 0xF4, 0x04, 0x20, 0x02, 0x35, 0x06,
-        0x0A, 0x02, 0xC8, 0x06, 0x81, 0x01, 0x7D, 0x06, 0x7C, 0x00, 0x8D, 0x05,
-        0x69, 0xFF, 0x42, 0x04, 0x8F, 0xFE, 0xD2, 0x02, 0x2F, 0xFE, 0x7A, 0x01,
-        0x05, 0xFE, 0x7C, 0x00, 0xC3, 0xFD, 0xE5, 0xFF, 0x10, 0xFD, 0xD3, 0xFF,
-        0xFC, 0xFB, 0x1A, 0x00, 0xF2, 0xFA, 0xA8, 0x00, 0x60, 0xFA, 0x0A, 0x01,
-        0x62, 0xFA, 0x2A, 0x01, 0xD5, 0xFA, 0xE2, 0x00, 0x89, 0xFB, 0x4C, 0x00,
-        0x58, 0xFC, 0x78, 0xFF, 0x17, 0xFD, 0x5A, 0xFE, 0x92, 0xFD, 0xF3, 0xFC,
-        0xC0, 0xFD, 0x76, 0xFB, 0xAE, 0xFD, 0x3F, 0xFA, 0xC6, 0xFD, 0xB9, 0xF9,
-        0x3C, 0xFE, 0x06, 0xFA, 0x47, 0xFF, 0xF1, 0xFA, 0x65, 0x00, 0x3C, 0xFC,
-        0x55, 0x01, 0x9D, 0xFD, 0xD7, 0x01, 0xDF, 0xFE, 0x19, 0x02, 0xB8, 0xFF,
-        0x69, 0x02, 0x24, 0x00, 0x1C, 0x03, 0x18, 0x00, 0x2E, 0x04, 0xB9, 0xFF,
-        0x37, 0x05, 0x20, 0xFF, 0xC7, 0x05, 0xA8, 0xFE, 0xC8, 0x05, 0x7F, 0xFE,
-        0x4D, 0x05, 0xB1, 0xFE, 0x9B, 0x04, 0x3C, 0xFF, 0xBD, 0x03, 0xFD, 0xFF,
-        0x00, 0x03, 0x0C, 0x01, 0x77, 0x02, 0x6A, 0x02, 0x53, 0x02, 0xE8, 0x03,
-        0x65, 0x02, 0x1F, 0x05, 0x5B, 0x02, 0xA8, 0x05, 0xE0, 0x01, 0x62, 0x05,
-        0xDB, 0x00, 0x81, 0x04, 0xB4, 0xFF, 0x4C, 0x03, 0xC2, 0xFE, 0x08, 0x02,
-        0x32, 0xFE, 0xF2, 0x00, 0xE3, 0xFD, 0x40, 0x00, 0x8B, 0xFD, 0x02, 0x00,
-        0xD4, 0xFC, 0x20, 0x00, 0xBD, 0xFB, 0x8D, 0x00, 0xB6, 0xFA, 0x1E, 0x01,
-        0x1A, 0xFA, 0x8C, 0x01, 0x1E, 0xFA, 0xAA, 0x01, 0x8F, 0xFA, 0x6A, 0x01,
-        0x4A, 0xFB, 0xDE, 0x00, 0x26, 0xFC, 0x18, 0x00, 0xF4, 0xFC, 0x0D, 0xFF,
-        0x81, 0xFD, 0xB2, 0xFD, 0xB2, 0xFD, 0x3C, 0xFC, 0xA5, 0xFD, 0x0C, 0xFB,
-        0xAA, 0xFD, 0x8A, 0xFA, 0x1B, 0xFE, 0xD0, 0xFA, 0x0C, 0xFF, 0xB5, 0xFB,
-        0x25, 0x00, 0xEA, 0xFC, 0x15, 0x01, 0x26, 0xFE, 0xAE, 0x01, 0x32, 0xFF,
-        0x0D, 0x02, 0xD1, 0xFF, 0x74, 0x02, 0xFF, 0xFF, 0x3D, 0x03, 0xD5, 0xFF,
-        0x5C, 0x04, 0x5F, 0xFF, 0x70, 0x05, 0xD8, 0xFE, 0x0C, 0x06, 0x74, 0xFE,
-        0x0F, 0x06, 0x63, 0xFE, 0x9C, 0x05, 0xA7, 0xFE, 0xD2, 0x04, 0x34, 0xFF,
-        0xE3, 0x03, 0xEC, 0xFF, 0xF6, 0x02, 0xEA, 0x00, 0x64, 0x02, 0x2B, 0x02,
-        0x36, 0x02, 0x95, 0x03, 0x55, 0x02, 0xA1, 0x04, 0x6E, 0x02, 0x0F, 0x05,
-        0x06, 0x02, 0xA5, 0x04, 0x2D, 0x01, 0xB6, 0x03, 0x0A, 0x00, 0x76, 0x02,
-        0x1A, 0xFF, 0x37, 0x01, 0x6A, 0xFE, 0x2F, 0x00, 0x06, 0xFE, 0xA1, 0xFF,
-        0x8D, 0xFD, 0x8C, 0xFF, 0xC4, 0xFC, 0xD3, 0xFF, 0x9C, 0xFB, 0x52, 0x00,
-        0x89, 0xFA, 0xE8, 0x00, 0xE6, 0xF9, 0x56, 0x01, 0xEB, 0xF9, 0x74, 0x01,
-        0x59, 0xFA, 0x45, 0x01, 0x30, 0xFB, 0xC8, 0x00, 0x26, 0xFC, 0x28, 0x00,
-        0x10, 0xFD, 0x44, 0xFF, 0xA6, 0xFD, 0x1A, 0xFE, 0xC2, 0xFD, 0xD3, 0xFC,
-        0xA5, 0xFD, 0xE1, 0xFB, 0x86, 0xFD, 0x92, 0xFB, 0xF0, 0xFD, 0x0B, 0xFC,
-        0xD2, 0xFE, 0x04, 0xFD, 0xFB, 0xFF, 0x47, 0xFE, 0xFC, 0x00, 0x7D, 0xFF,
-        0xB2, 0x01, 0x7F, 0x00, 0x24, 0x02, 0xF3, 0x00, 0x99, 0x02, 0xFB, 0x00,
-        0x6C, 0x03, 0xA1, 0x00, 0x88, 0x04, 0x13, 0x00, 0x9C, 0x05, 0x6D, 0xFF,
-        0x2E, 0x06, 0xEE, 0xFE, 0x36, 0x06, 0xC2, 0xFE, 0xC8, 0x05, 0xEE, 0xFE,
-        0x09, 0x05, 0x5E, 0xFF, 0x16, 0x04, 0x03, 0x00, 0x32, 0x03, 0xDF, 0x00,
-        0xA6, 0x02, 0x16, 0x02, 0x83, 0x02, 0x50, 0x03, 0xAD, 0x02, 0x49, 0x04,
-        0xBA, 0x02, 0x84, 0x04, 0x57, 0x02, 0x11, 0x04, 0x5E, 0x01, 0x0D, 0x03,
-        0x2B, 0x00, 0xCC, 0x01, 0x0B, 0xFF, 0x8D, 0x00, 0x49, 0xFE, 0x8D, 0xFF,
-        0xD1, 0xFD, 0x0D, 0xFF, 0x60, 0xFD, 0x0F, 0xFF, 0x9B, 0xFC, 0x5E, 0xFF,
-        0x80, 0xFB, 0xFB, 0xFF, 0x7C, 0xFA, 0xA2, 0x00, 0xE6, 0xF9, 0x2D, 0x01,
-        0xE7, 0xF9, 0x60, 0x01, 0x53, 0xFA, 0x37, 0x01, 0x17, 0xFB, 0xD7, 0x00,
-        0x10, 0xFC, 0x39, 0x00, 0xF7, 0xFC, 0x6B, 0xFF, 0x89, 0xFD, 0x40, 0xFE,
-        0xB2, 0xFD, 0x0D, 0xFD, 0x92, 0xFD, 0x20, 0xFC, 0x90, 0xFD, 0xE4, 0xFB,
-        0x0A, 0xFE, 0x58, 0xFC, 0x19, 0xFF, 0x59, 0xFD, 0x65, 0x00, 0x9D, 0xFE,
-        0x8F, 0x01, 0xE5, 0xFF, 0x45, 0x02, 0xF8, 0x00, 0xAA, 0x02, 0x87, 0x01,
-        0x05, 0x03, 0x92, 0x01, 0xBC, 0x03, 0x3D, 0x01, 0xC2, 0x04, 0x9A, 0x00,
-        0xBF, 0x05, 0xE2, 0xFF, 0x3E, 0x06, 0x46, 0xFF, 0x3D, 0x06, 0x03, 0xFF,
-        0xBD, 0x05, 0x18, 0xFF, 0xF1, 0x04, 0x6D, 0xFF, 0xEE, 0x03, 0xF9, 0xFF,
-        0x09, 0x03, 0xC8, 0x00, 0x6E, 0x02, 0xE6, 0x01, 0x47, 0x02, 0x1A, 0x03,
-        0x5B, 0x02, 0xF7, 0x03, 0x6B, 0x02, 0x3F, 0x04, 0xF3, 0x01, 0xD0, 0x03,
-        0xF3, 0x00, 0xE1, 0x02, 0xA7, 0xFF, 0xA3, 0x01, 0x88, 0xFE, 0x5D, 0x00,
-        0xD7, 0xFD, 0x46, 0xFF, 0x85, 0xFD, 0xAC, 0xFE, 0x2E, 0xFD, 0x9D, 0xFE,
-        0x83, 0xFC, 0xE9, 0xFE, 0x84, 0xFB, 0x92, 0xFF, 0x97, 0xFA, 0x4F, 0x00,
-        0x17, 0xFA, 0xF9, 0x00, 0x2E, 0xFA, 0x4F, 0x01, 0xA6, 0xFA, 0x4E, 0x01,
-        0x7F, 0xFB, 0xFB, 0x00, 0x78, 0xFC, 0x71, 0x00, 0x62, 0xFD, 0x9A, 0xFF,
-        0xFB, 0xFD, 0x7F, 0xFE, 0x1C, 0xFE, 0x51, 0xFD, 0xF1, 0xFD, 0x74, 0xFC,
-        0xCD, 0xFD, 0x24, 0xFC, 0x26, 0xFE, 0x85, 0xFC, 0x20, 0xFF, 0x5C, 0xFD,
-        0x5D, 0x00, 0x90, 0xFE, 0x74, 0x01, 0xC7, 0xFF, 0x11, 0x02, 0xE2, 0x00,
-        0x53, 0x02, 0x76, 0x01, 0x95, 0x02, 0x8F, 0x01, 0x37, 0x03, 0x3B, 0x01,
-        0x36, 0x04, 0x98, 0x00, 0x30, 0x05, 0xC3, 0xFF, 0xBA, 0x05, 0x11, 0xFF,
-        0xAE, 0x05, 0xA9, 0xFE, 0x2E, 0x05, 0xB4, 0xFE, 0x5E, 0x04, 0x0F, 0xFF,
-        0x6E, 0x03, 0xAC, 0xFF, 0x90, 0x02, 0x88, 0x00, 0x13, 0x02, 0xA4, 0x01,
-        0x02, 0x02, 0xC9, 0x02, 0x50, 0x02, 0x9A, 0x03, 0x8A, 0x02, 0xDE, 0x03,
-        0x47, 0x02, 0x6C, 0x03, 0x63, 0x01, 0x77, 0x02, 0x33, 0x00, 0x3E, 0x01,
-        0x26, 0xFF, 0xEC, 0xFF, 0x94, 0xFE, 0xDF, 0xFE, 0x57, 0xFE, 0x41, 0xFE,
-        0x14, 0xFE, 0x31, 0xFE, 0x5E, 0xFD, 0x89, 0xFE, 0x45, 0xFC, 0x3D, 0xFF,
-        0x31, 0xFB, 0x16, 0x00, 0x99, 0xFA, 0xD9, 0x00, 0x9C, 0xFA, 0x45, 0x01,
-        0x0E, 0xFB, 0x42, 0x01, 0xCA, 0xFB, 0xE4, 0x00, 0xA1, 0xFC, 0x40, 0x00,
-        0x6D, 0xFD, 0x58, 0xFF, 0xD7, 0xFD, 0x36, 0xFE, 0xE2, 0xFD, 0x0B, 0xFD,
-        0x8D, 0xFD, 0x34, 0xFC, 0x5A, 0xFD, 0x09, 0xFC, 0x95, 0xFD, 0x8D, 0xFC,
-        0x80, 0xFE, 0x9D, 0xFD, 0xAF, 0xFF, 0xDE, 0xFE, 0xCF, 0x00, 0x25, 0x00,
-        0x64, 0x01, 0x2B, 0x01, 0xAB, 0x01, 0xAF, 0x01, 0xE5, 0x01, 0xB0, 0x01,
-        0xA2, 0x02, 0x35, 0x01, 0xBD, 0x03, 0x7A, 0x00, 0xE0, 0x04, 0x81, 0xFF,
-        0x8B, 0x05, 0xB4, 0xFE, 0x98, 0x05, 0x3E, 0xFE, 0x2F, 0x05, 0x47, 0xFE,
-        0x7D, 0x04, 0xBF, 0xFE, 0xA2, 0x03, 0x86, 0xFF, 0xDF, 0x02, 0x8D, 0x00,
-        0x6A, 0x02, 0xCF, 0x01, 0x65, 0x02, 0xFF, 0x02, 0xA6, 0x02, 0xC4, 0x03,
-        0xDA, 0x02, 0xDE, 0x03, 0x81, 0x02, 0x33, 0x03, 0x8B, 0x01, 0x19, 0x02,
-        0x38, 0x00, 0xC4, 0x00, 0x10, 0xFF, 0x75, 0xFF, 0x70, 0xFE, 0x73, 0xFE,
-        0x2F, 0xFE, 0xF2, 0xFD, 0xF8, 0xFD, 0x0F, 0xFE, 0x38, 0xFD, 0x8C, 0xFE,
-        0x13, 0xFC, 0x5D, 0xFF, 0xE2, 0xFA, 0x3F, 0x00, 0x2B, 0xFA, 0x0F, 0x01,
-        0x1F, 0xFA, 0x6C, 0x01, 0x89, 0xFA, 0x5A, 0x01, 0x44, 0xFB, 0xD2, 0x00,
-        0x1D, 0xFC, 0x0B, 0x00, 0xE3, 0xFC, 0x0D, 0xFF, 0x5E, 0xFD, 0xEB, 0xFD,
-        0x6F, 0xFD, 0xDF, 0xFC, 0x45, 0xFD, 0x3A, 0xFC, 0x2C, 0xFD, 0x3D, 0xFC,
-        0x90, 0xFD, 0xEB, 0xFC, 0x91, 0xFE, 0x0E, 0xFE, 0xDE, 0xFF, 0x5F, 0xFF,
-        0xFD, 0x00, 0x9F, 0x00, 0xA7, 0x01, 0x83, 0x01, 0xE5, 0x01, 0xD4, 0x01,
-        0x3B, 0x02, 0x90, 0x01, 0x08, 0x03, 0xFB, 0x00, 0x43, 0x04, 0x22, 0x00,
-        0x86, 0x05, 0x3C, 0xFF, 0x3D, 0x06, 0x73, 0xFE, 0x4D, 0x06, 0x11, 0xFE,
-        0xDA, 0x05, 0x28, 0xFE, 0x1A, 0x05, 0xAB, 0xFE, 0x36, 0x04, 0x76, 0xFF,
-        0x63, 0x03, 0x6C, 0x00, 0xE0, 0x02, 0x8B, 0x01, 0xC9, 0x02, 0x8E, 0x02,
-        0xFA, 0x02, 0x2D, 0x03, 0x17, 0x03, 0x33, 0x03, 0xBC, 0x02, 0x94, 0x02,
-        0xBC, 0x01, 0x8D, 0x01, 0x74, 0x00, 0x5F, 0x00, 0x46, 0xFF, 0x4B, 0xFF,
-        0xA2, 0xFE, 0x92, 0xFE, 0x51, 0xFE, 0x71, 0xFE, 0xF8, 0xFD, 0xC4, 0xFE,
-        0x1B, 0xFD, 0x68, 0xFF, 0xCD, 0xFB, 0x40, 0x00, 0x7E, 0xFA, 0x26, 0x01,
-        0xB1, 0xF9, 0xEC, 0x01, 0x9C, 0xF9, 0x42, 0x02, 0x09, 0xFA, 0x23, 0x02,
-        0xCE, 0xFA, 0x8B, 0x01, 0xB2, 0xFB, 0xB8, 0x00, 0x80, 0xFC, 0xAE, 0xFF,
-        0xF9, 0xFC, 0x92, 0xFE, 0x01, 0xFD, 0x87, 0xFD, 0xC9, 0xFC, 0xDC, 0xFC,
-        0x9F, 0xFC, 0xCE, 0xFC, 0xF6, 0xFC, 0x5D, 0xFD, 0xEF, 0xFD, 0x5D, 0xFE,
-        0x38, 0xFF, 0x7F, 0xFF, 0x5F, 0x00, 0x8B, 0x00, 0x08, 0x01, 0x3A, 0x01,
-        0x5F, 0x01, 0x62, 0x01, 0xD2, 0x01, 0x0B, 0x01, 0xD0, 0x02, 0x65, 0x00,
-        0x38, 0x04, 0x88, 0xFF, 0x98, 0x05, 0xA2, 0xFE, 0x6C, 0x06, 0xE4, 0xFD,
-        0x7D, 0x06, 0x98, 0xFD, 0x0B, 0x06, 0xB7, 0xFD, 0x41, 0x05, 0x4A, 0xFE,
-        0x60, 0x04, 0x11, 0xFF, 0x96, 0x03, 0x17, 0x00, 0x24, 0x03, 0x37, 0x01,
-        0x16, 0x03, 0x50, 0x02, 0x4B, 0x03, 0x0A, 0x03, 0x63, 0x03, 0x38, 0x03,
-        0x07, 0x03, 0xB2, 0x02, 0xFA, 0x01, 0xD2, 0x01, 0xAA, 0x00, 0xAB, 0x00,
-        0x76, 0xFF, 0xA5, 0xFF, 0xC2, 0xFE, 0xE4, 0xFE, 0x60, 0xFE, 0xB7, 0xFE,
-        0xDF, 0xFD, 0x04, 0xFF, 0xE2, 0xFC, 0xA8, 0xFF, 0x77, 0xFB, 0x8D, 0x00,
-        0x1E, 0xFA, 0x80, 0x01, 0x50, 0xF9, 0x52, 0x02, 0x3F, 0xF9, 0xB3, 0x02,
-        0xBC, 0xF9, 0xB1, 0x02, 0x80, 0xFA, 0x3C, 0x02, 0x65, 0xFB, 0x8D, 0x01,
-        0x26, 0xFC, 0x98, 0x00, 0x9F, 0xFC, 0x7C, 0xFF, 0xA5, 0xFC, 0x53, 0xFE,
-        0x79, 0xFC, 0x81, 0xFD, 0x54, 0xFC, 0x31, 0xFD, 0xBE, 0xFC, 0x91, 0xFD,
-        0xBC, 0xFD, 0x62, 0xFE, 0x14, 0xFF, 0x71, 0xFF, 0x34, 0x00, 0x81, 0x00,
-        0xE6, 0x00, 0x49, 0x01, 0x3B, 0x01, 0x8D, 0x01, 0xB4, 0x01, 0x46, 0x01,
-        0xAC, 0x02, 0x9F, 0x00, 0x0C, 0x04, 0xAB, 0xFF, 0x6E, 0x05, 0xA1, 0xFE,
-        0x3C, 0x06, 0xC1, 0xFD, 0x5B, 0x06, 0x49, 0xFD, 0xDD, 0x05, 0x45, 0xFD,
-        0x1B, 0x05, 0xAD, 0xFD, 0x35, 0x04, 0x5B, 0xFE, 0x6F, 0x03, 0x4D, 0xFF,
-        0xFE, 0x02, 0x69, 0x00, 0xED, 0x02, 0x8E, 0x01, 0x1A, 0x03, 0x6F, 0x02,
-        0x2D, 0x03, 0xBE, 0x02, 0xBF, 0x02, 0x75, 0x02, 0xBA, 0x01, 0xA4, 0x01,
-        0x6C, 0x00, 0xA2, 0x00, 0x4F, 0xFF, 0x9F, 0xFF, 0xB2, 0xFE, 0xE8, 0xFE,
-        0x60, 0xFE, 0xB1, 0xFE, 0xF5, 0xFD, 0xFF, 0xFE, 0x00, 0xFD, 0xA2, 0xFF,
-        0xA5, 0xFB, 0x97, 0x00, 0x51, 0xFA, 0x97, 0x01, 0x87, 0xF9, 0x75, 0x02,
-        0x74, 0xF9, 0xE8, 0x02, 0xEA, 0xF9, 0xEA, 0x02, 0xAD, 0xFA, 0x85, 0x02,
-        0x83, 0xFB, 0xDA, 0x01, 0x48, 0xFC, 0xF0, 0x00, 0xB1, 0xFC, 0xD2, 0xFF,
-        0xCD, 0xFC, 0xB0, 0xFE, 0xA4, 0xFC, 0xD3, 0xFD, 0x9E, 0xFC, 0x85, 0xFD,
-        0x0B, 0xFD, 0xE0, 0xFD, 0x10, 0xFE, 0xA8, 0xFE, 0x53, 0xFF, 0xA8, 0xFF,
-        0x67, 0x00, 0x98, 0x00, 0x05, 0x01, 0x41, 0x01, 0x59, 0x01, 0x62, 0x01,
-        0xC8, 0x01, 0x0C, 0x01, 0xB7, 0x02, 0x58, 0x00, 0x05, 0x04, 0x69, 0xFF,
-        0x4C, 0x05, 0x61, 0xFE, 0x18, 0x06, 0x8A, 0xFD, 0x32, 0x06, 0x0C, 0xFD,
-        0xD4, 0x05, 0x0E, 0xFD, 0x25, 0x05, 0x6D, 0xFD, 0x65, 0x04, 0x1D, 0xFE,
-        0xAD, 0x03, 0x07, 0xFF, 0x3C, 0x03, 0x1C, 0x00, 0x1C, 0x03, 0x39, 0x01,
-        0x29, 0x03, 0x03, 0x02, 0x25, 0x03, 0x45, 0x02, 0xA2, 0x02, 0xE0, 0x01,
-        0x96, 0x01, 0x0D, 0x01, 0x4E, 0x00, 0x0E, 0x00, 0x4E, 0xFF, 0x25, 0xFF,
-        0xC5, 0xFE, 0x85, 0xFE, 0x98, 0xFE, 0x73, 0xFE, 0x3A, 0xFE, 0xCE, 0xFE,
-        0x59, 0xFD, 0x8A, 0xFF, 0xFF, 0xFB, 0x7B, 0x00, 0xA4, 0xFA, 0x82, 0x01,
-        0xC5, 0xF9, 0x5E, 0x02, 0x95, 0xF9, 0xD6, 0x02, 0xF4, 0xF9, 0xD6, 0x02,
-        0x9B, 0xFA, 0x66, 0x02, 0x69, 0xFB, 0xAE, 0x01, 0x23, 0xFC, 0xB5, 0x00,
-        0xA3, 0xFC, 0x9E, 0xFF, 0xD6, 0xFC, 0x8A, 0xFE, 0xD6, 0xFC, 0xC8, 0xFD,
-        0xE6, 0xFC, 0x96, 0xFD, 0x67, 0xFD, 0x06, 0xFE, 0x54, 0xFE, 0xDD, 0xFE,
-        0x83, 0xFF, 0xE1, 0xFF, 0x5C, 0x00, 0xC9, 0x00, 0xDB, 0x00, 0x68, 0x01,
-        0x01, 0x01, 0x82, 0x01, 0x6B, 0x01, 0x30, 0x01, 0x5A, 0x02, 0x81, 0x00,
-        0xCA, 0x03, 0x98, 0xFF, 0x40, 0x05, 0x8D, 0xFE, 0x30, 0x06, 0xA1, 0xFD,
-        0x6E, 0x06, 0x1D, 0xFD, 0x1C, 0x06, 0x0E, 0xFD, 0x70, 0x05, 0x84, 0xFD,
-        0xA8, 0x04, 0x3D, 0xFE, 0xDB, 0x03, 0x37, 0xFF, 0x44, 0x03, 0x46, 0x00,
-        0xFC, 0x02, 0x4E, 0x01, 0xEC, 0x02, 0x08, 0x02, 0xDF, 0x02, 0x2F, 0x02,
-        0x7D, 0x02, 0xB9, 0x01, 0xA3, 0x01, 0xD8, 0x00, 0x97, 0x00, 0xD6, 0xFF,
-        0xC1, 0xFF, 0xED, 0xFE, 0x4A, 0xFF, 0x48, 0xFE, 0x1B, 0xFF, 0x15, 0xFE,
-        0xAD, 0xFE, 0x5A, 0xFE, 0xAF, 0xFD, 0xFA, 0xFE, 0x2C, 0xFC, 0xF3, 0xFF,
-        0xA0, 0xFA, 0x15, 0x01, 0x9A, 0xF9, 0x22, 0x02, 0x4E, 0xF9, 0xCA, 0x02,
-        0xB3, 0xF9, 0xE6, 0x02, 0x74, 0xFA, 0x82, 0x02, 0x69, 0xFB, 0xCA, 0x01,
-        0x4C, 0xFC, 0xD8, 0x00, 0xFB, 0xFC, 0xC4, 0xFF, 0x4F, 0xFD, 0xB6, 0xFE,
-        0x6B, 0xFD, 0xF5, 0xFD, 0x76, 0xFD, 0xCE, 0xFD, 0xD5, 0xFD, 0x43, 0xFE,
-        0x94, 0xFE, 0x23, 0xFF, 0x92, 0xFF, 0x25, 0x00, 0x52, 0x00, 0x17, 0x01,
-        0xC3, 0x00, 0xC3, 0x01, 0xF0, 0x00, 0x01, 0x02, 0x58, 0x01, 0xB7, 0x01,
-        0x54, 0x02, 0x08, 0x01, 0xD3, 0x03, 0xFA, 0xFF, 0x5D, 0x05, 0xB2, 0xFE,
-        0x68, 0x06, 0x90, 0xFD, 0xB2, 0x06, 0xD0, 0xFC, 0x58, 0x06, 0xBB, 0xFC,
-        0x9A, 0x05, 0x1C, 0xFD, 0xB1, 0x04, 0xE3, 0xFD, 0xCA, 0x03, 0xD0, 0xFE,
-        0x1B, 0x03, 0xF2, 0xFF, 0xB5, 0x02, 0xFB, 0x00, 0x8B, 0x02, 0xBC, 0x01,
-        0x72, 0x02, 0xE8, 0x01, 0x19, 0x02, 0x7B, 0x01, 0x5F, 0x01, 0xAC, 0x00,
-        0x88, 0x00, 0xB7, 0xFF, 0xD0, 0xFF, 0xD2, 0xFE, 0x81, 0xFF, 0x27, 0xFE,
-        0x5F, 0xFF, 0xEF, 0xFD, 0x13, 0xFF, 0x2F, 0xFE, 0x29, 0xFE, 0xE0, 0xFE,
-        0xC0, 0xFC, 0xE8, 0xFF, 0x32, 0xFB, 0x2E, 0x01, 0x1F, 0xFA, 0x4C, 0x02,
-        0xB4, 0xF9, 0x08, 0x03, 0xEE, 0xF9, 0x25, 0x03, 0x8F, 0xFA, 0xB8, 0x02,
-        0x5D, 0xFB, 0xFC, 0x01, 0x30, 0xFC, 0xF7, 0x00, 0xCF, 0xFC, 0xE5, 0xFF,
-        0x37, 0xFD, 0xCC, 0xFE, 0x69, 0xFD, 0x14, 0xFE, 0x9A, 0xFD, 0xD9, 0xFD,
-        0xF9, 0xFD, 0x3F, 0xFE, 0xBD, 0xFE, 0x0B, 0xFF, 0x91, 0xFF, 0x03, 0x00,
-        0x3F, 0x00, 0xF4, 0x00, 0x85, 0x00, 0x9C, 0x01, 0x8F, 0x00, 0xE1, 0x01,
-        0xD4, 0x00, 0xA8, 0x01, 0xB1, 0x01, 0x10, 0x01, 0x29, 0x03, 0x19, 0x00,
-        0xBD, 0x04, 0xEB, 0xFE, 0xF3, 0x05, 0xCC, 0xFD, 0x79, 0x06, 0x18, 0xFD,
-        0x62, 0x06, 0xF1, 0xFC, 0xE4, 0x05, 0x5E, 0xFD, 0x27, 0x05, 0x22, 0xFE,
-        0x69, 0x04, 0x20, 0xFF, 0xD1, 0x03, 0x40, 0x00, 0x65, 0x03, 0x48, 0x01,
-        0x31, 0x03, 0x06, 0x02, 0xFB, 0x02, 0x32, 0x02, 0x95, 0x02, 0xC3, 0x01,
-        0xD6, 0x01, 0xE3, 0x00, 0xF3, 0x00, 0xD8, 0xFF, 0x39, 0x00, 0xE4, 0xFE,
-        0xDC, 0xFF, 0x35, 0xFE, 0xB5, 0xFF, 0xFD, 0xFD, 0x62, 0xFF, 0x2F, 0xFE,
-        0x6D, 0xFE, 0xCB, 0xFE, 0xF2, 0xFC, 0xB8, 0xFF, 0x59, 0xFB, 0xD9, 0x00,
-        0x24, 0xFA, 0xE9, 0x01, 0xAA, 0xF9, 0x95, 0x02, 0xCA, 0xF9, 0xB1, 0x02,
-        0x5E, 0xFA, 0x4E, 0x02, 0x1C, 0xFB, 0x8B, 0x01, 0xD7, 0xFB, 0xA4, 0x00,
-        0x63, 0xFC, 0x92, 0xFF, 0xB9, 0xFC, 0xA2, 0xFE, 0xE5, 0xFC, 0xEF, 0xFD,
-        0x0B, 0xFD, 0xD6, 0xFD, 0x6D, 0xFD, 0x56, 0xFE, 0x2B, 0xFE, 0x45, 0xFF,
-        0x1D, 0xFF, 0x61, 0x00, 0xE5, 0xFF, 0x5A, 0x01, 0x5C, 0x00, 0x06, 0x02,
-        0x83, 0x00, 0x3A, 0x02, 0xE0, 0x00, 0xF5, 0x01, 0xB9, 0x01, 0x54, 0x01,
-        0x25, 0x03, 0x63, 0x00, 0xA0, 0x04, 0x44, 0xFF, 0xC3, 0x05, 0x3C, 0xFE,
-        0x32, 0x06, 0x8A, 0xFD, 0x13, 0x06, 0x5B, 0xFD, 0x8D, 0x05, 0xA7, 0xFD,
-        0xE3, 0x04, 0x47, 0xFE, 0x44, 0x04, 0x2A, 0xFF, 0xCD, 0x03, 0x34, 0x00,
-        0x83, 0x03, 0x3E, 0x01, 0x59, 0x03, 0xFC, 0x01, 0x2E, 0x03, 0x3A, 0x02,
-        0xBD, 0x02, 0xCF, 0x01, 0xFB, 0x01, 0xF6, 0x00, 0x03, 0x01, 0xEE, 0xFF,
-        0x40, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x65, 0xFE, 0xBB, 0xFF, 0x3A, 0xFE,
-        0x74, 0xFF, 0x7F, 0xFE, 0xB0, 0xFE, 0x22, 0xFF, 0x57, 0xFD, 0x10, 0x00,
-        0xD5, 0xFB, 0x30, 0x01, 0xAE, 0xFA, 0x44, 0x02, 0x1E, 0xFA, 0x08, 0x03,
-        0x33, 0xFA, 0x53, 0x03, 0xA1, 0xFA, 0x13, 0x03, 0x45, 0xFB, 0x74, 0x02,
-        0xD2, 0xFB, 0x78, 0x01, 0x44, 0xFC, 0x4D, 0x00, 0x87, 0xFC, 0x1D, 0xFF,
-        0xAE, 0xFC, 0x3A, 0xFE, 0xDD, 0xFC, 0xE8, 0xFD, 0x41, 0xFD, 0x41, 0xFE,
-        0x00, 0xFE, 0x1B, 0xFF, 0xEC, 0xFE, 0x1E, 0x00, 0xA7, 0xFF, 0x08, 0x01,
-        0x10, 0x00, 0xA1, 0x01, 0x2F, 0x00, 0xC5, 0x01, 0x77, 0x00, 0x7E, 0x01,
-        0x4D, 0x01, 0xDC, 0x00, 0xAA, 0x02, 0xEB, 0xFF, 0x34, 0x04, 0xD5, 0xFE,
-        0x66, 0x05, 0xBC, 0xFD, 0xF6, 0x05, 0xFE, 0xFC, 0xEA, 0x05, 0xB9, 0xFC,
-        0x74, 0x05, 0x04, 0xFD, 0xCD, 0x04, 0xBB, 0xFD, 0x36, 0x04, 0xBD, 0xFE,
-        0xC3, 0x03, 0xED, 0xFF, 0x80, 0x03, 0x15, 0x01, 0x60, 0x03, 0xF2, 0x01,
-        0x3F, 0x03, 0x41, 0x02, 0xED, 0x02, 0xE2, 0x01, 0x36, 0x02, 0x12, 0x01,
-        0x57, 0x01, 0x17, 0x00, 0x89, 0x00, 0x43, 0xFF, 0x16, 0x00, 0xB8, 0xFE,
-        0xDA, 0xFF, 0x99, 0xFE, 0x78, 0xFF, 0xD7, 0xFE, 0x92, 0xFE, 0x76, 0xFF,
-        0x23, 0xFD, 0x52, 0x00, 0x96, 0xFB, 0x67, 0x01, 0x6C, 0xFA, 0x6B, 0x02,
-        0xE9, 0xF9, 0x25, 0x03, 0x10, 0xFA, 0x57, 0x03, 0x9E, 0xFA, 0x0B, 0x03,
-        0x56, 0xFB, 0x54, 0x02, 0xFE, 0xFB, 0x5F, 0x01, 0x78, 0xFC, 0x42, 0x00,
-        0xBA, 0xFC, 0x27, 0xFF, 0xDF, 0xFC, 0x56, 0xFE, 0xF5, 0xFC, 0x0C, 0xFE,
-        0x51, 0xFD, 0x66, 0xFE, 0xF9, 0xFD, 0x32, 0xFF, 0xE0, 0xFE, 0x2D, 0x00,
-        0x9F, 0xFF, 0x04, 0x01, 0x12, 0x00, 0x93, 0x01, 0x48, 0x00, 0xB5, 0x01,
-        0xA1, 0x00, 0x72, 0x01, 0x87, 0x01, 0xD8, 0x00, 0xEB, 0x02, 0xFB, 0xFF,
-        0x72, 0x04, 0xE7, 0xFE, 0x8F, 0x05, 0xDF, 0xFD, 0x01, 0x06, 0x2B, 0xFD,
-        0xCC, 0x05, 0xEC, 0xFC, 0x35, 0x05, 0x40, 0xFD, 0x73, 0x04, 0xE4, 0xFD,
-        0xC4, 0x03, 0xDA, 0xFE, 0x48, 0x03, 0xE7, 0xFF, 0xF5, 0x02, 0xFC, 0x00,
-        0xD7, 0x02, 0xBF, 0x01, 0xB3, 0x02, 0xFB, 0x01, 0x6D, 0x02, 0x90, 0x01,
-        0xCF, 0x01, 0xAC, 0x00, 0xFE, 0x00, 0xA7, 0xFF, 0x4C, 0x00, 0xC0, 0xFE,
-        0xDC, 0xFF, 0x33, 0xFE, 0xAD, 0xFF, 0x19, 0xFE, 0x4C, 0xFF, 0x6C, 0xFE,
-        0x68, 0xFE, 0x1A, 0xFF, 0xF1, 0xFC, 0x05, 0x00, 0x63, 0xFB, 0x19, 0x01,
-        0x42, 0xFA, 0x22, 0x02, 0xD2, 0xF9, 0xDC, 0x02, 0x21, 0xFA, 0x15, 0x03,
-        0xC6, 0xFA, 0xCB, 0x02, 0xA4, 0xFB, 0x16, 0x02, 0x58, 0xFC, 0x2D, 0x01,
-        0xDA, 0xFC, 0x23, 0x00, 0x1A, 0xFD, 0x33, 0xFF, 0x2D, 0xFD, 0x7E, 0xFE,
-        0x38, 0xFD, 0x50, 0xFE, 0x78, 0xFD, 0xBB, 0xFE, 0x17, 0xFE, 0x8D, 0xFF,
-        0xF6, 0xFE, 0x8A, 0x00, 0xC6, 0xFF, 0x5A, 0x01, 0x4D, 0x00, 0xD4, 0x01,
-        0xA2, 0x00, 0xE6, 0x01, 0x11, 0x01, 0x8A, 0x01, 0x07, 0x02, 0xE4, 0x00,
-        0x79, 0x03, 0x04, 0x00, 0xF7, 0x04, 0xF2, 0xFE, 0x08, 0x06, 0xF5, 0xFD,
-        0x4B, 0x06, 0x37, 0xFD, 0xED, 0x05, 0xFF, 0xFC, 0x1F, 0x05, 0x42, 0xFD,
-        0x39, 0x04, 0xE6, 0xFD, 0x79, 0x03, 0xBF, 0xFE, 0xFD, 0x02, 0xAF, 0xFF,
-        0xCB, 0x02, 0x93, 0x00, 0xC0, 0x02, 0x3E, 0x01, 0xBF, 0x02, 0x7A, 0x01,
-        0x81, 0x02, 0x2D, 0x01, 0xDF, 0x01, 0x80, 0x00, 0xF8, 0x00, 0xA7, 0xFF,
-        0x18, 0x00, 0xE7, 0xFE, 0x7B, 0xFF, 0x63, 0xFE, 0x14, 0xFF, 0x43, 0xFE,
-        0x94, 0xFE, 0x7D, 0xFE, 0xA2, 0xFD, 0x03, 0xFF, 0x3A, 0xFC, 0xC6, 0xFF,
-        0xD7, 0xFA, 0xB4, 0x00, 0xE9, 0xF9, 0xA6, 0x01, 0xB9, 0xF9, 0x4E, 0x02,
-        0x31, 0xFA, 0x87, 0x02, 0xFD, 0xFA, 0x3E, 0x02, 0xE7, 0xFB, 0xA8, 0x01,
-        0xA3, 0xFC, 0xDB, 0x00, 0x18, 0xFD, 0x00, 0x00, 0x42, 0xFD, 0x28, 0xFF,
-        0x42, 0xFD, 0x7A, 0xFE, 0x33, 0xFD, 0x31, 0xFE, 0x6E, 0xFD, 0x6E, 0xFE,
-        0x03, 0xFE, 0x0F, 0xFF, 0xE4, 0xFE, 0xE6, 0xFF, 0xB8, 0xFF, 0xB0, 0x00,
-        0x4D, 0x00, 0x45, 0x01, 0xB3, 0x00, 0x80, 0x01, 0x34, 0x01, 0x5A, 0x01,
-        0x32, 0x02, 0xE7, 0x00, 0x97, 0x03, 0x37, 0x00, 0x01, 0x05, 0x69, 0xFF,
-        0xE9, 0x05, 0xA0, 0xFE, 0x10, 0x06, 0x20, 0xFE, 0x90, 0x05, 0x01, 0xFE,
-        0xB7, 0x04, 0x43, 0xFE, 0xC1, 0x03, 0xCC, 0xFE, 0xFE, 0x02, 0x75, 0xFF,
-        0x89, 0x02, 0x2E, 0x00, 0x64, 0x02, 0xE5, 0x00, 0x7A, 0x02, 0x71, 0x01,
-        0x8A, 0x02, 0xAF, 0x01, 0x65, 0x02, 0x6B, 0x01, 0xCE, 0x01, 0xCD, 0x00,
-        0xF8, 0x00, 0x00, 0x00, 0x31, 0x00, 0x3B, 0xFF, 0xA1, 0xFF, 0xB8, 0xFE,
-        0x48, 0xFF, 0x7D, 0xFE, 0xBB, 0xFE, 0xAE, 0xFE, 0xBB, 0xFD, 0x0E, 0xFF,
-        0x47, 0xFC, 0xA4, 0xFF, 0xE1, 0xFA, 0x4B, 0x00, 0x04, 0xFA, 0xE8, 0x00,
-        0xEE, 0xF9, 0x4F, 0x01, 0x7F, 0xFA, 0x50, 0x01, 0x6B, 0xFB, 0x0B, 0x01,
-        0x62, 0xFC, 0x86, 0x00, 0x30, 0xFD, 0xEF, 0xFF, 0x9E, 0xFD, 0x4C, 0xFF,
-        0xC5, 0xFD, 0xAC, 0xFE, 0xAC, 0xFD, 0x2E, 0xFE, 0x95, 0xFD, 0x01, 0xFE,
-        0xB0, 0xFD, 0x45, 0xFE, 0x39, 0xFE, 0xDB, 0xFE, 0x00, 0xFF, 0x9A, 0xFF,
-        0xC6, 0xFF, 0x4D, 0x00, 0x4C, 0x00, 0xD0, 0x00, 0xA9, 0x00, 0x05, 0x01,
-        0x36, 0x01, 0xE5, 0x00, 0x34, 0x02, 0x93, 0x00, 0xA7, 0x03, 0x18, 0x00,
-        0x02, 0x05, 0x9A, 0xFF, 0xD7, 0x05, 0x14, 0xFF, 0xE9, 0x05, 0xDD, 0xFE,
-        0x49, 0x05, 0xE3, 0xFE, 0x5F, 0x04, 0x49, 0xFF, 0x5C, 0x03, 0xC6, 0xFF,
-        0x89, 0x02, 0x60, 0x00, 0x0C, 0x02, 0xEE, 0x00, 0xDA, 0x01, 0x86, 0x01,
-        0xE6, 0x01, 0xF6, 0x01, 0x01, 0x02, 0x1C, 0x02, 0xE0, 0x01, 0xD5, 0x01,
-        0x63, 0x01, 0x29, 0x01, 0x98, 0x00, 0x61, 0x00, 0xE4, 0xFF, 0x98, 0xFF,
-        0x61, 0xFF, 0x14, 0xFF, 0x18, 0xFF, 0xDE, 0xFE, 0x99, 0xFE, 0x01, 0xFF,
-        0xA1, 0xFD, 0x5B, 0xFF, 0x2E, 0xFC, 0xD3, 0xFF, 0xCA, 0xFA, 0x5D, 0x00,
-        0xE7, 0xF9, 0xD2, 0x00, 0xDC, 0xF9, 0x0B, 0x01, 0x74, 0xFA, 0xF1, 0x00,
-        0x6E, 0xFB, 0x90, 0x00, 0x6F, 0xFC, 0x17, 0x00, 0x39, 0xFD, 0x88, 0xFF,
-        0xB5, 0xFD, 0xFC, 0xFE, 0xDA, 0xFD, 0x66, 0xFE, 0xCF, 0xFD, 0xF2, 0xFD,
-        0xB6, 0xFD, 0xC9, 0xFD, 0xD6, 0xFD, 0x14, 0xFE, 0x4F, 0xFE, 0xC2, 0xFE,
-        0x16, 0xFF, 0x9D, 0xFF, 0xC7, 0xFF, 0x67, 0x00, 0x4C, 0x00, 0xFA, 0x00,
-        0x9F, 0x00, 0x29, 0x01, 0x23, 0x01, 0x07, 0x01, 0x29, 0x02, 0xA5, 0x00,
-        0x9D, 0x03, 0x26, 0x00, 0x0F, 0x05, 0xA5, 0xFF, 0xF1, 0x05, 0x2D, 0xFF,
-        0x05, 0x06, 0x04, 0xFF, 0x68, 0x05, 0x13, 0xFF, 0x7C, 0x04, 0x71, 0xFF,
-        0x7F, 0x03, 0xE0, 0xFF, 0xBE, 0x02, 0x61, 0x00, 0x4C, 0x02, 0xF2, 0x00,
-        0x27, 0x02, 0x81, 0x01, 0x35, 0x02, 0x08, 0x02, 0x50, 0x02, 0x31, 0x02,
-        0x2D, 0x02, 0xF0, 0x01, 0xB3, 0x01, 0x39, 0x01, 0xE8, 0x00, 0x5C, 0x00,
-        0x32, 0x00, 0x86, 0xFF, 0x9F, 0xFF, 0xEE, 0xFE, 0x49, 0xFF, 0xB0, 0xFE,
-        0xBF, 0xFE, 0xC8, 0xFE, 0xB9, 0xFD, 0x1B, 0xFF, 0x48, 0xFC, 0x8B, 0xFF,
-        0xCF, 0xFA, 0x06, 0x00, 0xED, 0xF9, 0x70, 0x00, 0xD4, 0xF9, 0xB5, 0x00,
-        0x73, 0xFA, 0xA4, 0x00, 0x65, 0xFB, 0x6C, 0x00, 0x62, 0xFC, 0x01, 0x00,
-        0x29, 0xFD, 0x93, 0xFF, 0xA4, 0xFD, 0x0D, 0xFF, 0xD5, 0xFD, 0x84, 0xFE,
-        0xDD, 0xFD, 0x0B, 0xFE, 0xD7, 0xFD, 0xE3, 0xFD, 0x09, 0xFE, 0x2E, 0xFE,
-        0x87, 0xFE, 0xDF, 0xFE, 0x46, 0xFF, 0xBD, 0xFF, 0xF2, 0xFF, 0x92, 0x00,
-        0x6F, 0x00, 0x2A, 0x01, 0xBB, 0x00, 0x6F, 0x01, 0x36, 0x01, 0x63, 0x01,
-        0x35, 0x02, 0x19, 0x01, 0xA9, 0x03, 0xC3, 0x00, 0x22, 0x05, 0x4F, 0x00,
-        0x0E, 0x06, 0xEC, 0xFF, 0x22, 0x06, 0xA9, 0xFF, 0x88, 0x05, 0xA7, 0xFF,
-        0x85, 0x04, 0xDD, 0xFF, 0x8A, 0x03, 0x29, 0x00, 0xB1, 0x02, 0x7F, 0x00,
-        0x3B, 0x02, 0xE1, 0x00, 0xFF, 0x01, 0x49, 0x01, 0xFD, 0x01, 0xA6, 0x01,
-        0x00, 0x02, 0xB7, 0x01, 0xD8, 0x01, 0x6C, 0x01, 0x63, 0x01, 0xB9, 0x00,
-        0xAE, 0x00, 0xE6, 0xFF, 0x0A, 0x00, 0x25, 0xFF, 0x90, 0xFF, 0x95, 0xFE,
-        0x4B, 0xFF, 0x61, 0xFE, 0xD2, 0xFE, 0x6B, 0xFE, 0xDD, 0xFD, 0xAB, 0xFE,
-        0x66, 0xFC, 0xFB, 0xFE, 0xF0, 0xFA, 0x64, 0xFF, 0x00, 0xFA, 0xC4, 0xFF,
-        0xEA, 0xF9, 0x07, 0x00, 0x8A, 0xFA, 0x10, 0x00, 0x8C, 0xFB, 0xE4, 0xFF,
-        0x90, 0xFC, 0xAA, 0xFF, 0x66, 0xFD, 0x6B, 0xFF, 0xE0, 0xFD, 0x26, 0xFF,
-        0x1C, 0xFE, 0xDA, 0xFE, 0x21, 0xFE, 0x9E, 0xFE, 0x1D, 0xFE, 0x95, 0xFE,
-        0x3B, 0xFE, 0xF0, 0xFE, 0xA5, 0xFE, 0x90, 0xFF, 0x4D, 0xFF, 0x55, 0x00,
-        0xF6, 0xFF, 0x09, 0x01, 0x7A, 0x00, 0x82, 0x01, 0xD3, 0x00, 0xB8, 0x01,
-        0x59, 0x01, 0xA4, 0x01, 0x55, 0x02, 0x6D, 0x01, 0xC9, 0x03, 0x25, 0x01,
-        0x39, 0x05, 0xCD, 0x00, 0x27, 0x06, 0x7C, 0x00, 0x3D, 0x06, 0x47, 0x00,
-        0x9F, 0x05, 0x4B, 0x00, 0x9E, 0x04, 0x6F, 0x00, 0x96, 0x03, 0xA2, 0x00,
-        0xC4, 0x02, 0xD6, 0x00, 0x45, 0x02, 0x0E, 0x01, 0x11, 0x02, 0x5D, 0x01,
-        0x07, 0x02, 0x95, 0x01, 0x16, 0x02, 0xAA, 0x01, 0xF8, 0x01, 0x5B, 0x01,
-        0x96, 0x01, 0xBE, 0x00, 0xEB, 0x00, 0xFA, 0xFF, 0x3C, 0x00, 0x3E, 0xFF,
-        0xAF, 0xFF, 0xB0, 0xFE, 0x4B, 0xFF, 0x6E, 0xFE, 0xB9, 0xFE, 0x69, 0xFE,
-        0xB9, 0xFD, 0x8E, 0xFE, 0x38, 0xFC, 0xC8, 0xFE, 0xC5, 0xFA, 0x12, 0xFF,
-        0xCD, 0xF9, 0x60, 0xFF, 0xB5, 0xF9, 0x98, 0xFF, 0x55, 0xFA, 0xA3, 0xFF,
-        0x5D, 0xFB, 0x8D, 0xFF, 0x69, 0xFC, 0x66, 0xFF, 0x3B, 0xFD, 0x34, 0xFF,
-        0xB3, 0xFD, 0xF2, 0xFE, 0xDE, 0xFD, 0xA2, 0xFE, 0xDD, 0xFD, 0x55, 0xFE,
-        0xCF, 0xFD, 0x3E, 0xFE, 0xED, 0xFD, 0x79, 0xFE, 0x57, 0xFE, 0x0F, 0xFF,
-        0x08, 0xFF, 0xD9, 0xFF, 0xBD, 0xFF, 0xA0, 0x00, 0x56, 0x00, 0x49, 0x01,
-        0xD0, 0x00, 0xA7, 0x01, 0x6C, 0x01, 0xBF, 0x01, 0x82, 0x02, 0xAD, 0x01,
-        0xF4, 0x03, 0x70, 0x01, 0x67, 0x05, 0x29, 0x01, 0x48, 0x06, 0xD2, 0x00,
-        0x5E, 0x06, 0x9B, 0x00, 0xBB, 0x05, 0x90, 0x00, 0xBE, 0x04, 0xA5, 0x00,
-        0xBC, 0x03, 0xCB, 0x00, 0xF5, 0x02, 0xF9, 0x00, 0x87, 0x02, 0x35, 0x01,
-        0x5F, 0x02, 0x89, 0x01, 0x66, 0x02, 0xE1, 0x01, 0x6E, 0x02, 0x09, 0x02,
-        0x47, 0x02, 0xE6, 0x01, 0xCD, 0x01, 0x50, 0x01, 0x11, 0x01, 0x8A, 0x00,
-        0x57, 0x00, 0xAB, 0xFF, 0xBD, 0xFF, 0xEC, 0xFE, 0x4C, 0xFF, 0x75, 0xFE,
-        0xB1, 0xFE, 0x3E, 0xFE, 0xA6, 0xFD, 0x4E, 0xFE, 0x36, 0xFC, 0x79, 0xFE,
-        0xC8, 0xFA, 0xC6, 0xFE, 0xE6, 0xF9, 0x0F, 0xFF, 0xC4, 0xF9, 0x3D, 0xFF,
-        0x5E, 0xFA, 0x49, 0xFF, 0x48, 0xFB, 0x37, 0xFF, 0x51, 0xFC, 0x2C, 0xFF,
-        0x11, 0xFD, 0x16, 0xFF, 0x87, 0xFD, 0xE9, 0xFE, 0xA9, 0xFD, 0xA0, 0xFE,
-        0x97, 0xFD, 0x46, 0xFE, 0x8A, 0xFD, 0x17, 0xFE, 0xAA, 0xFD, 0x49, 0xFE,
-        0x22, 0xFE, 0xDE, 0xFE, 0xD5, 0xFE, 0xBA, 0xFF, 0x89, 0xFF, 0xA1, 0x00,
-        0x1D, 0x00, 0x6E, 0x01, 0x8D, 0x00, 0xF1, 0x01, 0x33, 0x01, 0x24, 0x02,
-        0x46, 0x02, 0x18, 0x02, 0xC3, 0x03, 0xDE, 0x01, 0x2F, 0x05, 0x91, 0x01,
-        0x19, 0x06, 0x3C, 0x01, 0x38, 0x06, 0x0D, 0x01, 0xB6, 0x05, 0xFF, 0x00,
-        0xCE, 0x04, 0xFC, 0x00, 0xDB, 0x03, 0xF1, 0x00, 0x0F, 0x03, 0xE1, 0x00,
-        0x89, 0x02, 0xEC, 0x00, 0x61, 0x02, 0x1E, 0x01, 0x5C, 0x02, 0x62, 0x01,
-        0x7F, 0x02, 0x82, 0x01, 0x60, 0x02, 0x50, 0x01, 0x00, 0x02, 0xBA, 0x00,
-        0x56, 0x01, 0xF0, 0xFF, 0xB1, 0x00, 0x16, 0xFF, 0x26, 0x00, 0x5B, 0xFE,
-        0xB9, 0xFF, 0xE4, 0xFD, 0x11, 0xFF, 0xC1, 0xFD, 0xF8, 0xFD, 0xD7, 0xFD,
-        0x7B, 0xFC, 0x20, 0xFE, 0x06, 0xFB, 0x7E, 0xFE, 0x24, 0xFA, 0xDE, 0xFE,
-        0xF4, 0xF9, 0x20, 0xFF, 0x7C, 0xFA, 0x40, 0xFF, 0x57, 0xFB, 0x5D, 0xFF,
-        0x52, 0xFC, 0x86, 0xFF, 0x21, 0xFD, 0xAE, 0xFF, 0xAA, 0xFD, 0xA6, 0xFF,
-        0xDD, 0xFD, 0x73, 0xFF, 0xD3, 0xFD, 0x1A, 0xFF, 0xB6, 0xFD, 0xEB, 0xFE,
-        0xBE, 0xFD, 0x03, 0xFF, 0x21, 0xFE, 0x87, 0xFF, 0xBE, 0xFE, 0x42, 0x00,
-        0x63, 0xFF, 0x0B, 0x01, 0xE0, 0xFF, 0xC6, 0x01, 0x40, 0x00, 0x2D, 0x02,
-        0xDB, 0x00, 0x59, 0x02, 0xE8, 0x01, 0x3B, 0x02, 0x64, 0x03, 0xF2, 0x01,
-        0xCC, 0x04, 0x8D, 0x01, 0xB0, 0x05, 0x1E, 0x01, 0xDC, 0x05, 0xD5, 0x00,
-        0x61, 0x05, 0xA7, 0x00, 0x97, 0x04, 0x89, 0x00, 0xAE, 0x03, 0x54, 0x00,
-        0xF2, 0x02, 0x32, 0x00, 0x6C, 0x02, 0x31, 0x00, 0x38, 0x02, 0x6A, 0x00,
-        0x3E, 0x02, 0xBD, 0x00, 0x5D, 0x02, 0x02, 0x01, 0x5C, 0x02, 0xF0, 0x00,
-        0xFB, 0x01, 0x87, 0x00, 0x5F, 0x01, 0xD8, 0xFF, 0xB0, 0x00, 0x16, 0xFF,
-        0x39, 0x00, 0x5A, 0xFE, 0xD1, 0xFF, 0xD9, 0xFD, 0x46, 0xFF, 0x91, 0xFD,
-        0x34, 0xFE, 0x87, 0xFD, 0xC3, 0xFC, 0xAF, 0xFD, 0x4C, 0xFB, 0xF7, 0xFD,
-        0x61, 0xFA, 0x59, 0xFE, 0x2D, 0xFA, 0xA4, 0xFE, 0xA4, 0xFA, 0xE5, 0xFE,
-        0x7D, 0xFB, 0x26, 0xFF, 0x6B, 0xFC, 0x7C, 0xFF, 0x36, 0xFD, 0xBA, 0xFF,
-        0xC0, 0xFD, 0xCB, 0xFF, 0xFA, 0xFD, 0x89, 0xFF, 0xFA, 0xFD, 0x22, 0xFF,
-        0xD5, 0xFD, 0xC4, 0xFE, 0xDD, 0xFD, 0xB5, 0xFE, 0x36, 0xFE, 0x15, 0xFF,
-        0xE2, 0xFE, 0xB3, 0xFF, 0x8D, 0xFF, 0x88, 0x00, 0x0D, 0x00, 0x52, 0x01,
-        0x63, 0x00, 0xFD, 0x01, 0xE7, 0x00, 0x6C, 0x02, 0xE3, 0x01, 0x9B, 0x02,
-        0x55, 0x03, 0x9F, 0x02, 0xBE, 0x04, 0x63, 0x02, 0xAC, 0x05, 0x13, 0x02,
-        0xD8, 0x05, 0xB5, 0x01, 0x5A, 0x05, 0x68, 0x01, 0x84, 0x04, 0x0F, 0x01,
-        0x95, 0x03, 0xA9, 0x00, 0xD4, 0x02, 0x59, 0x00, 0x49, 0x02, 0x46, 0x00,
-        0x0E, 0x02, 0x7E, 0x00, 0x0C, 0x02, 0xE8, 0x00, 0x2F, 0x02, 0x43, 0x01,
-        0x39, 0x02, 0x4F, 0x01, 0xE9, 0x01, 0xFC, 0x00, 0x4C, 0x01, 0x54, 0x00,
-        0xA0, 0x00, 0x87, 0xFF, 0x19, 0x00, 0xA8, 0xFE, 0xBE, 0xFF, 0xF7, 0xFD,
-        0x3B, 0xFF, 0x7F, 0xFD, 0x45, 0xFE, 0x49, 0xFD, 0xE4, 0xFC, 0x42, 0xFD,
-        0x84, 0xFB, 0x6F, 0xFD, 0xA5, 0xFA, 0xB6, 0xFD, 0x7F, 0xFA, 0x03, 0xFE,
-        0x01, 0xFB, 0x50, 0xFE, 0xD6, 0xFB, 0xA4, 0xFE, 0xBD, 0xFC, 0x16, 0xFF,
-        0x7A, 0xFD, 0x6B, 0xFF, 0xF2, 0xFD, 0x8F, 0xFF, 0x28, 0xFE, 0x5E, 0xFF,
-        0x19, 0xFE, 0xFF, 0xFE, 0xE0, 0xFD, 0x9D, 0xFE, 0xCD, 0xFD, 0x85, 0xFE,
-        0x04, 0xFE, 0xCE, 0xFE, 0xAA, 0xFE, 0x6B, 0xFF, 0x5A, 0xFF, 0x37, 0x00,
-        0xF2, 0xFF, 0x19, 0x01, 0x57, 0x00, 0xC9, 0x01, 0xD7, 0x00, 0x4F, 0x02,
-        0xC0, 0x01, 0x8D, 0x02, 0x0B, 0x03, 0xA6, 0x02, 0x52, 0x04, 0x89, 0x02,
-        0x26, 0x05, 0x50, 0x02, 0x42, 0x05, 0x08, 0x02, 0xCE, 0x04, 0xBE, 0x01,
-        0x04, 0x04, 0x68, 0x01, 0x3A, 0x03, 0xF5, 0x00, 0x94, 0x02, 0xA2, 0x00,
-        0x35, 0x02, 0x81, 0x00, 0x13, 0x02, 0xAF, 0x00, 0x3A, 0x02, 0x12, 0x01,
-        0x81, 0x02, 0x6A, 0x01, 0xB1, 0x02, 0x80, 0x01, 0x7B, 0x02, 0x31, 0x01,
-        0xE5, 0x01, 0x8F, 0x00, 0x28, 0x01, 0xC6, 0xFF, 0x91, 0x00, 0xE4, 0xFE,
-        0x22, 0x00, 0x36, 0xFE, 0xA2, 0xFF, 0xB5, 0xFD, 0xB7, 0xFE, 0x6B, 0xFD,
-        0x6E, 0xFD, 0x52, 0xFD, 0x24, 0xFC, 0x66, 0xFD, 0x4E, 0xFB, 0xA2, 0xFD,
-        0x24, 0xFB, 0xEB, 0xFD, 0x8B, 0xFB, 0x39, 0xFE, 0x3E, 0xFC, 0x8B, 0xFE,
-        0xFE, 0xFC, 0xF7, 0xFE, 0x8D, 0xFD, 0x44, 0xFF, 0xF4, 0xFD, 0x65, 0xFF,
-        0x0B, 0xFE, 0x3B, 0xFF, 0xEF, 0xFD, 0xE6, 0xFE, 0xA7, 0xFD, 0x8E, 0xFE,
-        0x72, 0xFD, 0x81, 0xFE, 0xA3, 0xFD, 0xC9, 0xFE, 0x35, 0xFE, 0x5F, 0xFF,
-        0xED, 0xFE, 0x2B, 0x00, 0x8B, 0xFF, 0x00, 0x01, 0xF1, 0xFF, 0xBC, 0x01,
-        0x75, 0x00, 0x49, 0x02, 0x5A, 0x01, 0x9E, 0x02, 0x9E, 0x02, 0xC2, 0x02,
-        0xE9, 0x03, 0xB2, 0x02, 0xB6, 0x04, 0x73, 0x02, 0xE5, 0x04, 0x2C, 0x02,
-        0x79, 0x04, 0xE0, 0x01, 0xC4, 0x03, 0x86, 0x01, 0xFE, 0x02, 0x21, 0x01,
-        0x59, 0x02, 0xC1, 0x00, 0xEB, 0x01, 0x99, 0x00, 0xBC, 0x01, 0xAB, 0x00,
-        0xD6, 0x01, 0xF6, 0x00, 0x1E, 0x02, 0x3A, 0x01, 0x4D, 0x02, 0x47, 0x01,
-        0x23, 0x02, 0xF3, 0x00, 0x8B, 0x01, 0x5D, 0x00, 0xD3, 0x00, 0x9C, 0xFF,
-        0x3F, 0x00, 0xD2, 0xFE, 0xDC, 0xFF, 0x2B, 0xFE, 0x6C, 0xFF, 0xBD, 0xFD,
-        0x8F, 0xFE, 0x7B, 0xFD, 0x55, 0xFD, 0x73, 0xFD, 0x11, 0xFC, 0x8C, 0xFD,
-        0x40, 0xFB, 0xCD, 0xFD, 0x21, 0xFB, 0x1B, 0xFE, 0x89, 0xFB, 0x66, 0xFE,
-        0x4D, 0xFC, 0xC7, 0xFE, 0x0F, 0xFD, 0x39, 0xFF, 0xB6, 0xFD, 0xA3, 0xFF,
-        0x25, 0xFE, 0xE0, 0xFF, 0x53, 0xFE, 0xD6, 0xFF, 0x47, 0xFE, 0x94, 0xFF,
-        0xFD, 0xFD, 0x43, 0xFF, 0xDB, 0xFD, 0x35, 0xFF, 0x01, 0xFE, 0x76, 0xFF,
-        0x9C, 0xFE, 0x0C, 0x00, 0x4F, 0xFF, 0xC7, 0x00, 0xE1, 0xFF, 0x87, 0x01,
-        0x3E, 0x00, 0x19, 0x02, 0xA3, 0x00, 0x6D, 0x02, 0x7C, 0x01, 0x8B, 0x02,
-        0xA6, 0x02, 0x7B, 0x02, 0xE2, 0x03, 0x4D, 0x02, 0x9C, 0x04, 0xFF, 0x01,
-        0xB3, 0x04, 0xB5, 0x01, 0x34, 0x04, 0x6B, 0x01, 0x75, 0x03, 0x18, 0x01,
-        0xA3, 0x02, 0xAB, 0x00, 0x05, 0x02, 0x44, 0x00, 0x91, 0x01, 0x0C, 0x00,
-        0x62, 0x01, 0x14, 0x00, 0x74, 0x01, 0x60, 0x00, 0xB4, 0x01, 0xB1, 0x00,
-        0xDE, 0x01, 0xC4, 0x00, 0xAF, 0x01, 0x7C, 0x00, 0x0F, 0x01, 0xE7, 0xFF,
-        0x4D, 0x00, 0x25, 0xFF, 0xAB, 0xFF, 0x70, 0xFE, 0x41, 0xFF, 0xE6, 0xFD,
-        0xD0, 0xFE, 0xA1, 0xFD, 0xFE, 0xFD, 0x92, 0xFD, 0xD3, 0xFC, 0x9C, 0xFD,
-        0xAA, 0xFB, 0xCE, 0xFD, 0xEF, 0xFA, 0x0A, 0xFE, 0xE0, 0xFA, 0x52, 0xFE,
-        0x55, 0xFB, 0x95, 0xFE, 0x15, 0xFC, 0xDF, 0xFE, 0xD7, 0xFC, 0x4A, 0xFF,
-        0x7E, 0xFD, 0xA4, 0xFF, 0xF0, 0xFD, 0xDF, 0xFF, 0x37, 0xFE, 0xD2, 0xFF,
-        0x33, 0xFE, 0x86, 0xFF, 0x01, 0xFE, 0x35, 0xFF, 0xDD, 0xFD, 0x1E, 0xFF,
-        0x0E, 0xFE, 0x67, 0xFF, 0xA3, 0xFE, 0x02, 0x00, 0x65, 0xFF, 0xC9, 0x00,
-        0x04, 0x00, 0x86, 0x01, 0x6F, 0x00, 0x17, 0x02, 0xEE, 0x00, 0x5B, 0x02,
-        0xC5, 0x01, 0x75, 0x02, 0x01, 0x03, 0x6F, 0x02, 0x37, 0x04, 0x45, 0x02,
-        0xFC, 0x04, 0x0A, 0x02, 0x11, 0x05, 0xC2, 0x01, 0x9D, 0x04, 0x84, 0x01,
-        0xD3, 0x03, 0x34, 0x01, 0xFE, 0x02, 0xD9, 0x00, 0x46, 0x02, 0x75, 0x00,
-        0xBE, 0x01, 0x47, 0x00, 0x73, 0x01, 0x4E, 0x00, 0x74, 0x01, 0x92, 0x00,
-        0xA7, 0x01, 0xDB, 0x00, 0xCF, 0x01, 0xE9, 0x00, 0x9F, 0x01, 0x98, 0x00,
-        0x03, 0x01, 0xFB, 0xFF, 0x3A, 0x00, 0x35, 0xFF, 0x8D, 0xFF, 0x78, 0xFE,
-        0x14, 0xFF, 0xF5, 0xFD, 0x95, 0xFE, 0xB2, 0xFD, 0xA8, 0xFD, 0x95, 0xFD,
-        0x76, 0xFC, 0x99, 0xFD, 0x31, 0xFB, 0xB3, 0xFD, 0x7B, 0xFA, 0xEC, 0xFD,
-        0x65, 0xFA, 0x29, 0xFE, 0xE4, 0xFA, 0x64, 0xFE, 0xBC, 0xFB, 0xAD, 0xFE,
-        0x98, 0xFC, 0x02, 0xFF, 0x61, 0xFD, 0x5D, 0xFF, 0xE7, 0xFD, 0x84, 0xFF,
-        0x32, 0xFE, 0x7D, 0xFF, 0x25, 0xFE, 0x2F, 0xFF, 0xE7, 0xFD, 0xE0, 0xFE,
-        0xB9, 0xFD, 0xC4, 0xFE, 0xE8, 0xFD, 0x0D, 0xFF, 0x91, 0xFE, 0x9E, 0xFF,
-        0x63, 0xFF, 0x62, 0x00, 0x1F, 0x00, 0x13, 0x01, 0x9C, 0x00, 0x98, 0x01,
-        0x2A, 0x01, 0xDD, 0x01, 0x12, 0x02, 0x03, 0x02, 0x4F, 0x03, 0x04, 0x02,
-        0x81, 0x04, 0xF4, 0x01, 0x3A, 0x05, 0xC0, 0x01, 0x3D, 0x05, 0x88, 0x01,
-        0xB9, 0x04, 0x5A, 0x01, 0xD8, 0x03, 0x1F, 0x01, 0xF0, 0x02, 0xCE, 0x00,
-        0x2C, 0x02, 0x85, 0x00, 0x9D, 0x01, 0x56, 0x00, 0x64, 0x01, 0x6A, 0x00,
-        0x6F, 0x01, 0xB7, 0x00, 0xBE, 0x01, 0x11, 0x01, 0xEB, 0x01, 0x35, 0x01,
-        0xBA, 0x01, 0xF6, 0x00, 0x10, 0x01, 0x65, 0x00, 0x31, 0x00, 0xA3, 0xFF,
-        0x78, 0xFF, 0xEC, 0xFE, 0xF6, 0xFE, 0x62, 0xFE, 0x6F, 0xFE, 0x1A, 0xFE,
-        0x8B, 0xFD, 0xF6, 0xFD, 0x5A, 0xFC, 0xF4, 0xFD, 0x31, 0xFB, 0x09, 0xFE,
-        0x8F, 0xFA, 0x3E, 0xFE, 0x8F, 0xFA, 0x6A, 0xFE, 0x27, 0xFB, 0x8B, 0xFE,
-        0x01, 0xFC, 0xB5, 0xFE, 0xED, 0xFC, 0xF2, 0xFE, 0xAA, 0xFD, 0x3D, 0xFF,
-        0x2E, 0xFE, 0x64, 0xFF, 0x61, 0xFE, 0x53, 0xFF, 0x48, 0xFE, 0x07, 0xFF,
-        0x00, 0xFE, 0xB0, 0xFE, 0xD7, 0xFD, 0x99, 0xFE, 0x1A, 0xFE, 0xE6, 0xFE,
-        0xCC, 0xFE, 0x86, 0xFF, 0xB2, 0xFF, 0x4B, 0x00, 0x67, 0x00, 0x05, 0x01,
-        0xE3, 0x00, 0x85, 0x01, 0x62, 0x01, 0xD0, 0x01, 0x3B, 0x02, 0xED, 0x01,
-        0x66, 0x03, 0xF3, 0x01, 0x83, 0x04, 0xD3, 0x01, 0x2A, 0x05, 0x9C, 0x01,
-        0x26, 0x05, 0x5E, 0x01, 0x9F, 0x04, 0x2C, 0x01, 0xCD, 0x03, 0xF4, 0x00,
-        0xF5, 0x02, 0x9B, 0x00, 0x3F, 0x02, 0x51, 0x00, 0xC5, 0x01, 0x19, 0x00,
-        0x84, 0x01, 0x34, 0x00, 0x94, 0x01, 0x84, 0x00, 0xCC, 0x01, 0xE1, 0x00,
-        0xEB, 0x01, 0x01, 0x01, 0xAA, 0x01, 0xAE, 0x00, 0x03, 0x01, 0x16, 0x00,
-        0x2C, 0x00, 0x44, 0xFF, 0x91, 0xFF, 0x97, 0xFE, 0x20, 0xFF, 0x11, 0xFE,
-        0xB5, 0xFE, 0xD4, 0xFD, 0xE8, 0xFD, 0xBB, 0xFD, 0xCC, 0xFC, 0xBF, 0xFD,
-        0xAF, 0xFB, 0xE8, 0xFD, 0x06, 0xFB, 0x28, 0xFE, 0x01, 0xFB, 0x6F, 0xFE,
-        0x80, 0xFB, 0xAA, 0xFE, 0x5D, 0xFC, 0xEE, 0xFE, 0x3D, 0xFD, 0x4E, 0xFF,
-        0x08, 0xFE, 0xAB, 0xFF, 0x95, 0xFE, 0xDE, 0xFF, 0xD1, 0xFE, 0xC8, 0xFF,
-        0xC3, 0xFE, 0x71, 0xFF, 0x77, 0xFE, 0x12, 0xFF, 0x48, 0xFE, 0xF8, 0xFE,
-        0x7D, 0xFE, 0x41, 0xFF, 0x15, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0x99, 0x00,
-        0x89, 0x00, 0x46, 0x01, 0xFC, 0x00, 0xB2, 0x01, 0x73, 0x01, 0xF4, 0x01,
-        0x41, 0x02, 0x06, 0x02, 0x60, 0x03, 0x12, 0x02, 0x79, 0x04, 0xF4, 0x01,
-        0x1D, 0x05, 0xBC, 0x01, 0x26, 0x05, 0x7D, 0x01, 0xA0, 0x04, 0x41, 0x01,
-        0xCB, 0x03, 0xF9, 0x00, 0xE1, 0x02, 0x9E, 0x00, 0x1C, 0x02, 0x3A, 0x00,
-        0x91, 0x01, 0x12, 0x00, 0x55, 0x01, 0x1B, 0x00, 0x6D, 0x01, 0x75, 0x00,
-        0xB4, 0x01, 0xC1, 0x00, 0xEF, 0x01, 0xE1, 0x00, 0xBE, 0x01, 0x92, 0x00,
-        0x2A, 0x01, 0x05, 0x00, 0x5B, 0x00, 0x51, 0xFF, 0xB4, 0xFF, 0xB6, 0xFE,
-        0x3D, 0xFF, 0x44, 0xFE, 0xBF, 0xFE, 0x15, 0xFE, 0xF5, 0xFD, 0xF6, 0xFD,
-        0xE2, 0xFC, 0xFB, 0xFD, 0xDE, 0xFB, 0x14, 0xFE, 0x45, 0xFB, 0x46, 0xFE,
-        0x4D, 0xFB, 0x83, 0xFE, 0xD7, 0xFB, 0xAB, 0xFE, 0xB3, 0xFC, 0xEA, 0xFE,
-        0x9F, 0xFD, 0x36, 0xFF, 0x65, 0xFE, 0x94, 0xFF, 0xE9, 0xFE, 0xBE, 0xFF,
-        0x1B, 0xFF, 0xBE, 0xFF, 0xF6, 0xFE, 0x7D, 0xFF, 0xA6, 0xFE, 0x46, 0xFF,
-        0x6C, 0xFE, 0x45, 0xFF, 0x99, 0xFE, 0x9E, 0xFF, 0x2C, 0xFF, 0x3B, 0x00,
-        0xF2, 0xFF, 0xE8, 0x00, 0x90, 0x00, 0x86, 0x01, 0x02, 0x01, 0xE0, 0x01,
-        0x7A, 0x01, 0x0B, 0x02, 0x44, 0x02, 0x10, 0x02, 0x55, 0x03, 0x06, 0x02,
-        0x63, 0x04, 0xEC, 0x01, 0xFA, 0x04, 0xBC, 0x01, 0xFF, 0x04, 0x8C, 0x01,
-        0x75, 0x04, 0x65, 0x01, 0x9A, 0x03, 0x2E, 0x01, 0xB6, 0x02, 0xE2, 0x00,
-        0xED, 0x01, 0x8E, 0x00, 0x7A, 0x01, 0x60, 0x00, 0x4C, 0x01, 0x67, 0x00,
-        0x7A, 0x01, 0x9D, 0x00, 0xCD, 0x01, 0xCF, 0x00, 0x0A, 0x02, 0xC7, 0x00,
-        0xE8, 0x01, 0x6B, 0x00, 0x5D, 0x01, 0xCE, 0xFF, 0xAC, 0x00, 0x24, 0xFF,
-        0x15, 0x00, 0x8C, 0xFE, 0xA8, 0xFF, 0x3D, 0xFE, 0x22, 0xFF, 0x1F, 0xFE,
-        0x48, 0xFE, 0x2C, 0xFE, 0x23, 0xFD, 0x40, 0xFE, 0x0C, 0xFC, 0x60, 0xFE,
-        0x64, 0xFB, 0x8E, 0xFE, 0x56, 0xFB, 0xB1, 0xFE, 0xD4, 0xFB, 0xCB, 0xFE,
-        0x9D, 0xFC, 0xF2, 0xFE, 0x7E, 0xFD, 0x2F, 0xFF, 0x34, 0xFE, 0x7C, 0xFF,
-        0xA9, 0xFE, 0xA1, 0xFF, 0xD2, 0xFE, 0xA0, 0xFF, 0xAC, 0xFE, 0x6F, 0xFF,
-        0x5C, 0xFE, 0x46, 0xFF, 0x23, 0xFE, 0x4C, 0xFF, 0x3D, 0xFE, 0xAB, 0xFF,
-        0xC7, 0xFE, 0x39, 0x00, 0x64, 0xFF, 0xE5, 0x00, 0xF9, 0xFF, 0x6D, 0x01,
-        0x55, 0x00, 0xBD, 0x01, 0xD7, 0x00, 0xD3, 0x01, 0xA6, 0x01, 0xC1, 0x01,
-        0xC5, 0x02, 0xB4, 0x01, 0xD5, 0x03, 0x98, 0x01, 0x89, 0x04, 0x8A, 0x01,
-        0xA3, 0x04, 0x72, 0x01, 0x45, 0x04, 0x70, 0x01, 0x91, 0x03, 0x4B, 0x01,
-        0xC9, 0x02, 0x0E, 0x01, 0x1A, 0x02, 0xBF, 0x00, 0xAF, 0x01, 0x91, 0x00,
-        0x83, 0x01, 0x94, 0x00, 0xB2, 0x01, 0xC5, 0x00, 0x01, 0x02, 0xF8, 0x00,
-        0x3D, 0x02, 0xFC, 0x00, 0x1B, 0x02, 0xB5, 0x00, 0x97, 0x01, 0x32, 0x00,
-        0xEA, 0x00, 0x9F, 0xFF, 0x63, 0x00, 0x1C, 0xFF, 0xFB, 0xFF, 0xD4, 0xFE,
-        0x83, 0xFF, 0xBC, 0xFE, 0xB0, 0xFE, 0xBE, 0xFE, 0x96, 0xFD, 0xC1, 0xFE,
-        0x7F, 0xFC, 0xC2, 0xFE, 0xCD, 0xFB, 0xD3, 0xFE, 0xA6, 0xFB, 0xE2, 0xFE,
-        0xFE, 0xFB, 0xF1, 0xFE, 0xAB, 0xFC, 0x17, 0xFF, 0x6C, 0xFD, 0x55, 0xFF,
-        0x1A, 0xFE, 0x9F, 0xFF, 0x85, 0xFE, 0xD4, 0xFF, 0xAD, 0xFE, 0xCF, 0xFF,
-        0x7F, 0xFE, 0xB4, 0xFF, 0x28, 0xFE, 0x84, 0xFF, 0xE2, 0xFD, 0x8B, 0xFF,
-        0xF7, 0xFD, 0xCF, 0xFF, 0x79, 0xFE, 0x4A, 0x00, 0x1B, 0xFF, 0xD5, 0x00,
-        0xAA, 0xFF, 0x55, 0x01, 0x0D, 0x00, 0xA0, 0x01, 0x85, 0x00, 0xC5, 0x01,
-        0x54, 0x01, 0xC1, 0x01, 0x5D, 0x02, 0xBA, 0x01, 0x6C, 0x03, 0xA4, 0x01,
-        0x13, 0x04, 0x7C, 0x01, 0x39, 0x04, 0x5C, 0x01, 0xEB, 0x03, 0x37, 0x01,
-        0x43, 0x03, 0x12, 0x01, 0x93, 0x02, 0xC6, 0x00, 0xE8, 0x01, 0x81, 0x00,
-        0x8B, 0x01, 0x42, 0x00, 0x66, 0x01, 0x3C, 0x00, 0xA1, 0x01, 0x53, 0x00,
-        0xFD, 0x01, 0x75, 0x00, 0x46, 0x02, 0x6B, 0x00, 0x21, 0x02, 0x25, 0x00,
-        0x9C, 0x01, 0xA9, 0xFF, 0xE1, 0x00, 0x24, 0xFF, 0x5C, 0x00, 0xAF, 0xFE,
-        0xEE, 0xFF, 0x6D, 0xFE, 0x7F, 0xFF, 0x64, 0xFE, 0xB3, 0xFE, 0x75, 0xFE,
-        0xA8, 0xFD, 0x93, 0xFE, 0x99, 0xFC, 0xB6, 0xFE, 0xEB, 0xFB, 0xDF, 0xFE,
-        0xB8, 0xFB, 0x0D, 0xFF, 0x04, 0xFC, 0x27, 0xFF, 0x98, 0xFC, 0x52, 0xFF,
-        0x54, 0xFD, 0x8C, 0xFF, 0xF5, 0xFD, 0xD5, 0xFF, 0x66, 0xFE, 0x02, 0x00,
-        0x89, 0xFE, 0x0F, 0x00, 0x5C, 0xFE, 0xEA, 0xFF, 0x00, 0xFE, 0xD3, 0xFF,
-        0xBE, 0xFD, 0xDB, 0xFF, 0xD8, 0xFD, 0x29, 0x00, 0x5A, 0xFE, 0xA0, 0x00,
-        0x03, 0xFF, 0x15, 0x01, 0x8E, 0xFF, 0x7E, 0x01, 0xFE, 0xFF, 0xA5, 0x01,
-        0x84, 0x00, 0xA5, 0x01, 0x5C, 0x01, 0x7F, 0x01, 0x76, 0x02, 0x5F, 0x01,
-        0x8D, 0x03, 0x3B, 0x01, 0x40, 0x04, 0x15, 0x01, 0x76, 0x04, 0xF4, 0x00,
-        0x28, 0x04, 0xD8, 0x00, 0x8D, 0x03, 0xB9, 0x00, 0xCA, 0x02, 0x7B, 0x00,
-        0x1D, 0x02, 0x3B, 0x00, 0xA4, 0x01, 0x0B, 0x00, 0x76, 0x01, 0x08, 0x00,
-        0x9A, 0x01, 0x26, 0x00, 0xE9, 0x01, 0x46, 0x00, 0x2A, 0x02, 0x37, 0x00,
-        0x11, 0x02, 0xEF, 0xFF, 0x9B, 0x01, 0x79, 0xFF, 0x02, 0x01, 0x04, 0xFF,
-        0x81, 0x00, 0xA2, 0xFE, 0x1D, 0x00, 0x81, 0xFE, 0x9A, 0xFF, 0x8B, 0xFE,
-        0xC8, 0xFE, 0xBD, 0xFE, 0xB0, 0xFD, 0xDE, 0xFE, 0x9E, 0xFC, 0xFF, 0xFE,
-        0xDF, 0xFB, 0x14, 0xFF, 0xA5, 0xFB, 0x22, 0xFF, 0xD9, 0xFB, 0x2D, 0xFF,
-        0x6C, 0xFC, 0x3B, 0xFF, 0x1C, 0xFD, 0x6E, 0xFF, 0xC8, 0xFD, 0xA0, 0xFF,
-        0x43, 0xFE, 0xC7, 0xFF, 0x7A, 0xFE, 0xC8, 0xFF, 0x6A, 0xFE, 0xAE, 0xFF,
-        0x24, 0xFE, 0x97, 0xFF, 0xF2, 0xFD, 0xB7, 0xFF, 0xFD, 0xFD, 0x0A, 0x00,
-        0x6D, 0xFE, 0x91, 0x00, 0xF5, 0xFE, 0x09, 0x01, 0x75, 0xFF, 0x66, 0x01,
-        0xDA, 0xFF, 0x7D, 0x01, 0x60, 0x00, 0x5C, 0x01, 0x2D, 0x01, 0x24, 0x01,
-        0x4B, 0x02, 0xF9, 0x00, 0x5B, 0x03, 0xE5, 0x00, 0x25, 0x04, 0xD7, 0x00,
-        0x63, 0x04, 0xCA, 0x00, 0x32, 0x04, 0xC2, 0x00, 0xA6, 0x03, 0xA9, 0x00,
-        0xF8, 0x02, 0x83, 0x00, 0x50, 0x02, 0x52, 0x00, 0xDD, 0x01, 0x32, 0x00,
-        0xA4, 0x01, 0x29, 0x00, 0xBB, 0x01, 0x31, 0x00, 0xFC, 0x01, 0x2C, 0x00,
-        0x33, 0x02, 0xF8, 0xFF, 0x1C, 0x02, 0x8F, 0xFF, 0xA7, 0x01, 0x0D, 0xFF,
-        0x07, 0x01, 0x96, 0xFE, 0x78, 0x00, 0x4B, 0xFE, 0xFA, 0xFF, 0x3F, 0xFE,
-        0x6D, 0xFF, 0x6A, 0xFE, 0x89, 0xFE, 0xA3, 0xFE, 0x72, 0xFD, 0xCC, 0xFE,
-        0x5A, 0xFC, 0xE1, 0xFE, 0xA9, 0xFB, 0xF4, 0xFE, 0x76, 0xFB, 0x12, 0xFF,
-        0xC2, 0xFB, 0x28, 0xFF, 0x5C, 0xFC, 0x52, 0xFF, 0x16, 0xFD, 0x75, 0xFF,
-        0xBF, 0xFD, 0xA5, 0xFF, 0x2E, 0xFE, 0xB1, 0xFF, 0x5B, 0xFE, 0xAF, 0xFF,
-        0x34, 0xFE, 0x95, 0xFF, 0xE2, 0xFD, 0x8F, 0xFF, 0xA2, 0xFD, 0xB1, 0xFF,
-        0xB4, 0xFD, 0x0B, 0x00, 0x2E, 0xFE, 0x7B, 0x00, 0xD0, 0xFE, 0xE4, 0x00,
-        0x6A, 0xFF, 0x27, 0x01, 0xE9, 0xFF, 0x35, 0x01, 0x8A, 0x00, 0x11, 0x01,
-        0x72, 0x01, 0xE2, 0x00, 0x9C, 0x02, 0xCC, 0x00, 0xAA, 0x03, 0xCA, 0x00,
-        0x5A, 0x04, 0xC4, 0x00, 0x69, 0x04, 0xB3, 0x00, 0x0F, 0x04, 0x95, 0x00,
-        0x51, 0x03, 0x72, 0x00, 0x89, 0x02, 0x4A, 0x00, 0xD8, 0x01, 0x2E, 0x00,
-        0x63, 0x01, 0x26, 0x00, 0x44, 0x01, 0x41, 0x00, 0x72, 0x01, 0x65, 0x00,
-        0xCE, 0x01, 0x83, 0x00, 0x13, 0x02, 0x6B, 0x00, 0xFF, 0x01, 0x22, 0x00,
-        0x83, 0x01, 0xB9, 0xFF, 0xE3, 0x00, 0x59, 0xFF, 0x42, 0x00, 0x15, 0xFF,
-        0xB9, 0xFF, 0x04, 0xFF, 0x0E, 0xFF, 0x18, 0xFF, 0x23, 0xFE, 0x3A, 0xFF,
-        0x07, 0xFD, 0x37, 0xFF, 0x12, 0xFC, 0x2F, 0xFF};
+
+    Player player;                       ///< Used only by worker thread
+    uint32_t tonePhase;                  ///< Feedback tone phase, Q32 of a period. Used only by worker thread
+    int32_t toneLevel;                   ///< Feedback tone amplitude at the end of the last block. Used only by worker thread
+    std::atomic<uint8_t> clipIndex;      ///< Selected clip
+    std::atomic<bool> loop;              ///< Repeat clips
+    std::atomic<uint16_t> gain;          ///< Volume, Q8
+    std::atomic<bool> playRequested;     ///< Selected clip must start from the beginning
+    std::atomic<bool> stopRequested;     ///< Playback must stop
+    std::atomic<uint8_t> blocksPerWakeup; ///< Blocks written per feeder wakeup
+    std::atomic<uint32_t> underruns;     ///< Number of I2S underruns
+    std::atomic<uint32_t> blocks;        ///< Number of blocks written
+    std::atomic<uint32_t> wakeups;       ///< Number of feeder wakeups
+    std::atomic<uint32_t> lowestQueue;   ///< Fewest blocks found queued on a wakeup since the last report
+
+    std::atomic<bool> toneEnabled;       ///< Feedback tone is mixed in
+    std::atomic<uint8_t> toneVolume;     ///< Feedback tone volume, %
+    std::atomic<uint16_t> toneFrequency; ///< Feedback tone frequency, Hz
+    std::atomic<uint32_t> toneStamp;     ///< Stamp of the last tone change
+    std::atomic<bool> toneChanged;       ///< Tone change is not played yet
+    LatencyMeter toneLatency;            ///< Tone change to playback latency
 };
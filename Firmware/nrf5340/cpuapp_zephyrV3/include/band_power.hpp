@@ -0,0 +1,211 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "arm_math.h"
+
+#include "ads131_pipeline.hpp"
+#include "ble_service.hpp"
+#include "ble_types.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+class FeedbackEngine;
+
+/**
+ * @brief Keys for CommandId::BandPowerCmd commands
+ */
+enum class BandPowerCommand : uint8_t
+{
+    SetRate    = 1, ///< data: [rate Hz]. Record rate, 1 - 10, 0 stops output and FFTs
+    SetWindow  = 2, ///< data: [BandPowerWindow]
+    SetOverlap = 3, ///< data: [overlap %], 0 - 90
+    SetBands   = 4, ///< data: [count, per band low and high edge u16 LE, 0.1 Hz]. Band is low <= f < high
+};
+
+/**
+ * @brief Segment window. Windows are periodic, like scipy.signal.get_window
+ */
+enum class BandPowerWindow : uint8_t
+{
+    Rectangular = 0,
+    Hann        = 1,
+    Hamming     = 2,
+    Blackman    = 3,
+};
+
+/**
+ * @brief Welch band power estimator of ADS131M08 channels.
+ *
+ * Takes filtered blocks from Ads131Pipeline and runs on its own low priority thread, so FFTs never delay ADC frame
+ * reads on system work queue. Every hop (FFT size times 1 - overlap) the last FFT size samples of every channel are
+ * detrended (mean removed), windowed and transformed with arm_rfft_fast_f32. Periodograms are scaled as one-sided
+ * power spectral density, like scipy.signal.welch(scaling='density'), summed over band bins and averaged over all
+ * segments of the record interval.
+ *
+ * Record, one per device: [counter][device][bands][segments][power f32 LE, channel 0 bands, channel 1 bands, ...].
+ * Power is in ADC codes squared.
+ */
+class BandPower
+{
+public:
+    constexpr static size_t FftSize = CONFIG_ADS131_BAND_POWER_FFT_SIZE; ///< Segment length
+    constexpr static size_t MaxBands = 6;   ///< Maximum number of bands
+    constexpr static size_t MaxRate = 10;   ///< Maximum record rate, Hz
+    constexpr static size_t MaxOverlap = 90; ///< Maximum segment overlap, %
+
+    /**
+     * @brief Construct BandPower
+     *
+     * @param controller USB communication controller
+     */
+    BandPower(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Registers BLE command handler and starts worker thread
+     *
+     * @param sampleRate rate of pipeline blocks, Hz
+     */
+    void Initialize(uint32_t sampleRate);
+
+    /**
+     * @brief Queue filtered block of one device. Block is dropped if worker thread is behind, and segments of the
+     *        device restart after the gap
+     *
+     * @param device device index, less than Ads131Pipeline::MaxDevices
+     * @param block per channel samples, 24-bit ADC codes scaled by 2^Ads131Pipeline::SampleShift
+     * @warning Called from system work queue
+     */
+    void PushBlock(size_t device, const q31_t (&block)[Ads131Pipeline::Channels][Ads131Pipeline::SamplesPerPacket]);
+
+#if CONFIG_USE_FEEDBACK
+    /**
+     * @brief Set feedback engine fed with band powers of every segment
+     *
+     * @param engine feedback engine, nullptr stops feeding band powers
+     */
+    void SetFeedback(FeedbackEngine *engine);
+#endif
+
+private:
+    constexpr static size_t Channels = Ads131Pipeline::Channels;
+    constexpr static size_t BlockSamples = Ads131Pipeline::SamplesPerPacket;
+    constexpr static size_t Bins = FftSize / 2 + 1; ///< One-sided spectrum bins
+    constexpr static size_t headerSize = 4;         ///< Size of record header
+    constexpr static size_t maxQueuedBlocks = 8;    ///< Depth of block queue
+
+    /**
+     * @brief Block passed from system work queue to worker thread
+     */
+    struct Block
+    {
+        size_t device;                                    ///< Device index
+        bool gap;                                         ///< Previous block of the device was dropped
+        uint32_t stamp;                                   ///< Cycle counter when the block was queued
+        q31_t samples[Channels][BlockSamples];            ///< Per channel samples
+    };
+
+    /**
+     * @brief Estimator settings, changed by commands
+     */
+    struct Settings
+    {
+        uint8_t rate;                    ///< Record rate, Hz, 0 for off
+        BandPowerWindow window;          ///< Segment window
+        uint8_t overlap;                 ///< Segment overlap, %
+        uint8_t bandCount;               ///< Number of bands
+        uint16_t bands[MaxBands][2];     ///< Low and high band edges, 0.1 Hz
+    };
+
+    /**
+     * @brief Per device history and accumulated band powers
+     */
+    struct Device
+    {
+        float history[Channels][FftSize]; ///< Last FftSize samples of every channel, circular
+        size_t head;                      ///< Next history position
+        size_t filled;                    ///< Valid samples in history
+        size_t sinceSegment;              ///< Samples since last segment
+        size_t sinceRecord;               ///< Samples since last record
+        uint32_t segments;                ///< Segments accumulated for the next record
+        float power[Channels][MaxBands];  ///< Accumulated band powers
+        uint8_t counter;                  ///< Record counter
+        uint32_t stamp;                   ///< Cycle counter when the newest block was queued
+    };
+
+    /**
+     * @brief Called when band power command is received via BLE
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
+    /**
+     * @brief Worker thread. Appends queued blocks to history and computes segments and records.
+     *
+     * @param data pointer to current instance of BandPower
+     */
+    static void WorkingThread(void *data, void *, void *);
+
+    /**
+     * @brief Store settings to be applied by worker thread before the next block
+     */
+    void SetPending(const Settings &requested);
+
+    /**
+     * @brief Apply pending settings. Restarts history and accumulation of every device
+     */
+    void ApplyPending();
+
+    /**
+     * @brief Append block to device history, computing segments and records on the way
+     */
+    void Append(const Block &block);
+
+    /**
+     * @brief Compute periodogram of every channel from history and add band powers to accumulators
+     */
+    void Segment(Device &dev, size_t index);
+
+    /**
+     * @brief Send averaged band powers and clear accumulators
+     */
+    void Record(Device &dev, size_t index);
+
+    uint32_t sampleRate;                   ///< Rate of pipeline blocks, Hz
+    Settings settings;                     ///< Active settings
+    size_t hop;                            ///< Samples between segments
+    size_t recordInterval;                 ///< Samples between records
+    size_t bandBins[MaxBands][2];          ///< First and past the last bin of every band
+    float window[FftSize];                 ///< Window coefficients
+    float binScale;                        ///< Density scale of interior bins times bin width
+
+    Device devices[Ads131Pipeline::MaxDevices]; ///< Per device state
+    arm_rfft_fast_instance_f32 fft;        ///< Real FFT instance
+    float fftInput[FftSize];               ///< FFT input, modified by transform
+    float fftOutput[FftSize];              ///< Packed FFT output
+    float binPower[Bins];                  ///< Scaled power of one-sided bins
+
+    k_spinlock pendingLock;                ///< Protects pending settings
+    Settings pendingSettings;              ///< Settings requested by command
+    std::atomic<bool> reloadPending;       ///< Pending settings are not applied yet
+
+    k_msgq blocks;                                  ///< Queue of blocks for worker thread
+    alignas(4) char blocksBuffer[maxQueuedBlocks * sizeof(Block)]; ///< Block queue storage
+    Block outgoing;                                 ///< Block being queued. Used only by system work queue
+    bool gapPending[Ads131Pipeline::MaxDevices];    ///< Block of device was dropped. Used only by system work queue
+    std::atomic<uint32_t> dropped;                  ///< Number of dropped blocks
+    k_thread thread;                                ///< Worker thread
+#if CONFIG_USE_FEEDBACK
+    FeedbackEngine *feedback = nullptr;             ///< Feedback engine fed with segment band powers
+#endif
+
+    SensorStream<SensorId::BandPower, Bluetooth::BandPowerNotify> stream; ///< Band power record stream
+};
@@ -51,6 +51,41 @@ namespace Bluetooth::Gatt
      */
     extern atomic_t iBeaconNotificationsEnable;
 
+    /**
+     * @brief State of the Vitals Notifications.
+     */
+    extern atomic_t vitalsNotificationsEnable;
+
+    /**
+     * @brief State of the Orientation Notifications.
+     */
+    extern atomic_t orientationNotificationsEnable;
+
+    /**
+     * @brief State of the Band Power Notifications.
+     */
+    extern atomic_t bandPowerNotificationsEnable;
+
+    /**
+     * @brief State of the DMIC Spectrum Notifications.
+     */
+    extern atomic_t dmicSpectrumNotificationsEnable;
+
+    /**
+     * @brief State of the DMIC Audio Notifications.
+     */
+    extern atomic_t dmicAudioNotificationsEnable;
+
+    /**
+     * @brief State of the Signal Quality Notifications.
+     */
+    extern atomic_t signalQualityNotificationsEnable;
+
+    /**
+     * @brief State of the Capture Event Notifications.
+     */
+    extern atomic_t captureEventNotificationsEnable;
+
     /**
      * @brief GATT service
      */
@@ -96,6 +131,41 @@ namespace Bluetooth::Gatt
      */
     constexpr static int CharacteristiciBeaconData = 25;
 
+    /**
+     * @brief Index of the Gatt Vitals Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicVitalsData = 30;
+
+    /**
+     * @brief Index of the Gatt Orientation Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicOrientationData = 33;
+
+    /**
+     * @brief Index of the Gatt Band Power Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicBandPowerData = 36;
+
+    /**
+     * @brief Index of the Gatt DMIC Spectrum Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicDmicSpectrumData = 39;
+
+    /**
+     * @brief Index of the Gatt DMIC Audio Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicDmicAudioData = 42;
+
+    /**
+     * @brief Index of the Gatt Signal Quality Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicSignalQualityData = 45;
+
+    /**
+     * @brief Index of the Gatt Capture Event Data characteristic in service characteristic table
+     */
+    constexpr static int CharacteristicCaptureEventData = 48;
+
     /**
      * @brief Callback called when Bluetooth is initialized. Starts BLE server
      * 
@@ -122,4 +192,16 @@ namespace Bluetooth::Gatt
      * @param action Action to call when command ith commandId is received via BLE
      */
     void GattSetControlCallback(CommandId commandId, BleControlAction&& action);
+
+    /**
+     * @brief Pass complete command to the registered Control callback. Used by transports other than BLE
+     * 
+     * @param commandId command ID
+     * @param key command key
+     * @param buffer command data
+     * @param length command data length
+     * 
+     * @return true if handler was found and command was processed succesfully
+     */
+    bool GattDispatchControlCommand(CommandId commandId, CommandKey key, const uint8_t* buffer, BleLength length);
 }
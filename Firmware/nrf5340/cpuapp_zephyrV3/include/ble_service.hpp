@@ -62,6 +62,62 @@ namespace Bluetooth
      */
     void Bme280Notify(const uint8_t* data, const uint8_t len);
 
+    /**
+     * @brief Send BLE notification through Vitals Data Pipe.
+     * 
+     * @param data pointer to datasource containing vitals record
+     * @param len  record length
+     */
+    void VitalsNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through Orientation Data Pipe.
+     * 
+     * @param data pointer to datasource containing quaternion record
+     * @param len  record length
+     */
+    void OrientationNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through Band Power Data Pipe.
+     * 
+     * @param data pointer to datasource containing band power record
+     * @param len  record length
+     */
+    void BandPowerNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through DMIC Spectrum Data Pipe.
+     * 
+     * @param data pointer to datasource containing spectrum or level record
+     * @param len  record length
+     */
+    void DmicSpectrumNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through DMIC Audio Data Pipe.
+     * 
+     * @param data pointer to datasource containing IMA ADPCM packet
+     * @param len  packet length
+     */
+    void DmicAudioNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through Signal Quality Data Pipe.
+     * 
+     * @param data pointer to datasource containing signal quality record
+     * @param len  record length
+     */
+    void SignalQualityNotify(const uint8_t* data, const uint8_t len);
+
+    /**
+     * @brief Send BLE notification through Capture Event Data Pipe.
+     * 
+     * @param data pointer to datasource containing capture event record
+     * @param len  record length
+     */
+    void CaptureEventNotify(const uint8_t* data, const uint8_t len);
+
     /**
      * @brief Start taking signal strength (RSSI) values
      * @param rssi pointer to signal strength value
@@ -97,4 +153,16 @@ namespace Bluetooth
      */
     void GattRegisterControlCallback(CommandId commandId, BleControlAction&& action);
 
+    /**
+     * @brief Execute command through the same handler table as the BLE Control characteristic
+     * 
+     * @param commandId command ID
+     * @param key command key
+     * @param buffer command data
+     * @param length command data length
+     * 
+     * @return true if command was processed succesfully
+     */
+    bool DispatchControlCommand(CommandId commandId, CommandKey key, const uint8_t* buffer, BleLength length);
+
 }
@@ -3,69 +3,66 @@
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/devicetree.h>
-#include <zephyr/drivers/sensor.h>
 #include <zephyr/sys/atomic.h>
 #include <stdlib.h>
 #include <zephyr/logging/log.h>
 
+#include "i2c_transport.hpp"
+#include "device_string.hpp"
 #include "ble_service.hpp"
 #include "usb_comm_handler.hpp"
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
+#include "sensor_module.hpp"
 
 class UsbCommHandler;
 
-namespace
+#define BME280_ADDRESS              DT_REG_ADDR(DT_NODELABEL(bme280))
+
+#define BME280_REG_CALIB_00         0x88 //[0x88:0xA1] dig_T1 - dig_H1
+#define BME280_REG_ID               0xD0
+#define BME280_REG_RESET            0xE0
+#define BME280_REG_CALIB_26         0xE1 //[0xE1:0xE7] dig_H2 - dig_H6
+#define BME280_REG_CTRL_HUM         0xF2 //[2:0] osrs_h
+#define BME280_REG_STATUS           0xF3 //[3] measuring, [0] im_update
+#define BME280_REG_CTRL_MEAS        0xF4 //[7:5] osrs_t, [4:2] osrs_p, [1:0] mode
+#define BME280_REG_CONFIG           0xF5 //[7:5] t_sb, [4:2] filter
+#define BME280_REG_PRESS_MSB        0xF7 //[0xF7:0xFE] pressure, temperature, humidity
+
+#define BME280_RESET_VALUE          0xB6
+#define BME280_OVERSAMPLING_1X      0x01
+#define BME280_MODE_SLEEP           0x00
+#define BME280_MODE_FORCED          0x01
+
+/**
+ * @brief Keys for CommandId::Bme280Cmd commands, in addition to BleCommand
+ */
+enum class Bme280Command : uint8_t
 {
-    constexpr static int stackSize = 1024;           ///< Worker thread size
-    constexpr static int taskPriority = 7;           ///< Worker thread priority
-    K_THREAD_STACK_DEFINE(pollStackArea, stackSize); ///< Worker thread stack
-
-struct bme280_data {
-	/* Compensation parameters. */
-	uint16_t dig_t1;
-	int16_t dig_t2;
-	int16_t dig_t3;
-	uint16_t dig_p1;
-	int16_t dig_p2;
-	int16_t dig_p3;
-	int16_t dig_p4;
-	int16_t dig_p5;
-	int16_t dig_p6;
-	int16_t dig_p7;
-	int16_t dig_p8;
-	int16_t dig_p9;
-	uint8_t dig_h1;
-	int16_t dig_h2;
-	uint8_t dig_h3;
-	int16_t dig_h4;
-	int16_t dig_h5;
-	int8_t dig_h6;
-
-	/* Compensated values. */
-	int32_t comp_temp;
-	uint32_t comp_press;
-	uint32_t comp_humidity;
-
-	/* Carryover between temperature and pressure/humidity compensation. */
-	int32_t t_fine;
-
-	uint8_t chip_id;
-};    
-}
+    SetPeriod = 0x10, ///< data: [period lo, period hi]. Sampling period in ms
+};
 
 /**
  * @brief Bme280 driver
+ *
+ * Every period timer queues one asynchronous burst read of the previous forced mode conversion, and the read
+ * completion queues the next conversion. The conversion has the whole period to complete, so the I2C queue is
+ * never blocked waiting for the sensor. Samples are compensated with Bosch integer formulas.
  */
-class Bme280 {   
-  
-    constexpr static auto pollPeriod = 300;  ///< BME280 polling period in milliseconds
+class Bme280 : public SensorModule<Bme280> {
+
+    friend class SensorModule<Bme280>;
+
+    using I2C_1DeviceName = DeviceString<'I', '2', 'C', '_', '1'>;
     constexpr static uint8_t bme280_id = 0x60;
     constexpr static uint8_t bmp280_id_sample_1 = 0x56;
     constexpr static uint8_t bmp280_id_sample_2 = 0x57;
     constexpr static uint8_t bmp280_id_mp = 0x58;
 
 public:
+    constexpr static uint32_t minPeriod = 10;    ///< Forced conversion with 1x oversampling takes up to 9.3 ms
+    constexpr static uint32_t maxPeriod = 60000; ///< Maximum sampling period in milliseconds
+
     /**
      * @brief Construct a new Bme280 object
      */
@@ -76,155 +73,189 @@ public:
      * could not be done in constructor
      * @return Status, 0 for no errors
      */
-    int Initialize();    
+    int Initialize();
+
+    /**
+     * @brief Initialize device and start sampling
+     * @return Status, 0 for no errors
+     */
+    int Start();
 
     /**
      * @brief Start taking BME280 samples (ambient tempeature, pressure, himidity)
      */
-    void StartSampling();    
+    void StartSampling();
 
     /**
      * @brief Stop taking BME280 samples (ambient tempeature, pressure, himidity)
      */
     void StopSampling();
 
+    /**
+     * @brief Set sampling period. Restarts sampling if it is running
+     *
+     * @param period sampling period in milliseconds, minPeriod - maxPeriod
+     * @return true if period is valid
+     */
+    bool SetPeriod(uint32_t period);
+
     /**
      * @brief Check if either BME280 or BMP280 device is connected to I2C bus
      * @return TRUE if either of BME280 or BMP280 is on the bus, FALSE otherwise
      */
-    bool BmX280IsOnI2cBus(); 
+    bool BmX280IsOnI2cBus();
 
     /**
      * @brief Check if BME280 device is connected to I2C bus
      * @return TRUE if BME280 is on the bus, FALSE otherwise
      */
-    bool Bme280IsOnI2cBus(); 
+    bool Bme280IsOnI2cBus();
 
 private:
+    constexpr static size_t samplesPerPacket = 3;      ///< Samples in one packet
+    constexpr static size_t sensorValueSize = 8;       ///< Channel value: integer part and millionths, int32 each
+    constexpr static size_t headerSize = 2;            ///< Chip ID and packet counter
+    constexpr static size_t calibrationSize = 26;       ///< dig_T1 - dig_H1
+    constexpr static size_t humidityCalibrationSize = 7; ///< dig_H2 - dig_H6
+    constexpr static size_t bme280DataSize = 8;        ///< Pressure, temperature and humidity registers
+    constexpr static size_t bmp280DataSize = 6;        ///< Pressure and temperature registers
+    constexpr static uint32_t resetTimeoutMs = 20;     ///< Maximum wait for reset to complete
+
     /**
-     * @brief Main working thread. Used to perform accelerometer polling.
-     * Due possible blocking during accelerometer measurments reading
-     * it required a separate stack to not break main BLE stack state machine
-     * 
-     * @param data pointer to this
+     * @brief Compensation parameters read from sensor NVM
      */
-    static void WorkingThread(void *data, void *, void *){
-        Bme280 *self = static_cast<Bme280 *>(data);
-        int ret = 0;        
-        self->tx_buf[0] = self->bmx_id;
-
-        for (;;)
-        {
-            k_sem_take(&self->pollSemaphore, K_FOREVER);
+    struct Calibration
+    {
+        uint16_t dig_t1;
+        int16_t dig_t2;
+        int16_t dig_t3;
+        uint16_t dig_p1;
+        int16_t dig_p2;
+        int16_t dig_p3;
+        int16_t dig_p4;
+        int16_t dig_p5;
+        int16_t dig_p6;
+        int16_t dig_p7;
+        int16_t dig_p8;
+        int16_t dig_p9;
+        uint8_t dig_h1;
+        int16_t dig_h2;
+        uint8_t dig_h3;
+        int16_t dig_h4;
+        int16_t dig_h5;
+        int8_t dig_h6;
+    };
 
-            ret = sensor_sample_fetch(self->bme280_dev);
-            ret += sensor_channel_get(self->bme280_dev, SENSOR_CHAN_AMBIENT_TEMP, &self->temperature_channel);
-            ret += sensor_channel_get(self->bme280_dev, SENSOR_CHAN_PRESS, &self->pressure_channel);
-		    
-            if(self->Bme280IsOnI2cBus()){ // If BME280 is on I2C Buss
-               ret += sensor_channel_get(self->bme280_dev, SENSOR_CHAN_HUMIDITY, &self->humidity_channel);
-
-                if (ret == 0){
-                    memcpy((self->tx_buf + 24*self->sample_cnt + 2), &self->temperature_channel.val1, sizeof(self->temperature_channel));
-                    memcpy((self->tx_buf + 24*self->sample_cnt + 10), &self->pressure_channel.val1, sizeof(self->pressure_channel));
-                    memcpy((self->tx_buf + 24*self->sample_cnt + 18), &self->humidity_channel.val1, sizeof(self->humidity_channel));
-
-                    self->sample_cnt++;
-
-                    if(self->sample_cnt == 3){
-                        self->sample_cnt = 0;
-                        self->tx_buf[1] = self->packet_cnt;
-                        self->packet_cnt++;
-                        self->serialHandler.SendBme280Samples(self->tx_buf, 74);
-                        Bluetooth::Bme280Notify(self->tx_buf, 74); 
-                    }
-                } else {
+    /**
+     * @brief Reset Bme280 device. Waits at most resetTimeoutMs for calibration data to be loaded
+     * @return Status, 0 for no errors
+     */
+    int Reset();
 
-                }           
-            } else {  // BMP280 is on the bus. Don't fetch Humidity data.
-                if (ret == 0){
-                    memcpy((self->tx_buf + 16*self->sample_cnt + 2), &self->temperature_channel.val1, sizeof(self->temperature_channel));
-                    memcpy((self->tx_buf + 16*self->sample_cnt + 10), &self->pressure_channel.val1, sizeof(self->pressure_channel));
+    /**
+     * @brief Write oversampling and filter settings, sensor stays in sleep mode
+     * @return Status, 0 for no errors
+     */
+    int WriteSettings();
 
-                    self->sample_cnt++;
+    /**
+     * @brief Reset device after repeated transfer errors and restore calibration, settings and sampling state
+     * @return Status, 0 for no errors
+     * @warning Called from sensor recovery work queue
+     */
+    int Recover();
 
-                    if(self->sample_cnt == 3){
-                        self->sample_cnt = 0;
-                        self->tx_buf[1] = self->packet_cnt;
-                        self->packet_cnt++;
-                        self->serialHandler.SendBme280Samples(self->tx_buf, 50);
-                        Bluetooth::Bme280Notify(self->tx_buf, 50); 
-                    }
-                } else {
+    /**
+     * @brief Read ID register and figure out whether we have BMP280 or BME280 on I2C bus
+     */
+    void GetChipId();
 
-                }           
-            }
+    /**
+     * @brief Read compensation parameters
+     */
+    void ReadCalibration();
 
-        }
-    }
+    /**
+     * @brief Set I2C queue deadlines of the periodic transfers from the sampling period
+     */
+    void UpdateDeadlines();
 
     /**
-     * @brief Reset Bme280 device
+     * @brief Handle Bme280Command keys
+     *
+     * @param key command key
+     * @param buffer command data
+     * @param length command data length
+     *
+     * @return true if command was processed succesfully
      */
-    void Reset();
+    bool OnCommand(uint8_t key, const uint8_t *buffer, size_t length);
 
     /**
-     * @brief Get a device structure from a devicetree node with compatible
-     * "bosch,bme280". (If there are multiple, just pick one.)
+     * @brief Timer handler. Queues read of the last conversion, or the first conversion
+     *
+     * @param tmr timer object
+     * @warning Called at ISR Level, no actual workload should be implemented here
      */
-    const struct device * get_bme280_device(void);
+    static void TimerHandler(k_timer *tmr);
 
     /**
-     * @brief Shutdown Bme280 device
+     * @brief Called from I2C queue when conversion result is read. Stores sample and starts next conversion
+     *
+     * @param status transfer status
      */
-    void Shutdown();
+    void OnSensorData(int status);
 
     /**
-     * @brief Wakeup Bme280 device
+     * @brief Called from I2C queue when forced conversion is started
+     *
+     * @param status transfer status
      */
-    void Wakeup();
+    void OnConversionStarted(int status);
 
     /**
-     * @brief Read ID register and figure out whether we have BMP280 or BME280 on I2C bus
+     * @brief Compensate raw readings and store sample to packet. Sends packet when it is complete
      */
-    void GetChipId(const struct device *dev);
+    void StoreSample();
 
     /**
-     * @brief Called when trigger mode is received via BLE
-     * 
-     * @param buffer receviced buffer
-     * @param length buffer length
-     * @param offset data offset
-     * 
-     * @return true if command was processed succesfully
+     * @brief Temperature in 0.01 DegC. Updates tFine
      */
-    bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+    int32_t CompensateTemperature(int32_t adc);
 
     /**
-     * @brief Timer handler. Used to queue Reading of the BME280 data.
-     * 
-     * @param tmr timer object
-     * @warning Called at ISR Level, no actual workload should be implemented here
+     * @brief Pressure in Pa, Q24.8
      */
-    static void TimerHandler(k_timer *tmr){
-        Bme280 *self = CONTAINER_OF(tmr, Bme280, timer);
-        k_sem_give(&self->pollSemaphore);
-    }
+    uint32_t CompensatePressure(int32_t adc);
 
-    struct bme280_data * ToData(const struct device *dev);
+    /**
+     * @brief Relative humidity in %, Q22.10
+     */
+    uint32_t CompensateHumidity(int32_t adc);
 
-    const struct device * bme280_dev;
-    uint8_t bmx_id; 
+    /**
+     * @brief Store channel value in integer part and millionths format
+     */
+    static void PutValue(uint8_t *out, int32_t integer, int32_t micro);
+
+    Calibration calibration;               ///< Compensation parameters
+    int32_t tFine;                         ///< Temperature carried over to pressure and humidity compensation
+    uint32_t period = 300;                 ///< Sampling period in milliseconds
+    std::atomic<bool> sampling;            ///< Sampling timer is running
+    std::atomic<bool> conversionStarted;   ///< Forced conversion was started by the previous period
+    uint8_t ctrlMeas;                      ///< CTRL_MEAS value which starts forced conversion
+    uint8_t sensorData[bme280DataSize];    ///< Raw conversion result
+    size_t sensorDataSize;                 ///< Bytes read per conversion
+    I2cTransaction dataTransaction;        ///< Conversion result read
+    I2cTransaction triggerTransaction;     ///< Forced conversion start
+
+    uint8_t bmx_id;
     uint8_t sample_cnt;
     uint8_t packet_cnt;
     std::atomic<bool> bme280_is_on_i2c_bus_; ///< Device status
     std::atomic<bool> bmp280_is_on_i2c_bus_; ///< Device status
-    UsbCommHandler &serialHandler; ///< USB communication controller
-    uint8_t tx_buf[73] = {};
+    I2CTransport<I2C_1DeviceName, BME280_ADDRESS, I2C_SPEED_FAST_PLUS> transport; ///< I2C transport for device, supports up to 3.4 MHz
+    SensorStream<SensorId::Bme280, Bluetooth::Bme280Notify> stream; ///< Sample packet stream
+    uint8_t tx_buf[headerSize + samplesPerPacket * 3 * sensorValueSize] = {};
     k_timer timer;       ///< Timer object
-    k_sem pollSemaphore; ///< Semaphore used to accelerometer polling
-    k_thread worker;     ///< Worker thread
-    struct sensor_value temperature_channel; ///< Value taken from one of the BME280 ambient temperature channel
-    struct sensor_value pressure_channel; ///< Value taken from one of the BME280 pressure channel
-    struct sensor_value humidity_channel; ///< Value taken from one of the BME280 humidity channel
 };
@@ -17,4 +17,10 @@ enum class CommandId : uint8_t
     Tlc5940Cmd = 8,
     BleCmd = 9,    ///< Command for start/stop looking for iBeacon devices
     SystemCmd = 10, ///< For sending commands on the app/system level from where we can control every sensor/module
+    UsbCmd = 11,    ///< USB stream subscription and rate limiting
+    RecorderCmd = 12, ///< Start/Stop/Offload of on-device flash recording
+    OrientationCmd = 13, ///< Orientation fusion output rate and filter gain
+    BandPowerCmd = 14,   ///< ADS131M08 band power rate, window, overlap and bands
+    FeedbackCmd = 15,    ///< On-device biofeedback rules
+    CaptureCmd = 16,     ///< Event-triggered capture mode, windows and triggers
 };
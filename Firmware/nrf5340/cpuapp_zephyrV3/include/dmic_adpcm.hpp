@@ -0,0 +1,90 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "ble_service.hpp"
+#include "ima_adpcm.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+
+/**
+ * @brief IMA ADPCM audio stream of DMIC PCM blocks.
+ *
+ * Samples are encoded straight from DMIC memory slab blocks into the packet being filled, 4 bits per sample. Every
+ * packet is one WAV IMA ADPCM block of SamplesPerPacket samples, so packets decode independently and can be
+ * written to a WAV file (format tag 0x11, block align BlockAlign) unchanged.
+ *
+ * Packet: [sequence u16 LE][first sample index u32 LE][WAV IMA ADPCM block]. Sequence counts packets, sample index
+ * counts recorded samples, so the host can tell lost packets from dropped DMIC blocks. Partial packets are
+ * discarded on gaps.
+ */
+class DmicAdpcm
+{
+public:
+    constexpr static size_t BlockAlign = 204;                                             ///< WAV block size
+    constexpr static size_t SamplesPerPacket = 2 * (BlockAlign - ImaAdpcm::BlockHeaderSize) + 1; ///< Samples per block
+    constexpr static size_t HeaderSize = 6;                                               ///< Packet header size
+    constexpr static size_t PacketSize = HeaderSize + BlockAlign;                         ///< Packet size
+
+    /**
+     * @brief Construct DmicAdpcm
+     *
+     * @param controller USB communication controller
+     */
+    DmicAdpcm(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Applies CONFIG_DMIC_AUDIO_STREAM
+     */
+    void Initialize();
+
+    /**
+     * @brief Encode PCM block
+     *
+     * @param samples mono 16-bit PCM samples
+     * @param count number of samples
+     * @warning Called from DMIC worker thread
+     */
+    void Process(const int16_t *samples, size_t count);
+
+    /**
+     * @brief Account samples of a dropped block. Partial packet is discarded
+     *
+     * @param count number of dropped samples
+     * @warning Called from DMIC worker thread
+     */
+    void Skip(size_t count);
+
+    /**
+     * @brief Discard partial packet before the next block
+     */
+    void Restart();
+
+    /**
+     * @brief Enable or disable audio stream, applied before the next block
+     *
+     * @param enable 1 to stream audio, 0 to stop
+     * @return true if value is valid
+     */
+    bool SetEnabled(uint8_t enable);
+
+private:
+    /**
+     * @brief Start packet with sample as WAV block predictor
+     */
+    void StartPacket(int16_t sample);
+
+    ImaAdpcm::State state;            ///< Encoder state
+    uint8_t packet[PacketSize];       ///< Packet being filled
+    size_t packetSamples;             ///< Samples in packet, 0 if no packet is started
+    uint16_t sequence;                ///< Sequence number of the next packet
+    uint32_t sampleIndex;             ///< Index of the next recorded sample
+
+    std::atomic<bool> enabled;        ///< Audio stream is enabled
+    std::atomic<bool> restartPending; ///< Partial packet must be discarded before the next block
+
+    SensorStream<SensorId::DmicAudio, Bluetooth::DmicAudioNotify> stream; ///< Audio packet stream
+};
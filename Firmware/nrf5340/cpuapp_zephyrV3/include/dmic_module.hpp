@@ -13,6 +13,9 @@
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
 #include "device_string.hpp"
+#include "dmic_adpcm.hpp"
+#include "dmic_spectrum.hpp"
+#include "sensor_module.hpp"
 
 /*************************/
 #include <zephyr/device.h>
@@ -29,11 +32,9 @@
 /* Milliseconds to wait for a block to be read. */
 #define READ_TIMEOUT     1000
 
-#define FFT_LENGTH 32
-
-/* Size of a block for 100 ms of audio data. */
+/* Size of a block for CONFIG_DMIC_BLOCK_MS of audio data. */
 #define BLOCK_SIZE(_sample_rate, _number_of_channels) \
-	(BYTES_PER_SAMPLE * (_sample_rate / 10) * _number_of_channels)
+	(BYTES_PER_SAMPLE * (_sample_rate * CONFIG_DMIC_BLOCK_MS / 1000) * _number_of_channels)
 
 /* Driver will allocate blocks from this slab to receive audio data into them.
  * Application, after getting a given block from the driver and processing its
@@ -42,6 +43,11 @@
 #define MAX_BLOCK_SIZE   BLOCK_SIZE(MAX_SAMPLE_RATE, 1)
 #define BLOCK_COUNT      8
 
+/* Filled blocks waiting for the worker thread before the oldest is dropped. Bounds latency to
+ * (MAX_BACKLOG + 1) blocks.
+ */
+#define MAX_BACKLOG      1
+
 namespace
 {
     constexpr static int stackSizeDmic = 2048;           ///< Worker thread size
@@ -49,16 +55,32 @@ namespace
     K_THREAD_STACK_DEFINE(pollStackAreaDmic, stackSizeDmic); ///< Worker thread stack
 } // namespace
 
+/**
+ * @brief Keys for CommandId::DmicCmd commands, in addition to BleCommand
+ */
+enum class DmicCommand : uint8_t
+{
+    SetSpectrumMode = 0x10, ///< data: [DmicSpectrumMode]
+    SetAverage      = 0x11, ///< data: [frames per record], 1 - 32
+    SetMelBands     = 0x12, ///< data: [bands], 0 for linear spectrum, otherwise 8 - 64
+    ReportBudget    = 0x13, ///< Log cycle budget of the spectrum pipeline
+    SetAudioStream  = 0x14, ///< data: [1 to stream IMA ADPCM audio, 0 to stop]
+};
+
 /**
  * @brief DmicModule driver
  */
-class DmicModule {
-    
+class DmicModule : public SensorModule<DmicModule> {
+
+    friend class SensorModule<DmicModule>;
+
 public:
     /**
      * @brief Construct a new DmicModule object
+     *
+     * @param controller USB communication controller
      */
-    DmicModule();
+    DmicModule(UsbCommHandler &controller);
 
     /**
      * @brief Initialization function. Used to perform actual initialization. Because of software stack initialization
@@ -67,6 +89,12 @@ public:
      */
     int Initialize();
 
+    /**
+     * @brief Initialize microphone. Sampling is started with BleCommand::StartSampling
+     * @return Status, 0 for no errors
+     */
+    int Start();
+
     /**
      * @brief Start taking Audio samples
      */
@@ -78,20 +106,23 @@ public:
     int StopSampling();
 
 private:
+    int do_pdm_transfer(const struct device *dmic_dev, struct dmic_cfg *cfg, size_t block_count);
+
     /**
-     * @brief Called when trigger mode is received via BLE
-     * 
-     * @param buffer receviced buffer
-     * @param length buffer length
-     * @param offset data offset
-     * 
+     * @brief Called for DmicCommand keys
+     *
+     * @param key command key
+     * @param buffer command data
+     * @param length data length
      * @return true if command was processed succesfully
      */
-    bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
-    int do_pdm_transfer(const struct device *dmic_dev, struct dmic_cfg *cfg, size_t block_count);
+    bool OnCommand(uint8_t key, const uint8_t *buffer, size_t length);
 
     static void WorkingThreadDmic(void *data, void *, void *);
     k_thread worker;     ///< Worker thread
     void *mem_blocks;
     const struct device* dmic_dev; ///< Logical device
+    uint32_t dropped;    ///< Number of blocks dropped to bound latency
+    DmicSpectrum spectrum; ///< Spectrum and level records
+    DmicAdpcm adpcm;     ///< IMA ADPCM audio stream
 };
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "arm_math.h"
+
+#include "ble_service.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+
+/**
+ * @brief Output of the DMIC feature pipeline
+ */
+enum class DmicSpectrumMode : uint8_t
+{
+    Off      = 0, ///< No records, no FFTs
+    Spectrum = 1, ///< Linear or mel band spectrum
+    Level    = 2, ///< RMS and peak level
+};
+
+/**
+ * @brief Type of DMIC feature record, first byte of the record
+ */
+enum class DmicRecord : uint8_t
+{
+    LinearSpectrum = 1, ///< Equal width bands from 0 Hz to Nyquist frequency
+    MelSpectrum    = 2, ///< Triangular mel bands from 0 Hz to Nyquist frequency
+    Level          = 3, ///< RMS level, then peak level
+};
+
+/**
+ * @brief Streaming spectrum of DMIC audio.
+ *
+ * PCM blocks are appended to a sliding window of FftSize samples, so frames are independent of DMIC block size. Every
+ * Hop samples the window has its mean removed, is Hann windowed and transformed with arm_rfft_fast_f32. Bin powers
+ * are scaled so their sum is the mean square of the frame relative to full scale, and are summed into equal width
+ * bands or triangular mel bands. Band powers are averaged over a number of frames and sent as one record.
+ *
+ * Record: [DmicRecord][counter][value count][frames averaged][values]. Every value is one byte, 0.5 dB steps from
+ * -120 dBFS: dBFS = value / 2 - 120. Full scale sine is -3 dBFS.
+ *
+ * Cycles of every block and frame are measured with timing functions and reported as share of the application core.
+ */
+class DmicSpectrum
+{
+public:
+    constexpr static size_t FftSize = CONFIG_DMIC_FFT_SIZE; ///< Frame length
+    constexpr static size_t Hop = CONFIG_DMIC_FFT_HOP;      ///< Samples between frames
+    constexpr static size_t LinearBands = 128;              ///< Number of bands of linear spectrum
+    constexpr static size_t MaxMelBands = 64;               ///< Maximum number of mel bands
+    constexpr static size_t MaxAverage = 32;                ///< Maximum number of frames per record
+
+    /**
+     * @brief Construct DmicSpectrum
+     *
+     * @param controller USB communication controller
+     */
+    DmicSpectrum(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Applies Kconfig defaults
+     *
+     * @param rate PCM sample rate, Hz
+     * @param samples samples in one DMIC block
+     * @return Status, 0 for no errors
+     */
+    int Initialize(uint32_t rate, size_t samples);
+
+    /**
+     * @brief Process PCM block
+     *
+     * @param samples mono 16-bit PCM samples
+     * @param count number of samples
+     * @warning Called from DMIC worker thread
+     */
+    void Process(const int16_t *samples, size_t count);
+
+    /**
+     * @brief Drop the sliding window and accumulated frames. Next frame starts with the next block
+     */
+    void Restart();
+
+    /**
+     * @brief Set output, applied before the next block
+     *
+     * @param mode DmicSpectrumMode value
+     * @return true if mode is valid
+     */
+    bool SetMode(uint8_t mode);
+
+    /**
+     * @brief Set number of frames averaged into one record, applied before the next block
+     *
+     * @param count 1 - MaxAverage
+     * @return true if number of frames is valid
+     */
+    bool SetAverage(uint8_t count);
+
+    /**
+     * @brief Set number of mel bands, applied before the next block
+     *
+     * @param bands 0 for linear spectrum, otherwise 8 - MaxMelBands
+     * @return true if number of bands is valid
+     */
+    bool SetMelBands(uint8_t bands);
+
+    /**
+     * @brief Log cycle budget after the next block
+     */
+    void RequestReport();
+
+private:
+    constexpr static size_t Bins = FftSize / 2 + 1; ///< One-sided spectrum bins
+    constexpr static size_t headerSize = 4;         ///< Size of record header
+    constexpr static uint8_t noBand = UINT8_MAX;    ///< Bin outside of mel bands
+
+    /**
+     * @brief Pipeline settings, changed by commands
+     */
+    struct Settings
+    {
+        DmicSpectrumMode mode; ///< Output
+        uint8_t average;       ///< Frames per record
+        uint8_t melBands;      ///< Number of mel bands, 0 for linear spectrum
+    };
+
+    /**
+     * @brief Cycle counters since the last report
+     */
+    struct Budget
+    {
+        uint64_t busyCycles;     ///< Cycles spent in Process
+        uint32_t maxBlockCycles; ///< Longest block
+        uint64_t frameCycles;    ///< Cycles spent in frames
+        uint32_t maxFrameCycles; ///< Longest frame
+        uint32_t frames;         ///< Number of frames
+        uint32_t samples;        ///< Number of processed samples
+    };
+
+    /**
+     * @brief Read pending settings for modification
+     */
+    Settings GetPending();
+
+    /**
+     * @brief Store settings to be applied before the next block
+     */
+    void SetPending(const Settings &requested);
+
+    /**
+     * @brief Apply pending settings. Restarts the window and accumulation
+     */
+    void ApplyPending();
+
+    /**
+     * @brief Map FFT bins to mel bands
+     */
+    void DesignMelBands();
+
+    /**
+     * @brief Append samples to the sliding window, computing frames on the way
+     */
+    void AppendSpectrum(const int16_t *samples, size_t count);
+
+    /**
+     * @brief Accumulate level of samples, sending a record every average times Hop samples
+     */
+    void AppendLevel(const int16_t *samples, size_t count);
+
+    /**
+     * @brief Transform the window and add band powers to accumulators
+     */
+    void Frame();
+
+    /**
+     * @brief Send averaged band powers or levels and clear accumulators
+     */
+    void Record();
+
+    /**
+     * @brief Log cycle budget and clear counters
+     */
+    void Report();
+
+    /**
+     * @brief Convert power relative to full scale to record value
+     */
+    static uint8_t Encode(float power);
+
+    uint32_t sampleRate;                   ///< PCM sample rate, Hz
+    size_t blockSamples;                   ///< Samples in one DMIC block
+    Settings settings;                     ///< Active settings
+    size_t bandCount;                      ///< Values per record
+    uint8_t counter;                       ///< Record counter
+
+    float window[FftSize];                 ///< Hann window
+    float binScale;                        ///< Scale of interior bins to mean square
+    uint8_t binBand[Bins];                 ///< Mel band whose rising edge holds the bin
+    float binWeight[Bins];                 ///< Weight of the bin in rising edge, 1 - weight in falling edge
+
+    float frame[FftSize];                  ///< Sliding window
+    size_t filled;                         ///< Valid samples in sliding window
+    arm_rfft_fast_instance_f32 fft;        ///< Real FFT instance
+    float fftInput[FftSize];               ///< FFT input, modified by transform
+    float fftOutput[FftSize];              ///< Packed FFT output
+    float binPower[Bins];                  ///< Scaled power of one-sided bins
+    float power[MaxMelBands > LinearBands ? MaxMelBands : LinearBands]; ///< Accumulated band powers
+    uint32_t frames;                       ///< Frames accumulated for the next record
+
+    int64_t levelSum;                      ///< Sum of samples for the next level record
+    uint64_t levelSquares;                 ///< Sum of squared samples for the next level record
+    uint32_t levelSamples;                 ///< Samples accumulated for the next level record
+    uint16_t levelPeak;                    ///< Peak magnitude for the next level record
+
+    Budget budget;                         ///< Cycle counters
+    uint32_t reportSamples;                ///< Samples between budget reports, 0 for reports on request only
+    std::atomic<bool> reportPending;       ///< Report was requested by command
+
+    k_spinlock pendingLock;                ///< Protects pending settings
+    Settings pendingSettings;              ///< Settings requested by command
+    std::atomic<bool> reloadPending;       ///< Pending settings are not applied yet
+
+    SensorStream<SensorId::DmicSpectrum, Bluetooth::DmicSpectrumNotify> stream; ///< Feature record stream
+};
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+
+#include <atomic>
+
+#include "arm_math.h"
+
+#include "ads131_pipeline.hpp"
+#include "ble_service.hpp"
+#include "ble_types.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+
+/**
+ * @brief Keys for CommandId::CaptureCmd commands
+ */
+enum class CaptureCommand : uint8_t
+{
+    SetEnabled   = 1, ///< data: [1 holds packets until a trigger, 0 streams live]
+    SetWindow    = 2, ///< data: [pre-trigger ms u16 LE][post-trigger ms u16 LE]
+    Trigger      = 3, ///< Software trigger, aligned to command execution
+    SetThreshold = 4, ///< data: [device][channel][threshold i32 LE]. ADC code crossing that triggers, 0 disables.
+                      ///< A positive threshold triggers when the code rises to it, a negative one when it falls to it
+};
+
+/**
+ * @brief Source of a capture trigger
+ */
+enum class CaptureTrigger : uint8_t
+{
+    Gpio      = 1, ///< Edge on capture-trigger-gpios pin
+    Command   = 2, ///< CaptureCommand::Trigger over BLE or USB
+    Threshold = 3, ///< ADS131M08 channel crossed CaptureCommand::SetThreshold
+};
+
+/**
+ * @brief Event-triggered capture of ADS131M08 and MPU6050 packets.
+ *
+ * While capture mode is enabled, Ads131Pipeline and Mpu6050 hand every packet to the capture instead of publishing
+ * it, so nothing is sent over BLE or USB until a trigger. Packets are kept in RAM rings, one per source, that hold
+ * the pre-trigger window. ADC frames are numbered by one counter, the data ready edges counted by OnDataReady in the
+ * interrupt. A trigger latches, for every ADS131M08 device, the number of the newest frame and the time since its
+ * data ready edge, so the GPIO trigger is aligned to the frame whatever the work queue latency. The data ready work
+ * item calls LatchFrame, which tells how many frames wait in the two-deep ADC FIFO, and reads them oldest first.
+ * Frames are numbered on from the last one read, so when work was coalesced by the work queue the frame still in the
+ * FIFO keeps its own number. Only conversions overwritten in the FIFO leave a gap in the numbers, so packets and
+ * threshold triggers are never shifted against GPIO triggers.
+ *
+ * Packets keep filling the rings until every source passes the post-trigger window, then an event record is sent,
+ * followed by the packets of the window as one burst through the usual ADS131M08 and MPU6050 streams, paced by
+ * CONFIG_EVENT_CAPTURE_BURST_INTERVAL_MS. Rings are cleared and the capture re-arms after the burst. Triggers while
+ * an event is collected or sent are counted as missed.
+ *
+ * Event record: [counter][CaptureTrigger][decimation][missed triggers][trigger uptime ms u32][pre ms u16]
+ * [post ms u16], per ADS131M08 device [trigger frame u32][µs since trigger frame u16][first frame u32][packets],
+ * then [MPU6050 packets]. Frames are ADC frames at the pipeline input, sample N of packet P is frame
+ * first frame + (P * 9 + N) * decimation as long as no frame was skipped. MPU6050 packets are selected by completion
+ * time.
+ */
+class EventCapture
+{
+public:
+    constexpr static size_t MaxDevices = Ads131Pipeline::MaxDevices; ///< Number of ADS131M08 devices
+    constexpr static uint32_t AdcFifoDepth = 2;                       ///< Conversions held by ADS131M08 until read
+
+    /**
+     * @brief Construct EventCapture
+     *
+     * @param controller USB communication controller
+     */
+    EventCapture(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Registers BLE command handler and configures trigger pin
+     *
+     * @param sampleRate ADC sample rate, Hz
+     */
+    void Initialize(uint32_t sampleRate);
+
+    /**
+     * @brief Count data ready edge of ADS131M08 device
+     *
+     * @param device device index, less than MaxDevices
+     * @warning Called from data ready interrupt
+     */
+    void OnDataReady(size_t device);
+
+    /**
+     * @brief Latch number of the oldest ADC frame still in the ADC FIFO
+     *
+     * @param device device index, less than MaxDevices
+     * @return number of frames to read, 0 to AdcFifoDepth. Frames pushed to the pipeline get consecutive numbers
+     * @warning Called from system work queue, before the frames are read
+     */
+    size_t LatchFrame(size_t device);
+
+    /**
+     * @brief Count ADC frame and check threshold trigger
+     *
+     * @param device device index, less than MaxDevices
+     * @param input per channel samples of the current block, scaled by 2^Ads131Pipeline::SampleShift
+     * @param index index of the frame in the block
+     * @warning Called from system work queue
+     */
+    void OnFrame(size_t device, const q31_t (&input)[Ads131Pipeline::Channels][Ads131Pipeline::MaxBlockFrames],
+                 size_t index);
+
+    /**
+     * @brief Keep ADS131M08 packet while capture mode is enabled
+     *
+     * @param device device index, less than MaxDevices
+     * @param packet packet data. Data is copied before function returns
+     * @param length packet length
+     * @param frames ADC frames in packet
+     * @return true if packet is held or dropped, false if it should be published
+     * @warning Called from system work queue
+     */
+    bool HoldAds(size_t device, const uint8_t *packet, size_t length, size_t frames);
+
+    /**
+     * @brief Keep MPU6050 packet while capture mode is enabled
+     *
+     * @param packet packet data. Data is copied before function returns
+     * @param length packet length
+     * @return true if packet is held or dropped, false if it should be published
+     */
+    bool HoldImu(const uint8_t *packet, size_t length);
+
+    /**
+     * @brief Trigger capture
+     *
+     * @param source trigger source
+     * @return true if trigger starts an event
+     * @note Could be called from interrupt
+     */
+    bool Trigger(CaptureTrigger source);
+
+private:
+    constexpr static size_t sourceCount = MaxDevices + 1; ///< ADS131M08 devices and MPU6050
+    constexpr static size_t imuSource = MaxDevices;       ///< Source index of MPU6050
+    constexpr static size_t maxPacketSize = 243;          ///< Largest held packet, MPU6050
+    constexpr static size_t recordSize = 35;              ///< Size of event record
+    constexpr static uint32_t deadlineMs = 1000;          ///< Time after post window when a stalled source is cut off
+
+    /**
+     * @brief Capture state
+     */
+    enum class State : uint8_t
+    {
+        Off,        ///< Packets are published live
+        Armed,      ///< Packets fill pre-trigger rings
+        Collecting, ///< Packets fill post-trigger window
+        Sending,    ///< Event burst is sent, new packets are dropped
+    };
+
+    /**
+     * @brief Held packet
+     */
+    struct Slot
+    {
+        uint32_t time;                ///< Uptime at packet completion, ms
+        uint32_t frame;               ///< First ADC frame of ADS131M08 packet
+        uint32_t end;                 ///< ADC frame after the last one of ADS131M08 packet
+        uint8_t length;               ///< Packet length
+        uint8_t data[maxPacketSize];  ///< Packet
+    };
+
+    /**
+     * @brief Packet ring of one source
+     */
+    struct Source
+    {
+        Slot *slots;          ///< Ring storage
+        size_t capacity;      ///< Number of slots
+        size_t head;          ///< Next slot to write
+        size_t count;         ///< Slots holding packets
+        size_t afterTrigger;  ///< Packets written since trigger
+        size_t first;         ///< Age of the first slot of the burst, counted back from head
+        size_t packets;       ///< Slots of the burst
+        uint32_t frames;      ///< ADC frames per packet, ADS131M08 only
+        bool active;          ///< Source had packets when triggered
+        bool done;            ///< Source passed post-trigger window
+    };
+
+    /**
+     * @brief Trigger position of one device
+     */
+    struct DeviceTrigger
+    {
+        uint32_t frame;  ///< Newest ADC frame at trigger
+        uint16_t offset; ///< Time since data ready edge of the frame, µs
+    };
+
+    /**
+     * @brief Called when capture command is received via BLE
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
+    /**
+     * @brief Enable or disable capture mode. An event in progress is finished first
+     */
+    void SetEnabled(bool enable);
+
+    /**
+     * @brief Set pre- and post-trigger windows. Used by the next trigger
+     */
+    void SetWindow(uint16_t pre, uint16_t post);
+
+    /**
+     * @brief Start event if capture is armed. Lock must be held
+     *
+     * @param source trigger source
+     * @param device device of the threshold trigger, MaxDevices for other sources
+     * @param frame ADC frame of the threshold trigger
+     * @return true if event is started
+     */
+    bool Fire(CaptureTrigger source, size_t device, uint32_t frame);
+
+    /**
+     * @brief Write packet to ring of source
+     *
+     * @param index source index
+     * @param packet packet data
+     * @param length packet length
+     * @param frame first ADC frame of ADS131M08 packet
+     * @param end ADC frame after the last one of ADS131M08 packet
+     * @param frames ADC frames in ADS131M08 packet, 0 for MPU6050
+     * @return true if packet is held or dropped, false if it should be published
+     */
+    bool Hold(size_t index, const uint8_t *packet, size_t length, uint32_t frame, uint32_t end, uint32_t frames);
+
+    /**
+     * @brief Check if slot ends after the post-trigger window of source
+     */
+    bool PastWindow(size_t index, const Slot &slot) const;
+
+    /**
+     * @brief Check if slot ends after the start of the pre-trigger window of source
+     */
+    bool InWindow(size_t index, const Slot &slot) const;
+
+    /**
+     * @brief Select burst packets of every source and build event record. Lock must be held
+     */
+    void PrepareBurst();
+
+    /**
+     * @brief Clear every ring. Lock must be held
+     */
+    void Clear();
+
+    /**
+     * @brief Send event record or the next burst packet, re-arm when the burst is complete
+     */
+    void SendNext();
+
+    /**
+     * @brief Publish packet through the stream of source
+     */
+    void Publish(size_t index, const uint8_t *packet, size_t length);
+
+    /**
+     * @brief Burst work handler
+     *
+     * @param work worker
+     */
+    static void SendWorkHandler(k_work *work);
+
+    /**
+     * @brief Trigger pin interrupt handler
+     */
+    static void TriggerHandler(const device *port, gpio_callback *callback, gpio_port_pins_t pins);
+
+    k_spinlock lock;                        ///< Protects state, rings and trigger
+    State state = State::Off;               ///< Capture state
+    bool enabled = false;                   ///< Capture mode is requested
+    uint16_t preMs;                         ///< Pre-trigger window, ms
+    uint16_t postMs;                        ///< Post-trigger window, ms
+    uint32_t sampleRate;                    ///< ADC sample rate, Hz
+
+    CaptureTrigger triggerSource;           ///< Source of the current event
+    uint32_t triggerTime;                   ///< Uptime at trigger, ms
+    uint16_t eventPreMs;                    ///< Pre-trigger window of the current event, ms
+    uint16_t eventPostMs;                   ///< Post-trigger window of the current event, ms
+    DeviceTrigger triggers[MaxDevices];     ///< Trigger position of every device
+    uint8_t missed;                         ///< Triggers missed since the last event
+    uint8_t counter;                        ///< Event counter
+
+    uint32_t ready[MaxDevices];             ///< Data ready edges of every device
+    uint32_t readyStamp[MaxDevices];        ///< Cycle counter at the last data ready edge
+    uint32_t latched[MaxDevices];           ///< Number of the next frame read. Used by system work queue only
+    uint32_t blockFirst[MaxDevices];        ///< Number of the first frame of the current block. Used by system work queue only
+
+    std::atomic<int32_t> threshold;         ///< Threshold trigger ADC code, 0 if disabled
+    std::atomic<uint8_t> thresholdDevice;   ///< Device of threshold trigger
+    std::atomic<uint8_t> thresholdChannel;  ///< Channel of threshold trigger
+    bool thresholdReached = false;          ///< Threshold channel is past the threshold
+
+    Slot adsSlots[MaxDevices][CONFIG_EVENT_CAPTURE_ADS_PACKETS]; ///< ADS131M08 packet rings
+    Slot imuSlots[CONFIG_EVENT_CAPTURE_IMU_PACKETS];             ///< MPU6050 packet ring
+    Source sources[sourceCount];            ///< Rings of ADS131M08 devices and MPU6050
+
+    k_work_delayable sendWork;              ///< Burst work, also ends collection of stalled sources
+    bool recordPending;                     ///< Event record is not sent yet. Used by burst work only
+    size_t sendSource;                      ///< Source of the next burst packet. Used by burst work only
+    size_t sendPosition;                    ///< Burst packet of source. Used by burst work only
+    uint8_t record[recordSize];             ///< Event record
+    uint8_t burst[maxPacketSize];           ///< Packet being sent
+    gpio_callback triggerCallback;          ///< Trigger pin callback
+
+    SensorStream<SensorId::CaptureEvent, Bluetooth::CaptureEventNotify> eventStream; ///< Event record stream
+    SensorStream<SensorId::Ads131m08_0, Bluetooth::Ads131m08Notify> ads0Stream;     ///< ADS131M08_0 burst stream
+    SensorStream<SensorId::Ads131m08_1, Bluetooth::Ads131m08_1_Notify> ads1Stream;  ///< ADS131M08_1 burst stream
+    SensorStream<SensorId::Mpu6050, Bluetooth::Mpu6050Notify> imuStream;            ///< MPU6050 burst stream
+};
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "ads131_pipeline.hpp"
+#include "ble_types.hpp"
+#include "latency_meter.hpp"
+
+class AudioModule;
+class Tlc5940;
+
+/**
+ * @brief Keys for CommandId::FeedbackCmd commands
+ */
+enum class FeedbackCommand : uint8_t
+{
+    SetRule       = 1, ///< data: [index][FeedbackSource][device][channel][band][FeedbackMapping][FeedbackTarget]
+                       ///< [output][smoothing %][low f32 LE][high f32 LE][output low u16 LE][output high u16 LE]
+    ClearRule     = 2, ///< data: [index], 0xFF clears every rule
+    SetEnabled    = 3, ///< data: [1 to run rules, 0 to stop them and silence their outputs]
+    ReportLatency = 4, ///< Log latencies since the last report
+};
+
+/**
+ * @brief Feature a rule follows
+ */
+enum class FeedbackSource : uint8_t
+{
+    None          = 0, ///< Rule is not used
+    BandPower     = 1, ///< Band power of ADS131M08 [device, channel, band] from every Welch segment, ADC codes squared
+    RelativePower = 2, ///< Band power over the sum of every band of the channel, 0 - 1
+    Amplitude     = 3, ///< Absolute ADC code of ADS131M08 [device, channel], every frame
+    HeartRate     = 4, ///< MAX30102 heart rate, bpm, every vitals record with a valid heart rate
+};
+
+/**
+ * @brief Mapping of feature to output
+ */
+enum class FeedbackMapping : uint8_t
+{
+    Linear    = 0, ///< Feature low - high maps to output low - output high, clamped
+    Log       = 1, ///< Like Linear in log10 of the feature. Low must be positive
+    Threshold = 2, ///< Output high once the feature reaches high, output low once it falls below low
+};
+
+/**
+ * @brief Output a rule drives
+ */
+enum class FeedbackTarget : uint8_t
+{
+    ToneVolume    = 0, ///< Feedback tone volume of AudioModule, %
+    ToneFrequency = 1, ///< Feedback tone frequency of AudioModule, Hz
+    Led           = 2, ///< Grayscale of TLC5940 channel output, 0xFF for every channel, 0 - 4095
+};
+
+/**
+ * @brief On-device biofeedback rule engine.
+ *
+ * Rules map a feature to an output without a round trip through the phone. Features are fed by their producers as
+ * soon as they are computed: band powers by the BandPower worker thread after every Welch segment, frame amplitude
+ * by the ADS131M08 pipeline on every frame, and heart rate by the MAX30102 after every vitals record. Matching rules
+ * are evaluated on the calling thread and drive the output at once, so the engine adds no thread or queue.
+ *
+ * Every feature carries a cycle counter stamp of its newest sample. Latency from the stamp is measured when the rule
+ * hands the output over (decision), when the I2S block with the new tone is filled plus the blocks queued ahead of
+ * it (audio), and when the TLC5940 latches the new grayscale (LED). Outputs are only driven when their value
+ * changes. When several rules drive the same output, the last evaluated one wins.
+ */
+class FeedbackEngine
+{
+public:
+    constexpr static size_t MaxRules = 8;    ///< Number of rules
+    constexpr static size_t MaxBands = 6;    ///< Bands per channel, like BandPower::MaxBands
+    constexpr static uint8_t AllLeds = 0xFF; ///< Led output of every TLC5940 channel
+
+    /**
+     * @brief Construct FeedbackEngine
+     */
+    FeedbackEngine();
+
+    /**
+     * @brief Initialization function. Registers BLE command handler
+     */
+    void Initialize();
+
+#if CONFIG_USE_I2S
+    /**
+     * @brief Set audio module that plays the feedback tone
+     *
+     * @param module audio module, nullptr ignores audio targets
+     */
+    void SetAudio(AudioModule *module);
+#endif
+
+#if CONFIG_USE_TLC5940
+    /**
+     * @brief Set LED driver
+     *
+     * @param driver TLC5940 driver, nullptr ignores LED targets
+     */
+    void SetLeds(Tlc5940 *driver);
+#endif
+
+    /**
+     * @brief Check whether any enabled rule follows source. Lets producers skip preparing features nobody uses
+     */
+    bool Wants(FeedbackSource source) const
+    {
+        return sourceMask.load(std::memory_order_relaxed) & (1u << static_cast<uint8_t>(source));
+    }
+
+    /**
+     * @brief Feed band powers of one channel from a Welch segment
+     *
+     * @param device ADS131M08 device index
+     * @param channel channel index
+     * @param power power of every band, ADC codes squared
+     * @param bands number of bands
+     * @param stamp cycle counter when the newest sample of the segment arrived
+     * @warning Called from BandPower worker thread
+     */
+    void OnBandPower(size_t device, size_t channel, const float *power, size_t bands, uint32_t stamp);
+
+    /**
+     * @brief Feed ADS131M08 frame
+     *
+     * @param device ADS131M08 device index
+     * @param codes ADC code of every channel
+     * @param stamp cycle counter when the frame was read
+     * @warning Called from system work queue
+     */
+    void OnFrame(size_t device, const int32_t (&codes)[Ads131Pipeline::Channels], uint32_t stamp);
+
+    /**
+     * @brief Feed heart rate
+     *
+     * @param bpm heart rate, beats per minute
+     * @param stamp cycle counter when the vitals record was completed
+     */
+    void OnHeartRate(uint8_t bpm, uint32_t stamp);
+
+    /**
+     * @brief Log latencies since the last report
+     */
+    void ReportLatency();
+
+private:
+    constexpr static size_t sourceCount = 5;  ///< Number of FeedbackSource values
+    constexpr static size_t ruleSize = 21;    ///< Size of SetRule data
+    constexpr static uint16_t maxLed = 4095;  ///< Highest TLC5940 grayscale
+    constexpr static uint16_t maxToneFrequency = 20000; ///< Highest tone frequency, Hz
+    constexpr static uint8_t defaultToneVolume = 50;    ///< Tone volume when no rule drives it, %
+
+    /**
+     * @brief Rule and its evaluation state
+     */
+    struct Rule
+    {
+        FeedbackSource source;   ///< Feature, None for unused rule
+        uint8_t device;          ///< ADS131M08 device index
+        uint8_t channel;         ///< Channel index
+        uint8_t band;            ///< Band index
+        FeedbackMapping mapping; ///< Mapping of feature to output
+        FeedbackTarget target;   ///< Driven output
+        uint8_t output;          ///< LED channel
+        float weight;            ///< Smoothing weight of the newest feature, 0 - 1
+        float low;               ///< Feature low edge, log10 for Log mapping
+        float high;              ///< Feature high edge, log10 for Log mapping
+        uint16_t outputLow;      ///< Output at or below low edge
+        uint16_t outputHigh;     ///< Output at or above high edge
+
+        bool primed;             ///< Level holds a smoothed feature
+        bool on;                 ///< Threshold state
+        float level;             ///< Smoothed feature position, 0 at low, 1 at high
+        int32_t last;            ///< Last output, -1 before the first one
+    };
+
+    /**
+     * @brief Called when feedback command is received via BLE
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
+    /**
+     * @brief Parse and store SetRule data
+     *
+     * @return true if rule is valid
+     */
+    bool SetRule(const uint8_t *buffer);
+
+    /**
+     * @brief Start or stop every rule. Stopping silences the tone and switches rule LEDs off
+     */
+    void SetEnabled(bool enable);
+
+    /**
+     * @brief Recompute source mask and tone state from rules
+     */
+    void UpdateSources();
+
+    /**
+     * @brief Evaluate every rule that select accepts and drive changed outputs
+     *
+     * @param select returns true and the feature for rules that follow the fed feature
+     * @param stamp cycle counter of the newest sample of the feature
+     */
+    template <typename Select>
+    void Feed(Select select, uint32_t stamp);
+
+    /**
+     * @brief Apply feature to rule
+     *
+     * @param rule rule, lock must be held
+     * @param feature feature
+     * @param value output of the rule
+     * @return true if output changed
+     */
+    static bool Evaluate(Rule &rule, float feature, uint16_t &value);
+
+    /**
+     * @brief Drive output
+     */
+    void Drive(FeedbackTarget target, uint8_t output, uint16_t value, uint32_t stamp);
+
+    Rule rules[MaxRules];                  ///< Rules, protected by lock
+    k_spinlock lock;                       ///< Protects rules
+    std::atomic<bool> enabled;             ///< Rules are running
+    std::atomic<uint32_t> sourceMask;      ///< Bit of every source followed by an enabled rule
+
+#if CONFIG_USE_I2S
+    AudioModule *audio = nullptr;          ///< Plays the feedback tone
+#endif
+#if CONFIG_USE_TLC5940
+    Tlc5940 *leds = nullptr;               ///< LED driver
+#endif
+
+    LatencyMeter decision[sourceCount];    ///< Feature to output handover latency of every source
+};
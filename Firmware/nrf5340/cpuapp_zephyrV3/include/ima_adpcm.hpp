@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief IMA ADPCM, 4 bits per 16-bit sample. Blocks follow the WAV IMA ADPCM layout (format tag 0x11): predictor
+ *        int16 LE, step index, zero byte, then nibbles of the following samples, low nibble first.
+ */
+namespace ImaAdpcm
+{
+    constexpr static size_t BlockHeaderSize = 4; ///< Size of WAV block header
+    constexpr static uint8_t MaxIndex = 88;      ///< Last step table index
+
+    extern const int16_t stepTable[MaxIndex + 1]; ///< Quantizer step sizes
+    extern const int8_t indexTable[16];           ///< Step index change for every nibble
+
+    /**
+     * @brief Encoder and decoder state
+     */
+    struct State
+    {
+        int32_t predictor; ///< Predicted sample
+        uint8_t index;     ///< Step table index
+    };
+
+    /**
+     * @brief Update predictor and step index with nibble
+     */
+    inline void Update(State &state, uint8_t nibble, int32_t difference)
+    {
+        state.predictor += (nibble & 8) ? -difference : difference;
+        state.predictor = state.predictor > INT16_MAX ? INT16_MAX : state.predictor;
+        state.predictor = state.predictor < INT16_MIN ? INT16_MIN : state.predictor;
+
+        int32_t index = state.index + indexTable[nibble];
+        state.index = index < 0 ? 0 : (index > MaxIndex ? MaxIndex : index);
+    }
+
+    /**
+     * @brief Encode one sample
+     *
+     * @param state encoder state
+     * @param sample PCM sample
+     * @return nibble
+     */
+    inline uint8_t Encode(State &state, int16_t sample)
+    {
+        int32_t step = stepTable[state.index];
+        int32_t delta = sample - state.predictor;
+        int32_t difference = step >> 3;
+        uint8_t nibble = 0;
+
+        if (delta < 0)
+        {
+            nibble = 8;
+            delta = -delta;
+        }
+
+        // Same quantization as the decoder reconstructs, so encoder and decoder predictors stay equal
+        for (uint8_t bit = 4; bit != 0; bit >>= 1)
+        {
+            if (delta >= step)
+            {
+                nibble |= bit;
+                delta -= step;
+                difference += step;
+            }
+            step >>= 1;
+        }
+
+        Update(state, nibble, difference);
+
+        return nibble;
+    }
+
+    /**
+     * @brief Decode one sample
+     *
+     * @param state decoder state
+     * @param nibble encoded sample
+     * @return PCM sample
+     */
+    inline int16_t Decode(State &state, uint8_t nibble)
+    {
+        int32_t step = stepTable[state.index];
+        int32_t difference = step >> 3;
+
+        if (nibble & 4)
+        {
+            difference += step;
+        }
+        if (nibble & 2)
+        {
+            difference += step >> 1;
+        }
+        if (nibble & 1)
+        {
+            difference += step >> 2;
+        }
+
+        Update(state, nibble, difference);
+
+        return static_cast<int16_t>(state.predictor);
+    }
+} // namespace ImaAdpcm
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+/**
+ * @brief Count, mean, min and max of latencies from a cycle counter stamp, in us. Safe to use from any thread
+ */
+class LatencyMeter
+{
+public:
+    /**
+     * @brief Latencies since the last Take
+     */
+    struct Summary
+    {
+        uint32_t count; ///< Number of latencies
+        uint32_t mean;  ///< Mean latency, us
+        uint32_t min;   ///< Shortest latency, us
+        uint32_t max;   ///< Longest latency, us
+    };
+
+    /**
+     * @brief Current cycle counter, used as stamp
+     */
+    static uint32_t Stamp()
+    {
+        return k_cycle_get_32();
+    }
+
+    /**
+     * @brief Add latency from stamp until now, plus delay that is still ahead
+     *
+     * @param stamp cycle counter when the event happened
+     * @param extraUs known delay after now, us
+     */
+    void Add(uint32_t stamp, uint32_t extraUs = 0)
+    {
+        uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - stamp) + extraUs;
+        k_spinlock_key_t key = k_spin_lock(&lock);
+
+        min = (count == 0 || us < min) ? us : min;
+        max = us > max ? us : max;
+        sum += us;
+        count++;
+
+        k_spin_unlock(&lock, key);
+    }
+
+    /**
+     * @brief Return latencies since the last call and start over
+     */
+    Summary Take()
+    {
+        k_spinlock_key_t key = k_spin_lock(&lock);
+        Summary summary = {count, count ? static_cast<uint32_t>(sum / count) : 0, min, max};
+
+        count = 0;
+        sum = 0;
+        min = 0;
+        max = 0;
+
+        k_spin_unlock(&lock, key);
+
+        return summary;
+    }
+
+private:
+    k_spinlock lock = {};
+    uint32_t count = 0;
+    uint64_t sum = 0;
+    uint32_t min = 0;
+    uint32_t max = 0;
+};
@@ -10,8 +10,11 @@
 #include "device_string.hpp"
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
+#include "ppg_processor.hpp"
+#include "sensor_module.hpp"
 
 class UsbCommHandler;
+class FeedbackEngine;
 //#define DT_DRV_COMPAT maxim_max30102
 
 #define MAX30102_REG_INT_STS1 0x00
@@ -126,10 +129,29 @@ class UsbCommHandler;
         MAX30102_INTR_1_A_FULL_EN = 128,
     };
 
+/**
+ * @brief Keys for CommandId::Max30102Cmd commands, in addition to BleCommand::StartSampling and StopSampling
+ */
+enum class Max30102Command : uint8_t
+{
+    SetOutput = 0x10, ///< data: [output mask]. Bit 0 enables raw samples, bit 1 enables vitals records
+};
+
+/**
+ * @brief Max30102 output selected by Max30102Command::SetOutput
+ */
+enum Max30102Output : uint8_t
+{
+    OutputRaw    = BIT(0), ///< Raw Red and IR samples packets
+    OutputVitals = BIT(1), ///< 1 Hz heart rate and SpO2 records. Requires CONFIG_USE_PPG_PROCESSING
+};
+
 /**
  * @brief Max30102 driver
  */
-class Max30102 {
+class Max30102 : public SensorModule<Max30102> {
+
+    friend class SensorModule<Max30102>;
 
     // using I2C_1DeviceName = DeviceString<'I', '2', 'C', '_', '1'>;
     // using I2C_1DeviceName = DeviceString<'i', '2', 'c', '1', 'm', 'a', 'x'>;
@@ -138,7 +160,7 @@ class Max30102 {
 
     constexpr static uint8_t max30102_i2c_address = 0x57; //I2C Address
     constexpr static uint8_t max30102_id = 0x15; // Part ID
-    uint8_t tx_buf[195] = {};
+    uint8_t tx_buf[196] = {}; // 4 byte header followed by up to 32 Red and IR samples
 
     struct max30102_data {
         const struct device *i2c;
@@ -164,6 +186,12 @@ public:
      */
     int Initialize();    
 
+    /**
+     * @brief Initialize device, attach interrupt pin, apply default configuration and start sampling
+     * @return Status, 0 for no errors
+     */
+    int Start();
+
     /**
      * @brief Configure Max30102 device
      * 
@@ -183,7 +211,8 @@ public:
     void StopSampling();
 
     /**
-     * @brief Initiate Single Temperature Reading. Max30102 will generate interrupt when temperature sample is available.
+     * @brief Queue Single Temperature Reading. Max30102 will generate interrupt when temperature sample is available.
+     *        Called periodically while sampling, could be called from ISR.
      */
     void InitiateTemperatureReading();    
 
@@ -197,11 +226,28 @@ public:
      */
     bool IsOnI2cBus(); 
 
+#if CONFIG_USE_PPG_PROCESSING && CONFIG_USE_FEEDBACK
+    /**
+     * @brief Set feedback engine fed with the heart rate of every vitals record
+     *
+     * @param engine feedback engine, nullptr stops feeding heart rate
+     */
+    void SetFeedback(FeedbackEngine *engine);
+#endif
+
 private:
     /**
-     * @brief Reset Max30102 device
+     * @brief Reset Max30102 device. Waits at most resetTimeoutMs for reset to complete
+     * @return Status, 0 for no errors
      */
-    void Reset();
+    int Reset();
+
+    /**
+     * @brief Reset device after repeated transfer errors and restore configuration and sampling state
+     * @return Status, 0 for no errors
+     * @warning Called from sensor recovery work queue
+     */
+    int Recover();
 
     /**
      * @brief Shutdown Max30102 device
@@ -214,22 +260,101 @@ private:
     void Wakeup();
 
     /**
-     * @brief Called when trigger mode is received via BLE
+     * @brief Handle Max30102Command keys
+     *
+     * @param key command key
+     * @param buffer command data
+     * @param length command data length
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnCommand(uint8_t key, const uint8_t *buffer, size_t length);
+
+    /**
+     * @brief Called from I2C queue when interrupt status registers are read
      * 
-     * @param buffer receviced buffer
-     * @param length buffer length
-     * @param offset data offset
+     * @param status transfer status
+     */
+    void OnInterruptStatus(int status);
+
+    /**
+     * @brief Called from I2C queue when FIFO write pointer, overflow counter and read pointer are read.
+     *        Reads exactly the samples available in FIFO.
      * 
-     * @return true if command was processed succesfully
+     * @param status transfer status
+     */
+    void OnFifoPointers(int status);
+
+    /**
+     * @brief Called from I2C queue when FIFO data is read. Sends samples packet
+     * 
+     * @param status transfer status
      */
-    bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+    void OnFifoData(int status);
 
     /**
-     * @brief Read Temperature Registers
+     * @brief Called from I2C queue when temperature registers are read. Temperature is stored for the next packets
+     * 
+     * @param status transfer status
      */
-    void TemperatureRead();
+    void OnTemperature(int status);
+
+    /**
+     * @brief Timer handler. Used to start periodic temperature conversion.
+     * 
+     * @param tmr timer object
+     * @warning Called at ISR Level, no actual workload should be implemented here
+     */
+    static void TemperatureTimerHandler(k_timer *tmr);
+
+    /**
+     * @brief Get effective sample rate of configuration: ADC sample rate divided by FIFO averaging
+     * 
+     * @param config Configuration details
+     * @return sample rate, Hz
+     */
+    static uint32_t SampleRate(const max30102_config &config);
+
+    /**
+     * @brief Pass samples of the current packet to PPG processor and send completed vitals records
+     * 
+     * @param samples number of samples in tx_buf
+     */
+    void ProcessSamples(size_t samples);
+
+    constexpr static size_t fifoDepth = 32;           ///< Number of samples in FIFO
+    constexpr static uint16_t fifoChunkSamples = 8;   ///< Samples per bus transfer of FIFO read
+    constexpr static size_t sampleSize = 6;           ///< Red and IR sample size
+    constexpr static size_t headerSize = 4;           ///< Packet header: counter, overflow counter, TINT, TFRAC
+    constexpr static uint32_t temperaturePeriod = 1000; ///< Temperature conversion period in ms
+    constexpr static uint32_t resetTimeoutMs = 100;     ///< Maximum wait for reset to complete
+
+    I2cTransaction statusTransaction;      ///< Interrupt status read
+    I2cTransaction pointersTransaction;    ///< FIFO pointers read
+    I2cTransaction fifoTransaction;        ///< FIFO data read
+    I2cTransaction temperatureTransaction; ///< Temperature read
+    I2cTransaction tempConfigTransaction;  ///< Temperature conversion start
+    uint8_t interruptStatus[2];            ///< INT_STS1 and INT_STS2 registers
+    uint8_t fifoPointers[3];               ///< FIFO_WR, FIFO_OVF and FIFO_RD registers
+    uint8_t fifoSamples;                   ///< Number of samples requested by current FIFO read
+    uint8_t temperature[2];                ///< TINT and TFRAC registers
+    uint8_t tempConfig;                    ///< TEMP_CFG register value
+    k_timer temperatureTimer;              ///< Temperature conversion timer
+    std::atomic<uint8_t> outputMask;       ///< Enabled outputs, Max30102Output bits
+    std::atomic<bool> sampling;            ///< Set between StartSampling and StopSampling
+    max30102_config activeConfig;          ///< Last applied configuration, restored by recovery
+#if CONFIG_USE_PPG_PROCESSING
+    PpgProcessor ppg;                      ///< Heart rate and SpO2 processing
+#if CONFIG_USE_FEEDBACK
+    FeedbackEngine *feedback = nullptr;    ///< Feedback engine fed with heart rate
+#endif
+#endif
+
     uint8_t packet_cnt;
     std::atomic<bool> max30102_is_on_i2c_bus_; ///< Device status
     I2CTransport<I2C_1DeviceName, max30102_i2c_address> transport; ///< I2C transport for device
-    UsbCommHandler &serialHandler; ///< USB communication controller
+    SensorStream<SensorId::Max30102, Bluetooth::Max30102Notify> stream; ///< Red and IR packet stream
+#if CONFIG_USE_PPG_PROCESSING
+    SensorStream<SensorId::Vitals, Bluetooth::VitalsNotify> vitalsStream; ///< Vitals record stream
+#endif
 };
\ No newline at end of file
@@ -10,8 +10,11 @@
 #include "device_string.hpp"
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
+#include "sensor_module.hpp"
 
 class UsbCommHandler;
+class OrientationFusion;
+class EventCapture;
 
 #define MPU6050_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for InvenSense evaluation board
 #define MPU6050_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC)
@@ -409,7 +412,9 @@ class UsbCommHandler;
 /**
  * @brief MPU6050 driver
  */
-class Mpu6050 {
+class Mpu6050 : public SensorModule<Mpu6050> {
+
+    friend class SensorModule<Mpu6050>;
 
     using I2C_1DeviceName = DeviceString<'I', '2', 'C', '_', '1'>; 
     constexpr static uint8_t mpu6050_id = 0x68; // Part ID
@@ -428,6 +433,12 @@ public:
      */
     int Initialize();    
 
+    /**
+     * @brief Initialize device, attach interrupt pin and apply default configuration
+     * @return Status, 0 for no errors
+     */
+    int Start();
+
     /**
      * @brief Configure Mpu6050 device
      * 
@@ -461,11 +472,48 @@ public:
      */
     bool IsOnI2cBus(); 
 
+    /**
+     * @brief Get number of FIFO overflows since FIFO mode was configured
+     */
+    uint32_t GetFifoOverflows();
+
+#if CONFIG_USE_ORIENTATION_FUSION
+    /**
+     * @brief Set orientation filter fed with every Accel and Gyro sample
+     * 
+     * @param filter orientation filter, nullptr stops feeding samples
+     */
+    void SetFusion(OrientationFusion *filter);
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+    /**
+     * @brief Set event capture that holds packets while capture mode is enabled
+     * 
+     * @param events event capture, nullptr publishes every packet
+     */
+    void SetCapture(EventCapture *events);
+#endif
+
 private:
+    constexpr static size_t samplesPerPacket = 20;   ///< Accel and Gyro samples in one packet
+    constexpr static size_t fifoSampleSize = 12;     ///< Accel and Gyro sample size in FIFO
+    constexpr static size_t fifoSize = 1024;         ///< Size of Mpu6050 FIFO
+    constexpr static uint32_t samplesPerFifoPoll = 10; ///< Expected number of samples in FIFO on every poll
+    constexpr static uint16_t fifoChunkSamples = 4;    ///< Samples per bus transfer of FIFO read
+    constexpr static uint32_t resetTimeoutMs = 100;    ///< Maximum wait for reset to complete
+    /**
+     * @brief Reset Mpu6050 device. Waits at most resetTimeoutMs for reset to complete
+     * @return Status, 0 for no errors
+     */
+    int Reset();
+
     /**
-     * @brief Reset Mpu6050 device
+     * @brief Reset device after repeated transfer errors and restore configuration
+     * @return Status, 0 for no errors
+     * @warning Called from sensor recovery work queue
      */
-    void Reset();
+    int Recover();
 
     /**
      * @brief Shutdown Mpu6050 device
@@ -478,25 +526,123 @@ private:
     void Wakeup();
 
     /**
-     * @brief Called when trigger mode is received via BLE
+     * @brief Read Temperature Registers
+     */
+    void TemperatureRead();
+
+    /**
+     * @brief Called from I2C queue when interrupt status and sensor registers are read
+     * 
+     * @param status transfer status
+     */
+    void OnSensorData(int status);
+
+    /**
+     * @brief INT_STATUS followed by accel, temperature and gyro registers, read with one transfer
+     */
+    constexpr static size_t sensorDataSize = MPU6050_RA_GYRO_XOUT_H + 6 - MPU6050_RA_INT_STATUS;
+
+    I2cTransaction dataTransaction;       ///< Interrupt status and sensor data read
+    uint8_t sensorData[sensorDataSize];   ///< Interrupt status and sensor registers
+
+    /**
+     * @brief Get sample rate of configuration: gyro output rate divided by SMPLRT_DIV
      * 
-     * @param buffer receviced buffer
-     * @param length buffer length
-     * @param offset data offset
+     * @param config Configuration details
+     * @return sample rate, Hz
+     */
+    static uint32_t SampleRate(const mpu6050_config &config);
+
+    /**
+     * @brief Start FIFO poll timer with period matching configured sample rate
      * 
-     * @return true if command was processed succesfully
+     * @param config Configuration details
      */
-    bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+    void StartFifoPolling(const mpu6050_config &config);
 
     /**
-     * @brief Read Temperature Registers
+     * @brief Timer handler. Queues read of FIFO count, unless previous FIFO read is still in progress.
+     * 
+     * @param tmr timer object
+     * @warning Called at ISR Level, no actual workload should be implemented here
      */
-    void TemperatureRead();
+    static void FifoTimerHandler(k_timer *tmr);
+
+    /**
+     * @brief Called from I2C queue when FIFO count is read
+     * 
+     * @param status transfer status
+     */
+    void OnFifoCount(int status);
+
+    /**
+     * @brief Read available FIFO samples with one burst, up to the end of current packet
+     */
+    void ReadFifoSamples();
+
+    /**
+     * @brief Called from I2C queue when FIFO samples are read
+     * 
+     * @param status transfer status
+     */
+    void OnFifoData(int status);
+
+    /**
+     * @brief Called from I2C queue when temperature of completed FIFO packet is read
+     * 
+     * @param status transfer status
+     */
+    void OnFifoTemperature(int status);
+
+    /**
+     * @brief Reset FIFO after overflow with three chained USER_CTRL writes. Partially filled packet is dropped
+     */
+    void ResetFifo();
+
+    /**
+     * @brief Called from I2C queue when a USER_CTRL write of FIFO reset completes. Queues the next write, and ends
+     *        the FIFO read in progress after the last one
+     * 
+     * @param status transfer status
+     */
+    void OnFifoReset(int status);
+
+    /**
+     * @brief Publish completed packet in tx_buf, unless event capture holds it
+     */
+    void PublishPacket();
+
+    bool fifoMode = false;                ///< Samples are read from FIFO instead of on every Data Ready interrupt
+    mpu6050_config activeConfig;          ///< Last applied configuration, restored by recovery
+    k_timer fifoTimer;                    ///< FIFO poll timer
+    std::atomic<bool> fifoBusy;           ///< FIFO read is in progress
+    std::atomic<bool> fifoOverflow;       ///< FIFO overflow interrupt was received
+    std::atomic<uint32_t> fifoOverflows;  ///< Number of FIFO overflows
+    uint32_t fifoAvailable;               ///< Samples in FIFO which are not read yet
+    uint32_t fifoRequested;               ///< Samples requested by current FIFO read
+    uint8_t fifoCount[2];                 ///< FIFO_COUNTH and FIFO_COUNTL
+    uint8_t userControl;                  ///< USER_CTRL value written by the current FIFO reset step
+    uint8_t fifoResetStep;                ///< Next USER_CTRL write of FIFO reset
+    uint32_t samplePeriodUs;              ///< Accel and Gyro sample period, µs
+    int64_t fifoSampleUs;                 ///< Uptime when the next sample read from FIFO was taken, µs
+    int64_t sampleTimeUs;                 ///< Uptime of Data Ready interrupt of the sample being read, µs
+    I2cTransaction fifoCountTransaction;  ///< FIFO count read
+    I2cTransaction fifoDataTransaction;   ///< FIFO samples read
+    I2cTransaction fifoTempTransaction;   ///< Temperature read
+    I2cTransaction fifoResetTransaction;  ///< FIFO reset
+
+#if CONFIG_USE_ORIENTATION_FUSION
+    OrientationFusion *fusion = nullptr;  ///< Orientation filter fed with samples
+#endif
+#if CONFIG_USE_EVENT_CAPTURE
+    EventCapture *capture = nullptr;      ///< Event capture fed with packets
+#endif
+
     uint8_t sample_cnt;
     uint8_t packet_cnt;
     std::atomic<bool> mpu6050_is_on_i2c_bus_; ///< Device status
     I2CTransport<I2C_1DeviceName, MPU6050_DEFAULT_ADDRESS> transport; ///< I2C transport for device
-    UsbCommHandler &serialHandler; ///< USB communication controller
+    SensorStream<SensorId::Mpu6050, Bluetooth::Mpu6050Notify> stream; ///< Accel and Gyro packet stream
 
 };
 
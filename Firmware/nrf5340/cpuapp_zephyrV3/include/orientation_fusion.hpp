@@ -0,0 +1,140 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include "ble_types.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+
+/**
+ * @brief Keys for CommandId::OrientationCmd commands
+ */
+enum class OrientationCommand : uint8_t
+{
+    SetRate  = 1, ///< data: [rate Hz]. Quaternion output rate, 0 stops output
+    SetGain  = 2, ///< data: [beta lo, beta hi]. Filter gain in 0.001 units
+    Reset    = 3, ///< Restart from identity orientation
+};
+
+/**
+ * @brief Madgwick orientation filter fed by MPU6050 accel/gyro and QMC5883L magnetometer samples.
+ *
+ * Runs in float on Cortex-M33 FPU with constant number of operations per sample. Accel and gyro samples drive the
+ * filter, latest magnetometer sample is used for heading correction while it is fresh. Both sensors are on the same
+ * I2C bus, so samples arrive from the same I2C queue thread.
+ *
+ * Every sample comes with the time it was taken, not the time it was read: MPU6050 FIFO samples arrive in bursts
+ * about 100 ms after the first of them was taken. Record timestamps and magnetometer freshness use those times.
+ *
+ * Quaternion record: [counter][timestamp ms, u32 LE][w][x][y][z], components are int16 LE Q14. Timestamp is the
+ * uptime of the last accel/gyro sample of the record.
+ */
+class OrientationFusion
+{
+public:
+    /**
+     * @brief Size of quaternion record
+     */
+    constexpr static size_t RecordSize = 13;
+
+    /**
+     * @brief Construct OrientationFusion
+     *
+     * @param controller USB communication controller
+     */
+    OrientationFusion(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Registers BLE command handler
+     */
+    void Initialize();
+
+    /**
+     * @brief Set accel/gyro sample rate and gyro scale. Called by MPU6050 driver on configuration
+     *
+     * @param sampleRate accel and gyro sample rate, Hz
+     * @param gyroLsbPerDps gyro sensitivity, LSB per degree per second
+     */
+    void SetImuConfig(uint32_t sampleRate, float gyroLsbPerDps);
+
+    /**
+     * @brief Update filter with accel and gyro sample
+     *
+     * @param sample MPU6050 sample: accel XYZ followed by gyro XYZ, int16 big endian
+     * @param timeUs uptime when the sample was taken, µs
+     */
+    void UpdateImu(const uint8_t *sample, int64_t timeUs);
+
+    /**
+     * @brief Store latest magnetometer sample
+     *
+     * @param sample QMC5883L sample: XYZ, int16 little endian
+     * @param timeUs uptime when the sample was taken, µs
+     */
+    void UpdateMagnetometer(const uint8_t *sample, int64_t timeUs);
+
+    /**
+     * @brief Get maximum number of CPU cycles spent in single filter update since the last query
+     */
+    uint32_t GetMaxCycles();
+
+private:
+    /**
+     * @brief Called when orientation command is received via BLE
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
+    /**
+     * @brief Madgwick gradient descent step with magnetometer. Gyro in rad/s, accel and magnetometer in any units
+     */
+    void StepMarg(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz);
+
+    /**
+     * @brief Madgwick gradient descent step without magnetometer. Gyro in rad/s, accel in any units
+     */
+    void StepImu(float gx, float gy, float gz, float ax, float ay, float az);
+
+    /**
+     * @brief Integrate rate of change of quaternion and normalize
+     */
+    void Integrate(float qDot1, float qDot2, float qDot3, float qDot4);
+
+    /**
+     * @brief Send quaternion record over BLE and USB
+     *
+     * @param timeUs uptime of the last sample, µs
+     */
+    void Publish(int64_t timeUs);
+
+    constexpr static float defaultBeta = 0.1f;        ///< Default filter gain
+    constexpr static int64_t magnetometerTimeoutUs = 500000; ///< Magnetometer sample older than this is not used, µs
+
+    float q[4];                          ///< Orientation quaternion w, x, y, z
+    float beta;                          ///< Filter gain
+    float dt;                            ///< Accel/gyro sample period, s
+    float gyroScale;                     ///< Gyro LSB to rad/s
+    uint32_t sampleRate;                 ///< Accel/gyro sample rate, Hz
+
+    int16_t magnetometer[3];             ///< Latest magnetometer sample
+    int64_t magnetometerTimeUs;          ///< Uptime of latest magnetometer sample, µs
+    bool magnetometerValid;              ///< Magnetometer sample was received
+
+    std::atomic<uint8_t> outputRate;     ///< Quaternion output rate, Hz
+    std::atomic<uint16_t> pendingBeta;   ///< Gain requested by command, 0.001 units, 0 if none
+    std::atomic<bool> resetRequested;    ///< Reset requested by command
+    uint32_t samplesSinceOutput;         ///< Filter updates since last published record
+    uint8_t counter;                     ///< Record counter
+    uint32_t maxCycles;                  ///< Maximum cycles of single update
+
+    SensorStream<SensorId::Orientation, Bluetooth::OrientationNotify> stream; ///< Orientation record stream
+};
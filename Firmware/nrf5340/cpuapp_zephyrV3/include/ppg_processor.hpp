@@ -0,0 +1,141 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <stdint.h>
+
+/**
+ * @brief Computes heart rate and SpO2 from MAX30102 Red and IR samples.
+ *
+ * Every sample goes through fixed-point pipeline:
+ *  - DC tracking (first order IIR), DC is kept for R ratio
+ *  - band pass biquad (0.5 - 5 Hz), Q2.30 coefficients with 64 bit accumulator
+ *  - peak detection on IR with adaptive threshold and refractory period
+ *  - SpO2 = 110 - 25 * R, where R = (AC red / DC red) / (AC IR / DC IR) over every beat
+ *
+ * Vitals record is produced once per second of samples.
+ */
+class PpgProcessor
+{
+public:
+    /**
+     * @brief Vitals record. Heart rate and SpO2 are 0 when signal quality is too low
+     */
+    struct Vitals
+    {
+        uint8_t counter;         ///< Record counter
+        uint8_t heartRate;       ///< Heart rate, beats per minute
+        uint8_t spo2;            ///< SpO2, %
+        uint8_t quality;         ///< Average signal quality over the last second, 0 - 100
+        uint16_t perfusionIndex; ///< IR perfusion index (AC / DC), 0.01 % units, LE
+        uint16_t beatInterval;   ///< Average beat to beat interval, ms, LE
+    } __packed;
+
+    /**
+     * @brief Reset pipeline state and compute filter coefficients
+     *
+     * @param sampleRate effective sample rate after FIFO averaging, Hz
+     */
+    void Initialize(uint32_t sampleRate);
+
+    /**
+     * @brief Process one Red and IR sample
+     *
+     * @param red 18-bit Red sample
+     * @param ir  18-bit IR sample
+     * @return signal quality index of the sample, 0 - 100
+     */
+    uint8_t Process(uint32_t red, uint32_t ir);
+
+    /**
+     * @brief Get vitals record. Record is available once per second of processed samples
+     *
+     * @param vitals output record
+     * @return true if new record was stored
+     */
+    bool GetVitals(Vitals &vitals);
+
+    /**
+     * @brief Get maximum number of CPU cycles spent in Process during the last completed second
+     */
+    uint32_t GetMaxCycles();
+
+    /**
+     * @brief Get R ratio of the last beat, Q10. SpO2 is computed from it with the calibration curve
+     */
+    uint32_t GetRatio();
+
+private:
+    constexpr static size_t intervalCount = 4; ///< Number of beat intervals averaged for heart rate
+
+    /**
+     * @brief Second order section with Q2.30 coefficients
+     */
+    struct Biquad
+    {
+        int32_t b0, b1, b2, a1, a2; ///< Coefficients, a0 normalized to 1
+        int32_t x1, x2, y1, y2;     ///< Filter state
+
+        /**
+         * @brief Filter one sample
+         */
+        int32_t Filter(int32_t x);
+    };
+
+    /**
+     * @brief Per LED pipeline state
+     */
+    struct Channel
+    {
+        int32_t dc;    ///< DC estimate, Q8
+        Biquad filter; ///< Band pass filter
+        int32_t max;   ///< Maximum of filtered signal during current beat
+        int32_t min;   ///< Minimum of filtered signal during current beat
+
+        /**
+         * @brief Remove DC and filter sample
+         *
+         * @param sample raw sample
+         * @return band passed sample
+         */
+        int32_t Process(uint32_t sample);
+    };
+
+    /**
+     * @brief Called on every detected beat
+     *
+     * @param interval samples since previous beat
+     */
+    void OnBeat(uint32_t interval);
+
+    /**
+     * @brief Compute signal quality of current sample
+     *
+     * @param ir raw IR sample
+     * @param red raw Red sample
+     */
+    uint8_t Quality(uint32_t red, uint32_t ir);
+
+    uint32_t sampleRate;      ///< Effective sample rate, Hz
+    Channel red;              ///< Red channel
+    Channel ir;               ///< IR channel
+    int32_t envelope;         ///< Decaying peak envelope of IR beat signal
+    int32_t prev[2];          ///< Previous two IR beat signal samples
+    uint32_t sinceBeat;       ///< Samples since last beat
+    bool beatSeen;            ///< At least one beat was detected
+
+    uint32_t intervals[intervalCount]; ///< Last beat intervals, samples
+    size_t intervalIndex;     ///< Next interval slot
+    size_t validIntervals;    ///< Number of stored intervals
+    uint32_t spo2;            ///< Smoothed SpO2, Q8 %
+    uint32_t ratio;           ///< R ratio of last beat, Q10
+    uint32_t perfusionIndex;  ///< IR perfusion index of last beat, 0.01 %
+
+    uint32_t windowSamples;   ///< Samples processed in current second
+    uint32_t windowQuality;   ///< Sum of quality in current second
+    uint8_t counter;          ///< Vitals record counter
+    bool vitalsReady;         ///< Vitals record is ready
+    Vitals vitals;            ///< Last completed vitals record
+    uint32_t maxCycles;       ///< Maximum cycles per sample in current second
+    uint32_t reportedMaxCycles; ///< Maximum cycles per sample in last completed second
+};
@@ -6,12 +6,15 @@
 //#include <zephyr/drivers/i2c.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/spinlock.h>
 #include "i2c_transport.hpp"
 #include "device_string.hpp"
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
+#include "sensor_module.hpp"
 
 class UsbCommHandler;
+class OrientationFusion;
 
 #define QMC5883L_ADDRESS            0x0D
 
@@ -63,10 +66,23 @@ struct qmc5883l_config {
     uint8_t ctrl_reg_2;
 };
 
+/**
+ * @brief Keys for CommandId::Qmc5883lCmd commands, in addition to BleCommand::StartSampling and StopSampling
+ */
+enum class Qmc5883lCommand : uint8_t
+{
+    SetHardIron      = 0x10, ///< data: X, Y, Z offsets, int16 LE raw counts
+    SetSoftIron      = 0x11, ///< data: 3x3 row-major matrix, int16 LE Q12 (4096 = 1.0)
+    ResetCalibration = 0x12, ///< Zero offsets, identity matrix
+    GetStats         = 0x13, ///< Log I2C bus time per sample
+};
+
 /**
  * @brief Qmc5883l driver
  */
-class Qmc5883l {
+class Qmc5883l : public SensorModule<Qmc5883l> {
+
+    friend class SensorModule<Qmc5883l>;
 
     // using I2C_1DeviceName = DeviceString<'I', '2', 'C', '_', '1'>;
     using I2C_1DeviceName = DeviceString<'i', '2', 'c', '1'>;
@@ -87,6 +103,12 @@ public:
      */
     int Initialize();
 
+    /**
+     * @brief Initialize device, attach Data Ready pin, apply default configuration and start sampling
+     * @return Status, 0 for no errors
+     */
+    int Start();
+
     /**
      * @brief Configure Qmc5883l device
      *
@@ -120,11 +142,40 @@ public:
      */
     bool IsOnI2cBus();
 
+#if CONFIG_USE_ORIENTATION_FUSION
+    /**
+     * @brief Set orientation filter fed with every calibrated XYZ sample
+     *
+     * @param filter orientation filter, nullptr stops feeding samples
+     */
+    void SetFusion(OrientationFusion *filter);
+#endif
+
 private:
+    constexpr static size_t samplesPerPacket = 40; ///< XYZ samples in one packet
+    constexpr static size_t sampleSize = 6;        ///< XYZ sample size
+    constexpr static int calibrationShift = 12;    ///< Soft iron matrix is Q12
+
+    /**
+     * @brief Hard and soft iron calibration: calibrated = matrix * (raw - offset)
+     */
+    struct Calibration
+    {
+        int16_t offset[3];    ///< Hard iron offsets, raw counts
+        int16_t matrix[3][3]; ///< Soft iron matrix, Q12
+    };
     /**
      * @brief Reset Qmc5883l device
+     * @return Status, 0 for no errors
      */
-    void Reset();
+    int Reset();
+
+    /**
+     * @brief Reset device after repeated transfer errors and restore configuration and sampling state
+     * @return Status, 0 for no errors
+     * @warning Called from sensor recovery work queue
+     */
+    int Recover();
 
     /**
      * @brief Shutdown Qmc5883l device
@@ -137,27 +188,79 @@ private:
     void Wakeup();
 
     /**
-     * @brief Read Temperature Registers
+     * @brief Handle Qmc5883lCommand keys
+     *
+     * @param key command key
+     * @param buffer command data
+     * @param length command data length
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnCommand(uint8_t key, const uint8_t *buffer, size_t length);
+
+    /**
+     * @brief Called from I2C queue when data, status and temperature registers are read
+     * 
+     * @param status transfer status
      */
-    void TemperatureRead();
+    void OnSensorData(int status);
 
     /**
-     * @brief Called when trigger mode is received via BLE
+     * @brief Set hard and/or soft iron calibration. Both nullptr restore identity calibration
      * 
-     * @param buffer receviced buffer
-     * @param length buffer length
-     * @param offset data offset
+     * @param offset hard iron offsets, nullptr to keep current
+     * @param matrix soft iron matrix, Q12, nullptr to keep current
+     */
+    void SetCalibration(const int16_t *offset, const int16_t (*matrix)[3]);
+
+    /**
+     * @brief Log I2C bus time per sample since the last report
+     */
+    void ReportStats();
+
+    /**
+     * @brief Apply calibration to sample and store it to packet buffer
      * 
-     * @return true if command was processed succesfully
+     * @param raw XYZ sample as read from device
+     * @param out packet buffer position
+     */
+    void StoreSample(const uint8_t *raw, uint8_t *out);
+
+    /**
+     * @brief XYZ data and status registers. Read on every Data Ready
      */
-    bool OnBleCommand(const uint8_t* buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+    constexpr static size_t sampleDataSize = QMC5883L_STATUS_REG + 1 - QMC5883L_X_LSB;
+
+    /**
+     * @brief XYZ data, status and temperature registers. Read once per packet
+     */
+    constexpr static size_t sensorDataSize = QMC5883L_TOUT_MSB + 1 - QMC5883L_X_LSB;
+
+    I2cTransaction dataTransaction;     ///< Sensor data read
+    uint8_t sensorData[sensorDataSize]; ///< Data, status and temperature registers
+    uint8_t temperature[2];             ///< Last temperature reading, sent with every packet
+    std::atomic<bool> readTemperature;  ///< Next burst includes temperature registers
+    std::atomic<bool> sampling;         ///< Set between StartSampling and StopSampling
+    qmc5883l_config activeConfig;       ///< Last applied configuration, restored by recovery
+    int64_t sampleTimeUs;               ///< Uptime of Data Ready interrupt of the sample being read, µs
+
+    Calibration calibration;            ///< Active calibration
+    bool calibrationIdentity;           ///< Calibration does not change samples
+    k_spinlock calibrationLock;         ///< Protects calibration
+
+    uint32_t statSamples;               ///< Samples read since last stats report
+    uint64_t statBusCycles;             ///< Bus cycles of the samples
+    uint32_t statMaxBusCycles;          ///< Maximum bus cycles of a single sample
 
+#if CONFIG_USE_ORIENTATION_FUSION
+    OrientationFusion *fusion = nullptr; ///< Orientation filter fed with samples
+#endif
 
     uint8_t sample_cnt;
     uint8_t packet_cnt;
     std::atomic<bool> qmc5883l_is_on_i2c_bus_; ///< Device status
     I2CTransport<I2C_1DeviceName, QMC5883L_ADDRESS> transport; ///< I2C transport for device
-    UsbCommHandler &serialHandler; ///< USB communication controller
+    SensorStream<SensorId::Qmc5883l, Bluetooth::Qmc5883lNotify> stream; ///< XYZ packet stream
 
 };
 
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+#include <functional>
+
+#include <zephyr/device.h>
+#include <zephyr/spinlock.h>
+
+#include "sensor_id.hpp"
+
+/**
+ * @brief Keys for CommandId::RecorderCmd commands
+ */
+enum class RecorderCommand : uint8_t
+{
+    Start   = 1, ///< Start appending sensor packets to flash
+    Stop    = 2, ///< Stop recording and flush partially filled block
+    Erase   = 3, ///< Erase whole recording area
+    Offload = 4, ///< Stream all recorded blocks from oldest to newest to the host
+    GetInfo = 5, ///< Send recorder state to the host
+};
+
+/**
+ * @brief Records sensor packets to flash using append-only, block aligned log.
+ *
+ * Every block is one flash erase unit:
+ *  - header: magic, sequence number, record count, used payload bytes, CRC32 of everything after the header
+ *  - records growing from the header: [SensorId][length][timestamp ms, u32 LE][data]
+ *  - index growing from the block end: u16 LE offset of every record
+ *
+ * Blocks are written in sequence order and wrap around when recording area is full, overwriting the oldest block.
+ * A block whose CRC does not match was torn by a reset during its write. The boot scan ends at that block and the
+ * log continues there, offload skips it.
+ * Packets are collected in two RAM blocks. While one is written to flash by recorder thread, the other one is filled,
+ * so acquisition is never blocked by flash erase or write.
+ */
+class Recorder
+{
+public:
+    constexpr static size_t BlockSize = 4096;    ///< Size of single block. Must be multiple of flash erase size
+    constexpr static uint32_t BlockMagic = 0x43524E42; ///< "BNRC"
+
+    /**
+     * @brief Block header. Stored at the beginning of every block
+     */
+    struct BlockHeader
+    {
+        uint32_t magic;    ///< BlockMagic
+        uint32_t sequence; ///< Block sequence number, increments with every written block
+        uint16_t count;    ///< Number of records in the block
+        uint16_t used;     ///< Number of bytes used by records
+        uint32_t crc;      ///< CRC32 of the block after the header
+    } __packed;
+
+    /**
+     * @brief Sink used to send offloaded data to the host. Returns false if data could not be queued yet
+     */
+    using OffloadSink = std::function<bool(const uint8_t *buffer, size_t length)>;
+
+    /**
+     * @brief Maximum payload passed to OffloadSink in one call
+     */
+    constexpr static size_t OffloadChunkSize = 240;
+
+    /**
+     * @brief Construct Recorder.
+     * @note Only one instance could be constructed
+     */
+    Recorder();
+
+    /**
+     * @brief Initialization function. Scans recording area to continue the log after the last written block.
+     *
+     * @param sink sink for offloaded data
+     * @return 0 on success, negative error code otherwise
+     */
+    int Initialize(OffloadSink &&sink);
+
+    /**
+     * @brief Append sensor packet to the log. Packet is dropped if recording is stopped or both RAM blocks are busy.
+     *
+     * @param sensorId sensor id
+     * @param buffer   packet data. Data is copied before return
+     * @param length   packet data length
+     */
+    void Append(SensorId sensorId, const uint8_t *buffer, size_t length);
+
+    /**
+     * @brief Start appending sensor packets to flash
+     */
+    void Start();
+
+    /**
+     * @brief Stop recording. Partially filled block is written to flash
+     */
+    void Stop();
+
+    /**
+     * @brief Stop recording and erase whole recording area. Executed by recorder thread
+     */
+    void Erase();
+
+    /**
+     * @brief Stop recording and stream all blocks from oldest to newest to offload sink. Executed by recorder thread.
+     *        Every chunk is [block sequence u32 LE][block offset u16 LE][block data]. Chunk with sequence 0xFFFFFFFF
+     *        and offset set to number of sent blocks marks end of offload.
+     */
+    void Offload();
+
+    /**
+     * @brief Fill recorder state message: [recording, blocks u32, oldest sequence u32, newest sequence u32, dropped u32]
+     *
+     * @param buffer output buffer, at least InfoSize bytes
+     * @return number of bytes written
+     */
+    size_t GetInfo(uint8_t *buffer);
+
+    constexpr static size_t InfoSize = 17; ///< Size of recorder state message
+
+private:
+    /**
+     * @brief Recorder thread. Writes filled blocks to flash and executes erase and offload jobs.
+     *
+     * @param data pointer to current instance of Recorder
+     */
+    static void WorkingThread(void *data, void *, void *);
+
+    /**
+     * @brief Job executed by recorder thread
+     */
+    enum class Job : uint8_t
+    {
+        WriteBlock0, ///< Write RAM block 0 to flash
+        WriteBlock1, ///< Write RAM block 1 to flash
+        Erase,       ///< Erase recording area
+        Offload,     ///< Send recording to the host
+    };
+
+    /**
+     * @brief State of RAM block
+     */
+    enum class BufferState : uint8_t
+    {
+        Free,    ///< Could be filled
+        Filling, ///< Receives records
+        Writing, ///< Waits for or is being written to flash
+    };
+
+    /**
+     * @brief Start new RAM block. Must be called with lock held
+     *
+     * @return true if free RAM block was found
+     */
+    bool OpenBlock();
+
+    /**
+     * @brief Finalize current RAM block. Must be called with lock held. Caller queues write job after releasing lock
+     *
+     * @return index of closed RAM block
+     */
+    int CloseBlock();
+
+    /**
+     * @brief Write RAM block to flash
+     *
+     * @param index RAM block index
+     */
+    void WriteBlock(size_t index);
+
+    /**
+     * @brief Erase whole recording area
+     */
+    void EraseAll();
+
+    /**
+     * @brief Send all valid blocks from oldest to newest to offload sink
+     */
+    void OffloadAll();
+
+    /**
+     * @brief Read and validate block header
+     *
+     * @param slot   flash block index
+     * @param header output header
+     * @return true if block contains valid header
+     */
+    bool ReadHeader(uint32_t slot, BlockHeader &header);
+
+    /**
+     * @brief Check CRC of block after the header
+     *
+     * @param slot   flash block index
+     * @param header block header
+     * @return true if CRC matches
+     */
+    bool CheckCrc(uint32_t slot, const BlockHeader &header);
+
+    /**
+     * @brief Queue job for recorder thread
+     */
+    void QueueJob(Job job);
+
+    const device *flash;            ///< Flash device
+    uint32_t slotCount;             ///< Number of blocks in recording area
+    uint32_t nextSlot;              ///< Flash block written next
+    std::atomic<uint32_t> nextSequence; ///< Sequence number of next block
+    std::atomic<uint32_t> usedSlots; ///< Number of slots from oldest to newest block, damaged blocks included
+    std::atomic<uint32_t> oldestSequence; ///< Sequence of oldest valid block
+
+    uint8_t __aligned(4) blocks[2][BlockSize]; ///< Double buffered RAM blocks
+    std::atomic<BufferState> blockState[2];  ///< State of RAM blocks
+    int activeBlock;                         ///< Block being filled, -1 if none
+    uint16_t activeCount;                    ///< Records in active block
+    uint16_t activeUsed;                     ///< Bytes used by records in active block
+
+    k_spinlock lock;                  ///< Protects active block
+    std::atomic<bool> recording;      ///< Recording is started
+    std::atomic<uint32_t> dropped;    ///< Packets dropped because both RAM blocks were busy
+
+    k_msgq jobQueue;         ///< Recorder thread jobs
+    char jobQueueBuffer[8];  ///< Recorder thread jobs storage
+    OffloadSink offloadSink; ///< Offloaded data sink
+    k_thread thread;         ///< Recorder thread
+};
@@ -12,5 +12,12 @@ enum class SensorId : uint8_t
     Mpu6050         = 4,
     Max30102        = 5,
     Bme280          = 6,
-    Qmc5883l        = 7
+    Qmc5883l        = 7,
+    Vitals          = 8,  ///< Heart rate and SpO2 computed from MAX30102 samples
+    Orientation     = 9,  ///< Orientation quaternions fused from MPU6050 and QMC5883L samples
+    BandPower       = 10, ///< Welch band powers of ADS131M08 channels
+    DmicSpectrum    = 11, ///< Spectrum and level records of DMIC audio
+    DmicAudio       = 12, ///< IMA ADPCM packets of DMIC audio
+    SignalQuality   = 13, ///< Per channel signal quality of ADS131M08 channels
+    CaptureEvent    = 14, ///< Event record sent before every burst of event-triggered capture
 };
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+
+#include <string.h>
+
+#include <atomic>
+#include <functional>
+
+#include "ble_service.hpp"
+#include "ble_types.hpp"
+#include "ble_commands.hpp"
+#include "commandid.hpp"
+#include "sensor_id.hpp"
+#include "sensor_recovery.hpp"
+#include "usb_comm_handler.hpp"
+
+/**
+ * @brief Base of sensor drivers. Provides control command dispatch and interrupt to work queue dispatch.
+ *
+ * Derived class must implement:
+ *  - int Start(): bring the sensor up with its default configuration and start sampling
+ *  - StartSampling() and StopSampling(): called on BleCommand::StartSampling and StopSampling
+ *  - HandleInterrupt(): called from system work queue when interrupt attached with AttachInterrupt fires
+ *  - bool OnCommand(key, buffer, length): optional, called for sensor specific command keys
+ *  - int Recover(): required with EnableRecovery. Reset the sensor with bounded waits and apply its last
+ *    configuration again. Returns 0 for no errors
+ *
+ * Calls to derived class are resolved at compile time, so there are no virtual calls on the interrupt path.
+ *
+ * @tparam Derived sensor driver class
+ */
+template <class Derived>
+class SensorModule
+{
+protected:
+    /**
+     * @brief Register control command handler
+     *
+     * @param commandId command ID of the sensor
+     */
+    void RegisterCommands(CommandId commandId)
+    {
+        Bluetooth::GattRegisterControlCallback(commandId,
+            [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+            {
+                return OnBleCommand(buffer, key, length, offset);
+            });
+    }
+
+    /**
+     * @brief Configure interrupt pin. Every interrupt submits work item which calls Derived::HandleInterrupt
+     *
+     * @param pin interrupt pin from devicetree, flags select pull resistor
+     * @param edge GPIO_INT_EDGE_FALLING or GPIO_INT_EDGE_RISING
+     * @return Status, 0 for no errors
+     */
+    int AttachInterrupt(const gpio_dt_spec &pin, gpio_flags_t edge)
+    {
+        if (!gpio_is_ready_dt(&pin))
+        {
+            return -ENODEV;
+        }
+
+        k_work_init(&interruptWork, &SensorModule::InterruptWorkHandler);
+
+        int ret = gpio_pin_configure_dt(&pin, GPIO_INPUT);
+        ret += gpio_pin_interrupt_configure_dt(&pin, edge);
+        gpio_init_callback(&interruptCallback, &SensorModule::InterruptHandler, BIT(pin.pin));
+        ret += gpio_add_callback(pin.port, &interruptCallback);
+
+        return ret;
+    }
+
+    /**
+     * @brief Enable automatic recovery. After repeated transfer errors reported by transport, Derived::Recover is
+     *        called from sensor recovery work queue. Failed recovery is retried with doubling delay.
+     *
+     * @param transport I2C transport of the sensor
+     */
+    template <class Transport>
+    void EnableRecovery(Transport &transport)
+    {
+        k_work_init_delayable(&recoveryWork, &SensorModule::RecoveryWorkHandler);
+        recovering.store(false, std::memory_order_relaxed);
+        retryDelayMs = minRetryDelayMs;
+        noteRecovery = [&transport](bool recovered) { transport.NoteRecovery(recovered); };
+        resetBus = [&transport]() { return transport.ResetBus(); };
+        transport.SetFailureHandler([this]() { RequestRecovery(); });
+    }
+
+    /**
+     * @brief Default handler of sensor specific command keys. Unknown keys are ignored
+     */
+    bool OnCommand(uint8_t key, const uint8_t *buffer, size_t length)
+    {
+        ARG_UNUSED(key);
+        ARG_UNUSED(buffer);
+        ARG_UNUSED(length);
+        return true;
+    }
+
+private:
+    /**
+     * @brief Called when sensor command is received via BLE or USB
+     *
+     * @param buffer receviced buffer
+     * @param key command key
+     * @param length buffer length
+     * @param offset data offset
+     *
+     * @return true if command was processed succesfully
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+    {
+        if (offset.value != 0 || length.value == 0)
+        {
+            return false;
+        }
+
+        Derived *self = static_cast<Derived *>(this);
+
+        switch (key.key[0])
+        {
+        case static_cast<uint8_t>(BleCommand::StartSampling):
+            self->StartSampling();
+            return true;
+
+        case static_cast<uint8_t>(BleCommand::StopSampling):
+            self->StopSampling();
+            return true;
+
+        default:
+            return self->OnCommand(key.key[0], buffer, length.value);
+        }
+    }
+
+    /**
+     * @brief GPIO interrupt handler. Defers interrupt processing to system work queue
+     *
+     * @warning Called at ISR Level, no actual workload should be implemented here
+     */
+    static void InterruptHandler(const device *port, gpio_callback *cb, gpio_port_pins_t pins)
+    {
+        ARG_UNUSED(port);
+        ARG_UNUSED(pins);
+        SensorModule *self = CONTAINER_OF(cb, SensorModule, interruptCallback);
+        self->interruptCycles.store(k_cycle_get_32(), std::memory_order_relaxed);
+        k_work_submit(&self->interruptWork);
+    }
+
+    /**
+     * @brief Uptime of the last interrupt, so that a sample is stamped when it was ready rather than when it was read
+     *
+     * @return uptime, µs
+     */
+    int64_t InterruptTimeUs()
+    {
+        uint32_t elapsed = k_cycle_get_32() - interruptCycles.load(std::memory_order_relaxed);
+        return static_cast<int64_t>(k_ticks_to_us_floor64(k_uptime_ticks()) - k_cyc_to_us_floor64(elapsed));
+    }
+
+    /**
+     * @brief Work queue handler. Calls Derived::HandleInterrupt
+     *
+     * @warning Called by system work queue in cooperative level
+     */
+    static void InterruptWorkHandler(k_work *work)
+    {
+        SensorModule *self = CONTAINER_OF(work, SensorModule, interruptWork);
+        static_cast<Derived *>(self)->HandleInterrupt();
+    }
+
+    /**
+     * @brief Schedule recovery unless it is already in progress
+     *
+     * @warning Called from the thread of the failed transfer, e.g. I2C queue thread
+     */
+    void RequestRecovery()
+    {
+        if (!recovering.exchange(true, std::memory_order_acq_rel))
+        {
+            SensorRecovery::Schedule(&recoveryWork, K_NO_WAIT);
+        }
+    }
+
+    /**
+     * @brief Recovery work handler. Resets the bus controller after an abandoned transfer, then calls
+     *        Derived::Recover and schedules retry if either fails
+     *
+     * @warning Called by sensor recovery work queue
+     */
+    static void RecoveryWorkHandler(k_work *work)
+    {
+        k_work_delayable *delayable = k_work_delayable_from_work(work);
+        SensorModule *self = CONTAINER_OF(delayable, SensorModule, recoveryWork);
+        int ret = self->resetBus();
+        if (ret == 0)
+        {
+            ret = static_cast<Derived *>(self)->Recover();
+        }
+
+        self->noteRecovery(ret == 0);
+
+        if (ret != 0)
+        {
+            SensorRecovery::Schedule(&self->recoveryWork, K_MSEC(self->retryDelayMs));
+            self->retryDelayMs = MIN(2 * self->retryDelayMs, maxRetryDelayMs);
+            return;
+        }
+
+        self->retryDelayMs = minRetryDelayMs;
+        self->recovering.store(false, std::memory_order_release);
+    }
+
+    constexpr static uint32_t minRetryDelayMs = 100;   ///< Delay before the first retry of failed recovery
+    constexpr static uint32_t maxRetryDelayMs = 10000; ///< Maximum delay between recovery retries
+
+    gpio_callback interruptCallback; ///< Interrupt pin callback
+    k_work interruptWork;            ///< Interrupt work item
+    std::atomic<uint32_t> interruptCycles; ///< Cycle counter at the last interrupt
+    k_work_delayable recoveryWork;   ///< Recovery work item
+    std::atomic<bool> recovering;    ///< Set while recovery is scheduled or running
+    uint32_t retryDelayMs;           ///< Delay before the next retry of failed recovery
+    std::function<void(bool)> noteRecovery; ///< Counts recovery result in bus statistics
+    std::function<int()> resetBus;          ///< Resets controller of a failed bus
+};
+
+/**
+ * @brief Sensor data stream. Sends every packet as BLE notification and over USB
+ *
+ * @tparam Id USB stream ID
+ * @tparam Notify BLE notification function of the sensor characteristic
+ */
+template <SensorId Id, void (*Notify)(const uint8_t *, const uint8_t)>
+class SensorStream
+{
+public:
+    /**
+     * @brief Construct stream
+     *
+     * @param controller USB communication controller
+     */
+    explicit SensorStream(UsbCommHandler &controller) : serialHandler(controller)
+    {
+    }
+
+    /**
+     * @brief Send packet
+     *
+     * @param buffer packet data. Data is copied before function returns
+     * @param length packet length
+     */
+    void Publish(const uint8_t *buffer, size_t length)
+    {
+        Notify(buffer, length);
+        serialHandler.SendData(Id, buffer, length);
+    }
+
+private:
+    UsbCommHandler &serialHandler; ///< USB communication controller
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+namespace SensorRecovery
+{
+    /**
+     * @brief Schedule sensor recovery work. Recovery work runs on its own low priority work queue, so resets and
+     *        register polling of a failed sensor never delay I2C queue threads or system work queue, which carry
+     *        acquisition of the other sensors. Work queue is started on first use.
+     *
+     * @param work recovery work item
+     * @param delay delay before recovery, used as retry back-off
+     */
+    void Schedule(k_work_delayable *work, k_timeout_t delay);
+}
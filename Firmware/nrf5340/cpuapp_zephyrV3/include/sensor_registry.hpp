@@ -0,0 +1,76 @@
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include <zephyr/sys/util_macro.h>
+
+/**
+ * @brief Registry entry of a sensor enabled in Kconfig. Expands to nothing when sensor is disabled
+ *
+ * @param config Kconfig option of the sensor, e.g. CONFIG_USE_MPU6050
+ * @param module sensor object
+ */
+#define SENSOR_REGISTRY_ENTRY(config, module) COND_CODE_1(config, (std::tie(module),), ())
+
+/**
+ * @brief Compile time list of sensor modules. Operations are expanded for every module, without virtual calls
+ *
+ * @tparam Modules sensor module types
+ */
+template <class... Modules>
+class SensorRegistry
+{
+public:
+    /**
+     * @brief Construct registry
+     *
+     * @param list references to sensor modules
+     */
+    explicit SensorRegistry(std::tuple<Modules &...> list) : modules(list)
+    {
+    }
+
+    /**
+     * @brief Call function for every registered module, in registration order
+     *
+     * @param function callable taking module reference
+     */
+    template <class Function>
+    void ForEach(Function &&function)
+    {
+        std::apply([&function](auto &...module) { (function(module), ...); }, modules);
+    }
+
+    /**
+     * @brief Start every registered module
+     *
+     * @return number of modules which failed to start
+     */
+    int StartAll()
+    {
+        int failed = 0;
+        ForEach([&failed](auto &module) { failed += module.Start() != 0; });
+        return failed;
+    }
+
+    /**
+     * @brief Number of registered modules
+     */
+    constexpr static size_t Size()
+    {
+        return sizeof...(Modules);
+    }
+
+private:
+    std::tuple<Modules &...> modules; ///< Registered modules
+};
+
+/**
+ * @brief Create registry from tuple of module references, e.g. std::tuple_cat of SENSOR_REGISTRY_ENTRY entries
+ */
+template <class... Modules>
+SensorRegistry<Modules...> MakeSensorRegistry(std::tuple<Modules &...> list)
+{
+    return SensorRegistry<Modules...>(list);
+}
@@ -3,10 +3,13 @@
 #include <zephyr/kernel.h>
 
 #include <atomic>
+#include <functional>
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/usb/usb_device.h>
 #include "istatus_reporter.hpp"
 
 /**
@@ -44,6 +47,23 @@ struct SerialTransfer
     std::atomic<bool> completed; ///< Set to true if when command is completed.
 };
 
+/**
+ * @brief USB device state as reported by USB stack status callbacks
+ */
+enum class UsbState
+{
+    Disconnected, ///< Cable is not connected or bus was reset
+    Configured,   ///< Host has configured the device, port could be opened
+    Suspended,    ///< Bus is suspended
+};
+
+/**
+ * @brief Handler called for every valid packet received from the host. Returns true if the packet was accepted,
+ *        the host gets an Ack for accepted packets and a Neg otherwise.
+ * @warning Called from the serial controller working thread. Packet data is only valid during the call.
+ */
+using SerialReceiveHandler = std::function<bool(const SerialPacket &)>;
+
 /**
  * @brief Serial port communication controller. Encapsulates asyncronus USB/UART communication with the PC.
  */
@@ -75,12 +95,26 @@ public:
     bool QueueTransfer(SerialTransfer *task);
 
     /**
-     * @brief Check if SerialController is initialized
+     * @brief Check if SerialController is initialized and host port is open, so data could be sent
      *      
      * @return true if initialized, false owtherwise
      */
     bool IsInitialized();
 
+    /**
+     * @brief Check if host has opened the port (DTR is set)
+     *      
+     * @return true if port is open, false owtherwise
+     */
+    bool IsPortOpen();
+
+    /**
+     * @brief Register handler for packets received from the host
+     * 
+     * @param handler handler to call when valid packet is received
+     */
+    void SetReceiveHandler(SerialReceiveHandler &&handler);
+
     /**
      * @brief Get status of last operation
      * 
@@ -101,6 +135,27 @@ private:
 
     static void interrupt_handler(const struct device *dev, void *user_data);
 
+    /**
+     * @brief USB stack status callback. Drives USB state machine.
+     * 
+     * @param status USB device status
+     * @param param  status parameter
+     */
+    static void UsbStatusCallback(usb_dc_status_code status, const uint8_t *param);
+
+    /**
+     * @brief Tracks DTR line state while device is configured. Legacy CDC ACM class has no line state
+     *        notification, so line state is sampled with short period and working thread is signalled on change.
+     * 
+     * @param work worker
+     */
+    static void DtrWorkHandler(k_work *work);
+
+    /**
+     * @brief Called by working thread when port is opened by the host. Prepares port for streaming.
+     */
+    void OnPortOpened();
+
     /**
      * @brief Thread used to manage serial controller task working queue and controls high level transfers.
      * 
@@ -123,6 +178,26 @@ private:
      */
     TransferStatus SendNeg();
 
+    /**
+     * @brief Send Ack message.
+     * 
+     * @return TransferStatus transfer status
+     */
+    TransferStatus SendAck();
+
+    /**
+     * @brief Process bytes received from the host. Passes valid frames to the receive handler, acks frames
+     *        the handler accepts and negs malformed or rejected ones.
+     */
+    void ProcessReceived();
+
+    /**
+     * @brief Move bytes from the receive ring buffer into receive buffer until a complete frame is assembled
+     * 
+     * @return true if receive buffer contains complete frame
+     */
+    bool AssembleFrame();
+
     /**
      * @brief Sends prepared send buffer.
      * 
@@ -136,7 +211,7 @@ private:
      * @brief Handles receive from connected UART
      * 
      * @param packet reference where received data should be stored
-     * @return TransferStatus Transfer status.
+     * @return TransferStatus Transfer status. Return TransferStatus::Timeout if no complete frame was received yet.
      */
     TransferStatus Receive(SerialPacket &packet);
 
@@ -161,6 +236,12 @@ private:
     uint8_t recvBuffer[BufferSize]; ///< recevice buffer;
     size_t recvLength;              ///< number of bytes was recived via current transfer
     uint8_t sendBuffer[BufferSize]; ///< send buffer;
+    uint8_t recvData[BufferSize];   ///< payload of the last received packet
+    uint32_t lastRecvTime;          ///< uptime of the last received byte. Used to drop stale partial frames
+
+    ring_buf rxRing;                  ///< Bytes received in interrupt context
+    uint8_t rxRingBuffer[BufferSize]; ///< Receive ring buffer storage
+    SerialReceiveHandler receiveHandler; ///< Handler for packets received from the host
 
     k_sem rxSem; ///< Data received semaphore
     k_sem txSem; ///< Data sent semaphore.
@@ -168,4 +249,9 @@ private:
     k_msgq messageQueue;                   ///< Serial port task queue
     SerialTransfer *buffer[MaxEntryCount]; ///< Serial port task buffer
     std::atomic<bool> serial_is_initialized_; ///< Device status
+
+    std::atomic<UsbState> usbState; ///< Current USB device state
+    std::atomic<bool> portOpen;     ///< DTR state sampled by DTR work
+    k_work_delayable dtrWork;       ///< DTR sampling work
+    k_poll_signal stateSignal;      ///< Raised when port is opened or closed
 };
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include "arm_math.h"
+
+#include "ads131_pipeline.hpp"
+#include "ble_service.hpp"
+#include "sensor_module.hpp"
+
+class UsbCommHandler;
+
+/**
+ * @brief Per channel status bits of a signal quality record
+ */
+enum SignalQualityFlag : uint8_t
+{
+    SignalQualityClipped   = BIT(0), ///< At least one sample reached the ADC rails
+    SignalQualityFlat      = BIT(1), ///< Peak to peak stayed below CONFIG_ADS131_QUALITY_FLAT_CODES
+    SignalQualityLineNoise = BIT(2), ///< Line noise is more than CONFIG_ADS131_QUALITY_LINE_PERCENT of the AC power
+};
+
+/**
+ * @brief Signal quality monitor of ADS131M08 channels.
+ *
+ * Takes every block of ADC samples from Ads131Pipeline before decimation and filtering, so a notch can't hide line
+ * noise. Every sample only updates integer accumulators on system work queue: sum and sum of squares, the line
+ * frequency component (sample times a Q15 cosine and sine from a table), minimum, maximum and the count of samples
+ * at the rails. Once per second of samples, the accumulators of each channel become a status and a record is sent.
+ *
+ * The window is exactly one second, so 50 and 60 Hz fall on a DFT bin. The mean times the sum of the table values
+ * is taken off the line component, so a DC offset does not leak into it through table rounding.
+ *
+ * Record, one per device: [counter][device][channels], then per channel [SignalQualityFlag bits][clipped samples %]
+ * [line noise level][AC RMS level]. Levels are in 0.5 dB steps from -120 dB relative to the full scale ADC code:
+ * dB = value / 2 - 120.
+ */
+class SignalQuality
+{
+public:
+    constexpr static size_t Channels = Ads131Pipeline::Channels; ///< Channels per device
+
+    /**
+     * @brief Construct SignalQuality
+     *
+     * @param controller USB communication controller
+     */
+    SignalQuality(UsbCommHandler &controller);
+
+    /**
+     * @brief Initialization function. Builds line frequency table and clears accumulators
+     *
+     * @param sampleRate ADC sample rate, Hz
+     */
+    void Initialize(uint32_t sampleRate);
+
+    /**
+     * @brief Add block of ADC samples of one device. Sends a record when a second of samples is complete
+     *
+     * @param device device index, less than Ads131Pipeline::MaxDevices
+     * @param input per channel samples, 24-bit ADC codes scaled by 2^Ads131Pipeline::SampleShift
+     * @param frames number of samples per channel
+     * @warning Called from system work queue
+     */
+    void PushBlock(size_t device, const q31_t (&input)[Channels][Ads131Pipeline::MaxBlockFrames], size_t frames);
+
+private:
+    constexpr static size_t headerSize = 3;  ///< Size of record header
+    constexpr static size_t channelSize = 4; ///< Size of channel status in record
+    constexpr static size_t tableBits = 8;   ///< log2 of sine table size
+
+    /**
+     * @brief Accumulators of one channel over the current second
+     */
+    struct Channel
+    {
+        int64_t sum;        ///< Sum of ADC codes
+        int64_t squares;    ///< Sum of squared ADC codes
+        int64_t lineCos;    ///< Sum of ADC codes times Q15 cosine at line frequency
+        int64_t lineSin;    ///< Sum of ADC codes times Q15 sine at line frequency
+        int32_t min;        ///< Lowest ADC code
+        int32_t max;        ///< Highest ADC code
+        uint32_t clipped;   ///< Samples at the rails
+    };
+
+    /**
+     * @brief Per device accumulators
+     */
+    struct Device
+    {
+        Channel channels[Channels]; ///< Accumulators of every channel
+        uint32_t phase;             ///< Line frequency phase, Q32 of a period
+        int64_t cosSum;             ///< Sum of the Q15 cosines used in the current second
+        int64_t sinSum;             ///< Sum of the Q15 sines used in the current second
+        uint32_t samples;           ///< Samples accumulated in the current second
+        uint32_t cycles;            ///< CPU cycles spent accumulating the current second
+        uint8_t counter;            ///< Record counter
+    };
+
+    /**
+     * @brief Clear accumulators of device and restart line phase
+     */
+    static void Reset(Device &dev);
+
+    /**
+     * @brief Accumulate samples of every channel
+     *
+     * @param dev device
+     * @param input per channel samples
+     * @param first index of the first sample
+     * @param count number of samples
+     */
+    void Accumulate(Device &dev, const q31_t (&input)[Channels][Ads131Pipeline::MaxBlockFrames], size_t first,
+                    size_t count);
+
+    /**
+     * @brief Send statuses of every channel and restart accumulators
+     */
+    void Record(Device &dev, size_t index);
+
+    uint32_t sampleRate;                        ///< ADC sample rate, Hz
+    uint32_t lineStep;                          ///< Line frequency phase step per sample, Q32
+    int16_t sine[1 << tableBits];               ///< One period of sine, Q15
+    Device devices[Ads131Pipeline::MaxDevices]; ///< Per device state. Used only by system work queue
+
+    SensorStream<SensorId::SignalQuality, Bluetooth::SignalQualityNotify> stream; ///< Status record stream
+};
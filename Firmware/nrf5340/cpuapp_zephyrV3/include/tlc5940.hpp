@@ -7,6 +7,7 @@
 #include <atomic>
 #include "ble_types.hpp"
 #include "ble_commands.hpp"
+#include "latency_meter.hpp"
               
 struct tlc5940_config {
     struct gpio_dt_spec gsclk_gpio; /**< Reference clock for grayscale PWM control */
@@ -84,6 +85,20 @@ public:
      */
     uint16_t Get(uint8_t channel);
 
+    /**
+     * @brief Set grayscale from a feedback rule and refresh at once instead of on the next 10 ms cycle
+     *
+     * @param channel Tlc5940 channel ID, 0xFF for all channels
+     * @param value Grayscale value to set. 0 - 4095.
+     * @param stamp cycle counter of the feature that caused the change
+     */
+    void SetFeedback(uint8_t channel, uint16_t value, uint32_t stamp);
+
+    /**
+     * @brief Return latencies from SetFeedback stamps to latch since the last call
+     */
+    LatencyMeter::Summary TakeLatchLatency();
+
 private:
 
     int InitializeGpios(void);
@@ -111,7 +126,7 @@ private:
         
         while(1){
             self->Update();
-            k_msleep(10);
+            k_sem_take(&self->refresh, K_MSEC(10));
         }
     }
 
@@ -132,6 +147,10 @@ private:
     uint8_t firstCycleFlag;
     uint8_t gsData[CONFIG_NUM_TLCS * 24];
     k_thread worker; 
+    k_sem refresh;                         ///< Given by SetFeedback, wakes the worker before the next cycle
+    std::atomic<uint32_t> feedbackStamp;   ///< Stamp of the last SetFeedback
+    std::atomic<bool> feedbackPending;     ///< SetFeedback is not latched yet
+    LatencyMeter latchLatency;             ///< SetFeedback to latch latency
 
     const struct device *gpio_dev;
 };
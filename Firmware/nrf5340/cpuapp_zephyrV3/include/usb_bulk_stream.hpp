@@ -0,0 +1,115 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+#include <atomic>
+
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/usb/usb_device.h>
+
+/**
+ * @brief Vendor class USB interface with one bulk IN and one bulk OUT endpoint. Used to stream high rate sensor data
+ *        next to the CDC ACM port, which is kept for commands and logs.
+ *        Data frames use the same format as the serial controller: 0xF0 0xF0 id len data crc8
+ */
+class UsbBulkStream
+{
+public:
+    /**
+     * @brief Construct Usb Bulk Stream.
+     * @note Only one instance could be constructed
+     */
+    UsbBulkStream();
+
+    /**
+     * @brief Initialization function. Must be called before usb_enable, because endpoint configuration is
+     *        used when USB descriptors are built.
+     */
+    void Initialize();
+
+    /**
+     * @brief Check if host has configured the device and bulk IN endpoint could be used
+     *
+     * @return true if configured, false owtherwise
+     */
+    bool IsConfigured();
+
+    /**
+     * @brief Queue data frame for sending via bulk IN endpoint. Frame is either queued completely or dropped.
+     *
+     * @param messageId message id
+     * @param buffer    message data. Data is copied before return
+     * @param length    message data length
+     * @return true if frame was queued, false if device is not configured or transmit buffer is full
+     */
+    bool Write(uint8_t messageId, const uint8_t *buffer, size_t length);
+
+    /**
+     * @brief Get number of frames dropped because transmit buffer was full
+     *
+     * @return number of dropped frames
+     */
+    uint32_t GetDroppedFrames();
+
+private:
+    /**
+     * @brief USB device status callback. Starts bulk transfers when the host configures the device, cancels them and
+     *        discards queued data when the host leaves
+     *
+     * @param cfg    interface configuration
+     * @param status device status
+     * @param param  status parameter
+     */
+    static void OnStatus(usb_cfg_data *cfg, usb_dc_status_code status, const uint8_t *param);
+
+    /**
+     * @brief Bulk IN transfer complete callback. Releases sent bytes and starts next transfer
+     *
+     * @param ep    endpoint
+     * @param tsize number of bytes transferred, negative on error
+     * @param priv  pointer to current instance of Usb Bulk Stream
+     */
+    static void OnWriteComplete(uint8_t ep, int tsize, void *priv);
+
+    /**
+     * @brief Bulk OUT transfer complete callback. In loopback mode echoes received data back to the host
+     *
+     * @param ep    endpoint
+     * @param tsize number of bytes transferred, negative on error
+     * @param priv  pointer to current instance of Usb Bulk Stream
+     */
+    static void OnReadComplete(uint8_t ep, int tsize, void *priv);
+
+    /**
+     * @brief Start bulk IN transfer if no transfer is in progress and transmit buffer is not empty
+     */
+    void StartWrite();
+
+    /**
+     * @brief Start bulk OUT transfer
+     */
+    void StartRead();
+
+    /**
+     * @brief Put raw bytes into transmit buffer and start transfer
+     *
+     * @param buffer data to send
+     * @param length data length
+     * @return true if all data was queued
+     */
+    bool WriteRaw(const uint8_t *buffer, size_t length);
+
+    constexpr static size_t maxTransferSize = 1024; ///< Maximum size of single bulk IN transfer
+    constexpr static size_t readBufferSize = 64;    ///< Bulk OUT buffer size
+
+    ring_buf txRing;                                     ///< Transmit ring buffer
+    uint8_t txRingBuffer[CONFIG_USB_BULK_TX_BUF_SIZE];   ///< Transmit ring buffer storage
+    k_spinlock txLock;                                   ///< Serializes writers of the transmit ring buffer
+    uint32_t claimedSize;                                ///< Bytes passed to bulk IN transfer in progress
+    uint8_t readBuffer[readBufferSize];                  ///< Bulk OUT receive buffer
+
+    std::atomic<bool> configured;    ///< Device is configured by the host
+    std::atomic<bool> writeBusy;     ///< Bulk IN transfer in progress
+    std::atomic<uint32_t> dropped;   ///< Frames dropped because transmit buffer was full
+};
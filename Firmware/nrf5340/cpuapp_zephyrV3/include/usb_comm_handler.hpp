@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <zephyr/sys/atomic.h>
 #include <functional>
 
@@ -8,6 +9,28 @@
 #include "serial_controller.hpp"
 
 #include "sensor_id.hpp"
+#include "usb_message_id.hpp"
+
+#if CONFIG_USE_USB_BULK
+#include "usb_bulk_stream.hpp"
+#endif
+
+#if CONFIG_USE_RECORDER
+#include "recorder.hpp"
+#endif
+
+/**
+ * @brief Keys for CommandId::UsbCmd commands. Used by host to select which sensors are streamed over USB link
+ */
+enum class UsbStreamCommand : uint8_t
+{
+    SetSubscription = 1, ///< data: [mask lo, mask hi]. Bit N enables sensor with SensorId N. All sensors are enabled by default
+    SetDecimation   = 2, ///< data: [SensorId, factor]. Every factor-th packet is sent, 1 sends every packet
+    SetMinInterval  = 3, ///< data: [SensorId, interval lo, interval hi]. Minimum interval between packets in ms, 0 disables cap
+    GetStats        = 4, ///< Sends UsbMessageId::StreamStats message
+    ResetStats      = 5, ///< Clears stream counters
+    GetI2cStats     = 6, ///< Sends UsbMessageId::I2cStats message and starts new I2C statistics window
+};
 
 /**
  * @brief USB/UART transport. Used to pass sensor readings through USB link
@@ -19,6 +42,46 @@ class UsbCommHandler
      */
     constexpr static size_t maxCommands = 20;
 
+    /**
+     * @brief Maximum number of commands received from PC waiting to be executed.
+     */
+    constexpr static size_t maxPendingCommands = 4;
+
+    /**
+     * @brief Maximum payload length of the command received from PC.
+     */
+    constexpr static size_t maxCommandLength = 250;
+
+    /**
+     * @brief Size of per sensor stream table. Indexed by SensorId
+     */
+    constexpr static size_t maxStreams = 16;
+
+    /**
+     * @brief Per sensor stream subscription state and counters
+     */
+    struct StreamControl
+    {
+        std::atomic<uint8_t> decimation;     ///< Every decimation-th packet is sent
+        std::atomic<uint16_t> minIntervalMs; ///< Minimum interval between packets, 0 if not limited
+        uint8_t decimationCounter;           ///< Packets skipped since last sent packet. Used by producer only
+        uint32_t lastSentMs;                 ///< Uptime of last sent packet. Used by producer only
+
+        std::atomic<uint32_t> sent;     ///< Packets queued to the host
+        std::atomic<uint32_t> filtered; ///< Packets skipped by subscription mask, decimation or rate cap
+        std::atomic<uint32_t> dropped;  ///< Packets lost because transmit queue was full
+    };
+
+    /**
+     * @brief Command received from PC. Copied out of serial controller receive buffer.
+     */
+    struct UsbCommand
+    {
+        uint8_t messageId;              ///< Message Id
+        uint8_t length;                 ///< Payload length
+        uint8_t data[maxCommandLength]; ///< Payload
+    };
+
 public:
     /**
      * @brief Construct a new Uart Commands Transport object.
@@ -34,54 +97,110 @@ public:
     void Initialize();
 
     /**
-     * @brief API function for sending Acceleromter Data over USB. Prepares command that contains samples from the Accelerometer sensor
+     * @brief API function for sending ADS131M08 Data over USB. Prepares command that contains samples from the ADS131M08 sensor
      * 
      * @param buffer buffer with message data. Data should be copied before use
      * @param length current data chunk length.
+     * @param sensor_id ID of the ADS131M08 sensor. We currently have two ADS131M08 sensors attached to I2C bus
+     */    
+    void SendAds131m08Samples(const uint8_t *buffer, size_t length, uint8_t sensor_id);
+
+    /**
+     * @brief Send sensor samples to PC. Uses bulk endpoint when it is enabled and configured by the host,
+     *        serial port otherwise.
+     * 
+     * @param sensorId sensor id, used as message id
+     * @param buffer   buffer with message data. Data is copied before return
+     * @param length   data length
+     * @return true if samples were queued
      */
-    void SendAccelSamples(const uint8_t *buffer, size_t length);
+    bool SendData(SensorId sensorId, const uint8_t *buffer, size_t length);
 
+private:
     /**
-     * @brief API function for sending Magnetometer Data over USB. Prepares command that contains samples from the Accelerometer sensor
+     * @brief Callback called by serial controller when command is completed. Releases acuired command resources.
+     * @warning Callback is executed in system working thread callback
      * 
-     * @param buffer buffer with message data. Data should be copied before use
-     * @param length current data chunk length.
+     * @param work worker
      */
-    void SendMagnetometerSamples(const uint8_t *buffer, size_t length);
+    static void CommandCompletedCallback(k_work *work);
 
     /**
-     * @brief API function for sending MAX30102 Data over USB. Prepares command that contains samples from the MAX30102 sensor
+     * @brief Handles CommandId::UsbCmd commands
      * 
-     * @param buffer buffer with message data. Data should be copied before use
-     * @param length current data chunk length.
-     */    
-    void SendMax30102Samples(const uint8_t *buffer, size_t length);    
-    
+     * @param buffer command data
+     * @param key    command key. key[0] is UsbStreamCommand
+     * @param length command data length
+     * @param offset command data offset
+     * @return true if command was processed
+     */
+    bool OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset);
+
     /**
-     * @brief API function for sending ADS131M08 Data over USB. Prepares command that contains samples from the ADS131M08 sensor
+     * @brief Handles CommandId::RecorderCmd commands
      * 
-     * @param buffer buffer with message data. Data should be copied before use
-     * @param length current data chunk length.
-     * @param sensor_id ID of the ADS131M08 sensor. We currently have two ADS131M08 sensors attached to I2C bus
-     */    
-    void SendAds131m08Samples(const uint8_t *buffer, size_t length, uint8_t sensor_id);
+     * @param key    command key. key[0] is RecorderCommand
+     * @return true if command was processed
+     */
+    bool OnRecorderCommand(Bluetooth::CommandKey key);
 
     /**
-     * @brief API function for sending BME280 Data over USB. Prepares command that contains samples from the BME280 sensor
+     * @brief Send non-sample message to PC. Uses bulk endpoint when it is enabled and configured by the host,
+     *        serial port otherwise.
      * 
-     * @param buffer buffer with message data. Data should be copied before use
-     * @param length current data chunk length.
-     */    
-    void SendBme280Samples(const uint8_t *buffer, size_t length); 
+     * @param messageId message id
+     * @param buffer    message data. Data is copied before return
+     * @param length    data length
+     * @return true if message was queued
+     */
+    bool SendMessage(UsbMessageId messageId, const uint8_t *buffer, size_t length);
 
-private:
     /**
-     * @brief Callback called by serial controller when command is completed. Releases acuired command resources.
-     * @warning Callback is executed in system working thread callback
+     * @brief Queue stream counters message to the host
+     * 
+     * @return true if message was queued
+     */
+    bool SendStreamStats();
+
+    /**
+     * @brief Queue I2C bus utilization message to the host
+     * 
+     * @return true if message was queued
+     */
+    bool SendI2cStats();
+
+    /**
+     * @brief Check if samples of the sensor pass subscription mask, decimation and rate cap
+     * 
+     * @param stream   stream state of the sensor
+     * @param index    stream index (SensorId value)
+     * @return true if packet should be sent
+     */
+    bool AcceptPacket(StreamControl &stream, size_t index);
+
+    /**
+     * @brief Called by serial controller for every valid packet received from PC. Queues command for execution.
+     * @warning Called from serial controller working thread
+     * 
+     * @param packet received packet
+     * @return true if command is queued, false if it is dropped
+     */
+    bool OnPacketReceived(const SerialPacket &packet);
+
+    /**
+     * @brief Executes commands received from PC.
+     * @warning Executed in system working thread, same as other deferred sensor work
      * 
      * @param work worker
      */
-    static void CommandCompletedCallback(k_work *work);
+    static void CommandWorkHandler(k_work *work);
+
+    /**
+     * @brief Execute single command received from PC and send response
+     * 
+     * @param command command to execute
+     */
+    void ExecuteCommand(const UsbCommand &command);
 
     /**
      * @brief Creates and initializes Serial Transfer object used to send command to stm8
@@ -94,6 +213,28 @@ private:
      */
     SerialTransfer *CreateTransferFrom(SensorId messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen);
 
+    /**
+     * @brief Creates and initializes Serial Transfer object for non-sample messages
+     * 
+     * @param messageId         message id
+     * @param req               request buffer 
+     * @param reqLen            request buffer length. Set this field to 0 if request contains no data
+     * @param respMaxLen        maximum reponse buffer length. Set this field to 0 if no responce is expected
+     * @return SerialTransfer*  constructed transfer, or nullptr if transfer creation was unsuccessful 
+     */
+    SerialTransfer *CreateTransferFrom(UsbMessageId messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen);
+
+    /**
+     * @brief Creates and initializes Serial Transfer object with raw message id
+     * 
+     * @param messageId         message id
+     * @param req               request buffer 
+     * @param reqLen            request buffer length. Set this field to 0 if request contains no data
+     * @param respMaxLen        maximum reponse buffer length. Set this field to 0 if no responce is expected
+     * @return SerialTransfer*  constructed transfer, or nullptr if transfer creation was unsuccessful 
+     */
+    SerialTransfer *CreateTransferFrom(uint8_t messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen);
+
     /**
      * @brief Queues transfer to UART, and if autoReleaseOnError is set and any error occurs releases transfer and its
      *        allocated buffers
@@ -106,6 +247,7 @@ private:
 
     /**
      * @brief Allocates serial transfer to execute command
+     * @note Could be called from any thread, every sensor sends its samples from its own context
      * 
      * @return SerialTransfer* serial transfers buffer.
      */
@@ -113,6 +255,7 @@ private:
 
     /**
      * @brief Release serial transfer after command execution is complete
+     * @note Could be called from any thread
      * 
      * @param transfer transfer to release
      */
@@ -124,8 +267,25 @@ private:
     SerialPacket recvPackets[maxCommands];       ///< Serial transfer receive buffers
     SerialTransfer transfersBuffer[maxCommands]; ///< Serial transfer commands buffers
 
-    constexpr static size_t capacity = 32;            ///< SPSC circular buffer size
-    std::array<SerialTransfer *, capacity> transfers; ///< SPSC circular buffer
-    std::atomic<int> headIndex;                       ///< SPSC head circular buffer index
-    std::atomic<int> tailIndex;                       ///< SPSC tail circular buffer index
+    constexpr static size_t capacity = 32;            ///< Free transfers circular buffer size
+    std::array<SerialTransfer *, capacity> transfers; ///< Free transfers circular buffer
+    int headIndex = 0;                                ///< Free transfers head index, next released transfer
+    int tailIndex = 0;                                ///< Free transfers tail index, next allocated transfer
+    k_spinlock transfersLock;                         ///< Protects free transfers. Sensors allocate from their own threads
+
+    k_msgq commandQueue;                                         ///< Commands received from PC
+    char __aligned(4) commandQueueBuffer[maxPendingCommands * sizeof(UsbCommand)]; ///< Command queue storage
+    k_work commandWork;                                          ///< Command execution work
+
+#if CONFIG_USE_USB_BULK
+    UsbBulkStream bulk; ///< Vendor bulk endpoint for sensor samples
+#endif
+
+#if CONFIG_USE_RECORDER
+    Recorder recorder; ///< Flash recorder. Records the same packets as sent to the host
+#endif
+
+    std::atomic<uint16_t> subscriptionMask; ///< Bit N enables streaming of sensor with SensorId N
+    StreamControl streams[maxStreams];      ///< Per sensor stream state
+
 };
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Ids for non-sample messages exchanged with the host over the USB link.
+ *        Sample messages use SensorId as message Id, so values here must not overlap with SensorId.
+ */
+enum class UsbMessageId : uint8_t
+{
+    Command         = 0x10, ///< Host -> device. Payload mirrors BLE control write: [CommandId, key0, key1, data...]
+    CommandResponse = 0x11, ///< Device -> host. Payload: [CommandId, key0, key1, result]. result is 0 on success
+    StatusRequest   = 0x12, ///< Host -> device. No payload required
+    StatusResponse  = 0x13, ///< Device -> host. Payload: [serial status]
+    StreamStats     = 0x14, ///< Device -> host. Payload: per sensor [SensorId, sent u32, filtered u32, dropped u32], little endian
+    RecorderData    = 0x15, ///< Device -> host. Payload: offloaded recording chunk, see Recorder::Offload
+    RecorderInfo    = 0x16, ///< Device -> host. Payload: recorder state, see Recorder::GetInfo
+    I2cStats        = 0x17, ///< Device -> host. Payload: per bus [bus, speed, window ms u32, busy us u32, rejected u32,
+                            ///< bus clears u32, devices] followed by per device [address, transfers u32, bus us u32,
+                            ///< max latency us u32, deadline misses u32, recoveries u16, failed recoveries u16]
+};
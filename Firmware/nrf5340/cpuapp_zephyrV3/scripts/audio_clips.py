@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Generate src/audio_clips.cpp, the compressed clips played by AudioModule.
+
+Usage: python3 scripts/audio_clips.py [scripts/siren.wav] > src/audio_clips.cpp
+
+scripts/siren.wav is the alarm siren that used to be embedded as raw PCM (16-bit,
+24 kHz, stereo). That array was a whole WAV file cut 28 bytes short: AudioModule
+played its 44-byte header as 11 frames of noise, and only 23253 of the 23260 frames
+of its data chunk were present. siren.wav holds those 23253 frames, so the clip is
+11 frames shorter than the array. It is mixed to mono, like the MAX98357A does
+by default, and stored as mu-law: its square wave edges are faster than IMA ADPCM
+step adaptation (10 dB SNR as ADPCM). The other clips are synthesized here and stored as IMA ADPCM or
+mu-law. SNR of every clip is printed to stderr. Pure Python, no dependencies.
+"""
+
+import math
+import os
+import struct
+import sys
+import wave
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+    107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871,
+    5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+    27086, 29794, 32767]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+
+
+def ima_encode(samples, predictor, index):
+    """Encode samples from the given state. Returns nibbles and squared error."""
+    nibbles = []
+    error = 0
+    for sample in samples:
+        step = STEP_TABLE[index]
+        delta = sample - predictor
+        nibble = 0
+        if delta < 0:
+            nibble = 8
+            delta = -delta
+        difference = step >> 3
+        for bit in (4, 2, 1):
+            if delta >= step:
+                nibble |= bit
+                delta -= step
+                difference += step
+            step >>= 1
+        predictor += -difference if nibble & 8 else difference
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_TABLE[nibble]))
+        nibbles.append(nibble)
+        error += (sample - predictor) ** 2
+    return nibbles, error
+
+
+def ima_clip(samples):
+    """Encode clip as IMA ADPCM, low nibble first. Start index is chosen for the smallest error of the onset."""
+    head = samples[:256]
+    index = min(range(89), key=lambda i: ima_encode(head, 0, i)[1])
+    nibbles, _ = ima_encode(samples, 0, index)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    data = bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+    return data, index
+
+
+def mulaw_encode(sample):
+    """G.711 mu-law"""
+    sign = 0x80 if sample < 0 else 0
+    magnitude = min(abs(sample), 32635) + 0x84
+    exponent = 7
+    while exponent > 0 and not magnitude & (0x4000 >> (7 - exponent)):
+        exponent -= 1
+    mantissa = (magnitude >> (exponent + 3)) & 0x0F
+    return ~(sign | (exponent << 4) | mantissa) & 0xFF
+
+
+def mulaw_decode(value):
+    value = ~value & 0xFF
+    magnitude = (((value & 0x0F) << 3) + 0x84) << ((value & 0x70) >> 4)
+    return 0x84 - magnitude if value & 0x80 else magnitude - 0x84
+
+
+def snr(samples, decoded):
+    error = sum((a - b) ** 2 for a, b in zip(samples, decoded))
+    return 10 * math.log10(sum(a * a for a in samples) / max(error, 1))
+
+
+def read_wav(path):
+    """Read 16-bit PCM WAV, mixed to mono"""
+    with wave.open(path) as wav:
+        channels = wav.getnchannels()
+        rate = wav.getframerate()
+        frames = wav.readframes(wav.getnframes())
+    pcm = struct.unpack('<%dh' % (len(frames) // 2), frames)
+    mono = [sum(pcm[i:i + channels]) // channels for i in range(0, len(pcm), channels)]
+    return mono, rate
+
+
+def tone(rate, parts):
+    """Sum of decaying sines: parts are (start s, length s, frequency Hz, amplitude, decay 1/s)"""
+    length = max(start + duration for start, duration, _, _, _ in parts)
+    out = []
+    for n in range(int(length * rate)):
+        t = n / rate
+        value = 0.0
+        for start, duration, frequency, amplitude, decay in parts:
+            if start <= t < start + duration:
+                local = t - start
+                # 5 ms fade in and out, no clicks
+                fade = min(1.0, local / 0.005, (duration - local) / 0.005)
+                value += amplitude * fade * math.exp(-decay * local) * math.sin(2 * math.pi * frequency * local)
+        out.append(max(-32768, min(32767, round(value * 32767))))
+    return out
+
+
+def emit_array(name, data):
+    lines = ['    const uint8_t %s[%d] = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('        ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines.append('    };')
+    return '\n'.join(lines)
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), 'siren.wav')
+    siren, siren_rate = read_wav(path)
+    clips = [
+        ('siren', 'MuLaw', siren_rate, siren),
+        ('beep', 'MuLaw', 16000, tone(16000, [(0.0, 0.15, 1000.0, 0.5, 0.0)])),
+        ('chime', 'ImaAdpcm', 16000, tone(16000, [(0.0, 0.6, 880.0, 0.4, 4.0), (0.15, 0.45, 1318.5, 0.3, 5.0)])),
+    ]
+
+    arrays = []
+    entries = []
+    total = 0
+    for name, fmt, rate, samples in clips:
+        if fmt == 'ImaAdpcm':
+            data, index = ima_clip(samples)
+            _, error = ima_encode(samples, 0, index)
+            quality = 10 * math.log10(sum(a * a for a in samples) / max(error, 1))
+        else:
+            data, index = bytes(mulaw_encode(s) for s in samples), 0
+            quality = snr(samples, [mulaw_decode(b) for b in data])
+        print('%s: %s, %d Hz, %d samples, %d bytes, SNR %.1f dB' % (name, fmt, rate, len(samples), len(data), quality),
+              file=sys.stderr)
+        total += len(data)
+        arrays.append(emit_array(name + 'Data', data))
+        entries.append('    {"%s", AudioClipFormat::%s, %d, %d, %d, %sData, sizeof(%sData)},'
+                       % (name, fmt, rate, len(samples), index, name, name))
+
+    print('// Generated by scripts/audio_clips.py, do not edit. %d bytes of clip data' % total)
+    print()
+    print('#if CONFIG_USE_I2S')
+    print()
+    print('#include "audio_clips.hpp"')
+    print()
+    print('namespace')
+    print('{')
+    print('\n\n'.join(arrays))
+    print('} // namespace')
+    print()
+    print('const AudioClip audioClips[] = {')
+    print('\n'.join(entries))
+    print('};')
+    print()
+    print('const size_t audioClipCount = sizeof(audioClips) / sizeof(audioClips[0]);')
+    print()
+    print('#endif // CONFIG_USE_I2S')
+
+
+if __name__ == '__main__':
+    main()
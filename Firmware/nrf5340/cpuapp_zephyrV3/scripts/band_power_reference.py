@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Write ADS131M08 samples and numpy Welch band powers as a C include file for the band power replay test.
+
+Usage: python3 scripts/band_power_reference.py [recording.csv] [--rate 250] [--fft-size 256] [--window 1]
+                                               [--overlap 50] [--record-rate 1] -o band_power_fixture.inc
+
+A recording is a CSV file with one sample per line: 8 channels of 24-bit ADC codes at the
+pipeline output rate. A header line and further columns are ignored.
+
+Without a recording the script synthesizes one: every channel has a DC offset, two tones
+in different default bands and white noise. Reference records follow the segment and
+record schedule of BandPower: the first segment ends when FFT size samples are in the
+history, the next ones every hop, and every record averages the segments that ended in
+its interval. Each segment has its mean removed, is windowed and transformed with
+numpy.fft.rfft and scaled like scipy.signal.welch(scaling='density') times the bin width.
+test/band_power builds this script into its fixture. Needs numpy.
+"""
+
+import argparse
+import csv
+import math
+
+import numpy as np
+
+CHANNELS = 8
+BLOCK_SAMPLES = 9  # Ads131Pipeline::SamplesPerPacket, the test feeds whole blocks
+
+# defaultBands of src/band_power.cpp, 0.1 Hz: delta, theta, alpha, beta, gamma
+BANDS = [(10, 40), (40, 80), (80, 130), (130, 300), (300, 450)]
+
+# Synthetic tones per channel: (frequency Hz, amplitude ADC codes)
+TONES = [
+    [(2.0, 3000), (10.0, 800)],
+    [(6.0, 2500), (20.0, 600)],
+    [(10.0, 4000), (2.5, 1000)],
+    [(20.0, 1500), (40.0, 400)],
+    [(40.0, 1200), (6.5, 900)],
+    [(1.5, 5000), (35.0, 300)],
+    [(11.0, 2000), (25.0, 2000)],
+    [(3.0, 200), (60.0, 3000)],
+]
+
+
+def window(kind, n):
+    """Periodic window like scipy.signal.get_window: 0 rectangular, 1 Hann, 2 Hamming, 3 Blackman"""
+    phase = 2 * np.pi * np.arange(n) / n
+    if kind == 1:
+        return 0.5 - 0.5 * np.cos(phase)
+    if kind == 2:
+        return 0.54 - 0.46 * np.cos(phase)
+    if kind == 3:
+        return 0.42 - 0.5 * np.cos(phase) + 0.08 * np.cos(2 * phase)
+    return np.ones(n)
+
+
+def band_bins(rate, fft_size):
+    """First and past the last bin of every band, bin k at k * rate / fft_size with low <= f < high"""
+    bins = fft_size // 2 + 1
+    return [tuple(min(-(-edge * fft_size // (10 * rate)), bins) for edge in band) for band in BANDS]
+
+
+def welch(samples, rate, fft_size, kind, overlap, record_rate):
+    """Band power records of all channels: list of (segments, powers[channel][band])"""
+    w = window(kind, fft_size)
+    scale = 2.0 / (fft_size * np.sum(w * w))
+    hop = max(fft_size - fft_size * overlap // 100, 1)
+    interval = max(rate // record_rate, 1)
+    bins = band_bins(rate, fft_size)
+
+    records = []
+    power = np.zeros((CHANNELS, len(BANDS)))
+    segments = 0
+    for n in range(1, len(samples) + 1):
+        if n >= fft_size and (n - fft_size) % hop == 0:
+            segment = samples[n - fft_size:n]
+            segment = (segment - segment.mean(axis=0)) * w[:, None]
+            psd = np.abs(np.fft.rfft(segment, axis=0)) ** 2 * scale
+            psd[0] /= 2
+            psd[-1] /= 2
+            for b, (low, high) in enumerate(bins):
+                power[:, b] += psd[low:high].sum(axis=0)
+            segments += 1
+
+        if n % interval == 0 and segments > 0:
+            records.append((segments, power / segments))
+            power = np.zeros((CHANNELS, len(BANDS)))
+            segments = 0
+    return records
+
+
+def synth(rate, seconds, seed):
+    rng = np.random.default_rng(seed)
+    t = np.arange(int(rate * seconds)) / rate
+    samples = np.zeros((len(t), CHANNELS))
+    for ch, tones in enumerate(TONES):
+        samples[:, ch] = 1000 * (ch + 1) + rng.normal(0, 50, len(t))
+        for frequency, amplitude in tones:
+            samples[:, ch] += amplitude * np.sin(2 * np.pi * frequency * t + rng.uniform(0, 2 * math.pi))
+    return np.round(samples)
+
+
+def load(path):
+    samples = []
+    with open(path, newline='') as f:
+        for row in csv.reader(f):
+            try:
+                samples.append([int(float(v)) for v in row[:CHANNELS]])
+            except ValueError:
+                continue
+    return np.array(samples, dtype=float).reshape(-1, CHANNELS)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('recording', nargs='?', help='CSV file with 8 channels of ADC codes')
+    parser.add_argument('--rate', type=int, default=250, help='pipeline output rate, Hz')
+    parser.add_argument('--fft-size', type=int, default=256, help='CONFIG_ADS131_BAND_POWER_FFT_SIZE')
+    parser.add_argument('--window', type=int, default=1, help='CONFIG_ADS131_BAND_POWER_WINDOW')
+    parser.add_argument('--overlap', type=int, default=50, help='CONFIG_ADS131_BAND_POWER_OVERLAP, %%')
+    parser.add_argument('--record-rate', type=int, default=1, help='CONFIG_ADS131_BAND_POWER_RATE, Hz')
+    parser.add_argument('--seconds', type=int, default=8, help='length of synthetic recording')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('-o', '--output', default='band_power_fixture.inc')
+    args = parser.parse_args()
+
+    if args.recording:
+        samples = load(args.recording)
+        source = args.recording
+    else:
+        samples = synth(args.rate, args.seconds, args.seed)
+        source = 'synthetic, seed %d' % args.seed
+
+    samples = samples[:len(samples) - len(samples) % BLOCK_SAMPLES]
+    records = welch(samples, args.rate, args.fft_size, args.window, args.overlap, max(args.record_rate, 1))
+
+    with open(args.output, 'w') as f:
+        f.write('/* Generated by scripts/band_power_reference.py from %s */\n\n' % source)
+        f.write('#define BAND_POWER_FIXTURE_SAMPLE_RATE %d\n' % args.rate)
+        f.write('#define BAND_POWER_FIXTURE_FFT_SIZE %d\n' % args.fft_size)
+        f.write('#define BAND_POWER_FIXTURE_WINDOW %d\n' % args.window)
+        f.write('#define BAND_POWER_FIXTURE_OVERLAP %d\n' % args.overlap)
+        f.write('#define BAND_POWER_FIXTURE_RECORD_RATE %d\n' % args.record_rate)
+        f.write('#define BAND_POWER_FIXTURE_BANDS %d\n\n' % len(BANDS))
+        f.write('static const int32_t bandPowerSamples[][%d] = {\n' % CHANNELS)
+        for row in samples:
+            f.write('    {%s},\n' % ', '.join('%d' % v for v in row))
+        f.write('};\n\n')
+        f.write('/* Segments of every record */\n')
+        f.write('static const uint8_t bandPowerSegments[] = {%s};\n\n' % ', '.join(str(s) for s, _ in records))
+        f.write('/* Band powers of every record, ADC codes squared */\n')
+        f.write('static const float bandPowerReference[][%d][%d] = {\n' % (CHANNELS, len(BANDS)))
+        for _, power in records:
+            f.write('    {%s},\n' % ', '.join('{%s}' % ', '.join('%.8ef' % p for p in channel) for channel in power))
+        f.write('};\n')
+
+    print('%d samples, %.1f s, %d records -> %s' % (len(samples), len(samples) / args.rate, len(records), args.output))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Simulate a FeedbackEngine band power rule on synthetic EEG and estimate its latency.
+
+Usage: python3 scripts/feedback_sim.py [--fft 256] [--overlap 50] [--smoothing 50] ...
+
+A 250 Hz channel of noise gets 10 Hz alpha bursts. Segments are cut, windowed and
+summed into bands like BandPower, and the relative alpha power goes through the
+same mapping and smoothing as FeedbackEngine::Evaluate. For every burst the script
+prints how long the rule took to switch its output, then adds the audio queue of
+the I2S settings. It also prints the FeedbackCmd SetRule payload of the rule.
+Pure Python, no dependencies.
+"""
+
+import argparse
+import math
+import random
+import struct
+
+BANDS = [(1, 4), (4, 8), (8, 13), (13, 30), (30, 45)]
+ALPHA = 2
+MAPPINGS = {'linear': 0, 'log': 1, 'threshold': 2}
+
+
+def synth(rate, seconds, bursts, seed):
+    """Brown-ish background noise plus 10 Hz bursts: (start s, length s)"""
+    rng = random.Random(seed)
+    samples = []
+    drift = 0.0
+    for n in range(int(rate * seconds)):
+        t = n / rate
+        drift = 0.97 * drift + rng.gauss(0, 1)
+        value = drift * 4 + rng.gauss(0, 3)
+        for start, length in bursts:
+            if start <= t < start + length:
+                # 100 ms fade in, like a real burst
+                value += 40 * min(1.0, (t - start) / 0.1) * math.sin(2 * math.pi * 10 * (t - start))
+        samples.append(value)
+    return samples
+
+
+def band_powers(segment, rate):
+    """Hann windowed periodogram summed over BANDS, low <= f < high"""
+    size = len(segment)
+    mean = sum(segment) / size
+    window = [0.5 - 0.5 * math.cos(2 * math.pi * i / size) for i in range(size)]
+    x = [(s - mean) * w for s, w in zip(segment, window)]
+    scale = 2.0 / (rate * sum(w * w for w in window))
+    width = rate / size
+    powers = []
+    for low, high in BANDS:
+        total = 0.0
+        for k in range(math.ceil(low / width), math.ceil(high / width)):
+            re = sum(v * math.cos(2 * math.pi * k * i / size) for i, v in enumerate(x))
+            im = sum(v * math.sin(2 * math.pi * k * i / size) for i, v in enumerate(x))
+            total += (re * re + im * im) * scale * width
+        powers.append(total)
+    return powers
+
+
+class Rule:
+    """Mirror of FeedbackEngine::Evaluate"""
+
+    def __init__(self, mapping, low, high, out_low, out_high, smoothing):
+        self.mapping = mapping
+        if mapping == 'log':
+            low, high = math.log10(low), math.log10(high)
+        self.low, self.high = low, high
+        self.out_low, self.out_high = out_low, out_high
+        self.weight = smoothing / 100
+        self.level = None
+        self.on = False
+
+    def evaluate(self, feature):
+        if self.mapping == 'log':
+            feature = math.log10(max(feature, 1e-30))
+        position = (feature - self.low) / (self.high - self.low)
+        self.level = position if self.level is None else self.level + self.weight * (position - self.level)
+        if self.mapping == 'threshold':
+            if self.level >= 1:
+                self.on = True
+            elif self.level < 0:
+                self.on = False
+            amount = 1.0 if self.on else 0.0
+        else:
+            amount = min(1.0, max(0.0, self.level))
+        return round(self.out_low + amount * (self.out_high - self.out_low))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--rate', type=int, default=250, help='ADS131 output rate, Hz')
+    parser.add_argument('--fft', type=int, default=256, help='CONFIG_ADS131_BAND_POWER_FFT_SIZE')
+    parser.add_argument('--overlap', type=int, default=50, help='segment overlap, %%')
+    parser.add_argument('--mapping', choices=MAPPINGS, default='threshold')
+    parser.add_argument('--low', type=float, default=0.2, help='relative alpha power low edge')
+    parser.add_argument('--high', type=float, default=0.4, help='relative alpha power high edge')
+    parser.add_argument('--smoothing', type=int, default=50, help='weight of the newest feature, %%')
+    parser.add_argument('--frames', type=int, default=512, help='CONFIG_I2S_FRAMES_PER_BLOCK')
+    parser.add_argument('--blocks', type=int, default=4, help='CONFIG_I2S_NUM_BLOCKS')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    bursts = [(4.0, 4.0), (12.0, 3.0), (19.0, 2.0)]
+    samples = synth(args.rate, 24, bursts, args.seed)
+    hop = max(1, args.fft * (100 - args.overlap) // 100)
+    rule = Rule(args.mapping, args.low, args.high, 0, 100, args.smoothing)
+
+    changes = []
+    last = None
+    for end in range(args.fft, len(samples) + 1, hop):
+        powers = band_powers(samples[end - args.fft:end], args.rate)
+        relative = powers[ALPHA] / sum(powers)
+        output = rule.evaluate(relative)
+        t = end / args.rate
+        if output != last:
+            changes.append((t, output))
+            print('%6.3f s  relative alpha %.2f  volume %3d %%' % (t, relative, output))
+            last = output
+
+    # The I2S block with the new volume plays after the blocks queued ahead of it
+    block = args.frames / 44100
+    queue = (args.blocks - 1) * block
+    print('\nhop %.0f ms, audio queue up to %.1f ms' % (1000 * hop / args.rate, 1000 * queue))
+    for start, length in bursts:
+        on = next((t for t, out in changes if start <= t and out > 0), None)
+        off = next((t for t, out in changes if start + length <= t and out == 0), None)
+        if on is None or off is None:
+            print('burst at %.1f s: missed' % start)
+            continue
+        print('burst at %.1f s: on after %.0f ms, off after %.0f ms, plus audio up to %.0f ms'
+              % (start, 1000 * (on - start), 1000 * (off - start - length), 1000 * queue))
+
+    payload = bytes([0, 2, 0, 0, ALPHA, MAPPINGS[args.mapping], 0, 0, args.smoothing])
+    payload += struct.pack('<ffHH', args.low, args.high, 0, 100)
+    print('\nFeedbackCmd key 1 (SetRule), relative alpha of device 0 channel 0 to tone volume:')
+    print(payload.hex())
+
+
+if __name__ == '__main__':
+    main()
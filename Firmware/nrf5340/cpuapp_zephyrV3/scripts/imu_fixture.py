@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Write MPU6050/QMC5883L samples with reference orientation as a C include file for the fusion regression test.
+
+Usage: python3 scripts/imu_fixture.py [recording.csv] [--rate 200] [--mag-rate 50] [--name recording]
+                                      -o imu_fixture.inc
+
+A recording is a CSV file with one accel/gyro sample per line:
+ax,ay,az,gx,gy,gz,mx,my,mz,qw,qx,qy,qz. Accel and gyro are raw MPU6050 counts
+(+-2 g, +-250 deg/s), magnetometer raw QMC5883L counts, or empty when there is no
+new magnetometer sample. qw..qz is the reference orientation, e.g. from optical
+tracking or the device records captured by scripts/sensor_capture.py, rotating sensor
+frame to an Earth frame with x to magnetic north and z up. A header line is ignored.
+A comment line "# rate=100" as written by scripts/sensor_capture.py gives the sample
+rate.
+
+Without a recording the script synthesizes one: 5 s at rest in a tilted pose,
+then 12 s of rotation about all axes at up to 50 deg/s, then rest again. Samples
+get noise and a constant gyro bias of about 0.3 deg/s. test/orientation_fusion
+builds this script into its fixtures. --name sets the prefix of the symbols,
+imuFixture and IMU_FIXTURE_* by default. Pure Python, no dependencies.
+"""
+
+import argparse
+import csv
+import math
+import random
+
+ACCEL_LSB_PER_G = 16384
+GYRO_LSB_PER_DPS = 131.0
+MAG_LSB_PER_GAUSS = 12000
+FIELD_GAUSS = 0.5
+INCLINATION_DEG = 60
+
+
+def multiply(a, b):
+    w1, x1, y1, z1 = a
+    w2, x2, y2, z2 = b
+    return (w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+            w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+            w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+            w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2)
+
+
+def conjugate(q):
+    return (q[0], -q[1], -q[2], -q[3])
+
+
+def to_sensor(q, v):
+    """Earth frame vector v seen in sensor frame of orientation q"""
+    return multiply(multiply(conjugate(q), (0.0,) + tuple(v)), q)[1:]
+
+
+def from_euler(yaw, pitch, roll):
+    """Quaternion of ZYX Euler angles in degrees"""
+    cy, sy = math.cos(math.radians(yaw) / 2), math.sin(math.radians(yaw) / 2)
+    cp, sp = math.cos(math.radians(pitch) / 2), math.sin(math.radians(pitch) / 2)
+    cr, sr = math.cos(math.radians(roll) / 2), math.sin(math.radians(roll) / 2)
+    return (cr * cp * cy + sr * sp * sy,
+            sr * cp * cy - cr * sp * sy,
+            cr * sp * cy + sr * cp * sy,
+            cr * cp * sy - sr * sp * cy)
+
+
+def trajectory(t):
+    """Yaw, pitch, roll in degrees: rest, smooth rotations about every axis, rest"""
+    yaw, pitch, roll = 20.0, 10.0, -5.0
+    if 5 <= t < 17:
+        s = t - 5
+        yaw += 90 * (1 - math.cos(2 * math.pi * s / 12))
+        pitch += 30 * math.sin(2 * math.pi * s / 6)
+        roll += 25 * math.sin(2 * math.pi * s / 4)
+    return yaw, pitch, roll
+
+
+def clamp16(value):
+    return max(-32768, min(32767, int(round(value))))
+
+
+def synth(rate, mag_rate, seconds, seed):
+    rng = random.Random(seed)
+    gravity = (0.0, 0.0, 1.0)
+    inclination = math.radians(INCLINATION_DEG)
+    # Northern hemisphere: field points north and down
+    field = (FIELD_GAUSS * math.cos(inclination), 0.0, -FIELD_GAUSS * math.sin(inclination))
+    bias = [rng.gauss(0, 0.3) for _ in range(3)]
+
+    rows = []
+    previous = from_euler(*trajectory(0.0))
+    mag_period = max(1, rate // mag_rate)
+    for n in range(int(rate * seconds)):
+        q = from_euler(*trajectory(n / rate))
+        if sum(a * b for a, b in zip(q, previous)) < 0:
+            q = tuple(-c for c in q)
+
+        # Constant body rate over the sample period that turns previous orientation into this one
+        delta = multiply(conjugate(previous), q)
+        angle = 2 * math.acos(max(-1.0, min(1.0, delta[0])))
+        norm = math.sqrt(delta[1] ** 2 + delta[2] ** 2 + delta[3] ** 2)
+        rate_dps = [math.degrees(angle) * rate * c / norm if norm > 1e-12 else 0.0 for c in delta[1:]]
+        previous = q
+
+        accel = [ACCEL_LSB_PER_G * c + rng.gauss(0, 20) for c in to_sensor(q, gravity)]
+        gyro = [GYRO_LSB_PER_DPS * (r + b) + rng.gauss(0, 5) for r, b in zip(rate_dps, bias)]
+        mag = None
+        if n % mag_period == 0:
+            mag = [MAG_LSB_PER_GAUSS * c + rng.gauss(0, 15) for c in to_sensor(q, field)]
+
+        rows.append(([clamp16(v) for v in accel + gyro], [clamp16(v) for v in mag] if mag else None, q))
+    return rows
+
+
+def load(path):
+    """Rows of a CSV file, and key=value pairs of comment lines"""
+    rows = []
+    settings = {}
+    with open(path, newline='') as f:
+        for row in csv.reader(f):
+            if row and row[0].startswith('#'):
+                for item in ' '.join(row).lstrip('#').split():
+                    key, _, value = item.partition('=')
+                    if value:
+                        settings[key] = value
+                continue
+            try:
+                imu = [int(float(v)) for v in row[0:6]]
+                mag = [int(float(v)) for v in row[6:9]] if all(v.strip() for v in row[6:9]) else None
+                q = tuple(float(v) for v in row[9:13])
+            except (ValueError, IndexError):
+                continue
+            rows.append((imu, mag, q))
+    return rows, settings
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('recording', nargs='?', help='CSV file with raw samples and reference quaternion')
+    parser.add_argument('--rate', type=int, help='accel/gyro sample rate, Hz, 200 by default')
+    parser.add_argument('--mag-rate', type=int, default=50, help='magnetometer sample rate, Hz')
+    parser.add_argument('--seconds', type=int, default=20, help='length of synthetic recording')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--name', default='fixture', help='symbol prefix after imu')
+    parser.add_argument('-o', '--output', default='imu_fixture.inc')
+    args = parser.parse_args()
+
+    if args.recording:
+        rows, settings = load(args.recording)
+        rate = args.rate or int(settings.get('rate', 200))
+        source = args.recording
+    else:
+        rate = args.rate or 200
+        rows = synth(rate, args.mag_rate, args.seconds, args.seed)
+        source = 'synthetic, seed %d' % args.seed
+
+    prefix = 'IMU_%s_' % args.name.upper()
+    with open(args.output, 'w') as f:
+        f.write('/* Generated by scripts/imu_fixture.py from %s */\n\n' % source)
+        f.write('#define %sSAMPLE_RATE %d\n' % (prefix, rate))
+        f.write('#define %sGYRO_LSB_PER_DPS %.1ff\n\n' % (prefix, GYRO_LSB_PER_DPS))
+        f.write('/* accel XYZ, gyro XYZ; magnetometer XYZ; new magnetometer sample; reference w, x, y, z */\n')
+        f.write('static const ImuFixtureSample imu%s[] = {\n' % args.name.capitalize())
+        for imu, mag, q in rows:
+            f.write('    {{%s}, {%s}, %d, {%s}},\n' % (', '.join(str(v) for v in imu),
+                                                      ', '.join(str(v) for v in (mag or [0, 0, 0])),
+                                                      1 if mag else 0,
+                                                      ', '.join('%.6ff' % c for c in q)))
+        f.write('};\n')
+
+    print('%d samples, %.1f s -> %s' % (len(rows), len(rows) / rate, args.output))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Write DMIC PCM samples and reference IMA ADPCM packets as a C include file for the audio codec test.
+
+Usage: python3 scripts/pcm_fixture.py [recording.wav] [--wav synthetic.wav] -o pcm_fixture.inc
+
+A recording is a 16-bit WAV file, 16 kHz like the DMIC. Only the first channel is used.
+
+Without a recording the script synthesizes one: a 100 Hz - 6 kHz logarithmic sweep,
+a two tone chord and speech-like noise bursts, with silence in between. --wav also
+writes it as a WAV file to listen to.
+
+Reference blocks are encoded with the IMA ADPCM algorithm of the IMA/DVI recommended
+practice, packetized like DmicAdpcm: every block starts with the exact first sample as
+predictor and carries the step index over from the previous block. test/ima_adpcm builds
+this script into its fixture. Pure Python, no dependencies.
+"""
+
+import argparse
+import math
+import random
+import struct
+import wave
+
+SAMPLE_RATE = 16000
+BLOCK_ALIGN = 204                              # DmicAdpcm::BlockAlign
+SAMPLES_PER_BLOCK = 2 * (BLOCK_ALIGN - 4) + 1  # DmicAdpcm::SamplesPerPacket
+
+STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88,
+    97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660,
+    4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818,
+    18500, 20350, 22385, 24623, 27086, 29794, 32767]
+INDEX_CHANGE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def encode(state, sample):
+    """IMA ADPCM nibble of sample, updates [predictor, index] state"""
+    predictor, index = state
+    step = STEPS[index]
+    diff = sample - predictor
+    nibble = 8 if diff < 0 else 0
+    diff = abs(diff)
+
+    vpdiff = step >> 3
+    for bit in (4, 2, 1):
+        if diff >= step:
+            nibble |= bit
+            diff -= step
+            vpdiff += step
+        step >>= 1
+
+    predictor += -vpdiff if nibble & 8 else vpdiff
+    state[0] = max(-32768, min(32767, predictor))
+    state[1] = max(0, min(88, index + INDEX_CHANGE[nibble & 7]))
+    return nibble
+
+
+def blocks(samples):
+    """WAV IMA ADPCM blocks of all complete packets"""
+    state = [0, 0]
+    result = []
+    for start in range(0, len(samples) - SAMPLES_PER_BLOCK + 1, SAMPLES_PER_BLOCK):
+        chunk = samples[start:start + SAMPLES_PER_BLOCK]
+        state[0] = chunk[0]
+        block = bytearray(struct.pack('<hBB', chunk[0], state[1], 0))
+        nibbles = [encode(state, s) for s in chunk[1:]]
+        block += bytes(lo | hi << 4 for lo, hi in zip(nibbles[0::2], nibbles[1::2]))
+        result.append(block)
+    return result
+
+
+def synth(seconds, seed):
+    rng = random.Random(seed)
+    samples = []
+    n = int(SAMPLE_RATE * seconds)
+    sweep = n * 2 // 5
+    chord = n * 3 // 10
+    phase = 0.0
+    for i in range(n):
+        t = i / SAMPLE_RATE
+        if i < sweep:
+            # Logarithmic sweep, -6 dBFS
+            frequency = 100 * (6000 / 100) ** (i / sweep)
+            phase += 2 * math.pi * frequency / SAMPLE_RATE
+            value = 0.5 * math.sin(phase)
+        elif i < sweep + chord:
+            value = 0.3 * math.sin(2 * math.pi * 440 * t) + 0.2 * math.sin(2 * math.pi * 660 * t)
+        else:
+            # Noise bursts with syllable-like 4 Hz envelope, low-passed by a one-pole filter
+            envelope = max(0.0, math.sin(2 * math.pi * 4 * t)) ** 2
+            value = 0.3 * envelope * rng.gauss(0, 1)
+            value = 0.7 * (samples[-1] / 32768 if samples else 0.0) + 0.3 * value
+        samples.append(max(-32768, min(32767, int(round(value * 32767 + rng.gauss(0, 20))))))
+    return samples
+
+
+def load(path):
+    with wave.open(path, 'rb') as f:
+        if f.getsampwidth() != 2:
+            raise SystemExit('%s: 16-bit PCM expected' % path)
+        if f.getframerate() != SAMPLE_RATE:
+            print('warning: %s is %d Hz, DMIC runs at %d Hz' % (path, f.getframerate(), SAMPLE_RATE))
+        channels = f.getnchannels()
+        frames = f.readframes(f.getnframes())
+    values = struct.unpack('<%dh' % (len(frames) // 2), frames)
+    return list(values[::channels])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('recording', nargs='?', help='16-bit WAV file')
+    parser.add_argument('--seconds', type=int, default=2, help='length of synthetic recording')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--wav', help='also write synthetic recording as WAV file')
+    parser.add_argument('-o', '--output', default='pcm_fixture.inc')
+    args = parser.parse_args()
+
+    if args.recording:
+        samples = load(args.recording)
+        source = args.recording
+    else:
+        samples = synth(args.seconds, args.seed)
+        source = 'synthetic, seed %d' % args.seed
+        if args.wav:
+            with wave.open(args.wav, 'wb') as f:
+                f.setnchannels(1)
+                f.setsampwidth(2)
+                f.setframerate(SAMPLE_RATE)
+                f.writeframes(struct.pack('<%dh' % len(samples), *samples))
+
+    reference = blocks(samples)
+
+    with open(args.output, 'w') as f:
+        f.write('/* Generated by scripts/pcm_fixture.py from %s */\n\n' % source)
+        f.write('#define PCM_FIXTURE_SAMPLE_RATE %d\n\n' % SAMPLE_RATE)
+        f.write('static const int16_t pcmFixture[] = {\n')
+        for start in range(0, len(samples), 16):
+            f.write('    %s,\n' % ', '.join(str(s) for s in samples[start:start + 16]))
+        f.write('};\n\n')
+        f.write('/* WAV IMA ADPCM block of every complete packet */\n')
+        f.write('static const uint8_t adpcmReference[][%d] = {\n' % BLOCK_ALIGN)
+        for block in reference:
+            f.write('    {%s},\n' % ', '.join('0x%02X' % b for b in block))
+        f.write('};\n')
+
+    print('%d samples, %.2f s, %d blocks -> %s' % (len(samples), len(samples) / SAMPLE_RATE, len(reference),
+                                                   args.output))
+
+
+if __name__ == '__main__':
+    main()
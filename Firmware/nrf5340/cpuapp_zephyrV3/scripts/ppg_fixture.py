@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Write MAX30102 Red/IR samples as a C include file for the PPG replay test.
+
+Usage: python3 scripts/ppg_fixture.py [recording.csv [--hr 64 --spo2 98]] [--rate 50] [--name recording]
+                                      -o ppg_fixture.inc
+
+A recording is a CSV file with one sample per line: red,ir as 18-bit counts at the
+effective sample rate (ADC rate divided by FIFO averaging, 50 Hz for the default
+800 sps with 16x averaging). A header line and further columns are ignored. The
+reference values, e.g. from a clinical pulse oximeter worn at the same time, are
+taken from a comment line "# hr=64 spo2=98 rate=50" as written by
+scripts/sensor_capture.py, or given with --hr and --spo2.
+
+Without a recording the script synthesizes one: a beat shaped pulse with dicrotic
+notch, heart rate variability, respiratory baseline wander and noise, with Red/IR
+amplitudes of the given ratio of ratios R. A synthetic signal has no SpO2 of its own,
+only a recording checks the calibration curve. Its SpO2 is written as 0 and R is
+written instead, so the test checks the R measured by the pipeline.
+
+--name sets the prefix of the symbols, ppgFixture and PPG_FIXTURE_* by default.
+test/ppg_processor builds this script into its fixtures. Pure Python, no dependencies.
+"""
+
+import argparse
+import csv
+import math
+import random
+
+
+def pulse(phase):
+    """Blood volume over one beat, 0 - 1: fast systolic rise, dicrotic notch, slow decay"""
+    systolic = math.exp(-((phase - 0.15) / 0.07) ** 2)
+    dicrotic = 0.35 * math.exp(-((phase - 0.45) / 0.09) ** 2)
+    return systolic + dicrotic
+
+
+def synth(rate, seconds, hr, ratio, seed):
+    """Red/IR samples of a finger with given heart rate (bpm) and ratio of ratios"""
+    rng = random.Random(seed)
+    dc_ir, dc_red = 120000.0, 90000.0
+    perfusion = 0.015
+    ac_ir = perfusion * dc_ir
+    ac_red = ratio * perfusion * dc_red
+
+    samples = []
+    phase = 0.0
+    beat_rate = hr / 60
+    for n in range(int(rate * seconds)):
+        t = n / rate
+        phase += beat_rate / rate
+        if phase >= 1.0:
+            phase -= 1.0
+            # 3 % beat to beat variability around the mean rate
+            beat_rate = hr / 60 * (1 + rng.gauss(0, 0.03))
+        volume = pulse(phase)
+        wander = 1 + 0.004 * math.sin(2 * math.pi * 0.25 * t)
+        # Blood absorbs light, received light drops during systole
+        red = dc_red * wander - ac_red * volume + rng.gauss(0, 8)
+        ir = dc_ir * wander - ac_ir * volume + rng.gauss(0, 8)
+        samples.append((int(red), int(ir)))
+    return samples
+
+
+def load(path):
+    """Red/IR pairs from the first two numeric columns of a CSV file, and key=value pairs of comment lines"""
+    samples = []
+    reference = {}
+    with open(path, newline='') as f:
+        for row in csv.reader(f):
+            if row and row[0].startswith('#'):
+                for item in ' '.join(row).lstrip('#').split():
+                    key, _, value = item.partition('=')
+                    if value:
+                        reference[key] = value
+                continue
+            try:
+                samples.append((int(float(row[0])), int(float(row[1]))))
+            except (ValueError, IndexError):
+                continue
+    return samples, reference
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('recording', nargs='?', help='CSV file with red,ir columns')
+    parser.add_argument('--hr', type=int, help='reference heart rate, bpm, 72 for synthetic recording')
+    parser.add_argument('--spo2', type=int, help='reference SpO2 of recording, %%')
+    parser.add_argument('--ratio', type=float, default=0.5, help='ratio of ratios R of synthetic recording')
+    parser.add_argument('--rate', type=int, help='effective sample rate, Hz, 50 by default')
+    parser.add_argument('--seconds', type=int, default=60, help='length of synthetic recording')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--name', default='fixture', help='symbol prefix after ppg')
+    parser.add_argument('-o', '--output', default='ppg_fixture.inc')
+    args = parser.parse_args()
+
+    if args.recording:
+        samples, reference = load(args.recording)
+        source = args.recording
+        rate = args.rate or int(reference.get('rate', 50))
+        hr = args.hr or int(reference.get('hr', 0))
+        spo2 = args.spo2 or int(reference.get('spo2', 0))
+        ratio = 0
+        if not hr or not spo2:
+            raise SystemExit('%s: reference heart rate and SpO2 missing, pass --hr and --spo2' % args.recording)
+    else:
+        rate = args.rate or 50
+        hr = args.hr or 72
+        spo2 = 0
+        ratio = args.ratio
+        samples = synth(rate, args.seconds, hr, ratio, args.seed)
+        source = 'synthetic, seed %d' % args.seed
+
+    prefix = 'PPG_%s_' % args.name.upper()
+    with open(args.output, 'w') as f:
+        f.write('/* Generated by scripts/ppg_fixture.py from %s */\n\n' % source)
+        f.write('#define %sSAMPLE_RATE %d\n' % (prefix, rate))
+        f.write('#define %sHEART_RATE %d\n' % (prefix, hr))
+        f.write('#define %sSPO2 %d\n' % (prefix, spo2))
+        f.write('#define %sRATIO_Q10 %d\n\n' % (prefix, round(ratio * 1024)))
+        f.write('static const uint32_t ppg%s[][2] = {\n' % args.name.capitalize())
+        for red, ir in samples:
+            f.write('    {%d, %d},\n' % (red, ir))
+        f.write('};\n')
+
+    print('%d samples, %.1f s, HR %d, %s -> %s' %
+          (len(samples), len(samples) / rate, hr, 'SpO2 %d' % spo2 if spo2 else 'R %.3f' % ratio, args.output))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""Capture sensor samples from the vendor bulk interface as CSV recordings for the replay tests.
+
+Usage: python3 scripts/sensor_capture.py ppg --hr 64 --spo2 98 [--seconds 60] [--rate 50]
+                                         -o test/ppg_processor/recordings/max30102.csv
+       python3 scripts/sensor_capture.py imu [--seconds 30] [--rate 100] [--mag-rate 50]
+                                         -o test/orientation_fusion/recordings/imu.csv
+
+Needs firmware built with CONFIG_USE_USB_BULK=y and pyusb with a libusb backend, like
+scripts/usb_loopback.py. Sample frames are split from the bulk IN stream and their CRC
+is checked.
+
+ppg: MAX30102 raw packets (SensorId 5), so raw output must be enabled (Max30102Cmd
+SetOutput bit 0, the default). Every Red/IR sample becomes one line red,ir of 18-bit
+counts. --hr and --spo2 are the reference values read from a clinical pulse oximeter
+worn on another finger during the capture; they are written with the sample rate
+in a comment line, which scripts/ppg_fixture.py reads. Samples lost in the sensor FIFO
+or on the link break the beat intervals, so the capture fails when the packet
+counter or the FIFO overflow counter shows a gap. Keep the hand still and warm.
+
+imu: MPU6050 (SensorId 4), QMC5883L (7) and orientation records (9) of firmware built
+with CONFIG_USE_ORIENTATION_FUSION=y, output rate 50 Hz and default filter gain. Every
+accel/gyro sample becomes one line ax,ay,az,gx,gy,gz,mx,my,mz,qw,qx,qy,qz in the format
+of scripts/imu_fixture.py. There is no optical tracking, so the reference orientation
+is the one the firmware computed on the device, and the replay is a regression test
+against it. Orientation records are published while the samples of the next MPU6050
+packet are filtered, so they are matched to the samples of that packet. Magnetometer
+packets carry no time: their samples are placed on the accel/gyro sample grid by a
+line fitted to the arrival order of the packets of both sensors. Move the board
+slowly in all directions, away from magnets and steel.
+
+A recording committed under test/<name>/recordings is built into the test fixture
+instead of the synthetic signal.
+"""
+
+import argparse
+import sys
+import time
+
+import usb.util
+
+from usb_loopback import FrameParser, open_device
+
+MAX30102_ID = 5
+MAX30102_HEADER_SIZE = 4
+MAX30102_SAMPLE_SIZE = 6
+MAX30102_DATA_MASK = 0x3FFFF
+
+MPU6050_ID = 4
+MPU6050_SAMPLES = 20        # Samples per packet, after the packet counter
+QMC5883L_ID = 7
+QMC5883L_SAMPLES = 40
+ORIENTATION_ID = 9
+ORIENTATION_RATE = 50       # CONFIG_ORIENTATION_OUTPUT_RATE of the replay test
+
+
+def capture_ppg(in_ep, frames_parser, args, out):
+    """Write Red/IR samples of MAX30102 packets until --seconds of samples are captured"""
+    wanted = args.seconds * args.rate
+    samples = 0
+    counter = None
+    deadline = time.monotonic() + args.seconds + 10
+
+    out.write('# MAX30102 capture hr=%d spo2=%d rate=%d\n' % (args.hr, args.spo2, args.rate))
+    out.write('red,ir\n')
+
+    while samples < wanted:
+        if time.monotonic() > deadline:
+            sys.exit('Only %d of %d samples in time, is the MAX30102 stream enabled?' % (samples, wanted))
+
+        for message_id, payload in frames_parser.feed(bytes(in_ep.read(4096, timeout=1000))):
+            if message_id != MAX30102_ID or len(payload) < MAX30102_HEADER_SIZE:
+                continue
+            if counter is not None and payload[0] != (counter + 1) & 0xFF:
+                sys.exit('Packet %d follows %d, packets were lost' % (payload[0], counter))
+            if payload[1] != 0:
+                sys.exit('%d samples lost in the sensor FIFO' % payload[1])
+            counter = payload[0]
+
+            for offset in range(MAX30102_HEADER_SIZE, len(payload) - MAX30102_SAMPLE_SIZE + 1, MAX30102_SAMPLE_SIZE):
+                red = int.from_bytes(payload[offset:offset + 3], 'big') & MAX30102_DATA_MASK
+                ir = int.from_bytes(payload[offset + 3:offset + 6], 'big') & MAX30102_DATA_MASK
+                out.write('%d,%d\n' % (red, ir))
+                samples += 1
+
+    return samples
+
+
+def capture_imu(in_ep, frames_parser, args, out):
+    """Write accel/gyro samples with magnetometer samples and device orientation until --seconds are captured"""
+    wanted = args.seconds * args.rate
+    every = args.rate // ORIENTATION_RATE
+    if every == 0 or MPU6050_SAMPLES % every != 0:
+        sys.exit('Sample rate %d Hz does not fit %d Hz orientation records' % (args.rate, ORIENTATION_RATE))
+
+    imu = []          # (accel/gyro, orientation or None)
+    magnetometer = [] # XYZ samples
+    mag_ends = []     # (accel/gyro samples published before the magnetometer packet, magnetometer samples)
+    records = []      # Orientation records since the last MPU6050 packet
+    counters = {}
+    deadline = time.monotonic() + args.seconds + 10
+
+    while len(imu) < wanted:
+        if time.monotonic() > deadline:
+            sys.exit('Only %d of %d samples in time, are the streams enabled?' % (len(imu), wanted))
+
+        for message_id, payload in frames_parser.feed(bytes(in_ep.read(4096, timeout=1000))):
+            if message_id not in (MPU6050_ID, QMC5883L_ID, ORIENTATION_ID):
+                continue
+            if message_id in counters and payload[0] != (counters[message_id] + 1) & 0xFF:
+                sys.exit('Stream %d: %d follows %d, data was lost' % (message_id, payload[0], counters[message_id]))
+            counters[message_id] = payload[0]
+
+            if message_id == ORIENTATION_ID:
+                records.append(tuple(int.from_bytes(payload[5 + 2 * i:7 + 2 * i], 'little', signed=True) / 16384
+                                     for i in range(4)))
+            elif message_id == QMC5883L_ID:
+                samples = [tuple(int.from_bytes(payload[1 + 6 * n + 2 * i:3 + 6 * n + 2 * i], 'little', signed=True)
+                                 for i in range(3)) for n in range(QMC5883L_SAMPLES)]
+                magnetometer += samples
+                mag_ends.append((len(imu), len(magnetometer)))
+            else:
+                # Records of the first packet may belong to samples before the capture started
+                if imu and len(records) != MPU6050_SAMPLES // every:
+                    sys.exit('%d orientation records with one MPU6050 packet, was the FIFO reset?' % len(records))
+                for n in range(MPU6050_SAMPLES):
+                    sample = tuple(int.from_bytes(payload[1 + 12 * n + 2 * i:3 + 12 * n + 2 * i], 'big', signed=True)
+                                   for i in range(6))
+                    # Records are published on every (every)th sample counted from the first one after boot
+                    record = records[n // every] if imu and n % every == every - 1 else None
+                    imu.append((sample, record))
+                records = []
+
+    # Magnetometer packet is published after its last sample, while the next accel/gyro packet is filtered
+    points = [(count, published + MPU6050_SAMPLES / 2) for published, count in mag_ends if published > 0]
+    if len(points) < 2:
+        sys.exit('Too few magnetometer packets, is the QMC5883L stream enabled?')
+    mean_x = sum(x for x, _ in points) / len(points)
+    mean_y = sum(y for _, y in points) / len(points)
+    slope = (sum((x - mean_x) * (y - mean_y) for x, y in points) /
+             max(sum((x - mean_x) ** 2 for x, _ in points), 1e-9))
+    placed = {}
+    for n, sample in enumerate(magnetometer):
+        position = int(round(mean_y + (n + 1 - mean_x) * slope))
+        if 0 <= position < len(imu):
+            placed[position] = sample
+
+    out.write('# MPU6050/QMC5883L capture rate=%d mag_rate=%d, reference is the device orientation\n' %
+              (args.rate, args.mag_rate))
+    out.write('ax,ay,az,gx,gy,gz,mx,my,mz,qw,qx,qy,qz\n')
+    last = (1.0, 0.0, 0.0, 0.0)
+    for n, (sample, record) in enumerate(imu):
+        last = record or last
+        mag = placed.get(n)
+        out.write('%s,%s,%s\n' % (','.join(str(v) for v in sample), ','.join(str(v) for v in mag) if mag else ',,',
+                                   ','.join('%.5f' % c for c in last)))
+
+    print('%.2f accel/gyro samples per magnetometer sample, %.2f expected' % (slope, args.rate / args.mag_rate))
+    return len(imu)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--vid', type=lambda v: int(v, 0), default=0x2FE3)
+    parser.add_argument('--pid', type=lambda v: int(v, 0), default=0x0100)
+    commands = parser.add_subparsers(dest='sensor', required=True)
+
+    ppg = commands.add_parser('ppg', help='MAX30102 Red/IR samples with reference heart rate and SpO2')
+    ppg.add_argument('--hr', type=int, required=True, help='reference heart rate, bpm')
+    ppg.add_argument('--spo2', type=int, required=True, help='reference SpO2, %%')
+    ppg.add_argument('--rate', type=int, default=50, help='effective sample rate, Hz')
+    ppg.add_argument('--seconds', type=int, default=60)
+    ppg.add_argument('-o', '--output', required=True)
+
+    imu = commands.add_parser('imu', help='MPU6050 and QMC5883L samples with device orientation')
+    imu.add_argument('--rate', type=int, default=100, help='CONFIG_MPU6050_SAMPLE_RATE, Hz')
+    imu.add_argument('--mag-rate', type=int, default=50, help='QMC5883L output data rate, Hz')
+    imu.add_argument('--seconds', type=int, default=30)
+    imu.add_argument('-o', '--output', required=True)
+
+    args = parser.parse_args()
+    capture = {'ppg': capture_ppg, 'imu': capture_imu}[args.sensor]
+
+    device, interface, _, in_ep = open_device(args.vid, args.pid)
+    frames_parser = FrameParser()
+
+    try:
+        with open(args.output, 'w') as out:
+            samples = capture(in_ep, frames_parser, args, out)
+    finally:
+        usb.util.release_interface(device, interface.bInterfaceNumber)
+
+    print('%d samples -> %s, CRC errors: %d' % (samples, args.output, frames_parser.crc_errors))
+
+
+if __name__ == '__main__':
+    main()
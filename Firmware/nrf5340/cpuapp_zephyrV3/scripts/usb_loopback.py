@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Loopback test of the vendor bulk interface, through libusb.
+
+Usage: python3 scripts/usb_loopback.py [--frames 2000] [--window 32] [--vid 0x2fe3 --pid 0x0100]
+
+Needs firmware built with CONFIG_USE_USB_BULK=y and CONFIG_USB_BULK_LOOPBACK=y, and
+pyusb with a libusb backend (pip install pyusb). On Windows bind WinUSB to the vendor
+interface first.
+
+The script writes loopback frames to the bulk OUT endpoint in the data link format,
+0xF0 0xF0 <id> <len> <data> <crc8>, with id 0xFE. Every frame is exactly one 64-byte
+packet, so the device echoes it in one piece. The bulk IN stream is split into frames.
+Echoed frames must come back in order with their payload intact. Sample frames from the
+sensors arrive in between; they are counted, and their CRC is checked as well. At most
+--window frames are in flight, so the 4 KB transmit buffer of the device never
+overflows. Prints echo throughput and the sample frames per SensorId. Exits with
+status 1 on a lost, reordered or corrupted frame.
+"""
+
+import argparse
+import collections
+import random
+import sys
+import time
+
+import usb.core
+import usb.util
+
+HEADER = 0xF0
+LOOPBACK_ID = 0xFE
+PACKET_SIZE = 64
+PAYLOAD_SIZE = PACKET_SIZE - 5
+
+
+def crc8(data):
+    """CRC-8 of the data link: polynomial 0x31, initial value 0xFF, no reflection"""
+    crc = 0xFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x31) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def frame(message_id, payload):
+    head = bytes([HEADER, HEADER, message_id, len(payload)]) + payload
+    return head + bytes([crc8(head)])
+
+
+class FrameParser:
+    """Split the bulk IN byte stream into (id, payload) frames, resynchronizing on the header"""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.crc_errors = 0
+
+    def feed(self, data):
+        self.buffer += data
+        frames = []
+        while True:
+            start = self.buffer.find(bytes([HEADER, HEADER]))
+            if start < 0:
+                # Keep a trailing header byte, the next read could complete it
+                del self.buffer[:max(0, len(self.buffer) - 1)]
+                return frames
+            del self.buffer[:start]
+            if len(self.buffer) < 4 or len(self.buffer) < self.buffer[3] + 5:
+                return frames
+            size = self.buffer[3] + 5
+            candidate = bytes(self.buffer[:size])
+            if crc8(candidate[:-1]) != candidate[-1]:
+                self.crc_errors += 1
+                del self.buffer[:1]
+                continue
+            frames.append((candidate[2], candidate[4:-1]))
+            del self.buffer[:size]
+
+
+def open_device(vid, pid):
+    device = usb.core.find(idVendor=vid, idProduct=pid)
+    if device is None:
+        sys.exit('Device %04x:%04x not found' % (vid, pid))
+
+    config = device.get_active_configuration()
+    interface = usb.util.find_descriptor(config, bInterfaceClass=0xFF)
+    if interface is None:
+        sys.exit('No vendor class interface, is CONFIG_USE_USB_BULK enabled?')
+    usb.util.claim_interface(device, interface.bInterfaceNumber)
+
+    def direction(wanted):
+        return lambda ep: usb.util.endpoint_direction(ep.bEndpointAddress) == wanted
+
+    out_ep = usb.util.find_descriptor(interface, custom_match=direction(usb.util.ENDPOINT_OUT))
+    in_ep = usb.util.find_descriptor(interface, custom_match=direction(usb.util.ENDPOINT_IN))
+    return device, interface, out_ep, in_ep
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--vid', type=lambda v: int(v, 0), default=0x2FE3)
+    parser.add_argument('--pid', type=lambda v: int(v, 0), default=0x0100)
+    parser.add_argument('--frames', type=int, default=2000, help='loopback frames to send')
+    parser.add_argument('--window', type=int, default=32, help='frames in flight')
+    parser.add_argument('--timeout', type=int, default=1000, help='read timeout, ms')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    device, interface, out_ep, in_ep = open_device(args.vid, args.pid)
+    rng = random.Random(args.seed)
+    frames_parser = FrameParser()
+    samples = collections.Counter()
+    expected = collections.deque()
+    sent = received = errors = 0
+    start = time.monotonic()
+
+    try:
+        while received < args.frames:
+            while sent < args.frames and len(expected) < args.window:
+                # Sequence number first, so a lost frame is reported by number
+                payload = sent.to_bytes(4, 'little') + bytes(rng.randrange(256) for _ in range(PAYLOAD_SIZE - 4))
+                out_ep.write(frame(LOOPBACK_ID, payload))
+                expected.append(payload)
+                sent += 1
+
+            try:
+                data = in_ep.read(16 * PACKET_SIZE, timeout=args.timeout)
+            except usb.core.USBTimeoutError:
+                print('Timeout: %d frames sent, %d echoed' % (sent, received), file=sys.stderr)
+                errors += len(expected)
+                break
+
+            for message_id, payload in frames_parser.feed(bytes(data)):
+                if message_id != LOOPBACK_ID:
+                    samples[message_id] += 1
+                    continue
+                if not expected:
+                    print('Unexpected echo %d' % int.from_bytes(payload[:4], 'little'), file=sys.stderr)
+                    errors += 1
+                    continue
+                wanted = expected.popleft()
+                if payload != wanted:
+                    print('Frame %d came back as %d or corrupted' % (int.from_bytes(wanted[:4], 'little'),
+                                                                     int.from_bytes(payload[:4], 'little')),
+                          file=sys.stderr)
+                    errors += 1
+                received += 1
+    finally:
+        usb.util.release_interface(device, interface.bInterfaceNumber)
+
+    elapsed = time.monotonic() - start
+    print('%d of %d frames echoed in %.2f s, %.1f KB/s each way' %
+          (received, sent, elapsed, received * PACKET_SIZE / 1024 / max(elapsed, 1e-6)))
+    print('Sample frames: %s' % (', '.join('id %d: %d' % item for item in sorted(samples.items())) or 'none'))
+    print('CRC errors: %d, loopback errors: %d' % (frames_parser.crc_errors, errors))
+
+    sys.exit(1 if errors or frames_parser.crc_errors else 0)
+
+
+if __name__ == '__main__':
+    main()
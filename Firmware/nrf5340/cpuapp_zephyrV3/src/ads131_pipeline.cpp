@@ -0,0 +1,571 @@
+#include "ads131_pipeline.hpp"
+
+#if CONFIG_USE_ADS131_PIPELINE
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#if CONFIG_ADS131_PIPELINE_BENCHMARK
+#include <zephyr/timing/timing.h>
+#endif
+
+#include "usb_comm_handler.hpp"
+
+#if CONFIG_USE_ADS131_BAND_POWER
+#include "band_power.hpp"
+#endif
+#if CONFIG_USE_ADS131_SIGNAL_QUALITY
+#include "signal_quality.hpp"
+#endif
+#if CONFIG_USE_FEEDBACK
+#include "feedback_engine.hpp"
+#endif
+#if CONFIG_USE_EVENT_CAPTURE
+#include "event_capture.hpp"
+#endif
+
+LOG_MODULE_REGISTER(ads131_pipeline, LOG_LEVEL_INF);
+
+BUILD_ASSERT(CONFIG_ADS131_SAMPLE_RATE % CONFIG_ADS131_OUTPUT_RATE == 0 &&
+             IS_POWER_OF_TWO(CONFIG_ADS131_SAMPLE_RATE / CONFIG_ADS131_OUTPUT_RATE) &&
+             CONFIG_ADS131_SAMPLE_RATE / CONFIG_ADS131_OUTPUT_RATE <= Ads131Pipeline::MaxDecimation,
+             "CONFIG_ADS131_OUTPUT_RATE must be CONFIG_ADS131_SAMPLE_RATE divided by 1, 2, 4 or 8");
+
+namespace
+{
+    constexpr static double pi = 3.14159265358979;
+    constexpr static double notchQ = 30.0;             ///< Notch quality factor, about 2 Hz wide at 50/60 Hz
+    constexpr static double butterworthQ = 0.70710678; ///< Quality factor of second order Butterworth section
+    constexpr static double highPassHz = 0.5;          ///< Band pass lower edge
+    constexpr static double lowPassHz = 100.0;         ///< Band pass upper edge
+    constexpr static double maxCutoff = 0.45;          ///< Upper edge limit relative to sample rate
+    constexpr static double q30 = 1073741824.0;        ///< Q2.30 scale
+    constexpr static double q31 = 2147483648.0;        ///< Q1.31 scale
+
+    enum class Shape
+    {
+        Notch,
+        HighPass,
+        LowPass,
+    };
+
+    /**
+     * @brief Design biquad with RBJ cookbook formulas and store it in CMSIS layout {b0, b1, b2, -a1, -a2}, Q2.30.
+     *        Design runs in double precision, so 0.5 Hz poles at 2 kSPS keep their distance from unit circle
+     */
+    void DesignBiquad(Shape shape, double frequency, double q, uint32_t rate, q31_t *out)
+    {
+        double w0 = 2.0 * pi * frequency / rate;
+        double cosW0 = cos(w0);
+        double alpha = sin(w0) / (2.0 * q);
+        double b[3];
+
+        switch (shape)
+        {
+        case Shape::Notch:
+            b[0] = 1.0;
+            b[1] = -2.0 * cosW0;
+            b[2] = 1.0;
+            break;
+
+        case Shape::HighPass:
+            b[0] = (1.0 + cosW0) / 2.0;
+            b[1] = -(1.0 + cosW0);
+            b[2] = b[0];
+            break;
+
+        case Shape::LowPass:
+        default:
+            b[0] = (1.0 - cosW0) / 2.0;
+            b[1] = 1.0 - cosW0;
+            b[2] = b[0];
+            break;
+        }
+
+        double a0 = 1.0 + alpha;
+        double values[5] = {b[0] / a0, b[1] / a0, b[2] / a0, 2.0 * cosW0 / a0, -(1.0 - alpha) / a0};
+
+        for (size_t i = 0; i < ARRAY_SIZE(values); ++i)
+        {
+            out[i] = static_cast<q31_t>(CLAMP(lround(values[i] * q30), INT32_MIN, INT32_MAX));
+        }
+    }
+
+    /**
+     * @brief Design Blackman windowed sinc low pass with cutoff at half of output rate and unity DC gain, Q1.31.
+     *        With 32 taps per phase, response is flat to 0.41 and at least 74 dB down from 0.59 of output rate,
+     *        so nothing folds into the band below 0.41 of output rate
+     *
+     * @param factor decimation factor
+     * @param taps number of taps
+     * @param out output coefficients
+     */
+    void DesignDecimator(size_t factor, size_t taps, q31_t *out)
+    {
+        auto tap = [factor, taps](size_t i)
+        {
+            double t = (i - (taps - 1) / 2.0) / factor;
+            double sinc = t == 0.0 ? 1.0 : sin(pi * t) / (pi * t);
+            double window = 0.42 - 0.5 * cos(2.0 * pi * i / (taps - 1)) + 0.08 * cos(4.0 * pi * i / (taps - 1));
+            return sinc * window;
+        };
+        double sum = 0.0;
+
+        for (size_t i = 0; i < taps; ++i)
+        {
+            sum += tap(i);
+        }
+
+        for (size_t i = 0; i < taps; ++i)
+        {
+            out[i] = static_cast<q31_t>(CLAMP(lround(tap(i) / sum * q31), INT32_MIN, INT32_MAX));
+        }
+    }
+}
+
+/**
+ * @brief Construct Ads131Pipeline
+ *
+ * @param controller USB communication controller
+ */
+Ads131Pipeline::Ads131Pipeline(UsbCommHandler &controller) : stream0(controller), stream1(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Registers BLE command handler and applies CONFIG_ADS131_FILTER_PRESET
+ *
+ * @param adcRate ADC sample rate, Hz
+ * @param streamRate streaming rate, Hz. adcRate divided by 1, 2, 4 or 8
+ */
+void Ads131Pipeline::Initialize(uint32_t adcRate, uint32_t streamRate)
+{
+    q31_t preset[5 * MaxStages];
+
+    inputRate = adcRate;
+    outputRate = streamRate;
+    memset(packet, 0, sizeof(packet));
+
+    for (Device &dev : devices)
+    {
+        dev.counter = 0;
+    }
+
+    SetDecimation(inputRate / outputRate);
+
+    size_t count = DesignPreset(static_cast<Ads131FilterPreset>(CONFIG_ADS131_FILTER_PRESET), outputRate, preset);
+    SetPending(preset, count);
+    ApplyPending();
+
+    LOG_INF("%u SPS decimated by %u to %u SPS, %u filter stages", inputRate, decimation, outputRate, stages);
+
+    Bluetooth::GattRegisterControlCallback(CommandId::Ads131m08Cmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+}
+
+bool Ads131Pipeline::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    q31_t requested[5 * MaxStages];
+    size_t count;
+
+    if (offset.value != 0 || length.value < 1)
+    {
+        return false;
+    }
+
+    // Coefficients are applied by the system work queue on the next block
+    switch (static_cast<Ads131Command>(key.key[0]))
+    {
+    case Ads131Command::SetPreset:
+        if (buffer[0] > static_cast<uint8_t>(Ads131FilterPreset::Bandpass))
+        {
+            return false;
+        }
+        count = DesignPreset(static_cast<Ads131FilterPreset>(buffer[0]), outputRate, requested);
+        LOG_INF("Filter preset %u, %u stages", buffer[0], count);
+        break;
+
+    case Ads131Command::SetCoefficients:
+        count = buffer[0];
+        if (count > MaxStages || length.value < 1 + 5 * sizeof(q31_t) * count)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < 5 * count; ++i)
+        {
+            requested[i] = static_cast<q31_t>(sys_get_le32(buffer + 1 + sizeof(q31_t) * i));
+        }
+        LOG_INF("Custom filter, %u stages", count);
+        break;
+
+    default:
+        return false;
+    }
+
+    SetPending(requested, count);
+
+    return true;
+}
+
+/**
+ * @brief Design preset coefficients for sample rate
+ *
+ * @param preset filter preset
+ * @param rate sample rate, Hz
+ * @param out output coefficients, 5 per stage
+ * @return number of stages
+ */
+size_t Ads131Pipeline::DesignPreset(Ads131FilterPreset preset, uint32_t rate, q31_t *out)
+{
+    size_t count = 0;
+
+    if (preset == Ads131FilterPreset::Off)
+    {
+        return 0;
+    }
+
+    if (preset == Ads131FilterPreset::Notch50Bandpass || preset == Ads131FilterPreset::Notch60Bandpass)
+    {
+        double notchHz = preset == Ads131FilterPreset::Notch50Bandpass ? 50.0 : 60.0;
+        DesignBiquad(Shape::Notch, notchHz, notchQ, rate, out + 5 * count++);
+    }
+
+    DesignBiquad(Shape::HighPass, highPassHz, butterworthQ, rate, out + 5 * count++);
+    DesignBiquad(Shape::LowPass, MIN(lowPassHz, maxCutoff * rate), butterworthQ, rate, out + 5 * count++);
+
+    return count;
+}
+
+/**
+ * @brief Store coefficients to be applied on the next block
+ */
+void Ads131Pipeline::SetPending(const q31_t *values, size_t count)
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    memcpy(pendingCoefficients, values, 5 * sizeof(q31_t) * count);
+    pendingStages = count;
+    reloadPending.store(true, std::memory_order_release);
+
+    k_spin_unlock(&pendingLock, key);
+}
+
+/**
+ * @brief Apply pending coefficients to every channel and clear filter state
+ */
+void Ads131Pipeline::ApplyPending()
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    memcpy(coefficients, pendingCoefficients, 5 * sizeof(q31_t) * pendingStages);
+    stages = pendingStages;
+    reloadPending.store(false, std::memory_order_relaxed);
+
+    k_spin_unlock(&pendingLock, key);
+
+    for (Device &dev : devices)
+    {
+        for (size_t ch = 0; ch < Channels; ++ch)
+        {
+            arm_biquad_cascade_df1_init_q31(&dev.filter[ch], stages, coefficients, dev.state[ch], postShift);
+        }
+    }
+}
+
+/**
+ * @brief Design decimator and reset decimator state of every device
+ *
+ * @param factor decimation factor, 1, 2, 4 or 8
+ */
+void Ads131Pipeline::SetDecimation(size_t factor)
+{
+    decimation = factor;
+    blockFrames = SamplesPerPacket * decimation;
+
+    if (decimation > 1)
+    {
+        DesignDecimator(decimation, tapsPerPhase * decimation, decimatorCoefficients);
+    }
+
+    for (Device &dev : devices)
+    {
+        dev.frames = 0;
+
+        if (decimation > 1)
+        {
+            for (size_t ch = 0; ch < Channels; ++ch)
+            {
+                arm_fir_decimate_init_q31(&dev.decimator[ch], tapsPerPhase * decimation, decimation,
+                                          decimatorCoefficients, dev.decimatorState[ch], blockFrames);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Add frame of one device. Sends packet when block is complete
+ *
+ * @param device device index, less than MaxDevices
+ * @param channels channel data of the frame, 8 x 24-bit big endian
+ */
+void Ads131Pipeline::PushFrame(size_t device, const uint8_t *channels)
+{
+    Device &dev = devices[device];
+
+    for (size_t ch = 0; ch < Channels; ++ch)
+    {
+        // Sign extend 24-bit sample
+        int32_t sample = static_cast<int32_t>(sys_get_be24(channels + 3 * ch) << 8) >> 8;
+        dev.input[ch][dev.frames] = sample * (1 << SampleShift);
+    }
+
+#if CONFIG_USE_FEEDBACK
+    // Amplitude rules see every frame, before the block is complete
+    if (feedback != nullptr && feedback->Wants(FeedbackSource::Amplitude))
+    {
+        int32_t codes[Channels];
+
+        for (size_t ch = 0; ch < Channels; ++ch)
+        {
+            codes[ch] = dev.input[ch][dev.frames] >> SampleShift;
+        }
+        feedback->OnFrame(device, codes, LatencyMeter::Stamp());
+    }
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+    // Frames are counted one by one, so a threshold trigger is aligned to the crossing frame
+    if (capture != nullptr)
+    {
+        capture->OnFrame(device, dev.input, dev.frames);
+    }
+#endif
+
+    if (++dev.frames < blockFrames)
+    {
+        return;
+    }
+    dev.frames = 0;
+
+#if CONFIG_USE_ADS131_SIGNAL_QUALITY
+    // Quality is judged on ADC samples, before the notch removes line noise
+    if (signalQuality != nullptr)
+    {
+        signalQuality->PushBlock(device, dev.input, blockFrames);
+    }
+#endif
+
+    if (reloadPending.load(std::memory_order_acquire))
+    {
+        ApplyPending();
+    }
+
+    FilterBlock(dev);
+
+#if CONFIG_USE_ADS131_BAND_POWER
+    if (bandPower != nullptr)
+    {
+        bandPower->PushBlock(device, dev.block);
+    }
+#endif
+
+    Pack(dev);
+
+#if CONFIG_USE_EVENT_CAPTURE
+    if (capture != nullptr && capture->HoldAds(device, packet, PacketSize, blockFrames))
+    {
+        return;
+    }
+#endif
+
+    if (device == 0)
+    {
+        stream0.Publish(packet, PacketSize);
+    }
+    else
+    {
+        stream1.Publish(packet, PacketSize);
+    }
+}
+
+/**
+ * @brief Set band power estimator fed with every filtered block
+ *
+ * @param estimator band power estimator, nullptr stops feeding blocks
+ */
+void Ads131Pipeline::SetBandPower(BandPower *estimator)
+{
+    bandPower = estimator;
+}
+
+/**
+ * @brief Set signal quality monitor fed with every block of ADC samples
+ *
+ * @param monitor signal quality monitor, nullptr stops feeding blocks
+ */
+void Ads131Pipeline::SetSignalQuality(SignalQuality *monitor)
+{
+    signalQuality = monitor;
+}
+
+#if CONFIG_USE_FEEDBACK
+/**
+ * @brief Set feedback engine fed with the ADC codes of every frame
+ *
+ * @param engine feedback engine, nullptr stops feeding frames
+ */
+void Ads131Pipeline::SetFeedback(FeedbackEngine *engine)
+{
+    feedback = engine;
+}
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+/**
+ * @brief Set event capture that counts every frame and holds packets while capture mode is enabled
+ *
+ * @param events event capture, nullptr publishes every packet
+ */
+void Ads131Pipeline::SetCapture(EventCapture *events)
+{
+    capture = events;
+}
+#endif
+
+/**
+ * @brief Decimate complete block of a device and filter the result
+ */
+void Ads131Pipeline::FilterBlock(Device &dev)
+{
+    for (size_t ch = 0; ch < Channels; ++ch)
+    {
+        if (decimation > 1)
+        {
+            arm_fir_decimate_q31(&dev.decimator[ch], dev.input[ch], dev.block[ch], blockFrames);
+        }
+        else
+        {
+            memcpy(dev.block[ch], dev.input[ch], sizeof(dev.block[ch]));
+        }
+
+        if (stages != 0)
+        {
+            arm_biquad_cascade_df1_q31(&dev.filter[ch], dev.block[ch], dev.block[ch], SamplesPerPacket);
+        }
+    }
+}
+
+/**
+ * @brief Pack filtered block into packet
+ */
+void Ads131Pipeline::Pack(Device &dev)
+{
+    constexpr int32_t maxSample = (1 << 23) - 1;
+
+    for (size_t i = 0; i < SamplesPerPacket; ++i)
+    {
+        uint8_t *out = packet + sampleStride * i;
+
+        for (size_t ch = 0; ch < Channels; ++ch)
+        {
+            int32_t sample = CLAMP(dev.block[ch][i] >> SampleShift, -maxSample - 1, maxSample);
+            sys_put_be24(static_cast<uint32_t>(sample), out + 3 * ch);
+        }
+        out[counterOffset] = dev.counter++;
+    }
+}
+
+#if CONFIG_ADS131_PIPELINE_BENCHMARK
+/**
+ * @brief Measure pipeline cycles for 8 and 16 channels at every ADC sample rate and decimation factor, and log
+ *        CPU load with BLE bandwidth. Must be called before sampling starts
+ */
+void Ads131Pipeline::Benchmark()
+{
+    constexpr static uint32_t rates[] = {250, 500, 1000, 2000, 4000};
+    constexpr static uint32_t minOutputRate = 125;
+    q31_t active[5 * MaxStages];
+    q31_t preset[5 * MaxStages];
+    size_t activeStages = stages;
+    size_t activeDecimation = decimation;
+
+    memcpy(active, coefficients, sizeof(active));
+
+    timing_init();
+    timing_start();
+
+    for (uint32_t rate : rates)
+    {
+        for (size_t factor = 1; factor <= MaxDecimation && rate / factor >= minOutputRate; factor *= 2)
+        {
+            uint32_t output = rate / factor;
+            uint32_t load[MaxDevices];
+
+            SetDecimation(factor);
+            SetPending(preset, DesignPreset(Ads131FilterPreset::Notch50Bandpass, output, preset));
+            ApplyPending();
+
+            for (size_t deviceCount = 1; deviceCount <= MaxDevices; ++deviceCount)
+            {
+                // One second of samples. Content does not change cycle count, so every sample is distinct noise
+                size_t blocks = DIV_ROUND_UP(output, SamplesPerPacket);
+                uint64_t cycles = 0;
+                uint32_t seed = 1;
+
+                for (size_t block = 0; block < blocks; ++block)
+                {
+                    for (size_t d = 0; d < deviceCount; ++d)
+                    {
+                        Device &dev = devices[d];
+                        for (size_t ch = 0; ch < Channels; ++ch)
+                        {
+                            for (size_t i = 0; i < blockFrames; ++i)
+                            {
+                                seed = seed * 1664525u + 1013904223u;
+                                dev.input[ch][i] = (static_cast<int32_t>(seed) >> 8) * (1 << SampleShift);
+                            }
+                        }
+
+                        timing_t start = timing_counter_get();
+                        FilterBlock(dev);
+                        Pack(dev);
+                        timing_t end = timing_counter_get();
+                        cycles += timing_cycles_get(&start, &end);
+                    }
+                }
+
+                uint64_t perSecond = cycles * output / (blocks * SamplesPerPacket);
+                load[deviceCount - 1] = static_cast<uint32_t>(perSecond * 10000 / timing_freq_get());
+            }
+
+            // BLE payload of one device
+            uint32_t bandwidth = output * PacketSize / SamplesPerPacket;
+
+            LOG_INF("%4u -> %4u SPS: %u.%02u%% CPU for 8 channels, %u.%02u%% for 16, %6u B/s per device, %2u%% saved",
+                    rate, output, load[0] / 100, load[0] % 100, load[1] / 100, load[1] % 100, bandwidth,
+                    100 - 100 / factor);
+        }
+    }
+
+    timing_stop();
+
+    SetDecimation(activeDecimation);
+    SetPending(active, activeStages);
+    ApplyPending();
+
+    for (Device &dev : devices)
+    {
+        dev.counter = 0;
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,1931 @@
+// Generated by scripts/audio_clips.py, do not edit. 30453 bytes of clip data
+
+#if CONFIG_USE_I2S
+
+#include "audio_clips.hpp"
+
+namespace
+{
+    const uint8_t sirenData[23253] = {
+        0xFD, 0xFC, 0xF5, 0x73, 0xFC, 0x7D, 0xFB, 0xFC, 0x6E, 0x72, 0x69, 0x7E, 0x71, 0xEE, 0x63, 0xEA,
+        0x5B, 0xCA, 0xA2, 0xA3, 0xAA, 0xB0, 0xBB, 0xBC, 0xC6, 0xC9, 0xD9, 0xDB, 0xE0, 0xDD, 0xE5, 0xE2,
+        0xEC, 0xEB, 0xEB, 0xF5, 0xF3, 0x27, 0x1C, 0x1E, 0x1F, 0x29, 0x2E, 0x35, 0x3B, 0x42, 0x4D, 0x52,
+        0x57, 0x54, 0x5F, 0x57, 0x68, 0x5B, 0x62, 0x63, 0x5D, 0xA9, 0x9C, 0x9E, 0xA0, 0xAB, 0xB2, 0xB9,
+        0xC1, 0xCB, 0xE4, 0xED, 0x6C, 0x78, 0x5E, 0x65, 0x5C, 0x61, 0x5A, 0x5C, 0x5D, 0x27, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2D, 0x33, 0x3A, 0x3F, 0x49, 0x4B, 0x53, 0x56, 0x5B, 0x54, 0x5C, 0x58, 0x65, 0x64,
+        0x60, 0xA9, 0x9D, 0x9E, 0x9F, 0xAA, 0xB1, 0xB9, 0xBF, 0xCA, 0xDA, 0xDE, 0x77, 0xF2, 0x74, 0xEF,
+        0x69, 0x6F, 0x61, 0x64, 0x68, 0x27, 0x1C, 0x1D, 0x1F, 0x29, 0x2E, 0x34, 0x3C, 0x44, 0x4E, 0x53,
+        0x5F, 0x5A, 0x65, 0x5F, 0x73, 0x62, 0x7C, 0xFE, 0x6F, 0xA8, 0x9C, 0x9E, 0x9F, 0xA9, 0xAE, 0xB5,
+        0xBB, 0xC5, 0xCE, 0xD4, 0xE3, 0xDA, 0xE8, 0xDB, 0xEA, 0xDC, 0xEA, 0xEF, 0xE0, 0x29, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x30, 0x37, 0x3D, 0x48, 0x52, 0x5F, 0xF5, 0x74, 0xE5, 0x76, 0xEE, 0xFD, 0xE5, 0xE5,
+        0xEC, 0xA7, 0x9C, 0x9E, 0x9F, 0xA8, 0xAD, 0xB3, 0xB9, 0xBE, 0xCA, 0xCF, 0xDC, 0xD7, 0xDD, 0xD8,
+        0xE0, 0xDA, 0xE8, 0xE6, 0xDE, 0x29, 0x1C, 0x1E, 0x20, 0x2B, 0x31, 0x39, 0x40, 0x4A, 0x5D, 0x6B,
+        0xE8, 0xF4, 0xE6, 0xF0, 0xDF, 0xE4, 0xDE, 0xDE, 0xDD, 0xA6, 0x9C, 0x9E, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xBA, 0xBF, 0xCB, 0xCE, 0xD9, 0xD6, 0xDE, 0xD9, 0xDF, 0xDC, 0xE6, 0xEB, 0xEB, 0x28, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x30, 0x39, 0x40, 0x49, 0x5D, 0x69, 0xEE, 0x79, 0xF1, 0x75, 0xEC, 0xEA, 0xDF, 0xDE,
+        0xDD, 0xA7, 0x9C, 0x9E, 0x9E, 0xA8, 0xAE, 0xB3, 0xB9, 0xBF, 0xCD, 0xD3, 0xDD, 0xD7, 0xDF, 0xDB,
+        0xEA, 0xE9, 0x7A, 0x76, 0x7D, 0x27, 0x1C, 0x1E, 0x1F, 0x29, 0x2F, 0x35, 0x3D, 0x46, 0x55, 0x59,
+        0x6B, 0x5F, 0x6F, 0x67, 0xFD, 0x7E, 0xEA, 0xE5, 0xE9, 0xA7, 0x9C, 0x9D, 0x9F, 0xA9, 0xAF, 0xB5,
+        0xBC, 0xC4, 0xD1, 0xD4, 0xE6, 0xE1, 0xF9, 0xEB, 0x79, 0xFC, 0x66, 0x5F, 0x69, 0x27, 0x1C, 0x1E,
+        0x1F, 0x29, 0x2E, 0x35, 0x3B, 0x41, 0x4D, 0x50, 0x62, 0x5E, 0x66, 0x5D, 0x73, 0x69, 0xF1, 0xEB,
+        0x76, 0xA8, 0x9C, 0x9E, 0x9F, 0xAA, 0xB0, 0xB7, 0xBE, 0xC6, 0xD7, 0xDF, 0x7D, 0xF7, 0x75, 0xF2,
+        0x66, 0x6F, 0x5D, 0x5C, 0x5F, 0x26, 0x1C, 0x1E, 0x1E, 0x28, 0x2D, 0x32, 0x3A, 0x41, 0x4E, 0x53,
+        0x5D, 0x5B, 0x5E, 0x5B, 0x79, 0x68, 0x7E, 0x72, 0x6A, 0xA8, 0x9C, 0x9E, 0x9F, 0xAA, 0xAF, 0xB6,
+        0xBF, 0xC9, 0xD9, 0xE2, 0x7C, 0x78, 0x69, 0x71, 0x5E, 0x65, 0x5B, 0x61, 0x63, 0x27, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2D, 0x32, 0x3A, 0x3F, 0x4C, 0x50, 0x60, 0x61, 0x62, 0x5C, 0x7B, 0x73, 0xEF, 0x74,
+        0x6A, 0xA8, 0x9C, 0x9D, 0x9F, 0xA9, 0xAF, 0xB7, 0xBE, 0xC5, 0xD6, 0xDE, 0x71, 0x72, 0x6E, 0xFB,
+        0x64, 0x6C, 0x5D, 0x5E, 0x60, 0x26, 0x1C, 0x1D, 0x1E, 0x28, 0x2D, 0x33, 0x3B, 0x41, 0x4F, 0x55,
+        0x68, 0x63, 0x69, 0x5F, 0xFA, 0x76, 0xF1, 0xF5, 0x7A, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB6,
+        0xBD, 0xC5, 0xD4, 0xDC, 0xFA, 0xEF, 0x72, 0xF0, 0x6C, 0x79, 0x69, 0x6B, 0x74, 0x27, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2E, 0x35, 0x3C, 0x43, 0x50, 0x59, 0x6C, 0x65, 0x75, 0x63, 0xFA, 0xF5, 0xE9, 0xF6,
+        0x7F, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB5, 0xBC, 0xC4, 0xD2, 0xDA, 0xEA, 0xE3, 0xF5, 0xE4,
+        0xFC, 0xF9, 0x73, 0xFC, 0xFC, 0x27, 0x1C, 0x1D, 0x1E, 0x28, 0x2E, 0x34, 0x3C, 0x45, 0x56, 0x60,
+        0xFE, 0x6F, 0x7D, 0x64, 0xFA, 0xF9, 0xE4, 0xEA, 0xF1, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB3,
+        0xBC, 0xC3, 0xCF, 0xDA, 0xEF, 0xE9, 0xF6, 0xDF, 0xF0, 0xE9, 0x6E, 0x73, 0xF2, 0x28, 0x1C, 0x1E,
+        0x1F, 0x29, 0x2E, 0x35, 0x3D, 0x45, 0x54, 0x64, 0xF1, 0x7B, 0xF3, 0x6C, 0xF5, 0x78, 0xE5, 0xE7,
+        0xF8, 0xA7, 0x9C, 0x9E, 0x9F, 0xA8, 0xAE, 0xB3, 0xBB, 0xC1, 0xCD, 0xD7, 0xEB, 0xE5, 0xF7, 0xE6,
+        0xF6, 0xE8, 0x76, 0x77, 0xEF, 0x27, 0x1C, 0x1E, 0x1F, 0x29, 0x2F, 0x35, 0x3C, 0x45, 0x52, 0x5B,
+        0x73, 0x6B, 0xFB, 0x72, 0xEA, 0x77, 0xED, 0xE9, 0xEF, 0xA6, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB4,
+        0xBB, 0xC1, 0xCC, 0xD3, 0xE4, 0xE1, 0xED, 0xE1, 0x7D, 0xE9, 0x6F, 0x6E, 0xF9, 0x27, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2F, 0x35, 0x3D, 0x43, 0x4D, 0x57, 0x68, 0x65, 0x70, 0x68, 0xEA, 0x72, 0xED, 0xEA,
+        0xF6, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB4, 0xBC, 0xC0, 0xCB, 0xD5, 0xE8, 0xE4, 0xEF, 0xE2,
+        0x79, 0xEA, 0x71, 0x6A, 0x7A, 0x27, 0x1C, 0x1E, 0x1E, 0x28, 0x2F, 0x35, 0x3C, 0x42, 0x4C, 0x56,
+        0x62, 0x5D, 0x71, 0x67, 0xF3, 0x68, 0x7E, 0xED, 0xFD, 0xA7, 0x9C, 0x9E, 0x9F, 0xA9, 0xAF, 0xB5,
+        0xBD, 0xC2, 0xCB, 0xD4, 0xE0, 0xDD, 0xF9, 0xE9, 0x7D, 0xE7, 0xFD, 0x73, 0xF2, 0x28, 0x1C, 0x1E,
+        0x1F, 0x29, 0x2F, 0x35, 0x3C, 0x3F, 0x49, 0x52, 0x5E, 0x5A, 0x6B, 0x5F, 0x70, 0x61, 0x72, 0xF6,
+        0x6C, 0xA8, 0x9D, 0x9E, 0x9F, 0xA9, 0xAF, 0xB5, 0xBD, 0xC0, 0xCC, 0xD4, 0xE0, 0xDB, 0xED, 0xE2,
+        0x7E, 0xE8, 0xF0, 0x7C, 0xF1, 0x28, 0x1D, 0x1E, 0x1E, 0x28, 0x2E, 0x35, 0x3C, 0x40, 0x4B, 0x51,
+        0x5C, 0x58, 0x68, 0x5F, 0x73, 0x5F, 0x6D, 0x7A, 0x69, 0xA8, 0x9D, 0x9E, 0x9F, 0xA9, 0xAE, 0xB5,
+        0xBC, 0xC2, 0xCE, 0xD9, 0xE9, 0xDF, 0xF1, 0xE3, 0xF6, 0xE2, 0xF8, 0x7E, 0xE8, 0x29, 0x1D, 0x1E,
+        0x1E, 0x28, 0x2E, 0x36, 0x3C, 0x40, 0x4C, 0x56, 0x69, 0x5F, 0x6B, 0x5A, 0x61, 0x5B, 0x6C, 0x76,
+        0x60, 0xA9, 0x9D, 0x9E, 0x9F, 0xA9, 0xAF, 0xB6, 0xBC, 0xC1, 0xCE, 0xD7, 0xEF, 0xDF, 0xE7, 0xD8,
+        0xE1, 0xDC, 0xE8, 0xFF, 0xE9, 0x28, 0x1D, 0x1E, 0x1F, 0x29, 0x2E, 0x35, 0x3B, 0x3F, 0x4B, 0x50,
+        0x68, 0x5D, 0x63, 0x54, 0x5D, 0x58, 0x61, 0x79, 0x66, 0xA8, 0x9D, 0x9E, 0x9F, 0xA9, 0xAE, 0xB6,
+        0xBB, 0xC0, 0xCC, 0xD2, 0xE5, 0xDD, 0xE5, 0xD6, 0xDE, 0xD7, 0xE4, 0xF4, 0xE8, 0x28, 0x1C, 0x1E,
+        0x1E, 0x28, 0x2E, 0x35, 0x3B, 0x3F, 0x4A, 0x51, 0x60, 0x5E, 0x61, 0x54, 0x5A, 0x56, 0x6C, 0x75,
+        0x6D, 0xA8, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB5, 0xBB, 0xBF, 0xCC, 0xD4, 0xE1, 0xDE, 0xDF, 0xD6,
+        0xDD, 0xDC, 0xFB, 0xFC, 0xF4, 0x28, 0x1C, 0x1D, 0x1F, 0x28, 0x2F, 0x35, 0x3C, 0x40, 0x4C, 0x54,
+        0x61, 0x5C, 0x5E, 0x55, 0x5C, 0x5C, 0xFB, 0x7C, 0x77, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB5,
+        0xBB, 0xC0, 0xCB, 0xD2, 0xDE, 0xD8, 0xDB, 0xD4, 0xDD, 0xDE, 0x6F, 0x79, 0x7B, 0x27, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2E, 0x35, 0x3B, 0x40, 0x4C, 0x53, 0x60, 0x59, 0x5D, 0x58, 0x62, 0x68, 0xE5, 0xE9,
+        0xEB, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB4, 0xBA, 0xBF, 0xCC, 0xD1, 0xDF, 0xD8, 0xDD, 0xD7,
+        0xE1, 0xEB, 0x63, 0x63, 0x63, 0x26, 0x1C, 0x1D, 0x1E, 0x28, 0x2E, 0x34, 0x3B, 0x41, 0x4D, 0x50,
+        0x5F, 0x59, 0x5F, 0x5A, 0x68, 0x6E, 0xE5, 0xE0, 0xE5, 0xA6, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB4,
+        0xBB, 0xBF, 0xCA, 0xCE, 0xDD, 0xD9, 0xDD, 0xD5, 0xE2, 0xEE, 0x65, 0x62, 0x66, 0x26, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2E, 0x35, 0x3B, 0x3F, 0x49, 0x4F, 0x5E, 0x59, 0x5B, 0x52, 0x5F, 0x6A, 0xE3, 0xDE,
+        0xDD, 0xA6, 0x9B, 0x9D, 0x9E, 0xA7, 0xAE, 0xB3, 0xBA, 0xBE, 0xC9, 0xCE, 0xDD, 0xD7, 0xD8, 0xD3,
+        0xE5, 0xF0, 0x5E, 0x5A, 0x59, 0x25, 0x1B, 0x1D, 0x1E, 0x27, 0x2D, 0x33, 0x39, 0x3E, 0x4A, 0x4D,
+        0x5C, 0x5A, 0x5E, 0x59, 0x6D, 0x76, 0xDE, 0xDB, 0xDA, 0xA5, 0x9B, 0x9D, 0x9E, 0xA7, 0xAD, 0xB2,
+        0xB8, 0xBE, 0xC9, 0xCF, 0xDE, 0xDC, 0xE3, 0xDB, 0xEB, 0xED, 0x5E, 0x5A, 0x58, 0x25, 0x1B, 0x1D,
+        0x1E, 0x27, 0x2D, 0x32, 0x37, 0x3D, 0x47, 0x4E, 0x5D, 0x5A, 0x5C, 0x55, 0x5E, 0x67, 0xDF, 0xDB,
+        0xD9, 0xA5, 0x9B, 0x9D, 0x9E, 0xA7, 0xAD, 0xB0, 0xB7, 0xBD, 0xC8, 0xCE, 0xDF, 0xD9, 0xD9, 0xD4,
+        0xDE, 0xE9, 0x63, 0x5A, 0x59, 0x25, 0x1B, 0x1D, 0x1E, 0x27, 0x2C, 0x2F, 0x36, 0x3C, 0x47, 0x4C,
+        0x5C, 0x54, 0x58, 0x52, 0x5D, 0x65, 0xE8, 0xDB, 0xDB, 0xA5, 0x9B, 0x9D, 0x9D, 0xA6, 0xAC, 0xAF,
+        0xB6, 0xBD, 0xC6, 0xCC, 0xDE, 0xD9, 0xDC, 0xD3, 0xE0, 0xE8, 0x60, 0x58, 0x5A, 0x25, 0x1B, 0x1D,
+        0x1D, 0x26, 0x2C, 0x2F, 0x36, 0x3C, 0x47, 0x4F, 0x61, 0x5C, 0x5D, 0x54, 0x5F, 0x65, 0xE5, 0xDC,
+        0xDD, 0xA5, 0x9B, 0x9D, 0x9D, 0xA6, 0xAC, 0xAF, 0xB6, 0xBD, 0xCA, 0xD1, 0xE6, 0xDE, 0xDD, 0xD3,
+        0xDF, 0xE6, 0x68, 0x5C, 0x5C, 0x25, 0x1B, 0x1C, 0x1D, 0x26, 0x2C, 0x2F, 0x37, 0x3D, 0x4B, 0x51,
+        0x62, 0x5D, 0x62, 0x5A, 0x6A, 0x66, 0xE3, 0xD8, 0xD6, 0xA4, 0x9B, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF,
+        0xB7, 0xBE, 0xCB, 0xD2, 0xE5, 0xE6, 0xEC, 0xDE, 0xF6, 0xEE, 0x5A, 0x54, 0x52, 0x24, 0x1B, 0x1C,
+        0x1D, 0x25, 0x2C, 0x2F, 0x36, 0x3E, 0x4B, 0x53, 0x68, 0x67, 0x6E, 0x65, 0xF6, 0x7D, 0xD4, 0xCE,
+        0xCF, 0xA4, 0x9B, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF, 0xB6, 0xBD, 0xC9, 0xD2, 0xE9, 0xEA, 0xF2, 0xE5,
+        0x6D, 0x70, 0x4F, 0x4D, 0x4F, 0x23, 0x1B, 0x1C, 0x1D, 0x25, 0x2C, 0x30, 0x36, 0x3E, 0x4A, 0x54,
+        0x6A, 0x6E, 0xFA, 0x6A, 0xEB, 0xEF, 0xCF, 0xCC, 0xCD, 0xA4, 0x9B, 0x9C, 0x9D, 0xA6, 0xAC, 0xB0,
+        0xB7, 0xBD, 0xCA, 0xD8, 0xF5, 0xF6, 0x6D, 0xEA, 0x73, 0x6E, 0x4E, 0x4C, 0x4D, 0x23, 0x1B, 0x1C,
+        0x1D, 0x25, 0x2B, 0x2F, 0x37, 0x3E, 0x4A, 0x59, 0xFF, 0x7A, 0xE8, 0x6D, 0xEC, 0xE5, 0xCC, 0xCA,
+        0xCC, 0xA3, 0x9B, 0x9C, 0x9D, 0xA6, 0xAC, 0xAF, 0xB6, 0xBE, 0xCA, 0xDA, 0xFD, 0xF5, 0x6B, 0xEC,
+        0x68, 0x63, 0x4D, 0x4B, 0x4B, 0x22, 0x1A, 0x1C, 0x1D, 0x26, 0x2B, 0x2F, 0x37, 0x3E, 0x4B, 0x5F,
+        0xEE, 0xF1, 0xE2, 0x77, 0xDF, 0xDB, 0xCB, 0xCA, 0xC8, 0xA2, 0x9A, 0x9C, 0x9D, 0xA6, 0xAC, 0xAF,
+        0xB7, 0xBE, 0xCC, 0xE0, 0x6B, 0x6C, 0x5E, 0x78, 0x5E, 0x5C, 0x4B, 0x47, 0x47, 0x22, 0x1A, 0x1C,
+        0x1D, 0x26, 0x2C, 0x30, 0x38, 0x3F, 0x4C, 0x60, 0xE2, 0xE0, 0xDC, 0xFD, 0xDF, 0xDB, 0xCA, 0xC6,
+        0xC8, 0xA3, 0x9A, 0x9C, 0x9D, 0xA7, 0xAC, 0xB0, 0xB8, 0xBF, 0xCE, 0xDE, 0x6F, 0x6C, 0x60, 0xF2,
+        0x63, 0x5C, 0x4C, 0x47, 0x48, 0x23, 0x1A, 0x1C, 0x1D, 0x27, 0x2C, 0x30, 0x38, 0x3F, 0x4E, 0x5D,
+        0xF8, 0xFC, 0xEA, 0x68, 0xE8, 0xDF, 0xCC, 0xC7, 0xC9, 0xA2, 0x9B, 0x9C, 0x9E, 0xA7, 0xAC, 0xB1,
+        0xB8, 0xBF, 0xCD, 0xDA, 0xF3, 0xF6, 0x76, 0xE3, 0x6F, 0x6A, 0x4D, 0x48, 0x4A, 0x23, 0x1B, 0x1C,
+        0x1D, 0x26, 0x2C, 0x30, 0x37, 0x3D, 0x4B, 0x53, 0x66, 0x68, 0x69, 0x5A, 0x75, 0xEF, 0xD1, 0xCD,
+        0xD0, 0xA4, 0x9B, 0x9C, 0x9E, 0xA7, 0xAC, 0xB0, 0xB7, 0xBE, 0xCC, 0xD6, 0xF5, 0xEA, 0xEC, 0xDD,
+        0xFE, 0x67, 0x50, 0x4D, 0x4F, 0x24, 0x1B, 0x1C, 0x1E, 0x27, 0x2C, 0x2F, 0x36, 0x3D, 0x4B, 0x57,
+        0xF8, 0x6A, 0x6D, 0x5D, 0xF6, 0xE7, 0xD0, 0xCC, 0xCE, 0xA3, 0x9B, 0x9C, 0x9E, 0xA7, 0xAC, 0xB0,
+        0xB7, 0xBE, 0xCB, 0xD9, 0x6B, 0xFD, 0xF9, 0xDF, 0x70, 0x5E, 0x4B, 0x48, 0x4B, 0x23, 0x1B, 0x1C,
+        0x1E, 0x27, 0x2D, 0x31, 0x37, 0x3C, 0x4B, 0x5C, 0xE5, 0xFC, 0x77, 0x5F, 0xEF, 0xDA, 0xCA, 0xC7,
+        0xCB, 0xA4, 0x9B, 0x9D, 0x9E, 0xA7, 0xAD, 0xB2, 0xB8, 0xBE, 0xCE, 0xE7, 0x5A, 0x67, 0x6E, 0xEC,
+        0x5F, 0x53, 0x48, 0x46, 0x4C, 0x24, 0x1B, 0x1D, 0x1E, 0x28, 0x2D, 0x33, 0x3A, 0x3F, 0x54, 0x76,
+        0xD8, 0xE6, 0xE9, 0x78, 0xDB, 0xD3, 0xC9, 0xC6, 0xCD, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xAD, 0xB4,
+        0xBA, 0xC0, 0xD6, 0x7B, 0x57, 0x5E, 0x5E, 0xFD, 0x5E, 0x56, 0x4A, 0x48, 0x51, 0x26, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2D, 0x33, 0x3A, 0x40, 0x52, 0x79, 0xDA, 0xE3, 0xE2, 0x6B, 0xE5, 0xD9, 0xCB, 0xCA,
+        0xD4, 0xA6, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB4, 0xBA, 0xC0, 0xD4, 0x7F, 0x5C, 0x68, 0x66, 0xEA,
+        0x63, 0x5B, 0x4C, 0x4C, 0x57, 0x26, 0x1C, 0x1D, 0x1E, 0x29, 0x2F, 0x35, 0x3B, 0x42, 0x55, 0xFE,
+        0xDA, 0xE5, 0xE9, 0x68, 0xE2, 0xDC, 0xCD, 0xCE, 0xD9, 0xA6, 0x9C, 0x9D, 0x9E, 0xA9, 0xAF, 0xB6,
+        0xBC, 0xC2, 0xD2, 0x7F, 0x58, 0x67, 0x6C, 0xED, 0x5F, 0x5D, 0x4D, 0x4D, 0x56, 0x26, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2F, 0x36, 0x3A, 0x3F, 0x4E, 0x71, 0xD9, 0xE6, 0xEB, 0x76, 0xDE, 0xD9, 0xCB, 0xCC,
+        0xD8, 0xA6, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB5, 0xBA, 0xBF, 0xD0, 0xF3, 0x57, 0x64, 0x66, 0x7C,
+        0x5E, 0x57, 0x4A, 0x4B, 0x57, 0x25, 0x1B, 0x1D, 0x1E, 0x29, 0x2F, 0x35, 0x3B, 0x42, 0x55, 0x7A,
+        0xD5, 0xE7, 0xE7, 0x7D, 0xDF, 0xD8, 0xCB, 0xCB, 0xD8, 0xA5, 0x9B, 0x9D, 0x9E, 0xA9, 0xAF, 0xB6,
+        0xBC, 0xC3, 0xD5, 0xFC, 0x56, 0x6C, 0x6C, 0xEC, 0x64, 0x5D, 0x4D, 0x4D, 0x5B, 0x25, 0x1C, 0x1D,
+        0x1E, 0x29, 0x30, 0x37, 0x3C, 0x46, 0x5B, 0xEA, 0xD1, 0xE2, 0xEC, 0x6B, 0xE0, 0xD7, 0xC9, 0xCB,
+        0xD5, 0xA4, 0x9B, 0x9D, 0x9E, 0xA9, 0xB1, 0xB7, 0xBC, 0xC6, 0xDD, 0x69, 0x50, 0x62, 0x74, 0xE9,
+        0x5F, 0x55, 0x4A, 0x4B, 0x50, 0x24, 0x1B, 0x1D, 0x1E, 0x29, 0x31, 0x38, 0x3E, 0x47, 0x63, 0xE1,
+        0xCE, 0xDF, 0xE8, 0x7B, 0xDE, 0xD5, 0xCB, 0xCB, 0xD0, 0xA4, 0x9B, 0x9D, 0x9E, 0xA9, 0xB0, 0xB8,
+        0xBE, 0xC7, 0xDC, 0x6B, 0x50, 0x62, 0x69, 0xF5, 0x60, 0x59, 0x4C, 0x4D, 0x53, 0x24, 0x1B, 0x1D,
+        0x1E, 0x29, 0x31, 0x38, 0x3E, 0x47, 0x5B, 0xED, 0xD0, 0xDF, 0xEC, 0x6B, 0xE6, 0xDD, 0xCD, 0xCE,
+        0xD3, 0xA5, 0x9C, 0x9D, 0x9F, 0xA9, 0xB1, 0xB7, 0xBD, 0xC6, 0xD9, 0x6C, 0x52, 0x63, 0x79, 0xE7,
+        0x6A, 0x5D, 0x4C, 0x4D, 0x51, 0x24, 0x1B, 0x1D, 0x1F, 0x2A, 0x30, 0x36, 0x3C, 0x43, 0x54, 0xFF,
+        0xD9, 0xF3, 0x73, 0x5F, 0xF1, 0xDF, 0xCD, 0xCE, 0xD5, 0xA5, 0x9C, 0x9D, 0x9F, 0xAA, 0xB0, 0xB7,
+        0xBC, 0xC3, 0xD3, 0xFC, 0x5C, 0xFD, 0xEC, 0xDA, 0x7E, 0x67, 0x4F, 0x4F, 0x58, 0x25, 0x1C, 0x1D,
+        0x1F, 0x2A, 0x31, 0x36, 0x3C, 0x43, 0x51, 0x75, 0xE1, 0x74, 0x67, 0x57, 0x6E, 0xF7, 0xD5, 0xD6,
+        0xDD, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB2, 0xB7, 0xBD, 0xC4, 0xD7, 0x78, 0x5F, 0xF5, 0xE4, 0xD5,
+        0xE8, 0xFC, 0x59, 0x58, 0x5E, 0x26, 0x1C, 0x1E, 0x1F, 0x2A, 0x31, 0x37, 0x3C, 0x42, 0x54, 0x75,
+        0xE1, 0x6B, 0x5F, 0x53, 0x63, 0x75, 0xD9, 0xD6, 0xDC, 0xA5, 0x9B, 0x9D, 0x9F, 0xAA, 0xB1, 0xB8,
+        0xBD, 0xC4, 0xD4, 0xEB, 0x69, 0xE7, 0xDF, 0xD3, 0xE6, 0xF7, 0x56, 0x52, 0x59, 0x25, 0x1B, 0x1D,
+        0x1F, 0x29, 0x30, 0x37, 0x3D, 0x42, 0x52, 0x6D, 0xE7, 0x6B, 0x5F, 0x53, 0x66, 0xFA, 0xD1, 0xCF,
+        0xD5, 0xA5, 0x9B, 0x9D, 0x9F, 0xA9, 0xB0, 0xB7, 0xBD, 0xC3, 0xD6, 0xF8, 0x64, 0xE9, 0xDC, 0xD3,
+        0xE5, 0x73, 0x4F, 0x4E, 0x56, 0x25, 0x1C, 0x1D, 0x1F, 0x29, 0x30, 0x37, 0x3D, 0x44, 0x59, 0x78,
+        0xE2, 0x6B, 0x5E, 0x53, 0x69, 0xF2, 0xD1, 0xCE, 0xDA, 0xA5, 0x9C, 0x9D, 0x9F, 0xA9, 0xB1, 0xB9,
+        0xBE, 0xC4, 0xD8, 0xEF, 0x69, 0xEB, 0xEA, 0xD8, 0xEF, 0x6E, 0x53, 0x51, 0x5C, 0x26, 0x1C, 0x1D,
+        0x1F, 0x29, 0x31, 0x39, 0x3E, 0x44, 0x55, 0x6F, 0xE5, 0x72, 0x6C, 0x57, 0x6A, 0xF1, 0xCF, 0xCF,
+        0xDB, 0xA6, 0x9C, 0x9E, 0x9F, 0xA9, 0xB1, 0xB9, 0xBD, 0xC4, 0xD7, 0xF4, 0x64, 0xEF, 0xE7, 0xD6,
+        0xF0, 0x6E, 0x51, 0x52, 0x5F, 0x26, 0x1C, 0x1E, 0x1F, 0x2A, 0x31, 0x39, 0x3E, 0x49, 0x5F, 0xFB,
+        0xE2, 0x71, 0x63, 0x54, 0x6D, 0xF7, 0xD5, 0xD5, 0xE3, 0xA6, 0x9C, 0x9E, 0x9F, 0xAA, 0xB3, 0xBB,
+        0xC0, 0xC9, 0xE1, 0x73, 0x5B, 0x78, 0xEB, 0xD8, 0xED, 0x7A, 0x59, 0x59, 0x6C, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x33, 0x3B, 0x40, 0x48, 0x61, 0xF3, 0xD8, 0xEB, 0xFD, 0x5B, 0x6B, 0xFE, 0xD9, 0xD5,
+        0xE6, 0xA6, 0x9C, 0x9D, 0x9F, 0xAA, 0xB3, 0xBB, 0xBF, 0xC7, 0xDC, 0x7F, 0x5B, 0x7C, 0xED, 0xD7,
+        0xE6, 0xFD, 0x58, 0x55, 0x66, 0x26, 0x1C, 0x1D, 0x1F, 0x2A, 0x32, 0x3A, 0x3F, 0x47, 0x5C, 0x75,
+        0xE1, 0x73, 0x67, 0x55, 0x64, 0x7A, 0xDB, 0xD6, 0xE6, 0xA6, 0x9C, 0x9E, 0x9F, 0xAA, 0xB2, 0xBA,
+        0xC0, 0xC9, 0xDE, 0xF4, 0x5F, 0x7C, 0xED, 0xD5, 0xE9, 0x7A, 0x5B, 0x57, 0x6D, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2B, 0x33, 0x3B, 0x40, 0x48, 0x5C, 0x7B, 0xDE, 0x7D, 0x6D, 0x55, 0x69, 0xFB, 0xDB, 0xD7,
+        0xE9, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB3, 0xBB, 0xC0, 0xC9, 0xDC, 0x7A, 0x5D, 0xF6, 0xEA, 0xD4,
+        0xE4, 0xFF, 0x58, 0x54, 0x61, 0x26, 0x1C, 0x1E, 0x1F, 0x2B, 0x32, 0x3A, 0x3F, 0x49, 0x5E, 0x7F,
+        0xDF, 0x6F, 0x69, 0x56, 0x67, 0xF9, 0xD9, 0xD5, 0xE2, 0xA6, 0x9C, 0x9E, 0x9F, 0xAA, 0xB1, 0xB9,
+        0xBF, 0xC7, 0xD7, 0xEA, 0x64, 0xF1, 0xEC, 0xD7, 0xEA, 0x73, 0x5B, 0x5B, 0x6E, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x30, 0x38, 0x3D, 0x43, 0x51, 0x63, 0xE5, 0x6E, 0x64, 0x54, 0x65, 0xEF, 0xD8, 0xD8,
+        0xEA, 0xA7, 0x9C, 0x9E, 0x9F, 0xAA, 0xB0, 0xB8, 0xBC, 0xBF, 0xCD, 0xDA, 0x6C, 0xE9, 0xDF, 0xD2,
+        0xE7, 0x6B, 0x55, 0x56, 0x68, 0x26, 0x1C, 0x1E, 0x1F, 0x29, 0x30, 0x38, 0x3C, 0x3F, 0x4C, 0x58,
+        0xF1, 0x69, 0x5F, 0x53, 0x6A, 0xED, 0xD6, 0xD7, 0xE9, 0xA6, 0x9C, 0x9E, 0x9F, 0xA9, 0xB0, 0xB9,
+        0xBD, 0xC1, 0xCC, 0xD5, 0xFE, 0xE9, 0xE0, 0xD4, 0xEA, 0x6E, 0x57, 0x55, 0x63, 0x26, 0x1C, 0x1D,
+        0x1F, 0x29, 0x31, 0x39, 0x3E, 0x40, 0x4B, 0x56, 0xF6, 0x6D, 0x61, 0x54, 0x6C, 0xE4, 0xD0, 0xD1,
+        0xE1, 0xA6, 0x9C, 0x9D, 0x9F, 0xA9, 0xB0, 0xB9, 0xBD, 0xC1, 0xCE, 0xDE, 0x65, 0xF1, 0xE4, 0xD5,
+        0xF0, 0x5E, 0x4E, 0x4F, 0x60, 0x26, 0x1C, 0x1E, 0x1E, 0x29, 0x30, 0x39, 0x3E, 0x42, 0x4E, 0x5C,
+        0xEA, 0x6D, 0x68, 0x5A, 0xFA, 0xDC, 0xCF, 0xD1, 0xE9, 0xA7, 0x9C, 0x9E, 0x9E, 0xA9, 0xB0, 0xB9,
+        0xBE, 0xC2, 0xCD, 0xD7, 0x76, 0xEB, 0xEA, 0xDC, 0x78, 0x5D, 0x4F, 0x4F, 0x65, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x31, 0x3A, 0x3F, 0x43, 0x4D, 0x56, 0xF6, 0x6A, 0x65, 0x59, 0x7D, 0xDD, 0xCF, 0xCF,
+        0xE6, 0xA7, 0x9C, 0x9E, 0x9F, 0xAA, 0xB2, 0xBB, 0xC1, 0xC5, 0xD0, 0xD9, 0x7A, 0xDE, 0xDA, 0xD2,
+        0xEE, 0x5E, 0x4F, 0x51, 0x6C, 0x27, 0x1C, 0x1E, 0x1F, 0x2A, 0x32, 0x3C, 0x40, 0x45, 0x51, 0x59,
+        0x7D, 0x5B, 0x59, 0x51, 0x6C, 0xE0, 0xD0, 0xD4, 0xF3, 0xA8, 0x9C, 0x9E, 0x9F, 0xAA, 0xB2, 0xBC,
+        0xC1, 0xC7, 0xD5, 0xDE, 0x6F, 0xE0, 0xDB, 0xD1, 0xEB, 0x65, 0x52, 0x54, 0x6D, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x33, 0x3C, 0x41, 0x47, 0x57, 0x61, 0xE8, 0x6B, 0x5C, 0x4F, 0x62, 0xEC, 0xD5, 0xD5,
+        0xEF, 0xA7, 0x9C, 0x9D, 0x9E, 0xA9, 0xB2, 0xBB, 0xC0, 0xC7, 0xDA, 0xE5, 0x66, 0xEA, 0xDC, 0xD0,
+        0xE7, 0x62, 0x50, 0x51, 0x6D, 0x27, 0x1C, 0x1D, 0x1E, 0x28, 0x30, 0x39, 0x3E, 0x45, 0x54, 0x5D,
+        0xF1, 0x64, 0x5D, 0x51, 0x67, 0xE8, 0xD4, 0xD3, 0xED, 0xA7, 0x9B, 0x9D, 0x9E, 0xA8, 0xAF, 0xB9,
+        0xBE, 0xC2, 0xCD, 0xD5, 0x7E, 0xE7, 0xE3, 0xD4, 0xEC, 0x69, 0x56, 0x53, 0x6A, 0x27, 0x1C, 0x1D,
+        0x1E, 0x28, 0x30, 0x39, 0x3E, 0x42, 0x4E, 0x5A, 0xEA, 0x6F, 0x68, 0x56, 0x71, 0xE0, 0xD0, 0xCE,
+        0xE0, 0xA6, 0x9B, 0x9D, 0x9E, 0xA9, 0xB1, 0xB9, 0xBE, 0xC4, 0xD2, 0xDF, 0x64, 0xEC, 0xE6, 0xD8,
+        0xFD, 0x5C, 0x4E, 0x4D, 0x60, 0x26, 0x1B, 0x1D, 0x1E, 0x2A, 0x32, 0x3A, 0x3F, 0x47, 0x5A, 0x6A,
+        0xE2, 0x69, 0x67, 0x59, 0xFB, 0xDC, 0xCD, 0xCB, 0xDC, 0xA6, 0x9B, 0x9D, 0x9E, 0xA9, 0xB2, 0xBA,
+        0xBF, 0xC6, 0xD7, 0xE8, 0x65, 0xE8, 0xE9, 0xD8, 0xF7, 0x5D, 0x4E, 0x4C, 0x5D, 0x26, 0x1B, 0x1D,
+        0x1E, 0x2A, 0x32, 0x3B, 0x40, 0x47, 0x57, 0x70, 0xE2, 0x68, 0x67, 0x56, 0x7E, 0xDB, 0xCC, 0xCC,
+        0xDC, 0xA6, 0x9B, 0x9D, 0x9E, 0xAA, 0xB4, 0xBC, 0xC2, 0xC9, 0xDB, 0xFF, 0x63, 0xE6, 0xE0, 0xD4,
+        0x7B, 0x5B, 0x4C, 0x4C, 0x5D, 0x26, 0x1B, 0x1D, 0x1E, 0x2A, 0x33, 0x3C, 0x42, 0x49, 0x5A, 0x78,
+        0xEA, 0x5F, 0x5C, 0x50, 0x78, 0xDF, 0xCE, 0xCC, 0xDD, 0xA6, 0x9B, 0x9D, 0x9E, 0xAA, 0xB3, 0xBC,
+        0xC1, 0xC7, 0xD4, 0xE7, 0x6C, 0xE4, 0xDE, 0xD3, 0xF5, 0x67, 0x50, 0x4D, 0x5F, 0x26, 0x1B, 0x1D,
+        0x1F, 0x2A, 0x34, 0x3D, 0x43, 0x48, 0x58, 0x6C, 0xE8, 0x63, 0x5C, 0x52, 0xFD, 0xDE, 0xCE, 0xCB,
+        0xE1, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBD, 0xC3, 0xC9, 0xDD, 0x7D, 0x61, 0xE6, 0xDD, 0xD4,
+        0x76, 0x5C, 0x4C, 0x4A, 0x5D, 0x27, 0x1C, 0x1E, 0x1F, 0x2B, 0x35, 0x3D, 0x44, 0x49, 0x5B, 0x70,
+        0xEB, 0x60, 0x5F, 0x58, 0xEF, 0xDA, 0xCC, 0xCA, 0xDC, 0xA7, 0x9C, 0x9E, 0x9F, 0xAA, 0xB4, 0xBD,
+        0xC5, 0xCB, 0xDB, 0xEB, 0x72, 0xDE, 0xE2, 0xD9, 0x6E, 0x5B, 0x4C, 0x4B, 0x5D, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x34, 0x3D, 0x44, 0x4A, 0x5A, 0x6D, 0xEB, 0x60, 0x69, 0x5C, 0xE8, 0xD8, 0xCC, 0xCC,
+        0xE3, 0xA7, 0x9C, 0x9E, 0x9F, 0xAA, 0xB4, 0xBE, 0xC6, 0xCC, 0xDE, 0x7E, 0x5F, 0xE6, 0xE6, 0xDD,
+        0x67, 0x56, 0x4B, 0x4B, 0x60, 0x27, 0x1C, 0x1E, 0x1F, 0x2A, 0x34, 0x3F, 0x47, 0x4C, 0x63, 0x7E,
+        0xDE, 0x66, 0x61, 0x5B, 0xE9, 0xD6, 0xCB, 0xCA, 0xDD, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB4, 0xBF,
+        0xC7, 0xCD, 0xE5, 0xFB, 0x5E, 0xE4, 0xE0, 0xDA, 0x6C, 0x56, 0x4A, 0x48, 0x59, 0x26, 0x1C, 0x1E,
+        0x1F, 0x2B, 0x34, 0x3F, 0x46, 0x4C, 0x63, 0x75, 0xDE, 0x66, 0x61, 0x5B, 0xE7, 0xD5, 0xC9, 0xC6,
+        0xD6, 0xA6, 0x9C, 0x9E, 0x9F, 0xAA, 0xB4, 0xBF, 0xC6, 0xCD, 0xE7, 0xFB, 0x60, 0xE4, 0xDC, 0xD8,
+        0x69, 0x56, 0x49, 0x45, 0x53, 0x26, 0x1C, 0x1E, 0x1F, 0x2B, 0x35, 0x3F, 0x47, 0x4D, 0x68, 0x7A,
+        0xE2, 0x65, 0x5E, 0x5A, 0xE9, 0xD6, 0xC9, 0xC6, 0xD4, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBF,
+        0xC7, 0xCC, 0xE0, 0xEF, 0x63, 0xE6, 0xE1, 0xDB, 0x68, 0x53, 0x48, 0x46, 0x55, 0x26, 0x1C, 0x1E,
+        0x1F, 0x2B, 0x35, 0x3F, 0x47, 0x4C, 0x5F, 0x70, 0xDF, 0x6E, 0x69, 0x5D, 0xE1, 0xD1, 0xC8, 0xC7,
+        0xD6, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBF, 0xC8, 0xCD, 0xDF, 0xF8, 0x5F, 0xEA, 0xE5, 0xDD,
+        0x5D, 0x50, 0x47, 0x47, 0x56, 0x26, 0x1C, 0x1E, 0x1F, 0x2B, 0x36, 0x40, 0x49, 0x4F, 0x65, 0xFE,
+        0xE3, 0x62, 0x5D, 0x5C, 0xE1, 0xD2, 0xC7, 0xC7, 0xD4, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB6, 0xC0,
+        0xC9, 0xCF, 0xE7, 0xF5, 0x6A, 0xDD, 0xD8, 0xD7, 0x6C, 0x55, 0x47, 0x49, 0x58, 0x26, 0x1C, 0x1E,
+        0x1F, 0x2B, 0x37, 0x42, 0x4B, 0x51, 0x6A, 0x72, 0xE9, 0x5D, 0x58, 0x56, 0xEE, 0xD4, 0xC8, 0xC9,
+        0xD9, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB6, 0xC0, 0xC9, 0xCF, 0xE4, 0xEE, 0x69, 0xDB, 0xD6, 0xD5,
+        0x6B, 0x54, 0x49, 0x4B, 0x5C, 0x26, 0x1C, 0x1E, 0x1F, 0x2B, 0x36, 0x40, 0x49, 0x4F, 0x68, 0x78,
+        0xE7, 0x5B, 0x57, 0x56, 0xE8, 0xD5, 0xCA, 0xCB, 0xDA, 0xA6, 0x9C, 0x9E, 0x9F, 0xAB, 0xB6, 0xC1,
+        0xC9, 0xCF, 0xE9, 0xF8, 0x69, 0xDB, 0xDA, 0xDA, 0x60, 0x53, 0x4A, 0x4A, 0x57, 0x26, 0x1C, 0x1E,
+        0x1F, 0x2C, 0x37, 0x42, 0x49, 0x4E, 0x63, 0x6F, 0xEB, 0x5D, 0x5B, 0x5C, 0xDC, 0xD1, 0xC8, 0xC9,
+        0xD7, 0xA6, 0x9C, 0x9E, 0xA0, 0xAC, 0xB7, 0xC2, 0xC9, 0xCE, 0xE8, 0xFC, 0x65, 0xE3, 0xDE, 0xE0,
+        0x57, 0x4D, 0x46, 0x48, 0x56, 0x26, 0x1C, 0x1E, 0x1F, 0x2C, 0x36, 0x3F, 0x47, 0x4C, 0x63, 0x71,
+        0xEB, 0x60, 0x5C, 0x5F, 0xD6, 0xCD, 0xC7, 0xC9, 0xD9, 0xA6, 0x9C, 0x9E, 0x9F, 0xAC, 0xB5, 0xBF,
+        0xC7, 0xCC, 0xE3, 0xF6, 0x64, 0xEA, 0xE2, 0xE4, 0x55, 0x4C, 0x46, 0x47, 0x57, 0x26, 0x1C, 0x1E,
+        0x1F, 0x2B, 0x35, 0x3E, 0x45, 0x4A, 0x5D, 0x76, 0xDF, 0x6C, 0x5E, 0x5C, 0xDB, 0xCE, 0xC6, 0xC7,
+        0xDA, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBE, 0xC5, 0xC9, 0xDD, 0xFB, 0x5F, 0xE9, 0xDB, 0xD9,
+        0x5E, 0x4F, 0x47, 0x48, 0x5E, 0x27, 0x1C, 0x1E, 0x1F, 0x2B, 0x36, 0x3E, 0x46, 0x4B, 0x60, 0x79,
+        0xE3, 0x68, 0x5E, 0x5E, 0xDA, 0xCD, 0xC6, 0xC8, 0xDE, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBD,
+        0xC4, 0xC9, 0xD8, 0xE5, 0x6D, 0xE3, 0xDE, 0xDC, 0x5F, 0x51, 0x49, 0x4A, 0x5F, 0x27, 0x1C, 0x1F,
+        0x20, 0x2B, 0x36, 0x3E, 0x43, 0x47, 0x53, 0x63, 0xEC, 0x63, 0x5F, 0x5B, 0xDF, 0xD1, 0xC9, 0xCA,
+        0xDD, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB6, 0xBE, 0xC3, 0xC7, 0xD5, 0xE8, 0x6C, 0xDF, 0xDD, 0xDA,
+        0x5F, 0x4E, 0x47, 0x48, 0x59, 0x27, 0x1C, 0x1E, 0x1F, 0x2B, 0x35, 0x3D, 0x42, 0x46, 0x54, 0x63,
+        0xF4, 0x5C, 0x5B, 0x58, 0xE4, 0xD0, 0xC9, 0xC8, 0xD9, 0xA7, 0x9C, 0x9E, 0x9F, 0xAB, 0xB5, 0xBD,
+        0xC2, 0xC6, 0xD2, 0xE1, 0x6F, 0xDE, 0xDD, 0xD7, 0x67, 0x52, 0x49, 0x48, 0x59, 0x27, 0x1C, 0x1E,
+        0x1F, 0x2A, 0x34, 0x3E, 0x42, 0x46, 0x50, 0x5F, 0xF7, 0x59, 0x58, 0x51, 0xEF, 0xD6, 0xC9, 0xC9,
+        0xDC, 0xA7, 0x9C, 0x9E, 0x9F, 0xAA, 0xB4, 0xBD, 0xC0, 0xC5, 0xCF, 0xDE, 0x7E, 0xD7, 0xD7, 0xD3,
+        0x67, 0x51, 0x48, 0x48, 0x5A, 0x26, 0x1C, 0x1D, 0x1F, 0x2A, 0x33, 0x3D, 0x40, 0x47, 0x51, 0x5C,
+        0x77, 0x56, 0x59, 0x55, 0xE4, 0xD3, 0xC8, 0xC7, 0xD9, 0xA6, 0x9C, 0x9D, 0x9F, 0xA9, 0xB3, 0xBD,
+        0xC0, 0xC7, 0xD1, 0xDC, 0xFD, 0xD9, 0xDB, 0xD4, 0x67, 0x56, 0x49, 0x47, 0x58, 0x26, 0x1C, 0x1D,
+        0x1F, 0x2A, 0x34, 0x3E, 0x41, 0x48, 0x53, 0x5F, 0xF5, 0x5C, 0x5A, 0x53, 0xE7, 0xD5, 0xC8, 0xC7,
+        0xD7, 0xA6, 0x9C, 0x9D, 0x9F, 0xAA, 0xB4, 0xBD, 0xBF, 0xC7, 0xD7, 0xE5, 0x72, 0xDA, 0xD6, 0xD3,
+        0x63, 0x51, 0x49, 0x48, 0x55, 0x25, 0x1B, 0x1D, 0x1F, 0x2A, 0x34, 0x3D, 0x40, 0x47, 0x5A, 0x65,
+        0xEF, 0x59, 0x57, 0x55, 0xE1, 0xD1, 0xC9, 0xC6, 0xD0, 0xA5, 0x9B, 0x9D, 0x9E, 0xAA, 0xB3, 0xBD,
+        0xC0, 0xC8, 0xD7, 0xDF, 0x77, 0xD8, 0xDB, 0xD7, 0x62, 0x53, 0x4A, 0x46, 0x53, 0x25, 0x1B, 0x1D,
+        0x1E, 0x2A, 0x34, 0x3E, 0x42, 0x47, 0x54, 0x5F, 0xF8, 0x5B, 0x5D, 0x58, 0xDF, 0xCF, 0xC8, 0xC6,
+        0xD2, 0xA5, 0x9B, 0x9D, 0x9E, 0xAA, 0xB5, 0xBE, 0xC3, 0xC8, 0xD8, 0xEB, 0x6E, 0xDC, 0xDD, 0xD9,
+        0x5E, 0x4E, 0x47, 0x46, 0x51, 0x25, 0x1B, 0x1D, 0x1E, 0x2A, 0x35, 0x3D, 0x43, 0x48, 0x59, 0x6A,
+        0xF0, 0x5C, 0x5D, 0x5B, 0xE1, 0xCF, 0xC9, 0xC7, 0xD2, 0xA5, 0x9B, 0x9D, 0x9E, 0xA9, 0xB4, 0xBE,
+        0xC4, 0xC8, 0xD8, 0xE4, 0x74, 0xDC, 0xDF, 0xDA, 0x6A, 0x54, 0x4B, 0x47, 0x52, 0x25, 0x1B, 0x1D,
+        0x1E, 0x29, 0x34, 0x3D, 0x41, 0x46, 0x56, 0x61, 0xF4, 0x5A, 0x5D, 0x57, 0xEF, 0xD6, 0xCA, 0xC7,
+        0xD1, 0xA5, 0x9B, 0x9D, 0x9E, 0xA9, 0xB4, 0xBD, 0xC2, 0xC9, 0xDA, 0xE7, 0x73, 0xD8, 0xDA, 0xD7,
+        0x6A, 0x55, 0x4C, 0x4A, 0x57, 0x25, 0x1B, 0x1D, 0x1E, 0x29, 0x34, 0x3E, 0x44, 0x4B, 0x5D, 0x6B,
+        0xEE, 0x5A, 0x5C, 0x5B, 0xE5, 0xD7, 0xCF, 0xCE, 0xDC, 0xA6, 0x9B, 0x9D, 0x9E, 0xA9, 0xB4, 0xBE,
+        0xC4, 0xC9, 0xDA, 0xE9, 0x6A, 0xDC, 0xDE, 0xDC, 0x6A, 0x5B, 0x51, 0x4F, 0x5F, 0x26, 0x1C, 0x1D,
+        0x1E, 0x29, 0x34, 0x3D, 0x42, 0x48, 0x5A, 0x72, 0xE0, 0x60, 0x5F, 0x5C, 0xE8, 0xD8, 0xCE, 0xCD,
+        0xE1, 0xA7, 0x9C, 0x9E, 0x9E, 0xAA, 0xB4, 0xBD, 0xC2, 0xC8, 0xDE, 0x79, 0x5C, 0xE4, 0xE0, 0xDF,
+        0x5F, 0x53, 0x4C, 0x4E, 0x64, 0x27, 0x1C, 0x1E, 0x1E, 0x29, 0x34, 0x3D, 0x44, 0x4B, 0x5F, 0xF8,
+        0xDE, 0x65, 0x66, 0x6A, 0xD9, 0xD0, 0xCB, 0xCF, 0xE4, 0xA7, 0x9C, 0x9D, 0x9E, 0xA9, 0xB4, 0xBD,
+        0xC4, 0xCB, 0xDB, 0xF3, 0x64, 0xE3, 0xE9, 0xEA, 0x59, 0x51, 0x4B, 0x4E, 0x60, 0x27, 0x1C, 0x1D,
+        0x1E, 0x29, 0x34, 0x3E, 0x44, 0x4B, 0x59, 0x6F, 0xE7, 0x60, 0x64, 0x5F, 0xDF, 0xD6, 0xCC, 0xCE,
+        0xE1, 0xA7, 0x9C, 0x9E, 0x9E, 0xAA, 0xB5, 0xBE, 0xC4, 0xCB, 0xDC, 0xEE, 0x6A, 0xDF, 0xE3, 0xDD,
+        0x5F, 0x55, 0x4C, 0x4D, 0x5E, 0x27, 0x1C, 0x1D, 0x1E, 0x29, 0x34, 0x3E, 0x44, 0x4C, 0x5C, 0x66,
+        0xFA, 0x5A, 0x5D, 0x5A, 0xE1, 0xD7, 0xCE, 0xCF, 0xE2, 0xA7, 0x9C, 0x9D, 0x9E, 0xAA, 0xB4, 0xBE,
+        0xC6, 0xCE, 0xDD, 0xE9, 0x6F, 0xDD, 0xDF, 0xDC, 0x5E, 0x55, 0x4D, 0x4E, 0x5F, 0x26, 0x1C, 0x1D,
+        0x1E, 0x2A, 0x35, 0x3E, 0x46, 0x4C, 0x5B, 0x6A, 0xED, 0x5C, 0x5C, 0x58, 0xE6, 0xD7, 0xCD, 0xCE,
+        0xDF, 0xA6, 0x9C, 0x9D, 0x9E, 0xAA, 0xB5, 0xBE, 0xC5, 0xCB, 0xDB, 0xED, 0x6C, 0xDB, 0xDB, 0xD8,
+        0x68, 0x57, 0x4D, 0x4D, 0x5D, 0x26, 0x1C, 0x1D, 0x1E, 0x2A, 0x35, 0x3E, 0x46, 0x4B, 0x5A, 0x69,
+        0xF2, 0x5B, 0x5D, 0x5A, 0xE4, 0xD7, 0xCE, 0xCD, 0xDB, 0xA6, 0x9B, 0x9D, 0x9E, 0xA9, 0xB3, 0xBD,
+        0xC4, 0xCA, 0xD5, 0xE0, 0xFE, 0xDC, 0xE0, 0xDA, 0x63, 0x59, 0x4E, 0x4D, 0x5B, 0x26, 0x1B, 0x1D,
+        0x1E, 0x29, 0x34, 0x3D, 0x42, 0x47, 0x52, 0x63, 0xF2, 0x64, 0x67, 0x5C, 0xDD, 0xD5, 0xCC, 0xC9,
+        0xD5, 0xA5, 0x9B, 0x9D, 0x9E, 0xA9, 0xB4, 0xBC, 0xBF, 0xC5, 0xD2, 0xE7, 0x6F, 0xE1, 0xDF, 0xD9,
+        0x5E, 0x56, 0x4C, 0x4A, 0x58, 0x26, 0x1B, 0x1D, 0x1E, 0x29, 0x33, 0x3C, 0x3F, 0x47, 0x55, 0x64,
+        0xFB, 0x5B, 0x5B, 0x58, 0xDE, 0xD7, 0xCD, 0xCB, 0xDA, 0xA6, 0x9B, 0x9D, 0x9E, 0xA8, 0xB2, 0xBC,
+        0xC1, 0xC9, 0xD7, 0xE0, 0x7D, 0xDB, 0xDB, 0xD9, 0x5F, 0x58, 0x4D, 0x4B, 0x58, 0x25, 0x1B, 0x1D,
+        0x1E, 0x28, 0x32, 0x3C, 0x40, 0x46, 0x53, 0x60, 0xEE, 0x5E, 0x5C, 0x58, 0xE4, 0xD8, 0xCD, 0xCA,
+        0xD6, 0xA5, 0x9B, 0x9D, 0x9E, 0xA9, 0xB2, 0xBC, 0xBF, 0xC5, 0xD4, 0xE7, 0x69, 0xDC, 0xD9, 0xD5,
+        0x69, 0x58, 0x4D, 0x4A, 0x56, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x32, 0x3B, 0x3F, 0x47, 0x57, 0x6C,
+        0xE9, 0x5E, 0x5D, 0x5B, 0xDF, 0xD5, 0xCB, 0xCA, 0xD5, 0xA6, 0x9B, 0x9D, 0x9E, 0xA8, 0xB2, 0xBB,
+        0xC0, 0xC7, 0xD5, 0xE5, 0x6F, 0xDF, 0xDE, 0xDC, 0x61, 0x57, 0x4C, 0x4B, 0x55, 0x26, 0x1B, 0x1D,
+        0x1E, 0x28, 0x32, 0x3B, 0x40, 0x46, 0x53, 0x62, 0xEE, 0x62, 0x5D, 0x5C, 0xDF, 0xD3, 0xC9, 0xC9,
+        0xD1, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xB0, 0xBA, 0xBF, 0xC5, 0xD3, 0xE1, 0x6D, 0xDE, 0xDC, 0xDE,
+        0x5A, 0x4E, 0x48, 0x47, 0x50, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x30, 0x3A, 0x3F, 0x46, 0x55, 0x61,
+        0xEE, 0x5D, 0x5D, 0x62, 0xD6, 0xCE, 0xC8, 0xC8, 0xD3, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xB0, 0xBA,
+        0xBE, 0xC6, 0xD1, 0xDD, 0x76, 0xDD, 0xDF, 0xE4, 0x57, 0x51, 0x4A, 0x49, 0x53, 0x25, 0x1B, 0x1D,
+        0x1E, 0x27, 0x30, 0x39, 0x3D, 0x43, 0x4D, 0x58, 0x74, 0x5A, 0x5B, 0x5D, 0xDE, 0xD5, 0xCB, 0xCA,
+        0xD2, 0xA5, 0x9B, 0x9C, 0x9E, 0xA7, 0xAF, 0xB8, 0xBD, 0xC2, 0xCB, 0xD4, 0xEB, 0xD6, 0xD8, 0xDB,
+        0x5D, 0x52, 0x49, 0x49, 0x51, 0x25, 0x1B, 0x1C, 0x1D, 0x27, 0x2F, 0x38, 0x3D, 0x43, 0x4B, 0x53,
+        0x67, 0x52, 0x55, 0x56, 0xDF, 0xD4, 0xCB, 0xCB, 0xD5, 0xA5, 0x9B, 0x9D, 0x9E, 0xA7, 0xB0, 0xBA,
+        0xBE, 0xC2, 0xCA, 0xD4, 0xE6, 0xD3, 0xD4, 0xD6, 0x5F, 0x56, 0x4C, 0x4C, 0x57, 0x25, 0x1B, 0x1C,
+        0x1E, 0x28, 0x30, 0x39, 0x3C, 0x3F, 0x47, 0x51, 0x61, 0x4F, 0x51, 0x53, 0xE7, 0xD9, 0xCD, 0xCD,
+        0xDA, 0xA6, 0x9B, 0x9D, 0x9E, 0xA8, 0xB1, 0xB9, 0xBC, 0xBF, 0xC9, 0xD5, 0xE8, 0xD0, 0xCF, 0xD2,
+        0x6B, 0x5A, 0x4C, 0x4B, 0x57, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x30, 0x38, 0x3D, 0x40, 0x4A, 0x57,
+        0x6E, 0x53, 0x50, 0x50, 0xF4, 0xDE, 0xCC, 0xCA, 0xD5, 0xA5, 0x9B, 0x9C, 0x9E, 0xA7, 0xB0, 0xB9,
+        0xBE, 0xC1, 0xC8, 0xD4, 0xEB, 0xD3, 0xCF, 0xCF, 0xF3, 0x6B, 0x4F, 0x4E, 0x5A, 0x26, 0x1B, 0x1D,
+        0x1E, 0x28, 0x32, 0x3A, 0x3F, 0x41, 0x48, 0x54, 0x69, 0x52, 0x4F, 0x50, 0x79, 0xE6, 0xCE, 0xCD,
+        0xD8, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xB0, 0xB8, 0xBD, 0xBE, 0xC7, 0xD2, 0xDE, 0xCD, 0xCD, 0xCD,
+        0xEE, 0x6A, 0x50, 0x4C, 0x58, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x2F, 0x38, 0x3C, 0x3E, 0x47, 0x52,
+        0x5E, 0x4E, 0x51, 0x4F, 0xFC, 0xE1, 0xCE, 0xCB, 0xD5, 0xA5, 0x9B, 0x9C, 0x9E, 0xA7, 0xAF, 0xB7,
+        0xBC, 0xBE, 0xC7, 0xD0, 0xDF, 0xD3, 0xD4, 0xD1, 0x77, 0x5E, 0x4E, 0x4D, 0x58, 0x25, 0x1B, 0x1C,
+        0x1D, 0x27, 0x2F, 0x37, 0x3B, 0x3E, 0x48, 0x50, 0x64, 0x53, 0x51, 0x4F, 0x7F, 0xDD, 0xCF, 0xCE,
+        0xDB, 0xA6, 0x9B, 0x9D, 0x9E, 0xA8, 0xAF, 0xB8, 0xBC, 0xBF, 0xCA, 0xD2, 0xE9, 0xD2, 0xD1, 0xD0,
+        0x74, 0x58, 0x4E, 0x4D, 0x59, 0x25, 0x1B, 0x1D, 0x1E, 0x27, 0x2F, 0x37, 0x3B, 0x3E, 0x49, 0x4F,
+        0x62, 0x4F, 0x4F, 0x4F, 0xFE, 0xDA, 0xCE, 0xCC, 0xD6, 0xA5, 0x9B, 0x9D, 0x9D, 0xA7, 0xAF, 0xB7,
+        0xBC, 0xBE, 0xC9, 0xCF, 0xE6, 0xD2, 0xD1, 0xD0, 0xFD, 0x57, 0x4C, 0x49, 0x51, 0x25, 0x1B, 0x1D,
+        0x1D, 0x27, 0x2F, 0x37, 0x3B, 0x3E, 0x49, 0x4F, 0x6B, 0x56, 0x53, 0x52, 0xFE, 0xD5, 0xCA, 0xC8,
+        0xD0, 0xA5, 0x9B, 0x9D, 0x9E, 0xA7, 0xAF, 0xB7, 0xBB, 0xBE, 0xCA, 0xD0, 0xE9, 0xD5, 0xD4, 0xD3,
+        0x71, 0x55, 0x4A, 0x48, 0x50, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x2F, 0x38, 0x3B, 0x3F, 0x4A, 0x52,
+        0x6A, 0x58, 0x57, 0x55, 0xEB, 0xD6, 0xCA, 0xC9, 0xCE, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xB0, 0xB8,
+        0xBB, 0xBF, 0xC8, 0xD0, 0xE6, 0xD7, 0xD5, 0xD4, 0x6D, 0x57, 0x4A, 0x49, 0x4F, 0x25, 0x1B, 0x1D,
+        0x1E, 0x27, 0x2F, 0x37, 0x3A, 0x3E, 0x49, 0x52, 0x6E, 0x57, 0x53, 0x53, 0xEC, 0xD5, 0xCA, 0xC9,
+        0xD3, 0xA5, 0x9B, 0x9D, 0x9E, 0xA8, 0xAF, 0xB7, 0xBA, 0xBE, 0xCB, 0xD7, 0xFD, 0xD7, 0xD4, 0xD3,
+        0x69, 0x55, 0x4A, 0x4A, 0x56, 0x25, 0x1B, 0x1D, 0x1E, 0x28, 0x2F, 0x37, 0x3A, 0x3E, 0x4A, 0x55,
+        0x6E, 0x54, 0x53, 0x52, 0xED, 0xD8, 0xCC, 0xCC, 0xD9, 0xA6, 0x9B, 0x9D, 0x9E, 0xA8, 0xAF, 0xB7,
+        0xBB, 0xBE, 0xCB, 0xD7, 0xF7, 0xDB, 0xD5, 0xD3, 0x71, 0x58, 0x4B, 0x4B, 0x58, 0x26, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2F, 0x37, 0x3B, 0x3D, 0x4B, 0x58, 0x75, 0x5A, 0x50, 0x4E, 0x7B, 0xDB, 0xCD, 0xCD,
+        0xDB, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB6, 0xBA, 0xBD, 0xCB, 0xD9, 0xED, 0xD5, 0xCC, 0xCC,
+        0xF2, 0x5E, 0x4E, 0x4E, 0x5D, 0x27, 0x1C, 0x1E, 0x1E, 0x28, 0x2F, 0x36, 0x3B, 0x3E, 0x4D, 0x5E,
+        0x70, 0x56, 0x4D, 0x4D, 0x79, 0xDF, 0xCF, 0xCF, 0xDD, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB6,
+        0xBB, 0xBE, 0xCD, 0xDD, 0xED, 0xD5, 0xCD, 0xCD, 0xF1, 0x65, 0x50, 0x51, 0x62, 0x27, 0x1C, 0x1D,
+        0x1E, 0x28, 0x2F, 0x36, 0x3A, 0x3E, 0x4C, 0x5F, 0x7C, 0x59, 0x50, 0x4E, 0x78, 0xE3, 0xCF, 0xD0,
+        0xE1, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAF, 0xB5, 0xB9, 0xBD, 0xCB, 0xDE, 0xFC, 0xD8, 0xD1, 0xCF,
+        0xFD, 0x66, 0x50, 0x53, 0x64, 0x27, 0x1C, 0x1D, 0x1E, 0x28, 0x2E, 0x35, 0x39, 0x3D, 0x49, 0x5C,
+        0x72, 0x56, 0x4F, 0x4E, 0x6E, 0xF3, 0xD6, 0xD7, 0xE7, 0xA7, 0x9C, 0x9D, 0x9E, 0xA7, 0xAE, 0xB4,
+        0xB9, 0xBD, 0xC8, 0xD8, 0xED, 0xD4, 0xCF, 0xCE, 0xEA, 0x73, 0x55, 0x56, 0x65, 0x26, 0x1B, 0x1D,
+        0x1D, 0x27, 0x2E, 0x34, 0x39, 0x3C, 0x48, 0x57, 0x6F, 0x53, 0x4E, 0x4E, 0x6D, 0xE8, 0xD2, 0xD2,
+        0xE6, 0xA6, 0x9B, 0x9D, 0x9D, 0xA7, 0xAE, 0xB4, 0xB9, 0xBD, 0xCA, 0xDA, 0xFC, 0xD5, 0xD2, 0xD0,
+        0x7F, 0x61, 0x4F, 0x4F, 0x65, 0x26, 0x1B, 0x1C, 0x1D, 0x26, 0x2D, 0x34, 0x38, 0x3C, 0x49, 0x57,
+        0x70, 0x55, 0x51, 0x4F, 0xFE, 0xE2, 0xCF, 0xCF, 0xE3, 0xA6, 0x9B, 0x9D, 0x9D, 0xA6, 0xAD, 0xB4,
+        0xB8, 0xBC, 0xC8, 0xD6, 0xF2, 0xD8, 0xD1, 0xCE, 0xF2, 0x66, 0x50, 0x4F, 0x64, 0x27, 0x1B, 0x1D,
+        0x1E, 0x27, 0x2D, 0x34, 0x37, 0x3B, 0x48, 0x58, 0x79, 0x59, 0x50, 0x4E, 0x72, 0xE4, 0xCF, 0xD0,
+        0xE4, 0xA7, 0x9B, 0x9D, 0x9E, 0xA6, 0xAD, 0xB2, 0xB6, 0xBB, 0xC9, 0xDB, 0xFA, 0xD7, 0xCF, 0xCE,
+        0xF3, 0x63, 0x50, 0x50, 0x62, 0x26, 0x1B, 0x1D, 0x1E, 0x27, 0x2D, 0x32, 0x37, 0x3B, 0x49, 0x5A,
+        0x7D, 0x58, 0x53, 0x53, 0x7C, 0xE0, 0xD0, 0xD1, 0xE5, 0xA7, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3,
+        0xB8, 0xBB, 0xC8, 0xD9, 0x71, 0xDD, 0xD9, 0xD5, 0xFE, 0x5F, 0x4F, 0x50, 0x67, 0x27, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2D, 0x33, 0x37, 0x3B, 0x47, 0x5A, 0xE7, 0x63, 0x5B, 0x54, 0x79, 0xDF, 0xCE, 0xCF,
+        0xE7, 0xA7, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xBB, 0xC8, 0xDC, 0x64, 0xE4, 0xDB, 0xD6,
+        0x7D, 0x5D, 0x4E, 0x4F, 0x65, 0x27, 0x1C, 0x1D, 0x1E, 0x27, 0x2D, 0x32, 0x37, 0x3B, 0x48, 0x5A,
+        0xE9, 0x62, 0x5B, 0x58, 0xFA, 0xDD, 0xCE, 0xCF, 0xE6, 0xA7, 0x9C, 0x9D, 0x9E, 0xA7, 0xAE, 0xB3,
+        0xB8, 0xBB, 0xC8, 0xD8, 0x69, 0xE2, 0xDB, 0xD9, 0x78, 0x5C, 0x4E, 0x4F, 0x67, 0x27, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2E, 0x34, 0x38, 0x3B, 0x48, 0x58, 0xE8, 0x63, 0x5B, 0x59, 0xF1, 0xDB, 0xCE, 0xCF,
+        0xEC, 0xA7, 0x9C, 0x9D, 0x9E, 0xA8, 0xAE, 0xB4, 0xB7, 0xBB, 0xC7, 0xD7, 0x68, 0xE5, 0xDD, 0xDA,
+        0x6F, 0x5D, 0x51, 0x52, 0x72, 0x28, 0x1C, 0x1D, 0x1E, 0x27, 0x2E, 0x34, 0x38, 0x3B, 0x47, 0x59,
+        0xE4, 0x6C, 0x63, 0x5E, 0xEA, 0xDE, 0xD1, 0xD4, 0xF8, 0xA8, 0x9C, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4,
+        0xB8, 0xBA, 0xC6, 0xD7, 0x68, 0xEA, 0xE2, 0xDC, 0x74, 0x63, 0x54, 0x57, 0xFE, 0x28, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x34, 0x38, 0x3A, 0x45, 0x56, 0xEB, 0x68, 0x5F, 0x5A, 0x7D, 0xE6, 0xD6, 0xD9,
+        0x7D, 0xA8, 0x9C, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4, 0xB8, 0xBA, 0xC5, 0xD6, 0x73, 0xDF, 0xDD, 0xD8,
+        0xF9, 0x63, 0x56, 0x58, 0x79, 0x28, 0x1C, 0x1D, 0x1E, 0x27, 0x2D, 0x34, 0x38, 0x39, 0x44, 0x52,
+        0x77, 0x5B, 0x5A, 0x56, 0x73, 0xE8, 0xDA, 0xDC, 0x77, 0xA8, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xB8, 0xBA, 0xC5, 0xD3, 0xFA, 0xDC, 0xDA, 0xD2, 0xEA, 0x71, 0x5C, 0x5D, 0xF4, 0x28, 0x1C, 0x1D,
+        0x1E, 0x27, 0x2D, 0x33, 0x37, 0x39, 0x44, 0x54, 0x7A, 0x5C, 0x56, 0x4E, 0x61, 0xFE, 0xDC, 0xDC,
+        0x74, 0xA8, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xB9, 0xC5, 0xD4, 0xFB, 0xDC, 0xD5, 0xCF,
+        0xE4, 0x7A, 0x5D, 0x5E, 0xEB, 0x29, 0x1D, 0x1D, 0x1E, 0x26, 0x2D, 0x33, 0x37, 0x39, 0x45, 0x52,
+        0x73, 0x5B, 0x56, 0x50, 0x66, 0xFD, 0xE1, 0xE3, 0x66, 0xA9, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB3,
+        0xB8, 0xB9, 0xC5, 0xD1, 0xF0, 0xDB, 0xD6, 0xCF, 0xE2, 0xF3, 0x6A, 0x69, 0xE1, 0x29, 0x1D, 0x1D,
+        0x1D, 0x26, 0x2D, 0x34, 0x38, 0x3A, 0x46, 0x54, 0x7A, 0x5C, 0x57, 0x4F, 0x63, 0x77, 0xE7, 0xE3,
+        0x63, 0xA9, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xB9, 0xC6, 0xD3, 0xF2, 0xD8, 0xD3, 0xCE,
+        0xE4, 0xF2, 0x6C, 0x69, 0xDD, 0x2A, 0x1D, 0x1D, 0x1E, 0x27, 0x2D, 0x33, 0x37, 0x39, 0x46, 0x54,
+        0x70, 0x57, 0x54, 0x50, 0x6D, 0x7C, 0xE8, 0xE5, 0x5F, 0xA9, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB2,
+        0xB6, 0xB8, 0xC4, 0xD1, 0xED, 0xD5, 0xD3, 0xCF, 0xE8, 0xF0, 0x6A, 0x65, 0xDE, 0x29, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2C, 0x32, 0x36, 0x38, 0x45, 0x55, 0xFE, 0x59, 0x56, 0x50, 0x6B, 0x7E, 0xE1, 0xDE,
+        0x61, 0xA9, 0x9D, 0x9E, 0x9E, 0xA7, 0xAC, 0xB2, 0xB6, 0xB8, 0xC5, 0xD8, 0x6F, 0xDD, 0xD8, 0xD2,
+        0xEF, 0x78, 0x5F, 0x5D, 0xE1, 0x29, 0x1D, 0x1D, 0x1D, 0x27, 0x2C, 0x32, 0x36, 0x38, 0x44, 0x56,
+        0xF8, 0x5C, 0x57, 0x51, 0x6A, 0x74, 0xE8, 0xE2, 0x5E, 0xA9, 0x9D, 0x9E, 0x9D, 0xA6, 0xAC, 0xB2,
+        0xB6, 0xB8, 0xC3, 0xD5, 0x77, 0xDF, 0xD9, 0xD0, 0xE8, 0xEF, 0x63, 0x5D, 0xE8, 0x29, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x37, 0x41, 0x52, 0xFE, 0x62, 0x59, 0x4F, 0x69, 0x72, 0xE0, 0xDC,
+        0x67, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB6, 0xB8, 0xC3, 0xD4, 0x7A, 0xE5, 0xDC, 0xD4,
+        0xFD, 0x79, 0x5E, 0x5B, 0xEB, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x31, 0x36, 0x39, 0x43, 0x52,
+        0x79, 0x5E, 0x5B, 0x55, 0xFB, 0xF9, 0xDF, 0xDB, 0x6C, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB1,
+        0xB6, 0xB9, 0xC5, 0xD4, 0xFB, 0xDC, 0xD9, 0xD3, 0xFD, 0x74, 0x5F, 0x59, 0xEB, 0x28, 0x1C, 0x1E,
+        0x1D, 0x26, 0x2C, 0x31, 0x35, 0x38, 0x45, 0x56, 0xFF, 0x5B, 0x58, 0x51, 0x79, 0xEF, 0xDE, 0xDA,
+        0x6D, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB0, 0xB5, 0xB8, 0xC4, 0xD6, 0xFD, 0xDA, 0xD7, 0xD3,
+        0xFF, 0x6B, 0x5C, 0x5A, 0xF7, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x30, 0x35, 0x39, 0x45, 0x58,
+        0xFD, 0x5B, 0x5A, 0x57, 0xF7, 0xE7, 0xDA, 0xD8, 0xF6, 0xA7, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB0,
+        0xB6, 0xB9, 0xC4, 0xD7, 0xF6, 0xDA, 0xDA, 0xD7, 0x7B, 0x66, 0x59, 0x59, 0x7C, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x38, 0x42, 0x53, 0x6B, 0x57, 0x58, 0x54, 0x7D, 0xE6, 0xD9, 0xDB,
+        0x7C, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB5, 0xB8, 0xC1, 0xD3, 0xEC, 0xD9, 0xD9, 0xD4,
+        0x79, 0x66, 0x5A, 0x5C, 0x7E, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x31, 0x35, 0x38, 0x42, 0x54,
+        0x6C, 0x58, 0x59, 0x54, 0xF5, 0xE7, 0xDA, 0xD9, 0xF5, 0xA7, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1,
+        0xB5, 0xBA, 0xC4, 0xD5, 0xF3, 0xDA, 0xDA, 0xD5, 0x71, 0x67, 0x59, 0x59, 0x7C, 0x27, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2D, 0x32, 0x36, 0x3B, 0x46, 0x58, 0xF7, 0x5D, 0x5C, 0x55, 0xF2, 0xE6, 0xD8, 0xD8,
+        0x7E, 0xA7, 0x9C, 0x9D, 0x9D, 0xA5, 0xAD, 0xB2, 0xB5, 0xBA, 0xC5, 0xD5, 0x76, 0xDB, 0xD8, 0xD1,
+        0xF7, 0x6D, 0x5C, 0x5B, 0xF7, 0x27, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x31, 0x34, 0x39, 0x44, 0x54,
+        0xFB, 0x5A, 0x58, 0x53, 0x7B, 0xE7, 0xD8, 0xD7, 0xF5, 0xA7, 0x9C, 0x9D, 0x9D, 0xA5, 0xAB, 0xAF,
+        0xB3, 0xB8, 0xC2, 0xCF, 0xF1, 0xD9, 0xD7, 0xD2, 0xF3, 0x67, 0x56, 0x56, 0x6D, 0x27, 0x1C, 0x1D,
+        0x1D, 0x24, 0x2C, 0x30, 0x34, 0x38, 0x41, 0x4E, 0x6C, 0x5A, 0x56, 0x51, 0x71, 0xE6, 0xD4, 0xD5,
+        0xEA, 0xA7, 0x9C, 0x9C, 0x9D, 0xA4, 0xAC, 0xAF, 0xB4, 0xB8, 0xC1, 0xCD, 0xE4, 0xD7, 0xD1, 0xCF,
+        0xEF, 0x68, 0x55, 0x55, 0x67, 0x27, 0x1B, 0x1C, 0x1D, 0x24, 0x2B, 0x2F, 0x33, 0x38, 0x40, 0x4C,
+        0x5D, 0x52, 0x4F, 0x4F, 0x77, 0xE9, 0xD6, 0xD7, 0xE9, 0xA7, 0x9B, 0x9C, 0x9C, 0xA3, 0xAB, 0xAF,
+        0xB3, 0xB8, 0xC1, 0xCC, 0xDD, 0xD4, 0xD4, 0xD5, 0x72, 0x60, 0x52, 0x53, 0x63, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2E, 0x33, 0x37, 0x40, 0x4C, 0x5F, 0x55, 0x55, 0x55, 0xF6, 0xE0, 0xD3, 0xD6,
+        0xEB, 0xA7, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF, 0xB4, 0xB8, 0xC2, 0xCF, 0xEA, 0xD9, 0xD8, 0xD8,
+        0x6E, 0x5B, 0x51, 0x53, 0x67, 0x27, 0x1B, 0x1C, 0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x42, 0x4E,
+        0x62, 0x54, 0x53, 0x54, 0xFD, 0xDF, 0xD6, 0xD6, 0xEC, 0xA7, 0x9B, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0,
+        0xB5, 0xB8, 0xC3, 0xCD, 0xDF, 0xD4, 0xD5, 0xD6, 0x78, 0x5E, 0x54, 0x53, 0x67, 0x27, 0x1B, 0x1D,
+        0x1D, 0x24, 0x2C, 0x30, 0x36, 0x38, 0x42, 0x4C, 0x60, 0x57, 0x58, 0x5A, 0xED, 0xDB, 0xD1, 0xD0,
+        0xE4, 0xA7, 0x9B, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB5, 0xB8, 0xC2, 0xCD, 0xE4, 0xD7, 0xD9, 0xDC,
+        0x67, 0x59, 0x52, 0x53, 0x6C, 0x27, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3A, 0x46, 0x50,
+        0x6D, 0x59, 0x5E, 0x62, 0xDE, 0xD5, 0xD1, 0xD2, 0xED, 0xA7, 0x9B, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2,
+        0xB7, 0xBA, 0xC4, 0xCD, 0xE5, 0xD3, 0xD9, 0xDA, 0x69, 0x5A, 0x56, 0x55, 0xFE, 0x27, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2C, 0x33, 0x37, 0x39, 0x44, 0x4D, 0x6A, 0x54, 0x57, 0x56, 0xEF, 0xD9, 0xD3, 0xD3,
+        0xFF, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2, 0xB5, 0xB8, 0xC2, 0xCC, 0xE8, 0xD1, 0xD2, 0xD0,
+        0x7B, 0x59, 0x53, 0x53, 0xFA, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x32, 0x36, 0x39, 0x43, 0x4D,
+        0x69, 0x52, 0x52, 0x51, 0xF5, 0xD9, 0xD3, 0xD3, 0xFE, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB3,
+        0xB7, 0xBA, 0xC4, 0xCD, 0xE6, 0xD1, 0xD2, 0xD0, 0xFA, 0x5F, 0x58, 0x58, 0xF5, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x34, 0x37, 0x3A, 0x44, 0x4D, 0x68, 0x54, 0x52, 0x4F, 0x6F, 0xE8, 0xDB, 0xDB,
+        0x72, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB3, 0xB7, 0xBA, 0xC4, 0xCE, 0xE8, 0xD5, 0xD2, 0xD0,
+        0xF7, 0x67, 0x5B, 0x5B, 0xFB, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x32, 0x36, 0x3A, 0x44, 0x4E,
+        0x63, 0x54, 0x52, 0x52, 0xFE, 0xE9, 0xDD, 0xDD, 0x73, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB3,
+        0xB7, 0xBA, 0xC5, 0xCF, 0xE6, 0xD7, 0xD6, 0xD5, 0x75, 0x66, 0x5B, 0x5B, 0xF3, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x36, 0x39, 0x43, 0x4D, 0x61, 0x53, 0x50, 0x4F, 0x6F, 0xEF, 0xDE, 0xDF,
+        0x67, 0xA9, 0x9C, 0x9D, 0x9E, 0xA6, 0xAC, 0xB1, 0xB6, 0xB9, 0xC4, 0xD0, 0xE6, 0xD3, 0xD0, 0xCF,
+        0xF1, 0x6A, 0x5D, 0x5F, 0xEC, 0x29, 0x1C, 0x1D, 0x1D, 0x25, 0x2B, 0x30, 0x35, 0x39, 0x44, 0x4F,
+        0x64, 0x51, 0x4F, 0x4E, 0x6B, 0xF2, 0xE3, 0xE3, 0x6C, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAB, 0xB0,
+        0xB5, 0xB9, 0xC3, 0xCE, 0xE5, 0xD3, 0xD1, 0xCE, 0xE6, 0x7B, 0x62, 0x5D, 0xFA, 0x28, 0x1C, 0x1D,
+        0x1D, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x41, 0x4D, 0x69, 0x54, 0x53, 0x4E, 0x69, 0xEF, 0xDA, 0xD7,
+        0xED, 0xA7, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF, 0xB3, 0xB7, 0xC0, 0xCD, 0xE8, 0xD2, 0xCF, 0xCD,
+        0xE6, 0x6F, 0x5A, 0x57, 0x6E, 0x27, 0x1B, 0x1C, 0x1D, 0x25, 0x2B, 0x2F, 0x34, 0x39, 0x43, 0x4F,
+        0x6F, 0x54, 0x51, 0x4E, 0x6A, 0xEC, 0xD9, 0xD3, 0xE9, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF,
+        0xB3, 0xB9, 0xC3, 0xCD, 0xED, 0xD3, 0xD0, 0xCD, 0xE4, 0x76, 0x5C, 0x54, 0x71, 0x27, 0x1B, 0x1C,
+        0x1C, 0x24, 0x2A, 0x2F, 0x34, 0x39, 0x44, 0x4E, 0x74, 0x54, 0x51, 0x4D, 0x67, 0xF2, 0xDA, 0xD5,
+        0xFA, 0xA7, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF, 0xB4, 0xB9, 0xC4, 0xCE, 0xED, 0xD3, 0xCF, 0xCC,
+        0xE7, 0x76, 0x5B, 0x58, 0x7A, 0x27, 0x1B, 0x1C, 0x1C, 0x24, 0x2A, 0x2F, 0x35, 0x3A, 0x45, 0x50,
+        0x72, 0x56, 0x50, 0x4E, 0x67, 0x7A, 0xDF, 0xDC, 0xFB, 0xA7, 0x9B, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF,
+        0xB6, 0xBA, 0xC5, 0xD0, 0xF4, 0xD9, 0xD2, 0xCE, 0xE2, 0xF1, 0x61, 0x5D, 0x7B, 0x27, 0x1C, 0x1C,
+        0x1D, 0x25, 0x2B, 0x2F, 0x35, 0x3A, 0x44, 0x50, 0x72, 0x57, 0x50, 0x4C, 0x5D, 0x6E, 0xE0, 0xDC,
+        0x7E, 0xA7, 0x9C, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF, 0xB5, 0xBA, 0xC5, 0xD3, 0xF9, 0xD7, 0xD2, 0xCC,
+        0xE0, 0xF7, 0x5E, 0x5B, 0x75, 0x27, 0x1B, 0x1C, 0x1D, 0x25, 0x2B, 0x2F, 0x35, 0x3A, 0x45, 0x54,
+        0x6E, 0x55, 0x4F, 0x4C, 0x5E, 0x6D, 0xE4, 0xE0, 0xFE, 0xA7, 0x9C, 0x9C, 0x9D, 0xA5, 0xAC, 0xAF,
+        0xB5, 0xBA, 0xC7, 0xD5, 0xEC, 0xD5, 0xCE, 0xCB, 0xDC, 0xEB, 0x64, 0x60, 0xFD, 0x28, 0x1C, 0x1C,
+        0x1D, 0x25, 0x2B, 0x2F, 0x35, 0x3A, 0x47, 0x54, 0x6D, 0x54, 0x4D, 0x4A, 0x59, 0x6B, 0xE5, 0xE2,
+        0x6F, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0, 0xB5, 0xBA, 0xC8, 0xD5, 0xEE, 0xD3, 0xCD, 0xCA,
+        0xD9, 0xE8, 0x68, 0x6A, 0xE8, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x30, 0x35, 0x3A, 0x46, 0x53,
+        0x69, 0x51, 0x4D, 0x4A, 0x57, 0x60, 0xEE, 0xF3, 0x66, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0,
+        0xB5, 0xBA, 0xC5, 0xD1, 0xE6, 0xD2, 0xCE, 0xCA, 0xD4, 0xDE, 0x6E, 0x72, 0xE8, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2B, 0x30, 0x35, 0x3A, 0x45, 0x51, 0x66, 0x51, 0x4E, 0x4A, 0x55, 0x65, 0xE6, 0xEA,
+        0x6B, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF, 0xB5, 0xB9, 0xC5, 0xD2, 0xE3, 0xCF, 0xCC, 0xC9,
+        0xD7, 0xE9, 0x64, 0x6A, 0xED, 0x28, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x2F, 0x35, 0x3A, 0x47, 0x56,
+        0x69, 0x51, 0x4E, 0x4C, 0x5C, 0x6C, 0xE4, 0xE8, 0x72, 0xA8, 0x9C, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF,
+        0xB6, 0xBB, 0xC7, 0xD4, 0xEA, 0xD2, 0xCE, 0xCD, 0xDD, 0xEA, 0x67, 0x69, 0xEA, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2B, 0x30, 0x36, 0x3A, 0x47, 0x53, 0x6D, 0x50, 0x4E, 0x4D, 0x5F, 0x6F, 0xE1, 0xE3,
+        0x67, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0, 0xB6, 0xBA, 0xC7, 0xD6, 0xF3, 0xD1, 0xCD, 0xCC,
+        0xDF, 0xEF, 0x64, 0x67, 0xE3, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2B, 0x30, 0x36, 0x3A, 0x47, 0x54,
+        0x6E, 0x51, 0x4D, 0x4C, 0x5C, 0x69, 0xEF, 0xEF, 0x60, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAB, 0xB0,
+        0xB7, 0xBA, 0xC7, 0xD2, 0xEC, 0xD1, 0xCE, 0xCB, 0xD9, 0xE4, 0x79, 0x6C, 0xE2, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2B, 0x2F, 0x36, 0x39, 0x45, 0x51, 0x6B, 0x51, 0x4D, 0x4A, 0x58, 0x63, 0xEF, 0xE5,
+        0x69, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAB, 0xAF, 0xB4, 0xB8, 0xC4, 0xD3, 0xE9, 0xD2, 0xCD, 0xCB,
+        0xDC, 0xE5, 0x6C, 0x65, 0xED, 0x28, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x2F, 0x35, 0x39, 0x44, 0x55,
+        0x6C, 0x54, 0x4F, 0x4D, 0x5F, 0x67, 0xEC, 0xE4, 0x6F, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF,
+        0xB5, 0xBA, 0xC5, 0xD5, 0xEE, 0xD5, 0xD0, 0xCD, 0xDF, 0xE4, 0x6B, 0x5F, 0xF0, 0x28, 0x1C, 0x1D,
+        0x1D, 0x24, 0x2B, 0x2F, 0x35, 0x39, 0x43, 0x54, 0x6A, 0x52, 0x4F, 0x4C, 0x5D, 0x64, 0xE7, 0xDE,
+        0x74, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF, 0xB4, 0xB9, 0xC3, 0xD4, 0xE5, 0xCF, 0xCE, 0xCC,
+        0xDE, 0xEB, 0x66, 0x5D, 0xF9, 0x27, 0x1C, 0x1D, 0x1D, 0x25, 0x2B, 0x2F, 0x34, 0x38, 0x43, 0x4F,
+        0x5E, 0x4C, 0x4C, 0x4B, 0x5C, 0x68, 0xEF, 0xDF, 0x76, 0xA7, 0x9B, 0x9C, 0x9D, 0xA5, 0xAB, 0xAF,
+        0xB4, 0xB8, 0xC1, 0xCD, 0xDB, 0xCB, 0xCD, 0xCA, 0xDB, 0xE3, 0x71, 0x5F, 0xFA, 0x27, 0x1B, 0x1C,
+        0x1C, 0x24, 0x2A, 0x2F, 0x33, 0x37, 0x3F, 0x4C, 0x58, 0x4B, 0x4B, 0x48, 0x57, 0x5E, 0xF1, 0xE3,
+        0x78, 0xA7, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAE, 0xB3, 0xB7, 0xBF, 0xCD, 0xDB, 0xCC, 0xCB, 0xC9,
+        0xD8, 0xE3, 0x6D, 0x61, 0x7C, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2A, 0x2E, 0x33, 0x37, 0x40, 0x4C,
+        0x5D, 0x4C, 0x4C, 0x4B, 0x5A, 0x64, 0xF4, 0xE2, 0x7F, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB3, 0xB7, 0xBF, 0xCC, 0xE1, 0xCD, 0xCE, 0xCB, 0xDD, 0xE4, 0x6D, 0x5F, 0x7B, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x37, 0x3F, 0x4F, 0x69, 0x4F, 0x4E, 0x4B, 0x5D, 0x67, 0xE4, 0xDD,
+        0xF4, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB3, 0xB7, 0xC0, 0xD1, 0xEB, 0xCF, 0xCE, 0xCC,
+        0xDF, 0xF0, 0x5F, 0x5C, 0x72, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x38, 0x42, 0x50,
+        0x69, 0x4F, 0x4E, 0x4D, 0x67, 0x7D, 0xDF, 0xDB, 0xF9, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB4, 0xB8, 0xC0, 0xCD, 0xE0, 0xCE, 0xCE, 0xCD, 0xE4, 0xF0, 0x64, 0x5B, 0xFD, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x38, 0x3F, 0x4D, 0x5F, 0x4E, 0x4E, 0x4B, 0x5D, 0x65, 0xE9, 0xDD,
+        0x7D, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB3, 0xB7, 0xBF, 0xCC, 0xDC, 0xCD, 0xCC, 0xC9,
+        0xD9, 0xDE, 0x76, 0x64, 0xFA, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x38, 0x3F, 0x4C,
+        0x5B, 0x4C, 0x4C, 0x4A, 0x59, 0x60, 0xF6, 0xE1, 0xF4, 0xA6, 0x9B, 0x9C, 0x9C, 0xA2, 0xAA, 0xAE,
+        0xB4, 0xB7, 0xBF, 0xCC, 0xDB, 0xCD, 0xCD, 0xCA, 0xD9, 0xE0, 0x74, 0x5F, 0x6F, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2E, 0x33, 0x37, 0x40, 0x4E, 0x5E, 0x4E, 0x4D, 0x4B, 0x5B, 0x69, 0xE7, 0xDB,
+        0xEA, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAE, 0xB3, 0xB8, 0xC2, 0xD3, 0xE5, 0xCE, 0xCD, 0xCB,
+        0xDE, 0xEF, 0x5F, 0x58, 0x65, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2A, 0x2E, 0x33, 0x38, 0x42, 0x51,
+        0x60, 0x4D, 0x4C, 0x4C, 0x62, 0x79, 0xDC, 0xD6, 0xE7, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF,
+        0xB4, 0xB8, 0xC2, 0xD1, 0xE3, 0xCF, 0xCE, 0xCC, 0xE4, 0x7D, 0x59, 0x52, 0x61, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x37, 0x41, 0x4F, 0x65, 0x4F, 0x4E, 0x4C, 0x60, 0x7D, 0xDB, 0xD1,
+        0xE2, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB4, 0xB8, 0xC4, 0xD3, 0xF4, 0xD1, 0xCF, 0xCD,
+        0xE4, 0x75, 0x5A, 0x4F, 0x5E, 0x25, 0x1A, 0x1C, 0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x37, 0x44, 0x54,
+        0x79, 0x53, 0x4F, 0x4E, 0x69, 0xEE, 0xD9, 0xCF, 0xDD, 0xA5, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB4, 0xB8, 0xC5, 0xD5, 0xFE, 0xD6, 0xD0, 0xCF, 0xEE, 0x68, 0x55, 0x4F, 0x5C, 0x26, 0x1B, 0x1C,
+        0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x45, 0x56, 0xFC, 0x59, 0x51, 0x50, 0x6F, 0xE6, 0xD2, 0xCF,
+        0xDB, 0xA5, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF, 0xB4, 0xB8, 0xC4, 0xD5, 0xF8, 0xD8, 0xD0, 0xD0,
+        0xEF, 0x66, 0x54, 0x51, 0x5D, 0x26, 0x1B, 0x1C, 0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x44, 0x54,
+        0x74, 0x58, 0x52, 0x51, 0x79, 0xE5, 0xD5, 0xD2, 0xDC, 0xA5, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF,
+        0xB3, 0xB7, 0xC2, 0xCF, 0xE9, 0xD5, 0xD2, 0xD0, 0xFC, 0x65, 0x54, 0x52, 0x5D, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x37, 0x41, 0x4F, 0x66, 0x54, 0x4F, 0x4E, 0x75, 0xE8, 0xD4, 0xD2,
+        0xDD, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAB, 0xAF, 0xB3, 0xB7, 0xC0, 0xCF, 0xE4, 0xD3, 0xCF, 0xCE,
+        0xF4, 0x6A, 0x55, 0x54, 0x5D, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2B, 0x2F, 0x33, 0x37, 0x40, 0x4F,
+        0x64, 0x53, 0x4F, 0x4E, 0x70, 0xEE, 0xD7, 0xD4, 0xDD, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB3, 0xB7, 0xC0, 0xCF, 0xE9, 0xD5, 0xD0, 0xCE, 0xE9, 0x77, 0x5A, 0x56, 0x61, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2B, 0x2F, 0x33, 0x38, 0x41, 0x50, 0x6D, 0x53, 0x4E, 0x4B, 0x60, 0x7D, 0xDD, 0xDA,
+        0xE9, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF, 0xB3, 0xB7, 0xC1, 0xCF, 0xE8, 0xCF, 0xCC, 0xCA,
+        0xDF, 0xF5, 0x61, 0x5D, 0x6C, 0x26, 0x1B, 0x1C, 0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x41, 0x4F,
+        0x64, 0x50, 0x4E, 0x4C, 0x61, 0x72, 0xE3, 0xDF, 0xEB, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xB0,
+        0xB5, 0xB8, 0xC1, 0xCF, 0xE6, 0xD5, 0xCF, 0xCD, 0xDE, 0xEC, 0x66, 0x63, 0x73, 0x27, 0x1B, 0x1C,
+        0x1D, 0x25, 0x2C, 0x30, 0x35, 0x38, 0x42, 0x51, 0x6B, 0x57, 0x4F, 0x4C, 0x5C, 0x6A, 0xE8, 0xE8,
+        0x7D, 0xA7, 0x9B, 0x9C, 0x9D, 0xA5, 0xAC, 0xB1, 0xB6, 0xB9, 0xC4, 0xD5, 0xED, 0xD4, 0xCE, 0xCC,
+        0xDF, 0xED, 0x68, 0x67, 0xFE, 0x27, 0x1B, 0x1C, 0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3A, 0x45, 0x54,
+        0x69, 0x51, 0x4E, 0x4C, 0x65, 0x6F, 0xE5, 0xE2, 0xF8, 0xA6, 0x9B, 0x9C, 0x9D, 0xA5, 0xAC, 0xB1,
+        0xB6, 0xBA, 0xC4, 0xD3, 0xEC, 0xD3, 0xCF, 0xCD, 0xE3, 0xEE, 0x60, 0x5E, 0x6F, 0x26, 0x1B, 0x1C,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x39, 0x43, 0x52, 0x6F, 0x53, 0x4E, 0x4C, 0x5C, 0x6A, 0xE1, 0xDE,
+        0xF2, 0xA6, 0x9B, 0x9C, 0x9D, 0xA5, 0xAC, 0xB1, 0xB5, 0xBA, 0xC4, 0xD0, 0xEA, 0xD0, 0xCD, 0xCB,
+        0xDA, 0xE6, 0x63, 0x5F, 0x71, 0x26, 0x1B, 0x1C, 0x1D, 0x24, 0x2B, 0x30, 0x36, 0x3A, 0x43, 0x4F,
+        0x64, 0x4F, 0x4D, 0x4B, 0x5A, 0x63, 0xE4, 0xE4, 0xF9, 0xA6, 0x9B, 0x9C, 0x9D, 0xA4, 0xAB, 0xB1,
+        0xB7, 0xBB, 0xC3, 0xD1, 0xE4, 0xD0, 0xCD, 0xC9, 0xDA, 0xDF, 0x65, 0x6B, 0xF8, 0x27, 0x1B, 0x1C,
+        0x1D, 0x24, 0x2B, 0x31, 0x36, 0x3B, 0x43, 0x53, 0x64, 0x50, 0x4C, 0x48, 0x59, 0x5E, 0xE9, 0xEE,
+        0x72, 0xA7, 0x9B, 0x9C, 0x9D, 0xA4, 0xAB, 0xB1, 0xB6, 0xBB, 0xC4, 0xD3, 0xE2, 0xD0, 0xCC, 0xC9,
+        0xDA, 0xDF, 0x6E, 0x6C, 0xF5, 0x26, 0x1B, 0x1C, 0x1C, 0x24, 0x2B, 0x30, 0x36, 0x3B, 0x44, 0x4F,
+        0x5D, 0x4E, 0x4C, 0x48, 0x59, 0x5D, 0xF6, 0xEB, 0x75, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xB0,
+        0xB6, 0xBA, 0xC4, 0xCF, 0xDF, 0xCF, 0xCC, 0xC8, 0xD8, 0xDE, 0x74, 0x69, 0xF6, 0x26, 0x1B, 0x1C,
+        0x1C, 0x24, 0x2B, 0x30, 0x35, 0x3A, 0x44, 0x51, 0x63, 0x4F, 0x4A, 0x46, 0x58, 0x5F, 0xED, 0xE6,
+        0x76, 0xA6, 0x9B, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF, 0xB4, 0xBA, 0xC3, 0xD2, 0xE4, 0xCD, 0xCA, 0xC6,
+        0xD9, 0xE2, 0x69, 0x61, 0xFB, 0x26, 0x1B, 0x1C, 0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x3A, 0x43, 0x53,
+        0x63, 0x4D, 0x4B, 0x47, 0x5D, 0x67, 0xE3, 0xDD, 0xF4, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB3, 0xB9, 0xC2, 0xCF, 0xE0, 0xCD, 0xCB, 0xC8, 0xDB, 0xE6, 0x66, 0x5E, 0x7B, 0x26, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x39, 0x43, 0x4E, 0x63, 0x4E, 0x4B, 0x48, 0x5A, 0x6A, 0xE9, 0xDE,
+        0x7E, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB3, 0xB8, 0xC3, 0xCD, 0xE1, 0xCD, 0xCA, 0xC7,
+        0xD9, 0xE7, 0x75, 0x64, 0xEF, 0x26, 0x1B, 0x1C, 0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x38, 0x43, 0x4C,
+        0x5D, 0x4B, 0x49, 0x47, 0x5A, 0x66, 0xFB, 0xEA, 0x6C, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAE,
+        0xB2, 0xB7, 0xC2, 0xCC, 0xDA, 0xCB, 0xC8, 0xC6, 0xD8, 0xE1, 0xFD, 0x70, 0xE7, 0x27, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2E, 0x32, 0x37, 0x41, 0x4C, 0x5B, 0x4C, 0x48, 0x44, 0x56, 0x61, 0xFC, 0xEF,
+        0x65, 0xA7, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF, 0xB2, 0xB7, 0xC1, 0xCD, 0xDC, 0xCC, 0xC8, 0xC4,
+        0xD6, 0xE2, 0x7A, 0x6E, 0xE6, 0x27, 0x1B, 0x1C, 0x1C, 0x24, 0x2A, 0x2F, 0x33, 0x37, 0x41, 0x4D,
+        0x5A, 0x4A, 0x47, 0x43, 0x53, 0x5E, 0x78, 0xF2, 0x67, 0xA7, 0x9B, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF,
+        0xB4, 0xB8, 0xC2, 0xCE, 0xDB, 0xCB, 0xC8, 0xC4, 0xD1, 0xDE, 0xFB, 0x6C, 0xEE, 0x27, 0x1B, 0x1B,
+        0x1B, 0x23, 0x2A, 0x2E, 0x32, 0x36, 0x40, 0x4C, 0x5B, 0x4B, 0x48, 0x43, 0x4E, 0x5B, 0x75, 0xEE,
+        0x6C, 0xA7, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAF, 0xB3, 0xB7, 0xC1, 0xCE, 0xDF, 0xCC, 0xCA, 0xC4,
+        0xD1, 0xDE, 0x76, 0x66, 0xFE, 0x26, 0x1B, 0x1B, 0x1B, 0x23, 0x2A, 0x2E, 0x32, 0x37, 0x42, 0x4F,
+        0x60, 0x4D, 0x4A, 0x46, 0x54, 0x60, 0xF5, 0xE7, 0x7E, 0xA6, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB3, 0xB8, 0xC3, 0xD0, 0xE7, 0xCF, 0xCB, 0xC7, 0xD6, 0xE3, 0x72, 0x64, 0xFC, 0x26, 0x1B, 0x1B,
+        0x1B, 0x23, 0x2A, 0x2F, 0x34, 0x38, 0x44, 0x52, 0x6C, 0x50, 0x4B, 0x47, 0x57, 0x67, 0xEC, 0xDF,
+        0x7A, 0xA7, 0x9B, 0x9B, 0x9B, 0xA3, 0xAA, 0xAF, 0xB4, 0xB8, 0xC3, 0xD3, 0xEA, 0xCF, 0xCB, 0xC8,
+        0xD8, 0xE5, 0x6D, 0x5F, 0x7F, 0x27, 0x1B, 0x1B, 0x1C, 0x23, 0x2B, 0x2F, 0x35, 0x39, 0x45, 0x55,
+        0x65, 0x4F, 0x4C, 0x49, 0x59, 0x66, 0xED, 0xDF, 0xF4, 0xA7, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAE,
+        0xB4, 0xB8, 0xC3, 0xD1, 0xDF, 0xCE, 0xCB, 0xC8, 0xD3, 0xE1, 0x7A, 0x67, 0xFC, 0x27, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x34, 0x37, 0x44, 0x54, 0x6D, 0x50, 0x4D, 0x48, 0x54, 0x68, 0xF4, 0xE5,
+        0x78, 0xA7, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAE, 0xB2, 0xB6, 0xC2, 0xD0, 0xEA, 0xCD, 0xCA, 0xC6,
+        0xD4, 0xE8, 0x78, 0x66, 0xF2, 0x27, 0x1B, 0x1B, 0x1C, 0x23, 0x2A, 0x2F, 0x32, 0x37, 0x44, 0x53,
+        0x6F, 0x4E, 0x4C, 0x49, 0x57, 0x6A, 0xF4, 0xE1, 0xF9, 0xA7, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB3, 0xB8, 0xC5, 0xD1, 0xF0, 0xD1, 0xCE, 0xCB, 0xD8, 0xE9, 0x74, 0x5F, 0x71, 0x27, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x38, 0x45, 0x51, 0x7A, 0x53, 0x4F, 0x4A, 0x56, 0x67, 0xF5, 0xDC,
+        0xED, 0xA6, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB3, 0xB8, 0xC6, 0xD4, 0x7B, 0xD4, 0xCF, 0xCA,
+        0xD9, 0xED, 0x6E, 0x5A, 0x6B, 0x26, 0x1B, 0x1B, 0x1C, 0x23, 0x2A, 0x2E, 0x32, 0x38, 0x45, 0x52,
+        0x72, 0x50, 0x4E, 0x49, 0x5A, 0x69, 0xF6, 0xDD, 0xEF, 0xA6, 0x9B, 0x9B, 0x9C, 0xA3, 0xA9, 0xAF,
+        0xB2, 0xB8, 0xC5, 0xD2, 0xF4, 0xD2, 0xCF, 0xCA, 0xDA, 0xE7, 0x75, 0x5C, 0x6C, 0x26, 0x1A, 0x1B,
+        0x1B, 0x22, 0x29, 0x2E, 0x31, 0x37, 0x41, 0x4E, 0x6F, 0x51, 0x4E, 0x48, 0x56, 0x60, 0xFA, 0xDE,
+        0xEF, 0xA6, 0x9A, 0x9B, 0x9B, 0xA2, 0xA9, 0xAE, 0xB1, 0xB7, 0xC2, 0xD0, 0xFB, 0xD1, 0xCD, 0xC9,
+        0xD9, 0xE7, 0x6F, 0x5D, 0x73, 0x26, 0x1B, 0x1B, 0x1B, 0x22, 0x29, 0x2E, 0x31, 0x38, 0x42, 0x4E,
+        0x6D, 0x4D, 0x4B, 0x48, 0x58, 0x65, 0xF8, 0xE1, 0x7F, 0xA6, 0x9B, 0x9B, 0x9B, 0xA2, 0xA9, 0xAE,
+        0xB2, 0xB8, 0xC3, 0xCE, 0xEF, 0xCF, 0xCE, 0xCA, 0xD7, 0xE3, 0x7C, 0x61, 0x7B, 0x26, 0x1B, 0x1B,
+        0x1B, 0x22, 0x29, 0x2E, 0x32, 0x38, 0x43, 0x4F, 0x7B, 0x52, 0x4E, 0x4A, 0x58, 0x69, 0xF0, 0xDF,
+        0xFA, 0xA7, 0x9B, 0x9B, 0x9B, 0xA2, 0xA9, 0xAE, 0xB2, 0xB8, 0xC5, 0xD2, 0xFD, 0xD0, 0xCD, 0xC9,
+        0xD9, 0xEF, 0x6C, 0x5F, 0x7D, 0x26, 0x1B, 0x1B, 0x1B, 0x23, 0x2A, 0x2E, 0x32, 0x39, 0x45, 0x52,
+        0x70, 0x4E, 0x4C, 0x4A, 0x5B, 0x6F, 0xEC, 0xE4, 0x79, 0xA7, 0x9B, 0x9B, 0x9C, 0xA3, 0xAA, 0xAE,
+        0xB2, 0xB8, 0xC3, 0xCF, 0xEA, 0xCE, 0xCC, 0xCA, 0xD7, 0xE3, 0x7A, 0x6B, 0xEE, 0x27, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2E, 0x33, 0x38, 0x42, 0x4E, 0x6B, 0x4E, 0x4C, 0x48, 0x53, 0x60, 0xF8, 0xE7,
+        0x72, 0xA7, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAE, 0xB2, 0xB7, 0xC2, 0xCE, 0xEB, 0xCE, 0xCB, 0xC8,
+        0xD3, 0xE1, 0x7C, 0x68, 0xEE, 0x27, 0x1B, 0x1C, 0x1C, 0x24, 0x2A, 0x2E, 0x33, 0x39, 0x45, 0x51,
+        0x70, 0x50, 0x4D, 0x49, 0x57, 0x60, 0x79, 0xEE, 0x6A, 0xA7, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAE,
+        0xB4, 0xB9, 0xC5, 0xCF, 0xE8, 0xCF, 0xCC, 0xC8, 0xD5, 0xDE, 0xFD, 0x6E, 0xE8, 0x28, 0x1C, 0x1C,
+        0x1C, 0x24, 0x2A, 0x2F, 0x34, 0x3A, 0x46, 0x53, 0x6B, 0x52, 0x4C, 0x48, 0x54, 0x5E, 0xF8, 0xEC,
+        0x6A, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAE, 0xB4, 0xB9, 0xC6, 0xD2, 0xE8, 0xCF, 0xCB, 0xC8,
+        0xD4, 0xDD, 0x7D, 0x6F, 0xE7, 0x28, 0x1C, 0x1C, 0x1C, 0x24, 0x2B, 0x2F, 0x34, 0x39, 0x45, 0x51,
+        0x66, 0x4F, 0x4A, 0x48, 0x52, 0x59, 0x70, 0xFA, 0x62, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAB, 0xAF,
+        0xB4, 0xB9, 0xC4, 0xCF, 0xE5, 0xCE, 0xC9, 0xC6, 0xCF, 0xD5, 0xEF, 0x74, 0xE4, 0x28, 0x1C, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x38, 0x41, 0x4D, 0x5F, 0x4D, 0x47, 0x43, 0x4C, 0x53, 0x6E, 0xFA,
+        0x60, 0xA9, 0x9C, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF, 0xB4, 0xB8, 0xC3, 0xCF, 0xE4, 0xCF, 0xC9, 0xC5,
+        0xCF, 0xD7, 0xF7, 0x76, 0xE8, 0x28, 0x1C, 0x1C, 0x1C, 0x23, 0x2A, 0x2E, 0x34, 0x38, 0x43, 0x4F,
+        0x61, 0x4E, 0x49, 0x47, 0x51, 0x58, 0x71, 0xF8, 0x69, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF,
+        0xB4, 0xB9, 0xC5, 0xD1, 0xEC, 0xD3, 0xCD, 0xC9, 0xD4, 0xDA, 0xF5, 0x71, 0xE9, 0x28, 0x1C, 0x1C,
+        0x1C, 0x24, 0x2A, 0x2F, 0x34, 0x39, 0x43, 0x50, 0x6D, 0x53, 0x4C, 0x48, 0x53, 0x5B, 0xFC, 0xEC,
+        0x6B, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF, 0xB4, 0xB9, 0xC5, 0xD2, 0xED, 0xD2, 0xCA, 0xC7,
+        0xD3, 0xDC, 0x76, 0x6A, 0xED, 0x28, 0x1C, 0x1C, 0x1C, 0x24, 0x2A, 0x2F, 0x34, 0x39, 0x46, 0x52,
+        0x6C, 0x52, 0x4A, 0x48, 0x53, 0x5B, 0xF8, 0xE8, 0x79, 0xA7, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAF,
+        0xB4, 0xB9, 0xC4, 0xCF, 0xE4, 0xD0, 0xCB, 0xC8, 0xD3, 0xD9, 0xFE, 0x6C, 0xEF, 0x28, 0x1C, 0x1C,
+        0x1D, 0x24, 0x2A, 0x2F, 0x34, 0x39, 0x45, 0x50, 0x69, 0x50, 0x4A, 0x48, 0x53, 0x5A, 0xFA, 0xEB,
+        0x6F, 0xA8, 0x9C, 0x9C, 0x9D, 0xA4, 0xAA, 0xAF, 0xB3, 0xB9, 0xC4, 0xD1, 0xE9, 0xCE, 0xC8, 0xC6,
+        0xD0, 0xD9, 0x7C, 0x6C, 0xF0, 0x27, 0x1C, 0x1C, 0x1D, 0x24, 0x2A, 0x2E, 0x33, 0x38, 0x43, 0x4F,
+        0x64, 0x4D, 0x49, 0x47, 0x53, 0x5C, 0x7F, 0xEE, 0x6D, 0xA7, 0x9B, 0x9C, 0x9C, 0xA3, 0xAA, 0xAE,
+        0xB3, 0xB8, 0xC2, 0xCE, 0xE2, 0xCD, 0xC9, 0xC7, 0xD2, 0xDB, 0xF9, 0x72, 0xEA, 0x28, 0x1B, 0x1C,
+        0x1C, 0x23, 0x2A, 0x2F, 0x33, 0x37, 0x40, 0x4D, 0x60, 0x4D, 0x4A, 0x48, 0x51, 0x59, 0x76, 0xF4,
+        0x69, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAA, 0xAF, 0xB2, 0xB7, 0xC0, 0xCD, 0xDF, 0xCD, 0xCA, 0xC9,
+        0xD1, 0xD9, 0xF8, 0x75, 0xE9, 0x28, 0x1C, 0x1C, 0x1D, 0x24, 0x2B, 0x2F, 0x33, 0x38, 0x41, 0x4E,
+        0x5F, 0x4D, 0x4C, 0x49, 0x53, 0x59, 0x7A, 0xFE, 0x67, 0xA8, 0x9C, 0x9C, 0x9D, 0xA4, 0xAB, 0xAF,
+        0xB3, 0xB8, 0xC1, 0xCE, 0xDF, 0xCE, 0xCC, 0xC9, 0xD1, 0xD5, 0xEE, 0xEF, 0xE3, 0x28, 0x1C, 0x1C,
+        0x1C, 0x23, 0x2B, 0x2F, 0x34, 0x38, 0x41, 0x4F, 0x63, 0x4F, 0x4C, 0x49, 0x51, 0x57, 0x6C, 0x72,
+        0x64, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF, 0xB4, 0xB8, 0xC2, 0xCF, 0xE6, 0xCE, 0xCB, 0xC8,
+        0xD3, 0xD8, 0xEA, 0xF2, 0xE0, 0x28, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x2F, 0x34, 0x39, 0x42, 0x4F,
+        0x65, 0x4D, 0x4A, 0x48, 0x53, 0x58, 0x68, 0x73, 0x5E, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xB0,
+        0xB5, 0xB9, 0xC2, 0xCE, 0xE3, 0xCE, 0xCB, 0xC8, 0xD1, 0xD6, 0xE6, 0xF1, 0xDE, 0x29, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x30, 0x35, 0x39, 0x42, 0x4F, 0x68, 0x50, 0x4D, 0x48, 0x50, 0x56, 0x67, 0x70,
+        0x5F, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0, 0xB5, 0xB9, 0xC4, 0xD4, 0xED, 0xD2, 0xCE, 0xC9,
+        0xD2, 0xD8, 0xEB, 0xF2, 0xE0, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2B, 0x2F, 0x34, 0x39, 0x44, 0x55,
+        0x6B, 0x53, 0x4E, 0x48, 0x52, 0x58, 0x68, 0x6E, 0x5F, 0xA9, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF,
+        0xB5, 0xB9, 0xC5, 0xD7, 0xF3, 0xD7, 0xCF, 0xCA, 0xD5, 0xDB, 0xED, 0xFA, 0xE5, 0x28, 0x1C, 0x1D,
+        0x1D, 0x24, 0x2B, 0x2F, 0x34, 0x38, 0x43, 0x53, 0x6F, 0x55, 0x4E, 0x48, 0x54, 0x5A, 0x6A, 0x7B,
+        0x62, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF, 0xB3, 0xB8, 0xC3, 0xD3, 0xF0, 0xD2, 0xCC, 0xC8,
+        0xD6, 0xDD, 0xEF, 0x79, 0xE5, 0x28, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x2F, 0x33, 0x38, 0x44, 0x53,
+        0x6C, 0x4F, 0x4C, 0x48, 0x55, 0x5D, 0x70, 0xF8, 0x61, 0xA8, 0x9C, 0x9D, 0x9C, 0xA4, 0xAB, 0xAF,
+        0xB3, 0xB9, 0xC3, 0xD2, 0xE8, 0xCF, 0xCD, 0xC8, 0xD3, 0xDB, 0xEE, 0xFD, 0xE0, 0x29, 0x1C, 0x1C,
+        0x1C, 0x24, 0x2B, 0x30, 0x34, 0x39, 0x44, 0x57, 0x6F, 0x54, 0x4F, 0x49, 0x53, 0x5D, 0x6F, 0x79,
+        0x62, 0xA9, 0x9C, 0x9C, 0x9D, 0xA4, 0xAB, 0xAF, 0xB5, 0xB9, 0xC5, 0xD8, 0xF1, 0xD2, 0xCE, 0xC8,
+        0xD4, 0xDF, 0xEB, 0xF5, 0xDF, 0x29, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x30, 0x35, 0x3A, 0x46, 0x55,
+        0x6B, 0x4E, 0x4D, 0x47, 0x54, 0x5E, 0x67, 0x78, 0x5F, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAB, 0xB0,
+        0xB5, 0xBA, 0xC4, 0xD3, 0xE9, 0xCE, 0xCE, 0xC6, 0xD3, 0xDC, 0xEA, 0xFA, 0xDF, 0x28, 0x1C, 0x1C,
+        0x1C, 0x24, 0x2B, 0x30, 0x35, 0x39, 0x43, 0x51, 0x69, 0x4E, 0x4D, 0x47, 0x51, 0x5A, 0x6A, 0x7A,
+        0x5D, 0xA8, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xAF, 0xB4, 0xB9, 0xC4, 0xD0, 0xEA, 0xCD, 0xCC, 0xC7,
+        0xD0, 0xD9, 0xE6, 0xF4, 0xDB, 0x28, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x30, 0x35, 0x3A, 0x45, 0x50,
+        0x67, 0x4C, 0x4C, 0x46, 0x52, 0x59, 0x66, 0x6E, 0x59, 0xA8, 0x9C, 0x9C, 0x9C, 0xA4, 0xAB, 0xB0,
+        0xB5, 0xBA, 0xC4, 0xD2, 0xE6, 0xCE, 0xCC, 0xC5, 0xD0, 0xD7, 0xE4, 0xE9, 0xD9, 0x29, 0x1C, 0x1D,
+        0x1D, 0x24, 0x2B, 0x31, 0x36, 0x3A, 0x44, 0x53, 0x69, 0x4F, 0x4C, 0x45, 0x4E, 0x58, 0x68, 0x6B,
+        0x5C, 0xA9, 0x9C, 0x9D, 0x9D, 0xA4, 0xAB, 0xB1, 0xB6, 0xBA, 0xC5, 0xD3, 0xEC, 0xCE, 0xCB, 0xC6,
+        0xCF, 0xD9, 0xE8, 0xEA, 0xD9, 0x29, 0x1C, 0x1D, 0x1D, 0x24, 0x2B, 0x31, 0x36, 0x3B, 0x46, 0x54,
+        0x6D, 0x4F, 0x4C, 0x47, 0x51, 0x58, 0x64, 0x66, 0x58, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2,
+        0xB7, 0xBC, 0xC6, 0xD3, 0xEB, 0xD0, 0xCD, 0xC8, 0xD0, 0xD6, 0xE3, 0xE2, 0xD7, 0x29, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3B, 0x46, 0x52, 0x6C, 0x4F, 0x4B, 0x47, 0x4E, 0x57, 0x67, 0x68,
+        0x58, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2, 0xB7, 0xBB, 0xC7, 0xD1, 0xEE, 0xCE, 0xCA, 0xC7,
+        0xD0, 0xDA, 0xEA, 0xF2, 0xDB, 0x29, 0x1C, 0x1D, 0x1D, 0x24, 0x2C, 0x31, 0x36, 0x3B, 0x47, 0x50,
+        0x6B, 0x4E, 0x4A, 0x47, 0x52, 0x5A, 0x6A, 0x78, 0x5C, 0xA9, 0x9C, 0x9D, 0x9D, 0xA4, 0xAC, 0xB2,
+        0xB7, 0xBC, 0xC7, 0xD1, 0xEC, 0xCF, 0xCB, 0xC7, 0xD1, 0xD8, 0xE8, 0xF7, 0xDC, 0x29, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x36, 0x3B, 0x46, 0x50, 0x68, 0x4E, 0x4B, 0x46, 0x4F, 0x56, 0x63, 0x6B,
+        0x59, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB6, 0xBB, 0xC6, 0xD1, 0xE9, 0xCE, 0xCB, 0xC7,
+        0xD1, 0xD9, 0xE8, 0xEC, 0xDB, 0x29, 0x1C, 0x1D, 0x1D, 0x24, 0x2C, 0x30, 0x36, 0x3B, 0x46, 0x51,
+        0x6A, 0x4F, 0x4A, 0x48, 0x54, 0x5A, 0x68, 0x6A, 0x5A, 0xA9, 0x9C, 0x9D, 0x9D, 0xA4, 0xAC, 0xB1,
+        0xB6, 0xBB, 0xC6, 0xD4, 0xEF, 0xD2, 0xCC, 0xC8, 0xD5, 0xDB, 0xE9, 0xE9, 0xDA, 0x29, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3B, 0x46, 0x56, 0x7B, 0x53, 0x4E, 0x49, 0x55, 0x5C, 0x6C, 0x6C,
+        0x58, 0xA9, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB6, 0xBB, 0xC6, 0xD6, 0xFF, 0xD3, 0xCE, 0xCA,
+        0xD9, 0xDF, 0xEF, 0xEF, 0xD8, 0x29, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3B, 0x46, 0x54,
+        0x75, 0x50, 0x4D, 0x4A, 0x5B, 0x67, 0x73, 0x78, 0x5C, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1,
+        0xB7, 0xBB, 0xC6, 0xD1, 0xEF, 0xCF, 0xCC, 0xCA, 0xDB, 0xE7, 0xF0, 0xFC, 0xDC, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3B, 0x45, 0x50, 0x6E, 0x4E, 0x4C, 0x4A, 0x5B, 0x66, 0x7A, 0xF4,
+        0x5F, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2, 0xB6, 0xBA, 0xC5, 0xD0, 0xE9, 0xCD, 0xCB, 0xCA,
+        0xDA, 0xE2, 0xFA, 0x7A, 0xDF, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3B, 0x46, 0x4F,
+        0x66, 0x4E, 0x4C, 0x4B, 0x5A, 0x61, 0x7D, 0xF4, 0x63, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2,
+        0xB7, 0xBB, 0xC5, 0xCE, 0xE7, 0xCF, 0xCD, 0xCB, 0xD6, 0xE0, 0xF5, 0x6E, 0xE3, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3B, 0x45, 0x4F, 0x6E, 0x4F, 0x4F, 0x4A, 0x57, 0x65, 0xFD, 0xE6,
+        0x64, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2, 0xB7, 0xBB, 0xC7, 0xD3, 0xF5, 0xCF, 0xCE, 0xCA,
+        0xDB, 0xEB, 0x6F, 0x62, 0xE6, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x32, 0x37, 0x3C, 0x48, 0x55,
+        0x6F, 0x4F, 0x4F, 0x4B, 0x5E, 0x6F, 0xF0, 0xE6, 0x66, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2,
+        0xB7, 0xBB, 0xC7, 0xD5, 0xEE, 0xCF, 0xCE, 0xCC, 0xDE, 0xF3, 0x6B, 0x63, 0xEB, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3A, 0x45, 0x53, 0x6F, 0x4F, 0x4E, 0x4B, 0x5D, 0x71, 0xE6, 0xE0,
+        0x6C, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB5, 0xBA, 0xC4, 0xD2, 0xEC, 0xCF, 0xCD, 0xCB,
+        0xDF, 0xFA, 0x5F, 0x5E, 0xEF, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3A, 0x45, 0x50,
+        0x69, 0x4F, 0x4C, 0x4C, 0x5E, 0x72, 0xE1, 0xDF, 0x70, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1,
+        0xB6, 0xBA, 0xC5, 0xCE, 0xE9, 0xD2, 0xCE, 0xCD, 0xDF, 0xED, 0x63, 0x5D, 0xF4, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x31, 0x36, 0x3A, 0x45, 0x50, 0x6A, 0x54, 0x4E, 0x4C, 0x5E, 0x6D, 0xE2, 0xDF,
+        0x6F, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB6, 0xBA, 0xC6, 0xD3, 0xE9, 0xD4, 0xCD, 0xCC,
+        0xE3, 0xF6, 0x5F, 0x61, 0xEE, 0x28, 0x1C, 0x1D, 0x1D, 0x25, 0x2D, 0x31, 0x36, 0x3A, 0x46, 0x53,
+        0x69, 0x55, 0x4F, 0x4E, 0x68, 0x7B, 0xE0, 0xDD, 0x74, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB2,
+        0xB6, 0xBA, 0xC5, 0xD1, 0xEC, 0xD7, 0xD2, 0xCD, 0xE1, 0xF2, 0x60, 0x5A, 0xFA, 0x28, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x32, 0x35, 0x39, 0x43, 0x50, 0x6D, 0x56, 0x51, 0x4B, 0x5D, 0x6D, 0xDE, 0xD9,
+        0x7A, 0xA7, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB1, 0xB5, 0xB9, 0xC3, 0xCF, 0xE7, 0xD2, 0xCF, 0xCA,
+        0xDF, 0xF1, 0x5F, 0x5C, 0xFC, 0x27, 0x1C, 0x1D, 0x1D, 0x25, 0x2C, 0x30, 0x34, 0x39, 0x42, 0x4E,
+        0x5E, 0x4F, 0x4F, 0x4B, 0x5F, 0x6F, 0xE7, 0xDF, 0xFF, 0xA7, 0x9C, 0x9D, 0x9D, 0xA5, 0xAC, 0xB0,
+        0xB4, 0xB9, 0xC2, 0xCE, 0xE0, 0xD0, 0xD0, 0xCC, 0xDF, 0xED, 0x69, 0x5F, 0x7B, 0x27, 0x1C, 0x1D,
+        0x1D, 0x25, 0x2C, 0x30, 0x34, 0x38, 0x43, 0x50, 0x65, 0x52, 0x4F, 0x4B, 0x5D, 0x6A, 0xEC, 0xE1,
+        0x7D, 0xA7, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB1, 0xB5, 0xB9, 0xC6, 0xD5, 0xE9, 0xD2, 0xCF, 0xCB,
+        0xDF, 0xEC, 0x70, 0x66, 0xED, 0x27, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x31, 0x35, 0x3A, 0x47, 0x54,
+        0x69, 0x53, 0x50, 0x4C, 0x66, 0x6E, 0xF3, 0xE3, 0x6C, 0xA7, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2,
+        0xB5, 0xB9, 0xC5, 0xD1, 0xE6, 0xD4, 0xD1, 0xCB, 0xE3, 0xEA, 0x77, 0x66, 0xED, 0x28, 0x1C, 0x1D,
+        0x1E, 0x26, 0x2D, 0x32, 0x35, 0x38, 0x43, 0x52, 0x69, 0x55, 0x50, 0x4C, 0x61, 0x70, 0xE8, 0xE3,
+        0x73, 0xA7, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB1, 0xB5, 0xB8, 0xC3, 0xD1, 0xE6, 0xD0, 0xCD, 0xCB,
+        0xDD, 0xEE, 0x6C, 0x67, 0xEB, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x31, 0x35, 0x38, 0x44, 0x50,
+        0x65, 0x50, 0x4E, 0x4C, 0x5F, 0x72, 0xED, 0xE6, 0x6B, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB1,
+        0xB5, 0xB8, 0xC3, 0xCF, 0xE5, 0xD0, 0xCE, 0xCB, 0xDC, 0xEC, 0x6F, 0x69, 0xE7, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x31, 0x35, 0x38, 0x44, 0x51, 0x6B, 0x54, 0x4E, 0x4A, 0x5B, 0x6B, 0xED, 0xE9,
+        0x68, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB2, 0xB5, 0xB8, 0xC4, 0xD1, 0xED, 0xD5, 0xCF, 0xCB,
+        0xDB, 0xED, 0x6B, 0x68, 0xE9, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2D, 0x32, 0x36, 0x39, 0x45, 0x50,
+        0x6B, 0x53, 0x4F, 0x4C, 0x5C, 0x6B, 0xED, 0xE8, 0x64, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB2,
+        0xB6, 0xBA, 0xC6, 0xD1, 0xF0, 0xD6, 0xD0, 0xCC, 0xDE, 0xEE, 0x6B, 0x65, 0xE8, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x32, 0x36, 0x38, 0x44, 0x50, 0x6D, 0x53, 0x4F, 0x4C, 0x5C, 0x6F, 0xEE, 0xEA,
+        0x64, 0xA8, 0x9C, 0x9D, 0x9D, 0xA7, 0xAD, 0xB2, 0xB6, 0xB8, 0xC4, 0xD2, 0xEB, 0xD0, 0xCE, 0xCB,
+        0xDC, 0xEF, 0x6C, 0x67, 0xE5, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x31, 0x36, 0x38, 0x43, 0x4F,
+        0x60, 0x4E, 0x4D, 0x4A, 0x59, 0x66, 0xF9, 0xEB, 0x62, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2,
+        0xB7, 0xB9, 0xC4, 0xD0, 0xE0, 0xCF, 0xCE, 0xCA, 0xD9, 0xE6, 0x77, 0x68, 0xE5, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2C, 0x31, 0x36, 0x38, 0x44, 0x4F, 0x60, 0x4E, 0x4D, 0x49, 0x58, 0x68, 0xF4, 0xE7,
+        0x67, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB1, 0xB6, 0xB8, 0xC5, 0xD0, 0xE0, 0xCD, 0xCB, 0xC9,
+        0xD9, 0xEE, 0x74, 0x66, 0xEA, 0x28, 0x1C, 0x1D, 0x1D, 0x26, 0x2C, 0x31, 0x36, 0x38, 0x46, 0x4F,
+        0x5F, 0x4C, 0x4B, 0x49, 0x5A, 0x71, 0xF8, 0xE8, 0x68, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2,
+        0xB6, 0xB9, 0xC5, 0xCE, 0xDD, 0xCB, 0xCB, 0xC9, 0xDA, 0xEE, 0x79, 0x68, 0xE4, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x32, 0x36, 0x38, 0x44, 0x4D, 0x5D, 0x4D, 0x4D, 0x49, 0x5B, 0x6D, 0xF2, 0xE8,
+        0x66, 0xA9, 0x9C, 0x9D, 0x9D, 0xA6, 0xAC, 0xB2, 0xB5, 0xB8, 0xC1, 0xCC, 0xDA, 0xCC, 0xCB, 0xC9,
+        0xDA, 0xEA, 0x6F, 0x6A, 0xE7, 0x29, 0x1C, 0x1D, 0x1E, 0x26, 0x2D, 0x32, 0x36, 0x38, 0x42, 0x4B,
+        0x5B, 0x4D, 0x4C, 0x4B, 0x5B, 0x69, 0xF6, 0xEA, 0x66, 0xA9, 0x9C, 0x9D, 0x9E, 0xA6, 0xAD, 0xB2,
+        0xB6, 0xB9, 0xC2, 0xCA, 0xD9, 0xCD, 0xCB, 0xCA, 0xD8, 0xE3, 0xF3, 0x79, 0xDE, 0x29, 0x1C, 0x1E,
+        0x1E, 0x27, 0x2D, 0x32, 0x37, 0x39, 0x43, 0x4C, 0x5D, 0x4E, 0x4D, 0x4B, 0x58, 0x67, 0x7C, 0xF7,
+        0x5F, 0xA9, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB2, 0xB6, 0xB8, 0xC3, 0xCE, 0xE0, 0xCE, 0xCD, 0xCB,
+        0xDA, 0xEB, 0x7E, 0x78, 0xDF, 0x29, 0x1C, 0x1D, 0x1E, 0x27, 0x2D, 0x32, 0x36, 0x38, 0x44, 0x4F,
+        0x5F, 0x4E, 0x4D, 0x4A, 0x5B, 0x6E, 0xF8, 0xF9, 0x62, 0xA9, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB2,
+        0xB6, 0xB9, 0xC2, 0xCE, 0xDE, 0xCE, 0xCD, 0xC9, 0xD9, 0xE5, 0xFE, 0xF7, 0xDE, 0x29, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x32, 0x36, 0x38, 0x41, 0x4E, 0x5D, 0x4E, 0x4C, 0x48, 0x55, 0x5E, 0x71, 0x6E,
+        0x5D, 0xA9, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xB8, 0xC3, 0xCF, 0xDE, 0xCE, 0xCC, 0xC9,
+        0xD4, 0xDF, 0xF1, 0xF0, 0xDC, 0x29, 0x1D, 0x1D, 0x1E, 0x27, 0x2D, 0x33, 0x37, 0x39, 0x44, 0x4E,
+        0x5E, 0x4E, 0x4D, 0x4A, 0x55, 0x5C, 0x6D, 0x6D, 0x5A, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xB8, 0xB9, 0xC4, 0xCE, 0xDF, 0xD0, 0xCD, 0xCA, 0xD5, 0xDC, 0xEE, 0xEF, 0xDB, 0x2A, 0x1D, 0x1D,
+        0x1E, 0x27, 0x2D, 0x33, 0x37, 0x39, 0x44, 0x4E, 0x61, 0x52, 0x4C, 0x4A, 0x54, 0x5E, 0x77, 0x75,
+        0x5B, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xB9, 0xC6, 0xCF, 0xE1, 0xD0, 0xCC, 0xCA,
+        0xD7, 0xE0, 0xF9, 0xFC, 0xD9, 0x2A, 0x1C, 0x1D, 0x1E, 0x27, 0x2D, 0x34, 0x37, 0x39, 0x45, 0x4E,
+        0x5D, 0x4F, 0x4D, 0x4A, 0x59, 0x60, 0x77, 0x7F, 0x59, 0xAA, 0x9C, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xB7, 0xB9, 0xC3, 0xCD, 0xDD, 0xD0, 0xCE, 0xC9, 0xD6, 0xDE, 0xF9, 0x7F, 0xD9, 0x2A, 0x1D, 0x1D,
+        0x1E, 0x26, 0x2D, 0x33, 0x36, 0x39, 0x43, 0x4D, 0x60, 0x4F, 0x4C, 0x48, 0x53, 0x5E, 0x74, 0x78,
+        0x56, 0xAA, 0x9D, 0x9E, 0x9E, 0xA6, 0xAD, 0xB3, 0xB6, 0xB9, 0xC5, 0xCE, 0xE1, 0xCE, 0xCB, 0xC8,
+        0xD4, 0xDF, 0xEE, 0xEF, 0xD3, 0x2A, 0x1D, 0x1E, 0x1E, 0x27, 0x2D, 0x33, 0x36, 0x39, 0x45, 0x4E,
+        0x61, 0x4E, 0x4C, 0x49, 0x56, 0x5E, 0x6E, 0x6C, 0x54, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAD, 0xB3,
+        0xB6, 0xBA, 0xC4, 0xCE, 0xE2, 0xD1, 0xCD, 0xC9, 0xD6, 0xDD, 0xEE, 0xEA, 0xD3, 0x2A, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2D, 0x33, 0x37, 0x39, 0x45, 0x4F, 0x66, 0x52, 0x4D, 0x47, 0x54, 0x5E, 0x70, 0x6B,
+        0x53, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAD, 0xB3, 0xB7, 0xB9, 0xC4, 0xCF, 0xE7, 0xD1, 0xCC, 0xC7,
+        0xD5, 0xDC, 0xEC, 0xE9, 0xD1, 0x2A, 0x1D, 0x1E, 0x1E, 0x27, 0x2D, 0x34, 0x37, 0x3A, 0x44, 0x4F,
+        0x5F, 0x4F, 0x4C, 0x48, 0x58, 0x5C, 0x6A, 0x66, 0x4F, 0xAB, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4,
+        0xB8, 0xBA, 0xC3, 0xCE, 0xDD, 0xCF, 0xCD, 0xC9, 0xD7, 0xDA, 0xE5, 0xE1, 0xCE, 0x2B, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x34, 0x37, 0x39, 0x42, 0x4C, 0x5D, 0x4F, 0x4C, 0x49, 0x59, 0x5D, 0x68, 0x65,
+        0x4E, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB3, 0xB6, 0xB9, 0xC2, 0xCD, 0xDE, 0xCE, 0xCC, 0xC8,
+        0xDB, 0xDF, 0xEF, 0xEB, 0xD0, 0x2A, 0x1D, 0x1E, 0x1E, 0x27, 0x2D, 0x33, 0x36, 0x39, 0x42, 0x4E,
+        0x5F, 0x4E, 0x4C, 0x49, 0x5F, 0x62, 0x7E, 0x6D, 0x52, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB3,
+        0xB7, 0xBA, 0xC3, 0xCE, 0xE1, 0xCF, 0xCC, 0xCA, 0xDE, 0xE3, 0x7D, 0xEE, 0xD2, 0x2A, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x34, 0x37, 0x3A, 0x44, 0x4F, 0x63, 0x4F, 0x4C, 0x49, 0x5C, 0x65, 0xFF, 0x6E,
+        0x50, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4, 0xB7, 0xBA, 0xC5, 0xD1, 0xE5, 0xCE, 0xCB, 0xC8,
+        0xDD, 0xE8, 0xFE, 0xEE, 0xD0, 0x2A, 0x1D, 0x1E, 0x1E, 0x27, 0x2E, 0x34, 0x37, 0x3B, 0x46, 0x50,
+        0x5F, 0x4D, 0x4C, 0x49, 0x5D, 0x64, 0x74, 0x6A, 0x51, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB5,
+        0xB8, 0xBB, 0xC6, 0xD0, 0xDF, 0xCE, 0xCD, 0xCA, 0xDA, 0xDE, 0xF0, 0xEA, 0xD4, 0x2A, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x35, 0x38, 0x3B, 0x45, 0x51, 0x64, 0x4F, 0x4D, 0x4A, 0x59, 0x5F, 0x7A, 0x6D,
+        0x57, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4, 0xB7, 0xBA, 0xC6, 0xD2, 0xE8, 0xCF, 0xCC, 0xCB,
+        0xDB, 0xE5, 0x7C, 0xF5, 0xD9, 0x29, 0x1D, 0x1D, 0x1E, 0x27, 0x2E, 0x34, 0x37, 0x3A, 0x47, 0x53,
+        0x6B, 0x50, 0x4D, 0x4C, 0x5B, 0x62, 0x76, 0x73, 0x58, 0xA9, 0x9C, 0x9D, 0x9E, 0xA7, 0xAE, 0xB5,
+        0xB8, 0xBA, 0xC6, 0xD1, 0xE8, 0xD1, 0xCE, 0xCB, 0xDB, 0xDF, 0xF1, 0xEF, 0xD7, 0x29, 0x1D, 0x1D,
+        0x1E, 0x27, 0x2E, 0x35, 0x38, 0x3B, 0x46, 0x53, 0x6A, 0x53, 0x4E, 0x4A, 0x5B, 0x60, 0x7A, 0x70,
+        0x58, 0xA9, 0x9D, 0x9D, 0x9E, 0xA7, 0xAE, 0xB4, 0xB8, 0xBB, 0xC6, 0xD4, 0xEA, 0xD3, 0xCE, 0xCB,
+        0xDE, 0xE8, 0x79, 0xF6, 0xDA, 0x29, 0x1C, 0x1D, 0x1E, 0x27, 0x2E, 0x34, 0x38, 0x3B, 0x46, 0x53,
+        0x67, 0x50, 0x4D, 0x4A, 0x5C, 0x65, 0x7E, 0x77, 0x5B, 0xA9, 0x9D, 0x9E, 0x9E, 0xA7, 0xAF, 0xB5,
+        0xB8, 0xBB, 0xC5, 0xD2, 0xEC, 0xD3, 0xCF, 0xCC, 0xDC, 0xE5, 0x7E, 0xFF, 0xDB, 0x29, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x35, 0x38, 0x3A, 0x44, 0x51, 0x6F, 0x54, 0x50, 0x4C, 0x5A, 0x66, 0x7E, 0xFE,
+        0x5B, 0xA9, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB4, 0xB7, 0xBA, 0xC6, 0xD2, 0xF2, 0xD4, 0xD2, 0xCD,
+        0xDD, 0xEB, 0xFD, 0xFE, 0xDB, 0x29, 0x1D, 0x1E, 0x1E, 0x27, 0x2E, 0x33, 0x37, 0x3B, 0x46, 0x52,
+        0x6C, 0x51, 0x51, 0x4D, 0x5E, 0x6A, 0x7A, 0x78, 0x5A, 0xA9, 0x9D, 0x9D, 0x9E, 0xA7, 0xAE, 0xB4,
+        0xB8, 0xBB, 0xC5, 0xD1, 0xEA, 0xD2, 0xD2, 0xCD, 0xDD, 0xE4, 0xF2, 0xEE, 0xD8, 0x2A, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x35, 0x38, 0x3B, 0x46, 0x55, 0x6E, 0x54, 0x53, 0x4D, 0x5E, 0x67, 0x7B, 0x74,
+        0x59, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAE, 0xB4, 0xB7, 0xBA, 0xC6, 0xD6, 0xEB, 0xD3, 0xD1, 0xCC,
+        0xDD, 0xE8, 0xFB, 0xF2, 0xD8, 0x2A, 0x1D, 0x1D, 0x1E, 0x27, 0x2E, 0x34, 0x37, 0x3B, 0x46, 0x56,
+        0x6C, 0x54, 0x53, 0x4C, 0x5F, 0x6C, 0xFA, 0x7A, 0x58, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xB7, 0xBB, 0xC4, 0xD2, 0xEB, 0xD4, 0xD3, 0xCC, 0xDD, 0xEC, 0x79, 0xFA, 0xD8, 0x2A, 0x1D, 0x1D,
+        0x1D, 0x26, 0x2D, 0x34, 0x37, 0x3A, 0x43, 0x52, 0x75, 0x57, 0x54, 0x4C, 0x5C, 0x6A, 0xFB, 0x7E,
+        0x5A, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4, 0xB7, 0xBA, 0xC5, 0xD2, 0xF4, 0xD5, 0xD1, 0xCC,
+        0xDB, 0xE7, 0xFB, 0xFD, 0xD9, 0x2A, 0x1D, 0x1D, 0x1E, 0x27, 0x2D, 0x34, 0x37, 0x3B, 0x47, 0x50,
+        0x6C, 0x52, 0x50, 0x4C, 0x5B, 0x64, 0x72, 0x7A, 0x58, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4,
+        0xB7, 0xBB, 0xC5, 0xCD, 0xE6, 0xD2, 0xD0, 0xCB, 0xDC, 0xE2, 0xF3, 0xF8, 0xD8, 0x2A, 0x1D, 0x1D,
+        0x1E, 0x27, 0x2D, 0x34, 0x37, 0x3A, 0x43, 0x4D, 0x66, 0x51, 0x4E, 0x4A, 0x59, 0x60, 0x75, 0x79,
+        0x59, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB4, 0xB7, 0xBA, 0xC5, 0xCF, 0xE7, 0xCF, 0xCD, 0xCA,
+        0xDA, 0xE4, 0xFD, 0x7E, 0xDB, 0x29, 0x1D, 0x1D, 0x1D, 0x27, 0x2D, 0x33, 0x37, 0x3A, 0x45, 0x4E,
+        0x65, 0x4F, 0x4D, 0x4A, 0x57, 0x5F, 0x75, 0x79, 0x5B, 0xA9, 0x9D, 0x9D, 0x9D, 0xA7, 0xAD, 0xB4,
+        0xB8, 0xBB, 0xC4, 0xCE, 0xE3, 0xCF, 0xCD, 0xCA, 0xD7, 0xDF, 0x7E, 0x7E, 0xDD, 0x29, 0x1D, 0x1D,
+        0x1E, 0x27, 0x2D, 0x34, 0x38, 0x3A, 0x42, 0x4D, 0x5F, 0x4F, 0x4C, 0x49, 0x57, 0x5E, 0xFC, 0x7B,
+        0x5B, 0xAA, 0x9D, 0x9D, 0x9E, 0xA7, 0xAE, 0xB4, 0xB8, 0xBA, 0xC3, 0xCE, 0xDD, 0xCE, 0xCB, 0xC9,
+        0xD8, 0xDE, 0xFD, 0xF6, 0xDB, 0x29, 0x1D, 0x1D, 0x1E, 0x27, 0x2D, 0x34, 0x37, 0x3A, 0x44, 0x4E,
+        0x5E, 0x4D, 0x4C, 0x49, 0x59, 0x5F, 0x75, 0x71, 0x58, 0xA9, 0x9D, 0x9D, 0x9E, 0xA7, 0xAD, 0xB5,
+        0xB8, 0xBB, 0xC5, 0xCF, 0xE2, 0xCE, 0xCD, 0xC9, 0xD9, 0xE0, 0xF9, 0xFC, 0xD8, 0x29, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x35, 0x38, 0x3A, 0x45, 0x4F, 0x6A, 0x4F, 0x4D, 0x49, 0x57, 0x60, 0x7B, 0xFF,
+        0x57, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB5, 0xB8, 0xBB, 0xC6, 0xD0, 0xE7, 0xCE, 0xCC, 0xC9,
+        0xD8, 0xE5, 0xFC, 0xFB, 0xD6, 0x2A, 0x1D, 0x1E, 0x1E, 0x27, 0x2E, 0x35, 0x39, 0x3B, 0x46, 0x51,
+        0x65, 0x4E, 0x4E, 0x4A, 0x59, 0x64, 0x73, 0x6F, 0x56, 0xA9, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB6,
+        0xB9, 0xBC, 0xC5, 0xD2, 0xE7, 0xCF, 0xCE, 0xC9, 0xD9, 0xDF, 0xEF, 0xEC, 0xD7, 0x29, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2F, 0x36, 0x39, 0x3B, 0x44, 0x52, 0x66, 0x4F, 0x4D, 0x49, 0x58, 0x5E, 0x71, 0x6C,
+        0x56, 0xAA, 0x9D, 0x9E, 0x9E, 0xA8, 0xAF, 0xB6, 0xB9, 0xBB, 0xC5, 0xD2, 0xE9, 0xCF, 0xCC, 0xC8,
+        0xD7, 0xDE, 0xEE, 0xEC, 0xD5, 0x2A, 0x1D, 0x1E, 0x1E, 0x28, 0x2E, 0x36, 0x39, 0x3C, 0x47, 0x52,
+        0x68, 0x4E, 0x4C, 0x48, 0x59, 0x61, 0x6F, 0x6F, 0x55, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB6,
+        0xB9, 0xBC, 0xC7, 0xD2, 0xEB, 0xCF, 0xCD, 0xC8, 0xD8, 0xDE, 0xEA, 0xEE, 0xD4, 0x2A, 0x1D, 0x1E,
+        0x1E, 0x27, 0x2E, 0x36, 0x39, 0x3B, 0x47, 0x54, 0x6D, 0x51, 0x4E, 0x48, 0x57, 0x5E, 0x72, 0x7C,
+        0x56, 0xAA, 0x9D, 0x9E, 0x9E, 0xA7, 0xAE, 0xB5, 0xB8, 0xBB, 0xC7, 0xD6, 0xEF, 0xD0, 0xCC, 0xC8,
+        0xD9, 0xE7, 0x77, 0x75, 0xDA, 0x29, 0x1D, 0x1E, 0x1E, 0x27, 0x2E, 0x35, 0x39, 0x3C, 0x48, 0x56,
+        0x69, 0x4F, 0x4E, 0x4A, 0x5E, 0x73, 0xE7, 0xE9, 0x5D, 0xA9, 0x9D, 0x9E, 0x9E, 0xA7, 0xAD, 0xB5,
+        0xB8, 0xBB, 0xC7, 0xD3, 0xEA, 0xD0, 0xCF, 0xCB, 0xDF, 0xF4, 0x64, 0x67, 0xE2, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2D, 0x34, 0x37, 0x3A, 0x45, 0x4F, 0x6C, 0x53, 0x4F, 0x4C, 0x5D, 0x73, 0xDF, 0xE0,
+        0x68, 0xA8, 0x9C, 0x9D, 0x9D, 0xA6, 0xAD, 0xB3, 0xB6, 0xBA, 0xC6, 0xCF, 0xEA, 0xD0, 0xCF, 0xCD,
+        0xDE, 0xEF, 0x63, 0x64, 0xE6, 0x27, 0x1C, 0x1D, 0x1D, 0x26, 0x2D, 0x33, 0x37, 0x3B, 0x46, 0x4D,
+        0x64, 0x4F, 0x4F, 0x4E, 0x61, 0x72, 0xE2, 0xE8, 0x5F, 0xA7, 0x9C, 0x9D, 0x9D, 0xA7, 0xAD, 0xB4,
+        0xB6, 0xBA, 0xC2, 0xCA, 0xE0, 0xCF, 0xCF, 0xCE, 0xE1, 0xEB, 0x64, 0x6A, 0xDE, 0x28, 0x1C, 0x1D,
+        0x1D, 0x27, 0x2E, 0x34, 0x36, 0x39, 0x41, 0x4C, 0x66, 0x4F, 0x4C, 0x4B, 0x5F, 0x6A, 0xE6, 0xF4,
+        0x5B, 0xA8, 0x9C, 0x9D, 0x9D, 0xA7, 0xAE, 0xB3, 0xB6, 0xB9, 0xC0, 0xCC, 0xDF, 0xCE, 0xCD, 0xCD,
+        0xE1, 0xE5, 0x76, 0xF1, 0xD9, 0x28, 0x1C, 0x1D, 0x1D, 0x27, 0x2E, 0x32, 0x35, 0x38, 0x3E, 0x4A,
+        0x5C, 0x4E, 0x4D, 0x4D, 0x5E, 0x5F, 0x71, 0x6B, 0x59, 0xA9, 0x9C, 0x9D, 0x9D, 0xA6, 0xAE, 0xB2,
+        0xB6, 0xB8, 0xBD, 0xC8, 0xDA, 0xCE, 0xCF, 0xCD, 0xDB, 0xDD, 0xEF, 0xEB, 0xD7, 0x29, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2E, 0x34, 0x37, 0x39, 0x3D, 0x48, 0x58, 0x4C, 0x4E, 0x4C, 0x5C, 0x5E, 0x6D, 0x6B,
+        0x5B, 0xA8, 0x9C, 0x9D, 0x9E, 0xA7, 0xAF, 0xB5, 0xB7, 0xBA, 0xBF, 0xCA, 0xD7, 0xCA, 0xCD, 0xCE,
+        0xE8, 0xE4, 0xEE, 0xED, 0xDD, 0x27, 0x1C, 0x1D, 0x1E, 0x27, 0x2F, 0x36, 0x39, 0x3D, 0x44, 0x4C,
+        0x58, 0x4B, 0x51, 0x54, 0x6E, 0x61, 0x6B, 0x70, 0x5B, 0xA7, 0x9C, 0x9D, 0x9D, 0xA7, 0xAF, 0xB7,
+        0xB9, 0xBD, 0xC4, 0xCE, 0xE3, 0xD4, 0xDA, 0xD2, 0xE2, 0xDB, 0xEE, 0xF8, 0xD8, 0x28, 0x1C, 0x1D,
+        0x1D, 0x26, 0x2E, 0x36, 0x38, 0x3C, 0x45, 0x50, 0x6C, 0x55, 0x53, 0x4D, 0x60, 0x5D, 0x7A, 0x7A,
+        0x59, 0xA8, 0x9C, 0x9D, 0x9D, 0xA5, 0xAD, 0xB4, 0xB9, 0xBD, 0xC4, 0xCB, 0xD8, 0xCF, 0xCF, 0xCE,
+        0xE4, 0xDB, 0xFC, 0x79, 0xE1, 0x27, 0x1B, 0x1D, 0x1D, 0x25, 0x2D, 0x32, 0x37, 0x3C, 0x42, 0x48,
+        0x51, 0x4C, 0x4B, 0x4D, 0x60, 0x59, 0xED, 0xDF, 0xFD, 0xA6, 0x9B, 0x9D, 0x9D, 0xA4, 0xAC, 0xB0,
+        0xB7, 0xBB, 0xC0, 0xC7, 0xCF, 0xCA, 0xC6, 0xC9, 0xDD, 0xDC, 0x5D, 0x5A, 0xFA, 0x26, 0x1B, 0x1D,
+        0x1D, 0x25, 0x2D, 0x30, 0x35, 0x39, 0x3F, 0x47, 0x4E, 0x48, 0x44, 0x4B, 0x66, 0x62, 0xD6, 0xD4,
+        0x7B, 0xA7, 0x9B, 0x9D, 0x9C, 0xA5, 0xAC, 0xAE, 0xB1, 0xB6, 0xBE, 0xC8, 0xD3, 0xC8, 0xC2, 0xCA,
+        0xEA, 0xF5, 0x50, 0x53, 0xE9, 0x28, 0x1C, 0x1D, 0x1C, 0x24, 0x2A, 0x2D, 0x32, 0x36, 0x3E, 0x47,
+        0x50, 0x44, 0x3F, 0x47, 0x5C, 0x66, 0xD5, 0xCF, 0x6D, 0xA9, 0x9C, 0x9D, 0x9C, 0xA4, 0xAA, 0xAE,
+        0xB2, 0xB4, 0xBD, 0xC8, 0xD1, 0xC0, 0xBC, 0xBF, 0xCB, 0xD0, 0x6A, 0x57, 0xE1, 0x2A, 0x1D, 0x1E,
+        0x1D, 0x25, 0x2A, 0x2E, 0x34, 0x36, 0x3F, 0x48, 0x4C, 0x3B, 0x36, 0x36, 0x3D, 0x49, 0x7A, 0xDF,
+        0x56, 0xAB, 0x9E, 0x9F, 0x9E, 0xA7, 0xAC, 0xB0, 0xB6, 0xB9, 0xC4, 0xCD, 0xCE, 0xBA, 0xB5, 0xB5,
+        0xBD, 0xC8, 0xDE, 0xF8, 0xD5, 0x2B, 0x1E, 0x1F, 0x1F, 0x26, 0x2B, 0x2F, 0x33, 0x36, 0x41, 0x4E,
+        0x50, 0x3B, 0x35, 0x34, 0x3C, 0x48, 0x5F, 0x67, 0x4E, 0xAF, 0xA0, 0xA1, 0xA1, 0xA9, 0xAC, 0xAE,
+        0xB0, 0xB7, 0xC6, 0xD4, 0xD1, 0xBE, 0xBB, 0xBC, 0xC7, 0xDA, 0x70, 0xF1, 0xD2, 0x30, 0x22, 0x22,
+        0x23, 0x29, 0x2C, 0x2F, 0x34, 0x3A, 0x42, 0x4B, 0x4B, 0x3E, 0x3C, 0x3E, 0x53, 0xEB, 0xDB, 0xF5,
+        0x5B, 0xB9, 0xAD, 0xB2, 0xB4, 0xBA, 0xC0, 0xCA, 0xCD, 0xCC, 0xCD, 0xD0, 0xCF, 0xC4, 0xC7, 0xCD,
+        0xE9, 0x6E, 0x79, 0xDD, 0xC2, 0xCF, 0xDA, 0xCD, 0xEF, 0x74, 0xDC, 0xD4, 0xF6, 0x5A, 0x5A, 0x69,
+        0x6B, 0x56, 0x5C, 0x66, 0xF6, 0xE7, 0xE6, 0xF1, 0x4E, 0x50, 0x5C, 0x60, 0xD9, 0xD7, 0x7B, 0x6C,
+        0xDB, 0xCC, 0xCB, 0xCD, 0xD3, 0xCF, 0xD0, 0xCE, 0xD2, 0xE3, 0xEB, 0xDF, 0xC7, 0xC4, 0xCB, 0xCD,
+        0xD9, 0xD6, 0xCC, 0xCD, 0xDE, 0xF6, 0xFA, 0xF7, 0xEA, 0x6C, 0x68, 0xFB, 0xDB, 0xCE, 0xD8, 0xE7,
+        0x63, 0x5C, 0x6B, 0x6A, 0xE4, 0xDA, 0xE6, 0x78, 0xF9, 0xE6, 0xDD, 0xD8, 0xDE, 0xD0, 0xCF, 0xDB,
+        0x7C, 0x5C, 0xFE, 0xE2, 0xD2, 0xCB, 0xCF, 0xD4, 0xED, 0x6C, 0x6F, 0xF5, 0xFF, 0x76, 0x7E, 0x7F,
+        0xE0, 0x75, 0x64, 0x77, 0xE9, 0xD6, 0xE3, 0xEE, 0x5F, 0x4E, 0x50, 0x5B, 0xE9, 0xDA, 0xDC, 0xEC,
+        0xE6, 0xE1, 0xEE, 0x70, 0x59, 0xF8, 0xDB, 0xE5, 0x6B, 0x53, 0x5D, 0x6D, 0xDD, 0xD2, 0xDE, 0x72,
+        0x55, 0x52, 0x57, 0x5E, 0x58, 0x57, 0x5E, 0x64, 0x76, 0x53, 0x4D, 0x53, 0x5D, 0x7B, 0x6A, 0x60,
+        0x50, 0x4C, 0x54, 0x67, 0xED, 0xF4, 0x78, 0x71, 0xF1, 0xFC, 0x6B, 0x66, 0x62, 0xDF, 0xD7, 0xE4,
+        0x6E, 0x55, 0x55, 0x5D, 0xF1, 0xE6, 0x7C, 0x61, 0x52, 0x4F, 0x50, 0x53, 0x51, 0x55, 0x59, 0x5A,
+        0x5C, 0x4C, 0x47, 0x4B, 0x56, 0x75, 0x74, 0x5C, 0x4C, 0x4C, 0x56, 0x61, 0xF3, 0xFC, 0x66, 0x65,
+        0xFC, 0xF5, 0x74, 0x63, 0x5E, 0xE7, 0xD8, 0xE6, 0x65, 0x53, 0x55, 0x6A, 0xE0, 0xE8, 0x77, 0x68,
+        0x57, 0x5A, 0x67, 0x5D, 0x4F, 0x4E, 0x53, 0x5B, 0x5D, 0x4C, 0x48, 0x4D, 0x5E, 0xF1, 0x7F, 0x58,
+        0x49, 0x4C, 0x55, 0x5C, 0x7A, 0x72, 0x5F, 0x68, 0xEF, 0xEA, 0xE7, 0xE8, 0xE8, 0xD4, 0xCF, 0xD8,
+        0xFC, 0x5D, 0x64, 0xE5, 0xD0, 0xD9, 0xE9, 0xF6, 0x5E, 0x63, 0xF0, 0x7D, 0x5E, 0x5A, 0x57, 0x58,
+        0x5A, 0x4D, 0x48, 0x4C, 0x59, 0x73, 0x6F, 0x5A, 0x4D, 0x52, 0x5F, 0x68, 0xEB, 0xF3, 0x65, 0x6D,
+        0xEC, 0xE3, 0xDF, 0xDE, 0xDC, 0xCB, 0xC6, 0xCB, 0xD9, 0xEF, 0xE6, 0xD5, 0xCA, 0xD0, 0xDF, 0xE7,
+        0x6F, 0xFA, 0xDD, 0xE0, 0xFA, 0x70, 0x6A, 0x67, 0x61, 0x4E, 0x4A, 0x4F, 0x5F, 0x73, 0x66, 0x58,
+        0x4E, 0x57, 0x6F, 0x7E, 0xE3, 0xE9, 0x6D, 0x73, 0xE0, 0xD7, 0xD6, 0xD9, 0xD9, 0xCB, 0xC5, 0xCA,
+        0xD3, 0xDD, 0xD9, 0xCF, 0xC8, 0xCA, 0xD5, 0xDD, 0xF5, 0xF0, 0xDA, 0xDB, 0xF7, 0x64, 0x64, 0x6E,
+        0x71, 0x57, 0x4D, 0x54, 0x64, 0xF2, 0xFC, 0x5E, 0x4F, 0x52, 0x72, 0xE8, 0xDB, 0xDF, 0x75, 0x72,
+        0xDE, 0xD0, 0xD1, 0xD7, 0xD9, 0xCC, 0xC6, 0xCA, 0xD2, 0xDF, 0xDA, 0xCF, 0xC8, 0xCA, 0xD7, 0xDF,
+        0xF3, 0xF0, 0xDD, 0xDB, 0xF8, 0x60, 0x67, 0x7D, 0xF0, 0x5E, 0x4F, 0x55, 0x5F, 0x7D, 0x72, 0x5F,
+        0x50, 0x52, 0x6C, 0xF0, 0xDD, 0xDF, 0xFE, 0x6E, 0xE5, 0xD5, 0xD9, 0xDF, 0xE4, 0xD1, 0xCA, 0xCB,
+        0xD0, 0xDA, 0xD9, 0xD3, 0xCA, 0xCB, 0xDB, 0xEE, 0x6D, 0xFA, 0xDC, 0xD7, 0xED, 0x5F, 0x67, 0xF6,
+        0xEE, 0x5D, 0x4E, 0x4F, 0x59, 0x6C, 0x6D, 0x5E, 0x4F, 0x52, 0x6B, 0xEE, 0xDE, 0xEC, 0x69, 0x68,
+        0xE9, 0xD6, 0xDE, 0xEF, 0xEF, 0xD4, 0xCA, 0xCB, 0xD5, 0xE7, 0xE6, 0xDC, 0xCE, 0xCF, 0xE0, 0xF5,
+        0x69, 0xFD, 0xE3, 0xE4, 0x6C, 0x57, 0x5D, 0x6E, 0x75, 0x57, 0x4C, 0x4C, 0x56, 0x66, 0x66, 0x5F,
+        0x52, 0x55, 0x67, 0x79, 0xE8, 0xF9, 0x66, 0x67, 0xEE, 0xD7, 0xD9, 0xEA, 0x7F, 0xDC, 0xCD, 0xCC,
+        0xD5, 0xE7, 0xEB, 0xE7, 0xD7, 0xD9, 0xED, 0x71, 0x5C, 0x64, 0xF1, 0xF4, 0x61, 0x51, 0x53, 0x63,
+        0x70, 0x57, 0x4B, 0x4A, 0x52, 0x60, 0x63, 0x5E, 0x52, 0x54, 0x67, 0xFC, 0xE2, 0xF0, 0x66, 0x6C,
+        0xE7, 0xD6, 0xD8, 0xEA, 0xFE, 0xDC, 0xCE, 0xCE, 0xDA, 0xEC, 0xED, 0xEB, 0xD9, 0xDB, 0x7C, 0x69,
+        0x5C, 0x61, 0x7A, 0x76, 0x5A, 0x4E, 0x50, 0x5C, 0x63, 0x53, 0x4A, 0x4B, 0x52, 0x5D, 0x5E, 0x5E,
+        0x51, 0x53, 0x63, 0x73, 0xEC, 0xF6, 0x6A, 0x6B, 0xE3, 0xD4, 0xD7, 0xE6, 0xF6, 0xDC, 0xCF, 0xCF,
+        0xDA, 0xEC, 0xED, 0xE8, 0xD6, 0xD8, 0xEB, 0x7A, 0x62, 0x68, 0xFA, 0x7D, 0x5B, 0x4F, 0x51, 0x5E,
+        0x68, 0x55, 0x4B, 0x4B, 0x52, 0x5E, 0x5E, 0x5B, 0x4F, 0x51, 0x5E, 0x69, 0xF8, 0x7C, 0x65, 0x6A,
+        0xE3, 0xD4, 0xD8, 0xEA, 0xF9, 0xDB, 0xCE, 0xCE, 0xD9, 0xE7, 0xE8, 0xE3, 0xD6, 0xD8, 0xEC, 0xFE,
+        0x67, 0x6D, 0xF4, 0x7F, 0x5C, 0x50, 0x55, 0x64, 0x6E, 0x57, 0x4C, 0x4C, 0x55, 0x61, 0x62, 0x5F,
+        0x53, 0x55, 0x64, 0x6F, 0xF0, 0xF8, 0x6B, 0x75, 0xDE, 0xD3, 0xD8, 0xE9, 0xF7, 0xDB, 0xCE, 0xCE,
+        0xD8, 0xE7, 0xEA, 0xE4, 0xD6, 0xD7, 0xE8, 0xF2, 0x6E, 0x72, 0xEE, 0xF8, 0x5F, 0x53, 0x57, 0x68,
+        0x78, 0x5A, 0x4D, 0x4D, 0x56, 0x64, 0x66, 0x63, 0x56, 0x57, 0x67, 0x71, 0xEE, 0xF4, 0x6C, 0x72,
+        0xDF, 0xD3, 0xD8, 0xE8, 0xF6, 0xDA, 0xCE, 0xCE, 0xD6, 0xE5, 0xE7, 0xE4, 0xD5, 0xD6, 0xE6, 0xF0,
+        0x70, 0x76, 0xEC, 0xF1, 0x61, 0x54, 0x59, 0x69, 0x7A, 0x5C, 0x4F, 0x4E, 0x58, 0x69, 0x6B, 0x69,
+        0x58, 0x59, 0x6C, 0x7A, 0xEB, 0xF0, 0x6E, 0x72, 0xE1, 0xD5, 0xD7, 0xE4, 0xEF, 0xDA, 0xCE, 0xCD,
+        0xD7, 0xE6, 0xE9, 0xE6, 0xD7, 0xD7, 0xE7, 0xEF, 0x71, 0x78, 0xEA, 0xEC, 0x67, 0x56, 0x58, 0x66,
+        0x72, 0x5B, 0x4F, 0x4F, 0x59, 0x69, 0x6C, 0x6A, 0x59, 0x5A, 0x6C, 0x78, 0xEC, 0xF3, 0x6D, 0x6E,
+        0xE2, 0xD4, 0xD5, 0xDE, 0xE7, 0xD5, 0xCC, 0xCD, 0xD6, 0xE4, 0xE6, 0xE5, 0xD8, 0xD9, 0xEB, 0xF1,
+        0x74, 0xFB, 0xE5, 0xE8, 0x67, 0x56, 0x56, 0x5E, 0x66, 0x55, 0x4D, 0x4F, 0x5B, 0x6E, 0x6F, 0x6C,
+        0x5B, 0x5C, 0x76, 0xFE, 0xED, 0xF8, 0x69, 0x6C, 0xE5, 0xD4, 0xD3, 0xDC, 0xE2, 0xD4, 0xCD, 0xD0,
+        0xDD, 0xF5, 0xF3, 0xEB, 0xD9, 0xDA, 0xED, 0xF8, 0x6F, 0xFD, 0xE3, 0xE8, 0x6B, 0x57, 0x57, 0x60,
+        0x68, 0x57, 0x4F, 0x53, 0x61, 0xFA, 0x7F, 0x70, 0x5B, 0x5B, 0x72, 0xFE, 0xEC, 0x7E, 0x65, 0x68,
+        0xED, 0xD8, 0xD8, 0xDF, 0xE6, 0xD6, 0xCF, 0xD2, 0xE1, 0x7E, 0xF9, 0xEC, 0xD9, 0xDA, 0xEC, 0xF3,
+        0x73, 0xFB, 0xE3, 0xE5, 0x72, 0x5A, 0x58, 0x5F, 0x64, 0x57, 0x4F, 0x54, 0x65, 0x7E, 0x71, 0x68,
+        0x57, 0x57, 0x65, 0x6C, 0xFA, 0x7B, 0x64, 0x66, 0xEF, 0xD9, 0xD6, 0xDC, 0xE0, 0xD5, 0xCE, 0xD2,
+        0xE3, 0xF8, 0xED, 0xE6, 0xD7, 0xD7, 0xE6, 0xEC, 0x77, 0x7C, 0xE7, 0xEA, 0x68, 0x57, 0x56, 0x5D,
+        0x61, 0x55, 0x4F, 0x53, 0x64, 0x72, 0x68, 0x62, 0x56, 0x57, 0x66, 0x6D, 0xFA, 0xFD, 0x68, 0x6B,
+        0xE8, 0xD8, 0xD7, 0xDF, 0xE6, 0xD7, 0xD0, 0xD5, 0xE4, 0xED, 0xE3, 0xDF, 0xD5, 0xD6, 0xE3, 0xEB,
+        0x79, 0x7B, 0xE7, 0xEA, 0x67, 0x56, 0x56, 0x5F, 0x65, 0x56, 0x4F, 0x52, 0x5D, 0x64, 0x5E, 0x5C,
+        0x52, 0x54, 0x60, 0x69, 0xFC, 0x7C, 0x64, 0x66, 0xE8, 0xD7, 0xD7, 0xE1, 0xE8, 0xD8, 0xCF, 0xD2,
+        0xDC, 0xE2, 0xDD, 0xDC, 0xD1, 0xD3, 0xDF, 0xE8, 0x7D, 0xFA, 0xE5, 0xE9, 0x65, 0x57, 0x59, 0x64,
+        0x6C, 0x59, 0x51, 0x52, 0x5B, 0x5E, 0x5A, 0x59, 0x4F, 0x53, 0x5E, 0x66, 0xF8, 0xFC, 0x6A, 0x6D,
+        0xE2, 0xD7, 0xDA, 0xEB, 0xF9, 0xDC, 0xD4, 0xD4, 0xDC, 0xDF, 0xDD, 0xDD, 0xD3, 0xD7, 0xE4, 0xEF,
+        0x6D, 0x75, 0xEC, 0xEF, 0x61, 0x56, 0x5B, 0x6E, 0xFD, 0x5E, 0x55, 0x54, 0x5C, 0x60, 0x5C, 0x5A,
+        0x4F, 0x53, 0x5F, 0x69, 0xF6, 0x7E, 0x68, 0x6C, 0xE4, 0xD8, 0xDE, 0xF9, 0x74, 0xE1, 0xD7, 0xD6,
+        0xDD, 0xE0, 0xDB, 0xD9, 0xCE, 0xD0, 0xDD, 0xE5, 0xFF, 0xF5, 0xE6, 0xE9, 0x6A, 0x5A, 0x5F, 0x78,
+        0xF8, 0x5E, 0x54, 0x53, 0x5A, 0x5E, 0x59, 0x58, 0x4E, 0x51, 0x5D, 0x63, 0x7C, 0x71, 0x63, 0x62,
+        0xF1, 0xDA, 0xDE, 0xF0, 0xFA, 0xDA, 0xD1, 0xD1, 0xD9, 0xDE, 0xDA, 0xD9, 0xCF, 0xD1, 0xDE, 0xE5,
+        0xFB, 0xEE, 0xE0, 0xDF, 0x78, 0x5B, 0x5F, 0x71, 0x7A, 0x5B, 0x51, 0x53, 0x5B, 0x60, 0x5A, 0x57,
+        0x4E, 0x52, 0x5F, 0x64, 0x77, 0x6E, 0x60, 0x5D, 0x7B, 0xDD, 0xE1, 0xF1, 0xF6, 0xD9, 0xCF, 0xD3,
+        0xDA, 0xDE, 0xD9, 0xD7, 0xCE, 0xD0, 0xDC, 0xDD, 0xE9, 0xE2, 0xD9, 0xD6, 0xE9, 0x66, 0x68, 0x73,
+        0x78, 0x5A, 0x51, 0x54, 0x5C, 0x65, 0x5F, 0x5C, 0x4F, 0x51, 0x5B, 0x5C, 0x64, 0x5F, 0x56, 0x54,
+        0x67, 0xE5, 0xE6, 0xF4, 0xF8, 0xD9, 0xCF, 0xD2, 0xD9, 0xDF, 0xDB, 0xD9, 0xCE, 0xCE, 0xD8, 0xDA,
+        0xDE, 0xDA, 0xD3, 0xD2, 0xE6, 0x67, 0x67, 0x72, 0x74, 0x58, 0x4E, 0x51, 0x5B, 0x63, 0x5E, 0x5C,
+        0x4F, 0x50, 0x5B, 0x5B, 0x5D, 0x59, 0x52, 0x51, 0x66, 0xE4, 0xE1, 0xEA, 0xEE, 0xD6, 0xCE, 0xD1,
+        0xDD, 0xE9, 0xE1, 0xDD, 0xCE, 0xCD, 0xD5, 0xD4, 0xD6, 0xD3, 0xCF, 0xCF, 0xE5, 0x64, 0x5F, 0x6A,
+        0x72, 0x57, 0x4E, 0x52, 0x5D, 0x6B, 0x60, 0x5A, 0x4C, 0x4B, 0x53, 0x53, 0x57, 0x54, 0x4F, 0x52,
+        0x69, 0xE1, 0xDD, 0xEA, 0xEF, 0xD4, 0xCC, 0xCE, 0xD8, 0xE2, 0xDA, 0xD5, 0xCA, 0xCB, 0xD5, 0xD5,
+        0xD9, 0xD7, 0xD1, 0xD2, 0xE8, 0x61, 0x5C, 0x67, 0x69, 0x50, 0x4A, 0x4B, 0x53, 0x5D, 0x58, 0x52,
+        0x4A, 0x4A, 0x55, 0x55, 0x59, 0x58, 0x50, 0x51, 0x63, 0xE5, 0xDE, 0xE8, 0xED, 0xD2, 0xC9, 0xCB,
+        0xD2, 0xDC, 0xD4, 0xCF, 0xC8, 0xC9, 0xD2, 0xD4, 0xDB, 0xDC, 0xD4, 0xD4, 0xE8, 0x61, 0x5C, 0x67,
+        0x6C, 0x50, 0x48, 0x4A, 0x50, 0x59, 0x50, 0x4D, 0x46, 0x48, 0x52, 0x54, 0x5C, 0x5C, 0x55, 0x56,
+        0x6A, 0xE1, 0xDD, 0xE7, 0xEA, 0xD1, 0xC9, 0xCB, 0xD3, 0xDA, 0xD1, 0xCD, 0xC7, 0xC9, 0xD2, 0xD5,
+        0xDD, 0xDC, 0xD6, 0xD7, 0xEF, 0x5D, 0x5A, 0x60, 0x64, 0x4F, 0x49, 0x4B, 0x52, 0x57, 0x4E, 0x4B,
+        0x45, 0x47, 0x4F, 0x54, 0x5B, 0x5A, 0x53, 0x54, 0x6B, 0xDF, 0xDC, 0xE4, 0xE9, 0xD2, 0xCA, 0xCC,
+        0xD4, 0xDA, 0xD0, 0xCC, 0xC6, 0xC8, 0xD1, 0xD5, 0xDD, 0xDC, 0xD4, 0xD5, 0xEF, 0x5C, 0x5A, 0x60,
+        0x62, 0x4F, 0x48, 0x4B, 0x51, 0x55, 0x4D, 0x49, 0x42, 0x43, 0x4C, 0x4F, 0x58, 0x58, 0x51, 0x54,
+        0x6F, 0xDC, 0xDA, 0xDE, 0xE0, 0xCF, 0xC9, 0xCA, 0xCF, 0xD4, 0xCC, 0xC8, 0xC1, 0xC3, 0xCD, 0xD1,
+        0xDD, 0xE0, 0xD9, 0xDB, 0x78, 0x57, 0x56, 0x5C, 0x5F, 0x4F, 0x48, 0x4A, 0x4F, 0x53, 0x4B, 0x47,
+        0x40, 0x43, 0x4D, 0x52, 0x61, 0x61, 0x58, 0x59, 0x7C, 0xDA, 0xDA, 0xDF, 0xE6, 0xD2, 0xCA, 0xCB,
+        0xD1, 0xD6, 0xCD, 0xC9, 0xC2, 0xC5, 0xCE, 0xD3, 0xE4, 0xE5, 0xDB, 0xDA, 0xF6, 0x5B, 0x5B, 0x60,
+        0x62, 0x50, 0x4A, 0x4B, 0x51, 0x57, 0x4D, 0x48, 0x42, 0x44, 0x4E, 0x52, 0x61, 0x63, 0x5A, 0x59,
+        0x6F, 0xDC, 0xDB, 0xDF, 0xDF, 0xD1, 0xCB, 0xCD, 0xD4, 0xD9, 0xCD, 0xC8, 0xC2, 0xC5, 0xCD, 0xD0,
+        0xDD, 0xDF, 0xD7, 0xD5, 0xEA, 0x5E, 0x5E, 0x63, 0x64, 0x54, 0x4D, 0x50, 0x5B, 0x5F, 0x51, 0x4B,
+        0x45, 0x47, 0x50, 0x54, 0x5E, 0x5F, 0x57, 0x57, 0x6F, 0xDB, 0xDB, 0xDD, 0xDD, 0xD0, 0xCC, 0xD0,
+        0xDA, 0xDD, 0xD2, 0xCC, 0xC6, 0xC8, 0xD0, 0xD4, 0xDD, 0xDB, 0xD3, 0xD6, 0xED, 0x5C, 0x5B, 0x5D,
+        0x5B, 0x4F, 0x4C, 0x52, 0x5B, 0x5E, 0x53, 0x4D, 0x47, 0x48, 0x51, 0x55, 0x5F, 0x5D, 0x53, 0x55,
+        0x6F, 0xDA, 0xD7, 0xD8, 0xD5, 0xCD, 0xCB, 0xCF, 0xD7, 0xD8, 0xCE, 0xCA, 0xC4, 0xC6, 0xCF, 0xD3,
+        0xDD, 0xDB, 0xD0, 0xD3, 0xEC, 0x5C, 0x59, 0x5A, 0x58, 0x4F, 0x4C, 0x50, 0x56, 0x55, 0x4C, 0x49,
+        0x44, 0x47, 0x50, 0x56, 0x62, 0x60, 0x56, 0x59, 0x79, 0xD8, 0xD4, 0xD5, 0xD2, 0xCC, 0xC9, 0xCC,
+        0xCF, 0xCF, 0xCA, 0xC7, 0xC4, 0xC7, 0xD3, 0xD9, 0xE7, 0xE9, 0xDC, 0xDD, 0x78, 0x56, 0x50, 0x4F,
+        0x4E, 0x49, 0x46, 0x49, 0x4D, 0x4E, 0x4A, 0x47, 0x45, 0x49, 0x58, 0x5F, 0x6F, 0x75, 0x61, 0x64,
+        0xEC, 0xD3, 0xCD, 0xCC, 0xCB, 0xC7, 0xC3, 0xC6, 0xCA, 0xCC, 0xC9, 0xC8, 0xC7, 0xCB, 0xDA, 0xDE,
+        0xED, 0xF2, 0xDE, 0xE1, 0x6E, 0x54, 0x4D, 0x4C, 0x4B, 0x47, 0x43, 0x47, 0x4B, 0x4D, 0x4A, 0x49,
+        0x49, 0x4D, 0x5C, 0x60, 0x74, 0x7E, 0x65, 0x69, 0xE9, 0xD2, 0xCC, 0xCB, 0xCB, 0xC7, 0xC4, 0xC6,
+        0xCB, 0xCD, 0xCB, 0xCA, 0xCB, 0xCF, 0xDF, 0xE4, 0x7B, 0x6B, 0xF4, 0xF8, 0x5F, 0x4E, 0x4A, 0x49,
+        0x48, 0x44, 0x42, 0x45, 0x4C, 0x4E, 0x4C, 0x4C, 0x4D, 0x52, 0x60, 0x64, 0xF5, 0xE5, 0xFD, 0xFE,
+        0xDD, 0xCD, 0xC8, 0xC7, 0xC6, 0xC4, 0xC3, 0xC7, 0xCD, 0xCF, 0xCC, 0xCC, 0xCB, 0xCF, 0xDD, 0xDF,
+        0x7D, 0x67, 0x7D, 0x7B, 0x5F, 0x4F, 0x4A, 0x48, 0x47, 0x44, 0x43, 0x46, 0x4C, 0x4E, 0x4B, 0x4B,
+        0x4A, 0x4D, 0x59, 0x5B, 0x70, 0xEE, 0x78, 0x73, 0xE8, 0xD2, 0xCB, 0xC9, 0xC7, 0xC4, 0xC3, 0xC6,
+        0xCB, 0xCD, 0xCA, 0xCA, 0xC9, 0xCD, 0xD6, 0xD9, 0xED, 0x6E, 0xFD, 0xFA, 0x63, 0x4F, 0x4A, 0x48,
+        0x46, 0x43, 0x42, 0x45, 0x4A, 0x4B, 0x48, 0x48, 0x47, 0x49, 0x51, 0x57, 0x6E, 0xEA, 0xF8, 0xFC,
+        0xDF, 0xCF, 0xCB, 0xC9, 0xC8, 0xC5, 0xC5, 0xC7, 0xCB, 0xCD, 0xCA, 0xCA, 0xC8, 0xCB, 0xD4, 0xDB,
+        0x7F, 0x60, 0x69, 0x6A, 0x59, 0x4B, 0x47, 0x47, 0x46, 0x44, 0x44, 0x46, 0x49, 0x4B, 0x48, 0x47,
+        0x45, 0x47, 0x4E, 0x54, 0x6E, 0xE3, 0xE8, 0xE8, 0xD7, 0xCB, 0xC7, 0xC8, 0xC7, 0xC5, 0xC4, 0xC6,
+        0xC9, 0xCA, 0xC8, 0xC8, 0xC5, 0xC5, 0xCD, 0xD6, 0xF8, 0x5E, 0x61, 0x60, 0x53, 0x49, 0x45, 0x45,
+        0x44, 0x42, 0x42, 0x44, 0x47, 0x48, 0x46, 0x46, 0x43, 0x45, 0x4D, 0x58, 0xFF, 0xDD, 0xDF, 0xDF,
+        0xD3, 0xC9, 0xC5, 0xC5, 0xC5, 0xC3, 0xC3, 0xC5, 0xC8, 0xC9, 0xC7, 0xC7, 0xC4, 0xC7, 0xD1, 0xDE,
+        0x6C, 0x59, 0x5C, 0x5C, 0x51, 0x48, 0x45, 0x45, 0x45, 0x43, 0x44, 0x46, 0x49, 0x49, 0x47, 0x47,
+        0x45, 0x48, 0x55, 0x67, 0xE0, 0xD5, 0xD8, 0xD9, 0xCF, 0xC8, 0xC5, 0xC5, 0xC6, 0xC4, 0xC5, 0xC8,
+        0xCA, 0xCB, 0xC8, 0xC7, 0xC4, 0xC8, 0xD6, 0xEA, 0x5F, 0x54, 0x59, 0x5C, 0x53, 0x4B, 0x48, 0x49,
+        0x49, 0x48, 0x49, 0x4A, 0x4C, 0x4D, 0x4A, 0x49, 0x47, 0x4B, 0x5C, 0x7C, 0xDB, 0xD3, 0xD9, 0xDC,
+        0xD4, 0xCB, 0xC9, 0xC9, 0xCA, 0xC9, 0xCA, 0xCB, 0xCE, 0xCF, 0xCC, 0xCC, 0xC9, 0xCC, 0xDB, 0xF5,
+        0x5C, 0x55, 0x5A, 0x5D, 0x55, 0x4C, 0x4A, 0x4B, 0x4D, 0x4B, 0x4C, 0x4F, 0x52, 0x55, 0x51, 0x4F,
+        0x4C, 0x4E, 0x5E, 0xF9, 0xD7, 0xCF, 0xD4, 0xD7, 0xCF, 0xCA, 0xC8, 0xC9, 0xCB, 0xCA, 0xCA, 0xCE,
+        0xD3, 0xD7, 0xD4, 0xD1, 0xCD, 0xCE, 0xDD, 0xFE, 0x58, 0x4F, 0x54, 0x58, 0x50, 0x4A, 0x49, 0x4A,
+        0x4C, 0x4B, 0x4C, 0x52, 0x59, 0x5C, 0x56, 0x51, 0x4C, 0x4C, 0x57, 0x6C, 0xDC, 0xD3, 0xD7, 0xD9,
+        0xD0, 0xCA, 0xC8, 0xCA, 0xCD, 0xCC, 0xCD, 0xD3, 0xD7, 0xD6, 0xCF, 0xCD, 0xCA, 0xCB, 0xD5, 0xE9,
+        0x5F, 0x56, 0x5A, 0x5A, 0x50, 0x4A, 0x49, 0x4B, 0x4E, 0x4D, 0x4E, 0x52, 0x55, 0x53, 0x4E, 0x4D,
+        0x4A, 0x4B, 0x57, 0x6E, 0xDE, 0xD7, 0xDA, 0xDA, 0xCF, 0xCA, 0xC9, 0xCB, 0xCE, 0xCD, 0xCE, 0xD2,
+        0xD6, 0xD3, 0xCD, 0xCC, 0xC9, 0xCB, 0xDA, 0x7D, 0x5A, 0x54, 0x58, 0x59, 0x4F, 0x4A, 0x49, 0x4A,
+        0x4D, 0x4C, 0x4E, 0x53, 0x57, 0x54, 0x4E, 0x4C, 0x4A, 0x4D, 0x5F, 0xF0, 0xD9, 0xD5, 0xD9, 0xDA,
+        0xCF, 0xCA, 0xC8, 0xCA, 0xCD, 0xCC, 0xCD, 0xD2, 0xD6, 0xD5, 0xCE, 0xCD, 0xCC, 0xCF, 0xE1, 0x71,
+        0x5B, 0x56, 0x58, 0x59, 0x4F, 0x4A, 0x48, 0x4B, 0x4E, 0x4C, 0x4C, 0x4F, 0x53, 0x53, 0x4D, 0x4D,
+        0x4C, 0x4F, 0x5F, 0xF5, 0xDC, 0xD5, 0xD7, 0xD9, 0xD1, 0xCB, 0xCA, 0xCC, 0xCE, 0xCB, 0xCB, 0xCF,
+        0xD4, 0xD4, 0xCE, 0xCD, 0xCD, 0xCF, 0xE2, 0x6F, 0x5A, 0x53, 0x54, 0x56, 0x4E, 0x49, 0x47, 0x49,
+        0x4B, 0x48, 0x4A, 0x50, 0x57, 0x57, 0x4F, 0x4F, 0x4F, 0x53, 0x67, 0xED, 0xD9, 0xD2, 0xD2, 0xD1,
+        0xCB, 0xC6, 0xC5, 0xC7, 0xCA, 0xC8, 0xCB, 0xD1, 0xD9, 0xDA, 0xD3, 0xD4, 0xD4, 0xD8, 0xEF, 0x69,
+        0x58, 0x51, 0x51, 0x4F, 0x4A, 0x44, 0x43, 0x46, 0x48, 0x46, 0x49, 0x4F, 0x57, 0x5A, 0x54, 0x55,
+        0x54, 0x57, 0x6B, 0xEE, 0xDB, 0xD3, 0xD3, 0xD1, 0xCC, 0xC6, 0xC6, 0xC9, 0xCB, 0xC9, 0xCB, 0xD1,
+        0xDB, 0xDD, 0xD7, 0xD6, 0xD4, 0xD6, 0xEA, 0x6E, 0x59, 0x50, 0x52, 0x53, 0x4D, 0x48, 0x48, 0x4B,
+        0x4D, 0x4B, 0x4C, 0x54, 0x5D, 0x5E, 0x57, 0x56, 0x54, 0x57, 0x6C, 0xEA, 0xD6, 0xCF, 0xD1, 0xD3,
+        0xCD, 0xC8, 0xC7, 0xCB, 0xCD, 0xCB, 0xCD, 0xD5, 0xDD, 0xDC, 0xD5, 0xD6, 0xD6, 0xDA, 0xF8, 0x61,
+        0x51, 0x4D, 0x4F, 0x51, 0x4C, 0x47, 0x47, 0x4B, 0x4D, 0x4A, 0x4C, 0x53, 0x5B, 0x5A, 0x54, 0x56,
+        0x56, 0x5A, 0x71, 0xE4, 0xD3, 0xCD, 0xD0, 0xD1, 0xCC, 0xC7, 0xC8, 0xCB, 0xCC, 0xCA, 0xCB, 0xD2,
+        0xDB, 0xDA, 0xD3, 0xD4, 0xD3, 0xD7, 0xEB, 0x69, 0x54, 0x4E, 0x51, 0x52, 0x4C, 0x48, 0x48, 0x4C,
+        0x4D, 0x4B, 0x4C, 0x53, 0x5C, 0x5A, 0x54, 0x54, 0x54, 0x59, 0x6F, 0xE6, 0xD5, 0xD0, 0xD6, 0xD6,
+        0xCF, 0xCB, 0xCB, 0xCE, 0xCF, 0xCC, 0xCC, 0xD2, 0xDB, 0xDA, 0xD5, 0xD7, 0xD8, 0xDE, 0x7B, 0x61,
+        0x56, 0x54, 0x5A, 0x5B, 0x52, 0x4D, 0x4D, 0x52, 0x53, 0x4D, 0x4C, 0x52, 0x5C, 0x5C, 0x57, 0x59,
+        0x59, 0x5E, 0x7E, 0xE3, 0xD6, 0xD4, 0xDA, 0xDA, 0xD3, 0xCE, 0xD0, 0xD7, 0xD7, 0xCE, 0xCC, 0xD2,
+        0xDB, 0xDB, 0xD6, 0xD8, 0xD7, 0xDC, 0xF5, 0x66, 0x57, 0x55, 0x5B, 0x5C, 0x56, 0x50, 0x53, 0x5A,
+        0x58, 0x4E, 0x4C, 0x51, 0x59, 0x58, 0x54, 0x57, 0x56, 0x5C, 0x75, 0xE4, 0xD6, 0xD5, 0xD9, 0xD9,
+        0xD3, 0xCF, 0xD2, 0xD9, 0xD7, 0xCE, 0xCD, 0xD0, 0xD7, 0xD5, 0xD2, 0xD6, 0xD6, 0xDC, 0xF3, 0x67,
+        0x59, 0x57, 0x59, 0x59, 0x53, 0x50, 0x55, 0x5B, 0x59, 0x4F, 0x4D, 0x50, 0x56, 0x54, 0x51, 0x54,
+        0x54, 0x5A, 0x6C, 0xEF, 0xDE, 0xDB, 0xDB, 0xD8, 0xD0, 0xCE, 0xD0, 0xD6, 0xD4, 0xCD, 0xCB, 0xCE,
+        0xD3, 0xD1, 0xCF, 0xD3, 0xD4, 0xDB, 0xEE, 0x72, 0x5F, 0x5C, 0x5C, 0x57, 0x4F, 0x4D, 0x4F, 0x55,
+        0x53, 0x4C, 0x4B, 0x4D, 0x51, 0x50, 0x4F, 0x54, 0x57, 0x5F, 0x77, 0xED, 0xDE, 0xDC, 0xDD, 0xD9,
+        0xD2, 0xCF, 0xD3, 0xD8, 0xD5, 0xCD, 0xCA, 0xCD, 0xD0, 0xD0, 0xD0, 0xD5, 0xD9, 0xE2, 0xFA, 0x6C,
+        0x5E, 0x5B, 0x5B, 0x57, 0x4F, 0x4E, 0x51, 0x58, 0x56, 0x4E, 0x4B, 0x4E, 0x50, 0x4F, 0x4F, 0x54,
+        0x58, 0x61, 0x7B, 0xE9, 0xDA, 0xD7, 0xD7, 0xD1, 0xCD, 0xCD, 0xD1, 0xD9, 0xD8, 0xCF, 0xCD, 0xCF,
+        0xD3, 0xD1, 0xD1, 0xD8, 0xDC, 0xE8, 0x77, 0x63, 0x57, 0x55, 0x55, 0x50, 0x4D, 0x4D, 0x52, 0x59,
+        0x59, 0x50, 0x4E, 0x51, 0x54, 0x53, 0x51, 0x59, 0x5E, 0x6A, 0xF2, 0xE2, 0xD7, 0xD5, 0xD6, 0xD2,
+        0xCE, 0xCD, 0xCF, 0xD5, 0xD5, 0xCE, 0xCD, 0xD0, 0xD3, 0xD1, 0xD0, 0xD8, 0xDE, 0xEC, 0x71, 0x62,
+        0x57, 0x55, 0x56, 0x51, 0x4C, 0x4B, 0x4D, 0x50, 0x51, 0x4D, 0x4D, 0x51, 0x56, 0x54, 0x52, 0x59,
+        0x5E, 0x6A, 0xFD, 0xEA, 0xDB, 0xD7, 0xD6, 0xD0, 0xCC, 0xC9, 0xCB, 0xCE, 0xCF, 0xCC, 0xCC, 0xD1,
+        0xD6, 0xD2, 0xCF, 0xD5, 0xDA, 0xE0, 0xEC, 0x7E, 0x63, 0x5E, 0x5C, 0x56, 0x4E, 0x4B, 0x4D, 0x50,
+        0x50, 0x4D, 0x4D, 0x52, 0x57, 0x52, 0x4F, 0x55, 0x59, 0x5E, 0x68, 0x75, 0xEA, 0xE2, 0xE0, 0xDA,
+        0xD0, 0xCD, 0xCF, 0xD4, 0xD4, 0xCF, 0xCE, 0xD3, 0xD8, 0xD2, 0xCF, 0xD3, 0xD7, 0xDC, 0xE3, 0xED,
+        0x6D, 0x64, 0x60, 0x5A, 0x51, 0x4D, 0x4F, 0x53, 0x52, 0x4E, 0x4D, 0x50, 0x54, 0x4F, 0x4C, 0x4F,
+        0x53, 0x5B, 0x61, 0x6D, 0xEC, 0xE1, 0xDE, 0xD8, 0xCF, 0xCB, 0xCB, 0xCE, 0xCE, 0xCC, 0xCB, 0xCF,
+        0xD2, 0xCE, 0xCC, 0xCE, 0xD3, 0xDC, 0xE4, 0xF0, 0x68, 0x5E, 0x5B, 0x54, 0x4D, 0x49, 0x49, 0x4C,
+        0x4D, 0x4B, 0x4A, 0x4D, 0x4F, 0x4C, 0x4A, 0x4C, 0x50, 0x59, 0x5F, 0x6B, 0xEA, 0xDD, 0xDB, 0xD6,
+        0xCE, 0xC9, 0xCA, 0xCD, 0xCE, 0xCC, 0xCB, 0xCD, 0xCE, 0xCB, 0xC9, 0xCC, 0xCF, 0xD9, 0xE0, 0xEC,
+        0x66, 0x5B, 0x59, 0x54, 0x4D, 0x48, 0x48, 0x4C, 0x4E, 0x4C, 0x4B, 0x4C, 0x4E, 0x4B, 0x49, 0x4B,
+        0x4F, 0x58, 0x5F, 0x6C, 0xE5, 0xD9, 0xD6, 0xD0, 0xCB, 0xC7, 0xC8, 0xCC, 0xCF, 0xCD, 0xCB, 0xCC,
+        0xCD, 0xCA, 0xC9, 0xCB, 0xCF, 0xD9, 0xDF, 0xED, 0x62, 0x57, 0x55, 0x50, 0x4C, 0x48, 0x49, 0x4E,
+        0x51, 0x4F, 0x4D, 0x4E, 0x4F, 0x4C, 0x4B, 0x4D, 0x51, 0x5A, 0x60, 0x6E, 0xE4, 0xD9, 0xD7, 0xD2,
+        0xCD, 0xCA, 0xCB, 0xD0, 0xD6, 0xD3, 0xCF, 0xD0, 0xD1, 0xCD, 0xCB, 0xCD, 0xD0, 0xDA, 0xE1, 0xF0,
+        0x62, 0x58, 0x55, 0x51, 0x4D, 0x4B, 0x4C, 0x51, 0x57, 0x55, 0x52, 0x52, 0x52, 0x4D, 0x4B, 0x4D,
+        0x50, 0x5A, 0x65, 0x7C, 0xDD, 0xD4, 0xD1, 0xCF, 0xCD, 0xCA, 0xCB, 0xCF, 0xD5, 0xD4, 0xD1, 0xD1,
+        0xD0, 0xCC, 0xCA, 0xCB, 0xCF, 0xD8, 0xE5, 0x7C, 0x5C, 0x54, 0x51, 0x4F, 0x4D, 0x4A, 0x4B, 0x50,
+        0x57, 0x58, 0x54, 0x52, 0x50, 0x4C, 0x4A, 0x4B, 0x4F, 0x59, 0x66, 0xF7, 0xDB, 0xD4, 0xD2, 0xCF,
+        0xCC, 0xCA, 0xCC, 0xD2, 0xDB, 0xDB, 0xD5, 0xD2, 0xCF, 0xCC, 0xCA, 0xCC, 0xD0, 0xDB, 0xED, 0x6C,
+        0x59, 0x54, 0x52, 0x4E, 0x4C, 0x4A, 0x4C, 0x53, 0x5B, 0x5A, 0x54, 0x51, 0x4F, 0x4D, 0x4B, 0x4E,
+        0x54, 0x61, 0x7E, 0xE6, 0xD8, 0xD4, 0xD2, 0xCE, 0xCB, 0xC9, 0xCA, 0xCF, 0xD5, 0xD5, 0xD0, 0xCF,
+        0xCE, 0xCC, 0xCC, 0xCE, 0xD6, 0xE1, 0xF9, 0x69, 0x58, 0x53, 0x50, 0x4C, 0x4A, 0x47, 0x49, 0x4E,
+        0x53, 0x54, 0x4F, 0x4F, 0x4E, 0x4D, 0x4C, 0x4E, 0x55, 0x60, 0x7C, 0xE4, 0xD5, 0xD0, 0xCE, 0xCB,
+        0xC9, 0xC7, 0xC8, 0xCD, 0xD1, 0xD2, 0xCF, 0xCE, 0xCE, 0xCC, 0xCB, 0xCE, 0xD4, 0xDF, 0xFD, 0x63,
+        0x54, 0x4F, 0x4D, 0x4A, 0x48, 0x46, 0x47, 0x4C, 0x50, 0x51, 0x4F, 0x4E, 0x4D, 0x4B, 0x49, 0x4B,
+        0x4F, 0x5A, 0x6D, 0xEB, 0xD8, 0xD1, 0xCE, 0xCA, 0xC7, 0xC5, 0xC7, 0xCC, 0xD0, 0xD1, 0xCF, 0xCE,
+        0xCE, 0xCA, 0xC8, 0xCA, 0xCE, 0xDA, 0xEE, 0x6A, 0x56, 0x4F, 0x4C, 0x48, 0x45, 0x43, 0x45, 0x4B,
+        0x4F, 0x52, 0x51, 0x4F, 0x4E, 0x4A, 0x47, 0x49, 0x4D, 0x59, 0x6E, 0xEA, 0xD7, 0xD0, 0xCC, 0xC8,
+        0xC5, 0xC2, 0xC6, 0xCC, 0xD1, 0xD4, 0xD1, 0xCF, 0xCD, 0xC9, 0xC6, 0xC8, 0xCC, 0xD8, 0xED, 0x6A,
+        0x57, 0x4F, 0x4B, 0x46, 0x43, 0x41, 0x45, 0x4B, 0x4F, 0x52, 0x50, 0x4E, 0x4C, 0x47, 0x45, 0x47,
+        0x4C, 0x58, 0x6D, 0xE9, 0xD5, 0xCE, 0xCA, 0xC5, 0xC2, 0xC0, 0xC4, 0xCB, 0xCF, 0xD3, 0xD1, 0xCE,
+        0xCC, 0xC8, 0xC6, 0xC8, 0xCC, 0xD8, 0xEF, 0x65, 0x54, 0x4D, 0x49, 0x44, 0x42, 0x40, 0x44, 0x4B,
+        0x50, 0x54, 0x51, 0x4F, 0x4C, 0x48, 0x46, 0x48, 0x4D, 0x58, 0x6F, 0xE7, 0xD4, 0xCD, 0xC8, 0xC4,
+        0xC1, 0xC0, 0xC4, 0xCB, 0xD0, 0xD4, 0xD2, 0xCF, 0xCE, 0xCA, 0xC8, 0xCB, 0xCF, 0xDB, 0xF5, 0x65,
+        0x53, 0x4C, 0x47, 0x43, 0x40, 0x3F, 0x43, 0x4A, 0x4F, 0x53, 0x51, 0x4F, 0x4D, 0x4A, 0x48, 0x4B,
+        0x4F, 0x5C, 0x71, 0xE8, 0xD5, 0xCD, 0xC8, 0xC3, 0xC1, 0xBF, 0xC4, 0xCB, 0xCF, 0xD3, 0xD2, 0xD0,
+        0xCD, 0xCB, 0xCA, 0xCD, 0xD1, 0xDB, 0xEE, 0x6A, 0x56, 0x4D, 0x49, 0x44, 0x42, 0x40, 0x44, 0x4B,
+        0x51, 0x55, 0x54, 0x50, 0x4E, 0x4B, 0x4A, 0x4C, 0x4F, 0x59, 0x6C, 0xEA, 0xD5, 0xCD, 0xC8, 0xC4,
+        0xC2, 0xC0, 0xC4, 0xCB, 0xD0, 0xD4, 0xD2, 0xCF, 0xCD, 0xCA, 0xCA, 0xCB, 0xCE, 0xD8, 0xED, 0x67,
+        0x53, 0x4D, 0x48, 0x44, 0x42, 0x40, 0x44, 0x4A, 0x4F, 0x52, 0x51, 0x4E, 0x4C, 0x4A, 0x49, 0x4B,
+        0x4E, 0x58, 0x6F, 0xE3, 0xD1, 0xCB, 0xC6, 0xC2, 0xC0, 0xBF, 0xC2, 0xC9, 0xCD, 0xCF, 0xCE, 0xCC,
+        0xC9, 0xC7, 0xC6, 0xC9, 0xCC, 0xD7, 0xF0, 0x63, 0x51, 0x4C, 0x48, 0x44, 0x42, 0x40, 0x43, 0x49,
+        0x4D, 0x4F, 0x4E, 0x4C, 0x49, 0x47, 0x47, 0x4A, 0x4E, 0x5B, 0x7B, 0xE0, 0xD2, 0xCD, 0xC9, 0xC5,
+        0xC1, 0xBF, 0xC1, 0xC7, 0xCC, 0xCE, 0xCD, 0xCB, 0xC8, 0xC6, 0xC6, 0xC9, 0xCD, 0xD9, 0xF4, 0x64,
+        0x55, 0x4F, 0x4B, 0x46, 0x42, 0x3F, 0x42, 0x48, 0x4D, 0x4F, 0x4E, 0x4C, 0x4A, 0x48, 0x47, 0x4A,
+        0x4F, 0x5C, 0x7D, 0xE1, 0xD4, 0xCF, 0xCB, 0xC7, 0xC3, 0xC0, 0xC3, 0xC9, 0xCD, 0xD0, 0xCF, 0xCE,
+        0xCC, 0xCA, 0xC9, 0xCC, 0xD1, 0xDE, 0x77, 0x5E, 0x52, 0x4E, 0x4A, 0x45, 0x42, 0x40, 0x43, 0x48,
+        0x4D, 0x50, 0x50, 0x4E, 0x4B, 0x49, 0x49, 0x4C, 0x52, 0x60, 0xF2, 0xDD, 0xD2, 0xCD, 0xCA, 0xC5,
+        0xC3, 0xC1, 0xC4, 0xCA, 0xCE, 0xD2, 0xD2, 0xCF, 0xCC, 0xCA, 0xC9, 0xCD, 0xD4, 0xE6, 0x6B, 0x5A,
+        0x4F, 0x4C, 0x49, 0x46, 0x44, 0x43, 0x46, 0x4B, 0x4F, 0x53, 0x52, 0x4E, 0x4C, 0x4A, 0x49, 0x4D,
+        0x54, 0x65, 0xEE, 0xDC, 0xD1, 0xCD, 0xCA, 0xC6, 0xC4, 0xC3, 0xC6, 0xCB, 0xCF, 0xD2, 0xD0, 0xCE,
+        0xCC, 0xC9, 0xC9, 0xCC, 0xD1, 0xDF, 0x75, 0x5D, 0x52, 0x4E, 0x4A, 0x46, 0x45, 0x44, 0x47, 0x4C,
+        0x50, 0x52, 0x50, 0x4E, 0x4C, 0x4A, 0x49, 0x4C, 0x51, 0x5F, 0xF7, 0xDE, 0xD3, 0xCE, 0xCA, 0xC6,
+        0xC5, 0xC4, 0xC7, 0xCB, 0xCF, 0xD1, 0xD0, 0xCE, 0xCC, 0xCA, 0xC9, 0xCB, 0xCF, 0xDC, 0xFA, 0x64,
+        0x55, 0x4F, 0x4B, 0x47, 0x46, 0x45, 0x47, 0x4B, 0x4F, 0x52, 0x51, 0x4F, 0x4E, 0x4C, 0x4A, 0x4C,
+        0x4F, 0x5C, 0x75, 0xE7, 0xD7, 0xD0, 0xCC, 0xC8, 0xC7, 0xC6, 0xC8, 0xCD, 0xD2, 0xD5, 0xD4, 0xD2,
+        0xCF, 0xCC, 0xC9, 0xCA, 0xCE, 0xD9, 0xEC, 0x6E, 0x5A, 0x53, 0x4E, 0x4A, 0x48, 0x47, 0x49, 0x4D,
+        0x53, 0x55, 0x54, 0x50, 0x4D, 0x4A, 0x48, 0x49, 0x4D, 0x5A, 0x6F, 0xEC, 0xDA, 0xD4, 0xCE, 0xCB,
+        0xC9, 0xC8, 0xCA, 0xCE, 0xD4, 0xD7, 0xD5, 0xD1, 0xCE, 0xCA, 0xC8, 0xC9, 0xCE, 0xDC, 0xF7, 0x68,
+        0x59, 0x52, 0x4D, 0x4A, 0x48, 0x47, 0x48, 0x4D, 0x52, 0x54, 0x52, 0x4F, 0x4C, 0x49, 0x46, 0x49,
+        0x4E, 0x5D, 0x7A, 0xE7, 0xD8, 0xD0, 0xCC, 0xC9, 0xC7, 0xC6, 0xC8, 0xCC, 0xD2, 0xD5, 0xD3, 0xD0,
+        0xCD, 0xCA, 0xC8, 0xCA, 0xCF, 0xDD, 0xF9, 0x68, 0x59, 0x51, 0x4C, 0x49, 0x47, 0x45, 0x46, 0x4B,
+        0x51, 0x55, 0x53, 0x4F, 0x4D, 0x49, 0x47, 0x48, 0x4D, 0x58, 0x68, 0xF8, 0xDD, 0xD3, 0xCD, 0xC9,
+        0xC7, 0xC5, 0xC7, 0xCD, 0xD4, 0xD7, 0xD5, 0xD2, 0xCE, 0xCB, 0xC8, 0xC8, 0xCD, 0xD8, 0xE9, 0x72,
+        0x5B, 0x50, 0x4B, 0x48, 0x46, 0x45, 0x48, 0x4E, 0x56, 0x59, 0x56, 0x51, 0x4E, 0x4A, 0x47, 0x48,
+        0x4C, 0x57, 0x67, 0xF8, 0xDD, 0xD1, 0xCB, 0xC8, 0xC6, 0xC5, 0xC8, 0xCE, 0xD6, 0xD8, 0xD4, 0xCF,
+        0xCC, 0xC9, 0xC6, 0xC6, 0xCB, 0xD5, 0xE5, 0x7A, 0x5D, 0x52, 0x4B, 0x47, 0x46, 0x45, 0x48, 0x4E,
+        0x56, 0x58, 0x53, 0x4F, 0x4C, 0x4A, 0x47, 0x48, 0x4C, 0x57, 0x68, 0xF7, 0xDE, 0xD3, 0xCC, 0xC8,
+        0xC6, 0xC5, 0xC8, 0xCE, 0xD6, 0xD8, 0xD4, 0xD0, 0xCD, 0xCB, 0xC8, 0xC8, 0xCC, 0xD8, 0xE8, 0x7F,
+        0x61, 0x55, 0x4C, 0x48, 0x46, 0x45, 0x49, 0x4F, 0x59, 0x5B, 0x56, 0x52, 0x4E, 0x4B, 0x48, 0x49,
+        0x4D, 0x57, 0x65, 0x7B, 0xE2, 0xD5, 0xCC, 0xC7, 0xC5, 0xC5, 0xC9, 0xCF, 0xD9, 0xDA, 0xD5, 0xD0,
+        0xCD, 0xCA, 0xC8, 0xC9, 0xCD, 0xD9, 0xEB, 0x7C, 0x61, 0x55, 0x4C, 0x47, 0x44, 0x44, 0x47, 0x4E,
+        0x57, 0x59, 0x55, 0x50, 0x4E, 0x4C, 0x4B, 0x4C, 0x52, 0x5F, 0x74, 0xF6, 0xE2, 0xD6, 0xCD, 0xC7,
+        0xC5, 0xC4, 0xC7, 0xCD, 0xD5, 0xD8, 0xD4, 0xD0, 0xCF, 0xCE, 0xCD, 0xCE, 0xD5, 0xE3, 0xFC, 0x71,
+        0x63, 0x58, 0x4E, 0x49, 0x46, 0x44, 0x47, 0x4D, 0x55, 0x58, 0x54, 0x4F, 0x4E, 0x4D, 0x4D, 0x4F,
+        0x57, 0x66, 0xF9, 0xEC, 0xE0, 0xD7, 0xCE, 0xCA, 0xC7, 0xC4, 0xC7, 0xCC, 0xD3, 0xD6, 0xD0, 0xCD,
+        0xCC, 0xCC, 0xCC, 0xCE, 0xD4, 0xE3, 0x7C, 0x6C, 0x60, 0x58, 0x4F, 0x4A, 0x47, 0x45, 0x46, 0x4B,
+        0x51, 0x52, 0x4E, 0x4B, 0x4A, 0x4A, 0x49, 0x4B, 0x50, 0x5E, 0x76, 0xF4, 0xE5, 0xDA, 0xD1, 0xCC,
+        0xC9, 0xC6, 0xC7, 0xCC, 0xD1, 0xD2, 0xCE, 0xCB, 0xCA, 0xC9, 0xC9, 0xCA, 0xCF, 0xDB, 0xF0, 0x75,
+        0x64, 0x59, 0x4F, 0x4B, 0x48, 0x46, 0x47, 0x4C, 0x52, 0x54, 0x4F, 0x4C, 0x4A, 0x49, 0x48, 0x4A,
+        0x4E, 0x5B, 0x79, 0xEA, 0xDD, 0xD4, 0xCE, 0xCA, 0xC7, 0xC5, 0xC7, 0xCD, 0xD4, 0xD7, 0xD1, 0xCD,
+        0xCB, 0xC9, 0xC8, 0xC9, 0xCD, 0xDC, 0xFD, 0x68, 0x5B, 0x54, 0x4E, 0x4A, 0x48, 0x47, 0x49, 0x4E,
+        0x57, 0x59, 0x53, 0x4E, 0x4C, 0x4A, 0x49, 0x4A, 0x4F, 0x5E, 0xF8, 0xE2, 0xD8, 0xD1, 0xCD, 0xC9,
+        0xC7, 0xC6, 0xC8, 0xCD, 0xD5, 0xD6, 0xD1, 0xCD, 0xCB, 0xCA, 0xC9, 0xCA, 0xCF, 0xDD, 0x7A, 0x63,
+        0x59, 0x52, 0x4D, 0x4A, 0x47, 0x46, 0x48, 0x4E, 0x55, 0x57, 0x52, 0x4E, 0x4C, 0x4A, 0x49, 0x4B,
+        0x4F, 0x5D, 0x7F, 0xE5, 0xDA, 0xD2, 0xCD, 0xCA, 0xC8, 0xC7, 0xC9, 0xCE, 0xD5, 0xD6, 0xD1, 0xCE,
+        0xCC, 0xCB, 0xCA, 0xCB, 0xCF, 0xDD, 0xFE, 0x66, 0x59, 0x51, 0x4D, 0x4A, 0x47, 0x46, 0x48, 0x4D,
+        0x53, 0x55, 0x50, 0x4D, 0x4B, 0x4A, 0x4A, 0x4B, 0x4E, 0x5A, 0x70, 0xEE, 0xDE, 0xD5, 0xCF, 0xCC,
+        0xC9, 0xC8, 0xCB, 0xCF, 0xD8, 0xD8, 0xD2, 0xCE, 0xCC, 0xCB, 0xCA, 0xCA, 0xCE, 0xDA, 0xEE, 0x70,
+        0x5E, 0x55, 0x4F, 0x4C, 0x4A, 0x49, 0x4B, 0x4F, 0x56, 0x55, 0x4F, 0x4C, 0x4A, 0x48, 0x47, 0x48,
+        0x4C, 0x56, 0x66, 0xFD, 0xE1, 0xD6, 0xD0, 0xCD, 0xCC, 0xCA, 0xCC, 0xD0, 0xD6, 0xD5, 0xCF, 0xCC,
+        0xCA, 0xC9, 0xC8, 0xC9, 0xCD, 0xD8, 0xE8, 0x7B, 0x60, 0x56, 0x50, 0x4E, 0x4C, 0x4B, 0x4D, 0x51,
+        0x57, 0x55, 0x4F, 0x4C, 0x4B, 0x4A, 0x4A, 0x4B, 0x4E, 0x59, 0x67, 0x7E, 0xE3, 0xD8, 0xD2, 0xCF,
+        0xCD, 0xCB, 0xCD, 0xD0, 0xD7, 0xD6, 0xD0, 0xCD, 0xCC, 0xCB, 0xCA, 0xCB, 0xCE, 0xD7, 0xE2, 0xF2,
+        0x69, 0x5B, 0x53, 0x4F, 0x4C, 0x4A, 0x4C, 0x4F, 0x55, 0x55, 0x51, 0x4E, 0x4C, 0x4B, 0x4A, 0x4B,
+        0x4D, 0x55, 0x5F, 0x6E, 0xEA, 0xDB, 0xD3, 0xCE, 0xCC, 0xCA, 0xCB, 0xCE, 0xD4, 0xD5, 0xD1, 0xCE,
+        0xCD, 0xCB, 0xCB, 0xCB, 0xCE, 0xD6, 0xE0, 0xEF, 0x6C, 0x5C, 0x53, 0x4E, 0x4C, 0x4A, 0x4A, 0x4E,
+        0x53, 0x54, 0x50, 0x4E, 0x4C, 0x4B, 0x4A, 0x4B, 0x4D, 0x55, 0x60, 0x6E, 0xEC, 0xDC, 0xD2, 0xCD,
+        0xCB, 0xC9, 0xCA, 0xCD, 0xD1, 0xD3, 0xD0, 0xCE, 0xCD, 0xCB, 0xCA, 0xCB, 0xCD, 0xD5, 0xDF, 0xEE,
+        0x6D, 0x5C, 0x52, 0x4D, 0x4B, 0x49, 0x4A, 0x4E, 0x54, 0x57, 0x52, 0x4E, 0x4C, 0x4A, 0x49, 0x49,
+        0x4C, 0x54, 0x5F, 0x6C, 0xF0, 0xDD, 0xD4, 0xCE, 0xCB, 0xC9, 0xCB, 0xCE, 0xD6, 0xD7, 0xD2, 0xCD,
+        0xCA, 0xC8, 0xC7, 0xC8, 0xCC, 0xD5, 0xE0, 0xEE, 0x6E, 0x5D, 0x55, 0x4F, 0x4C, 0x4B, 0x4B, 0x4F,
+        0x56, 0x56, 0x50, 0x4D, 0x4A, 0x48, 0x48, 0x49, 0x4D, 0x59, 0x67, 0x79, 0xEA, 0xDC, 0xD5, 0xD0,
+        0xCD, 0xCB, 0xCC, 0xCF, 0xD6, 0xD7, 0xD1, 0xCD, 0xCA, 0xC8, 0xC7, 0xC9, 0xCD, 0xD6, 0xE1, 0xED,
+        0x71, 0x60, 0x59, 0x53, 0x4E, 0x4C, 0x4D, 0x51, 0x59, 0x5A, 0x54, 0x4E, 0x4B, 0x48, 0x47, 0x49,
+        0x4C, 0x54, 0x5E, 0x69, 0xF9, 0xE4, 0xDA, 0xD2, 0xCE, 0xCC, 0xCD, 0xD3, 0xDA, 0xDA, 0xD4, 0xCE,
+        0xCA, 0xC8, 0xC7, 0xC8, 0xCB, 0xD1, 0xDB, 0xE4, 0xFE, 0x66, 0x5A, 0x53, 0x4E, 0x4D, 0x4E, 0x55,
+        0x5B, 0x5B, 0x55, 0x4E, 0x4B, 0x48, 0x48, 0x49, 0x4C, 0x54, 0x5E, 0x6B, 0xF5, 0xE1, 0xD7, 0xD0,
+        0xCD, 0xCC, 0xCE, 0xD4, 0xDB, 0xDC, 0xD6, 0xCF, 0xCB, 0xC9, 0xC8, 0xC9, 0xCC, 0xD3, 0xDC, 0xE9,
+        0x79, 0x63, 0x59, 0x52, 0x4E, 0x4E, 0x50, 0x59, 0x61, 0x63, 0x5B, 0x53, 0x4D, 0x4A, 0x49, 0x49,
+        0x4B, 0x51, 0x5B, 0x67, 0xFA, 0xE1, 0xD7, 0xD0, 0xCE, 0xCD, 0xD0, 0xD9, 0xE1, 0xE4, 0xDD, 0xD4,
+        0xCE, 0xCB, 0xC9, 0xC9, 0xCB, 0xD0, 0xDB, 0xE9, 0x71, 0x5D, 0x54, 0x4E, 0x4D, 0x4D, 0x4F, 0x58,
+        0x61, 0x64, 0x5D, 0x55, 0x4E, 0x4B, 0x49, 0x49, 0x4B, 0x4F, 0x59, 0x68, 0xF1, 0xDD, 0xD5, 0xD0,
+        0xCE, 0xCF, 0xD3, 0xDC, 0xE8, 0xEA, 0xE1, 0xD8, 0xD0, 0xCD, 0xCB, 0xCB, 0xCD, 0xD3, 0xDE, 0xF4,
+        0x66, 0x59, 0x51, 0x4E, 0x4D, 0x4E, 0x52, 0x5B, 0x63, 0x64, 0x5D, 0x55, 0x4E, 0x4B, 0x4A, 0x4A,
+        0x4C, 0x52, 0x5E, 0x71, 0xEA, 0xDC, 0xD5, 0xD2, 0xD2, 0xD3, 0xD8, 0xDF, 0xE9, 0xE9, 0xDE, 0xD6,
+        0xCF, 0xCC, 0xCB, 0xCC, 0xCF, 0xD7, 0xE5, 0x7C, 0x65, 0x5B, 0x56, 0x53, 0x52, 0x52, 0x56, 0x5C,
+        0x63, 0x62, 0x5B, 0x53, 0x4D, 0x4B, 0x4B, 0x4C, 0x4E, 0x56, 0x62, 0x77, 0xEB, 0xDF, 0xD9, 0xD5,
+        0xD3, 0xD2, 0xD6, 0xDB, 0xE1, 0xE0, 0xDA, 0xD2, 0xCD, 0xCB, 0xCB, 0xCC, 0xCE, 0xD4, 0xDD, 0xEC,
+        0x74, 0x63, 0x5B, 0x56, 0x54, 0x53, 0x56, 0x5C, 0x63, 0x63, 0x5C, 0x55, 0x4F, 0x4C, 0x4C, 0x4C,
+        0x4E, 0x55, 0x5E, 0x70, 0xEC, 0xDD, 0xD6, 0xD2, 0xD0, 0xCF, 0xD2, 0xD9, 0xE0, 0xE1, 0xDB, 0xD4,
+        0xCE, 0xCC, 0xCB, 0xCB, 0xCE, 0xD4, 0xDE, 0xEF, 0x6D, 0x5F, 0x59, 0x55, 0x53, 0x53, 0x57, 0x5E,
+        0x6A, 0x6A, 0x5F, 0x57, 0x4F, 0x4C, 0x4C, 0x4C, 0x4F, 0x56, 0x60, 0x75, 0xEB, 0xDE, 0xD8, 0xD5,
+        0xD3, 0xD3, 0xD8, 0xDF, 0xE9, 0xE6, 0xDC, 0xD3, 0xCD, 0xCA, 0xCA, 0xCB, 0xCD, 0xD3, 0xDD, 0xED,
+        0x70, 0x62, 0x5B, 0x58, 0x57, 0x57, 0x5A, 0x5F, 0x67, 0x63, 0x5A, 0x51, 0x4C, 0x49, 0x49, 0x4A,
+        0x4C, 0x51, 0x5B, 0x6C, 0xF0, 0xE3, 0xDD, 0xDA, 0xD8, 0xD8, 0xDA, 0xDF, 0xE4, 0xE0, 0xD9, 0xD0,
+        0xCC, 0xC9, 0xC8, 0xC9, 0xCC, 0xD1, 0xDC, 0xEE, 0x6D, 0x61, 0x5C, 0x59, 0x57, 0x56, 0x58, 0x5C,
+        0x5F, 0x5D, 0x57, 0x4F, 0x4B, 0x49, 0x48, 0x49, 0x4B, 0x50, 0x5B, 0x6C, 0xEF, 0xE1, 0xDC, 0xD9,
+        0xD7, 0xD7, 0xD9, 0xDD, 0xDF, 0xDD, 0xD7, 0xD0, 0xCC, 0xCA, 0xC9, 0xCA, 0xCC, 0xD0, 0xDB, 0xEA,
+        0x71, 0x64, 0x5E, 0x5B, 0x5A, 0x59, 0x5B, 0x5E, 0x60, 0x5D, 0x57, 0x50, 0x4C, 0x4B, 0x4A, 0x4B,
+        0x4D, 0x52, 0x5C, 0x6C, 0xF0, 0xE4, 0xDE, 0xDC, 0xDA, 0xD8, 0xD9, 0xDC, 0xDD, 0xDA, 0xD4, 0xCE,
+        0xCC, 0xCA, 0xCA, 0xCB, 0xCD, 0xD4, 0xDE, 0xF0, 0x6E, 0x65, 0x5F, 0x5E, 0x5C, 0x5A, 0x5B, 0x5D,
+        0x5E, 0x5C, 0x56, 0x50, 0x4D, 0x4C, 0x4C, 0x4D, 0x4F, 0x58, 0x66, 0xFC, 0xE7, 0xE1, 0xDE, 0xDD,
+        0xDB, 0xD9, 0xD9, 0xDA, 0xDA, 0xD8, 0xD2, 0xCE, 0xCC, 0xCA, 0xCB, 0xCC, 0xCF, 0xD8, 0xE6, 0x7A,
+        0x68, 0x62, 0x60, 0x5F, 0x5D, 0x5A, 0x58, 0x59, 0x59, 0x57, 0x52, 0x4F, 0x4D, 0x4C, 0x4C, 0x4E,
+        0x52, 0x5C, 0x6C, 0xF6, 0xE8, 0xE5, 0xE3, 0xE2, 0xDF, 0xDC, 0xDB, 0xDB, 0xDC, 0xDB, 0xD7, 0xD4,
+        0xD0, 0xCF, 0xCF, 0xD0, 0xD6, 0xDF, 0xEF, 0x73, 0x67, 0x65, 0x64, 0x62, 0x5E, 0x5B, 0x59, 0x59,
+        0x5A, 0x58, 0x56, 0x53, 0x51, 0x4F, 0x4F, 0x50, 0x55, 0x5E, 0x6D, 0xF8, 0xEA, 0xE8, 0xE8, 0xE5,
+        0xE0, 0xDB, 0xD9, 0xDA, 0xDB, 0xDA, 0xD9, 0xD7, 0xD5, 0xD3, 0xD2, 0xD4, 0xD9, 0xE4, 0xF7, 0x6F,
+        0x68, 0x67, 0x68, 0x65, 0x5F, 0x59, 0x56, 0x57, 0x58, 0x57, 0x56, 0x54, 0x52, 0x50, 0x50, 0x51,
+        0x56, 0x5F, 0x6D, 0xFB, 0xED, 0xED, 0xED, 0xEA, 0xE2, 0xDB, 0xD7, 0xD7, 0xD8, 0xD7, 0xD5, 0xD4,
+        0xD2, 0xD1, 0xD1, 0xD3, 0xD7, 0xDF, 0xEF, 0x77, 0x6B, 0x6C, 0x6D, 0x6C, 0x66, 0x5D, 0x5A, 0x59,
+        0x59, 0x57, 0x55, 0x54, 0x53, 0x53, 0x53, 0x54, 0x58, 0x60, 0x6F, 0xF8, 0xED, 0xEF, 0xF4, 0xF3,
+        0xEB, 0xDF, 0xDB, 0xDA, 0xDA, 0xD8, 0xD5, 0xD4, 0xD2, 0xD1, 0xD1, 0xD2, 0xD6, 0xDD, 0xE8, 0xF8,
+        0x7B, 0x7D, 0xFE, 0x7B, 0x6D, 0x61, 0x5C, 0x5B, 0x5A, 0x58, 0x54, 0x52, 0x50, 0x4F, 0x4F, 0x50,
+        0x54, 0x5C, 0x67, 0x74, 0xFD, 0xFB, 0xF9, 0xF1, 0xE9, 0xDE, 0xDA, 0xD9, 0xD8, 0xD5, 0xD1, 0xCF,
+        0xCE, 0xCD, 0xCD, 0xCE, 0xD3, 0xDC, 0xE9, 0xF7, 0x7C, 0x7B, 0x7A, 0x76, 0x6B, 0x5F, 0x5B, 0x59,
+        0x57, 0x54, 0x50, 0x4E, 0x4D, 0x4D, 0x4D, 0x4E, 0x53, 0x5D, 0x6A, 0x78, 0xFE, 0x7D, 0x7B, 0xFE,
+        0xEF, 0xE3, 0xDD, 0xDA, 0xD8, 0xD4, 0xD1, 0xCF, 0xCE, 0xCD, 0xCD, 0xCF, 0xD4, 0xDE, 0xEC, 0xFC,
+        0x79, 0x7C, 0x7E, 0x7C, 0x71, 0x65, 0x5D, 0x5A, 0x57, 0x53, 0x4F, 0x4E, 0x4E, 0x4D, 0x4D, 0x4E,
+        0x53, 0x5C, 0x69, 0x76, 0x7E, 0x79, 0x73, 0x71, 0x7B, 0xED, 0xE0, 0xDC, 0xD7, 0xD2, 0xCF, 0xCE,
+        0xCD, 0xCD, 0xCD, 0xCE, 0xD1, 0xDB, 0xE6, 0xEF, 0xF6, 0xF1, 0xEE, 0xED, 0xF7, 0x6D, 0x5F, 0x5A,
+        0x55, 0x50, 0x4E, 0x4D, 0x4C, 0x4C, 0x4C, 0x4D, 0x50, 0x5A, 0x65, 0x6F, 0x77, 0x72, 0x6E, 0x6F,
+        0x7D, 0xE9, 0xDD, 0xD8, 0xD3, 0xCF, 0xCD, 0xCC, 0xCB, 0xCB, 0xCB, 0xCC, 0xCF, 0xDA, 0xE5, 0xF0,
+        0xF9, 0xF4, 0xEF, 0xEF, 0xFB, 0x6B, 0x5E, 0x59, 0x54, 0x4F, 0x4D, 0x4C, 0x4B, 0x4B, 0x4B, 0x4D,
+        0x51, 0x5C, 0x6A, 0x78, 0xFE, 0x7A, 0x72, 0x72, 0x7E, 0xEA, 0xDE, 0xD8, 0xD3, 0xCE, 0xCC, 0xCB,
+        0xCB, 0xCB, 0xCB, 0xCC, 0xD0, 0xDB, 0xE8, 0xF5, 0xFB, 0xF5, 0xEF, 0xEE, 0xF8, 0x6E, 0x61, 0x5B,
+        0x56, 0x4F, 0x4D, 0x4C, 0x4B, 0x4B, 0x4B, 0x4C, 0x50, 0x5B, 0x69, 0x79, 0xFE, 0xFE, 0x7D, 0xFE,
+        0xF2, 0xE6, 0xDD, 0xDA, 0xD4, 0xCF, 0xCD, 0xCB, 0xCA, 0xCA, 0xCA, 0xCC, 0xD0, 0xDC, 0xEB, 0xFE,
+        0x75, 0x73, 0x72, 0x6F, 0x6A, 0x62, 0x5E, 0x5B, 0x55, 0x4F, 0x4C, 0x4B, 0x4A, 0x49, 0x4A, 0x4C,
+        0x51, 0x5E, 0x6F, 0xF9, 0xF0, 0xEF, 0xEF, 0xEE, 0xEA, 0xE4, 0xDE, 0xDA, 0xD4, 0xCE, 0xCC, 0xCB,
+        0xCB, 0xCB, 0xCB, 0xCE, 0xD5, 0xE2, 0xFA, 0x73, 0x6E, 0x6F, 0x6F, 0x6D, 0x68, 0x61, 0x5C, 0x58,
+        0x52, 0x4D, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4E, 0x56, 0x66, 0xFA, 0xEB, 0xE9, 0xEB, 0xED, 0xED,
+        0xE9, 0xE0, 0xDB, 0xD6, 0xD0, 0xCD, 0xCB, 0xCB, 0xCC, 0xCC, 0xCD, 0xCF, 0xD9, 0xED, 0x6F, 0x66,
+        0x67, 0x6B, 0x70, 0x71, 0x6C, 0x62, 0x5B, 0x55, 0x4F, 0x4D, 0x4B, 0x4C, 0x4D, 0x4D, 0x4D, 0x50,
+        0x59, 0x6A, 0xF6, 0xEC, 0xED, 0xF4, 0xFB, 0xFA, 0xEE, 0xE4, 0xDB, 0xD6, 0xD1, 0xCE, 0xCD, 0xCD,
+        0xCE, 0xCE, 0xCE, 0xD0, 0xD9, 0xEA, 0x78, 0x6D, 0x6E, 0x75, 0x7B, 0x7C, 0x73, 0x68, 0x5E, 0x59,
+        0x54, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x5B, 0x6F, 0xEF, 0xE9, 0xEC, 0xF5, 0x7E, 0x79,
+        0xFE, 0xED, 0xE1, 0xDA, 0xD6, 0xD1, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0xD4, 0xDD, 0xF3, 0x6E, 0x6A,
+        0x6F, 0x7C, 0xF7, 0xF4, 0xFC, 0x6E, 0x61, 0x5A, 0x55, 0x51, 0x4F, 0x50, 0x51, 0x51, 0x52, 0x56,
+        0x5F, 0x77, 0xED, 0xEA, 0xEF, 0x7E, 0x72, 0x6F, 0x77, 0xF1, 0xE2, 0xDA, 0xD5, 0xD0, 0xCF, 0xCF,
+        0xD1, 0xD2, 0xD4, 0xD8, 0xE3, 0x7E, 0x69, 0x67, 0x71, 0xF9, 0xEE, 0xED, 0xF6, 0x6F, 0x5F, 0x58,
+        0x53, 0x50, 0x4F, 0x4F, 0x51, 0x53, 0x56, 0x5C, 0x68, 0xF8, 0xE9, 0xEA, 0xF9, 0x70, 0x6B, 0x6C,
+        0x77, 0xEE, 0xDF, 0xD8, 0xD4, 0xD0, 0xCF, 0xD0, 0xD2, 0xD5, 0xD9, 0xDE, 0xEC, 0x75, 0x69, 0x6B,
+        0x7A, 0xF3, 0xEE, 0xF0, 0x7E, 0x6A, 0x5D, 0x57, 0x53, 0x50, 0x4F, 0x50, 0x53, 0x55, 0x59, 0x5E,
+        0x6A, 0xFB, 0xED, 0xEF, 0xFC, 0x74, 0x6F, 0x74, 0xFB, 0xEB, 0xDF, 0xD9, 0xD6, 0xD3, 0xD2, 0xD3,
+        0xD4, 0xD7, 0xDB, 0xE1, 0xEF, 0x71, 0x67, 0x68, 0x6F, 0x7D, 0xF9, 0xF9, 0x7B, 0x6E, 0x63, 0x5C,
+        0x58, 0x55, 0x53, 0x53, 0x54, 0x56, 0x5A, 0x5F, 0x6E, 0xF0, 0xE6, 0xE8, 0xF4, 0x77, 0x6D, 0x6B,
+        0x6E, 0x7A, 0xEF, 0xE4, 0xDD, 0xD9, 0xD6, 0xD4, 0xD3, 0xD6, 0xDA, 0xE1, 0xF2, 0x6D, 0x64, 0x68,
+        0x77, 0xF0, 0xEA, 0xE6, 0xE9, 0xF1, 0x76, 0x67, 0x5E, 0x59, 0x54, 0x51, 0x51, 0x53, 0x58, 0x5E,
+        0x6C, 0xF5, 0xEA, 0xED, 0xFE, 0x6E, 0x68, 0x65, 0x68, 0x72, 0xF4, 0xE4, 0xDC, 0xD5, 0xD0, 0xCE,
+        0xCE, 0xCF, 0xD4, 0xDB, 0xE8, 0x7B, 0x6B, 0x6E, 0xFD, 0xEB, 0xE4, 0xE1, 0xE5, 0xEE, 0x78, 0x67,
+        0x5D, 0x57, 0x52, 0x4F, 0x4F, 0x51, 0x57, 0x5F, 0x6F, 0xEE, 0xE5, 0xEA, 0xFE, 0x6B, 0x62, 0x5F,
+        0x64, 0x6D, 0xF8, 0xE6, 0xDD, 0xD7, 0xD2, 0xCF, 0xCF, 0xD0, 0xD5, 0xDB, 0xE8, 0x7B, 0x6E, 0x77,
+        0xED, 0xDF, 0xDB, 0xDA, 0xDD, 0xE6, 0xF9, 0x6C, 0x5F, 0x59, 0x54, 0x51, 0x4F, 0x50, 0x53, 0x5A,
+        0x64, 0x7B, 0xF2, 0xFB, 0x6C, 0x5F, 0x5C, 0x5C, 0x5F, 0x6B, 0xFB, 0xE8, 0xDE, 0xD7, 0xD2, 0xCF,
+        0xCE, 0xCE, 0xD0, 0xD7, 0xE0, 0xF5, 0x75, 0x7D, 0xED, 0xE1, 0xDD, 0xDD, 0xE2, 0xED, 0x79, 0x68,
+        0x5E, 0x58, 0x52, 0x4F, 0x4E, 0x4F, 0x52, 0x58, 0x63, 0x7C, 0xF0, 0xF9, 0x6D, 0x61, 0x5D, 0x5E,
+        0x64, 0x6F, 0xF7, 0xE9, 0xE0, 0xDA, 0xD5, 0xD1, 0xD0, 0xD0, 0xD4, 0xDA, 0xE7, 0x7B, 0x6D, 0x75,
+        0xEE, 0xE2, 0xDE, 0xDE, 0xE5, 0xF0, 0x77, 0x6A, 0x62, 0x5C, 0x57, 0x53, 0x51, 0x52, 0x55, 0x5B,
+        0x66, 0xFF, 0xF0, 0xFE, 0x68, 0x5D, 0x59, 0x5A, 0x5E, 0x68, 0x7B, 0xEF, 0xE6, 0xDE, 0xD9, 0xD4,
+        0xD2, 0xD2, 0xD5, 0xDA, 0xE4, 0xF6, 0x7C, 0xF2, 0xE3, 0xDA, 0xD7, 0xD9, 0xDF, 0xEC, 0x78, 0x69,
+        0x60, 0x5A, 0x55, 0x50, 0x4F, 0x4F, 0x52, 0x57, 0x5E, 0x6A, 0x71, 0x6A, 0x5F, 0x5A, 0x59, 0x5C,
+        0x63, 0x71, 0xF3, 0xE7, 0xDF, 0xD9, 0xD3, 0xCF, 0xCE, 0xCE, 0xD0, 0xD6, 0xDE, 0xEA, 0xF0, 0xEB,
+        0xE1, 0xDC, 0xDA, 0xDC, 0xE3, 0xEE, 0x7A, 0x6C, 0x64, 0x5C, 0x55, 0x4F, 0x4E, 0x4E, 0x50, 0x56,
+        0x5E, 0x6B, 0x73, 0x6D, 0x63, 0x5C, 0x5A, 0x5C, 0x61, 0x6C, 0x7E, 0xEF, 0xE6, 0xDC, 0xD5, 0xCF,
+        0xCD, 0xCE, 0xD0, 0xD6, 0xDD, 0xE8, 0xEE, 0xEB, 0xE2, 0xDC, 0xD9, 0xDB, 0xDF, 0xE8, 0xF7, 0x74,
+        0x68, 0x5D, 0x55, 0x4F, 0x4E, 0x4E, 0x50, 0x55, 0x5B, 0x63, 0x6A, 0x68, 0x60, 0x5B, 0x59, 0x5A,
+        0x5F, 0x69, 0x79, 0xF2, 0xE7, 0xDC, 0xD4, 0xCF, 0xCE, 0xCE, 0xD0, 0xD5, 0xDB, 0xE2, 0xEA, 0xEA,
+        0xE4, 0xDE, 0xDD, 0xDF, 0xE8, 0xF5, 0x74, 0x6A, 0x61, 0x5A, 0x52, 0x4E, 0x4D, 0x4E, 0x50, 0x55,
+        0x5B, 0x63, 0x6C, 0x6D, 0x67, 0x61, 0x5E, 0x60, 0x68, 0x74, 0xF9, 0xEE, 0xE6, 0xDD, 0xD5, 0xCF,
+        0xCF, 0xCF, 0xD3, 0xD9, 0xDF, 0xEB, 0xF8, 0xF8, 0xEC, 0xE3, 0xDF, 0xE0, 0xE7, 0xF2, 0x7B, 0x6F,
+        0x67, 0x5D, 0x55, 0x4F, 0x4E, 0x4F, 0x51, 0x56, 0x5D, 0x66, 0x6E, 0x6D, 0x64, 0x5D, 0x5A, 0x5B,
+        0x5F, 0x69, 0x77, 0xF7, 0xEA, 0xDE, 0xD6, 0xCF, 0xCE, 0xCE, 0xD0, 0xD4, 0xDA, 0xE1, 0xEA, 0xEA,
+        0xE2, 0xDC, 0xD9, 0xDA, 0xDE, 0xE8, 0xF5, 0x79, 0x6A, 0x5E, 0x56, 0x4F, 0x4E, 0x4E, 0x4F, 0x53,
+        0x5A, 0x60, 0x69, 0x69, 0x61, 0x5B, 0x58, 0x5A, 0x5E, 0x66, 0x6F, 0x7D, 0xEF, 0xE1, 0xD8, 0xD1,
+        0xCE, 0xCE, 0xCF, 0xD3, 0xD9, 0xDF, 0xE6, 0xE4, 0xDE, 0xD8, 0xD5, 0xD7, 0xDB, 0xE0, 0xE8, 0xEE,
+        0xFD, 0x6A, 0x5C, 0x55, 0x50, 0x4F, 0x4F, 0x52, 0x57, 0x5D, 0x62, 0x60, 0x5B, 0x56, 0x53, 0x55,
+        0x5A, 0x60, 0x68, 0x6F, 0xFD, 0xE7, 0xDA, 0xD1, 0xCE, 0xCD, 0xCD, 0xCE, 0xD2, 0xD8, 0xDC, 0xDB,
+        0xD6, 0xD1, 0xCF, 0xD2, 0xD8, 0xDE, 0xE6, 0xEE, 0x7D, 0x66, 0x59, 0x51, 0x4E, 0x4D, 0x4D, 0x4F,
+        0x55, 0x5B, 0x5F, 0x5F, 0x5A, 0x55, 0x53, 0x57, 0x5E, 0x69, 0x78, 0xF7, 0xE9, 0xDD, 0xD4, 0xCE,
+        0xCC, 0xCB, 0xCC, 0xCE, 0xD4, 0xDB, 0xDF, 0xDF, 0xDB, 0xD6, 0xD4, 0xD7, 0xDE, 0xE9, 0xF5, 0x7C,
+        0x6D, 0x5F, 0x57, 0x4F, 0x4D, 0x4C, 0x4C, 0x4F, 0x57, 0x5E, 0x67, 0x69, 0x61, 0x5C, 0x58, 0x5B,
+        0x61, 0x6B, 0x77, 0xFC, 0xEC, 0xDE, 0xD5, 0xCE, 0xCB, 0xCA, 0xCB, 0xCE, 0xD5, 0xDD, 0xE6, 0xE8,
+        0xE1, 0xDB, 0xD8, 0xDA, 0xDF, 0xEB, 0xF7, 0x7B, 0x6B, 0x5D, 0x52, 0x4C, 0x49, 0x48, 0x49, 0x4C,
+        0x51, 0x5A, 0x61, 0x65, 0x5E, 0x59, 0x56, 0x59, 0x60, 0x6C, 0x77, 0xFB, 0xEC, 0xDC, 0xD2, 0xCC,
+        0xC9, 0xC9, 0xCA, 0xCD, 0xD4, 0xDE, 0xEA, 0xEE, 0xE8, 0xDE, 0xDC, 0xDF, 0xEB, 0xFF, 0x70, 0x6A,
+        0x61, 0x57, 0x4F, 0x4A, 0x48, 0x47, 0x49, 0x4C, 0x52, 0x5C, 0x67, 0x6A, 0x63, 0x5C, 0x59, 0x5D,
+        0x68, 0x78, 0xF9, 0xF0, 0xE8, 0xDC, 0xD3, 0xCD, 0xCB, 0xCA, 0xCB, 0xCE, 0xD6, 0xDF, 0xEB, 0xEE,
+        0xE8, 0xDF, 0xDC, 0xDF, 0xEC, 0x7E, 0x73, 0x6E, 0x68, 0x5C, 0x53, 0x4D, 0x4A, 0x49, 0x49, 0x4C,
+        0x52, 0x5B, 0x65, 0x68, 0x64, 0x5D, 0x5A, 0x5D, 0x67, 0x73, 0x7E, 0xFB, 0xEF, 0xE1, 0xD7, 0xCE,
+        0xCB, 0xCA, 0xCB, 0xCE, 0xD5, 0xDE, 0xE9, 0xEC, 0xE7, 0xDE, 0xDB, 0xDD, 0xE6, 0xF2, 0xFD, 0x7D,
+        0x72, 0x63, 0x57, 0x4E, 0x4B, 0x49, 0x4A, 0x4D, 0x54, 0x5D, 0x67, 0x6A, 0x64, 0x5D, 0x5A, 0x5C,
+        0x65, 0x70, 0x7A, 0x7E, 0xF7, 0xE5, 0xD8, 0xCF, 0xCB, 0xCA, 0xCB, 0xCE, 0xD6, 0xDF, 0xEA, 0xEE,
+        0xE8, 0xDF, 0xDC, 0xDE, 0xE7, 0xF4, 0xFE, 0x7E, 0x75, 0x66, 0x59, 0x4F, 0x4C, 0x4A, 0x4C, 0x4F,
+        0x58, 0x62, 0x6E, 0x6F, 0x69, 0x5F, 0x5C, 0x5F, 0x6A, 0x7A, 0xF9, 0xF6, 0xEF, 0xE4, 0xD8, 0xCF,
+        0xCC, 0xCB, 0xCC, 0xCF, 0xD8, 0xE1, 0xEB, 0xEC, 0xE5, 0xDE, 0xDB, 0xDE, 0xE8, 0xF8, 0x7B, 0x79,
+        0x72, 0x67, 0x5A, 0x52, 0x4E, 0x4D, 0x4E, 0x53, 0x5C, 0x68, 0x77, 0x77, 0x6D, 0x64, 0x5F, 0x64,
+        0x6F, 0xF9, 0xEF, 0xED, 0xE9, 0xDF, 0xD7, 0xCF, 0xCD, 0xCC, 0xCE, 0xD2, 0xDB, 0xE8, 0xF4, 0xF4,
+        0xEA, 0xDF, 0xDC, 0xDE, 0xE7, 0xF3, 0xFE, 0x7B, 0x72, 0x65, 0x5A, 0x52, 0x4F, 0x4F, 0x51, 0x57,
+        0x60, 0x70, 0xFB, 0xFD, 0x6F, 0x64, 0x5E, 0x5F, 0x6A, 0x79, 0xF7, 0xF1, 0xEB, 0xE0, 0xD7, 0xD0,
+        0xCE, 0xCE, 0xCF, 0xD5, 0xDD, 0xEB, 0xFA, 0xFA, 0xED, 0xE2, 0xDC, 0xDD, 0xE6, 0xF2, 0x7D, 0x75,
+        0x6D, 0x61, 0x58, 0x51, 0x4F, 0x4F, 0x51, 0x56, 0x5E, 0x6C, 0x7B, 0x79, 0x6B, 0x5F, 0x5B, 0x5C,
+        0x63, 0x6F, 0x7E, 0xF7, 0xEE, 0xE3, 0xD9, 0xD3, 0xCF, 0xCF, 0xD0, 0xD4, 0xDB, 0xE3, 0xEB, 0xE9,
+        0xE1, 0xDB, 0xD7, 0xD8, 0xDE, 0xE8, 0xF5, 0x7B, 0x6D, 0x60, 0x58, 0x51, 0x4E, 0x4D, 0x4E, 0x4F,
+        0x54, 0x5A, 0x5E, 0x5E, 0x5B, 0x55, 0x52, 0x53, 0x59, 0x62, 0x6E, 0xFE, 0xEE, 0xE1, 0xD8, 0xD1,
+        0xCF, 0xCE, 0xCE, 0xD0, 0xD5, 0xDA, 0xDF, 0xDF, 0xDD, 0xD8, 0xD4, 0xD6, 0xDC, 0xE8, 0xFB, 0x70,
+        0x66, 0x5D, 0x55, 0x4F, 0x4E, 0x4D, 0x4E, 0x4F, 0x52, 0x58, 0x5B, 0x5C, 0x59, 0x55, 0x51, 0x54,
+        0x5A, 0x65, 0x77, 0xF4, 0xE9, 0xDF, 0xD8, 0xD2, 0xD0, 0xCF, 0xD0, 0xD1, 0xD5, 0xD9, 0xDD, 0xDE,
+        0xDB, 0xD6, 0xD3, 0xD6, 0xDD, 0xEB, 0x7C, 0x6C, 0x63, 0x5C, 0x56, 0x51, 0x4F, 0x4F, 0x50, 0x51,
+        0x55, 0x59, 0x5D, 0x5D, 0x5A, 0x56, 0x52, 0x55, 0x5C, 0x69, 0xFE, 0xEC, 0xE3, 0xDC, 0xD7, 0xD3,
+        0xD1, 0xD1, 0xD2, 0xD4, 0xD7, 0xDB, 0xDE, 0xDE, 0xDC, 0xD7, 0xD5, 0xD7, 0xDE, 0xED, 0x75, 0x68,
+        0x5F, 0x5B, 0x57, 0x53, 0x51, 0x50, 0x51, 0x53, 0x56, 0x5B, 0x5F, 0x61, 0x5E, 0x5A, 0x57, 0x5A,
+        0x61, 0x73, 0xEF, 0xE5, 0xDF, 0xDB, 0xD7, 0xD3, 0xD1, 0xD1, 0xD2, 0xD4, 0xD7, 0xDC, 0xDF, 0xE2,
+        0xDF, 0xDA, 0xD7, 0xD9, 0xE2, 0xF3, 0x70, 0x67, 0x62, 0x5E, 0x5A, 0x57, 0x56, 0x55, 0x56, 0x56,
+        0x59, 0x5C, 0x60, 0x62, 0x5F, 0x5B, 0x58, 0x5B, 0x64, 0x79, 0xED, 0xE5, 0xE2, 0xDE, 0xDB, 0xD7,
+        0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xDA, 0xDD, 0xDE, 0xDC, 0xD8, 0xD6, 0xD9, 0xE2, 0xF7, 0x6D, 0x66,
+        0x63, 0x5F, 0x5C, 0x59, 0x57, 0x57, 0x57, 0x57, 0x59, 0x5C, 0x5F, 0x60, 0x5E, 0x5A, 0x58, 0x5C,
+        0x67, 0xFE, 0xE9, 0xE2, 0xE0, 0xDF, 0xDC, 0xD9, 0xD8, 0xD7, 0xD7, 0xD8, 0xDA, 0xDC, 0xDF, 0xDF,
+        0xDD, 0xDA, 0xD8, 0xDB, 0xE6, 0xFD, 0x6B, 0x64, 0x63, 0x61, 0x5D, 0x5A, 0x59, 0x58, 0x58, 0x59,
+        0x5C, 0x5F, 0x65, 0x66, 0x63, 0x5E, 0x5B, 0x5E, 0x69, 0xFC, 0xE9, 0xE3, 0xE1, 0xDF, 0xDC, 0xD9,
+        0xD8, 0xD8, 0xD9, 0xDC, 0xDF, 0xE7, 0xED, 0xEC, 0xE6, 0xDE, 0xDB, 0xDD, 0xE7, 0xFD, 0x6B, 0x64,
+        0x61, 0x5F, 0x5D, 0x5A, 0x59, 0x5A, 0x5B, 0x5E, 0x63, 0x6A, 0x6E, 0x6C, 0x65, 0x5D, 0x5A, 0x5C,
+        0x64, 0x78, 0xEE, 0xE5, 0xE2, 0xDF, 0xDC, 0xDA, 0xD9, 0xDA, 0xDC, 0xDE, 0xE3, 0xE9, 0xED, 0xEA,
+        0xE3, 0xDC, 0xD9, 0xDB, 0xE4, 0xF8, 0x6D, 0x65, 0x62, 0x5F, 0x5C, 0x59, 0x58, 0x59, 0x5B, 0x5D,
+        0x5F, 0x66, 0x69, 0x67, 0x5F, 0x5A, 0x57, 0x59, 0x60, 0x6F, 0xF5, 0xEB, 0xE7, 0xE3, 0xDE, 0xDA,
+        0xDA, 0xDA, 0xDB, 0xDD, 0xE1, 0xE6, 0xE9, 0xE6, 0xDF, 0xD9, 0xD6, 0xD9, 0xDF, 0xF0, 0x72, 0x68,
+        0x64, 0x5F, 0x5B, 0x57, 0x57, 0x58, 0x59, 0x5A, 0x5D, 0x62, 0x66, 0x64, 0x5E, 0x59, 0x57, 0x59,
+        0x61, 0x74, 0xEF, 0xE7, 0xE2, 0xDE, 0xDA, 0xD7, 0xD6, 0xD7, 0xD9, 0xDB, 0xDE, 0xE5, 0xEA, 0xE8,
+        0xE2, 0xDC, 0xDA, 0xDC, 0xE5, 0xF8, 0x6E, 0x66, 0x62, 0x5E, 0x5A, 0x56, 0x56, 0x56, 0x58, 0x5B,
+        0x5F, 0x67, 0x6C, 0x6B, 0x64, 0x5D, 0x5A, 0x5B, 0x62, 0x72, 0xF2, 0xE8, 0xE3, 0xDF, 0xDA, 0xD7,
+        0xD6, 0xD7, 0xD9, 0xDC, 0xE1, 0xE9, 0xED, 0xEB, 0xE3, 0xDC, 0xD8, 0xDA, 0xE0, 0xF0, 0x72, 0x68,
+        0x63, 0x5F, 0x5B, 0x57, 0x57, 0x58, 0x5A, 0x5C, 0x60, 0x67, 0x6A, 0x67, 0x5F, 0x5A, 0x57, 0x58,
+        0x5F, 0x6D, 0xF5, 0xE8, 0xE3, 0xDE, 0xDA, 0xD7, 0xD6, 0xD7, 0xD9, 0xDC, 0xDF, 0xE6, 0xE8, 0xE4,
+        0xDE, 0xD8, 0xD5, 0xD6, 0xDD, 0xEC, 0x76, 0x69, 0x62, 0x5E, 0x5A, 0x57, 0x57, 0x58, 0x5A, 0x5C,
+        0x5E, 0x63, 0x65, 0x60, 0x5B, 0x55, 0x51, 0x54, 0x5B, 0x68, 0xFD, 0xEA, 0xE3, 0xDE, 0xDA, 0xD7,
+        0xD6, 0xD8, 0xD9, 0xDB, 0xDE, 0xE2, 0xE4, 0xDF, 0xDA, 0xD4, 0xD0, 0xD3, 0xDA, 0xE8, 0x7B, 0x69,
+        0x61, 0x5D, 0x58, 0x56, 0x56, 0x57, 0x59, 0x5A, 0x5D, 0x60, 0x62, 0x5E, 0x59, 0x53, 0x4F, 0x52,
+        0x5A, 0x68, 0xF9, 0xE8, 0xE0, 0xDD, 0xD9, 0xD6, 0xD6, 0xD7, 0xD9, 0xDA, 0xDC, 0xDE, 0xDF, 0xDD,
+        0xD8, 0xD2, 0xCF, 0xD2, 0xDA, 0xE8, 0x7E, 0x6C, 0x65, 0x5F, 0x5B, 0x57, 0x56, 0x57, 0x58, 0x59,
+        0x5B, 0x5E, 0x5F, 0x5D, 0x58, 0x53, 0x50, 0x52, 0x5A, 0x66, 0x7B, 0xEF, 0xEA, 0xE2, 0xDC, 0xD8,
+        0xD6, 0xD6, 0xD7, 0xD8, 0xDA, 0xDD, 0xDF, 0xDE, 0xD9, 0xD3, 0xD0, 0xD3, 0xD9, 0xE4, 0xF4, 0x79,
+        0x6F, 0x69, 0x5F, 0x5A, 0x58, 0x57, 0x57, 0x58, 0x5B, 0x5E, 0x60, 0x5E, 0x5A, 0x54, 0x51, 0x52,
+        0x59, 0x61, 0x6D, 0x79, 0xFB, 0xEE, 0xE3, 0xDC, 0xD9, 0xD8, 0xD7, 0xD7, 0xD9, 0xDC, 0xDE, 0xDC,
+        0xD8, 0xD2, 0xCF, 0xCF, 0xD5, 0xDC, 0xE3, 0xEC, 0xF4, 0x7A, 0x6A, 0x5F, 0x5C, 0x5A, 0x58, 0x58,
+        0x5A, 0x5D, 0x5E, 0x5B, 0x57, 0x51, 0x4E, 0x4F, 0x54, 0x5A, 0x62, 0x6A, 0x71, 0xFE, 0xEC, 0xE1,
+        0xDC, 0xDA, 0xD8, 0xD7, 0xD9, 0xDA, 0xDA, 0xD8, 0xD3, 0xCF, 0xCD, 0xCE, 0xD2, 0xDA, 0xE0, 0xEA,
+        0xF2, 0x7C, 0x6B, 0x60, 0x5C, 0x5A, 0x58, 0x57, 0x58, 0x59, 0x59, 0x56, 0x51, 0x4E, 0x4D, 0x4E,
+        0x52, 0x5A, 0x63, 0x6E, 0x7A, 0xF6, 0xE9, 0xDF, 0xDC, 0xD9, 0xD8, 0xD7, 0xD7, 0xD8, 0xD8, 0xD5,
+        0xD0, 0xCE, 0xCC, 0xCD, 0xD1, 0xD9, 0xE4, 0xF0, 0x7E, 0x6F, 0x64, 0x5D, 0x59, 0x58, 0x56, 0x55,
+        0x56, 0x56, 0x56, 0x54, 0x50, 0x4D, 0x4C, 0x4C, 0x50, 0x59, 0x64, 0x73, 0xF9, 0xEC, 0xE1, 0xDB,
+        0xD8, 0xD6, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xCF, 0xCD, 0xCC, 0xCD, 0xD1, 0xDB, 0xE9, 0xFE,
+        0x6F, 0x66, 0x5D, 0x58, 0x55, 0x54, 0x52, 0x52, 0x53, 0x53, 0x54, 0x52, 0x4F, 0x4D, 0x4C, 0x4D,
+        0x53, 0x5C, 0x6A, 0x7D, 0xF0, 0xE9, 0xDF, 0xDA, 0xD7, 0xD5, 0xD4, 0xD3, 0xD4, 0xD5, 0xD6, 0xD5,
+        0xD2, 0xCE, 0xCD, 0xCE, 0xD4, 0xDD, 0xEC, 0x7E, 0x70, 0x6A, 0x61, 0x5C, 0x58, 0x56, 0x54, 0x53,
+        0x53, 0x55, 0x55, 0x54, 0x51, 0x4E, 0x4D, 0x4F, 0x55, 0x5D, 0x68, 0x75, 0x7D, 0xF8, 0xED, 0xE3,
+        0xDD, 0xDA, 0xD8, 0xD6, 0xD6, 0xD7, 0xD8, 0xD7, 0xD4, 0xD0, 0xCE, 0xCF, 0xD5, 0xDD, 0xE7, 0xF1,
+        0xF8, 0x7C, 0x6E, 0x63, 0x5D, 0x59, 0x57, 0x55, 0x54, 0x55, 0x56, 0x54, 0x51, 0x4E, 0x4D, 0x4D,
+        0x52, 0x5A, 0x62, 0x6C, 0x74, 0x7F, 0xEE, 0xE2, 0xDC, 0xD9, 0xD6, 0xD4, 0xD4, 0xD5, 0xD5, 0xD3,
+        0xD0, 0xCE, 0xCC, 0xCD, 0xD2, 0xDA, 0xE4, 0xEF, 0xFA, 0x78, 0x6A, 0x5F, 0x5A, 0x56, 0x53, 0x51,
+        0x51, 0x52, 0x53, 0x52, 0x50, 0x4E, 0x4D, 0x4E, 0x54, 0x5D, 0x69, 0x79, 0xF9, 0xEF, 0xE5, 0xDC,
+        0xD7, 0xD3, 0xCF, 0xCE, 0xCE, 0xCF, 0xD0, 0xD0, 0xCF, 0xCE, 0xCD, 0xCF, 0xD5, 0xDE, 0xEC, 0xFE,
+        0x74, 0x6D, 0x65, 0x5D, 0x58, 0x53, 0x4F, 0x4E, 0x4E, 0x4F, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x51,
+        0x58, 0x62, 0x76, 0xF2, 0xEB, 0xE6, 0xDF, 0xD9, 0xD3, 0xCF, 0xCD, 0xCB, 0xCB, 0xCC, 0xCD, 0xCE,
+        0xCE, 0xCE, 0xCE, 0xCF, 0xD7, 0xDF, 0xEE, 0x7A, 0x6E, 0x6A, 0x61, 0x5A, 0x54, 0x4F, 0x4D, 0x4C,
+        0x4C, 0x4D, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x53, 0x5A, 0x64, 0x78, 0xEF, 0xE9, 0xE4, 0xDE, 0xD7,
+        0xD1, 0xCE, 0xCC, 0xCB, 0xCB, 0xCC, 0xCE, 0xCF, 0xD0, 0xD0, 0xD0, 0xD3, 0xD9, 0xE3, 0xF5, 0x72,
+        0x6A, 0x64, 0x5D, 0x57, 0x50, 0x4E, 0x4C, 0x4B, 0x4C, 0x4D, 0x4F, 0x51, 0x52, 0x52, 0x52, 0x54,
+        0x5A, 0x63, 0x74, 0xF0, 0xE8, 0xE0, 0xDB, 0xD4, 0xCE, 0xCC, 0xCB, 0xCB, 0xCC, 0xCE, 0xD0, 0xD3,
+        0xD4, 0xD3, 0xD3, 0xD4, 0xD9, 0xE2, 0xF5, 0x6E, 0x64, 0x5D, 0x57, 0x4F, 0x4C, 0x4B, 0x4A, 0x4A,
+        0x4B, 0x4D, 0x4F, 0x52, 0x53, 0x52, 0x51, 0x52, 0x57, 0x5F, 0x6F, 0xF2, 0xE6, 0xDD, 0xD6, 0xCF,
+        0xCC, 0xCA, 0xC9, 0xCA, 0xCB, 0xCD, 0xCF, 0xD1, 0xD1, 0xD0, 0xCF, 0xD0, 0xD6, 0xDE, 0xEF, 0x6F,
+        0x62, 0x5B, 0x54, 0x4E, 0x4C, 0x4A, 0x49, 0x49, 0x4A, 0x4C, 0x4E, 0x4F, 0x4F, 0x4E, 0x4E, 0x4F,
+        0x54, 0x5D, 0x6D, 0xF1, 0xE4, 0xDC, 0xD6, 0xCF, 0xCD, 0xCB, 0xCA, 0xCA, 0xCB, 0xCC, 0xCE, 0xCF,
+        0xCF, 0xCF, 0xCE, 0xCF, 0xD5, 0xDD, 0xEF, 0x70, 0x64, 0x5D, 0x57, 0x51, 0x4D, 0x4C, 0x4B, 0x4A,
+        0x4B, 0x4C, 0x4E, 0x4F, 0x50, 0x4F, 0x4F, 0x51, 0x57, 0x5F, 0x72, 0xEF, 0xE6, 0xDE, 0xD9, 0xD3,
+        0xCF, 0xCD, 0xCC, 0xCC, 0xCC, 0xCE, 0xD0, 0xD2, 0xD3, 0xD2, 0xD2, 0xD3, 0xD9, 0xE3, 0xF9, 0x6D,
+        0x65, 0x5F, 0x5A, 0x54, 0x50, 0x4E, 0x4D, 0x4D, 0x4D, 0x4F, 0x52, 0x54, 0x54, 0x53, 0x52, 0x54,
+        0x5A, 0x64, 0x7A, 0xED, 0xE5, 0xDF, 0xDA, 0xD5, 0xD0, 0xCF, 0xCE, 0xCD, 0xCE, 0xD0, 0xD3, 0xD5,
+        0xD6, 0xD5, 0xD5, 0xD6, 0xDC, 0xE8, 0x7E, 0x6B, 0x64, 0x5F, 0x5B, 0x56, 0x52, 0x50, 0x4F, 0x4E,
+        0x4F, 0x50, 0x53, 0x55, 0x56, 0x56, 0x55, 0x57, 0x5C, 0x68, 0xFF, 0xEC, 0xE6, 0xE1, 0xDD, 0xD8,
+        0xD5, 0xD3, 0xD1, 0xD0, 0xD0, 0xD2, 0xD4, 0xD6, 0xD6, 0xD6, 0xD6, 0xD8, 0xDD, 0xEA, 0x7B, 0x6A,
+        0x64, 0x5F, 0x5B, 0x57, 0x54, 0x53, 0x51, 0x50, 0x51, 0x52, 0x54, 0x55, 0x56, 0x56, 0x56, 0x58,
+        0x5E, 0x6A, 0xF9, 0xEA, 0xE2, 0xDE, 0xDA, 0xD6, 0xD3, 0xD2, 0xD1, 0xD1, 0xD2, 0xD4, 0xD5, 0xD6,
+        0xD7, 0xD6, 0xD5, 0xD7, 0xDD, 0xEB, 0x78, 0x68, 0x61, 0x5E, 0x5A, 0x56, 0x54, 0x54, 0x54, 0x54,
+        0x54, 0x56, 0x57, 0x57, 0x57, 0x56, 0x56, 0x59, 0x60, 0x74, 0xEC, 0xE1, 0xDE, 0xDD, 0xDA, 0xD7,
+        0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD7, 0xD7, 0xD7, 0xDA, 0xE2, 0xF8, 0x6B, 0x61,
+        0x5E, 0x5D, 0x5B, 0x58, 0x56, 0x56, 0x55, 0x54, 0x54, 0x55, 0x57, 0x57, 0x57, 0x56, 0x57, 0x5A,
+        0x63, 0x7C, 0xE8, 0xDF, 0xDD, 0xDC, 0xDA, 0xD6, 0xD4, 0xD3, 0xD2, 0xD2, 0xD2, 0xD4, 0xD5, 0xD5,
+        0xD5, 0xD5, 0xD6, 0xDA, 0xE4, 0xFD, 0x68, 0x5F, 0x5D, 0x5C, 0x59, 0x56, 0x54, 0x54, 0x53, 0x52,
+        0x52, 0x53, 0x53, 0x54, 0x54, 0x54, 0x56, 0x5A, 0x63, 0x7B, 0xE9, 0xDF, 0xDE, 0xDD, 0xDA, 0xD7,
+        0xD5, 0xD4, 0xD3, 0xD2, 0xD2, 0xD2, 0xD3, 0xD2, 0xD2, 0xD2, 0xD3, 0xD8, 0xDF, 0xF4, 0x6D, 0x64,
+        0x60, 0x5E, 0x5B, 0x58, 0x55, 0x54, 0x53, 0x52, 0x52, 0x53, 0x53, 0x54, 0x53, 0x53, 0x54, 0x58,
+        0x5F, 0x70, 0xF0, 0xE7, 0xE3, 0xDF, 0xDC, 0xD9, 0xD6, 0xD5, 0xD4, 0xD3, 0xD3, 0xD4, 0xD4, 0xD5,
+        0xD4, 0xD4, 0xD5, 0xD8, 0xDF, 0xED, 0x77, 0x6A, 0x65, 0x61, 0x5D, 0x59, 0x57, 0x55, 0x54, 0x54,
+        0x54, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x59, 0x5F, 0x6C, 0xF9, 0xEC, 0xE7, 0xE2, 0xDC, 0xD8,
+        0xD5, 0xD4, 0xD3, 0xD3, 0xD4, 0xD5, 0xD5, 0xD5, 0xD4, 0xD4, 0xD4, 0xD7, 0xDC, 0xE7, 0xF9, 0x71,
+        0x6A, 0x65, 0x5E, 0x59, 0x56, 0x55, 0x55, 0x55, 0x56, 0x57, 0x57, 0x56, 0x54, 0x53, 0x53, 0x56,
+        0x5C, 0x66, 0x78, 0xF2, 0xEB, 0xE6, 0xDE, 0xDA, 0xD7, 0xD6, 0xD5, 0xD6, 0xD7, 0xD7, 0xD6, 0xD5,
+        0xD2, 0xD1, 0xD1, 0xD5, 0xDC, 0xE8, 0x7E, 0x6D, 0x68, 0x65, 0x5F, 0x5B, 0x59, 0x57, 0x57, 0x57,
+        0x57, 0x57, 0x55, 0x53, 0x51, 0x50, 0x50, 0x54, 0x5B, 0x67, 0x7C, 0xF1, 0xEC, 0xEA, 0xE4, 0xDE,
+        0xDB, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD7, 0xD5, 0xD3, 0xD1, 0xD2, 0xD5, 0xDC, 0xE9, 0x7E, 0x6D,
+        0x69, 0x65, 0x60, 0x5C, 0x59, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x53, 0x51, 0x4F, 0x4F, 0x53,
+        0x5A, 0x65, 0x78, 0xF2, 0xEC, 0xE9, 0xE3, 0xDE, 0xDA, 0xD8, 0xD6, 0xD6, 0xD6, 0xD7, 0xD6, 0xD4,
+        0xD1, 0xD0, 0xD0, 0xD4, 0xDC, 0xE9, 0x7C, 0x6B, 0x67, 0x65, 0x60, 0x5C, 0x59, 0x57, 0x56, 0x55,
+        0x56, 0x56, 0x56, 0x54, 0x51, 0x4F, 0x4F, 0x53, 0x5A, 0x65, 0x7B, 0xEE, 0xE9, 0xE7, 0xE2, 0xDD,
+        0xDB, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA, 0xD9, 0xD6, 0xD2, 0xCF, 0xCF, 0xD2, 0xD9, 0xE5, 0xFC, 0x6D,
+        0x68, 0x66, 0x62, 0x5E, 0x5C, 0x5B, 0x5A, 0x5A, 0x5A, 0x5A, 0x58, 0x54, 0x50, 0x4E, 0x4E, 0x50,
+        0x58, 0x62, 0x77, 0xEF, 0xEA, 0xE6, 0xE3, 0xDE, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDA, 0xD8, 0xD4,
+        0xCF, 0xCE, 0xCD, 0xCF, 0xD7, 0xE2, 0xF7, 0x71, 0x6A, 0x68, 0x64, 0x5F, 0x5D, 0x5C, 0x5C, 0x5C,
+        0x5B, 0x5A, 0x57, 0x53, 0x4F, 0x4E, 0x4E, 0x50, 0x59, 0x64, 0x79, 0xEF, 0xE9, 0xE5, 0xE1, 0xDD,
+        0xDC, 0xDB, 0xDB, 0xDA, 0xDA, 0xD9, 0xD6, 0xD3, 0xCF, 0xCE, 0xCE, 0xD1, 0xD8, 0xE3, 0xF4, 0x76,
+        0x6E, 0x6C, 0x68, 0x62, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x57, 0x53, 0x50, 0x4E, 0x4F, 0x52,
+        0x5A, 0x65, 0x79, 0xF1, 0xEB, 0xE9, 0xE5, 0xE0, 0xDD, 0xDB, 0xDA, 0xD8, 0xD7, 0xD5, 0xD2, 0xCF,
+        0xCD, 0xCC, 0xCC, 0xCF, 0xD6, 0xE0, 0xF1, 0x78, 0x6F, 0x6D, 0x6A, 0x65, 0x60, 0x5E, 0x5C, 0x5A,
+        0x58, 0x56, 0x54, 0x50, 0x4E, 0x4D, 0x4E, 0x51, 0x59, 0x65, 0x7C, 0xED, 0xE8, 0xE6, 0xE3, 0xDF,
+        0xDC, 0xDA, 0xD8, 0xD6, 0xD4, 0xD3, 0xD1, 0xCF, 0xCD, 0xCC, 0xCD, 0xCF, 0xD6, 0xDF, 0xF2, 0x72,
+        0x6A, 0x66, 0x62, 0x5E, 0x5B, 0x59, 0x57, 0x55, 0x54, 0x53, 0x52, 0x4F, 0x4E, 0x4D, 0x4E, 0x51,
+        0x59, 0x66, 0xFE, 0xE9, 0xE2, 0xDF, 0xDD, 0xDB, 0xD8, 0xD6, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1, 0xCF,
+        0xCE, 0xCE, 0xCE, 0xD1, 0xD9, 0xE5, 0xFE, 0x6A, 0x62, 0x5F, 0x5C, 0x5A, 0x57, 0x55, 0x52, 0x51,
+        0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4D, 0x4D, 0x50, 0x58, 0x64, 0x7F, 0xE8, 0xE1, 0xDE, 0xDC, 0xD9,
+        0xD7, 0xD5, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD0, 0xCF, 0xCE, 0xCF, 0xD3, 0xDB, 0xEB, 0x71, 0x62,
+        0x5D, 0x5B, 0x5A, 0x58, 0x56, 0x54, 0x52, 0x50, 0x50, 0x4F, 0x4F, 0x4E, 0x4D, 0x4C, 0x4D, 0x4F,
+        0x57, 0x62, 0x79, 0xEC, 0xE4, 0xE1, 0xDE, 0xDC, 0xDA, 0xD8, 0xD6, 0xD3, 0xD3, 0xD2, 0xD1, 0xCF,
+        0xCE, 0xCD, 0xCD, 0xCF, 0xD7, 0xE3, 0x7E, 0x67, 0x5E, 0x5C, 0x5A, 0x58, 0x56, 0x54, 0x52, 0x51,
+        0x50, 0x50, 0x4F, 0x4D, 0x4C, 0x4B, 0x4B, 0x4D, 0x52, 0x5D, 0x6E, 0xEF, 0xE6, 0xE1, 0xDE, 0xDC,
+        0xDA, 0xD8, 0xD6, 0xD4, 0xD3, 0xD3, 0xD1, 0xCF, 0xCD, 0xCC, 0xCC, 0xCE, 0xD4, 0xDE, 0xF3, 0x6C,
+        0x62, 0x5E, 0x5B, 0x59, 0x57, 0x54, 0x52, 0x51, 0x50, 0x50, 0x50, 0x4F, 0x4D, 0x4C, 0x4C, 0x4E,
+        0x55, 0x5F, 0x77, 0xEB, 0xE1, 0xDD, 0xDB, 0xD8, 0xD6, 0xD4, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0,
+        0xCE, 0xCE, 0xCE, 0xCF, 0xD7, 0xE2, 0xFC, 0x68, 0x5F, 0x5D, 0x5A, 0x58, 0x56, 0x54, 0x53, 0x51,
+        0x51, 0x52, 0x52, 0x51, 0x4F, 0x4F, 0x4F, 0x51, 0x58, 0x65, 0xFC, 0xE7, 0xDF, 0xDD, 0xDB, 0xD8,
+        0xD6, 0xD4, 0xD2, 0xD0, 0xCF, 0xD0, 0xD0, 0xCF, 0xCF, 0xCE, 0xCE, 0xCF, 0xD6, 0xE0, 0xF6, 0x6D,
+        0x65, 0x61, 0x5E, 0x5C, 0x59, 0x57, 0x54, 0x52, 0x51, 0x51, 0x51, 0x50, 0x4F, 0x4E, 0x4E, 0x4F,
+        0x57, 0x61, 0x78, 0xEC, 0xE4, 0xDF, 0xDD, 0xDB, 0xD8, 0xD6, 0xD3, 0xD1, 0xCF, 0xCF, 0xCF, 0xCE,
+        0xCD, 0xCC, 0xCB, 0xCD, 0xD2, 0xDC, 0xEB, 0x77, 0x6A, 0x65, 0x60, 0x5D, 0x5A, 0x57, 0x55, 0x52,
+        0x50, 0x4F, 0x4F, 0x4E, 0x4C, 0x4B, 0x4B, 0x4D, 0x52, 0x5D, 0x6E, 0xF2, 0xE7, 0xE1, 0xDD, 0xDA,
+        0xD7, 0xD5, 0xD2, 0xD0, 0xCF, 0xCF, 0xCF, 0xCE, 0xCC, 0xCB, 0xCA, 0xCC, 0xD0, 0xDA, 0xEA, 0x79,
+        0x6A, 0x63, 0x5E, 0x5B, 0x59, 0x56, 0x54, 0x53, 0x53, 0x53, 0x52, 0x4F, 0x4D, 0x4C, 0x4B, 0x4C,
+        0x4F, 0x5A, 0x69, 0xF8, 0xE8, 0xE1, 0xDD, 0xD9, 0xD6, 0xD4, 0xD2, 0xD1, 0xD1, 0xD2, 0xD1, 0xCF,
+        0xCD, 0xCB, 0xCA, 0xCC, 0xD0, 0xDA, 0xEC, 0x71, 0x64, 0x5E, 0x5A, 0x57, 0x54, 0x52, 0x51, 0x51,
+        0x51, 0x52, 0x51, 0x50, 0x4E, 0x4C, 0x4C, 0x4D, 0x52, 0x5D, 0x6F, 0xEE, 0xE4, 0xDE, 0xDB, 0xD7,
+        0xD4, 0xD2, 0xD1, 0xD1, 0xD1, 0xD2, 0xD2, 0xD0, 0xCE, 0xCD, 0xCC, 0xCE, 0xD3, 0xDE, 0xF3, 0x6E,
+        0x64, 0x5E, 0x5B, 0x57, 0x54, 0x52, 0x51, 0x50, 0x50, 0x51, 0x51, 0x4F, 0x4E, 0x4C, 0x4B, 0x4D,
+        0x53, 0x5D, 0x6F, 0xF0, 0xE7, 0xE1, 0xDD, 0xDA, 0xD7, 0xD5, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD1,
+        0xCE, 0xCD, 0xCC, 0xCE, 0xD4, 0xDF, 0xF6, 0x6D, 0x65, 0x60, 0x5E, 0x5B, 0x58, 0x56, 0x54, 0x52,
+        0x52, 0x52, 0x52, 0x4F, 0x4E, 0x4C, 0x4B, 0x4D, 0x52, 0x5D, 0x6E, 0xF4, 0xEA, 0xE5, 0xDF, 0xDC,
+        0xD9, 0xD6, 0xD4, 0xD3, 0xD4, 0xD4, 0xD4, 0xD1, 0xCE, 0xCC, 0xCC, 0xCD, 0xD4, 0xDF, 0xF5, 0x6D,
+        0x64, 0x5E, 0x5B, 0x58, 0x55, 0x52, 0x51, 0x51, 0x52, 0x54, 0x54, 0x52, 0x4F, 0x4D, 0x4C, 0x4D,
+        0x52, 0x5D, 0x6F, 0xEF, 0xE6, 0xDF, 0xDC, 0xD9, 0xD6, 0xD4, 0xD3, 0xD4, 0xD6, 0xD8, 0xD8, 0xD5,
+        0xD1, 0xCE, 0xCD, 0xCE, 0xD4, 0xDF, 0xF7, 0x6B, 0x61, 0x5D, 0x5A, 0x57, 0x54, 0x52, 0x52, 0x53,
+        0x55, 0x58, 0x58, 0x55, 0x50, 0x4D, 0x4C, 0x4E, 0x53, 0x5E, 0x74, 0xED, 0xE3, 0xDE, 0xDB, 0xD7,
+        0xD5, 0xD3, 0xD3, 0xD4, 0xD6, 0xD8, 0xD8, 0xD5, 0xD0, 0xCD, 0xCC, 0xCD, 0xD3, 0xDE, 0xF2, 0x6E,
+        0x64, 0x5F, 0x5C, 0x5A, 0x57, 0x56, 0x55, 0x56, 0x58, 0x5A, 0x59, 0x56, 0x51, 0x4E, 0x4C, 0x4E,
+        0x53, 0x5E, 0x71, 0xEF, 0xE6, 0xE1, 0xDE, 0xDC, 0xD9, 0xD7, 0xD6, 0xD6, 0xD7, 0xD8, 0xD7, 0xD3,
+        0xCF, 0xCC, 0xCB, 0xCD, 0xD1, 0xDB, 0xEA, 0x7C, 0x6D, 0x69, 0x64, 0x5F, 0x5C, 0x5A, 0x59, 0x58,
+        0x59, 0x5A, 0x59, 0x55, 0x50, 0x4D, 0x4C, 0x4D, 0x53, 0x5D, 0x6F, 0xF1, 0xE8, 0xE3, 0xDF, 0xDD,
+        0xDA, 0xD8, 0xD7, 0xD7, 0xD7, 0xD7, 0xD6, 0xD3, 0xCE, 0xCC, 0xCB, 0xCD, 0xD2, 0xDD, 0xEE, 0x73,
+        0x69, 0x65, 0x60, 0x5D, 0x5B, 0x59, 0x58, 0x58, 0x58, 0x59, 0x58, 0x55, 0x50, 0x4D, 0x4C, 0x4E,
+        0x54, 0x5F, 0x76, 0xEC, 0xE3, 0xDE, 0xDC, 0xD9, 0xD7, 0xD5, 0xD5, 0xD5, 0xD6, 0xD7, 0xD6, 0xD3,
+        0xCF, 0xCC, 0xCB, 0xCD, 0xD2, 0xDD, 0xEF, 0x6F, 0x64, 0x5F, 0x5B, 0x58, 0x56, 0x54, 0x53, 0x54,
+        0x55, 0x56, 0x56, 0x52, 0x4E, 0x4C, 0x4B, 0x4D, 0x52, 0x5D, 0x6F, 0xEF, 0xE5, 0xDF, 0xDB, 0xD7,
+        0xD5, 0xD3, 0xD3, 0xD4, 0xD5, 0xD6, 0xD6, 0xD3, 0xCF, 0xCC, 0xCB, 0xCD, 0xD3, 0xDE, 0xF1, 0x6E,
+        0x64, 0x5E, 0x5A, 0x57, 0x54, 0x53, 0x53, 0x53, 0x55, 0x56, 0x56, 0x52, 0x4E, 0x4C, 0x4B, 0x4D,
+        0x52, 0x5D, 0x6F, 0xF1, 0xE6, 0xDF, 0xDB, 0xD8, 0xD5, 0xD4, 0xD4, 0xD5, 0xD6, 0xD8, 0xD7, 0xD4,
+        0xCF, 0xCD, 0xCC, 0xCE, 0xD5, 0xDF, 0xF3, 0x6E, 0x65, 0x5F, 0x5B, 0x58, 0x55, 0x54, 0x54, 0x56,
+        0x58, 0x59, 0x58, 0x54, 0x4F, 0x4D, 0x4C, 0x4E, 0x54, 0x5E, 0x6F, 0xF3, 0xE9, 0xE3, 0xDE, 0xDB,
+        0xD8, 0xD7, 0xD7, 0xD8, 0xD9, 0xD9, 0xD8, 0xD4, 0xCF, 0xCD, 0xCC, 0xCE, 0xD4, 0xDE, 0xEE, 0x78,
+        0x6C, 0x66, 0x5F, 0x5B, 0x58, 0x56, 0x56, 0x56, 0x57, 0x57, 0x55, 0x52, 0x4E, 0x4C, 0x4B, 0x4D,
+        0x53, 0x5C, 0x6B, 0xFD, 0xEE, 0xE7, 0xE0, 0xDC, 0xD8, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD6, 0xD2,
+        0xCE, 0xCC, 0xCB, 0xCD, 0xD3, 0xDC, 0xEB, 0x7C, 0x6D, 0x67, 0x60, 0x5C, 0x59, 0x57, 0x57, 0x58,
+        0x58, 0x58, 0x56, 0x53, 0x4E, 0x4C, 0x4B, 0x4D, 0x52, 0x5B, 0x68, 0x7C, 0xF2, 0xEA, 0xE2, 0xDD,
+        0xD9, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD7, 0xD4, 0xCF, 0xCD, 0xCC, 0xCD, 0xD2, 0xDB, 0xE9, 0xFD,
+        0x6E, 0x67, 0x5F, 0x5B, 0x58, 0x57, 0x58, 0x58, 0x59, 0x59, 0x58, 0x54, 0x4F, 0x4C, 0x4B, 0x4D,
+        0x52, 0x5B, 0x69, 0xFF, 0xEE, 0xE6, 0xDF, 0xDC, 0xDA, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xD9, 0xD5,
+        0xCF, 0xCD, 0xCC, 0xCD, 0xD3, 0xDD, 0xEC, 0x79, 0x6B, 0x64, 0x5F, 0x5C, 0x5A, 0x59, 0x5A, 0x5A,
+        0x5B, 0x5B, 0x59, 0x55, 0x50, 0x4D, 0x4C, 0x4E, 0x54, 0x5E, 0x6F, 0xF4, 0xE9, 0xE3, 0xDF, 0xDC,
+        0xDA, 0xDA, 0xDA, 0xDB, 0xDC, 0xDC, 0xDB, 0xD8, 0xD2, 0xCE, 0xCD, 0xCF, 0xD6, 0xDF, 0xF2, 0x71,
+        0x68, 0x64, 0x5F, 0x5D, 0x5B, 0x5A, 0x5A, 0x5B, 0x5C, 0x5C, 0x5B, 0x58, 0x53, 0x4F, 0x4E, 0x4F,
+        0x56, 0x60, 0x73, 0xF1, 0xE8, 0xE4, 0xDF, 0xDC, 0xDA, 0xD9, 0xDA, 0xDA, 0xDB, 0xDC, 0xDC, 0xD9,
+        0xD4, 0xD0, 0xCE, 0xD1, 0xD8, 0xE3, 0xFA, 0x6C, 0x64, 0x60, 0x5E, 0x5B, 0x59, 0x58, 0x59, 0x5A,
+        0x5B, 0x5D, 0x5D, 0x5A, 0x56, 0x51, 0x50, 0x53, 0x5B, 0x69, 0xF7, 0xE6, 0xDF, 0xDD, 0xDB, 0xD9,
+        0xD7, 0xD7, 0xD7, 0xD9, 0xDA, 0xDB, 0xDB, 0xD8, 0xD4, 0xD0, 0xCF, 0xD2, 0xDA, 0xE8, 0x78, 0x66,
+        0x5F, 0x5D, 0x5B, 0x59, 0x58, 0x58, 0x58, 0x5A, 0x5B, 0x5C, 0x5D, 0x5A, 0x56, 0x52, 0x51, 0x55,
+        0x5D, 0x6F, 0xEC, 0xDE, 0xDB, 0xD9, 0xD7, 0xD6, 0xD5, 0xD5, 0xD6, 0xD8, 0xDA, 0xDC, 0xDC, 0xDA,
+        0xD6, 0xD2, 0xD1, 0xD4, 0xDC, 0xED, 0x6E, 0x60, 0x5C, 0x5B, 0x59, 0x58, 0x57, 0x58, 0x59, 0x5B,
+        0x5D, 0x5F, 0x5F, 0x5D, 0x59, 0x55, 0x53, 0x56, 0x5D, 0x6F, 0xED, 0xE0, 0xDC, 0xDB, 0xDA, 0xD8,
+        0xD8, 0xD8, 0xDA, 0xDC, 0xDE, 0xDF, 0xDF, 0xDD, 0xD8, 0xD4, 0xD2, 0xD5, 0xDC, 0xEC, 0x70, 0x63,
+        0x5E, 0x5C, 0x5B, 0x59, 0x58, 0x59, 0x5B, 0x5D, 0x5E, 0x5F, 0x5E, 0x5C, 0x57, 0x52, 0x51, 0x54,
+        0x5C, 0x6C, 0xF0, 0xE3, 0xDE, 0xDD, 0xDC, 0xDB, 0xDA, 0xDA, 0xDC, 0xDE, 0xDE, 0xDF, 0xDE, 0xDA,
+        0xD6, 0xD2, 0xD0, 0xD5, 0xDD, 0xEF, 0x6B, 0x5F, 0x5C, 0x5B, 0x5A, 0x59, 0x58, 0x58, 0x5A, 0x5B,
+        0x5C, 0x5C, 0x5B, 0x58, 0x55, 0x51, 0x51, 0x55, 0x5E, 0x73, 0xEA, 0xDF, 0xDC, 0xDC, 0xDB, 0xDA,
+        0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDC, 0xDA, 0xD6, 0xD3, 0xD2, 0xD6, 0xDE, 0xF2, 0x6C, 0x61,
+        0x5E, 0x5E, 0x5D, 0x5C, 0x5A, 0x5A, 0x5B, 0x5C, 0x5D, 0x5D, 0x5C, 0x5A, 0x55, 0x52, 0x51, 0x55,
+        0x5D, 0x6D, 0xF0, 0xE5, 0xE1, 0xE0, 0xDF, 0xDC, 0xDA, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDD, 0xDA,
+        0xD6, 0xD2, 0xD1, 0xD4, 0xDC, 0xED, 0x71, 0x64, 0x60, 0x5F, 0x5E, 0x5B, 0x5A, 0x5A, 0x5B, 0x5D,
+        0x5E, 0x5F, 0x5E, 0x5C, 0x57, 0x53, 0x51, 0x55, 0x5C, 0x6B, 0xF4, 0xE6, 0xE1, 0xDF, 0xDE, 0xDD,
+        0xDB, 0xDB, 0xDD, 0xDF, 0xE1, 0xE3, 0xE1, 0xDE, 0xD9, 0xD5, 0xD4, 0xD7, 0xDE, 0xEF, 0x6F, 0x64,
+        0x60, 0x5F, 0x5E, 0x5C, 0x5B, 0x5B, 0x5D, 0x5F, 0x61, 0x62, 0x61, 0x5D, 0x59, 0x55, 0x54, 0x57,
+        0x5E, 0x6F, 0xEF, 0xE5, 0xE1, 0xE1, 0xDF, 0xDE, 0xDD, 0xDD, 0xDE, 0xE0, 0xE3, 0xE3, 0xE2, 0xDE,
+        0xDA, 0xD7, 0xD6, 0xD9, 0xE2, 0xF9, 0x6B, 0x62, 0x60, 0x5F, 0x5F, 0x5D, 0x5C, 0x5C, 0x5D, 0x5F,
+        0x5F, 0x60, 0x5F, 0x5C, 0x59, 0x56, 0x55, 0x59, 0x61, 0x75, 0xEE, 0xE5, 0xE3, 0xE2, 0xE0, 0xDE,
+        0xDC, 0xDC, 0xDD, 0xDF, 0xE0, 0xE0, 0xDF, 0xDD, 0xDA, 0xD8, 0xD7, 0xDB, 0xE3, 0xF8, 0x6D, 0x64,
+        0x61, 0x5F, 0x5E, 0x5C, 0x5A, 0x5A, 0x5C, 0x5E, 0x5F, 0x61, 0x60, 0x5E, 0x5B, 0x59, 0x58, 0x5C,
+        0x65, 0x7A, 0xEC, 0xE3, 0xE0, 0xDF, 0xDE, 0xDC, 0xDB, 0xDB, 0xDD, 0xDF, 0xE2, 0xE3, 0xE2, 0xDF,
+        0xDD, 0xDA, 0xDA, 0xDD, 0xE7, 0xFB, 0x6C, 0x64, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x5D, 0x5E, 0x60,
+        0x61, 0x62, 0x60, 0x5E, 0x5B, 0x59, 0x59, 0x5C, 0x65, 0x78, 0xEE, 0xE6, 0xE4, 0xE3, 0xE1, 0xDE,
+        0xDD, 0xDC, 0xDD, 0xDE, 0xDE, 0xDE, 0xDD, 0xDB, 0xD9, 0xD7, 0xD7, 0xDA, 0xE1, 0xF2, 0x71, 0x68,
+        0x65, 0x64, 0x61, 0x5E, 0x5C, 0x5C, 0x5C, 0x5D, 0x5E, 0x5E, 0x5D, 0x5B, 0x59, 0x57, 0x57, 0x5A,
+        0x63, 0x77, 0xED, 0xE4, 0xE1, 0xE1, 0xDF, 0xDD, 0xDC, 0xDB, 0xDC, 0xDE, 0xDF, 0xDF, 0xDE, 0xDB,
+        0xD8, 0xD6, 0xD6, 0xD9, 0xE0, 0xF0, 0x73, 0x69, 0x67, 0x67, 0x66, 0x62, 0x5F, 0x5F, 0x60, 0x63,
+        0x65, 0x65, 0x62, 0x5E, 0x5A, 0x57, 0x56, 0x59, 0x60, 0x70, 0xF4, 0xEA, 0xE8, 0xE8, 0xE6, 0xE3,
+        0xDF, 0xDF, 0xE0, 0xE2, 0xE3, 0xE3, 0xE0, 0xDD, 0xD9, 0xD6, 0xD5, 0xD8, 0xDE, 0xEC, 0x7C, 0x6E,
+        0x6B, 0x6A, 0x67, 0x63, 0x5F, 0x5F, 0x60, 0x62, 0x64, 0x65, 0x62, 0x5E, 0x5B, 0x58, 0x57, 0x5A,
+        0x61, 0x70, 0xF5, 0xEA, 0xE7, 0xE7, 0xE4, 0xE0, 0xDE, 0xDE, 0xDF, 0xE1, 0xE4, 0xE5, 0xE2, 0xDF,
+        0xDC, 0xD9, 0xD9, 0xDB, 0xE3, 0xF5, 0x70, 0x68, 0x65, 0x65, 0x63, 0x5F, 0x5D, 0x5D, 0x5E, 0x61,
+        0x64, 0x65, 0x63, 0x5F, 0x5D, 0x5A, 0x59, 0x5C, 0x64, 0x77, 0xEE, 0xE6, 0xE3, 0xE2, 0xE0, 0xDD,
+        0xDC, 0xDB, 0xDD, 0xE0, 0xE4, 0xE6, 0xE5, 0xE2, 0xDE, 0xDB, 0xDA, 0xDD, 0xE4, 0xF5, 0x6F, 0x66,
+        0x62, 0x60, 0x5E, 0x5B, 0x5A, 0x5A, 0x5B, 0x5E, 0x61, 0x64, 0x63, 0x60, 0x5D, 0x5A, 0x59, 0x5B,
+        0x60, 0x6E, 0xF8, 0xEB, 0xE6, 0xE3, 0xDF, 0xDC, 0xDA, 0xD9, 0xDB, 0xDD, 0xDF, 0xE3, 0xE4, 0xE2,
+        0xDE, 0xDC, 0xDA, 0xDC, 0xE2, 0xEF, 0x76, 0x6A, 0x65, 0x62, 0x5E, 0x5B, 0x58, 0x57, 0x58, 0x5B,
+        0x5D, 0x5F, 0x60, 0x5F, 0x5D, 0x5B, 0x5A, 0x5B, 0x60, 0x6C, 0xFE, 0xEE, 0xEA, 0xE6, 0xE1, 0xDC,
+        0xD9, 0xD8, 0xD8, 0xDB, 0xDD, 0xDF, 0xE0, 0xDF, 0xDE, 0xDC, 0xDB, 0xDD, 0xE3, 0xEF, 0x77, 0x6B,
+        0x67, 0x64, 0x5F, 0x5B, 0x58, 0x56, 0x57, 0x59, 0x5B, 0x5D, 0x5E, 0x5E, 0x5C, 0x5A, 0x59, 0x5B,
+        0x60, 0x6D, 0xFC, 0xED, 0xE9, 0xE6, 0xE1, 0xDC, 0xD9, 0xD7, 0xD7, 0xD9, 0xDC, 0xDE, 0xDF, 0xDE,
+        0xDD, 0xDA, 0xD9, 0xDB, 0xE0, 0xED, 0x7A, 0x6C, 0x67, 0x63, 0x5F, 0x5B, 0x57, 0x55, 0x55, 0x58,
+        0x5B, 0x5D, 0x5E, 0x5E, 0x5D, 0x5B, 0x5A, 0x5C, 0x62, 0x6F, 0xF7, 0xEA, 0xE6, 0xE2, 0xDE, 0xDA,
+        0xD6, 0xD3, 0xD4, 0xD7, 0xDA, 0xDD, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0xDE, 0xE6, 0xF6, 0x72, 0x68,
+        0x65, 0x61, 0x5D, 0x59, 0x55, 0x52, 0x53, 0x56, 0x59, 0x5C, 0x5F, 0x5F, 0x5F, 0x5E, 0x5E, 0x61,
+        0x69, 0x79, 0xEF, 0xE7, 0xE3, 0xDF, 0xDC, 0xD8, 0xD3, 0xD1, 0xD1, 0xD4, 0xD7, 0xDA, 0xDD, 0xDE,
+        0xDE, 0xDD, 0xDC, 0xDE, 0xE5, 0xF1, 0x77, 0x6A, 0x65, 0x60, 0x5C, 0x57, 0x53, 0x50, 0x51, 0x53,
+        0x57, 0x5B, 0x5D, 0x5E, 0x5D, 0x5C, 0x5C, 0x5D, 0x62, 0x6E, 0xF9, 0xEA, 0xE4, 0xDF, 0xDB, 0xD6,
+        0xD1, 0xCF, 0xCF, 0xD2, 0xD6, 0xD9, 0xDC, 0xDC, 0xDC, 0xDA, 0xDA, 0xDB, 0xDF, 0xEA, 0xFF, 0x6C,
+        0x65, 0x5F, 0x5B, 0x56, 0x52, 0x4F, 0x4F, 0x52, 0x55, 0x59, 0x5C, 0x5D, 0x5C, 0x5B, 0x5A, 0x5B,
+        0x5F, 0x6C, 0xFC, 0xEB, 0xE3, 0xDE, 0xDA, 0xD5, 0xD0, 0xCF, 0xCF, 0xD1, 0xD4, 0xD8, 0xDC, 0xDE,
+        0xDD, 0xDC, 0xDB, 0xDD, 0xE1, 0xED, 0x7B, 0x6B, 0x64, 0x5F, 0x5B, 0x56, 0x51, 0x4F, 0x50, 0x52,
+        0x56, 0x5B, 0x5F, 0x62, 0x62, 0x5F, 0x5E, 0x5E, 0x64, 0x6F, 0xF8, 0xEA, 0xE4, 0xDF, 0xDB, 0xD6,
+        0xD2, 0xD0, 0xD1, 0xD3, 0xD7, 0xDB, 0xDF, 0xE2, 0xE2, 0xDF, 0xDE, 0xDE, 0xE3, 0xEE, 0x7B, 0x6C,
+        0x65, 0x5F, 0x5A, 0x55, 0x50, 0x4F, 0x4F, 0x51, 0x56, 0x5B, 0x5F, 0x64, 0x63, 0x60, 0x5E, 0x5E,
+        0x62, 0x6C, 0xFE, 0xEC, 0xE4, 0xDE, 0xD9, 0xD4, 0xCF, 0xCE, 0xCE, 0xD0, 0xD5, 0xDA, 0xDF, 0xE3,
+        0xE3, 0xE0, 0xDE, 0xDD, 0xE0, 0xEA, 0xFD, 0x6D, 0x65, 0x5E, 0x5A, 0x54, 0x4F, 0x4E, 0x4E, 0x51,
+        0x55, 0x5B, 0x5F, 0x63, 0x63, 0x60, 0x5D, 0x5D, 0x5F, 0x68, 0x78, 0xEF, 0xE6, 0xDF, 0xDA, 0xD5,
+        0xD0, 0xCF, 0xCF, 0xD1, 0xD6, 0xDB, 0xDF, 0xE2, 0xE1, 0xDE, 0xDC, 0xDB, 0xDD, 0xE4, 0xF0, 0x76,
+        0x6A, 0x62, 0x5C, 0x56, 0x52, 0x4F, 0x50, 0x52, 0x56, 0x5B, 0x5F, 0x62, 0x61, 0x5F, 0x5C, 0x5B,
+        0x5D, 0x64, 0x70, 0xF6, 0xEA, 0xE1, 0xDB, 0xD6, 0xD1, 0xCF, 0xCF, 0xD2, 0xD6, 0xDB, 0xDF, 0xE3,
+        0xE4, 0xE1, 0xDE, 0xDD, 0xDF, 0xE8, 0xF8, 0x70, 0x67, 0x60, 0x5C, 0x56, 0x52, 0x50, 0x50, 0x53,
+        0x58, 0x5C, 0x62, 0x67, 0x68, 0x66, 0x61, 0x60, 0x63, 0x6C, 0xFE, 0xEC, 0xE5, 0xDF, 0xDB, 0xD7,
+        0xD3, 0xD1, 0xD2, 0xD5, 0xD9, 0xDE, 0xE5, 0xEA, 0xEC, 0xE9, 0xE4, 0xE2, 0xE6, 0xF0, 0x76, 0x68,
+        0x60, 0x5D, 0x5A, 0x55, 0x51, 0x4F, 0x50, 0x53, 0x57, 0x5C, 0x60, 0x66, 0x67, 0x65, 0x61, 0x5F,
+        0x63, 0x6C, 0xFC, 0xEB, 0xE3, 0xDE, 0xDA, 0xD6, 0xD1, 0xCF, 0xD0, 0xD3, 0xD7, 0xDC, 0xE1, 0xE7,
+        0xE9, 0xE7, 0xE3, 0xE1, 0xE6, 0xEF, 0x76, 0x67, 0x5F, 0x5C, 0x58, 0x54, 0x4F, 0x4E, 0x4F, 0x50,
+        0x55, 0x5A, 0x5E, 0x63, 0x65, 0x62, 0x5E, 0x5D, 0x5F, 0x69, 0x7B, 0xEE, 0xE6, 0xDF, 0xDB, 0xD6,
+        0xD2, 0xCF, 0xD0, 0xD3, 0xD8, 0xDC, 0xE2, 0xE8, 0xE9, 0xE6, 0xE1, 0xDF, 0xE2, 0xEC, 0x7C, 0x6A,
+        0x62, 0x5D, 0x59, 0x55, 0x50, 0x4F, 0x4F, 0x52, 0x56, 0x5B, 0x5F, 0x64, 0x65, 0x62, 0x5E, 0x5D,
+        0x5F, 0x6A, 0x7F, 0xEC, 0xE4, 0xDF, 0xDB, 0xD6, 0xD2, 0xD0, 0xD1, 0xD4, 0xD8, 0xDD, 0xE3, 0xE8,
+        0xE9, 0xE6, 0xE2, 0xE0, 0xE4, 0xEE, 0x76, 0x68, 0x61, 0x5D, 0x5A, 0x56, 0x52, 0x50, 0x51, 0x54,
+        0x59, 0x5E, 0x65, 0x6B, 0x6C, 0x69, 0x63, 0x61, 0x65, 0x6F, 0xF7, 0xE9, 0xE2, 0xDE, 0xDA, 0xD6,
+        0xD2, 0xD0, 0xD1, 0xD4, 0xD8, 0xDD, 0xE5, 0xEA, 0xEC, 0xE8, 0xE4, 0xE1, 0xE5, 0xEE, 0x7A, 0x6B,
+        0x63, 0x5F, 0x5B, 0x57, 0x53, 0x52, 0x53, 0x55, 0x5A, 0x5F, 0x67, 0x6C, 0x6E, 0x6B, 0x67, 0x65,
+        0x69, 0x75, 0xF1, 0xE7, 0xE0, 0xDD, 0xDA, 0xD6, 0xD2, 0xD1, 0xD1, 0xD4, 0xD8, 0xDD, 0xE3, 0xE8,
+        0xEA, 0xE7, 0xE2, 0xE1, 0xE5, 0xEE, 0x7C, 0x6C, 0x66, 0x61, 0x5D, 0x59, 0x55, 0x53, 0x53, 0x56,
+        0x5A, 0x5E, 0x65, 0x6A, 0x6B, 0x68, 0x64, 0x63, 0x66, 0x6F, 0xFA, 0xEC, 0xE7, 0xE2, 0xDE, 0xD9,
+        0xD6, 0xD3, 0xD3, 0xD5, 0xD8, 0xDC, 0xE0, 0xE5, 0xE7, 0xE4, 0xDF, 0xDE, 0xE1, 0xE9, 0xF6, 0x77,
+        0x6E, 0x69, 0x63, 0x5D, 0x58, 0x56, 0x55, 0x57, 0x5A, 0x5E, 0x65, 0x6A, 0x6B, 0x69, 0x65, 0x63,
+        0x65, 0x6D, 0x7E, 0xEF, 0xEA, 0xE5, 0xDF, 0xDB, 0xD7, 0xD5, 0xD5, 0xD7, 0xDA, 0xDE, 0xE4, 0xE9,
+        0xEA, 0xE8, 0xE4, 0xE2, 0xE5, 0xED, 0xFF, 0x70, 0x6A, 0x66, 0x60, 0x5C, 0x59, 0x57, 0x56, 0x58,
+        0x5B, 0x5F, 0x66, 0x6A, 0x6C, 0x69, 0x66, 0x64, 0x67, 0x6F, 0xFD, 0xEF, 0xEA, 0xE6, 0xE0, 0xDC,
+        0xD8, 0xD6, 0xD6, 0xD7, 0xDA, 0xDE, 0xE4, 0xEA, 0xEB, 0xE9, 0xE6, 0xE4, 0xE7, 0xEF, 0xFF, 0x71,
+        0x6C, 0x68, 0x63, 0x5E, 0x5A, 0x57, 0x56, 0x57, 0x5A, 0x5E, 0x62, 0x68, 0x69, 0x68, 0x65, 0x64,
+        0x67, 0x6F, 0x7F, 0xF1, 0xED, 0xE9, 0xE5, 0xDE, 0xDA, 0xD7, 0xD7, 0xD8, 0xDA, 0xDD, 0xE2, 0xE7,
+        0xE9, 0xE8, 0xE6, 0xE6, 0xEA, 0xF4, 0x79, 0x6D, 0x69, 0x66, 0x61, 0x5C, 0x58, 0x56, 0x55, 0x57,
+        0x5A, 0x5E, 0x62, 0x66, 0x68, 0x65, 0x63, 0x62, 0x65, 0x6C, 0x7A, 0xF6, 0xEE, 0xEA, 0xE5, 0xDE,
+        0xDA, 0xD7, 0xD7, 0xD9, 0xDC, 0xE1, 0xE7, 0xEB, 0xEB, 0xE9, 0xE5, 0xE3, 0xE6, 0xED, 0xFB, 0x74,
+        0x6D, 0x68, 0x62, 0x5C, 0x58,
+    };
+
+    const uint8_t beepData[2400] = {
+        0xFF, 0xF5, 0xE5, 0xDA, 0xD2, 0xCF, 0xD0, 0xDA, 0xFF, 0x55, 0x47, 0x3E, 0x3B, 0x3B, 0x3F, 0x4B,
+        0xFF, 0xC9, 0xBA, 0xB2, 0xAF, 0xAF, 0xB6, 0xC1, 0xFF, 0x3F, 0x31, 0x2B, 0x29, 0x2A, 0x2E, 0x3B,
+        0xFF, 0xBA, 0xAC, 0xA5, 0xA2, 0xA4, 0xA9, 0xB7, 0xFF, 0x35, 0x27, 0x1F, 0x1E, 0x1F, 0x25, 0x32,
+        0xFF, 0xB0, 0xA3, 0x9C, 0x9A, 0x9C, 0xA0, 0xAE, 0xFF, 0x2E, 0x1F, 0x19, 0x17, 0x19, 0x1E, 0x2C,
+        0xFF, 0xAB, 0x9D, 0x96, 0x94, 0x96, 0x9B, 0xA9, 0xFF, 0x29, 0x1A, 0x14, 0x11, 0x13, 0x19, 0x27,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA6, 0x99, 0x92, 0x8F, 0x92, 0x99, 0xA6, 0xFF, 0x26, 0x19, 0x12, 0x0F, 0x12, 0x19, 0x26,
+        0xFF, 0xA7, 0x99, 0x93, 0x91, 0x94, 0x9A, 0xA9, 0xFF, 0x29, 0x1B, 0x16, 0x14, 0x16, 0x1D, 0x2B,
+        0xFF, 0xAC, 0x9E, 0x99, 0x97, 0x99, 0x9F, 0xAE, 0xFF, 0x2E, 0x20, 0x1C, 0x1A, 0x1C, 0x23, 0x30,
+        0xFF, 0xB2, 0xA5, 0x9F, 0x9E, 0x9F, 0xA7, 0xB5, 0xFF, 0x37, 0x29, 0x24, 0x22, 0x25, 0x2C, 0x3A,
+        0xFF, 0xBB, 0xAE, 0xAA, 0xA9, 0xAB, 0xB1, 0xBF, 0xFF, 0x41, 0x36, 0x2F, 0x2F, 0x32, 0x3A, 0x49,
+        0xFF, 0xCB, 0xBF, 0xBB, 0xBB, 0xBE, 0xC7, 0xD5, 0xFF, 0x5A, 0x50, 0x4F, 0x52, 0x5A, 0x65, 0x75,
+    };
+
+    const uint8_t chimeData[4800] = {
+        0x60, 0x77, 0x23, 0x90, 0xED, 0xCC, 0xAA, 0x09, 0x53, 0x45, 0x33, 0x12, 0xC8, 0xDC, 0xCB, 0x9B,
+        0x09, 0x53, 0x44, 0x33, 0x02, 0xB8, 0xCD, 0xBC, 0xAB, 0x09, 0x53, 0x44, 0x33, 0x12, 0xA8, 0xCD,
+        0xBC, 0xAB, 0x88, 0x52, 0x34, 0x34, 0x02, 0xA0, 0xCC, 0xBC, 0xAB, 0x09, 0x32, 0x46, 0x32, 0x12,
+        0x98, 0xDB, 0xBC, 0xAB, 0x0A, 0x41, 0x44, 0x33, 0x12, 0x90, 0xEB, 0xCB, 0xAB, 0x89, 0x31, 0x54,
+        0x33, 0x13, 0x90, 0xDB, 0xBC, 0xAC, 0x89, 0x20, 0x44, 0x24, 0x22, 0x80, 0xCA, 0xBC, 0xAC, 0x8A,
+        0x20, 0x63, 0x33, 0x23, 0x81, 0xDA, 0xBC, 0xAC, 0x9A, 0x20, 0x63, 0x33, 0x23, 0x01, 0xCA, 0xBD,
+        0xAC, 0x9A, 0x28, 0x53, 0x53, 0x22, 0x81, 0xB9, 0xCC, 0xCB, 0x8A, 0x18, 0x42, 0x44, 0x22, 0x01,
+        0xA9, 0xCC, 0xAC, 0x9A, 0x08, 0x43, 0x34, 0x33, 0x12, 0xB9, 0xDD, 0xBB, 0xAA, 0x19, 0x52, 0x34,
+        0x24, 0x11, 0xA8, 0xCC, 0xCB, 0xAA, 0x08, 0x32, 0x45, 0x23, 0x12, 0xA8, 0xEB, 0xCB, 0xAA, 0x09,
+        0x41, 0x53, 0x23, 0x13, 0xA8, 0xDB, 0xBC, 0xBB, 0x89, 0x32, 0x46, 0x23, 0x13, 0xA0, 0xDB, 0xBC,
+        0xBB, 0x89, 0x31, 0x55, 0x23, 0x13, 0x91, 0xDB, 0xBC, 0xBB, 0x8A, 0x30, 0x36, 0x34, 0x13, 0x91,
+        0xDA, 0xDB, 0xAB, 0x8A, 0x20, 0x44, 0x34, 0x22, 0x80, 0xBA, 0xBE, 0xAC, 0x8A, 0x10, 0x34, 0x25,
+        0x23, 0x81, 0xC9, 0xBC, 0xBC, 0x9A, 0x10, 0x63, 0x33, 0x24, 0x81, 0xB9, 0xCC, 0xAC, 0x9A, 0x18,
+        0x52, 0x43, 0x23, 0x02, 0xB9, 0xCD, 0xBB, 0xAB, 0x18, 0x63, 0x43, 0x23, 0x02, 0xB8, 0xBD, 0xAD,
+        0x9B, 0x08, 0x42, 0x34, 0x24, 0x02, 0xA8, 0xEB, 0xBB, 0xBB, 0x08, 0x52, 0x34, 0x24, 0x12, 0xA8,
+        0xDB, 0xBC, 0xAB, 0x09, 0x41, 0x44, 0x33, 0x12, 0xA0, 0xEB, 0xCB, 0xAB, 0x09, 0x31, 0x45, 0x33,
+        0x12, 0x90, 0xEB, 0xCB, 0xAB, 0x89, 0x31, 0x54, 0x33, 0x13, 0x90, 0xDB, 0xBC, 0xAC, 0x89, 0x20,
+        0x44, 0x24, 0x22, 0x80, 0xCA, 0xBC, 0xAC, 0x8A, 0x20, 0x34, 0x35, 0x13, 0x81, 0xCA, 0xCC, 0xAB,
+        0x9A, 0x10, 0x44, 0x34, 0x23, 0x81, 0xCA, 0xBC, 0xAD, 0x8A, 0x18, 0x53, 0x43, 0x22, 0x01, 0xB9,
+        0xCD, 0xBB, 0x9A, 0x18, 0x34, 0x45, 0x22, 0x01, 0xA9, 0xCC, 0xAC, 0x9A, 0x08, 0x43, 0x34, 0x33,
+        0x12, 0xB9, 0xBE, 0xBC, 0xAB, 0x08, 0x43, 0x35, 0x24, 0x11, 0xA8, 0xCC, 0xBB, 0x9C, 0x09, 0x32,
+        0x36, 0x33, 0x12, 0xA8, 0xBD, 0xBD, 0xAA, 0x89, 0x42, 0x34, 0x34, 0x12, 0x98, 0xEB, 0xCB, 0xAA,
+        0x89, 0x22, 0x45, 0x23, 0x13, 0xA0, 0xDB, 0xBC, 0xBB, 0x89, 0x31, 0x55, 0x23, 0x13, 0x91, 0xDB,
+        0xBC, 0xBB, 0x8A, 0x30, 0x36, 0x34, 0x13, 0x91, 0xDA, 0xDB, 0xAB, 0x8A, 0x20, 0x44, 0x34, 0x22,
+        0x80, 0xBA, 0xBE, 0xAC, 0x8A, 0x10, 0x34, 0x25, 0x23, 0x81, 0xC9, 0xBC, 0xBC, 0x9A, 0x10, 0x34,
+        0x35, 0x33, 0x81, 0xB9, 0xCE, 0xBA, 0xAA, 0x10, 0x53, 0x34, 0x23, 0x02, 0xB9, 0xBE, 0xBC, 0xAA,
+        0x18, 0x43, 0x35, 0x33, 0x02, 0xB9, 0xCD, 0xCB, 0xAA, 0x08, 0x43, 0x34, 0x24, 0x02, 0xA8, 0xCC,
+        0xCB, 0xAA, 0x09, 0x42, 0x34, 0x34, 0x11, 0xA8, 0xDB, 0xBC, 0xAB, 0x09, 0x32, 0x36, 0x34, 0x12,
+        0x98, 0xBC, 0xBD, 0xAB, 0x0A, 0x41, 0x44, 0x33, 0x12, 0x90, 0xBC, 0xAE, 0xAB, 0x8A, 0x31, 0x35,
+        0x25, 0x22, 0x90, 0xDA, 0xCB, 0xAB, 0x99, 0x31, 0x44, 0x34, 0x22, 0x80, 0xCB, 0xCC, 0xAB, 0x8A,
+        0x20, 0x44, 0x34, 0x22, 0x81, 0xCA, 0xCC, 0xBB, 0x99, 0x10, 0x44, 0x34, 0x23, 0x81, 0xCA, 0xBC,
+        0xAD, 0x8A, 0x18, 0x53, 0x43, 0x22, 0x01, 0xB9, 0xCD, 0xAB, 0x9B, 0x18, 0x34, 0x45, 0x22, 0x01,
+        0xA9, 0xBD, 0xAC, 0x9B, 0x18, 0x52, 0x53, 0x22, 0x11, 0xA9, 0xCC, 0xCB, 0x9A, 0x08, 0x42, 0x34,
+        0x33, 0x03, 0xB8, 0xCD, 0xAC, 0xAB, 0x08, 0x32, 0x36, 0x24, 0x02, 0xA0, 0xDB, 0xBC, 0xAA, 0x09,
+        0x41, 0x34, 0x34, 0x12, 0x98, 0xBC, 0xBD, 0x9C, 0x89, 0x31, 0x44, 0x33, 0x13, 0x90, 0xCC, 0xBC,
+        0xBB, 0x89, 0x31, 0x55, 0x23, 0x13, 0x80, 0xDB, 0xBC, 0xBB, 0x8A, 0x21, 0x36, 0x34, 0x13, 0x91,
+        0xDA, 0xDB, 0xAB, 0x8A, 0x20, 0x44, 0x34, 0x22, 0x80, 0xCA, 0xBC, 0xAC, 0x9A, 0x20, 0x53, 0x34,
+        0x23, 0x01, 0xCA, 0xCC, 0xBB, 0xAA, 0x20, 0x63, 0x43, 0x23, 0x01, 0xBA, 0xCD, 0xBB, 0xAA, 0x10,
+        0x63, 0x43, 0x23, 0x01, 0xA9, 0xCD, 0xBB, 0x9B, 0x08, 0x63, 0x43, 0x23, 0x02, 0xA9, 0xBD, 0xAD,
+        0x9B, 0x08, 0x42, 0x34, 0x24, 0x02, 0xA8, 0xEB, 0xBB, 0xAB, 0x09, 0x52, 0x34, 0x24, 0x12, 0xA8,
+        0xEB, 0xBB, 0xBB, 0x09, 0x42, 0x35, 0x34, 0x11, 0x90, 0xBC, 0xBD, 0xAB, 0x89, 0x41, 0x34, 0x25,
+        0x12, 0x90, 0xCB, 0xBC, 0xAC, 0x89, 0x21, 0x35, 0x34, 0x12, 0x90, 0xDA, 0xDB, 0xAA, 0x8A, 0x21,
+        0x44, 0x43, 0x12, 0x91, 0xBA, 0xBE, 0xBB, 0x8A, 0x20, 0x45, 0x43, 0x22, 0x80, 0xBA, 0xCD, 0xAB,
+        0x9A, 0x20, 0x63, 0x43, 0x22, 0x81, 0xB9, 0xBE, 0xBB, 0xAA, 0x20, 0x44, 0x34, 0x14, 0x01, 0xB9,
+        0xCC, 0xCB, 0x99, 0x18, 0x42, 0x34, 0x24, 0x01, 0xB9, 0xCC, 0xBB, 0xAB, 0x18, 0x63, 0x43, 0x33,
+        0x02, 0xB9, 0xDC, 0xCB, 0x9A, 0x08, 0x32, 0x36, 0x23, 0x12, 0xB8, 0xDC, 0xBB, 0x9C, 0x09, 0x32,
+        0x45, 0x23, 0x12, 0xA8, 0xEB, 0xCB, 0xAA, 0x09, 0x32, 0x35, 0x34, 0x12, 0x98, 0xBC, 0xBD, 0x9C,
+        0x89, 0x31, 0x44, 0x33, 0x13, 0x90, 0xCC, 0xBC, 0xBB, 0x89, 0x31, 0x55, 0x23, 0x13, 0x80, 0xDB,
+        0xBC, 0xBB, 0x8A, 0x31, 0x45, 0x43, 0x22, 0x80, 0xCA, 0xCC, 0xAB, 0x99, 0x20, 0x44, 0x24, 0x23,
+        0x80, 0xBA, 0xBE, 0xCB, 0x99, 0x10, 0x34, 0x25, 0x23, 0x81, 0xBA, 0xCD, 0xBB, 0x9A, 0x28, 0x44,
+        0x34, 0x23, 0x01, 0xBA, 0xBE, 0xBC, 0x9A, 0x18, 0x53, 0x34, 0x33, 0x01, 0xB9, 0xCD, 0xAC, 0xAA,
+        0x18, 0x52, 0x43, 0x23, 0x02, 0xA9, 0xCD, 0xBB, 0xAB, 0x18, 0x52, 0x34, 0x24, 0x02, 0xA8, 0xEB,
+        0xBB, 0xAB, 0x09, 0x52, 0x34, 0x24, 0x12, 0xA8, 0xEB, 0xBB, 0xBB, 0x88, 0x42, 0x35, 0x34, 0x11,
+        0xA0, 0xDB, 0xDB, 0xAA, 0x09, 0x21, 0x35, 0x34, 0x12, 0x98, 0xDA, 0xBC, 0xAB, 0x8A, 0x32, 0x45,
+        0x43, 0x12, 0x90, 0xCA, 0xBC, 0xAC, 0x89, 0x20, 0x44, 0x43, 0x12, 0x91, 0xBA, 0xBE, 0xBB, 0x8A,
+        0x20, 0x45, 0x43, 0x22, 0x80, 0xBA, 0xCD, 0xAB, 0x9A, 0x20, 0x63, 0x43, 0x22, 0x81, 0xC9, 0xDB,
+        0xAB, 0x9B, 0x20, 0x53, 0x34, 0x14, 0x01, 0xB9, 0xCC, 0xBB, 0x9B, 0x18, 0x44, 0x34, 0x33, 0x82,
+        0xB9, 0xDD, 0xBB, 0xAA, 0x18, 0x53, 0x34, 0x24, 0x01, 0xA9, 0xEB, 0xBB, 0xAA, 0x08, 0x52, 0x34,
+        0x43, 0x01, 0x98, 0xCC, 0xBB, 0x9C, 0x09, 0x32, 0x36, 0x23, 0x03, 0xB0, 0xCC, 0xBC, 0xAB, 0x89,
+        0x42, 0x35, 0x43, 0x02, 0x90, 0xDB, 0xBC, 0xAA, 0x0A, 0x31, 0x36, 0x43, 0x12, 0x90, 0xDB, 0xCB,
+        0xAB, 0x0A, 0x30, 0x45, 0x33, 0x23, 0x90, 0xDB, 0xCC, 0xBA, 0x89, 0x30, 0x44, 0x43, 0x22, 0x80,
+        0xCA, 0xCC, 0xAB, 0x99, 0x20, 0x44, 0x24, 0x23, 0x80, 0xCA, 0xBC, 0xAC, 0x9A, 0x20, 0x63, 0x33,
+        0x33, 0x81, 0xCA, 0xBD, 0xBC, 0x8A, 0x18, 0x34, 0x35, 0x33, 0x81, 0xC9, 0xCC, 0xBB, 0x9A, 0x18,
+        0x63, 0x43, 0x23, 0x01, 0xA9, 0xCD, 0xBB, 0x9B, 0x18, 0x62, 0x43, 0x23, 0x02, 0xA9, 0xBD, 0xAD,
+        0x9B, 0x08, 0x42, 0x34, 0x24, 0x02, 0xA8, 0xCC, 0xCB, 0xAA, 0x08, 0x32, 0x45, 0x33, 0x02, 0x98,
+        0xCC, 0xBC, 0xAB, 0x09, 0x32, 0x36, 0x34, 0x11, 0x90, 0xBC, 0xBD, 0xAB, 0x89, 0x32, 0x45, 0x24,
+        0x12, 0x88, 0xCB, 0xCC, 0xAA, 0x89, 0x21, 0x35, 0x24, 0x13, 0x90, 0xDA, 0xDB, 0xAA, 0x8A, 0x21,
+        0x44, 0x43, 0x12, 0x91, 0xCA, 0xBC, 0xCB, 0x89, 0x10, 0x44, 0x43, 0x22, 0x80, 0xBA, 0xCD, 0xAB,
+        0x9A, 0x20, 0x44, 0x43, 0x23, 0x81, 0xBA, 0xBE, 0xAC, 0x9A, 0x10, 0x53, 0x34, 0x32, 0x81, 0xB9,
+        0xBE, 0xAC, 0x9A, 0x18, 0x43, 0x44, 0x23, 0x01, 0xB9, 0xDC, 0xBB, 0x9A, 0x19, 0x53, 0x34, 0x33,
+        0x02, 0xB8, 0xDD, 0xBB, 0xAA, 0x08, 0x43, 0x35, 0x24, 0x11, 0x99, 0xCC, 0xBB, 0x9C, 0x09, 0x42,
+        0x53, 0x23, 0x12, 0xA8, 0xCC, 0xCB, 0xAB, 0x09, 0x32, 0x36, 0x43, 0x02, 0x90, 0xDB, 0xAC, 0xAB,
+        0x89, 0x31, 0x45, 0x33, 0x13, 0x90, 0xCC, 0xBC, 0xAB, 0x8A, 0x31, 0x36, 0x34, 0x22, 0x90, 0xCB,
+        0xBD, 0xBB, 0x8A, 0x31, 0x45, 0x43, 0x22, 0x80, 0xCA, 0xCC, 0xAB, 0x99, 0x20, 0x44, 0x24, 0x13,
+        0x81, 0xBA, 0xBE, 0xCB, 0x99, 0x20, 0x43, 0x25, 0x23, 0x81, 0xBA, 0xCD, 0xBB, 0x9A, 0x28, 0x44,
+        0x34, 0x33, 0x81, 0xCA, 0xCD, 0xAA, 0x89, 0x21, 0x32, 0x33, 0x24, 0x23, 0x02, 0xFA, 0xCD, 0xAC,
+        0x8A, 0x32, 0x37, 0x23, 0x91, 0xDA, 0xCB, 0x99, 0x20, 0x32, 0x01, 0x98, 0x89, 0x52, 0x44, 0x82,
+        0xFA, 0xDB, 0x9A, 0x38, 0x54, 0x23, 0x81, 0xCB, 0xAC, 0x8A, 0x21, 0x33, 0x02, 0xAA, 0x9C, 0x20,
+        0x45, 0x13, 0xC8, 0xBE, 0xBB, 0x28, 0x54, 0x24, 0x01, 0xB9, 0xCC, 0x99, 0x10, 0x23, 0x12, 0xA8,
+        0xAB, 0x29, 0x45, 0x33, 0xA8, 0xCF, 0xBB, 0x09, 0x44, 0x34, 0x02, 0xB8, 0xBD, 0xAA, 0x28, 0x42,
+        0x12, 0xA0, 0xAA, 0x09, 0x63, 0x33, 0x91, 0xCE, 0xBC, 0x89, 0x42, 0x35, 0x22, 0xA8, 0xCC, 0x9B,
+        0x19, 0x31, 0x14, 0x91, 0xAA, 0x8A, 0x52, 0x24, 0x82, 0xFB, 0xCB, 0x8A, 0x40, 0x53, 0x13, 0xA1,
+        0xDA, 0xAB, 0x89, 0x22, 0x24, 0x81, 0xB9, 0x9A, 0x31, 0x36, 0x03, 0xEA, 0xCC, 0xAA, 0x20, 0x45,
+        0x23, 0x81, 0xCB, 0xAC, 0x8A, 0x21, 0x33, 0x02, 0xB9, 0xAB, 0x30, 0x46, 0x13, 0xC9, 0xCD, 0xAB,
+        0x29, 0x54, 0x33, 0x02, 0xCA, 0xBC, 0x9A, 0x20, 0x33, 0x13, 0xA8, 0xAC, 0x29, 0x54, 0x23, 0xA8,
+        0xBF, 0xBC, 0x19, 0x53, 0x34, 0x12, 0xB9, 0xBD, 0x9B, 0x18, 0x43, 0x22, 0x98, 0xBA, 0x09, 0x53,
+        0x25, 0x90, 0xDC, 0xCB, 0x89, 0x42, 0x44, 0x12, 0xA8, 0xCB, 0xBB, 0x08, 0x42, 0x23, 0x80, 0xBA,
+        0x8A, 0x42, 0x35, 0x82, 0xFB, 0xBC, 0x8B, 0x41, 0x44, 0x23, 0x90, 0xBC, 0xAC, 0x89, 0x31, 0x33,
+        0x82, 0xB9, 0xAB, 0x41, 0x45, 0x02, 0xDA, 0xCC, 0x9B, 0x30, 0x45, 0x23, 0x91, 0xDA, 0xBB, 0x8A,
+        0x31, 0x43, 0x02, 0xA9, 0xAA, 0x28, 0x45, 0x13, 0xC9, 0xDD, 0xAA, 0x28, 0x63, 0x33, 0x01, 0xCA,
+        0xBC, 0x9A, 0x20, 0x43, 0x12, 0x98, 0xAB, 0x19, 0x44, 0x33, 0xB8, 0xCF, 0xBB, 0x19, 0x63, 0x34,
+        0x02, 0xA9, 0xBD, 0x9B, 0x18, 0x43, 0x22, 0x88, 0xAB, 0x0A, 0x62, 0x23, 0x91, 0xDD, 0xAC, 0x0A,
+        0x42, 0x35, 0x12, 0xA8, 0xCC, 0xAA, 0x09, 0x42, 0x22, 0x91, 0xA9, 0x9A, 0x41, 0x34, 0x82, 0xDC,
+        0xAD, 0x8B, 0x41, 0x44, 0x22, 0x90, 0xDB, 0xAB, 0x0A, 0x22, 0x24, 0x82, 0xA9, 0xAA, 0x30, 0x45,
+        0x02, 0xDA, 0xCC, 0x9B, 0x30, 0x45, 0x33, 0x80, 0xDB, 0xBB, 0x9A, 0x31, 0x34, 0x12, 0xA9, 0xAB,
+        0x28, 0x54, 0x13, 0xC9, 0xDD, 0xAA, 0x28, 0x44, 0x24, 0x01, 0xBA, 0xBD, 0x9A, 0x20, 0x43, 0x12,
+        0x98, 0xAA, 0x09, 0x53, 0x33, 0xB8, 0xCF, 0xBB, 0x19, 0x73, 0x33, 0x03, 0xB9, 0xBE, 0xAA, 0x28,
+        0x42, 0x22, 0x90, 0xAA, 0x0A, 0x42, 0x34, 0xA1, 0xDD, 0xAC, 0x0A, 0x42, 0x35, 0x13, 0xA8, 0xBD,
+        0x9C, 0x19, 0x31, 0x33, 0x91, 0xB9, 0x8B, 0x50, 0x43, 0x82, 0xDC, 0xBC, 0x9A, 0x42, 0x35, 0x14,
+        0x90, 0xCB, 0xAC, 0x09, 0x21, 0x24, 0x81, 0xA8, 0x9A, 0x28, 0x44, 0x02, 0xDA, 0xCC, 0x9B, 0x30,
+        0x45, 0x14, 0x81, 0xCA, 0xBB, 0x9A, 0x31, 0x34, 0x02, 0xA8, 0xAB, 0x18, 0x54, 0x12, 0xC8, 0xCD,
+        0xAB, 0x28, 0x45, 0x33, 0x82, 0xCA, 0xCC, 0x8A, 0x10, 0x33, 0x13, 0x98, 0xAB, 0x0A, 0x44, 0x23,
+        0xB0, 0xCF, 0xAC, 0x08, 0x53, 0x34, 0x11, 0xB9, 0xBD, 0x9B, 0x18, 0x43, 0x23, 0x90, 0xBA, 0x8A,
+        0x42, 0x34, 0xA1, 0xDD, 0xAC, 0x0A, 0x52, 0x34, 0x13, 0xB8, 0xDC, 0xAA, 0x08, 0x32, 0x33, 0x81,
+        0xBA, 0x9B, 0x41, 0x34, 0x83, 0xDD, 0xBC, 0x9A, 0x42, 0x45, 0x22, 0xA0, 0xDB, 0xAB, 0x89, 0x32,
+        0x24, 0x02, 0xB9, 0xAA, 0x20, 0x44, 0x12, 0xEA, 0xCC, 0x9A, 0x30, 0x45, 0x23, 0x91, 0xCB, 0xAD,
+        0x99, 0x21, 0x43, 0x11, 0xA8, 0xAA, 0x18, 0x52, 0x12, 0xC8, 0xCD, 0xAB, 0x28, 0x45, 0x24, 0x01,
+        0xCA, 0xCB, 0x8A, 0x10, 0x43, 0x12, 0x98, 0xAA, 0x09, 0x42, 0x23, 0xB0, 0xCF, 0xAC, 0x08, 0x63,
+        0x33, 0x12, 0xC9, 0xBC, 0xAB, 0x18, 0x34, 0x23, 0x80, 0xAB, 0x8B, 0x42, 0x24, 0x91, 0xDD, 0xBC,
+        0x09, 0x52, 0x44, 0x02, 0xA8, 0xDB, 0x9B, 0x09, 0x33, 0x24, 0x81, 0xB9, 0x9A, 0x30, 0x34, 0x82,
+        0xEC, 0xBC, 0x8B, 0x42, 0x36, 0x13, 0x90, 0xCC, 0xBB, 0x89, 0x32, 0x25, 0x01, 0xA8, 0xAA, 0x28,
+        0x43, 0x03, 0xEA, 0xBD, 0x9B, 0x30, 0x37, 0x24, 0x80, 0xCB, 0xAC, 0x8A, 0x21, 0x24, 0x12, 0xA8,
+        0xAA, 0x19, 0x42, 0x23, 0xC9, 0xBF, 0xAB, 0x28, 0x55, 0x33, 0x82, 0xDA, 0xCB, 0x9A, 0x20, 0x43,
+        0x12, 0x90, 0xBA, 0x89, 0x42, 0x33, 0xA8, 0xDF, 0xBA, 0x08, 0x44, 0x34, 0x02, 0xB9, 0xCD, 0x9A,
+        0x18, 0x42, 0x22, 0x80, 0xAA, 0x8A, 0x21, 0x25, 0x80, 0xCD, 0xAC, 0x0A, 0x62, 0x43, 0x12, 0xA8,
+        0xCC, 0xAB, 0x19, 0x42, 0x23, 0x01, 0xAA, 0x9B, 0x20, 0x34, 0x02, 0xFC, 0xCB, 0x8A, 0x32, 0x37,
+        0x22, 0xA0, 0xCC, 0xAB, 0x89, 0x32, 0x34, 0x02, 0xA9, 0xAB, 0x18, 0x34, 0x13, 0xFA, 0xCC, 0x9A,
+        0x30, 0x55, 0x22, 0x91, 0xCB, 0xAC, 0x8A, 0x30, 0x34, 0x02, 0x98, 0xAB, 0x09, 0x43, 0x13, 0xD8,
+        0xCD, 0xAB, 0x38, 0x45, 0x24, 0x82, 0xCA, 0xBC, 0x9A, 0x20, 0x34, 0x22, 0x90, 0xAB, 0x8A, 0x32,
+        0x25, 0xA8, 0xCE, 0xAC, 0x18, 0x63, 0x43, 0x01, 0xB9, 0xCC, 0xAA, 0x10, 0x33, 0x24, 0x80, 0xAA,
+        0x9A, 0x30, 0x34, 0xA1, 0xDD, 0xBC, 0x09, 0x53, 0x35, 0x12, 0xA9, 0xBD, 0xBB, 0x19, 0x43, 0x24,
+        0x81, 0xA9, 0x9A, 0x28, 0x43, 0x01, 0xDC, 0xBC, 0x9A, 0x52, 0x35, 0x23, 0xA0, 0xBD, 0xAD, 0x88,
+        0x31, 0x43, 0x01, 0xA8, 0xAA, 0x08, 0x33, 0x13, 0xEB, 0xCD, 0x9A, 0x30, 0x46, 0x22, 0x91, 0xCB,
+        0xBC, 0x8A, 0x31, 0x53, 0x02, 0xA0, 0xAA, 0x09, 0x32, 0x23, 0xD9, 0xDD, 0x9B, 0x28, 0x45, 0x24,
+        0x81, 0xBA, 0xBD, 0x8B, 0x20, 0x53, 0x12, 0x80, 0xBA, 0x99, 0x31, 0x24, 0xB0, 0xED, 0xAB, 0x18,
+        0x44, 0x25, 0x02, 0xB9, 0xBD, 0xAB, 0x10, 0x53, 0x22, 0x81, 0xBA, 0x9A, 0x21, 0x33, 0x92, 0xCF,
+        0xBC, 0x09, 0x53, 0x35, 0x12, 0xB8, 0xBD, 0xAC, 0x08, 0x33, 0x24, 0x01, 0xB9, 0xAA, 0x10, 0x43,
+        0x01, 0xFB, 0xBC, 0x8A, 0x52, 0x44, 0x22, 0x98, 0xCC, 0xAB, 0x0A, 0x32, 0x25, 0x02, 0x99, 0xAB,
+        0x08, 0x42, 0x02, 0xD9, 0xBD, 0x9B, 0x40, 0x36, 0x14, 0x91, 0xDA, 0xBB, 0x8A, 0x31, 0x34, 0x13,
+        0x98, 0xBB, 0x0A, 0x41, 0x23, 0xD8, 0xCD, 0xAB, 0x20, 0x46, 0x33, 0x81, 0xDA, 0xBC, 0x9A, 0x20,
+        0x34, 0x23, 0x90, 0xBB, 0x8A, 0x30, 0x24, 0xB1, 0xDE, 0xBB, 0x18, 0x45, 0x34, 0x02, 0xBA, 0xBE,
+        0x9B, 0x28, 0x43, 0x33, 0x80, 0xBA, 0xAA, 0x20, 0x34, 0x91, 0xDD, 0xBC, 0x09, 0x63, 0x34, 0x12,
+        0xB8, 0xCD, 0xAB, 0x18, 0x42, 0x23, 0x82, 0xB9, 0xAA, 0x29, 0x42, 0x02, 0xFB, 0xBC, 0x8A, 0x52,
+        0x44, 0x13, 0xA0, 0xCC, 0xBB, 0x89, 0x42, 0x24, 0x02, 0x99, 0xAB, 0x08, 0x31, 0x13, 0xEA, 0xBD,
+        0x9B, 0x41, 0x55, 0x22, 0x80, 0xDB, 0xCB, 0x89, 0x21, 0x24, 0x12, 0x98, 0xAA, 0x8A, 0x31, 0x23,
+        0xC8, 0xBF, 0xAB, 0x38, 0x56, 0x23, 0x01, 0xDB, 0xCB, 0x9A, 0x20, 0x34, 0x13, 0x90, 0xBA, 0x9A,
+        0x21, 0x33, 0xB1, 0xDF, 0xBB, 0x18, 0x55, 0x33, 0x02, 0xD9, 0xBC, 0x9B, 0x28, 0x53, 0x23, 0x80,
+        0xAA, 0x9B, 0x28, 0x33, 0x92, 0xCE, 0xAD, 0x09, 0x62, 0x24, 0x03, 0xB8, 0xBD, 0xAC, 0x08, 0x33,
+        0x25, 0x81, 0x99, 0x9B, 0x19, 0x32, 0x01, 0xEB, 0xBD, 0x8A, 0x52, 0x35, 0x23, 0xA8, 0xCD, 0xAB,
+        0x89, 0x42, 0x43, 0x01, 0x98, 0xAB, 0x09, 0x31, 0x03, 0xD9, 0xCD, 0x9A, 0x31, 0x46, 0x23, 0x80,
+        0xCC, 0xAC, 0x89, 0x30, 0x24, 0x13, 0x98, 0xAB, 0x9A, 0x31, 0x23, 0xC8, 0xCE, 0xAB, 0x30, 0x46,
+        0x33, 0x82, 0xEB, 0xAC, 0x9A, 0x20, 0x34, 0x13, 0x90, 0xBA, 0x9A, 0x20, 0x33, 0xB1, 0xCF, 0xBB,
+        0x29, 0x55, 0x34, 0x01, 0xC9, 0xBC, 0xAB, 0x28, 0x34, 0x24, 0x81, 0xAA, 0x9B, 0x18, 0x32, 0x92,
+        0xFC, 0xBB, 0x09, 0x73, 0x34, 0x12, 0xB9, 0xCD, 0xAA, 0x19, 0x42, 0x33, 0x82, 0xA9, 0xBB, 0x19,
+        0x32, 0x03, 0xFB, 0xBD, 0x8A, 0x52, 0x35, 0x23, 0xA8, 0xCD, 0xBB, 0x09, 0x42, 0x43, 0x02, 0xA8,
+        0xAB, 0x89, 0x31, 0x13, 0xDA, 0xCD, 0x9A, 0x41, 0x54, 0x13, 0x91, 0xCC, 0xBB, 0x8A, 0x41, 0x43,
+        0x12, 0xA0, 0xBA, 0x8A, 0x21, 0x23, 0xC8, 0xDD, 0xAA, 0x20, 0x46, 0x33, 0x81, 0xEB, 0xBB, 0x9B,
+        0x30, 0x35, 0x23, 0x90, 0xCA, 0x8A, 0x18, 0x23, 0x90, 0xDD, 0xAB, 0x29, 0x55, 0x43, 0x01, 0xC9,
+        0xBC, 0x9B, 0x28, 0x53, 0x23, 0x81, 0xAA, 0xAB, 0x18, 0x32, 0x92, 0xEC, 0xAC, 0x0A, 0x54, 0x34,
+        0x02, 0xB8, 0xBE, 0xBB, 0x18, 0x53, 0x33, 0x01, 0xAA, 0xBB, 0x09, 0x32, 0x03, 0xFA, 0xBC, 0x8B,
+        0x63, 0x44, 0x22, 0xA8, 0xDC, 0xBA, 0x09, 0x42, 0x33, 0x12, 0xA9, 0xBB, 0x8A, 0x31, 0x23, 0xE9,
+        0xCC, 0x9B, 0x41, 0x36, 0x14, 0x91, 0xBC, 0xAD, 0x0A, 0x21, 0x34, 0x22, 0xA8, 0xBA, 0x8B, 0x20,
+        0x23, 0xB0, 0xCF, 0xAB, 0x30, 0x56, 0x23, 0x81, 0xDB, 0xBC, 0x9A, 0x21, 0x44, 0x12, 0x80, 0xBA,
+        0x9A, 0x10, 0x22, 0xA1, 0xEC, 0xAB, 0x29, 0x55, 0x24, 0x82, 0xC9, 0xBC, 0xAB, 0x28, 0x44, 0x23,
+        0x81, 0xBA, 0xAA, 0x19, 0x32, 0x81, 0xFB, 0xBC, 0x09, 0x54, 0x34, 0x12, 0xB9, 0xCE, 0xAA, 0x18,
+        0x42, 0x33, 0x01, 0xB9, 0xBB, 0x09, 0x22, 0x03, 0xEA, 0xCC, 0x0A, 0x61, 0x53, 0x12, 0x98, 0xBD,
+        0xAC, 0x09, 0x42, 0x33, 0x02, 0xA8, 0xCB, 0x89, 0x11, 0x12, 0xB8, 0xCE, 0x9A, 0x41, 0x45, 0x13,
+        0xA1, 0xEB, 0xCB, 0x89, 0x31, 0x34, 0x12, 0x98, 0xBB, 0x9A, 0x20, 0x23, 0xB0, 0xCE, 0x9C, 0x20,
+        0x55, 0x23, 0x81, 0xDB, 0xBC, 0x9A, 0x30, 0x44, 0x22, 0x90, 0xAA, 0xAB, 0x10, 0x22, 0x91, 0xEC,
+        0xAB, 0x29, 0x55, 0x34, 0x01, 0xCA, 0xAD, 0x9B, 0x28, 0x53, 0x23, 0x81, 0xBA, 0xAB, 0x08, 0x22,
+        0x82, 0xEB, 0xBC, 0x09, 0x64, 0x43, 0x12, 0xB9, 0xBE, 0xAB, 0x19, 0x34, 0x34, 0x01, 0xB9, 0xAB,
+        0x0A, 0x31, 0x02, 0xD9, 0xBD, 0x8A, 0x72, 0x34, 0x13, 0xB8, 0xCD, 0x9C, 0x09, 0x41, 0x23, 0x12,
+        0xA8, 0xAC, 0x89, 0x10, 0x12, 0xA8, 0xBE, 0x9B, 0x52, 0x45, 0x23, 0xA0, 0xCC, 0xBC, 0x89, 0x31,
+        0x35, 0x12, 0x98, 0xCA, 0x99, 0x10, 0x21, 0xA0, 0xCC, 0xAB, 0x30, 0x57, 0x32, 0x80, 0xDB, 0xBC,
+        0x8A, 0x30, 0x44, 0x22, 0x90, 0xBA, 0xAA, 0x18, 0x22, 0x91, 0xFB, 0xAB, 0x29, 0x46, 0x24, 0x02,
+        0xDA, 0xBC, 0x9A, 0x28, 0x34, 0x24, 0x81, 0xAA, 0xBB, 0x08, 0x31, 0x01, 0xEA, 0xCB, 0x09, 0x54,
+        0x34, 0x12, 0xC9, 0xBD, 0xAB, 0x19, 0x44, 0x33, 0x01, 0xB9, 0xCB, 0x89, 0x21, 0x12, 0xC9, 0xBC,
+        0x8B, 0x73, 0x44, 0x12, 0xA8, 0xDC, 0xAB, 0x09, 0x33, 0x35, 0x02, 0xA8, 0xBB, 0x9A, 0x30, 0x22,
+        0xB8, 0xBF, 0x8B, 0x51, 0x45, 0x23, 0xA0, 0xDC, 0xBB, 0x8A, 0x42, 0x34, 0x12, 0xA0, 0xCA, 0x9A,
+        0x10, 0x21, 0x90, 0xCC, 0xAB, 0x40, 0x55, 0x23, 0x81, 0xEB, 0xAC, 0x9A, 0x21, 0x44, 0x12, 0x80,
+        0xBA, 0x9B, 0x08, 0x22, 0x81, 0xEB, 0xBB, 0x28, 0x56, 0x43, 0x01, 0xCA, 0xBD, 0x9A, 0x10, 0x44,
+        0x22, 0x81, 0xAA, 0xBB, 0x09, 0x22, 0x02, 0xDA, 0xBC, 0x19, 0x54, 0x35, 0x02, 0xB9, 0xBF, 0xAA,
+        0x18, 0x43, 0x24, 0x82, 0xA9, 0xBB, 0x89, 0x21, 0x12, 0xC9, 0xCC, 0x0A, 0x62, 0x44, 0x12, 0xA8,
+        0xCD, 0xAB, 0x09, 0x43, 0x24, 0x12, 0xA9, 0xBB, 0x9A, 0x20, 0x13, 0xA0, 0xBE, 0x9B, 0x61, 0x35,
+        0x24, 0xA0, 0xCC, 0xBC, 0x89, 0x32, 0x35, 0x12, 0x98, 0xBB, 0x9B, 0x18, 0x32, 0x90, 0xDC, 0xAB,
+        0x40, 0x55, 0x33, 0x80, 0xCC, 0xBC, 0x8B, 0x21, 0x45, 0x12, 0x80, 0xBA, 0x9B, 0x19, 0x21, 0x82,
+        0xDB, 0xBB, 0x39, 0x47, 0x34, 0x01, 0xCB, 0xBD, 0xAB, 0x20, 0x35, 0x14, 0x81, 0xB9, 0xAB, 0x89,
+        0x22, 0x02, 0xD9, 0xBB, 0x0A, 0x56, 0x24, 0x03, 0xC9, 0xBD, 0xAB, 0x29, 0x63, 0x23, 0x82, 0xA9,
+        0xAC, 0x89, 0x20, 0x11, 0xA8, 0xCC, 0x8A, 0x63, 0x44, 0x12, 0xA8, 0xCD, 0xBB, 0x08, 0x52, 0x33,
+        0x03, 0xB8, 0xAC, 0x8B, 0x10, 0x22, 0x98, 0xCC, 0x9B, 0x52, 0x45, 0x23, 0xA0, 0xCD, 0xAC, 0x89,
+        0x32, 0x44, 0x02, 0x90, 0xBB, 0xAA, 0x00, 0x22, 0x81, 0xEB, 0xAA, 0x30, 0x47, 0x33, 0x80, 0xDC,
+        0xCB, 0x8A, 0x30, 0x44, 0x22, 0x90, 0xBA, 0xAB, 0x09, 0x22, 0x82, 0xCA, 0xBC, 0x28, 0x56, 0x24,
+        0x01, 0xCB, 0xBD, 0x9A, 0x28, 0x35, 0x33, 0x91, 0xBA, 0xAC, 0x0A, 0x21, 0x02, 0xB9, 0xBD, 0x09,
+        0x55, 0x44, 0x01, 0xC8, 0xBC, 0xBB, 0x28, 0x44, 0x33, 0x02, 0xC9, 0xAB, 0x9A, 0x21, 0x12, 0xA8,
+        0xBD, 0x8A, 0x73, 0x35, 0x22, 0xB9, 0xCE, 0xBA, 0x08, 0x52, 0x33, 0x12, 0xA9, 0xBC, 0x9A, 0x10,
+        0x22, 0x90, 0xDB, 0x9B, 0x52, 0x45, 0x23, 0xA0, 0xCD, 0xAC, 0x0A, 0x41, 0x43, 0x12, 0x98, 0xBB,
+        0x9B, 0x08, 0x23, 0x81, 0xDB, 0xAB, 0x58, 0x45, 0x24, 0x80, 0xCC, 0xCB, 0x8A, 0x30, 0x35, 0x13,
+        0x91, 0xCB, 0xAA, 0x09, 0x22, 0x01, 0xBA, 0xAD, 0x28, 0x65, 0x33, 0x82, 0xEB, 0xBC, 0x9B, 0x20,
+        0x35, 0x24, 0x80, 0xB9, 0xBB, 0x89, 0x21, 0x03, 0xB8, 0xBD, 0x09, 0x55, 0x25, 0x02, 0xC9, 0xCC,
+        0xAB, 0x10, 0x53, 0x33, 0x02, 0xBA, 0xBC, 0x8A, 0x20, 0x22, 0x98, 0xCC, 0x0A, 0x62, 0x35, 0x12,
+        0xB8, 0xCE, 0xAB, 0x09, 0x53, 0x33, 0x03, 0xB8, 0xBC, 0xAA, 0x20, 0x22, 0x90, 0xDB, 0x9A, 0x51,
+        0x36, 0x14, 0xA0, 0xDC, 0xBB, 0x09, 0x41, 0x34, 0x13, 0xA0, 0xCB, 0xAB, 0x18, 0x22, 0x81, 0xBA,
+        0x9D, 0x48, 0x45, 0x24, 0x80, 0xCC, 0xBC, 0x99, 0x31, 0x35, 0x23, 0x90, 0xBB, 0xAD, 0x08, 0x21,
+        0x01, 0xA9, 0xAC, 0x28, 0x65, 0x33, 0x82, 0xFB, 0xCB, 0x9A, 0x20, 0x44, 0x22, 0x81, 0xBA, 0xBB,
+        0x8A, 0x31, 0x12, 0xA8, 0xBD, 0x09, 0x55, 0x25, 0x02, 0xC9, 0xBD, 0xAB, 0x18, 0x54, 0x23, 0x01,
+        0xB9, 0xAC, 0x8A, 0x10, 0x22, 0xA0, 0xCA, 0x8A, 0x73, 0x34, 0x13, 0xC8, 0xCD, 0xBB, 0x08, 0x53,
+        0x24, 0x02, 0xA8, 0xCB, 0x9A, 0x10, 0x21, 0x91, 0xBA, 0x9B, 0x62, 0x36, 0x33, 0xA8, 0xBF, 0xBC,
+        0x09, 0x41, 0x34, 0x13, 0xA8, 0xCB, 0x9B, 0x08, 0x22, 0x01, 0xBA, 0x9C, 0x48, 0x46, 0x33, 0x90,
+        0xEC, 0xBB, 0x9A, 0x41, 0x44, 0x12, 0x80, 0xBB, 0xAB, 0x89, 0x22, 0x03, 0xA9, 0xAD, 0x28, 0x65,
+        0x33, 0x92, 0xEB, 0xCC, 0x8A, 0x10, 0x44, 0x22, 0x81, 0xBA, 0xAC, 0x89, 0x11, 0x12, 0xA0, 0xBB,
+        0x09, 0x56, 0x34, 0x02, 0xDA, 0xCC, 0x9B, 0x18, 0x44, 0x23, 0x82, 0xB9, 0xBC, 0x8A, 0x20, 0x12,
+        0x91, 0xCB, 0x0A, 0x72, 0x34, 0x23, 0xC9, 0xBE, 0xAC, 0x08, 0x43, 0x34, 0x11, 0xA9, 0xCB, 0xAA,
+        0x10, 0x22, 0x00, 0xBA, 0xAB, 0x62, 0x36, 0x14, 0xB0, 0xDC, 0xBB, 0x0A, 0x52, 0x34, 0x12, 0xA8,
+        0xCB, 0xAA, 0x08, 0x22, 0x82, 0xB8, 0x9C, 0x48, 0x45, 0x24, 0x90, 0xFB, 0xBB, 0x8A, 0x41, 0x34,
+        0x23, 0x90, 0xCB, 0xBB, 0x09, 0x31, 0x12, 0xA9, 0xAC, 0x39, 0x56, 0x24, 0x81, 0xDB, 0xCC, 0x9A,
+        0x21, 0x63, 0x22, 0x80, 0xB9, 0xAC, 0x89, 0x11, 0x12, 0x90, 0xAB, 0x1A, 0x74, 0x43, 0x02, 0xCA,
+        0xCD, 0xAA, 0x10, 0x53, 0x33, 0x82, 0xB9, 0xAD, 0x9A, 0x11, 0x12, 0x91, 0xAA, 0x0B, 0x72, 0x35,
+        0x03, 0xC8, 0xCD, 0xAB, 0x19, 0x53, 0x24, 0x02, 0xA8, 0xBC, 0x9A, 0x10, 0x21, 0x01, 0xB9, 0x9B,
+        0x61, 0x45, 0x22, 0xA8, 0xDD, 0xBB, 0x09, 0x52, 0x43, 0x12, 0x98, 0xCB, 0x9B, 0x19, 0x31, 0x01,
+        0xA8, 0xAB, 0x48, 0x37, 0x24, 0x91, 0xCD, 0xBC, 0x89, 0x31, 0x45, 0x12, 0x90, 0xBA, 0xAC, 0x09,
+        0x21, 0x12, 0x98, 0xAB, 0x29, 0x56, 0x24, 0x81, 0xDB, 0xBD, 0x9A, 0x30, 0x35, 0x24, 0x80, 0xBA,
+        0xAC, 0x0A, 0x20, 0x12, 0x80, 0xAB, 0x1A, 0x74, 0x43, 0x02, 0xDA, 0xCC, 0xAA, 0x10, 0x44, 0x23,
+        0x82, 0xC9, 0xBB, 0x9A, 0x11, 0x32, 0x91, 0xB9, 0x8B, 0x73, 0x26, 0x03, 0xC8, 0xBD, 0xAC, 0x19,
+        0x53, 0x43, 0x11, 0xA9, 0xCB, 0x9A, 0x18, 0x22, 0x01, 0xB9, 0x9A, 0x51, 0x36, 0x23, 0xC0, 0xCD,
+        0xAC, 0x09, 0x42, 0x34, 0x12, 0xA8, 0xCB, 0xAB, 0x19, 0x22, 0x12, 0xA9, 0xAB, 0x40, 0x46, 0x24,
+        0x90, 0xDC, 0xAC, 0x8A, 0x41, 0x53, 0x12, 0x90, 0xCA, 0xAA, 0x09, 0x21, 0x11, 0x90, 0xAA, 0x29,
+        0x65, 0x33, 0x81, 0xDC, 0xCC, 0x99, 0x20, 0x44, 0x23, 0x80, 0xCA, 0xAB, 0x8A, 0x21, 0x22, 0x80,
+        0xBA, 0x1A, 0x64, 0x25, 0x02, 0xDA, 0xBD, 0xAA, 0x28, 0x35, 0x34, 0x81, 0xB9, 0xBC, 0x9A, 0x10,
+        0x23, 0x01, 0xBA, 0x8A, 0x73, 0x44, 0x12, 0xC9, 0xCD, 0xAA, 0x19, 0x53, 0x24, 0x02, 0xB8, 0xCB,
+        0x9B, 0x00, 0x32, 0x11, 0xA9, 0x9B, 0x51, 0x36, 0x23, 0xB8, 0xCF, 0xBB, 0x09, 0x52, 0x34, 0x13,
+        0xA8, 0xBC, 0x9C, 0x08, 0x21, 0x02, 0xA0, 0x9A, 0x38, 0x46, 0x24, 0xA0, 0xDC, 0xAC, 0x8A, 0x32,
+        0x45, 0x12, 0x90, 0xCA, 0xAB, 0x09, 0x21, 0x22, 0x90, 0xAA, 0x29, 0x55, 0x34, 0x91, 0xFB, 0xAC,
+        0x9A, 0x30, 0x35, 0x24, 0x80, 0xBA, 0xAD, 0x89, 0x11, 0x12, 0x81, 0xA9, 0x89, 0x44, 0x35, 0x82,
+        0xEA, 0xBC, 0x9C, 0x10, 0x44, 0x23, 0x82, 0xC9, 0xBB, 0x9B, 0x20, 0x23, 0x02, 0xAA, 0x8B, 0x73,
+        0x44, 0x12, 0xC9, 0xCD, 0xAB, 0x18, 0x63, 0x33, 0x02, 0xB9, 0xCC, 0x9A, 0x18, 0x22, 0x02, 0xA8,
+        0x8A, 0x40, 0x45, 0x13, 0xC0, 0xCD, 0xBB, 0x09, 0x53, 0x34, 0x13, 0xA8, 0xCC, 0xAA, 0x08, 0x31,
+        0x12, 0x98, 0x9A, 0x28, 0x46, 0x24, 0xA0, 0xDC, 0xBC, 0x89, 0x41, 0x34, 0x23, 0x90, 0xBC, 0xAC,
+        0x89, 0x22, 0x12, 0x91, 0x9A, 0x19, 0x45, 0x25, 0x91, 0xEB, 0xBC, 0x8B, 0x40, 0x44, 0x22, 0x91,
+        0xCA, 0xBB, 0x89, 0x20, 0x23, 0x01, 0xAA, 0x0A, 0x54, 0x35, 0x01, 0xEA, 0xCC, 0x9A, 0x28, 0x44,
+        0x33, 0x01, 0xCA, 0xCB, 0x9A, 0x20, 0x22, 0x01, 0xA8, 0x8A, 0x52, 0x44, 0x03, 0xD9, 0xDC, 0xAA,
+        0x18, 0x53, 0x24, 0x02, 0xA9, 0xBC, 0x9B, 0x18, 0x32, 0x12, 0xA8, 0x9A, 0x40, 0x36, 0x14, 0xB8,
+        0xCE, 0xAC, 0x08, 0x42, 0x34, 0x12, 0xA8, 0xBC, 0x9C, 0x19, 0x21, 0x12, 0x90, 0xA9, 0x20, 0x45,
+        0x24, 0xA0, 0xDD, 0xBB, 0x8A, 0x42, 0x36, 0x12, 0x90, 0xCB, 0xBB, 0x89, 0x22, 0x23, 0x81, 0xAA,
+        0x19, 0x74, 0x33, 0x91, 0xEC, 0xBC, 0x8A, 0x30, 0x36, 0x23, 0x81, 0xDB, 0xBB, 0x89, 0x20, 0x23,
+        0x82, 0xA9, 0x89, 0x73, 0x43, 0x82, 0xEA, 0xCC, 0x9A, 0x28, 0x54, 0x32, 0x81, 0xBA, 0xBC, 0x9A,
+        0x10, 0x33, 0x02, 0x99, 0x9A, 0x61, 0x34, 0x13, 0xE9, 0xCD, 0xAA, 0x18, 0x63, 0x33, 0x02, 0xB9,
+        0xBD, 0xAA, 0x18, 0x23, 0x13, 0x98, 0xAA, 0x40, 0x45, 0x22, 0xC8, 0xCD, 0xAC, 0x08, 0x42, 0x25,
+        0x12, 0xA8, 0xBC, 0xBA, 0x08, 0x32, 0x13, 0x80, 0xAA, 0x28, 0x46, 0x33, 0xB0, 0xDE, 0xAC, 0x89,
+        0x41, 0x44, 0x12, 0x98, 0xCA, 0xAB, 0x89, 0x22, 0x23, 0x80, 0x99, 0x09, 0x54, 0x43, 0x91, 0xDC,
+        0xCC, 0x99, 0x21, 0x35, 0x14, 0x91, 0xBA, 0xBC, 0x8A, 0x21, 0x23, 0x82, 0xA8, 0x0A, 0x62, 0x34,
+        0x82, 0xFB, 0xBC, 0xAB, 0x30, 0x55, 0x23, 0x81, 0xBA, 0xAD, 0x9A, 0x10, 0x32, 0x02, 0x98, 0x8A,
+        0x41, 0x35, 0x13, 0xEA, 0xCD, 0xAA, 0x18, 0x44, 0x24, 0x82, 0xB8, 0xBC, 0xAB, 0x10, 0x32, 0x13,
+        0x90, 0xAA, 0x30, 0x37, 0x14, 0xC8, 0xDC, 0xBB, 0x19, 0x53, 0x25, 0x03, 0xA8, 0xBC, 0xAB, 0x09,
+        0x42, 0x12, 0x80, 0x99, 0x18, 0x63, 0x33, 0xB0, 0xDE, 0xAC, 0x0A, 0x42, 0x34, 0x23, 0xA0, 0xCC,
+        0xAB, 0x0A, 0x31, 0x23, 0x01, 0xA9, 0x09, 0x73, 0x33, 0x91, 0xED, 0xCB, 0x8A, 0x31, 0x45, 0x23,
+        0x90, 0xDA, 0xAB, 0x8A, 0x21, 0x32, 0x02, 0x99, 0x8A, 0x52, 0x34, 0x02, 0xEC, 0xBC, 0xAB, 0x30,
+        0x46, 0x23, 0x01, 0xCA, 0xAC, 0x9A, 0x10, 0x23, 0x12, 0x98, 0x8A, 0x30, 0x36, 0x13, 0xEA, 0xCD,
+        0x9B, 0x18, 0x44, 0x34, 0x01, 0xB9, 0xCC, 0x9A, 0x18, 0x32, 0x12, 0x90, 0x99, 0x28, 0x54, 0x22,
+        0xC8, 0xBE, 0xBC, 0x08, 0x63, 0x43, 0x02, 0xA8, 0xBC, 0xAB, 0x19, 0x32, 0x23, 0x81, 0xAA, 0x18,
+        0x54, 0x14, 0xA0, 0xDD, 0xAC, 0x0A, 0x42, 0x44, 0x12, 0x90, 0xBC, 0xBB, 0x09, 0x31, 0x33, 0x82,
+        0x99, 0x0A, 0x63, 0x24, 0x91, 0xFC, 0xBB, 0x8B, 0x41, 0x45, 0x13, 0x80, 0xCB, 0xBB, 0x9A, 0x31,
+        0x33, 0x03, 0xA8, 0x8A, 0x51, 0x35, 0x01, 0xDC, 0xBD, 0xAA, 0x30, 0x36, 0x24, 0x01, 0xCA, 0xAC,
+        0x9A, 0x20, 0x32, 0x12, 0x98, 0x99, 0x30, 0x35, 0x13, 0xFA, 0xBD, 0x9C, 0x18, 0x44, 0x24, 0x01,
+        0xA9, 0xAD, 0x9B, 0x18, 0x32, 0x13, 0x80, 0x9A, 0x28, 0x44, 0x23, 0xC9, 0xCF, 0xAB, 0x19, 0x63,
+        0x24, 0x12, 0xA9, 0xBC, 0xBB, 0x08, 0x42, 0x13, 0x81, 0x99, 0x19, 0x52, 0x33, 0xB0, 0xDF, 0xBB,
+        0x8A, 0x63, 0x34, 0x22, 0xA8, 0xEB, 0xAA, 0x89, 0x31, 0x32, 0x01, 0x99, 0x89, 0x42, 0x34, 0xA1,
+        0xED, 0xCB, 0x8A, 0x31, 0x46, 0x22, 0x90, 0xCA, 0xAC, 0x89, 0x20, 0x23, 0x02, 0x98, 0x99, 0x31,
+        0x35, 0x82, 0xEC, 0xCC, 0x9A, 0x30, 0x35, 0x15, 0x81, 0xC9, 0xBB, 0x9A, 0x11, 0x43, 0x02, 0x90,
+        0x99, 0x20, 0x34, 0x03, 0xFA, 0xBD, 0x9C, 0x18, 0x54, 0x23, 0x02, 0xC9, 0xCB, 0x9B, 0x18, 0x33,
+        0x22, 0x91, 0xA9, 0x18, 0x44, 0x23, 0xD9, 0xBE, 0x9D, 0x09, 0x53, 0x34, 0x02, 0xB8, 0xCC, 0xAA,
+        0x08, 0x22, 0x33, 0x00, 0xA9, 0x09, 0x53, 0x23, 0xB0, 0xDF, 0xAC, 0x09, 0x42, 0x44, 0x12, 0xA0,
+        0xDB, 0xAB, 0x09, 0x31, 0x33, 0x01, 0x99, 0x89, 0x41, 0x34, 0x90, 0xED, 0xAC, 0x9A, 0x42, 0x44,
+        0x23, 0x90, 0xDB, 0xBB, 0x8A, 0x21, 0x24, 0x12, 0x98, 0x8A, 0x30, 0x34, 0x82, 0xDD, 0xBD, 0x9B,
+        0x31, 0x46, 0x23, 0x81, 0xCA, 0xBC, 0x9A, 0x20, 0x33, 0x13, 0x90, 0x9A, 0x28, 0x44, 0x03, 0xFA,
+        0xCC, 0x9B, 0x28, 0x54, 0x24, 0x01, 0xB9, 0xAD, 0x9B, 0x18, 0x33, 0x23, 0x80, 0x9A, 0x19, 0x53,
+        0x13, 0xC9, 0xCF, 0xAB, 0x19, 0x54, 0x43, 0x02, 0xA9, 0xBC, 0x9C, 0x09, 0x32, 0x23, 0x01, 0xA9,
+        0x09, 0x42, 0x23, 0xB0, 0xEF, 0xBB, 0x89, 0x63, 0x34, 0x12, 0xA0, 0xCC, 0xAB, 0x89, 0x22, 0x24,
+        0x01, 0x98, 0x89, 0x21, 0x24, 0x91, 0xDE, 0xAC, 0x8A, 0x41, 0x35, 0x14, 0x90, 0xCA, 0xAC, 0x89,
+        0x20, 0x33, 0x02, 0x90, 0x9A, 0x20, 0x34, 0x82, 0xFC, 0xBC, 0x9B, 0x31, 0x37, 0x24, 0x80, 0xCA,
+        0xCB, 0x99, 0x20, 0x32, 0x13, 0x90, 0xA9, 0x10, 0x43, 0x12, 0xFB, 0xBD, 0x9C, 0x28, 0x54, 0x33,
+        0x02, 0xCA, 0xCC, 0x9A, 0x10, 0x22, 0x23, 0x80, 0x99, 0x09, 0x42, 0x13, 0xD9, 0xDD, 0xAB, 0x19,
+        0x54, 0x24, 0x12, 0xB9, 0xCC, 0xAA, 0x08, 0x32, 0x33, 0x01, 0xA9, 0x89, 0x41, 0x23, 0xC0, 0xDE,
+        0xBB, 0x0A, 0x73, 0x43, 0x22, 0xA8, 0xCC, 0xAB, 0x09, 0x22, 0x24, 0x01, 0x98, 0x89, 0x20, 0x33,
+        0xA1, 0xDF, 0xCB, 0x8A, 0x42, 0x35, 0x14, 0x90, 0xCB, 0xAC, 0x89, 0x30, 0x33, 0x12, 0x98, 0x9A,
+        0x10, 0x34, 0x81, 0xFC, 0xBC, 0x9B, 0x41, 0x45, 0x23, 0x91, 0xDA, 0xBB, 0x9B, 0x21, 0x43, 0x13,
+        0x80, 0x9A, 0x08, 0x33, 0x04, 0xEB, 0xBE, 0xAB, 0x20, 0x46, 0x24, 0x81, 0xB9, 0xAD, 0x9B, 0x18,
+        0x43, 0x22, 0x80, 0x99, 0x09, 0x31, 0x13, 0xD9, 0xBF, 0xAC, 0x18, 0x44, 0x34, 0x12, 0xB9, 0xCD,
+        0xAA, 0x08, 0x32, 0x33, 0x82, 0x99, 0x8A, 0x31, 0x33, 0xD0, 0xDE, 0xBB, 0x0A, 0x54, 0x34, 0x13,
+        0xA8, 0xCD, 0xAA, 0x89, 0x32, 0x33, 0x02, 0x98, 0x9A, 0x20, 0x43, 0xA1, 0xEE, 0xBB, 0x8B, 0x53,
+        0x45, 0x22, 0x90, 0xBC, 0xAC, 0x8A, 0x21, 0x24, 0x12, 0x88, 0x9A, 0x18, 0x32, 0x82, 0xDD, 0xBD,
+        0x9B, 0x41, 0x45, 0x23, 0x81, 0xDB, 0xCB, 0x8A, 0x20, 0x42, 0x12, 0x80, 0xA9, 0x08, 0x31, 0x02,
+        0xFA, 0xCC, 0x9B, 0x38, 0x55, 0x33, 0x01, 0xDA, 0xCB, 0x9A, 0x18, 0x33, 0x14, 0x81, 0x99, 0x89,
+        0x21, 0x13, 0xD9, 0xCE, 0xAB, 0x18, 0x45, 0x34, 0x02, 0xB9, 0xCD, 0x9A, 0x19, 0x32, 0x33, 0x01,
+        0xA9, 0x8A, 0x30, 0x23, 0xD0, 0xCE, 0xAC, 0x09, 0x63, 0x34, 0x12, 0xA8, 0xBD, 0xAC, 0x09, 0x22,
+        0x24, 0x11, 0x98, 0x9A, 0x10, 0x22, 0xA1, 0xED, 0xAC, 0x8A, 0x52, 0x44, 0x22, 0xA0, 0xDB, 0xBB,
+        0x8A, 0x31, 0x34, 0x13, 0x98, 0xA9, 0x08, 0x32, 0x82, 0xED, 0xCC, 0x8A, 0x40, 0x44, 0x33, 0x80,
+        0xDB, 0xBC, 0x8A, 0x20, 0x43, 0x22, 0x90, 0xA9, 0x88, 0x22, 0x02, 0xFA, 0xCC, 0x9B, 0x38, 0x46,
+        0x33, 0x01, 0xDA, 0xBC, 0x9A, 0x28, 0x33, 0x24, 0x81, 0xA9, 0x89, 0x20, 0x13, 0xD9, 0xCE, 0xAB,
+        0x28, 0x64, 0x33, 0x12, 0xC9, 0xCC, 0xAA, 0x08, 0x42, 0x22, 0x82, 0xA8, 0x89, 0x18, 0x13, 0xB0,
+        0xDF, 0xAB, 0x09, 0x73, 0x24, 0x03, 0xA8, 0xCC, 0xAB, 0x89, 0x42, 0x23, 0x12, 0xA8, 0xA9, 0x18,
+        0x32, 0x90, 0xCF, 0xBC, 0x8A, 0x53, 0x45, 0x12, 0x90, 0xDB, 0xBB, 0x8A, 0x31, 0x25, 0x12, 0x88,
+        0x9A, 0x08, 0x21, 0x81, 0xDC, 0xBD, 0x8B, 0x41, 0x36, 0x24, 0x80, 0xCB, 0xBC, 0x9A, 0x21, 0x43,
+        0x13, 0x91, 0xA9, 0x89, 0x21, 0x02, 0xFA, 0xCC, 0x9B, 0x30, 0x46, 0x33, 0x82, 0xCB, 0xBD, 0x9B,
+        0x10, 0x53, 0x22, 0x00, 0xA9, 0x89, 0x10, 0x02, 0xC8, 0xCE, 0xAB, 0x28, 0x55, 0x33, 0x03, 0xCA,
+        0xCC, 0x9B, 0x19, 0x33, 0x24, 0x02, 0xA9, 0x99, 0x18, 0x12, 0xB0, 0xCF, 0xAC, 0x09, 0x44, 0x35,
+        0x12, 0xA9, 0xBD, 0xAC, 0x88, 0x32, 0x24, 0x02, 0x98, 0xA9, 0x08, 0x12, 0x91, 0xDD, 0xBC, 0x8A,
+        0x63, 0x44, 0x12, 0x90, 0xCC, 0xAB, 0x8A, 0x32, 0x53, 0x12, 0x98, 0x99, 0x89, 0x21, 0x81, 0xFB,
+        0xBC, 0x9A, 0x51, 0x35, 0x24, 0x80, 0xDB, 0xCB, 0x99, 0x21, 0x42, 0x12, 0x80, 0xA9, 0x89, 0x11,
+        0x81, 0xC9, 0xBD, 0x9B, 0x40, 0x45, 0x33, 0x81, 0xCB, 0xAD, 0x9A, 0x10, 0x33, 0x23, 0x81, 0x9A,
+        0x9A, 0x10, 0x01, 0xB8, 0xCD, 0xAB, 0x20, 0x45, 0x33, 0x01, 0xCA, 0xBB, 0x99, 0x10, 0x22, 0x01,
+    };
+} // namespace
+
+const AudioClip audioClips[] = {
+    {"siren", AudioClipFormat::MuLaw, 24000, 23253, 0, sirenData, sizeof(sirenData)},
+    {"beep", AudioClipFormat::MuLaw, 16000, 2400, 0, beepData, sizeof(beepData)},
+    {"chime", AudioClipFormat::ImaAdpcm, 16000, 9600, 17, chimeData, sizeof(chimeData)},
+};
+
+const size_t audioClipCount = sizeof(audioClips) / sizeof(audioClips[0]);
+
+#endif // CONFIG_USE_I2S
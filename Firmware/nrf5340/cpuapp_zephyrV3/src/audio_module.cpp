@@ -1,6 +1,10 @@
+#if CONFIG_USE_I2S
+
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
 
+#include <math.h>
+
 #include "audio_module.hpp"
 #include "ble_service.hpp"
 #include "usb_comm_handler.hpp"
@@ -12,13 +16,38 @@
 /** Register log module */
 LOG_MODULE_REGISTER(i2s, LOG_LEVEL_INF);
 
-/* Define a new Memory Slab which consistes of NUM_BLOCKS blocks
+BUILD_ASSERT(CONFIG_I2S_PREFILL_BLOCKS <= CONFIG_I2S_NUM_BLOCKS, "CONFIG_I2S_PREFILL_BLOCKS must not exceed CONFIG_I2S_NUM_BLOCKS");
+BUILD_ASSERT(CONFIG_I2S_BLOCKS_PER_WAKEUP < CONFIG_I2S_NUM_BLOCKS,
+             "CONFIG_I2S_BLOCKS_PER_WAKEUP must be less than CONFIG_I2S_NUM_BLOCKS");
+
+/* Define a new Memory Slab which consistes of CONFIG_I2S_NUM_BLOCKS blocks
    __________________________________________________________________________
-  |    Block 0   |    Block 1   |    Block 2   |    Block 3   |    Block 4   |
-  |    0...31    |    0...31    |    0...31    |    0...31    |    0...31    |
-  |______________|______________|______________|______________|______________|
+  |    Block 0   |    Block 1   |    Block 2   |    Block 3   |
+  |   0...2047   |   0...2047   |   0...2047   |   0...2047   |
+  |______________|______________|______________|______________|
 */
-static K_MEM_SLAB_DEFINE(mem_slab, I2S_BLOCK_SIZE, NUM_BLOCKS, NUM_SAMPLES);
+static K_MEM_SLAB_DEFINE(mem_slab, I2S_BLOCK_SIZE, CONFIG_I2S_NUM_BLOCKS, 4);
+
+namespace
+{
+    constexpr static uint32_t phaseOne = 1 << 16; ///< One clip sample in Q16 phase
+    constexpr static size_t sineBits = 8;         ///< log2 of sine table size
+
+    /**
+     * @brief One period of sine, Q15, with the first entry repeated at the end for interpolation
+     */
+    int16_t sineTable[(1 << sineBits) + 1];
+
+    /**
+     * @brief G.711 mu-law to 16-bit PCM
+     */
+    int32_t MuLawDecode(uint8_t value)
+    {
+        value = ~value;
+        int32_t magnitude = (((value & 0x0F) << 3) + 0x84) << ((value & 0x70) >> 4);
+        return (value & 0x80) ? 0x84 - magnitude : magnitude - 0x84;
+    }
+}
 
 AudioModule::AudioModule() {
     LOG_DBG("AudioModule Constructor!");
@@ -38,13 +67,13 @@ int AudioModule::Initialize() {
 
     struct i2s_config i2s_cfg;
     i2s_cfg.word_size = 16; // due to int16_t in data_frame declaration
-    i2s_cfg.channels = 2; // L + R channel
+    i2s_cfg.channels = I2S_CHANNELS; // L + R channel
     i2s_cfg.format = I2S_FMT_DATA_FORMAT_I2S;
     i2s_cfg.options = I2S_OPT_BIT_CLK_MASTER | I2S_OPT_FRAME_CLK_MASTER;
-    i2s_cfg.frame_clk_freq = 44100;
+    i2s_cfg.frame_clk_freq = I2S_SAMPLE_RATE;
     i2s_cfg.mem_slab = &mem_slab;
     i2s_cfg.block_size = I2S_BLOCK_SIZE;
-    i2s_cfg.timeout = 1000;
+    i2s_cfg.timeout = WRITE_TIMEOUT;
     
     int ret = i2s_configure(i2s_dev, I2S_DIR_TX, &i2s_cfg);
     if (ret < 0) {
@@ -54,15 +83,29 @@ int AudioModule::Initialize() {
         LOG_DBG("i2s_configured successfully!");
     }
 
-    ret = k_mem_slab_alloc(&mem_slab, &mem_blocks, K_NO_WAIT);
-    if (ret < 0) {
-        LOG_ERR("Failed to allocate the memory blocks: %d\n", ret);
-        return ret;
-    } else {
-        LOG_DBG("slab allocated successfully!");
+    clipIndex.store(0, std::memory_order_relaxed);
+    loop.store(true, std::memory_order_relaxed);
+    gain.store(256, std::memory_order_relaxed);
+    playRequested.store(false, std::memory_order_relaxed);
+    stopRequested.store(false, std::memory_order_relaxed);
+    blocksPerWakeup.store(CONFIG_I2S_BLOCKS_PER_WAKEUP, std::memory_order_relaxed);
+    underruns.store(0, std::memory_order_relaxed);
+    blocks.store(0, std::memory_order_relaxed);
+    wakeups.store(0, std::memory_order_relaxed);
+    lowestQueue.store(CONFIG_I2S_NUM_BLOCKS, std::memory_order_relaxed);
+    toneEnabled.store(false, std::memory_order_relaxed);
+    toneVolume.store(0, std::memory_order_relaxed);
+    toneFrequency.store(440, std::memory_order_relaxed);
+    toneChanged.store(false, std::memory_order_relaxed);
+    player.finished = true;
+    tonePhase = 0;
+    toneLevel = 0;
+
+    for (size_t i = 0; i <= (1 << sineBits); ++i) {
+        sineTable[i] = static_cast<int16_t>(32767.0f * sinf(2.0f * static_cast<float>(M_PI) * i / (1 << sineBits)));
     }
 
-    memset((uint16_t*)mem_blocks, 0, (NUM_SAMPLES * NUM_BLOCKS));
+    k_sem_init(&playSemaphore, 0, 1);
 
     Bluetooth::GattRegisterControlCallback(CommandId::AlarmCmd,
         [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
@@ -73,7 +116,9 @@ int AudioModule::Initialize() {
     // Start working thread
     k_thread_create(&worker, pollStackAreaAudio, K_THREAD_STACK_SIZEOF(pollStackAreaAudio),
                     &WorkingThreadAudio, this, nullptr, nullptr, taskPriorityAudio, 0, K_NO_WAIT);
-    k_thread_suspend(&worker);
+
+    LOG_INF("%u clips, %u x %u us blocks, prefill %u, %u blocks per wakeup", audioClipCount, CONFIG_I2S_NUM_BLOCKS,
+            static_cast<uint32_t>(I2S_BLOCK_US), CONFIG_I2S_PREFILL_BLOCKS, CONFIG_I2S_BLOCKS_PER_WAKEUP);
 
     return ret;    
 }
@@ -96,6 +141,35 @@ bool AudioModule::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key,
             StopSampling();
             break;
 
+        case static_cast<uint8_t>(AudioCommand::SelectClip):
+            if (buffer[0] >= audioClipCount) {
+                return false;
+            }
+            clipIndex.store(buffer[0], std::memory_order_relaxed);
+            break;
+
+        case static_cast<uint8_t>(AudioCommand::SetLoop):
+            loop.store(buffer[0] != 0, std::memory_order_relaxed);
+            break;
+
+        case static_cast<uint8_t>(AudioCommand::SetVolume):
+            if (buffer[0] > 100) {
+                return false;
+            }
+            gain.store(buffer[0] * 256 / 100, std::memory_order_relaxed);
+            break;
+
+        case static_cast<uint8_t>(AudioCommand::SetBlocksPerWakeup):
+            if (buffer[0] == 0 || buffer[0] >= CONFIG_I2S_NUM_BLOCKS) {
+                return false;
+            }
+            blocksPerWakeup.store(buffer[0], std::memory_order_relaxed);
+            break;
+
+        case static_cast<uint8_t>(AudioCommand::ReportStats):
+            ReportStats();
+            break;
+
         default:
             break;
     }
@@ -104,61 +178,279 @@ bool AudioModule::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key,
 }
 
 int AudioModule::StartSampling(){
-    /* Start the transmission of data */
-	int ret = i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_START);
-	if (ret < 0) {
-		LOG_ERR("Failed to start the transmission: %d", ret);
-	} else {
-        LOG_DBG("Resuming thread...");
-        k_thread_resume(&worker);
-    }
-    return ret;
+    stopRequested.store(false, std::memory_order_relaxed);
+    playRequested.store(true, std::memory_order_release);
+    k_sem_give(&playSemaphore);
+
+    return 0;
 }
 
 int AudioModule::StopSampling(){
-	/* Start the transmission of data */
-	int ret = i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_DRAIN);
-	if (ret < 0) {
-		LOG_ERR("Failed to stop the transmission: %d", ret);
-	} else {
-        LOG_DBG("Suspending thread...");
-        k_thread_suspend(&worker);
+    stopRequested.store(true, std::memory_order_relaxed);
+    k_sem_give(&playSemaphore);
+
+    return 0;
+}
+
+uint32_t AudioModule::GetUnderruns() const {
+    return underruns.load(std::memory_order_relaxed);
+}
+
+void AudioModule::EnableTone(bool enable){
+    if (toneEnabled.exchange(enable, std::memory_order_relaxed) == enable) {
+        return;
+    }
+    if (enable) {
+        stopRequested.store(false, std::memory_order_relaxed);
+        k_sem_give(&playSemaphore);
     }
-    return ret;
 }
 
-    /**
-     * @brief Main working thread. Used to perform I2S transport.
-     * It required a separate stack to not break main BLE stack state machine
-     *
-     * @param data pointer to this
-     */
-    void AudioModule::WorkingThreadAudio(void *data, void *, void *){
-        AudioModule *self = static_cast<AudioModule *>(data);
-        int ret = 0;
-        uint32_t idx;
-        uint32_t j = 0;
+void AudioModule::SetToneVolume(uint8_t percent, uint32_t stamp){
+    toneVolume.store(MIN(percent, 100), std::memory_order_relaxed);
+    toneStamp.store(stamp, std::memory_order_relaxed);
+    toneChanged.store(true, std::memory_order_release);
+}
 
-        for (;;)
-        {
-            /* Put data into the tx buffer */
-            for (int i = 0; i < NUM_SAMPLES * NUM_BLOCKS; i++) {
-                idx = 2 * (NUM_BLOCKS * NUM_SAMPLES) * j + 2*i;
-                ((uint16_t*)self->mem_blocks)[i] = ((self->rawAudioData[idx+1]) << 8) | self->rawAudioData[idx];
-                if (j >= self->J_LIMIT){
-                    ((uint16_t*)self->mem_blocks)[i] = 0;
-                }
+void AudioModule::SetToneFrequency(uint16_t frequency, uint32_t stamp){
+    toneFrequency.store(frequency, std::memory_order_relaxed);
+    toneStamp.store(stamp, std::memory_order_relaxed);
+    toneChanged.store(true, std::memory_order_release);
+}
+
+LatencyMeter::Summary AudioModule::TakeToneLatency(){
+    return toneLatency.Take();
+}
+
+/**
+ * @brief Start selected clip from the beginning
+ */
+void AudioModule::StartClip(){
+    player.clip = &audioClips[clipIndex.load(std::memory_order_relaxed)];
+    player.finished = false;
+    player.state = {0, player.clip->startIndex};
+    player.position = 0;
+    player.step = (static_cast<uint64_t>(player.clip->sampleRate) << 16) / I2S_SAMPLE_RATE;
+    player.phase = 0;
+    player.previous = 0;
+    player.current = DecodeNext();
+
+    LOG_DBG("Playing %s", player.clip->name);
+}
+
+/**
+ * @brief Decode the next clip sample. Wraps around or finishes at the end of the clip
+ */
+int32_t AudioModule::DecodeNext(){
+    const AudioClip *clip = player.clip;
+
+    if (player.position >= clip->samples) {
+        if (!loop.load(std::memory_order_relaxed)) {
+            player.finished = true;
+            return 0;
+        }
+        player.state = {0, clip->startIndex};
+        player.position = 0;
+    }
+
+    uint32_t position = player.position++;
+
+    if (clip->format == AudioClipFormat::MuLaw) {
+        return MuLawDecode(clip->data[position]);
+    }
+
+    uint8_t nibble = (clip->data[position / 2] >> (4 * (position & 1))) & 0x0F;
+    return ImaAdpcm::Decode(player.state, nibble);
+}
+
+/**
+ * @brief Fill I2S block with resampled and scaled clip samples, silence after the end of the clip,
+ * and mix in the feedback tone
+ *
+ * @param block interleaved stereo block of CONFIG_I2S_FRAMES_PER_BLOCK frames
+ */
+void AudioModule::FillBlock(int16_t *block){
+    int32_t scale = gain.load(std::memory_order_relaxed);
+
+    if (toneChanged.exchange(false, std::memory_order_acquire)) {
+        // The block is heard once the blocks queued ahead of it are played
+        uint32_t ahead = CONFIG_I2S_NUM_BLOCKS - k_mem_slab_num_free_get(&mem_slab) - 1;
+        toneLatency.Add(toneStamp.load(std::memory_order_relaxed), static_cast<uint32_t>(ahead * I2S_BLOCK_US));
+    }
+
+    // Tone level ramps linearly over the block to the new volume, no clicks on changes
+    int32_t startLevel = toneLevel;
+    int32_t endLevel = toneEnabled.load(std::memory_order_relaxed) ? toneVolume.load(std::memory_order_relaxed) * 32767 / 100 : 0;
+    uint32_t toneStep = (static_cast<uint64_t>(toneFrequency.load(std::memory_order_relaxed)) << 32) / I2S_SAMPLE_RATE;
+    bool tone = startLevel != 0 || endLevel != 0;
+
+    for (size_t frame = 0; frame < CONFIG_I2S_FRAMES_PER_BLOCK; ++frame) {
+        int32_t sample = 0;
+
+        if (!player.finished) {
+            // Linear interpolation between clip samples, Q15 phase keeps the product in 32 bits
+            sample = player.previous + (((player.current - player.previous) * static_cast<int32_t>(player.phase >> 1)) >> 15);
+
+            player.phase += player.step;
+            while (player.phase >= phaseOne && !player.finished) {
+                player.phase -= phaseOne;
+                player.previous = player.current;
+                player.current = DecodeNext();
             }
+        }
+
+        sample = (sample * scale) >> 8;
+
+        if (tone) {
+            // Linear interpolation in the sine table, Q16 fraction of the entry
+            size_t index = tonePhase >> (32 - sineBits);
+            int32_t fraction = (tonePhase >> (32 - sineBits - 16)) & 0xFFFF;
+            int32_t sine = sineTable[index] + (((sineTable[index + 1] - sineTable[index]) * fraction) >> 16);
+            int32_t level = startLevel + (endLevel - startLevel) * static_cast<int32_t>(frame + 1) / CONFIG_I2S_FRAMES_PER_BLOCK;
+
+            sample = CLAMP(sample + ((sine * level) >> 15), INT16_MIN, INT16_MAX);
+            tonePhase += toneStep;
+        }
+
+        block[2 * frame] = sample;
+        block[2 * frame + 1] = sample;
+    }
 
-            j++;
-            if (j >= 2*self->J_LIMIT){
-                j = 0;
+    toneLevel = endLevel;
+}
+
+/**
+ * @brief Clip or feedback tone is playing. A disabled tone plays until it has ramped down
+ */
+bool AudioModule::Playing() const {
+    return !player.finished || toneEnabled.load(std::memory_order_relaxed) || toneLevel != 0;
+}
+
+/**
+ * @brief Play until the clip finishes and the tone is off, or StopSampling is called
+ */
+void AudioModule::Play(){
+    bool started = false;
+    bool failed = false;
+    size_t prefilled = 0;
+
+    // Changes made while stopped were not waiting on the queue
+    toneChanged.store(false, std::memory_order_relaxed);
+
+    while (!stopRequested.load(std::memory_order_relaxed)) {
+        if (playRequested.exchange(false, std::memory_order_acquire)) {
+            StartClip();
+        }
+        if (!Playing()) {
+            break;
+        }
+
+        size_t count = k_mem_slab_num_free_get(&mem_slab);
+        if (!started) {
+            count = MIN(count, CONFIG_I2S_PREFILL_BLOCKS - prefilled);
+        }
+
+        for (size_t i = 0; i < count && Playing(); ++i) {
+            void *block;
+            int ret = k_mem_slab_alloc(&mem_slab, &block, K_NO_WAIT);
+            if (ret < 0) {
+                break;
+            }
+
+            FillBlock(static_cast<int16_t *>(block));
+
+            ret = i2s_write(i2s_dev, block, I2S_BLOCK_SIZE);
+            if (ret == -EIO) {
+                // Stream stops on underrun. PREPARE drops the queue, then the stream is prefilled again with this block first
+                LOG_WRN("Underrun, %u total", underruns.fetch_add(1, std::memory_order_relaxed) + 1);
+                i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_PREPARE);
+                started = false;
+                prefilled = 0;
+                ret = i2s_write(i2s_dev, block, I2S_BLOCK_SIZE);
             }
-            /* Write Data */
-            ret = i2s_buf_write(self->i2s_dev, self->mem_blocks, I2S_BLOCK_SIZE);
             if (ret < 0) {
                 LOG_ERR("Error: i2s_write failed with %d", ret);
+                k_mem_slab_free(&mem_slab, block);
+                failed = true;
+                break;
+            }
+            blocks.fetch_add(1, std::memory_order_relaxed);
+
+            if (!started && ++prefilled == CONFIG_I2S_PREFILL_BLOCKS) {
+                break;
+            }
+        }
+        if (failed) {
+            break;
+        }
+
+        // TX can't start with an empty queue. A clip shorter than the prefill starts with the blocks it has
+        if (!started && prefilled > 0 && (prefilled == CONFIG_I2S_PREFILL_BLOCKS || !Playing())) {
+            int ret = i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_START);
+            if (ret < 0) {
+                LOG_ERR("Failed to start the transmission: %d", ret);
+                i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_DROP);
+                return;
+            }
+            started = true;
+            prefilled = 0;
+            // Top up the rest of the blocks right away
+            continue;
+        }
+
+        // Sleep until blocksPerWakeup blocks are played, or a block while prefill waits for free blocks.
+        // StartSampling and StopSampling wake the feeder at once
+        if (started || count == 0) {
+            uint32_t wait = started ? blocksPerWakeup.load(std::memory_order_relaxed) : 1;
+            k_sem_take(&playSemaphore, K_USEC(wait * I2S_BLOCK_US));
+        }
+
+        if (started) {
+            // Blocks still queued on wakeup are the margin left against an underrun
+            uint32_t queued = CONFIG_I2S_NUM_BLOCKS - k_mem_slab_num_free_get(&mem_slab);
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+            if (queued < lowestQueue.load(std::memory_order_relaxed)) {
+                lowestQueue.store(queued, std::memory_order_relaxed);
             }
         }
+    }
+
+    if (started) {
+        // Let the end of the clip play out, stop at once on StopSampling or error
+        bool stop = failed || stopRequested.load(std::memory_order_relaxed);
+        i2s_trigger(i2s_dev, I2S_DIR_TX, stop ? I2S_TRIGGER_DROP : I2S_TRIGGER_DRAIN);
+    } else if (prefilled > 0) {
+        i2s_trigger(i2s_dev, I2S_DIR_TX, I2S_TRIGGER_DROP);
+    }
+
+    ReportStats();
+}
+
+/**
+ * @brief Log playback statistics
+ */
+void AudioModule::ReportStats(){
+    uint32_t queued = lowestQueue.exchange(CONFIG_I2S_NUM_BLOCKS, std::memory_order_relaxed);
+
+    LOG_INF("%u blocks in %u wakeups, %u underruns, lowest queue %u blocks (%u us)",
+            blocks.load(std::memory_order_relaxed), wakeups.load(std::memory_order_relaxed),
+            underruns.load(std::memory_order_relaxed), queued, static_cast<uint32_t>(queued * I2S_BLOCK_US));
+}
+
+/**
+ * @brief Main working thread. Used to perform I2S transport.
+ * It required a separate stack to not break main BLE stack state machine
+ *
+ * @param data pointer to this
+ */
+void AudioModule::WorkingThreadAudio(void *data, void *, void *){
+    AudioModule *self = static_cast<AudioModule *>(data);
+
+    for (;;)
+    {
+        k_sem_take(&self->playSemaphore, K_FOREVER);
+        self->Play();
+    }
+}
 
-    }
\ No newline at end of file
+#endif // CONFIG_USE_I2S
@@ -0,0 +1,450 @@
+#if CONFIG_USE_ADS131_BAND_POWER
+
+#include "band_power.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "usb_comm_handler.hpp"
+#if CONFIG_USE_FEEDBACK
+#include "feedback_engine.hpp"
+#endif
+
+LOG_MODULE_REGISTER(band_power, LOG_LEVEL_INF);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_ADS131_BAND_POWER_FFT_SIZE) && CONFIG_ADS131_BAND_POWER_FFT_SIZE >= 32 &&
+             CONFIG_ADS131_BAND_POWER_FFT_SIZE <= 4096,
+             "CONFIG_ADS131_BAND_POWER_FFT_SIZE must be a power of two between 32 and 4096");
+#if CONFIG_USE_FEEDBACK
+BUILD_ASSERT(BandPower::MaxBands <= FeedbackEngine::MaxBands, "Feedback rules must reach every band");
+#endif
+
+namespace
+{
+    constexpr static int stackSize = 2048;  ///< Worker thread stack size. Records send BLE notifications
+    constexpr static int taskPriority = 8;  ///< Worker thread priority, below acquisition threads
+    constexpr static double pi = 3.14159265358979;
+    constexpr static float sampleScale = 1.0f / (1 << Ads131Pipeline::SampleShift); ///< Pipeline sample to ADC codes
+
+    /**
+     * @brief Default bands, 0.1 Hz: delta, theta, alpha, beta, gamma
+     */
+    constexpr static uint16_t defaultBands[][2] = {{10, 40}, {40, 80}, {80, 130}, {130, 300}, {300, 450}};
+
+    K_THREAD_STACK_DEFINE(bandPowerStackArea, stackSize); ///< Worker thread stack
+}
+
+/**
+ * @brief Construct BandPower
+ *
+ * @param controller USB communication controller
+ */
+BandPower::BandPower(UsbCommHandler &controller) : stream(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Registers BLE command handler and starts worker thread
+ *
+ * @param rate rate of pipeline blocks, Hz
+ */
+void BandPower::Initialize(uint32_t rate)
+{
+    Settings initial = {};
+
+    sampleRate = rate;
+    dropped.store(0, std::memory_order_relaxed);
+
+    for (size_t i = 0; i < Ads131Pipeline::MaxDevices; ++i)
+    {
+        devices[i].counter = 0;
+        gapPending[i] = false;
+    }
+
+    k_msgq_init(&blocks, blocksBuffer, sizeof(Block), maxQueuedBlocks);
+
+    if (arm_rfft_fast_init_f32(&fft, FftSize) != ARM_MATH_SUCCESS)
+    {
+        LOG_ERR("%s: ***ERROR: FFT size %u not supported", __func__, FftSize);
+        return;
+    }
+
+    initial.rate = CONFIG_ADS131_BAND_POWER_RATE;
+    initial.window = static_cast<BandPowerWindow>(CONFIG_ADS131_BAND_POWER_WINDOW);
+    initial.overlap = CONFIG_ADS131_BAND_POWER_OVERLAP;
+    initial.bandCount = ARRAY_SIZE(defaultBands);
+    memcpy(initial.bands, defaultBands, sizeof(defaultBands));
+
+    SetPending(initial);
+    ApplyPending();
+
+    Bluetooth::GattRegisterControlCallback(CommandId::BandPowerCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+
+    k_thread_create(&thread, bandPowerStackArea, K_THREAD_STACK_SIZEOF(bandPowerStackArea),
+                    &BandPower::WorkingThread, this, nullptr, nullptr, taskPriority, 0, K_NO_WAIT);
+    k_thread_name_set(&thread, "band_power");
+
+    LOG_INF("%u-point FFT at %u SPS, %u Hz records", FftSize, sampleRate, settings.rate);
+}
+
+bool BandPower::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    Settings requested;
+
+    if (offset.value != 0 || length.value < 1)
+    {
+        return false;
+    }
+
+    k_spinlock_key_t lockKey = k_spin_lock(&pendingLock);
+    requested = pendingSettings;
+    k_spin_unlock(&pendingLock, lockKey);
+
+    // Settings are applied by the worker thread before the next block
+    switch (static_cast<BandPowerCommand>(key.key[0]))
+    {
+    case BandPowerCommand::SetRate:
+        if (buffer[0] > MaxRate)
+        {
+            return false;
+        }
+        requested.rate = buffer[0];
+        break;
+
+    case BandPowerCommand::SetWindow:
+        if (buffer[0] > static_cast<uint8_t>(BandPowerWindow::Blackman))
+        {
+            return false;
+        }
+        requested.window = static_cast<BandPowerWindow>(buffer[0]);
+        break;
+
+    case BandPowerCommand::SetOverlap:
+        if (buffer[0] > MaxOverlap)
+        {
+            return false;
+        }
+        requested.overlap = buffer[0];
+        break;
+
+    case BandPowerCommand::SetBands:
+        if (buffer[0] == 0 || buffer[0] > MaxBands || length.value < 1 + 4 * buffer[0])
+        {
+            return false;
+        }
+        requested.bandCount = buffer[0];
+        for (size_t i = 0; i < requested.bandCount; ++i)
+        {
+            uint16_t low = sys_get_le16(buffer + 1 + 4 * i);
+            uint16_t high = sys_get_le16(buffer + 3 + 4 * i);
+
+            // Edges in 0.1 Hz, Nyquist frequency is 5 * sampleRate
+            if (low >= high || high > 5 * sampleRate)
+            {
+                return false;
+            }
+            requested.bands[i][0] = low;
+            requested.bands[i][1] = high;
+        }
+        break;
+
+    default:
+        return false;
+    }
+
+    SetPending(requested);
+
+    return true;
+}
+
+/**
+ * @brief Store settings to be applied by worker thread before the next block
+ */
+void BandPower::SetPending(const Settings &requested)
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    pendingSettings = requested;
+    reloadPending.store(true, std::memory_order_release);
+
+    k_spin_unlock(&pendingLock, key);
+}
+
+/**
+ * @brief Apply pending settings. Restarts history and accumulation of every device
+ */
+void BandPower::ApplyPending()
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    settings = pendingSettings;
+    reloadPending.store(false, std::memory_order_relaxed);
+
+    k_spin_unlock(&pendingLock, key);
+
+    hop = MAX(FftSize - FftSize * settings.overlap / 100, 1u);
+    recordInterval = settings.rate != 0 ? MAX(sampleRate / settings.rate, 1u) : 0;
+
+    double sumSquares = 0.0;
+    for (size_t n = 0; n < FftSize; ++n)
+    {
+        double phase = 2.0 * pi * n / FftSize;
+        double w;
+
+        switch (settings.window)
+        {
+        case BandPowerWindow::Hann:
+            w = 0.5 - 0.5 * cos(phase);
+            break;
+
+        case BandPowerWindow::Hamming:
+            w = 0.54 - 0.46 * cos(phase);
+            break;
+
+        case BandPowerWindow::Blackman:
+            w = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2.0 * phase);
+            break;
+
+        case BandPowerWindow::Rectangular:
+        default:
+            w = 1.0;
+            break;
+        }
+
+        window[n] = static_cast<float>(w);
+        sumSquares += window[n] * window[n];
+    }
+
+    // One-sided density 2 |X|^2 / (fs * sum(w^2)) times bin width fs / N
+    binScale = static_cast<float>(2.0 / (FftSize * sumSquares));
+
+    // Bin k is at k * fs / N. Band takes bins with low <= f < high
+    for (size_t b = 0; b < settings.bandCount; ++b)
+    {
+        for (size_t edge = 0; edge < 2; ++edge)
+        {
+            size_t bin = DIV_ROUND_UP(settings.bands[b][edge] * FftSize, 10 * sampleRate);
+            bandBins[b][edge] = MIN(bin, Bins);
+        }
+    }
+
+    for (Device &dev : devices)
+    {
+        dev.head = 0;
+        dev.filled = 0;
+        dev.sinceSegment = 0;
+        dev.sinceRecord = 0;
+        dev.segments = 0;
+        memset(dev.power, 0, sizeof(dev.power));
+    }
+
+    LOG_INF("Window %u, overlap %u%%, %u bands, %u Hz records", static_cast<uint8_t>(settings.window),
+            settings.overlap, settings.bandCount, settings.rate);
+}
+
+/**
+ * @brief Queue filtered block of one device. Block is dropped if worker thread is behind, and segments of the
+ *        device restart after the gap
+ *
+ * @param device device index, less than Ads131Pipeline::MaxDevices
+ * @param block per channel samples, 24-bit ADC codes scaled by 2^Ads131Pipeline::SampleShift
+ */
+void BandPower::PushBlock(size_t device, const q31_t (&block)[Channels][BlockSamples])
+{
+    outgoing.device = device;
+    outgoing.gap = gapPending[device];
+    outgoing.stamp = k_cycle_get_32();
+    memcpy(outgoing.samples, block, sizeof(outgoing.samples));
+
+    if (k_msgq_put(&blocks, &outgoing, K_NO_WAIT) != 0)
+    {
+        gapPending[device] = true;
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    gapPending[device] = false;
+}
+
+#if CONFIG_USE_FEEDBACK
+/**
+ * @brief Set feedback engine fed with band powers of every segment
+ *
+ * @param engine feedback engine, nullptr stops feeding band powers
+ */
+void BandPower::SetFeedback(FeedbackEngine *engine)
+{
+    feedback = engine;
+}
+#endif
+
+/**
+ * @brief Worker thread. Appends queued blocks to history and computes segments and records.
+ *
+ * @param data pointer to current instance of BandPower
+ */
+void BandPower::WorkingThread(void *data, void *, void *)
+{
+    BandPower *self = static_cast<BandPower *>(data);
+    Block block;
+
+    while (true)
+    {
+        if (k_msgq_get(&self->blocks, &block, K_FOREVER) != 0)
+        {
+            continue;
+        }
+
+        if (self->reloadPending.load(std::memory_order_acquire))
+        {
+            self->ApplyPending();
+        }
+
+        self->Append(block);
+    }
+}
+
+/**
+ * @brief Append block to device history, computing segments and records on the way
+ */
+void BandPower::Append(const Block &block)
+{
+    Device &dev = devices[block.device];
+
+    if (block.gap)
+    {
+        // Segments must not span dropped samples
+        dev.filled = 0;
+        dev.sinceSegment = 0;
+        LOG_WRN("Device %u: blocks dropped, %u total", block.device, dropped.load(std::memory_order_relaxed));
+    }
+
+    if (recordInterval == 0)
+    {
+        return;
+    }
+
+    dev.stamp = block.stamp;
+
+    for (size_t i = 0; i < BlockSamples; ++i)
+    {
+        for (size_t ch = 0; ch < Channels; ++ch)
+        {
+            dev.history[ch][dev.head] = block.samples[ch][i] * sampleScale;
+        }
+        dev.head = (dev.head + 1) % FftSize;
+        dev.filled = MIN(dev.filled + 1, FftSize);
+
+        // First segment ends when history is full, the next ones every hop, like scipy.signal.welch
+        if (++dev.sinceSegment >= hop && dev.filled == FftSize)
+        {
+            Segment(dev, block.device);
+            dev.sinceSegment = 0;
+        }
+
+        if (++dev.sinceRecord >= recordInterval)
+        {
+            Record(dev, block.device);
+            dev.sinceRecord = 0;
+        }
+    }
+}
+
+/**
+ * @brief Compute periodogram of every channel from history and add band powers to accumulators
+ *
+ * @param dev device state
+ * @param index device index
+ */
+void BandPower::Segment(Device &dev, size_t index)
+{
+    size_t tail = FftSize - dev.head;
+    float power[MaxBands];
+
+    for (size_t ch = 0; ch < Channels; ++ch)
+    {
+        // Oldest sample is at head
+        memcpy(fftInput, &dev.history[ch][dev.head], tail * sizeof(float));
+        memcpy(fftInput + tail, dev.history[ch], dev.head * sizeof(float));
+
+        float mean;
+        arm_mean_f32(fftInput, FftSize, &mean);
+        arm_offset_f32(fftInput, -mean, fftInput, FftSize);
+        arm_mult_f32(fftInput, window, fftInput, FftSize);
+        arm_rfft_fast_f32(&fft, fftInput, fftOutput, 0);
+
+        // Packed output: real DC and Nyquist bins, then complex bins 1 .. N/2 - 1
+        binPower[0] = fftOutput[0] * fftOutput[0] * binScale / 2;
+        binPower[Bins - 1] = fftOutput[1] * fftOutput[1] * binScale / 2;
+        arm_cmplx_mag_squared_f32(fftOutput + 2, binPower + 1, FftSize / 2 - 1);
+        arm_scale_f32(binPower + 1, binScale, binPower + 1, FftSize / 2 - 1);
+
+        for (size_t b = 0; b < settings.bandCount; ++b)
+        {
+            power[b] = 0.0f;
+            for (size_t k = bandBins[b][0]; k < bandBins[b][1]; ++k)
+            {
+                power[b] += binPower[k];
+            }
+            dev.power[ch][b] += power[b];
+        }
+
+#if CONFIG_USE_FEEDBACK
+        if (feedback != nullptr &&
+            (feedback->Wants(FeedbackSource::BandPower) || feedback->Wants(FeedbackSource::RelativePower)))
+        {
+            feedback->OnBandPower(index, ch, power, settings.bandCount, dev.stamp);
+        }
+#endif
+    }
+
+    dev.segments++;
+}
+
+/**
+ * @brief Send averaged band powers and clear accumulators
+ */
+void BandPower::Record(Device &dev, size_t index)
+{
+    uint8_t record[headerSize + Channels * MaxBands * sizeof(float)];
+    uint8_t *out = record + headerSize;
+
+    if (dev.segments == 0)
+    {
+        return;
+    }
+
+    record[0] = dev.counter++;
+    record[1] = index;
+    record[2] = settings.bandCount;
+    record[3] = MIN(dev.segments, UINT8_MAX);
+
+    for (size_t ch = 0; ch < Channels; ++ch)
+    {
+        for (size_t b = 0; b < settings.bandCount; ++b)
+        {
+            float value = dev.power[ch][b] / dev.segments;
+            uint32_t bits;
+
+            memcpy(&bits, &value, sizeof(bits));
+            sys_put_le32(bits, out);
+            out += sizeof(bits);
+        }
+    }
+
+    dev.segments = 0;
+    memset(dev.power, 0, sizeof(dev.power));
+
+    stream.Publish(record, out - record);
+}
+
+#endif // CONFIG_USE_ADS131_BAND_POWER
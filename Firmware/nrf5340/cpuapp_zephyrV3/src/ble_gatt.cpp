@@ -63,6 +63,13 @@ atomic_t bme280NotificationsEnable = false;
 atomic_t rssiNotificationsEnable = false;
 atomic_t qmc5883lNotificationsEnable = false;
 atomic_t iBeaconNotificationsEnable = false;
+atomic_t vitalsNotificationsEnable = false;
+atomic_t orientationNotificationsEnable = false;
+atomic_t bandPowerNotificationsEnable = false;
+atomic_t dmicSpectrumNotificationsEnable = false;
+atomic_t dmicAudioNotificationsEnable = false;
+atomic_t signalQualityNotificationsEnable = false;
+atomic_t captureEventNotificationsEnable = false;
 
 /* BT832A Custom Service  */
 bt_uuid_128 sensorServiceUUID = BT_UUID_INIT_128(
@@ -100,6 +107,27 @@ bt_uuid_128 controlUUID = BT_UUID_INIT_128(
 // iBeacons Data Pipe
 bt_uuid_128 iBeaconUUID = BT_UUID_INIT_128(
     BT_UUID_128_ENCODE(0x000acafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// Vitals (heart rate, SpO2) Data Pipe
+bt_uuid_128 vitalsDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x000bcafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// Orientation quaternion Data Pipe
+bt_uuid_128 orientationDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x000ccafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// ADS131M08 band power Data Pipe
+bt_uuid_128 bandPowerDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x000dcafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// DMIC spectrum and level Data Pipe
+bt_uuid_128 dmicSpectrumDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x000ecafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// DMIC IMA ADPCM audio Data Pipe
+bt_uuid_128 dmicAudioDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x000fcafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// ADS131M08 signal quality Data Pipe
+bt_uuid_128 signalQualityDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x0010cafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
+// Event-triggered capture event record Data Pipe
+bt_uuid_128 captureEventDataUUID = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x0011cafe,  0xb0ba, 0x8bad, 0xf00d, 0xdeadbeef0000));
 
 static ssize_t ControlCharacteristicWrite(bt_conn *conn, const bt_gatt_attr *attr, const void *buf, uint16_t len, uint16_t offset, uint8_t flags);
 
@@ -192,6 +220,104 @@ static void iBeaconCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
 	LOG_DBG("iBeacon Notification %s", iBeaconNotificationsEnable ? "enabled" : "disabled");
 }
 
+/**
+ * @brief CCCD handler for Vitals characteristic. Used to get notifications if client enables notifications
+ *        for Vitals characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void vitalsCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&vitalsNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("Vitals Notification %s", vitalsNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for Orientation characteristic. Used to get notifications if client enables notifications
+ *        for Orientation characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void orientationCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&orientationNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("Orientation Notification %s", orientationNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for Band Power characteristic. Used to get notifications if client enables notifications
+ *        for Band Power characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void bandPowerCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&bandPowerNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("Band Power Notification %s", bandPowerNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for DMIC Spectrum characteristic. Used to get notifications if client enables notifications
+ *        for DMIC Spectrum characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void dmicSpectrumCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&dmicSpectrumNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("DMIC Spectrum Notification %s", dmicSpectrumNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for DMIC Audio characteristic. Used to get notifications if client enables notifications
+ *        for DMIC Audio characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void dmicAudioCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&dmicAudioNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("DMIC Audio Notification %s", dmicAudioNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for Signal Quality characteristic. Used to get notifications if client enables notifications
+ *        for Signal Quality characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void signalQualityCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&signalQualityNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("Signal Quality Notification %s", signalQualityNotificationsEnable ? "enabled" : "disabled");
+}
+
+/**
+ * @brief CCCD handler for Capture Event characteristic. Used to get notifications if client enables notifications
+ *        for Capture Event characteristic. CCC = Client Characteristic Configuration
+ *
+ * @param attr Ble Gatt attribute
+ * @param value characteristic value
+ */
+static void captureEventCccHandler(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	ARG_UNUSED(attr);
+    atomic_set(&captureEventNotificationsEnable, value == BT_GATT_CCC_NOTIFY);
+	LOG_DBG("Capture Event Notification %s", captureEventNotificationsEnable ? "enabled" : "disabled");
+}
+
 /**
  * @brief CCCD handler for BME280 characteristic. Used to get notifications if client enables notifications
  *        for BME280 characteristic. CCC = Client Characteristic Configuration
@@ -278,8 +404,29 @@ BT_GATT_CCC(qmc5883lCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
 BT_GATT_CHARACTERISTIC(&iBeaconUUID.uuid, BT_GATT_CHRC_NOTIFY,                          // 25, 26
 		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
 BT_GATT_CCC(iBeaconCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),                 // 27
-BT_GATT_CHARACTERISTIC(&controlUUID.uuid, BT_GATT_CHRC_WRITE | BT_GATT_CHRC_WRITE_WITHOUT_RESP,
+BT_GATT_CHARACTERISTIC(&controlUUID.uuid, BT_GATT_CHRC_WRITE | BT_GATT_CHRC_WRITE_WITHOUT_RESP,     // 28, 29
     BT_GATT_PERM_WRITE, nullptr, ControlCharacteristicWrite, nullptr),
+BT_GATT_CHARACTERISTIC(&vitalsDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                       // 30, 31
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(vitalsCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),                  // 32
+BT_GATT_CHARACTERISTIC(&orientationDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                  // 33, 34
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(orientationCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),             // 35
+BT_GATT_CHARACTERISTIC(&bandPowerDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                    // 36, 37
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(bandPowerCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),               // 38
+BT_GATT_CHARACTERISTIC(&dmicSpectrumDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                 // 39, 40
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(dmicSpectrumCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),            // 41
+BT_GATT_CHARACTERISTIC(&dmicAudioDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                    // 42, 43
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(dmicAudioCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),               // 44
+BT_GATT_CHARACTERISTIC(&signalQualityDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                // 45, 46
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(signalQualityCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),           // 47
+BT_GATT_CHARACTERISTIC(&captureEventDataUUID.uuid, BT_GATT_CHRC_NOTIFY,                 // 48, 49
+		        BT_GATT_PERM_READ, nullptr, nullptr, nullptr),
+BT_GATT_CCC(captureEventCccHandler, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),            // 50
 );
 
 /********************************************************/
@@ -475,4 +622,27 @@ void GattSetControlCallback(CommandId commandId, BleControlAction&& action)
     }
 }
 
+/**
+ * @brief Pass complete command to the registered Control callback. Used by transports other than BLE
+ * 
+ * @param commandId command ID
+ * @param key command key
+ * @param buffer command data
+ * @param length command data length
+ * 
+ * @return true if handler was found and command was processed succesfully
+ */
+bool GattDispatchControlCommand(CommandId commandId, CommandKey key, const uint8_t* buffer, BleLength length)
+{
+    BleControlAction &handler = handlers[static_cast<size_t>(commandId)];
+
+    if (handler == nullptr)
+    {
+        LOG_WRN("No handler registered for command id %d", static_cast<int>(commandId));
+        return false;
+    }
+
+    return handler(buffer, key, length, BleOffset{0});
+}
+
 } // namespace Bluetooth::Gatt
@@ -117,6 +117,13 @@ void OnClientDisconnected(struct bt_conn *disconn, uint8_t reason)
     atomic_set(&Bluetooth::Gatt::rssiNotificationsEnable, false);
     atomic_set(&Bluetooth::Gatt::qmc5883lNotificationsEnable, false);
     atomic_set(&Bluetooth::Gatt::iBeaconNotificationsEnable, false);    
+    atomic_set(&Bluetooth::Gatt::vitalsNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::orientationNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::bandPowerNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::dmicSpectrumNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::dmicAudioNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::signalQualityNotificationsEnable, false);
+    atomic_set(&Bluetooth::Gatt::captureEventNotificationsEnable, false);
     LOG_INF("Disconnected (reason %u)", reason);
 }
 
@@ -381,6 +388,104 @@ void Bme280Notify(const uint8_t* data, const uint8_t len)
     }
 }
 
+/**
+ * @brief Send BLE notification through Vitals Data Pipe.
+ *
+ * @param data pointer to datasource containing vitals record
+ * @param len  record length
+ */
+void VitalsNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::vitalsNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicVitalsData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through Orientation Data Pipe.
+ *
+ * @param data pointer to datasource containing quaternion record
+ * @param len  record length
+ */
+void OrientationNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::orientationNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicOrientationData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through Band Power Data Pipe.
+ *
+ * @param data pointer to datasource containing band power record
+ * @param len  record length
+ */
+void BandPowerNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::bandPowerNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicBandPowerData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through DMIC Spectrum Data Pipe.
+ *
+ * @param data pointer to datasource containing spectrum or level record
+ * @param len  record length
+ */
+void DmicSpectrumNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::dmicSpectrumNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicDmicSpectrumData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through DMIC Audio Data Pipe.
+ *
+ * @param data pointer to datasource containing IMA ADPCM packet
+ * @param len  packet length
+ */
+void DmicAudioNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::dmicAudioNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicDmicAudioData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through Signal Quality Data Pipe.
+ *
+ * @param data pointer to datasource containing signal quality record
+ * @param len  record length
+ */
+void SignalQualityNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::signalQualityNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicSignalQualityData], data, len);
+    }
+}
+
+/**
+ * @brief Send BLE notification through Capture Event Data Pipe.
+ *
+ * @param data pointer to datasource containing capture event record
+ * @param len  record length
+ */
+void CaptureEventNotify(const uint8_t* data, const uint8_t len)
+{
+    if (atomic_get(&Gatt::captureEventNotificationsEnable))
+    {
+        bt_gatt_notify(nullptr, &Gatt::bt832a_svc.attrs[Gatt::CharacteristicCaptureEventData], data, len);
+    }
+}
+
 /**
  * @brief Send BLE notification through RSSI Data Pipe.
  *
@@ -438,4 +543,19 @@ void GattRegisterControlCallback(CommandId commandId, BleControlAction&& action)
     Gatt::GattSetControlCallback(commandId, std::forward<BleControlAction>(action));
 }
 
+/**
+ * @brief Execute command through the same handler table as the BLE Control characteristic
+ * 
+ * @param commandId command ID
+ * @param key command key
+ * @param buffer command data
+ * @param length command data length
+ * 
+ * @return true if command was processed succesfully
+ */
+bool DispatchControlCommand(CommandId commandId, CommandKey key, const uint8_t* buffer, BleLength length)
+{
+    return Gatt::GattDispatchControlCommand(commandId, key, buffer, length);
+}
+
 } // namespace Bluetooth
@@ -1,117 +1,320 @@
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+
 #include "bme280.hpp"
 // For registering callback
 #include "ble_service.hpp"
 
+#define DEVICE_NODE DT_NODELABEL(i2c1)
+
 LOG_MODULE_REGISTER(bme280, LOG_LEVEL_INF);
 
-Bme280::Bme280(UsbCommHandler &controller) : serialHandler(controller) {
+Bme280::Bme280(UsbCommHandler &controller) : stream(controller) {
     LOG_DBG("Bme280 Constructor!");
     k_timer_init(&timer, &Bme280::TimerHandler, nullptr);
-    k_sem_init(&pollSemaphore, 0, 1);    
 }
 
 int Bme280::Initialize() {
 
     int ret = 0;
-    // uint8_t part_id;
-    
-    LOG_DBG("Starting Bme280 Initialization..."); 
-    
+
+    LOG_DBG("Starting Bme280 Initialization...");
+
     packet_cnt = 0;
     sample_cnt = 0;
-    bme280_dev = get_bme280_device();
+    const struct device* dev = DEVICE_DT_GET(DEVICE_NODE);
+    transport.Initialize(dev);
 
-    if (bme280_dev != nullptr){
-        GetChipId(bme280_dev);
-        // Start working thread
-        k_thread_create(&worker, pollStackArea, K_THREAD_STACK_SIZEOF(pollStackArea),
-                        &WorkingThread, this, nullptr, nullptr, taskPriority, 0, K_NO_WAIT);        
-    } else {
-        bme280_is_on_i2c_bus_.store(false, std::memory_order_relaxed);
-        bmp280_is_on_i2c_bus_.store(false, std::memory_order_relaxed);
-        bmx_id = 0x00;
-        return -1;        
+    sampling.store(false, std::memory_order_relaxed);
+    conversionStarted.store(false, std::memory_order_relaxed);
+    bme280_is_on_i2c_bus_.store(false, std::memory_order_relaxed);
+    bmp280_is_on_i2c_bus_.store(false, std::memory_order_relaxed);
+
+    GetChipId();
+    if(!BmX280IsOnI2cBus()){
+        LOG_ERR("Wrong ID: 0x%X", bmx_id);
+        return -1;
     }
 
-    Bluetooth::GattRegisterControlCallback(CommandId::Bme280Cmd,
-        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
-        {
-            return OnBleCommand(buffer, key, length, offset);
-        });
+    EnableRecovery(transport);
+
+    ret = Reset();
+    if(ret != 0){
+        return ret;
+    }
+    ReadCalibration();
+    WriteSettings();
+
+    ctrlMeas = (BME280_OVERSAMPLING_1X << 5) | (BME280_OVERSAMPLING_1X << 2) | BME280_MODE_FORCED;
+    sensorDataSize = Bme280IsOnI2cBus() ? bme280DataSize : bmp280DataSize;
+    tx_buf[0] = bmx_id;
+
+    transport.SetupTransaction(dataTransaction, [this](int status) { OnSensorData(status); }, I2cPriority::Low);
+    transport.SetupTransaction(triggerTransaction, [this](int status) { OnConversionStarted(status); }, I2cPriority::Low);
+
+    RegisterCommands(CommandId::Bme280Cmd);
 
     return ret;
 }
 
-bool Bme280::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset){
-    if (offset.value != 0 || length.value == 0)
-    {
-        return false;
+int Bme280::Start(){
+    if(Initialize() != 0){
+        LOG_WRN("BME280 is not connected or properly initialized!");
+        return -1;
     }
-    LOG_DBG("Bme280 BLE Command received");
 
-    Bluetooth::CommandKey bleCommand;
-    memcpy(&bleCommand, &key, sizeof(key));
-          
-    switch(bleCommand.key[0]){
-        case static_cast<uint8_t>(BleCommand::StartSampling):
-            StartSampling();
-            break;
-        case static_cast<uint8_t>(BleCommand::StopSampling):
-            StopSampling();
-            break;
-        
+    StartSampling();
+    return 0;
+}
+
+bool Bme280::OnCommand(uint8_t key, const uint8_t *buffer, size_t length){
+    LOG_DBG("Bme280 command received");
+
+    switch(key){
+        case static_cast<uint8_t>(Bme280Command::SetPeriod):
+            return length >= 2 && SetPeriod(sys_get_le16(buffer));
+
         default:
             break;
     }
-    
+
     return true;
 }
 
-void Bme280::GetChipId(const struct device *dev){
-    struct bme280_data *data = ToData(dev);
+void Bme280::GetChipId(){
+    bmx_id = transport.ReadRegister(BME280_REG_ID);
 
-    bmx_id = data->chip_id;
-    if(data->chip_id == bme280_id){
+    if(bmx_id == bme280_id){
         LOG_DBG("BME280 on I2C bus!");
         bme280_is_on_i2c_bus_.store(true, std::memory_order_relaxed);
-    } else if (data->chip_id == bmp280_id_sample_1 || data->chip_id == bmp280_id_mp){
+    } else if (bmx_id == bmp280_id_sample_1 || bmx_id == bmp280_id_mp){
         LOG_DBG("BMP280 on I2C bus!");
         bmp280_is_on_i2c_bus_.store(true, std::memory_order_relaxed);
     }
 }
-const struct device * Bme280::get_bme280_device(void){
-	
-    // const struct device *dev = DEVICE_DT_GET(DT_BUS(DT_NODELABEL(bme280)));
-    const struct device *dev = DEVICE_DT_GET_ANY(bosch_bme280);
 
-	if (dev == nullptr) {
-		/* No such node, or the node does not have status "okay". */
-		LOG_ERR("\nError: no BME280 device found.\n");
-		return nullptr;
-	}
+int Bme280::Reset(){
+    transport.WriteRegister(BME280_REG_RESET, BME280_RESET_VALUE);
 
-	if (!device_is_ready(dev)) {
-		LOG_ERR("\nError: Device \"%s\" is not ready; "
-		       "check the driver initialization logs for errors.\n",
-		       dev->name);        
-		return nullptr;
-	}
+    // Calibration data is copied from NVM after reset, im_update bit is cleared when copy is done
+    int ret = transport.WaitRegisterClear(BME280_REG_STATUS, BIT(0), resetTimeoutMs);
+    if(ret != 0){
+        LOG_ERR("Bme280 Reset failed: %d", ret);
+    }
 
-	LOG_DBG("Found device \"%s\", getting sensor data\n", dev->name);
-	return dev;    
+    return ret;
 }
 
-struct bme280_data * Bme280::ToData(const struct device *dev){
-    return static_cast<bme280_data *>(dev->data);
+int Bme280::WriteSettings(){
+    // 1x oversampling on every channel, no IIR filter. Humidity setting is applied on CTRL_MEAS write
+    if(Bme280IsOnI2cBus()){
+        transport.WriteRegister(BME280_REG_CTRL_HUM, BME280_OVERSAMPLING_1X);
+    }
+    transport.WriteRegister(BME280_REG_CONFIG, 0x00);
+    transport.WriteRegister(BME280_REG_CTRL_MEAS, BME280_MODE_SLEEP);
+
+    return transport.GetStatus();
+}
+
+int Bme280::Recover(){
+    LOG_WRN("Bme280 is not responding, initializing again");
+    // Sampling flag is kept, so sampling resumes after recovery
+    k_timer_stop(&timer);
+    conversionStarted.store(false, std::memory_order_relaxed);
+
+    int ret = Reset();
+    if(ret == 0){
+        ReadCalibration();
+        ret = WriteSettings();
+    }
+    if(ret != 0){
+        LOG_ERR("Bme280 recovery failed: %d", ret);
+        return ret;
+    }
+
+    if(sampling.load(std::memory_order_relaxed)){
+        StartSampling();
+    }
+
+    LOG_INF("Bme280 recovered");
+    return 0;
+}
+
+void Bme280::ReadCalibration(){
+    uint8_t buf[calibrationSize];
+
+    transport.ReadRegisters(BME280_REG_CALIB_00, buf, sizeof(buf));
+    calibration.dig_t1 = sys_get_le16(buf);
+    calibration.dig_t2 = sys_get_le16(buf + 2);
+    calibration.dig_t3 = sys_get_le16(buf + 4);
+    calibration.dig_p1 = sys_get_le16(buf + 6);
+    calibration.dig_p2 = sys_get_le16(buf + 8);
+    calibration.dig_p3 = sys_get_le16(buf + 10);
+    calibration.dig_p4 = sys_get_le16(buf + 12);
+    calibration.dig_p5 = sys_get_le16(buf + 14);
+    calibration.dig_p6 = sys_get_le16(buf + 16);
+    calibration.dig_p7 = sys_get_le16(buf + 18);
+    calibration.dig_p8 = sys_get_le16(buf + 20);
+    calibration.dig_p9 = sys_get_le16(buf + 22);
+    calibration.dig_h1 = buf[25];
+
+    if(!Bme280IsOnI2cBus()){
+        return;
+    }
+
+    // dig_H4 and dig_H5 are 12-bit values sharing register 0xE5
+    transport.ReadRegisters(BME280_REG_CALIB_26, buf, humidityCalibrationSize);
+    calibration.dig_h2 = sys_get_le16(buf);
+    calibration.dig_h3 = buf[2];
+    calibration.dig_h4 = static_cast<int16_t>(static_cast<int8_t>(buf[3]) * 16 | (buf[4] & 0x0F));
+    calibration.dig_h5 = static_cast<int16_t>(static_cast<int8_t>(buf[5]) * 16 | (buf[4] >> 4));
+    calibration.dig_h6 = static_cast<int8_t>(buf[6]);
+}
+
+void Bme280::UpdateDeadlines(){
+    // Conversion has to be started early enough to complete before the next tick reads it
+    dataTransaction.deadlineUs = period * 1000;
+    triggerTransaction.deadlineUs = (period - minPeriod) * 1000;
 }
 
 void Bme280::StartSampling(){
-    // Start BME280 polling
-    k_timer_start(&timer, K_MSEC(pollPeriod), K_MSEC(pollPeriod));
-}   
+    UpdateDeadlines();
+    sampling.store(true, std::memory_order_relaxed);
+    k_timer_start(&timer, K_MSEC(period), K_MSEC(period));
+}
 
 void Bme280::StopSampling(){
+    sampling.store(false, std::memory_order_relaxed);
     k_timer_stop(&timer);
+    // Conversion in progress completes to sleep mode, its result is not read
+    conversionStarted.store(false, std::memory_order_relaxed);
+}
+
+bool Bme280::SetPeriod(uint32_t value){
+    if(value < minPeriod || value > maxPeriod){
+        return false;
+    }
+
+    period = value;
+    UpdateDeadlines();
+    LOG_INF("Sampling period %u ms", period);
+
+    if(sampling.load(std::memory_order_relaxed)){
+        k_timer_start(&timer, K_MSEC(period), K_MSEC(period));
+    }
+
+    return true;
+}
+
+void Bme280::TimerHandler(k_timer *tmr){
+    Bme280 *self = CONTAINER_OF(tmr, Bme280, timer);
+
+    // Transfers which are still queued from the previous period are not repeated
+    if(self->conversionStarted.exchange(false, std::memory_order_relaxed)){
+        self->transport.ReadRegistersAsync(self->dataTransaction, BME280_REG_PRESS_MSB, self->sensorData, self->sensorDataSize);
+    } else {
+        self->transport.WriteRegistersAsync(self->triggerTransaction, BME280_REG_CTRL_MEAS, &self->ctrlMeas, 1);
+    }
+}
+
+void Bme280::OnSensorData(int status){
+    if(status != 0){
+        LOG_WRN("Sensor data read failed: %d", status);
+    } else {
+        StoreSample();
+    }
+
+    if(sampling.load(std::memory_order_relaxed)){
+        transport.WriteRegistersAsync(triggerTransaction, BME280_REG_CTRL_MEAS, &ctrlMeas, 1);
+    }
+}
+
+void Bme280::OnConversionStarted(int status){
+    if(status != 0){
+        LOG_WRN("Conversion start failed: %d", status);
+        return;
+    }
+
+    conversionStarted.store(sampling.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void Bme280::StoreSample(){
+    int32_t adcPressure = (sensorData[0] << 12) | (sensorData[1] << 4) | (sensorData[2] >> 4);
+    int32_t adcTemperature = (sensorData[3] << 12) | (sensorData[4] << 4) | (sensorData[5] >> 4);
+
+    // Channel values keep sensor_value layout and units of Zephyr sensor API: DegC, kPa, %RH
+    size_t channels = Bme280IsOnI2cBus() ? 3 : 2;
+    uint8_t *out = tx_buf + headerSize + channels * sensorValueSize * sample_cnt;
+
+    int32_t temperature = CompensateTemperature(adcTemperature);
+    PutValue(out, temperature / 100, temperature % 100 * 10000);
+
+    uint32_t pressure = CompensatePressure(adcPressure);
+    PutValue(out + sensorValueSize, (pressure >> 8) / 1000,
+             (pressure >> 8) % 1000 * 1000 + (((pressure & 0xFF) * 1000) >> 8));
+
+    if(channels == 3){
+        int32_t adcHumidity = (sensorData[6] << 8) | sensorData[7];
+        uint32_t humidity = CompensateHumidity(adcHumidity);
+        PutValue(out + 2 * sensorValueSize, humidity >> 10, ((humidity & 0x3FF) * 1000 * 1000) >> 10);
+    }
+
+    sample_cnt++;
+
+    if(sample_cnt == samplesPerPacket){
+        size_t length = headerSize + channels * sensorValueSize * samplesPerPacket;
+        sample_cnt = 0;
+        tx_buf[1] = packet_cnt;
+        packet_cnt++;
+        stream.Publish(tx_buf, length);
+    }
+}
+
+void Bme280::PutValue(uint8_t *out, int32_t integer, int32_t micro){
+    memcpy(out, &integer, sizeof(integer));
+    memcpy(out + sizeof(integer), &micro, sizeof(micro));
+}
+
+int32_t Bme280::CompensateTemperature(int32_t adc){
+    int32_t var1 = (((adc >> 3) - (static_cast<int32_t>(calibration.dig_t1) << 1)) * calibration.dig_t2) >> 11;
+    int32_t var2 = (((((adc >> 4) - calibration.dig_t1) * ((adc >> 4) - calibration.dig_t1)) >> 12) *
+                    calibration.dig_t3) >> 14;
+
+    tFine = var1 + var2;
+    return (tFine * 5 + 128) >> 8;
+}
+
+uint32_t Bme280::CompensatePressure(int32_t adc){
+    int64_t var1 = static_cast<int64_t>(tFine) - 128000;
+    int64_t var2 = var1 * var1 * calibration.dig_p6;
+    var2 = var2 + ((var1 * calibration.dig_p5) << 17);
+    var2 = var2 + (static_cast<int64_t>(calibration.dig_p4) << 35);
+    var1 = ((var1 * var1 * calibration.dig_p3) >> 8) + ((var1 * calibration.dig_p2) << 12);
+    var1 = (((static_cast<int64_t>(1) << 47) + var1) * calibration.dig_p1) >> 33;
+
+    if(var1 == 0){
+        return 0;
+    }
+
+    int64_t p = 1048576 - adc;
+    p = (((p << 31) - var2) * 3125) / var1;
+    var1 = (static_cast<int64_t>(calibration.dig_p9) * (p >> 13) * (p >> 13)) >> 25;
+    var2 = (static_cast<int64_t>(calibration.dig_p8) * p) >> 19;
+    p = ((p + var1 + var2) >> 8) + (static_cast<int64_t>(calibration.dig_p7) << 4);
+
+    return static_cast<uint32_t>(p);
+}
+
+uint32_t Bme280::CompensateHumidity(int32_t adc){
+    int32_t h = tFine - 76800;
+
+    h = ((((adc << 14) - (static_cast<int32_t>(calibration.dig_h4) << 20) - (calibration.dig_h5 * h)) + 16384) >> 15) *
+        (((((((h * calibration.dig_h6) >> 10) * (((h * calibration.dig_h3) >> 11) + 32768)) >> 10) + 2097152) *
+          calibration.dig_h2 + 8192) >> 14);
+    h = h - (((((h >> 15) * (h >> 15)) >> 7) * calibration.dig_h1) >> 4);
+    h = CLAMP(h, 0, 419430400);
+
+    return static_cast<uint32_t>(h >> 12);
 }
 
 bool Bme280::BmX280IsOnI2cBus(){
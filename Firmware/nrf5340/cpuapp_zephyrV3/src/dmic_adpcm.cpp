@@ -0,0 +1,145 @@
+#if CONFIG_USE_DMIC
+
+#include "dmic_adpcm.hpp"
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "usb_comm_handler.hpp"
+
+LOG_MODULE_REGISTER(dmic_adpcm, LOG_LEVEL_INF);
+
+/**
+ * @brief Construct DmicAdpcm
+ *
+ * @param controller USB communication controller
+ */
+DmicAdpcm::DmicAdpcm(UsbCommHandler &controller) : stream(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Applies CONFIG_DMIC_AUDIO_STREAM
+ */
+void DmicAdpcm::Initialize()
+{
+    state = {};
+    packetSamples = 0;
+    sequence = 0;
+    sampleIndex = 0;
+    restartPending.store(false, std::memory_order_relaxed);
+    enabled.store(IS_ENABLED(CONFIG_DMIC_AUDIO_STREAM), std::memory_order_relaxed);
+
+    LOG_INF("IMA ADPCM %u samples per %u byte packet, audio stream %s", SamplesPerPacket, PacketSize,
+            enabled.load(std::memory_order_relaxed) ? "on" : "off");
+}
+
+/**
+ * @brief Enable or disable audio stream, applied before the next block
+ *
+ * @param enable 1 to stream audio, 0 to stop
+ * @return true if value is valid
+ */
+bool DmicAdpcm::SetEnabled(uint8_t enable)
+{
+    if (enable > 1)
+    {
+        return false;
+    }
+
+    enabled.store(enable != 0, std::memory_order_relaxed);
+
+    return true;
+}
+
+/**
+ * @brief Discard partial packet before the next block
+ */
+void DmicAdpcm::Restart()
+{
+    restartPending.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Account samples of a dropped block. Partial packet is discarded
+ *
+ * @param count number of dropped samples
+ */
+void DmicAdpcm::Skip(size_t count)
+{
+    packetSamples = 0;
+    sampleIndex += count;
+}
+
+/**
+ * @brief Encode PCM block
+ *
+ * @param samples mono 16-bit PCM samples
+ * @param count number of samples
+ */
+void DmicAdpcm::Process(const int16_t *samples, size_t count)
+{
+    uint8_t *data = packet + HeaderSize + ImaAdpcm::BlockHeaderSize;
+    bool active = enabled.load(std::memory_order_relaxed);
+
+    if (restartPending.exchange(false, std::memory_order_acquire) || !active)
+    {
+        packetSamples = 0;
+    }
+
+    if (!active)
+    {
+        sampleIndex += count;
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i, ++sampleIndex)
+    {
+        if (packetSamples == 0)
+        {
+            StartPacket(samples[i]);
+            continue;
+        }
+
+        // Nibbles of the samples after the block predictor, low nibble first
+        uint8_t nibble = ImaAdpcm::Encode(state, samples[i]);
+        size_t position = packetSamples - 1;
+
+        if (position & 1)
+        {
+            data[position / 2] |= nibble << 4;
+        }
+        else
+        {
+            data[position / 2] = nibble;
+        }
+
+        if (++packetSamples == SamplesPerPacket)
+        {
+            stream.Publish(packet, PacketSize);
+            sequence++;
+            packetSamples = 0;
+        }
+    }
+}
+
+/**
+ * @brief Start packet with sample as WAV block predictor
+ */
+void DmicAdpcm::StartPacket(int16_t sample)
+{
+    sys_put_le16(sequence, packet);
+    sys_put_le32(sampleIndex, packet + 2);
+
+    // Block predictor is the exact first sample, the step index carries over from the previous packet
+    state.predictor = sample;
+    sys_put_le16(static_cast<uint16_t>(sample), packet + HeaderSize);
+    packet[HeaderSize + 2] = state.index;
+    packet[HeaderSize + 3] = 0;
+
+    packetSamples = 1;
+}
+
+#endif // CONFIG_USE_DMIC
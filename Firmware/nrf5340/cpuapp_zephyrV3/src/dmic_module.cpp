@@ -1,3 +1,5 @@
+#if CONFIG_USE_DMIC
+
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
 #include "dmic_module.hpp"
@@ -19,7 +21,7 @@ LOG_MODULE_REGISTER(dmic, LOG_LEVEL_INF);
 */
 K_MEM_SLAB_DEFINE_STATIC(mem_slab, MAX_BLOCK_SIZE, BLOCK_COUNT, 4);
 
-DmicModule::DmicModule() {
+DmicModule::DmicModule(UsbCommHandler &controller) : spectrum(controller), adpcm(controller) {
     LOG_DBG("DmicModule Constructor!");
 }
 
@@ -72,11 +74,16 @@ int DmicModule::Initialize() {
 
     // memset((uint16_t*)mem_blocks, 0, (NUM_SAMPLES * NUM_BLOCKS));
 
-    Bluetooth::GattRegisterControlCallback(CommandId::DmicCmd,
-        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
-        {
-            return OnBleCommand(buffer, key, length, offset);
-        });
+    ret = spectrum.Initialize(MAX_SAMPLE_RATE, cfg.streams[0].block_size / BYTES_PER_SAMPLE);
+    if (ret < 0) {
+        return ret;
+    }
+    adpcm.Initialize();
+    dropped = 0;
+
+    LOG_INF("Latency at most %u ms from block end to records", (MAX_BACKLOG + 1) * CONFIG_DMIC_BLOCK_MS);
+
+    RegisterCommands(CommandId::DmicCmd);
 
     // Start working thread
     k_thread_create(&worker, pollStackAreaDmic, K_THREAD_STACK_SIZEOF(pollStackAreaDmic),
@@ -86,29 +93,10 @@ int DmicModule::Initialize() {
     return ret;    
 }
 
-bool DmicModule::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset){
-    if (offset.value != 0 || length.value == 0)
-    {
-        return false;
-    }
-    LOG_DBG("DmicModule BLE Command received");
-
-    Bluetooth::CommandKey bleCommand;
-    memcpy(&bleCommand, &key, sizeof(key));
-
-    switch(bleCommand.key[0]){
-        case static_cast<uint8_t>(BleCommand::StartSampling):
-            StartSampling();
-            break;
-        case static_cast<uint8_t>(BleCommand::StopSampling):
-            StopSampling();
-            break;
-
-        default:
-            break;
-    }
-
-    return true;
+int DmicModule::Start(){
+    int ret = Initialize();
+    LOG_DBG("%s: dmic.Initialize: %d", __func__, ret);
+    return ret;
 }
 
 int DmicModule::StartSampling(){
@@ -117,6 +105,9 @@ int DmicModule::StartSampling(){
 	if (ret < 0) {
 		LOG_ERR("START DMIC trigger failed: %d", ret);
     } else {
+        // Frames must not span the pause
+        spectrum.Restart();
+        adpcm.Restart();
         LOG_DBG("Resuming thread...");
         k_thread_resume(&worker);
     }
@@ -137,6 +128,34 @@ int DmicModule::StopSampling(){
     return ret;
 }
 
+bool DmicModule::OnCommand(uint8_t key, const uint8_t *buffer, size_t length){
+    // Every key takes one byte, length is checked by SensorModule
+    ARG_UNUSED(length);
+
+    switch(key){
+        case static_cast<uint8_t>(DmicCommand::SetSpectrumMode):
+            return spectrum.SetMode(buffer[0]);
+
+        case static_cast<uint8_t>(DmicCommand::SetAverage):
+            return spectrum.SetAverage(buffer[0]);
+
+        case static_cast<uint8_t>(DmicCommand::SetMelBands):
+            return spectrum.SetMelBands(buffer[0]);
+
+        case static_cast<uint8_t>(DmicCommand::ReportBudget):
+            spectrum.RequestReport();
+            return true;
+
+        case static_cast<uint8_t>(DmicCommand::SetAudioStream):
+            return adpcm.SetEnabled(buffer[0]);
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
 /**
  * @brief Main working thread. Used to perform I2S transport.
  * It required a separate stack to not break main BLE stack state machine
@@ -145,54 +164,36 @@ int DmicModule::StopSampling(){
  */
 void DmicModule::WorkingThreadDmic(void *data, void *, void *){
     DmicModule *self = static_cast<DmicModule *>(data);
-    int ret = 0;
-    static arm_rfft_instance_q15 RealFFT_Instance;
-    // arm_cfft_radix4_instance_q15 MyComplexFFT_Instance;
-    static volatile int16_t MicFFT[2*FFT_LENGTH];
-    static int16_t MicFFT_Mag[2*FFT_LENGTH];
-
-    // Initialize the FFT Structures
-    ret = arm_rfft_init_q15(&RealFFT_Instance,
-                    //&MyComplexFFT_Instance,
-                    FFT_LENGTH,
-                    0,
-                    1); //  Bit Reverse Flag enabled
-
-    if (ret < 0){
-        LOG_ERR("arm_rfft_init_q15: %d", ret);
-    } else {
-        LOG_DBG("arm_rfft_init_q15: SUCESS");
-    }
 
     for (;;)
     {
-        for (int i = 0; i < BLOCK_COUNT; ++i) {
-            void *buffer;
-            uint32_t size;
-
-            ret = dmic_read(self->dmic_dev, 0, &buffer, &size, READ_TIMEOUT);
-            if (ret < 0) {
-                LOG_ERR("%d - read failed: %d", i, ret);                    
-            }
-
-            // Compute FFT
-            arm_rfft_q15(&RealFFT_Instance,
-                        (q15_t *)buffer,
-                        (q15_t *)MicFFT);
-
-            // Scale the input before computing magnitude
-            for(int k = 0; k < 2*FFT_LENGTH; k++){
-                MicFFT[k]<<=6;
-            }
+        void *buffer;
+        uint32_t size;
 
-            // FFT functions returns the real/imaginary values. We need to compute the magnitude
-            arm_cmplx_mag_q15((q15_t *)MicFFT,
-                            (q15_t *)MicFFT_Mag,
-                            FFT_LENGTH);
-
-            LOG_HEXDUMP_INF(MicFFT_Mag, FFT_LENGTH, "micFFT_Mag");
+        int ret = dmic_read(self->dmic_dev, 0, &buffer, &size, READ_TIMEOUT);
+        if (ret < 0) {
+            LOG_ERR("read failed: %d", ret);
+            continue;
+        }
 
-            k_mem_slab_free(&mem_slab, &buffer);
+        // Driver holds the block being filled and the next one, this thread holds one
+        size_t used = k_mem_slab_num_used_get(&mem_slab);
+        size_t backlog = used > 3 ? used - 3 : 0;
+
+        if (backlog > MAX_BACKLOG) {
+            // Drop stale block instead of falling further behind
+            self->spectrum.Restart();
+            self->adpcm.Skip(size / BYTES_PER_SAMPLE);
+            LOG_WRN("Block dropped, %u total", ++self->dropped);
+        } else {
+            // Both consumers read the slab block in place
+            const int16_t *samples = static_cast<const int16_t *>(buffer);
+            self->adpcm.Process(samples, size / BYTES_PER_SAMPLE);
+            self->spectrum.Process(samples, size / BYTES_PER_SAMPLE);
         }
+
+        k_mem_slab_free(&mem_slab, buffer);
     }
-}
\ No newline at end of file
+}
+
+#endif // CONFIG_USE_DMIC
@@ -0,0 +1,512 @@
+#if CONFIG_USE_DMIC
+
+#include "dmic_spectrum.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+#include <zephyr/logging/log.h>
+
+#include "usb_comm_handler.hpp"
+
+LOG_MODULE_REGISTER(dmic_spectrum, LOG_LEVEL_INF);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DMIC_FFT_SIZE) && CONFIG_DMIC_FFT_SIZE >= 256 && CONFIG_DMIC_FFT_SIZE <= 1024,
+             "CONFIG_DMIC_FFT_SIZE must be 256, 512 or 1024");
+BUILD_ASSERT(CONFIG_DMIC_FFT_HOP <= CONFIG_DMIC_FFT_SIZE, "CONFIG_DMIC_FFT_HOP must not exceed CONFIG_DMIC_FFT_SIZE");
+BUILD_ASSERT(CONFIG_DMIC_MEL_BANDS == 0 || CONFIG_DMIC_MEL_BANDS >= 8, "CONFIG_DMIC_MEL_BANDS must be 0 or 8 - 64");
+
+namespace
+{
+    constexpr static double pi = 3.14159265358979;
+    constexpr static float fullScale = 32768.0f; ///< PCM full scale
+    constexpr static float dbFloor = -120.0f;    ///< dBFS of record value 0
+    constexpr static float minPower = 1e-12f;    ///< Power of dbFloor
+    constexpr static size_t minMelBands = 8;     ///< Minimum number of mel bands
+
+    /**
+     * @brief Frequency to mel, HTK formula
+     */
+    double HzToMel(double hz)
+    {
+        return 2595.0 * log10(1.0 + hz / 700.0);
+    }
+
+    /**
+     * @brief Mel to frequency, HTK formula
+     */
+    double MelToHz(double mel)
+    {
+        return 700.0 * (pow(10.0, mel / 2595.0) - 1.0);
+    }
+}
+
+/**
+ * @brief Construct DmicSpectrum
+ *
+ * @param controller USB communication controller
+ */
+DmicSpectrum::DmicSpectrum(UsbCommHandler &controller) : stream(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Applies Kconfig defaults
+ *
+ * @param rate PCM sample rate, Hz
+ * @param samples samples in one DMIC block
+ * @return Status, 0 for no errors
+ */
+int DmicSpectrum::Initialize(uint32_t rate, size_t samples)
+{
+    Settings initial;
+
+    sampleRate = rate;
+    blockSamples = samples;
+    counter = 0;
+    memset(&budget, 0, sizeof(budget));
+    reportSamples = CONFIG_DMIC_BUDGET_REPORT_INTERVAL * rate;
+    reportPending.store(false, std::memory_order_relaxed);
+
+    if (arm_rfft_fast_init_f32(&fft, FftSize) != ARM_MATH_SUCCESS)
+    {
+        LOG_ERR("%s: ***ERROR: FFT size %u not supported", __func__, FftSize);
+        return -EINVAL;
+    }
+
+    // Periodic Hann window
+    double sumSquares = 0.0;
+    for (size_t n = 0; n < FftSize; ++n)
+    {
+        window[n] = static_cast<float>(0.5 - 0.5 * cos(2.0 * pi * n / FftSize));
+        sumSquares += window[n] * window[n];
+    }
+
+    // Sum of 2 |X|^2 / (N * sum(w^2)) over one-sided bins is the mean square of the frame
+    binScale = static_cast<float>(2.0 / (FftSize * sumSquares));
+
+    timing_init();
+    timing_start();
+
+    initial.mode = static_cast<DmicSpectrumMode>(CONFIG_DMIC_SPECTRUM_MODE);
+    initial.average = CONFIG_DMIC_SPECTRUM_AVERAGE;
+    initial.melBands = CONFIG_DMIC_MEL_BANDS;
+
+    SetPending(initial);
+    ApplyPending();
+
+    LOG_INF("%u-point FFT (%u ms), hop %u (%u us), %u ms blocks", FftSize, FftSize * 1000 / sampleRate, Hop,
+            Hop * 1000000 / sampleRate, blockSamples * 1000 / sampleRate);
+
+    return 0;
+}
+
+/**
+ * @brief Read pending settings for modification
+ */
+DmicSpectrum::Settings DmicSpectrum::GetPending()
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+    Settings requested = pendingSettings;
+    k_spin_unlock(&pendingLock, key);
+
+    return requested;
+}
+
+/**
+ * @brief Store settings to be applied before the next block
+ */
+void DmicSpectrum::SetPending(const Settings &requested)
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    pendingSettings = requested;
+    reloadPending.store(true, std::memory_order_release);
+
+    k_spin_unlock(&pendingLock, key);
+}
+
+/**
+ * @brief Drop the sliding window and accumulated frames. Next frame starts with the next block
+ */
+void DmicSpectrum::Restart()
+{
+    SetPending(GetPending());
+}
+
+/**
+ * @brief Set output, applied before the next block
+ *
+ * @param mode DmicSpectrumMode value
+ * @return true if mode is valid
+ */
+bool DmicSpectrum::SetMode(uint8_t mode)
+{
+    if (mode > static_cast<uint8_t>(DmicSpectrumMode::Level))
+    {
+        return false;
+    }
+
+    Settings requested = GetPending();
+    requested.mode = static_cast<DmicSpectrumMode>(mode);
+    SetPending(requested);
+
+    return true;
+}
+
+/**
+ * @brief Set number of frames averaged into one record, applied before the next block
+ *
+ * @param count 1 - MaxAverage
+ * @return true if number of frames is valid
+ */
+bool DmicSpectrum::SetAverage(uint8_t count)
+{
+    if (count == 0 || count > MaxAverage)
+    {
+        return false;
+    }
+
+    Settings requested = GetPending();
+    requested.average = count;
+    SetPending(requested);
+
+    return true;
+}
+
+/**
+ * @brief Set number of mel bands, applied before the next block
+ *
+ * @param bands 0 for linear spectrum, otherwise 8 - MaxMelBands
+ * @return true if number of bands is valid
+ */
+bool DmicSpectrum::SetMelBands(uint8_t bands)
+{
+    if (bands != 0 && (bands < minMelBands || bands > MaxMelBands))
+    {
+        return false;
+    }
+
+    Settings requested = GetPending();
+    requested.melBands = bands;
+    SetPending(requested);
+
+    return true;
+}
+
+/**
+ * @brief Log cycle budget after the next block
+ */
+void DmicSpectrum::RequestReport()
+{
+    reportPending.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Apply pending settings. Restarts the window and accumulation
+ */
+void DmicSpectrum::ApplyPending()
+{
+    k_spinlock_key_t key = k_spin_lock(&pendingLock);
+
+    settings = pendingSettings;
+    reloadPending.store(false, std::memory_order_relaxed);
+
+    k_spin_unlock(&pendingLock, key);
+
+    if (settings.mode == DmicSpectrumMode::Level)
+    {
+        bandCount = 2;
+    }
+    else if (settings.melBands != 0)
+    {
+        bandCount = settings.melBands;
+        DesignMelBands();
+    }
+    else
+    {
+        bandCount = LinearBands;
+    }
+
+    filled = 0;
+    frames = 0;
+    memset(power, 0, sizeof(power));
+    levelSum = 0;
+    levelSquares = 0;
+    levelSamples = 0;
+    levelPeak = 0;
+
+    LOG_INF("Mode %u, %u values, %u frames per record", static_cast<uint8_t>(settings.mode), bandCount,
+            settings.average);
+}
+
+/**
+ * @brief Map FFT bins to mel bands. Band b rises from mel point b to b + 1 and falls to b + 2, points are evenly
+ *        spaced in mel from 0 Hz to Nyquist frequency and triangles are linear in Hz, like librosa with htk=True
+ */
+void DmicSpectrum::DesignMelBands()
+{
+    double melStep = HzToMel(sampleRate / 2.0) / (settings.melBands + 1);
+
+    for (size_t k = 0; k < Bins; ++k)
+    {
+        double hz = static_cast<double>(k) * sampleRate / FftSize;
+        size_t point = static_cast<size_t>(HzToMel(hz) / melStep);
+
+        if (point > settings.melBands)
+        {
+            binBand[k] = noBand;
+            continue;
+        }
+
+        double low = MelToHz(point * melStep);
+        double high = MelToHz((point + 1) * melStep);
+
+        binBand[k] = point;
+        binWeight[k] = static_cast<float>(CLAMP((hz - low) / (high - low), 0.0, 1.0));
+    }
+}
+
+/**
+ * @brief Process PCM block
+ *
+ * @param samples mono 16-bit PCM samples
+ * @param count number of samples
+ */
+void DmicSpectrum::Process(const int16_t *samples, size_t count)
+{
+    timing_t start = timing_counter_get();
+
+    if (reloadPending.load(std::memory_order_acquire))
+    {
+        ApplyPending();
+    }
+
+    switch (settings.mode)
+    {
+    case DmicSpectrumMode::Spectrum:
+        AppendSpectrum(samples, count);
+        break;
+
+    case DmicSpectrumMode::Level:
+        AppendLevel(samples, count);
+        break;
+
+    case DmicSpectrumMode::Off:
+    default:
+        break;
+    }
+
+    timing_t end = timing_counter_get();
+    uint32_t cycles = timing_cycles_get(&start, &end);
+
+    budget.busyCycles += cycles;
+    budget.maxBlockCycles = MAX(budget.maxBlockCycles, cycles);
+    budget.samples += count;
+
+    if (reportPending.exchange(false, std::memory_order_relaxed) ||
+        (reportSamples != 0 && budget.samples >= reportSamples))
+    {
+        Report();
+    }
+}
+
+/**
+ * @brief Append samples to the sliding window, computing frames on the way
+ */
+void DmicSpectrum::AppendSpectrum(const int16_t *samples, size_t count)
+{
+    while (count > 0)
+    {
+        size_t n = MIN(count, FftSize - filled);
+
+        arm_q15_to_float(samples, frame + filled, n);
+        filled += n;
+        samples += n;
+        count -= n;
+
+        if (filled < FftSize)
+        {
+            break;
+        }
+
+        timing_t start = timing_counter_get();
+        Frame();
+        timing_t end = timing_counter_get();
+        uint32_t cycles = timing_cycles_get(&start, &end);
+
+        budget.frameCycles += cycles;
+        budget.maxFrameCycles = MAX(budget.maxFrameCycles, cycles);
+        budget.frames++;
+
+        // Keep the last FftSize - Hop samples for the next frame
+        memmove(frame, frame + Hop, (FftSize - Hop) * sizeof(float));
+        filled = FftSize - Hop;
+    }
+}
+
+/**
+ * @brief Accumulate level of samples, sending a record every average times Hop samples
+ */
+void DmicSpectrum::AppendLevel(const int16_t *samples, size_t count)
+{
+    uint32_t recordSamples = settings.average * Hop;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        int32_t sample = samples[i];
+        uint16_t magnitude = sample < 0 ? -sample : sample;
+
+        levelSum += sample;
+        levelSquares += sample * sample;
+        levelPeak = MAX(levelPeak, magnitude);
+
+        if (++levelSamples >= recordSamples)
+        {
+            Record();
+        }
+    }
+}
+
+/**
+ * @brief Transform the window and add band powers to accumulators
+ */
+void DmicSpectrum::Frame()
+{
+    float mean;
+
+    arm_mean_f32(frame, FftSize, &mean);
+    arm_offset_f32(frame, -mean, fftInput, FftSize);
+    arm_mult_f32(fftInput, window, fftInput, FftSize);
+    arm_rfft_fast_f32(&fft, fftInput, fftOutput, 0);
+
+    // Packed output: real DC and Nyquist bins, then complex bins 1 .. N/2 - 1
+    binPower[0] = fftOutput[0] * fftOutput[0] * binScale / 2;
+    binPower[Bins - 1] = fftOutput[1] * fftOutput[1] * binScale / 2;
+    arm_cmplx_mag_squared_f32(fftOutput + 2, binPower + 1, FftSize / 2 - 1);
+    arm_scale_f32(binPower + 1, binScale, binPower + 1, FftSize / 2 - 1);
+
+    if (settings.melBands != 0)
+    {
+        for (size_t k = 0; k < Bins; ++k)
+        {
+            uint8_t band = binBand[k];
+
+            if (band == noBand)
+            {
+                continue;
+            }
+            if (band < settings.melBands)
+            {
+                power[band] += binWeight[k] * binPower[k];
+            }
+            if (band > 0)
+            {
+                power[band - 1] += (1.0f - binWeight[k]) * binPower[k];
+            }
+        }
+    }
+    else
+    {
+        constexpr size_t binsPerBand = (FftSize / 2) / LinearBands;
+
+        for (size_t b = 0; b < LinearBands; ++b)
+        {
+            float sum = 0.0f;
+            for (size_t k = b * binsPerBand; k < (b + 1) * binsPerBand; ++k)
+            {
+                sum += binPower[k];
+            }
+            power[b] += sum;
+        }
+    }
+
+    if (++frames >= settings.average)
+    {
+        Record();
+    }
+}
+
+/**
+ * @brief Send averaged band powers or levels and clear accumulators
+ */
+void DmicSpectrum::Record()
+{
+    uint8_t record[headerSize + (MaxMelBands > LinearBands ? MaxMelBands : LinearBands)];
+    uint8_t *out = record + headerSize;
+
+    record[1] = counter++;
+    record[2] = bandCount;
+
+    if (settings.mode == DmicSpectrumMode::Level)
+    {
+        double mean = static_cast<double>(levelSum) / levelSamples;
+        double meanSquare = static_cast<double>(levelSquares) / levelSamples - mean * mean;
+        float peak = levelPeak / fullScale;
+
+        record[0] = static_cast<uint8_t>(DmicRecord::Level);
+        record[3] = levelSamples / Hop;
+        *out++ = Encode(static_cast<float>(meanSquare / (fullScale * fullScale)));
+        *out++ = Encode(peak * peak);
+
+        levelSum = 0;
+        levelSquares = 0;
+        levelSamples = 0;
+        levelPeak = 0;
+    }
+    else
+    {
+        record[0] = static_cast<uint8_t>(settings.melBands != 0 ? DmicRecord::MelSpectrum : DmicRecord::LinearSpectrum);
+        record[3] = frames;
+
+        for (size_t b = 0; b < bandCount; ++b)
+        {
+            *out++ = Encode(power[b] / frames);
+        }
+
+        frames = 0;
+        memset(power, 0, sizeof(power));
+    }
+
+    stream.Publish(record, out - record);
+}
+
+/**
+ * @brief Log cycle budget and clear counters
+ */
+void DmicSpectrum::Report()
+{
+    uint64_t frequency = timing_freq_get();
+    uint64_t audioCycles = budget.samples * frequency / sampleRate;
+    uint32_t load = audioCycles != 0 ? budget.busyCycles * 10000 / audioCycles : 0;
+    uint32_t hopBudget = Hop * frequency / sampleRate;
+    uint32_t blockBudget = blockSamples * frequency / sampleRate;
+    uint32_t frameAverage = budget.frames != 0 ? budget.frameCycles / budget.frames : 0;
+
+    LOG_INF("%u frames: %u cycles average, %u max, %u per hop", budget.frames, frameAverage,
+            budget.maxFrameCycles, hopBudget);
+    LOG_INF("Load %u.%02u%% of application core, longest block %u of %u cycles", load / 100, load % 100,
+            budget.maxBlockCycles, blockBudget);
+
+    memset(&budget, 0, sizeof(budget));
+}
+
+/**
+ * @brief Convert power relative to full scale to record value
+ */
+uint8_t DmicSpectrum::Encode(float power)
+{
+    if (!(power > minPower))
+    {
+        return 0;
+    }
+
+    float value = 2.0f * (10.0f * log10f(power) - dbFloor);
+
+    return value >= UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(value + 0.5f);
+}
+
+#endif // CONFIG_USE_DMIC
@@ -0,0 +1,652 @@
+#if CONFIG_USE_EVENT_CAPTURE
+
+#include "event_capture.hpp"
+
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "usb_comm_handler.hpp"
+
+LOG_MODULE_REGISTER(event_capture, LOG_LEVEL_INF);
+
+#define USER_NODE DT_PATH(zephyr_user)
+
+namespace
+{
+    const char *const triggerNames[] = {"None", "GPIO", "Command", "Threshold"};
+
+#if DT_NODE_HAS_PROP(USER_NODE, capture_trigger_gpios)
+    const gpio_dt_spec triggerPin = GPIO_DT_SPEC_GET(USER_NODE, capture_trigger_gpios); ///< Trigger input
+#endif
+}
+
+/**
+ * @brief Construct EventCapture
+ *
+ * @param controller USB communication controller
+ */
+EventCapture::EventCapture(UsbCommHandler &controller)
+    : eventStream(controller), ads0Stream(controller), ads1Stream(controller), imuStream(controller)
+{
+    for (size_t device = 0; device < MaxDevices; ++device)
+    {
+        sources[device].slots = adsSlots[device];
+        sources[device].capacity = CONFIG_EVENT_CAPTURE_ADS_PACKETS;
+    }
+
+    sources[imuSource].slots = imuSlots;
+    sources[imuSource].capacity = CONFIG_EVENT_CAPTURE_IMU_PACKETS;
+}
+
+/**
+ * @brief Initialization function. Registers BLE command handler and configures trigger pin
+ *
+ * @param rate ADC sample rate, Hz
+ */
+void EventCapture::Initialize(uint32_t rate)
+{
+    sampleRate = rate;
+
+    threshold.store(0, std::memory_order_relaxed);
+    thresholdDevice.store(0, std::memory_order_relaxed);
+    thresholdChannel.store(0, std::memory_order_relaxed);
+
+    // Data ready interrupts could already run
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    for (size_t device = 0; device < MaxDevices; ++device)
+    {
+        ready[device] = 0;
+        latched[device] = 0;
+        blockFirst[device] = 0;
+    }
+    missed = 0;
+    counter = 0;
+    Clear();
+    k_spin_unlock(&lock, key);
+
+    SetWindow(CONFIG_EVENT_CAPTURE_PRE_MS, CONFIG_EVENT_CAPTURE_POST_MS);
+
+    k_work_init_delayable(&sendWork, &EventCapture::SendWorkHandler);
+
+    Bluetooth::GattRegisterControlCallback(CommandId::CaptureCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+
+#if DT_NODE_HAS_PROP(USER_NODE, capture_trigger_gpios)
+    int ret = -ENODEV;
+    if (gpio_is_ready_dt(&triggerPin))
+    {
+        ret = gpio_pin_configure_dt(&triggerPin, GPIO_INPUT);
+        ret += gpio_pin_interrupt_configure_dt(&triggerPin, GPIO_INT_EDGE_TO_ACTIVE);
+        gpio_init_callback(&triggerCallback, &EventCapture::TriggerHandler, BIT(triggerPin.pin));
+        ret += gpio_add_callback(triggerPin.port, &triggerCallback);
+    }
+    if (ret != 0)
+    {
+        LOG_ERR("Trigger pin configuration failed: %d", ret);
+    }
+#endif
+
+    SetEnabled(IS_ENABLED(CONFIG_EVENT_CAPTURE_ARMED_AT_BOOT));
+
+    LOG_INF("%u ms pre, %u ms post, %u ADS131M08 and %u MPU6050 packets per ring", preMs, postMs,
+            CONFIG_EVENT_CAPTURE_ADS_PACKETS, CONFIG_EVENT_CAPTURE_IMU_PACKETS);
+}
+
+/**
+ * @brief Count data ready edge of ADS131M08 device
+ *
+ * @param device device index, less than MaxDevices
+ */
+void EventCapture::OnDataReady(size_t device)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    ++ready[device];
+    readyStamp[device] = k_cycle_get_32();
+    k_spin_unlock(&lock, key);
+}
+
+/**
+ * @brief Latch number of the oldest ADC frame still in the ADC FIFO
+ *
+ * @param device device index, less than MaxDevices
+ * @return number of frames to read, 0 to AdcFifoDepth
+ */
+size_t EventCapture::LatchFrame(size_t device)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    uint32_t pending = ready[device] - latched[device];
+
+    // Older conversions were overwritten in the FIFO, their numbers are skipped
+    if (pending > AdcFifoDepth)
+    {
+        latched[device] = ready[device] - AdcFifoDepth;
+        pending = AdcFifoDepth;
+    }
+    k_spin_unlock(&lock, key);
+
+    return pending;
+}
+
+/**
+ * @brief Count ADC frame and check threshold trigger
+ *
+ * @param device device index, less than MaxDevices
+ * @param input per channel samples of the current block, scaled by 2^Ads131Pipeline::SampleShift
+ * @param index index of the frame in the block
+ */
+void EventCapture::OnFrame(size_t device, const q31_t (&input)[Ads131Pipeline::Channels][Ads131Pipeline::MaxBlockFrames],
+                           size_t index)
+{
+    if (index == 0)
+    {
+        blockFirst[device] = latched[device];
+    }
+
+    uint32_t frame = latched[device]++;
+    int32_t level = threshold.load(std::memory_order_acquire);
+
+    if (level == 0 || device != thresholdDevice.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    int32_t code = input[thresholdChannel.load(std::memory_order_relaxed)][index] >> Ads131Pipeline::SampleShift;
+    bool reached = level > 0 ? code >= level : code <= level;
+
+    // Only the crossing triggers, so a channel held past the threshold doesn't retrigger after every burst
+    if (reached && !thresholdReached)
+    {
+        k_spinlock_key_t key = k_spin_lock(&lock);
+        Fire(CaptureTrigger::Threshold, device, frame);
+        k_spin_unlock(&lock, key);
+    }
+    thresholdReached = reached;
+}
+
+/**
+ * @brief Keep ADS131M08 packet while capture mode is enabled
+ *
+ * @param device device index, less than MaxDevices
+ * @param packet packet data. Data is copied before function returns
+ * @param length packet length
+ * @param frames ADC frames in packet
+ * @return true if packet is held or dropped, false if it should be published
+ */
+bool EventCapture::HoldAds(size_t device, const uint8_t *packet, size_t length, size_t frames)
+{
+    // Called after the last frame of the packet was pushed
+    return Hold(device, packet, length, blockFirst[device], latched[device], frames);
+}
+
+/**
+ * @brief Keep MPU6050 packet while capture mode is enabled
+ *
+ * @param packet packet data. Data is copied before function returns
+ * @param length packet length
+ * @return true if packet is held or dropped, false if it should be published
+ */
+bool EventCapture::HoldImu(const uint8_t *packet, size_t length)
+{
+    return Hold(imuSource, packet, length, 0, 0, 0);
+}
+
+/**
+ * @brief Trigger capture
+ *
+ * @param source trigger source
+ * @return true if trigger starts an event
+ */
+bool EventCapture::Trigger(CaptureTrigger source)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool started = Fire(source, MaxDevices, 0);
+    k_spin_unlock(&lock, key);
+
+    return started;
+}
+
+/**
+ * @brief Start event if capture is armed. Lock must be held
+ *
+ * @param source trigger source
+ * @param device device of the threshold trigger, MaxDevices for other sources
+ * @param frame ADC frame of the threshold trigger
+ * @return true if event is started
+ */
+bool EventCapture::Fire(CaptureTrigger source, size_t device, uint32_t frame)
+{
+    if (state != State::Armed)
+    {
+        if (state != State::Off && missed < UINT8_MAX)
+        {
+            ++missed;
+        }
+        return false;
+    }
+
+    uint32_t now = k_cycle_get_32();
+
+    for (size_t i = 0; i < MaxDevices; ++i)
+    {
+        if (i == device)
+        {
+            triggers[i] = {frame, 0};
+        }
+        else if (ready[i] == 0)
+        {
+            triggers[i] = {0, 0};
+        }
+        else
+        {
+            // The newest frame was converted before the trigger, the offset places the trigger inside its period
+            uint32_t offset = k_cyc_to_us_floor32(now - readyStamp[i]);
+            triggers[i] = {ready[i] - 1, static_cast<uint16_t>(MIN(offset, UINT16_MAX))};
+        }
+    }
+
+    for (Source &src : sources)
+    {
+        src.active = src.count != 0;
+        src.done = false;
+        src.afterTrigger = 0;
+    }
+
+    triggerSource = source;
+    triggerTime = k_uptime_get_32();
+    eventPreMs = preMs;
+    eventPostMs = postMs;
+    state = State::Collecting;
+
+    // Ends collection even if a source stops sending packets
+    k_work_reschedule(&sendWork, K_MSEC(eventPostMs + deadlineMs));
+
+    return true;
+}
+
+/**
+ * @brief Write packet to ring of source
+ *
+ * @param index source index
+ * @param packet packet data
+ * @param length packet length
+ * @param frame first ADC frame of ADS131M08 packet
+ * @param end ADC frame after the last one of ADS131M08 packet
+ * @param frames ADC frames in ADS131M08 packet, 0 for MPU6050
+ * @return true if packet is held or dropped, false if it should be published
+ */
+bool EventCapture::Hold(size_t index, const uint8_t *packet, size_t length, uint32_t frame, uint32_t end,
+                        uint32_t frames)
+{
+    bool complete = false;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (state == State::Off || length > maxPacketSize)
+    {
+        k_spin_unlock(&lock, key);
+        return false;
+    }
+
+    Source &src = sources[index];
+
+    if (state == State::Sending || (state == State::Collecting && src.done))
+    {
+        k_spin_unlock(&lock, key);
+        return true;
+    }
+
+    Slot &slot = src.slots[src.head];
+    slot.time = k_uptime_get_32();
+    slot.frame = frame;
+    slot.end = end;
+    slot.length = length;
+    memcpy(slot.data, packet, length);
+
+    src.frames = frames;
+    src.head = (src.head + 1) % src.capacity;
+    src.count = MIN(src.count + 1, src.capacity);
+
+    if (state == State::Collecting)
+    {
+        // A post window longer than the ring ends early rather than overwriting the trigger
+        if (++src.afterTrigger == src.capacity || PastWindow(index, slot))
+        {
+            src.done = true;
+        }
+
+        bool any = false;
+        complete = true;
+        for (const Source &other : sources)
+        {
+            any |= other.active;
+            complete &= !other.active || other.done;
+        }
+        complete &= any;
+    }
+
+    k_spin_unlock(&lock, key);
+
+    if (complete)
+    {
+        k_work_reschedule(&sendWork, K_NO_WAIT);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check if slot ends after the post-trigger window of source
+ */
+bool EventCapture::PastWindow(size_t index, const Slot &slot) const
+{
+    if (index == imuSource)
+    {
+        return static_cast<int32_t>(slot.time - (triggerTime + eventPostMs)) >= 0;
+    }
+
+    uint32_t end = triggers[index].frame + eventPostMs * sampleRate / 1000;
+    return static_cast<int32_t>(slot.end - end) >= 0;
+}
+
+/**
+ * @brief Check if slot ends after the start of the pre-trigger window of source
+ */
+bool EventCapture::InWindow(size_t index, const Slot &slot) const
+{
+    if (index == imuSource)
+    {
+        return static_cast<int32_t>(slot.time - (triggerTime - eventPreMs)) > 0;
+    }
+
+    uint32_t start = triggers[index].frame - eventPreMs * sampleRate / 1000;
+    return static_cast<int32_t>(slot.end - start) > 0;
+}
+
+/**
+ * @brief Select burst packets of every source and build event record. Lock must be held
+ */
+void EventCapture::PrepareBurst()
+{
+    uint8_t decimation = 0;
+
+    for (size_t index = 0; index < sourceCount; ++index)
+    {
+        Source &src = sources[index];
+        size_t age = src.count;
+
+        // Slots get newer towards the head, so the burst starts at the oldest slot in the window
+        while (age > 0 && !InWindow(index, src.slots[(src.head + src.capacity - age) % src.capacity]))
+        {
+            --age;
+        }
+        src.first = age;
+        src.packets = age;
+
+        if (index != imuSource && decimation == 0)
+        {
+            decimation = src.frames / Ads131Pipeline::SamplesPerPacket;
+        }
+    }
+
+    record[0] = counter++;
+    record[1] = static_cast<uint8_t>(triggerSource);
+    record[2] = decimation;
+    record[3] = missed;
+    sys_put_le32(triggerTime, record + 4);
+    sys_put_le16(eventPreMs, record + 8);
+    sys_put_le16(eventPostMs, record + 10);
+    missed = 0;
+
+    uint8_t *out = record + 12;
+    for (size_t device = 0; device < MaxDevices; ++device)
+    {
+        const Source &src = sources[device];
+        uint32_t first = 0;
+
+        if (src.packets != 0)
+        {
+            first = src.slots[(src.head + src.capacity - src.first) % src.capacity].frame;
+            uint32_t start = triggers[device].frame - eventPreMs * sampleRate / 1000;
+            if (static_cast<int32_t>(first - start) > 0)
+            {
+                LOG_WRN("Device %u pre-trigger window cut by %u frames", device, first - start);
+            }
+        }
+
+        sys_put_le32(triggers[device].frame, out);
+        sys_put_le16(triggers[device].offset, out + 4);
+        sys_put_le32(first, out + 6);
+        out[10] = src.packets;
+        out += 11;
+    }
+    out[0] = sources[imuSource].packets;
+
+    LOG_INF("Event %u: %s trigger, %u + %u + %u packets", record[0], triggerNames[record[1]],
+            sources[0].packets, sources[1].packets, sources[imuSource].packets);
+}
+
+/**
+ * @brief Clear every ring. Lock must be held
+ */
+void EventCapture::Clear()
+{
+    for (Source &src : sources)
+    {
+        src.head = 0;
+        src.count = 0;
+        src.afterTrigger = 0;
+        src.first = 0;
+        src.packets = 0;
+        src.active = false;
+        src.done = false;
+    }
+}
+
+/**
+ * @brief Send event record or the next burst packet, re-arm when the burst is complete
+ */
+void EventCapture::SendNext()
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (state == State::Collecting)
+    {
+        state = State::Sending;
+        PrepareBurst();
+        recordPending = true;
+        sendSource = 0;
+        sendPosition = 0;
+    }
+
+    if (state != State::Sending)
+    {
+        k_spin_unlock(&lock, key);
+        return;
+    }
+
+    if (recordPending)
+    {
+        recordPending = false;
+        k_spin_unlock(&lock, key);
+
+        eventStream.Publish(record, recordSize);
+        k_work_reschedule(&sendWork, K_MSEC(CONFIG_EVENT_CAPTURE_BURST_INTERVAL_MS));
+        return;
+    }
+
+    while (sendSource < sourceCount && sendPosition >= sources[sendSource].packets)
+    {
+        ++sendSource;
+        sendPosition = 0;
+    }
+
+    if (sendSource == sourceCount)
+    {
+        Clear();
+        state = enabled ? State::Armed : State::Off;
+        k_spin_unlock(&lock, key);
+        return;
+    }
+
+    const Source &src = sources[sendSource];
+    const Slot &slot = src.slots[(src.head + src.capacity - src.first + sendPosition) % src.capacity];
+    size_t index = sendSource;
+    size_t length = slot.length;
+
+    memcpy(burst, slot.data, length);
+    ++sendPosition;
+    k_spin_unlock(&lock, key);
+
+    Publish(index, burst, length);
+    k_work_reschedule(&sendWork, K_MSEC(CONFIG_EVENT_CAPTURE_BURST_INTERVAL_MS));
+}
+
+/**
+ * @brief Publish packet through the stream of source
+ */
+void EventCapture::Publish(size_t index, const uint8_t *packet, size_t length)
+{
+    switch (index)
+    {
+    case 0:
+        ads0Stream.Publish(packet, length);
+        break;
+    case 1:
+        ads1Stream.Publish(packet, length);
+        break;
+    default:
+        imuStream.Publish(packet, length);
+        break;
+    }
+}
+
+/**
+ * @brief Enable or disable capture mode. An event in progress is finished first
+ */
+void EventCapture::SetEnabled(bool enable)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    enabled = enable;
+    if (enable && state == State::Off)
+    {
+        Clear();
+        missed = 0;
+        state = State::Armed;
+    }
+    else if (!enable && state == State::Armed)
+    {
+        Clear();
+        state = State::Off;
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+/**
+ * @brief Set pre- and post-trigger windows. Used by the next trigger
+ */
+void EventCapture::SetWindow(uint16_t pre, uint16_t post)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    preMs = pre;
+    postMs = post;
+    k_spin_unlock(&lock, key);
+
+    // One more packet covers a window that doesn't start on a packet boundary
+    uint32_t packets = DIV_ROUND_UP((pre + post) * CONFIG_ADS131_OUTPUT_RATE,
+                                   1000 * Ads131Pipeline::SamplesPerPacket) + 1;
+    if (packets > CONFIG_EVENT_CAPTURE_ADS_PACKETS)
+    {
+        LOG_WRN("Windows need %u ADS131M08 packets, rings hold %u", packets, CONFIG_EVENT_CAPTURE_ADS_PACKETS);
+    }
+}
+
+/**
+ * @brief Called when capture command is received via BLE
+ *
+ * @param buffer receviced buffer
+ * @param key command key
+ * @param length buffer length
+ * @param offset data offset
+ *
+ * @return true if command was processed succesfully
+ */
+bool EventCapture::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    if (offset.value != 0)
+    {
+        return false;
+    }
+
+    switch (static_cast<CaptureCommand>(key.key[0]))
+    {
+    case CaptureCommand::SetEnabled:
+        if (length.value < 1 || buffer[0] > 1)
+        {
+            return false;
+        }
+        SetEnabled(buffer[0] != 0);
+        break;
+
+    case CaptureCommand::SetWindow:
+        if (length.value < 4 || sys_get_le16(buffer + 2) == 0)
+        {
+            return false;
+        }
+        SetWindow(sys_get_le16(buffer), sys_get_le16(buffer + 2));
+        break;
+
+    case CaptureCommand::Trigger:
+        return Trigger(CaptureTrigger::Command);
+
+    case CaptureCommand::SetThreshold:
+        if (length.value < 6 || buffer[0] >= MaxDevices || buffer[1] >= Ads131Pipeline::Channels)
+        {
+            return false;
+        }
+        // Threshold goes last, so the frame check never sees a new level with the old channel
+        threshold.store(0, std::memory_order_relaxed);
+        thresholdDevice.store(buffer[0], std::memory_order_relaxed);
+        thresholdChannel.store(buffer[1], std::memory_order_relaxed);
+        threshold.store(static_cast<int32_t>(sys_get_le32(buffer + 2)), std::memory_order_release);
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Burst work handler
+ *
+ * @param work worker
+ */
+void EventCapture::SendWorkHandler(k_work *work)
+{
+    k_work_delayable *delayable = k_work_delayable_from_work(work);
+    EventCapture *self = CONTAINER_OF(delayable, EventCapture, sendWork);
+
+    self->SendNext();
+}
+
+/**
+ * @brief Trigger pin interrupt handler
+ */
+void EventCapture::TriggerHandler(const device *port, gpio_callback *callback, gpio_port_pins_t pins)
+{
+    ARG_UNUSED(port);
+    ARG_UNUSED(pins);
+
+    CONTAINER_OF(callback, EventCapture, triggerCallback)->Trigger(CaptureTrigger::Gpio);
+}
+
+#endif // CONFIG_USE_EVENT_CAPTURE
@@ -0,0 +1,573 @@
+#if CONFIG_USE_FEEDBACK
+
+#include "feedback_engine.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "ble_service.hpp"
+#if CONFIG_USE_I2S
+#include "audio_module.hpp"
+#endif
+#if CONFIG_USE_TLC5940
+#include "tlc5940.hpp"
+#endif
+
+LOG_MODULE_REGISTER(feedback, LOG_LEVEL_INF);
+
+namespace
+{
+    const char *const sourceNames[] = {"None", "Band power", "Relative power", "Amplitude", "Heart rate"};
+
+    /**
+     * @brief Read f32 LE
+     */
+    float GetFloat(const uint8_t *buffer)
+    {
+        uint32_t bits = sys_get_le32(buffer);
+        float value;
+
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+}
+
+/**
+ * @brief Construct FeedbackEngine
+ */
+FeedbackEngine::FeedbackEngine()
+{
+}
+
+/**
+ * @brief Initialization function. Registers BLE command handler
+ */
+void FeedbackEngine::Initialize()
+{
+    for (size_t i = 0; i < MaxRules; ++i)
+    {
+        rules[i] = {};
+    }
+
+    enabled.store(true, std::memory_order_relaxed);
+    sourceMask.store(0, std::memory_order_relaxed);
+
+    Bluetooth::GattRegisterControlCallback(CommandId::FeedbackCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+
+    LOG_INF("%u rules", MaxRules);
+}
+
+#if CONFIG_USE_I2S
+/**
+ * @brief Set audio module that plays the feedback tone
+ *
+ * @param module audio module, nullptr ignores audio targets
+ */
+void FeedbackEngine::SetAudio(AudioModule *module)
+{
+    audio = module;
+}
+#endif
+
+#if CONFIG_USE_TLC5940
+/**
+ * @brief Set LED driver
+ *
+ * @param driver TLC5940 driver, nullptr ignores LED targets
+ */
+void FeedbackEngine::SetLeds(Tlc5940 *driver)
+{
+    leds = driver;
+}
+#endif
+
+/**
+ * @brief Evaluate every rule that select accepts and drive changed outputs
+ *
+ * @param select returns true and the feature for rules that follow the fed feature
+ * @param stamp cycle counter of the newest sample of the feature
+ */
+template <typename Select>
+void FeedbackEngine::Feed(Select select, uint32_t stamp)
+{
+    if (!enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < MaxRules; ++i)
+    {
+        FeedbackSource source;
+        FeedbackTarget target;
+        uint8_t output;
+        uint16_t value;
+        float feature;
+        bool changed = false;
+
+        k_spinlock_key_t lockKey = k_spin_lock(&lock);
+        Rule &rule = rules[i];
+        if (rule.source != FeedbackSource::None && select(rule, feature))
+        {
+            changed = Evaluate(rule, feature, value);
+            source = rule.source;
+            target = rule.target;
+            output = rule.output;
+        }
+        k_spin_unlock(&lock, lockKey);
+
+        if (changed)
+        {
+            Drive(target, output, value, stamp);
+            decision[static_cast<uint8_t>(source)].Add(stamp);
+        }
+    }
+}
+
+/**
+ * @brief Feed band powers of one channel from a Welch segment
+ *
+ * @param device ADS131M08 device index
+ * @param channel channel index
+ * @param power power of every band, ADC codes squared
+ * @param bands number of bands
+ * @param stamp cycle counter when the newest sample of the segment arrived
+ */
+void FeedbackEngine::OnBandPower(size_t device, size_t channel, const float *power, size_t bands, uint32_t stamp)
+{
+    float total = 0.0f;
+
+    for (size_t b = 0; b < bands; ++b)
+    {
+        total += power[b];
+    }
+
+    Feed(
+        [&](const Rule &rule, float &value)
+        {
+            if ((rule.source != FeedbackSource::BandPower && rule.source != FeedbackSource::RelativePower) ||
+                rule.device != device || rule.channel != channel || rule.band >= bands)
+            {
+                return false;
+            }
+
+            value = power[rule.band];
+            if (rule.source == FeedbackSource::RelativePower)
+            {
+                value = total > 0.0f ? value / total : 0.0f;
+            }
+            return true;
+        },
+        stamp);
+}
+
+/**
+ * @brief Feed ADS131M08 frame
+ *
+ * @param device ADS131M08 device index
+ * @param codes ADC code of every channel
+ * @param stamp cycle counter when the frame was read
+ */
+void FeedbackEngine::OnFrame(size_t device, const int32_t (&codes)[Ads131Pipeline::Channels], uint32_t stamp)
+{
+    Feed(
+        [&](const Rule &rule, float &value)
+        {
+            if (rule.source != FeedbackSource::Amplitude || rule.device != device)
+            {
+                return false;
+            }
+
+            value = fabsf(static_cast<float>(codes[rule.channel]));
+            return true;
+        },
+        stamp);
+}
+
+/**
+ * @brief Feed heart rate
+ *
+ * @param bpm heart rate, beats per minute
+ * @param stamp cycle counter when the vitals record was completed
+ */
+void FeedbackEngine::OnHeartRate(uint8_t bpm, uint32_t stamp)
+{
+    Feed(
+        [&](const Rule &rule, float &value)
+        {
+            if (rule.source != FeedbackSource::HeartRate)
+            {
+                return false;
+            }
+
+            value = bpm;
+            return true;
+        },
+        stamp);
+}
+
+/**
+ * @brief Log latencies since the last report
+ */
+void FeedbackEngine::ReportLatency()
+{
+    for (size_t s = 1; s < sourceCount; ++s)
+    {
+        LatencyMeter::Summary summary = decision[s].Take();
+
+        if (summary.count != 0)
+        {
+            LOG_INF("%s: %u outputs, decision latency mean %u us, min %u us, max %u us", sourceNames[s],
+                    summary.count, summary.mean, summary.min, summary.max);
+        }
+    }
+
+#if CONFIG_USE_I2S
+    if (audio != nullptr)
+    {
+        LatencyMeter::Summary summary = audio->TakeToneLatency();
+
+        LOG_INF("Tone: %u changes, latency to playback mean %u us, min %u us, max %u us", summary.count,
+                summary.mean, summary.min, summary.max);
+    }
+#endif
+
+#if CONFIG_USE_TLC5940
+    if (leds != nullptr)
+    {
+        LatencyMeter::Summary summary = leds->TakeLatchLatency();
+
+        LOG_INF("LEDs: %u latches, latency to latch mean %u us, min %u us, max %u us", summary.count,
+                summary.mean, summary.min, summary.max);
+    }
+#endif
+}
+
+/**
+ * @brief Called when feedback command is received via BLE
+ *
+ * @param buffer receviced buffer
+ * @param key command key
+ * @param length buffer length
+ * @param offset data offset
+ *
+ * @return true if command was processed succesfully
+ */
+bool FeedbackEngine::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    if (offset.value != 0)
+    {
+        return false;
+    }
+
+    switch (static_cast<FeedbackCommand>(key.key[0]))
+    {
+    case FeedbackCommand::SetRule:
+        if (length.value < ruleSize)
+        {
+            return false;
+        }
+        return SetRule(buffer);
+
+    case FeedbackCommand::ClearRule:
+        if (length.value < 1 || (buffer[0] >= MaxRules && buffer[0] != 0xFF))
+        {
+            return false;
+        }
+        {
+            k_spinlock_key_t lockKey = k_spin_lock(&lock);
+            for (size_t i = 0; i < MaxRules; ++i)
+            {
+                if (buffer[0] == 0xFF || buffer[0] == i)
+                {
+                    rules[i] = {};
+                }
+            }
+            k_spin_unlock(&lock, lockKey);
+        }
+        UpdateSources();
+        break;
+
+    case FeedbackCommand::SetEnabled:
+        if (length.value < 1 || buffer[0] > 1)
+        {
+            return false;
+        }
+        SetEnabled(buffer[0] != 0);
+        break;
+
+    case FeedbackCommand::ReportLatency:
+        ReportLatency();
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Parse and store SetRule data
+ *
+ * @return true if rule is valid
+ */
+bool FeedbackEngine::SetRule(const uint8_t *buffer)
+{
+    size_t index = buffer[0];
+    uint8_t smoothing = buffer[8];
+    Rule rule = {};
+
+    rule.source = static_cast<FeedbackSource>(buffer[1]);
+    rule.device = buffer[2];
+    rule.channel = buffer[3];
+    rule.band = buffer[4];
+    rule.mapping = static_cast<FeedbackMapping>(buffer[5]);
+    rule.target = static_cast<FeedbackTarget>(buffer[6]);
+    rule.output = buffer[7];
+    rule.low = GetFloat(buffer + 9);
+    rule.high = GetFloat(buffer + 13);
+    rule.outputLow = sys_get_le16(buffer + 17);
+    rule.outputHigh = sys_get_le16(buffer + 19);
+    rule.weight = smoothing / 100.0f;
+    rule.last = -1;
+
+    if (index >= MaxRules || rule.source == FeedbackSource::None || buffer[1] >= sourceCount ||
+        rule.device >= Ads131Pipeline::MaxDevices || rule.channel >= Ads131Pipeline::Channels ||
+        rule.band >= MaxBands || rule.mapping > FeedbackMapping::Threshold || rule.target > FeedbackTarget::Led ||
+        smoothing == 0 || smoothing > 100)
+    {
+        return false;
+    }
+
+    // Also rejects NaN edges
+    if (!(rule.low < rule.high) || (rule.mapping == FeedbackMapping::Log && !(rule.low > 0.0f)))
+    {
+        return false;
+    }
+
+    uint16_t outputMax = MAX(rule.outputLow, rule.outputHigh);
+    switch (rule.target)
+    {
+    case FeedbackTarget::ToneVolume:
+        if (outputMax > 100)
+        {
+            return false;
+        }
+        break;
+
+    case FeedbackTarget::ToneFrequency:
+        if (outputMax > maxToneFrequency)
+        {
+            return false;
+        }
+        break;
+
+    case FeedbackTarget::Led:
+        if (outputMax > maxLed || (rule.output >= 16 * CONFIG_NUM_TLCS && rule.output != AllLeds))
+        {
+            return false;
+        }
+        break;
+    }
+
+    if (rule.mapping == FeedbackMapping::Log)
+    {
+        rule.low = log10f(rule.low);
+        rule.high = log10f(rule.high);
+    }
+
+    k_spinlock_key_t lockKey = k_spin_lock(&lock);
+    rules[index] = rule;
+    k_spin_unlock(&lock, lockKey);
+
+    UpdateSources();
+
+    LOG_INF("Rule %u: %s of %u/%u/%u to target %u", index, sourceNames[buffer[1]], rule.device, rule.channel,
+            rule.band, buffer[6]);
+
+    return true;
+}
+
+/**
+ * @brief Start or stop every rule. Stopping silences the tone and switches rule LEDs off
+ */
+void FeedbackEngine::SetEnabled(bool enable)
+{
+    uint8_t ledOutputs[MaxRules];
+    size_t ledCount = 0;
+
+    enabled.store(enable, std::memory_order_relaxed);
+
+    k_spinlock_key_t lockKey = k_spin_lock(&lock);
+    for (size_t i = 0; i < MaxRules; ++i)
+    {
+        Rule &rule = rules[i];
+
+        if (!enable && rule.source != FeedbackSource::None && rule.target == FeedbackTarget::Led)
+        {
+            ledOutputs[ledCount++] = rule.output;
+        }
+        rule.primed = false;
+        rule.on = false;
+        rule.last = -1;
+    }
+    k_spin_unlock(&lock, lockKey);
+
+    UpdateSources();
+
+    for (size_t i = 0; i < ledCount; ++i)
+    {
+        Drive(FeedbackTarget::Led, ledOutputs[i], 0, LatencyMeter::Stamp());
+    }
+}
+
+/**
+ * @brief Recompute source mask and tone state from rules
+ */
+void FeedbackEngine::UpdateSources()
+{
+    uint32_t mask = 0;
+    bool tone = false;
+    bool volume = false;
+
+    k_spinlock_key_t lockKey = k_spin_lock(&lock);
+    for (size_t i = 0; i < MaxRules; ++i)
+    {
+        const Rule &rule = rules[i];
+
+        if (rule.source != FeedbackSource::None)
+        {
+            mask |= 1u << static_cast<uint8_t>(rule.source);
+            tone |= rule.target != FeedbackTarget::Led;
+            volume |= rule.target == FeedbackTarget::ToneVolume;
+        }
+    }
+    k_spin_unlock(&lock, lockKey);
+
+    bool running = enabled.load(std::memory_order_relaxed);
+    sourceMask.store(running ? mask : 0, std::memory_order_relaxed);
+
+#if CONFIG_USE_I2S
+    if (audio != nullptr)
+    {
+        // A tone with only a frequency rule must still be heard
+        if (running && tone && !volume)
+        {
+            audio->SetToneVolume(defaultToneVolume, LatencyMeter::Stamp());
+        }
+        audio->EnableTone(running && tone);
+    }
+#else
+    ARG_UNUSED(tone);
+    ARG_UNUSED(volume);
+#endif
+}
+
+/**
+ * @brief Apply feature to rule
+ *
+ * @param rule rule, lock must be held
+ * @param feature feature
+ * @param value output of the rule
+ * @return true if output changed
+ */
+bool FeedbackEngine::Evaluate(Rule &rule, float feature, uint16_t &value)
+{
+    if (rule.mapping == FeedbackMapping::Log)
+    {
+        feature = log10f(MAX(feature, 1e-30f));
+    }
+
+    // Smoothing is applied to the position of the feature between the edges
+    float position = (feature - rule.low) / (rule.high - rule.low);
+    if (!rule.primed)
+    {
+        rule.level = position;
+        rule.primed = true;
+    }
+    else
+    {
+        rule.level += rule.weight * (position - rule.level);
+    }
+
+    float amount;
+    if (rule.mapping == FeedbackMapping::Threshold)
+    {
+        // Hysteresis between the edges
+        if (rule.level >= 1.0f)
+        {
+            rule.on = true;
+        }
+        else if (rule.level < 0.0f)
+        {
+            rule.on = false;
+        }
+        amount = rule.on ? 1.0f : 0.0f;
+    }
+    else
+    {
+        amount = CLAMP(rule.level, 0.0f, 1.0f);
+    }
+
+    int32_t output = lroundf(rule.outputLow + amount * (static_cast<int32_t>(rule.outputHigh) - rule.outputLow));
+    if (output == rule.last)
+    {
+        return false;
+    }
+
+    rule.last = output;
+    value = output;
+
+    return true;
+}
+
+/**
+ * @brief Drive output
+ */
+void FeedbackEngine::Drive(FeedbackTarget target, uint8_t output, uint16_t value, uint32_t stamp)
+{
+    switch (target)
+    {
+#if CONFIG_USE_I2S
+    case FeedbackTarget::ToneVolume:
+        if (audio != nullptr)
+        {
+            audio->SetToneVolume(value, stamp);
+        }
+        break;
+
+    case FeedbackTarget::ToneFrequency:
+        if (audio != nullptr)
+        {
+            audio->SetToneFrequency(value, stamp);
+        }
+        break;
+#endif
+
+#if CONFIG_USE_TLC5940
+    case FeedbackTarget::Led:
+        if (leds != nullptr)
+        {
+            leds->SetFeedback(output, value, stamp);
+        }
+        break;
+#endif
+
+    default:
+        ARG_UNUSED(output);
+        ARG_UNUSED(value);
+        ARG_UNUSED(stamp);
+        break;
+    }
+}
+
+#endif // CONFIG_USE_FEEDBACK
@@ -0,0 +1,682 @@
+#include "i2c_queue.hpp"
+
+#include <zephyr/logging/log.h>
+#include <zephyr/pm/device.h>
+
+LOG_MODULE_REGISTER(i2c_queue, LOG_LEVEL_INF);
+
+namespace
+{
+    constexpr static size_t maxBuses = 2;       ///< Maximum number of I2C buses with queues
+    constexpr static int stackSize = 2048;      ///< Queue thread stack size. Callbacks send BLE notifications
+    constexpr static int taskPriority = 2;      ///< Queue thread priority
+
+    K_THREAD_STACK_ARRAY_DEFINE(queueStackArea, maxBuses, stackSize); ///< Queue threads stacks
+    K_MUTEX_DEFINE(queuesLock);                                       ///< Protects queue creation
+
+    I2cQueue queues[maxBuses]; ///< Bus queues
+    size_t queueCount = 0;     ///< Number of started queues
+
+    /**
+     * @brief Check if transaction a has to run before transaction b
+     */
+    bool IsMoreUrgent(const I2cTransaction &a, const I2cTransaction &b)
+    {
+        if (a.priority != b.priority)
+        {
+            return a.priority < b.priority;
+        }
+
+        // Cycle counter wraps around, deadlines are compared by difference
+        return static_cast<int32_t>(a.due - b.due) < 0;
+    }
+}
+
+/**
+ * @brief Get queue of I2C bus. Queue thread is started on first use.
+ *
+ * @param bus I2C bus device
+ * @return I2cQueue& queue of the bus
+ */
+I2cQueue &I2cQueue::ForBus(const device *bus)
+{
+    k_mutex_lock(&queuesLock, K_FOREVER);
+
+    for (size_t i = 0; i < queueCount; ++i)
+    {
+        if (queues[i].bus == bus)
+        {
+            k_mutex_unlock(&queuesLock);
+            return queues[i];
+        }
+    }
+
+    __ASSERT(queueCount < maxBuses, "Too many I2C buses");
+
+    I2cQueue &queue = queues[queueCount];
+    queue.Start(bus, queueCount);
+    queueCount++;
+
+    k_mutex_unlock(&queuesLock);
+
+    return queue;
+}
+
+/**
+ * @brief Get number of started bus queues
+ */
+size_t I2cQueue::Count()
+{
+    return queueCount;
+}
+
+/**
+ * @brief Get started bus queue
+ *
+ * @param index queue index, less than Count()
+ * @return I2cQueue& queue of the bus
+ */
+I2cQueue &I2cQueue::At(size_t index)
+{
+    __ASSERT(index < queueCount, "Invalid I2C queue index");
+
+    return queues[index];
+}
+
+/**
+ * @brief Start queue thread for the bus
+ *
+ * @param busDevice I2C bus device
+ * @param index queue index, used to select thread stack
+ */
+void I2cQueue::Start(const device *busDevice, size_t index)
+{
+    bus = busDevice;
+    rejected.store(0, std::memory_order_relaxed);
+    busClears.store(0, std::memory_order_relaxed);
+    transferState.store(TransferState::Idle, std::memory_order_relaxed);
+    failed.store(false, std::memory_order_relaxed);
+    windowStart = k_uptime_get();
+
+    k_sem_init(&wakeup, 0, 1);
+    k_sem_init(&transferDone, 0, 1);
+
+    k_thread_create(&thread, queueStackArea[index], K_THREAD_STACK_SIZEOF(queueStackArea[index]),
+                    &I2cQueue::WorkingThread, this, nullptr, nullptr, taskPriority, 0, K_NO_WAIT);
+    k_thread_name_set(&thread, bus->name);
+}
+
+/**
+ * @brief Register device on the bus and configure bus speed. Bus runs at the lowest maximum speed of its
+ *        devices, and in Fast-mode Plus only with CONFIG_I2C_QUEUE_FAST_PLUS.
+ *
+ * @param address device address
+ * @param maxSpeed maximum speed supported by device, I2C_SPEED_*
+ * @return Status, 0 for no errors
+ */
+int I2cQueue::AddDevice(uint8_t address, uint32_t maxSpeed)
+{
+    uint32_t busSpeed = IS_ENABLED(CONFIG_I2C_QUEUE_FAST_PLUS) ? I2C_SPEED_FAST_PLUS : I2C_SPEED_FAST;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    size_t i = 0;
+    while (i < deviceCount && devices[i].address != address)
+    {
+        ++i;
+    }
+
+    if (i == MaxDevices)
+    {
+        k_spin_unlock(&lock, key);
+        LOG_ERR("%s: too many devices", bus->name);
+        return -ENOMEM;
+    }
+
+    if (i == deviceCount)
+    {
+        devices[i] = {};
+        devices[i].address = address;
+        deviceCount++;
+    }
+    devices[i].maxSpeed = maxSpeed;
+
+    for (i = 0; i < deviceCount; ++i)
+    {
+        busSpeed = MIN(busSpeed, devices[i].maxSpeed);
+    }
+
+    bool changed = busSpeed != speed;
+    speed = busSpeed;
+
+    k_spin_unlock(&lock, key);
+
+    if (!changed)
+    {
+        return 0;
+    }
+
+    LOG_INF("%s: speed %u", bus->name, busSpeed);
+
+    return i2c_configure(bus, I2C_SPEED_SET(busSpeed) | I2C_MODE_CONTROLLER);
+}
+
+/**
+ * @brief Queue transaction
+ *
+ * @param transaction transaction to execute
+ * @return true if transaction was queued, false if it is still pending or queue is full
+ */
+bool I2cQueue::Submit(I2cTransaction &transaction)
+{
+    if (transaction.pending.exchange(true, std::memory_order_acq_rel))
+    {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    transaction.queuedAt = k_cycle_get_32();
+    transaction.due = transaction.queuedAt + k_us_to_cyc_ceil32(transaction.deadlineUs);
+    transaction.done = 0;
+    transaction.busCycles = 0;
+
+    if (!Enqueue(transaction))
+    {
+        transaction.pending.store(false, std::memory_order_release);
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    k_sem_give(&wakeup);
+
+    return true;
+}
+
+/**
+ * @brief Get number of transactions rejected because queue was full or transaction was still pending
+ *
+ * @return number of rejected transactions
+ */
+uint32_t I2cQueue::GetRejected()
+{
+    return rejected.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Check if caller runs on queue thread, where waiting for a transaction would never return
+ *
+ * @return true if called from queue thread
+ */
+bool I2cQueue::IsQueueThread()
+{
+    return k_current_get() == &thread;
+}
+
+/**
+ * @brief Get bus and per device statistics
+ *
+ * @param busStats bus statistics
+ * @param deviceStats per device statistics, in registration order
+ * @param maxDevices size of deviceStats array
+ * @param reset start new statistics window
+ * @return number of devices stored to deviceStats array
+ */
+size_t I2cQueue::GetStats(I2cBusStats &busStats, I2cDeviceStats *deviceStats, size_t maxDevices, bool reset)
+{
+    int64_t now = k_uptime_get();
+    uint64_t busyCycles = 0;
+    size_t count;
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    count = MIN(deviceCount, maxDevices);
+    for (size_t i = 0; i < deviceCount; ++i)
+    {
+        DeviceEntry &entry = devices[i];
+        busyCycles += entry.busCycles;
+
+        if (i < count)
+        {
+            deviceStats[i].address = entry.address;
+            deviceStats[i].transfers = entry.transfers;
+            deviceStats[i].busTimeUs = static_cast<uint32_t>(k_cyc_to_us_floor64(entry.busCycles));
+            deviceStats[i].maxLatencyUs = k_cyc_to_us_floor32(entry.maxLatencyCycles);
+            deviceStats[i].deadlineMisses = entry.deadlineMisses;
+            deviceStats[i].recoveries = entry.recoveries;
+            deviceStats[i].failedRecoveries = entry.failedRecoveries;
+        }
+
+        if (reset)
+        {
+            entry.transfers = 0;
+            entry.busCycles = 0;
+            entry.maxLatencyCycles = 0;
+            entry.deadlineMisses = 0;
+        }
+    }
+
+    busStats.speed = speed;
+    busStats.windowMs = static_cast<uint32_t>(now - windowStart);
+    busStats.busyUs = static_cast<uint32_t>(k_cyc_to_us_floor64(busyCycles));
+    busStats.rejected = rejected.load(std::memory_order_relaxed);
+    busStats.busClears = busClears.load(std::memory_order_relaxed);
+    busStats.devices = deviceCount;
+
+    if (reset)
+    {
+        windowStart = now;
+    }
+
+    k_spin_unlock(&lock, key);
+
+    return count;
+}
+
+/**
+ * @brief Count sensor re-initialization after repeated transfer errors
+ *
+ * @param address device address
+ * @param recovered true if sensor was initialized again
+ */
+void I2cQueue::NoteRecovery(uint8_t address, bool recovered)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (size_t i = 0; i < deviceCount; ++i)
+    {
+        if (devices[i].address == address)
+        {
+            uint16_t &counter = recovered ? devices[i].recoveries : devices[i].failedRecoveries;
+            counter = MIN(counter + 1, UINT16_MAX);
+            break;
+        }
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+/**
+ * @brief Check if the bus failed: a timed out transfer was not returned by the driver after bus clear
+ *
+ * @return true until the controller is reset with ResetController
+ */
+bool I2cQueue::IsFailed()
+{
+    return failed.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Reset the controller of a failed bus. Suspending the controller stops its DMA, so the quarantined
+ *        transaction is released and transfers start again. Called from sensor recovery, does nothing if the bus
+ *        has not failed.
+ *
+ * @return Status, 0 if the bus is usable, -EBUSY if the driver may still write to the quarantined buffer
+ */
+int I2cQueue::ResetController()
+{
+    if (!IsFailed())
+    {
+        return 0;
+    }
+
+    // Queue thread does not use the driver while the bus is failed
+    int ret = pm_device_action_run(bus, PM_DEVICE_ACTION_SUSPEND);
+    if (ret == 0 || ret == -EALREADY)
+    {
+        ret = pm_device_action_run(bus, PM_DEVICE_ACTION_RESUME);
+        if (ret != 0)
+        {
+            LOG_ERR("%s: controller resume failed: %d", bus->name, ret);
+            return ret;
+        }
+
+        transferState.store(TransferState::Idle, std::memory_order_release);
+        ReleaseQuarantine();
+    }
+    else if (transferState.load(std::memory_order_acquire) != TransferState::Idle)
+    {
+        // Without device power management only the driver completion releases the buffer
+        LOG_WRN("%s: controller can't be reset, transfer still owned by the driver", bus->name);
+        return -EBUSY;
+    }
+
+    busClears.fetch_add(1, std::memory_order_relaxed);
+    i2c_recover_bus(bus);
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    uint32_t busSpeed = speed;
+    k_spin_unlock(&lock, key);
+
+    ret = i2c_configure(bus, I2C_SPEED_SET(busSpeed) | I2C_MODE_CONTROLLER);
+    if (ret != 0)
+    {
+        LOG_ERR("%s: controller configuration failed: %d", bus->name, ret);
+        return ret;
+    }
+
+    k_sem_reset(&transferDone);
+    failed.store(false, std::memory_order_release);
+    LOG_INF("%s: controller reset", bus->name);
+
+    return 0;
+}
+
+/**
+ * @brief Queue thread. Executes queued transactions and calls completion callbacks.
+ *
+ * @param data pointer to current instance of I2cQueue
+ */
+void I2cQueue::WorkingThread(void *data, void *, void *)
+{
+    I2cQueue *self = static_cast<I2cQueue *>(data);
+    I2cTransaction *transaction = nullptr;
+
+    for (;;)
+    {
+        if (transaction == nullptr)
+        {
+            transaction = self->Next();
+        }
+
+        if (transaction == nullptr)
+        {
+            k_sem_take(&self->wakeup, K_FOREVER);
+            continue;
+        }
+
+        uint16_t length = transaction->length - transaction->done;
+        if (transaction->chunkSize != 0)
+        {
+            length = MIN(length, transaction->chunkSize);
+        }
+
+        uint32_t start = k_cycle_get_32();
+        if (transaction->done == 0)
+        {
+            transaction->startedAt = start;
+        }
+
+        int status = self->Execute(*transaction, length);
+        uint32_t end = k_cycle_get_32();
+
+        self->CheckBus(status);
+
+        transaction->busCycles += end - start;
+        transaction->done += length;
+
+        if (status == 0 && transaction->done < transaction->length)
+        {
+            // More urgent transactions run between chunks. Continue with this one if queue is full
+            if (self->Enqueue(*transaction))
+            {
+                transaction = nullptr;
+            }
+            continue;
+        }
+
+        self->Account(*transaction, end);
+
+        // Transaction could be queued again from its own callback. Quarantined transaction stays pending
+        I2cTransaction &completed = *transaction;
+        transaction = nullptr;
+        if (!self->IsQuarantined(completed))
+        {
+            completed.pending.store(false, std::memory_order_release);
+        }
+
+        if (completed.callback)
+        {
+            completed.callback(status);
+        }
+    }
+}
+
+/**
+ * @brief Remove the most urgent transaction from the queue
+ *
+ * @return transaction, nullptr if queue is empty
+ */
+I2cTransaction *I2cQueue::Next()
+{
+    I2cTransaction *next = nullptr;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (queuedCount > 0)
+    {
+        size_t best = 0;
+        for (size_t i = 1; i < queuedCount; ++i)
+        {
+            if (IsMoreUrgent(*queued[i], *queued[best]))
+            {
+                best = i;
+            }
+        }
+
+        next = queued[best];
+        queued[best] = queued[--queuedCount];
+    }
+
+    k_spin_unlock(&lock, key);
+
+    return next;
+}
+
+/**
+ * @brief Add transaction to the queue
+ *
+ * @param transaction transaction to add
+ * @return true if there was free slot
+ */
+bool I2cQueue::Enqueue(I2cTransaction &transaction)
+{
+    bool queuedOk = false;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (queuedCount < MaxTransactions)
+    {
+        queued[queuedCount++] = &transaction;
+        queuedOk = true;
+    }
+
+    k_spin_unlock(&lock, key);
+
+    return queuedOk;
+}
+
+/**
+ * @brief Execute single bus transfer: whole transaction or its next chunk
+ *
+ * @param transaction transaction to execute
+ * @param length number of bytes to transfer
+ * @return transfer status, 0 for no errors
+ */
+int I2cQueue::Execute(I2cTransaction &transaction, uint16_t length)
+{
+    // Driver may still own the messages of the abandoned transfer
+    if (IsFailed())
+    {
+        return -EIO;
+    }
+
+    // Messages are owned by the queue, the driver uses them until the transfer completes
+    registerId = transaction.registerId;
+
+    msgs[0].buf = &registerId;
+    msgs[0].len = 1;
+    msgs[0].flags = I2C_MSG_WRITE;
+
+    msgs[1].buf = transaction.data + transaction.done;
+    msgs[1].len = length;
+    msgs[1].flags = transaction.write ? (I2C_MSG_WRITE | I2C_MSG_STOP)
+                                      : (I2C_MSG_READ | I2C_MSG_RESTART | I2C_MSG_STOP);
+
+#if CONFIG_I2C_CALLBACK
+    transferState.store(TransferState::Running, std::memory_order_release);
+
+    int ret = i2c_transfer_cb(bus, msgs, ARRAY_SIZE(msgs), transaction.address, &I2cQueue::OnTransferComplete, this);
+    if (ret == 0)
+    {
+        if (k_sem_take(&transferDone, K_MSEC(TransferTimeoutMs)) == 0)
+        {
+            return transferResult;
+        }
+
+        // Driver still owns the messages and may write to the transaction buffer. Abort the transfer by clearing
+        // the bus, which makes the driver complete it
+        busClears.fetch_add(1, std::memory_order_relaxed);
+        ret = i2c_recover_bus(bus);
+        LOG_WRN("%s: bus clear after transfer timeout: %d", bus->name, ret);
+
+        if (k_sem_take(&transferDone, K_MSEC(TransferTimeoutMs)) == 0)
+        {
+            return -ETIMEDOUT;
+        }
+
+        // Completion raced with the timeout
+        TransferState running = TransferState::Running;
+        if (!transferState.compare_exchange_strong(running, TransferState::Abandoned, std::memory_order_acq_rel))
+        {
+            k_sem_take(&transferDone, K_MSEC(TransferTimeoutMs));
+            return -ETIMEDOUT;
+        }
+
+        LOG_ERR("%s: transfer not completed after bus clear, bus failed", bus->name);
+        Quarantine(transaction);
+        return -ETIMEDOUT;
+    }
+
+    transferState.store(TransferState::Idle, std::memory_order_release);
+
+    if (ret != -ENOSYS)
+    {
+        return ret;
+    }
+#endif
+
+    return i2c_transfer(bus, msgs, ARRAY_SIZE(msgs), transaction.address);
+}
+
+/**
+ * @brief Update accounting of the transaction device
+ *
+ * @param transaction completed transaction
+ * @param end cycle counter at completion
+ */
+void I2cQueue::Account(const I2cTransaction &transaction, uint32_t end)
+{
+    uint32_t latency = transaction.startedAt - transaction.queuedAt;
+    bool missed = transaction.deadlineUs != 0 && static_cast<int32_t>(end - transaction.due) > 0;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    for (size_t i = 0; i < deviceCount; ++i)
+    {
+        DeviceEntry &entry = devices[i];
+        if (entry.address != transaction.address)
+        {
+            continue;
+        }
+
+        entry.transfers++;
+        entry.busCycles += transaction.busCycles;
+        entry.maxLatencyCycles = MAX(entry.maxLatencyCycles, latency);
+        entry.deadlineMisses += missed ? 1 : 0;
+        break;
+    }
+
+    k_spin_unlock(&lock, key);
+}
+
+/**
+ * @brief Count transfer result and clear the bus after too many failed transfers in a row
+ *
+ * @param status transfer status
+ */
+void I2cQueue::CheckBus(int status)
+{
+    // Failed bus is reset by sensor recovery, bus clear would use the driver
+    if (status == 0 || IsFailed())
+    {
+        failedTransfers = 0;
+        return;
+    }
+
+    if (CONFIG_I2C_QUEUE_RECOVERY_ERRORS == 0 || ++failedTransfers < CONFIG_I2C_QUEUE_RECOVERY_ERRORS)
+    {
+        return;
+    }
+
+    failedTransfers = 0;
+    busClears.fetch_add(1, std::memory_order_relaxed);
+
+    int ret = i2c_recover_bus(bus);
+    LOG_WRN("%s: bus clear after %u failed transfers: %d", bus->name, CONFIG_I2C_QUEUE_RECOVERY_ERRORS, ret);
+}
+
+/**
+ * @brief Mark the bus failed and keep the transaction pending until the driver returns its buffer
+ *
+ * @param transaction transaction of the abandoned transfer
+ */
+void I2cQueue::Quarantine(I2cTransaction &transaction)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    __ASSERT(quarantined == nullptr, "Transfer started on failed bus");
+    quarantined = &transaction;
+    failed.store(true, std::memory_order_release);
+
+    k_spin_unlock(&lock, key);
+
+    // Driver returned the buffer between the timeout and the quarantine
+    if (transferState.load(std::memory_order_acquire) == TransferState::Idle)
+    {
+        ReleaseQuarantine();
+    }
+}
+
+/**
+ * @brief Check if transaction is kept pending in the quarantine slot
+ */
+bool I2cQueue::IsQuarantined(const I2cTransaction &transaction)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool result = quarantined == &transaction;
+    k_spin_unlock(&lock, key);
+
+    return result;
+}
+
+/**
+ * @brief Release the quarantined transaction, so that its owner can submit it again
+ */
+void I2cQueue::ReleaseQuarantine()
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    I2cTransaction *transaction = quarantined;
+    quarantined = nullptr;
+    k_spin_unlock(&lock, key);
+
+    if (transaction != nullptr)
+    {
+        transaction->pending.store(false, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Transfer complete callback used with i2c_transfer_cb
+ */
+void I2cQueue::OnTransferComplete(const device *dev, int result, void *data)
+{
+    ARG_UNUSED(dev);
+
+    I2cQueue *self = static_cast<I2cQueue *>(data);
+
+    // Late completion of an abandoned transfer only releases its buffer, the bus stays failed until it is reset
+    if (self->transferState.exchange(TransferState::Idle, std::memory_order_acq_rel) == TransferState::Abandoned)
+    {
+        self->ReleaseQuarantine();
+        return;
+    }
+
+    self->transferResult = result;
+    k_sem_give(&self->transferDone);
+}
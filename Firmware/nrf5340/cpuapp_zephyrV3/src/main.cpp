@@ -14,8 +14,27 @@
 #include "qmc5883l.hpp"
 #include "serial_controller.hpp"
 #include "usb_comm_handler.hpp"
+#if CONFIG_USE_I2S
 #include "audio_module.hpp"
+#endif
+#if CONFIG_USE_DMIC
 #include "dmic_module.hpp"
+#endif
+#include "orientation_fusion.hpp"
+#include "ads131_pipeline.hpp"
+#if CONFIG_USE_ADS131_BAND_POWER
+#include "band_power.hpp"
+#endif
+#if CONFIG_USE_ADS131_SIGNAL_QUALITY
+#include "signal_quality.hpp"
+#endif
+#if CONFIG_USE_FEEDBACK
+#include "feedback_engine.hpp"
+#endif
+#if CONFIG_USE_EVENT_CAPTURE
+#include "event_capture.hpp"
+#endif
+#include "sensor_registry.hpp"
 
 #include "ble_service.hpp"
 // Needed for OTA
@@ -42,21 +61,35 @@ const struct device *gpio_1_dev;
 #define GREEN_LED           ((uint8_t)37)  //GREEN LED
 #define BLUE_LED            ((uint8_t)38)  //BLUE LED
 
-#define MAX_INT             ((uint8_t)4) // 4 //113 (nirs ensemble)
-
-#define MPU_INT             ((uint8_t)5)   // 5 //4 (nirs ensemble)
-#define QMC5883L_DRDY       ((uint8_t)6)   // 6 //32 (nirs ensemble)
+// Sensor interrupt pins are defined in zephyr,user node of the .overlay file
 
 LOG_MODULE_REGISTER(main);
 
 /* Static Functions */
 static int  gpio_init(void);
-static int  init_sensor_gpio_int(void);
 
 #define SPS_250_OSR  0b111
 #define SPS_500_OSR  0b110
 #define SPS_1000_OSR 0b101
 #define SPS_2000_OSR 0b100
+#define SPS_4000_OSR 0b011
+
+#if CONFIG_USE_ADS131M08
+#define ADS_SAMPLE_RATE CONFIG_ADS131_SAMPLE_RATE
+#if ADS_SAMPLE_RATE == 250
+#define ADS_OSR SPS_250_OSR
+#elif ADS_SAMPLE_RATE == 500
+#define ADS_OSR SPS_500_OSR
+#elif ADS_SAMPLE_RATE == 1000
+#define ADS_OSR SPS_1000_OSR
+#elif ADS_SAMPLE_RATE == 2000
+#define ADS_OSR SPS_2000_OSR
+#elif ADS_SAMPLE_RATE == 4000
+#define ADS_OSR SPS_4000_OSR
+#else
+#error "CONFIG_ADS131_SAMPLE_RATE must be 250, 500, 1000, 2000 or 4000"
+#endif
+#endif
 
 // #if CONFIG_USE_USB
 // SerialController serial;
@@ -91,61 +124,6 @@ static uint8_t i = 0;
 static uint8_t j = 0;
 #endif 
 
-#if CONFIG_USE_MAX30102
-/* Static Functions */
-static void max30102_interrupt_workQueue_handler(struct k_work* wrk);
-static void max30102_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
-
-/* Global variables */
-struct gpio_callback max30102_callback;
-struct k_work max30102_interrupt_work_item;    ///< interrupt work item
-static max30102_config max30102_default_config = {
-    0x80, // Interrupt Config 1. Enable FIFO_A_FULL interrupt
-    MAX30102_INTR_2_DIE_TEMP_RDY_EN, // Interrupt Config 2. Enable temperature ready interrupt
-    0b01110000, // FIFO Config. Average 16 samples, FIFO Rollover Enabled, FFIO_A_FULL = 32
-    0x87, // Mode config. Keep Max30102 shutdown. Multi LED mode .
-    0b01110011, // Sp02 config. 800sps rate, 2048 full scale, 18-bit ADC resolution.
-    {100, 100}, // LED1/LED2 config. 25.4mA typical LED current
-    {0x11, 0x22}  // SLOT config. SLOT1/2 for LED1, SLOT3/4 for LED2.
-};
-#endif
-
-#if CONFIG_USE_MPU6050
-/* Static Functions */
-static void mpu6050_interrupt_workQueue_handler(struct k_work* wrk);
-static void mpu6050_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
-
-/* Global variables */
-struct gpio_callback mpu6050_callback;
-struct k_work mpu6050_interrupt_work_item;    ///< interrupt work item
-static mpu6050_config mpu6050_default_config = {
-    .sample_rate_config = 0x09,     // Sample rate = 100Hz
-    .config_reg = 0x01,             // FSYNC disabled. Digital Low Pass filter enabled. 
-    .gyro_config = (0x01 << 3),     // 500dps Gyro Full Scale. No Self-Tests.
-    .accel_config = (0x01 << 3),    // +/-4g Accel Full Scale. No Self-Tests. 
-    .fifo_config = 0x00,            // FIFO disabled.
-    .interrupt_pin_config = 0xC0,    // INT active low. Open drain. Keep interrupt pin active until interrupt is cleared. Clear interrupt only by reading INT_STATUS register.
-    .interrupt_config = 0x01,       // Enable only Data Ready interrupts.
-    .user_control = 0x00,           // Disable FIFO
-    .pwr_mgmt_1 = 0x01,             // Use PLL with X axis gyroscope as Clock Source.
-    .pwr_mgmt_2 = 0x00              // Don't use Accelerometer only Low Power mode. XYZ axes of Gyro and Accel enabled. 
-}; 
-#endif
-
-#if CONFIG_USE_QMC5883L
-/* Static Functions */
-static void qmc5883l_interrupt_workQueue_handler(struct k_work* wrk);
-static void qmc5883l_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
-
-/* Global variables */
-struct gpio_callback qmc5883l_callback;
-struct k_work qmc5883l_interrupt_work_item;    ///< interrupt work item
-static qmc5883l_config qmc5883l_default_config = {
-    .ctrl_reg_1 = (QMC5833L_OSR_512 << 6) | (QMC5833L_FS_8G << 4) | (QMC5833L_ODR_100Hz << 2) | (QMC5833L_MODE_STANDBY),
-    .ctrl_reg_2 = 0
-}; 
-#endif
-
 #if CONFIG_USE_MCU2MCU
 /* Static Functions */
 static void uart_cb(const struct device *dev, struct uart_event *evt, void *user_data);
@@ -166,6 +144,18 @@ SerialController serial;
 UsbCommHandler usbCommHandler(serial);
 #endif
 
+#if CONFIG_USE_ADS131_PIPELINE
+Ads131Pipeline adsPipeline(usbCommHandler);
+#endif
+
+#if CONFIG_USE_ADS131_BAND_POWER
+BandPower bandPower(usbCommHandler);
+#endif
+
+#if CONFIG_USE_ADS131_SIGNAL_QUALITY
+SignalQuality signalQuality(usbCommHandler);
+#endif
+
 #if CONFIG_USE_MAX30102
 Max30102 max30102(usbCommHandler);
 #endif
@@ -174,6 +164,10 @@ Max30102 max30102(usbCommHandler);
 Mpu6050 mpu6050(usbCommHandler);
 #endif
 
+#if CONFIG_USE_ORIENTATION_FUSION
+OrientationFusion orientationFusion(usbCommHandler);
+#endif
+
 #if CONFIG_USE_BME280
 Bme280 bme280(usbCommHandler);
 #endif
@@ -187,13 +181,21 @@ AudioModule audio;
 #endif
 
 #if CONFIG_USE_DMIC
-DmicModule dmic;
+DmicModule dmic(usbCommHandler);
 #endif
 
 #if CONFIG_USE_TLC5940
 Tlc5940 tlc;
 #endif
 
+#if CONFIG_USE_FEEDBACK
+FeedbackEngine feedback;
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+EventCapture capture(usbCommHandler);
+#endif
+
 
 /* GPIO Macros */
 static int configureGPIOport(void) {
@@ -308,54 +310,6 @@ static int gpio_init(void) {
     return 0;
 }
 
-static int init_sensor_gpio_int(void){
-	int ret = 0;
-
-
-/* Max30102 Interrupt */
-//TODO(bojankoce): Use Zephyr DT (device tree) macros to get GPIO device, port and pin number
-
-#if CONFIG_USE_MAX30102
-    ret += configureGPIO(MAX_INT, GPIO_INPUT | GPIO_PULL_UP);
-    ret += configureInterrupt(MAX_INT, GPIO_INT_EDGE_FALLING);
-    ret += addGPIOCallback(MAX_INT, &max30102_callback, &max30102_irq_cb);
-
-    if (ret != 0){
-        LOG_ERR("%s: ***ERROR: GPIO initialization\n", __func__);
-    } else {
-        LOG_INF("%s: Max30102 Interrupt pin Int'd!", __func__);
-    } 
-#endif
-
-/* MPU6050 Interrupt */
-#if CONFIG_USE_MPU6050
-//TODO(bojankoce): Use Zephyr DT (device tree) macros to get GPIO device, port and pin number
-    ret += configureGPIO(MPU_INT, GPIO_INPUT | GPIO_PULL_UP);
-    ret += configureInterrupt(MPU_INT, GPIO_INT_EDGE_FALLING);
-    ret += addGPIOCallback(MPU_INT, &mpu6050_callback, &mpu6050_irq_cb);
-
-    if (ret != 0){
-        LOG_ERR("%s: ***ERROR: GPIO initialization\n", __func__);
-    } else {
-        LOG_INF("%s: Mpu6050 Interrupt pin Int'd!", __func__);
-    } 
-#endif
-/* QMC5883L Interrupt */
-#if CONFIG_USE_QMC5883L
-//TODO(bojankoce): Use Zephyr DT (device tree) macros to get GPIO device, port and pin number
-    ret += configureGPIO( QMC5883L_DRDY, GPIO_INPUT | GPIO_PULL_DOWN); // Pin P0.2
-    ret += configureInterrupt( QMC5883L_DRDY, GPIO_INT_EDGE_RISING);
-    ret += addGPIOCallback(QMC5883L_DRDY, &qmc5883l_callback, &qmc5883l_irq_cb);
-    if (ret != 0){
-        LOG_ERR("%s: ***ERROR: GPIO initialization\n", __func__);
-    } else {
-        LOG_INF("%s: QMC5883L Interrupt pin Int'd!", __func__);
-    } 
-#endif 
-
-    return ret;
-}
-
 #if CONFIG_USE_ADS131M08
 static int init_ads131_gpio_int(void){
     int ret = 0;
@@ -406,8 +360,8 @@ static int setupadc(ADS131M08 * adc) {
     int reg_value = 0;
     #if CONFIG_USE_ADS131M08
     
-    configureSPS(*&adc, SPS_250_OSR);
-     if(adc->writeReg(ADS131_CLOCK,0b1111111100011111)){  //< Clock register (page 55 in datasheet)
+    configureSPS(*&adc, ADS_OSR);
+     if(adc->writeReg(ADS131_CLOCK,0b1111111100000011 | (ADS_OSR << 2))){  //< Clock register (page 55 in datasheet)
          LOG_INF("ADS131_CLOCK register successfully configured");
      } 
    else {
@@ -470,10 +424,16 @@ static int setupadc(ADS131M08 * adc) {
 }
 
 static void ads131m08_drdy_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins){
+#if CONFIG_USE_EVENT_CAPTURE
+    capture.OnDataReady(0);
+#endif
     k_work_submit(&interrupt_work_item); 
 }
 
 static void ads131m08_1_drdy_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins){
+#if CONFIG_USE_EVENT_CAPTURE
+    capture.OnDataReady(1);
+#endif
     k_work_submit(&ads131m08_1_interrupt_work_item); 
 }
 
@@ -486,8 +446,21 @@ static void ads131m08_1_drdy_cb(const struct device *port, struct gpio_callback
 static void interrupt_workQueue_handler(struct k_work* wrk)
 {	
     uint8_t adcBuffer[(adc.nWordsInFrame * adc.nBytesInWord)] = {0};
+#if CONFIG_USE_EVENT_CAPTURE
+    // Work coalesced after a late run: the older frame is still in the ADC FIFO and is read first
+    for (size_t frames = capture.LatchFrame(0); frames > 0; --frames)
+    {
+        adc.readAllChannels(adcBuffer);
+        // Channel data follows 24-bit status word
+        adsPipeline.PushFrame(0, adcBuffer + 3);
+    }
+#elif CONFIG_USE_ADS131_PIPELINE
     adc.readAllChannels(adcBuffer);
-    
+    // Channel data follows 24-bit status word
+    adsPipeline.PushFrame(0, adcBuffer + 3);
+#else
+    adc.readAllChannels(adcBuffer);
+
     ble_tx_buff[25*i + 24] = sampleNum;
     memcpy((ble_tx_buff + 25*i), (adcBuffer + 3), 24);
 
@@ -500,6 +473,7 @@ static void interrupt_workQueue_handler(struct k_work* wrk)
         usbCommHandler.SendAds131m08Samples(ble_tx_buff, 227, 0);
 #endif        
     }
+#endif
 }
 
 /**
@@ -511,8 +485,18 @@ static void interrupt_workQueue_handler(struct k_work* wrk)
 static void ads131m08_1_interrupt_workQueue_handler(struct k_work* wrk)
 {	
     uint8_t adcBuffer[(adc_1.nWordsInFrame * adc_1.nBytesInWord)] = {0};
+#if CONFIG_USE_EVENT_CAPTURE
+    for (size_t frames = capture.LatchFrame(1); frames > 0; --frames)
+    {
+        adc_1.readAllChannels(adcBuffer);
+        adsPipeline.PushFrame(1, adcBuffer + 3);
+    }
+#elif CONFIG_USE_ADS131_PIPELINE
     adc_1.readAllChannels(adcBuffer);
-    
+    adsPipeline.PushFrame(1, adcBuffer + 3);
+#else
+    adc_1.readAllChannels(adcBuffer);
+
     ads131m08_1_ble_tx_buff[25*j + 24] = ads131m08_1_sampleNum;
     memcpy((ads131m08_1_ble_tx_buff + 25*j), (adcBuffer + 3), 24);
 
@@ -526,65 +510,10 @@ static void ads131m08_1_interrupt_workQueue_handler(struct k_work* wrk)
         usbCommHandler.SendAds131m08Samples(ads131m08_1_ble_tx_buff, 227, 0);
 #endif        
     }
+#endif
 }
 #endif /* CONFIG_USE_ADS131M08_1 */
 
-#if CONFIG_USE_MAX30102
-static void max30102_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins){
-    k_work_submit(&max30102_interrupt_work_item);     
-}
-
-/**
- * @brief IntWorkQueue handler. Used to process interrupts coming from MAX30102 interrupt pin 
- * Because all activity is performed on cooperative level no addition protection against data corruption is required
- * @param wrk work object
- * @warning  Called by system scheduled in cooperative level.
- */
-static void max30102_interrupt_workQueue_handler(struct k_work* wrk)
-{	
-    //LOG_INF("Max30102 Interrupt!");
-    max30102.HandleInterrupt();
-}
-#endif /* CONFIG_USE_MAX30102 */
-
-#if CONFIG_USE_MPU6050
-static void mpu6050_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins){
-    k_work_submit(&mpu6050_interrupt_work_item);     
-}
-
-/**
- * @brief IntWorkQueue handler. Used to process interrupts coming from MPU6050 interrupt pin 
- * Because all activity is performed on cooperative level no addition protection against data corruption is required
- * @param wrk work object
- * @warning  Called by system scheduled in cooperative level.
- */
-static void mpu6050_interrupt_workQueue_handler(struct k_work* wrk)
-{	
-    //LOG_INF("MPU6050 Interrupt!");
-    mpu6050.HandleInterrupt();
-}
-#endif /* CONFIG_USE_MPU6050 */
-
-
-#if CONFIG_USE_QMC5883L
-static void qmc5883l_irq_cb(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins){
-    k_work_submit(&qmc5883l_interrupt_work_item);     
-}
-
-/**
- * @brief IntWorkQueue handler. Used to process interrupts coming from QMC5883L interrupt pin 
- * Because all activity is performed on cooperative level no addition protection against data corruption is required
- * @param wrk work object
- * @warning  Called by system scheduled in cooperative level.
- */
-static void qmc5883l_interrupt_workQueue_handler(struct k_work* wrk)
-{	
-    //LOG_INF("QMC5883L Interrupt!");
-    qmc5883l.HandleInterrupt();
-}
-#endif /* CONFIG_USE_QMC5883L */
-
-
 void uart_poll_buffer(const struct device *dev, const uint8_t *data, size_t size)
 {
     for (size_t i = 0; i < size; i++) {
@@ -610,35 +539,15 @@ static void setupPeripherals()
     setGPIO(GREEN_LED, 0);
     setGPIO(BLUE_LED, 0);
 
-    ret = init_sensor_gpio_int();
-    if (ret == 0){
-        LOG_INF("%s: All GPIOs interrupts Int'd!", __func__);
-    }
-
     #if CONFIG_USE_ADS131M08    
         k_work_init(&interrupt_work_item, interrupt_workQueue_handler);
         k_work_init(&ads131m08_1_interrupt_work_item, ads131m08_1_interrupt_workQueue_handler);
     #endif
 
-    #if CONFIG_USE_MAX30102
-        k_work_init(&max30102_interrupt_work_item, max30102_interrupt_workQueue_handler);
-    #endif
-
-    #if CONFIG_USE_MPU6050
-        k_work_init(&mpu6050_interrupt_work_item, mpu6050_interrupt_workQueue_handler);
-    #endif
-
-    #if CONFIG_USE_QMC5883L
-        k_work_init(&qmc5883l_interrupt_work_item, qmc5883l_interrupt_workQueue_handler);
-    #endif
-
-        if (ret == 0){
-            //LOG_INF("GPIOs Int'd!");        
-        }
-
     #if CONFIG_USE_USB
-        serial.Initialize();
+        // Register receive handler before serial working thread is started
         usbCommHandler.Initialize();
+        serial.Initialize();
     #endif
 
     #if CONFIG_USE_ADS131M08    
@@ -646,46 +555,13 @@ static void setupPeripherals()
         adc_1.init(ADS_1_CS, DATA_READY_1_GPIO, ADS_1_RESET, 8000000); // cs_pin, drdy_pin, sync_rst_pin, 8MHz SPI bus
     #endif
 
-    #if CONFIG_USE_MAX30102
-        max30102.Initialize();
-        if(max30102.IsOnI2cBus()){
-            LOG_DBG("%s: MAX30102 is on I2C bus!", __func__);
-            max30102.Configure(max30102_default_config);
-            max30102.StartSampling();
-        } else {
-            LOG_WRN("%s: ***WARNING: MAX30102 is not connected or properly initialized!", __func__);
-        }
-    #endif
-
-    #if CONFIG_USE_MPU6050
-        mpu6050.Initialize();
-        if(mpu6050.IsOnI2cBus()){
-            LOG_DBG("%s: MPU6050 is on I2C bus!", __func__);
-            mpu6050.Configure(mpu6050_default_config);
-        } else {
-            LOG_WRN("%s: ***WARNING: MPU6050 is not connected or properly initialized!", __func__);
-        }
-    #endif
-
-    #if CONFIG_USE_BME280
-        bme280.Initialize();
-        if(bme280.BmX280IsOnI2cBus()){
-            // LOG_INF("Start BME280 sampling...");
-            bme280.StartSampling();
-        } else {
-            LOG_WRN("%s: ***WARNING: BME280 is not connected or properly initialized!", __func__);
-        }
-    #endif
-
-    #if CONFIG_USE_QMC5883L
-        qmc5883l.Initialize();
-        if(qmc5883l.IsOnI2cBus()){
-            LOG_DBG("%s: QMC5883L is on I2C bus!", __func__);
-            qmc5883l.Configure(qmc5883l_default_config);
-            qmc5883l.StartSampling();
-        } else {
-            LOG_WRN("%s: ***WARNING: QMC5883L is not connected or properly initialized!", __func__);
-        }
+    #if CONFIG_USE_ORIENTATION_FUSION
+        // Fusion must be attached before sensors are configured
+        orientationFusion.Initialize();
+        mpu6050.SetFusion(&orientationFusion);
+        #if CONFIG_USE_QMC5883L
+            qmc5883l.SetFusion(&orientationFusion);
+        #endif
     #endif
 
     #if CONFIG_USE_I2S
@@ -693,14 +569,45 @@ static void setupPeripherals()
         LOG_DBG("%s: audio.Initialize: %d", __func__, ret);
     #endif
 
-    #if CONFIG_USE_DMIC
-        ret = dmic.Initialize();
-        LOG_DBG("%s: dmic.Initialize: %d", __func__, ret);
+    #if CONFIG_USE_FEEDBACK
+        // Feedback must be attached before its producers are started
+        feedback.Initialize();
+        #if CONFIG_USE_I2S
+            feedback.SetAudio(&audio);
+        #endif
+        #if CONFIG_USE_MAX30102 && CONFIG_USE_PPG_PROCESSING
+            max30102.SetFeedback(&feedback);
+        #endif
     #endif
 
+    #if CONFIG_USE_EVENT_CAPTURE
+        // Capture must be attached before its producers are started
+        capture.Initialize(ADS_SAMPLE_RATE);
+        #if CONFIG_USE_MPU6050
+            mpu6050.SetCapture(&capture);
+        #endif
+    #endif
+
+    {
+        auto sensors = MakeSensorRegistry(std::tuple_cat(
+            SENSOR_REGISTRY_ENTRY(CONFIG_USE_MAX30102, max30102)
+            SENSOR_REGISTRY_ENTRY(CONFIG_USE_MPU6050, mpu6050)
+            SENSOR_REGISTRY_ENTRY(CONFIG_USE_BME280, bme280)
+            SENSOR_REGISTRY_ENTRY(CONFIG_USE_QMC5883L, qmc5883l)
+            SENSOR_REGISTRY_ENTRY(CONFIG_USE_DMIC, dmic)
+            std::tuple<>()));
+
+        int total = sensors.Size();
+        ret = sensors.StartAll();
+        LOG_INF("%s: %d of %d sensors started", __func__, total - ret, total);
+    }
+
     #if CONFIG_USE_TLC5940
         ret = tlc.Initialize(0x000);
         LOG_DBG("%s: tlc.Initialize: %d", __func__, ret);
+        #if CONFIG_USE_FEEDBACK
+            feedback.SetLeds(&tlc);
+        #endif
     #endif
 
     #if CONFIG_USE_MCU2MCU
@@ -710,6 +617,29 @@ static void setupPeripherals()
     #if CONFIG_USE_ADS131M08
         setupadc(&adc);
         // setupadc(&adc_1);
+        #if CONFIG_USE_ADS131_PIPELINE
+            adsPipeline.Initialize(ADS_SAMPLE_RATE, CONFIG_ADS131_OUTPUT_RATE);
+            #if CONFIG_ADS131_PIPELINE_BENCHMARK
+                adsPipeline.Benchmark();
+            #endif
+            #if CONFIG_USE_ADS131_BAND_POWER
+                bandPower.Initialize(CONFIG_ADS131_OUTPUT_RATE);
+                adsPipeline.SetBandPower(&bandPower);
+                #if CONFIG_USE_FEEDBACK
+                    bandPower.SetFeedback(&feedback);
+                #endif
+            #endif
+            #if CONFIG_USE_FEEDBACK
+                adsPipeline.SetFeedback(&feedback);
+            #endif
+            #if CONFIG_USE_ADS131_SIGNAL_QUALITY
+                signalQuality.Initialize(ADS_SAMPLE_RATE);
+                adsPipeline.SetSignalQuality(&signalQuality);
+            #endif
+            #if CONFIG_USE_EVENT_CAPTURE
+                adsPipeline.SetCapture(&capture);
+            #endif
+        #endif
         init_ads131_gpio_int();
     #endif
 
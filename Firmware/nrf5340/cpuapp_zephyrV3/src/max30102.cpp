@@ -6,16 +6,39 @@
 //#include <sys/__assert.h>
 #include <stdlib.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "max30102.hpp"
 #include "ble_service.hpp"
 #include "usb_comm_handler.hpp"
+#if CONFIG_USE_PPG_PROCESSING && CONFIG_USE_FEEDBACK
+#include "feedback_engine.hpp"
+#endif
 
 #define DEVICE_NODE DT_BUS(DT_NODELABEL(max30102))
 
 LOG_MODULE_REGISTER(max30102, LOG_LEVEL_INF);
 
-Max30102::Max30102(UsbCommHandler &controller) : serialHandler(controller) {
+namespace
+{
+    const gpio_dt_spec interruptPin = GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), max30102_int_gpios); ///< INT pin
+
+    const max30102_config defaultConfig = {
+        0x80, // Interrupt Config 1. Enable FIFO_A_FULL interrupt
+        MAX30102_INTR_2_DIE_TEMP_RDY_EN, // Interrupt Config 2. Enable temperature ready interrupt
+        0b01111000, // FIFO Config. Average 16 samples, FIFO Rollover Enabled, FIFO_A_FULL interrupt with 8 empty slots (24 samples) to leave margin for late reads
+        0x87, // Mode config. Keep Max30102 shutdown. Multi LED mode .
+        0b01110011, // Sp02 config. 800sps rate, 2048 full scale, 18-bit ADC resolution.
+        {100, 100}, // LED1/LED2 config. 25.4mA typical LED current
+        {0x11, 0x22}  // SLOT config. SLOT1/2 for LED1, SLOT3/4 for LED2.
+    };
+}
+
+#if CONFIG_USE_PPG_PROCESSING
+Max30102::Max30102(UsbCommHandler &controller) : stream(controller), vitalsStream(controller) {
+#else
+Max30102::Max30102(UsbCommHandler &controller) : stream(controller) {
+#endif
     LOG_DBG("Max30102 Constructor!");
 }
 int Max30102::Initialize() {
@@ -46,35 +69,63 @@ int Max30102::Initialize() {
         return -1;
     }
 
-    Reset();
+    EnableRecovery(transport);
+
+    int ret = Reset();
+    if(ret != 0){
+        return ret;
+    }
     k_msleep(5);
     Shutdown();
 
-    Bluetooth::GattRegisterControlCallback(CommandId::Max30102Cmd,
-        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
-        {
-            return OnBleCommand(buffer, key, length, offset);
-        });
+    transport.SetupTransaction(statusTransaction, [this](int status) { OnInterruptStatus(status); });
+    transport.SetupTransaction(pointersTransaction, [this](int status) { OnFifoPointers(status); });
+    transport.SetupTransaction(fifoTransaction, [this](int status) { OnFifoData(status); });
+    transport.SetupTransaction(temperatureTransaction, [this](int status) { OnTemperature(status); }, I2cPriority::Low);
+    transport.SetupTransaction(tempConfigTransaction, [](int status) {}, I2cPriority::Low);
+    // FIFO read pointer advances per whole sample, so the burst could be split at sample boundary
+    fifoTransaction.chunkSize = fifoChunkSamples * sampleSize;
+
+    temperature[0] = 0;
+    temperature[1] = 0;
+    tempConfig = MAX30102_TEMP_CFG_TEMP_EN;
+    sampling.store(false, std::memory_order_relaxed);
+    k_timer_init(&temperatureTimer, &Max30102::TemperatureTimerHandler, nullptr);
+#if CONFIG_USE_PPG_PROCESSING
+    outputMask.store(OutputRaw | OutputVitals, std::memory_order_relaxed);
+#else
+    outputMask.store(OutputRaw, std::memory_order_relaxed);
+#endif
+
+    RegisterCommands(CommandId::Max30102Cmd);
 
     return 0;
 }
 
-bool Max30102::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset){
-    if (offset.value != 0 || length.value == 0)
-    {
-        return false;
+int Max30102::Start(){
+    if(Initialize() != 0 || !IsOnI2cBus()){
+        LOG_WRN("MAX30102 is not connected or properly initialized!");
+        return -1;
     }
-    LOG_DBG("Max30102 BLE Command received");
 
-    Bluetooth::CommandKey bleCommand;
-    memcpy(&bleCommand, &key, sizeof(key));
-          
-    switch(bleCommand.key[0]){
-        case static_cast<uint8_t>(BleCommand::StartSampling):
-            StartSampling();
-            break;
-        case static_cast<uint8_t>(BleCommand::StopSampling):
-            StopSampling();
+    int ret = AttachInterrupt(interruptPin, GPIO_INT_EDGE_FALLING);
+    if(ret != 0){
+        LOG_ERR("Interrupt pin configuration failed: %d", ret);
+        return ret;
+    }
+
+    ret = Configure(defaultConfig);
+    StartSampling();
+    return ret;
+}
+
+bool Max30102::OnCommand(uint8_t key, const uint8_t *buffer, size_t length){
+    LOG_DBG("Max30102 command received");
+
+    switch(key){
+        case static_cast<uint8_t>(Max30102Command::SetOutput):
+            outputMask.store(buffer[0] & (OutputRaw | OutputVitals), std::memory_order_relaxed);
+            LOG_INF("Output mask: 0x%X", buffer[0]);
             break;
         
         default:
@@ -86,6 +137,7 @@ bool Max30102::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bl
 
 int Max30102::Configure(max30102_config config){
     uint8_t status;   
+    activeConfig = config;
     
     transport.WriteRegister(MAX30102_REG_INT_EN1, config.interrupt_config_1);
     transport.WriteRegister(MAX30102_REG_INT_EN2, config.interrupt_config_2);
@@ -98,22 +150,65 @@ int Max30102::Configure(max30102_config config){
     transport.WriteRegister(MAX30102_REG_MULTI_LED2, config.slot_config[1]);
 
     status = transport.GetStatus();
+
+    // FIFO_A_FULL interrupt leaves FIFO_FULL empty slots. Reads have to finish before they are filled
+    uint32_t emptySlots = MAX(1, (config.fifo_config >> MAX30102_FIFO_CFG_FIFO_FULL_SHIFT) & 0x0F);
+    uint32_t deadline = emptySlots * 1000000 / SampleRate(config);
+    statusTransaction.deadlineUs = deadline;
+    pointersTransaction.deadlineUs = deadline;
+    fifoTransaction.deadlineUs = deadline;
+
+#if CONFIG_USE_PPG_PROCESSING
+    ppg.Initialize(SampleRate(config));
+#endif
+
     return status;
 }
 
-void Max30102::Reset() {
-    uint8_t mode_cfg_reg;
+uint32_t Max30102::SampleRate(const max30102_config &config){
+    constexpr static uint32_t adcRates[] = {50, 100, 200, 400, 800, 1000, 1600, 3200};
+    uint32_t rate = adcRates[(config.spo2_config >> MAX30102_SPO2_SR_SHIFT) & 0x07];
+    // SMP_AVE above 5 also averages 32 samples
+    uint32_t averaging = 1 << MIN((config.fifo_config >> MAX30102_FIFO_CFG_SMP_AVE_SHIFT) & 0x07, 5);
+
+    return rate / averaging;
+}
+
+int Max30102::Reset() {
     // Write 1 to RESET bit
     transport.UpdateRegister(MAX30102_REG_MODE_CFG, MAX30102_MODE_CFG_RESET_MASK, MAX30102_MODE_CFG_RESET_MASK);
 
     // Wait for Reset sequence to finish. RESET bit will be cleared
-    do{
-        mode_cfg_reg = transport.ReadRegister(MAX30102_REG_MODE_CFG);
-        k_msleep(5);
-//TODO(bojankoce): We can get stuck here. Implement some timeout before returning reset error!        
-    } while(mode_cfg_reg & MAX30102_MODE_CFG_RESET_MASK);
+    int ret = transport.WaitRegisterClear(MAX30102_REG_MODE_CFG, MAX30102_MODE_CFG_RESET_MASK, resetTimeoutMs);
+    if(ret != 0){
+        LOG_ERR("Max30102 Reset failed: %d", ret);
+        return ret;
+    }
     
     LOG_DBG("Max30102 Reset Success!");
+    return 0;
+}
+
+int Max30102::Recover() {
+    LOG_WRN("Max30102 is not responding, initializing again");
+    k_timer_stop(&temperatureTimer);
+
+    // Reset releases interrupt pin, so interrupt chain broken by failed transfer starts again
+    int ret = Reset();
+    if(ret == 0){
+        ret = Configure(activeConfig);
+    }
+    if(ret != 0){
+        LOG_ERR("Max30102 recovery failed: %d", ret);
+        return ret;
+    }
+
+    if(sampling.load(std::memory_order_relaxed)){
+        StartSampling();
+    }
+
+    LOG_INF("Max30102 recovered");
+    return 0;
 }
 
 void Max30102::Shutdown() {
@@ -128,28 +223,52 @@ void Max30102::Wakeup() {
 }
 
 void Max30102::StartSampling(){
+    sampling.store(true, std::memory_order_relaxed);
+    // Clear FIFO pointers and overflow counter, as recommended in datasheet, so samples start from empty FIFO
+    transport.WriteRegister(MAX30102_REG_FIFO_WR, 0x00);
+    transport.WriteRegister(MAX30102_REG_FIFO_OVF, 0x00);
+    transport.WriteRegister(MAX30102_REG_FIFO_RD, 0x00);
     // Write 0 into SHDN bit of Mode Configuration register
     transport.UpdateRegister(MAX30102_REG_MODE_CFG, MAX30102_MODE_CFG_SHDN_MASK, 0x00);
+    InitiateTemperatureReading();
+    k_timer_start(&temperatureTimer, K_MSEC(temperaturePeriod), K_MSEC(temperaturePeriod));
 }   
 
 void Max30102::StopSampling(){
+    sampling.store(false, std::memory_order_relaxed);
+    k_timer_stop(&temperatureTimer);
     // Write 1 into SHDN bit of Mode Configuration register
     transport.UpdateRegister(MAX30102_REG_MODE_CFG, MAX30102_MODE_CFG_SHDN_MASK, MAX30102_MODE_CFG_SHDN_MASK);
 }
 
 void Max30102::InitiateTemperatureReading(){
-    transport.WriteRegister(MAX30102_REG_TEMP_CFG, MAX30102_TEMP_CFG_TEMP_EN);
+    transport.WriteRegistersAsync(tempConfigTransaction, MAX30102_REG_TEMP_CFG, &tempConfig, 1);
 }   
 
+void Max30102::TemperatureTimerHandler(k_timer *tmr){
+    Max30102 *self = CONTAINER_OF(tmr, Max30102, temperatureTimer);
+    self->InitiateTemperatureReading();
+}
+
 void Max30102::HandleInterrupt(){
     //LOG_INF("Handling Max30102 interrupt!");
-    uint8_t int_reason;
-    int_reason = transport.ReadRegister(MAX30102_REG_INT_STS1);
+    // Both status registers are read with one transfer. Interrupt reason is handled when data is available
+    if(!transport.ReadRegistersAsync(statusTransaction, MAX30102_REG_INT_STS1, interruptStatus, sizeof(interruptStatus))){
+        LOG_DBG("Status read is already pending");
+    }
+} 
+
+void Max30102::OnInterruptStatus(int status){
+    if(status != 0){
+        LOG_WRN("Interrupt status read failed: %d", status);
+        return;
+    }
+
+    uint8_t int_reason = interruptStatus[0];
     
     if(int_reason & FIFO_A_FULL_MASK){
-        transport.ReadRegisters(MAX30102_REG_FIFO_DATA, (tx_buf + 1), 192);
-        //LOG_INF("tx_buf: 0x%X 0x%X 0x%X", tx_buf[0], tx_buf[1], tx_buf[2]);
-        InitiateTemperatureReading();
+        // Number of available samples is taken from FIFO pointers, so late interrupt does not lose samples
+        transport.ReadRegistersAsync(pointersTransaction, MAX30102_REG_FIFO_WR, fifoPointers, sizeof(fifoPointers));
     }
 
     if(int_reason & PPG_RDY_MASK){
@@ -164,26 +283,106 @@ void Max30102::HandleInterrupt(){
         LOG_DBG("Power Ready!");
     }
 
-    int_reason = transport.ReadRegister(MAX30102_REG_INT_STS2);
+    int_reason = interruptStatus[1];
 
     if(int_reason & DIE_TEMP_RDY_MASK){
         //LOG_DBG("Temperature Ready!");
-        TemperatureRead();
-        Bluetooth::Max30102Notify(tx_buf, 195);
-        serialHandler.SendMax30102Samples(tx_buf, 195);
+        transport.ReadRegistersAsync(temperatureTransaction, MAX30102_REG_TINT, temperature, sizeof(temperature));
+    }
+}
+
+void Max30102::OnFifoPointers(int status){
+    if(status != 0){
+        LOG_WRN("FIFO pointers read failed: %d", status);
+        return;
+    }
+
+    uint8_t write_ptr = fifoPointers[0] & (fifoDepth - 1);
+    uint8_t overflow = fifoPointers[1] & (fifoDepth - 1);
+    uint8_t read_ptr = fifoPointers[2] & (fifoDepth - 1);
+
+    // Equal pointers mean empty FIFO, unless samples were lost because FIFO was full
+    fifoSamples = (write_ptr - read_ptr) & (fifoDepth - 1);
+    if(fifoSamples == 0 && overflow != 0){
+        fifoSamples = fifoDepth;
+    }
+
+    if(overflow != 0){
+        LOG_DBG("FIFO overflow: %u samples lost", overflow);
+    }
+
+    if(fifoSamples == 0){
+        return;
+    }
+
+    tx_buf[1] = overflow;
+    transport.ReadRegistersAsync(fifoTransaction, MAX30102_REG_FIFO_DATA, (tx_buf + headerSize), fifoSamples * sampleSize);
+}
+
+void Max30102::OnFifoData(int status){
+    if(status != 0){
+        LOG_WRN("FIFO read failed: %d", status);
+        return;
+    }
+
+    //LOG_INF("tx_buf: 0x%X 0x%X 0x%X", tx_buf[0], tx_buf[1], tx_buf[2]);
+    uint8_t output = outputMask.load(std::memory_order_relaxed);
+
+    if(output & OutputVitals){
+        ProcessSamples(fifoSamples);
+    }
+
+    if(output & OutputRaw){
+        size_t length = headerSize + fifoSamples * sampleSize;
+        tx_buf[0] = packet_cnt;
+        tx_buf[2] = temperature[0];
+        tx_buf[3] = temperature[1];
+        packet_cnt++;
+        stream.Publish(tx_buf, length);
+    }
+}
+
+void Max30102::ProcessSamples(size_t samples){
+#if CONFIG_USE_PPG_PROCESSING
+    const uint8_t *sample = tx_buf + headerSize;
+    PpgProcessor::Vitals vitals;
+
+    for(size_t i = 0; i < samples; i++, sample += sampleSize){
+        // LED1 (Red) is followed by LED2 (IR), both 18-bit big endian
+        uint32_t red = sys_get_be24(sample) & MAX30102_FIFO_DATA_MASK;
+        uint32_t ir = sys_get_be24(sample + MAX30102_BYTES_PER_CHANNEL) & MAX30102_FIFO_DATA_MASK;
+
+        ppg.Process(red, ir);
+
+        if(ppg.GetVitals(vitals)){
+            LOG_DBG("HR: %u, SpO2: %u, quality: %u, cycles: %u", vitals.heartRate, vitals.spo2, vitals.quality, ppg.GetMaxCycles());
+            vitalsStream.Publish(reinterpret_cast<const uint8_t*>(&vitals), sizeof(vitals));
+#if CONFIG_USE_FEEDBACK
+            // Heart rate is 0 when signal quality is too low
+            if(feedback != nullptr && vitals.heartRate != 0){
+                feedback->OnHeartRate(vitals.heartRate, LatencyMeter::Stamp());
+            }
+#endif
+        }
+    }
+#else
+    ARG_UNUSED(samples);
+#endif
+}
+
+#if CONFIG_USE_PPG_PROCESSING && CONFIG_USE_FEEDBACK
+void Max30102::SetFeedback(FeedbackEngine *engine){
+    feedback = engine;
+}
+#endif
+
+void Max30102::OnTemperature(int status){
+    if(status != 0){
+        LOG_WRN("Temperature read failed: %d", status);
+        return;
     }
-} 
 
-void Max30102::TemperatureRead(){
-    uint8_t tint;
-    uint8_t tfrac;
-    tint = transport.ReadRegister(MAX30102_REG_TINT);
-    tfrac = transport.ReadRegister(MAX30102_REG_TFRAC);
-    //LOG_DBG("Temperature: %d, %d", tint, tfrac);
-    tx_buf[193] = tint;
-    tx_buf[194] = tfrac;
-    tx_buf[0] = packet_cnt;            
-    packet_cnt++;
+    //LOG_DBG("Temperature: %d, %d", temperature[0], temperature[1]);
 }
 
 bool Max30102::IsOnI2cBus(){
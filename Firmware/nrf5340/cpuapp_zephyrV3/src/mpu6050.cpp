@@ -10,12 +10,53 @@
 #include "mpu6050.hpp"
 #include "ble_service.hpp"
 #include "usb_comm_handler.hpp"
+#if CONFIG_USE_ORIENTATION_FUSION
+#include "orientation_fusion.hpp"
+#endif
+#if CONFIG_USE_EVENT_CAPTURE
+#include "event_capture.hpp"
+#endif
 
 #define DEVICE_NODE DT_NODELABEL(i2c1)
 
 LOG_MODULE_REGISTER(mpu6050, LOG_LEVEL_INF);
 
-Mpu6050::Mpu6050(UsbCommHandler &controller) : serialHandler(controller) {
+namespace
+{
+    const gpio_dt_spec interruptPin = GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), mpu6050_int_gpios); ///< INT pin
+
+#if CONFIG_MPU6050_FIFO_MODE
+    BUILD_ASSERT(1000 % CONFIG_MPU6050_SAMPLE_RATE == 0, "CONFIG_MPU6050_SAMPLE_RATE must divide 1000 Hz");
+
+    const mpu6050_config defaultConfig = {
+        .sample_rate_config = (1000 / CONFIG_MPU6050_SAMPLE_RATE) - 1, // Sample rate = 1kHz / (1 + SMPLRT_DIV)
+        .config_reg = 0x01,             // FSYNC disabled. Digital Low Pass filter enabled. 
+        .gyro_config = (0x01 << 3),     // 500dps Gyro Full Scale. No Self-Tests.
+        .accel_config = (0x01 << 3),    // +/-4g Accel Full Scale. No Self-Tests. 
+        .fifo_config = 0x78,            // Store Accel and XYZ Gyro samples to FIFO.
+        .interrupt_pin_config = 0xC0,    // INT active low. Open drain. Keep interrupt pin active until interrupt is cleared. Clear interrupt only by reading INT_STATUS register.
+        .interrupt_config = 0x10,       // Enable only FIFO overflow interrupts. FIFO is polled.
+        .user_control = 0x40,           // Enable FIFO
+        .pwr_mgmt_1 = 0x01,             // Use PLL with X axis gyroscope as Clock Source.
+        .pwr_mgmt_2 = 0x00              // Don't use Accelerometer only Low Power mode. XYZ axes of Gyro and Accel enabled. 
+    };
+#else
+    const mpu6050_config defaultConfig = {
+        .sample_rate_config = 0x09,     // Sample rate = 100Hz
+        .config_reg = 0x01,             // FSYNC disabled. Digital Low Pass filter enabled. 
+        .gyro_config = (0x01 << 3),     // 500dps Gyro Full Scale. No Self-Tests.
+        .accel_config = (0x01 << 3),    // +/-4g Accel Full Scale. No Self-Tests. 
+        .fifo_config = 0x00,            // FIFO disabled.
+        .interrupt_pin_config = 0xC0,    // INT active low. Open drain. Keep interrupt pin active until interrupt is cleared. Clear interrupt only by reading INT_STATUS register.
+        .interrupt_config = 0x01,       // Enable only Data Ready interrupts.
+        .user_control = 0x00,           // Disable FIFO
+        .pwr_mgmt_1 = 0x01,             // Use PLL with X axis gyroscope as Clock Source.
+        .pwr_mgmt_2 = 0x00              // Don't use Accelerometer only Low Power mode. XYZ axes of Gyro and Accel enabled. 
+    };
+#endif /* CONFIG_MPU6050_FIFO_MODE */
+}
+
+Mpu6050::Mpu6050(UsbCommHandler &controller) : stream(controller) {
     LOG_DBG("Mpu6050 Constructor!");
 }
 
@@ -41,49 +82,58 @@ int Mpu6050::Initialize() {
         LOG_ERR("Wrong ID: 0x%X", part_id);
         return -1;
     }
+
+    EnableRecovery(transport);
+
     /* wake up chip */
     Wakeup();
-    Reset();
+    int ret = Reset();
+    if(ret != 0){
+        return ret;
+    }
     k_msleep(5);
 //    Shutdown();
 
-    Bluetooth::GattRegisterControlCallback(CommandId::Mpu6050Cmd,
-        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
-        {
-            return OnBleCommand(buffer, key, length, offset);
-        });
+    // DATA_RDY reads must finish before the next sample, FIFO reads only before the FIFO fills up
+    transport.SetupTransaction(dataTransaction, [this](int status) { OnSensorData(status); }, I2cPriority::High);
+    transport.SetupTransaction(fifoCountTransaction, [this](int status) { OnFifoCount(status); });
+    transport.SetupTransaction(fifoDataTransaction, [this](int status) { OnFifoData(status); });
+    transport.SetupTransaction(fifoTempTransaction, [this](int status) { OnFifoTemperature(status); });
+    transport.SetupTransaction(fifoResetTransaction, [this](int status) { OnFifoReset(status); });
+    fifoDataTransaction.chunkSize = fifoChunkSamples * fifoSampleSize;
+
+    k_timer_init(&fifoTimer, &Mpu6050::FifoTimerHandler, nullptr);
+    fifoBusy.store(false, std::memory_order_relaxed);
+    fifoOverflow.store(false, std::memory_order_relaxed);
+    fifoOverflows.store(0, std::memory_order_relaxed);
+
+    RegisterCommands(CommandId::Mpu6050Cmd);
 
     return 0;
 }
 
-bool Mpu6050::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset){
-    if (offset.value != 0 || length.value == 0)
-    {
-        return false;
+int Mpu6050::Start(){
+    if(Initialize() != 0 || !IsOnI2cBus()){
+        LOG_WRN("MPU6050 is not connected or properly initialized!");
+        return -1;
     }
-    LOG_DBG("Mpu6050 BLE Command received");
 
-    Bluetooth::CommandKey bleCommand;
-    memcpy(&bleCommand, &key, sizeof(key));
-          
-    switch(bleCommand.key[0]){
-        case static_cast<uint8_t>(BleCommand::StartSampling):
-            StartSampling();
-            break;
-        case static_cast<uint8_t>(BleCommand::StopSampling):
-            StopSampling();
-            break;
-        
-        default:
-            break;
+    int ret = AttachInterrupt(interruptPin, GPIO_INT_EDGE_FALLING);
+    if(ret != 0){
+        LOG_ERR("Interrupt pin configuration failed: %d", ret);
+        return ret;
     }
-    
-    return true;
+
+    return Configure(defaultConfig);
 }
 
 int Mpu6050::Configure(mpu6050_config config){
     uint8_t status;   
     
+    k_timer_stop(&fifoTimer);
+    activeConfig = config;
+    fifoMode = config.user_control & BIT(MPU6050_USERCTRL_FIFO_EN_BIT);
+
     transport.WriteRegister(MPU6050_RA_SMPLRT_DIV, config.sample_rate_config);
     transport.WriteRegister(MPU6050_RA_CONFIG, config.config_reg);
     transport.WriteRegister(MPU6050_RA_GYRO_CONFIG, config.gyro_config);
@@ -96,23 +146,255 @@ int Mpu6050::Configure(mpu6050_config config){
     transport.WriteRegister(MPU6050_RA_PWR_MGMT_2, config.pwr_mgmt_2);
 
     status = transport.GetStatus();
+
+    dataTransaction.deadlineUs = 1000000 / SampleRate(config);
+
+#if CONFIG_USE_ORIENTATION_FUSION
+    if(fusion != nullptr){
+        // LSB per deg/s halves with every FS_SEL step starting from 131 at +-250 deg/s
+        uint8_t fsSel = (config.gyro_config >> (MPU6050_GCONFIG_FS_SEL_BIT + 1 - MPU6050_GCONFIG_FS_SEL_LENGTH)) & 0x03;
+        fusion->SetImuConfig(SampleRate(config), 131.0f / (1 << fsSel));
+    }
+#endif
+
+    if(fifoMode && status == 0){
+        // FIFO_RESET takes effect only while FIFO_EN is cleared
+        uint8_t disabled = config.user_control & ~BIT(MPU6050_USERCTRL_FIFO_EN_BIT);
+        transport.WriteRegister(MPU6050_RA_USER_CTRL, disabled);
+        transport.WriteRegister(MPU6050_RA_USER_CTRL, disabled | BIT(MPU6050_USERCTRL_FIFO_RESET_BIT));
+        transport.WriteRegister(MPU6050_RA_USER_CTRL, config.user_control);
+        StartFifoPolling(config);
+    }
+
     return status;
 }
 
-void Mpu6050::Reset() {
-    uint8_t user_ctrl_reg;
+uint32_t Mpu6050::SampleRate(const mpu6050_config &config){
+    uint8_t dlpf = config.config_reg & 0x07;
+    // Gyro output rate is 8kHz when DLPF is disabled, 1kHz otherwise
+    uint32_t gyroRate = (dlpf == 0 || dlpf == 7) ? 8000 : 1000;
+    return gyroRate / (1 + config.sample_rate_config);
+}
+
+void Mpu6050::StartFifoPolling(const mpu6050_config &config){
+    uint32_t sampleRate = SampleRate(config);
+    uint32_t period = MAX(1, samplesPerFifoPoll * 1000 / sampleRate);
+
+    samplePeriodUs = USEC_PER_SEC / sampleRate;
+    sample_cnt = 0;
+    fifoAvailable = 0;
+    fifoBusy.store(false, std::memory_order_relaxed);
+    fifoOverflow.store(false, std::memory_order_relaxed);
+    fifoOverflows.store(0, std::memory_order_relaxed);
+
+    fifoCountTransaction.deadlineUs = period * 1000;
+    fifoDataTransaction.deadlineUs = period * 1000;
+    fifoTempTransaction.deadlineUs = period * 1000;
+
+    LOG_INF("FIFO mode: %u Hz, polled every %u ms", sampleRate, period);
+    k_timer_start(&fifoTimer, K_MSEC(period), K_MSEC(period));
+}
+
+void Mpu6050::FifoTimerHandler(k_timer *tmr){
+    Mpu6050 *self = CONTAINER_OF(tmr, Mpu6050, fifoTimer);
+
+    if(self->fifoBusy.exchange(true, std::memory_order_acq_rel)){
+        return;
+    }
+
+    if(!self->transport.ReadRegistersAsync(self->fifoCountTransaction, MPU6050_RA_FIFO_COUNTH, self->fifoCount, sizeof(self->fifoCount))){
+        self->fifoBusy.store(false, std::memory_order_release);
+    }
+}
+
+void Mpu6050::OnFifoCount(int status){
+    if(status != 0){
+        LOG_WRN("FIFO count read failed: %d", status);
+        fifoBusy.store(false, std::memory_order_release);
+        return;
+    }
+
+    uint32_t count = (fifoCount[0] << 8) | fifoCount[1];
+
+    // Full FIFO has lost samples and misaligned count means FIFO content is no longer sample aligned
+    if(fifoOverflow.exchange(false, std::memory_order_relaxed) || count > fifoSize - fifoSampleSize || (count % fifoSampleSize) != 0){
+        // FIFO stays busy until the reset writes complete
+        ResetFifo();
+        return;
+    }
+
+    fifoAvailable = count / fifoSampleSize;
+
+    // MPU6050 has no FIFO watermark interrupt, so the count read anchors the burst: the newest sample was taken
+    // within the last sample period, the others one period apart before it
+    int64_t now = static_cast<int64_t>(k_ticks_to_us_floor64(k_uptime_ticks()));
+    fifoSampleUs = now - samplePeriodUs / 2 - (static_cast<int64_t>(fifoAvailable) - 1) * samplePeriodUs;
+
+    ReadFifoSamples();
+}
+
+void Mpu6050::ReadFifoSamples(){
+    if(fifoAvailable == 0){
+        fifoBusy.store(false, std::memory_order_release);
+        return;
+    }
+
+    // Samples are read straight to packet buffer. FIFO order (accel, gyro) matches packet layout
+    fifoRequested = MIN(fifoAvailable, samplesPerPacket - sample_cnt);
+    fifoAvailable -= fifoRequested;
+
+    if(!transport.ReadRegistersAsync(fifoDataTransaction, MPU6050_RA_FIFO_R_W, tx_buf + fifoSampleSize*sample_cnt + 1, fifoSampleSize*fifoRequested)){
+        fifoAvailable = 0;
+        fifoBusy.store(false, std::memory_order_release);
+    }
+}
+
+void Mpu6050::OnFifoData(int status){
+    if(status != 0){
+        LOG_WRN("FIFO read failed: %d", status);
+        fifoAvailable = 0;
+        fifoBusy.store(false, std::memory_order_release);
+        return;
+    }
+
+#if CONFIG_USE_ORIENTATION_FUSION
+    if(fusion != nullptr){
+        for(size_t i = sample_cnt; i < sample_cnt + fifoRequested; i++){
+            fusion->UpdateImu(tx_buf + fifoSampleSize*i + 1, fifoSampleUs);
+            fifoSampleUs += samplePeriodUs;
+        }
+    }
+#endif
+
+    sample_cnt += fifoRequested;
+    if(sample_cnt < samplesPerPacket){
+        ReadFifoSamples();
+        return;
+    }
+
+    // Temperature is not stored to FIFO, so it is read once per packet
+    if(!transport.ReadRegistersAsync(fifoTempTransaction, MPU6050_RA_TEMP_OUT_H, tx_buf + fifoSampleSize*samplesPerPacket + 1, 2)){
+        sample_cnt = 0;
+        fifoAvailable = 0;
+        fifoBusy.store(false, std::memory_order_release);
+    }
+}
+
+void Mpu6050::OnFifoTemperature(int status){
+    if(status != 0){
+        LOG_WRN("Temperature read failed: %d", status);
+    } else {
+        tx_buf[0] = packet_cnt;            
+        packet_cnt++;
+        PublishPacket();
+    }
+
+    sample_cnt = 0;
+    ReadFifoSamples();
+}
+
+void Mpu6050::ResetFifo(){
+    uint32_t overflows = fifoOverflows.fetch_add(1, std::memory_order_relaxed) + 1;
+    LOG_WRN("FIFO overflow, resetting FIFO (%u)", overflows);
+
+    sample_cnt = 0;
+    fifoAvailable = 0;
+    fifoResetStep = 0;
+    OnFifoReset(0);
+}
+
+void Mpu6050::OnFifoReset(int status){
+    if(status != 0){
+        // FIFO may be left disabled, the next poll starts the reset again
+        LOG_WRN("FIFO reset failed: %d", status);
+        fifoOverflow.store(true, std::memory_order_relaxed);
+        fifoBusy.store(false, std::memory_order_release);
+        return;
+    }
+
+    // FIFO_RESET takes effect only while FIFO_EN is cleared: disable FIFO, reset it, enable it again
+    uint8_t disabled = activeConfig.user_control & ~BIT(MPU6050_USERCTRL_FIFO_EN_BIT);
+    switch(fifoResetStep++){
+    case 0:
+        userControl = disabled;
+        break;
+    case 1:
+        userControl = disabled | BIT(MPU6050_USERCTRL_FIFO_RESET_BIT);
+        break;
+    case 2:
+        userControl = activeConfig.user_control;
+        break;
+    default:
+        fifoBusy.store(false, std::memory_order_release);
+        return;
+    }
+
+    if(!transport.WriteRegistersAsync(fifoResetTransaction, MPU6050_RA_USER_CTRL, &userControl, 1)){
+        fifoOverflow.store(true, std::memory_order_relaxed);
+        fifoBusy.store(false, std::memory_order_release);
+    }
+}
+
+uint32_t Mpu6050::GetFifoOverflows(){
+    return fifoOverflows.load(std::memory_order_relaxed);
+}
+
+#if CONFIG_USE_ORIENTATION_FUSION
+void Mpu6050::SetFusion(OrientationFusion *filter){
+    fusion = filter;
+}
+#endif
+
+#if CONFIG_USE_EVENT_CAPTURE
+void Mpu6050::SetCapture(EventCapture *events){
+    capture = events;
+}
+#endif
+
+void Mpu6050::PublishPacket(){
+#if CONFIG_USE_EVENT_CAPTURE
+    if(capture != nullptr && capture->HoldImu(tx_buf, 243)){
+        return;
+    }
+#endif
+    stream.Publish(tx_buf, 243);
+}
+
+int Mpu6050::Reset() {
     // Write 1 to SIG_COND_RESET bit. This will reset signal paths for all sensors and also clear the sensor registers.
     transport.UpdateRegister(MPU6050_RA_USER_CTRL, BIT(MPU6050_USERCTRL_SIG_COND_RESET_BIT), 0xFF);    
     // Wait for Reset sequence to finish. SIG_COND_RESET bit will be cleared
-    do{
-        user_ctrl_reg = transport.ReadRegister(MPU6050_RA_USER_CTRL);
-        k_msleep(5);
-//TODO(bojankoce): We can get stuck here. Implement some timeout before returning reset error!        
-    } while(user_ctrl_reg & BIT(MPU6050_USERCTRL_SIG_COND_RESET_BIT));
+    int ret = transport.WaitRegisterClear(MPU6050_RA_USER_CTRL, BIT(MPU6050_USERCTRL_SIG_COND_RESET_BIT), resetTimeoutMs);
+    if(ret != 0){
+        LOG_ERR("Mpu6050 Reset failed: %d", ret);
+        return ret;
+    }
 
     //transport.WriteRegister(MPU6050_RA_SIGNAL_PATH_RESET, 0x07); // GYRO_RESET, ACCEL_RESET, TEMP_RESET
 
     LOG_DBG("Mpu6050 Reset Success!");
+    return 0;
+}
+
+int Mpu6050::Recover() {
+    LOG_WRN("Mpu6050 is not responding, initializing again");
+    k_timer_stop(&fifoTimer);
+
+    Wakeup();
+    int ret = Reset();
+    if(ret == 0){
+        ret = Configure(activeConfig);
+    }
+    if(ret != 0){
+        LOG_ERR("Mpu6050 recovery failed: %d", ret);
+        return ret;
+    }
+
+    // Latched Data Ready interrupt of a failed read is cleared, so interrupt pin can fire again
+    transport.ReadRegister(MPU6050_RA_INT_STATUS);
+
+    LOG_INF("Mpu6050 recovered");
+    return 0;
 }
 
 void Mpu6050::Shutdown() {
@@ -139,34 +421,50 @@ void Mpu6050::GetDieTemperature(){
 
 void Mpu6050::HandleInterrupt(){
     //LOG_INF("Handling Max30102 interrupt!");
-    uint8_t int_reason;
-    int_reason = transport.ReadRegister(MPU6050_RA_INT_STATUS);
+    // Interrupt status is followed by accel, temperature and gyro registers, so everything is read with one transfer
+    sampleTimeUs = InterruptTimeUs();
+    transport.ReadRegistersAsync(dataTransaction, MPU6050_RA_INT_STATUS, sensorData, sizeof(sensorData));
+} 
+
+void Mpu6050::OnSensorData(int status){
+    if(status != 0){
+        LOG_WRN("Sensor data read failed: %d", status);
+        return;
+    }
+
+    uint8_t int_reason = sensorData[0];
+    const uint8_t *accel = sensorData + (MPU6050_RA_ACCEL_XOUT_H - MPU6050_RA_INT_STATUS);
+    const uint8_t *temp = sensorData + (MPU6050_RA_TEMP_OUT_H - MPU6050_RA_INT_STATUS);
+    const uint8_t *gyro = sensorData + (MPU6050_RA_GYRO_XOUT_H - MPU6050_RA_INT_STATUS);
     
     if(int_reason & BIT(MPU6050_INTERRUPT_FIFO_OFLOW_BIT)){
-        //transport.ReadRegisters(MAX30102_REG_FIFO_DATA, tx_buf, 192);        
-        //InitiateTemperatureReading();
         LOG_DBG("FIFO overflow!");
+        // FIFO is reset by the next FIFO poll, so reset does not interleave with FIFO read in progress
+        fifoOverflow.store(true, std::memory_order_relaxed);
     }
 
     if(int_reason & BIT(MPU6050_INTERRUPT_I2C_MST_INT_BIT)){
         LOG_DBG("I2C master interrupt!");
     }
 
-    if(int_reason & BIT(MPU6050_INTERRUPT_DATA_RDY_BIT)){
+    if(!fifoMode && (int_reason & BIT(MPU6050_INTERRUPT_DATA_RDY_BIT))){
         //LOG_INF("Data Ready interrupt!");
         // Store Accel and Gyro samples
-        transport.ReadRegisters(MPU6050_RA_ACCEL_XOUT_H, (tx_buf + 12*sample_cnt + 1), 6);
-        transport.ReadRegisters(MPU6050_RA_GYRO_XOUT_H, (tx_buf + 12*sample_cnt + 7), 6);
+        memcpy(tx_buf + 12*sample_cnt + 1, accel, 6);
+        memcpy(tx_buf + 12*sample_cnt + 7, gyro, 6);
+#if CONFIG_USE_ORIENTATION_FUSION
+        if(fusion != nullptr){
+            fusion->UpdateImu(tx_buf + 12*sample_cnt + 1, sampleTimeUs);
+        }
+#endif
         sample_cnt++;
         if(sample_cnt == 20){
             //Store Temperature reading
-            transport.ReadRegisters(MPU6050_RA_TEMP_OUT_H, (tx_buf + 12*sample_cnt + 1), 2);
+            memcpy(tx_buf + 12*sample_cnt + 1, temp, 2);
             tx_buf[0] = packet_cnt;            
             packet_cnt++;
             sample_cnt = 0;
-            //TODO(bojankoce): Send BLE notification!            
-            Bluetooth::Mpu6050Notify(tx_buf, 243);
-            serialHandler.SendAccelSamples(tx_buf, 243);
+            PublishPacket();
         }
     }
 } 
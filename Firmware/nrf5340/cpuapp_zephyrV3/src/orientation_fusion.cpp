@@ -0,0 +1,382 @@
+#include "orientation_fusion.hpp"
+
+#if CONFIG_USE_ORIENTATION_FUSION
+
+#include <math.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "ble_service.hpp"
+#include "usb_comm_handler.hpp"
+
+LOG_MODULE_REGISTER(orientation_fusion, LOG_LEVEL_INF);
+
+namespace
+{
+    constexpr static float degreesToRadians = 3.14159265f / 180.0f;
+    constexpr static float quaternionScale = 1 << 14; ///< Quaternion components are sent as Q14
+}
+
+/**
+ * @brief Construct OrientationFusion
+ *
+ * @param controller USB communication controller
+ */
+OrientationFusion::OrientationFusion(UsbCommHandler &controller) : stream(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Registers BLE command handler
+ */
+void OrientationFusion::Initialize()
+{
+    q[0] = 1.0f;
+    q[1] = q[2] = q[3] = 0.0f;
+    beta = defaultBeta;
+    magnetometerValid = false;
+    samplesSinceOutput = 0;
+    counter = 0;
+    maxCycles = 0;
+
+    outputRate.store(CONFIG_ORIENTATION_OUTPUT_RATE, std::memory_order_relaxed);
+    pendingBeta.store(0, std::memory_order_relaxed);
+    resetRequested.store(false, std::memory_order_relaxed);
+
+    // Defaults of MPU6050 after reset: 1 kHz / (1 + 0), +-250 deg/s
+    SetImuConfig(1000, 131.0f);
+
+    Bluetooth::GattRegisterControlCallback(CommandId::OrientationCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+}
+
+/**
+ * @brief Set accel/gyro sample rate and gyro scale. Called by MPU6050 driver on configuration
+ *
+ * @param rate accel and gyro sample rate, Hz
+ * @param gyroLsbPerDps gyro sensitivity, LSB per degree per second
+ */
+void OrientationFusion::SetImuConfig(uint32_t rate, float gyroLsbPerDps)
+{
+    sampleRate = MAX(rate, 1u);
+    dt = 1.0f / sampleRate;
+    gyroScale = degreesToRadians / gyroLsbPerDps;
+
+    LOG_INF("Fusion at %u Hz, output %u Hz", sampleRate, outputRate.load(std::memory_order_relaxed));
+}
+
+bool OrientationFusion::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    if (offset.value != 0)
+    {
+        return false;
+    }
+
+    // Parameters are applied by the I2C queue thread on the next sample
+    switch (static_cast<OrientationCommand>(key.key[0]))
+    {
+    case OrientationCommand::SetRate:
+        if (length.value < 1)
+        {
+            return false;
+        }
+        outputRate.store(buffer[0], std::memory_order_relaxed);
+        LOG_INF("Output rate %u Hz", buffer[0]);
+        break;
+
+    case OrientationCommand::SetGain:
+        if (length.value < 2 || sys_get_le16(buffer) == 0)
+        {
+            return false;
+        }
+        pendingBeta.store(sys_get_le16(buffer), std::memory_order_relaxed);
+        break;
+
+    case OrientationCommand::Reset:
+        resetRequested.store(true, std::memory_order_relaxed);
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Store latest magnetometer sample
+ *
+ * @param sample QMC5883L sample: XYZ, int16 little endian
+ * @param timeUs uptime when the sample was taken, µs
+ */
+void OrientationFusion::UpdateMagnetometer(const uint8_t *sample, int64_t timeUs)
+{
+    for (size_t i = 0; i < 3; ++i)
+    {
+        magnetometer[i] = static_cast<int16_t>(sys_get_le16(sample + 2 * i));
+    }
+    magnetometerTimeUs = timeUs;
+    magnetometerValid = true;
+}
+
+/**
+ * @brief Update filter with accel and gyro sample
+ *
+ * @param sample MPU6050 sample: accel XYZ followed by gyro XYZ, int16 big endian
+ * @param timeUs uptime when the sample was taken, µs
+ */
+void OrientationFusion::UpdateImu(const uint8_t *sample, int64_t timeUs)
+{
+    uint32_t start = k_cycle_get_32();
+
+    if (resetRequested.exchange(false, std::memory_order_relaxed))
+    {
+        q[0] = 1.0f;
+        q[1] = q[2] = q[3] = 0.0f;
+    }
+
+    uint16_t gain = pendingBeta.exchange(0, std::memory_order_relaxed);
+    if (gain != 0)
+    {
+        beta = gain * 0.001f;
+    }
+
+    float ax = static_cast<int16_t>(sys_get_be16(sample));
+    float ay = static_cast<int16_t>(sys_get_be16(sample + 2));
+    float az = static_cast<int16_t>(sys_get_be16(sample + 4));
+    float gx = static_cast<int16_t>(sys_get_be16(sample + 6)) * gyroScale;
+    float gy = static_cast<int16_t>(sys_get_be16(sample + 8)) * gyroScale;
+    float gz = static_cast<int16_t>(sys_get_be16(sample + 10)) * gyroScale;
+
+    // Stale magnetometer sample would pull heading towards old direction, so filter continues on accel and gyro only.
+    // A FIFO burst is read after the magnetometer samples taken meanwhile, so the difference can be negative
+    int64_t age = timeUs - magnetometerTimeUs;
+    bool useMagnetometer = magnetometerValid && age < magnetometerTimeoutUs && age > -magnetometerTimeoutUs &&
+                           (magnetometer[0] != 0 || magnetometer[1] != 0 || magnetometer[2] != 0);
+
+    if (useMagnetometer)
+    {
+        StepMarg(gx, gy, gz, ax, ay, az, magnetometer[0], magnetometer[1], magnetometer[2]);
+    }
+    else
+    {
+        StepImu(gx, gy, gz, ax, ay, az);
+    }
+
+    uint32_t cycles = k_cycle_get_32() - start;
+    maxCycles = MAX(maxCycles, cycles);
+
+    uint8_t rate = outputRate.load(std::memory_order_relaxed);
+    if (rate == 0)
+    {
+        samplesSinceOutput = 0;
+        return;
+    }
+
+    if (++samplesSinceOutput >= MAX(sampleRate / rate, 1u))
+    {
+        samplesSinceOutput = 0;
+        Publish(timeUs);
+    }
+}
+
+/**
+ * @brief Madgwick gradient descent step without magnetometer
+ */
+void OrientationFusion::StepImu(float gx, float gy, float gz, float ax, float ay, float az)
+{
+    float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+
+    // Rate of change of quaternion from gyroscope
+    float qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    float qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    float qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+    float norm = ax * ax + ay * ay + az * az;
+    if (norm > 0.0f)
+    {
+        float recipNorm = 1.0f / sqrtf(norm);
+        ax *= recipNorm;
+        ay *= recipNorm;
+        az *= recipNorm;
+
+        float _2q0 = 2.0f * q0;
+        float _2q1 = 2.0f * q1;
+        float _2q2 = 2.0f * q2;
+        float _2q3 = 2.0f * q3;
+        float _4q0 = 4.0f * q0;
+        float _4q1 = 4.0f * q1;
+        float _4q2 = 4.0f * q2;
+        float _8q1 = 8.0f * q1;
+        float _8q2 = 8.0f * q2;
+        float q0q0 = q0 * q0;
+        float q1q1 = q1 * q1;
+        float q2q2 = q2 * q2;
+        float q3q3 = q3 * q3;
+
+        // Gradient of the gravity direction error
+        float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+        float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+        float s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+        float s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+
+        norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+        if (norm > 0.0f)
+        {
+            recipNorm = 1.0f / sqrtf(norm);
+            qDot1 -= beta * s0 * recipNorm;
+            qDot2 -= beta * s1 * recipNorm;
+            qDot3 -= beta * s2 * recipNorm;
+            qDot4 -= beta * s3 * recipNorm;
+        }
+    }
+
+    Integrate(qDot1, qDot2, qDot3, qDot4);
+}
+
+/**
+ * @brief Madgwick gradient descent step with magnetometer
+ */
+void OrientationFusion::StepMarg(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz)
+{
+    float accelNorm = ax * ax + ay * ay + az * az;
+    if (accelNorm <= 0.0f)
+    {
+        StepImu(gx, gy, gz, ax, ay, az);
+        return;
+    }
+
+    float q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+
+    float qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    float qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    float qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+    float recipNorm = 1.0f / sqrtf(accelNorm);
+    ax *= recipNorm;
+    ay *= recipNorm;
+    az *= recipNorm;
+
+    recipNorm = 1.0f / sqrtf(mx * mx + my * my + mz * mz);
+    mx *= recipNorm;
+    my *= recipNorm;
+    mz *= recipNorm;
+
+    float _2q0mx = 2.0f * q0 * mx;
+    float _2q0my = 2.0f * q0 * my;
+    float _2q0mz = 2.0f * q0 * mz;
+    float _2q1mx = 2.0f * q1 * mx;
+    float _2q0 = 2.0f * q0;
+    float _2q1 = 2.0f * q1;
+    float _2q2 = 2.0f * q2;
+    float _2q3 = 2.0f * q3;
+    float _2q0q2 = 2.0f * q0 * q2;
+    float _2q2q3 = 2.0f * q2 * q3;
+    float q0q0 = q0 * q0;
+    float q0q1 = q0 * q1;
+    float q0q2 = q0 * q2;
+    float q0q3 = q0 * q3;
+    float q1q1 = q1 * q1;
+    float q1q2 = q1 * q2;
+    float q1q3 = q1 * q3;
+    float q2q2 = q2 * q2;
+    float q2q3 = q2 * q3;
+    float q3q3 = q3 * q3;
+
+    // Reference direction of Earth's magnetic field, horizontal and vertical components
+    float hx = mx * q0q0 - _2q0my * q3 + _2q0mz * q2 + mx * q1q1 + _2q1 * my * q2 + _2q1 * mz * q3 - mx * q2q2 - mx * q3q3;
+    float hy = _2q0mx * q3 + my * q0q0 - _2q0mz * q1 + _2q1mx * q2 - my * q1q1 + my * q2q2 + _2q2 * mz * q3 - my * q3q3;
+    float _2bx = sqrtf(hx * hx + hy * hy);
+    float _2bz = -_2q0mx * q2 + _2q0my * q1 + mz * q0q0 + _2q1mx * q3 - mz * q1q1 + _2q2 * my * q3 - mz * q2q2 + mz * q3q3;
+    float _4bx = 2.0f * _2bx;
+    float _4bz = 2.0f * _2bz;
+
+    // Gradient of the gravity and magnetic field direction errors
+    float s0 = -_2q2 * (2.0f * q1q3 - _2q0q2 - ax) + _2q1 * (2.0f * q0q1 + _2q2q3 - ay) -
+               _2bz * q2 * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) +
+               (-_2bx * q3 + _2bz * q1) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) +
+               _2bx * q2 * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    float s1 = _2q3 * (2.0f * q1q3 - _2q0q2 - ax) + _2q0 * (2.0f * q0q1 + _2q2q3 - ay) -
+               4.0f * q1 * (1 - 2.0f * q1q1 - 2.0f * q2q2 - az) +
+               _2bz * q3 * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) +
+               (_2bx * q2 + _2bz * q0) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) +
+               (_2bx * q3 - _4bz * q1) * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    float s2 = -_2q0 * (2.0f * q1q3 - _2q0q2 - ax) + _2q3 * (2.0f * q0q1 + _2q2q3 - ay) -
+               4.0f * q2 * (1 - 2.0f * q1q1 - 2.0f * q2q2 - az) +
+               (-_4bx * q2 - _2bz * q0) * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) +
+               (_2bx * q1 + _2bz * q3) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) +
+               (_2bx * q0 - _4bz * q2) * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    float s3 = _2q1 * (2.0f * q1q3 - _2q0q2 - ax) + _2q2 * (2.0f * q0q1 + _2q2q3 - ay) +
+               (-_4bx * q3 + _2bz * q1) * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) +
+               (-_2bx * q0 + _2bz * q2) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) +
+               _2bx * q1 * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+
+    float norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+    if (norm > 0.0f)
+    {
+        recipNorm = 1.0f / sqrtf(norm);
+        qDot1 -= beta * s0 * recipNorm;
+        qDot2 -= beta * s1 * recipNorm;
+        qDot3 -= beta * s2 * recipNorm;
+        qDot4 -= beta * s3 * recipNorm;
+    }
+
+    Integrate(qDot1, qDot2, qDot3, qDot4);
+}
+
+/**
+ * @brief Integrate rate of change of quaternion and normalize
+ */
+void OrientationFusion::Integrate(float qDot1, float qDot2, float qDot3, float qDot4)
+{
+    float q0 = q[0] + qDot1 * dt;
+    float q1 = q[1] + qDot2 * dt;
+    float q2 = q[2] + qDot3 * dt;
+    float q3 = q[3] + qDot4 * dt;
+
+    float recipNorm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    q[0] = q0 * recipNorm;
+    q[1] = q1 * recipNorm;
+    q[2] = q2 * recipNorm;
+    q[3] = q3 * recipNorm;
+}
+
+/**
+ * @brief Send quaternion record over BLE and USB
+ *
+ * @param timeUs uptime of the last sample, µs
+ */
+void OrientationFusion::Publish(int64_t timeUs)
+{
+    uint8_t record[RecordSize];
+
+    record[0] = counter++;
+    sys_put_le32(static_cast<uint32_t>(timeUs / USEC_PER_MSEC), record + 1);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        int32_t value = lroundf(q[i] * quaternionScale);
+        sys_put_le16(static_cast<uint16_t>(CLAMP(value, INT16_MIN, INT16_MAX)), record + 5 + 2 * i);
+    }
+
+    stream.Publish(record, sizeof(record));
+}
+
+/**
+ * @brief Get maximum number of CPU cycles spent in single filter update since the last query
+ */
+uint32_t OrientationFusion::GetMaxCycles()
+{
+    uint32_t cycles = maxCycles;
+    maxCycles = 0;
+    return cycles;
+}
+
+#endif // CONFIG_USE_ORIENTATION_FUSION
@@ -0,0 +1,321 @@
+#include "ppg_processor.hpp"
+
+#if CONFIG_USE_PPG_PROCESSING
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(ppg_processor, LOG_LEVEL_INF);
+
+namespace
+{
+    constexpr static int coefficientShift = 30;       ///< Biquad coefficients are Q2.30
+    constexpr static int dcShift = 8;                  ///< DC tracker time constant, 256 samples
+    constexpr static float bandCenter = 1.5f;          ///< Band pass center frequency, Hz
+    constexpr static float bandQuality = 0.5f;         ///< Band pass Q. Pass band is roughly 0.5 - 5 Hz
+    constexpr static uint32_t minHeartRate = 30;       ///< Beat intervals longer than this are rejected, bpm
+    constexpr static uint32_t maxHeartRate = 220;      ///< Beat intervals shorter than this are rejected, bpm
+    constexpr static uint32_t contactThreshold = 32768; ///< IR level below this means no finger on sensor
+    constexpr static uint32_t saturationLevel = (1 << 18) - 256; ///< 18-bit ADC saturation level
+    constexpr static uint32_t minPerfusion = 5;        ///< Minimum plausible perfusion index, 0.01 %
+    constexpr static uint32_t maxPerfusion = 2000;     ///< Maximum plausible perfusion index, 0.01 %
+    constexpr static uint32_t minQuality = 50;         ///< Vitals are reported only above this quality
+
+    /**
+     * @brief Convert coefficient to Q2.30
+     */
+    int32_t ToQ30(float value)
+    {
+        return static_cast<int32_t>(lroundf(value * (1 << coefficientShift)));
+    }
+}
+
+/**
+ * @brief Reset pipeline state and compute filter coefficients
+ *
+ * @param rate effective sample rate after FIFO averaging, Hz
+ */
+void PpgProcessor::Initialize(uint32_t rate)
+{
+    sampleRate = MAX(rate, 1u);
+
+    // RBJ band pass with 0 dB peak gain, so filtered amplitude is comparable between channels
+    float w0 = 2.0f * 3.14159265f * bandCenter / sampleRate;
+    float alpha = sinf(w0) / (2.0f * bandQuality);
+    float a0 = 1.0f + alpha;
+
+    Biquad filter = {};
+    filter.b0 = ToQ30(alpha / a0);
+    filter.b1 = 0;
+    filter.b2 = ToQ30(-alpha / a0);
+    filter.a1 = ToQ30(-2.0f * cosf(w0) / a0);
+    filter.a2 = ToQ30((1.0f - alpha) / a0);
+
+    red = {0, filter, 0, 0};
+    ir = {0, filter, 0, 0};
+
+    envelope = 0;
+    prev[0] = 0;
+    prev[1] = 0;
+    sinceBeat = 0;
+    beatSeen = false;
+
+    memset(intervals, 0, sizeof(intervals));
+    intervalIndex = 0;
+    validIntervals = 0;
+    spo2 = 0;
+    ratio = 0;
+    perfusionIndex = 0;
+
+    windowSamples = 0;
+    windowQuality = 0;
+    counter = 0;
+    vitalsReady = false;
+    maxCycles = 0;
+    reportedMaxCycles = 0;
+
+    LOG_DBG("PPG processing at %u Hz", sampleRate);
+}
+
+/**
+ * @brief Filter one sample
+ */
+int32_t PpgProcessor::Biquad::Filter(int32_t x)
+{
+    int64_t acc = static_cast<int64_t>(b0) * x + static_cast<int64_t>(b1) * x1 + static_cast<int64_t>(b2) * x2 -
+                  static_cast<int64_t>(a1) * y1 - static_cast<int64_t>(a2) * y2;
+    int32_t y = static_cast<int32_t>(acc >> coefficientShift);
+
+    x2 = x1;
+    x1 = x;
+    y2 = y1;
+    y1 = y;
+
+    return y;
+}
+
+/**
+ * @brief Remove DC and filter sample
+ *
+ * @param sample raw sample
+ * @return band passed sample
+ */
+int32_t PpgProcessor::Channel::Process(uint32_t sample)
+{
+    int32_t x = static_cast<int32_t>(sample << dcShift);
+
+    // Start from the first sample, so DC tracker does not need to settle from zero
+    if (dc == 0)
+    {
+        dc = x;
+    }
+    dc += (x - dc) >> dcShift;
+
+    int32_t value = filter.Filter((x - dc) >> dcShift);
+
+    max = MAX(max, value);
+    min = MIN(min, value);
+
+    return value;
+}
+
+/**
+ * @brief Process one Red and IR sample
+ *
+ * @param redSample 18-bit Red sample
+ * @param irSample  18-bit IR sample
+ * @return signal quality index of the sample, 0 - 100
+ */
+uint8_t PpgProcessor::Process(uint32_t redSample, uint32_t irSample)
+{
+    uint32_t start = k_cycle_get_32();
+
+    red.Process(redSample);
+    // Blood volume pulse absorbs light, so systolic peak is a minimum of received IR light
+    int32_t beat = -ir.Process(irSample);
+
+    // Envelope decays with 1 s time constant and follows beat peaks
+    envelope -= envelope / static_cast<int32_t>(sampleRate);
+    envelope = MAX(envelope, beat);
+
+    if (sinceBeat < UINT32_MAX)
+    {
+        sinceBeat++;
+    }
+
+    // Previous sample is a peak if it is local maximum above half of envelope, outside of refractory period
+    uint32_t refractory = sampleRate * 60 / maxHeartRate;
+    if (prev[0] > prev[1] && prev[0] >= beat && prev[0] > envelope / 2 && sinceBeat > refractory)
+    {
+        OnBeat(sinceBeat - 1);
+        sinceBeat = 1;
+    }
+
+    prev[1] = prev[0];
+    prev[0] = beat;
+
+    uint8_t quality = Quality(redSample, irSample);
+    windowQuality += quality;
+    windowSamples++;
+
+    if (windowSamples >= sampleRate)
+    {
+        uint32_t averageQuality = windowQuality / windowSamples;
+        bool valid = averageQuality >= minQuality && validIntervals > 0;
+        uint32_t intervalSum = 0;
+
+        for (size_t i = 0; i < validIntervals; ++i)
+        {
+            intervalSum += intervals[i];
+        }
+        // Rate from the sum of intervals, an averaged interval truncated to whole samples overestimates it
+        uint32_t interval = validIntervals > 0 ? (intervalSum + validIntervals / 2) / validIntervals : 0;
+        uint32_t beats = 60 * sampleRate * validIntervals;
+
+        vitals.counter = counter++;
+        vitals.heartRate = (valid && intervalSum > 0) ? MIN((beats + intervalSum / 2) / intervalSum, 255u) : 0;
+        vitals.spo2 = (valid && spo2 > 0) ? (spo2 + 128) >> 8 : 0;
+        vitals.quality = averageQuality;
+        vitals.perfusionIndex = sys_cpu_to_le16(MIN(perfusionIndex, static_cast<uint32_t>(UINT16_MAX)));
+        vitals.beatInterval = sys_cpu_to_le16(MIN(interval * 1000 / sampleRate, static_cast<uint32_t>(UINT16_MAX)));
+        vitalsReady = true;
+
+        reportedMaxCycles = maxCycles;
+        maxCycles = 0;
+        windowSamples = 0;
+        windowQuality = 0;
+    }
+
+    uint32_t cycles = k_cycle_get_32() - start;
+    maxCycles = MAX(maxCycles, cycles);
+
+    return quality;
+}
+
+/**
+ * @brief Called on every detected beat
+ *
+ * @param interval samples since previous beat
+ */
+void PpgProcessor::OnBeat(uint32_t interval)
+{
+    int32_t acRed = red.max - red.min;
+    int32_t acIr = ir.max - ir.min;
+    int32_t dcRed = red.dc >> dcShift;
+    int32_t dcIr = ir.dc >> dcShift;
+
+    red.max = red.min = 0;
+    ir.max = ir.min = 0;
+
+    // Interval and amplitudes before the first beat do not cover whole beat
+    if (!beatSeen)
+    {
+        beatSeen = true;
+        return;
+    }
+
+    if (interval < sampleRate * 60 / maxHeartRate || interval > sampleRate * 60 / minHeartRate)
+    {
+        return;
+    }
+
+    intervals[intervalIndex] = interval;
+    intervalIndex = (intervalIndex + 1) % intervalCount;
+    validIntervals = MIN(validIntervals + 1, intervalCount);
+
+    if (acRed <= 0 || acIr <= 0 || dcRed <= 0 || dcIr <= 0)
+    {
+        return;
+    }
+
+    perfusionIndex = static_cast<uint32_t>(static_cast<int64_t>(acIr) * 10000 / dcIr);
+
+    // R in Q10, SpO2 in Q8 %
+    int64_t r = (static_cast<int64_t>(acRed) * dcIr << 10) / (static_cast<int64_t>(acIr) * dcRed);
+    ratio = static_cast<uint32_t>(MIN(r, static_cast<int64_t>(UINT32_MAX)));
+    int32_t value = (110 << 8) - static_cast<int32_t>((25 * r) >> 2);
+    value = CLAMP(value, 70 << 8, 100 << 8);
+
+    spo2 = spo2 == 0 ? value : (3 * spo2 + value) / 4;
+}
+
+/**
+ * @brief Compute signal quality of current sample
+ *
+ * @param redSample raw Red sample
+ * @param irSample raw IR sample
+ */
+uint8_t PpgProcessor::Quality(uint32_t redSample, uint32_t irSample)
+{
+    if (irSample < contactThreshold || irSample >= saturationLevel || redSample >= saturationLevel)
+    {
+        return 0;
+    }
+
+    // Contact without rhythm, e.g. motion or settling filters
+    if (validIntervals == 0 || sinceBeat > 2 * sampleRate)
+    {
+        return 25;
+    }
+
+    int32_t quality = 100;
+    uint32_t mean = 0;
+
+    for (size_t i = 0; i < validIntervals; ++i)
+    {
+        mean += intervals[i];
+    }
+    mean /= validIntervals;
+
+    uint32_t last = intervals[(intervalIndex + intervalCount - 1) % intervalCount];
+    uint32_t deviation = (last > mean ? last - mean : mean - last) * 100 / mean;
+    quality -= MIN(deviation * 2, 50u);
+
+    if (perfusionIndex < minPerfusion || perfusionIndex > maxPerfusion)
+    {
+        quality -= 30;
+    }
+
+    return MAX(quality, 0);
+}
+
+/**
+ * @brief Get vitals record. Record is available once per second of processed samples
+ *
+ * @param record output record
+ * @return true if new record was stored
+ */
+bool PpgProcessor::GetVitals(Vitals &record)
+{
+    if (!vitalsReady)
+    {
+        return false;
+    }
+
+    record = vitals;
+    vitalsReady = false;
+    return true;
+}
+
+/**
+ * @brief Get maximum number of CPU cycles spent in Process during the last completed second
+ */
+uint32_t PpgProcessor::GetMaxCycles()
+{
+    return reportedMaxCycles;
+}
+
+/**
+ * @brief Get R ratio of the last beat, Q10. SpO2 is computed from it with the calibration curve
+ */
+uint32_t PpgProcessor::GetRatio()
+{
+    return ratio;
+}
+
+#endif // CONFIG_USE_PPG_PROCESSING
@@ -6,10 +6,14 @@
 //#include <sys/__assert.h>
 #include <stdlib.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "qmc5883l.hpp"
 #include "ble_service.hpp"
 #include "usb_comm_handler.hpp"
+#if CONFIG_USE_ORIENTATION_FUSION
+#include "orientation_fusion.hpp"
+#endif
 // For registering callback
 #include "ble_service.hpp"
 
@@ -17,7 +21,17 @@
 
 LOG_MODULE_REGISTER(qmc5883l, LOG_LEVEL_INF);
 
-Qmc5883l::Qmc5883l(UsbCommHandler &controller) : serialHandler(controller) {
+namespace
+{
+    const gpio_dt_spec interruptPin = GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), qmc5883l_drdy_gpios); ///< DRDY pin
+
+    const qmc5883l_config defaultConfig = {
+        .ctrl_reg_1 = (QMC5833L_OSR_512 << 6) | (QMC5833L_FS_8G << 4) | (QMC5833L_ODR_100Hz << 2) | (QMC5833L_MODE_CONTINUOUS),
+        .ctrl_reg_2 = 0
+    };
+}
+
+Qmc5883l::Qmc5883l(UsbCommHandler &controller) : stream(controller) {
     LOG_DBG("Qmc5883l Constructor!");
 }
 
@@ -43,23 +57,54 @@ int Qmc5883l::Initialize() {
         LOG_ERR("Wrong ID: 0x%X", part_id);
         return -1;
     }
+
+    EnableRecovery(transport);
+
     /* wake up chip */
     //Wakeup();
-    Reset();
+    ret = Reset();
+    if(ret != 0){
+        return ret;
+    }
     k_msleep(5);
 //    Shutdown();
 
-    Bluetooth::GattRegisterControlCallback(CommandId::Qmc5883lCmd,
-        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
-        {
-            return OnBleCommand(buffer, key, length, offset);
-        });
+    transport.SetupTransaction(dataTransaction, [this](int status) { OnSensorData(status); }, I2cPriority::High);
+    readTemperature.store(true, std::memory_order_relaxed);
+    sampling.store(false, std::memory_order_relaxed);
+    temperature[0] = 0;
+    temperature[1] = 0;
+
+    SetCalibration(nullptr, nullptr);
+    statSamples = 0;
+    statBusCycles = 0;
+    statMaxBusCycles = 0;
+
+    RegisterCommands(CommandId::Qmc5883lCmd);
 
     return 0;
 }
 
+int Qmc5883l::Start(){
+    if(Initialize() != 0 || !IsOnI2cBus()){
+        LOG_WRN("QMC5883L is not connected or properly initialized!");
+        return -1;
+    }
+
+    int ret = AttachInterrupt(interruptPin, GPIO_INT_EDGE_RISING);
+    if(ret != 0){
+        LOG_ERR("Interrupt pin configuration failed: %d", ret);
+        return ret;
+    }
+
+    ret = Configure(defaultConfig);
+    StartSampling();
+    return ret;
+}
+
 int Qmc5883l::Configure(qmc5883l_config config){
     uint8_t status;   
+    activeConfig = config;
 
     transport.WriteRegister(QMC5883L_SET_RESET_PERIOD, 0x01); // Recommended by QMC5883L datasheet
     transport.WriteRegister(QMC5883L_CTRL_REG_1, config.ctrl_reg_1);
@@ -69,25 +114,47 @@ int Qmc5883l::Configure(qmc5883l_config config){
     status = transport.ReadRegister(QMC5883L_Z_MSB);
 
     status = transport.GetStatus();
+
+    // Sample has to be read before the next Data Ready
+    constexpr static uint32_t odrHz[] = {10, 50, 100, 200};
+    dataTransaction.deadlineUs = 1000000 / odrHz[(config.ctrl_reg_1 & QMC5833L_ODR_MASK) >> 2];
+
     return status;
 }
 
-bool Qmc5883l::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset){
-    if (offset.value != 0 || length.value == 0)
-    {
-        return false;
-    }
-    LOG_DBG("Qmc5883l BLE Command received");
+bool Qmc5883l::OnCommand(uint8_t key, const uint8_t *buffer, size_t length){
+    LOG_DBG("Qmc5883l command received");
 
-    Bluetooth::CommandKey bleCommand;
-    memcpy(&bleCommand, &key, sizeof(key));
-          
-    switch(bleCommand.key[0]){
-        case static_cast<uint8_t>(BleCommand::StartSampling):
-            StartSampling();
+    switch(key){
+        case static_cast<uint8_t>(Qmc5883lCommand::SetHardIron):
+        {
+            if(length < 3 * sizeof(int16_t)){
+                return false;
+            }
+            int16_t offset[3];
+            for(size_t i = 0; i < 3; i++){
+                offset[i] = sys_get_le16(buffer + 2 * i);
+            }
+            SetCalibration(offset, nullptr);
             break;
-        case static_cast<uint8_t>(BleCommand::StopSampling):
-            StopSampling();
+        }
+        case static_cast<uint8_t>(Qmc5883lCommand::SetSoftIron):
+        {
+            if(length < 9 * sizeof(int16_t)){
+                return false;
+            }
+            int16_t matrix[3][3];
+            for(size_t i = 0; i < 9; i++){
+                matrix[i / 3][i % 3] = sys_get_le16(buffer + 2 * i);
+            }
+            SetCalibration(nullptr, matrix);
+            break;
+        }
+        case static_cast<uint8_t>(Qmc5883lCommand::ResetCalibration):
+            SetCalibration(nullptr, nullptr);
+            break;
+        case static_cast<uint8_t>(Qmc5883lCommand::GetStats):
+            ReportStats();
             break;
         
         default:
@@ -97,13 +164,41 @@ bool Qmc5883l::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bl
     return true;
 }
 
-void Qmc5883l::Reset() {
-    uint8_t user_ctrl_reg;
+int Qmc5883l::Reset() {
     // Write 1 to SOFT_RST bit. This will restore default value of all registers.
     // QMC5883L immediately switches to standby mode.
     transport.UpdateRegister(QMC5883L_CTRL_REG_2, BIT(QMC5883L_SOFT_RST_BIT), 0xFF);    
 
+    int ret = transport.GetStatus();
+    if(ret != 0){
+        LOG_ERR("Qmc5883l Reset failed: %d", ret);
+        return ret;
+    }
+
     LOG_DBG("Qmc5883l Reset Success!");
+    return 0;
+}
+
+int Qmc5883l::Recover() {
+    LOG_WRN("Qmc5883l is not responding, initializing again");
+
+    // Configuration selects continuous mode, standby is restored below when sampling is stopped
+    int ret = Reset();
+    if(ret == 0){
+        k_msleep(5);
+        ret = Configure(activeConfig);
+    }
+    if(ret != 0){
+        LOG_ERR("Qmc5883l recovery failed: %d", ret);
+        return ret;
+    }
+
+    if(!sampling.load(std::memory_order_relaxed)){
+        Shutdown();
+    }
+
+    LOG_INF("Qmc5883l recovered");
+    return 0;
 }
 
 void Qmc5883l::Shutdown() {
@@ -117,10 +212,12 @@ void Qmc5883l::Wakeup() {
 }
 
 void Qmc5883l::StartSampling(){    
+    sampling.store(true, std::memory_order_relaxed);
     Wakeup();
 }   
 
 void Qmc5883l::StopSampling(){
+    sampling.store(false, std::memory_order_relaxed);
     Shutdown();
 }
 
@@ -130,38 +227,147 @@ void Qmc5883l::GetDieTemperature(){
 
 void Qmc5883l::HandleInterrupt(){
     //LOG_INF("Handling Qmc5883l interrupt!");
-    uint8_t int_reason;
-    int_reason = transport.ReadRegister(QMC5883L_STATUS_REG);
+    // XYZ data and status are read with one transfer, which also clears DRDY. Temperature is added once per packet
+    size_t size = readTemperature.load(std::memory_order_relaxed) ? sensorDataSize : sampleDataSize;
+    sampleTimeUs = InterruptTimeUs();
+    transport.ReadRegistersAsync(dataTransaction, QMC5883L_X_LSB, sensorData, size);
+} 
+
+void Qmc5883l::OnSensorData(int status){
+    if(status != 0){
+        LOG_WRN("Sensor data read failed: %d", status);
+        return;
+    }
+
+    statSamples++;
+    statBusCycles += dataTransaction.busCycles;
+    statMaxBusCycles = MAX(statMaxBusCycles, dataTransaction.busCycles);
+
+    uint8_t int_reason = sensorData[QMC5883L_STATUS_REG - QMC5883L_X_LSB];
     
     if(int_reason & BIT(QMC5883L_OVL_BIT)){
         LOG_DBG("Sensor value overflow!");
-        // Read one of the XYZ output registers to clear DRDY
-        transport.ReadRegister(QMC5883L_Z_MSB);
     }
 
     if(int_reason & BIT(QMC5883L_DOR_BIT)){
         LOG_DBG("QMC5883L Data Skip (DOR) Interrupt!");
-        // Read one of the XYZ output registers to clear DRDY
-        transport.ReadRegister(QMC5883L_Z_MSB);        
-    }
-
-    if(int_reason & BIT(QMC5883L_DRDY_BIT)){
-        //LOG_INF("QMC5883L Data Ready interrupt!");
-        // Store Accel and Gyro samples
-        transport.ReadRegisters(QMC5883L_X_LSB, (tx_buf + 6*sample_cnt + 1), 6);        
-        sample_cnt++;
-        if(sample_cnt == 40){
-            //Store Temperature reading
-            transport.ReadRegisters(QMC5883L_TOUT_LSB, (tx_buf + 6*sample_cnt + 1), 2);
-            tx_buf[0] = packet_cnt;            
-            packet_cnt++;
-            sample_cnt = 0;          
-            Bluetooth::Qmc5883lNotify(tx_buf, 243);
-            serialHandler.SendMagnetometerSamples(tx_buf, 243);
-        }
+    }
+
+    if(dataTransaction.length == sensorDataSize){
+        memcpy(temperature, sensorData + (QMC5883L_TOUT_LSB - QMC5883L_X_LSB), 2);
+        readTemperature.store(false, std::memory_order_relaxed);
+    }
+
+    //LOG_INF("QMC5883L Data Ready interrupt!");
+    StoreSample(sensorData, tx_buf + sampleSize*sample_cnt + 1);
+#if CONFIG_USE_ORIENTATION_FUSION
+    if(fusion != nullptr){
+        fusion->UpdateMagnetometer(tx_buf + sampleSize*sample_cnt + 1, sampleTimeUs);
+    }
+#endif
+    sample_cnt++;
+
+    if(sample_cnt == samplesPerPacket - 1){
+        readTemperature.store(true, std::memory_order_relaxed);
+    }
+
+    if(sample_cnt == samplesPerPacket){
+        //Store Temperature reading. If last burst was queued before temperature was requested, previous one is used
+        memcpy(tx_buf + sampleSize*sample_cnt + 1, temperature, 2);
+        tx_buf[0] = packet_cnt;            
+        packet_cnt++;
+        sample_cnt = 0;          
+        stream.Publish(tx_buf, 243);
     }
 } 
 
+void Qmc5883l::StoreSample(const uint8_t *raw, uint8_t *out){
+    int32_t value[3];
+
+    for(size_t i = 0; i < 3; i++){
+        value[i] = static_cast<int16_t>(sys_get_le16(raw + 2 * i));
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&calibrationLock);
+
+    if(calibrationIdentity){
+        k_spin_unlock(&calibrationLock, key);
+        memcpy(out, raw, sampleSize);
+        return;
+    }
+
+    int32_t centered[3];
+    for(size_t i = 0; i < 3; i++){
+        centered[i] = value[i] - calibration.offset[i];
+    }
+
+    // Q12 coefficients up to 8 times centered values up to 65535 overflow int32 over three terms
+    for(size_t i = 0; i < 3; i++){
+        int64_t sum = static_cast<int64_t>(calibration.matrix[i][0]) * centered[0] +
+                      static_cast<int64_t>(calibration.matrix[i][1]) * centered[1] +
+                      static_cast<int64_t>(calibration.matrix[i][2]) * centered[2];
+        value[i] = static_cast<int32_t>(CLAMP(sum >> calibrationShift, INT16_MIN, INT16_MAX));
+    }
+
+    k_spin_unlock(&calibrationLock, key);
+
+    for(size_t i = 0; i < 3; i++){
+        sys_put_le16(static_cast<uint16_t>(value[i]), out + 2 * i);
+    }
+}
+
+void Qmc5883l::SetCalibration(const int16_t *offset, const int16_t (*matrix)[3]){
+    k_spinlock_key_t key = k_spin_lock(&calibrationLock);
+
+    if(offset == nullptr && matrix == nullptr){
+        memset(calibration.offset, 0, sizeof(calibration.offset));
+        memset(calibration.matrix, 0, sizeof(calibration.matrix));
+        for(size_t i = 0; i < 3; i++){
+            calibration.matrix[i][i] = 1 << calibrationShift;
+        }
+    }
+
+    if(offset != nullptr){
+        memcpy(calibration.offset, offset, sizeof(calibration.offset));
+    }
+
+    if(matrix != nullptr){
+        memcpy(calibration.matrix, matrix, sizeof(calibration.matrix));
+    }
+
+    calibrationIdentity = true;
+    for(size_t i = 0; i < 3; i++){
+        calibrationIdentity &= calibration.offset[i] == 0;
+        for(size_t j = 0; j < 3; j++){
+            calibrationIdentity &= calibration.matrix[i][j] == (i == j ? (1 << calibrationShift) : 0);
+        }
+    }
+
+    k_spin_unlock(&calibrationLock, key);
+
+    LOG_INF("Calibration offsets: %d %d %d", calibration.offset[0], calibration.offset[1], calibration.offset[2]);
+}
+
+#if CONFIG_USE_ORIENTATION_FUSION
+void Qmc5883l::SetFusion(OrientationFusion *filter){
+    fusion = filter;
+}
+#endif
+
+void Qmc5883l::ReportStats(){
+    // Counters are updated from I2C queue thread, so values are a snapshot
+    uint32_t samples = statSamples;
+    uint64_t cycles = statBusCycles;
+    uint32_t maxCycles = statMaxBusCycles;
+
+    uint32_t average = samples > 0 ? k_cyc_to_us_floor32(cycles / samples) : 0;
+    LOG_INF("I2C bus time per sample: avg %u us, max %u us, %u samples", average, k_cyc_to_us_floor32(maxCycles), samples);
+
+    statSamples = 0;
+    statBusCycles = 0;
+    statMaxBusCycles = 0;
+}
+
 bool Qmc5883l::IsOnI2cBus(){
     bool status;
     status = qmc5883l_is_on_i2c_bus_.load(std::memory_order_relaxed);
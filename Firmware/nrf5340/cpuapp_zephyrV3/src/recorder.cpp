@@ -0,0 +1,527 @@
+#include "recorder.hpp"
+
+#if CONFIG_USE_RECORDER
+
+#include <string.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(recorder, LOG_LEVEL_INF);
+
+namespace
+{
+    constexpr static size_t recordHeaderSize = 6;     ///< [SensorId][length][timestamp u32]
+    constexpr static size_t indexEntrySize = 2;       ///< u16 record offset
+    constexpr static size_t chunkHeaderSize = 6;      ///< [sequence u32][offset u16]
+    constexpr static uint32_t offloadEndMarker = 0xFFFFFFFF;
+    constexpr static int sinkRetryCount = 1000;       ///< Offload is aborted if host does not read for 1 s
+    constexpr static size_t crcChunkSize = 128;       ///< Flash read size of CRC check
+
+    constexpr static int stackSize = 1536;            ///< Recorder thread stack size
+    constexpr static int taskPriority = 10;           ///< Recorder thread priority. Lower than sensor threads
+
+    K_THREAD_STACK_DEFINE(recorderStackArea, stackSize); ///< Recorder thread stack
+}
+
+/**
+ * @brief Construct Recorder.
+ * @note Only one instance could be constructed
+ */
+Recorder::Recorder()
+{
+    flash = DEVICE_DT_GET(DT_ALIAS(recorder_flash));
+    slotCount = CONFIG_RECORDER_FLASH_SIZE / BlockSize;
+    nextSlot = 0;
+    nextSequence.store(1, std::memory_order_relaxed);
+    usedSlots.store(0, std::memory_order_relaxed);
+    oldestSequence.store(0, std::memory_order_relaxed);
+
+    blockState[0].store(BufferState::Free, std::memory_order_relaxed);
+    blockState[1].store(BufferState::Free, std::memory_order_relaxed);
+    activeBlock = -1;
+    activeCount = 0;
+    activeUsed = 0;
+
+    recording.store(false, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Initialization function. Scans recording area to continue the log after the last written block.
+ *
+ * @param sink sink for offloaded data
+ * @return 0 on success, negative error code otherwise
+ */
+int Recorder::Initialize(OffloadSink &&sink)
+{
+    offloadSink = std::move(sink);
+
+    if (!device_is_ready(flash))
+    {
+        LOG_ERR("Recorder flash device not ready");
+        return -ENODEV;
+    }
+
+    uint32_t newestSequence = 0;
+    uint32_t newestSlot = 0;
+    uint32_t oldest = UINT32_MAX;
+    uint32_t valid = 0;
+
+    for (uint32_t slot = 0; slot < slotCount; ++slot)
+    {
+        BlockHeader header;
+        if (!ReadHeader(slot, header))
+        {
+            continue;
+        }
+
+        if (!CheckCrc(slot, header))
+        {
+            // Torn by a reset during its write, or damaged. Its sequence is not trusted, a torn block after the
+            // newest valid one is overwritten first
+            LOG_WRN("Block %u (sequence %u) has bad CRC, skipped", slot, header.sequence);
+            continue;
+        }
+
+        ++valid;
+        oldest = MIN(oldest, header.sequence);
+        if (header.sequence > newestSequence)
+        {
+            newestSequence = header.sequence;
+            newestSlot = slot;
+        }
+    }
+
+    // Blocks are written in slot order with consecutive sequences, so the log spans the slots from the oldest to the
+    // newest valid block, damaged blocks in between included
+    uint32_t used = 0;
+    if (valid != 0)
+    {
+        used = MIN(newestSequence - oldest + 1, slotCount);
+        nextSlot = (newestSlot + 1) % slotCount;
+        nextSequence.store(newestSequence + 1, std::memory_order_relaxed);
+        oldestSequence.store(newestSequence + 1 - used, std::memory_order_relaxed);
+    }
+    usedSlots.store(used, std::memory_order_relaxed);
+
+    LOG_INF("Recorder: %u of %u blocks used, %u valid, next sequence %u", used, slotCount, valid, newestSequence + 1);
+
+    k_msgq_init(&jobQueue, jobQueueBuffer, sizeof(Job), sizeof(jobQueueBuffer) / sizeof(Job));
+
+    k_thread_create(&thread, recorderStackArea, K_THREAD_STACK_SIZEOF(recorderStackArea),
+                    &Recorder::WorkingThread, this, nullptr, nullptr, taskPriority, 0, K_NO_WAIT);
+
+    return 0;
+}
+
+/**
+ * @brief Append sensor packet to the log. Packet is dropped if recording is stopped or both RAM blocks are busy.
+ *
+ * @param sensorId sensor id
+ * @param buffer   packet data. Data is copied before return
+ * @param length   packet data length
+ */
+void Recorder::Append(SensorId sensorId, const uint8_t *buffer, size_t length)
+{
+    if (!recording.load(std::memory_order_relaxed) || length > UINT8_MAX)
+    {
+        return;
+    }
+
+    size_t recordSize = recordHeaderSize + length;
+    uint32_t timestamp = k_uptime_get_32();
+
+    int closedBlock = -1;
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    if (activeBlock >= 0 &&
+        sizeof(BlockHeader) + activeUsed + recordSize + (activeCount + 1) * indexEntrySize > BlockSize)
+    {
+        closedBlock = CloseBlock();
+    }
+
+    if (activeBlock < 0 && !OpenBlock())
+    {
+        k_spin_unlock(&lock, key);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+
+        if (closedBlock >= 0)
+        {
+            QueueJob(closedBlock == 0 ? Job::WriteBlock0 : Job::WriteBlock1);
+        }
+        return;
+    }
+
+    uint8_t *block = blocks[activeBlock];
+    uint16_t offset = sizeof(BlockHeader) + activeUsed;
+    uint8_t *record = block + offset;
+
+    record[0] = static_cast<uint8_t>(sensorId);
+    record[1] = static_cast<uint8_t>(length);
+    sys_put_le32(timestamp, record + 2);
+    memcpy(record + recordHeaderSize, buffer, length);
+
+    sys_put_le16(offset, block + BlockSize - (activeCount + 1) * indexEntrySize);
+
+    activeUsed += recordSize;
+    activeCount++;
+
+    k_spin_unlock(&lock, key);
+
+    if (closedBlock >= 0)
+    {
+        QueueJob(closedBlock == 0 ? Job::WriteBlock0 : Job::WriteBlock1);
+    }
+}
+
+/**
+ * @brief Start appending sensor packets to flash
+ */
+void Recorder::Start()
+{
+    if (!recording.exchange(true, std::memory_order_relaxed))
+    {
+        LOG_INF("Recording started");
+    }
+}
+
+/**
+ * @brief Stop recording. Partially filled block is written to flash
+ */
+void Recorder::Stop()
+{
+    if (!recording.exchange(false, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    int closedBlock = -1;
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    if (activeBlock >= 0)
+    {
+        closedBlock = CloseBlock();
+    }
+    k_spin_unlock(&lock, key);
+
+    if (closedBlock >= 0)
+    {
+        QueueJob(closedBlock == 0 ? Job::WriteBlock0 : Job::WriteBlock1);
+    }
+
+    LOG_INF("Recording stopped, %u packets dropped", dropped.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Stop recording and erase whole recording area. Executed by recorder thread
+ */
+void Recorder::Erase()
+{
+    Stop();
+    QueueJob(Job::Erase);
+}
+
+/**
+ * @brief Stop recording and stream all blocks from oldest to newest to offload sink. Executed by recorder thread.
+ */
+void Recorder::Offload()
+{
+    Stop();
+    QueueJob(Job::Offload);
+}
+
+/**
+ * @brief Fill recorder state message: [recording, blocks u32, oldest sequence u32, newest sequence u32, dropped u32]
+ *
+ * @param buffer output buffer, at least InfoSize bytes
+ * @return number of bytes written
+ */
+size_t Recorder::GetInfo(uint8_t *buffer)
+{
+    buffer[0] = recording.load(std::memory_order_relaxed) ? 1 : 0;
+    sys_put_le32(usedSlots.load(std::memory_order_relaxed), buffer + 1);
+    sys_put_le32(oldestSequence.load(std::memory_order_relaxed), buffer + 5);
+    sys_put_le32(nextSequence.load(std::memory_order_relaxed) - 1, buffer + 9);
+    sys_put_le32(dropped.load(std::memory_order_relaxed), buffer + 13);
+
+    return InfoSize;
+}
+
+/**
+ * @brief Start new RAM block. Must be called with lock held
+ *
+ * @return true if free RAM block was found
+ */
+bool Recorder::OpenBlock()
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        if (blockState[i].load(std::memory_order_acquire) == BufferState::Free)
+        {
+            blockState[i].store(BufferState::Filling, std::memory_order_relaxed);
+            memset(blocks[i], 0xFF, BlockSize);
+
+            activeBlock = i;
+            activeCount = 0;
+            activeUsed = 0;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Finalize current RAM block. Must be called with lock held. Caller queues write job after releasing lock
+ *
+ * @return index of closed RAM block
+ */
+int Recorder::CloseBlock()
+{
+    int closed = activeBlock;
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(blocks[activeBlock]);
+
+    // Sequence and CRC are filled by recorder thread
+    header->magic = BlockMagic;
+    header->count = activeCount;
+    header->used = activeUsed;
+
+    blockState[activeBlock].store(BufferState::Writing, std::memory_order_release);
+    activeBlock = -1;
+
+    return closed;
+}
+
+/**
+ * @brief Queue job for recorder thread
+ */
+void Recorder::QueueJob(Job job)
+{
+    if (k_msgq_put(&jobQueue, &job, K_NO_WAIT) != 0)
+    {
+        LOG_ERR("Recorder job queue is full");
+    }
+}
+
+/**
+ * @brief Recorder thread. Writes filled blocks to flash and executes erase and offload jobs.
+ *
+ * @param data pointer to current instance of Recorder
+ */
+void Recorder::WorkingThread(void *data, void *, void *)
+{
+    Recorder *self = static_cast<Recorder *>(data);
+    Job job;
+
+    for (;;)
+    {
+        k_msgq_get(&self->jobQueue, &job, K_FOREVER);
+
+        switch (job)
+        {
+        case Job::WriteBlock0:
+            self->WriteBlock(0);
+            break;
+        case Job::WriteBlock1:
+            self->WriteBlock(1);
+            break;
+        case Job::Erase:
+            self->EraseAll();
+            break;
+        case Job::Offload:
+            self->OffloadAll();
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Write RAM block to flash
+ *
+ * @param index RAM block index
+ */
+void Recorder::WriteBlock(size_t index)
+{
+    uint8_t *block = blocks[index];
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(block);
+
+    uint32_t sequence = nextSequence.load(std::memory_order_relaxed);
+    header->sequence = sequence;
+    header->crc = crc32_ieee(block + sizeof(BlockHeader), BlockSize - sizeof(BlockHeader));
+
+    off_t offset = CONFIG_RECORDER_FLASH_OFFSET + nextSlot * BlockSize;
+
+    int ret = flash_erase(flash, offset, BlockSize);
+    if (ret == 0)
+    {
+        ret = flash_write(flash, offset, block, BlockSize);
+    }
+
+    blockState[index].store(BufferState::Free, std::memory_order_release);
+
+    if (ret != 0)
+    {
+        LOG_ERR("Block %u write failed: %d", nextSlot, ret);
+        return;
+    }
+
+    if (usedSlots.load(std::memory_order_relaxed) == slotCount)
+    {
+        // Oldest block was overwritten
+        oldestSequence.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        if (usedSlots.fetch_add(1, std::memory_order_relaxed) == 0)
+        {
+            oldestSequence.store(sequence, std::memory_order_relaxed);
+        }
+    }
+
+    nextSlot = (nextSlot + 1) % slotCount;
+    nextSequence.store(sequence + 1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Erase whole recording area
+ */
+void Recorder::EraseAll()
+{
+    LOG_INF("Erasing recording area...");
+
+    int ret = flash_erase(flash, CONFIG_RECORDER_FLASH_OFFSET, slotCount * BlockSize);
+    if (ret != 0)
+    {
+        LOG_ERR("Erase failed: %d", ret);
+        return;
+    }
+
+    nextSlot = 0;
+    usedSlots.store(0, std::memory_order_relaxed);
+    oldestSequence.store(0, std::memory_order_relaxed);
+
+    LOG_INF("Recording area erased");
+}
+
+/**
+ * @brief Send all valid blocks from oldest to newest to offload sink
+ */
+void Recorder::OffloadAll()
+{
+    uint8_t chunk[OffloadChunkSize];
+    constexpr size_t chunkDataSize = OffloadChunkSize - chunkHeaderSize;
+
+    uint32_t used = usedSlots.load(std::memory_order_relaxed);
+    uint32_t firstSlot = (nextSlot + slotCount - used) % slotCount;
+    uint32_t sentBlocks = 0;
+
+    auto send = [this](const uint8_t *buffer, size_t length)
+    {
+        for (int retry = 0; retry < sinkRetryCount; ++retry)
+        {
+            if (offloadSink && offloadSink(buffer, length))
+            {
+                return true;
+            }
+            k_sleep(K_MSEC(1));
+        }
+        return false;
+    };
+
+    LOG_INF("Offloading %u blocks", used);
+
+    for (uint32_t i = 0; i < used; ++i)
+    {
+        uint32_t slot = (firstSlot + i) % slotCount;
+        BlockHeader header;
+
+        if (!ReadHeader(slot, header))
+        {
+            continue;
+        }
+
+        if (!CheckCrc(slot, header))
+        {
+            LOG_WRN("Block %u has bad CRC, skipped", header.sequence);
+            continue;
+        }
+
+        off_t blockOffset = CONFIG_RECORDER_FLASH_OFFSET + slot * BlockSize;
+
+        for (size_t offset = 0; offset < BlockSize; offset += chunkDataSize)
+        {
+            size_t length = MIN(chunkDataSize, BlockSize - offset);
+
+            sys_put_le32(header.sequence, chunk);
+            sys_put_le16(offset, chunk + 4);
+
+            if (flash_read(flash, blockOffset + offset, chunk + chunkHeaderSize, length) != 0 ||
+                !send(chunk, chunkHeaderSize + length))
+            {
+                LOG_ERR("Offload aborted at block %u", header.sequence);
+                return;
+            }
+        }
+        ++sentBlocks;
+    }
+
+    sys_put_le32(offloadEndMarker, chunk);
+    sys_put_le16(sentBlocks, chunk + 4);
+    send(chunk, chunkHeaderSize);
+
+    LOG_INF("Offload complete, %u blocks sent", sentBlocks);
+}
+
+/**
+ * @brief Read and validate block header
+ *
+ * @param slot   flash block index
+ * @param header output header
+ * @return true if block contains valid header
+ */
+bool Recorder::ReadHeader(uint32_t slot, BlockHeader &header)
+{
+    off_t offset = CONFIG_RECORDER_FLASH_OFFSET + slot * BlockSize;
+
+    if (flash_read(flash, offset, &header, sizeof(header)) != 0)
+    {
+        return false;
+    }
+
+    return header.magic == BlockMagic && header.sequence != 0 && header.sequence != UINT32_MAX &&
+           header.used <= BlockSize - sizeof(BlockHeader);
+}
+
+/**
+ * @brief Check CRC of block after the header
+ *
+ * @param slot   flash block index
+ * @param header block header
+ * @return true if CRC matches
+ */
+bool Recorder::CheckCrc(uint32_t slot, const BlockHeader &header)
+{
+    uint8_t buffer[crcChunkSize];
+    off_t offset = CONFIG_RECORDER_FLASH_OFFSET + slot * BlockSize;
+    uint32_t crc = 0;
+
+    for (size_t position = sizeof(BlockHeader); position < BlockSize; position += crcChunkSize)
+    {
+        size_t length = MIN(crcChunkSize, BlockSize - position);
+
+        if (flash_read(flash, offset + position, buffer, length) != 0)
+        {
+            return false;
+        }
+        crc = crc32_ieee_update(crc, buffer, length);
+    }
+
+    return crc == header.crc;
+}
+
+#endif // CONFIG_USE_RECORDER
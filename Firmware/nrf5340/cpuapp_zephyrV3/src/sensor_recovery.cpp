@@ -0,0 +1,44 @@
+#include "sensor_recovery.hpp"
+
+namespace
+{
+    constexpr static int stackSize = 2048;  ///< Recovery thread stack size
+    constexpr static int taskPriority = 10; ///< Recovery thread priority, below I2C queue and sensor threads
+
+    K_THREAD_STACK_DEFINE(recoveryStackArea, stackSize); ///< Recovery thread stack
+    K_MUTEX_DEFINE(startLock);                          ///< Protects work queue start
+
+    k_work_q recoveryQueue; ///< Recovery work queue
+    bool started = false;   ///< Set when work queue is started
+}
+
+namespace SensorRecovery
+{
+    /**
+     * @brief Schedule sensor recovery work. Recovery work runs on its own low priority work queue, so resets and
+     *        register polling of a failed sensor never delay I2C queue threads or system work queue, which carry
+     *        acquisition of the other sensors. Work queue is started on first use.
+     *
+     * @param work recovery work item
+     * @param delay delay before recovery, used as retry back-off
+     */
+    void Schedule(k_work_delayable *work, k_timeout_t delay)
+    {
+        k_mutex_lock(&startLock, K_FOREVER);
+
+        if (!started)
+        {
+            k_work_queue_config config = {};
+            config.name = "sensor_recovery";
+
+            k_work_queue_init(&recoveryQueue);
+            k_work_queue_start(&recoveryQueue, recoveryStackArea, K_THREAD_STACK_SIZEOF(recoveryStackArea),
+                               taskPriority, &config);
+            started = true;
+        }
+
+        k_mutex_unlock(&startLock);
+
+        k_work_schedule_for_queue(&recoveryQueue, work, delay);
+    }
+}
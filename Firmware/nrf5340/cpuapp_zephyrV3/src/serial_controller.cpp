@@ -35,23 +35,17 @@ namespace
     constexpr static uint8_t crcPolynom = 0x31;
     constexpr static uint8_t crcInitilalValue = 0xFF;
 
-    /**
-     * @brief Command execution step
-     */
-    enum class CommandState
-    {
-        SendCommand,  ///< Sendind command via uart
-        WaitResponse, ///< Getting response
-        Done,         ///< Command is completed
-    };
+    constexpr static int dtrPollPeriodMs = 10; ///< DTR sampling period while device is configured
 
-    constexpr static int serialPortStackSize = 512;
+    constexpr static int serialPortStackSize = 1024;
     constexpr static int serialPortTaskPriority = 1;
 
     K_THREAD_STACK_DEFINE(my_stack_area, serialPortStackSize); ///< Serial controller working task stack
     k_thread worker;                                           ///< worker thread
 
     std::atomic<TransferStatus> serialStatus; ///< Status of last operation
+
+    SerialController *instance = nullptr; ///< Instance used from USB status callback
 }
 
 /**
@@ -63,9 +57,17 @@ SerialController::SerialController()
     LOG_DBG("Serial Controller Constructor!");
     k_sem_init(&rxSem, 0, 1);
     k_sem_init(&txSem, 0, 1);
+    ring_buf_init(&rxRing, sizeof(rxRingBuffer), rxRingBuffer);
+    recvLength = 0;
+    lastRecvTime = 0;
 
     serialStatus.store(TransferStatus::Ok, std::memory_order_relaxed);
     serial_is_initialized_.store(false, std::memory_order_relaxed);
+
+    usbState.store(UsbState::Disconnected, std::memory_order_relaxed);
+    portOpen.store(false, std::memory_order_relaxed);
+    k_work_init_delayable(&dtrWork, &SerialController::DtrWorkHandler);
+    k_poll_signal_init(&stateSignal);
 }
 
 /**
@@ -74,10 +76,6 @@ SerialController::SerialController()
  */
 void SerialController::Initialize()
 {
-    
-    uint32_t baudrate, dtr = 0U;
-	int ret;
-
     k_msgq_init(&messageQueue, static_cast<char *>(static_cast<void *>(buffer)), sizeof(SerialTransfer *), MaxEntryCount);
 
 	dev = DEVICE_DT_GET_ONE(zephyr_cdc_acm_uart);
@@ -86,11 +84,13 @@ void SerialController::Initialize()
 		return;
 	}
 
+    instance = this;
+
     // Start working thread
     k_thread_create(&worker, my_stack_area, K_THREAD_STACK_SIZEOF(my_stack_area),
                     &SerialController::WorkingThread, this, nullptr, nullptr, serialPortTaskPriority, 0, K_NO_WAIT);
 
-	ret = usb_enable(NULL);
+	int ret = usb_enable(&SerialController::UsbStatusCallback);
 	if (ret != 0) {
 		LOG_ERR("Failed to enable USB");
 		return;
@@ -131,78 +131,195 @@ uint8_t SerialController::GetStatus()
  */
 void SerialController::WorkingThread(void *data, void *, void *)
 {
-    uint32_t baudrate, dtr = 0U;
-	int ret;
-
     SerialController *self = static_cast<SerialController *>(data);
 
     //uart_callback_set(self->uartDevice, &SerialController::SerialPortCallback, self);
     //uart_irq_callback_set(self->dev, &SerialController::interrupt_handler);
     uart_irq_callback_user_data_set(self->dev, &SerialController::interrupt_handler, self);
 
-	/* Enable rx interrupts */
-	//uart_irq_rx_enable(self->dev);
-
     SerialTransfer *currentTask;
 
-	LOG_DBG("Wait for DTR");
+    // Port state changes are handled first. Queued transfers are kept while port is closed and sent
+    // when the host opens it again.
+    k_poll_event events[3];
+    k_poll_event_init(&events[0], K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &self->stateSignal);
+    k_poll_event_init(&events[1], K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &self->rxSem);
+    k_poll_event_init(&events[2], K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &self->messageQueue);
 
-	while (true) {
-		uart_line_ctrl_get(self->dev, UART_LINE_CTRL_DTR, &dtr);
-		if (dtr) {
-			break;
-		} else {
-			/* Give CPU resources to low priority threads. */
-			k_sleep(K_MSEC(500));
-		}
-	}
+    for (;;)
+    {
+        bool open = self->serial_is_initialized_.load(std::memory_order_relaxed);
+
+        k_poll(events, open ? ARRAY_SIZE(events) : 1, K_FOREVER);
+
+        if (events[0].state == K_POLL_STATE_SIGNALED)
+        {
+            events[0].state = K_POLL_STATE_NOT_READY;
+            k_poll_signal_reset(&self->stateSignal);
+
+            bool portOpen = self->IsPortOpen();
+            if (portOpen && !open)
+            {
+                self->OnPortOpened();
+            }
+            else if (!portOpen && open)
+            {
+                LOG_INF("Port closed, streaming paused");
+                uart_irq_rx_disable(self->dev);
+                self->serial_is_initialized_.store(false, std::memory_order_relaxed);
+            }
+            continue;
+        }
+
+        if (events[1].state == K_POLL_STATE_SEM_AVAILABLE)
+        {
+            events[1].state = K_POLL_STATE_NOT_READY;
+            k_sem_take(&self->rxSem, K_NO_WAIT);
+            self->ProcessReceived();
+        }
+
+        if (events[2].state != K_POLL_STATE_MSGQ_DATA_AVAILABLE)
+        {
+            continue;
+        }
+        events[2].state = K_POLL_STATE_NOT_READY;
+
+        if (k_msgq_get(&self->messageQueue, &currentTask, K_NO_WAIT) != 0)
+        {
+            continue;
+        }
+
+        TransferStatus status = TransferStatus::Ok;
+
+        k_sem_reset(&self->txSem);
+        //LOG_DBG("SerialController::WorkingThread");
+        status = self->SendPacket(*currentTask->request);
+
+        serialStatus.store(status, std::memory_order_relaxed);
+
+        currentTask->completed.store(true, std::memory_order_release);
+
+        if (currentTask->callback.handler)
+        {
+            k_work_submit(&currentTask->callback);
+        }
+    }
+}
 
-	LOG_DBG("DTR set");
+/**
+ * @brief Called by working thread when port is opened by the host. Prepares port for streaming.
+ */
+void SerialController::OnPortOpened()
+{
+    uint32_t baudrate = 0U;
 
 	/* They are optional, we use them to test the interrupt endpoint */
-	ret = uart_line_ctrl_set(self->dev, UART_LINE_CTRL_DCD, 1);
+	int ret = uart_line_ctrl_set(dev, UART_LINE_CTRL_DCD, 1);
 	if (ret) {
 		LOG_WRN("Failed to set DCD, ret code %d", ret);
 	}
 
-	ret = uart_line_ctrl_set(self->dev, UART_LINE_CTRL_DSR, 1);
+	ret = uart_line_ctrl_set(dev, UART_LINE_CTRL_DSR, 1);
 	if (ret) {
 		LOG_WRN("Failed to set DSR, ret code %d", ret);
 	}
 
-	/* Wait 1 sec for the host to do all settings */
-	k_busy_wait(1000000);
-
-	ret = uart_line_ctrl_get(self->dev, UART_LINE_CTRL_BAUD_RATE, &baudrate);
+	ret = uart_line_ctrl_get(dev, UART_LINE_CTRL_BAUD_RATE, &baudrate);
 	if (ret) {
 		LOG_WRN("Failed to get baudrate, ret code %d", ret);
 	} else {
-		LOG_INF("Baudrate detected: %d", baudrate);
+		LOG_INF("Port opened, baudrate: %d", baudrate);
 	}
-    self->serial_is_initialized_.store(true, std::memory_order_relaxed);    
 
-    for (;;)
-    {
-        k_msgq_get(&self->messageQueue, &currentTask, K_FOREVER);
+    // Drop partial frame left from the previous session
+    ring_buf_reset(&rxRing);
+    recvLength = 0;
 
-        TransferStatus status = TransferStatus::Ok;
+	/* Enable rx interrupts. Commands from the host are accepted once the port is open */
+	uart_irq_rx_enable(dev);
 
-        CommandState commandState = CommandState::SendCommand;
+    serial_is_initialized_.store(true, std::memory_order_relaxed);
+}
 
-        k_sem_reset(&self->rxSem);
-        k_sem_reset(&self->txSem);
-        //LOG_DBG("SerialController::WorkingThread");
-        self->SendPacket(*currentTask->request);
+/**
+ * @brief USB stack status callback. Drives USB state machine.
+ * 
+ * @param status USB device status
+ * @param param  status parameter
+ */
+void SerialController::UsbStatusCallback(usb_dc_status_code status, const uint8_t *param)
+{
+    ARG_UNUSED(param);
 
-        serialStatus.store(status, std::memory_order_relaxed);
+    SerialController *self = instance;
+    if (self == nullptr)
+    {
+        return;
+    }
 
-        currentTask->completed.store(true, std::memory_order_release);
+    switch (status)
+    {
+    case USB_DC_CONFIGURED:
+        LOG_DBG("USB configured");
+        self->usbState.store(UsbState::Configured, std::memory_order_relaxed);
+        k_work_reschedule(&self->dtrWork, K_NO_WAIT);
+        break;
 
-        if (currentTask->callback.handler)
+    case USB_DC_RESUME:
+        if (self->usbState.load(std::memory_order_relaxed) == UsbState::Suspended)
         {
-            k_work_submit(&currentTask->callback);
+            LOG_DBG("USB resumed");
+            self->usbState.store(UsbState::Configured, std::memory_order_relaxed);
+            k_work_reschedule(&self->dtrWork, K_NO_WAIT);
         }
+        break;
+
+    case USB_DC_SUSPEND:
+    case USB_DC_DISCONNECTED:
+    case USB_DC_RESET:
+        LOG_DBG("USB %s", status == USB_DC_SUSPEND ? "suspended" : "disconnected");
+        self->usbState.store(status == USB_DC_SUSPEND ? UsbState::Suspended : UsbState::Disconnected,
+                             std::memory_order_relaxed);
+        k_work_cancel_delayable(&self->dtrWork);
+
+        if (self->portOpen.exchange(false, std::memory_order_relaxed))
+        {
+            k_poll_signal_raise(&self->stateSignal, 0);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Tracks DTR line state while device is configured. Legacy CDC ACM class has no line state
+ *        notification, so line state is sampled with short period and working thread is signalled on change.
+ * 
+ * @param work worker
+ */
+void SerialController::DtrWorkHandler(k_work *work)
+{
+    k_work_delayable *delayable = k_work_delayable_from_work(work);
+    SerialController *self = CONTAINER_OF(delayable, SerialController, dtrWork);
+
+    if (self->usbState.load(std::memory_order_relaxed) != UsbState::Configured)
+    {
+        return;
+    }
+
+    uint32_t dtr = 0U;
+    uart_line_ctrl_get(self->dev, UART_LINE_CTRL_DTR, &dtr);
+
+    bool open = dtr != 0;
+    if (self->portOpen.exchange(open, std::memory_order_relaxed) != open)
+    {
+        LOG_DBG("DTR %s", open ? "set" : "cleared");
+        k_poll_signal_raise(&self->stateSignal, 0);
     }
+
+    k_work_schedule(&self->dtrWork, K_MSEC(dtrPollPeriodMs));
 }
 
 /**
@@ -231,6 +348,19 @@ TransferStatus SerialController::SendNeg()
     return SendInternal(smallPacketSize);
 }
 
+/**
+ * @brief Send Ack message.
+ * 
+ * @return TransferStatus transfer status
+ */
+TransferStatus SerialController::SendAck()
+{
+    sendBuffer[packetHeader0] = headerAckValue;
+    sendBuffer[packetHeader1] = headerAckValue;
+
+    return SendInternal(smallPacketSize);
+}
+
 /**
  * @brief Sends prepared send buffer.
  * 
@@ -263,23 +393,143 @@ TransferStatus SerialController::SendInternal(size_t packetSize)
  * @brief Handles receive from connected UART
  * 
  * @param packet reference where received data should be stored
- * @return TransferStatus Transfer status.
+ * @return TransferStatus Transfer status. Return TransferStatus::Timeout if no complete frame was received yet.
  */
 TransferStatus SerialController::Receive(SerialPacket &packet)
 {
-    int take_result = k_sem_take(&rxSem, transferTimeout);
-
-    if (take_result == -EAGAIN)
+    if (!AssembleFrame())
     {
-        uart_rx_disable(uartDevice);
         return TransferStatus::Timeout;
     }
 
     TransferStatus result = ParseBuffer(packet);
+    recvLength = 0;
 
     return result;
 }
 
+/**
+ * @brief Move bytes from the receive ring buffer into receive buffer until a complete frame is assembled
+ * 
+ * @return true if receive buffer contains complete frame
+ */
+bool SerialController::AssembleFrame()
+{
+    uint32_t now = k_uptime_get_32();
+
+    // Drop partial frame if the host stopped sending in the middle of it
+    if (recvLength != 0 && (now - lastRecvTime) > k_ticks_to_ms_ceil32(transferTimeout.ticks))
+    {
+        LOG_WRN("Dropping %d bytes of incomplete frame", recvLength);
+        recvLength = 0;
+    }
+
+    uint8_t byte;
+    while (ring_buf_get(&rxRing, &byte, 1) == 1)
+    {
+        lastRecvTime = now;
+        recvBuffer[recvLength++] = byte;
+
+        if (recvLength == 1)
+        {
+            // Wait for valid header start
+            if (byte != headerValue && byte != headerAckValue && byte != headerNegValue)
+            {
+                recvLength = 0;
+            }
+            continue;
+        }
+
+        if (recvLength == smallPacketSize)
+        {
+            if (recvBuffer[packetHeader1] != recvBuffer[packetHeader0])
+            {
+                // Resynchronize on the last byte
+                recvBuffer[packetHeader0] = byte;
+                recvLength = (byte == headerValue || byte == headerAckValue || byte == headerNegValue) ? 1 : 0;
+                continue;
+            }
+
+            if (byte != headerValue)
+            {
+                return true; // Ack or Neg
+            }
+            continue;
+        }
+
+        if (recvLength > packetHeaderMessageLength)
+        {
+            size_t frameSize = recvBuffer[packetHeaderMessageLength] + metadataSize;
+            if (frameSize > BufferSize)
+            {
+                recvLength = 0;
+                continue;
+            }
+
+            if (recvLength == frameSize)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Process bytes received from the host. Passes valid frames to the receive handler, acks frames
+ *        the handler accepts and negs malformed or rejected ones.
+ */
+void SerialController::ProcessReceived()
+{
+    SerialPacket packet;
+
+    for (;;)
+    {
+        packet.dataPtr = recvData;
+        packet.length = sizeof(recvData) - 1;
+
+        TransferStatus result = Receive(packet);
+
+        switch (result)
+        {
+        case TransferStatus::Timeout:
+            return;
+
+        case TransferStatus::Ok:
+            // Ack only once the frame is accepted, so the host can resend a rejected one
+            if (!receiveHandler || receiveHandler(packet))
+            {
+                SendAck();
+            }
+            else
+            {
+                SendNeg();
+            }
+            break;
+
+        case TransferStatus::Error:
+            LOG_WRN("Malformed frame received");
+            SendNeg();
+            break;
+
+        default:
+            // Ack/Neg from the host, nothing to do
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Register handler for packets received from the host
+ * 
+ * @param handler handler to call when valid packet is received
+ */
+void SerialController::SetReceiveHandler(SerialReceiveHandler &&handler)
+{
+    receiveHandler = std::move(handler);
+}
+
 /**
  * @brief Serialize packet into internal send buffer
  * 
@@ -400,7 +650,16 @@ void SerialController::interrupt_handler(const struct device *dev, void *user_da
     SerialController *self = static_cast<SerialController *>(user_data);
 
 	while (uart_irq_update(dev) && uart_irq_is_pending(dev)) {
-		if (uart_irq_rx_ready(dev)) {        
+		if (uart_irq_rx_ready(dev)) {
+			uint8_t buffer[64];
+			int recv_len = uart_fifo_read(dev, buffer, sizeof(buffer));
+
+			if (recv_len > 0) {
+				if (ring_buf_put(&self->rxRing, buffer, recv_len) < static_cast<uint32_t>(recv_len)) {
+					LOG_WRN("RX ring buffer overflow");
+				}
+				k_sem_give(&self->rxSem);
+			}
 		}
 
 		if (uart_irq_tx_ready(dev)) {
@@ -424,4 +683,8 @@ bool SerialController::IsInitialized(){
     bool status;
     status = serial_is_initialized_.load(std::memory_order_relaxed);
     return status;
+}
+
+bool SerialController::IsPortOpen(){
+    return portOpen.load(std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -0,0 +1,237 @@
+#if CONFIG_USE_ADS131_SIGNAL_QUALITY
+
+#include "signal_quality.hpp"
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+
+#include "usb_comm_handler.hpp"
+
+LOG_MODULE_REGISTER(signal_quality, LOG_LEVEL_INF);
+
+BUILD_ASSERT(2 * CONFIG_ADS131_QUALITY_LINE_HZ < CONFIG_ADS131_SAMPLE_RATE,
+             "CONFIG_ADS131_QUALITY_LINE_HZ must be below half of CONFIG_ADS131_SAMPLE_RATE");
+
+namespace
+{
+    constexpr static double pi = 3.14159265358979;
+    constexpr static int32_t railCode = (1 << 23) - 16; ///< ADC clips at 0x7FFFFF and 0x800000, codes this close count
+    constexpr static double fullScale = 1 << 23;        ///< Full scale ADC code, 0 dB
+    constexpr static double q15 = 32767.0;              ///< Q15 scale of the sine table
+    constexpr static uint32_t quarterPeriod = 1u << 30; ///< Quarter of a Q32 period, cosine from the sine table
+
+    /**
+     * @brief Level byte of a mean square in ADC codes: 0.5 dB steps from -120 dB of full scale
+     */
+    uint8_t Level(double power)
+    {
+        if (power <= 0.0)
+        {
+            return 0;
+        }
+
+        double db = 10.0 * log10(power / (fullScale * fullScale));
+        return static_cast<uint8_t>(CLAMP(lround(2.0 * (db + 120.0)), 0, UINT8_MAX));
+    }
+}
+
+/**
+ * @brief Construct SignalQuality
+ *
+ * @param controller USB communication controller
+ */
+SignalQuality::SignalQuality(UsbCommHandler &controller) : stream(controller)
+{
+}
+
+/**
+ * @brief Initialization function. Builds line frequency table and clears accumulators
+ *
+ * @param rate ADC sample rate, Hz
+ */
+void SignalQuality::Initialize(uint32_t rate)
+{
+    sampleRate = rate;
+    lineStep = static_cast<uint32_t>((static_cast<uint64_t>(CONFIG_ADS131_QUALITY_LINE_HZ) << 32) / sampleRate);
+
+    for (size_t i = 0; i < ARRAY_SIZE(sine); ++i)
+    {
+        sine[i] = static_cast<int16_t>(lround(q15 * sin(2.0 * pi * i / ARRAY_SIZE(sine))));
+    }
+
+    for (Device &dev : devices)
+    {
+        Reset(dev);
+        dev.counter = 0;
+    }
+
+    LOG_INF("%u SPS, %u Hz line, flat below %u codes peak to peak", sampleRate, CONFIG_ADS131_QUALITY_LINE_HZ,
+            CONFIG_ADS131_QUALITY_FLAT_CODES);
+}
+
+/**
+ * @brief Add block of ADC samples of one device. Sends a record when a second of samples is complete
+ *
+ * @param device device index, less than Ads131Pipeline::MaxDevices
+ * @param input per channel samples, 24-bit ADC codes scaled by 2^Ads131Pipeline::SampleShift
+ * @param frames number of samples per channel
+ */
+void SignalQuality::PushBlock(size_t device, const q31_t (&input)[Channels][Ads131Pipeline::MaxBlockFrames],
+                              size_t frames)
+{
+    Device &dev = devices[device];
+    size_t first = 0;
+
+    // Blocks don't divide a second, so the block is split where the second ends
+    while (first < frames)
+    {
+        size_t count = MIN(frames - first, sampleRate - dev.samples);
+        uint32_t start = k_cycle_get_32();
+
+        Accumulate(dev, input, first, count);
+
+        dev.cycles += k_cycle_get_32() - start;
+        dev.samples += count;
+        first += count;
+
+        if (dev.samples == sampleRate)
+        {
+            Record(dev, device);
+        }
+    }
+}
+
+/**
+ * @brief Clear accumulators of device and restart line phase
+ */
+void SignalQuality::Reset(Device &dev)
+{
+    for (Channel &channel : dev.channels)
+    {
+        channel = {};
+        channel.min = INT32_MAX;
+        channel.max = INT32_MIN;
+    }
+
+    dev.phase = 0;
+    dev.cosSum = 0;
+    dev.sinSum = 0;
+    dev.samples = 0;
+    dev.cycles = 0;
+}
+
+/**
+ * @brief Accumulate samples of every channel
+ *
+ * @param dev device
+ * @param input per channel samples
+ * @param first index of the first sample
+ * @param count number of samples
+ */
+void SignalQuality::Accumulate(Device &dev, const q31_t (&input)[Channels][Ads131Pipeline::MaxBlockFrames],
+                               size_t first, size_t count)
+{
+    int16_t lineCos[Ads131Pipeline::MaxBlockFrames];
+    int16_t lineSin[Ads131Pipeline::MaxBlockFrames];
+
+    // Channels of a device are sampled together and share the line phase
+    for (size_t i = 0; i < count; ++i)
+    {
+        lineSin[i] = sine[dev.phase >> (32 - tableBits)];
+        lineCos[i] = sine[(dev.phase + quarterPeriod) >> (32 - tableBits)];
+        dev.cosSum += lineCos[i];
+        dev.sinSum += lineSin[i];
+        dev.phase += lineStep;
+    }
+
+    for (size_t ch = 0; ch < Channels; ++ch)
+    {
+        Channel &channel = dev.channels[ch];
+        const q31_t *samples = input[ch] + first;
+        // Locals keep the accumulators in registers: one add, three multiply-accumulates and three compares per sample
+        int64_t sum = channel.sum;
+        int64_t squares = channel.squares;
+        int64_t cosSum = channel.lineCos;
+        int64_t sinSum = channel.lineSin;
+        int32_t min = channel.min;
+        int32_t max = channel.max;
+        uint32_t clipped = channel.clipped;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            int32_t code = samples[i] >> Ads131Pipeline::SampleShift;
+
+            sum += code;
+            squares += static_cast<int64_t>(code) * code;
+            cosSum += static_cast<int64_t>(code) * lineCos[i];
+            sinSum += static_cast<int64_t>(code) * lineSin[i];
+            min = MIN(min, code);
+            max = MAX(max, code);
+            clipped += (code >= railCode || code <= -railCode) ? 1 : 0;
+        }
+
+        channel.sum = sum;
+        channel.squares = squares;
+        channel.lineCos = cosSum;
+        channel.lineSin = sinSum;
+        channel.min = min;
+        channel.max = max;
+        channel.clipped = clipped;
+    }
+}
+
+/**
+ * @brief Send statuses of every channel and restart accumulators
+ */
+void SignalQuality::Record(Device &dev, size_t index)
+{
+    uint8_t record[headerSize + Channels * channelSize];
+    uint8_t *out = record + headerSize;
+    double count = dev.samples;
+
+    record[0] = dev.counter++;
+    record[1] = index;
+    record[2] = Channels;
+
+    for (const Channel &channel : dev.channels)
+    {
+        double mean = channel.sum / count;
+        double power = MAX(channel.squares / count - mean * mean, 0.0);
+        // A sine of amplitude A gives a DFT bin of A * count / 2, and has a mean square of A^2 / 2
+        double real = (channel.lineCos - mean * dev.cosSum) / q15;
+        double imaginary = (channel.lineSin - mean * dev.sinSum) / q15;
+        double line = 2.0 * (real * real + imaginary * imaginary) / (count * count);
+        uint8_t flags = 0;
+
+        if (channel.clipped != 0)
+        {
+            flags |= SignalQualityClipped;
+        }
+        if (static_cast<int64_t>(channel.max) - channel.min < CONFIG_ADS131_QUALITY_FLAT_CODES)
+        {
+            flags |= SignalQualityFlat;
+        }
+        if (power > 0.0 && 100.0 * line > CONFIG_ADS131_QUALITY_LINE_PERCENT * power)
+        {
+            flags |= SignalQualityLineNoise;
+        }
+
+        out[0] = flags;
+        out[1] = DIV_ROUND_UP(100 * channel.clipped, dev.samples);
+        out[2] = Level(line);
+        out[3] = Level(power);
+        out += channelSize;
+    }
+
+    LOG_DBG("Device %u: %u cycles per sample", index, dev.cycles / (dev.samples * Channels));
+
+    Reset(dev);
+
+    stream.Publish(record, out - record);
+}
+
+#endif // CONFIG_USE_ADS131_SIGNAL_QUALITY
@@ -48,6 +48,9 @@ int Tlc5940::Initialize(uint16_t initialValue) {
     
     SetAll(initialValue);
 
+    feedbackPending.store(false, std::memory_order_relaxed);
+    k_sem_init(&refresh, 0, 1);
+
     LOG_DBG("Tlc5940 Intl'ed!");
 
     Bluetooth::GattRegisterControlCallback(CommandId::Tlc5940Cmd,
@@ -114,8 +117,27 @@ uint16_t Tlc5940::Get(uint8_t channel){
     return value;
 }
 
+void Tlc5940::SetFeedback(uint8_t channel, uint16_t value, uint32_t stamp){
+
+    if (channel == 0xFF) {
+        SetAll(value);
+    } else {
+        Set(channel, value);
+    }
+
+    feedbackStamp.store(stamp, std::memory_order_relaxed);
+    feedbackPending.store(true, std::memory_order_release);
+    k_sem_give(&refresh);
+}
+
+LatencyMeter::Summary Tlc5940::TakeLatchLatency(){
+    return latchLatency.Take();
+}
+
 int Tlc5940::Update(){
     bool first_time_here = true;
+    // Only changes made before the data is shifted in are latched by this update
+    bool pending = feedbackPending.exchange(false, std::memory_order_acquire);
 
     //TODO: read VCPRG state. If it is HIGH
     // set it to LOW and set firstCycleFlag flag to 1
@@ -139,6 +161,10 @@ int Tlc5940::Update(){
     PulsePin(XLAT_PIN, LOW_TO_HIGH);
     SetPin(BLANK_PIN, 0);
 
+    if (pending) {
+        latchLatency.Add(feedbackStamp.load(std::memory_order_relaxed));
+    }
+
     for(int j = 0; j < 4096; j++){
         PulsePin(GSCLK_PIN, LOW_TO_HIGH);
     }
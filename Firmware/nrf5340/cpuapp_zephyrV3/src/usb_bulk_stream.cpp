@@ -0,0 +1,363 @@
+#include "usb_bulk_stream.hpp"
+
+#if CONFIG_USE_USB_BULK
+
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/usb/usb_ch9.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(usb_bulk, LOG_LEVEL_INF);
+
+namespace
+{
+    constexpr static size_t headerSize = 4;
+    constexpr static uint8_t headerValue = 0xF0;
+    constexpr static uint8_t crcPolynom = 0x31;
+    constexpr static uint8_t crcInitilalValue = 0xFF;
+
+    constexpr static uint8_t bulkOutEpAddr = 0x01; ///< Initial OUT endpoint address. Fixed up by USB stack
+    constexpr static uint8_t bulkInEpAddr = 0x81;  ///< Initial IN endpoint address. Fixed up by USB stack
+    constexpr static uint16_t bulkEpMps = 64;      ///< Full speed bulk endpoint max packet size
+
+    /**
+     * @brief Vendor interface descriptors
+     */
+    struct UsbBulkDescriptor
+    {
+        usb_if_descriptor if0;
+        usb_ep_descriptor if0OutEp;
+        usb_ep_descriptor if0InEp;
+    } __packed;
+
+    USBD_CLASS_DESCR_DEFINE(primary, 1) UsbBulkDescriptor bulkDescriptor = {
+        .if0 = {
+            .bLength = sizeof(usb_if_descriptor),
+            .bDescriptorType = USB_DESC_INTERFACE,
+            .bInterfaceNumber = 0,
+            .bAlternateSetting = 0,
+            .bNumEndpoints = 2,
+            .bInterfaceClass = USB_BCC_VENDOR,
+            .bInterfaceSubClass = 0,
+            .bInterfaceProtocol = 0,
+            .iInterface = 0,
+        },
+        .if0OutEp = {
+            .bLength = sizeof(usb_ep_descriptor),
+            .bDescriptorType = USB_DESC_ENDPOINT,
+            .bEndpointAddress = bulkOutEpAddr,
+            .bmAttributes = USB_DC_EP_BULK,
+            .wMaxPacketSize = sys_cpu_to_le16(bulkEpMps),
+            .bInterval = 0,
+        },
+        .if0InEp = {
+            .bLength = sizeof(usb_ep_descriptor),
+            .bDescriptorType = USB_DESC_ENDPOINT,
+            .bEndpointAddress = bulkInEpAddr,
+            .bmAttributes = USB_DC_EP_BULK,
+            .wMaxPacketSize = sys_cpu_to_le16(bulkEpMps),
+            .bInterval = 0,
+        },
+    };
+
+    usb_ep_cfg_data bulkEndpoints[2]; ///< Endpoint configuration. Addresses are updated by USB stack
+
+    /**
+     * @brief Called by USB stack when interface number is assigned
+     */
+    void OnInterfaceConfig(usb_desc_header *head, uint8_t bInterfaceNumber)
+    {
+        ARG_UNUSED(head);
+        bulkDescriptor.if0.bInterfaceNumber = bInterfaceNumber;
+    }
+
+    USBD_DEFINE_CFG_DATA(bulkConfig); ///< Interface configuration. Filled in UsbBulkStream::Initialize
+
+    UsbBulkStream *instance = nullptr; ///< Instance used from USB status callback
+}
+
+/**
+ * @brief Construct Usb Bulk Stream.
+ * @note Only one instance could be constructed
+ */
+UsbBulkStream::UsbBulkStream()
+{
+    ring_buf_init(&txRing, sizeof(txRingBuffer), txRingBuffer);
+    claimedSize = 0;
+
+    configured.store(false, std::memory_order_relaxed);
+    writeBusy.store(false, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Initialization function. Must be called before usb_enable, because endpoint configuration is
+ *        used when USB descriptors are built.
+ */
+void UsbBulkStream::Initialize()
+{
+    instance = this;
+
+    bulkEndpoints[0].ep_cb = usb_transfer_ep_callback;
+    bulkEndpoints[0].ep_addr = bulkOutEpAddr;
+    bulkEndpoints[1].ep_cb = usb_transfer_ep_callback;
+    bulkEndpoints[1].ep_addr = bulkInEpAddr;
+
+    bulkConfig.usb_device_description = nullptr;
+    bulkConfig.interface_config = OnInterfaceConfig;
+    bulkConfig.interface_descriptor = &bulkDescriptor.if0;
+    bulkConfig.cb_usb_status = &UsbBulkStream::OnStatus;
+    bulkConfig.interface.class_handler = nullptr;
+    bulkConfig.interface.vendor_handler = nullptr;
+    bulkConfig.interface.custom_handler = nullptr;
+    bulkConfig.num_endpoints = ARRAY_SIZE(bulkEndpoints);
+    bulkConfig.endpoint = bulkEndpoints;
+
+    LOG_INF("USB bulk stream initialized%s", IS_ENABLED(CONFIG_USB_BULK_LOOPBACK) ? " (loopback)" : "");
+}
+
+/**
+ * @brief Check if host has configured the device and bulk IN endpoint could be used
+ *
+ * @return true if configured, false owtherwise
+ */
+bool UsbBulkStream::IsConfigured()
+{
+    return configured.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Get number of frames dropped because transmit buffer was full
+ *
+ * @return number of dropped frames
+ */
+uint32_t UsbBulkStream::GetDroppedFrames()
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Queue data frame for sending via bulk IN endpoint. Frame is either queued completely or dropped.
+ *
+ * @param messageId message id
+ * @param buffer    message data. Data is copied before return
+ * @param length    message data length
+ * @return true if frame was queued, false if device is not configured or transmit buffer is full
+ */
+bool UsbBulkStream::Write(uint8_t messageId, const uint8_t *buffer, size_t length)
+{
+    if (!IsConfigured() || length > UINT8_MAX)
+    {
+        return false;
+    }
+
+    uint8_t header[headerSize] = {headerValue, headerValue, messageId, static_cast<uint8_t>(length)};
+
+    uint8_t crc = crc8(header, sizeof(header), crcPolynom, crcInitilalValue, false);
+    crc = crc8(buffer, length, crcPolynom, crc, false);
+
+    k_spinlock_key_t key = k_spin_lock(&txLock);
+
+    if (ring_buf_space_get(&txRing) < sizeof(header) + length + sizeof(crc))
+    {
+        k_spin_unlock(&txLock, key);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    ring_buf_put(&txRing, header, sizeof(header));
+    ring_buf_put(&txRing, buffer, length);
+    ring_buf_put(&txRing, &crc, sizeof(crc));
+
+    k_spin_unlock(&txLock, key);
+
+    StartWrite();
+
+    return true;
+}
+
+/**
+ * @brief Put raw bytes into transmit buffer and start transfer
+ *
+ * @param buffer data to send
+ * @param length data length
+ * @return true if all data was queued
+ */
+bool UsbBulkStream::WriteRaw(const uint8_t *buffer, size_t length)
+{
+    k_spinlock_key_t key = k_spin_lock(&txLock);
+    uint32_t written = ring_buf_put(&txRing, buffer, length);
+    k_spin_unlock(&txLock, key);
+
+    StartWrite();
+
+    return written == length;
+}
+
+/**
+ * @brief Start bulk IN transfer if no transfer is in progress and transmit buffer is not empty
+ */
+void UsbBulkStream::StartWrite()
+{
+    bool expected = false;
+    if (!IsConfigured() || !writeBusy.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    uint8_t *data;
+    claimedSize = ring_buf_get_claim(&txRing, &data, maxTransferSize);
+
+    if (claimedSize == 0)
+    {
+        writeBusy.store(false, std::memory_order_release);
+
+        // Writer could have added data between claim and flag release
+        if (!ring_buf_is_empty(&txRing))
+        {
+            StartWrite();
+        }
+        return;
+    }
+
+    int ret = usb_transfer(bulkEndpoints[1].ep_addr, data, claimedSize, USB_TRANS_WRITE,
+                           &UsbBulkStream::OnWriteComplete, this);
+    if (ret < 0)
+    {
+        LOG_WRN("Bulk IN transfer failed: %d", ret);
+        ring_buf_get_finish(&txRing, 0);
+        claimedSize = 0;
+        writeBusy.store(false, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Bulk IN transfer complete callback. Releases sent bytes and starts next transfer
+ *
+ * @param ep    endpoint
+ * @param tsize number of bytes transferred, negative on error
+ * @param priv  pointer to current instance of Usb Bulk Stream
+ */
+void UsbBulkStream::OnWriteComplete(uint8_t ep, int tsize, void *priv)
+{
+    UsbBulkStream *self = static_cast<UsbBulkStream *>(priv);
+
+    if (tsize < 0)
+    {
+        LOG_DBG("Bulk IN transfer aborted: %d", tsize);
+    }
+
+    // Data is released even if transfer failed, frames are not retransmitted
+    ring_buf_get_finish(&self->txRing, self->claimedSize);
+    self->claimedSize = 0;
+
+    // OnStatus keeps the ring while this transfer is in flight, data queued for a host that left is stale
+    if (!self->IsConfigured())
+    {
+        k_spinlock_key_t key = k_spin_lock(&self->txLock);
+        ring_buf_reset(&self->txRing);
+        k_spin_unlock(&self->txLock, key);
+    }
+
+    self->writeBusy.store(false, std::memory_order_release);
+
+    self->StartWrite();
+}
+
+/**
+ * @brief Start bulk OUT transfer
+ */
+void UsbBulkStream::StartRead()
+{
+    int ret = usb_transfer(bulkEndpoints[0].ep_addr, readBuffer, sizeof(readBuffer), USB_TRANS_READ,
+                           &UsbBulkStream::OnReadComplete, this);
+    if (ret < 0)
+    {
+        LOG_WRN("Bulk OUT transfer failed: %d", ret);
+    }
+}
+
+/**
+ * @brief Bulk OUT transfer complete callback. In loopback mode echoes received data back to the host
+ *
+ * @param ep    endpoint
+ * @param tsize number of bytes transferred, negative on error
+ * @param priv  pointer to current instance of Usb Bulk Stream
+ */
+void UsbBulkStream::OnReadComplete(uint8_t ep, int tsize, void *priv)
+{
+    UsbBulkStream *self = static_cast<UsbBulkStream *>(priv);
+
+    if (tsize < 0 || !self->IsConfigured())
+    {
+        return;
+    }
+
+    if (IS_ENABLED(CONFIG_USB_BULK_LOOPBACK) && tsize > 0)
+    {
+        if (!self->WriteRaw(self->readBuffer, tsize))
+        {
+            self->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    self->StartRead();
+}
+
+/**
+ * @brief USB device status callback. Starts bulk transfers when the host configures the device, cancels them and
+ *        discards queued data when the host leaves
+ *
+ * @param cfg    interface configuration
+ * @param status device status
+ * @param param  status parameter
+ */
+void UsbBulkStream::OnStatus(usb_cfg_data *cfg, usb_dc_status_code status, const uint8_t *param)
+{
+    ARG_UNUSED(cfg);
+    ARG_UNUSED(param);
+
+    UsbBulkStream *self = instance;
+    if (self == nullptr)
+    {
+        return;
+    }
+
+    switch (status)
+    {
+    case USB_DC_CONFIGURED:
+        if (!self->configured.exchange(true, std::memory_order_acq_rel))
+        {
+            LOG_INF("Bulk interface configured");
+            self->StartRead();
+            self->StartWrite();
+        }
+        break;
+
+    case USB_DC_DISCONNECTED:
+    case USB_DC_RESET:
+        if (self->configured.exchange(false, std::memory_order_acq_rel))
+        {
+            LOG_INF("Bulk interface released");
+            usb_cancel_transfer(bulkEndpoints[0].ep_addr);
+            usb_cancel_transfer(bulkEndpoints[1].ep_addr);
+
+            // Data queued for disconnected host is stale
+            k_spinlock_key_t key = k_spin_lock(&self->txLock);
+            if (!self->writeBusy.load(std::memory_order_acquire))
+            {
+                ring_buf_reset(&self->txRing);
+            }
+            k_spin_unlock(&self->txLock, key);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+#endif // CONFIG_USE_USB_BULK
@@ -3,6 +3,9 @@
 #include <zephyr/kernel.h>
 
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "i2c_queue.hpp"
 
 LOG_MODULE_REGISTER(UsbCommHandler);
 
@@ -32,6 +35,19 @@ UsbCommHandler::UsbCommHandler(SerialController &serial)
 
         Release(&transfersBuffer[i]);
     }
+
+    subscriptionMask.store(UINT16_MAX, std::memory_order_relaxed);
+
+    for (auto &stream : streams)
+    {
+        stream.decimation.store(1, std::memory_order_relaxed);
+        stream.minIntervalMs.store(0, std::memory_order_relaxed);
+        stream.decimationCounter = 0;
+        stream.lastSentMs = 0;
+        stream.sent.store(0, std::memory_order_relaxed);
+        stream.filtered.store(0, std::memory_order_relaxed);
+        stream.dropped.store(0, std::memory_order_relaxed);
+    }
 }
 
 /**
@@ -41,6 +57,361 @@ UsbCommHandler::UsbCommHandler(SerialController &serial)
 void UsbCommHandler::Initialize()
 {
     LOG_INF("UsbCommHandler Initialization...");
+
+    k_msgq_init(&commandQueue, commandQueueBuffer, sizeof(UsbCommand), maxPendingCommands);
+    k_work_init(&commandWork, &UsbCommHandler::CommandWorkHandler);
+
+#if CONFIG_USE_USB_BULK
+    // Bulk interface has to be registered before USB stack is enabled by serial controller
+    bulk.Initialize();
+#endif
+
+    serial.SetReceiveHandler([this](const SerialPacket &packet)
+        {
+            return OnPacketReceived(packet);
+        });
+
+    Bluetooth::GattRegisterControlCallback(CommandId::UsbCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return OnBleCommand(buffer, key, length, offset);
+        });
+
+#if CONFIG_USE_RECORDER
+    recorder.Initialize([this](const uint8_t *buffer, size_t length)
+        {
+            return SendMessage(UsbMessageId::RecorderData, buffer, length);
+        });
+
+    Bluetooth::GattRegisterControlCallback(CommandId::RecorderCmd,
+        [this](const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+        {
+            return offset.value == 0 && OnRecorderCommand(key);
+        });
+#endif
+}
+
+/**
+ * @brief Handles CommandId::RecorderCmd commands
+ * 
+ * @param key    command key. key[0] is RecorderCommand
+ * @return true if command was processed
+ */
+bool UsbCommHandler::OnRecorderCommand(Bluetooth::CommandKey key)
+{
+#if CONFIG_USE_RECORDER
+    switch (static_cast<RecorderCommand>(key.key[0]))
+    {
+    case RecorderCommand::Start:
+        recorder.Start();
+        break;
+
+    case RecorderCommand::Stop:
+        recorder.Stop();
+        break;
+
+    case RecorderCommand::Erase:
+        recorder.Erase();
+        break;
+
+    case RecorderCommand::Offload:
+        recorder.Offload();
+        break;
+
+    case RecorderCommand::GetInfo:
+    {
+        uint8_t info[Recorder::InfoSize];
+        size_t length = recorder.GetInfo(info);
+
+        // State is a command response, so it goes with other responses over serial port
+        SerialTransfer *transfer = CreateTransferFrom(UsbMessageId::RecorderInfo, info, length, 0);
+        return QueueTransfer(transfer, true);
+    }
+
+    default:
+        return false;
+    }
+
+    return true;
+#else
+    ARG_UNUSED(key);
+    return false;
+#endif
+}
+
+/**
+ * @brief Send non-sample message to PC. Uses bulk endpoint when it is enabled and configured by the host,
+ *        serial port otherwise.
+ * 
+ * @param messageId message id
+ * @param buffer    message data. Data is copied before return
+ * @param length    data length
+ * @return true if message was queued
+ */
+bool UsbCommHandler::SendMessage(UsbMessageId messageId, const uint8_t *buffer, size_t length)
+{
+#if CONFIG_USE_USB_BULK
+    if (bulk.IsConfigured())
+    {
+        return bulk.Write(static_cast<uint8_t>(messageId), buffer, length);
+    }
+#endif
+
+    if (!serial.IsInitialized())
+    {
+        return false;
+    }
+
+    SerialTransfer *transfer = CreateTransferFrom(messageId, buffer, length, 0);
+
+    return QueueTransfer(transfer, true);
+}
+
+/**
+ * @brief Handles CommandId::UsbCmd commands
+ * 
+ * @param buffer command data
+ * @param key    command key. key[0] is UsbStreamCommand
+ * @param length command data length
+ * @param offset command data offset
+ * @return true if command was processed
+ */
+bool UsbCommHandler::OnBleCommand(const uint8_t *buffer, Bluetooth::CommandKey key, Bluetooth::BleLength length, Bluetooth::BleOffset offset)
+{
+    if (offset.value != 0)
+    {
+        return false;
+    }
+
+    switch (static_cast<UsbStreamCommand>(key.key[0]))
+    {
+    case UsbStreamCommand::SetSubscription:
+        if (length.value < 2)
+        {
+            return false;
+        }
+        subscriptionMask.store(sys_get_le16(buffer), std::memory_order_relaxed);
+        LOG_INF("USB subscription mask: 0x%04X", sys_get_le16(buffer));
+        break;
+
+    case UsbStreamCommand::SetDecimation:
+        if (length.value < 2 || buffer[0] >= maxStreams || buffer[1] == 0)
+        {
+            return false;
+        }
+        streams[buffer[0]].decimation.store(buffer[1], std::memory_order_relaxed);
+        break;
+
+    case UsbStreamCommand::SetMinInterval:
+        if (length.value < 3 || buffer[0] >= maxStreams)
+        {
+            return false;
+        }
+        streams[buffer[0]].minIntervalMs.store(sys_get_le16(buffer + 1), std::memory_order_relaxed);
+        break;
+
+    case UsbStreamCommand::GetStats:
+        return SendStreamStats();
+
+    case UsbStreamCommand::GetI2cStats:
+        return SendI2cStats();
+
+    case UsbStreamCommand::ResetStats:
+        for (auto &stream : streams)
+        {
+            stream.sent.store(0, std::memory_order_relaxed);
+            stream.filtered.store(0, std::memory_order_relaxed);
+            stream.dropped.store(0, std::memory_order_relaxed);
+        }
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Queue stream counters message to the host
+ * 
+ * @return true if message was queued
+ */
+bool UsbCommHandler::SendStreamStats()
+{
+    constexpr size_t entrySize = 1 + 3 * sizeof(uint32_t);
+    constexpr SensorId sensors[] = {SensorId::Ads131m08_0, SensorId::Ads131m08_1, SensorId::Mpu6050,
+                                    SensorId::Max30102, SensorId::Bme280, SensorId::Qmc5883l,
+                                    SensorId::Vitals, SensorId::Orientation, SensorId::BandPower,
+                                    SensorId::DmicSpectrum, SensorId::DmicAudio, SensorId::SignalQuality,
+                                    SensorId::CaptureEvent};
+    uint8_t message[entrySize * ARRAY_SIZE(sensors)];
+    uint8_t *entry = message;
+
+    for (SensorId sensor : sensors)
+    {
+        const StreamControl &stream = streams[static_cast<size_t>(sensor)];
+
+        entry[0] = static_cast<uint8_t>(sensor);
+        sys_put_le32(stream.sent.load(std::memory_order_relaxed), entry + 1);
+        sys_put_le32(stream.filtered.load(std::memory_order_relaxed), entry + 5);
+        sys_put_le32(stream.dropped.load(std::memory_order_relaxed), entry + 9);
+        entry += entrySize;
+    }
+
+    SerialTransfer *transfer = CreateTransferFrom(UsbMessageId::StreamStats, message, sizeof(message), 0);
+
+    return QueueTransfer(transfer, true);
+}
+
+/**
+ * @brief Queue I2C bus utilization message to the host
+ * 
+ * @return true if message was queued
+ */
+bool UsbCommHandler::SendI2cStats()
+{
+    // Message has to fit single 255 byte transfer
+    constexpr size_t maxBuses = 2;
+    constexpr size_t maxDevices = 5;
+    constexpr size_t busEntrySize = 2 + 4 * sizeof(uint32_t) + 1;
+    constexpr size_t deviceEntrySize = 1 + 4 * sizeof(uint32_t) + 2 * sizeof(uint16_t);
+    uint8_t message[maxBuses * (busEntrySize + maxDevices * deviceEntrySize)];
+    uint8_t *entry = message;
+
+    for (size_t i = 0; i < MIN(I2cQueue::Count(), maxBuses); ++i)
+    {
+        I2cBusStats bus;
+        I2cDeviceStats devices[maxDevices];
+        size_t count = I2cQueue::At(i).GetStats(bus, devices, maxDevices, true);
+
+        LOG_INF("I2C bus %u: %u/%u ms busy, %u rejected, %u bus clears", i, bus.busyUs / 1000, bus.windowMs,
+                bus.rejected, bus.busClears);
+
+        entry[0] = static_cast<uint8_t>(i);
+        entry[1] = static_cast<uint8_t>(bus.speed);
+        sys_put_le32(bus.windowMs, entry + 2);
+        sys_put_le32(bus.busyUs, entry + 6);
+        sys_put_le32(bus.rejected, entry + 10);
+        sys_put_le32(bus.busClears, entry + 14);
+        entry[18] = static_cast<uint8_t>(count);
+        entry += busEntrySize;
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            entry[0] = devices[j].address;
+            sys_put_le32(devices[j].transfers, entry + 1);
+            sys_put_le32(devices[j].busTimeUs, entry + 5);
+            sys_put_le32(devices[j].maxLatencyUs, entry + 9);
+            sys_put_le32(devices[j].deadlineMisses, entry + 13);
+            sys_put_le16(devices[j].recoveries, entry + 17);
+            sys_put_le16(devices[j].failedRecoveries, entry + 19);
+            entry += deviceEntrySize;
+        }
+    }
+
+    SerialTransfer *transfer = CreateTransferFrom(UsbMessageId::I2cStats, message, entry - message, 0);
+
+    return QueueTransfer(transfer, true);
+}
+
+/**
+ * @brief Called by serial controller for every valid packet received from PC. Queues command for execution.
+ * @warning Called from serial controller working thread
+ * 
+ * @param packet received packet
+ * @return true if command is queued, false if it is dropped
+ */
+bool UsbCommHandler::OnPacketReceived(const SerialPacket &packet)
+{
+    UsbCommand command;
+
+    if (packet.length > maxCommandLength)
+    {
+        LOG_WRN("Command is too long: %d", packet.length);
+        return false;
+    }
+
+    command.messageId = packet.messageId;
+    command.length = packet.length;
+    memcpy(command.data, packet.dataPtr, packet.length);
+
+    if (k_msgq_put(&commandQueue, &command, K_NO_WAIT) != 0)
+    {
+        LOG_WRN("Command queue is full. Command 0x%X dropped", packet.messageId);
+        return false;
+    }
+
+    k_work_submit(&commandWork);
+    return true;
+}
+
+/**
+ * @brief Executes commands received from PC.
+ * @warning Executed in system working thread, same as other deferred sensor work
+ * 
+ * @param work worker
+ */
+void UsbCommHandler::CommandWorkHandler(k_work *work)
+{
+    UsbCommHandler *self = CONTAINER_OF(work, UsbCommHandler, commandWork);
+    UsbCommand command;
+
+    while (k_msgq_get(&self->commandQueue, &command, K_NO_WAIT) == 0)
+    {
+        self->ExecuteCommand(command);
+    }
+}
+
+/**
+ * @brief Execute single command received from PC and send response
+ * 
+ * @param command command to execute
+ */
+void UsbCommHandler::ExecuteCommand(const UsbCommand &command)
+{
+    SerialTransfer *transfer = nullptr;
+
+    switch (static_cast<UsbMessageId>(command.messageId))
+    {
+    case UsbMessageId::Command:
+    {
+        // Same layout as BLE control characteristic write: [CommandId, key0, key1, data...]
+        constexpr size_t headerSize = 3;
+
+        if (command.length < headerSize)
+        {
+            LOG_WRN("Command is too short: %d", command.length);
+            return;
+        }
+
+        Bluetooth::CommandKey key;
+        key.key[0] = command.data[1];
+        key.key[1] = command.data[2];
+
+        bool ok = Bluetooth::DispatchControlCommand(static_cast<CommandId>(command.data[0]), key,
+                                                    command.data + headerSize,
+                                                    Bluetooth::BleLength{static_cast<uint16_t>(command.length - headerSize)});
+
+        uint8_t response[] = {command.data[0], command.data[1], command.data[2], static_cast<uint8_t>(ok ? 0 : 1)};
+        transfer = CreateTransferFrom(UsbMessageId::CommandResponse, response, sizeof(response), 0);
+        break;
+    }
+    case UsbMessageId::StatusRequest:
+    {
+        uint8_t response[] = {serial.GetStatus()};
+        transfer = CreateTransferFrom(UsbMessageId::StatusResponse, response, sizeof(response), 0);
+        break;
+    }
+    default:
+        LOG_WRN("Unknown message id 0x%X", command.messageId);
+        return;
+    }
+
+    if (transfer != nullptr)
+    {
+        QueueTransfer(transfer, true);
+    }
 }
 
 /**
@@ -61,62 +432,108 @@ void UsbCommHandler::CommandCompletedCallback(k_work *work)
     self->Release(task);
 }
 
-void UsbCommHandler::SendAccelSamples(const uint8_t *buffer, size_t length){
-    
-    if(serial.IsInitialized()){
-        LOG_INF(".");
-        SerialTransfer *transfer = CreateTransferFrom(SensorId::Mpu6050, buffer, length, 0);
-
-        QueueTransfer(transfer);   
-    } 
+void UsbCommHandler::SendAds131m08Samples(const uint8_t *buffer, size_t length, uint8_t sensor_id){
+    SendData(sensor_id == 0 ? SensorId::Ads131m08_0 : SensorId::Ads131m08_1, buffer, length);
 }
 
-void UsbCommHandler::SendMagnetometerSamples(const uint8_t *buffer, size_t length){
-    
-    if(serial.IsInitialized()){
-        LOG_INF("=");
-        SerialTransfer *transfer = CreateTransferFrom(SensorId::Qmc5883l, buffer, length, 0);
+/**
+ * @brief Check if samples of the sensor pass subscription mask, decimation and rate cap
+ * 
+ * @param stream   stream state of the sensor
+ * @param index    stream index (SensorId value)
+ * @return true if packet should be sent
+ */
+bool UsbCommHandler::AcceptPacket(StreamControl &stream, size_t index)
+{
+    if ((subscriptionMask.load(std::memory_order_relaxed) & (1u << index)) == 0)
+    {
+        return false;
+    }
+
+    if (++stream.decimationCounter < stream.decimation.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    stream.decimationCounter = 0;
 
-        QueueTransfer(transfer);   
-    } 
-}
+    uint16_t minInterval = stream.minIntervalMs.load(std::memory_order_relaxed);
+    uint32_t now = k_uptime_get_32();
 
-void UsbCommHandler::SendMax30102Samples(const uint8_t *buffer, size_t length){
-    
-    if(serial.IsInitialized()){
-        LOG_INF("*");
-        SerialTransfer *transfer = CreateTransferFrom(SensorId::Max30102, buffer, length, 0);
+    if (minInterval != 0 && (now - stream.lastSentMs) < minInterval)
+    {
+        return false;
+    }
+    stream.lastSentMs = now;
 
-        QueueTransfer(transfer);   
-    } 
+    return true;
 }
 
-void UsbCommHandler::SendBme280Samples(const uint8_t *buffer, size_t length){
-    
-    if(serial.IsInitialized()){
-        LOG_INF("/");
-        
-        SerialTransfer *transfer = CreateTransferFrom(SensorId::Bme280, buffer, length, 0);
+/**
+ * @brief Send sensor samples to PC. Uses bulk endpoint when it is enabled and configured by the host,
+ *        serial port otherwise. Packets are filtered by subscription mask, decimation and rate cap.
+ * 
+ * @param sensorId sensor id, used as message id
+ * @param buffer   buffer with message data. Data is copied before return
+ * @param length   data length
+ * @return true if samples were queued
+ */
+bool UsbCommHandler::SendData(SensorId sensorId, const uint8_t *buffer, size_t length)
+{
+    size_t index = static_cast<size_t>(sensorId);
+    if (index >= maxStreams)
+    {
+        return false;
+    }
+
+#if CONFIG_USE_RECORDER
+    // Recording does not depend on host connection and stream subscription
+    recorder.Append(sensorId, buffer, length);
+#endif
 
-        QueueTransfer(transfer);   
-    } 
-}
+    bool useBulk = false;
+#if CONFIG_USE_USB_BULK
+    useBulk = bulk.IsConfigured();
+#endif
 
-void UsbCommHandler::SendAds131m08Samples(const uint8_t *buffer, size_t length, uint8_t sensor_id){
-        
-    SensorId ads131m08_id;
-    
-    if(serial.IsInitialized()){    
-        LOG_INF("-");
-        if(sensor_id == 0){
-            ads131m08_id = SensorId::Ads131m08_0;
-        } else {
-            ads131m08_id = SensorId::Ads131m08_1;
-        }          
-        SerialTransfer *transfer = CreateTransferFrom(ads131m08_id, buffer, length, 0);
-        
-        QueueTransfer(transfer);    
+    // Nothing is counted while host is not listening
+    if (!useBulk && !serial.IsInitialized())
+    {
+        return false;
+    }
+
+    StreamControl &stream = streams[index];
+
+    if (!AcceptPacket(stream, index))
+    {
+        stream.filtered.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool result;
+#if CONFIG_USE_USB_BULK
+    if (useBulk)
+    {
+        result = bulk.Write(static_cast<uint8_t>(sensorId), buffer, length);
+    }
+    else
+#endif
+    {
+        SerialTransfer *transfer = CreateTransferFrom(sensorId, buffer, length, 0);
+
+        // Serial queue is full while host is slow or port is being closed. Release buffers instead of leaking them
+        result = QueueTransfer(transfer, true);
+    }
+
+    if (result)
+    {
+        stream.sent.fetch_add(1, std::memory_order_relaxed);
     }
+    else
+    {
+        stream.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return result;
 }
 
 /**
@@ -129,6 +546,11 @@ void UsbCommHandler::SendAds131m08Samples(const uint8_t *buffer, size_t length,
  */
 bool UsbCommHandler::QueueTransfer(SerialTransfer *transfer, bool autoReleaseOnError)
 {
+    if (transfer == nullptr)
+    {
+        return false;
+    }
+
     bool result = serial.QueueTransfer(transfer);
 
     if (!result && autoReleaseOnError)
@@ -151,6 +573,34 @@ bool UsbCommHandler::QueueTransfer(SerialTransfer *transfer, bool autoReleaseOnE
  * @return SerialTransfer*  constructed transfer, or nullptr if transfer creation was unsuccessful 
  */
 SerialTransfer *UsbCommHandler::CreateTransferFrom(SensorId messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen)
+{
+    return CreateTransferFrom(static_cast<uint8_t>(messageId), req, reqLen, respMaxLen);
+}
+
+/**
+ * @brief Creates and initializes Serial Transfer object for non-sample messages
+ * 
+ * @param messageId         message id
+ * @param req               request buffer 
+ * @param reqLen            request buffer length. Set this field to 0 if request contains no data
+ * @param respMaxLen        maximum reponse buffer length. Set this field to 0 if no responce is expected
+ * @return SerialTransfer*  constructed transfer, or nullptr if transfer creation was unsuccessful 
+ */
+SerialTransfer *UsbCommHandler::CreateTransferFrom(UsbMessageId messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen)
+{
+    return CreateTransferFrom(static_cast<uint8_t>(messageId), req, reqLen, respMaxLen);
+}
+
+/**
+ * @brief Creates and initializes Serial Transfer object with raw message id
+ * 
+ * @param messageId         message id
+ * @param req               request buffer 
+ * @param reqLen            request buffer length. Set this field to 0 if request contains no data
+ * @param respMaxLen        maximum reponse buffer length. Set this field to 0 if no responce is expected
+ * @return SerialTransfer*  constructed transfer, or nullptr if transfer creation was unsuccessful 
+ */
+SerialTransfer *UsbCommHandler::CreateTransferFrom(uint8_t messageId, const uint8_t *req, size_t reqLen, size_t respMaxLen)
 {
     void *request = nullptr;
     uint8_t requestLen = 0;
@@ -195,7 +645,7 @@ SerialTransfer *UsbCommHandler::CreateTransferFrom(SensorId messageId, const uin
 
     transfer->request->dataPtr = static_cast<uint8_t *>(request);
     transfer->request->length = requestLen;
-    transfer->request->messageId = static_cast<uint8_t>(messageId);
+    transfer->request->messageId = messageId;
 
     transfer->response->dataPtr = static_cast<uint8_t *>(response);
     transfer->response->length = responseLen;
@@ -207,39 +657,43 @@ SerialTransfer *UsbCommHandler::CreateTransferFrom(SensorId messageId, const uin
 
 /**
  * @brief Allocates serial transfer to execute command
+ * @note Could be called from any thread, every sensor sends its samples from its own context
  * 
  * @return SerialTransfer* serial transfers buffer.
  */
 SerialTransfer *UsbCommHandler::Allocate()
 {
-    int index = tailIndex.load(std::memory_order_acquire);
-    int nextTail = (index + 1) % capacity;
+    SerialTransfer *retval = nullptr;
+    k_spinlock_key_t key = k_spin_lock(&transfersLock);
 
-    if (tailIndex == headIndex.load(std::memory_order_consume))
+    if (tailIndex != headIndex)
     {
-        return nullptr;
+        retval = transfers[tailIndex];
+        tailIndex = (tailIndex + 1) % capacity;
     }
 
-    SerialTransfer *retval = transfers[index];
-
-    tailIndex.store(nextTail, std::memory_order_release);
+    k_spin_unlock(&transfersLock, key);
     return retval;
 }
 
 /**
  * @brief Release serial transfer after command execution is complete
+ * @note Could be called from any thread
  * 
  * @param transfer transfer to release
  */
 void UsbCommHandler::Release(SerialTransfer *buffer)
 {
-    int currentHead = headIndex.load(std::memory_order_acquire);
-    int nextHead = (currentHead + 1) % capacity;
-    if (nextHead == tailIndex.load(std::memory_order_consume))
+    k_spinlock_key_t key = k_spin_lock(&transfersLock);
+
+    int nextHead = (headIndex + 1) % capacity;
+    if (nextHead == tailIndex)
     {
         LOG_ERR("Unreachable");
     }
 
-    transfers[currentHead] = buffer;
-    headIndex.store(nextHead, std::memory_order_release);
+    transfers[headIndex] = buffer;
+    headIndex = nextHead;
+
+    k_spin_unlock(&transfersLock, key);
 }
@@ -0,0 +1,244 @@
+#include <zephyr/ztest.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+
+#include "band_power.hpp"
+#include "usb_comm_handler.hpp"
+
+#include "band_power_fixture.inc"
+
+/*
+ * Replays ADS131M08 samples generated by scripts/band_power_reference.py, synthetic by default or a recording passed
+ * with -DBAND_POWER_FIXTURE_ARGS, and compares band power records with numpy Welch reference records.
+ */
+
+BUILD_ASSERT(BAND_POWER_FIXTURE_FFT_SIZE == CONFIG_ADS131_BAND_POWER_FFT_SIZE &&
+             BAND_POWER_FIXTURE_WINDOW == CONFIG_ADS131_BAND_POWER_WINDOW &&
+             BAND_POWER_FIXTURE_OVERLAP == CONFIG_ADS131_BAND_POWER_OVERLAP &&
+             BAND_POWER_FIXTURE_RECORD_RATE == CONFIG_ADS131_BAND_POWER_RATE,
+             "Fixture was generated for other estimator settings");
+
+namespace
+{
+    constexpr size_t channels = Ads131Pipeline::Channels;
+    constexpr size_t blockSamples = Ads131Pipeline::SamplesPerPacket;
+    constexpr size_t blockCount = ARRAY_SIZE(bandPowerSamples) / blockSamples;
+    constexpr size_t recordCount = ARRAY_SIZE(bandPowerReference);
+    constexpr size_t recordSize = 4 + channels * BAND_POWER_FIXTURE_BANDS * sizeof(float);
+    constexpr int blockPeriodMs = 1000 * blockSamples / BAND_POWER_FIXTURE_SAMPLE_RATE;
+    constexpr float relativeTolerance = 1e-3f; ///< Error of band power relative to reference
+    constexpr float floorTolerance = 1e-6f;    ///< Error relative to total power of the channel, float FFT noise
+
+    SerialController serial;
+    UsbCommHandler usb(serial);
+    BandPower bandPower(usb);
+
+    Bluetooth::BleControlAction bandPowerCommand; ///< Handler registered by Initialize
+
+    k_spinlock recordLock;
+    uint8_t records[2 * recordCount][recordSize]; ///< Records sent by worker thread
+    size_t received;                              ///< Number of records sent by worker thread
+    K_SEM_DEFINE(recordSem, 0, 2 * recordCount);
+
+    bool Command(BandPowerCommand command, const uint8_t *data, uint8_t length)
+    {
+        Bluetooth::CommandKey key = {};
+        key.key[0] = static_cast<uint8_t>(command);
+
+        return bandPowerCommand(data, key, Bluetooth::BleLength{length}, Bluetooth::BleOffset{0});
+    }
+
+    /**
+     * @brief Feed fixture blocks of device 0 at the pipeline rate, so that the worker thread keeps up like on the
+     *        device
+     */
+    void Run()
+    {
+        q31_t block[channels][blockSamples];
+
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            for (size_t n = 0; n < blockSamples; ++n)
+            {
+                for (size_t ch = 0; ch < channels; ++ch)
+                {
+                    block[ch][n] = bandPowerSamples[i * blockSamples + n][ch] * (1 << Ads131Pipeline::SampleShift);
+                }
+            }
+
+            bandPower.PushBlock(0, block);
+            k_msleep(blockPeriodMs);
+        }
+    }
+
+    float RecordPower(const uint8_t *record, size_t ch, size_t band)
+    {
+        uint32_t bits = sys_get_le32(record + 4 + 4 * (ch * BAND_POWER_FIXTURE_BANDS + band));
+        float value;
+
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void *BandPowerSetup()
+    {
+        bandPower.Initialize(BAND_POWER_FIXTURE_SAMPLE_RATE);
+        return nullptr;
+    }
+
+    void BandPowerBefore(void *)
+    {
+        // Restarts segments of every device
+        const uint8_t rate = CONFIG_ADS131_BAND_POWER_RATE;
+        zassert_true(Command(BandPowerCommand::SetRate, &rate, sizeof(rate)));
+
+        k_spinlock_key_t key = k_spin_lock(&recordLock);
+        received = 0;
+        k_spin_unlock(&recordLock, key);
+        k_sem_reset(&recordSem);
+    }
+
+    void BandPowerAfter(void *)
+    {
+        // Worker thread finishes queued blocks before the next test restarts segments
+        k_msleep(10 * blockPeriodMs);
+    }
+}
+
+/*
+ * Link seams: records are captured here instead of BLE and USB stacks, which the test does not build
+ */
+
+namespace Bluetooth
+{
+    void BandPowerNotify(const uint8_t *data, const uint8_t len)
+    {
+        k_spinlock_key_t key = k_spin_lock(&recordLock);
+
+        if (received < ARRAY_SIZE(records) && len == recordSize)
+        {
+            memcpy(records[received], data, len);
+        }
+        received++;
+
+        k_spin_unlock(&recordLock, key);
+
+        k_sem_give(&recordSem);
+    }
+
+    void GattRegisterControlCallback(CommandId commandId, BleControlAction &&action)
+    {
+        zassert_equal(commandId, CommandId::BandPowerCmd);
+        bandPowerCommand = std::move(action);
+    }
+}
+
+SerialController::SerialController()
+{
+}
+
+uint8_t SerialController::GetStatus()
+{
+    return 0;
+}
+
+UsbCommHandler::UsbCommHandler(SerialController &serial) : serial(serial)
+{
+}
+
+bool UsbCommHandler::SendData(SensorId sensorId, const uint8_t *buffer, size_t length)
+{
+    ARG_UNUSED(sensorId);
+    ARG_UNUSED(buffer);
+    ARG_UNUSED(length);
+    return true;
+}
+
+ZTEST(band_power, test_records_match_numpy_welch)
+{
+    Run();
+
+    for (size_t i = 0; i < recordCount; ++i)
+    {
+        zassert_ok(k_sem_take(&recordSem, K_MSEC(1000)), "record %u was not sent", static_cast<unsigned>(i));
+    }
+    zassert_equal(received, recordCount, "records of %u blocks", static_cast<unsigned>(blockCount));
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < recordCount; ++i)
+    {
+        const uint8_t *record = records[i];
+
+        zassert_equal(record[1], 0, "device");
+        zassert_equal(record[2], BAND_POWER_FIXTURE_BANDS, "band count");
+        zassert_equal(record[3], bandPowerSegments[i], "segments of record %u", static_cast<unsigned>(i));
+        zassert_equal(static_cast<uint8_t>(record[0] - records[0][0]), i, "record counter");
+
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            float total = 0.0f;
+            for (size_t b = 0; b < BAND_POWER_FIXTURE_BANDS; ++b)
+            {
+                total += bandPowerReference[i][ch][b];
+            }
+
+            for (size_t b = 0; b < BAND_POWER_FIXTURE_BANDS; ++b)
+            {
+                float expected = bandPowerReference[i][ch][b];
+                float error = fabsf(RecordPower(record, ch, b) - expected);
+
+                maxError = MAX(maxError, error / MAX(expected, 1.0f));
+                zassert_true(error <= relativeTolerance * expected + floorTolerance * total,
+                             "record %u channel %u band %u: %f, numpy %f", static_cast<unsigned>(i),
+                             static_cast<unsigned>(ch), static_cast<unsigned>(b),
+                             static_cast<double>(RecordPower(record, ch, b)), static_cast<double>(expected));
+            }
+        }
+    }
+
+    TC_PRINT("%u records, max relative error %.2e\n", static_cast<unsigned>(recordCount),
+             static_cast<double>(maxError));
+}
+
+ZTEST(band_power, test_zero_rate_stops_records)
+{
+    const uint8_t off = 0;
+    zassert_true(Command(BandPowerCommand::SetRate, &off, sizeof(off)));
+
+    Run();
+
+    zassert_equal(k_sem_take(&recordSem, K_MSEC(100)), -EAGAIN, "record sent while stopped");
+}
+
+ZTEST(band_power, test_invalid_commands_are_rejected)
+{
+    const uint8_t rate = BandPower::MaxRate + 1;
+    const uint8_t window = static_cast<uint8_t>(BandPowerWindow::Blackman) + 1;
+    const uint8_t overlap = BandPower::MaxOverlap + 1;
+
+    zassert_false(Command(BandPowerCommand::SetRate, &rate, sizeof(rate)));
+    zassert_false(Command(BandPowerCommand::SetWindow, &window, sizeof(window)));
+    zassert_false(Command(BandPowerCommand::SetOverlap, &overlap, sizeof(overlap)));
+
+    // Count, low and high edges in 0.1 Hz
+    const uint8_t empty[] = {0};
+    const uint8_t reversed[] = {1, 0x64, 0x00, 0x0A, 0x00};
+    const uint8_t aboveNyquist[] = {1, 0x0A, 0x00, 0xE3, 0x04};
+    const uint8_t truncated[] = {2, 0x0A, 0x00, 0x28, 0x00};
+    const uint8_t valid[] = {1, 0x50, 0x00, 0x82, 0x00};
+
+    zassert_false(Command(BandPowerCommand::SetBands, empty, sizeof(empty)));
+    zassert_false(Command(BandPowerCommand::SetBands, reversed, sizeof(reversed)));
+    zassert_false(Command(BandPowerCommand::SetBands, aboveNyquist, sizeof(aboveNyquist)));
+    zassert_false(Command(BandPowerCommand::SetBands, truncated, sizeof(truncated)));
+    zassert_true(Command(BandPowerCommand::SetBands, valid, sizeof(valid)));
+
+    // Default bands back for the other tests
+    const uint8_t defaults[] = {5, 10, 0, 40, 0, 40, 0, 80, 0, 80, 0, 130, 0, 130, 0, 0x2C, 0x01, 0x2C, 0x01, 0xC2, 0x01};
+    zassert_true(Command(BandPowerCommand::SetBands, defaults, sizeof(defaults)));
+}
+
+ZTEST_SUITE(band_power, nullptr, BandPowerSetup, BandPowerBefore, BandPowerAfter, nullptr);
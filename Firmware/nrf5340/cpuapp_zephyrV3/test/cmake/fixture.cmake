@@ -0,0 +1,39 @@
+# Fixtures of the replay tests: C include files generated by the scripts in ../../scripts at build time
+
+set(FIXTURE_SCRIPT_DIR ${CMAKE_CURRENT_LIST_DIR}/../../scripts)
+
+# Generate fixture/<name>.inc in the build directory with a fixture script before app is compiled.
+# The script runs in the test source directory and gets -o <file> after ARGS.
+#
+# add_fixture(<name> <script> [ARGS <arg>...] [DEPENDS <file>...])
+function(add_fixture name script)
+  cmake_parse_arguments(FIXTURE "" "" "ARGS;DEPENDS" ${ARGN})
+  set(script ${FIXTURE_SCRIPT_DIR}/${script})
+  set(output ${CMAKE_CURRENT_BINARY_DIR}/fixture/${name}.inc)
+  file(MAKE_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/fixture)
+
+  add_custom_command(OUTPUT ${output}
+                     COMMAND ${PYTHON_EXECUTABLE} ${script} ${FIXTURE_ARGS} -o ${output}
+                     DEPENDS ${script} ${FIXTURE_DEPENDS}
+                     WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR})
+  add_custom_target(${name} DEPENDS ${output})
+  add_dependencies(app ${name})
+  target_include_directories(app PRIVATE ${CMAKE_CURRENT_BINARY_DIR}/fixture)
+endfunction()
+
+# Generate fixture/<name>.inc from a committed recording when the file exists, with symbols prefixed by
+# "recording", and define the upper case name, e.g. PPG_RECORDING=1. Without a recording the test skips the
+# cases that need one.
+#
+# add_recording_fixture(<name> <script> <recording> [ARGS <arg>...])
+function(add_recording_fixture name script recording)
+  cmake_parse_arguments(RECORDING "" "" "ARGS" ${ARGN})
+  string(TOUPPER ${name} define)
+
+  if(EXISTS ${recording})
+    add_fixture(${name} ${script} ARGS ${recording} --name recording ${RECORDING_ARGS} DEPENDS ${recording})
+    target_compile_definitions(app PRIVATE ${define}=1)
+  else()
+    message(STATUS "No recording at ${recording}, test cases with ${define} are skipped")
+  endif()
+endfunction()
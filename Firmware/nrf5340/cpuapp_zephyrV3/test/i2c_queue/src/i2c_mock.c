@@ -0,0 +1,304 @@
+#include "i2c_mock.h"
+
+#include <string.h>
+
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/pm/device.h>
+
+#define I2C_MOCK_LOG_SIZE 64
+
+static struct
+{
+    struct k_spinlock lock;
+    uint8_t registers[256];
+    uint8_t fifoCounter;
+    struct i2c_mock_transfer log[I2C_MOCK_LOG_SIZE];
+    size_t logCount;
+    bool hold;
+    int failCount;
+    bool stall;
+    bool hang;
+    i2c_callback_t stalledCallback;
+    void *stalledData;
+    struct i2c_msg *stalledMsgs;
+    bool stalledHung;
+    uint32_t recoveries;
+    uint32_t controllerResets;
+    uint32_t speed;
+} mock;
+
+K_SEM_DEFINE(mockHeld, 0, 1);
+K_SEM_DEFINE(mockRelease, 0, 1);
+
+static int i2c_mock_configure(const struct device *dev, uint32_t config)
+{
+    ARG_UNUSED(dev);
+
+    mock.speed = I2C_SPEED_GET(config);
+    return 0;
+}
+
+/**
+ * @brief Log transfer and take injected fault. Register transfers are [register write][data read or write]
+ *
+ * @return -EIO for injected fault, -EINVAL for unexpected messages, 0 otherwise
+ */
+static int i2c_mock_begin(struct i2c_msg *msgs, uint8_t num_msgs, uint16_t addr)
+{
+    if (num_msgs != 2 || msgs[0].len != 1 || (msgs[0].flags & I2C_MSG_READ) != 0)
+    {
+        return -EINVAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&mock.lock);
+
+    if (mock.logCount < I2C_MOCK_LOG_SIZE)
+    {
+        struct i2c_mock_transfer *entry = &mock.log[mock.logCount++];
+        entry->address = addr;
+        entry->reg = msgs[0].buf[0];
+        entry->length = msgs[1].len;
+        entry->write = (msgs[1].flags & I2C_MSG_READ) == 0;
+    }
+
+    int ret = 0;
+    if (mock.failCount > 0)
+    {
+        mock.failCount--;
+        ret = -EIO;
+    }
+
+    k_spin_unlock(&mock.lock, key);
+
+    return ret;
+}
+
+static int i2c_mock_transfer(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs, uint16_t addr)
+{
+    ARG_UNUSED(dev);
+
+    if (mock.hold)
+    {
+        k_sem_give(&mockHeld);
+        k_sem_take(&mockRelease, K_FOREVER);
+    }
+
+    int ret = i2c_mock_begin(msgs, num_msgs, addr);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    uint8_t reg = msgs[0].buf[0];
+    bool read = (msgs[1].flags & I2C_MSG_READ) != 0;
+
+    for (uint32_t i = 0; i < msgs[1].len; ++i)
+    {
+        if (reg == I2C_MOCK_FIFO_REGISTER)
+        {
+            if (read)
+            {
+                msgs[1].buf[i] = mock.fifoCounter++;
+            }
+        }
+        else if (read)
+        {
+            msgs[1].buf[i] = mock.registers[(reg + i) & 0xFF];
+        }
+        else
+        {
+            mock.registers[(reg + i) & 0xFF] = msgs[1].buf[i];
+        }
+    }
+
+    return 0;
+}
+
+static int i2c_mock_transfer_cb(const struct device *dev, struct i2c_msg *msgs, uint8_t num_msgs, uint16_t addr,
+                                i2c_callback_t cb, void *userdata)
+{
+    if (mock.stall || mock.hang)
+    {
+        int ret = i2c_mock_begin(msgs, num_msgs, addr);
+        if (ret != 0)
+        {
+            return ret;
+        }
+
+        mock.stalledHung = mock.hang;
+        mock.stall = false;
+        mock.hang = false;
+        mock.stalledCallback = cb;
+        mock.stalledData = userdata;
+        mock.stalledMsgs = msgs;
+        return 0;
+    }
+
+    cb(dev, i2c_mock_transfer(dev, msgs, num_msgs, addr), userdata);
+    return 0;
+}
+
+static int i2c_mock_recover_bus(const struct device *dev)
+{
+    mock.recoveries++;
+
+    // Bus clear releases a stalled transfer, the driver reports it as failed
+    i2c_callback_t callback = mock.stalledCallback;
+    if (callback != NULL && !mock.stalledHung)
+    {
+        mock.stalledCallback = NULL;
+        callback(dev, -EIO, mock.stalledData);
+    }
+
+    return 0;
+}
+
+#if CONFIG_PM_DEVICE
+static int i2c_mock_pm_action(const struct device *dev, enum pm_device_action action)
+{
+    ARG_UNUSED(dev);
+
+    // Disabled controller never completes the transfer in progress
+    if (action == PM_DEVICE_ACTION_SUSPEND)
+    {
+        mock.controllerResets++;
+        mock.stalledCallback = NULL;
+    }
+
+    return 0;
+}
+
+PM_DEVICE_DEFINE(i2c_mock, i2c_mock_pm_action);
+#endif
+
+static const struct i2c_driver_api i2c_mock_api = {
+    .configure = i2c_mock_configure,
+    .transfer = i2c_mock_transfer,
+    .transfer_cb = i2c_mock_transfer_cb,
+    .recover_bus = i2c_mock_recover_bus,
+};
+
+static int i2c_mock_init(const struct device *dev)
+{
+    ARG_UNUSED(dev);
+
+    return 0;
+}
+
+DEVICE_DEFINE(i2c_mock, "i2c_mock", i2c_mock_init, PM_DEVICE_GET(i2c_mock), NULL, NULL, POST_KERNEL,
+              CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &i2c_mock_api);
+
+const struct device *i2c_mock_device(void)
+{
+    return DEVICE_GET(i2c_mock);
+}
+
+void i2c_mock_reset(void)
+{
+    i2c_mock_release();
+
+    k_spinlock_key_t key = k_spin_lock(&mock.lock);
+
+    memset(mock.registers, 0, sizeof(mock.registers));
+    mock.fifoCounter = 0;
+    mock.logCount = 0;
+    mock.failCount = 0;
+    mock.stall = false;
+    mock.hang = false;
+    mock.stalledCallback = NULL;
+    mock.recoveries = 0;
+    mock.controllerResets = 0;
+
+    k_spin_unlock(&mock.lock, key);
+
+    k_sem_reset(&mockHeld);
+}
+
+uint8_t *i2c_mock_registers(void)
+{
+    return mock.registers;
+}
+
+void i2c_mock_hold(void)
+{
+    k_sem_reset(&mockRelease);
+    mock.hold = true;
+}
+
+int i2c_mock_wait_held(k_timeout_t timeout)
+{
+    return k_sem_take(&mockHeld, timeout);
+}
+
+void i2c_mock_step(void)
+{
+    k_sem_give(&mockRelease);
+}
+
+void i2c_mock_release(void)
+{
+    mock.hold = false;
+    k_sem_give(&mockRelease);
+}
+
+void i2c_mock_fail(int count)
+{
+    mock.failCount = count;
+}
+
+void i2c_mock_stall(void)
+{
+    mock.stall = true;
+}
+
+void i2c_mock_hang(void)
+{
+    mock.hang = true;
+}
+
+bool i2c_mock_complete_stalled(uint8_t value)
+{
+    i2c_callback_t callback = mock.stalledCallback;
+    if (callback == NULL)
+    {
+        return false;
+    }
+
+    // Late DMA write into the buffer of the read
+    struct i2c_msg *data = &mock.stalledMsgs[1];
+    if ((data->flags & I2C_MSG_READ) != 0)
+    {
+        memset(data->buf, value, data->len);
+    }
+
+    mock.stalledCallback = NULL;
+    callback(i2c_mock_device(), 0, mock.stalledData);
+    return true;
+}
+
+size_t i2c_mock_log(struct i2c_mock_transfer *log, size_t max)
+{
+    k_spinlock_key_t key = k_spin_lock(&mock.lock);
+
+    size_t count = MIN(max, mock.logCount);
+    memcpy(log, mock.log, count * sizeof(*log));
+
+    k_spin_unlock(&mock.lock, key);
+
+    return count;
+}
+
+uint32_t i2c_mock_recoveries(void)
+{
+    return mock.recoveries;
+}
+
+uint32_t i2c_mock_controller_resets(void)
+{
+    return mock.controllerResets;
+}
+
+uint32_t i2c_mock_speed(void)
+{
+    return mock.speed;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Register of the mock which behaves like a sensor FIFO: every read byte is the next value of a counter and
+ *        the register address is not advanced
+ */
+#define I2C_MOCK_FIFO_REGISTER 0x7F
+
+/**
+ * @brief Bus transfer seen by the mock
+ */
+struct i2c_mock_transfer
+{
+    uint16_t address; ///< Device address
+    uint8_t reg;      ///< Register address
+    uint16_t length;  ///< Data length
+    bool write;       ///< true for register write
+};
+
+/**
+ * @brief Get mock I2C controller device
+ */
+const struct device *i2c_mock_device(void);
+
+/**
+ * @brief Clear registers, transfer log, injected faults and counters. Releases held transfers
+ */
+void i2c_mock_reset(void);
+
+/**
+ * @brief Get register map shared by all device addresses, 256 bytes
+ */
+uint8_t *i2c_mock_registers(void);
+
+/**
+ * @brief Block every following transfer until it is released with i2c_mock_step or i2c_mock_release
+ */
+void i2c_mock_hold(void);
+
+/**
+ * @brief Wait until a transfer is blocked by i2c_mock_hold
+ *
+ * @param timeout maximum wait
+ * @return 0 if a transfer is blocked, -EAGAIN on timeout
+ */
+int i2c_mock_wait_held(k_timeout_t timeout);
+
+/**
+ * @brief Let one held transfer complete, the following ones are still held
+ */
+void i2c_mock_step(void);
+
+/**
+ * @brief Stop holding transfers and let the blocked one complete
+ */
+void i2c_mock_release(void);
+
+/**
+ * @brief Fail the next transfers with -EIO
+ *
+ * @param count number of transfers to fail
+ */
+void i2c_mock_fail(int count);
+
+/**
+ * @brief Never complete the next callback transfer, like a slave holding SDA low. It completes with -EIO when the
+ *        bus is recovered
+ */
+void i2c_mock_stall(void);
+
+/**
+ * @brief Never complete the next callback transfer, not even after bus recovery, like a controller stuck in DMA. It
+ *        is dropped when the controller is suspended
+ */
+void i2c_mock_hang(void);
+
+/**
+ * @brief Complete stalled or hung transfer late: fill read buffer with value and call the completion callback
+ *
+ * @param value byte written to every byte of the read buffer
+ * @return true if there was a transfer to complete
+ */
+bool i2c_mock_complete_stalled(uint8_t value);
+
+/**
+ * @brief Copy transfer log since the last reset
+ *
+ * @param log output array
+ * @param max size of log array
+ * @return number of logged transfers
+ */
+size_t i2c_mock_log(struct i2c_mock_transfer *log, size_t max);
+
+/**
+ * @brief Get number of bus recoveries since the last reset
+ */
+uint32_t i2c_mock_recoveries(void);
+
+/**
+ * @brief Get number of controller suspends by device power management since the last reset
+ */
+uint32_t i2c_mock_controller_resets(void);
+
+/**
+ * @brief Get bus speed set by the last configure call, I2C_SPEED_*
+ */
+uint32_t i2c_mock_speed(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,349 @@
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#include "device_string.hpp"
+#include "i2c_mock.h"
+#include "i2c_transport.hpp"
+
+namespace
+{
+    using MockBusName = DeviceString<'i', '2', 'c', '_', 'm', 'o', 'c', 'k'>;
+
+    constexpr uint8_t sensorAddress = 0x57;
+    constexpr uint8_t imuAddress = 0x68;
+    constexpr int callbackTimeoutMs = 1000;
+
+    I2CTransport<MockBusName, sensorAddress> sensor;
+    I2CTransport<MockBusName, imuAddress, I2C_SPEED_FAST_PLUS> imu;
+    std::atomic<uint32_t> failures;
+
+    /**
+     * @brief Transaction with completion signal
+     */
+    struct TestTransaction
+    {
+        I2cTransaction transaction;
+        k_sem done;
+        int status;
+        uint8_t data[96];
+
+        void Setup(I2cPriority priority, uint32_t deadlineUs = 0)
+        {
+            k_sem_init(&done, 0, 1);
+            status = 1;
+            sensor.SetupTransaction(transaction, [this](int result)
+                                    {
+                                        status = result;
+                                        k_sem_give(&done);
+                                    },
+                                    priority, deadlineUs);
+        }
+
+        bool Read(uint8_t registerId, uint16_t length)
+        {
+            return sensor.ReadRegistersAsync(transaction, registerId, data, length);
+        }
+
+        int Wait()
+        {
+            zassert_ok(k_sem_take(&done, K_MSEC(callbackTimeoutMs)), "transaction was not completed");
+            return status;
+        }
+    };
+
+    I2cQueue &Queue()
+    {
+        return I2cQueue::ForBus(i2c_mock_device());
+    }
+
+    I2cBusStats BusStats(I2cDeviceStats *deviceStats = nullptr)
+    {
+        I2cBusStats busStats;
+        I2cDeviceStats devices[2];
+
+        Queue().GetStats(busStats, deviceStats != nullptr ? deviceStats : devices, 2, false);
+        return busStats;
+    }
+
+    void *QueueSetup()
+    {
+        sensor.Initialize(i2c_mock_device());
+        imu.Initialize(i2c_mock_device());
+        sensor.SetFailureHandler([]()
+                                 { failures.fetch_add(1); });
+        return nullptr;
+    }
+
+    void QueueBefore(void *)
+    {
+        i2c_mock_reset();
+
+        // Successful transfer ends error streaks left by the previous test
+        sensor.ReadRegister(0);
+        i2c_mock_reset();
+        failures.store(0);
+
+        I2cBusStats busStats;
+        I2cDeviceStats devices[2];
+        Queue().GetStats(busStats, devices, 2, true);
+    }
+
+    void QueueAfter(void *)
+    {
+        i2c_mock_release();
+    }
+}
+
+ZTEST(i2c_queue, test_bus_runs_at_slowest_device_speed)
+{
+    zassert_equal(BusStats().speed, I2C_SPEED_FAST);
+    zassert_equal(BusStats().devices, 2);
+    zassert_equal(i2c_mock_speed(), I2C_SPEED_FAST);
+}
+
+ZTEST(i2c_queue, test_async_read)
+{
+    TestTransaction read;
+    read.Setup(I2cPriority::High);
+
+    const uint8_t expected[] = {0x11, 0x22, 0x33, 0x44};
+    memcpy(i2c_mock_registers() + 0x10, expected, sizeof(expected));
+
+    zassert_true(read.Read(0x10, sizeof(expected)));
+    zassert_ok(read.Wait());
+    zassert_mem_equal(read.data, expected, sizeof(expected));
+    zassert_false(read.transaction.pending.load());
+}
+
+ZTEST(i2c_queue, test_blocking_access_goes_through_queue)
+{
+    sensor.WriteRegister(0x20, 0x5A);
+    zassert_equal(i2c_mock_registers()[0x20], 0x5A);
+    zassert_equal(sensor.ReadRegister(0x20), 0x5A);
+
+    sensor.UpdateRegister(0x20, 0x0F, 0x03);
+    zassert_equal(i2c_mock_registers()[0x20], 0x53);
+
+    // Unchanged value is not written again
+    sensor.UpdateRegister(0x20, 0x0F, 0x03);
+
+    I2cDeviceStats devices[2];
+    BusStats(devices);
+    zassert_equal(devices[0].address, sensorAddress);
+    zassert_equal(devices[0].transfers, 5, "write, read, read and write, read");
+    zassert_equal(sensor.GetStatus(), 0);
+}
+
+ZTEST(i2c_queue, test_priority_and_deadline_order)
+{
+    TestTransaction blocker, low, normal, late, early;
+    blocker.Setup(I2cPriority::Low);
+    low.Setup(I2cPriority::Low);
+    normal.Setup(I2cPriority::Normal);
+    late.Setup(I2cPriority::High, 1000);
+    early.Setup(I2cPriority::High, 500);
+
+    i2c_mock_hold();
+    zassert_true(blocker.Read(0x01, 1));
+    zassert_ok(i2c_mock_wait_held(K_MSEC(callbackTimeoutMs)));
+
+    // Queued while the bus is busy, in reverse order of urgency
+    zassert_true(low.Read(0x02, 1));
+    zassert_true(normal.Read(0x03, 1));
+    zassert_true(late.Read(0x04, 1));
+    zassert_true(early.Read(0x05, 1));
+    i2c_mock_release();
+
+    for (TestTransaction *transaction : {&blocker, &low, &normal, &late, &early})
+    {
+        zassert_ok(transaction->Wait());
+    }
+
+    i2c_mock_transfer log[8];
+    zassert_equal(i2c_mock_log(log, ARRAY_SIZE(log)), 5);
+
+    const uint8_t expected[] = {0x01, 0x05, 0x04, 0x03, 0x02};
+    for (size_t i = 0; i < ARRAY_SIZE(expected); ++i)
+    {
+        zassert_equal(log[i].reg, expected[i], "transfer %u", static_cast<unsigned>(i));
+    }
+}
+
+ZTEST(i2c_queue, test_chunked_read_yields_between_chunks)
+{
+    TestTransaction fifo, sample;
+    fifo.Setup(I2cPriority::Normal);
+    fifo.transaction.chunkSize = 32;
+    sample.Setup(I2cPriority::High);
+
+    i2c_mock_hold();
+    zassert_true(fifo.Read(I2C_MOCK_FIFO_REGISTER, 96));
+    zassert_ok(i2c_mock_wait_held(K_MSEC(callbackTimeoutMs)));
+
+    // Sample read becomes due while the first chunk is on the bus
+    zassert_true(sample.Read(0x3B, 6));
+    i2c_mock_step();
+    zassert_ok(i2c_mock_wait_held(K_MSEC(callbackTimeoutMs)));
+    i2c_mock_release();
+
+    zassert_ok(sample.Wait());
+    zassert_ok(fifo.Wait());
+
+    i2c_mock_transfer log[8];
+    zassert_equal(i2c_mock_log(log, ARRAY_SIZE(log)), 4);
+    zassert_equal(log[0].reg, I2C_MOCK_FIFO_REGISTER);
+    zassert_equal(log[0].length, 32);
+    zassert_equal(log[1].reg, 0x3B);
+    zassert_equal(log[2].reg, I2C_MOCK_FIFO_REGISTER);
+    zassert_equal(log[3].reg, I2C_MOCK_FIFO_REGISTER);
+
+    for (size_t i = 0; i < 96; ++i)
+    {
+        zassert_equal(fifo.data[i], i, "FIFO byte %u", static_cast<unsigned>(i));
+    }
+}
+
+ZTEST(i2c_queue, test_pending_transaction_is_rejected)
+{
+    TestTransaction read;
+    read.Setup(I2cPriority::Normal);
+
+    i2c_mock_hold();
+    zassert_true(read.Read(0x01, 1));
+    zassert_ok(i2c_mock_wait_held(K_MSEC(callbackTimeoutMs)));
+
+    uint32_t rejected = Queue().GetRejected();
+    zassert_false(read.Read(0x02, 1), "transport must not change pending transaction");
+    zassert_false(Queue().Submit(read.transaction));
+    zassert_equal(Queue().GetRejected(), rejected + 1);
+    zassert_equal(read.transaction.registerId, 0x01);
+
+    i2c_mock_release();
+    zassert_ok(read.Wait());
+    zassert_equal(k_sem_count_get(&read.done), 0, "callback called twice");
+}
+
+ZTEST(i2c_queue, test_failures_clear_bus_and_call_failure_handler)
+{
+    uint32_t busClears = BusStats().busClears;
+
+    i2c_mock_fail(CONFIG_SENSOR_RECOVERY_ERRORS);
+    for (int i = 0; i < CONFIG_SENSOR_RECOVERY_ERRORS; ++i)
+    {
+        zassert_equal(failures.load(), 0);
+        sensor.ReadRegister(0x01);
+        zassert_equal(sensor.GetStatus(), EIO);
+    }
+
+    zassert_equal(failures.load(), 1);
+    zassert_equal(BusStats().busClears - busClears, CONFIG_SENSOR_RECOVERY_ERRORS / CONFIG_I2C_QUEUE_RECOVERY_ERRORS);
+    zassert_equal(i2c_mock_recoveries(), CONFIG_SENSOR_RECOVERY_ERRORS / CONFIG_I2C_QUEUE_RECOVERY_ERRORS);
+
+    sensor.ReadRegister(0x01);
+    zassert_equal(sensor.GetStatus(), 0);
+}
+
+ZTEST(i2c_queue, test_stalled_transfer_is_aborted)
+{
+    uint32_t busClears = BusStats().busClears;
+
+    i2c_mock_stall();
+    int64_t start = k_uptime_get();
+    sensor.ReadRegister(0x01);
+
+    zassert_true(k_uptime_get() - start >= 100, "transfer timeout too short");
+    zassert_equal(sensor.GetStatus(), ETIMEDOUT);
+    zassert_equal(BusStats().busClears - busClears, 1);
+    zassert_equal(i2c_mock_recoveries(), 1);
+
+    // Bus is usable again
+    i2c_mock_registers()[0x01] = 0xA5;
+    zassert_equal(sensor.ReadRegister(0x01), 0xA5);
+}
+
+ZTEST(i2c_queue, test_blocking_transfer_times_out)
+{
+    uint8_t data[4];
+    memset(data, 0xA5, sizeof(data));
+    i2c_mock_registers()[0x30] = 0x11;
+
+    // Queue thread is stuck in the driver
+    i2c_mock_hold();
+    int64_t start = k_uptime_get();
+    sensor.ReadRegisters(0x30, data, sizeof(data));
+    zassert_true(k_uptime_get() - start >= 5 * I2cQueue::TransferTimeoutMs, "blocking transfer timeout too short");
+    zassert_equal(sensor.GetStatus(), ETIMEDOUT);
+
+    // Abandoned transaction still belongs to the queue
+    start = k_uptime_get();
+    sensor.ReadRegister(0x30);
+    zassert_equal(sensor.GetStatus(), EBUSY);
+    zassert_true(k_uptime_get() - start < I2cQueue::TransferTimeoutMs, "abandoned transfer was waited for again");
+
+    // Late completion lands in the buffer of the transport
+    i2c_mock_release();
+    k_msleep(10);
+    zassert_equal(data[0], 0xA5, "late completion wrote into the caller's buffer");
+    zassert_equal(sensor.ReadRegister(0x30), 0x11);
+    zassert_equal(sensor.GetStatus(), 0);
+}
+
+ZTEST(i2c_queue, test_hung_transfer_is_quarantined)
+{
+    TestTransaction read;
+    read.Setup(I2cPriority::High);
+
+    i2c_mock_hang();
+    zassert_true(read.Read(0x10, 4));
+    zassert_equal(read.Wait(), -ETIMEDOUT);
+    zassert_true(Queue().IsFailed());
+    zassert_true(read.transaction.pending.load(), "buffer reused while the driver owns it");
+    zassert_false(read.Read(0x10, 4));
+
+    // Failed bus fails fast without the driver and asks for recovery right away
+    zassert_equal(failures.load(), 1);
+    sensor.ReadRegister(0x01);
+    zassert_equal(sensor.GetStatus(), EIO);
+    zassert_equal(failures.load(), 2);
+
+    i2c_mock_transfer log[4];
+    zassert_equal(i2c_mock_log(log, ARRAY_SIZE(log)), 1);
+
+    // Late completion lands in the quarantined buffer and releases it, the bus stays failed until it is reset
+    zassert_true(i2c_mock_complete_stalled(0xEE));
+    zassert_false(read.transaction.pending.load());
+    zassert_equal(read.data[3], 0xEE);
+    zassert_equal(k_sem_count_get(&read.done), 0, "callback called twice");
+    zassert_true(Queue().IsFailed());
+
+    zassert_ok(sensor.ResetBus());
+    zassert_false(Queue().IsFailed());
+
+    i2c_mock_registers()[0x01] = 0xA5;
+    zassert_equal(sensor.ReadRegister(0x01), 0xA5);
+}
+
+ZTEST(i2c_queue, test_controller_reset_releases_hung_transfer)
+{
+    TestTransaction read;
+    read.Setup(I2cPriority::High);
+
+    zassert_ok(sensor.ResetBus(), "reset of a working bus does nothing");
+    zassert_equal(i2c_mock_controller_resets(), 0);
+
+    i2c_mock_hang();
+    zassert_true(read.Read(0x10, 4));
+    zassert_equal(read.Wait(), -ETIMEDOUT);
+    zassert_true(read.transaction.pending.load());
+
+    zassert_ok(sensor.ResetBus());
+    zassert_equal(i2c_mock_controller_resets(), 1);
+    zassert_false(read.transaction.pending.load());
+    zassert_false(i2c_mock_complete_stalled(0xEE), "suspended controller completed the transfer");
+
+    zassert_true(read.Read(0x10, 4));
+    zassert_ok(read.Wait());
+}
+
+ZTEST_SUITE(i2c_queue, nullptr, QueueSetup, QueueBefore, QueueAfter, nullptr);
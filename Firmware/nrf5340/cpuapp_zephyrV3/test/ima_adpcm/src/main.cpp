@@ -0,0 +1,224 @@
+#include <zephyr/ztest.h>
+
+#include <math.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/timing/timing.h>
+
+#include "dmic_adpcm.hpp"
+#include "usb_comm_handler.hpp"
+
+#include "pcm_fixture.inc"
+
+/*
+ * Encodes PCM samples generated by scripts/pcm_fixture.py, synthetic by default or a WAV recording passed with
+ * -DPCM_FIXTURE_ARGS, and compares packets with reference IMA ADPCM blocks and decoded samples with the input.
+ */
+
+namespace
+{
+    constexpr size_t sampleCount = ARRAY_SIZE(pcmFixture);
+    constexpr size_t packetCount = ARRAY_SIZE(adpcmReference);
+    constexpr size_t blockSamples = CONFIG_DMIC_BLOCK_MS * PCM_FIXTURE_SAMPLE_RATE / 1000; ///< DMIC block
+    constexpr float minSnr = 20.0f;          ///< Decoded signal to quantization noise, dB
+    constexpr uint32_t timeBudgetNs = 1250;  ///< Encoder time per sample on Cortex-M, 2 % of the sample period
+
+    BUILD_ASSERT(sizeof(adpcmReference[0]) == DmicAdpcm::BlockAlign, "Fixture was generated for other block size");
+
+    SerialController serial;
+    UsbCommHandler usb(serial);
+    DmicAdpcm adpcm(usb);
+
+    uint8_t packets[packetCount + 1][DmicAdpcm::PacketSize]; ///< Packets sent by the encoder
+    size_t received;                                         ///< Number of packets sent by the encoder
+
+    /**
+     * @brief Encode samples in DMIC blocks
+     *
+     * @return time spent in encoder, ns
+     */
+    uint64_t Encode(const int16_t *samples, size_t count)
+    {
+        uint64_t ns = 0;
+
+        timing_start();
+
+        for (size_t i = 0; i < count; i += blockSamples)
+        {
+            timing_t start = timing_counter_get();
+            adpcm.Process(samples + i, MIN(blockSamples, count - i));
+            timing_t end = timing_counter_get();
+
+            ns += timing_cycles_to_ns(timing_cycles_get(&start, &end));
+        }
+
+        timing_stop();
+
+        return ns;
+    }
+
+    /**
+     * @brief Decode WAV IMA ADPCM block of packet
+     *
+     * @param packet packet sent by the encoder
+     * @param samples output, DmicAdpcm::SamplesPerPacket samples
+     */
+    void Decode(const uint8_t *packet, int16_t *samples)
+    {
+        const uint8_t *block = packet + DmicAdpcm::HeaderSize;
+        ImaAdpcm::State state;
+
+        state.predictor = static_cast<int16_t>(sys_get_le16(block));
+        state.index = block[2];
+        samples[0] = static_cast<int16_t>(state.predictor);
+
+        for (size_t i = 1; i < DmicAdpcm::SamplesPerPacket; ++i)
+        {
+            uint8_t byte = block[ImaAdpcm::BlockHeaderSize + (i - 1) / 2];
+            samples[i] = ImaAdpcm::Decode(state, (i & 1) ? byte & 0x0F : byte >> 4);
+        }
+    }
+
+    void AdpcmBefore(void *)
+    {
+        adpcm.Initialize();
+        received = 0;
+    }
+}
+
+/*
+ * Link seams: packets are captured here instead of BLE and USB stacks, which the test does not build
+ */
+
+namespace Bluetooth
+{
+    void DmicAudioNotify(const uint8_t *data, const uint8_t len)
+    {
+        zassert_equal(len, DmicAdpcm::PacketSize);
+        if (received < ARRAY_SIZE(packets))
+        {
+            memcpy(packets[received], data, len);
+        }
+        received++;
+    }
+}
+
+SerialController::SerialController()
+{
+}
+
+uint8_t SerialController::GetStatus()
+{
+    return 0;
+}
+
+UsbCommHandler::UsbCommHandler(SerialController &serial) : serial(serial)
+{
+}
+
+bool UsbCommHandler::SendData(SensorId sensorId, const uint8_t *buffer, size_t length)
+{
+    zassert_equal(sensorId, SensorId::DmicAudio);
+    ARG_UNUSED(buffer);
+    ARG_UNUSED(length);
+    return true;
+}
+
+ZTEST(ima_adpcm, test_packets_match_reference)
+{
+    Encode(pcmFixture, sampleCount);
+
+    zassert_equal(received, packetCount, "packets of %u samples", static_cast<unsigned>(sampleCount));
+
+    for (size_t i = 0; i < packetCount; ++i)
+    {
+        zassert_equal(sys_get_le16(packets[i]), i, "sequence");
+        zassert_equal(sys_get_le32(packets[i] + 2), i * DmicAdpcm::SamplesPerPacket, "first sample index");
+        zassert_mem_equal(packets[i] + DmicAdpcm::HeaderSize, adpcmReference[i], DmicAdpcm::BlockAlign,
+                          "block %u differs from reference encoder", static_cast<unsigned>(i));
+    }
+}
+
+ZTEST(ima_adpcm, test_decoded_snr)
+{
+    Encode(pcmFixture, sampleCount);
+    zassert_true(received > 0, "fixture shorter than one packet");
+
+    int16_t decoded[DmicAdpcm::SamplesPerPacket];
+    double signal = 0.0;
+    double noise = 0.0;
+
+    for (size_t i = 0; i < MIN(received, packetCount); ++i)
+    {
+        const int16_t *input = pcmFixture + sys_get_le32(packets[i] + 2);
+
+        Decode(packets[i], decoded);
+        for (size_t n = 0; n < DmicAdpcm::SamplesPerPacket; ++n)
+        {
+            double error = decoded[n] - input[n];
+            signal += static_cast<double>(input[n]) * input[n];
+            noise += error * error;
+        }
+    }
+
+    float snr = static_cast<float>(10.0 * log10(signal / MAX(noise, 1.0)));
+    TC_PRINT("%u packets, SNR %.1f dB\n", static_cast<unsigned>(received), static_cast<double>(snr));
+
+    zassert_true(snr >= minSnr, "SNR %.1f dB", static_cast<double>(snr));
+}
+
+ZTEST(ima_adpcm, test_gap_discards_partial_packet)
+{
+    constexpr size_t first = 100;
+    constexpr size_t dropped = blockSamples;
+
+    adpcm.Process(pcmFixture, first);
+    adpcm.Skip(dropped);
+    Encode(pcmFixture + first + dropped, DmicAdpcm::SamplesPerPacket);
+
+    zassert_equal(received, 1);
+    zassert_equal(sys_get_le16(packets[0]), 0, "sequence counts sent packets only");
+    zassert_equal(sys_get_le32(packets[0] + 2), first + dropped, "first sample index after gap");
+
+    // Restart discards the partial packet of the next block, samples are still counted
+    adpcm.Process(pcmFixture, first);
+    adpcm.Restart();
+    Encode(pcmFixture, DmicAdpcm::SamplesPerPacket);
+
+    zassert_equal(received, 2);
+    zassert_equal(sys_get_le16(packets[1]), 1);
+    zassert_equal(sys_get_le32(packets[1] + 2), first + dropped + DmicAdpcm::SamplesPerPacket + first);
+}
+
+ZTEST(ima_adpcm, test_disabled_stream_sends_nothing)
+{
+    zassert_false(adpcm.SetEnabled(2));
+    zassert_true(adpcm.SetEnabled(0));
+    Encode(pcmFixture, 2 * DmicAdpcm::SamplesPerPacket);
+    zassert_equal(received, 0);
+
+    // Samples are counted while the stream is off
+    zassert_true(adpcm.SetEnabled(1));
+    Encode(pcmFixture, DmicAdpcm::SamplesPerPacket);
+    zassert_equal(received, 1);
+    zassert_equal(sys_get_le16(packets[0]), 0);
+    zassert_equal(sys_get_le32(packets[0] + 2), 2 * DmicAdpcm::SamplesPerPacket);
+}
+
+ZTEST(ima_adpcm, test_encoder_speed)
+{
+    uint64_t ns = Encode(pcmFixture, sampleCount);
+    uint32_t nsPerSample = static_cast<uint32_t>(ns / sampleCount);
+
+    TC_PRINT("%u ns per sample, %u x real time\n", nsPerSample,
+             static_cast<unsigned>(NSEC_PER_SEC / PCM_FIXTURE_SAMPLE_RATE / MAX(nsPerSample, 1u)));
+
+#if CONFIG_CPU_CORTEX_M
+    zassert_true(nsPerSample <= timeBudgetNs, "%u ns per sample, budget %u", nsPerSample, timeBudgetNs);
+#else
+    ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(ima_adpcm, nullptr, nullptr, AdpcmBefore, nullptr, nullptr);
@@ -0,0 +1,343 @@
+#include <zephyr/ztest.h>
+
+#include <math.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/timing/timing.h>
+
+#include "orientation_fusion.hpp"
+#include "usb_comm_handler.hpp"
+
+/**
+ * @brief Accel/gyro sample with latest magnetometer sample and reference orientation
+ */
+struct ImuFixtureSample
+{
+    int16_t imu[6];          ///< Accel XYZ, gyro XYZ, raw counts
+    int16_t magnetometer[3]; ///< Magnetometer XYZ, raw counts
+    bool newMagnetometer;    ///< Magnetometer sample arrived before this accel/gyro sample
+    float q[4];              ///< Reference orientation w, x, y, z
+};
+
+#include "imu_fixture.inc"
+#if IMU_RECORDING
+#include "imu_recording.inc"
+#endif
+
+/*
+ * Replays accel, gyro and magnetometer samples generated by scripts/imu_fixture.py and compares quaternion records
+ * with the reference orientation. The synthetic signal has an exact reference orientation. A capture committed as
+ * recordings/imu.csv, taken with scripts/sensor_capture.py, is replayed against the orientation records of the
+ * firmware it was captured with. Samples are stamped with their sample time, like the MPU6050 driver stamps FIFO
+ * samples, independent of the uptime during the replay.
+ */
+
+namespace
+{
+    /**
+     * @brief Replayed samples
+     */
+    struct Fixture
+    {
+        const ImuFixtureSample *samples; ///< Accel/gyro samples with magnetometer and reference
+        size_t count;                    ///< Number of samples
+        uint32_t sampleRate;             ///< Accel/gyro sample rate, Hz
+        float gyroLsbPerDps;             ///< Gyro sensitivity
+    };
+
+    constexpr Fixture synthetic = {imuFixture, ARRAY_SIZE(imuFixture), IMU_FIXTURE_SAMPLE_RATE,
+                                   IMU_FIXTURE_GYRO_LSB_PER_DPS};
+#if IMU_RECORDING
+    constexpr Fixture recording = {imuRecording, ARRAY_SIZE(imuRecording), IMU_RECORDING_SAMPLE_RATE,
+                                   IMU_RECORDING_GYRO_LSB_PER_DPS};
+#endif
+
+    constexpr size_t sampleCount = synthetic.count;
+    constexpr size_t settleSeconds = 4;        ///< Filter converges from identity, not checked
+    constexpr size_t settleSamples = settleSeconds * IMU_FIXTURE_SAMPLE_RATE;
+    constexpr int64_t startUs = 1000000;       ///< Sample time of the first sample
+    constexpr float maxErrorTolerance = 3.0f;  ///< Error of one record, degrees
+    constexpr float meanErrorTolerance = 1.0f; ///< Average error of all records, degrees
+    constexpr float gyroOnlyTolerance = 8.0f;  ///< Error after 2 s without magnetometer, heading follows gyro bias
+    constexpr uint32_t cycleBudget = 1500;     ///< Cycles per update on Cortex-M, about 2 % of a 1 kHz sample at 64 MHz
+
+    SerialController serial;
+    UsbCommHandler usb(serial);
+    OrientationFusion fusion(usb);
+
+    Bluetooth::BleControlAction orientationCommand; ///< Handler registered by Initialize
+
+    struct Replay
+    {
+        size_t records;
+        size_t checked;
+        float errorSum;
+        float maxError;
+        uint32_t maxCycles;
+        uint64_t totalNs;
+        float last[4]; ///< Latest published orientation
+        uint32_t timestamp; ///< Timestamp of latest record, ms
+    };
+
+    Replay replay;
+    const Fixture *replayed = &synthetic; ///< Fixture being replayed
+    size_t currentSample; ///< Fixture sample of the filter update in progress
+
+    /**
+     * @brief Uptime when a fixture sample was taken, µs
+     */
+    int64_t SampleTimeUs(const Fixture &fixture, size_t sample)
+    {
+        return startUs + static_cast<int64_t>(sample) * USEC_PER_SEC / fixture.sampleRate;
+    }
+
+    /**
+     * @brief Angle of rotation between two unit quaternions, degrees
+     */
+    float Difference(const float *a, const float *b)
+    {
+        float dot = fabsf(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]);
+        return 2.0f * acosf(MIN(dot, 1.0f)) * 180.0f / 3.14159265f;
+    }
+
+    bool Command(OrientationCommand command, const uint8_t *data = nullptr, uint8_t length = 0)
+    {
+        Bluetooth::CommandKey key = {};
+        key.key[0] = static_cast<uint8_t>(command);
+
+        return orientationCommand(data, key, Bluetooth::BleLength{length}, Bluetooth::BleOffset{0});
+    }
+
+    /**
+     * @brief Feed fixture samples in the byte order of the sensors
+     *
+     * @param first first sample
+     * @param count number of samples
+     * @param magnetometers false drops magnetometer samples
+     * @param fixture replayed samples
+     */
+    void Run(size_t first, size_t count, bool magnetometers = true, const Fixture &fixture = synthetic)
+    {
+        uint8_t imu[12];
+        uint8_t magnetometer[6];
+
+        replayed = &fixture;
+
+        timing_start();
+        timing_t start = timing_counter_get();
+
+        for (currentSample = first; currentSample < MIN(first + count, fixture.count); ++currentSample)
+        {
+            const ImuFixtureSample &sample = fixture.samples[currentSample];
+            int64_t timeUs = SampleTimeUs(fixture, currentSample);
+
+            if (sample.newMagnetometer && magnetometers)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    sys_put_le16(static_cast<uint16_t>(sample.magnetometer[i]), magnetometer + 2 * i);
+                }
+                fusion.UpdateMagnetometer(magnetometer, timeUs);
+            }
+
+            for (size_t i = 0; i < 6; ++i)
+            {
+                sys_put_be16(static_cast<uint16_t>(sample.imu[i]), imu + 2 * i);
+            }
+            fusion.UpdateImu(imu, timeUs);
+        }
+
+        timing_t end = timing_counter_get();
+        replay.totalNs += timing_cycles_to_ns(timing_cycles_get(&start, &end));
+        timing_stop();
+
+        replay.maxCycles = MAX(replay.maxCycles, fusion.GetMaxCycles());
+    }
+
+    void FusionBefore(void *)
+    {
+        fusion.Initialize();
+        fusion.SetImuConfig(synthetic.sampleRate, synthetic.gyroLsbPerDps);
+        replay = {};
+    }
+}
+
+/*
+ * Link seams: records are captured here instead of BLE and USB stacks, which the test does not build
+ */
+
+namespace Bluetooth
+{
+    void OrientationNotify(const uint8_t *data, const uint8_t len)
+    {
+        zassert_equal(len, OrientationFusion::RecordSize);
+        replay.records++;
+        replay.timestamp = sys_get_le32(data + 1);
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            replay.last[i] = static_cast<int16_t>(sys_get_le16(data + 5 + 2 * i)) / 16384.0f;
+        }
+
+        if (currentSample < settleSeconds * replayed->sampleRate)
+        {
+            return;
+        }
+
+        float error = Difference(replay.last, replayed->samples[currentSample].q);
+        replay.checked++;
+        replay.errorSum += error;
+        replay.maxError = MAX(replay.maxError, error);
+    }
+
+    void GattRegisterControlCallback(CommandId commandId, BleControlAction &&action)
+    {
+        zassert_equal(commandId, CommandId::OrientationCmd);
+        orientationCommand = std::move(action);
+    }
+}
+
+SerialController::SerialController()
+{
+}
+
+uint8_t SerialController::GetStatus()
+{
+    return 0;
+}
+
+UsbCommHandler::UsbCommHandler(SerialController &serial) : serial(serial)
+{
+}
+
+bool UsbCommHandler::SendData(SensorId sensorId, const uint8_t *buffer, size_t length)
+{
+    zassert_equal(sensorId, SensorId::Orientation);
+    ARG_UNUSED(buffer);
+    ARG_UNUSED(length);
+    return true;
+}
+
+ZTEST(orientation_fusion, test_replay_accuracy)
+{
+    Run(0, sampleCount);
+
+    zassert_true(replay.checked > 0, "fixture shorter than settling time");
+
+    float meanError = replay.errorSum / replay.checked;
+    TC_PRINT("%u records, mean error %.2f deg, max error %.2f deg\n", static_cast<unsigned>(replay.checked),
+             static_cast<double>(meanError), static_cast<double>(replay.maxError));
+
+    zassert_true(meanError <= meanErrorTolerance, "mean error %.2f deg", static_cast<double>(meanError));
+    zassert_true(replay.maxError <= maxErrorTolerance, "max error %.2f deg", static_cast<double>(replay.maxError));
+}
+
+ZTEST(orientation_fusion, test_recording_regression)
+{
+#if IMU_RECORDING
+    fusion.SetImuConfig(recording.sampleRate, recording.gyroLsbPerDps);
+    Run(0, recording.count, true, recording);
+
+    zassert_true(replay.checked > 0, "recording shorter than settling time");
+
+    float meanError = replay.errorSum / replay.checked;
+    TC_PRINT("%u records, mean difference %.2f deg, max difference %.2f deg\n", static_cast<unsigned>(replay.checked),
+             static_cast<double>(meanError), static_cast<double>(replay.maxError));
+
+    zassert_true(meanError <= meanErrorTolerance, "mean difference %.2f deg", static_cast<double>(meanError));
+    zassert_true(replay.maxError <= maxErrorTolerance, "max difference %.2f deg", static_cast<double>(replay.maxError));
+#else
+    TC_PRINT("No IMU recording\n");
+    ztest_test_skip();
+#endif
+}
+
+ZTEST(orientation_fusion, test_record_timestamps_are_sample_times)
+{
+    uint32_t output = IMU_FIXTURE_SAMPLE_RATE / CONFIG_ORIENTATION_OUTPUT_RATE;
+
+    // Whole replay takes far less uptime than the samples span, so uptime stamps would all be equal
+    for (size_t i = 0; i < 5; ++i)
+    {
+        Run(i * output, output);
+        zassert_equal(replay.records, i + 1);
+        zassert_equal(replay.timestamp, SampleTimeUs(synthetic, (i + 1) * output - 1) / USEC_PER_MSEC,
+                      "record %u", static_cast<unsigned>(i));
+    }
+}
+
+ZTEST(orientation_fusion, test_stale_magnetometer_is_ignored)
+{
+    // Magnetometer samples stop while heading turns fastest, at 8 s. The last one must not hold heading back
+    constexpr size_t gapFirst = 7 * IMU_FIXTURE_SAMPLE_RATE;
+    constexpr size_t gapSamples = 2 * IMU_FIXTURE_SAMPLE_RATE;
+
+    Run(0, gapFirst);
+    replay.maxError = 0.0f;
+    Run(gapFirst, gapSamples, false);
+
+    TC_PRINT("max error %.2f deg without magnetometer\n", static_cast<double>(replay.maxError));
+    zassert_true(replay.maxError <= gyroOnlyTolerance, "error %.2f deg", static_cast<double>(replay.maxError));
+}
+
+ZTEST(orientation_fusion, test_output_rate)
+{
+    Run(0, IMU_FIXTURE_SAMPLE_RATE);
+    zassert_equal(replay.records, CONFIG_ORIENTATION_OUTPUT_RATE, "records in one second");
+
+    const uint8_t rate = 10;
+    zassert_true(Command(OrientationCommand::SetRate, &rate, sizeof(rate)));
+    replay.records = 0;
+    Run(IMU_FIXTURE_SAMPLE_RATE, IMU_FIXTURE_SAMPLE_RATE);
+    zassert_equal(replay.records, rate, "records in one second");
+
+    const uint8_t stop = 0;
+    zassert_true(Command(OrientationCommand::SetRate, &stop, sizeof(stop)));
+    replay.records = 0;
+    Run(2 * IMU_FIXTURE_SAMPLE_RATE, IMU_FIXTURE_SAMPLE_RATE);
+    zassert_equal(replay.records, 0, "records after output was stopped");
+}
+
+ZTEST(orientation_fusion, test_reset_restarts_from_identity)
+{
+    // Converged, then higher gain so that it converges again within a few seconds
+    Run(0, settleSamples);
+    const uint8_t gain[] = {0xF4, 0x01};
+    zassert_true(Command(OrientationCommand::SetGain, gain, sizeof(gain)));
+    zassert_true(Command(OrientationCommand::Reset));
+
+    size_t records = replay.records;
+    Run(settleSamples, 1);
+    zassert_equal(replay.records, records, "no record after one sample");
+
+    // First record after reset is a few filter steps away from identity
+    const float identity[] = {1.0f, 0.0f, 0.0f, 0.0f};
+    uint32_t output = IMU_FIXTURE_SAMPLE_RATE / CONFIG_ORIENTATION_OUTPUT_RATE;
+    Run(settleSamples + 1, output - 1);
+    zassert_equal(replay.records, records + 1);
+    zassert_true(Difference(replay.last, identity) <= 3.0f, "orientation was not reset");
+
+    // Converges again, only the last second is checked
+    Run(settleSamples + output, 3 * IMU_FIXTURE_SAMPLE_RATE);
+    replay.maxError = 0.0f;
+    Run(settleSamples + output + 3 * IMU_FIXTURE_SAMPLE_RATE, IMU_FIXTURE_SAMPLE_RATE);
+    zassert_true(replay.maxError <= maxErrorTolerance, "error %.2f deg after reset", static_cast<double>(replay.maxError));
+
+    zassert_false(Command(OrientationCommand::SetGain, nullptr, 0), "gain without data");
+}
+
+ZTEST(orientation_fusion, test_cycles_per_update)
+{
+    Run(0, sampleCount);
+
+    TC_PRINT("%u ns per update, max %u cycles per update\n",
+             static_cast<unsigned>(replay.totalNs / sampleCount), replay.maxCycles);
+
+#if CONFIG_CPU_CORTEX_M
+    zassert_true(replay.maxCycles <= cycleBudget, "%u cycles per update, budget %u", replay.maxCycles, cycleBudget);
+#else
+    ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(orientation_fusion, nullptr, nullptr, FusionBefore, nullptr, nullptr);
@@ -0,0 +1,212 @@
+#include <zephyr/ztest.h>
+
+#include <stdlib.h>
+
+#include <zephyr/timing/timing.h>
+
+#include "ppg_processor.hpp"
+
+#include "ppg_fixture.inc"
+#if PPG_RECORDING
+#include "ppg_recording.inc"
+#endif
+
+/*
+ * Replays MAX30102 Red/IR samples through the pipeline. A recording committed as recordings/max30102.csv, captured
+ * with scripts/sensor_capture.py next to a clinical pulse oximeter, checks heart rate and SpO2 against the oximeter.
+ * The synthetic signal of scripts/ppg_fixture.py has no SpO2 of its own, so it checks heart rate, the R ratio measured
+ * by the pipeline and the edge cases only.
+ */
+
+namespace
+{
+    /**
+     * @brief Replayed samples with reference values
+     */
+    struct Fixture
+    {
+        const uint32_t (*samples)[2]; ///< Red/IR samples
+        size_t count;                 ///< Number of samples
+        uint32_t sampleRate;          ///< Effective sample rate, Hz
+        int heartRate;                ///< Reference heart rate, bpm
+        int spo2;                     ///< Reference SpO2, %, 0 if unknown
+        uint32_t ratio;               ///< R ratio of the signal, Q10, 0 if unknown
+    };
+
+    constexpr Fixture synthetic = {ppgFixture, ARRAY_SIZE(ppgFixture), PPG_FIXTURE_SAMPLE_RATE,
+                                   PPG_FIXTURE_HEART_RATE, PPG_FIXTURE_SPO2, PPG_FIXTURE_RATIO_Q10};
+#if PPG_RECORDING
+    constexpr Fixture recording = {ppgRecording, ARRAY_SIZE(ppgRecording), PPG_RECORDING_SAMPLE_RATE,
+                                   PPG_RECORDING_HEART_RATE, PPG_RECORDING_SPO2, PPG_RECORDING_RATIO_Q10};
+#endif
+
+    constexpr size_t settleSeconds = 10;      ///< Filters and beat intervals settle, records are not checked
+    constexpr int meanHeartRateTolerance = 2; ///< Error of average over all records, bpm
+    constexpr int spo2Tolerance = 4;          ///< Error of one record against the reference oximeter, %
+    constexpr int meanSpo2Tolerance = 2;      ///< Error of average over all records, %, about the oximeter accuracy
+    constexpr int ratioTolerance = 10;        ///< Error of R of one beat, %, SpO2 smooths it over beats
+    constexpr int meanRatioTolerance = 2;     ///< Error of average R over all records, %
+    constexpr int minValidPercent = 90;       ///< Records after settling with heart rate and SpO2
+    constexpr uint32_t cycleBudget = 2000;    ///< Cycles per sample on Cortex-M, 0.2 % of a 50 Hz sample at 64 MHz
+
+    PpgProcessor processor;
+
+    struct Replay
+    {
+        size_t records;
+        size_t valid;
+        int heartRateSum;
+        int spo2Sum;
+        int maxHeartRateError;
+        int maxSpo2Error;
+        uint32_t ratioSum; ///< Q10
+        int maxRatioError; ///< %
+        uint32_t maxQuality;
+        uint32_t maxCycles;
+        uint64_t totalNs;
+    };
+
+    /**
+     * @brief Error of one record, 5 bpm or 5 %. Record averages 4 beats, and one sample of interval at 50 Hz is 4 %
+     *        at 110 bpm
+     */
+    constexpr int HeartRateTolerance(int heartRate)
+    {
+        return MAX(5, heartRate * 5 / 100);
+    }
+
+    /**
+     * @brief Process whole fixture and collect vitals records after settling time
+     *
+     * @param fixture replayed samples
+     * @param scale divider of the samples, 1 replays them unchanged
+     */
+    Replay Run(const Fixture &fixture, uint32_t scale = 1)
+    {
+        Replay replay = {};
+        PpgProcessor::Vitals vitals;
+
+        processor.Initialize(fixture.sampleRate);
+
+        timing_start();
+        timing_t start = timing_counter_get();
+
+        for (size_t i = 0; i < fixture.count; ++i)
+        {
+            processor.Process(fixture.samples[i][0] / scale, fixture.samples[i][1] / scale);
+
+            if (!processor.GetVitals(vitals))
+            {
+                continue;
+            }
+
+            replay.maxCycles = MAX(replay.maxCycles, processor.GetMaxCycles());
+            if (vitals.counter < settleSeconds)
+            {
+                continue;
+            }
+
+            replay.records++;
+            replay.maxQuality = MAX(replay.maxQuality, vitals.quality);
+            if (vitals.heartRate == 0 || vitals.spo2 == 0)
+            {
+                continue;
+            }
+
+            replay.valid++;
+            replay.heartRateSum += vitals.heartRate;
+            replay.spo2Sum += vitals.spo2;
+            replay.maxHeartRateError = MAX(replay.maxHeartRateError, abs(vitals.heartRate - fixture.heartRate));
+            if (fixture.spo2 != 0)
+            {
+                replay.maxSpo2Error = MAX(replay.maxSpo2Error, abs(vitals.spo2 - fixture.spo2));
+            }
+            if (fixture.ratio != 0)
+            {
+                replay.ratioSum += processor.GetRatio();
+                int error = abs(static_cast<int>(processor.GetRatio()) - static_cast<int>(fixture.ratio));
+                replay.maxRatioError = MAX(replay.maxRatioError, error * 100 / static_cast<int>(fixture.ratio));
+            }
+        }
+
+        timing_t end = timing_counter_get();
+        replay.totalNs = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+        timing_stop();
+
+        return replay;
+    }
+
+    /**
+     * @brief Check that enough records have vitals and heart rate matches the reference
+     */
+    void CheckHeartRate(const Replay &replay, const Fixture &fixture)
+    {
+        zassert_true(replay.records > 0, "fixture shorter than settling time");
+        zassert_true(replay.valid > 0, "no record with vitals");
+
+        int heartRate = (replay.heartRateSum + static_cast<int>(replay.valid) / 2) / static_cast<int>(replay.valid);
+        TC_PRINT("%u of %u records valid, HR %d bpm (max error %d)\n", static_cast<unsigned>(replay.valid),
+                 static_cast<unsigned>(replay.records), heartRate, replay.maxHeartRateError);
+
+        zassert_true(replay.valid * 100 >= replay.records * minValidPercent, "too many records without vitals");
+        zassert_within(heartRate, fixture.heartRate, meanHeartRateTolerance);
+        zassert_true(replay.maxHeartRateError <= HeartRateTolerance(fixture.heartRate), "heart rate error %d bpm",
+                     replay.maxHeartRateError);
+    }
+}
+
+ZTEST(ppg_processor, test_recording_accuracy)
+{
+#if PPG_RECORDING
+    Replay replay = Run(recording);
+    CheckHeartRate(replay, recording);
+
+    int spo2 = (replay.spo2Sum + static_cast<int>(replay.valid) / 2) / static_cast<int>(replay.valid);
+    TC_PRINT("SpO2 %d %% (max error %d), oximeter %d %%\n", spo2, replay.maxSpo2Error, recording.spo2);
+
+    zassert_within(spo2, recording.spo2, meanSpo2Tolerance);
+    zassert_true(replay.maxSpo2Error <= spo2Tolerance, "SpO2 error %d %%", replay.maxSpo2Error);
+#else
+    TC_PRINT("No MAX30102 recording, SpO2 calibration is not checked\n");
+    ztest_test_skip();
+#endif
+}
+
+ZTEST(ppg_processor, test_synthetic_heart_rate_and_ratio)
+{
+    Replay replay = Run(synthetic);
+    CheckHeartRate(replay, synthetic);
+
+    int ratio = static_cast<int>(replay.ratioSum / replay.valid);
+    int ratioError = abs(ratio - static_cast<int>(synthetic.ratio)) * 100 / static_cast<int>(synthetic.ratio);
+    TC_PRINT("R %d/1024 (max error %d %%), synthetic %u/1024\n", ratio, replay.maxRatioError, synthetic.ratio);
+
+    zassert_true(ratioError <= meanRatioTolerance, "mean R error %d %%", ratioError);
+    zassert_true(replay.maxRatioError <= ratioTolerance, "R error %d %%", replay.maxRatioError);
+}
+
+ZTEST(ppg_processor, test_no_contact_reports_no_vitals)
+{
+    // IR level of an empty sensor, below the contact threshold
+    Replay replay = Run(synthetic, 4);
+
+    zassert_true(replay.records > 0, "fixture shorter than settling time");
+    zassert_equal(replay.valid, 0, "vitals without contact");
+    zassert_equal(replay.maxQuality, 0, "quality without contact");
+}
+
+ZTEST(ppg_processor, test_cycles_per_sample)
+{
+    Replay replay = Run(synthetic);
+
+    TC_PRINT("%u ns per sample, max %u cycles per sample\n",
+             static_cast<unsigned>(replay.totalNs / synthetic.count), replay.maxCycles);
+
+#if CONFIG_CPU_CORTEX_M
+    zassert_true(replay.maxCycles <= cycleBudget, "%u cycles per sample, budget %u", replay.maxCycles, cycleBudget);
+#else
+    ztest_test_skip();
+#endif
+}
+
+ZTEST_SUITE(ppg_processor, nullptr, nullptr, nullptr, nullptr, nullptr);
@@ -0,0 +1,230 @@
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include "recorder.hpp"
+
+/*
+ * Flash layout written before Recorder is initialized, a ring which has wrapped once:
+ *  - slot 0:      block with sequence 17 torn by a reset while it replaced sequence 1, CRC does not match
+ *  - slots 1..15: valid blocks, sequence 2..16
+ *
+ * Tests run in name order and build on each other.
+ */
+
+namespace
+{
+    constexpr size_t slotCount = CONFIG_RECORDER_FLASH_SIZE / Recorder::BlockSize;
+    constexpr size_t headerSize = sizeof(Recorder::BlockHeader);
+    constexpr size_t recordHeaderSize = 6;
+    constexpr size_t chunkHeaderSize = 6;
+    constexpr uint32_t endMarker = 0xFFFFFFFF;
+    constexpr int waitStepMs = 10;
+    constexpr int waitTimeoutMs = 2000;
+
+    const device *flash = DEVICE_DT_GET(DT_ALIAS(recorder_flash));
+    Recorder recorder;
+
+    uint8_t block[Recorder::BlockSize];
+
+    /**
+     * @brief Offloaded data, collected by the sink on recorder thread
+     */
+    struct
+    {
+        uint32_t sequences[slotCount];
+        uint8_t data[slotCount][Recorder::BlockSize];
+        size_t blocks;
+        uint16_t endCount;
+        bool malformed;
+    } offload;
+
+    K_SEM_DEFINE(offloadDone, 0, 1);
+
+    /**
+     * @brief Build block with `count` records of 12 bytes in the RAM buffer, in the format written by Recorder
+     *
+     * @param sequence block sequence number
+     * @param count    number of records
+     */
+    void BuildBlock(uint32_t sequence, uint16_t count)
+    {
+        memset(block, 0xFF, sizeof(block));
+
+        uint16_t used = 0;
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            uint16_t offset = headerSize + used;
+            uint8_t *record = block + offset;
+
+            record[0] = static_cast<uint8_t>(SensorId::Mpu6050);
+            record[1] = 12;
+            sys_put_le32(sequence * 100 + i, record + 2);
+            memset(record + recordHeaderSize, sequence + i, 12);
+            sys_put_le16(offset, block + Recorder::BlockSize - (i + 1) * 2);
+
+            used += recordHeaderSize + 12;
+        }
+
+        Recorder::BlockHeader *header = reinterpret_cast<Recorder::BlockHeader *>(block);
+        header->magic = Recorder::BlockMagic;
+        header->sequence = sequence;
+        header->count = count;
+        header->used = used;
+        header->crc = crc32_ieee(block + headerSize, Recorder::BlockSize - headerSize);
+    }
+
+    off_t SlotOffset(uint32_t slot)
+    {
+        return CONFIG_RECORDER_FLASH_OFFSET + slot * Recorder::BlockSize;
+    }
+
+    void WriteSlot(uint32_t slot)
+    {
+        zassert_ok(flash_erase(flash, SlotOffset(slot), Recorder::BlockSize));
+        zassert_ok(flash_write(flash, SlotOffset(slot), block, Recorder::BlockSize));
+    }
+
+    uint32_t InfoField(size_t offset)
+    {
+        uint8_t info[Recorder::InfoSize];
+        zassert_equal(recorder.GetInfo(info), Recorder::InfoSize);
+        return sys_get_le32(info + offset);
+    }
+
+    /**
+     * @brief Collect offloaded chunks. Chunks of one block arrive in order, blocks from oldest to newest
+     */
+    bool OffloadSink(const uint8_t *buffer, size_t length)
+    {
+        uint32_t sequence = sys_get_le32(buffer);
+        uint16_t offset = sys_get_le16(buffer + 4);
+
+        if (sequence == endMarker)
+        {
+            offload.endCount = offset;
+            k_sem_give(&offloadDone);
+            return true;
+        }
+
+        if (offset == 0)
+        {
+            if (offload.blocks == slotCount)
+            {
+                offload.malformed = true;
+                return true;
+            }
+            offload.sequences[offload.blocks++] = sequence;
+        }
+
+        size_t size = length - chunkHeaderSize;
+        if (offload.blocks == 0 || offload.sequences[offload.blocks - 1] != sequence ||
+            offset + size > Recorder::BlockSize)
+        {
+            offload.malformed = true;
+            return true;
+        }
+
+        memcpy(offload.data[offload.blocks - 1] + offset, buffer + chunkHeaderSize, size);
+        return true;
+    }
+
+    void *RecorderSetup()
+    {
+        zassert_true(device_is_ready(flash));
+        zassert_ok(flash_erase(flash, CONFIG_RECORDER_FLASH_OFFSET, CONFIG_RECORDER_FLASH_SIZE));
+
+        for (uint32_t slot = 1; slot < slotCount; ++slot)
+        {
+            BuildBlock(slot + 1, 10 + slot);
+            WriteSlot(slot);
+        }
+
+        // Reset during the write of slot 0: header is complete, the last records are missing
+        BuildBlock(slotCount + 1, 20);
+        memset(block + headerSize + 10 * (recordHeaderSize + 12), 0xFF, 10 * (recordHeaderSize + 12));
+        WriteSlot(0);
+
+        zassert_ok(recorder.Initialize(OffloadSink));
+        return nullptr;
+    }
+}
+
+ZTEST(recorder, test_1_boot_scan_skips_torn_block)
+{
+    zassert_equal(InfoField(1), slotCount - 1, "used blocks");
+    zassert_equal(InfoField(5), 2, "oldest sequence");
+    zassert_equal(InfoField(9), slotCount, "newest sequence");
+}
+
+ZTEST(recorder, test_2_append_resumes_at_torn_block)
+{
+    const uint8_t packet[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+    recorder.Start();
+    for (int i = 0; i < 3; ++i)
+    {
+        recorder.Append(SensorId::Mpu6050, packet, sizeof(packet));
+    }
+    recorder.Stop();
+
+    for (int waited = 0; InfoField(1) != slotCount && waited < waitTimeoutMs; waited += waitStepMs)
+    {
+        k_msleep(waitStepMs);
+    }
+    zassert_equal(InfoField(1), slotCount, "block was not written");
+    zassert_equal(InfoField(5), 2, "oldest sequence");
+    zassert_equal(InfoField(9), slotCount + 1, "newest sequence");
+
+    // New block replaces the torn one
+    zassert_ok(flash_read(flash, SlotOffset(0), block, sizeof(block)));
+    const Recorder::BlockHeader *header = reinterpret_cast<const Recorder::BlockHeader *>(block);
+    zassert_equal(header->magic, Recorder::BlockMagic);
+    zassert_equal(header->sequence, slotCount + 1);
+    zassert_equal(header->count, 3);
+    zassert_equal(header->used, 3 * (recordHeaderSize + sizeof(packet)));
+    zassert_equal(header->crc, crc32_ieee(block + headerSize, Recorder::BlockSize - headerSize));
+
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        uint16_t offset = sys_get_le16(block + Recorder::BlockSize - (i + 1) * 2);
+        zassert_equal(offset, headerSize + i * (recordHeaderSize + sizeof(packet)));
+        zassert_equal(block[offset], static_cast<uint8_t>(SensorId::Mpu6050));
+        zassert_equal(block[offset + 1], sizeof(packet));
+        zassert_mem_equal(block + offset + recordHeaderSize, packet, sizeof(packet));
+    }
+}
+
+ZTEST(recorder, test_3_offload_skips_bad_crc)
+{
+    // Flip one erased byte in the free area of slot 2 (sequence 3)
+    const uint8_t zero = 0;
+    zassert_ok(flash_write(flash, SlotOffset(2) + Recorder::BlockSize / 2, &zero, 1));
+
+    memset(&offload, 0, sizeof(offload));
+    k_sem_reset(&offloadDone);
+
+    recorder.Offload();
+    zassert_ok(k_sem_take(&offloadDone, K_MSEC(waitTimeoutMs)), "offload did not finish");
+
+    zassert_false(offload.malformed);
+    zassert_equal(offload.endCount, slotCount - 1);
+    zassert_equal(offload.blocks, slotCount - 1);
+
+    // Oldest to newest: slot 1, slots 3..15, then slot 0 written after the wrap
+    for (size_t i = 0; i < offload.blocks; ++i)
+    {
+        uint32_t slot = (i == 0 ? 1 : i + 2) % slotCount;
+        uint32_t expected = slot == 0 ? slotCount + 1 : slot + 1;
+
+        zassert_equal(offload.sequences[i], expected);
+        zassert_ok(flash_read(flash, SlotOffset(slot), block, sizeof(block)));
+        zassert_mem_equal(offload.data[i], block, sizeof(block), "block %u differs", expected);
+    }
+}
+
+ZTEST_SUITE(recorder, nullptr, RecorderSetup, nullptr, nullptr, nullptr);